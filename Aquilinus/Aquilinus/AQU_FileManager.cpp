@@ -38,9 +38,12 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define NODE_HASH_SIZE (sizeof(size_t))
 const char* szWHeader_v1_0_0 = "VIREIO_AQ_WORKING_AREA_V01.0.0";
 const char* szPHeader_v1_0_0 = "VIREIO_AQ_GAME_PROFILE_V01.0.0";
+#define AQU_E_WRONG_HEADER ((HRESULT)0x80041001L)
+#define AQU_E_CORRUPT_BLOCK ((HRESULT)0x80041002L)
 
 #include"AQU_FileManager.h"
 #include"AQU_GlobalTypes.h"
+#include<thread>
 
 /// <summary> 
 /// Constructor.
@@ -72,6 +75,43 @@ AQU_FileManager::~AQU_FileManager()
 	}
 }
 
+/// <summary>
+/// Allocates from the current chunk, creates a new chunk if it does not fit.
+/// </summary>
+void* AQU_DataArena::Allocate(size_t nSize, size_t nAlignment)
+{
+	if (m_asChunks.size())
+	{
+		Chunk& sChunk = m_asChunks.back();
+		size_t nOffset = (sChunk.nUsed + nAlignment - 1) & ~(nAlignment - 1);
+		if (nOffset + nSize <= sChunk.nSize)
+		{
+			sChunk.nUsed = nOffset + nSize;
+			return sChunk.pcData + nOffset;
+		}
+	}
+
+	// new chunk, at least 64KB
+	const size_t nChunkSizeMin = 65536;
+	Chunk sChunk;
+	sChunk.nSize = (std::max)(nSize, nChunkSizeMin);
+	sChunk.pcData = (BYTE*)_aligned_malloc(sChunk.nSize, (std::max)(nAlignment, (size_t)16));
+	if (!sChunk.pcData) return nullptr;
+	sChunk.nUsed = nSize;
+	m_asChunks.push_back(sChunk);
+	return sChunk.pcData;
+}
+
+/// <summary>
+/// Releases all chunks.
+/// </summary>
+void AQU_DataArena::Release()
+{
+	for (Chunk& sChunk : m_asChunks)
+		_aligned_free(sChunk.pcData);
+	m_asChunks.clear();
+}
+
 /// <summary>
 /// => Load working area basics
 /// Loads the basic information from a working area file for the Inicio app.
@@ -382,153 +422,289 @@ HRESULT AQU_FileManager::LoadProfileBasics(LPCWSTR szProfilePath, AquilinusCfg*
 
 /// <summary>
 /// => Load working area (stream)
-///  Load working area to pure data stream.
+///  Load working area to verified payload stream.
+///  Called from DllMain (loader lock), so the blocks are verified on this thread only.
 /// <param name="szWorkspacePath">The file path</param>
-/// <param name="sstrDataStream">The pure data stream</param>
+/// <param name="cArena">The arena the payload is allocated from</param>
+/// <param name="cDataStream">The payload data stream</param>
 /// </summary>
-HRESULT AQU_FileManager::LoadWorkingArea(LPWSTR szWorkspacePath, std::stringstream& sstrDataStream)
+HRESULT AQU_FileManager::LoadWorkingArea(LPWSTR szWorkspacePath, AQU_DataArena& cArena, AQU_DataStream& cDataStream)
 {
-	// first, clear the data stream
-	sstrDataStream.clear();
+	HRESULT nHr = LoadDataBlocks(szWorkspacePath, szWHeader_v1_0_0, WORKSPACE_HEADER_SIZE, cArena, cDataStream, false);
+	if (nHr == AQU_E_WRONG_HEADER)
+		OutputDebugString(L"Aquilinus : Wrong workspace file version !");
+	else if (nHr == AQU_E_CORRUPT_BLOCK)
+		OutputDebugString(L"Aquilinus : Corrupt workspace file !");
 
-	// open file
-	std::ifstream inFile;
-	inFile.open(szWorkspacePath, std::ios::in | std::ios::binary);
-	if (inFile.is_open())
+	return SUCCEEDED(nHr) ? S_OK : E_FAIL;
+}
+
+/// <summary>
+/// => Load profile (stream)
+///  Load profile to verified payload stream.
+///  Called from DllMain (loader lock), so the blocks are verified on this thread only.
+/// <param name="szProfilePath">The file path</param>
+/// <param name="cArena">The arena the payload is allocated from</param>
+/// <param name="cDataStream">The payload data stream</param>
+/// </summary>
+HRESULT AQU_FileManager::LoadProfile(LPWSTR szProfilePath, AQU_DataArena& cArena, AQU_DataStream& cDataStream)
+{
+	HRESULT nHr = LoadDataBlocks(szProfilePath, szPHeader_v1_0_0, PROFILE_HEADER_SIZE, cArena, cDataStream, false);
+	if (nHr == AQU_E_WRONG_HEADER)
+		OutputDebugString(L"Aquilinus : Wrong profile file version !");
+	else if (nHr == AQU_E_CORRUPT_BLOCK)
+		OutputDebugString(L"Aquilinus : Corrupt profile file !");
+
+	return SUCCEEDED(nHr) ? S_OK : E_FAIL;
+}
+
+/// <summary>
+/// => Decode nodes
+/// Decodes all node records and connections following the file options.
+/// If a pool is provided, all plugin binaries are pre-read in parallel meanwhile,
+/// so the (serialized) plugin loading later hits the file cache. Returns after
+/// all pre-reads are done.
+/// <param name="cDataStream">The payload data stream, positioned at the node number</param>
+/// <param name="asNodes">The decoded node records</param>
+/// <param name="pcPool">The worker pool, may be null. Must be null if called from DllMain (loader lock).</param>
+/// </summary>
+HRESULT AQU_FileManager::DecodeNodes(AQU_DataStream& cDataStream, std::vector<AQU_NodeRecord>& asNodes, AQU_ThreadPool* pcPool)
+{
+	// pre-reads a file in big chunks, the data itself is discarded
+	auto PrereadFile = [](std::wstring szPath)
 	{
-		// read header
-		int nVersion = -1;
-		char szHeaderCompare[WORKSPACE_HEADER_SIZE + 1];
-		inFile.read(szHeaderCompare, WORKSPACE_HEADER_SIZE);
-		szHeaderCompare[WORKSPACE_HEADER_SIZE] = 0;
-
-		// get file version
-		if (strcmp(szWHeader_v1_0_0, szHeaderCompare) == 0)
-			nVersion = 0;
-
-		// fail if version not supported
-		if (nVersion == -1)
-		{
-			OutputDebugString(L"Aquilinus : Wrong workspace file version !");
-			OutputDebugStringA(szHeaderCompare);
-			OutputDebugStringA(szWHeader_v1_0_0);
-			inFile.close();
-			return E_FAIL;
-		}
+		HANDLE hFile = CreateFileW(szPath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (hFile == INVALID_HANDLE_VALUE) return;
+		std::vector<BYTE> acBuffer(1 << 20);
+		DWORD dwRead = 0;
+		while (ReadFile(hFile, acBuffer.data(), (DWORD)acBuffer.size(), &dwRead, NULL) && dwRead) {}
+		CloseHandle(hFile);
+	};
+	std::vector<std::wstring> aszPlugins;
+
+	// read the number of nodes
+	unsigned __int32 dwNodeNumber = 0;
+	if (!cDataStream.Read(&dwNodeNumber, sizeof(unsigned __int32)))
+		return E_FAIL;
+	asNodes.clear();
+
+	// each node record has at least its id, position and data size, a bigger number means a corrupt file
+	if ((size_t)dwNodeNumber > cDataStream.GetRemaining() / (sizeof(unsigned __int32) * 4))
+	{
+		OutputDebugString(L"Aquilinus : Corrupt node number !");
+		return E_FAIL;
+	}
+	asNodes.resize(dwNodeNumber);
 
-		unsigned __int32 dwInputHash;
-		char pData[256];
-		while (inFile.good())
+	// loop through the nodes to get node data
+	for (AQU_NodeRecord& sNode : asNodes)
+	{
+		// get the node hash and position
+		cDataStream.Read(&sNode.dwId, sizeof(unsigned __int32));
+		cDataStream.Read(&sNode.fX, sizeof(float));
+		cDataStream.Read(&sNode.fY, sizeof(float));
+
+		// load plugin info (if plugin node)
+		sNode.dwPluginId = 0;
+		sNode.szFilePath[0] = 0;
+		if (sNode.dwId == ELEMENTARY_NODE_PLUGIN)
 		{
-			// read hash and data
-			inFile.read((char*)&dwInputHash, sizeof(unsigned __int32));
-			inFile.read(pData, 256);
+			wchar_t szFileName[64];
+			cDataStream.Read(&sNode.dwPluginId, sizeof(unsigned __int32));
+			cDataStream.Read(&szFileName[0], sizeof(wchar_t) * 64);
+			szFileName[63] = 0;
 
-			// get actual data size
-			int nActualSize = (int)inFile.gcount();
+			// create full path
+			wsprintf(sNode.szFilePath, L"%s%s", GetPluginPath(), szFileName);
 
-			// is there any data ?
-			if (nActualSize > 0)
+			// pre-read each plugin binary once
+			if ((pcPool) && (std::find(aszPlugins.begin(), aszPlugins.end(), std::wstring(sNode.szFilePath)) == aszPlugins.end()))
 			{
-				// get the hash for this data block
-				unsigned __int32 dwHash = this->GetHash((BYTE*)pData, (unsigned __int32)nActualSize);
+				aszPlugins.push_back(std::wstring(sNode.szFilePath));
+				std::wstring szPath(sNode.szFilePath);
+				pcPool->Submit([PrereadFile, szPath]() { PrereadFile(szPath); });
+			}
+		}
 
-				// compare hash, write data
-				if (dwHash == dwInputHash)
-					sstrDataStream.write(pData, nActualSize);
-				else
-				{
-					OutputDebugString(L"Aquilinus : Corrupt workspace file !");
-					inFile.close();
-					return E_FAIL;
-				}
+		// read node data size, get the data (points into the payload)
+		sNode.dwDataSize = 0;
+		cDataStream.Read(&sNode.dwDataSize, sizeof(unsigned __int32));
+		sNode.pcData = cDataStream.Get(sNode.dwDataSize);
+		if (!sNode.pcData) sNode.dwDataSize = 0;
+	}
+
+	// loop through the nodes to get node connections
+	for (AQU_NodeRecord& sNode : asNodes)
+	{
+		// get the number of commanders
+		unsigned __int32 dwCommandersNumber = 0;
+		cDataStream.Read(&dwCommandersNumber, sizeof(unsigned __int32));
+		if (!cDataStream.Good()) break;
+		if ((size_t)dwCommandersNumber > cDataStream.GetRemaining() / sizeof(unsigned __int32)) { cDataStream.Fail(); break; }
+		sNode.aasCommanderConnections.resize(dwCommandersNumber);
+
+		// loop through commanders, get the connection indices
+		for (std::vector<std::pair<LONG, LONG>>& asConnections : sNode.aasCommanderConnections)
+		{
+			unsigned __int32 dwConnectionsNumber = 0;
+			cDataStream.Read(&dwConnectionsNumber, sizeof(unsigned __int32));
+			if (!cDataStream.Good()) break;
+			if ((size_t)dwConnectionsNumber > cDataStream.GetRemaining() / (sizeof(LONG) * 2)) { cDataStream.Fail(); break; }
+			asConnections.resize(dwConnectionsNumber);
+			for (std::pair<LONG, LONG>& sConnection : asConnections)
+			{
+				cDataStream.Read(&sConnection.first, sizeof(LONG));
+				cDataStream.Read(&sConnection.second, sizeof(LONG));
 			}
 		}
 
-		inFile.close();
+		// get the provoker connections
+		unsigned __int32 dwConnectionsNumber = 0;
+		cDataStream.Read(&dwConnectionsNumber, sizeof(unsigned __int32));
+		if (!cDataStream.Good()) break;
+		if ((size_t)dwConnectionsNumber > cDataStream.GetRemaining() / sizeof(LONG)) { cDataStream.Fail(); break; }
+		sNode.alInvokerConnections.resize(dwConnectionsNumber);
+		for (LONG& lNodeIndex : sNode.alInvokerConnections)
+			cDataStream.Read(&lNodeIndex, sizeof(LONG));
 	}
-	else
-		return E_FAIL;
 
-	// set back binary stream
-	sstrDataStream.seekg(0);
-	sstrDataStream.seekp(0);
+	// wait for the plugin pre-reads
+	if (pcPool)
+		pcPool->WaitIdle();
+
+	if (!cDataStream.Good())
+	{
+		OutputDebugString(L"Aquilinus : Truncated node data !");
+		return E_FAIL;
+	}
 
 	return S_OK;
 }
 
 /// <summary>
-/// => Load profile (stream)
-///  Load profile to pure data stream.
-/// <param name="szWorkspacePath">The file path</param>
-/// <param name="sstrDataStream">The pure data stream</param>
+/// => Load data blocks
+/// Maps the file, verifies the hash of every 256 byte data block and gathers the
+/// block data into one contiguous payload allocated from the arena.
+/// Big files are verified on several threads if allowed, each block is independent.
+/// <param name="szPath">The file path</param>
+/// <param name="szHeader">The expected file header</param>
+/// <param name="nHeaderSize">The file header size</param>
+/// <param name="cArena">The arena the payload is allocated from</param>
+/// <param name="cDataStream">The payload data stream</param>
+/// <param name="bParallel">False if called from DllMain, threads can not start under the loader lock</param>
 /// </summary>
-HRESULT AQU_FileManager::LoadProfile(LPWSTR szProfilePath, std::stringstream& sstrDataStream)
+HRESULT AQU_FileManager::LoadDataBlocks(LPCWSTR szPath, const char* szHeader, size_t nHeaderSize, AQU_DataArena& cArena, AQU_DataStream& cDataStream, bool bParallel)
 {
-	sstrDataStream.clear();
+	cDataStream.Set(nullptr, 0);
 
-	// open file
-	std::ifstream inFile;
-	inFile.open(szProfilePath, std::ios::in | std::ios::binary);
-	if (inFile.is_open())
+	// map file
+	HANDLE hFile = CreateFileW(szPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return E_FAIL;
+
+	LARGE_INTEGER sFileSize = {};
+	if ((!GetFileSizeEx(hFile, &sFileSize)) || (sFileSize.QuadPart < (LONGLONG)nHeaderSize))
 	{
-		// read header
-		int nVersion = -1;
-		char szHeaderCompare[PROFILE_HEADER_SIZE + 1];
-		inFile.read(szHeaderCompare, PROFILE_HEADER_SIZE);
-		szHeaderCompare[PROFILE_HEADER_SIZE] = 0;
-
-		// get file version
-		if (strcmp(szPHeader_v1_0_0, szHeaderCompare) == 0)
-			nVersion = 0;
-
-		// fail if version not supported
-		if (nVersion == -1)
+		CloseHandle(hFile);
+		return AQU_E_WRONG_HEADER;
+	}
+
+	HANDLE hMapping = CreateFileMappingW(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	const BYTE* pcFile = hMapping ? (const BYTE*)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+	if (!pcFile)
+	{
+		if (hMapping) CloseHandle(hMapping);
+		CloseHandle(hFile);
+		return E_FAIL;
+	}
+
+	// header (version 1.0.0 right now)
+	HRESULT nHr = S_OK;
+	if (memcmp(pcFile, szHeader, nHeaderSize) != 0)
+	{
+		OutputDebugStringA(std::string((const char*)pcFile, nHeaderSize).c_str());
+		OutputDebugStringA(szHeader);
+		nHr = AQU_E_WRONG_HEADER;
+	}
+	else
+	{
+		// get block number and payload size, each block is the hash code plus up to 256 bytes
+		const size_t nBlockSize = sizeof(unsigned __int32) + 256;
+		size_t nDataSize = (size_t)sFileSize.QuadPart - nHeaderSize;
+		size_t nBlocks = (nDataSize + nBlockSize - 1) / nBlockSize;
+		size_t nLastBlockSize = nBlocks ? (nDataSize - (nBlocks - 1) * nBlockSize) : 0;
+		if ((nBlocks) && (nLastBlockSize <= sizeof(unsigned __int32)))
 		{
-			OutputDebugString(L"Aquilinus : Wrong profile file version !");
-			OutputDebugStringA(szHeaderCompare);
-			OutputDebugStringA(szPHeader_v1_0_0);
-			inFile.close();
-			return E_FAIL;
+			// trailing hash without data
+			nBlocks--;
+			nLastBlockSize = nBlocks ? nBlockSize : 0;
 		}
+		size_t nPayloadSize = nBlocks ? ((nBlocks - 1) * 256 + (nLastBlockSize - sizeof(unsigned __int32))) : 0;
 
-		unsigned __int32 dwInputHash;
-		char pData[256];
-		while (inFile.good())
+		char* pcPayload = (char*)cArena.Allocate(nPayloadSize ? nPayloadSize : 1);
+		if (!pcPayload)
 		{
-			// read hash and data
-			inFile.read((char*)&dwInputHash, sizeof(unsigned __int32));
-			inFile.read(pData, 256);
-
-			// get actual data size
-			int nActualSize = (int)inFile.gcount();
+			OutputDebugString(L"Aquilinus : Out of memory loading file !");
+			UnmapViewOfFile(pcFile);
+			CloseHandle(hMapping);
+			CloseHandle(hFile);
+			return E_OUTOFMEMORY;
+		}
+		const BYTE* pcBlocks = pcFile + nHeaderSize;
 
-			// is there any data ?
-			if (nActualSize > 0)
+		// verify and gather a range of blocks, returns false on hash mismatch
+		auto VerifyBlocks = [=](size_t nFirst, size_t nEnd) -> bool
+		{
+			for (size_t i = nFirst; i < nEnd; i++)
 			{
-				// get the hash for this data block
-				unsigned __int32 dwHash = this->GetHash((BYTE*)pData, (unsigned __int32)nActualSize);
-
-				// compare hash, write data
-				if (dwHash == dwInputHash)
-					sstrDataStream.write(pData, nActualSize);
-				else
-				{
-					OutputDebugString(L"Aquilinus : Corrupt profile file !");
-					inFile.close();
-					return E_FAIL;
-				}
+				const BYTE* pcBlock = pcBlocks + i * nBlockSize;
+				unsigned __int32 dwSize = (i == nBlocks - 1) ? (unsigned __int32)(nLastBlockSize - sizeof(unsigned __int32)) : 256;
+				unsigned __int32 dwInputHash;
+				memcpy(&dwInputHash, pcBlock, sizeof(unsigned __int32));
+				const BYTE* pcData = pcBlock + sizeof(unsigned __int32);
+				if (GetHash((BYTE*)pcData, dwSize) != dwInputHash)
+					return false;
+				memcpy(pcPayload + i * 256, pcData, dwSize);
+			}
+			return true;
+		};
+
+		// split big files on all cores
+		const size_t nBlocksPerThreadMin = 4096;
+		size_t nThreads = bParallel ? (size_t)std::thread::hardware_concurrency() : 1;
+		if (nThreads > nBlocks / nBlocksPerThreadMin) nThreads = nBlocks / nBlocksPerThreadMin;
+		bool bVerified = true;
+		if (nThreads > 1)
+		{
+			std::vector<std::thread> acThreads;
+			std::vector<char> abResults(nThreads, 0);
+			size_t nBlocksPerThread = (nBlocks + nThreads - 1) / nThreads;
+			for (size_t i = 0; i < nThreads; i++)
+			{
+				size_t nFirst = i * nBlocksPerThread;
+				size_t nEnd = (std::min)(nFirst + nBlocksPerThread, nBlocks);
+				acThreads.push_back(std::thread([&, i, nFirst, nEnd]() { abResults[i] = VerifyBlocks(nFirst, nEnd) ? 1 : 0; }));
+			}
+			for (size_t i = 0; i < nThreads; i++)
+			{
+				acThreads[i].join();
+				bVerified &= (abResults[i] != 0);
 			}
 		}
-	}
+		else
+			bVerified = VerifyBlocks(0, nBlocks);
 
-	inFile.close();
+		if (bVerified)
+			cDataStream.Set(pcPayload, nPayloadSize);
+		else
+			nHr = AQU_E_CORRUPT_BLOCK;
+	}
 
-	// set back binary stream
-	sstrDataStream.seekg(0);
-	sstrDataStream.seekp(0);
+	UnmapViewOfFile(pcFile);
+	CloseHandle(hMapping);
+	CloseHandle(hFile);
 
-	return S_OK;
+	return nHr;
 }
 
 /// <summary>
@@ -1228,13 +1404,31 @@ LPWSTR AQU_FileManager::GetProcessName(DWORD dwIndex)
 
 /// <summary> 
 /// Hash code helper
+/// Computes h = 31 * h + c over all bytes, in four interleaved lanes
+/// (31^4 = 923521) to break the multiply dependency chain.
 /// </summary>
 unsigned __int32 AQU_FileManager::GetHash(BYTE* pcData, unsigned __int32 dwSize)
 {
 	unsigned __int32 h = 0;
 
-	// create hash
-	for (DWORD i = 0; i < dwSize; i++)
+	// create hash, four bytes per step
+	unsigned __int32 dwQuads = dwSize >> 2;
+	if (dwQuads)
+	{
+		unsigned __int32 h0 = 0, h1 = 0, h2 = 0, h3 = 0;
+		for (DWORD i = 0; i < dwQuads; i++)
+		{
+			h0 = 923521u * h0 + pcData[0];
+			h1 = 923521u * h1 + pcData[1];
+			h2 = 923521u * h2 + pcData[2];
+			h3 = 923521u * h3 + pcData[3];
+			pcData += 4;
+		}
+		h = 29791u * h0 + 961u * h1 + 31u * h2 + h3;
+	}
+
+	// remaining bytes
+	for (DWORD i = 0; i < (dwSize & 3); i++)
 	{
 		h = 31 * h + pcData[i];
 	}
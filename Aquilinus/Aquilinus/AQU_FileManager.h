@@ -59,6 +59,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <vector>
 #include "NOD_Basic.h"
 #include "NOD_Plugin.h"
+#include "AQU_ThreadPool.h"
 
 /**
 * Aquilinus encryption modes.
@@ -70,6 +71,105 @@ enum AQU_EncryptionMode
 	MixUpPosition,
 };
 
+/**
+* Aquilinus data arena.
+* Linear allocator for file payload data, all memory is released at once.
+***/
+class AQU_DataArena
+{
+public:
+	AQU_DataArena() {}
+	~AQU_DataArena() { Release(); }
+
+	void* Allocate(size_t nSize, size_t nAlignment = 16);
+	void  Release();
+
+private:
+	AQU_DataArena(const AQU_DataArena&);
+	AQU_DataArena& operator=(const AQU_DataArena&);
+
+	/**
+	* Arena memory chunk.
+	***/
+	struct Chunk
+	{
+		BYTE*  pcData;
+		size_t nSize;
+		size_t nUsed;
+	};
+	/**
+	* All chunks, the last one is the current.
+	***/
+	std::vector<Chunk> m_asChunks;
+};
+
+/**
+* Aquilinus data stream.
+* Read cursor on a verified file payload. Data is never copied unless
+* explicitly read, Get() returns a pointer into the payload itself.
+***/
+class AQU_DataStream
+{
+public:
+	AQU_DataStream() : m_pcData(nullptr), m_nSize(0), m_nPosition(0), m_bFail(false) {}
+
+	/*** AQU_DataStream public methods ***/
+	void Set(char* pcData, size_t nSize) { m_pcData = pcData; m_nSize = nSize; m_nPosition = 0; m_bFail = false; }
+	bool Read(void* pvDest, size_t nSize)
+	{
+		char* pcSrc = Get(nSize);
+		if (pcSrc) CopyMemory(pvDest, pcSrc, nSize);
+		return pcSrc != nullptr;
+	}
+	bool Ignore(size_t nSize) { return Get(nSize) != nullptr; }
+	char* Get(size_t nSize)
+	{
+		if ((m_bFail) || (nSize > m_nSize - m_nPosition)) { m_bFail = true; return nullptr; }
+		char* pcData = m_pcData + m_nPosition;
+		m_nPosition += nSize;
+		return pcData;
+	}
+	bool   Good() { return !m_bFail; }
+	size_t GetSize() { return m_nSize; }
+	size_t GetRemaining() { return m_nSize - m_nPosition; }
+	void   Fail() { m_bFail = true; }
+
+private:
+	/**
+	* The payload (owned by an arena).
+	***/
+	char* m_pcData;
+	/**
+	* Payload size, in bytes.
+	***/
+	size_t m_nSize;
+	/**
+	* Current read position.
+	***/
+	size_t m_nPosition;
+	/**
+	* True if a read exceeded the payload.
+	***/
+	bool m_bFail;
+};
+
+/**
+* Aquilinus node record.
+* One decoded node of a working area or profile file including its connections.
+* The save data points into the file payload.
+***/
+struct AQU_NodeRecord
+{
+	unsigned __int32 dwId;                                      /**< Node type id. **/
+	float fX, fY;                                               /**< Node position. **/
+	unsigned __int32 dwPluginId;                                /**< Plugin node type id (if plugin node). **/
+	wchar_t szFilePath[MAX_PATH];                               /**< Full plugin dll path (if plugin node). **/
+	char* pcData;                                               /**< Node save data. **/
+	unsigned __int32 dwDataSize;                                /**< Node save data size. **/
+	std::vector<std::vector<std::pair<LONG, LONG>>> aasCommanderConnections; /**< Per commander : (node index, decommander index) **/
+	std::vector<LONG> alInvokerConnections;                     /**< Provoker connection node indices. **/
+};
+
 /**
 * Aquilinus File Manager.
 * Inherits all input and output operations including file or memory encryptions.
@@ -82,8 +182,9 @@ public:
 
 	HRESULT LoadWorkingAreaBasics(LPWSTR szWorkspacePath, DWORD &dwProcessIndex, DWORD &dwSupportedInterfacesNumber, __int32* pnInterfaceInjectionTechnique, LPWSTR szPicturePath, BOOL &bPicture, unsigned __int32 &dwDetourTimeDelay, __int32 &nInjectionRepetition, bool bKeepProcessName);
 	HRESULT LoadProfileBasics(LPCWSTR szProfilePath, AquilinusCfg* psConfig, DWORD &dwSupportedInterfacesNumber, BYTE* &paPictureData, DWORD &dwPictureSize);
-	HRESULT LoadWorkingArea(LPWSTR szWorkspacePath, std::stringstream &sstrDataStream);
-	HRESULT LoadProfile(LPWSTR szProfilePath, std::stringstream &sstrDataStream);
+	HRESULT LoadWorkingArea(LPWSTR szWorkspacePath, AQU_DataArena &cArena, AQU_DataStream &cDataStream);
+	HRESULT LoadProfile(LPWSTR szProfilePath, AQU_DataArena &cArena, AQU_DataStream &cDataStream);
+	HRESULT DecodeNodes(AQU_DataStream &cDataStream, std::vector<AQU_NodeRecord> &asNodes, AQU_ThreadPool* pcPool);
 	HRESULT SaveWorkingArea(AquilinusCfg* psConfig, std::vector<NOD_Basic*>* ppaNodes, DWORD dwSupportedInterfacesNumber);
 	HRESULT CompileProfile(AquilinusCfg* psConfig, std::vector<NOD_Basic*>* ppaNodes, DWORD dwSupportedInterfacesNumber);
 	LPCWSTR GetAquilinusPath();
@@ -100,6 +201,8 @@ public:
 	HRESULT SaveGameListTXT();
 
 private:
+	HRESULT LoadDataBlocks(LPCWSTR szPath, const char* szHeader, size_t nHeaderSize, AQU_DataArena &cArena, AQU_DataStream &cDataStream, bool bParallel);
+
 	/**
 	* The Aquilinus node directory path.
 	***/
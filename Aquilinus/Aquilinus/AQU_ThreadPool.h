@@ -0,0 +1,169 @@
+/********************************************************************
+Vireio Perception : Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+Aquilinus : Vireio Perception 3D Modification Studio 
+Copyright  2014 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+v2.0.4 to v3.0.x 2014-2015 by Grant Bagwell, Simon Brown and Neil Schneider
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown and Neil Schneider
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+#ifndef AQU_THREADPOOL_CLASS
+#define AQU_THREADPOOL_CLASS
+
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <future>
+#include <memory>
+#include <queue>
+#include <vector>
+
+/**
+* Aquilinus thread pool.
+* Platform neutral worker pool for the parallel parts of profile loading.
+* Tasks are started in submission order, each one returns a future.
+***/
+class AQU_ThreadPool
+{
+public:
+	/**
+	* Constructor.
+	* @param uThreads Number of worker threads, zero for the number of hardware threads.
+	***/
+	explicit AQU_ThreadPool(unsigned uThreads = 0) :
+		m_uActive(0),
+		m_bExit(false)
+	{
+		if (!uThreads) uThreads = std::thread::hardware_concurrency();
+		if (!uThreads) uThreads = 2;
+		for (unsigned i = 0; i < uThreads; i++)
+			m_acWorkers.push_back(std::thread(&AQU_ThreadPool::Worker, this));
+	}
+	/**
+	* Destructor.
+	* Finishes all pending tasks, then joins the workers.
+	***/
+	~AQU_ThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> cLock(m_cMutex);
+			m_bExit = true;
+		}
+		m_cTaskCondition.notify_all();
+		for (std::thread& cWorker : m_acWorkers)
+			cWorker.join();
+	}
+
+	/**
+	* Adds a task.
+	* @return The future of the task result.
+	***/
+	template<typename F> std::future<decltype(std::declval<F>()())> Submit(F fTask)
+	{
+		typedef decltype(std::declval<F>()()) R;
+		std::shared_ptr<std::packaged_task<R()>> pcTask = std::make_shared<std::packaged_task<R()>>(fTask);
+		std::future<R> cFuture = pcTask->get_future();
+		{
+			std::lock_guard<std::mutex> cLock(m_cMutex);
+			m_afTasks.push([pcTask]() { (*pcTask)(); });
+		}
+		m_cTaskCondition.notify_one();
+		return cFuture;
+	}
+	/**
+	* Blocks until all submitted tasks are done.
+	***/
+	void WaitIdle()
+	{
+		std::unique_lock<std::mutex> cLock(m_cMutex);
+		m_cIdleCondition.wait(cLock, [this]() { return m_afTasks.empty() && (m_uActive == 0); });
+	}
+	/**
+	* Number of worker threads.
+	***/
+	unsigned GetThreadNumber() { return (unsigned)m_acWorkers.size(); }
+
+private:
+	AQU_ThreadPool(const AQU_ThreadPool&);
+	AQU_ThreadPool& operator=(const AQU_ThreadPool&);
+
+	/**
+	* Worker thread loop.
+	***/
+	void Worker()
+	{
+		for (;;)
+		{
+			std::function<void()> fTask;
+			{
+				std::unique_lock<std::mutex> cLock(m_cMutex);
+				m_cTaskCondition.wait(cLock, [this]() { return m_bExit || !m_afTasks.empty(); });
+				if (m_afTasks.empty()) return;
+				fTask = std::move(m_afTasks.front());
+				m_afTasks.pop();
+				m_uActive++;
+			}
+
+			fTask();
+
+			{
+				std::lock_guard<std::mutex> cLock(m_cMutex);
+				m_uActive--;
+				if (m_afTasks.empty() && (m_uActive == 0))
+					m_cIdleCondition.notify_all();
+			}
+		}
+	}
+
+	/**
+	* The worker threads.
+	***/
+	std::vector<std::thread> m_acWorkers;
+	/**
+	* Pending tasks.
+	***/
+	std::queue<std::function<void()>> m_afTasks;
+	/**
+	* Guards tasks, active count and exit flag.
+	***/
+	std::mutex m_cMutex;
+	/**
+	* Signaled on new tasks and on exit.
+	***/
+	std::condition_variable m_cTaskCondition;
+	/**
+	* Signaled when the pool runs idle.
+	***/
+	std::condition_variable m_cIdleCondition;
+	/**
+	* Number of tasks currently executed.
+	***/
+	unsigned m_uActive;
+	/**
+	* True if the pool shuts down.
+	***/
+	bool m_bExit;
+};
+
+#endif
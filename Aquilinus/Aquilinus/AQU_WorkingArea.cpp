@@ -283,7 +283,14 @@ AQU_WorkingArea::~AQU_WorkingArea()
 	while (it2 != m_vcPluginHandles.end())
 	{
 		if ((*it2) != NULL)
+		{
+			// stop the plugin log writer thread, it must not outlive the dll code
+			typedef void(*Vireio_Log_Shutdown)();
+			Vireio_Log_Shutdown pVireio_Log_Shutdown = (Vireio_Log_Shutdown)GetProcAddress(*it2, "Vireio_Log_Shutdown");
+			if (pVireio_Log_Shutdown)
+				pVireio_Log_Shutdown();
 			FreeLibrary(*it2);
+		}
 		it2 = m_vcPluginHandles.erase(it2);
 	}
 }
@@ -992,18 +999,19 @@ HRESULT AQU_WorkingArea::s_LoadWorkSpace()
 	// set d3d override to true
 	m_pcTransferSite->m_bForceD3D = true;
 
-	// get a data stream
-	std::stringstream sstrDataStream;
+	// get a data stream, the payload lives in the arena
+	AQU_DataArena cArena;
+	AQU_DataStream cDataStream;
 
 	// load the stream
-	HRESULT hr = m_pcTransferSite->m_pFileManager->LoadWorkingArea(m_pcTransferSite->m_pConfig->szWorkspaceFilePath, sstrDataStream);
+	HRESULT hr = m_pcTransferSite->m_pFileManager->LoadWorkingArea(m_pcTransferSite->m_pConfig->szWorkspaceFilePath, cArena, cDataStream);
 
 	// and decode the stream
 	if (SUCCEEDED(hr))
 	{
 		// first, read the game name to see wether this is an empty profile
 		wchar_t szEntryName[MAX_JOLIET_FILENAME];
-		sstrDataStream.read((char*)szEntryName, ENTRY_SIZE);
+		cDataStream.Read(szEntryName, ENTRY_SIZE);
 
 		// empty profile ?
 		if (szEntryName[0] == 0)
@@ -1012,80 +1020,54 @@ HRESULT AQU_WorkingArea::s_LoadWorkSpace()
 			m_pcTransferSite->m_pConfig->bEmptyProcess = FALSE;
 
 		// now, ignore the size of the additional option data block
-		sstrDataStream.ignore(sizeof(unsigned __int32) * OPTIONS_RESERVED);
+		cDataStream.Ignore(sizeof(unsigned __int32) * OPTIONS_RESERVED);
 
 		// ignore picture boolean and the path if true
 		BOOL bPicture;
-		sstrDataStream.read((char*)&bPicture, sizeof(BOOL));
+		cDataStream.Read(&bPicture, sizeof(BOOL));
 		if (bPicture)
-			sstrDataStream.ignore(MAX_PATH * sizeof(wchar_t));
+			cDataStream.Ignore(MAX_PATH * sizeof(wchar_t));
 
 		// ignore the detour time delay and injection repetition
-		sstrDataStream.ignore(sizeof(unsigned __int32));
-		sstrDataStream.ignore(sizeof(unsigned __int32));
+		cDataStream.Ignore(sizeof(unsigned __int32));
+		cDataStream.Ignore(sizeof(unsigned __int32));
 
 		// now, ignore the injection techniques
 		unsigned __int32 dwSupportedInterfacesNumber;
-		sstrDataStream.read((char*)&dwSupportedInterfacesNumber, sizeof(unsigned __int32));
-		sstrDataStream.ignore((std::streamsize)dwSupportedInterfacesNumber * (std::streamsize)sizeof(__int32));
-
-		// read the number of nodes, resize node vector
-		unsigned __int32 dwNodeNumber;
-		sstrDataStream.read((char*)&dwNodeNumber, sizeof(unsigned __int32));
-		m_paNodes.resize(dwNodeNumber);
+		cDataStream.Read(&dwSupportedInterfacesNumber, sizeof(unsigned __int32));
+		cDataStream.Ignore((size_t)dwSupportedInterfacesNumber * sizeof(__int32));
+
+		// decode all node records, no worker pool here : s_LoadWorkSpace() is called by AquilinusInitProject()
+		// from DllMain (loader lock), worker threads could not start until it returns
+		std::vector<AQU_NodeRecord> asNodes;
+		hr = m_pcTransferSite->m_pFileManager->DecodeNodes(cDataStream, asNodes, NULL);
+		if (FAILED(hr))
+		{
+			m_pcTransferSite->m_bForceD3D = false;
+			return E_FAIL;
+		}
+		m_paNodes.resize(asNodes.size());
 
 		// get a node provider
 		AQU_NodeProvider* pProvider = new AQU_NodeProvider();
 
-		// loop through the nodes to add node data 
-		for (UINT i = 0; i != dwNodeNumber; i++)
+		// serialized : create the nodes and init node data
+		for (UINT i = 0; i != (UINT)asNodes.size(); i++)
 		{
-			OutputDebugString(L"New Node!");
-
-			// get the node hash
-			unsigned __int32 id;
-			sstrDataStream.read((char*)&id, sizeof(unsigned __int32));
-
-			// get the node position
-			ImVec2 sPos = {};
-			sstrDataStream.read((char*)&sPos.x, sizeof(float));
-			sstrDataStream.read((char*)&sPos.y, sizeof(float));
-
-			// load plugin info (if plugin node)
-			unsigned __int32 idPlugin = 0;
-			wchar_t szFileName[64];
-			wchar_t szFilePath[MAX_PATH];
-			if (id == ELEMENTARY_NODE_PLUGIN)
-			{
-				// and write to stream
-				sstrDataStream.read((char*)&idPlugin, sizeof(unsigned __int32));
-				sstrDataStream.read((char*)&szFileName[0], sizeof(wchar_t) * 64);
-
-				// create full path
-				wsprintf(szFilePath, L"%s%s", m_pcTransferSite->m_pFileManager->GetPluginPath(), szFileName);
-
-				OutputDebugString(szFilePath);
-			}
+			AQU_NodeRecord& sNode = asNodes[i];
+			if (sNode.dwId == ELEMENTARY_NODE_PLUGIN)
+				OutputDebugString(sNode.szFilePath);
 
-			// read node data
-			unsigned __int32 dwDataSize = 0;
-			sstrDataStream.read((char*)&dwDataSize, sizeof(unsigned __int32));
-
-			// read the data
-			char* pcData = new char[dwDataSize];
-			if (dwDataSize)
-				sstrDataStream.read((char*)pcData, dwDataSize);
-
-			// get a node pointer... TODO !! NODE POSITION FLOAT
+			// get a node pointer
 			NOD_Basic* pNode;
-			if (FAILED(pProvider->Get_Node(pNode, id, (LONG)sPos.x, (LONG)sPos.y, idPlugin, szFilePath)))
+			if (FAILED(pProvider->Get_Node(pNode, sNode.dwId, (LONG)sNode.fX, (LONG)sNode.fY, sNode.dwPluginId, sNode.szFilePath)))
 			{
 				// unregister all nodes
 				m_pcTransferSite->UnregisterAllNodes();
 
 				// debug output
 				wchar_t buf[64];
-				wsprintf(buf, L"Aquilinus : Unknown node type %u", id);
+				wsprintf(buf, L"Aquilinus : Unknown node type %u", sNode.dwId);
 				OutputDebugString(buf);
 
 				for (UINT j = 0; j < i; j++)
@@ -1093,69 +1075,48 @@ HRESULT AQU_WorkingArea::s_LoadWorkSpace()
 
 				m_paNodes.clear();
 				delete pProvider;
-				sstrDataStream.clear();
 				return E_FAIL;
 			}
 
 			// init node data
-			pNode->InitNodeData(pcData, dwDataSize);
+			pNode->InitNodeData(sNode.pcData, sNode.dwDataSize);
 
 			// register this node
-			m_pcTransferSite->RegisterD3DNode(pNode, id);
+			m_pcTransferSite->RegisterD3DNode(pNode, sNode.dwId);
 
 			// and add the node
 			m_paNodes[i] = pNode;
-			delete[] pcData;
 		}
 
 		delete pProvider;
 
-		// loop through the nodes to add node connections
+		// serialized : wire up the node connections
 		for (std::vector<NOD_Basic*>::size_type i = 0; i != m_paNodes.size(); i++)
 		{
-			// get the number of commanders
-			unsigned __int32 dwCommandersNumber;
-			sstrDataStream.read((char*)&dwCommandersNumber, sizeof(unsigned __int32));
-
-			// loop through commanders, get the number of connections and the connection indices
-			for (DWORD j = 0; j < dwCommandersNumber; j++)
+			// commanders -> decommanders
+			for (DWORD j = 0; j < (DWORD)asNodes[i].aasCommanderConnections.size(); j++)
 			{
-				// get the commander connections number
-				unsigned __int32 dwConnectionsNumber;
-				sstrDataStream.read((char*)&dwConnectionsNumber, sizeof(unsigned __int32));
-
-				// loop through decommanders, set indices
-				for (DWORD k = 0; k < dwConnectionsNumber; k++)
+				for (const std::pair<LONG, LONG>& sConnection : asNodes[i].aasCommanderConnections[j])
 				{
-					// get decommander node index
-					LONG lNodeIndex;
-					sstrDataStream.read((char*)&lNodeIndex, sizeof(LONG));
-					// get decommander index
-					LONG lDecommanderIndex;
-					sstrDataStream.read((char*)&lDecommanderIndex, sizeof(LONG));
-
 					// output debug data
 					OutputDebugString(L"Connect Decommander");
-					wchar_t buf[64]; wsprintf(buf, L"nodes : %u %u cix : %u dix : %u", i, lNodeIndex, j, lDecommanderIndex); OutputDebugString(buf);
+					wchar_t buf[64];
+					wsprintf(buf, L"nodes : %u %u cix : %u dix : %u", i, sConnection.first, j, sConnection.second);
+					OutputDebugString(buf);
 
 					// and connect
-					m_paNodes[i]->ConnectDecommander(m_paNodes[lNodeIndex], lNodeIndex, j, lDecommanderIndex);
+					m_paNodes[i]->ConnectDecommander(m_paNodes[sConnection.first], sConnection.first, j, sConnection.second);
 				}
 			}
 
-			// get the provoker connections number
-			unsigned __int32 dwConnectionsNumber;
-			sstrDataStream.read((char*)&dwConnectionsNumber, sizeof(unsigned __int32));
-
-			// loop through decommanders, return indices
-			for (int j = 0; j < (int)dwConnectionsNumber; j++)
+			// provoker connections
+			for (LONG lNodeIndex : asNodes[i].alInvokerConnections)
 			{
-				LONG lNodeIndex;
-				sstrDataStream.read((char*)&lNodeIndex, sizeof(LONG));
-
 				// output debug data
 				OutputDebugString(L"Connect Invoker");
-				wchar_t buf[64]; wsprintf(buf, L"nodes : %u %u", i, lNodeIndex); OutputDebugString(buf);
+				wchar_t buf[64];
+				wsprintf(buf, L"nodes : %u %u", i, lNodeIndex);
+				OutputDebugString(buf);
 
 				// and connect
 				m_paNodes[i]->ConnectInvoker(m_paNodes[lNodeIndex], lNodeIndex);
@@ -343,95 +343,72 @@ HRESULT WINAPI AquilinusInitProject(HINSTANCE hInstance)
 		g_pAQU_TransferSite->m_paDataSheetCategories.clear();
 		g_pAQU_TransferSite->m_aInterfaceIndices.clear();
 
-		// get a data stream
-		std::stringstream sstrDataStream;
+		// get a data stream, the payload lives in the arena
+		AQU_DataArena cArena;
+		AQU_DataStream cDataStream;
 
 		// load the stream
-		HRESULT hr = g_pAQU_TransferSite->m_pFileManager->LoadProfile(g_pAQU_TransferSite->m_pConfig->szProfileFilePath, sstrDataStream);
+		HRESULT hr = g_pAQU_TransferSite->m_pFileManager->LoadProfile(g_pAQU_TransferSite->m_pConfig->szProfileFilePath, cArena, cDataStream);
 
 		// and decode the stream
 		if (SUCCEEDED(hr))
 		{
 			// first, ignore the game, process and window name
-			sstrDataStream.ignore(ENTRY_SIZE * 3);
+			cDataStream.Ignore(ENTRY_SIZE * 3);
 
 			// ignore the reserved option space
-			sstrDataStream.ignore(sizeof(unsigned __int32) * OPTIONS_RESERVED);
+			cDataStream.Ignore(sizeof(unsigned __int32) * OPTIONS_RESERVED);
 
 			// ignore picture boolean and the path if true
 			BOOL bPicture;
-			sstrDataStream.read((char*)&bPicture, sizeof(BOOL));
+			cDataStream.Read(&bPicture, sizeof(BOOL));
 			if (bPicture)
 			{
 				LONG nImageSize;
-				sstrDataStream.read((char*)&nImageSize, sizeof(LONG));
-				sstrDataStream.ignore(nImageSize);
+				cDataStream.Read(&nImageSize, sizeof(LONG));
+				cDataStream.Ignore(nImageSize);
 			}
 
 			// ignore the detour time delay and injection repetition
-			sstrDataStream.ignore(sizeof(unsigned __int32));
-			sstrDataStream.ignore(sizeof(unsigned __int32));
+			cDataStream.Ignore(sizeof(unsigned __int32));
+			cDataStream.Ignore(sizeof(unsigned __int32));
 
 			// now, ignore the injection techniques
 			unsigned __int32 dwSupportedInterfacesNumber;
-			sstrDataStream.read((char*)&dwSupportedInterfacesNumber, sizeof(unsigned __int32));
-			sstrDataStream.ignore((std::streamsize)dwSupportedInterfacesNumber * (std::streamsize)sizeof(__int32));
-
-			// read the number of nodes, resize node vector
-			unsigned __int32 dwNodeNumber;
-			sstrDataStream.read((char*)&dwNodeNumber, sizeof(unsigned __int32));
-			g_paNodes.resize(dwNodeNumber);
+			cDataStream.Read(&dwSupportedInterfacesNumber, sizeof(unsigned __int32));
+			cDataStream.Ignore((size_t)dwSupportedInterfacesNumber * sizeof(__int32));
+
+			// decode all node records, no worker pool here : we are called from DllMain (loader lock),
+			// worker threads could not start until we return and joining them would dead lock
+			std::vector<AQU_NodeRecord> asNodes;
+			hr = g_pAQU_TransferSite->m_pFileManager->DecodeNodes(cDataStream, asNodes, NULL);
+			if (FAILED(hr))
+			{
+				g_pAQU_TransferSite->m_bForceD3D = false;
+				return E_FAIL;
+			}
+			g_paNodes.resize(asNodes.size());
 
 			// get a node provider
 			AQU_NodeProvider* pProvider = new AQU_NodeProvider();
 
-			// loop through the nodes to add node data
-			for (UINT i = 0; i != dwNodeNumber; i++)
+			// serialized : create the nodes and init node data
+			for (UINT i = 0; i != (UINT)asNodes.size(); i++)
 			{
-				// get the node hash
-				unsigned __int32 id;
-				sstrDataStream.read((char*)&id, sizeof(unsigned __int32));
-
-				// get the node position
-				ImVec2 sPos = {};
-				sstrDataStream.read((char*)&sPos.x, sizeof(float));
-				sstrDataStream.read((char*)&sPos.y, sizeof(float));
-
-				// load plugin info (if plugin node)
-				unsigned __int32 idPlugin = 0;
-				wchar_t szFileName[64];
-				wchar_t szFilePath[MAX_PATH];
-				if (id == ELEMENTARY_NODE_PLUGIN)
-				{
-					// and write to stream
-					sstrDataStream.read((char*)&idPlugin, sizeof(unsigned __int32));
-					sstrDataStream.read((char*)&szFileName[0], sizeof(wchar_t) * 64);
-
-					// create full path
-					wsprintf(szFilePath, L"%s%s", g_pAQU_TransferSite->m_pFileManager->GetPluginPath(), szFileName);
-
-					OutputDebugString(szFilePath);
-				}
-
-				// read node data
-				unsigned __int32 dwDataSize = 0;
-				sstrDataStream.read((char*)&dwDataSize, sizeof(unsigned __int32));
-
-				// read the data
-				char* pcData = new char[dwDataSize];
-				if (dwDataSize)
-					sstrDataStream.read((char*)pcData, dwDataSize);
+				AQU_NodeRecord& sNode = asNodes[i];
+				if (sNode.dwId == ELEMENTARY_NODE_PLUGIN)
+					OutputDebugString(sNode.szFilePath);
 
 				// get a node pointer
 				NOD_Basic* pNode;
-				if (FAILED(pProvider->Get_Node(pNode, id, (LONG)sPos.x, (LONG)sPos.y, idPlugin, szFilePath)))
+				if (FAILED(pProvider->Get_Node(pNode, sNode.dwId, (LONG)sNode.fX, (LONG)sNode.fY, sNode.dwPluginId, sNode.szFilePath)))
 				{
 					// unregister all nodes
 					g_pAQU_TransferSite->UnregisterAllNodes();
 
 					// debug output
 					wchar_t buf[64];
-					wsprintf(buf, L"[AQU] Unknown node type %u", id);
+					wsprintf(buf, L"[AQU] Unknown node type %u", sNode.dwId);
 					OutputDebugString(buf);
 
 					for (UINT j = 0; j < i; j++)
@@ -439,68 +416,43 @@ HRESULT WINAPI AquilinusInitProject(HINSTANCE hInstance)
 
 					g_paNodes.clear();
 					delete pProvider;
-					sstrDataStream.clear();
 					return E_FAIL;
 				}
 
 				// init node data
-				pNode->InitNodeData(pcData, dwDataSize);
+				pNode->InitNodeData(sNode.pcData, sNode.dwDataSize);
 
 				// register this node
-				g_pAQU_TransferSite->RegisterD3DNode(pNode, id);
+				g_pAQU_TransferSite->RegisterD3DNode(pNode, sNode.dwId);
 
 				// and add the node
 				g_paNodes[i] = pNode;
-				delete[] pcData;
 			}
 
 			delete pProvider;
 
-			// loop through the nodes to add node connections
+			// serialized : wire up the node connections
 			for (std::vector<NOD_Basic*>::size_type i = 0; i != g_paNodes.size(); i++)
 			{
-				// get the number of commanders
-				unsigned __int32 dwCommandersNumber;
-				sstrDataStream.read((char*)&dwCommandersNumber, sizeof(unsigned __int32));
-
-				// loop through commanders, get the number of connections and the connection indices
-				for (DWORD j = 0; j < dwCommandersNumber; j++)
+				// commanders -> decommanders
+				for (DWORD j = 0; j < (DWORD)asNodes[i].aasCommanderConnections.size(); j++)
 				{
-					// get the commander connections number
-					unsigned __int32 dwConnectionsNumber;
-					sstrDataStream.read((char*)&dwConnectionsNumber, sizeof(unsigned __int32));
-
-					// loop through decommanders, set indices
-					for (DWORD k = 0; k < dwConnectionsNumber; k++)
+					for (const std::pair<LONG, LONG>& sConnection : asNodes[i].aasCommanderConnections[j])
 					{
-						// get decommander node index
-						LONG lNodeIndex;
-						sstrDataStream.read((char*)&lNodeIndex, sizeof(LONG));
-						// get decommander index
-						LONG lDecommanderIndex;
-						sstrDataStream.read((char*)&lDecommanderIndex, sizeof(LONG));
-
 						// output debug data
 						OutputDebugString(L"Connect Decommander");
 						wchar_t buf[64];
-						wsprintf(buf, L"nodes : %u %u cix : %u dix : %u", i, lNodeIndex, j, lDecommanderIndex);
+						wsprintf(buf, L"nodes : %u %u cix : %u dix : %u", i, sConnection.first, j, sConnection.second);
 						OutputDebugString(buf);
 
 						// and connect
-						g_paNodes[i]->ConnectDecommander(g_paNodes[lNodeIndex], lNodeIndex, j, lDecommanderIndex);
+						g_paNodes[i]->ConnectDecommander(g_paNodes[sConnection.first], sConnection.first, j, sConnection.second);
 					}
 				}
 
-				// get the provoker connections number
-				unsigned __int32 dwConnectionsNumber;
-				sstrDataStream.read((char*)&dwConnectionsNumber, sizeof(unsigned __int32));
-
-				// loop through decommanders, return indices
-				for (int j = 0; j < (int)dwConnectionsNumber; j++)
+				// provoker connections
+				for (LONG lNodeIndex : asNodes[i].alInvokerConnections)
 				{
-					LONG lNodeIndex;
-					sstrDataStream.read((char*)&lNodeIndex, sizeof(LONG));
-
 					// output debug data
 					OutputDebugString(L"Connect Invoker");
 					wchar_t buf[64];
@@ -138,6 +138,12 @@ m_dwUpdateCounter(0)
 /// </summary>
 NOD_Plugin::~NOD_Plugin()
 {
+	// stop the plugin log writer thread, it must not outlive the dll code
+	typedef void(*Vireio_Log_Shutdown)();
+	Vireio_Log_Shutdown pVireio_Log_Shutdown = m_hm ? (Vireio_Log_Shutdown)GetProcAddress(m_hm, "Vireio_Log_Shutdown") : NULL;
+	if (pVireio_Log_Shutdown)
+		pVireio_Log_Shutdown();
+
 	FreeLibrary(m_hm);
 	m_hm = NULL;
 }
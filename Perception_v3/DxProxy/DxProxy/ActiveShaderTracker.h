@@ -0,0 +1,188 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <ActiveShaderTracker.h> and
+Class <ActiveShaderTracker> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#ifndef ACTIVESHADERTRACKER_H_INCLUDED
+#define ACTIVESHADERTRACKER_H_INCLUDED
+
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+
+/**
+* Tracks the shaders set during the current and the last frame.
+* Each shader hash owns a record stamped with the frames it was set in, so
+* "active this frame" is a frame number compare and starting a new frame
+* does neither copy nor clear any map. The hashes first set in a frame are
+* additionally kept in a compact list (swapped on a new frame) for the menu.
+* Shaders are identified by hash only, no shader pointers are held.
+*/
+class ActiveShaderTracker
+{
+public:
+	/**
+	* Constructor.
+	***/
+	ActiveShaderTracker() :
+		m_records(),
+		m_activeHashes(),
+		m_lastFrameHashes(),
+		m_frame(1)
+	{}
+
+	/**
+	* Starts a new frame.
+	* The active hashes become the last frame hashes, no records are touched.
+	***/
+	void NextFrame()
+	{
+		m_lastFrameHashes.swap(m_activeHashes);
+		m_activeHashes.clear();
+		m_frame++;
+	}
+
+	/**
+	* Marks the shader active for the current frame.
+	* @param hash The shader hash code.
+	***/
+	void SetActive(uint32_t hash)
+	{
+		ShaderRecord& record = m_records[hash];
+		if (record.frame == m_frame)
+			return;
+
+		record.previousFrame = record.frame;
+		record.frame = m_frame;
+		m_activeHashes.push_back(hash);
+	}
+
+	/**
+	* True if the shader was set in the current frame.
+	***/
+	bool IsActive(uint32_t hash) const
+	{
+		auto it = m_records.find(hash);
+		return (it != m_records.end()) && (it->second.frame == m_frame);
+	}
+
+	/**
+	* True if the shader was set in the last frame.
+	***/
+	bool WasActiveLastFrame(uint32_t hash) const
+	{
+		uint32_t lastFrame = m_frame - 1;
+		if (lastFrame == 0)
+			return false;
+
+		auto it = m_records.find(hash);
+		if (it == m_records.end())
+			return false;
+		return (it->second.frame == lastFrame) || (it->second.previousFrame == lastFrame);
+	}
+
+	/**
+	* Number of different shaders set in the current frame.
+	***/
+	size_t GetActiveCount() const { return m_activeHashes.size(); }
+
+	/**
+	* Number of different shaders set in the last frame.
+	***/
+	size_t GetLastFrameCount() const { return m_lastFrameHashes.size(); }
+
+	/**
+	* Hashes set in the current frame, in order of their first set call.
+	***/
+	const std::vector<uint32_t>& GetActiveHashes() const { return m_activeHashes; }
+
+	/**
+	* Hashes set in the last frame, in order of their first set call.
+	***/
+	const std::vector<uint32_t>& GetLastFrameHashes() const { return m_lastFrameHashes; }
+
+	/**
+	* Adds the hashes active in the current frame to a sorted index.
+	* Only called when a menu shows the shaders, the index stays sorted and unique.
+	* @param index [in, out] Sorted hash index.
+	***/
+	void AddActiveToIndex(std::vector<uint32_t>& index) const
+	{
+		size_t oldSize = index.size();
+		for (auto it = m_activeHashes.begin(); it != m_activeHashes.end(); ++it)
+		{
+			if (!std::binary_search(index.begin(), index.begin() + oldSize, *it))
+				index.push_back(*it);
+		}
+		if (index.size() == oldSize)
+			return;
+
+		std::sort(index.begin() + oldSize, index.end());
+		std::inplace_merge(index.begin(), index.begin() + oldSize, index.end());
+	}
+
+	/**
+	* Drops all records, call if the shaders got released (device reset).
+	***/
+	void Clear()
+	{
+		m_records.clear();
+		m_activeHashes.clear();
+		m_lastFrameHashes.clear();
+	}
+
+private:
+	/**
+	* Shader record, stamped with the last two frames the shader was set in.
+	***/
+	struct ShaderRecord
+	{
+		ShaderRecord() : frame(0), previousFrame(0) {}
+		uint32_t frame;
+		uint32_t previousFrame;
+	};
+
+	/**
+	* All shader records by hash code.
+	***/
+	std::unordered_map<uint32_t, ShaderRecord> m_records;
+	/**
+	* Hashes set in the current frame.
+	***/
+	std::vector<uint32_t> m_activeHashes;
+	/**
+	* Hashes set in the last frame.
+	***/
+	std::vector<uint32_t> m_lastFrameHashes;
+	/**
+	* Current frame number, starts at 1 (a zero stamp means never set).
+	***/
+	uint32_t m_frame;
+};
+
+#endif
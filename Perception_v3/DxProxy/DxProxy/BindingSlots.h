@@ -0,0 +1,300 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <BindingSlots.h> and
+Class <BindingSlots> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#ifndef BINDINGSLOTS_H_INCLUDED
+#define BINDINGSLOTS_H_INCLUDED
+
+#include <d3d9.h>
+#include <stdint.h>
+
+/**
+* Number of texture slots : 16 pixel samplers, the displacement map sampler and 4 vertex samplers.
+* @see TextureStageToSlot()
+***/
+#define BINDING_TEXTURE_SLOTS 21
+/**
+* Number of vertex stream slots (D3D9 maximum).
+***/
+#define BINDING_VERTEX_STREAMS 16
+/**
+* Returned for stage or stream numbers without a slot.
+***/
+#define BINDING_INVALID_SLOT 0xFFFFFFFF
+
+/**
+* Dense slot index for a D3D9 sampler stage.
+* 0..15 -> 0..15, D3DDMAPSAMPLER -> 16, D3DVERTEXTEXTURESAMPLER0..3 -> 17..20.
+* @return BINDING_INVALID_SLOT for any other stage.
+***/
+inline UINT TextureStageToSlot(DWORD Stage)
+{
+	if (Stage < 16)
+		return (UINT)Stage;
+	if ((Stage >= D3DDMAPSAMPLER) && (Stage <= D3DVERTEXTEXTURESAMPLER3))
+		return (UINT)(Stage - D3DDMAPSAMPLER) + 16;
+	return BINDING_INVALID_SLOT;
+}
+
+/**
+* D3D9 sampler stage for a dense slot index.
+* @see TextureStageToSlot()
+***/
+inline DWORD SlotToTextureStage(UINT slot)
+{
+	if (slot < 16)
+		return (DWORD)slot;
+	return (DWORD)(slot - 16) + D3DDMAPSAMPLER;
+}
+
+/**
+* Fixed size array of bound interfaces, indexed by dense slot number.
+* Replaces hash maps keyed by stage or stream, a slot is either unbound or bound to an
+* interface or to NULL (the application specifically cleared it, the proxy StateBlock needs
+* that information). Bound slots are flagged in a bitmask, slot selections passed to
+* the copy methods are bitmasks too. Bound interfaces are reference counted.
+* @param T Interface type (needs AddRef() and Release()).
+* @param N Number of slots (32 max).
+*/
+template <class T, UINT N>
+class BindingSlots
+{
+public:
+	/**
+	* Constructor, all slots unbound.
+	***/
+	BindingSlots() :
+		m_boundMask(0)
+	{
+		for (UINT i = 0; i < N; i++)
+			m_slots[i] = NULL;
+	}
+	/**
+	* Destructor, releases all bound interfaces.
+	***/
+	~BindingSlots()
+	{
+		UnbindAll();
+	}
+
+	/**
+	* Mask of all slots.
+	***/
+	static uint32_t AllSlots() { return (N >= 32) ? 0xFFFFFFFF : ((1u << N) - 1); }
+
+	/**
+	* True if the slot was bound (possibly to NULL).
+	***/
+	bool IsBound(UINT slot) const
+	{
+		return (slot < N) && ((m_boundMask & (1u << slot)) != 0);
+	}
+	/**
+	* The interface bound to that slot, NULL if unbound or bound to NULL.
+	***/
+	T* Get(UINT slot) const
+	{
+		return (slot < N) ? m_slots[slot] : NULL;
+	}
+	/**
+	* Bitmask of all bound slots.
+	***/
+	uint32_t GetBoundMask() const { return m_boundMask; }
+
+	/**
+	* Binds the interface (can be NULL) to the slot.
+	* @return False if the slot was already bound to that interface (nothing changed).
+	***/
+	bool Bind(UINT slot, T* pInterface)
+	{
+		if (slot >= N)
+			return false;
+
+		uint32_t bit = 1u << slot;
+		if ((m_boundMask & bit) && (m_slots[slot] == pInterface))
+			return false;
+
+		if (pInterface)
+			pInterface->AddRef();
+		if (m_slots[slot])
+			m_slots[slot]->Release();
+
+		m_slots[slot] = pInterface;
+		m_boundMask |= bit;
+		return true;
+	}
+	/**
+	* Unbinds the slot and releases the bound interface.
+	***/
+	void Unbind(UINT slot)
+	{
+		if (slot >= N)
+			return;
+
+		if (m_slots[slot])
+			m_slots[slot]->Release();
+		m_slots[slot] = NULL;
+		m_boundMask &= ~(1u << slot);
+	}
+	/**
+	* Unbinds all slots and releases all bound interfaces.
+	***/
+	void UnbindAll()
+	{
+		for (UINT i = 0; i < N; i++)
+		{
+			if (m_slots[i])
+				m_slots[i]->Release();
+			m_slots[i] = NULL;
+		}
+		m_boundMask = 0;
+	}
+
+	/**
+	* Binds the selected slots that are bound in the source, the other slots stay as they are.
+	* @param source The source slots.
+	* @param selection Bitmask of slots to copy.
+	***/
+	void CopyBound(const BindingSlots& source, uint32_t selection)
+	{
+		uint32_t mask = source.m_boundMask & selection;
+		for (UINT i = 0; mask; i++, mask >>= 1)
+			if (mask & 1)
+				Bind(i, source.m_slots[i]);
+	}
+	/**
+	* Calls fn(slot, pInterface) for all bound slots in slot order.
+	***/
+	template <class F> void ForEachBound(F fn) const
+	{
+		uint32_t mask = m_boundMask;
+		for (UINT i = 0; mask; i++, mask >>= 1)
+			if (mask & 1)
+				fn(i, m_slots[i]);
+	}
+
+private:
+	/**
+	* No copies, bound interfaces are reference counted.
+	***/
+	BindingSlots(const BindingSlots&);
+	BindingSlots& operator=(const BindingSlots&);
+
+	/**
+	* The bound interfaces, NULL if unbound or bound to NULL.
+	***/
+	T* m_slots[N];
+	/**
+	* Bitmask of bound slots.
+	***/
+	uint32_t m_boundMask;
+};
+
+/**
+* Actual left and right interfaces of the stereo interfaces bound to BindingSlots, indexed by the
+* same dense slot number. Recorded once when a proxy interface is bound, so switching the drawing
+* side only replays the stereo slots (mono interfaces are the same for both sides and stay bound)
+* without unwrapping each bound interface again. Not reference counted, the actual interfaces are
+* owned by the proxy interfaces bound to the corresponding BindingSlots.
+* @param T Actual interface type.
+* @param N Number of slots (32 max).
+*/
+template <class T, UINT N>
+class StereoBindingSlots
+{
+public:
+	/**
+	* Constructor, no stereo slots.
+	***/
+	StereoBindingSlots() :
+		m_stereoMask(0)
+	{
+		Clear();
+	}
+
+	/**
+	* Records the actual interfaces bound to the slot.
+	* @param pActualRight NULL if the bound interface is mono (or NULL), the slot is no stereo slot then.
+	***/
+	void Record(UINT slot, T* pActualLeft, T* pActualRight)
+	{
+		if (slot >= N)
+			return;
+
+		if (pActualRight)
+		{
+			m_left[slot] = pActualLeft;
+			m_right[slot] = pActualRight;
+			m_stereoMask |= 1u << slot;
+		}
+		else
+		{
+			m_left[slot] = NULL;
+			m_right[slot] = NULL;
+			m_stereoMask &= ~(1u << slot);
+		}
+	}
+	/**
+	* Forgets all slots.
+	***/
+	void Clear()
+	{
+		for (UINT i = 0; i < N; i++)
+		{
+			m_left[i] = NULL;
+			m_right[i] = NULL;
+		}
+		m_stereoMask = 0;
+	}
+
+	/**
+	* Bitmask of all slots bound to a stereo interface.
+	***/
+	uint32_t GetStereoMask() const { return m_stereoMask; }
+	/**
+	* Actual left interface of a stereo slot.
+	***/
+	T* GetLeft(UINT slot) const { return (slot < N) ? m_left[slot] : NULL; }
+	/**
+	* Actual right interface of a stereo slot.
+	***/
+	T* GetRight(UINT slot) const { return (slot < N) ? m_right[slot] : NULL; }
+
+private:
+	/**
+	* Actual left and right interfaces, NULL for all slots not in the stereo mask.
+	***/
+	T* m_left[N];
+	T* m_right[N];
+	/**
+	* Bitmask of stereo slots.
+	***/
+	uint32_t m_stereoMask;
+};
+
+#endif
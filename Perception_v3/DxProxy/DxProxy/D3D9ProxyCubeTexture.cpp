@@ -55,13 +55,12 @@ D3D9ProxyCubeTexture::~D3D9ProxyCubeTexture()
 {
 	SHOW_CALL("~D3D9ProxyCubeTexture()");
 	// delete all surfaces in m_levels
-	auto it = m_wrappedSurfaceLevels.begin();
-	while (it != m_wrappedSurfaceLevels.end()) {
+	for (size_t i = 0; i < m_wrappedSurfaceLevels.size(); i++) {
 		// we have to explicitly delete the Surfaces here as the Release behaviour of the surface would get stuck in a loop
 		// calling back to the container Release.
-		delete it->second;
-		it = m_wrappedSurfaceLevels.erase(it);
+		delete m_wrappedSurfaceLevels[i];
 	}
+	m_wrappedSurfaceLevels.clear();
 
 	if (m_pActualTextureRight)
 		m_pActualTextureRight->Release();
@@ -184,11 +183,17 @@ HRESULT WINAPI D3D9ProxyCubeTexture::GetCubeMapSurface(D3DCUBEMAP_FACES FaceType
 	SHOW_CALL("D3D9ProxyCubeTexture::GetCubeMapSurface");
 	HRESULT finalResult;
 
-	CubeSurfaceKey key = CubeSurfaceKey(FaceType,Level);
+	// one slot per face and level, allocated once
+	if (m_wrappedSurfaceLevels.empty())
+		m_wrappedSurfaceLevels.resize(m_pActualTexture->GetLevelCount() * 6, NULL);
+
+	size_t index = (size_t)FaceType * (m_wrappedSurfaceLevels.size() / 6) + Level;
+	bool validIndex = ((UINT)FaceType < 6) && (Level < m_wrappedSurfaceLevels.size() / 6);
+
 	// Have we already got a Proxy for this surface level?
-	if (m_wrappedSurfaceLevels.count(key) == 1) { // yes
+	if (validIndex && m_wrappedSurfaceLevels[index]) { // yes
 
-		*ppCubeMapSurface = m_wrappedSurfaceLevels[key];
+		*ppCubeMapSurface = m_wrappedSurfaceLevels[index];
 		(*ppCubeMapSurface)->AddRef();
 
 		finalResult = D3D_OK;
@@ -211,20 +216,21 @@ HRESULT WINAPI D3D9ProxyCubeTexture::GetCubeMapSurface(D3DCUBEMAP_FACES FaceType
 
 			D3D9ProxySurface* pWrappedSurfaceLevel = new D3D9ProxySurface(pActualSurfaceLevelLeft, pActualSurfaceLevelRight, m_pOwningDevice, this, NULL, NULL);
 
-			if(m_wrappedSurfaceLevels.insert(std::pair<CubeSurfaceKey, D3D9ProxySurface*>(key, pWrappedSurfaceLevel)).second) {
-				// insertion of wrapped surface level into m_wrappedSurfaceLevels succeeded
+			if (validIndex) {
+				m_wrappedSurfaceLevels[index] = pWrappedSurfaceLevel;
 				*ppCubeMapSurface = pWrappedSurfaceLevel;
 				(*ppCubeMapSurface)->AddRef();
 				finalResult = D3D_OK;
 			}
 			else {
-				// Failure to insert should not be possible. In this case we could still return the wrapped surface,
+				// Failure to store should not be possible. In this case we could still return the wrapped surface,
 				// however, if we did and it was requested again a new wrapped instance will be returned and things would explode
 				// at some point. Better to fail fast.
 				OutputDebugString(__FUNCTION__);
 				OutputDebugString("\n");
 				OutputDebugString("Unable to store surface level.\n");
 				assert(false);
+				delete pWrappedSurfaceLevel;
 
 				finalResult = D3DERR_INVALIDCALL;
 			}
@@ -246,6 +252,7 @@ HRESULT WINAPI D3D9ProxyCubeTexture::GetCubeMapSurface(D3DCUBEMAP_FACES FaceType
 HRESULT WINAPI D3D9ProxyCubeTexture::LockRect(D3DCUBEMAP_FACES FaceType, UINT Level, D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags)
 {
 	SHOW_CALL("D3D9ProxyCubeTexture::LockRect");
+	m_pOwningDevice->FlushStereoBatch();
 
 	D3DSURFACE_DESC desc;
 	m_pActualTexture->GetLevelDesc(0, &desc);
@@ -325,6 +332,7 @@ HRESULT WINAPI D3D9ProxyCubeTexture::LockRect(D3DCUBEMAP_FACES FaceType, UINT Le
 HRESULT WINAPI D3D9ProxyCubeTexture::UnlockRect(D3DCUBEMAP_FACES FaceType, UINT Level)
 {
 	SHOW_CALL("D3D9ProxyCubeTexture::UnlockRect");
+	m_pOwningDevice->FlushStereoBatch();
 
 	D3DSURFACE_DESC desc;
 	m_pActualTexture->GetLevelDesc(Level, &desc);
@@ -40,21 +40,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <utility>
 #include <mutex>
 
-/**
-* Pair to use as key for storing surface levels.
-***/
-typedef std::pair<D3DCUBEMAP_FACES,UINT> CubeSurfaceKey;
-
-/**
-* Hash for surface level key.
-***/
-struct hash_CubeSurfaceKey {
-    size_t operator()(const CubeSurfaceKey &cubeSurfaceKey ) const
-    {
-        return std::hash<int>()(cubeSurfaceKey.first) ^ std::hash<UINT>()(cubeSurfaceKey.second);
-    }
-};
-
 /**
 *  Direct 3D proxy Cube Texture class. 
 *  Overwrites BaseDirect3DCubeTexture9 and imbeds the wrapped surface levels.
@@ -87,9 +72,10 @@ public:
 
 protected:
 	/**
-	* Wrapped Surface levels.
+	* Wrapped Surface levels, indexed by (face * level count + level) (NULL if not wrapped yet).
+	* Sized to six faces of the level count of the texture when the first surface is wrapped.
 	***/
-	std::unordered_map<CubeSurfaceKey, D3D9ProxySurface*, hash_CubeSurfaceKey> m_wrappedSurfaceLevels;
+	std::vector<D3D9ProxySurface*> m_wrappedSurfaceLevels;
 	/**
 	* The owning device.
 	* @see D3D9ProxySurface::m_pOwningDevice
@@ -36,8 +36,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 D3D9ProxyPixelShader::D3D9ProxyPixelShader(IDirect3DPixelShader9* pActualPixelShader, D3DProxyDevice *pOwningDevice, ShaderModificationRepository* pModLoader) :
 	BaseDirect3DPixelShader9(pActualPixelShader, pOwningDevice),
 	m_pActualDevice(pOwningDevice->getActual()),
-	m_shaderObjectType(ShaderObjectTypeUnknown)
+	m_shaderObjectType(ShaderObjectTypeUnknown),
+	m_shaderHash(0)
 {
+	// hash the shader function once, binding the shader must not touch the function again
+	UINT sizeOfData = 0;
+	if (SUCCEEDED(pActualPixelShader->GetFunction(NULL, &sizeOfData)) && (sizeOfData > 0))
+	{
+		std::vector<BYTE> data(sizeOfData);
+		if (SUCCEEDED(pActualPixelShader->GetFunction(&data[0], &sizeOfData)))
+			MurmurHash3_x86_32(&data[0], sizeOfData, VIREIO_SEED, &m_shaderHash);
+	}
+
 	if (pModLoader)
 	{
 		m_modifiedConstants = pModLoader->GetModifiedConstantsF(pActualPixelShader);
@@ -52,11 +62,11 @@ D3D9ProxyPixelShader::~D3D9ProxyPixelShader()
 {}
 
 /**
-* Returns modified constants pointer.
+* Returns modified constants pointer (NULL if there are none).
 ***/
-std::map<UINT, StereoShaderConstant<float>>* D3D9ProxyPixelShader::ModifiedConstants()
+const StereoConstantSet* D3D9ProxyPixelShader::ModifiedConstants()
 {
-	return &m_modifiedConstants;
+	return m_modifiedConstants.get();
 }
 
 /**
@@ -66,3 +76,11 @@ ShaderObjectType D3D9ProxyPixelShader::GetShaderObjectType()
 {
 	return m_shaderObjectType;
 }
+
+/**
+* Returns the hash code of the shader function.
+***/
+uint32_t D3D9ProxyPixelShader::GetShaderHash()
+{
+	return m_shaderHash;
+}
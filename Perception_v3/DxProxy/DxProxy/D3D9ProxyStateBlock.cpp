@@ -47,17 +47,16 @@ D3D9ProxyStateBlock::D3D9ProxyStateBlock(IDirect3DStateBlock9* pActualStateBlock
 	m_eCaptureMode(type),
 	m_storedTextureStages(),
 	m_storedVertexBuffers(),
+	m_storedRenderStates(),
 	m_storedViewport(),
 	m_eSidesAre(isSideLeft ? SidesAllLeft : SidesAllRight),
 	m_selectedStates(),
-	m_selectedTextureSamplers(),
-	m_selectedVertexStreams(),
+	m_selectedTextureSamplers(0),
+	m_selectedVertexStreams(0),
 	m_storedSelectedPSRegistersF(),
 	m_storedAllPSRegistersF(),
-	m_selectedPixelConstantRegistersF(),
 	m_storedSelectedVSRegistersF(),
-	m_storedAllVSRegistersF(),
-	m_selectedVertexConstantRegistersF()
+	m_storedAllVSRegistersF()
 {
 	assert (pOwningDevice != NULL);
 
@@ -126,10 +125,10 @@ D3D9ProxyStateBlock::~D3D9ProxyStateBlock()
 	ClearCapturedData();
 
 	m_selectedStates.clear();
-	m_selectedTextureSamplers.clear();
-	m_selectedVertexStreams.clear();
-	m_selectedPixelConstantRegistersF.clear();
-	m_selectedVertexConstantRegistersF.clear();
+	m_selectedTextureSamplers = 0;
+	m_selectedVertexStreams = 0;
+	m_storedSelectedPSRegistersF.Clear();
+	m_storedSelectedVSRegistersF.Clear();
 
 	m_pWrappedDevice->Release();
 }
@@ -140,6 +139,8 @@ D3D9ProxyStateBlock::~D3D9ProxyStateBlock()
 ***/
 HRESULT WINAPI D3D9ProxyStateBlock::Capture()
 {
+	m_pWrappedDevice->FlushStereoBatch();
+
 	HRESULT result = BaseDirect3DStateBlock9::Capture();
 
 	if (SUCCEEDED(result)) {
@@ -175,6 +176,7 @@ HRESULT WINAPI D3D9ProxyStateBlock::Apply()
 	// (probably an error in D3D but haven't tested to check)
 	assert (!m_pWrappedDevice->m_bInBeginEndStateBlock);
 
+	m_pWrappedDevice->FlushStereoBatch();
 
 	// If all stereo states recorded on the same side then switch the proxy device to that side
 	if (m_eSidesAre == SidesAllLeft) {
@@ -205,28 +207,27 @@ HRESULT WINAPI D3D9ProxyStateBlock::Apply()
 
 
 
-		// Apply non-stereo indexed states
-		auto itVertexBuffer = m_storedVertexBuffers.begin();
-		while (itVertexBuffer != m_storedVertexBuffers.end()) {
+		// Render states, the actual state block applied them behind the render state shadow of the proxy device
+		switch (m_eCaptureMode) 
+		{
+		case Cap_Type_Selected:
+			m_pWrappedDevice->m_renderStateShadow.CopyKnown(m_storedRenderStates);
+			break;
 
-			// Remove and Release existing buffer in proxy device
-			if (m_pWrappedDevice->m_activeVertexBuffers.count(itVertexBuffer->first) == 1) {
+		case Cap_Type_Full:
+			// states unknown at capture time are unknown now
+			m_pWrappedDevice->m_renderStateShadow = m_storedRenderStates;
+			break;
 
-				auto removing = m_pWrappedDevice->m_activeVertexBuffers[itVertexBuffer->first];
-				if (removing != NULL) {
-					removing->Release();
-				}
-				m_pWrappedDevice->m_activeVertexBuffers.erase(itVertexBuffer->first);
-			}
+		default:
+			m_pWrappedDevice->m_renderStateShadow.ForgetAll();
+			break;
+		}
 
-			auto inserted = m_pWrappedDevice->m_activeVertexBuffers.insert(std::pair<UINT, BaseDirect3DVertexBuffer9*>(itVertexBuffer->first, itVertexBuffer->second));
-			// insert success and buffer not NULL
-			if (inserted.second && inserted.first->second) {
-				inserted.first->second->AddRef();
-			}
 
-			++itVertexBuffer;
-		}
+
+		// Apply non-stereo indexed states, replaces (and releases) existing buffers in proxy device
+		m_pWrappedDevice->m_activeVertexBuffers.CopyBound(m_storedVertexBuffers, m_storedVertexBuffers.AllSlots());
 
 
 
@@ -267,39 +268,19 @@ HRESULT WINAPI D3D9ProxyStateBlock::Apply()
 		if (reApplyStereo) {
 
 			// Textures
-			auto itTextures = m_storedTextureStages.begin();
-			while (itTextures != m_storedTextureStages.end()) {
-
-				m_pWrappedDevice->SetTexture(itTextures->first, itTextures->second);
-				++itTextures;
+			uint32_t mask = m_storedTextureStages.GetBoundMask();
+			for (UINT slot = 0; mask; slot++, mask >>= 1) {
+				if (mask & 1)
+					m_pWrappedDevice->SetTexture(SlotToTextureStage(slot), m_storedTextureStages.Get(slot));
 			}
 		}
 		// Update the internal state of the proxy device for the above indexed stereo states without applying to the actual device (actual stateblock will
 		// have applied the correct state already)
 		else {
 
-			// Textures 
-			auto itTextures = m_storedTextureStages.begin();
-			while (itTextures != m_storedTextureStages.end()) {
-
-				// Remove and Release existing active texture in proxy device
-				if (m_pWrappedDevice->m_activeTextureStages.count(itTextures->first) == 1) {
-
-					auto removing = m_pWrappedDevice->m_activeTextureStages[itTextures->first];
-					if (removing != NULL) {
-						removing->Release();
-					}
-					m_pWrappedDevice->m_activeTextureStages.erase(itTextures->first);
-				}
-
-				auto inserted = m_pWrappedDevice->m_activeTextureStages.insert(std::pair<DWORD, IDirect3DBaseTexture9*>(itTextures->first, itTextures->second));
-				// insert success and texture not NULL
-				if (inserted.second && inserted.first->second) {
-					inserted.first->second->AddRef();
-				}
-
-				++itTextures;
-			}
+			// Textures, replaces (and releases) existing active textures in proxy device
+			m_pWrappedDevice->m_activeTextureStages.CopyBound(m_storedTextureStages, m_storedTextureStages.AllSlots());
+			m_pWrappedDevice->RecordStereoTextures(m_storedTextureStages.GetBoundMask());
 		}
 	}
 
@@ -483,21 +464,12 @@ void D3D9ProxyStateBlock::SelectAndCaptureState(DWORD Stage, IDirect3DBaseTextur
 	assert (m_pWrappedDevice->m_bInBeginEndStateBlock);
 	assert (!m_pActualStateBlock);
 
-	m_selectedTextureSamplers.insert(Stage);
-
-	if (m_storedTextureStages.count(Stage) == 1) {
-		IDirect3DBaseTexture9* pOldTexture = m_storedTextureStages.at(Stage);
-
-		if (pOldTexture)
-			pOldTexture->Release();
-
-		m_storedTextureStages.erase(Stage);
-	}
+	UINT slot = TextureStageToSlot(Stage);
+	if (slot == BINDING_INVALID_SLOT)
+		return;
 
-	if(m_storedTextureStages.insert(std::pair<DWORD, IDirect3DBaseTexture9*>(Stage, pWrappedTexture)).second) {
-		if (pWrappedTexture)
-			pWrappedTexture->AddRef();
-	}
+	m_selectedTextureSamplers |= (1u << slot);
+	m_storedTextureStages.Bind(slot, pWrappedTexture);
 
 	updateCaptureSideTracking();
 }
@@ -513,21 +485,26 @@ void D3D9ProxyStateBlock::SelectAndCaptureState(UINT StreamNumber, BaseDirect3DV
 	assert (m_pWrappedDevice->m_bInBeginEndStateBlock);
 	assert (!m_pActualStateBlock);
 
-	m_selectedVertexStreams.insert(StreamNumber);
-
-	if (m_storedVertexBuffers.count(StreamNumber) == 1) {
-		BaseDirect3DVertexBuffer9* pOldBuffer = m_storedVertexBuffers.at(StreamNumber);
+	if (StreamNumber >= BINDING_VERTEX_STREAMS)
+		return;
 
-		if (pOldBuffer)
-			pOldBuffer->Release();
+	m_selectedVertexStreams |= (1u << StreamNumber);
+	m_storedVertexBuffers.Bind(StreamNumber, pWrappedStreamData);
+}
 
-		m_storedVertexBuffers.erase(StreamNumber);
-	}
+/**
+* Adds a render, sampler or texture stage state to the selected states and captures its value.
+* Use these methods when the respective methods on the device are called between Start/End StateBlock.
+* @param shadowIndex The state index. @see RenderStateShadow::RenderStateIndex()
+* @param Value The state value.
+***/
+void D3D9ProxyStateBlock::SelectAndCaptureRenderState(UINT shadowIndex, DWORD Value)
+{
+	assert(m_eCaptureMode == Cap_Type_Selected);
+	assert (m_pWrappedDevice->m_bInBeginEndStateBlock);
+	assert (!m_pActualStateBlock);
 
-	if(m_storedVertexBuffers.insert(std::pair<DWORD, BaseDirect3DVertexBuffer9*>(StreamNumber, pWrappedStreamData)).second) {
-		if (pWrappedStreamData)
-			pWrappedStreamData->AddRef();
-	}
+	m_storedRenderStates.Set(shadowIndex, Value);
 }
 
 /** 
@@ -549,10 +526,7 @@ HRESULT WINAPI D3D9ProxyStateBlock::SelectAndCaptureStateVSConst(UINT StartRegis
 
 	if (SUCCEEDED(result)) {
 		// Mark these registers as being tracked and save them
-		for (UINT i = StartRegister; i < (StartRegister + Vector4fCount); i++) {
-			m_selectedVertexConstantRegistersF.insert(i);
-			m_storedSelectedVSRegistersF.insert(std::pair<UINT, D3DXVECTOR4>(i, pConstantData));
-		}
+		m_storedSelectedVSRegistersF.Store(StartRegister, pConstantData, Vector4fCount);
 	}
 
 	return result;
@@ -577,10 +551,7 @@ HRESULT WINAPI D3D9ProxyStateBlock::SelectAndCaptureStatePSConst(UINT StartRegis
 
 	if (SUCCEEDED(result)) {
 		// Mark these registers as being tracked and save them
-		for (UINT i = StartRegister; i < (StartRegister + Vector4fCount); i++) {
-			m_selectedPixelConstantRegistersF.insert(i);
-			m_storedSelectedPSRegistersF.insert(std::pair<UINT, D3DXVECTOR4>(i, pConstantData));
-		}
+		m_storedSelectedPSRegistersF.Store(StartRegister, pConstantData, Vector4fCount);
 	}
 
 	return result;
@@ -638,36 +609,19 @@ void D3D9ProxyStateBlock::CaptureSelectedFromProxyDevice()
 		{
 			// if full - copy all textures, vertex buffers and shader constants.
 
-			// Textures
-			m_storedTextureStages = m_pWrappedDevice->m_activeTextureStages;
-
+			// Textures (increases the ref count on all copied textures)
 			// TODO Do we need to copy Textures rather than just keeping reference. Textures could be changed (have new data stretched/copied into them) 
 			// TODO Check actual behaviour of state block. Is it saving a reference to the texture or a copy of the texture??
-			// Need to increase ref count on all copied textures
-			auto itTextures = m_storedTextureStages.begin();
-			while (itTextures != m_storedTextureStages.end()) {
-				if (itTextures->second != NULL) {
-					itTextures->second->AddRef();
-				}
-				++itTextures;
-			}
-
-
-			// Vertex buffers
-			m_storedVertexBuffers = m_pWrappedDevice->m_activeVertexBuffers;
+			m_storedTextureStages.CopyBound(m_pWrappedDevice->m_activeTextureStages, m_storedTextureStages.AllSlots());
 
+			// Vertex buffers (increases the ref count on all copied vbs)
 			// TODO same question as for Textures above
-			// Need to increase ref count on all copied vbs
-			auto itVB = m_storedVertexBuffers.begin();
-			while (itVB != m_storedVertexBuffers.end()) {
-				if (itVB->second != NULL) {
-					itVB->second->AddRef();
-				}
-				++itVB;
-			}
+			m_storedVertexBuffers.CopyBound(m_pWrappedDevice->m_activeVertexBuffers, m_storedVertexBuffers.AllSlots());
 
+			// Render states (as far as known)
+			m_storedRenderStates = m_pWrappedDevice->m_renderStateShadow;
 
-			// Vertex Shader constants
+			// Vertex Shader constants (bulk copy, reuses the capacity of the last capture)
 			m_storedAllVSRegistersF = m_pWrappedDevice->m_spManagedShaderRegisters->GetAllVSConstantRegistersF();
 			// Pixel Shader constants
 			m_storedAllPSRegistersF = m_pWrappedDevice->m_spManagedShaderRegisters->GetAllPSConstantRegistersF();
@@ -691,71 +645,21 @@ void D3D9ProxyStateBlock::CaptureSelectedFromProxyDevice()
 
 	case Cap_Type_Selected:
 		{
-			// if selected - iterate m_selectedTextureSamplers, m_selectedVertexStreams and m_selectedVertexConstantRegistersF and copy as selected.
-
-			auto itSelectedTextures = m_selectedTextureSamplers.begin();
-			while (itSelectedTextures != m_selectedTextureSamplers.end()) {
-
-				if (m_pWrappedDevice->m_activeTextureStages.count(*itSelectedTextures) == 1) {
-
-					auto inserted = m_storedTextureStages.insert(std::pair<DWORD, IDirect3DBaseTexture9*>(*itSelectedTextures, m_pWrappedDevice->m_activeTextureStages[*itSelectedTextures]));
-					// insert success and texture is not NULL
-					if (inserted.second && inserted.first->second) {
-						inserted.first->second->AddRef();
-					}
-					else { // insertfailed
-						//OutputDebugString("Texture sampler capture to StateBlock failed");
-						//TODO aaaaa why does this get spammed
-					}
-				}
-
-				++itSelectedTextures;
-			}
+			// if selected - copy the samplers and streams in m_selectedTextureSamplers, m_selectedVertexStreams (if bound in the device)
+			// and copy the selected shader constant registers, one block per run of contiguous registers.
+			m_storedTextureStages.CopyBound(m_pWrappedDevice->m_activeTextureStages, m_selectedTextureSamplers);
+			m_storedVertexBuffers.CopyBound(m_pWrappedDevice->m_activeVertexBuffers, m_selectedVertexStreams);
 
-
-			auto itSelectedVertexStreams = m_selectedVertexStreams.begin();
-			while (itSelectedVertexStreams != m_selectedVertexStreams.end()) {
-
-				if (m_pWrappedDevice->m_activeVertexBuffers.count(*itSelectedVertexStreams) == 1) {
-
-					auto inserted = m_storedVertexBuffers.insert(std::pair<UINT, BaseDirect3DVertexBuffer9*>(*itSelectedVertexStreams, m_pWrappedDevice->m_activeVertexBuffers[*itSelectedVertexStreams]));
-					// insert success and buffer is not NULL
-					if (inserted.second && inserted.first->second) {
-						inserted.first->second->AddRef();
-					}
-					else { // insertfailed
-						//Need to find out why this is repeatedly written in Bioshock 2
-						//OutputDebugString("Vertex buffer capture to StateBlock failed");
-					}
-				}
-
-				++itSelectedVertexStreams;
-			}
+			// Recorded render states, the actual state block captured their current values
+			m_storedRenderStates.RefreshKnown(m_pWrappedDevice->m_renderStateShadow, m_pWrappedDevice->getActual());
 
 
 
 			// Vertex Shader constants
-			float currentRegister [4];
-			auto itSelectedVertexConstants = m_selectedVertexConstantRegistersF.begin();
-			while (itSelectedVertexConstants != m_selectedVertexConstantRegistersF.end()) {
-
-				m_pWrappedDevice->m_spManagedShaderRegisters->GetVertexShaderConstantF(*itSelectedVertexConstants, currentRegister, 1);
-
-				m_storedSelectedVSRegistersF.insert(std::pair<UINT, D3DXVECTOR4>(*itSelectedVertexConstants, currentRegister));
-
-				++itSelectedVertexConstants;
-			}
+			m_storedSelectedVSRegistersF.CaptureFrom(m_pWrappedDevice->m_spManagedShaderRegisters->GetAllVSConstantRegistersF());
 
 			// Pixel Shader constants
-			auto itSelectedPixelConstants = m_selectedPixelConstantRegistersF.begin();
-			while (itSelectedPixelConstants != m_selectedPixelConstantRegistersF.end()) {
-
-				m_pWrappedDevice->m_spManagedShaderRegisters->GetPixelShaderConstantF(*itSelectedPixelConstants, currentRegister, 1);
-
-				m_storedSelectedPSRegistersF.insert(std::pair<UINT, D3DXVECTOR4>(*itSelectedPixelConstants, currentRegister));
-
-				++itSelectedPixelConstants;
-			}
+			m_storedSelectedPSRegistersF.CaptureFrom(m_pWrappedDevice->m_spManagedShaderRegisters->GetAllPSConstantRegistersF());
 
 			break;
 		}
@@ -857,26 +761,11 @@ void D3D9ProxyStateBlock::Capture(CaptureableState toCap)
 ***/
 void D3D9ProxyStateBlock::ClearCapturedData()
 {
-	auto it = m_storedTextureStages.begin();
-	while (it != m_storedTextureStages.end()) {
-		if (it->second)
-			it->second->Release();
-		++it;
-	}
-	m_storedTextureStages.clear();
-
-	auto it2 = m_storedVertexBuffers.begin();
-	while (it2 != m_storedVertexBuffers.end()) {
-		if (it2->second)
-			it2->second->Release();
-		++it2;
-	}
-	m_storedVertexBuffers.clear();
+	m_storedTextureStages.UnbindAll();
+	m_storedVertexBuffers.UnbindAll();
 
-	m_storedSelectedVSRegistersF.clear();
+	// selected registers keep their selection, the data is overwritten on the next capture
 	m_storedAllVSRegistersF.clear();
-
-	m_storedSelectedPSRegistersF.clear();
 	m_storedAllPSRegistersF.clear();
 
 	if (m_pStoredIndicies) {
@@ -43,7 +43,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "D3D9ProxyVertexShader.h"
 #include "Direct3DPixelShader9.h"
 #include "Direct3DVertexDeclaration9.h"
-#include "StereoShaderConstant.h"
+#include "StereoConstantSet.h"
+#include "BindingSlots.h"
+#include "RenderStateShadow.h"
 
 class BaseDirect3DStateBlock9;
 class D3DProxyDevice;
@@ -127,7 +129,7 @@ public:
 	{
 		Texture = 1,					/**< needs to track which sampler **/
 		VertexBuffer = 2,				/**< needs to track which stream **/
-		VertexShaderConstantsF = 3,		/**< StereoShaderConstants only, leave the rest to the actual state block **/
+		VertexShaderConstantsF = 3,		/**< Modified (stereo) constants only, leave the rest to the actual state block **/
 	};
 
 	D3D9ProxyStateBlock(IDirect3DStateBlock9* pActualStateBlock, D3DProxyDevice* pOwningDevice, CaptureType type, bool isSideLeft);
@@ -147,6 +149,7 @@ public:
 	void           SelectAndCaptureState(BaseDirect3DVertexDeclaration9* pWrappedVertexDeclaration);
 	void           SelectAndCaptureState(DWORD Stage, IDirect3DBaseTexture9* pWrappedTexture);
 	void           SelectAndCaptureState(UINT StreamNumber, BaseDirect3DVertexBuffer9* pWrappedStreamData);
+	void           SelectAndCaptureRenderState(UINT shadowIndex, DWORD Value);
 	HRESULT WINAPI SelectAndCaptureStateVSConst(UINT StartRegister,CONST float* pConstantData,UINT Vector4fCount);
 	HRESULT WINAPI SelectAndCaptureStatePSConst(UINT StartRegister,CONST float* pConstantData,UINT Vector4fCount);
 	void           EndStateBlock(IDirect3DStateBlock9* pActualStateBlock);
@@ -188,28 +191,30 @@ private:
 	std::unordered_set<CaptureableState> m_selectedStates;
 	/**
 	* Selected States to capture are only relevant if CaptureType is Cap_Type_Selected.
+	* Bitmask of dense sampler slots. @see TextureStageToSlot()
 	***/
-	std::unordered_set<DWORD> m_selectedTextureSamplers; 
+	uint32_t m_selectedTextureSamplers; 
 	/**
 	* Selected States to capture are only relevant if CaptureType is Cap_Type_Selected.
+	* Bitmask of stream numbers.
 	***/
-	std::unordered_set<UINT> m_selectedVertexStreams;
-	/**
-	* Selected States to capture are only relevant if CaptureType is Cap_Type_Selected.
-	***/
-	std::unordered_set<UINT> m_selectedVertexConstantRegistersF;
-	/**
-	* Selected States to capture are only relevant if CaptureType is Cap_Type_Selected.
-	***/
-	std::unordered_set<UINT> m_selectedPixelConstantRegistersF;
+	uint32_t m_selectedVertexStreams;
 	/**
 	* General States - Textures in samplers (standard, vertex and displacement).
 	***/
-	std::unordered_map<DWORD, IDirect3DBaseTexture9*> m_storedTextureStages;
+	BindingSlots<IDirect3DBaseTexture9, BINDING_TEXTURE_SLOTS> m_storedTextureStages;
 	/**
 	* General States - Vertex Buffers.
 	***/
-	std::unordered_map<UINT, BaseDirect3DVertexBuffer9*> m_storedVertexBuffers;
+	BindingSlots<BaseDirect3DVertexBuffer9, BINDING_VERTEX_STREAMS> m_storedVertexBuffers;
+	/**
+	* General States - Render, sampler and texture stage states.
+	* Cap_Type_Selected : the states recorded between Begin/End StateBlock.
+	* Cap_Type_Full : the states known in the device shadow at capture time.
+	* Used to keep the render state shadow of the proxy device up to date on Apply().
+	* @see D3DProxyDevice::m_renderStateShadow
+	***/
+	RenderStateShadow m_storedRenderStates;
 	/**
 	* General States - Index Buffer.
 	***/
@@ -247,8 +252,9 @@ private:
 	/**
 	* Vertex Shader States -  Shader registers 
 	* Use this when using Cap_Type_Selected.
+	* Selection (bitmask) and captured data of the registers set between Begin/End StateBlock.
 	**/
-	std::map<UINT, D3DXVECTOR4> m_storedSelectedVSRegistersF;
+	RegisterCaptureStore m_storedSelectedVSRegistersF;
 	/**
 	* Vertex Shader States -  Shader registers 
 	* Use this to copy everything when needed with other modes.
@@ -261,8 +267,9 @@ private:
 	/**
 	* Pixel Shader States -  Shader registers 
 	* Use this when using Cap_Type_Selected.
+	* Selection (bitmask) and captured data of the registers set between Begin/End StateBlock.
 	**/
-	std::map<UINT, D3DXVECTOR4> m_storedSelectedPSRegistersF;
+	RegisterCaptureStore m_storedSelectedPSRegistersF;
 	/**
 	* Pixel Shader States -  Shader registers 
 	* Use this to copy everything when needed with other modes.
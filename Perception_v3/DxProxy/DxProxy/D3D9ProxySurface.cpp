@@ -30,6 +30,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <assert.h>
 #include "D3D9ProxySurface.h"
 #include "D3DProxyDevice.h"
+#include "D3D9ProxyTexture.h"
 
 /**
 * Constructor.
@@ -41,12 +42,12 @@ D3D9ProxySurface::D3D9ProxySurface(IDirect3DSurface9* pActualSurfaceLeft, IDirec
 								   BaseDirect3DDevice9* pOwningDevice, IUnknown* pWrappedContainer, HANDLE SharedHandleLeft, HANDLE SharedHandleRight) :
 	BaseDirect3DSurface9(pActualSurfaceLeft),
 	m_pActualSurfaceRight(pActualSurfaceRight),
+	m_pDeferredStereoTexture(NULL),
 	m_pOwningDevice(pOwningDevice),
 	m_pWrappedContainer(pWrappedContainer),
 	m_SharedHandleLeft(SharedHandleLeft),
 	m_SharedHandleRight(SharedHandleRight),
-	lockableSysMemTexture(NULL),
-	fullSurface(false)
+	lockableSysMemTexture(NULL)
 {
 	SHOW_CALL("D3D9ProxySurface::D3D9ProxySurface()");
 
@@ -81,6 +82,37 @@ D3D9ProxySurface::~D3D9ProxySurface()
 		m_pActualSurfaceRight->Release();
 }
 
+/**
+* Pool of all proxy surfaces (derived classes use the heap).
+* Leaked on purpose : surfaces released at process exit, after the static destructors ran, still return
+* their memory to it.
+***/
+ProxyObjectPool* const D3D9ProxySurface::s_pPool = new ProxyObjectPool(sizeof(D3D9ProxySurface));
+
+/**
+* Allocates the object from the pool.
+***/
+void* D3D9ProxySurface::operator new(size_t size)
+{
+	return s_pPool->Allocate(size);
+}
+
+/**
+* Returns the object to the pool.
+***/
+void D3D9ProxySurface::operator delete(void* p, size_t size)
+{
+	s_pPool->Free(p, size);
+}
+
+/**
+* Allocation counts and memory footprint of the pool.
+***/
+ProxyPoolStats D3D9ProxySurface::GetPoolStats()
+{
+	return s_pPool->GetStats();
+}
+
 /**
 * Behaviour determined through observing D3D with various test cases.
 *
@@ -247,6 +279,7 @@ void WriteDesc(D3DSURFACE_DESC &desc)
 HRESULT WINAPI D3D9ProxySurface::LockRect(D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags)
 {
 	SHOW_CALL("D3D9ProxySurface::LockRect");
+	m_pOwningDevice->FlushStereoBatch();
 
 	D3DSURFACE_DESC desc;
 	m_pActualSurface->GetDesc(&desc);
@@ -256,20 +289,13 @@ HRESULT WINAPI D3D9ProxySurface::LockRect(D3DLOCKED_RECT* pLockedRect, CONST REC
 		return m_pActualSurface->LockRect(pLockedRect, pRect, Flags);
 	}
 
+	//Texture levels locked on the texture must be uploaded first, this lock copies back over them
+	static_cast<D3DProxyDevice*>(m_pOwningDevice)->UploadLockedTextures();
+
 	//Guard against multithreaded access as this could be causing us problems
 	std::lock_guard<std::mutex> lck (m_mtx);
 
 	//Create lockable system memory surfaces
-	if (pRect && !fullSurface)
-	{
-		lockedRects.push_back(*pRect);
-	}
-	else
-	{
-		lockedRects.clear();
-		fullSurface = true;
-	}
-
 	HRESULT hr = D3DERR_INVALIDCALL;
 	IDirect3DSurface9 *pSurface = NULL;
 	bool createdTexture = false;
@@ -300,12 +326,15 @@ HRESULT WINAPI D3D9ProxySurface::LockRect(D3DLOCKED_RECT* pLockedRect, CONST REC
 
 	//And finally, lock the memory surface
 	hr = pSurface->LockRect(pLockedRect, pRect, Flags);
+	pSurface->Release();
 	if (FAILED(hr))
 		return hr;
 
 	lockedRect = *pLockedRect;
 
-	pSurface->Release();
+	//Only a successful lock marks the rectangle, read only locks leave nothing to copy back
+	if (!(Flags & D3DLOCK_READONLY))
+		lockedRects.Add(pRect);
 
 	return hr;
 }
@@ -316,6 +345,7 @@ HRESULT WINAPI D3D9ProxySurface::LockRect(D3DLOCKED_RECT* pLockedRect, CONST REC
 HRESULT WINAPI D3D9ProxySurface::UnlockRect()
 {
 	SHOW_CALL("D3D9ProxySurface::UnlockRect");
+	m_pOwningDevice->FlushStereoBatch();
 
 	D3DSURFACE_DESC desc;
 	m_pActualSurface->GetDesc(&desc);
@@ -328,8 +358,8 @@ HRESULT WINAPI D3D9ProxySurface::UnlockRect()
 	std::lock_guard<std::mutex> lck (m_mtx);
 
 	//This would mean nothing to do
-	if (lockedRects.size() == 0 && !fullSurface)
-		return S_OK;
+	if (lockedRects.IsEmpty())
+		return lockableSysMemTexture ? lockableSysMemTexture->UnlockRect(0) : S_OK;
 
 	IDirect3DSurface9 *pSurface = NULL;
 	HRESULT hr = lockableSysMemTexture ? lockableSysMemTexture->GetSurfaceLevel(0, &pSurface) : D3DERR_INVALIDCALL;
@@ -340,61 +370,40 @@ HRESULT WINAPI D3D9ProxySurface::UnlockRect()
 
 	if (IsStereo())
 	{
-		if (fullSurface)
-		{
-			hr = m_pOwningDevice->getActual()->UpdateSurface(pSurface, NULL, m_pActualSurfaceRight, NULL);
-			if (FAILED(hr))
-				WriteDesc(desc);
-		}
-		else
-		{
-			std::vector<RECT>::iterator rectIter = lockedRects.begin();
-			while (rectIter != lockedRects.end())
-			{
-				POINT p;
-				p.x = rectIter->left;
-				p.y = rectIter->top;
-				hr = m_pOwningDevice->getActual()->UpdateSurface(pSurface, &(*rectIter), m_pActualSurfaceRight, &p);
-				if (FAILED(hr))
-					WriteDesc(desc);
-				rectIter++;
-			}
-		}
-	}
-
-	if (fullSurface)
-	{
-		hr = m_pOwningDevice->getActual()->UpdateSurface(pSurface, NULL, m_pActualSurface, NULL);
+		hr = lockedRects.Update(m_pOwningDevice->getActual(), pSurface, m_pActualSurfaceRight);
 		if (FAILED(hr))
 			WriteDesc(desc);
 	}
-	else
-	{
-		std::vector<RECT>::iterator rectIter = lockedRects.begin();
-		while (rectIter != lockedRects.end())
-		{
-			POINT p;
-			p.x = rectIter->left;
-			p.y = rectIter->top;
-			hr = m_pOwningDevice->getActual()->UpdateSurface(pSurface, &(*rectIter), m_pActualSurface, &p);
-			if (FAILED(hr))
-				WriteDesc(desc);
-			rectIter++;
-		}
-	}
+
+	hr = lockedRects.Update(m_pOwningDevice->getActual(), pSurface, m_pActualSurface);
+	if (FAILED(hr))
+		WriteDesc(desc);
 
 	pSurface->Release();
 
-	fullSurface = false;
+	//Copied, the next lock starts clean
+	lockedRects.Clear();
 	return hr;
 }
 
+/**
+* Retrieves a device context, deferred draws are replayed first.
+***/
+HRESULT WINAPI D3D9ProxySurface::GetDC(HDC* phdc)
+{
+	SHOW_CALL("D3D9ProxySurface::GetDC");
+	m_pOwningDevice->FlushStereoBatch();
+
+	return BaseDirect3DSurface9::GetDC(phdc);
+}
+
 /**
 * Releases device context on both (left/right) surfaces.
 ***/
 HRESULT WINAPI D3D9ProxySurface::ReleaseDC(HDC hdc)
 {
 	SHOW_CALL("D3D9ProxySurface::ReleaseDC");
+	m_pOwningDevice->FlushStereoBatch();
 	if (IsStereo())
 		m_pActualSurfaceRight->ReleaseDC(hdc);
 
@@ -425,6 +434,36 @@ IDirect3DSurface9* D3D9ProxySurface::getActualRight()
 	return m_pActualSurfaceRight;
 }
 
+/**
+* Creates the right surface if this surface is a level of a texture that creates its right texture on demand.
+* Called before the surface is drawn or copied to per side.
+***/
+void D3D9ProxySurface::MakeStereo()
+{
+	if (m_pDeferredStereoTexture)
+		m_pDeferredStereoTexture->MarkStereoDivergent();
+}
+
+/**
+* Sets the texture creating the right surface of this level on demand.
+* @see MakeStereo()
+***/
+void D3D9ProxySurface::SetDeferredStereo(D3D9ProxyTexture* pContainerTexture)
+{
+	m_pDeferredStereoTexture = pContainerTexture;
+}
+
+/**
+* Sets the right surface of a texture level when the texture created its right texture.
+* The surface takes over the reference.
+***/
+void D3D9ProxySurface::SetActualRight(IDirect3DSurface9* pActualSurfaceRight)
+{
+	assert(m_pActualSurfaceRight == NULL);
+	m_pActualSurfaceRight = pActualSurfaceRight;
+	m_pDeferredStereoTexture = NULL;
+}
+
 HANDLE D3D9ProxySurface::getHandleLeft()
 {
 	return m_SharedHandleLeft;
@@ -32,11 +32,15 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <d3d9.h>
 #include "Direct3DSurface9.h"
+#include "ProxyObjectPool.h"
+#include "DirtyRectSet.h"
 #include "Direct3DDevice9.h"
 #include "IStereoCapableWrapper.h"
 #include <stdio.h>
 #include <mutex>
 
+class D3D9ProxyTexture;
+
 /**
 *  Direct 3D proxy surface class. 
 *  Overwrites wrapped surface class (BaseDirect3DSurface9) and imbeds additional right surface.
@@ -48,6 +52,11 @@ public:
 		HANDLE SharedHandleLeft, HANDLE SharedHandleRight);
 	virtual ~D3D9ProxySurface();
 
+	/*** D3D9ProxySurface pool allocation ***/
+	static void* operator new(size_t size);
+	static void  operator delete(void* p, size_t size);
+	static ProxyPoolStats GetPoolStats();
+
 	/*** IUnknown methods ***/
 	virtual ULONG WINAPI AddRef();
 	virtual ULONG WINAPI Release();
@@ -61,6 +70,7 @@ public:
 	virtual HRESULT WINAPI GetContainer(REFIID riid, LPVOID* ppContainer);
 	virtual HRESULT WINAPI LockRect(D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags);
 	virtual HRESULT WINAPI UnlockRect();
+	virtual HRESULT WINAPI GetDC(HDC* phdc);
 	virtual HRESULT WINAPI ReleaseDC(HDC hdc);
 
 	/*** D3D9ProxySurface methods ***/
@@ -70,6 +80,9 @@ public:
 	virtual bool               IsStereo();
 	virtual HANDLE getHandleLeft();
 	virtual HANDLE getHandleRight();
+	void           MakeStereo();
+	void           SetDeferredStereo(D3D9ProxyTexture* pContainerTexture);
+	void           SetActualRight(IDirect3DSurface9* pActualSurfaceRight);
 
 protected:
 	/**
@@ -98,9 +111,15 @@ protected:
 	BaseDirect3DDevice9* const m_pOwningDevice;
 	/**
 	* Right surface. 
-	* NULL for surfaces that aren't being duplicated.
+	* NULL for surfaces that aren't being duplicated (yet).
+	***/
+	IDirect3DSurface9* m_pActualSurfaceRight;
+	/**
+	* Texture this surface is a level of, if the texture creates its right texture on demand.
+	* NULL for all other surfaces, and once the right surface is set.
+	* @see D3D9ProxyTexture::CreateRightTexture()
 	***/
-	IDirect3DSurface9* const m_pActualSurfaceRight;
+	D3D9ProxyTexture* m_pDeferredStereoTexture;
 
 	/**
 	* Handles for shared access
@@ -110,9 +129,14 @@ protected:
 
 	//Special handling required for locking rectangles if we are using Dx9Ex
 	std::mutex m_mtx;
-	std::vector<RECT> lockedRects;
-	bool fullSurface;
+	DirtyRectSet lockedRects;
 	IDirect3DTexture9* lockableSysMemTexture;
 	D3DLOCKED_RECT lockedRect;
+
+private:
+	/**
+	* Pool of all proxy surfaces, never destroyed.
+	***/
+	static ProxyObjectPool* const s_pPool;
 };
 #endif
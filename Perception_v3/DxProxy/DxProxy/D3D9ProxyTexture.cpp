@@ -34,19 +34,29 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 /**
 * Constructor.
+* @param bDeferRightTexture True to create the right texture when the texture is first drawn or copied to per side.
 * @see D3D9ProxySurface::D3D9ProxySurface
 ***/
-D3D9ProxyTexture::D3D9ProxyTexture(IDirect3DTexture9* pActualTextureLeft, IDirect3DTexture9* pActualTextureRight, BaseDirect3DDevice9* pOwningDevice) :
+D3D9ProxyTexture::D3D9ProxyTexture(IDirect3DTexture9* pActualTextureLeft, IDirect3DTexture9* pActualTextureRight, BaseDirect3DDevice9* pOwningDevice, bool bDeferRightTexture) :
 	BaseDirect3DTexture9(pActualTextureLeft),
 	m_pActualTextureRight(pActualTextureRight),
+	m_bRightTextureDeferred(bDeferRightTexture && !pActualTextureRight),
 	m_wrappedSurfaceLevels(),
 	m_pOwningDevice(pOwningDevice),
+	m_bStereoDivergent(true),
+	m_bUploadQueued(false),
+	m_levelUploads(),
 	lockableSysMemTexture(NULL)
 {
 	SHOW_CALL("D3D9ProxyTexture::D3D9ProxyTexture");
 	assert (pOwningDevice != NULL);
 
 	m_pOwningDevice->AddRef();
+
+	// only render targets and depth stencils are drawn per side
+	D3DSURFACE_DESC desc;
+	if (m_pActualTextureRight && SUCCEEDED(m_pActualTexture->GetLevelDesc(0, &desc)))
+		m_bStereoDivergent = ((desc.Usage & (D3DUSAGE_RENDERTARGET | D3DUSAGE_DEPTHSTENCIL)) != 0);
 }
 
 /**
@@ -56,14 +66,16 @@ D3D9ProxyTexture::D3D9ProxyTexture(IDirect3DTexture9* pActualTextureLeft, IDirec
 D3D9ProxyTexture::~D3D9ProxyTexture()
 {
 	SHOW_CALL("D3D9ProxyTexture::~D3D9ProxyTexture");
+	// unlocked levels not uploaded yet are of no use any more
+	static_cast<D3DProxyDevice*>(m_pOwningDevice)->CancelLockedTextureUpload(this);
+
 	// delete all surfaces in m_levels
-	auto it = m_wrappedSurfaceLevels.begin();
-	while (it != m_wrappedSurfaceLevels.end()) {
+	for (size_t i = 0; i < m_wrappedSurfaceLevels.size(); i++) {
 		// we have to explicitly delete the Surfaces here as the Release behaviour of the surface would get stuck in a loop
 		// calling back to the container Release.
-		delete it->second;
-		it = m_wrappedSurfaceLevels.erase(it);
+		delete m_wrappedSurfaceLevels[i];
 	}
+	m_wrappedSurfaceLevels.clear();
 
 	//Cleanup 
 	auto it2 = lockableSysMemTexture.begin();
@@ -80,6 +92,37 @@ D3D9ProxyTexture::~D3D9ProxyTexture()
 		m_pOwningDevice->Release();
 }
 
+/**
+* Pool of all proxy textures (derived classes use the heap).
+* Leaked on purpose : textures released at process exit, after the static destructors ran, still return
+* their memory to it.
+***/
+ProxyObjectPool* const D3D9ProxyTexture::s_pPool = new ProxyObjectPool(sizeof(D3D9ProxyTexture));
+
+/**
+* Allocates the object from the pool.
+***/
+void* D3D9ProxyTexture::operator new(size_t size)
+{
+	return s_pPool->Allocate(size);
+}
+
+/**
+* Returns the object to the pool.
+***/
+void D3D9ProxyTexture::operator delete(void* p, size_t size)
+{
+	s_pPool->Free(p, size);
+}
+
+/**
+* Allocation counts and memory footprint of the pool.
+***/
+ProxyPoolStats D3D9ProxyTexture::GetPoolStats()
+{
+	return s_pPool->GetStats();
+}
+
 #define IF_GUID(riid,a,b,c,d,e,f,g) if ((riid.Data1==a)&&(riid.Data2==b)&&(riid.Data3==c)&&(riid.Data4[0]==d)&&(riid.Data4[1]==e)&&(riid.Data4[2]==f)&&(riid.Data4[3]==g))
 /**
 * Ensures Skyrim works (and maybe other games).
@@ -230,8 +273,12 @@ HRESULT WINAPI D3D9ProxyTexture::GetSurfaceLevel(UINT Level, IDirect3DSurface9**
 	SHOW_CALL("D3D9ProxyTexture::GetSurfaceLevel");
 	HRESULT finalResult;
 
+	// surfaces can be written per side (render target data, stretch rect), the sides may differ from now on
+	if (IsStereo())
+		MarkStereoDivergent();
+
 	// Have we already got a Proxy for this surface level?
-	if (m_wrappedSurfaceLevels.count(Level) == 1) { // yes
+	if ((Level < m_wrappedSurfaceLevels.size()) && (m_wrappedSurfaceLevels[Level])) { // yes
 
 		// TODO Should we call through to underlying texture and make sure the result of doing this operation on the 
 		// underlying texture would still be a success? (not if we don't have to, will see if it becomes a problem)
@@ -258,21 +305,28 @@ HRESULT WINAPI D3D9ProxyTexture::GetSurfaceLevel(UINT Level, IDirect3DSurface9**
 		if (SUCCEEDED(leftResult)) {
 
 			D3D9ProxySurface* pWrappedSurfaceLevel = new D3D9ProxySurface(pActualSurfaceLevelLeft, pActualSurfaceLevelRight, m_pOwningDevice, this, NULL, NULL);
+			if (m_bRightTextureDeferred)
+				pWrappedSurfaceLevel->SetDeferredStereo(this);
 
-			if(m_wrappedSurfaceLevels.insert(std::pair<ULONG, D3D9ProxySurface*>(Level, pWrappedSurfaceLevel)).second) {
-				// insertion of wrapped surface level into m_wrappedSurfaceLevels succeeded
+			// one slot per level, allocated once
+			if (m_wrappedSurfaceLevels.empty())
+				m_wrappedSurfaceLevels.resize(m_pActualTexture->GetLevelCount(), NULL);
+
+			if (Level < m_wrappedSurfaceLevels.size()) {
+				m_wrappedSurfaceLevels[Level] = pWrappedSurfaceLevel;
 				*ppSurfaceLevel = pWrappedSurfaceLevel;
 				(*ppSurfaceLevel)->AddRef();
 				finalResult = D3D_OK;
 			}
 			else {
-				// Failure to insert should not be possible. In this case we could still return the wrapped surface,
+				// Failure to store should not be possible. In this case we could still return the wrapped surface,
 				// however, if we did and it was requested again a new wrapped instance will be returned and things would explode
 				// at some point. Better to fail fast.
 				OutputDebugString(__FUNCTION__);
 				OutputDebugString("\n");
 				OutputDebugString("Unable to store surface level.\n");
 				assert(false);
+				delete pWrappedSurfaceLevel;
 
 				finalResult = D3DERR_INVALIDCALL;
 			}
@@ -294,6 +348,7 @@ HRESULT WINAPI D3D9ProxyTexture::GetSurfaceLevel(UINT Level, IDirect3DSurface9**
 HRESULT WINAPI D3D9ProxyTexture::LockRect(UINT Level, D3DLOCKED_RECT* pLockedRect, CONST RECT* pRect, DWORD Flags)
 {
 	SHOW_CALL("D3D9ProxyTexture::LockRect");
+	m_pOwningDevice->FlushStereoBatch();
 
 	D3DSURFACE_DESC desc;
 	m_pActualTexture->GetLevelDesc(Level, &desc);
@@ -308,17 +363,7 @@ HRESULT WINAPI D3D9ProxyTexture::LockRect(UINT Level, D3DLOCKED_RECT* pLockedRec
 
 	//Initialise
 	if (lockableSysMemTexture.find(Level) == lockableSysMemTexture.end())
-	{
 		lockableSysMemTexture[Level] = NULL;
-		fullSurfaces[Level] = false;
-	}
-
-	if (!pRect)
-		fullSurfaces[Level] = true;
-	else if (!fullSurfaces[Level])
-	{
-		lockedRects[Level].push_back(*pRect);
-	}
 
 	bool newTexture = false;
 	HRESULT hr = D3DERR_INVALIDCALL;
@@ -389,12 +434,18 @@ HRESULT WINAPI D3D9ProxyTexture::LockRect(UINT Level, D3DLOCKED_RECT* pLockedRec
 	}
 
 	hr = pSurface->LockRect(pLockedRect, pRect, Flags);
+	pSurface->Release();
 	if (FAILED(hr))
 	{
 		vireio::debugf("Failed: pSurface->LockRect hr = 0x%0.8x", hr);
 		return hr;
 	}
-	pSurface->Release();
+
+	//Only a successful lock marks the level, read only locks leave nothing to upload
+	LevelUpload& upload = m_levelUploads[Level];
+	upload.locked = true;
+	if (!(Flags & D3DLOCK_READONLY))
+		upload.lockRects.Add(pRect);
 
 	return hr;
 }
@@ -418,6 +469,7 @@ void WriteDesc(UINT Level, D3DSURFACE_DESC &desc)
 HRESULT WINAPI D3D9ProxyTexture::UnlockRect(UINT Level)
 {
 	SHOW_CALL("D3D9ProxyTexture::UnlockRect");
+	m_pOwningDevice->FlushStereoBatch();
 
 	D3DSURFACE_DESC desc;
 	m_pActualTexture->GetLevelDesc(Level, &desc);
@@ -426,110 +478,245 @@ HRESULT WINAPI D3D9ProxyTexture::UnlockRect(UINT Level)
 		return m_pActualTexture->UnlockRect(Level);
 	}
 
-	//Guard against multithreaded access as this could be causing us problems
+	bool queue = false;
+	{
+		//Guard against multithreaded access as this could be causing us problems
+		std::lock_guard<std::mutex> lck (m_mtx);
+
+		if (lockableSysMemTexture.find(Level) == lockableSysMemTexture.end())
+			return S_OK;
+
+		IDirect3DSurface9 *pSurface = NULL;
+		HRESULT hr = lockableSysMemTexture[Level] ? lockableSysMemTexture[Level]->GetSurfaceLevel(0, &pSurface) : D3DERR_INVALIDCALL;
+		if (FAILED(hr))
+			return hr;
+
+		pSurface->UnlockRect();
+		pSurface->Release();
+
+		//This would mean nothing to do
+		LevelUpload& upload = m_levelUploads[Level];
+		upload.locked = false;
+		if (upload.lockRects.IsEmpty())
+			return S_OK;
+
+		//The rectangles wait for the upload of all unlocked levels, the next lock starts clean
+		upload.leftRects.Add(upload.lockRects);
+		if (IsStereo())
+			upload.rightRects.Add(upload.lockRects);
+		upload.lockRects.Clear();
+
+		queue = !m_bUploadQueued;
+		m_bUploadQueued = true;
+	}
+
+	if (queue)
+		static_cast<D3DProxyDevice*>(m_pOwningDevice)->QueueLockedTextureUpload(this);
+	return S_OK;
+}
+
+/**
+* Uploads the unlocked rectangles of all levels to the left texture, and to the right texture if the sides
+* may differ (otherwise the right texture gets them when it is used).
+* Called by the owning device before the texture can be read and at the end of the frame.
+* @return True if locked levels are left to upload, the texture stays queued.
+* @see D3DProxyDevice::UploadLockedTextures()
+***/
+bool D3D9ProxyTexture::UploadLockedLevels()
+{
 	std::lock_guard<std::mutex> lck (m_mtx);
 
-	if (lockableSysMemTexture.find(Level) == lockableSysMemTexture.end())
-		return S_OK;
+	bool pending = false;
+	for (auto it = m_levelUploads.begin(); it != m_levelUploads.end(); ++it)
+	{
+		LevelUpload& upload = it->second;
+		if (upload.locked)
+		{
+			pending = pending || !upload.leftRects.IsEmpty() || (m_bStereoDivergent && !upload.rightRects.IsEmpty());
+			continue;
+		}
 
+		//Failed copies are ignored, not much we can do
+		if (!upload.leftRects.IsEmpty())
+		{
+			UploadLevel(it->first, upload.leftRects, m_pActualTexture);
+			upload.leftRects.Clear();
+		}
+		if (m_bStereoDivergent && !upload.rightRects.IsEmpty())
+		{
+			UploadLevel(it->first, upload.rightRects, m_pActualTextureRight);
+			upload.rightRects.Clear();
+		}
+	}
+
+	m_bUploadQueued = pending;
+	return pending;
+}
+
+/**
+* Copies rectangles of a level from its lockable system memory texture to an actual texture.
+* Called with m_mtx locked.
+***/
+HRESULT D3D9ProxyTexture::UploadLevel(UINT Level, const DirtyRectSet& rects, IDirect3DTexture9* pActualTexture)
+{
 	IDirect3DSurface9 *pSurface = NULL;
-	HRESULT hr = lockableSysMemTexture[Level] ? lockableSysMemTexture[Level]->GetSurfaceLevel(0, &pSurface) : D3DERR_INVALIDCALL;
+	HRESULT hr = lockableSysMemTexture[Level]->GetSurfaceLevel(0, &pSurface);
 	if (FAILED(hr))
 		return hr;
 
-	pSurface->UnlockRect();
-
-	if (IsStereo())
+	IDirect3DSurface9 *pActualSurface = NULL;
+	hr = pActualTexture->GetSurfaceLevel(Level, &pActualSurface);
+	if (FAILED(hr))
 	{
-		IDirect3DSurface9 *pActualSurfaceRight = NULL;
-		hr = m_pActualTextureRight->GetSurfaceLevel(Level, &pActualSurfaceRight);
-		if (FAILED(hr))
-			return hr;
+		pSurface->Release();
+		return hr;
+	}
 
-		if (fullSurfaces[Level])
-		{
-			hr = m_pOwningDevice->getActual()->UpdateSurface(pSurface, NULL, pActualSurfaceRight, NULL);
-			if (FAILED(hr))
-			{
+	hr = rects.Update(m_pOwningDevice->getActual(), pSurface, pActualSurface);
 #ifdef _DEBUG
-				vireio::debugf("Failed: m_pOwningDevice->getActual()->UpdateSurface hr = 0x%0.8x", hr);
-				WriteDesc(Level, desc);
+	if (FAILED(hr))
+	{
+		vireio::debugf("Failed: m_pOwningDevice->getActual()->UpdateSurface hr = 0x%0.8x", hr);
+		D3DSURFACE_DESC desc;
+		pActualTexture->GetLevelDesc(Level, &desc);
+		WriteDesc(Level, desc);
+	}
 #endif
-				//Just ignore the failed copy back, not much we can do
-				hr = S_OK;
-			}
+
+	pActualSurface->Release();
+	pSurface->Release();
+	return hr;
+}
+
+/**
+* Uploads the unlocked rectangles the right texture missed while both sides were the same.
+* Called with m_mtx locked.
+* @return True if locked levels are left to upload.
+***/
+bool D3D9ProxyTexture::UploadRightLevels()
+{
+	bool pending = false;
+	for (auto it = m_levelUploads.begin(); it != m_levelUploads.end(); ++it)
+	{
+		LevelUpload& upload = it->second;
+		if (upload.rightRects.IsEmpty())
+			continue;
+		if (upload.locked)
+		{
+			pending = true;
+			continue;
+		}
+
+		UploadLevel(it->first, upload.rightRects, m_pActualTextureRight);
+		upload.rightRects.Clear();
+	}
+	return pending;
+}
+
+/**
+* True if the right texture may differ from the left texture.
+* @see m_bStereoDivergent
+***/
+bool D3D9ProxyTexture::IsStereoDivergent()
+{
+	return IsStereo() && m_bStereoDivergent;
+}
+
+/**
+* The sides of the texture may differ from now on.
+* Creates a deferred right texture, or uploads the rectangles the right texture missed. The owning device
+* binds the right texture for the right side.
+***/
+void D3D9ProxyTexture::MarkStereoDivergent()
+{
+	bool queue = false;
+	{
+		std::lock_guard<std::mutex> lck (m_mtx);
+		if (m_bRightTextureDeferred)
+		{
+			CreateRightTexture();
+			if (!IsStereo())
+				return;
 		}
 		else
 		{
-			std::vector<RECT>::iterator rectIter = lockedRects[Level].begin();
-			while (rectIter != lockedRects[Level].end())
+			if (m_bStereoDivergent || !IsStereo())
+				return;
+
+			m_bStereoDivergent = true;
+			if (UploadRightLevels() && !m_bUploadQueued)
 			{
-				POINT p;
-				p.x = rectIter->left;
-				p.y = rectIter->top;
-				hr = m_pOwningDevice->getActual()->UpdateSurface(pSurface, &(*rectIter), pActualSurfaceRight, &p);
-				if (FAILED(hr))
-				{
-#ifdef _DEBUG
-					vireio::debugf("Failed: m_pOwningDevice->getActual()->UpdateSurface hr = 0x%0.8x", hr);
-					WriteDesc(Level, desc);
-#endif
-					//Just ignore the failed copy back, not much we can do
-					hr = S_OK;
-				}
-				rectIter++;
+				m_bUploadQueued = true;
+				queue = true;
 			}
 		}
-
-		pActualSurfaceRight->Release();
 	}
 
-	IDirect3DSurface9 *pActualSurface = NULL;
-	hr = m_pActualTexture->GetSurfaceLevel(Level, &pActualSurface);
+	D3DProxyDevice* pDevice = static_cast<D3DProxyDevice*>(m_pOwningDevice);
+	if (queue)
+		pDevice->QueueLockedTextureUpload(this);
+	pDevice->StereoTextureDiverged(this);
+}
+
+/**
+* Creates the deferred right texture with the content of the left texture, hands the right surfaces
+* to the levels wrapped so far. Falls back to mono if the right texture can't be created.
+* Unlocked rectangles not uploaded yet go to both sides.
+* Called with m_mtx locked.
+***/
+void D3D9ProxyTexture::CreateRightTexture()
+{
+	m_bRightTextureDeferred = false;
+
+	D3DSURFACE_DESC desc;
+	HRESULT hr = m_pActualTexture->GetLevelDesc(0, &desc);
+	if (SUCCEEDED(hr))
+	{
+		// auto generated sub levels are not counted by the left texture
+		UINT levels = (desc.Usage & D3DUSAGE_AUTOGENMIPMAP) ? 0 : m_pActualTexture->GetLevelCount();
+		hr = m_pOwningDevice->getActual()->CreateTexture(desc.Width, desc.Height, levels, desc.Usage, desc.Format, desc.Pool, &m_pActualTextureRight, NULL);
+	}
 	if (FAILED(hr))
-		return hr;
-	if (fullSurfaces[Level])
 	{
-		hr = m_pOwningDevice->getActual()->UpdateSurface(pSurface, NULL, pActualSurface, NULL);
-		if (FAILED(hr))
+		OutputDebugString("Failed to create deferred right eye texture, staying mono\n");
+		m_pActualTextureRight = NULL;
+		for (size_t i = 0; i < m_wrappedSurfaceLevels.size(); i++)
 		{
-#ifdef _DEBUG
-			vireio::debugf("Failed: m_pOwningDevice->getActual()->UpdateSurface hr = 0x%0.8x", hr);
-			WriteDesc(Level, desc);
-#endif
-
-			//Just ignore the failed copy back, not much we can do
-			hr = S_OK;
+			if (m_wrappedSurfaceLevels[i])
+				m_wrappedSurfaceLevels[i]->SetDeferredStereo(NULL);
 		}
+		return;
 	}
-	else
+
+	m_pActualTextureRight->SetPriority(m_pActualTexture->GetPriority());
+	m_pActualTextureRight->SetLOD(m_pActualTexture->GetLOD());
+	if (desc.Usage & D3DUSAGE_AUTOGENMIPMAP)
+		m_pActualTextureRight->SetAutoGenFilterType(m_pActualTexture->GetAutoGenFilterType());
+
+	// render target levels are copied on the device
+	for (UINT level = 0; level < m_pActualTexture->GetLevelCount(); level++)
 	{
-		std::vector<RECT>::iterator rectIter = lockedRects[Level].begin();
-		while (rectIter != lockedRects[Level].end())
+		IDirect3DSurface9* pActualSurfaceLevelLeft = NULL;
+		IDirect3DSurface9* pActualSurfaceLevelRight = NULL;
+		if (FAILED(m_pActualTexture->GetSurfaceLevel(level, &pActualSurfaceLevelLeft)))
+			continue;
+		if (SUCCEEDED(m_pActualTextureRight->GetSurfaceLevel(level, &pActualSurfaceLevelRight)))
 		{
-			POINT p;
-			p.x = rectIter->left;
-			p.y = rectIter->top;
-			hr = m_pOwningDevice->getActual()->UpdateSurface(pSurface, &(*rectIter), pActualSurface, &p);
-			if (FAILED(hr))
-			{
-#ifdef _DEBUG
-				vireio::debugf("Failed: m_pOwningDevice->getActual()->UpdateSurface hr = 0x%0.8x", hr);
-				WriteDesc(Level, desc);
-#endif
-				//Just ignore the failed copy back, not much we can do
-				hr = S_OK;
-			}
-			rectIter++;
+			if (FAILED(m_pOwningDevice->getActual()->StretchRect(pActualSurfaceLevelLeft, NULL, pActualSurfaceLevelRight, NULL, D3DTEXF_NONE)))
+				OutputDebugString("Failed to copy left texture level to deferred right texture\n");
+
+			if ((level < m_wrappedSurfaceLevels.size()) && m_wrappedSurfaceLevels[level])
+				m_wrappedSurfaceLevels[level]->SetActualRight(pActualSurfaceLevelRight);
+			else
+				pActualSurfaceLevelRight->Release();
 		}
+		pActualSurfaceLevelLeft->Release();
 	}
+	if (desc.Usage & D3DUSAGE_AUTOGENMIPMAP)
+		m_pActualTextureRight->GenerateMipSubLevels();
 
-	//Release everything
-	pActualSurface->Release();
-	pSurface->Release();
-	
-	fullSurfaces[Level] = false;
-	return hr;
+	for (auto it = m_levelUploads.begin(); it != m_levelUploads.end(); ++it)
+		it->second.rightRects.Add(it->second.leftRects);
 }
 
 /**
@@ -561,10 +748,16 @@ IDirect3DTexture9* D3D9ProxyTexture::getActualLeft()
 }
 
 /**
-* Returns the right texture.
+* Returns the right texture, with all unlocked rectangles uploaded.
 ***/
 IDirect3DTexture9* D3D9ProxyTexture::getActualRight()
 {
+	// both sides were the same so far, the right texture may have missed uploads
+	if (m_pActualTextureRight && !m_bStereoDivergent)
+	{
+		std::lock_guard<std::mutex> lck (m_mtx);
+		UploadRightLevels();
+	}
 	return m_pActualTextureRight;
 }
 
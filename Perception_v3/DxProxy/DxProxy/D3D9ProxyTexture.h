@@ -34,6 +34,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <unordered_map>
 #include "D3DProxyDevice.h"
 #include "Direct3DTexture9.h"
+#include "ProxyObjectPool.h"
+#include "DirtyRectSet.h"
 #include "D3D9ProxySurface.h"
 #include "IStereoCapableWrapper.h"
 
@@ -46,9 +48,14 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 class D3D9ProxyTexture : public BaseDirect3DTexture9, public IStereoCapableWrapper<IDirect3DTexture9>
 {
 public:
-	D3D9ProxyTexture(IDirect3DTexture9* pActualTextureLeft, IDirect3DTexture9* pActualTextureRight, BaseDirect3DDevice9* pOwningDevice);
+	D3D9ProxyTexture(IDirect3DTexture9* pActualTextureLeft, IDirect3DTexture9* pActualTextureRight, BaseDirect3DDevice9* pOwningDevice, bool bDeferRightTexture);
 	virtual ~D3D9ProxyTexture();
 
+	/*** D3D9ProxyTexture pool allocation ***/
+	static void* operator new(size_t size);
+	static void  operator delete(void* p, size_t size);
+	static ProxyPoolStats GetPoolStats();
+
 	/*** IUnknown methods ***/
 	virtual HRESULT WINAPI QueryInterface(REFIID riid, LPVOID* ppv);
 	
@@ -72,11 +79,17 @@ public:
 	virtual IDirect3DTexture9* getActualRight();
 	virtual bool               IsStereo();
 
+	/*** D3D9ProxyTexture public methods ***/
+	bool UploadLockedLevels();
+	bool IsStereoDivergent();
+	void MarkStereoDivergent();
+
 protected:
 	/**
-	* Wrapped Surface levels.
+	* Wrapped Surface levels, indexed by level (NULL if not wrapped yet).
+	* Sized to the level count of the texture when the first level is wrapped.
 	***/
-	std::unordered_map<UINT, D3D9ProxySurface*> m_wrappedSurfaceLevels;
+	std::vector<D3D9ProxySurface*> m_wrappedSurfaceLevels;
 	/**
 	* The owning device.
 	* @see D3D9ProxySurface::m_pOwningDevice
@@ -84,14 +97,72 @@ protected:
 	BaseDirect3DDevice9* const m_pOwningDevice;
 	/**
 	* The actual right texture embedded. 
+	* NULL for mono textures and until a deferred right texture is created.
+	***/
+	IDirect3DTexture9* m_pActualTextureRight;
+	/**
+	* True if the right texture is created when the texture is first drawn or copied to per side.
+	* Render target textures only drawn or copied to as mono never get one.
+	* @see CreateRightTexture()
+	***/
+	bool m_bRightTextureDeferred;
+
+	/**
+	* Locked rectangles of a texture level.
+	* The rectangles are kept in the lockable system memory texture until the owning device
+	* uploads them, all unlocked levels with one call per frame (or before the texture is used).
+	* @see D3DProxyDevice::UploadLockedTextures()
+	***/
+	struct LevelUpload
+	{
+		LevelUpload() : locked(false), lockRects(), leftRects(), rightRects() {}
+		/**
+		* True while the level is locked, its system memory texture can't be uploaded.
+		***/
+		bool locked;
+		/**
+		* Rectangles of the current lock.
+		***/
+		DirtyRectSet lockRects;
+		/**
+		* Unlocked rectangles not uploaded to the left texture yet.
+		***/
+		DirtyRectSet leftRects;
+		/**
+		* Unlocked rectangles not uploaded to the right texture yet.
+		***/
+		DirtyRectSet rightRects;
+	};
+
+	/*** D3D9ProxyTexture protected methods ***/
+	HRESULT UploadLevel(UINT Level, const DirtyRectSet& rects, IDirect3DTexture9* pActualTexture);
+	bool    UploadRightLevels();
+	void    CreateRightTexture();
+
+	/**
+	* True if the right texture may differ from the left texture.
+	* Render target and depth stencil textures are divergent from the start, other stereo textures only
+	* get their content from the CPU and mono copies. Until one of their levels is handed out or a stereo
+	* texture is copied to them, both sides are the same : the left texture is bound for both sides and
+	* locked rectangles are only uploaded to the right texture when it gets used.
+	* @see D3DProxyDevice::UnWrapBoundTexture()
+	***/
+	bool m_bStereoDivergent;
+	/**
+	* True if the texture is queued at the owning device for the upload of its locked levels.
 	***/
-	IDirect3DTexture9* const m_pActualTextureRight;
+	bool m_bUploadQueued;
 
 	//Special handling required for locking rectangles if we are using Dx9Ex
 	std::mutex m_mtx;
-	std::unordered_map<UINT, std::vector<RECT>> lockedRects;
-	std::unordered_map<UINT, bool> fullSurfaces;
+	std::unordered_map<UINT, LevelUpload> m_levelUploads;
 	std::unordered_map<UINT, bool> newSurface;
 	std::unordered_map<UINT, IDirect3DTexture9*> lockableSysMemTexture;
+
+private:
+	/**
+	* Pool of all proxy textures, never destroyed.
+	***/
+	static ProxyObjectPool* const s_pPool;
 };
 #endif
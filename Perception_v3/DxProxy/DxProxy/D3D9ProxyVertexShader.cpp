@@ -36,8 +36,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 D3D9ProxyVertexShader::D3D9ProxyVertexShader(IDirect3DVertexShader9* pActualVertexShader, D3DProxyDevice *pOwningDevice, ShaderModificationRepository* pModLoader) :
 	BaseDirect3DVertexShader9(pActualVertexShader, pOwningDevice),
 	m_pActualDevice(pOwningDevice->getActual()),
-	m_shaderObjectType(ShaderObjectTypeUnknown)
+	m_shaderObjectType(ShaderObjectTypeUnknown),
+	m_shaderHash(0)
 {
+	// hash the shader function once, binding the shader must not touch the function again
+	UINT sizeOfData = 0;
+	if (SUCCEEDED(pActualVertexShader->GetFunction(NULL, &sizeOfData)) && (sizeOfData > 0))
+	{
+		std::vector<BYTE> data(sizeOfData);
+		if (SUCCEEDED(pActualVertexShader->GetFunction(&data[0], &sizeOfData)))
+			MurmurHash3_x86_32(&data[0], sizeOfData, VIREIO_SEED, &m_shaderHash);
+	}
+
 	if (pModLoader)
 	{
 		m_modifiedConstants = pModLoader->GetModifiedConstantsF(pActualVertexShader);
@@ -57,11 +67,11 @@ D3D9ProxyVertexShader::~D3D9ProxyVertexShader()
 {}
 
 /**
-* Returns modified constants pointer.
+* Returns modified constants pointer (NULL if there are none).
 ***/
-std::map<UINT, StereoShaderConstant<float>>* D3D9ProxyVertexShader::ModifiedConstants()
+const StereoConstantSet* D3D9ProxyVertexShader::ModifiedConstants()
 {
-	return &m_modifiedConstants;
+	return m_modifiedConstants.get();
 }
 
 /**
@@ -79,3 +89,11 @@ ShaderObjectType D3D9ProxyVertexShader::GetShaderObjectType()
 {
 	return m_shaderObjectType;
 }
+
+/**
+* Returns the hash code of the shader function.
+***/
+uint32_t D3D9ProxyVertexShader::GetShaderHash()
+{
+	return m_shaderHash;
+}
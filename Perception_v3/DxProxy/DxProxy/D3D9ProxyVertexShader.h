@@ -37,6 +37,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <algorithm>
 #include "Direct3DVertexShader9.h"
 #include "Direct3DDevice9.h"
+#include "StereoConstantSet.h"
 #include "ShaderRegisters.h"
 #include "D3DProxyDevice.h"
 #include "ShaderModificationRepository.h"
@@ -56,9 +57,10 @@ public:
 	virtual ~D3D9ProxyVertexShader();
 
 	/*** D3D9ProxyVertexShader public methods ***/
-	std::map<UINT, StereoShaderConstant<>>* ModifiedConstants();
+	const StereoConstantSet*                ModifiedConstants();
 	bool                                    SquishViewport();
 	ShaderObjectType						GetShaderObjectType();
+	uint32_t                                GetShaderHash();
 
 protected:
 	/**
@@ -66,11 +68,11 @@ protected:
 	***/
 	IDirect3DDevice9* m_pActualDevice;
 	/**
-	* Modified shader constants.
-	* <StartRegister, StereoShaderConstant<>>
-	* @see StereoShaderConstant
+	* Modified shader constants, interned (shared with all shaders using the same modified constants).
+	* NULL if no modification rules are loaded.
+	* @see StereoConstantSet
 	***/
-	std::map<UINT, StereoShaderConstant<>> m_modifiedConstants;
+	std::shared_ptr<const StereoConstantSet> m_modifiedConstants;
 	/**
 	* True if viewport should be squished (seen as GUI) if this shader is set.
 	***/
@@ -79,5 +81,10 @@ protected:
 	* Store the object type of this shader (if it is specified)
 	*/
 	ShaderObjectType m_shaderObjectType;
+	/**
+	* Hash code of the shader function, computed once on creation.
+	* Identifies the shader in rules and in the shader analyzer.
+	***/
+	uint32_t m_shaderHash;
 };
 #endif
@@ -66,6 +66,37 @@ D3D9ProxyVolume::~D3D9ProxyVolume()
 	}	
 }
 
+/**
+* Pool of all proxy volumes (derived classes use the heap).
+* Leaked on purpose : volumes released at process exit, after the static destructors ran, still return
+* their memory to it.
+***/
+ProxyObjectPool* const D3D9ProxyVolume::s_pPool = new ProxyObjectPool(sizeof(D3D9ProxyVolume));
+
+/**
+* Allocates the object from the pool.
+***/
+void* D3D9ProxyVolume::operator new(size_t size)
+{
+	return s_pPool->Allocate(size);
+}
+
+/**
+* Returns the object to the pool.
+***/
+void D3D9ProxyVolume::operator delete(void* p, size_t size)
+{
+	s_pPool->Free(p, size);
+}
+
+/**
+* Allocation counts and memory footprint of the pool.
+***/
+ProxyPoolStats D3D9ProxyVolume::GetPoolStats()
+{
+	return s_pPool->GetStats();
+}
+
 /**
 * Behaviour determined through observing D3D with various test cases.
 *
@@ -164,6 +195,26 @@ HRESULT WINAPI D3D9ProxyVolume::GetContainer(REFIID riid, LPVOID* ppContainer)
 	}
 }
 
+/**
+* Locks the volume, deferred draws are replayed first.
+***/
+HRESULT WINAPI D3D9ProxyVolume::LockBox(D3DLOCKED_BOX *pLockedVolume, const D3DBOX *pBox, DWORD Flags)
+{
+	m_pOwningDevice->FlushStereoBatch();
+
+	return BaseDirect3DVolume9::LockBox(pLockedVolume, pBox, Flags);
+}
+
+/**
+* Unlocks the volume, deferred draws are replayed first.
+***/
+HRESULT WINAPI D3D9ProxyVolume::UnlockBox()
+{
+	m_pOwningDevice->FlushStereoBatch();
+
+	return BaseDirect3DVolume9::UnlockBox();
+}
+
 /**
 * Gets the actual (parent) volume.
 ***/
@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <d3d9.h>
 #include "Direct3DVolume9.h"
+#include "ProxyObjectPool.h"
 #include "Direct3DDevice9.h"
 #include <stdio.h>
 
@@ -48,6 +49,11 @@ class D3D9ProxyVolume : public BaseDirect3DVolume9
 public:
 	D3D9ProxyVolume(IDirect3DVolume9* pActualVolume, BaseDirect3DDevice9* pOwningDevice, IUnknown* pWrappedContainer);
 	virtual ~D3D9ProxyVolume();
+
+	/*** D3D9ProxyVolume pool allocation ***/
+	static void* operator new(size_t size);
+	static void  operator delete(void* p, size_t size);
+	static ProxyPoolStats GetPoolStats();
 	
 	/*** IUnknown methods ***/
 	virtual ULONG WINAPI AddRef();
@@ -56,6 +62,8 @@ public:
 	/*** IDirect3DVolume9 methods ***/
 	virtual HRESULT WINAPI GetDevice(IDirect3DDevice9** ppDevice);
 	virtual HRESULT WINAPI GetContainer(REFIID riid, LPVOID* ppContainer);
+	virtual HRESULT WINAPI LockBox(D3DLOCKED_BOX *pLockedVolume, const D3DBOX *pBox, DWORD Flags);
+	virtual HRESULT WINAPI UnlockBox();
 
 	/*** D3D9ProxyVolume public methods ***/
 	IDirect3DVolume9* getActualVolume();
@@ -71,5 +79,11 @@ protected:
 	* @see D3D9ProxySurface::m_pOwningDevice
 	***/
 	BaseDirect3DDevice9* const m_pOwningDevice;
+
+private:
+	/**
+	* Pool of all proxy volumes, never destroyed.
+	***/
+	static ProxyObjectPool* const s_pPool;
 };
 #endif
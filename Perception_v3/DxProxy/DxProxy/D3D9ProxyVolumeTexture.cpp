@@ -54,13 +54,12 @@ D3D9ProxyVolumeTexture::~D3D9ProxyVolumeTexture()
 {
 	SHOW_CALL("D3D9ProxyVolumeTexture::~D3D9ProxyVolumeTexture");
 	// delete all surfaces in m_levels
-	auto it = m_wrappedVolumeLevels.begin();
-	while (it != m_wrappedVolumeLevels.end()) {
+	for (size_t i = 0; i < m_wrappedVolumeLevels.size(); i++) {
 		// we have to explicitly delete the Volume here as the Release behaviour of the volume would get stuck in a loop
 		// calling back to the container Release.
-		delete it->second;
-		it = m_wrappedVolumeLevels.erase(it);
+		delete m_wrappedVolumeLevels[i];
 	}
+	m_wrappedVolumeLevels.clear();
 
 	if (lockableSysMemVolume)
 		lockableSysMemVolume->Release();
@@ -101,7 +100,7 @@ HRESULT D3D9ProxyVolumeTexture::GetVolumeLevel(UINT Level, IDirect3DVolume9** pp
 	HRESULT finalResult;
 
 	// Have we already got a Proxy for this surface level?
-	if (m_wrappedVolumeLevels.count(Level) == 1) { // yes
+	if ((Level < m_wrappedVolumeLevels.size()) && (m_wrappedVolumeLevels[Level])) { // yes
 
 		// TODO Should we call through to underlying texture and make sure the result of doing this operation on the 
 		// underlying texture would still be a success? (not if we don't have to, will see if it becomes a problem)
@@ -122,20 +121,25 @@ HRESULT D3D9ProxyVolumeTexture::GetVolumeLevel(UINT Level, IDirect3DVolume9** pp
 
 			D3D9ProxyVolume* pWrappedVolumeLevel = new D3D9ProxyVolume(pActualVolumeLevel, m_pOwningDevice, this);
 
-			if(m_wrappedVolumeLevels.insert(std::pair<ULONG, D3D9ProxyVolume*>(Level, pWrappedVolumeLevel)).second) {
-				// insertion of wrapped surface level into m_wrappedSurfaceLevels succeeded
+			// one slot per level, allocated once
+			if (m_wrappedVolumeLevels.empty())
+				m_wrappedVolumeLevels.resize(m_pActualTexture->GetLevelCount(), NULL);
+
+			if (Level < m_wrappedVolumeLevels.size()) {
+				m_wrappedVolumeLevels[Level] = pWrappedVolumeLevel;
 				*ppVolumeLevel = pWrappedVolumeLevel;
 				(*ppVolumeLevel)->AddRef();
 				finalResult = D3D_OK;
 			}
 			else {
-				// Failure to insert should not be possible. In this case we could still return the wrapped surface,
+				// Failure to store should not be possible. In this case we could still return the wrapped surface,
 				// however, if we did and it was requested again a new wrapped instance will be returned and things would explode
 				// at some point. Better to fail fast.
 				OutputDebugString(__FUNCTION__);
 				OutputDebugString("\n");
 				OutputDebugString("Unable to store surface level.\n");
 				assert(false);
+				delete pWrappedVolumeLevel;
 
 				finalResult = D3DERR_INVALIDCALL;
 			}
@@ -252,6 +256,7 @@ HRESULT              D3D9ProxyVolumeTexture::GetLevelDesc(UINT Level, D3DVOLUME_
 HRESULT    D3D9ProxyVolumeTexture::LockBox(UINT Level, D3DLOCKED_BOX *pLockedVolume, const D3DBOX *pBox, DWORD Flags)
 {
 	SHOW_CALL("D3D9ProxyVolumeTexture::LockBox");
+	m_pOwningDevice->FlushStereoBatch();
 
 	D3DVOLUME_DESC desc;
 	m_pActualTexture->GetLevelDesc(Level, &desc);
@@ -285,6 +290,7 @@ HRESULT    D3D9ProxyVolumeTexture::LockBox(UINT Level, D3DLOCKED_BOX *pLockedVol
 HRESULT D3D9ProxyVolumeTexture::UnlockBox(UINT Level)
 {
 	SHOW_CALL("D3D9ProxyVolumeTexture::UnlockBox");
+	m_pOwningDevice->FlushStereoBatch();
 	D3DVOLUME_DESC desc;
 	m_pActualTexture->GetLevelDesc(Level, &desc);
 	if (desc.Pool != D3DPOOL_DEFAULT)
@@ -72,9 +72,10 @@ public:
 
 protected:
 	/**
-	* Wrapped Volume levels. 
+	* Wrapped Volume levels, indexed by level (NULL if not wrapped yet).
+	* Sized to the level count of the texture when the first level is wrapped.
 	***/
-	std::unordered_map<UINT, D3D9ProxyVolume*> m_wrappedVolumeLevels;
+	std::vector<D3D9ProxyVolume*> m_wrappedVolumeLevels;
 	/**
 	* The owning device.
 	* @see D3D9ProxySurface::m_pOwningDevice
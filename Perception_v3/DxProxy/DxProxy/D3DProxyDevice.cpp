@@ -35,6 +35,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "MotionTrackerFactory.h"
 #include "HMDisplayInfoFactory.h"
 #include <typeinfo>
+#include <algorithm>
 #include <assert.h>
 #include <comdef.h>
 #include <tchar.h>
@@ -184,6 +185,10 @@ std::string VRboostAxisString(UINT axis)
 D3DProxyDevice::D3DProxyDevice(IDirect3DDevice9* pDevice, BaseDirect3D9* pCreatedBy):BaseDirect3DDevice9(pDevice, pCreatedBy),
 	m_activeRenderTargets (1, NULL),
 	m_activeTextureStages(),
+	m_stereoTextureStages(),
+	m_lockedTextureUploads(),
+	m_lockedTextureUploadsMutex(),
+	m_bLockedTextureUploads(false),
 	m_activeVertexBuffers(),
 	m_activeSwapChains(),
 	m_gameXScaleUnits(),
@@ -271,8 +276,19 @@ D3DProxyDevice::D3DProxyDevice(IDirect3DDevice9* pDevice, BaseDirect3D9* pCreate
 
 }
 
+/**
+* Writes the allocation counts and memory footprint of a proxy wrapper pool to the debug log.
+***/
+static void DebugPoolStats(const char* name, const ProxyPoolStats& stats)
+{
+	debugf("%s pool: %u allocations, %u live, %u peak, %u slabs, %u bytes\n", name,
+		(unsigned)stats.allocations, (unsigned)stats.liveObjects, (unsigned)stats.peakObjects,
+		(unsigned)stats.slabs, (unsigned)stats.footprint);
+}
+
 /**
 * Destructor : calls ReleaseEverything() and releases swap chains.
+* Reports the proxy wrapper pools to the debug log.
 * @see ReleaseEverything()
 ***/
 D3DProxyDevice::~D3DProxyDevice()
@@ -302,6 +318,10 @@ D3DProxyDevice::~D3DProxyDevice()
 
 		it = m_activeSwapChains.erase(it);
 	}
+
+	DebugPoolStats("D3D9ProxyTexture", D3D9ProxyTexture::GetPoolStats());
+	DebugPoolStats("D3D9ProxySurface", D3D9ProxySurface::GetPoolStats());
+	DebugPoolStats("D3D9ProxyVolume", D3D9ProxyVolume::GetPoolStats());
 }
 
 #define IF_GUID(riid,a,b,c,d,e,f,g,h,i,j,k) if ((riid.Data1==a)&&(riid.Data2==b)&&(riid.Data3==c)&&(riid.Data4[0]==d)&&(riid.Data4[1]==e)&&(riid.Data4[2]==f)&&(riid.Data4[3]==g)&&(riid.Data4[4]==h)&&(riid.Data4[5]==i)&&(riid.Data4[6]==j)&&(riid.Data4[7]==k))
@@ -331,6 +351,7 @@ HRESULT WINAPI D3DProxyDevice::QueryInterface(REFIID riid, LPVOID* ppv)
 HRESULT WINAPI D3DProxyDevice::TestCooperativeLevel()
 {
 	SHOW_CALL("TestCooperativeLevel");
+	FlushStereoBatch();
 	
 	return BaseDirect3DDevice9::TestCooperativeLevel();
 	// The calling application will start releasing resources after TestCooperativeLevel returns D3DERR_DEVICENOTRESET.
@@ -342,6 +363,7 @@ HRESULT WINAPI D3DProxyDevice::TestCooperativeLevel()
 HRESULT WINAPI D3DProxyDevice::SetCursorProperties(UINT XHotSpot, UINT YHotSpot, IDirect3DSurface9* pCursorBitmap)
 {
 	SHOW_CALL("SetCursorProperties");
+	FlushStereoBatch();
 	
 	if (!pCursorBitmap)
 		return BaseDirect3DDevice9::SetCursorProperties(XHotSpot, YHotSpot, NULL);
@@ -356,6 +378,7 @@ HRESULT WINAPI D3DProxyDevice::SetCursorProperties(UINT XHotSpot, UINT YHotSpot,
 HRESULT WINAPI D3DProxyDevice::CreateAdditionalSwapChain(D3DPRESENT_PARAMETERS* pPresentationParameters,IDirect3DSwapChain9** pSwapChain)
 {
 	SHOW_CALL("CreateAdditionalSwapChain");
+	FlushStereoBatch();
 	
 	IDirect3DSwapChain9* pActualSwapChain;
 	HRESULT result = BaseDirect3DDevice9::CreateAdditionalSwapChain(pPresentationParameters, &pActualSwapChain);
@@ -377,6 +400,7 @@ HRESULT WINAPI D3DProxyDevice::CreateAdditionalSwapChain(D3DPRESENT_PARAMETERS*
 HRESULT WINAPI D3DProxyDevice::GetSwapChain(UINT iSwapChain,IDirect3DSwapChain9** pSwapChain)
 {
 	SHOW_CALL("GetSwapChain");
+	FlushStereoBatch();
 	
 	try {
 		*pSwapChain = m_activeSwapChains.at(iSwapChain); 
@@ -402,6 +426,7 @@ HRESULT WINAPI D3DProxyDevice::GetSwapChain(UINT iSwapChain,IDirect3DSwapChain9*
 HRESULT WINAPI D3DProxyDevice::Reset(D3DPRESENT_PARAMETERS* pPresentationParameters)
 {
 	SHOW_CALL("Reset");
+	FlushStereoBatch();
 	
 	if(stereoView)
 		stereoView->ReleaseEverything();
@@ -446,7 +471,11 @@ HRESULT WINAPI D3DProxyDevice::Reset(D3DPRESENT_PARAMETERS* pPresentationParamet
 HRESULT WINAPI D3DProxyDevice::Present(CONST RECT* pSourceRect,CONST RECT* pDestRect,HWND hDestWindowOverride,CONST RGNDATA* pDirtyRegion)
 {
 	SHOW_CALL("Present");
+	FlushStereoBatch();
 	
+	// textures locked after the last draw call, the frame ends here
+	UploadLockedTextures();
+
 	HandleLandmarkMoment(DeviceBehavior::WhenToDo::BEFORE_COMPOSITING);
 	
 	IDirect3DSurface9* pWrappedBackBuffer = NULL;
@@ -480,6 +509,9 @@ HRESULT WINAPI D3DProxyDevice::Present(CONST RECT* pSourceRect,CONST RECT* pDest
 		hr =  BaseDirect3DDevice9::Present(pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion);	
 	}
 	
+	// Start counting the shader constant uploads of the next frame
+	m_spManagedShaderRegisters->NextFrame();
+
 	//Now calculate frames per second
 	fps = CalcFPS();
 
@@ -515,6 +547,7 @@ HRESULT WINAPI D3DProxyDevice::Present(CONST RECT* pSourceRect,CONST RECT* pDest
 HRESULT WINAPI D3DProxyDevice::GetBackBuffer(UINT iSwapChain,UINT iBackBuffer,D3DBACKBUFFER_TYPE Type,IDirect3DSurface9** ppBackBuffer)
 {
 	SHOW_CALL("GetBackBuffer");
+	FlushStereoBatch();
 	
 	HRESULT result;
 	try {
@@ -532,16 +565,19 @@ HRESULT WINAPI D3DProxyDevice::GetBackBuffer(UINT iSwapChain,UINT iBackBuffer,D3
 /**
 * Creates a proxy (or wrapped) texture (D3DProxyTexture).
 * Texture to be created only gets both stereo textures if game handler agrees.
+* Render target textures get their right texture when first drawn or copied to per side.
 * @see D3DProxyTexture
 * @see GameHandler::ShouldDuplicateTexture()
 ***/
 HRESULT WINAPI D3DProxyDevice::CreateTexture(UINT Width,UINT Height,UINT Levels,DWORD Usage,D3DFORMAT Format,D3DPOOL Pool,IDirect3DTexture9** ppTexture,HANDLE* pSharedHandle)
 {
 	SHOW_CALL("CreateTexture");
+	FlushStereoBatch();
 	
 	HRESULT creationResult;
 	IDirect3DTexture9* pLeftTexture = NULL;
 	IDirect3DTexture9* pRightTexture = NULL;	
+	bool deferRightTexture = false;
 
 	D3DPOOL newPool = Pool;
 
@@ -560,7 +596,11 @@ HRESULT WINAPI D3DProxyDevice::CreateTexture(UINT Width,UINT Height,UINT Levels,
 		// Does this Texture need duplicating?
 		if (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY && m_pGameHandler->ShouldDuplicateTexture(Width, Height, Levels, Usage, Format, Pool)) 
 		{
-			if (FAILED(BaseDirect3DDevice9::CreateTexture(Width, Height, Levels, Usage, Format, newPool, &pRightTexture, pSharedHandle))) {
+			// shared textures need both sides now
+			if ((Usage & D3DUSAGE_RENDERTARGET) && !pSharedHandle) {
+				deferRightTexture = true;
+			}
+			else if (FAILED(BaseDirect3DDevice9::CreateTexture(Width, Height, Levels, Usage, Format, newPool, &pRightTexture, pSharedHandle))) {
 				OutputDebugString("Failed to create right eye texture while attempting to create stereo pair, falling back to mono\n");
 				pRightTexture = NULL;
 			}
@@ -573,7 +613,7 @@ HRESULT WINAPI D3DProxyDevice::CreateTexture(UINT Width,UINT Height,UINT Levels,
 
 	if (SUCCEEDED(creationResult))
 	{
-		*ppTexture = new D3D9ProxyTexture(pLeftTexture, pRightTexture, this);
+		*ppTexture = new D3D9ProxyTexture(pLeftTexture, pRightTexture, this, deferRightTexture);
 	}
 
 	return creationResult;
@@ -587,6 +627,7 @@ HRESULT WINAPI D3DProxyDevice::CreateTexture(UINT Width,UINT Height,UINT Levels,
 HRESULT WINAPI D3DProxyDevice::CreateVolumeTexture(UINT Width,UINT Height,UINT Depth,UINT Levels,DWORD Usage,D3DFORMAT Format,D3DPOOL Pool,IDirect3DVolumeTexture9** ppVolumeTexture,HANDLE* pSharedHandle)
 {
 	SHOW_CALL("CreateVolumeTexture");
+	FlushStereoBatch();
 
 	HRESULT hr = S_OK;
 	IDirect3DDevice9Ex *pDirect3DDevice9Ex = NULL;
@@ -616,6 +657,7 @@ HRESULT WINAPI D3DProxyDevice::CreateVolumeTexture(UINT Width,UINT Height,UINT D
 HRESULT WINAPI D3DProxyDevice::CreateCubeTexture(UINT EdgeLength, UINT Levels, DWORD Usage, D3DFORMAT Format, D3DPOOL Pool, IDirect3DCubeTexture9** ppCubeTexture, HANDLE* pSharedHandle)
 {
 	SHOW_CALL("CreateCubeTexture");
+	FlushStereoBatch();
 
 	D3DPOOL newPool = Pool;
 
@@ -662,6 +704,7 @@ HRESULT WINAPI D3DProxyDevice::CreateCubeTexture(UINT EdgeLength, UINT Levels, D
 HRESULT WINAPI D3DProxyDevice::CreateVertexBuffer(UINT Length, DWORD Usage, DWORD FVF, D3DPOOL Pool, IDirect3DVertexBuffer9** ppVertexBuffer, HANDLE* pSharedHandle)
 {
 	SHOW_CALL("CreateVertexBuffer");
+	FlushStereoBatch();
 		
 	HRESULT hr = S_OK;
 	IDirect3DDevice9Ex *pDirect3DDevice9Ex = NULL;
@@ -689,6 +732,7 @@ HRESULT WINAPI D3DProxyDevice::CreateVertexBuffer(UINT Length, DWORD Usage, DWOR
 HRESULT WINAPI D3DProxyDevice::CreateIndexBuffer(UINT Length,DWORD Usage,D3DFORMAT Format,D3DPOOL Pool,IDirect3DIndexBuffer9** ppIndexBuffer,HANDLE* pSharedHandle)
 {
 	SHOW_CALL("CreateIndexBuffer");
+	FlushStereoBatch();
 
 	HRESULT hr = S_OK;
 	IDirect3DDevice9Ex *pDirect3DDevice9Ex = NULL;
@@ -717,6 +761,7 @@ HRESULT WINAPI D3DProxyDevice::CreateRenderTarget(UINT Width, UINT Height, D3DFO
 												  DWORD MultisampleQuality,BOOL Lockable,IDirect3DSurface9** ppSurface,HANDLE* pSharedHandle)
 {
 	SHOW_CALL("CreateRenderTarget1");
+	FlushStereoBatch();
 	
 	// call public overloaded function
 	return CreateRenderTarget(Width, Height, Format, MultiSample, MultisampleQuality, Lockable, ppSurface, pSharedHandle, false);
@@ -731,6 +776,7 @@ HRESULT WINAPI D3DProxyDevice::CreateRenderTarget(UINT Width, UINT Height, D3DFO
 HRESULT WINAPI D3DProxyDevice::CreateDepthStencilSurface(UINT Width,UINT Height,D3DFORMAT Format,D3DMULTISAMPLE_TYPE MultiSample,DWORD MultisampleQuality,BOOL Discard,IDirect3DSurface9** ppSurface,HANDLE* pSharedHandle)
 {
 	SHOW_CALL("CreateDepthStencilSurface");
+	FlushStereoBatch();
 	
 	IDirect3DSurface9* pDepthStencilSurfaceLeft = NULL;
 	IDirect3DSurface9* pDepthStencilSurfaceRight = NULL;
@@ -778,12 +824,20 @@ HRESULT WINAPI D3DProxyDevice::CreateDepthStencilSurface(UINT Width,UINT Height,
 HRESULT WINAPI D3DProxyDevice::UpdateSurface(IDirect3DSurface9* pSourceSurface,CONST RECT* pSourceRect,IDirect3DSurface9* pDestinationSurface,CONST POINT* pDestPoint)
 {
 	SHOW_CALL("UpdateSurface");
+	FlushStereoBatch();
 	
+	UploadLockedTextures();
+
 	if (!pSourceSurface || !pDestinationSurface)
 		return D3DERR_INVALIDCALL;
 
 	IDirect3DSurface9* pSourceSurfaceLeft = static_cast<D3D9ProxySurface*>(pSourceSurface)->getActualLeft();
 	IDirect3DSurface9* pSourceSurfaceRight = static_cast<D3D9ProxySurface*>(pSourceSurface)->getActualRight();
+
+	// a stereo source makes the sides of the destination differ
+	if (pSourceSurfaceRight)
+		static_cast<D3D9ProxySurface*>(pDestinationSurface)->MakeStereo();
+
 	IDirect3DSurface9* pDestSurfaceLeft = static_cast<D3D9ProxySurface*>(pDestinationSurface)->getActualLeft();
 	IDirect3DSurface9* pDestSurfaceRight = static_cast<D3D9ProxySurface*>(pDestinationSurface)->getActualRight();
 
@@ -818,6 +872,7 @@ HRESULT WINAPI D3DProxyDevice::UpdateSurface(IDirect3DSurface9* pSourceSurface,C
 HRESULT WINAPI D3DProxyDevice::UpdateTexture(IDirect3DBaseTexture9* pSourceTexture,IDirect3DBaseTexture9* pDestinationTexture)
 {
 	SHOW_CALL("UpdateTexture");
+	FlushStereoBatch();
 	
 	if (!pSourceTexture || !pDestinationTexture)
 		return D3DERR_INVALIDCALL;
@@ -828,7 +883,15 @@ HRESULT WINAPI D3DProxyDevice::UpdateTexture(IDirect3DBaseTexture9* pSourceTextu
 	IDirect3DBaseTexture9* pDestTextureLeft = NULL;
 	IDirect3DBaseTexture9* pDestTextureRight = NULL;
 
-	vireio::UnWrapTexture(pSourceTexture, &pSourceTextureLeft, &pSourceTextureRight);
+	UploadLockedTextures();
+
+	// a source texture with the same content on both sides is copied as mono
+	UnWrapBoundTexture(pSourceTexture, &pSourceTextureLeft, &pSourceTextureRight);
+
+	// a stereo source makes the sides of the destination differ
+	if (pSourceTextureRight && (pDestinationTexture->GetType() == D3DRTYPE_TEXTURE))
+		static_cast<D3D9ProxyTexture*>(pDestinationTexture)->MarkStereoDivergent();
+
 	vireio::UnWrapTexture(pDestinationTexture, &pDestTextureLeft, &pDestTextureRight);
 
 	HRESULT result = BaseDirect3DDevice9::UpdateTexture(pSourceTextureLeft, pDestTextureLeft);
@@ -860,7 +923,10 @@ HRESULT WINAPI D3DProxyDevice::UpdateTexture(IDirect3DBaseTexture9* pSourceTextu
 HRESULT WINAPI D3DProxyDevice::GetRenderTargetData(IDirect3DSurface9* pRenderTarget,IDirect3DSurface9* pDestSurface)
 {
 	SHOW_CALL("GetRenderTarget");
+	FlushStereoBatch();
 	
+	UploadLockedTextures();
+
 	if ((pDestSurface == NULL) || (pRenderTarget == NULL))
 		return D3DERR_INVALIDCALL;
 
@@ -903,6 +969,7 @@ HRESULT WINAPI D3DProxyDevice::GetRenderTargetData(IDirect3DSurface9* pRenderTar
 HRESULT WINAPI D3DProxyDevice::GetFrontBufferData(UINT iSwapChain, IDirect3DSurface9* pDestSurface)
 {
 	SHOW_CALL("GetFrontBufferData");
+	FlushStereoBatch();
 	
 	HRESULT result;
 	try {
@@ -923,7 +990,10 @@ HRESULT WINAPI D3DProxyDevice::GetFrontBufferData(UINT iSwapChain, IDirect3DSurf
 HRESULT WINAPI D3DProxyDevice::StretchRect(IDirect3DSurface9* pSourceSurface,CONST RECT* pSourceRect,IDirect3DSurface9* pDestSurface,CONST RECT* pDestRect,D3DTEXTUREFILTERTYPE Filter)
 {
 	SHOW_CALL("StretchRect");
+	FlushStereoBatch();
 	
+	UploadLockedTextures();
+
 	if (!pSourceSurface || !pDestSurface)
 		return D3DERR_INVALIDCALL;
 
@@ -932,6 +1002,11 @@ HRESULT WINAPI D3DProxyDevice::StretchRect(IDirect3DSurface9* pSourceSurface,CON
 
 	IDirect3DSurface9* pSourceSurfaceLeft = pWrappedSource->getActualLeft();
 	IDirect3DSurface9* pSourceSurfaceRight = pWrappedSource->getActualRight();
+
+	// a stereo source makes the sides of the destination differ
+	if (pSourceSurfaceRight)
+		pWrappedDest->MakeStereo();
+
 	IDirect3DSurface9* pDestSurfaceLeft = pWrappedDest->getActualLeft();
 	IDirect3DSurface9* pDestSurfaceRight = pWrappedDest->getActualRight();
 
@@ -965,7 +1040,10 @@ HRESULT WINAPI D3DProxyDevice::StretchRect(IDirect3DSurface9* pSourceSurface,CON
 HRESULT WINAPI D3DProxyDevice::ColorFill(IDirect3DSurface9* pSurface,CONST RECT* pRect,D3DCOLOR color)
 {
 	SHOW_CALL("ColorFill");
+	FlushStereoBatch();
 	
+	UploadLockedTextures();
+
 	HRESULT result;
 	
 	D3D9ProxySurface* pDerivedSurface = static_cast<D3D9ProxySurface*> (pSurface);
@@ -990,6 +1068,7 @@ HRESULT WINAPI D3DProxyDevice::ColorFill(IDirect3DSurface9* pSurface,CONST RECT*
 HRESULT WINAPI D3DProxyDevice::CreateOffscreenPlainSurface(UINT Width,UINT Height,D3DFORMAT Format,D3DPOOL Pool,IDirect3DSurface9** ppSurface,HANDLE* pSharedHandle)
 {	
 	SHOW_CALL("CreateOffscreenPlainSurface");
+	FlushStereoBatch();
 	
 	D3DPOOL newPool = Pool;
 
@@ -1018,6 +1097,7 @@ HRESULT WINAPI D3DProxyDevice::CreateOffscreenPlainSurface(UINT Width,UINT Heigh
 HRESULT WINAPI D3DProxyDevice::SetRenderTarget(DWORD RenderTargetIndex, IDirect3DSurface9* pRenderTarget)
 {
 	SHOW_CALL("SetRenderTarget");
+	FlushStereoBatch();
 	
 	D3D9ProxySurface* newRenderTarget = static_cast<D3D9ProxySurface*>(pRenderTarget);
 
@@ -1042,6 +1122,9 @@ HRESULT WINAPI D3DProxyDevice::SetRenderTarget(DWORD RenderTargetIndex, IDirect3
 	}
 	// Setting a render target
 	else {
+		// render target textures are drawn per side from now on
+		newRenderTarget->MakeStereo();
+
 		if (m_currentRenderingSide == vireio::Left) {
 			result = BaseDirect3DDevice9::SetRenderTarget(RenderTargetIndex, newRenderTarget->getActualLeft());
 		}
@@ -1074,6 +1157,7 @@ HRESULT WINAPI D3DProxyDevice::SetRenderTarget(DWORD RenderTargetIndex, IDirect3
 HRESULT WINAPI D3DProxyDevice::GetRenderTarget(DWORD RenderTargetIndex,IDirect3DSurface9** ppRenderTarget)
 {
 	SHOW_CALL("GetRenderTarget");
+	FlushStereoBatch();
 	
 	if ((RenderTargetIndex >= m_activeRenderTargets.capacity()) || (RenderTargetIndex < 0)) {
 		return D3DERR_INVALIDCALL;
@@ -1096,6 +1180,7 @@ HRESULT WINAPI D3DProxyDevice::GetRenderTarget(DWORD RenderTargetIndex,IDirect3D
 HRESULT WINAPI D3DProxyDevice::SetDepthStencilSurface(IDirect3DSurface9* pNewZStencil)
 {
 	SHOW_CALL("SetDepthStencilSurface");
+	FlushStereoBatch();
 	
 	D3D9ProxySurface* pNewDepthStencil = static_cast<D3D9ProxySurface*>(pNewZStencil);
 
@@ -1131,6 +1216,7 @@ HRESULT WINAPI D3DProxyDevice::SetDepthStencilSurface(IDirect3DSurface9* pNewZSt
 HRESULT WINAPI D3DProxyDevice::GetDepthStencilSurface(IDirect3DSurface9** ppZStencilSurface)
 {
 	SHOW_CALL("GetDepthStencilSurface");
+	FlushStereoBatch();
 	
 	if (!m_pActiveStereoDepthStencil)
 		return D3DERR_NOTFOUND;
@@ -1149,6 +1235,7 @@ HRESULT WINAPI D3DProxyDevice::GetDepthStencilSurface(IDirect3DSurface9** ppZSte
 HRESULT WINAPI D3DProxyDevice::BeginScene()
 {
 	SHOW_CALL("BeginScene");
+	FlushStereoBatch();
 
 	if (m_isFirstBeginSceneOfFrame)
 	{
@@ -1253,6 +1340,7 @@ HRESULT WINAPI D3DProxyDevice::BeginScene()
 HRESULT WINAPI D3DProxyDevice::EndScene()
 {
 	SHOW_CALL("EndScene");
+	FlushStereoBatch();
 
 	HandleLandmarkMoment(DeviceBehavior::WhenToDo::END_SCENE);
 
@@ -1265,6 +1353,7 @@ HRESULT WINAPI D3DProxyDevice::EndScene()
 HRESULT WINAPI D3DProxyDevice::Clear(DWORD Count,CONST D3DRECT* pRects,DWORD Flags,D3DCOLOR Color,float Z,DWORD Stencil)
 {
 	SHOW_CALL("Clear");
+	FlushStereoBatch();
 	
 	HRESULT result;
 
@@ -1293,6 +1382,7 @@ HRESULT WINAPI D3DProxyDevice::Clear(DWORD Count,CONST D3DRECT* pRects,DWORD Fla
 HRESULT WINAPI D3DProxyDevice::SetTransform(D3DTRANSFORMSTATETYPE State, CONST D3DMATRIX* pMatrix)
 {
 	SHOW_CALL("SetTransform");
+	FlushStereoBatch();
 	
 	if(State == D3DTS_VIEW)
 	{
@@ -1439,6 +1529,7 @@ HRESULT WINAPI D3DProxyDevice::SetTransform(D3DTRANSFORMSTATETYPE State, CONST D
 HRESULT WINAPI D3DProxyDevice::MultiplyTransform(D3DTRANSFORMSTATETYPE State,CONST D3DMATRIX* pMatrix)
 {
 	SHOW_CALL("MultiplyTransform");
+	FlushStereoBatch();
 	
 	OutputDebugString(__FUNCTION__); 
 	OutputDebugString("\n"); 
@@ -1458,6 +1549,7 @@ HRESULT WINAPI D3DProxyDevice::MultiplyTransform(D3DTRANSFORMSTATETYPE State,CON
 HRESULT WINAPI D3DProxyDevice::SetViewport(CONST D3DVIEWPORT9* pViewport)
 {	
 	SHOW_CALL("SetViewport");
+	FlushStereoBatch();
 	
 	HRESULT result = BaseDirect3DDevice9::SetViewport(pViewport);
 
@@ -1480,6 +1572,36 @@ HRESULT WINAPI D3DProxyDevice::SetViewport(CONST D3DVIEWPORT9* pViewport)
 	return result;
 }
 
+/**
+* Try and set, if success update the render state shadow.
+* Also, it captures the render state in stored proxy state block.
+* @see m_renderStateShadow
+* @see D3D9ProxyStateBlock::SelectAndCaptureRenderState()
+***/
+HRESULT WINAPI D3DProxyDevice::SetRenderState(D3DRENDERSTATETYPE State,DWORD Value)
+{
+	SHOW_CALL("SetRenderState");
+
+	if (StereoBatchRecording())
+		StereoBatchState(RenderStateShadow::RenderStateIndex(State), Value);
+
+	HRESULT result = BaseDirect3DDevice9::SetRenderState(State, Value);
+
+	if (SUCCEEDED(result)) {
+
+		// If in a Begin-End StateBlock pair update the block state rather than the current proxy device state
+		// (the actual device only records the state then)
+		if (m_pCapturingStateTo) {
+			m_pCapturingStateTo->SelectAndCaptureRenderState(RenderStateShadow::RenderStateIndex(State), Value);
+		}
+		else {
+			m_renderStateShadow.Set(RenderStateShadow::RenderStateIndex(State), Value);
+		}
+	}
+
+	return result;
+}
+
 /**
 * Creates proxy state block.
 * Also, selects capture type option according to state block type.
@@ -1489,6 +1611,7 @@ HRESULT WINAPI D3DProxyDevice::SetViewport(CONST D3DVIEWPORT9* pViewport)
 HRESULT WINAPI D3DProxyDevice::CreateStateBlock(D3DSTATEBLOCKTYPE Type,IDirect3DStateBlock9** ppSB)
 {
 	SHOW_CALL("CreateStateBlock");
+	FlushStereoBatch();
 	
 	IDirect3DStateBlock9* pActualStateBlock = NULL;
 	HRESULT creationResult = BaseDirect3DDevice9::CreateStateBlock(Type, &pActualStateBlock);
@@ -1536,6 +1659,7 @@ HRESULT WINAPI D3DProxyDevice::CreateStateBlock(D3DSTATEBLOCKTYPE Type,IDirect3D
 HRESULT WINAPI D3DProxyDevice::BeginStateBlock()
 {
 	SHOW_CALL("BeginStateBlock");
+	FlushStereoBatch();
 	
 	HRESULT result;
 	if (SUCCEEDED(result = BaseDirect3DDevice9::BeginStateBlock())) {
@@ -1554,6 +1678,7 @@ HRESULT WINAPI D3DProxyDevice::BeginStateBlock()
 HRESULT WINAPI D3DProxyDevice::EndStateBlock(IDirect3DStateBlock9** ppSB)
 {
 	SHOW_CALL("ppSB");
+	FlushStereoBatch();
 	
 	IDirect3DStateBlock9* pActualStateBlock = NULL;
 	HRESULT creationResult = BaseDirect3DDevice9::EndStateBlock(&pActualStateBlock);
@@ -1581,10 +1706,11 @@ HRESULT WINAPI D3DProxyDevice::GetTexture(DWORD Stage,IDirect3DBaseTexture9** pp
 {
 	SHOW_CALL("GetTexture");
 	
-	if (m_activeTextureStages.count(Stage) != 1)
+	UINT slot = TextureStageToSlot(Stage);
+	if (!m_activeTextureStages.IsBound(slot))
 		return D3DERR_INVALIDCALL;
 	else {
-		*ppTexture = m_activeTextureStages[Stage];
+		*ppTexture = m_activeTextureStages.Get(slot);
 		if ((*ppTexture))
 			(*ppTexture)->AddRef();
 		return D3D_OK;
@@ -1601,13 +1727,15 @@ HRESULT WINAPI D3DProxyDevice::SetTexture(DWORD Stage,IDirect3DBaseTexture9* pTe
 {
 	SHOW_CALL("SetTexture");
 	
+	if (StereoBatchRecording() && !m_stereoBatch.RecordTexture(Stage, pTexture, m_activeTextureStages.Get(TextureStageToSlot(Stage))))
+		FlushStereoBatch();
+
 	HRESULT result;
+	IDirect3DBaseTexture9* pActualLeftTexture = NULL;
+	IDirect3DBaseTexture9* pActualRightTexture = NULL;
 	if (pTexture) {
 
-		IDirect3DBaseTexture9* pActualLeftTexture = NULL;
-		IDirect3DBaseTexture9* pActualRightTexture = NULL;
-
-		vireio::UnWrapTexture(pTexture, &pActualLeftTexture, &pActualRightTexture);
+		UnWrapBoundTexture(pTexture, &pActualLeftTexture, &pActualRightTexture);
 
 		// Try and Update the actual devices textures
 		if ((pActualRightTexture == NULL) || (m_currentRenderingSide == vireio::Left)) // use left (mono) if not stereo or one left side
@@ -1629,32 +1757,76 @@ HRESULT WINAPI D3DProxyDevice::SetTexture(DWORD Stage,IDirect3DBaseTexture9* pTe
 		}
 		else {
 
-			// remove existing texture that was active at Stage if there is one
-			if (m_activeTextureStages.count(Stage) == 1) { 
-
-				IDirect3DBaseTexture9* pOldTexture = m_activeTextureStages.at(Stage);
-				if (pOldTexture)
-					pOldTexture->Release();
-
-				m_activeTextureStages.erase(Stage);
-			}
-
-			// insert new texture (can be a NULL pointer, this is important for StateBlock tracking)
-			if(m_activeTextureStages.insert(std::pair<DWORD, IDirect3DBaseTexture9*>(Stage, pTexture)).second) {
-				//success
-				if (pTexture)
-					pTexture->AddRef();
+			// bind new texture, releases the texture that was active at Stage if there is one
+			// (can be a NULL pointer, this is important for StateBlock tracking)
+			UINT slot = TextureStageToSlot(Stage);
+			if (slot != BINDING_INVALID_SLOT) {
+				m_activeTextureStages.Bind(slot, pTexture);
+				m_stereoTextureStages.Record(slot, pActualLeftTexture, pActualRightTexture);
 			}
 			else {
 				OutputDebugString(__FUNCTION__);
 				OutputDebugString("\n");
 				OutputDebugString("Unable to store active Texture Stage.\n");
-				assert(false);
+			}
+		}
+	}
+
+	return result;
+}
 
-				//If we get here the state of the texture tracking is fubared and an implosion is imminent.
+/**
+* Try and set, if success update the render state shadow.
+* Also, it captures the texture stage state in stored proxy state block.
+* @see m_renderStateShadow
+* @see D3D9ProxyStateBlock::SelectAndCaptureRenderState()
+***/
+HRESULT WINAPI D3DProxyDevice::SetTextureStageState(DWORD Stage,D3DTEXTURESTAGESTATETYPE Type,DWORD Value)
+{
+	SHOW_CALL("SetTextureStageState");
 
-				result = D3DERR_INVALIDCALL;
-			}
+	if (StereoBatchRecording())
+		StereoBatchState(RenderStateShadow::TextureStageStateIndex(Stage, Type), Value);
+
+	HRESULT result = BaseDirect3DDevice9::SetTextureStageState(Stage, Type, Value);
+
+	if (SUCCEEDED(result)) {
+
+		// If in a Begin-End StateBlock pair update the block state rather than the current proxy device state
+		if (m_pCapturingStateTo) {
+			m_pCapturingStateTo->SelectAndCaptureRenderState(RenderStateShadow::TextureStageStateIndex(Stage, Type), Value);
+		}
+		else {
+			m_renderStateShadow.Set(RenderStateShadow::TextureStageStateIndex(Stage, Type), Value);
+		}
+	}
+
+	return result;
+}
+
+/**
+* Try and set, if success update the render state shadow.
+* Also, it captures the sampler state in stored proxy state block.
+* @see m_renderStateShadow
+* @see D3D9ProxyStateBlock::SelectAndCaptureRenderState()
+***/
+HRESULT WINAPI D3DProxyDevice::SetSamplerState(DWORD Sampler,D3DSAMPLERSTATETYPE Type,DWORD Value)
+{
+	SHOW_CALL("SetSamplerState");
+
+	if (StereoBatchRecording())
+		StereoBatchState(RenderStateShadow::SamplerStateIndex(Sampler, Type), Value);
+
+	HRESULT result = BaseDirect3DDevice9::SetSamplerState(Sampler, Type, Value);
+
+	if (SUCCEEDED(result)) {
+
+		// If in a Begin-End StateBlock pair update the block state rather than the current proxy device state
+		if (m_pCapturingStateTo) {
+			m_pCapturingStateTo->SelectAndCaptureRenderState(RenderStateShadow::SamplerStateIndex(Sampler, Type), Value);
+		}
+		else {
+			m_renderStateShadow.Set(RenderStateShadow::SamplerStateIndex(Sampler, Type), Value);
 		}
 	}
 
@@ -1663,7 +1835,9 @@ HRESULT WINAPI D3DProxyDevice::SetTexture(DWORD Stage,IDirect3DBaseTexture9* pTe
 
 /**
 * Applies all dirty shader registers, draws both stereo sides if switchDrawingSide() agrees.
+* Records the draw to the stereo batch instead of drawing the other side if the batch records.
 * @see switchDrawingSide()
+* @see m_stereoBatch
 ***/
 HRESULT WINAPI D3DProxyDevice::DrawPrimitive(D3DPRIMITIVETYPE PrimitiveType,UINT StartVertex,UINT PrimitiveCount)
 {
@@ -1673,11 +1847,15 @@ HRESULT WINAPI D3DProxyDevice::DrawPrimitive(D3DPRIMITIVETYPE PrimitiveType,UINT
 	if (m_bDoNotDrawVShader || m_bDoNotDrawPShader)
 		return S_OK;
 
+	UploadLockedTextures();
+	bool stereoBatch = StereoBatchDraw();
 	m_spManagedShaderRegisters->ApplyAllDirty(m_currentRenderingSide);
 
 	HRESULT result;
 	if (SUCCEEDED(result = BaseDirect3DDevice9::DrawPrimitive(PrimitiveType, StartVertex, PrimitiveCount))) {
-		if (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY && switchDrawingSide())
+		if (stereoBatch)
+			m_stereoBatch.RecordDrawPrimitive(PrimitiveType, StartVertex, PrimitiveCount);
+		else if (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY && !m_stereoBatch.IsReplaying() && switchDrawingSide())
 			BaseDirect3DDevice9::DrawPrimitive(PrimitiveType, StartVertex, PrimitiveCount);
 	}
 
@@ -1686,7 +1864,9 @@ HRESULT WINAPI D3DProxyDevice::DrawPrimitive(D3DPRIMITIVETYPE PrimitiveType,UINT
 
 /**
 * Applies all dirty shader registers, draws both stereo sides if switchDrawingSide() agrees.
+* Records the draw to the stereo batch instead of drawing the other side if the batch records.
 * @see switchDrawingSide()
+* @see m_stereoBatch
 ***/
 HRESULT WINAPI D3DProxyDevice::DrawIndexedPrimitive(D3DPRIMITIVETYPE PrimitiveType,INT BaseVertexIndex,UINT MinVertexIndex,UINT NumVertices,UINT startIndex,UINT primCount)
 {
@@ -1696,11 +1876,15 @@ HRESULT WINAPI D3DProxyDevice::DrawIndexedPrimitive(D3DPRIMITIVETYPE PrimitiveTy
 	if (m_bDoNotDrawVShader || m_bDoNotDrawPShader)
 		return S_OK;
 
+	UploadLockedTextures();
+	bool stereoBatch = StereoBatchDraw();
 	m_spManagedShaderRegisters->ApplyAllDirty(m_currentRenderingSide);
 
 	HRESULT result;
 	if (SUCCEEDED(result = BaseDirect3DDevice9::DrawIndexedPrimitive(PrimitiveType, BaseVertexIndex, MinVertexIndex, NumVertices, startIndex, primCount))) {
-		if (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY && switchDrawingSide()) {			
+		if (stereoBatch)
+			m_stereoBatch.RecordDrawIndexedPrimitive(PrimitiveType, BaseVertexIndex, MinVertexIndex, NumVertices, startIndex, primCount);
+		else if (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY && !m_stereoBatch.IsReplaying() && switchDrawingSide()) {			
 			HRESULT result2 = BaseDirect3DDevice9::DrawIndexedPrimitive(PrimitiveType, BaseVertexIndex, MinVertexIndex, NumVertices, startIndex, primCount);
 			if (result != result2)
 				OutputDebugString("moop\n");
@@ -1712,7 +1896,9 @@ HRESULT WINAPI D3DProxyDevice::DrawIndexedPrimitive(D3DPRIMITIVETYPE PrimitiveTy
 
 /**
 * Applies all dirty shader registers, draws both stereo sides if switchDrawingSide() agrees.
+* Records the draw to the stereo batch instead of drawing the other side if the batch records.
 * @see switchDrawingSide()
+* @see m_stereoBatch
 ***/
 HRESULT WINAPI D3DProxyDevice::DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType,UINT PrimitiveCount,CONST void* pVertexStreamZeroData,UINT VertexStreamZeroStride)
 {
@@ -1722,12 +1908,21 @@ HRESULT WINAPI D3DProxyDevice::DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType,UI
 	if (m_bDoNotDrawVShader || m_bDoNotDrawPShader)
 		return S_OK;
 
+	UploadLockedTextures();
+	bool stereoBatch = StereoBatchDraw();
+	if (stereoBatch)
+		StereoBatchInitialStream(0);
 	m_spManagedShaderRegisters->ApplyAllDirty(m_currentRenderingSide);
 
 	HRESULT result;
 	if (SUCCEEDED(result = BaseDirect3DDevice9::DrawPrimitiveUP(PrimitiveType, PrimitiveCount, pVertexStreamZeroData, VertexStreamZeroStride))) {
-		if (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY && switchDrawingSide())
+		if (stereoBatch)
+			m_stereoBatch.RecordDrawPrimitiveUP(PrimitiveType, PrimitiveCount, pVertexStreamZeroData, VertexStreamZeroStride);
+		else if (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY && !m_stereoBatch.IsReplaying() && switchDrawingSide())
 			BaseDirect3DDevice9::DrawPrimitiveUP(PrimitiveType, PrimitiveCount, pVertexStreamZeroData, VertexStreamZeroStride);
+
+		// the draw resets stream 0 on the actual device
+		m_activeVertexBuffers.Bind(0, NULL);
 	}
 
 	return result;
@@ -1735,7 +1930,9 @@ HRESULT WINAPI D3DProxyDevice::DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType,UI
 
 /**
 * Applies all dirty shader registers, draws both stereo sides if switchDrawingSide() agrees.
+* Records the draw to the stereo batch instead of drawing the other side if the batch records.
 * @see switchDrawingSide()
+* @see m_stereoBatch
 ***/
 HRESULT WINAPI D3DProxyDevice::DrawIndexedPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType,UINT MinVertexIndex,UINT NumVertices,UINT PrimitiveCount,CONST void* pIndexData,D3DFORMAT IndexDataFormat,CONST void* pVertexStreamZeroData,UINT VertexStreamZeroStride)
 {
@@ -1745,12 +1942,27 @@ HRESULT WINAPI D3DProxyDevice::DrawIndexedPrimitiveUP(D3DPRIMITIVETYPE Primitive
 	if (m_bDoNotDrawVShader || m_bDoNotDrawPShader)
 		return S_OK;
 
+	UploadLockedTextures();
+	bool stereoBatch = StereoBatchDraw();
+	if (stereoBatch) {
+		StereoBatchInitialStream(0);
+		m_stereoBatch.RecordInitialIndices(m_pActiveIndicies);
+	}
 	m_spManagedShaderRegisters->ApplyAllDirty(m_currentRenderingSide);
 
 	HRESULT result;
 	if (SUCCEEDED(result = BaseDirect3DDevice9::DrawIndexedPrimitiveUP(PrimitiveType, MinVertexIndex, NumVertices, PrimitiveCount, pIndexData, IndexDataFormat, pVertexStreamZeroData, VertexStreamZeroStride))) {
-		if (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY && switchDrawingSide())		
+		if (stereoBatch)
+			m_stereoBatch.RecordDrawIndexedPrimitiveUP(PrimitiveType, MinVertexIndex, NumVertices, PrimitiveCount, pIndexData, IndexDataFormat, pVertexStreamZeroData, VertexStreamZeroStride);
+		else if (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY && !m_stereoBatch.IsReplaying() && switchDrawingSide())		
 			BaseDirect3DDevice9::DrawIndexedPrimitiveUP(PrimitiveType, MinVertexIndex, NumVertices, PrimitiveCount, pIndexData, IndexDataFormat, pVertexStreamZeroData, VertexStreamZeroStride);
+
+		// the draw resets stream 0 and the indices on the actual device
+		m_activeVertexBuffers.Bind(0, NULL);
+		if (m_pActiveIndicies) {
+			m_pActiveIndicies->Release();
+			m_pActiveIndicies = NULL;
+		}
 	}
 
 	return result;
@@ -1762,10 +1974,12 @@ HRESULT WINAPI D3DProxyDevice::DrawIndexedPrimitiveUP(D3DPRIMITIVETYPE Primitive
 HRESULT WINAPI D3DProxyDevice::ProcessVertices(UINT SrcStartIndex,UINT DestIndex,UINT VertexCount,IDirect3DVertexBuffer9* pDestBuffer,IDirect3DVertexDeclaration9* pVertexDecl,DWORD Flags)
 {
 	SHOW_CALL("ProcessVertices");
+	FlushStereoBatch();
 	
 	if (!pDestBuffer)
 		return D3DERR_INVALIDCALL;
 
+	UploadLockedTextures();
 	m_spManagedShaderRegisters->ApplyAllDirty(m_currentRenderingSide);
 
 	BaseDirect3DVertexBuffer9* pCastDestBuffer = static_cast<BaseDirect3DVertexBuffer9*>(pDestBuffer);
@@ -1789,6 +2003,7 @@ HRESULT WINAPI D3DProxyDevice::ProcessVertices(UINT SrcStartIndex,UINT DestIndex
 HRESULT WINAPI D3DProxyDevice::CreateVertexDeclaration(CONST D3DVERTEXELEMENT9* pVertexElements,IDirect3DVertexDeclaration9** ppDecl)
 {
 	SHOW_CALL("CreateVertexDeclaration");
+	FlushStereoBatch();
 	
 	IDirect3DVertexDeclaration9* pActualVertexDeclaration = NULL;
 	HRESULT creationResult = BaseDirect3DDevice9::CreateVertexDeclaration(pVertexElements, &pActualVertexDeclaration );
@@ -1810,6 +2025,9 @@ HRESULT WINAPI D3DProxyDevice::SetVertexDeclaration(IDirect3DVertexDeclaration9*
 	
 	BaseDirect3DVertexDeclaration9* pWrappedVDeclarationData = static_cast<BaseDirect3DVertexDeclaration9*>(pDecl);
 
+	if (StereoBatchRecording())
+		m_stereoBatch.RecordVertexDeclaration(pDecl, m_pActiveVertexDeclaration);
+
 	// Update actual Vertex Declaration
 	HRESULT result;
 	if (pWrappedVDeclarationData)
@@ -1865,6 +2083,7 @@ HRESULT WINAPI D3DProxyDevice::GetVertexDeclaration(IDirect3DVertexDeclaration9*
 HRESULT WINAPI D3DProxyDevice::CreateVertexShader(CONST DWORD* pFunction,IDirect3DVertexShader9** ppShader)
 {
 	SHOW_CALL("CreateVertexShader");
+	FlushStereoBatch();
 	
 	IDirect3DVertexShader9* pActualVShader = NULL;
 	HRESULT creationResult = BaseDirect3DDevice9::CreateVertexShader(pFunction, &pActualVShader);
@@ -1911,6 +2130,9 @@ HRESULT WINAPI D3DProxyDevice::SetVertexShader(IDirect3DVertexShader9* pShader)
 	
 	D3D9ProxyVertexShader* pWrappedVShaderData = static_cast<D3D9ProxyVertexShader*>(pShader);
 
+	if (StereoBatchRecording())
+		m_stereoBatch.RecordVertexShader(pShader, m_pActiveVertexShader);
+
 	// Update actual Vertex shader
 	HRESULT result;
 	if (pWrappedVShaderData)
@@ -1957,15 +2179,16 @@ HRESULT WINAPI D3DProxyDevice::SetVertexShader(IDirect3DVertexShader9* pShader)
 		else
 		{
 			if (m_bViewportIsSquished)
-				BaseDirect3DDevice9::SetViewport(&m_LastViewportSet);
+				getActual()->SetViewport(&m_LastViewportSet);
 			m_bViewportIsSquished = false;
 		}
 	}
 	else
 		m_bDoNotDrawVShader = false;
 
-	// increase vertex shader call count
-	++m_VertexShaderCount;
+	// increase vertex shader call count (the stereo batch replay is no game call)
+	if (!m_stereoBatch.IsReplaying())
+		++m_VertexShaderCount;
 	return result;
 }
 
@@ -1993,6 +2216,13 @@ HRESULT WINAPI D3DProxyDevice::SetVertexShaderConstantF(UINT StartRegister,CONST
 {
 	SHOW_CALL("SEtVertexShadewrConstantF");
 	
+	if (StereoBatchRecording()) {
+		const std::vector<float>& registers = m_spManagedShaderRegisters->GetAllVSConstantRegistersF();
+		if (((StartRegister + Vector4fCount) * 4 > registers.size()) ||
+			!m_stereoBatch.RecordVertexShaderConstantF(StartRegister, pConstantData, Vector4fCount, &registers[0]))
+			FlushStereoBatch();
+	}
+
 	HRESULT result = D3DERR_INVALIDCALL;
 
 	if (m_pCapturingStateTo) {
@@ -2027,6 +2257,13 @@ HRESULT WINAPI D3DProxyDevice::SetStreamSource(UINT StreamNumber, IDirect3DVerte
 	SHOW_CALL("SetStreamSource");
 	
 	BaseDirect3DVertexBuffer9* pCastStreamData = static_cast<BaseDirect3DVertexBuffer9*>(pStreamData);
+
+	if (StereoBatchRecording()) {
+		StereoBatchInitialStream(StreamNumber);
+		if (!m_stereoBatch.RecordStreamSource(StreamNumber, pStreamData, OffsetInBytes, Stride))
+			FlushStereoBatch();
+	}
+
 	HRESULT result;
 	if (pStreamData) {		
 		result = BaseDirect3DDevice9::SetStreamSource(StreamNumber, pCastStreamData->getActual(), OffsetInBytes, Stride);
@@ -2044,34 +2281,14 @@ HRESULT WINAPI D3DProxyDevice::SetStreamSource(UINT StreamNumber, IDirect3DVerte
 			m_pCapturingStateTo->SelectAndCaptureState(StreamNumber, pCastStreamData);
 		}
 		else {
-			// remove existing vertex buffer that was active at StreamNumber if there is one
-			if (m_activeVertexBuffers.count(StreamNumber) == 1) { 
-
-				IDirect3DVertexBuffer9* pOldBuffer = m_activeVertexBuffers.at(StreamNumber);
-				if (pOldBuffer == pStreamData)
-					return result;
-
-				if (pOldBuffer)
-					pOldBuffer->Release();
-
-				m_activeVertexBuffers.erase(StreamNumber);
-			}
-
-			// insert new vertex buffer
-			if(m_activeVertexBuffers.insert(std::pair<UINT, BaseDirect3DVertexBuffer9*>(StreamNumber, pCastStreamData)).second) {
-				//success
-				if (pStreamData)
-					pStreamData->AddRef();
+			// bind new vertex buffer, releases the vertex buffer that was active at StreamNumber if there is one
+			if (StreamNumber < BINDING_VERTEX_STREAMS) {
+				m_activeVertexBuffers.Bind(StreamNumber, pCastStreamData);
 			}
 			else {
 				OutputDebugString(__FUNCTION__);
 				OutputDebugString("\n");
-				OutputDebugString("Unable to store active Texture Stage.\n");
-				assert(false);
-
-				//If we get here the state of the texture tracking is fubared and an implosion is imminent.
-
-				result = D3DERR_INVALIDCALL;
+				OutputDebugString("Unable to store active Vertex Stream.\n");
 			}
 		}
 	}
@@ -2091,14 +2308,14 @@ HRESULT WINAPI D3DProxyDevice::GetStreamSource(UINT StreamNumber, IDirect3DVerte
 	// This whole methods implementation is highly questionable. Not sure exactly how GetStreamSource works
 	HRESULT result = D3DERR_INVALIDCALL;
 
-	if (m_activeVertexBuffers.count(StreamNumber) == 1) {
+	if (m_activeVertexBuffers.IsBound(StreamNumber)) {
 
-		//IDirect3DVertexBuffer9* pCurrentActual = m_activeVertexBuffers[StreamNumber]->getActual();
+		//IDirect3DVertexBuffer9* pCurrentActual = m_activeVertexBuffers.Get(StreamNumber)->getActual();
 
 		//IDirect3DVertexBuffer9* pActualResultBuffer = NULL;
 		//HRESULT result = BaseDirect3DDevice9::GetStreamSource(StreamNumber, &pCurrentActual, pOffsetInBytes, pStride);
 
-		*ppStreamData = m_activeVertexBuffers[StreamNumber];
+		*ppStreamData = m_activeVertexBuffers.Get(StreamNumber);
 		if ((*ppStreamData))
 			(*ppStreamData)->AddRef();
 
@@ -2117,6 +2334,9 @@ HRESULT WINAPI D3DProxyDevice::SetIndices(IDirect3DIndexBuffer9* pIndexData)
 	
 	BaseDirect3DIndexBuffer9* pWrappedNewIndexData = static_cast<BaseDirect3DIndexBuffer9*>(pIndexData);
 
+	if (StereoBatchRecording())
+		m_stereoBatch.RecordIndices(pIndexData, m_pActiveIndicies);
+
 	// Update actual index buffer
 	HRESULT result;
 	if (pWrappedNewIndexData)
@@ -2168,6 +2388,7 @@ HRESULT WINAPI D3DProxyDevice::GetIndices(IDirect3DIndexBuffer9** ppIndexData)
 HRESULT WINAPI D3DProxyDevice::CreatePixelShader(CONST DWORD* pFunction,IDirect3DPixelShader9** ppShader)
 {
 	SHOW_CALL("CreatePixelSHader");
+	FlushStereoBatch();
 	
 	IDirect3DPixelShader9* pActualPShader = NULL;
 	HRESULT creationResult = BaseDirect3DDevice9::CreatePixelShader(pFunction, &pActualPShader);
@@ -2189,15 +2410,15 @@ HRESULT WINAPI D3DProxyDevice::SetPixelShader(IDirect3DPixelShader9* pShader)
 	
 	D3D9ProxyPixelShader* pWrappedPShaderData = static_cast<D3D9ProxyPixelShader*>(pShader);
 
+	if (StereoBatchRecording())
+		m_stereoBatch.RecordPixelShader(pShader, m_pActivePixelShader);
+
 	// Update actual pixel shader
 	HRESULT result;
 	if (pWrappedPShaderData)
 		result = BaseDirect3DDevice9::SetPixelShader(pWrappedPShaderData->getActual());
 	else
-	{
 		result = BaseDirect3DDevice9::SetPixelShader(NULL);
-		return result;
-	}
 
 	// Update stored proxy pixel shader
 	if (SUCCEEDED(result)) {
@@ -2261,6 +2482,13 @@ HRESULT WINAPI D3DProxyDevice::SetPixelShaderConstantF(UINT StartRegister,CONST
 {
 	SHOW_CALL("SetPixelShaderConstantF");
 	
+	if (StereoBatchRecording()) {
+		const std::vector<float>& registers = m_spManagedShaderRegisters->GetAllPSConstantRegistersF();
+		if (((StartRegister + Vector4fCount) * 4 > registers.size()) ||
+			!m_stereoBatch.RecordPixelShaderConstantF(StartRegister, pConstantData, Vector4fCount, &registers[0]))
+			FlushStereoBatch();
+	}
+
 	HRESULT result = D3DERR_INVALIDCALL;
 
 	if (m_pCapturingStateTo) {
@@ -2292,7 +2520,9 @@ HRESULT WINAPI D3DProxyDevice::GetPixelShaderConstantF(UINT StartRegister,float*
 HRESULT WINAPI D3DProxyDevice::DrawRectPatch(UINT Handle,CONST float* pNumSegs,CONST D3DRECTPATCH_INFO* pRectPatchInfo)
 {
 	SHOW_CALL("DrawRectPatch");
+	FlushStereoBatch();
 	
+	UploadLockedTextures();
 	m_spManagedShaderRegisters->ApplyAllDirty(m_currentRenderingSide);
 
 	HRESULT result;
@@ -2311,7 +2541,9 @@ HRESULT WINAPI D3DProxyDevice::DrawRectPatch(UINT Handle,CONST float* pNumSegs,C
 HRESULT WINAPI D3DProxyDevice::DrawTriPatch(UINT Handle,CONST float* pNumSegs,CONST D3DTRIPATCH_INFO* pTriPatchInfo)
 {
 	SHOW_CALL("DrawTriPatch");
+	FlushStereoBatch();
 	
+	UploadLockedTextures();
 	m_spManagedShaderRegisters->ApplyAllDirty(m_currentRenderingSide);
 
 	HRESULT result;
@@ -2329,6 +2561,7 @@ HRESULT WINAPI D3DProxyDevice::DrawTriPatch(UINT Handle,CONST float* pNumSegs,CO
 HRESULT WINAPI D3DProxyDevice::CreateQuery(D3DQUERYTYPE Type,IDirect3DQuery9** ppQuery)
 {
 	SHOW_CALL("CreateQuery");
+	FlushStereoBatch();
 	
 	// this seems a weird response to me but it's what the actual device does.
 	if (!ppQuery)
@@ -2355,6 +2588,7 @@ HRESULT WINAPI D3DProxyDevice::CreateRenderTarget(UINT Width, UINT Height, D3DFO
 												  DWORD MultisampleQuality,BOOL Lockable,IDirect3DSurface9** ppSurface,HANDLE* pSharedHandle, bool isSwapChainBackBuffer)
 {
 	SHOW_CALL("CreateRenderTarget2");
+	FlushStereoBatch();
 	
 	IDirect3DSurface9* pLeftRenderTarget = NULL;
 	IDirect3DSurface9* pRightRenderTarget = NULL;
@@ -3212,6 +3446,9 @@ void D3DProxyDevice::OnCreateOrRestore()
 {	
 	SHOW_CALL("OnCreateOrRestore");
 	
+	// new or reset device, all states are at their defaults now
+	m_renderStateShadow.ForgetAll();
+
 	m_currentRenderingSide = vireio::Left;
 	m_pCurrentView = &m_leftView;
 	m_pCurrentProjection = &m_leftProjection;
@@ -3254,6 +3491,7 @@ void D3DProxyDevice::OnCreateOrRestore()
 
 	SetupHUD();
 
+	stereoView->SetRenderStateShadow(&m_renderStateShadow);
 	stereoView->Init(getActual());
 
 	m_spShaderViewAdjustment->UpdateProjectionMatrices((float)stereoView->viewport.Width/(float)stereoView->viewport.Height, config.fPFOV);
@@ -3291,6 +3529,13 @@ bool D3DProxyDevice::setDrawingSide(vireio::RenderPosition side)
 		return true;
 	}
 
+	// replay the deferred draws first, that switches the side as well
+	if (!m_stereoBatch.IsReplaying()) {
+		FlushStereoBatch();
+		if (side == m_currentRenderingSide)
+			return true;
+	}
+
 	// should never try and render for the right eye if there is no render target for the main render targets right side
 	if (!m_activeRenderTargets[0]->IsStereo() && (side == vireio::Right)) {
 		return false;
@@ -3338,28 +3583,19 @@ bool D3DProxyDevice::setDrawingSide(vireio::RenderPosition side)
 			result = BaseDirect3DDevice9::SetDepthStencilSurface(m_pActiveStereoDepthStencil->getActualRight());
 	}
 
-	// switch textures to new side
-	IDirect3DBaseTexture9* pActualLeftTexture = NULL;
-	IDirect3DBaseTexture9* pActualRightTexture = NULL;
-
-	for(auto it = m_activeTextureStages.begin(); it != m_activeTextureStages.end(); ++it )
+	// switch stereo textures to new side, the actual textures were recorded when the textures got bound
+	// (mono textures don't need changing. They will always be set initially and then won't need changing)
+	uint32_t stereoSlots = m_stereoTextureStages.GetStereoMask();
+	for (UINT slot = 0; stereoSlots; slot++, stereoSlots >>= 1)
 	{
-		if (it->second) {
-			pActualLeftTexture = NULL;
-			pActualRightTexture = NULL;
-			vireio::UnWrapTexture(it->second, &pActualLeftTexture, &pActualRightTexture);
-
-			// if stereo texture
-			if (pActualRightTexture != NULL) { 
-				if (side == vireio::Left) 
-					result = BaseDirect3DDevice9::SetTexture(it->first, pActualLeftTexture); 
-				else 
-					result = BaseDirect3DDevice9::SetTexture(it->first, pActualRightTexture);
-
-				if (result != D3D_OK)
-					OutputDebugString("Error trying to set one of the textures while switching between active eyes for drawing.\n");
-			}
-			// else the texture is mono and doesn't need changing. It will always be set initially and then won't need changing
+		if (stereoSlots & 1) {
+			if (side == vireio::Left) 
+				result = BaseDirect3DDevice9::SetTexture(SlotToTextureStage(slot), m_stereoTextureStages.GetLeft(slot)); 
+			else 
+				result = BaseDirect3DDevice9::SetTexture(SlotToTextureStage(slot), m_stereoTextureStages.GetRight(slot));
+
+			if (result != D3D_OK)
+				OutputDebugString("Error trying to set one of the textures while switching between active eyes for drawing.\n");
 		}
 	}
 
@@ -3418,6 +3654,86 @@ bool D3DProxyDevice::switchDrawingSide()
 	return switched;
 }
 
+/**
+* Replays the deferred draws for the other side.
+* Switches the drawing side once and replays the stereo batch through the proxy setters and draws, so
+* the eye dependent state is patched for the other side. A batch without draws is just cleared, its
+* state is set already. Called before any call the batch can't record.
+* @see m_stereoBatch
+***/
+void D3DProxyDevice::FlushStereoBatch()
+{
+	if (m_stereoBatch.IsEmpty() || m_stereoBatch.IsReplaying())
+		return;
+
+	if (m_stereoBatch.GetDrawCount()) {
+		m_stereoBatch.BeginReplay();
+		if (switchDrawingSide())
+			m_stereoBatch.Replay(this);
+		m_stereoBatch.EndReplay();
+	}
+	else
+		m_stereoBatch.Clear();
+}
+
+/**
+* True if the stereo batch records the bound state calls, flushes the batch if not.
+* Records in geometry mode with the stereo batch option set, not while replaying or in a
+* Begin-End StateBlock pair.
+***/
+bool D3DProxyDevice::StereoBatchRecording()
+{
+	if (m_stereoBatch.IsReplaying())
+		return false;
+
+	if (config.stereo_batch && (m_3DReconstructionMode == Reconstruction_Type::GEOMETRY) && !m_pCapturingStateTo)
+		return true;
+
+	FlushStereoBatch();
+	return false;
+}
+
+/**
+* True if a draw is recorded to the stereo batch, the primary render target needs to be stereo.
+***/
+bool D3DProxyDevice::StereoBatchDraw()
+{
+	return StereoBatchRecording() && m_activeRenderTargets[0] && m_activeRenderTargets[0]->IsStereo();
+}
+
+/**
+* Records a render, sampler or texture stage state to the stereo batch, flushes the batch if
+* the state is not shadowed.
+* @param index Render state shadow index. @see RenderStateShadow
+***/
+void D3DProxyDevice::StereoBatchState(UINT index, DWORD Value)
+{
+	if (m_stereoBatch.NeedsInitialState(index))
+		m_stereoBatch.RecordInitialState(index, m_renderStateShadow.Fetch(getActual(), index));
+
+	if (!m_stereoBatch.RecordState(index, Value))
+		FlushStereoBatch();
+}
+
+/**
+* Records the stream source a stereo batch starts with, if the stream is not yet touched.
+* Offset and stride are not stored by the proxy, these are read from the actual device.
+***/
+void D3DProxyDevice::StereoBatchInitialStream(UINT StreamNumber)
+{
+	if (!m_stereoBatch.NeedsInitialStream(StreamNumber))
+		return;
+
+	IDirect3DVertexBuffer9* pActualStreamData = NULL;
+	UINT offsetInBytes = 0;
+	UINT stride = 0;
+	getActual()->GetStreamSource(StreamNumber, &pActualStreamData, &offsetInBytes, &stride);
+	if (pActualStreamData)
+		pActualStreamData->Release();
+
+	m_stereoBatch.RecordInitialStream(StreamNumber, m_activeVertexBuffers.Get(StreamNumber), offsetInBytes, stride);
+}
+
 /**
 * Changes the HUD scale mode - also changes new scale in view adjustment class.
 ***/
@@ -3545,6 +3861,116 @@ float D3DProxyDevice::CalcFPS()
 }
 
 
+/**
+* Records the actual left and right textures of the selected texture stage slots.
+* Called when m_activeTextureStages got changed without SetTexture() (proxy StateBlock).
+* @param slots Bitmask of the slots to record.
+***/
+void D3DProxyDevice::RecordStereoTextures(uint32_t slots)
+{
+	for (UINT slot = 0; slots; slot++, slots >>= 1) {
+		if (!(slots & 1))
+			continue;
+
+		IDirect3DBaseTexture9* pActualLeftTexture = NULL;
+		IDirect3DBaseTexture9* pActualRightTexture = NULL;
+		IDirect3DBaseTexture9* pTexture = m_activeTextureStages.Get(slot);
+		if (pTexture)
+			UnWrapBoundTexture(pTexture, &pActualLeftTexture, &pActualRightTexture);
+
+		m_stereoTextureStages.Record(slot, pActualLeftTexture, pActualRightTexture);
+	}
+}
+
+/**
+* Unwraps a texture to be bound : textures with the same content on both sides bind their left texture for both sides.
+* @see D3D9ProxyTexture::IsStereoDivergent()
+* @see vireio::UnWrapTexture()
+***/
+void D3DProxyDevice::UnWrapBoundTexture(IDirect3DBaseTexture9* pTexture, IDirect3DBaseTexture9** ppActualLeftTexture, IDirect3DBaseTexture9** ppActualRightTexture)
+{
+	if (pTexture->GetType() == D3DRTYPE_TEXTURE) {
+		D3D9ProxyTexture* pDerivedTexture = static_cast<D3D9ProxyTexture*>(pTexture);
+		if (!pDerivedTexture->IsStereoDivergent()) {
+			*ppActualLeftTexture = pDerivedTexture->getActualLeft();
+			*ppActualRightTexture = NULL;
+			return;
+		}
+	}
+
+	vireio::UnWrapTexture(pTexture, ppActualLeftTexture, ppActualRightTexture);
+}
+
+/**
+* Queues a texture with unlocked levels for the upload.
+* Called by the texture on its first unlock after an upload.
+* @see UploadLockedTextures()
+***/
+void D3DProxyDevice::QueueLockedTextureUpload(D3D9ProxyTexture* pTexture)
+{
+	std::lock_guard<std::mutex> lck (m_lockedTextureUploadsMutex);
+	m_lockedTextureUploads.push_back(pTexture);
+	m_bLockedTextureUploads = true;
+}
+
+/**
+* Removes a texture from the upload queue, called when the texture is destroyed.
+***/
+void D3DProxyDevice::CancelLockedTextureUpload(D3D9ProxyTexture* pTexture)
+{
+	std::lock_guard<std::mutex> lck (m_lockedTextureUploadsMutex);
+	m_lockedTextureUploads.erase(std::remove(m_lockedTextureUploads.begin(), m_lockedTextureUploads.end(), pTexture), m_lockedTextureUploads.end());
+	m_bLockedTextureUploads = !m_lockedTextureUploads.empty();
+}
+
+/**
+* Uploads the unlocked levels of all queued textures, all levels of a texture in one pass.
+* Called before anything can read the textures (draw calls, copies) and on Present. Rectangles
+* locked several times between two draw calls (or on several levels) are uploaded once.
+* @see D3D9ProxyTexture::UploadLockedLevels()
+***/
+void D3DProxyDevice::UploadLockedTextures()
+{
+	if (!m_bLockedTextureUploads)
+		return;
+
+	std::lock_guard<std::mutex> lck (m_lockedTextureUploadsMutex);
+	size_t kept = 0;
+	for (size_t i = 0; i < m_lockedTextureUploads.size(); i++) {
+		// textures with levels still locked stay queued
+		if (m_lockedTextureUploads[i]->UploadLockedLevels())
+			m_lockedTextureUploads[kept++] = m_lockedTextureUploads[i];
+	}
+	m_lockedTextureUploads.resize(kept);
+	m_bLockedTextureUploads = (kept > 0);
+}
+
+/**
+* Binds the right texture of a texture whose sides may differ from now on, wherever that texture is bound.
+* @see D3D9ProxyTexture::MarkStereoDivergent()
+***/
+void D3DProxyDevice::StereoTextureDiverged(D3D9ProxyTexture* pTexture)
+{
+	uint32_t slots = 0;
+	uint32_t bound = m_activeTextureStages.GetBoundMask();
+	for (UINT slot = 0; bound; slot++, bound >>= 1) {
+		if ((bound & 1) && (m_activeTextureStages.Get(slot) == static_cast<IDirect3DBaseTexture9*>(pTexture)))
+			slots |= (1u << slot);
+	}
+	if (!slots)
+		return;
+
+	RecordStereoTextures(slots);
+
+	// the left texture is bound for both sides so far, switch if drawing the right side
+	if (m_currentRenderingSide == vireio::Right) {
+		for (UINT slot = 0; slots; slot++, slots >>= 1) {
+			if (slots & 1)
+				BaseDirect3DDevice9::SetTexture(SlotToTextureStage(slot), m_stereoTextureStages.GetRight(slot));
+		}
+	}
+}
+
 /**
 * Releases HUD font, shader registers, render targets, texture stages, vertex buffers, depth stencils, indices, shaders, declarations.
 ***/
@@ -3577,6 +4003,9 @@ void D3DProxyDevice::ReleaseEverything()
 		hudTextBox = NULL;
 	}
 
+	// the batch holds interfaces as well
+	m_stereoBatch.Clear();
+
 	m_spManagedShaderRegisters->ReleaseResources();
 
 	if (m_pCapturingStateTo) {
@@ -3594,22 +4023,9 @@ void D3DProxyDevice::ReleaseEverything()
 	} 
 
 
-	auto it = m_activeTextureStages.begin();
-	while (it != m_activeTextureStages.end()) {
-		if (it->second)
-			it->second->Release();
-
-		it = m_activeTextureStages.erase(it);
-	}
-
-
-	auto itVB = m_activeVertexBuffers.begin();
-	while (itVB != m_activeVertexBuffers.end()) {
-		if (itVB->second)
-			itVB->second->Release();
-
-		itVB = m_activeVertexBuffers.erase(itVB);
-	}
+	m_activeTextureStages.UnbindAll();
+	m_stereoTextureStages.Clear();
+	m_activeVertexBuffers.UnbindAll();
 
 
 
@@ -3785,7 +4201,7 @@ void D3DProxyDevice::SetGUIViewport()
 
 	// set viewport
 	m_bViewportIsSquished = true;
-	BaseDirect3DDevice9::SetViewport(&m_ViewportIfSquished);
+	getActual()->SetViewport(&m_ViewportIfSquished);
 }
 
 /**
@@ -54,6 +54,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "Direct3DVertexShader9.h"
 #include "Direct3DVertexDeclaration9.h"
 #include "Direct3DQuery9.h"
+#include "BindingSlots.h"
+#include "RenderStateShadow.h"
+#include "StereoBatch.h"
 
 #include "ProxyHelper.h"
 #include "StereoView.h"
@@ -68,10 +71,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <memory>
 #include <ctime>
 #include <mutex>
+#include <atomic>
 #include <functional>
 #include "Vireio.h"
 #include "VireioUtil.h"
-#include "StereoShaderConstant.h"
+#include "StereoConstantSet.h"
 #include "StereoBackBuffer.h"
 #include "GameHandler.h"
 #include "ShaderRegisters.h"
@@ -98,6 +102,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 class StereoView;
 class D3D9ProxySwapChain;
+class D3D9ProxyTexture;
 class ShaderRegisters;
 class GameHandler;
 struct HMDisplayInfo;
@@ -205,11 +210,14 @@ public:
 	virtual HRESULT WINAPI SetTransform(D3DTRANSFORMSTATETYPE State,CONST D3DMATRIX* pMatrix);
 	virtual HRESULT WINAPI MultiplyTransform(D3DTRANSFORMSTATETYPE State,CONST D3DMATRIX* pMatrix);
 	virtual HRESULT WINAPI SetViewport(CONST D3DVIEWPORT9* pViewport);
+	virtual HRESULT WINAPI SetRenderState(D3DRENDERSTATETYPE State,DWORD Value);
 	virtual HRESULT WINAPI CreateStateBlock(D3DSTATEBLOCKTYPE Type,IDirect3DStateBlock9** ppSB);
 	virtual HRESULT WINAPI BeginStateBlock();
 	virtual HRESULT WINAPI EndStateBlock(IDirect3DStateBlock9** ppSB);
 	virtual HRESULT WINAPI GetTexture(DWORD Stage,IDirect3DBaseTexture9** ppTexture);	
 	virtual HRESULT WINAPI SetTexture(DWORD Stage,IDirect3DBaseTexture9* pTexture);
+	virtual HRESULT WINAPI SetTextureStageState(DWORD Stage,D3DTEXTURESTAGESTATETYPE Type,DWORD Value);
+	virtual HRESULT WINAPI SetSamplerState(DWORD Sampler,D3DSAMPLERSTATETYPE Type,DWORD Value);
 	virtual HRESULT WINAPI DrawPrimitive(D3DPRIMITIVETYPE PrimitiveType,UINT StartVertex,UINT PrimitiveCount);
 	virtual HRESULT WINAPI DrawIndexedPrimitive(D3DPRIMITIVETYPE PrimitiveType,INT BaseVertexIndex,UINT MinVertexIndex,UINT NumVertices,UINT startIndex,UINT primCount);
 	virtual HRESULT WINAPI DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType,UINT PrimitiveCount,CONST void* pVertexStreamZeroData,UINT VertexStreamZeroStride);
@@ -247,6 +255,12 @@ public:
 	void HotkeyCooldown(float duration);
 	bool HotkeysActive();
 
+	void QueueLockedTextureUpload(D3D9ProxyTexture* pTexture);
+	void CancelLockedTextureUpload(D3D9ProxyTexture* pTexture);
+	void UploadLockedTextures();
+	void StereoTextureDiverged(D3D9ProxyTexture* pTexture);
+	virtual void FlushStereoBatch();
+
 	double getLastFrameTime(){	return m_lastFrameTime; }
 
 	/**
@@ -701,10 +715,16 @@ protected:
 private:
 	/*** D3DProxyDevice private methods ***/
 	void    ReleaseEverything();
+	void    RecordStereoTextures(uint32_t slots);
+	void    UnWrapBoundTexture(IDirect3DBaseTexture9* pTexture, IDirect3DBaseTexture9** ppActualLeftTexture, IDirect3DBaseTexture9** ppActualRightTexture);
 	bool    isViewportDefaultForMainRT(CONST D3DVIEWPORT9* pViewport);
 	HRESULT SetStereoViewTransform(D3DXMATRIX pLeftMatrix, D3DXMATRIX pRightMatrix, bool apply);
 	HRESULT SetStereoProjectionTransform(D3DXMATRIX pLeftMatrix, D3DXMATRIX pRightMatrix, bool apply);
 	void    SetGUIViewport();
+	bool    StereoBatchRecording();
+	bool    StereoBatchDraw();
+	void    StereoBatchState(UINT index, DWORD Value);
+	void    StereoBatchInitialStream(UINT StreamNumber);
 	float   RoundVireioValue(float val);
 	bool	InitVRBoost();
 	bool	InitTracker();
@@ -868,18 +888,56 @@ private:
 	***/
 	std::vector<D3D9ProxySurface*> m_activeRenderTargets;	
 	/**
-	* Textures assigned to stages. 
-	* (NULL is a valid entry in these containers. It indicates that the application has specifically 
+	* Textures assigned to stages, indexed by dense sampler slot.
+	* (NULL is a valid binding in these containers. It indicates that the application has specifically 
 	* cleared that stream/sampler. It is important that this information is available to the proxy 
 	* StateBlock)
+	* @see TextureStageToSlot()
 	* @see SetTexture()
 	* @see GetTexture()
 	**/
-	std::unordered_map<DWORD, IDirect3DBaseTexture9*> m_activeTextureStages;
+	BindingSlots<IDirect3DBaseTexture9, BINDING_TEXTURE_SLOTS> m_activeTextureStages;
+	/**
+	* Actual left and right textures of the stereo textures in m_activeTextureStages.
+	* @see RecordStereoTextures()
+	* @see setDrawingSide()
+	**/
+	StereoBindingSlots<IDirect3DBaseTexture9, BINDING_TEXTURE_SLOTS> m_stereoTextureStages;
+	/**
+	* Textures with unlocked levels waiting for the upload to the actual textures.
+	* Uploaded before anything can read them (draw calls, copies) and at the end of the frame.
+	* @see UploadLockedTextures()
+	**/
+	std::vector<D3D9ProxyTexture*> m_lockedTextureUploads;
+	/**
+	* Guards m_lockedTextureUploads, textures may be unlocked on other threads.
+	**/
+	std::mutex m_lockedTextureUploadsMutex;
+	/**
+	* True if m_lockedTextureUploads is not empty, checked without locking by every draw call.
+	**/
+	std::atomic<bool> m_bLockedTextureUploads;
+	/**
+	* Active stored vertex buffers, indexed by stream number.
+	**/
+	BindingSlots<BaseDirect3DVertexBuffer9, BINDING_VERTEX_STREAMS> m_activeVertexBuffers;
+	/**
+	* Shadow copy of the render, sampler and texture stage states set by the game.
+	* Read by the stereo view to save the game states on Present without device round trips.
+	* States set behind the proxy (applied state blocks, device reset) are forgotten and
+	* fetched from the actual device on next read.
+	* @see SetRenderState()
+	* @see StereoView::SetRenderStateShadow()
+	**/
+	RenderStateShadow m_renderStateShadow;
 	/**
-	* Active stored vertex buffers.
+	* Draws of the current side deferred for the other side, with the bound state calls in between.
+	* Replayed after a single drawing side switch before any other call. Only used with the
+	* stereo batch option in geometry mode.
+	* @see FlushStereoBatch()
+	* @see StereoBatch
 	**/
-	std::unordered_map<UINT, BaseDirect3DVertexBuffer9*> m_activeVertexBuffers;
+	StereoBatch m_stereoBatch;
 	/**
 	* True if BeginStateBlock() is called, false if EndStateBlock is called.
 	* @see BeginStateBlock()
@@ -37,50 +37,6 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 using namespace vireio;
 
-/**
-* Simple helper to get the hash of a shader.
-* @param pShader The input vertex shader.
-* @return The hash code of the shader.
-***/
-uint32_t ShaderHash(LPDIRECT3DVERTEXSHADER9 pShader)
-{
-	if (!pShader) return 0;
-
-	BYTE* pData = NULL;
-	UINT pSizeOfData;
-	pShader->GetFunction(NULL, &pSizeOfData);
-
-	pData = new BYTE[pSizeOfData];
-	pShader->GetFunction(pData, &pSizeOfData);
-
-	uint32_t hash = 0;
-	MurmurHash3_x86_32(pData, pSizeOfData, VIREIO_SEED, &hash);
-	delete[] pData;
-	return hash;
-}
-
-/**
-* Simple helper to get the hash of a shader.
-* @param pShader The input vertex shader.
-* @return The hash code of the shader.
-***/
-uint32_t ShaderHash(LPDIRECT3DPIXELSHADER9 pShader)
-{
-	if (!pShader) return 0;
-
-	BYTE* pData = NULL;
-	UINT pSizeOfData;
-	pShader->GetFunction(NULL, &pSizeOfData);
-
-	pData = new BYTE[pSizeOfData];
-	pShader->GetFunction(pData, &pSizeOfData);
-
-	uint32_t hash = 0;
-	MurmurHash3_x86_32(pData, pSizeOfData, VIREIO_SEED, &hash);
-	delete[] pData;
-	return hash;
-}
-
 /**
 * Constructor, opens the dump file.
 * @param pDevice Imbed actual device.
@@ -92,8 +48,6 @@ DataGatherer::DataGatherer(IDirect3DDevice9* pDevice, BaseDirect3D9* pCreatedBy)
 	m_recordedSetVShaders(),
 	m_activeVShaders(),
 	m_activePShaders(),
-	m_activeVShadersLastFrame(),
-	m_activePShadersLastFrame(),
 	m_excludedVShaders(),
 	m_excludedPShaders(),
 	m_bAvoidDraw(false),
@@ -249,13 +203,9 @@ HRESULT WINAPI DataGatherer::Present(CONST RECT* pSourceRect,CONST RECT* pDestRe
 HRESULT WINAPI DataGatherer::BeginScene()
 {
 	if (m_isFirstBeginSceneOfFrame) {
-		// create last frame active shader vectors, delete current frame ones
-		m_activeVShadersLastFrame.clear();
-		m_activePShadersLastFrame.clear();
-		m_activeVShadersLastFrame = m_activeVShaders;
-		m_activePShadersLastFrame = m_activePShaders;
-		m_activeVShaders.clear();
-		m_activePShaders.clear();
+		// current frame active shaders become last frame ones
+		m_activeVShaders.NextFrame();
+		m_activePShaders.NextFrame();
 	}
 
 	return D3DProxyDevice::BeginScene();
@@ -315,31 +265,31 @@ HRESULT WINAPI DataGatherer::CreateVertexShader(CONST DWORD* pFunction,IDirect3D
 	HRESULT creationResult = D3DProxyDevice::CreateVertexShader(pFunction, ppShader);
 
 	if (SUCCEEDED(creationResult)) {
-		BaseDirect3DVertexShader9* pWrappedShader = static_cast<BaseDirect3DVertexShader9*>(*ppShader);
+		D3D9ProxyVertexShader* pWrappedShader = static_cast<D3D9ProxyVertexShader*>(*ppShader);
 		IDirect3DVertexShader9* pActualShader = pWrappedShader->getActual();
 
-		// insertion succeeded - record shader details.
-		LPD3DXCONSTANTTABLE pConstantTable = NULL;
-
-		BYTE* pData = NULL;
-		UINT pSizeOfData;
-		pActualShader->GetFunction(NULL, &pSizeOfData);
-
-		pData = new BYTE[pSizeOfData];					
-		HRESULT _hr = pActualShader->GetFunction(pData, &pSizeOfData);
-		if(_hr == D3DERR_INVALIDCALL)
-		{
-			OutputDebugString("DATAGATHERER :: Invalid Call to IDirect3DVertexShader9->getFunction()");	
-		}
-			
-		uint32_t hash = 0;
-		MurmurHash3_x86_32(pData, pSizeOfData, VIREIO_SEED, &hash); 
+		// the proxy shader hashed its function on creation
+		uint32_t hash = pWrappedShader->GetShaderHash();
 		if (m_recordedVShaders.find(hash) == m_recordedVShaders.end() && 
 			m_shaderDumpFile.is_open())
 		{
 			//This doesn't keep a ref count, doesn't need to, it isn't used
 			m_recordedVShaders[hash] = *ppShader;
 
+			// insertion succeeded - record shader details.
+			LPD3DXCONSTANTTABLE pConstantTable = NULL;
+
+			BYTE* pData = NULL;
+			UINT pSizeOfData;
+			pActualShader->GetFunction(NULL, &pSizeOfData);
+
+			pData = new BYTE[pSizeOfData];					
+			HRESULT _hr = pActualShader->GetFunction(pData, &pSizeOfData);
+			if(_hr == D3DERR_INVALIDCALL)
+			{
+				OutputDebugString("DATAGATHERER :: Invalid Call to IDirect3DVertexShader9->getFunction()");	
+			}
+
 			_hr = D3DXGetShaderConstantTable(reinterpret_cast<DWORD*>(pData), &pConstantTable);
 			if(_hr == D3DERR_INVALIDCALL)
 				OutputDebugString("DATAGATHERER :: Invalid Call to D3DXGetShaderConstantTable");	
@@ -429,10 +379,9 @@ HRESULT WINAPI DataGatherer::CreateVertexShader(CONST DWORD* pFunction,IDirect3D
 			}
 
 			_SAFE_RELEASE(pConstantTable);
+			if (pData) delete[] pData;
 		}
 		// else shader already recorded
-
-		if (pData) delete[] pData;
 	}
 
 	return creationResult;
@@ -446,15 +395,13 @@ HRESULT WINAPI DataGatherer::SetVertexShader(IDirect3DVertexShader9* pShader)
 	// set the current vertex shader hash code for the call counter
 	if (pShader)
 	{
-		m_currentVertexShaderHash = ShaderHash(pShader);
+		m_currentVertexShaderHash = static_cast<D3D9ProxyVertexShader*>(pShader)->GetShaderHash();
 
-		// add to vector of active shaders if not present
-		if (m_activeVShaders.find(m_currentVertexShaderHash) == m_activeVShaders.end()) {
-			m_activeVShaders[m_currentVertexShaderHash] = pShader;
-		}
+		// stamp shader active for this frame
+		m_activeVShaders.SetActive(m_currentVertexShaderHash);
 
-		// avoid draw if shader present in excluded vector
-		if (std::find(m_excludedVShaders.begin(), m_excludedVShaders.end(), m_currentVertexShaderHash) == m_excludedVShaders.end()) {
+		// avoid draw if shader present in excluded set
+		if (m_excludedVShaders.count(m_currentVertexShaderHash) == 0) {
 			m_bAvoidDraw = false;
 		}
 		else
@@ -556,27 +503,27 @@ HRESULT WINAPI DataGatherer::CreatePixelShader(CONST DWORD* pFunction,IDirect3DP
 	HRESULT creationResult = D3DProxyDevice::CreatePixelShader(pFunction, ppShader);
 
 	if (SUCCEEDED(creationResult)) {
-		BaseDirect3DPixelShader9* pWrappedShader = static_cast<BaseDirect3DPixelShader9*>(*ppShader);
+		D3D9ProxyPixelShader* pWrappedShader = static_cast<D3D9ProxyPixelShader*>(*ppShader);
 		IDirect3DPixelShader9* pActualShader = pWrappedShader->getActual();
 
-		// insertion succeeded - record shader details.
-		LPD3DXCONSTANTTABLE pConstantTable = NULL;
-
-		BYTE* pData = NULL;
-		UINT pSizeOfData;
-		pActualShader->GetFunction(NULL, &pSizeOfData);
-
-		pData = new BYTE[pSizeOfData];
-		pActualShader->GetFunction(pData, &pSizeOfData);
-
-		uint32_t hash = 0;
-		MurmurHash3_x86_32(pData, pSizeOfData, VIREIO_SEED, &hash); 
+		// the proxy shader hashed its function on creation
+		uint32_t hash = pWrappedShader->GetShaderHash();
 		if (m_recordedPShaders.find(hash) == m_recordedPShaders.end() && 
 			m_shaderDumpFile.is_open())
 		{
 			//This doesn't keep a ref count (no need, it basically isn't used)
 			m_recordedPShaders[hash] = *ppShader;
 
+			// insertion succeeded - record shader details.
+			LPD3DXCONSTANTTABLE pConstantTable = NULL;
+
+			BYTE* pData = NULL;
+			UINT pSizeOfData;
+			pActualShader->GetFunction(NULL, &pSizeOfData);
+
+			pData = new BYTE[pSizeOfData];
+			pActualShader->GetFunction(pData, &pSizeOfData);
+
 			D3DXGetShaderConstantTable(reinterpret_cast<DWORD*>(pData), &pConstantTable);
 
 			D3DXCONSTANTTABLE_DESC pDesc;
@@ -661,10 +608,9 @@ HRESULT WINAPI DataGatherer::CreatePixelShader(CONST DWORD* pFunction,IDirect3DP
 			}
 
 			_SAFE_RELEASE(pConstantTable);
+			if (pData) delete[] pData;
 		}
 		// else shader already recorded
-
-		if (pData) delete[] pData;
 	}
 
 	return creationResult;
@@ -678,15 +624,13 @@ HRESULT WINAPI DataGatherer::SetPixelShader(IDirect3DPixelShader9* pShader)
 	uint32_t currentPixelShaderHash = 0;
 	if (pShader)
 	{
-		currentPixelShaderHash = ShaderHash(pShader);
+		currentPixelShaderHash = static_cast<D3D9ProxyPixelShader*>(pShader)->GetShaderHash();
 
-		// add to vector of active shaders if not present
-		if (m_activePShaders.find(currentPixelShaderHash) == m_activePShaders.end()) {
-			m_activePShaders[currentPixelShaderHash] = pShader;
-		}
+		// stamp shader active for this frame
+		m_activePShaders.SetActive(currentPixelShaderHash);
 
-		// avoid draw if shader present in excluded vector
-		if (std::find(m_excludedPShaders.begin(), m_excludedPShaders.end(), currentPixelShaderHash) == m_excludedPShaders.end()) {
+		// avoid draw if shader present in excluded set
+		if (m_excludedPShaders.count(currentPixelShaderHash) == 0) {
 			m_bAvoidDrawPS = false;
 		}
 		else
@@ -973,14 +917,12 @@ void DataGatherer::VPMENU_ChangeRules()
 						// show blinking if shader is drawn
 						if (m_relevantVSConstantNames[menuID[i]].nodeOpen)
 						{
-							if (std::find(m_excludedVShaders.begin(), m_excludedVShaders.end(), itShaderConstants->hash) == m_excludedVShaders.end()) {
-								m_excludedVShaders.push_back(itShaderConstants->hash);
-							}
+							m_excludedVShaders.insert(itShaderConstants->hash);
 						}
 						else
 						{
-							// erase all entries for that hash
-							m_excludedVShaders.erase(std::remove(m_excludedVShaders.begin(), m_excludedVShaders.end(), itShaderConstants->hash), m_excludedVShaders.end()); 
+							// erase the entry for that hash
+							m_excludedVShaders.erase(itShaderConstants->hash);
 						}
 					}
 				}
@@ -1070,7 +1012,7 @@ void DataGatherer::VPMENU_PickRules()
 void DataGatherer::VPMENU_ShowActiveShaders()
 {
 	//Don't do anything if it is an empty collection
-	if (m_activePShaders.size() == 0)
+	if (m_activePShaders.GetActiveCount() == 0)
 		return;
 
 	UINT menuEntryCount = 2;
@@ -1081,7 +1023,7 @@ void DataGatherer::VPMENU_ShowActiveShaders()
 
 	//Local copy of known shaders, the main collection is too big
 	if (m_knownVShaders.size() == 0)
-		m_knownVShaders = m_activeVShaders;
+		m_activeVShaders.AddActiveToIndex(m_knownVShaders);
 
 	// loop through relevant vertex shaders
 	for(auto itVShaderHash = m_knownVShaders.begin();
@@ -1091,43 +1033,37 @@ void DataGatherer::VPMENU_ShowActiveShaders()
 		bool excluded = false;
 		bool visible = true;
 		// show colored if shader is drawn
-		if (std::find(m_excludedVShaders.begin(), m_excludedVShaders.end(), itVShaderHash->first) != m_excludedVShaders.end()) {
+		if (m_excludedVShaders.count(*itVShaderHash) != 0) {
 			excluded = true;
 		}
 
-		if (m_activeVShaders.find(itVShaderHash->first) == m_activeVShaders.end())
+		if (!m_activeVShaders.IsActive(*itVShaderHash))
 			visible = false;
 
-		menuID.push_back(itVShaderHash->first);
+		menuID.push_back(*itVShaderHash);
 
 		if (!visible)
 		{
 			menuColor.push_back(COLOR_MENU_DISABLED);
-			menuEntries.push_back(retprintf("VS : (%u)", itVShaderHash->first));
+			menuEntries.push_back(retprintf("VS : (%u)", *itVShaderHash));
 		}
 		else
 		{
 			menuColor.push_back(excluded ? COLOR_MENU_TEXT : COLOR_MENU_ENABLED);
-			menuEntries.push_back(retprintf("VS : %u", itVShaderHash->first));
+			menuEntries.push_back(retprintf("VS : %u", *itVShaderHash));
 		}
 
 		menuEntryCount++;
 	}
 
 	// for next time, add in any we don;t know yet
-	for(auto itVShaderCurrentHash = m_activeVShaders.begin();
-	    itVShaderCurrentHash != m_activeVShaders.end();
-	    itVShaderCurrentHash++)
-	{
-		if (m_knownVShaders.find(itVShaderCurrentHash->first) == m_knownVShaders.end())
-			m_knownVShaders[itVShaderCurrentHash->first] = itVShaderCurrentHash->second;
-	}
+	m_activeVShaders.AddActiveToIndex(m_knownVShaders);
 
 	UINT endOfVertexShaderEntries = menuEntryCount-2;
 	
 	//Local copy of known shaders, the main collection is too big
 	if (m_knownPShaders.size() == 0)
-		m_knownPShaders = m_activePShaders;
+		m_activePShaders.AddActiveToIndex(m_knownPShaders);
 
 	// loop through relevant pixel shaders
 	for(auto itPShaderHash = m_knownPShaders.begin();
@@ -1137,36 +1073,30 @@ void DataGatherer::VPMENU_ShowActiveShaders()
 		bool excluded = false;
 		bool visible = true;
 		// show colored if shader is drawn
-		if (std::find(m_excludedPShaders.begin(), m_excludedPShaders.end(), itPShaderHash->first) != m_excludedPShaders.end()) {
+		if (m_excludedPShaders.count(*itPShaderHash) != 0) {
 			excluded = true;
 		}
-		if (m_activePShaders.find(itPShaderHash->first) == m_activePShaders.end())
+		if (!m_activePShaders.IsActive(*itPShaderHash))
 			visible = false;
 
-		menuID.push_back(itPShaderHash->first);
+		menuID.push_back(*itPShaderHash);
 
 		if (!visible)
 		{
 			menuColor.push_back(COLOR_MENU_DISABLED);
-			menuEntries.push_back(retprintf("PS : (%u)", itPShaderHash->first));
+			menuEntries.push_back(retprintf("PS : (%u)", *itPShaderHash));
 		}
 		else
 		{
 			menuColor.push_back(excluded ? COLOR_MENU_TEXT : COLOR_MENU_ENABLED);
-			menuEntries.push_back(retprintf("PS : %u", itPShaderHash->first));
+			menuEntries.push_back(retprintf("PS : %u", *itPShaderHash));
 		}
 
 		menuEntryCount++;
 	}
 	
 	// for next time, add in any we don;t know yet
-	for(auto itPShaderCurrentHash = m_activePShaders.begin();
-	    itPShaderCurrentHash != m_activePShaders.end();
-	    itPShaderCurrentHash++)
-	{
-		if (m_knownPShaders.find(itPShaderCurrentHash->first) == m_knownPShaders.end())
-			m_knownPShaders[itPShaderCurrentHash->first] = itPShaderCurrentHash->second;
-	}
+	m_activePShaders.AddActiveToIndex(m_knownPShaders);
 
 	MenuBuilder *menu = VPMENU_NewFrame();
 
@@ -1180,25 +1110,19 @@ void DataGatherer::VPMENU_ShowActiveShaders()
 			if (i < endOfVertexShaderEntries)
 			{
 				// show colored if shader is drawn
-				if (std::find(m_excludedVShaders.begin(), m_excludedVShaders.end(), menuID[i]) == m_excludedVShaders.end()) {
-					m_excludedVShaders.push_back(menuID[i]);
-				}
-				else
+				if (!m_excludedVShaders.insert(menuID[i]).second)
 				{
-					// erase all entries for that hash
-					m_excludedVShaders.erase(std::remove(m_excludedVShaders.begin(), m_excludedVShaders.end(), menuID[i]), m_excludedVShaders.end()); 
+					// already excluded, erase the entry for that hash
+					m_excludedVShaders.erase(menuID[i]);
 				}
 			}
 			else
 			{
 				// show colored if shader is drawn
-				if (std::find(m_excludedPShaders.begin(), m_excludedPShaders.end(), menuID[i]) == m_excludedPShaders.end()) {
-					m_excludedPShaders.push_back(menuID[i]);
-				}
-				else
+				if (!m_excludedPShaders.insert(menuID[i]).second)
 				{
-					// erase all entries for that hash
-					m_excludedPShaders.erase(std::remove(m_excludedPShaders.begin(), m_excludedPShaders.end(), menuID[i]), m_excludedPShaders.end()); 
+					// already excluded, erase the entry for that hash
+					m_excludedPShaders.erase(menuID[i]);
 				}
 			}
 		});
@@ -35,6 +35,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "ProxyHelper.h"
 #include "MurmurHash3.h"
 #include "Direct3DVertexShader9.h"
+#include "ActiveShaderTracker.h"
+#include <unordered_set>
 
 /**
 * Data gatherer class, outputs relevant shader data to dump file (.csv format) .
@@ -120,31 +122,25 @@ private:
 	***/
 	std::vector<ShaderConstant> m_relevantVSConstantNames;
 	/**
-	* Map of all active vertex shader hash codes.
+	* Active vertex shader hash codes, current and last frame.
+	* @see ActiveShaderTracker
 	***/
-	std::map<uint32_t, IDirect3DVertexShader9*> m_activeVShaders;
+	ActiveShaderTracker m_activeVShaders;
 	/**
-	* Map of all active pixel shader hash codes.
+	* Active pixel shader hash codes, current and last frame.
+	* @see ActiveShaderTracker
 	***/
-	std::map<uint32_t, IDirect3DPixelShader9*> m_activePShaders;
+	ActiveShaderTracker m_activePShaders;
 	/**
-	* Map of all active vertex shader hash codes (last frame).
-	***/
-	std::map<uint32_t, IDirect3DVertexShader9*> m_activeVShadersLastFrame;
-	/**
-	* Map of all active pixel shader hash codes (last frame).
-	***/
-	std::map<uint32_t, IDirect3DPixelShader9*> m_activePShadersLastFrame;
-	/**
-	* Vector of all excluded vertex shader hash codes.
+	* Set of all excluded vertex shader hash codes.
 	* Vertex shaders are excluded from being drawn.
 	***/
-	std::vector<uint32_t> m_excludedVShaders;
+	std::unordered_set<uint32_t> m_excludedVShaders;
 	/**
-	* Vector of all excluded pixel shader hash codes.
+	* Set of all excluded pixel shader hash codes.
 	* Pixel shaders are excluded from being drawn.
 	***/
-	std::vector<uint32_t> m_excludedPShaders;
+	std::unordered_set<uint32_t> m_excludedPShaders;
 	/**
 	* True if Draw() calls should be skipped currently.
 	***/
@@ -178,13 +174,14 @@ private:
 	***/
 	std::map<uint32_t, IDirect3DPixelShader9*> m_recordedPShaders;
 	/**
-	* Set of known vertex shaders for ShowActiveShaders
+	* Sorted index of known vertex shader hash codes for ShowActiveShaders.
+	* Only built while the menu is shown, the menu lists the shaders in this order.
 	***/
-	std::map<uint32_t, IDirect3DVertexShader9*> m_knownVShaders;
+	std::vector<uint32_t> m_knownVShaders;
 	/**
-	* Set of known pixel shaders for ShowActiveShaders.
+	* Sorted index of known pixel shader hash codes for ShowActiveShaders.
 	***/
-	std::map<uint32_t, IDirect3DPixelShader9*> m_knownPShaders;
+	std::vector<uint32_t> m_knownPShaders;
 	/**
 	* Set of recorded vertex shaders, to avoid double debug log output.
 	***/
@@ -111,6 +111,8 @@ HRESULT WINAPI BaseDirect3DDevice9::TestCooperativeLevel()
 	m_logFile << "TestCooperativeLevel" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->TestCooperativeLevel();
 }
 
@@ -123,6 +125,8 @@ UINT WINAPI BaseDirect3DDevice9::GetAvailableTextureMem()
 	m_logFile << "GetAvailableTextureMem" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetAvailableTextureMem();
 }
 
@@ -135,6 +139,8 @@ HRESULT WINAPI BaseDirect3DDevice9::EvictManagedResources()
 	m_logFile << "EvictManagedResources" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->EvictManagedResources();
 }
 
@@ -147,6 +153,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetDirect3D(IDirect3D9** ppD3D9)
 	m_logFile << "GetDirect3D" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	if (!m_pCreatedBy)
 		return D3DERR_INVALIDCALL;
 	else {
@@ -165,6 +173,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetDeviceCaps(D3DCAPS9* pCaps)
 	m_logFile << "GetDeviceCaps" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetDeviceCaps(pCaps);
 }
 
@@ -177,6 +187,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetDisplayMode(UINT iSwapChain,D3DDISPLAYMOD
 	m_logFile << "GetDisplayMode" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetDisplayMode(iSwapChain, pMode);
 }
 
@@ -189,6 +201,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetCreationParameters(D3DDEVICE_CREATION_PAR
 	m_logFile << "GetCreationParameters" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetCreationParameters(pParameters);
 }
 
@@ -201,6 +215,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetCursorProperties(UINT XHotSpot,UINT YHotS
 	m_logFile << "SetCursorProperties" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetCursorProperties(XHotSpot, YHotSpot, pCursorBitmap);
 }
 
@@ -213,6 +229,8 @@ void WINAPI BaseDirect3DDevice9::SetCursorPosition(int X,int Y,DWORD Flags)
 	m_logFile << "SetCursorPosition" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetCursorPosition(X, Y, Flags);
 }
 
@@ -225,6 +243,8 @@ BOOL WINAPI BaseDirect3DDevice9::ShowCursor(BOOL bShow)
 	m_logFile << "ShowCursor" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->ShowCursor(bShow);
 }
 
@@ -237,6 +257,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateAdditionalSwapChain(D3DPRESENT_PARAMET
 	m_logFile << "CreateAdditionalSwapChain" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->CreateAdditionalSwapChain(pPresentationParameters, pSwapChain);
 }
 
@@ -249,6 +271,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetSwapChain(UINT iSwapChain,IDirect3DSwapCh
 	m_logFile << "GetSwapChain" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetSwapChain(iSwapChain, pSwapChain);
 }
 
@@ -261,6 +285,8 @@ UINT WINAPI BaseDirect3DDevice9::GetNumberOfSwapChains()
 	m_logFile << "GetNumberOfSwapChains" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetNumberOfSwapChains();
 }
 
@@ -273,6 +299,8 @@ HRESULT WINAPI BaseDirect3DDevice9::Reset(D3DPRESENT_PARAMETERS* pPresentationPa
 	m_logFile << "Reset" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->Reset(pPresentationParameters);
 }
 
@@ -285,6 +313,8 @@ HRESULT WINAPI BaseDirect3DDevice9::Present(CONST RECT* pSourceRect,CONST RECT*
 	m_logFile << "Present" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->Present( pSourceRect, pDestRect, hDestWindowOverride, pDirtyRegion);
 }
 
@@ -297,6 +327,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetBackBuffer(UINT iSwapChain,UINT iBackBuff
 	m_logFile << "GetBackBuffer" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetBackBuffer(iSwapChain, iBackBuffer, Type, ppBackBuffer);
 }
 
@@ -309,6 +341,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetRasterStatus(UINT iSwapChain,D3DRASTER_ST
 	m_logFile << "GetRasterStatus" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetRasterStatus(iSwapChain, pRasterStatus);
 }
 
@@ -321,6 +355,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetDialogBoxMode(BOOL bEnableDialogs)
 	m_logFile << "SetDialogBoxMode" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetDialogBoxMode(bEnableDialogs);
 }
 
@@ -333,6 +369,8 @@ void WINAPI BaseDirect3DDevice9::SetGammaRamp(UINT iSwapChain,DWORD Flags,CONST
 	m_logFile << "SetGammaRamp" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetGammaRamp(iSwapChain, Flags, pRamp);
 }
 
@@ -345,6 +383,8 @@ void WINAPI BaseDirect3DDevice9::GetGammaRamp(UINT iSwapChain,D3DGAMMARAMP* pRam
 	m_logFile << "GetGammaRamp" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetGammaRamp(iSwapChain, pRamp);
 }
 
@@ -357,6 +397,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateTexture(UINT Width,UINT Height,UINT Le
 	m_logFile << "CreateTexture" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	HRESULT hr = m_pDevice->CreateTexture(Width, Height, Levels, Usage, Format, Pool, ppTexture, pSharedHandle);
 
 	if (FAILED(hr))
@@ -378,6 +420,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateVolumeTexture(UINT Width,UINT Height,U
 	m_logFile << "CreateVolumeTexture" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 
 	HRESULT hr = S_OK;
 	hr = m_pDevice->CreateVolumeTexture(Width, Height, Depth, Levels, Usage, Format, Pool, ppVolumeTexture, pSharedHandle);
@@ -401,6 +445,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateCubeTexture(UINT EdgeLength,UINT Level
 	m_logFile << "CreateCubeTexture" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	HRESULT hr = S_OK;
 	hr = m_pDevice->CreateCubeTexture(EdgeLength, Levels, Usage, Format, Pool, ppCubeTexture, pSharedHandle);
 	
@@ -423,6 +469,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateVertexBuffer(UINT Length,DWORD Usage,D
 	m_logFile << "CreateVertexBuffer" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 
 	HRESULT hr = S_OK;
 	hr = m_pDevice->CreateVertexBuffer(Length, Usage, FVF, Pool, ppVertexBuffer, pSharedHandle);
@@ -446,6 +494,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateIndexBuffer(UINT Length,DWORD Usage,D3
 	m_logFile << "CreateIndexBuffer" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 
 	HRESULT hr = S_OK;
 	hr = m_pDevice->CreateIndexBuffer(Length, Usage, Format, Pool, ppIndexBuffer, pSharedHandle);
@@ -469,6 +519,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateRenderTarget(UINT Width,UINT Height,D3
 	m_logFile << "CreateRenderTarget" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->CreateRenderTarget(Width, Height, Format, MultiSample, MultisampleQuality, Lockable, ppSurface, pSharedHandle);
 }
 
@@ -481,6 +533,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateDepthStencilSurface(UINT Width,UINT He
 	m_logFile << "CreateDepthStencilSurface" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->CreateDepthStencilSurface(Width, Height, Format, MultiSample, MultisampleQuality, Discard, ppSurface, pSharedHandle);
 }
 
@@ -493,6 +547,8 @@ HRESULT WINAPI BaseDirect3DDevice9::UpdateSurface(IDirect3DSurface9* pSourceSurf
 	m_logFile << "UpdateSurface" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->UpdateSurface(pSourceSurface, pSourceRect, pDestinationSurface, pDestPoint);
 }
 
@@ -505,6 +561,8 @@ HRESULT WINAPI BaseDirect3DDevice9::UpdateTexture(IDirect3DBaseTexture9* pSource
 	m_logFile << "UpdateTexture" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->UpdateTexture(pSourceTexture, pDestinationTexture);
 }
 
@@ -517,6 +575,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetRenderTargetData(IDirect3DSurface9* pRend
 	m_logFile << "GetRenderTargetData" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetRenderTargetData(pRenderTarget, pDestSurface);
 }
 
@@ -529,6 +589,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetFrontBufferData(UINT iSwapChain,IDirect3D
 	m_logFile << "GetFrontBufferData" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetFrontBufferData(iSwapChain, pDestSurface);
 }
 
@@ -541,6 +603,8 @@ HRESULT WINAPI BaseDirect3DDevice9::StretchRect(IDirect3DSurface9* pSourceSurfac
 	m_logFile << "StretchRect" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->StretchRect(pSourceSurface, pSourceRect, pDestSurface, pDestRect, Filter);
 }
 
@@ -553,6 +617,8 @@ HRESULT WINAPI BaseDirect3DDevice9::ColorFill(IDirect3DSurface9* pSurface,CONST
 	m_logFile << "ColorFill" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->ColorFill(pSurface, pRect, color);
 }
 
@@ -565,6 +631,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateOffscreenPlainSurface(UINT Width,UINT
 	m_logFile << "CreateOffscreenPlainSurface" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 
 	HRESULT hr = S_OK;
 	hr = m_pDevice->CreateOffscreenPlainSurface(Width, Height, Format, Pool, ppSurface, pSharedHandle);
@@ -588,6 +656,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetRenderTarget(DWORD RenderTargetIndex,IDir
 	m_logFile << "SetRenderTarget" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetRenderTarget(RenderTargetIndex, pRenderTarget);
 }
 
@@ -600,6 +670,7 @@ HRESULT WINAPI BaseDirect3DDevice9::GetRenderTarget(DWORD RenderTargetIndex,IDir
 	m_logFile << "GetRenderTarget" << std::endl;
 
 #endif
+	FlushStereoBatch();
 	return m_pDevice->GetRenderTarget(RenderTargetIndex, ppRenderTarget);
 }
 
@@ -612,6 +683,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetDepthStencilSurface(IDirect3DSurface9* pN
 	m_logFile << "SetDepthStencilSurface" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetDepthStencilSurface(pNewZStencil);
 }
 
@@ -624,6 +697,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetDepthStencilSurface(IDirect3DSurface9** p
 	m_logFile << "GetDepthStencilSurface" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetDepthStencilSurface(ppZStencilSurface);
 }
 
@@ -636,6 +711,8 @@ HRESULT WINAPI BaseDirect3DDevice9::BeginScene()
 	m_logFile << "BeginScene" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->BeginScene();
 }
 
@@ -648,6 +725,8 @@ HRESULT WINAPI BaseDirect3DDevice9::EndScene()
 	m_logFile << "EndScene" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->EndScene();
 }
 
@@ -660,6 +739,8 @@ HRESULT WINAPI BaseDirect3DDevice9::Clear(DWORD Count,CONST D3DRECT* pRects,DWOR
 	m_logFile << "Clear" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->Clear(Count, pRects, Flags, Color, Z, Stencil);
 }
 
@@ -672,6 +753,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetTransform(D3DTRANSFORMSTATETYPE State,CON
 	m_logFile << "SetTransform" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetTransform(State, pMatrix);
 }
 
@@ -684,6 +767,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetTransform(D3DTRANSFORMSTATETYPE State,D3D
 	m_logFile << "GetTransform" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetTransform(State, pMatrix);
 }
 
@@ -696,6 +781,8 @@ HRESULT WINAPI BaseDirect3DDevice9::MultiplyTransform(D3DTRANSFORMSTATETYPE Stat
 	m_logFile << "MultiplyTransform" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->MultiplyTransform(State, pMatrix);
 }
 
@@ -708,6 +795,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetViewport(CONST D3DVIEWPORT9* pViewport)
 	m_logFile << "SetViewport" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetViewport(pViewport);
 }
 
@@ -720,6 +809,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetViewport(D3DVIEWPORT9* pViewport)
 	m_logFile << "GetViewport" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetViewport(pViewport);
 }
 
@@ -732,6 +823,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetMaterial(CONST D3DMATERIAL9* pMaterial)
 	m_logFile << "SetMaterial" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetMaterial(pMaterial);
 }
 
@@ -744,6 +837,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetMaterial(D3DMATERIAL9* pMaterial)
 	m_logFile << "GetMaterial" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetMaterial(pMaterial);
 }
 
@@ -756,6 +851,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetLight(DWORD Index,CONST D3DLIGHT9* pLight
 	m_logFile << "SetLight" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetLight(Index, pLight);
 }
 
@@ -768,6 +865,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetLight(DWORD Index,D3DLIGHT9* pLight)
 	m_logFile << "GetLight" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetLight(Index, pLight);
 }
 
@@ -780,6 +879,8 @@ HRESULT WINAPI BaseDirect3DDevice9::LightEnable(DWORD Index,BOOL Enable)
 	m_logFile << "LightEnable" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->LightEnable(Index, Enable);
 }
 
@@ -792,6 +893,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetLightEnable(DWORD Index,BOOL* pEnable)
 	m_logFile << "GetLightEnable" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetLightEnable(Index, pEnable);
 }
 
@@ -804,6 +907,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetClipPlane(DWORD Index,CONST float* pPlane
 	m_logFile << "SetClipPlane" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetClipPlane(Index, pPlane);
 }
 
@@ -816,6 +921,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetClipPlane(DWORD Index,float* pPlane)
 	m_logFile << "GetClipPlane" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetClipPlane(Index, pPlane);
 }
 
@@ -852,6 +959,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateStateBlock(D3DSTATEBLOCKTYPE Type,IDir
 	m_logFile << "CreateStateBlock" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->CreateStateBlock(Type, ppSB);
 }
 
@@ -864,6 +973,8 @@ HRESULT WINAPI BaseDirect3DDevice9::BeginStateBlock()
 	m_logFile << "BeginStateBlock" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->BeginStateBlock();
 }
 
@@ -876,6 +987,8 @@ HRESULT WINAPI BaseDirect3DDevice9::EndStateBlock(IDirect3DStateBlock9** ppSB)
 	m_logFile << "EndStateBlock" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->EndStateBlock(ppSB);
 }
 
@@ -888,6 +1001,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetClipStatus(CONST D3DCLIPSTATUS9* pClipSta
 	m_logFile << "SetClipStatus" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetClipStatus(pClipStatus);
 }
 
@@ -900,6 +1015,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetClipStatus(D3DCLIPSTATUS9* pClipStatus)
 	m_logFile << "GetClipStatus" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetClipStatus(pClipStatus);
 }
 
@@ -984,6 +1101,8 @@ HRESULT WINAPI BaseDirect3DDevice9::ValidateDevice(DWORD* pNumPasses)
 	m_logFile << "ValidateDevice" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->ValidateDevice(pNumPasses);
 }
 
@@ -996,6 +1115,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetPaletteEntries(UINT PaletteNumber,CONST P
 	m_logFile << "SetPaletteEntries" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetPaletteEntries(PaletteNumber, pEntries);
 }
 
@@ -1008,6 +1129,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetPaletteEntries(UINT PaletteNumber,PALETTE
 	m_logFile << "GetPaletteEntries" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetPaletteEntries(PaletteNumber, pEntries);
 }
 
@@ -1020,6 +1143,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetCurrentTexturePalette(UINT PaletteNumber)
 	m_logFile << "SetCurrentTexturePalette" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetCurrentTexturePalette(PaletteNumber);
 }
 
@@ -1032,6 +1157,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetCurrentTexturePalette(UINT *PaletteNumber
 	m_logFile << "GetCurrentTexturePalette" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetCurrentTexturePalette(PaletteNumber);
 }
 
@@ -1044,6 +1171,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetScissorRect(CONST RECT* pRect)
 	m_logFile << "SetScissorRect" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetScissorRect(pRect);
 }
 
@@ -1056,6 +1185,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetScissorRect(RECT* pRect)
 	m_logFile << "GetScissorRect" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetScissorRect(pRect);
 }
 
@@ -1068,6 +1199,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetSoftwareVertexProcessing(BOOL bSoftware)
 	m_logFile << "SetSoftwareVertexProcessing" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetSoftwareVertexProcessing(bSoftware);
 }
 
@@ -1080,6 +1213,8 @@ BOOL WINAPI BaseDirect3DDevice9::GetSoftwareVertexProcessing()
 	m_logFile << "GetSoftwareVertexProcessing" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetSoftwareVertexProcessing();
 }
 
@@ -1092,6 +1227,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetNPatchMode(float nSegments)
 	m_logFile << "SetNPatchMode" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetNPatchMode(nSegments);
 }
 
@@ -1104,6 +1241,8 @@ float WINAPI BaseDirect3DDevice9::GetNPatchMode()
 	m_logFile << "GetNPatchMode" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetNPatchMode();
 }
 
@@ -1164,6 +1303,8 @@ HRESULT WINAPI BaseDirect3DDevice9::ProcessVertices(UINT SrcStartIndex,UINT Dest
 	m_logFile << "ProcessVertices" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->ProcessVertices(SrcStartIndex, DestIndex, VertexCount, pDestBuffer, pVertexDecl, Flags);
 }
 
@@ -1176,6 +1317,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateVertexDeclaration(CONST D3DVERTEXELEME
 	m_logFile << "CreateVertexDeclaration" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->CreateVertexDeclaration(pVertexElements, ppDecl);
 }
 
@@ -1212,6 +1355,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetFVF(DWORD FVF)
 	m_logFile << "SetFVF" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetFVF(FVF);
 }
 
@@ -1224,6 +1369,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetFVF(DWORD* pFVF)
 	m_logFile << "GetFVF" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetFVF(pFVF);
 }
 
@@ -1236,6 +1383,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateVertexShader(CONST DWORD* pFunction,ID
 	m_logFile << "CreateVertexShader" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->CreateVertexShader(pFunction, ppShader);
 }
 
@@ -1296,6 +1445,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetVertexShaderConstantI(UINT StartRegister,
 	m_logFile << "SetVertexShaderConstantI" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetVertexShaderConstantI(StartRegister, pConstantData, Vector4iCount);
 }
 
@@ -1308,6 +1459,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetVertexShaderConstantI(UINT StartRegister,
 	m_logFile << "GetVertexShaderConstantI" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetVertexShaderConstantI(StartRegister, pConstantData, Vector4iCount);
 }
 
@@ -1320,6 +1473,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetVertexShaderConstantB(UINT StartRegister,
 	m_logFile << "SetVertexShaderConstantB" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetVertexShaderConstantB(StartRegister, pConstantData, BoolCount);
 }
 
@@ -1332,6 +1487,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetVertexShaderConstantB(UINT StartRegister,
 	m_logFile << "GetVertexShaderConstantB" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetVertexShaderConstantB(StartRegister, pConstantData, BoolCount);
 }
 
@@ -1368,6 +1525,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetStreamSourceFreq(UINT StreamNumber,UINT S
 	m_logFile << "SetStreamSourceFreq" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetStreamSourceFreq(StreamNumber, Setting);
 }
 
@@ -1380,6 +1539,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetStreamSourceFreq(UINT StreamNumber,UINT*
 	m_logFile << "GetStreamSourceFreq" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetStreamSourceFreq(StreamNumber, pSetting);
 }
 
@@ -1416,6 +1577,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreatePixelShader(CONST DWORD* pFunction,IDi
 	m_logFile << "CreatePixelShader" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->CreatePixelShader(pFunction, ppShader);
 }
 
@@ -1476,6 +1639,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetPixelShaderConstantI(UINT StartRegister,C
 	m_logFile << "SetPixelShaderConstantI" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetPixelShaderConstantI(StartRegister, pConstantData, Vector4iCount);
 }
 
@@ -1488,6 +1653,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetPixelShaderConstantI(UINT StartRegister,i
 	m_logFile << "GetPixelShaderConstantI" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetPixelShaderConstantI(StartRegister, pConstantData, Vector4iCount);
 }
 
@@ -1500,6 +1667,8 @@ HRESULT WINAPI BaseDirect3DDevice9::SetPixelShaderConstantB(UINT StartRegister,C
 	m_logFile << "SetPixelShaderConstantB" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->SetPixelShaderConstantB(StartRegister, pConstantData, BoolCount);
 }
 
@@ -1512,6 +1681,8 @@ HRESULT WINAPI BaseDirect3DDevice9::GetPixelShaderConstantB(UINT StartRegister,B
 	m_logFile << "GetPixelShaderConstantB" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->GetPixelShaderConstantB(StartRegister, pConstantData, BoolCount);
 }
 
@@ -1524,6 +1695,7 @@ HRESULT WINAPI BaseDirect3DDevice9::DrawRectPatch(UINT Handle,CONST float* pNumS
 	m_logFile << "DrawRectPatch" << std::endl;
 
 #endif
+	FlushStereoBatch();
 	return m_pDevice->DrawRectPatch(Handle, pNumSegs, pRectPatchInfo);
 }
 
@@ -1536,6 +1708,8 @@ HRESULT WINAPI BaseDirect3DDevice9::DrawTriPatch(UINT Handle,CONST float* pNumSe
 	m_logFile << "DrawTriPatch" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->DrawTriPatch(Handle, pNumSegs, pTriPatchInfo);
 }
 
@@ -1548,6 +1722,8 @@ HRESULT WINAPI BaseDirect3DDevice9::DeletePatch(UINT Handle)
 	m_logFile << "DeletePatch" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->DeletePatch(Handle);
 }
 
@@ -1560,6 +1736,8 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateQuery(D3DQUERYTYPE Type,IDirect3DQuery
 	m_logFile << "CreateQuery" << std::endl;
 #endif
 
+	FlushStereoBatch();
+
 	return m_pDevice->CreateQuery(Type, ppQuery);
 }
 
@@ -1569,4 +1747,13 @@ HRESULT WINAPI BaseDirect3DDevice9::CreateQuery(D3DQUERYTYPE Type,IDirect3DQuery
 IDirect3DDevice9* BaseDirect3DDevice9::getActual()
 {
 	return m_pDevice;
-}
\ No newline at end of file
+}
+/**
+* Replays deferred draws before any call that can't be deferred, nothing is deferred here.
+* Called by all methods except the bound state setters and getters and the draws. Also called
+* by the buffer wrappers on any call.
+* @see D3DProxyDevice::FlushStereoBatch()
+***/
+void BaseDirect3DDevice9::FlushStereoBatch()
+{
+}
@@ -168,6 +168,7 @@ public:
 
 	/*** BaseDirect3DDevice9 methods ***/
 	IDirect3DDevice9* getActual();
+	virtual void      FlushStereoBatch();
 
 private:
 	/**
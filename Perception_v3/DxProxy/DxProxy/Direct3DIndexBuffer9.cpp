@@ -99,6 +99,7 @@ HRESULT WINAPI BaseDirect3DIndexBuffer9::GetDevice(IDirect3DDevice9** ppDevice)
 	if (!m_pOwningDevice)
 		return D3DERR_INVALIDCALL;
 	else {
+		static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 		*ppDevice = m_pOwningDevice;
 		m_pOwningDevice->AddRef(); 
 		return D3D_OK;
@@ -110,6 +111,7 @@ HRESULT WINAPI BaseDirect3DIndexBuffer9::GetDevice(IDirect3DDevice9** ppDevice)
 ***/
 HRESULT WINAPI BaseDirect3DIndexBuffer9::SetPrivateData(REFGUID refguid, CONST void* pData, DWORD SizeOfData, DWORD Flags)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->SetPrivateData(refguid, pData, SizeOfData, Flags);
 }
 
@@ -118,6 +120,7 @@ HRESULT WINAPI BaseDirect3DIndexBuffer9::SetPrivateData(REFGUID refguid, CONST v
 ***/
 HRESULT WINAPI BaseDirect3DIndexBuffer9::GetPrivateData(REFGUID refguid, void* pData, DWORD* pSizeOfData)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->GetPrivateData(refguid, pData, pSizeOfData);
 }
 
@@ -126,6 +129,7 @@ HRESULT WINAPI BaseDirect3DIndexBuffer9::GetPrivateData(REFGUID refguid, void* p
 ***/
 HRESULT WINAPI BaseDirect3DIndexBuffer9::FreePrivateData(REFGUID refguid)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->FreePrivateData(refguid);
 }
 
@@ -134,6 +138,7 @@ HRESULT WINAPI BaseDirect3DIndexBuffer9::FreePrivateData(REFGUID refguid)
 ***/
 DWORD WINAPI BaseDirect3DIndexBuffer9::SetPriority(DWORD PriorityNew)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->SetPriority(PriorityNew);
 }
 
@@ -142,6 +147,7 @@ DWORD WINAPI BaseDirect3DIndexBuffer9::SetPriority(DWORD PriorityNew)
 ***/
 DWORD WINAPI BaseDirect3DIndexBuffer9::GetPriority()
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->GetPriority();
 }
 
@@ -150,6 +156,7 @@ DWORD WINAPI BaseDirect3DIndexBuffer9::GetPriority()
 ***/
 void WINAPI BaseDirect3DIndexBuffer9::PreLoad()
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->PreLoad();
 }
 
@@ -158,6 +165,7 @@ void WINAPI BaseDirect3DIndexBuffer9::PreLoad()
 ***/
 D3DRESOURCETYPE WINAPI BaseDirect3DIndexBuffer9::GetType()
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->GetType();
 }
 
@@ -166,6 +174,7 @@ D3DRESOURCETYPE WINAPI BaseDirect3DIndexBuffer9::GetType()
 ***/
 HRESULT WINAPI BaseDirect3DIndexBuffer9::Lock(UINT OffsetToLock, UINT SizeToLock, VOID **ppbData, DWORD Flags)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->Lock(OffsetToLock, SizeToLock, ppbData, Flags);
 }
 
@@ -174,6 +183,7 @@ HRESULT WINAPI BaseDirect3DIndexBuffer9::Lock(UINT OffsetToLock, UINT SizeToLock
 ***/
 HRESULT WINAPI BaseDirect3DIndexBuffer9::Unlock()
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->Unlock();
 }
 
@@ -182,6 +192,7 @@ HRESULT WINAPI BaseDirect3DIndexBuffer9::Unlock()
 ***/
 HRESULT WINAPI BaseDirect3DIndexBuffer9::GetDesc(D3DINDEXBUFFER_DESC *pDesc)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualIndexBuffer->GetDesc(pDesc);
 }
 
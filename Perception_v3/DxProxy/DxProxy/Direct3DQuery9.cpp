@@ -125,6 +125,8 @@ DWORD WINAPI BaseDirect3DQuery9::GetDataSize()
 ***/
 HRESULT WINAPI BaseDirect3DQuery9::Issue(DWORD dwIssueFlags)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
+
 	return m_pActualQuery->Issue(dwIssueFlags);
 }
 
@@ -133,5 +135,7 @@ HRESULT WINAPI BaseDirect3DQuery9::Issue(DWORD dwIssueFlags)
 ***/
 HRESULT WINAPI BaseDirect3DQuery9::GetData(void* pData, DWORD dwSize, DWORD dwGetDataFlags)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
+
 	return m_pActualQuery->GetData(pData, dwSize, dwGetDataFlags);
 }
\ No newline at end of file
@@ -99,6 +99,7 @@ HRESULT WINAPI BaseDirect3DVertexBuffer9::GetDevice(IDirect3DDevice9** ppDevice)
 	if (!m_pOwningDevice)
 		return D3DERR_INVALIDCALL;
 	else {
+		static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 		*ppDevice = m_pOwningDevice;
 		m_pOwningDevice->AddRef(); 
 		return D3D_OK;
@@ -110,6 +111,7 @@ HRESULT WINAPI BaseDirect3DVertexBuffer9::GetDevice(IDirect3DDevice9** ppDevice)
 ***/
 HRESULT WINAPI BaseDirect3DVertexBuffer9::SetPrivateData(REFGUID refguid, CONST void* pData, DWORD SizeOfData, DWORD Flags)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->SetPrivateData(refguid, pData, SizeOfData, Flags);
 }
 
@@ -118,6 +120,7 @@ HRESULT WINAPI BaseDirect3DVertexBuffer9::SetPrivateData(REFGUID refguid, CONST
 ***/
 HRESULT WINAPI BaseDirect3DVertexBuffer9::GetPrivateData(REFGUID refguid, void* pData, DWORD* pSizeOfData)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->GetPrivateData(refguid, pData, pSizeOfData);
 }
 
@@ -126,6 +129,7 @@ HRESULT WINAPI BaseDirect3DVertexBuffer9::GetPrivateData(REFGUID refguid, void*
 ***/
 HRESULT WINAPI BaseDirect3DVertexBuffer9::FreePrivateData(REFGUID refguid)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->FreePrivateData(refguid);
 }
 
@@ -134,6 +138,7 @@ HRESULT WINAPI BaseDirect3DVertexBuffer9::FreePrivateData(REFGUID refguid)
 ***/
 DWORD WINAPI BaseDirect3DVertexBuffer9::SetPriority(DWORD PriorityNew)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->SetPriority(PriorityNew);
 }
 
@@ -142,6 +147,7 @@ DWORD WINAPI BaseDirect3DVertexBuffer9::SetPriority(DWORD PriorityNew)
 ***/
 DWORD WINAPI BaseDirect3DVertexBuffer9::GetPriority()
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->GetPriority();
 }
 
@@ -150,6 +156,7 @@ DWORD WINAPI BaseDirect3DVertexBuffer9::GetPriority()
 ***/
 void WINAPI BaseDirect3DVertexBuffer9::PreLoad()
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->PreLoad();
 }
 
@@ -158,6 +165,7 @@ void WINAPI BaseDirect3DVertexBuffer9::PreLoad()
 ***/
 D3DRESOURCETYPE WINAPI BaseDirect3DVertexBuffer9::GetType()
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->GetType();
 }
 
@@ -166,6 +174,7 @@ D3DRESOURCETYPE WINAPI BaseDirect3DVertexBuffer9::GetType()
 ***/
 HRESULT WINAPI BaseDirect3DVertexBuffer9::Lock(UINT OffsetToLock, UINT SizeToLock, VOID **ppbData, DWORD Flags)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->Lock(OffsetToLock, SizeToLock, ppbData, Flags);
 }
 
@@ -174,6 +183,7 @@ HRESULT WINAPI BaseDirect3DVertexBuffer9::Lock(UINT OffsetToLock, UINT SizeToLoc
 ***/
 HRESULT WINAPI BaseDirect3DVertexBuffer9::Unlock()
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->Unlock();
 }
 
@@ -182,6 +192,7 @@ HRESULT WINAPI BaseDirect3DVertexBuffer9::Unlock()
 ***/
 HRESULT WINAPI BaseDirect3DVertexBuffer9::GetDesc(D3DVERTEXBUFFER_DESC *pDesc)
 {
+	static_cast<BaseDirect3DDevice9*>(m_pOwningDevice)->FlushStereoBatch();
 	return m_pActualVertexBuffer->GetDesc(pDesc);
 }
 
@@ -0,0 +1,183 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <DirtyRectSet.h> and
+Class <DirtyRectSet> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#ifndef DIRTYRECTSET_H_INCLUDED
+#define DIRTYRECTSET_H_INCLUDED
+
+#include <stddef.h>
+#include <d3d9.h>
+#include <vector>
+
+/**
+* Rectangles locked on a proxy surface (or texture level) since the last copy to the actual surfaces.
+* Rectangles are coalesced when they are added: two rectangles are merged only if their bounding box
+* is exactly their union (nested rectangles, or rectangles sharing a full edge or overlapping along
+* a full side), so repeated, split or nested locks end up in a single copy. Other rectangles are
+* copied as they are. A lock without rectangle marks the whole surface.
+* The set covers exactly the locked pixels, never more. The lockable system memory surface is only
+* loaded from the actual surface on creation, anything written to the actual surfaces later
+* (UpdateSurface, ColorFill, rendering) is stale there and must not be copied back.
+* @see D3D9ProxyTexture::LockRect
+***/
+class DirtyRectSet
+{
+public:
+	DirtyRectSet() : m_rects(), m_full(false) {}
+
+	/**
+	* Adds a locked rectangle, NULL for the whole surface.
+	***/
+	void Add(const RECT* pRect)
+	{
+		if (m_full)
+			return;
+		if (!pRect)
+		{
+			m_rects.clear();
+			m_full = true;
+			return;
+		}
+		if ((pRect->right <= pRect->left) || (pRect->bottom <= pRect->top))
+			return;
+
+		// merge until no union is a rectangle any more
+		RECT rect = *pRect;
+		size_t i = 0;
+		while (i < m_rects.size())
+		{
+			RECT merged = Union(rect, m_rects[i]);
+			if (Area(merged) == Area(rect) + Area(m_rects[i]) - Area(Intersection(rect, m_rects[i])))
+			{
+				rect = merged;
+				m_rects[i] = m_rects.back();
+				m_rects.pop_back();
+				i = 0;
+			}
+			else i++;
+		}
+		m_rects.push_back(rect);
+	}
+	/**
+	* Adds all rectangles of another set.
+	***/
+	void Add(const DirtyRectSet& other)
+	{
+		if (other.m_full)
+			Add((const RECT*)NULL);
+		for (size_t i = 0; i < other.m_rects.size(); i++)
+			Add(&other.m_rects[i]);
+	}
+	/**
+	* Copies the dirty part of the source surface to the destination surface.
+	* Returns the result of the last failed copy, S_OK if all copies succeeded.
+	***/
+	HRESULT Update(IDirect3DDevice9* pDevice, IDirect3DSurface9* pSource, IDirect3DSurface9* pDestination) const
+	{
+		if (m_full)
+			return pDevice->UpdateSurface(pSource, NULL, pDestination, NULL);
+
+		HRESULT result = S_OK;
+		for (size_t i = 0; i < m_rects.size(); i++)
+		{
+			POINT p;
+			p.x = m_rects[i].left;
+			p.y = m_rects[i].top;
+			HRESULT hr = pDevice->UpdateSurface(pSource, &m_rects[i], pDestination, &p);
+			if (FAILED(hr))
+				result = hr;
+		}
+		return result;
+	}
+	/**
+	* Clears the set, to be called after the rectangles are copied.
+	***/
+	void Clear()
+	{
+		m_rects.clear();
+		m_full = false;
+	}
+	/**
+	* True if the whole surface is dirty.
+	***/
+	bool IsFull() const { return m_full; }
+	/**
+	* True if nothing is dirty.
+	***/
+	bool IsEmpty() const { return !m_full && m_rects.empty(); }
+	/**
+	* The coalesced rectangles, empty if the whole surface is dirty.
+	***/
+	const std::vector<RECT>& GetRects() const { return m_rects; }
+
+private:
+	/**
+	* Area of a rectangle, zero if empty.
+	***/
+	static long long Area(const RECT& rect)
+	{
+		if ((rect.right <= rect.left) || (rect.bottom <= rect.top))
+			return 0;
+		return (long long)(rect.right - rect.left) * (long long)(rect.bottom - rect.top);
+	}
+	/**
+	* Intersection of two rectangles, empty if they do not overlap.
+	***/
+	static RECT Intersection(const RECT& a, const RECT& b)
+	{
+		RECT rect;
+		rect.left = (a.left > b.left) ? a.left : b.left;
+		rect.top = (a.top > b.top) ? a.top : b.top;
+		rect.right = (a.right < b.right) ? a.right : b.right;
+		rect.bottom = (a.bottom < b.bottom) ? a.bottom : b.bottom;
+		return rect;
+	}
+	/**
+	* Bounding box of two rectangles.
+	***/
+	static RECT Union(const RECT& a, const RECT& b)
+	{
+		RECT rect;
+		rect.left = (a.left < b.left) ? a.left : b.left;
+		rect.top = (a.top < b.top) ? a.top : b.top;
+		rect.right = (a.right > b.right) ? a.right : b.right;
+		rect.bottom = (a.bottom > b.bottom) ? a.bottom : b.bottom;
+		return rect;
+	}
+
+	/**
+	* Coalesced rectangles.
+	***/
+	std::vector<RECT> m_rects;
+	/**
+	* True if the whole surface is dirty.
+	***/
+	bool m_full;
+};
+
+#endif
@@ -0,0 +1,258 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <DistortionMesh.cpp> and
+Class <DistortionMesh> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#include "DistortionMesh.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+/**
+* Cache file identifier, "VDM" + version.
+***/
+#define DISTORTION_MESH_MAGIC 0x014D4456
+
+/**
+* Constructor.
+***/
+DistortionMesh::DistortionMesh() :
+	columns(0),
+	rows(0),
+	xMin(0.0f),
+	xMax(0.0f),
+	yMin(0.0f),
+	yMax(0.0f)
+{
+	ZeroMemory(&key, sizeof(Key));
+}
+
+/**
+* Destructor.
+***/
+DistortionMesh::~DistortionMesh()
+{
+}
+
+/**
+* Builds the mesh.
+* Lens space x covers one screen half, -1 - lens offset to 1 - lens offset
+* (see HMDisplayInfo::GetLensXCenterOffset()), y covers -yExtent to yExtent.
+* @param hmd The head mounted display info.
+* @param yExtent Lens space y extent, depends on the eye aspect ratio (OculusRiftView : ScaleIn[1] / 2).
+* @param columns Cells in x, at most MAX_RESOLUTION.
+* @param rows Cells in y, at most MAX_RESOLUTION.
+***/
+bool DistortionMesh::Generate(HMDisplayInfo* hmd, float yExtent, UINT columns, UINT rows)
+{
+	if ((!hmd) || (!columns) || (!rows) || (columns > MAX_RESOLUTION) || (rows > MAX_RESOLUTION)) return false;
+	SetKey(hmd, yExtent, columns, rows);
+
+	this->columns = columns;
+	this->rows = rows;
+	xMin = key.xMin;
+	xMax = key.xMax;
+	yMin = -yExtent;
+	yMax = yExtent;
+
+	// the chroma factor matches HmdWarp() : (1 + c0) + c1 * rSq, red uses c0,c1, blue c2,c3
+	const float* k = key.distortion;
+	const float* c = key.chroma;
+
+	vertices.resize((columns + 1) * (rows + 1));
+	for (UINT row = 0; row <= rows; row++)
+	{
+		float y = yMin + (yMax - yMin) * (float)row / (float)rows;
+		for (UINT column = 0; column <= columns; column++)
+		{
+			float x = xMin + (xMax - xMin) * (float)column / (float)columns;
+			float rSq = x * x + y * y;
+
+			// same as HMDisplayInfo::Distort() / radius
+			float scale = k[0] + k[1] * rSq + k[2] * rSq * rSq + k[3] * rSq * rSq * rSq;
+			float scaleRed = scale * ((1.0f + c[0]) + c[1] * rSq);
+			float scaleBlue = scale * ((1.0f + c[2]) + c[3] * rSq);
+
+			DistortionVertex& vertex = vertices[row * (columns + 1) + column];
+			vertex.x = x;
+			vertex.y = y;
+			vertex.redU = x * scaleRed;
+			vertex.redV = y * scaleRed;
+			vertex.greenU = x * scale;
+			vertex.greenV = y * scale;
+			vertex.blueU = x * scaleBlue;
+			vertex.blueV = y * scaleBlue;
+		}
+	}
+
+	indices.resize(columns * rows * 6);
+	WORD* index = indices.empty() ? nullptr : &indices[0];
+	for (UINT row = 0; row < rows; row++)
+	{
+		for (UINT column = 0; column < columns; column++)
+		{
+			WORD v00 = (WORD)(row * (columns + 1) + column);
+			WORD v10 = v00 + 1;
+			WORD v01 = (WORD)(v00 + columns + 1);
+			WORD v11 = v01 + 1;
+			*index++ = v00; *index++ = v10; *index++ = v11;
+			*index++ = v00; *index++ = v11; *index++ = v01;
+		}
+	}
+
+	return true;
+}
+
+/**
+* Loads the mesh from the cache or builds and caches it.
+* @param cacheDir Cache directory including the trailing backslash, must exist.
+***/
+bool DistortionMesh::LoadOrGenerate(HMDisplayInfo* hmd, float yExtent, UINT columns, UINT rows, const std::string& cacheDir)
+{
+	if ((!hmd) || (!columns) || (!rows) || (columns > MAX_RESOLUTION) || (rows > MAX_RESOLUTION)) return false;
+	SetKey(hmd, yExtent, columns, rows);
+
+	std::string file = cacheDir + GetCacheFileName();
+	if (Load(file)) return true;
+
+	if (!Generate(hmd, yExtent, columns, rows)) return false;
+	if (!Save(file))
+		OutputDebugStringA("DistortionMesh : Failed to write cache file !");
+	return true;
+}
+
+/**
+* Interpolates the uvs at a lens space position the way the rasterizer does.
+* @param uv6 Receives red, green and blue uv.
+* @return False if the position is outside the mesh.
+***/
+bool DistortionMesh::Sample(float x, float y, float* uv6) const
+{
+	if ((vertices.empty()) || (x < xMin) || (x > xMax) || (y < yMin) || (y > yMax)) return false;
+
+	float gx = (x - xMin) / (xMax - xMin) * (float)columns;
+	float gy = (y - yMin) / (yMax - yMin) * (float)rows;
+	UINT column = ((UINT)gx < columns) ? (UINT)gx : columns - 1;
+	UINT row = ((UINT)gy < rows) ? (UINT)gy : rows - 1;
+	float fx = gx - (float)column;
+	float fy = gy - (float)row;
+
+	const float* v00 = &vertices[row * (columns + 1) + column].redU;
+	const float* v10 = &vertices[row * (columns + 1) + column + 1].redU;
+	const float* v01 = &vertices[(row + 1) * (columns + 1) + column].redU;
+	const float* v11 = &vertices[(row + 1) * (columns + 1) + column + 1].redU;
+
+	for (int i = 0; i < 6; i++)
+	{
+		if (fx >= fy)
+			uv6[i] = v00[i] + fx * (v10[i] - v00[i]) + fy * (v11[i] - v10[i]);
+		else
+			uv6[i] = v00[i] + fx * (v11[i] - v01[i]) + fy * (v01[i] - v00[i]);
+	}
+	return true;
+}
+
+/**
+* Cache file name, hash of the key.
+***/
+std::string DistortionMesh::GetCacheFileName() const
+{
+	// FNV-1a
+	UINT hash = 2166136261u;
+	const BYTE* data = (const BYTE*)&key;
+	for (size_t i = 0; i < sizeof(Key); i++)
+	{
+		hash ^= data[i];
+		hash *= 16777619u;
+	}
+
+	std::stringstream sstm;
+	sstm << "distortion_" << std::hex << std::setw(8) << std::setfill('0') << hash << ".vdm";
+	return sstm.str();
+}
+
+/**
+* Sets the cache key.
+***/
+void DistortionMesh::SetKey(HMDisplayInfo* hmd, float yExtent, UINT columns, UINT rows)
+{
+	ZeroMemory(&key, sizeof(Key));
+	memcpy(key.distortion, hmd->GetDistortionCoefficients(), 4 * sizeof(float));
+	memcpy(key.chroma, hmd->GetDistortionCoefficientsChroma(), 4 * sizeof(float));
+	key.xMin = -1.0f - hmd->GetLensXCenterOffset();
+	key.xMax = 1.0f - hmd->GetLensXCenterOffset();
+	key.yExtent = yExtent;
+	key.columns = columns;
+	key.rows = rows;
+}
+
+/**
+* Loads the mesh, fails if the file was built for another key.
+***/
+bool DistortionMesh::Load(const std::string& file)
+{
+	std::ifstream stream(file.c_str(), std::ios::binary);
+	if (!stream.is_open()) return false;
+
+	UINT magic = 0;
+	Key fileKey;
+	stream.read((char*)&magic, sizeof(UINT));
+	stream.read((char*)&fileKey, sizeof(Key));
+	if ((!stream) || (magic != DISTORTION_MESH_MAGIC) || (memcmp(&fileKey, &key, sizeof(Key)) != 0)) return false;
+
+	std::vector<DistortionVertex> fileVertices((key.columns + 1) * (key.rows + 1));
+	std::vector<WORD> fileIndices(key.columns * key.rows * 6);
+	stream.read((char*)&fileVertices[0], fileVertices.size() * sizeof(DistortionVertex));
+	stream.read((char*)&fileIndices[0], fileIndices.size() * sizeof(WORD));
+	if (!stream) return false;
+
+	vertices.swap(fileVertices);
+	indices.swap(fileIndices);
+	columns = key.columns;
+	rows = key.rows;
+	xMin = key.xMin;
+	xMax = key.xMax;
+	yMin = -key.yExtent;
+	yMax = key.yExtent;
+	return true;
+}
+
+/**
+* Writes the mesh.
+***/
+bool DistortionMesh::Save(const std::string& file) const
+{
+	std::ofstream stream(file.c_str(), std::ios::binary | std::ios::trunc);
+	if (!stream.is_open()) return false;
+
+	UINT magic = DISTORTION_MESH_MAGIC;
+	stream.write((const char*)&magic, sizeof(UINT));
+	stream.write((const char*)&key, sizeof(Key));
+	stream.write((const char*)&vertices[0], vertices.size() * sizeof(DistortionVertex));
+	stream.write((const char*)&indices[0], indices.size() * sizeof(WORD));
+	return stream.good();
+}
@@ -0,0 +1,118 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <DistortionMesh.h> and
+Class <DistortionMesh> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#ifndef DISTORTIONMESH_H_INCLUDED
+#define DISTORTIONMESH_H_INCLUDED
+
+#include "d3d9.h"
+#include <string>
+#include <vector>
+
+#include "HMDisplayInfo.h"
+
+/**
+* Distortion mesh vertex.
+* Position is the undistorted lens space coordinate of the screen,
+* the uvs are the distorted lens space coordinates to be sampled, one
+* per color channel (chromatic aberration correction).
+* Both are mapped to screen/texture space by the view (LensCenter, Scale, ScaleIn).
+***/
+struct DistortionVertex
+{
+	float x, y;
+	float redU, redV;
+	float greenU, greenV;
+	float blueU, blueV;
+};
+
+/**
+* Precomputed barrel distortion mesh.
+* Tessellates the lens space of one eye and evaluates the HMDisplayInfo
+* distortion (and chroma) polynomial once per vertex, so the view draws
+* a mesh instead of evaluating the polynomial per pixel. Left eye only,
+* mirror x for the right eye (same as the pixel shader warp).
+* Meshes are cached to disk keyed by the coefficients.
+***/
+class DistortionMesh
+{
+public:
+	DistortionMesh();
+	virtual ~DistortionMesh();
+
+	/*** DistortionMesh public methods ***/
+	bool        Generate(HMDisplayInfo* hmd, float yExtent, UINT columns, UINT rows);
+	bool        LoadOrGenerate(HMDisplayInfo* hmd, float yExtent, UINT columns, UINT rows, const std::string& cacheDir);
+	bool        Sample(float x, float y, float* uv6) const;
+	std::string GetCacheFileName() const;
+
+	const std::vector<DistortionVertex>& GetVertices() const { return vertices; }
+	const std::vector<WORD>&             GetIndices() const { return indices; }
+	UINT                                 GetColumns() const { return columns; }
+	UINT                                 GetRows() const { return rows; }
+
+	/**
+	* Maximum columns/rows, 16 bit indices.
+	***/
+	static const UINT MAX_RESOLUTION = 255;
+
+private:
+	/*** DistortionMesh private methods ***/
+	void        SetKey(HMDisplayInfo* hmd, float yExtent, UINT columns, UINT rows);
+	bool        Load(const std::string& file);
+	bool        Save(const std::string& file) const;
+
+	/**
+	* Cache key, everything the mesh depends on.
+	***/
+	struct Key
+	{
+		float distortion[4];
+		float chroma[4];
+		float xMin, xMax;
+		float yExtent;
+		UINT columns, rows;
+	} key;
+	/**
+	* Grid resolution in cells.
+	***/
+	UINT columns, rows;
+	/**
+	* Lens space extent.
+	***/
+	float xMin, xMax, yMin, yMax;
+	/**
+	* Vertices, (columns + 1) * (rows + 1), row major.
+	***/
+	std::vector<DistortionVertex> vertices;
+	/**
+	* Triangle list indices, two triangles per cell split along (x0,y0)-(x1,y1).
+	***/
+	std::vector<WORD> indices;
+};
+#endif
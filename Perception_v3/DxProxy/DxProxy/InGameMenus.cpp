@@ -1188,6 +1188,8 @@ void D3DProxyDevice::VPMENU_Drawing()
 		if (pRepo->GameHasShaderObjectType(ShaderObjectTypeSky))
 			menu->AddToggle("Draw Skybox : %s", "Yes", "No", &config.draw_sky, defaultConfig.draw_sky);
 	}
+
+	menu->AddToggle("Stereo Batch : %s", "ON", "OFF", &config.stereo_batch, defaultConfig.stereo_batch);
 	
 	menu->AddBackButtons();
 	VPMENU_FinishDrawing(menu);
@@ -0,0 +1,210 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <ProxyObjectPool.h> and
+Class <ProxyObjectPool> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#ifndef PROXYOBJECTPOOL_H_INCLUDED
+#define PROXYOBJECTPOOL_H_INCLUDED
+
+#include <stddef.h>
+#include <new>
+#include <vector>
+#include <mutex>
+
+/**
+* Number of objects per slab.
+***/
+#define PROXY_POOL_SLAB_OBJECTS 64
+
+/**
+* Allocation counts and memory footprint of a proxy object pool.
+***/
+struct ProxyPoolStats
+{
+	ProxyPoolStats() : allocations(0), liveObjects(0), peakObjects(0), slabs(0), footprint(0) {}
+
+	/**
+	* Number of objects allocated since start.
+	***/
+	size_t allocations;
+	/**
+	* Number of objects currently allocated.
+	***/
+	size_t liveObjects;
+	/**
+	* Highest number of objects allocated at the same time.
+	***/
+	size_t peakObjects;
+	/**
+	* Number of slabs taken from the heap (the only heap allocations of the pool).
+	***/
+	size_t slabs;
+	/**
+	* Bytes held by the slabs.
+	***/
+	size_t footprint;
+};
+
+/**
+* Free list pool for proxy wrapper objects, one pool per wrapper class.
+* Objects are carved from slabs of PROXY_POOL_SLAB_OBJECTS objects. Released objects go to a free list
+* and the next wrapper of that class reuses them, so creating and releasing textures at a high rate does
+* not hit the heap. Slabs are kept until the process ends, the pool grows to the highest number of live
+* objects. Allocations of another size (derived classes) bypass the pool.
+* Use from the class operator new and operator delete. @see D3D9ProxySurface::operator new
+*/
+class ProxyObjectPool
+{
+public:
+	/**
+	* Constructor.
+	* @param objectSize Size of the pooled class.
+	***/
+	explicit ProxyObjectPool(size_t objectSize) :
+		m_objectSize(((objectSize < sizeof(FreeObject) ? sizeof(FreeObject) : objectSize) + 15) & ~(size_t)15),
+		m_classSize(objectSize),
+		m_pFree(NULL),
+		m_slabs(),
+		m_stats(),
+		m_mtx()
+	{}
+	/**
+	* Destructor, keeps the slabs.
+	* The wrapper class pools are never destroyed, wrappers might still be released on process exit.
+	***/
+	~ProxyObjectPool() {}
+
+	/**
+	* Allocates an object from the pool.
+	* @param size Size of the allocated class, if it does not match the pooled class the heap is used.
+	***/
+	void* Allocate(size_t size)
+	{
+		if (size != m_classSize)
+			return ::operator new(size);
+
+		std::lock_guard<std::mutex> lock(m_mtx);
+		if (!m_pFree)
+			AddSlab();
+
+		FreeObject* pObject = m_pFree;
+		m_pFree = pObject->pNext;
+
+		m_stats.allocations++;
+		m_stats.liveObjects++;
+		if (m_stats.liveObjects > m_stats.peakObjects)
+			m_stats.peakObjects = m_stats.liveObjects;
+		return pObject;
+	}
+	/**
+	* Returns an object to the pool.
+	* @param size Size of the released class, as passed to Allocate().
+	***/
+	void Free(void* p, size_t size)
+	{
+		if (!p)
+			return;
+		if (size != m_classSize) {
+			::operator delete(p);
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mtx);
+		FreeObject* pObject = static_cast<FreeObject*>(p);
+		pObject->pNext = m_pFree;
+		m_pFree = pObject;
+		m_stats.liveObjects--;
+	}
+	/**
+	* Allocation counts and memory footprint.
+	***/
+	ProxyPoolStats GetStats()
+	{
+		std::lock_guard<std::mutex> lock(m_mtx);
+		return m_stats;
+	}
+
+private:
+	/**
+	* A released object, links to the next one.
+	***/
+	struct FreeObject
+	{
+		FreeObject* pNext;
+	};
+
+	/**
+	* Takes a new slab from the heap and puts its objects on the free list.
+	***/
+	void AddSlab()
+	{
+		char* pSlab = static_cast<char*>(::operator new(m_objectSize * PROXY_POOL_SLAB_OBJECTS));
+		m_slabs.push_back(pSlab);
+
+		for (size_t i = PROXY_POOL_SLAB_OBJECTS; i > 0; i--) {
+			FreeObject* pObject = reinterpret_cast<FreeObject*>(pSlab + (i - 1) * m_objectSize);
+			pObject->pNext = m_pFree;
+			m_pFree = pObject;
+		}
+
+		m_stats.slabs++;
+		m_stats.footprint += m_objectSize * PROXY_POOL_SLAB_OBJECTS;
+	}
+
+	/**
+	* No copies.
+	***/
+	ProxyObjectPool(const ProxyObjectPool&);
+	ProxyObjectPool& operator=(const ProxyObjectPool&);
+
+	/**
+	* Size of a pool object (class size, 16 byte aligned).
+	***/
+	const size_t m_objectSize;
+	/**
+	* Size of the pooled class.
+	***/
+	const size_t m_classSize;
+	/**
+	* First released object.
+	***/
+	FreeObject* m_pFree;
+	/**
+	* All slabs.
+	***/
+	std::vector<char*> m_slabs;
+	/**
+	* Allocation counts and memory footprint.
+	***/
+	ProxyPoolStats m_stats;
+	/**
+	* Wrappers might be created and released from different threads (D3DCREATE_MULTITHREADED).
+	***/
+	std::mutex m_mtx;
+};
+
+#endif
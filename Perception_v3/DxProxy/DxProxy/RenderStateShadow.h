@@ -0,0 +1,300 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <RenderStateShadow.h> and
+Class <RenderStateShadow> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#ifndef RENDERSTATESHADOW_H_INCLUDED
+#define RENDERSTATESHADOW_H_INCLUDED
+
+#include <d3d9.h>
+#include <stdint.h>
+#include "BindingSlots.h"
+
+/**
+* Number of shadowed render states (D3DRENDERSTATETYPE values are all below 256).
+***/
+#define SHADOW_RENDER_STATES 256
+/**
+* Number of shadowed sampler state types per sampler (D3DSAMP_ADDRESSU = 1 ... D3DSAMP_DMAPOFFSET = 13).
+***/
+#define SHADOW_SAMPLER_STATE_TYPES 14
+/**
+* Number of shadowed texture stages (fixed function, 8 max).
+***/
+#define SHADOW_TEXTURE_STAGES 8
+/**
+* Number of shadowed texture stage state types per stage (D3DTSS_COLOROP = 1 ... D3DTSS_CONSTANT = 32).
+***/
+#define SHADOW_TEXTURE_STAGE_STATE_TYPES 33
+/**
+* First sampler state index, sampler states are indexed by dense sampler slot. @see TextureStageToSlot()
+***/
+#define SHADOW_SAMPLER_BASE SHADOW_RENDER_STATES
+/**
+* First texture stage state index.
+***/
+#define SHADOW_TEXTURE_STAGE_BASE (SHADOW_SAMPLER_BASE + BINDING_TEXTURE_SLOTS * SHADOW_SAMPLER_STATE_TYPES)
+/**
+* Total number of shadowed states.
+***/
+#define SHADOW_STATE_COUNT (SHADOW_TEXTURE_STAGE_BASE + SHADOW_TEXTURE_STAGES * SHADOW_TEXTURE_STAGE_STATE_TYPES)
+/**
+* Returned for states that are not shadowed.
+***/
+#define SHADOW_INVALID_INDEX 0xFFFFFFFF
+
+/**
+* Shadow copy of the D3D9 render, sampler and texture stage states.
+* All states share one flat index space (render states, then sampler states per dense sampler
+* slot, then texture stage states per stage). A state is either known (the value matches the
+* device) or unknown, unknown states are fetched from the device once on first read.
+* The proxy device keeps one shadow of the game states, updated as it forwards the game setters,
+* so the stereo view can save the game states without a single Get call.
+*/
+class RenderStateShadow
+{
+public:
+	/**
+	* Constructor, all states unknown.
+	***/
+	RenderStateShadow()
+	{
+		for (UINT i = 0; i < SHADOW_STATE_COUNT; i++)
+			m_values[i] = 0;
+		ForgetAll();
+	}
+
+	/**
+	* Shadow index of a render state.
+	***/
+	static UINT RenderStateIndex(D3DRENDERSTATETYPE State)
+	{
+		if ((UINT)State >= SHADOW_RENDER_STATES)
+			return SHADOW_INVALID_INDEX;
+		return (UINT)State;
+	}
+	/**
+	* Shadow index of a sampler state.
+	***/
+	static UINT SamplerStateIndex(DWORD Sampler, D3DSAMPLERSTATETYPE Type)
+	{
+		UINT slot = TextureStageToSlot(Sampler);
+		if ((slot == BINDING_INVALID_SLOT) || ((UINT)Type >= SHADOW_SAMPLER_STATE_TYPES))
+			return SHADOW_INVALID_INDEX;
+		return SHADOW_SAMPLER_BASE + slot * SHADOW_SAMPLER_STATE_TYPES + (UINT)Type;
+	}
+	/**
+	* Shadow index of a texture stage state.
+	***/
+	static UINT TextureStageStateIndex(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type)
+	{
+		if ((Stage >= SHADOW_TEXTURE_STAGES) || ((UINT)Type >= SHADOW_TEXTURE_STAGE_STATE_TYPES))
+			return SHADOW_INVALID_INDEX;
+		return SHADOW_TEXTURE_STAGE_BASE + (UINT)Stage * SHADOW_TEXTURE_STAGE_STATE_TYPES + (UINT)Type;
+	}
+
+	/**
+	* Sets the state on the device, whatever kind of state the index stands for.
+	***/
+	static HRESULT SetOnDevice(IDirect3DDevice9* pDevice, UINT index, DWORD value)
+	{
+		if (index < SHADOW_SAMPLER_BASE)
+			return pDevice->SetRenderState((D3DRENDERSTATETYPE)index, value);
+		if (index < SHADOW_TEXTURE_STAGE_BASE) {
+			index -= SHADOW_SAMPLER_BASE;
+			return pDevice->SetSamplerState(SlotToTextureStage(index / SHADOW_SAMPLER_STATE_TYPES), (D3DSAMPLERSTATETYPE)(index % SHADOW_SAMPLER_STATE_TYPES), value);
+		}
+		if (index < SHADOW_STATE_COUNT) {
+			index -= SHADOW_TEXTURE_STAGE_BASE;
+			return pDevice->SetTextureStageState(index / SHADOW_TEXTURE_STAGE_STATE_TYPES, (D3DTEXTURESTAGESTATETYPE)(index % SHADOW_TEXTURE_STAGE_STATE_TYPES), value);
+		}
+		return D3DERR_INVALIDCALL;
+	}
+	/**
+	* Gets the state from the device, whatever kind of state the index stands for.
+	***/
+	static HRESULT GetFromDevice(IDirect3DDevice9* pDevice, UINT index, DWORD* pValue)
+	{
+		if (index < SHADOW_SAMPLER_BASE)
+			return pDevice->GetRenderState((D3DRENDERSTATETYPE)index, pValue);
+		if (index < SHADOW_TEXTURE_STAGE_BASE) {
+			index -= SHADOW_SAMPLER_BASE;
+			return pDevice->GetSamplerState(SlotToTextureStage(index / SHADOW_SAMPLER_STATE_TYPES), (D3DSAMPLERSTATETYPE)(index % SHADOW_SAMPLER_STATE_TYPES), pValue);
+		}
+		if (index < SHADOW_STATE_COUNT) {
+			index -= SHADOW_TEXTURE_STAGE_BASE;
+			return pDevice->GetTextureStageState(index / SHADOW_TEXTURE_STAGE_STATE_TYPES, (D3DTEXTURESTAGESTATETYPE)(index % SHADOW_TEXTURE_STAGE_STATE_TYPES), pValue);
+		}
+		return D3DERR_INVALIDCALL;
+	}
+
+	/**
+	* True if the state value is known.
+	***/
+	bool IsKnown(UINT index) const
+	{
+		return (index < SHADOW_STATE_COUNT) && ((m_knownMask[index >> 5] & (1u << (index & 31))) != 0);
+	}
+	/**
+	* Gets a known state value.
+	* @return False if the state is unknown, pValue is untouched then.
+	***/
+	bool Get(UINT index, DWORD* pValue) const
+	{
+		if (!IsKnown(index))
+			return false;
+		*pValue = m_values[index];
+		return true;
+	}
+	/**
+	* Sets the state value, the state is known afterwards. Ignored for invalid indices.
+	***/
+	void Set(UINT index, DWORD value)
+	{
+		if (index >= SHADOW_STATE_COUNT)
+			return;
+		m_values[index] = value;
+		m_knownMask[index >> 5] |= 1u << (index & 31);
+	}
+	/**
+	* Gets the state value, fetches (and keeps) it from the device if unknown.
+	* States that are not shadowed are fetched from the device each call.
+	***/
+	DWORD Fetch(IDirect3DDevice9* pDevice, UINT index)
+	{
+		DWORD value = 0;
+		if (Get(index, &value))
+			return value;
+		if (SUCCEEDED(GetFromDevice(pDevice, index, &value)))
+			Set(index, value);
+		return value;
+	}
+
+	/**
+	* The state value is unknown afterwards.
+	***/
+	void Forget(UINT index)
+	{
+		if (index < SHADOW_STATE_COUNT)
+			m_knownMask[index >> 5] &= ~(1u << (index & 31));
+	}
+	/**
+	* All state values are unknown afterwards, call on device reset or if the states got
+	* changed behind the shadow (e.g. by an applied state block).
+	***/
+	void ForgetAll()
+	{
+		for (UINT i = 0; i < SHADOW_MASK_WORDS; i++)
+			m_knownMask[i] = 0;
+	}
+	/**
+	* Forgets all states known in the other shadow.
+	***/
+	void Forget(const RenderStateShadow& states)
+	{
+		for (UINT i = 0; i < SHADOW_MASK_WORDS; i++)
+			m_knownMask[i] &= ~states.m_knownMask[i];
+	}
+	/**
+	* Takes over all states known in the source shadow, other states stay as they are.
+	***/
+	void CopyKnown(const RenderStateShadow& source)
+	{
+		for (UINT i = 0; i < SHADOW_MASK_WORDS; i++) {
+			uint32_t mask = source.m_knownMask[i];
+			if (!mask)
+				continue;
+			m_knownMask[i] |= mask;
+			for (UINT bit = 0; mask; bit++, mask >>= 1)
+				if (mask & 1)
+					m_values[(i << 5) + bit] = source.m_values[(i << 5) + bit];
+		}
+	}
+	/**
+	* Reads all states known here anew from the source shadow (fetched from the device if unknown there).
+	* @param source The source shadow.
+	* @param pDevice The device to fetch unknown source states from.
+	***/
+	void RefreshKnown(RenderStateShadow& source, IDirect3DDevice9* pDevice)
+	{
+		for (UINT i = 0; i < SHADOW_MASK_WORDS; i++) {
+			uint32_t mask = m_knownMask[i];
+			for (UINT bit = 0; mask; bit++, mask >>= 1)
+				if (mask & 1)
+					m_values[(i << 5) + bit] = source.Fetch(pDevice, (i << 5) + bit);
+		}
+	}
+	/**
+	* True if any state is known.
+	***/
+	bool AnyKnown() const
+	{
+		for (UINT i = 0; i < SHADOW_MASK_WORDS; i++)
+			if (m_knownMask[i])
+				return true;
+		return false;
+	}
+	/**
+	* Index of the next known state, skips unknown states 32 at a time.
+	* @param from First index to look at.
+	* @return SHADOW_INVALID_INDEX if there is no known state at or after from.
+	***/
+	UINT NextKnown(UINT from) const
+	{
+		UINT index = from;
+		while (index < SHADOW_STATE_COUNT) {
+			uint32_t mask = m_knownMask[index >> 5] >> (index & 31);
+			if (!mask) {
+				index = (index | 31) + 1;
+				continue;
+			}
+			while (!(mask & 1)) {
+				mask >>= 1;
+				index++;
+			}
+			return index;
+		}
+		return SHADOW_INVALID_INDEX;
+	}
+
+private:
+	/**
+	* Number of 32 bit words in the known state mask.
+	***/
+	enum { SHADOW_MASK_WORDS = (SHADOW_STATE_COUNT + 31) / 32 };
+
+	/**
+	* The state values, only valid if known.
+	***/
+	DWORD m_values[SHADOW_STATE_COUNT];
+	/**
+	* Bitmask of known states.
+	***/
+	uint32_t m_knownMask[SHADOW_MASK_WORDS];
+};
+
+#endif
@@ -42,9 +42,10 @@ ShaderModificationRepository::ShaderModificationRepository(std::shared_ptr<ViewA
 	m_AllModificationRules(),
 	m_defaultModificationRuleIDs(),
 	m_shaderSpecificModificationRuleIDs(),
-	m_spAdjustmentMatrices(adjustmentMatrices)
+	m_spAdjustmentMatrices(adjustmentMatrices),
+	m_modifications(),
+	m_constantSets()
 {
-	D3DXMatrixIdentity(&m_identity);
 	memset(m_hasShaderObjectType, 0, sizeof(bool) * ShaderObjectType_Count);
 }
 
@@ -376,25 +377,25 @@ bool ShaderModificationRepository::DeleteRule(std::string constantName)
 }
 
 /**
-* Returns a collection of modified constants for the specified shader. 
-* (may be an empty collection if no modifications apply)
-* <StrartRegister, StereoShaderConstant<float>>
+* Returns the set of modified constants for the specified shader. 
+* (may be an empty set if no modifications apply)
+* Sets are interned, shaders with the same modified constants share one set.
 *
 * Hash the shader and load modification rules:
 * If rules for this specific shader use those else use default rules.
 *
 * For each shader constant:
-* Check if constant matches a rule (name and/or index). If it does create a stereoshaderconstant 
-* based on rule and add to map of stereoshaderconstants to return.
+* Check if constant matches a rule (name and/or index). If it does create a stereo constant binding 
+* based on rule and add to the set to return.
 *
 * @param pActualPixelShader The actual (not wrapped) pixel shader.
-* @return Collection of stereoshaderconstants for this shader (empty collection if no modifications).
+* @return Set of modified constants for this shader (empty set if no modifications).
 ***/
-std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetModifiedConstantsF(IDirect3DPixelShader9* pActualPixelShader)
+std::shared_ptr<const StereoConstantSet> ShaderModificationRepository::GetModifiedConstantsF(IDirect3DPixelShader9* pActualPixelShader)
 {
 	// All rules are assumed to be valid. Validation of rules should be done when rules are loaded/created
 	std::vector<ConstantModificationRule*> rulesToApply;
-	std::map<UINT, StereoShaderConstant<float>> result;
+	std::vector<StereoConstantBinding> result;
 
 	// Hash the shader and load modification rules
 	BYTE *pData = NULL;
@@ -427,7 +428,7 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 		}
 	}
 
-	// Load the constant descriptions for this shader and create StereoShaderConstants as the applicable rules require them.
+	// Load the constant descriptions for this shader and create stereo constant bindings as the applicable rules require them.
 	LPD3DXCONSTANTTABLE pConstantTable = NULL;
 
 	D3DXGetShaderConstantTable(reinterpret_cast<DWORD*>(pData), &pConstantTable);
@@ -520,8 +521,8 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 								debugf("Register Index: %d", pConstantDesc[j].RegisterIndex);
 #endif // DEBUG
 
-								// Create StereoShaderConstant<float> and add to result
-								result.insert(std::pair<UINT, StereoShaderConstant<>>(pConstantDesc[j].RegisterIndex, CreateStereoConstantFrom(*itRules, pConstantDesc[j].RegisterIndex, pConstantDesc[j].RegisterCount)));
+								// Create the stereo constant binding and add to result
+								result.push_back(CreateStereoConstantFrom(*itRules, pConstantDesc[j].RegisterIndex, pConstantDesc[j].RegisterCount));
 
 								// only the first matching rule is applied to a constant
 								break;
@@ -570,7 +571,7 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 
 					if (std::strstr(codeBuffer, parseStringBuffer))
 					{
-						result.insert(std::pair<UINT, StereoShaderConstant<>>((*itRules)->m_startRegIndex, CreateStereoConstantFrom(*itRules, (*itRules)->m_startRegIndex, (*itRules)->m_registerCount)));
+						result.push_back(CreateStereoConstantFrom(*itRules, (*itRules)->m_startRegIndex, (*itRules)->m_registerCount));
 						found = true;
 						break;
 					}
@@ -583,7 +584,7 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 				//Direct compare for contains
 				if (std::strstr(codeBuffer, shaderCodeFindPattern.c_str()))
 				{
-					result.insert(std::pair<UINT, StereoShaderConstant<>>((*itRules)->m_startRegIndex, CreateStereoConstantFrom(*itRules, (*itRules)->m_startRegIndex, (*itRules)->m_registerCount)));
+					result.push_back(CreateStereoConstantFrom(*itRules, (*itRules)->m_startRegIndex, (*itRules)->m_registerCount));
 					break;
 				}
 			}
@@ -595,29 +596,29 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 	_SAFE_RELEASE(pConstantTable);
 	if (pData) delete[] pData;
 
-	return result;
+	return InternConstantSet(result);
 }
 
 /**
-* Returns a collection of modified constants for the specified shader. 
-* (may be an empty collection if no modifications apply)
-* <StrartRegister, StereoShaderConstant<float>>
+* Returns the set of modified constants for the specified shader. 
+* (may be an empty set if no modifications apply)
+* Sets are interned, shaders with the same modified constants share one set.
 *
 * Hash the shader and load modification rules:
 * If rules for this specific shader use those else use default rules.
 *
 * For each shader constant:
-* Check if constant matches a rule (name and/or index). If it does create a stereoshaderconstant 
-* based on rule and add to map of stereoshaderconstants to return.
+* Check if constant matches a rule (name and/or index). If it does create a stereo constant binding 
+* based on rule and add to the set to return.
 *
 * @param pActualVertexShader The actual (not wrapped) vertex shader.
-* @return Collection of stereoshaderconstants for this shader (empty collection if no modifications).
+* @return Set of modified constants for this shader (empty set if no modifications).
 ***/
-std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetModifiedConstantsF(IDirect3DVertexShader9* pActualVertexShader)
+std::shared_ptr<const StereoConstantSet> ShaderModificationRepository::GetModifiedConstantsF(IDirect3DVertexShader9* pActualVertexShader)
 {
 	// All rules are assumed to be valid. Validation of rules should be done when rules are loaded/created
 	std::vector<ConstantModificationRule*> rulesToApply;
-	std::map<UINT, StereoShaderConstant<float>> result;
+	std::vector<StereoConstantBinding> result;
 
 	// Hash the shader and load modification rules
 	BYTE *pData = NULL;
@@ -653,7 +654,7 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 
 
 
-	// Load the constant descriptions for this shader and create StereoShaderConstants as the applicable rules require them.
+	// Load the constant descriptions for this shader and create stereo constant bindings as the applicable rules require them.
 	LPD3DXCONSTANTTABLE pConstantTable = NULL;
 	D3DXGetShaderConstantTable(reinterpret_cast<DWORD*>(pData), &pConstantTable);
 
@@ -763,9 +764,9 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 								debugf("Register Index: %d", pConstantDesc[j].RegisterIndex);
 #endif // DEBUG
 
-								// Create StereoShaderConstant<float> and add to result
+								// Create the stereo constant binding and add to result
 
-								result.insert(std::pair<UINT, StereoShaderConstant<>>(pConstantDesc[j].RegisterIndex, CreateStereoConstantFrom(*itRules, pConstantDesc[j].RegisterIndex, pConstantDesc[j].RegisterCount)));
+								result.push_back(CreateStereoConstantFrom(*itRules, pConstantDesc[j].RegisterIndex, pConstantDesc[j].RegisterCount));
 
 								// only the first matching rule is applied to a constant
 								break;
@@ -812,7 +813,7 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 
 					if (std::strstr(codeBuffer, parseStringBuffer))
 					{
-						result.insert(std::pair<UINT, StereoShaderConstant<>>((*itRules)->m_startRegIndex, CreateStereoConstantFrom(*itRules, (*itRules)->m_startRegIndex, (*itRules)->m_registerCount)));
+						result.push_back(CreateStereoConstantFrom(*itRules, (*itRules)->m_startRegIndex, (*itRules)->m_registerCount));
 						found = true;
 						break;
 					}
@@ -825,7 +826,7 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 				//Direct compare for contains
 				if (std::strstr(codeBuffer, shaderCodeFindPattern.c_str()))
 				{
-					result.insert(std::pair<UINT, StereoShaderConstant<>>((*itRules)->m_startRegIndex, CreateStereoConstantFrom(*itRules, (*itRules)->m_startRegIndex, (*itRules)->m_registerCount)));
+					result.push_back(CreateStereoConstantFrom(*itRules, (*itRules)->m_startRegIndex, (*itRules)->m_registerCount));
 					break;
 				}
 			}
@@ -837,7 +838,7 @@ std::map<UINT, StereoShaderConstant<float>> ShaderModificationRepository::GetMod
 	_SAFE_RELEASE(pConstantTable);
 	if (pData) delete[] pData;
 
-	return result;
+	return InternConstantSet(result);
 }
 
 /**
@@ -1051,50 +1052,82 @@ bool ShaderModificationRepository::ConstantHasRule(std::string constantName, std
 }
 
 /**
-* Creates and returns StereoShaderConstant by specified rule.
+* Creates and returns the stereo constant binding for the specified rule.
 * StartReg is needed for registers that were identified by rule using name for matching but not register.
 * @param rule [in] Shader constant modification rule.
 * @param StartReg [in] Shader constant start register.
 * @param Count [in] Shader constant size.
-* @return The stereo shader constant containing the specified modification rule.
+* @return The stereo constant binding containing the modification of the specified rule.
 ***/
-StereoShaderConstant<> ShaderModificationRepository::CreateStereoConstantFrom(const ConstantModificationRule* rule, UINT StartReg, UINT Count)
+StereoConstantBinding ShaderModificationRepository::CreateStereoConstantFrom(const ConstantModificationRule* rule, UINT StartReg, UINT Count)
 {
 	assert ((rule->m_startRegIndex == UINT_MAX) ? (StartReg != UINT_MAX) : (rule->m_startRegIndex == StartReg));
 
-	std::shared_ptr<ShaderConstantModification<>> modification = nullptr;
-	float* pData = NULL;
+	StereoConstantBinding binding;
+	binding.startRegister = StartReg;
+	binding.count = Count;
 
 	switch (rule->m_constantType)
 	{
 	case D3DXPC_VECTOR:
 		//If a register of 4 treat as a matrix
-		if(Count == 4)
-		{
-			modification = ShaderConstantModificationFactory::CreateMatrixModification(rule->m_operationToApply, m_spAdjustmentMatrices, rule->m_transpose);
-			pData = m_identity;
-
-			return StereoShaderConstant<>(StartReg, pData, Count, modification);
-		}
-		else
-		{
-			modification = ShaderConstantModificationFactory::CreateVector4Modification(rule->m_operationToApply, m_spAdjustmentMatrices);
-			pData = D3DXVECTOR4(0,0,0,0);
-
-			return StereoShaderConstant<>(StartReg, pData, Count, modification);
-		}
+		binding.modification = GetModification(rule->m_operationToApply, (Count == 4), rule->m_transpose);
 		break;
 	
 	case D3DXPC_MATRIX_ROWS:
 	case D3DXPC_MATRIX_COLUMNS:
-		modification = ShaderConstantModificationFactory::CreateMatrixModification(rule->m_operationToApply, m_spAdjustmentMatrices, rule->m_transpose);
-		pData = m_identity;
-
-		return StereoShaderConstant<>(StartReg, pData, Count, modification);
+		binding.modification = GetModification(rule->m_operationToApply, true, rule->m_transpose);
 		break;
 
 	default:
 		throw 69; // unhandled type
 		break;
 	}
-}
\ No newline at end of file
+
+	return binding;
+}
+
+/**
+* Returns the shared modification for the specified operation, creates it on first use.
+* Modifications hold no per constant data, so all constants with the same operation share one.
+* @param operation [in] Modification identifier.
+* @param matrix [in] True for a matrix modification, false for a vector modification.
+* @param transpose [in] True if the input matrix should be transposed (matrix modifications only).
+***/
+std::shared_ptr<ShaderConstantModification<>> ShaderModificationRepository::GetModification(UINT operation, bool matrix, bool transpose)
+{
+	if (!matrix)
+		transpose = false;
+
+	ModificationKey key(operation, (matrix ? 2 : 0) | (transpose ? 1 : 0));
+	auto itModification = m_modifications.find(key);
+	if (itModification != m_modifications.end())
+		return itModification->second;
+
+	std::shared_ptr<ShaderConstantModification<>> modification;
+	if (matrix)
+		modification = ShaderConstantModificationFactory::CreateMatrixModification(operation, m_spAdjustmentMatrices, transpose);
+	else
+		modification = ShaderConstantModificationFactory::CreateVector4Modification(operation, m_spAdjustmentMatrices);
+
+	m_modifications.insert(std::make_pair(key, modification));
+	return modification;
+}
+
+/**
+* Returns the interned set for the specified bindings.
+* Bindings are sorted by start register (first binding per register wins), identical sets are only stored once.
+* @param bindings [in, out] Bindings of a shader, sorted on return.
+***/
+std::shared_ptr<const StereoConstantSet> ShaderModificationRepository::InternConstantSet(std::vector<StereoConstantBinding>& bindings)
+{
+	StereoConstantSet::Normalize(bindings);
+
+	auto itSet = m_constantSets.find(bindings);
+	if (itSet != m_constantSets.end())
+		return itSet->second;
+
+	std::shared_ptr<const StereoConstantSet> constantSet = std::make_shared<StereoConstantSet>(bindings);
+	m_constantSets.insert(std::make_pair(bindings, constantSet));
+	return constantSet;
+}
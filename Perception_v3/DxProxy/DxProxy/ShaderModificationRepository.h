@@ -34,9 +34,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <d3dx9.h>
 #include <vector>
 #include <unordered_map>
+#include <map>
 #include <string>
 #include <memory>
-#include "StereoShaderConstant.h"
+#include "StereoConstantSet.h"
 #include "GameHandler.h"
 #include "ShaderRegisters.h"
 #include "MurmurHash3.h"
@@ -64,8 +65,8 @@ public:
 	bool                                        AddRule(std::string constantName, bool allowPartialNameMatch, UINT startRegIndex, D3DXPARAMETER_CLASS constantType, UINT operationToApply, UINT modificationRuleID, bool transpose);
 	bool                                        ModifyRule(std::string constantName, UINT operationToApply, bool transpose);
 	bool                                        DeleteRule(std::string constantName);
-	std::map<UINT, StereoShaderConstant<float>> GetModifiedConstantsF(IDirect3DPixelShader9* pActualPixelShader);
-	std::map<UINT, StereoShaderConstant<float>> GetModifiedConstantsF(IDirect3DVertexShader9* pActualVertexShader);
+	std::shared_ptr<const StereoConstantSet>    GetModifiedConstantsF(IDirect3DPixelShader9* pActualPixelShader);
+	std::shared_ptr<const StereoConstantSet>    GetModifiedConstantsF(IDirect3DVertexShader9* pActualVertexShader);
 	bool										SquishViewportForShader(IDirect3DVertexShader9* pActualVertexShader);
 	ShaderObjectType							GetShaderObjectType(IDirect3DVertexShader9* pActualVertexShader);
 	ShaderObjectType							GetShaderObjectType(IDirect3DPixelShader9* pActualPixelShader);
@@ -212,16 +213,29 @@ private:
 	};
 
 	/*** ShaderModificationRepository private methods ***/
-	StereoShaderConstant<float> CreateStereoConstantFrom(const ConstantModificationRule* rule, UINT StartReg, UINT Count);
+	StereoConstantBinding                         CreateStereoConstantFrom(const ConstantModificationRule* rule, UINT StartReg, UINT Count);
+	std::shared_ptr<ShaderConstantModification<>> GetModification(UINT operation, bool matrix, bool transpose);
+	std::shared_ptr<const StereoConstantSet>      InternConstantSet(std::vector<StereoConstantBinding>& bindings);
+
+	/**
+	* Modification key : <Modification identifier, (matrix ? 2 : 0) | (transpose ? 1 : 0)>
+	***/
+	typedef std::pair<UINT, UINT> ModificationKey;
 
 	/**
 	* Matrix calculation class pointer, used here to create the modifications.
 	***/
 	std::shared_ptr<ViewAdjustment> m_spAdjustmentMatrices;	
 	/**
-	* Identity matrix.
+	* Shared constant modifications, one per operation.
+	* <ModificationKey, Modification>
+	***/
+	std::map<ModificationKey, std::shared_ptr<ShaderConstantModification<>>> m_modifications;
+	/**
+	* Interned sets of modified constants, shared by all shaders with the same modified constants.
+	* <Sorted bindings, Set>
 	***/
-	D3DXMATRIX m_identity;
+	std::map<std::vector<StereoConstantBinding>, std::shared_ptr<const StereoConstantSet>> m_constantSets;
 	/**
 	* Map of all modification rules.
 	* <Modification Rule ID, ModificationRule>
@@ -30,6 +30,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "ShaderRegisters.h"
 #include "vireio.h"
 #include <assert.h>
+#include <intrin.h>
+#include <stdexcept>
 
 using namespace vireio;
 
@@ -45,7 +47,14 @@ ShaderRegisters::ShaderRegisters(DWORD maxPSConstantRegistersF, DWORD maxVSConst
 	m_vsRegistersF(maxVSConstantRegistersF * VECTOR_LENGTH, 0), // VECTOR_LENGTH floats per register
 	m_pActualDevice(pActualDevice),
 	m_pActivePixelShader(NULL),
-	m_pActiveVertexShader(NULL)
+	m_pActiveVertexShader(NULL),
+	m_vsStereoConstants(),
+	m_psStereoConstants(),
+	m_uploadBuffer((std::max)(maxPSConstantRegistersF, maxVSConstantRegistersF) * VECTOR_LENGTH, 0),
+	m_vsUploads(),
+	m_psUploads(),
+	m_lastFrameVSUploads(),
+	m_lastFramePSUploads()
 {
 	assert(pActualDevice != NULL);
 
@@ -150,16 +159,18 @@ HRESULT WINAPI ShaderRegisters::GetPixelShaderConstantF(UINT StartRegister, floa
 
 /**
 * Returns the vertex shader register vector containing all constant registers.
+* Returned by reference, state blocks copy it into their (already allocated) capture vector.
 ***/
-std::vector<float> ShaderRegisters::GetAllVSConstantRegistersF()
+const std::vector<float>& ShaderRegisters::GetAllVSConstantRegistersF()
 {
 	return m_vsRegistersF;
 }
 
 /**
 * Returns the pixel shader register vector containing all constant registers.
+* Returned by reference, state blocks copy it into their (already allocated) capture vector.
 ***/
-std::vector<float> ShaderRegisters::GetAllPSConstantRegistersF()
+const std::vector<float>& ShaderRegisters::GetAllPSConstantRegistersF()
 {
 	return m_psRegistersF;
 }
@@ -180,6 +191,8 @@ std::vector<float> ShaderRegisters::GetAllPSConstantRegistersF()
 void ShaderRegisters::SetFromStateBlockVertexShader(D3D9ProxyVertexShader* storedVShader)
 {
 	// vertex shader
+	m_vsStereoConstants.Change(storedVShader ? storedVShader->ModifiedConstants() : NULL, dirtyVSRegisters);
+
 	_SAFE_RELEASE(m_pActiveVertexShader);
 	m_pActiveVertexShader = storedVShader;
 	if (m_pActiveVertexShader)
@@ -202,6 +215,8 @@ void ShaderRegisters::SetFromStateBlockVertexShader(D3D9ProxyVertexShader* store
 void ShaderRegisters::SetFromStateBlockPixelShader(D3D9ProxyPixelShader* storedPShader)
 {
 	// pixel shader
+	m_psStereoConstants.Change(storedPShader ? storedPShader->ModifiedConstants() : NULL, dirtyPSRegisters);
+
 	_SAFE_RELEASE(m_pActivePixelShader);
 	m_pActivePixelShader = storedPShader;
 	if (m_pActivePixelShader)
@@ -219,53 +234,53 @@ void ShaderRegisters::SetFromStateBlockPixelShader(D3D9ProxyPixelShader* storedP
 * stateblock textures for further thoughts.
 * The only time you restore all registers is when the whole vertex shader state is saved, in which
 * case there will always be a vertex shader to go with the registers (it may be null).
-* @param storedPSRegisters Pointer to stored pixel shader register map.
-* @param storedVSRegisters Pointer to stored vertex shader register map.
+* @param storedPSRegisters Pointer to stored pixel shader register selection, NULL to skip.
+* @param storedVSRegisters Pointer to stored vertex shader register selection, NULL to skip.
 ***/
-void ShaderRegisters::SetFromStateBlockData(std::map<UINT, D3DXVECTOR4> * storedVSRegisters, std::map<UINT, D3DXVECTOR4> * storedPSRegisters)
+void ShaderRegisters::SetFromStateBlockData(RegisterCaptureStore * storedVSRegisters, RegisterCaptureStore * storedPSRegisters)
 {
-	// vertex shader registers
-	auto itNewRegsVS = storedVSRegisters->begin();
-	while (itNewRegsVS != storedVSRegisters->end()) {
+	UINT start = 0;
+	UINT count = 0;
 
-		if ((RegisterIndex(itNewRegsVS->first) + VECTOR_LENGTH) >= m_vsRegistersF.size())
-			throw std::out_of_range("Register from stateblock is out of range, implosion imminent");
+	// vertex shader registers, one block copy per run of selected registers
+	if (storedVSRegisters)
+	{
+		UINT next = 0;
+		while (storedVSRegisters->NextRun(next, start, count)) {
 
-		//std::copy(static_cast<float*>(itNewRegsVS->second), static_cast<float*>(itNewRegsVS->second) + VECTOR_LENGTH,  &m_vsRegistersF[RegisterIndex(itNewRegsVS->first)]);
-		// copy produces warnings, this does not.
-		int regStartIndexInVector = RegisterIndex(itNewRegsVS->first);
-		m_vsRegistersF[regStartIndexInVector	] = itNewRegsVS->second.x;
-		m_vsRegistersF[regStartIndexInVector + 1] = itNewRegsVS->second.y;
-		m_vsRegistersF[regStartIndexInVector + 2] = itNewRegsVS->second.z;
-		m_vsRegistersF[regStartIndexInVector + 3] = itNewRegsVS->second.w;
+			if ((start + count) >= m_maxVSConstantRegistersF)
+				throw std::out_of_range("Register from stateblock is out of range, implosion imminent");
 
-		// register is clean (now matches device state - unless it's stereo in which case it might not, that is handled at the end)
-		dirtyVSRegisters.MarkClean(itNewRegsVS->first);
-		++itNewRegsVS;
-	}
+			const float* pData = storedVSRegisters->Data(start);
+			std::copy(pData, pData + (VECTOR_LENGTH * count), m_vsRegistersF.begin() + RegisterIndex(start));
 
-	MarkAllVSStereoConstantsDirty();
+			// registers are clean (now match device state - unless stereo in which case they might not, that is handled at the end)
+			dirtyVSRegisters.MarkRangeClean(start, count);
+			next = start + count;
+		}
 
-	// pixel shader registers
-	auto itNewRegsPS = storedPSRegisters->begin();
-	while (itNewRegsPS != storedPSRegisters->end()) {
-
-		if ((RegisterIndex(itNewRegsPS->first) + VECTOR_LENGTH) >= m_psRegistersF.size())
-			throw std::out_of_range("Register from stateblock is out of range, implosion imminent");
-
-		// copy produces warnings, this does not.
-		int regStartIndexInVector = RegisterIndex(itNewRegsPS->first);
-		m_psRegistersF[regStartIndexInVector	] = itNewRegsPS->second.x;
-		m_psRegistersF[regStartIndexInVector + 1] = itNewRegsPS->second.y;
-		m_psRegistersF[regStartIndexInVector + 2] = itNewRegsPS->second.z;
-		m_psRegistersF[regStartIndexInVector + 3] = itNewRegsPS->second.w;
-
-		// register is clean (now matches device state - unless it's stereo in which case it might not, that is handled at the end)
-		dirtyPSRegisters.MarkClean(itNewRegsPS->first);
-		++itNewRegsPS;
+		MarkAllVSStereoConstantsDirty();
 	}
 
-	MarkAllPSStereoConstantsDirty();
+	// pixel shader registers
+	if (storedPSRegisters)
+	{
+		UINT next = 0;
+		while (storedPSRegisters->NextRun(next, start, count)) {
+
+			if ((start + count) >= m_maxPSConstantRegistersF)
+				throw std::out_of_range("Register from stateblock is out of range, implosion imminent");
+
+			const float* pData = storedPSRegisters->Data(start);
+			std::copy(pData, pData + (VECTOR_LENGTH * count), m_psRegistersF.begin() + RegisterIndex(start));
+
+			// registers are clean (now match device state - unless stereo in which case they might not, that is handled at the end)
+			dirtyPSRegisters.MarkRangeClean(start, count);
+			next = start + count;
+		}
+
+		MarkAllPSStereoConstantsDirty();
+	}
 }
 
 /**
@@ -315,64 +330,57 @@ void ShaderRegisters::SetFromStateBlockData(std::vector<float> * storedVSRegiste
 
 /**
 * This will apply all dirty (vertex and pixel shader) registers to actual device. 
-* StereoShaderConstants are updated and applied followed by unmodified.
+* Dirty modified (stereo) constants are updated first, then every run of contiguous dirty registers is
+* applied with one call, modified constants within the run being replaced by their data for the current side.
 * Note that stereo constants will only be applied if the underlying register has changed. To apply a 
-* specific side whether dirty or not use ApplyStereoConstantsVS with forceApply true.
+* specific side whether dirty or not use ApplyAllStereoConstants().
 * @param currentSide Left or Right side.
 ***/
 void ShaderRegisters::ApplyAllDirty(vireio::RenderPosition currentSide) 
 {
-	int start = 0;
-	
 	// vertex shader
-	start = dirtyVSRegisters.FirstDirtyAfter(0);
-	if(start >= 0)
-	{
-		if (m_pActiveVertexShader) {
-			ApplyStereoConstantsVS(currentSide, true);
-		}
-		
-		// Apply all remaining dirty registers (should just be non-stereo that remain dirty) to device
-		start = dirtyVSRegisters.FirstDirtyAfter(0);
-		while(start >= 0) {
-			int end = dirtyVSRegisters.LastInSpan(start);
-			m_pActualDevice->SetVertexShaderConstantF(start, &m_vsRegistersF[RegisterIndex(start)], end-start+1);
-			
-			start = dirtyVSRegisters.FirstDirtyAfter(end+1);
-		}
-		
-		dirtyVSRegisters.MarkAllClean();
-	}
-	
+	ApplyDirtyRegisters(dirtyVSRegisters, m_vsRegistersF, m_vsStereoConstants, currentSide, true);
+
 	// pixel shader
-	start = dirtyPSRegisters.FirstDirtyAfter(0);
-	if(start >= 0)
-	{
-		if (m_pActivePixelShader) {
-			ApplyStereoConstantsPS(currentSide, true);
-		}
-		
-		// Apply all remaining dirty registers (should just be non-stereo that remain dirty) to device
-		start = dirtyPSRegisters.FirstDirtyAfter(0);
-		while(start >= 0) {
-			int end = dirtyPSRegisters.LastInSpan(start);
-			m_pActualDevice->SetPixelShaderConstantF(start, &m_psRegistersF[RegisterIndex(start)], end-start+1);
-			
-			start = dirtyPSRegisters.FirstDirtyAfter(end+1);
-		}
-		
-		dirtyPSRegisters.MarkAllClean();
-	}
+	ApplyDirtyRegisters(dirtyPSRegisters, m_psRegistersF, m_psStereoConstants, currentSide, false);
 }
 
 /**
-* This will apply all (vertex and pixel shader) StereoShaderConstants to the device (updating dirty ones before applying them).
+* This will apply all (vertex and pixel shader) modified constants to the device (updating dirty ones before applying them).
 * @param currentSide Left or Right side.
 ***/
 void ShaderRegisters::ApplyAllStereoConstants(vireio::RenderPosition currentSide)
 {
-	ApplyStereoConstantsVS(currentSide, false);
-	ApplyStereoConstantsPS(currentSide, false);
+	ApplyStereoConstants(dirtyVSRegisters, m_vsRegistersF, m_vsStereoConstants, currentSide, true);
+	ApplyStereoConstants(dirtyPSRegisters, m_psRegistersF, m_psStereoConstants, currentSide, false);
+}
+
+/**
+* Starts a new frame for the upload statistics.
+* The uploads counted so far become the last frame statistics.
+***/
+void ShaderRegisters::NextFrame()
+{
+	m_lastFrameVSUploads = m_vsUploads;
+	m_lastFramePSUploads = m_psUploads;
+	m_vsUploads = ConstantUploadStats();
+	m_psUploads = ConstantUploadStats();
+}
+
+/**
+* Vertex shader constant uploads to the actual device during the last frame.
+***/
+const ConstantUploadStats& ShaderRegisters::GetLastFrameVSUploads() const
+{
+	return m_lastFrameVSUploads;
+}
+
+/**
+* Pixel shader constant uploads to the actual device during the last frame.
+***/
+const ConstantUploadStats& ShaderRegisters::GetLastFramePSUploads() const
+{
+	return m_lastFramePSUploads;
 }
 
 /**
@@ -385,41 +393,8 @@ void ShaderRegisters::ActiveVertexShaderChanged(D3D9ProxyVertexShader* pNewVerte
 	if (m_pActiveVertexShader == pNewVertexShader)
 		return;
 
-	if (pNewVertexShader) {
-
-		std::map<UINT, StereoShaderConstant<float>>* pNewShaderModConstants = pNewVertexShader->ModifiedConstants();
-
-		std::map<UINT, StereoShaderConstant<float>>* pOldShaderModConstants = NULL;
-		if (m_pActiveVertexShader)
-			pOldShaderModConstants = m_pActiveVertexShader->ModifiedConstants();
-
-		// Update the data in new shader constants with data from matching constants from last shader.
-		auto itNewConstants = pNewShaderModConstants->begin();
-		while (itNewConstants != pNewShaderModConstants->end()) {
-
-			bool mightBeDirty = true;
-
-			if (pOldShaderModConstants) {
-				// No idea if this is saving any time or if it would be better to just mark all the registers dirty 
-				// and re-apply the constants on first draw
-				if (m_pActiveVertexShader->ModifiedConstants()->count(itNewConstants->first) == 1) {
-					if (pOldShaderModConstants->at(itNewConstants->first).SameConstantAs(itNewConstants->second)) {
-						(*pNewShaderModConstants).at(itNewConstants->first) = (*pOldShaderModConstants).at(itNewConstants->first);
-						mightBeDirty = false;
-					}
-				}
-			}
-
-			// If there isn't a corresponding old modification then this modified constant will need updating
-			if (mightBeDirty) {
-				dirtyVSRegisters.MarkDirty(itNewConstants->first);
-			}
-
-			++itNewConstants;
-		}
-
-
-	}
+	// Keeps the data of constants that match the constants of the last shader, the others will need updating
+	m_vsStereoConstants.Change(pNewVertexShader ? pNewVertexShader->ModifiedConstants() : NULL, dirtyVSRegisters);
 
 	_SAFE_RELEASE(m_pActiveVertexShader);
 	m_pActiveVertexShader = pNewVertexShader;
@@ -437,41 +412,8 @@ void ShaderRegisters::ActivePixelShaderChanged(D3D9ProxyPixelShader* pNewPixelSh
 	if (m_pActivePixelShader == pNewPixelShader)
 		return;
 
-	if (pNewPixelShader) {
-
-		std::map<UINT, StereoShaderConstant<float>>* pNewShaderModConstants = pNewPixelShader->ModifiedConstants();
-
-		std::map<UINT, StereoShaderConstant<float>>* pOldShaderModConstants = NULL;
-		if (m_pActivePixelShader)
-			pOldShaderModConstants = m_pActivePixelShader->ModifiedConstants();
-
-		// Update the data in new shader constants with data from matching constants from last shader.
-		auto itNewConstants = pNewShaderModConstants->begin();
-		while (itNewConstants != pNewShaderModConstants->end()) {
-
-			bool mightBeDirty = true;
-
-			if (pOldShaderModConstants) {
-				// No idea if this is saving any time or if it would be better to just mark all the registers dirty 
-				// and re-apply the constants on first draw
-				if (m_pActivePixelShader->ModifiedConstants()->count(itNewConstants->first) == 1) {
-					if (pOldShaderModConstants->at(itNewConstants->first).SameConstantAs(itNewConstants->second)) {
-						(*pNewShaderModConstants).at(itNewConstants->first) = (*pOldShaderModConstants).at(itNewConstants->first);
-						mightBeDirty = false;
-					}
-				}
-			}
-
-			// If there isn't a corresponding old modification then this modified constant will need updating
-			if (mightBeDirty) {
-				dirtyPSRegisters.MarkDirty(itNewConstants->first);
-			}
-
-			++itNewConstants;
-		}
-
-
-	}
+	// Keeps the data of constants that match the constants of the last shader, the others will need updating
+	m_psStereoConstants.Change(pNewPixelShader ? pNewPixelShader->ModifiedConstants() : NULL, dirtyPSRegisters);
 
 	_SAFE_RELEASE(m_pActivePixelShader);
 	m_pActivePixelShader = pNewPixelShader;
@@ -484,6 +426,8 @@ void ShaderRegisters::ActivePixelShaderChanged(D3D9ProxyPixelShader* pNewPixelSh
 ***/
 void ShaderRegisters::ReleaseResources()
 {
+	m_vsStereoConstants.Change(NULL, dirtyVSRegisters);
+
 	if (m_pActiveVertexShader)
 		m_pActiveVertexShader->Release();
 
@@ -493,113 +437,144 @@ void ShaderRegisters::ReleaseResources()
 }
 
 /**
-* This will apply all vertex StereoShaderConstants to the device (updating dirty ones before applying them).
+* Applies all dirty registers of one shader type to the actual device, one call per run of contiguous dirty registers.
+* Dirty modified constants are updated and marked dirty as a whole before, so each of them lies completely
+* within one run. Runs containing modified constants are assembled in the upload buffer.
+* @param dirtyRegisters The dirty registers of the shader type, all clean afterwards.
+* @param registers The proxy registers of the shader type.
+* @param stereoConstants The modified constants of the active shader of that type.
 * @param currentSide Left or Right side.
-* @param dirtyOnly Set to true if only dirty registers are to be applied.
+* @param vertexShader True for vertex shader registers, false for pixel shader registers.
 ***/
-void ShaderRegisters::ApplyStereoConstantsVS(vireio::RenderPosition currentSide, const bool dirtyOnly)
+void ShaderRegisters::ApplyDirtyRegisters(RegisterDirtyStore& dirtyRegisters, const std::vector<float>& registers, StereoConstantStore& stereoConstants, vireio::RenderPosition currentSide, bool vertexShader)
 {
-	if (!m_pActiveVertexShader)
+	int start = dirtyRegisters.FirstDirtyAfter(0);
+	if (start < 0)
 		return;
 
-	auto itStereoConstant = m_pActiveVertexShader->ModifiedConstants()->begin();
-	while (itStereoConstant != m_pActiveVertexShader->ModifiedConstants()->end()) {
+	// if any of the registers that make up a constant are dirty update it, all its registers get applied
+	for (UINT i = 0; i < stereoConstants.Size(); i++) {
 
-		// if any of the registers that make up this constant are dirty update before setting
-		if (dirtyVSRegisters.AnyDirty(itStereoConstant->second.StartRegister(), itStereoConstant->second.Count()))
-		{
-			// Should we do this or make this method just switch sides without checking for updated data? 
+		const StereoConstantBinding& stereoConstant = stereoConstants.Binding(i);
+		if (dirtyRegisters.AnyDirty(stereoConstant.startRegister, stereoConstant.count)) {
+
+			stereoConstants.Update(i, &registers[RegisterIndex(stereoConstant.startRegister)]); //HOTSPOT 3.9%
+			dirtyRegisters.MarkRangeDirty(stereoConstant.startRegister, stereoConstant.count);
+		}
+	}
 
-			itStereoConstant->second.Update(&m_vsRegistersF[RegisterIndex(itStereoConstant->second.StartRegister())]);
+	// constants are sorted by start register, runs come in register order too
+	UINT constant = 0;
+	start = dirtyRegisters.FirstDirtyAfter(0);
+	while (start >= 0) {
 
-			if (dirtyOnly) {
-				// Apply this dirty constant to device
-				m_pActualDevice->SetVertexShaderConstantF(itStereoConstant->second.StartRegister(), (currentSide == vireio::Left) ? itStereoConstant->second.DataLeftPointer() : itStereoConstant->second.DataRightPointer(), itStereoConstant->second.Count());
-			}
+		int end = dirtyRegisters.LastInSpan(start);
+		UINT count = (UINT)(end - start + 1);
+		const float* pData = &registers[RegisterIndex(start)];
 
-			// These registers are no longer dirty
-			dirtyVSRegisters.MarkRangeClean(itStereoConstant->second.StartRegister(), itStereoConstant->second.Count());
-		}
+		// skip the (clean) constants before this run
+		while ((constant < stereoConstants.Size()) && (stereoConstants.Binding(constant).startRegister < (UINT)start))
+			constant++;
+
+		// replace the registers of the modified constants in this run by their data for the current side
+		if ((constant < stereoConstants.Size()) && (stereoConstants.Binding(constant).startRegister <= (UINT)end)) {
+
+			std::copy(pData, pData + (VECTOR_LENGTH * count), m_uploadBuffer.begin());
+			while ((constant < stereoConstants.Size()) && (stereoConstants.Binding(constant).startRegister <= (UINT)end)) {
 
-		if (!dirtyOnly) {
-			// Apply this constant to device
-			m_pActualDevice->SetVertexShaderConstantF(itStereoConstant->second.StartRegister(), (currentSide == vireio::Left) ? itStereoConstant->second.DataLeftPointer() : itStereoConstant->second.DataRightPointer(), itStereoConstant->second.Count());
+				const StereoConstantBinding& stereoConstant = stereoConstants.Binding(constant);
+				UINT constantCount = (std::min)(stereoConstant.count, (UINT)end + 1 - stereoConstant.startRegister);
+				const float* pSideData = stereoConstants.Data(constant, currentSide);
+				std::copy(pSideData, pSideData + (VECTOR_LENGTH * constantCount), m_uploadBuffer.begin() + RegisterIndex((stereoConstant.startRegister - start)));
+				constant++;
+			}
+			pData = &m_uploadBuffer[0];
 		}
 
-		++itStereoConstant;
+		UploadConstants(vertexShader, (UINT)start, pData, count);
+		start = dirtyRegisters.FirstDirtyAfter(end + 1);
 	}
+
+	dirtyRegisters.MarkAllClean();
 }
 
 /**
-* This will apply all pixel StereoShaderConstants to the device (updating dirty ones before applying them).
+* Applies all modified constants of one shader type to the actual device (updating dirty ones before applying them).
+* Adjacent constants are applied with one call.
+* @param dirtyRegisters The dirty registers of the shader type.
+* @param registers The proxy registers of the shader type.
+* @param stereoConstants The modified constants of the active shader of that type.
 * @param currentSide Left or Right side.
-* @param dirtyOnly Set to true if only dirty registers are to be applied.
+* @param vertexShader True for vertex shader registers, false for pixel shader registers.
 ***/
-void ShaderRegisters::ApplyStereoConstantsPS(vireio::RenderPosition currentSide, const bool dirtyOnly)
+void ShaderRegisters::ApplyStereoConstants(RegisterDirtyStore& dirtyRegisters, const std::vector<float>& registers, StereoConstantStore& stereoConstants, vireio::RenderPosition currentSide, bool vertexShader)
 {
-	if (!m_pActivePixelShader)
-		return;
+	UINT runStart = 0;
+	UINT runCount = 0;
+	for (UINT i = 0; i < stereoConstants.Size(); i++) {
 
-	auto itStereoConstant = m_pActivePixelShader->ModifiedConstants()->begin();
-	while (itStereoConstant != m_pActivePixelShader->ModifiedConstants()->end()) {
+		const StereoConstantBinding& stereoConstant = stereoConstants.Binding(i);
 
 		// if any of the registers that make up this constant are dirty update before setting
-		if ( dirtyPSRegisters.AnyDirty(itStereoConstant->second.StartRegister(), itStereoConstant->second.Count()))
+		if (dirtyRegisters.AnyDirty(stereoConstant.startRegister, stereoConstant.count))
 		{
-			// Should we do this or make this method just switch sides without checking for updated data? 
-
-			itStereoConstant->second.Update(&m_psRegistersF[RegisterIndex(itStereoConstant->second.StartRegister())]); //HOTSPOT 3.9%
-
-			if (dirtyOnly) {
-				// Apply this dirty constant to device
-				m_pActualDevice->SetPixelShaderConstantF(itStereoConstant->second.StartRegister(), (currentSide == vireio::Left) ? itStereoConstant->second.DataLeftPointer() : itStereoConstant->second.DataRightPointer(), itStereoConstant->second.Count());
-			}
+			stereoConstants.Update(i, &registers[RegisterIndex(stereoConstant.startRegister)]);
 
 			// These registers are no longer dirty
-			dirtyPSRegisters.MarkRangeClean(itStereoConstant->second.StartRegister(), itStereoConstant->second.Count()); //HOTSPOT 4.8%
+			dirtyRegisters.MarkRangeClean(stereoConstant.startRegister, stereoConstant.count);
 		}
 
-		if (!dirtyOnly) {
-			// Apply this constant to device
-			m_pActualDevice->SetPixelShaderConstantF(itStereoConstant->second.StartRegister(), (currentSide == vireio::Left) ? itStereoConstant->second.DataLeftPointer() : itStereoConstant->second.DataRightPointer(), itStereoConstant->second.Count());
+		// not adjacent to the constants collected so far, apply them
+		if ((runCount > 0) && (stereoConstant.startRegister != runStart + runCount)) {
+			UploadConstants(vertexShader, runStart, &m_uploadBuffer[0], runCount);
+			runCount = 0;
 		}
+		if (runCount == 0)
+			runStart = stereoConstant.startRegister;
 
-		++itStereoConstant;
+		const float* pSideData = stereoConstants.Data(i, currentSide);
+		std::copy(pSideData, pSideData + (VECTOR_LENGTH * stereoConstant.count), m_uploadBuffer.begin() + RegisterIndex(runCount));
+		runCount += stereoConstant.count;
 	}
+
+	if (runCount > 0)
+		UploadConstants(vertexShader, runStart, &m_uploadBuffer[0], runCount);
 }
 
 /**
-* Marks all pixel shader StereoShaderConstants dirty so they are updated before drawing.
+* Applies shader constant registers to the actual device and counts the upload.
+* @param vertexShader True for vertex shader registers, false for pixel shader registers.
 ***/
-void ShaderRegisters::MarkAllVSStereoConstantsDirty()
+void ShaderRegisters::UploadConstants(bool vertexShader, UINT startRegister, const float* pData, UINT count)
 {
-	// vertex shader
-	if (m_pActiveVertexShader) {
-		// Mark all StereoShaderConstants dirty so they are updated before drawing
-		auto itStereoConstant = m_pActiveVertexShader->ModifiedConstants()->begin();
-		while (itStereoConstant != m_pActiveVertexShader->ModifiedConstants()->end()) {
-
-			dirtyVSRegisters.MarkDirty(itStereoConstant->first);
-			++itStereoConstant;
-		}
+	if (vertexShader) {
+		m_pActualDevice->SetVertexShaderConstantF(startRegister, pData, count);
+		m_vsUploads.Add(count);
+	}
+	else {
+		m_pActualDevice->SetPixelShaderConstantF(startRegister, pData, count);
+		m_psUploads.Add(count);
 	}
 }
 
 /**
-* Marks all pixel shader StereoShaderConstants dirty so they are updated before drawing.
+* Marks all vertex shader modified constants dirty so they are updated before drawing.
 ***/
-void ShaderRegisters::MarkAllPSStereoConstantsDirty()
+void ShaderRegisters::MarkAllVSStereoConstantsDirty()
 {
-	// pixel shader
-	if (m_pActivePixelShader) {
-		// Mark all StereoShaderConstants dirty so they are updated before drawing
-		auto itStereoConstant = m_pActivePixelShader->ModifiedConstants()->begin();
-		while (itStereoConstant != m_pActivePixelShader->ModifiedConstants()->end()) {
+	// Mark all modified constants dirty so they are updated before drawing
+	if (m_pActiveVertexShader)
+		m_vsStereoConstants.MarkAllDirty(dirtyVSRegisters);
+}
 
-			dirtyPSRegisters.MarkDirty(itStereoConstant->first);
-			++itStereoConstant;
-		}
-	}
+/**
+* Marks all pixel shader modified constants dirty so they are updated before drawing.
+***/
+void ShaderRegisters::MarkAllPSStereoConstantsDirty()
+{
+	// Mark all modified constants dirty so they are updated before drawing
+	if (m_pActivePixelShader)
+		m_psStereoConstants.MarkAllDirty(dirtyPSRegisters);
 }
 
 
@@ -721,3 +696,256 @@ void RegisterDirtyStore::Expand(UINT capacity)
 		dirtyRegisters.push_back(0);
 	}
 }
+
+/**
+* Constructor, nothing selected.
+***/
+RegisterCaptureStore::RegisterCaptureStore() :
+	selectedMask(),
+	storedRegisters()
+{
+}
+
+/**
+* Adds the registers to the selection, the data of newly selected registers is undefined until stored or captured.
+* @param start Start register.
+* @param count Register count.
+***/
+void RegisterCaptureStore::Select(UINT start, UINT count)
+{
+	if (!count)
+		return;
+
+	Expand(start + count);
+
+	UINT end = start + count;
+	UINT index = start;
+	while (index < end) {
+		UINT bit = index & 31;
+		UINT bits = ((end - index) < (32 - bit)) ? (end - index) : (32 - bit);
+		uint32_t mask = (bits == 32) ? 0xFFFFFFFF : (((1u << bits) - 1) << bit);
+		selectedMask[index >> 5] |= mask;
+		index += bits;
+	}
+}
+
+/**
+* Selects the registers and stores their data (later stores to the same register overwrite earlier ones).
+* @param start Start register.
+* @param pData Register data, VECTOR_LENGTH floats per register.
+* @param count Register count.
+***/
+void RegisterCaptureStore::Store(UINT start, const float* pData, UINT count)
+{
+	Select(start, count);
+	std::copy(pData, pData + (VECTOR_LENGTH * count), storedRegisters.begin() + RegisterIndex(start));
+}
+
+/**
+* Copies all selected registers from a full register vector, one block copy per run.
+* Selected registers beyond the end of the vector are left untouched.
+* @param registers Register vector, VECTOR_LENGTH floats per register. @see ShaderRegisters::GetAllVSConstantRegistersF()
+***/
+void RegisterCaptureStore::CaptureFrom(const std::vector<float>& registers)
+{
+	UINT registerCount = (UINT)(registers.size() / VECTOR_LENGTH);
+	UINT start = 0;
+	UINT count = 0;
+	UINT next = 0;
+	while (NextRun(next, start, count) && (start < registerCount)) {
+
+		if (count > registerCount - start)
+			count = registerCount - start;
+		std::copy(registers.begin() + RegisterIndex(start), registers.begin() + RegisterIndex(start) + (VECTOR_LENGTH * count), storedRegisters.begin() + RegisterIndex(start));
+		next = start + count;
+	}
+}
+
+/**
+* True if the register is selected.
+***/
+bool RegisterCaptureStore::IsSelected(UINT index) const
+{
+	if ((index >> 5) >= selectedMask.size())
+		return false;
+	return (selectedMask[index >> 5] & (1u << (index & 31))) != 0;
+}
+
+/**
+* True if any register is selected.
+***/
+bool RegisterCaptureStore::AnySelected() const
+{
+	for (auto it = selectedMask.begin(); it != selectedMask.end(); ++it) {
+		if (*it)
+			return true;
+	}
+	return false;
+}
+
+/**
+* Finds the next run of contiguous selected registers.
+* Skips unselected words and scans full words 32 registers at a time.
+* @param from First register to look at.
+* @param start [out] First register of the run.
+* @param count [out] Number of registers in the run.
+* @return False if there is no selected register at or after from.
+***/
+bool RegisterCaptureStore::NextRun(UINT from, UINT& start, UINT& count) const
+{
+	UINT size = (UINT)selectedMask.size() * 32;
+	UINT index = from;
+	unsigned long bit;
+
+	// first selected register
+	while (index < size) {
+		uint32_t word = selectedMask[index >> 5] >> (index & 31);
+		if (_BitScanForward(&bit, word)) {
+			index += bit;
+			break;
+		}
+		index = (index | 31) + 1;
+	}
+	if (index >= size)
+		return false;
+	start = index;
+
+	// first unselected register after (shifted in zero bits count as selected, the next word decides)
+	while (index < size) {
+		uint32_t word = ~selectedMask[index >> 5] >> (index & 31);
+		if (_BitScanForward(&bit, word)) {
+			index += bit;
+			break;
+		}
+		index = (index | 31) + 1;
+	}
+	count = ((index < size) ? index : size) - start;
+	return true;
+}
+
+/**
+* Stored data of a selected register.
+***/
+const float* RegisterCaptureStore::Data(UINT index) const
+{
+	return &storedRegisters[RegisterIndex(index)];
+}
+
+/**
+* Clears selection and data.
+***/
+void RegisterCaptureStore::Clear()
+{
+	selectedMask.clear();
+	storedRegisters.clear();
+}
+
+/**
+* Grows mask and data to hold the register count, never shrinks.
+***/
+void RegisterCaptureStore::Expand(UINT registerCount)
+{
+	if (registerCount <= selectedMask.size() * 32)
+		return;
+
+	UINT words = (registerCount + 31) >> 5;
+	selectedMask.resize(words, 0);
+	storedRegisters.resize(words * 32 * VECTOR_LENGTH, 0.0f);
+}
+
+/**
+* Constructor, no modified constants.
+***/
+StereoConstantStore::StereoConstantStore() :
+	m_pConstants(NULL),
+	m_sides(),
+	m_previousSides()
+{
+}
+
+/**
+* Changes to the modified constants of a new shader.
+* Constants with the same registers and the same modification as in the last set keep their data,
+* the others are marked dirty to be updated before drawing.
+* @param pNewConstants The modified constants of the new shader (NULL if none).
+* @param dirtyRegisters The dirty registers of the shader type.
+***/
+void StereoConstantStore::Change(const StereoConstantSet* pNewConstants, RegisterDirtyStore& dirtyRegisters)
+{
+	// same (interned) set, all data stays valid
+	if (pNewConstants == m_pConstants)
+		return;
+
+	const StereoConstantSet* pOldConstants = m_pConstants;
+	m_pConstants = pNewConstants;
+	if (!pNewConstants)
+		return;
+
+	m_previousSides.swap(m_sides);
+	if (m_sides.size() < pNewConstants->Size())
+		m_sides.resize(pNewConstants->Size());
+
+	for (UINT i = 0; i < pNewConstants->Size(); i++) {
+
+		const StereoConstantBinding& binding = (*pNewConstants)[i];
+		ConstantSides& sides = m_sides[i];
+
+		int oldIndex = pOldConstants ? pOldConstants->Find(binding.startRegister) : -1;
+		if ((oldIndex >= 0) &&
+			((*pOldConstants)[oldIndex].count == binding.count) &&
+			((*pOldConstants)[oldIndex].modification == binding.modification)) {
+
+			sides.left.swap(m_previousSides[oldIndex].left);
+			sides.right.swap(m_previousSides[oldIndex].right);
+		}
+		else {
+
+			sides.left.resize(binding.count * VECTOR_LENGTH);
+			sides.right.resize(binding.count * VECTOR_LENGTH);
+			dirtyRegisters.MarkDirty(binding.startRegister);
+		}
+	}
+}
+
+/**
+* Marks the start registers of all modified constants dirty.
+***/
+void StereoConstantStore::MarkAllDirty(RegisterDirtyStore& dirtyRegisters) const
+{
+	for (UINT i = 0; i < Size(); i++)
+		dirtyRegisters.MarkDirty((*m_pConstants)[i].startRegister);
+}
+
+/**
+* Number of modified constants.
+***/
+UINT StereoConstantStore::Size() const
+{
+	return m_pConstants ? m_pConstants->Size() : 0;
+}
+
+/**
+* The modified constant at that position.
+***/
+const StereoConstantBinding& StereoConstantStore::Binding(UINT index) const
+{
+	return (*m_pConstants)[index];
+}
+
+/**
+* Applies the modification of the constant to the specified register data.
+* @param index Position of the constant.
+* @param pData Register data of the constant (count registers).
+***/
+void StereoConstantStore::Update(UINT index, const float* pData)
+{
+	(*m_pConstants)[index].modification->ApplyModification(pData, &m_sides[index].left, &m_sides[index].right);
+}
+
+/**
+* Left or right data of the constant.
+***/
+const float* StereoConstantStore::Data(UINT index, vireio::RenderPosition side) const
+{
+	return (side == vireio::Left) ? &m_sides[index].left[0] : &m_sides[index].right[0];
+}
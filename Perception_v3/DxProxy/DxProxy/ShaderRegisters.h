@@ -36,9 +36,11 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "d3d9.h"
 #include "d3dx9.h"
 #include <vector>
+#include <stdint.h>
 #include <set>
 #include <map>
 #include <algorithm>
+#include "StereoConstantSet.h"
 #include "D3D9ProxyPixelShader.h"
 #include "D3D9ProxyVertexShader.h"
 #include "Vireio.h"
@@ -69,10 +71,113 @@ public:
 	UINT lastDirtyReg;
 };
 
+/**
+* Selected shader constant registers and their data, as captured by a proxy state block.
+* Selection is a bitmask (one bit per register), data is stored dense by register index up to the
+* highest selected register. Contiguous selected registers form runs, which are captured and
+* applied as one block copy each. @see NextRun()
+***/
+class RegisterCaptureStore
+{
+public:
+	RegisterCaptureStore();
+	void Select(UINT start, UINT count);
+	void Store(UINT start, const float* pData, UINT count);
+	void CaptureFrom(const std::vector<float>& registers);
+	bool IsSelected(UINT index) const;
+	bool AnySelected() const;
+	bool NextRun(UINT from, UINT& start, UINT& count) const;
+	const float* Data(UINT index) const;
+	void Clear();
+
+private:
+	void Expand(UINT registerCount);
+
+	/**
+	* Selected registers, bit (index & 31) of word (index >> 5).
+	***/
+	std::vector<uint32_t> selectedMask;
+	/**
+	* Captured register data, VECTOR_LENGTH floats per register, only valid for selected registers.
+	***/
+	std::vector<float> storedRegisters;
+};
+
+/**
+* Left and right data of the modified constants of the active shader.
+* The modified constants are the interned StereoConstantSet of the shader, their data is kept here
+* (one entry per constant, in set order). Switching to a shader keeps the data of all constants
+* that are the same in both sets, switching between shaders sharing one set keeps all data.
+***/
+class StereoConstantStore
+{
+public:
+	StereoConstantStore();
+	void Change(const StereoConstantSet* pNewConstants, RegisterDirtyStore& dirtyRegisters);
+	void MarkAllDirty(RegisterDirtyStore& dirtyRegisters) const;
+	UINT Size() const;
+	const StereoConstantBinding& Binding(UINT index) const;
+	void Update(UINT index, const float* pData);
+	const float* Data(UINT index, vireio::RenderPosition side) const;
+
+private:
+	/**
+	* Left and right data of one modified constant.
+	***/
+	struct ConstantSides
+	{
+		std::vector<float> left;
+		std::vector<float> right;
+	};
+
+	/**
+	* Modified constants of the active shader, NULL if none.
+	***/
+	const StereoConstantSet* m_pConstants;
+	/**
+	* Data of the modified constants, in set order (may hold more entries than the set, reused).
+	***/
+	std::vector<ConstantSides> m_sides;
+	/**
+	* Data of the previous set while changing, swapped with m_sides to reuse the allocations.
+	***/
+	std::vector<ConstantSides> m_previousSides;
+};
+
+/**
+* Shader constant uploads to the actual device (of one shader type during one frame).
+***/
+struct ConstantUploadStats
+{
+	ConstantUploadStats() : calls(0), registers(0), bytes(0) {}
+	/**
+	* Counts one upload of that many registers.
+	***/
+	void Add(UINT count)
+	{
+		calls++;
+		registers += count;
+		bytes += count * VECTOR_LENGTH * sizeof(float);
+	}
+
+	/**
+	* Number of Set*ShaderConstantF() calls.
+	***/
+	UINT calls;
+	/**
+	* Number of registers uploaded.
+	***/
+	UINT registers;
+	/**
+	* Number of bytes uploaded.
+	***/
+	UINT bytes;
+};
+
 /**
 * Managed shader register class.
 * All shader registers stored, updated and applied to device here. 
-* Register update ONLY in ApplyStereoConstantsVS().
+* Register update ONLY in ApplyDirtyRegisters() and ApplyStereoConstants().
 */
 class ShaderRegisters
 {
@@ -85,11 +190,11 @@ public:
 	HRESULT WINAPI     GetVertexShaderConstantF(UINT StartRegister, float* pConstantData, UINT Vector4fCount);
 	HRESULT WINAPI     SetPixelShaderConstantF(UINT StartRegister, const float* pConstantData, UINT Vector4fCount);
 	HRESULT WINAPI     GetPixelShaderConstantF(UINT StartRegister, float* pConstantData, UINT Vector4fCount);
-	std::vector<float> GetAllVSConstantRegistersF();
-	std::vector<float> GetAllPSConstantRegistersF();	
+	const std::vector<float>& GetAllVSConstantRegistersF();
+	const std::vector<float>& GetAllPSConstantRegistersF();	
 	void               SetFromStateBlockVertexShader(D3D9ProxyVertexShader* storedVShader);
 	void               SetFromStateBlockPixelShader(D3D9ProxyPixelShader* storedPShader);
-	void               SetFromStateBlockData(std::map<UINT, D3DXVECTOR4> * storedVSRegisters, std::map<UINT, D3DXVECTOR4> * storedPSRegisters);
+	void               SetFromStateBlockData(RegisterCaptureStore * storedVSRegisters, RegisterCaptureStore * storedPSRegisters);
 	void               SetFromStateBlockData(std::vector<float> * storedVSRegisters, std::vector<float> * storedPSRegisters);
 	bool               AnyDirtyVS(UINT start, UINT count);
 	bool               AnyDirtyPS(UINT start, UINT count);
@@ -98,11 +203,15 @@ public:
 	void               ActiveVertexShaderChanged(D3D9ProxyVertexShader* pNewVertexShader);
 	void               ActivePixelShaderChanged(D3D9ProxyPixelShader* pNewPixelShader);
 	void               ReleaseResources();
+	void               NextFrame();
+	const ConstantUploadStats& GetLastFrameVSUploads() const;
+	const ConstantUploadStats& GetLastFramePSUploads() const;
 
 private:
 	/*** ShaderRegisters private methods ***/
-	void ApplyStereoConstantsVS(vireio::RenderPosition currentSide, const bool dirtyOnly);	
-	void ApplyStereoConstantsPS(vireio::RenderPosition currentSide, const bool dirtyOnly);
+	void ApplyDirtyRegisters(RegisterDirtyStore& dirtyRegisters, const std::vector<float>& registers, StereoConstantStore& stereoConstants, vireio::RenderPosition currentSide, bool vertexShader);
+	void ApplyStereoConstants(RegisterDirtyStore& dirtyRegisters, const std::vector<float>& registers, StereoConstantStore& stereoConstants, vireio::RenderPosition currentSide, bool vertexShader);
+	void UploadConstants(bool vertexShader, UINT startRegister, const float* pData, UINT count);
 	void MarkAllVSStereoConstantsDirty();
 	void MarkAllPSStereoConstantsDirty();
 
@@ -111,11 +220,13 @@ private:
 
 	/**
 	* Currently active vertex shader.
-	* <StartRegister, ModifiedConstant starting at start register>
-	* const std::map<UINT, StereoShaderConstant<float>>* m_activeModifications;
 	***/
 	D3D9ProxyVertexShader* m_pActiveVertexShader;
 	/**
+	* Modified constants of the active vertex shader and their left and right data.
+	***/
+	StereoConstantStore m_vsStereoConstants;
+	/**
 	* Number of vertex shader constant registers supported by device.
 	***/
 	DWORD m_maxVSConstantRegistersF;
@@ -129,11 +240,13 @@ private:
 	std::vector<float> m_vsRegistersF;
 	/**
 	* Currently active pixel shader.
-	* <StartRegister, ModifiedConstant starting at start register>
-	* const std::map<UINT, StereoShaderConstant<float>>* m_activeModifications;
 	***/
 	D3D9ProxyPixelShader* m_pActivePixelShader;
 	/**
+	* Modified constants of the active pixel shader and their left and right data.
+	***/
+	StereoConstantStore m_psStereoConstants;
+	/**
 	* Number of pixel shader constant registers supported by current shader version.
 	***/
 	DWORD m_maxPSConstantRegistersF;
@@ -149,5 +262,20 @@ private:
 	* Actual Direct3D Device pointer embedded. 
 	***/
 	IDirect3DDevice9* m_pActualDevice;
+	/**
+	* Register data of one upload when modified and unmodified registers are merged.
+	* Sized for the larger register set of both shader types.
+	***/
+	std::vector<float> m_uploadBuffer;
+	/**
+	* Vertex and pixel shader constant uploads in the current frame.
+	***/
+	ConstantUploadStats m_vsUploads;
+	ConstantUploadStats m_psUploads;
+	/**
+	* Vertex and pixel shader constant uploads in the last frame.
+	***/
+	ConstantUploadStats m_lastFrameVSUploads;
+	ConstantUploadStats m_lastFramePSUploads;
 };
 #endif
\ No newline at end of file
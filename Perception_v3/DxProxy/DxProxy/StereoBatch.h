@@ -0,0 +1,625 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <StereoBatch.h> and
+Class <StereoBatch> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#ifndef STEREOBATCH_H_INCLUDED
+#define STEREOBATCH_H_INCLUDED
+
+#include <d3d9.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#include "BindingSlots.h"
+#include "RenderStateShadow.h"
+
+/**
+* Number of vertex shader float constant registers a stereo batch records (vs_3_0).
+***/
+#define STEREO_BATCH_VS_CONSTANTS 256
+/**
+* Number of pixel shader float constant registers a stereo batch records (ps_3_0).
+***/
+#define STEREO_BATCH_PS_CONSTANTS 224
+
+/**
+* Command list of a run of draws for one stereo side, replayed for the other side after a single
+* drawing side switch.
+* Recorded are the game calls that only change bound state (textures, shaders, float constants,
+* streams, indices, vertex declaration, render/sampler/texture stage states) and the draws. Any
+* other call flushes the batch : the device switches the drawing side once and replays the batch
+* through its own setters, so the eye dependent state is patched the same way as for the game calls.
+* The state of every slot a run touches is recorded on first touch, the replay restores it before
+* the commands so the other side starts out the same. After the replay the state is the same as after
+* the recorded run. All interfaces the batch refers to are held (AddRef) until the batch is cleared,
+* the data of the user pointer draws is copied.
+*/
+class StereoBatch
+{
+public:
+	/**
+	* Recorded commands.
+	***/
+	enum CommandType
+	{
+		Texture,
+		VertexShader,
+		PixelShader,
+		VertexShaderConstantF,
+		PixelShaderConstantF,
+		StreamSource,
+		Indices,
+		VertexDeclaration,
+		State,
+		DrawPrimitive,
+		DrawIndexedPrimitive,
+		DrawPrimitiveUP,
+		DrawIndexedPrimitiveUP
+	};
+	/**
+	* One recorded command, the arguments in call order. Constants and user pointer data are
+	* stored in the data block, at the offsets in data[].
+	***/
+	struct Command
+	{
+		CommandType type;
+		DWORD args[6];
+		IUnknown* pObject;
+		size_t data[2];
+	};
+
+	/**
+	* Constructor, empty batch.
+	***/
+	StereoBatch() :
+		m_drawCount(0),
+		m_replaying(false)
+	{
+		for (UINT i = 0; i < INITIAL_OBJECTS; i++) {
+			m_initialObjects[i] = NULL;
+			m_initialObjectKnown[i] = false;
+		}
+		for (UINT i = 0; i < BINDING_VERTEX_STREAMS; i++) {
+			m_initialStreamOffset[i] = 0;
+			m_initialStreamStride[i] = 0;
+		}
+		for (UINT i = 0; i < CONSTANT_MASK_WORDS; i++) {
+			m_initialVSConstantMask[i] = 0;
+			m_initialPSConstantMask[i] = 0;
+		}
+	}
+	/**
+	* Destructor, releases all interfaces held.
+	***/
+	~StereoBatch()
+	{
+		Clear();
+	}
+
+	/**
+	* True if nothing is recorded.
+	***/
+	bool IsEmpty() const { return m_commands.empty(); }
+	/**
+	* Number of recorded draws.
+	***/
+	UINT GetDrawCount() const { return m_drawCount; }
+	/**
+	* Number of recorded commands (draws included, initial state not).
+	***/
+	UINT GetCommandCount() const { return (UINT)m_commands.size(); }
+	/**
+	* True between BeginReplay() and EndReplay(), nothing gets recorded then.
+	***/
+	bool IsReplaying() const { return m_replaying; }
+
+	/**
+	* Records a texture.
+	* @param pPrevious The texture bound to that stage before.
+	* @return False if the stage can't be recorded, flush the batch then.
+	***/
+	bool RecordTexture(DWORD Stage, IDirect3DBaseTexture9* pTexture, IDirect3DBaseTexture9* pPrevious)
+	{
+		UINT slot = TextureStageToSlot(Stage);
+		if (slot == BINDING_INVALID_SLOT)
+			return false;
+		if (!m_initialTextures.IsBound(slot))
+			m_initialTextures.Bind(slot, pPrevious);
+		Add(Texture, pTexture, Stage);
+		return true;
+	}
+	/**
+	* Records a vertex shader.
+	* @param pPrevious The vertex shader set before.
+	***/
+	void RecordVertexShader(IDirect3DVertexShader9* pShader, IDirect3DVertexShader9* pPrevious)
+	{
+		InitialObject(VertexShader, pPrevious);
+		Add(VertexShader, pShader);
+	}
+	/**
+	* Records a pixel shader.
+	* @param pPrevious The pixel shader set before.
+	***/
+	void RecordPixelShader(IDirect3DPixelShader9* pShader, IDirect3DPixelShader9* pPrevious)
+	{
+		InitialObject(PixelShader, pPrevious);
+		Add(PixelShader, pShader);
+	}
+	/**
+	* Records vertex shader float constants.
+	* @param pPrevious All vertex shader constant registers before the call (4 floats per register),
+	* only read for registers not touched before.
+	* @return False if the registers can't be recorded, flush the batch then.
+	***/
+	bool RecordVertexShaderConstantF(UINT StartRegister, CONST float* pConstantData, UINT Vector4fCount, CONST float* pPrevious)
+	{
+		return RecordConstants(VertexShaderConstantF, StartRegister, pConstantData, Vector4fCount, pPrevious);
+	}
+	/**
+	* Records pixel shader float constants.
+	* @param pPrevious All pixel shader constant registers before the call (4 floats per register),
+	* only read for registers not touched before.
+	* @return False if the registers can't be recorded, flush the batch then.
+	***/
+	bool RecordPixelShaderConstantF(UINT StartRegister, CONST float* pConstantData, UINT Vector4fCount, CONST float* pPrevious)
+	{
+		return RecordConstants(PixelShaderConstantF, StartRegister, pConstantData, Vector4fCount, pPrevious);
+	}
+	/**
+	* True if the stream was not touched in this run, call RecordInitialStream() before the first
+	* command touching it then (the previous stream is not known without asking the device).
+	***/
+	bool NeedsInitialStream(UINT StreamNumber) const
+	{
+		return (StreamNumber < BINDING_VERTEX_STREAMS) && !m_initialStreams.IsBound(StreamNumber);
+	}
+	/**
+	* Records the stream source the run starts with.
+	***/
+	void RecordInitialStream(UINT StreamNumber, IDirect3DVertexBuffer9* pStreamData, UINT OffsetInBytes, UINT Stride)
+	{
+		if (!NeedsInitialStream(StreamNumber))
+			return;
+		m_initialStreams.Bind(StreamNumber, pStreamData);
+		m_initialStreamOffset[StreamNumber] = OffsetInBytes;
+		m_initialStreamStride[StreamNumber] = Stride;
+	}
+	/**
+	* Records a stream source, the initial stream must be recorded before.
+	* @return False if the stream can't be recorded, flush the batch then.
+	***/
+	bool RecordStreamSource(UINT StreamNumber, IDirect3DVertexBuffer9* pStreamData, UINT OffsetInBytes, UINT Stride)
+	{
+		if (StreamNumber >= BINDING_VERTEX_STREAMS)
+			return false;
+		Add(StreamSource, pStreamData, StreamNumber, OffsetInBytes, Stride);
+		return true;
+	}
+	/**
+	* Records the index buffer the run starts with, if not yet touched.
+	***/
+	void RecordInitialIndices(IDirect3DIndexBuffer9* pPrevious)
+	{
+		InitialObject(Indices, pPrevious);
+	}
+	/**
+	* Records an index buffer.
+	* @param pPrevious The index buffer set before.
+	***/
+	void RecordIndices(IDirect3DIndexBuffer9* pIndexData, IDirect3DIndexBuffer9* pPrevious)
+	{
+		InitialObject(Indices, pPrevious);
+		Add(Indices, pIndexData);
+	}
+	/**
+	* Records a vertex declaration.
+	* @param pPrevious The vertex declaration set before.
+	***/
+	void RecordVertexDeclaration(IDirect3DVertexDeclaration9* pDecl, IDirect3DVertexDeclaration9* pPrevious)
+	{
+		InitialObject(VertexDeclaration, pPrevious);
+		Add(VertexDeclaration, pDecl);
+	}
+	/**
+	* True if the state was not touched in this run, call RecordInitialState() before RecordState() then.
+	* @param index Render state shadow index. @see RenderStateShadow
+	***/
+	bool NeedsInitialState(UINT index) const
+	{
+		return (index < SHADOW_STATE_COUNT) && !m_initialStates.IsKnown(index);
+	}
+	/**
+	* Records the state value the run starts with.
+	***/
+	void RecordInitialState(UINT index, DWORD value)
+	{
+		if (NeedsInitialState(index))
+			m_initialStates.Set(index, value);
+	}
+	/**
+	* Records a render, sampler or texture stage state, the initial value must be recorded before.
+	* @param index Render state shadow index. @see RenderStateShadow
+	* @return False if the state is not shadowed, flush the batch then.
+	***/
+	bool RecordState(UINT index, DWORD value)
+	{
+		if (index >= SHADOW_STATE_COUNT)
+			return false;
+		Add(State, NULL, index, value);
+		return true;
+	}
+
+	/**
+	* Records a draw.
+	***/
+	void RecordDrawPrimitive(D3DPRIMITIVETYPE PrimitiveType, UINT StartVertex, UINT PrimitiveCount)
+	{
+		Add(DrawPrimitive, NULL, (DWORD)PrimitiveType, StartVertex, PrimitiveCount);
+		m_drawCount++;
+	}
+	/**
+	* Records an indexed draw.
+	***/
+	void RecordDrawIndexedPrimitive(D3DPRIMITIVETYPE PrimitiveType, INT BaseVertexIndex, UINT MinVertexIndex, UINT NumVertices, UINT startIndex, UINT primCount)
+	{
+		Add(DrawIndexedPrimitive, NULL, (DWORD)PrimitiveType, (DWORD)BaseVertexIndex, MinVertexIndex, NumVertices, startIndex, primCount);
+		m_drawCount++;
+	}
+	/**
+	* Records a user pointer draw, the vertex data is copied. Stream 0 is reset by the draw, record the
+	* initial stream 0 before.
+	***/
+	void RecordDrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT PrimitiveCount, CONST void* pVertexStreamZeroData, UINT VertexStreamZeroStride)
+	{
+		Add(DrawPrimitiveUP, NULL, (DWORD)PrimitiveType, PrimitiveCount, VertexStreamZeroStride);
+		m_commands.back().data[0] = AddData(pVertexStreamZeroData, VertexCount(PrimitiveType, PrimitiveCount) * VertexStreamZeroStride);
+		m_drawCount++;
+	}
+	/**
+	* Records an indexed user pointer draw, the vertex and index data is copied. Stream 0 and the
+	* indices are reset by the draw, record the initial stream 0 and indices before.
+	***/
+	void RecordDrawIndexedPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT MinVertexIndex, UINT NumVertices, UINT PrimitiveCount, CONST void* pIndexData, D3DFORMAT IndexDataFormat, CONST void* pVertexStreamZeroData, UINT VertexStreamZeroStride)
+	{
+		Add(DrawIndexedPrimitiveUP, NULL, (DWORD)PrimitiveType, MinVertexIndex, NumVertices, PrimitiveCount, (DWORD)IndexDataFormat, VertexStreamZeroStride);
+		UINT indexSize = (IndexDataFormat == D3DFMT_INDEX32) ? 4 : 2;
+		m_commands.back().data[0] = AddData(pIndexData, VertexCount(PrimitiveType, PrimitiveCount) * indexSize);
+		m_commands.back().data[1] = AddData(pVertexStreamZeroData, (MinVertexIndex + NumVertices) * VertexStreamZeroStride);
+		m_drawCount++;
+	}
+
+	/**
+	* Starts the replay, nothing is recorded until EndReplay().
+	***/
+	void BeginReplay() { m_replaying = true; }
+	/**
+	* Restores the state the run started with and replays the commands on the device.
+	* Calls the setters and draws of the Device class non virtually (the proxy device methods,
+	* not the methods of a derived class that already did their part when the game called).
+	***/
+	template <class Device> void Replay(Device* pDevice)
+	{
+		// the state the run started with
+		uint32_t mask = m_initialTextures.GetBoundMask();
+		for (UINT slot = 0; mask; slot++, mask >>= 1)
+			if (mask & 1)
+				pDevice->Device::SetTexture(SlotToTextureStage(slot), m_initialTextures.Get(slot));
+		if (m_initialObjectKnown[VertexDeclaration])
+			pDevice->Device::SetVertexDeclaration(static_cast<IDirect3DVertexDeclaration9*>(m_initialObjects[VertexDeclaration]));
+		if (m_initialObjectKnown[VertexShader])
+			pDevice->Device::SetVertexShader(static_cast<IDirect3DVertexShader9*>(m_initialObjects[VertexShader]));
+		if (m_initialObjectKnown[PixelShader])
+			pDevice->Device::SetPixelShader(static_cast<IDirect3DPixelShader9*>(m_initialObjects[PixelShader]));
+		if (m_initialObjectKnown[Indices])
+			pDevice->Device::SetIndices(static_cast<IDirect3DIndexBuffer9*>(m_initialObjects[Indices]));
+		mask = m_initialStreams.GetBoundMask();
+		for (UINT stream = 0; mask; stream++, mask >>= 1)
+			if (mask & 1)
+				pDevice->Device::SetStreamSource(stream, m_initialStreams.Get(stream), m_initialStreamOffset[stream], m_initialStreamStride[stream]);
+		for (UINT index = m_initialStates.NextKnown(0); index != SHADOW_INVALID_INDEX; index = m_initialStates.NextKnown(index + 1)) {
+			DWORD value = 0;
+			m_initialStates.Get(index, &value);
+			ReplayState(pDevice, index, value);
+		}
+		ReplayInitialConstants(pDevice, true);
+		ReplayInitialConstants(pDevice, false);
+
+		// the run
+		for (size_t i = 0; i < m_commands.size(); i++) {
+			const Command& command = m_commands[i];
+			switch (command.type) {
+			case Texture:
+				pDevice->Device::SetTexture(command.args[0], static_cast<IDirect3DBaseTexture9*>(command.pObject));
+				break;
+			case VertexShader:
+				pDevice->Device::SetVertexShader(static_cast<IDirect3DVertexShader9*>(command.pObject));
+				break;
+			case PixelShader:
+				pDevice->Device::SetPixelShader(static_cast<IDirect3DPixelShader9*>(command.pObject));
+				break;
+			case VertexShaderConstantF:
+				pDevice->Device::SetVertexShaderConstantF(command.args[0], (CONST float*)&m_data[command.data[0]], command.args[1]);
+				break;
+			case PixelShaderConstantF:
+				pDevice->Device::SetPixelShaderConstantF(command.args[0], (CONST float*)&m_data[command.data[0]], command.args[1]);
+				break;
+			case StreamSource:
+				pDevice->Device::SetStreamSource(command.args[0], static_cast<IDirect3DVertexBuffer9*>(command.pObject), command.args[1], command.args[2]);
+				break;
+			case Indices:
+				pDevice->Device::SetIndices(static_cast<IDirect3DIndexBuffer9*>(command.pObject));
+				break;
+			case VertexDeclaration:
+				pDevice->Device::SetVertexDeclaration(static_cast<IDirect3DVertexDeclaration9*>(command.pObject));
+				break;
+			case State:
+				ReplayState(pDevice, command.args[0], command.args[1]);
+				break;
+			case DrawPrimitive:
+				pDevice->Device::DrawPrimitive((D3DPRIMITIVETYPE)command.args[0], command.args[1], command.args[2]);
+				break;
+			case DrawIndexedPrimitive:
+				pDevice->Device::DrawIndexedPrimitive((D3DPRIMITIVETYPE)command.args[0], (INT)command.args[1], command.args[2], command.args[3], command.args[4], command.args[5]);
+				break;
+			case DrawPrimitiveUP:
+				pDevice->Device::DrawPrimitiveUP((D3DPRIMITIVETYPE)command.args[0], command.args[1], DataPointer(command.data[0]), command.args[2]);
+				break;
+			case DrawIndexedPrimitiveUP:
+				pDevice->Device::DrawIndexedPrimitiveUP((D3DPRIMITIVETYPE)command.args[0], command.args[1], command.args[2], command.args[3],
+					DataPointer(command.data[0]), (D3DFORMAT)command.args[4], DataPointer(command.data[1]), command.args[5]);
+				break;
+			}
+		}
+	}
+	/**
+	* Ends the replay and clears the batch.
+	***/
+	void EndReplay()
+	{
+		m_replaying = false;
+		Clear();
+	}
+
+	/**
+	* Clears commands and initial state, releases all interfaces held. Keeps the memory.
+	***/
+	void Clear()
+	{
+		for (size_t i = 0; i < m_commands.size(); i++)
+			if (m_commands[i].pObject)
+				m_commands[i].pObject->Release();
+		m_commands.clear();
+		m_data.clear();
+		m_drawCount = 0;
+
+		m_initialTextures.UnbindAll();
+		m_initialStreams.UnbindAll();
+		for (UINT i = 0; i < INITIAL_OBJECTS; i++) {
+			if (m_initialObjects[i])
+				m_initialObjects[i]->Release();
+			m_initialObjects[i] = NULL;
+			m_initialObjectKnown[i] = false;
+		}
+		m_initialStates.ForgetAll();
+		for (UINT i = 0; i < CONSTANT_MASK_WORDS; i++) {
+			m_initialVSConstantMask[i] = 0;
+			m_initialPSConstantMask[i] = 0;
+		}
+	}
+
+	/**
+	* Number of vertices (or indices) a draw of that primitive type and count uses.
+	***/
+	static UINT VertexCount(D3DPRIMITIVETYPE PrimitiveType, UINT PrimitiveCount)
+	{
+		switch (PrimitiveType) {
+		case D3DPT_POINTLIST: return PrimitiveCount;
+		case D3DPT_LINELIST: return PrimitiveCount * 2;
+		case D3DPT_LINESTRIP: return PrimitiveCount + 1;
+		case D3DPT_TRIANGLELIST: return PrimitiveCount * 3;
+		case D3DPT_TRIANGLESTRIP: return PrimitiveCount + 2;
+		case D3DPT_TRIANGLEFAN: return PrimitiveCount + 2;
+		default: return 0;
+		}
+	}
+
+private:
+	/**
+	* Number of single interface slots (indexed by their command type, up to the vertex declaration).
+	***/
+	enum { INITIAL_OBJECTS = VertexDeclaration + 1 };
+	/**
+	* Number of 32 bit words in the touched constant register masks.
+	***/
+	enum { CONSTANT_MASK_WORDS = STEREO_BATCH_VS_CONSTANTS / 32 };
+
+	/**
+	* No copies, the batch holds interfaces.
+	***/
+	StereoBatch(const StereoBatch&);
+	StereoBatch& operator=(const StereoBatch&);
+
+	/**
+	* Adds a command, holds the interface.
+	***/
+	void Add(CommandType type, IUnknown* pObject, DWORD arg0 = 0, DWORD arg1 = 0, DWORD arg2 = 0, DWORD arg3 = 0, DWORD arg4 = 0, DWORD arg5 = 0)
+	{
+		Command command;
+		command.type = type;
+		command.args[0] = arg0;
+		command.args[1] = arg1;
+		command.args[2] = arg2;
+		command.args[3] = arg3;
+		command.args[4] = arg4;
+		command.args[5] = arg5;
+		command.pObject = pObject;
+		command.data[0] = 0;
+		command.data[1] = 0;
+		if (pObject)
+			pObject->AddRef();
+		m_commands.push_back(command);
+	}
+	/**
+	* Copies data to the data block (4 byte aligned), returns the offset.
+	***/
+	size_t AddData(CONST void* pData, size_t size)
+	{
+		size_t offset = m_data.size();
+		m_data.resize(offset + ((size + 3) & ~(size_t)3));
+		if (pData && size)
+			memcpy(&m_data[offset], pData, size);
+		return offset;
+	}
+	/**
+	* Pointer to data in the data block.
+	***/
+	CONST void* DataPointer(size_t offset) const
+	{
+		return (offset < m_data.size()) ? &m_data[offset] : NULL;
+	}
+	/**
+	* Records the interface of a single slot the run starts with, if not yet touched.
+	***/
+	void InitialObject(CommandType type, IUnknown* pPrevious)
+	{
+		if (m_initialObjectKnown[type])
+			return;
+		m_initialObjects[type] = pPrevious;
+		m_initialObjectKnown[type] = true;
+		if (pPrevious)
+			pPrevious->AddRef();
+	}
+	/**
+	* Records float constants, the registers not touched before are taken from pPrevious first.
+	***/
+	bool RecordConstants(CommandType type, UINT StartRegister, CONST float* pConstantData, UINT Vector4fCount, CONST float* pPrevious)
+	{
+		bool vertexShader = (type == VertexShaderConstantF);
+		UINT registers = vertexShader ? STEREO_BATCH_VS_CONSTANTS : STEREO_BATCH_PS_CONSTANTS;
+		if ((StartRegister >= registers) || (Vector4fCount > registers - StartRegister))
+			return false;
+
+		uint32_t* touched = vertexShader ? m_initialVSConstantMask : m_initialPSConstantMask;
+		float* initial = vertexShader ? m_initialVSConstants : m_initialPSConstants;
+		for (UINT i = StartRegister; i < StartRegister + Vector4fCount; i++) {
+			if (touched[i >> 5] & (1u << (i & 31)))
+				continue;
+			touched[i >> 5] |= 1u << (i & 31);
+			memcpy(&initial[i * 4], &pPrevious[i * 4], 4 * sizeof(float));
+		}
+
+		Add(type, NULL, StartRegister, Vector4fCount);
+		m_commands.back().data[0] = AddData(pConstantData, Vector4fCount * 4 * sizeof(float));
+		return true;
+	}
+	/**
+	* Sets the constant registers the run started with, in runs of consecutive registers.
+	***/
+	template <class Device> void ReplayInitialConstants(Device* pDevice, bool vertexShader)
+	{
+		const uint32_t* touched = vertexShader ? m_initialVSConstantMask : m_initialPSConstantMask;
+		const float* initial = vertexShader ? m_initialVSConstants : m_initialPSConstants;
+		UINT registers = vertexShader ? STEREO_BATCH_VS_CONSTANTS : STEREO_BATCH_PS_CONSTANTS;
+		UINT i = 0;
+		while (i < registers) {
+			if (!(touched[i >> 5] & (1u << (i & 31)))) {
+				i++;
+				continue;
+			}
+			UINT start = i;
+			while ((i < registers) && (touched[i >> 5] & (1u << (i & 31))))
+				i++;
+			if (vertexShader)
+				pDevice->Device::SetVertexShaderConstantF(start, &initial[start * 4], i - start);
+			else
+				pDevice->Device::SetPixelShaderConstantF(start, &initial[start * 4], i - start);
+		}
+	}
+	/**
+	* Sets a state, whatever kind of state the shadow index stands for. @see RenderStateShadow::SetOnDevice()
+	***/
+	template <class Device> static void ReplayState(Device* pDevice, UINT index, DWORD value)
+	{
+		if (index < SHADOW_SAMPLER_BASE)
+			pDevice->Device::SetRenderState((D3DRENDERSTATETYPE)index, value);
+		else if (index < SHADOW_TEXTURE_STAGE_BASE) {
+			index -= SHADOW_SAMPLER_BASE;
+			pDevice->Device::SetSamplerState(SlotToTextureStage(index / SHADOW_SAMPLER_STATE_TYPES), (D3DSAMPLERSTATETYPE)(index % SHADOW_SAMPLER_STATE_TYPES), value);
+		}
+		else if (index < SHADOW_STATE_COUNT) {
+			index -= SHADOW_TEXTURE_STAGE_BASE;
+			pDevice->Device::SetTextureStageState(index / SHADOW_TEXTURE_STAGE_STATE_TYPES, (D3DTEXTURESTAGESTATETYPE)(index % SHADOW_TEXTURE_STAGE_STATE_TYPES), value);
+		}
+	}
+
+	/**
+	* The recorded commands.
+	***/
+	std::vector<Command> m_commands;
+	/**
+	* Constants and user pointer draw data of the commands.
+	***/
+	std::vector<BYTE> m_data;
+	/**
+	* Number of recorded draws.
+	***/
+	UINT m_drawCount;
+	/**
+	* True while replaying.
+	***/
+	bool m_replaying;
+
+	/**
+	* Textures the run started with, a stage is bound here once touched.
+	***/
+	BindingSlots<IDirect3DBaseTexture9, BINDING_TEXTURE_SLOTS> m_initialTextures;
+	/**
+	* Vertex streams the run started with, a stream is bound here once touched.
+	***/
+	BindingSlots<IDirect3DVertexBuffer9, BINDING_VERTEX_STREAMS> m_initialStreams;
+	UINT m_initialStreamOffset[BINDING_VERTEX_STREAMS];
+	UINT m_initialStreamStride[BINDING_VERTEX_STREAMS];
+	/**
+	* Shaders, indices and vertex declaration the run started with (held), indexed by command type.
+	***/
+	IUnknown* m_initialObjects[INITIAL_OBJECTS];
+	bool m_initialObjectKnown[INITIAL_OBJECTS];
+	/**
+	* States the run started with, a state is known here once touched.
+	***/
+	RenderStateShadow m_initialStates;
+	/**
+	* Float constant registers the run started with and the masks of touched registers.
+	***/
+	float m_initialVSConstants[STEREO_BATCH_VS_CONSTANTS * 4];
+	float m_initialPSConstants[STEREO_BATCH_VS_CONSTANTS * 4];
+	uint32_t m_initialVSConstantMask[CONSTANT_MASK_WORDS];
+	uint32_t m_initialPSConstantMask[CONSTANT_MASK_WORDS];
+};
+
+#endif
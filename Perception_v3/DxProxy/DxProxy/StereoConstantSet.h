@@ -0,0 +1,146 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <StereoConstantSet.h> and
+Class <StereoConstantSet> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#ifndef STEREOCONSTANTSET_H_INCLUDED
+#define STEREOCONSTANTSET_H_INCLUDED
+
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include "d3d9.h"
+#include "ShaderConstantModification.h"
+
+/**
+* A float shader constant modified for stereo : its registers and the modification to apply.
+* Holds no register data, the left and right data is kept by ShaderRegisters.
+***/
+struct StereoConstantBinding
+{
+	/**
+	* Shader start register.
+	***/
+	UINT startRegister;
+	/**
+	* Shader constant size in registers.
+	* (4*float == 1 : Vector4 == 1, D3DMATRIX == 4,...)
+	***/
+	UINT count;
+	/**
+	* The constant modification, shared by all bindings that use the same modification.
+	***/
+	std::shared_ptr<ShaderConstantModification<float>> modification;
+};
+
+/**
+* Orders bindings by start register, then count, then modification instance.
+***/
+inline bool operator<(const StereoConstantBinding& a, const StereoConstantBinding& b)
+{
+	if (a.startRegister != b.startRegister)
+		return a.startRegister < b.startRegister;
+	if (a.count != b.count)
+		return a.count < b.count;
+	return a.modification.get() < b.modification.get();
+}
+
+/**
+* Immutable set of the modified float constants of a shader, sorted by start register.
+* Sets are interned by the ShaderModificationRepository, all shaders with the same
+* modified constants share one set. @see ShaderModificationRepository::GetModifiedConstantsF()
+*/
+class StereoConstantSet
+{
+public:
+	/**
+	* Constructor.
+	* @param bindings Bindings as returned by Normalize().
+	***/
+	explicit StereoConstantSet(const std::vector<StereoConstantBinding>& bindings) :
+		m_bindings(bindings)
+	{}
+
+	/**
+	* Sorts the bindings by start register, only the first binding added for a start register is kept.
+	***/
+	static void Normalize(std::vector<StereoConstantBinding>& bindings)
+	{
+		std::stable_sort(bindings.begin(), bindings.end(), LessStartRegister);
+		bindings.erase(std::unique(bindings.begin(), bindings.end(), SameStartRegister), bindings.end());
+	}
+
+	/**
+	* Number of modified constants.
+	***/
+	UINT Size() const { return (UINT)m_bindings.size(); }
+	/**
+	* The modified constant at that position (sorted by start register).
+	***/
+	const StereoConstantBinding& operator[](UINT index) const { return m_bindings[index]; }
+	/**
+	* Position of the modified constant starting at that register.
+	* @return -1 if no constant starts there.
+	***/
+	int Find(UINT startRegister) const
+	{
+		UINT low = 0;
+		UINT high = (UINT)m_bindings.size();
+		while (low < high) {
+			UINT mid = (low + high) / 2;
+			if (m_bindings[mid].startRegister < startRegister)
+				low = mid + 1;
+			else
+				high = mid;
+		}
+		if ((low < m_bindings.size()) && (m_bindings[low].startRegister == startRegister))
+			return (int)low;
+		return -1;
+	}
+
+private:
+	static bool LessStartRegister(const StereoConstantBinding& a, const StereoConstantBinding& b)
+	{
+		return a.startRegister < b.startRegister;
+	}
+	static bool SameStartRegister(const StereoConstantBinding& a, const StereoConstantBinding& b)
+	{
+		return a.startRegister == b.startRegister;
+	}
+
+	/**
+	* No assignment, sets are shared and immutable.
+	***/
+	StereoConstantSet& operator=(const StereoConstantSet&);
+
+	/**
+	* The modified constants, sorted by start register.
+	***/
+	const std::vector<StereoConstantBinding> m_bindings;
+};
+
+#endif
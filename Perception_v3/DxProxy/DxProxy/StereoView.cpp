@@ -90,6 +90,7 @@ StereoView::StereoView(ProxyConfig *config)
 	lastRenderTarget1 = NULL;
 	viewEffect = NULL;
 	sb = NULL;
+	m_pStateShadow = &m_localStateShadow;
 	m_bLeftSideActive = false;
 
 	//Start in DSV mode
@@ -352,6 +353,9 @@ void StereoView::PrePresent(D3D9ProxySurface* stereoCapableSurface)
 		m_pActualDevice->SetTexture(3, leftTexture);
 	}
 
+	// without a proxy device shadow no game state is known from the last frame
+	if (m_pStateShadow == &m_localStateShadow)
+		m_localStateShadow.ForgetAll();
 
 	// how to save (backup) render states ?	
 	switch(howToSaveRenderStates)
@@ -363,7 +367,6 @@ void StereoView::PrePresent(D3D9ProxySurface* stereoCapableSurface)
 		SaveState();
 		break;
 	case HowToSaveRenderStates::ALL_STATES_MANUALLY:
-		SaveAllRenderStates(m_pActualDevice);
 		SetAllRenderStatesDefault(m_pActualDevice);
 		break;
 	case HowToSaveRenderStates::DO_NOT_SAVE_AND_RESTORE:
@@ -416,7 +419,7 @@ void StereoView::PrePresent(D3D9ProxySurface* stereoCapableSurface)
 			OutputDebugString("Beginpass failed\n");
 		}
 
-		if (FAILED(m_pActualDevice->DrawPrimitive(D3DPT_TRIANGLEFAN, 0, 2))) {
+		if (FAILED(DrawView())) {
 			OutputDebugString("Draw failed\n");
 		}		
 
@@ -439,14 +442,18 @@ void StereoView::PrePresent(D3D9ProxySurface* stereoCapableSurface)
 		sb->Apply();
 		sb->Release();
 		sb = NULL;
+		m_changedStates.ForgetAll();
 		break;
 	case HowToSaveRenderStates::SELECTED_STATES_MANUALLY:
 		RestoreState();
 		break;
 	case HowToSaveRenderStates::ALL_STATES_MANUALLY:
-		RestoreAllRenderStates(m_pActualDevice);
+		RestoreChangedStates();
 		break;
 	case HowToSaveRenderStates::DO_NOT_SAVE_AND_RESTORE:
+		// the stereo view states stay set, so these are the game states now
+		m_pStateShadow->CopyKnown(m_changedStates);
+		m_changedStates.ForgetAll();
 		break;
 	}
 
@@ -488,6 +495,17 @@ IDirect3DSurface9* StereoView::GetBackBuffer()
 	return backBuffer;
 }
 
+/**
+* Sets the render state shadow of the proxy device.
+* The game render, sampler and texture stage states are taken from there instead of being read
+* back from the device each frame. NULL to use a local shadow that is forgotten each Present.
+***/
+void StereoView::SetRenderStateShadow(RenderStateShadow* pShadow)
+{
+	SHOW_CALL("StereoView::SetRenderStateShadow\n");
+	m_pStateShadow = pShadow ? pShadow : &m_localStateShadow;
+}
+
 /**
 * Calls ID3DXEffect::OnResetDevice.
 ***/
@@ -646,37 +664,22 @@ void StereoView::PostViewEffectCleanup()
 ***/
 void StereoView::CalculateShaderVariables() {} 
 
+/**
+* Draws the full screen quad, called for each pass of the view effect.
+***/
+HRESULT StereoView::DrawView()
+{
+	return m_pActualDevice->DrawPrimitive(D3DPT_TRIANGLEFAN, 0, 2);
+}
+
 /**
 * Workaround for Half Life 2 for now.
+* Saves the interfaces changed by SetState(), render, sampler and texture stage states
+* are taken from the state shadow.
 ***/
 void StereoView::SaveState()
 {
 	SHOW_CALL("StereoView::SaveState");
-	m_pActualDevice->GetTextureStageState(0, D3DTSS_COLOROP, &tssColorOp);
-	m_pActualDevice->GetTextureStageState(0, D3DTSS_COLORARG1, &tssColorArg1);
-	m_pActualDevice->GetTextureStageState(0, D3DTSS_ALPHAOP, &tssAlphaOp);
-	m_pActualDevice->GetTextureStageState(0, D3DTSS_ALPHAARG1, &tssAlphaArg1);
-	m_pActualDevice->GetTextureStageState(0, D3DTSS_CONSTANT, &tssConstant);
-
-	m_pActualDevice->GetRenderState(D3DRS_ALPHABLENDENABLE, &rsAlphaEnable);
-	m_pActualDevice->GetRenderState(D3DRS_ZWRITEENABLE, &rsZWriteEnable);
-	m_pActualDevice->GetRenderState(D3DRS_ZENABLE, &rsZEnable);
-	m_pActualDevice->GetRenderState(D3DRS_SRGBWRITEENABLE, &rsSrgbEnable);
-
-	m_pActualDevice->GetSamplerState(0, D3DSAMP_SRGBTEXTURE, &ssSrgb);
-	m_pActualDevice->GetSamplerState(1, D3DSAMP_SRGBTEXTURE, &ssSrgb1);
-	
-	m_pActualDevice->GetSamplerState(0, D3DSAMP_ADDRESSU, &ssAddressU);
-	m_pActualDevice->GetSamplerState(0, D3DSAMP_ADDRESSV, &ssAddressV);
-	m_pActualDevice->GetSamplerState(0, D3DSAMP_ADDRESSW, &ssAddressW);
-
-	m_pActualDevice->GetSamplerState(0, D3DSAMP_MAGFILTER, &ssMag0);
-	m_pActualDevice->GetSamplerState(1, D3DSAMP_MAGFILTER, &ssMag1);
-	m_pActualDevice->GetSamplerState(0, D3DSAMP_MINFILTER, &ssMin0);
-	m_pActualDevice->GetSamplerState(1, D3DSAMP_MINFILTER, &ssMin1);
-	m_pActualDevice->GetSamplerState(0, D3DSAMP_MIPFILTER, &ssMip0);
-	m_pActualDevice->GetSamplerState(1, D3DSAMP_MIPFILTER, &ssMip1);
-
 	m_pActualDevice->GetTexture(0, &lastTexture);
 	m_pActualDevice->GetTexture(1, &lastTexture1);
 
@@ -700,56 +703,57 @@ void StereoView::SetState()
 	m_pActualDevice->SetTransform(D3DTS_WORLD, D3DXMatrixIdentity(&identity));
 	m_pActualDevice->SetTransform(D3DTS_VIEW, &identity);
 	m_pActualDevice->SetTransform(D3DTS_PROJECTION, &identity);
-	m_pActualDevice->SetRenderState(D3DRS_LIGHTING, FALSE);
-	m_pActualDevice->SetRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
-	m_pActualDevice->SetRenderState(D3DRS_ZENABLE,  D3DZB_TRUE);
-	m_pActualDevice->SetRenderState(D3DRS_ZWRITEENABLE, TRUE);
-	m_pActualDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, FALSE);
-	m_pActualDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);// This fixed interior or car not being drawn in rFactor
-	m_pActualDevice->SetRenderState(D3DRS_STENCILENABLE, FALSE); 
-
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_COLORARG1, D3DTA_TEXTURE);
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_SELECTARG1);
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_ALPHAARG1, D3DTA_CONSTANT);
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_CONSTANT, 0xffffffff);
-
-	m_pActualDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, FALSE);
-	m_pActualDevice->SetRenderState(D3DRS_ZENABLE, D3DZB_TRUE);
-	m_pActualDevice->SetRenderState(D3DRS_ZWRITEENABLE, TRUE);
-	m_pActualDevice->SetRenderState(D3DRS_ALPHATESTENABLE, FALSE);  
+	ChangeRenderState(D3DRS_LIGHTING, FALSE);
+	ChangeRenderState(D3DRS_CULLMODE, D3DCULL_NONE);
+	ChangeRenderState(D3DRS_ZENABLE,  D3DZB_TRUE);
+	ChangeRenderState(D3DRS_ZWRITEENABLE, TRUE);
+	ChangeRenderState(D3DRS_ALPHABLENDENABLE, FALSE);
+	ChangeRenderState(D3DRS_ALPHATESTENABLE, FALSE);// This fixed interior or car not being drawn in rFactor
+	ChangeRenderState(D3DRS_STENCILENABLE, FALSE); 
+
+	ChangeTextureStageState(0, D3DTSS_COLOROP, D3DTOP_SELECTARG1);
+	ChangeTextureStageState(0, D3DTSS_COLORARG1, D3DTA_TEXTURE);
+	ChangeTextureStageState(0, D3DTSS_ALPHAOP, D3DTOP_SELECTARG1);
+	ChangeTextureStageState(0, D3DTSS_ALPHAARG1, D3DTA_CONSTANT);
+	ChangeTextureStageState(0, D3DTSS_CONSTANT, 0xffffffff);
+
+	ChangeRenderState(D3DRS_ALPHABLENDENABLE, FALSE);
+	ChangeRenderState(D3DRS_ZENABLE, D3DZB_TRUE);
+	ChangeRenderState(D3DRS_ZWRITEENABLE, TRUE);
+	ChangeRenderState(D3DRS_ALPHATESTENABLE, FALSE);  
 
 	int value = 0;
 	if (ProxyHelper::ParseGameType(config->game_type, ProxyHelper::DeviceStateFlags, value) && (value & 2))
 	{
-		m_pActualDevice->SetSamplerState(0, D3DSAMP_SRGBTEXTURE, ssSrgb);
-		m_pActualDevice->SetSamplerState(1, D3DSAMP_SRGBTEXTURE, ssSrgb);
+		DWORD srgbTexture = m_pStateShadow->Fetch(m_pActualDevice, RenderStateShadow::SamplerStateIndex(0, D3DSAMP_SRGBTEXTURE));
+		ChangeSamplerState(0, D3DSAMP_SRGBTEXTURE, srgbTexture);
+		ChangeSamplerState(1, D3DSAMP_SRGBTEXTURE, srgbTexture);
 	}
 	else
 	{
 		//Borderlands Dark Eye FIX
-		m_pActualDevice->SetSamplerState(0, D3DSAMP_SRGBTEXTURE, 0);
-		m_pActualDevice->SetSamplerState(1, D3DSAMP_SRGBTEXTURE, 0);
+		ChangeSamplerState(0, D3DSAMP_SRGBTEXTURE, 0);
+		ChangeSamplerState(1, D3DSAMP_SRGBTEXTURE, 0);
 	}
 	
 
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP);
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP);
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_ADDRESSW, D3DTADDRESS_CLAMP);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_ADDRESSW, D3DTADDRESS_CLAMP);
+	ChangeSamplerState(0, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP);
+	ChangeSamplerState(0, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP);
+	ChangeSamplerState(0, D3DSAMP_ADDRESSW, D3DTADDRESS_CLAMP);
+	ChangeSamplerState(1, D3DSAMP_ADDRESSU, D3DTADDRESS_CLAMP);
+	ChangeSamplerState(1, D3DSAMP_ADDRESSV, D3DTADDRESS_CLAMP);
+	ChangeSamplerState(1, D3DSAMP_ADDRESSW, D3DTADDRESS_CLAMP);
 
 	// TODO Need to check m_pActualDevice capabilities if we want a prefered order of fallback rather than 
 	// whatever the default is being used when a mode isn't supported.
 	// Example - GeForce 660 doesn't appear to support D3DTEXF_ANISOTROPIC on the MAGFILTER (at least
 	// according to the spam of error messages when running with the directx debug runtime)
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, D3DTEXF_ANISOTROPIC);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_MAGFILTER, D3DTEXF_ANISOTROPIC);
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_MINFILTER, D3DTEXF_ANISOTROPIC);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_MINFILTER, D3DTEXF_ANISOTROPIC);
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_MIPFILTER, D3DTEXF_NONE);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_MIPFILTER, D3DTEXF_NONE);
+	ChangeSamplerState(0, D3DSAMP_MAGFILTER, D3DTEXF_ANISOTROPIC);
+	ChangeSamplerState(1, D3DSAMP_MAGFILTER, D3DTEXF_ANISOTROPIC);
+	ChangeSamplerState(0, D3DSAMP_MINFILTER, D3DTEXF_ANISOTROPIC);
+	ChangeSamplerState(1, D3DSAMP_MINFILTER, D3DTEXF_ANISOTROPIC);
+	ChangeSamplerState(0, D3DSAMP_MIPFILTER, D3DTEXF_NONE);
+	ChangeSamplerState(1, D3DSAMP_MIPFILTER, D3DTEXF_NONE);
 
 	//m_pActualDevice->SetTexture(0, NULL);
 	//m_pActualDevice->SetTexture(1, NULL);
@@ -772,30 +776,7 @@ void StereoView::SetState()
 void StereoView::RestoreState()
 {
 	SHOW_CALL("StereoView::RestoreState");
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_COLOROP, tssColorOp);
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_COLORARG1, tssColorArg1);
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_ALPHAOP, tssAlphaOp);
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_ALPHAARG1, tssAlphaArg1);
-	m_pActualDevice->SetTextureStageState(0, D3DTSS_CONSTANT, tssConstant);
-
-	m_pActualDevice->SetRenderState(D3DRS_ALPHABLENDENABLE, rsAlphaEnable);
-	m_pActualDevice->SetRenderState(D3DRS_ZWRITEENABLE, rsZWriteEnable);
-	m_pActualDevice->SetRenderState(D3DRS_ZENABLE, rsZEnable);
-	m_pActualDevice->SetRenderState(D3DRS_SRGBWRITEENABLE, rsSrgbEnable);
-
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_SRGBTEXTURE, ssSrgb);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_SRGBTEXTURE, ssSrgb1);
-
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_ADDRESSU, ssAddressU);
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_ADDRESSV, ssAddressV);
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_ADDRESSW, ssAddressW);
-
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_MAGFILTER, ssMag0);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_MAGFILTER, ssMag1);
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_MINFILTER, ssMin0);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_MINFILTER, ssMin1);
-	m_pActualDevice->SetSamplerState(0, D3DSAMP_MIPFILTER, ssMip0);
-	m_pActualDevice->SetSamplerState(1, D3DSAMP_MIPFILTER, ssMip1);
+	RestoreChangedStates();
 
 	m_pActualDevice->SetTexture(0, lastTexture);
 	if(lastTexture != NULL)
@@ -833,123 +814,10 @@ void StereoView::RestoreState()
 	lastRenderTarget1 = NULL;
 }
 
-/**
-* Saves all Direct3D 9 render states.
-* Used for games that do not work with state blocks for some reason.
-***/
-void StereoView::SaveAllRenderStates(LPDIRECT3DDEVICE9 pDevice)
-{
-	SHOW_CALL("StereoView::SaveAllRenderStates\n");
-	// save all Direct3D 9 RenderStates 
-	DWORD dwCount = 0;
-	pDevice->GetRenderState(D3DRS_ZENABLE                     , &renderStates[dwCount++]); 
-	pDevice->GetRenderState(D3DRS_FILLMODE                    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_SHADEMODE                   , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ZWRITEENABLE                , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ALPHATESTENABLE             , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_LASTPIXEL                   , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_SRCBLEND                    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_DESTBLEND                   , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_CULLMODE                    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ZFUNC                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ALPHAREF                    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ALPHAFUNC                   , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_DITHERENABLE                , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ALPHABLENDENABLE            , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_FOGENABLE                   , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_SPECULARENABLE              , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_FOGCOLOR                    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_FOGTABLEMODE                , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_FOGSTART                    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_FOGEND                      , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_FOGDENSITY                  , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_RANGEFOGENABLE              , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_STENCILENABLE               , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_STENCILFAIL                 , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_STENCILZFAIL                , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_STENCILPASS                 , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_STENCILFUNC                 , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_STENCILREF                  , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_STENCILMASK                 , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_STENCILWRITEMASK            , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_TEXTUREFACTOR               , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP0                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP1                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP2                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP3                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP4                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP5                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP6                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP7                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_CLIPPING                    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_LIGHTING                    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_AMBIENT                     , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_FOGVERTEXMODE               , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_COLORVERTEX                 , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_LOCALVIEWER                 , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_NORMALIZENORMALS            , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_DIFFUSEMATERIALSOURCE       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_SPECULARMATERIALSOURCE      , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_AMBIENTMATERIALSOURCE       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_EMISSIVEMATERIALSOURCE      , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_VERTEXBLEND                 , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_CLIPPLANEENABLE             , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_POINTSIZE                   , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_POINTSIZE_MIN               , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_POINTSPRITEENABLE           , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_POINTSCALEENABLE            , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_POINTSCALE_A                , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_POINTSCALE_B                , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_POINTSCALE_C                , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_MULTISAMPLEANTIALIAS        , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_MULTISAMPLEMASK             , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_PATCHEDGESTYLE              , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_DEBUGMONITORTOKEN           , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_POINTSIZE_MAX               , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_INDEXEDVERTEXBLENDENABLE    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_COLORWRITEENABLE            , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_TWEENFACTOR                 , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_BLENDOP                     , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_POSITIONDEGREE              , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_NORMALDEGREE                , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_SCISSORTESTENABLE           , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_SLOPESCALEDEPTHBIAS         , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ANTIALIASEDLINEENABLE       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_MINTESSELLATIONLEVEL        , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_MAXTESSELLATIONLEVEL        , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ADAPTIVETESS_X              , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ADAPTIVETESS_Y              , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ADAPTIVETESS_Z              , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ADAPTIVETESS_W              , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_ENABLEADAPTIVETESSELLATION  , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_TWOSIDEDSTENCILMODE         , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_CCW_STENCILFAIL             , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_CCW_STENCILZFAIL            , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_CCW_STENCILPASS             , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_CCW_STENCILFUNC             , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_COLORWRITEENABLE1           , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_COLORWRITEENABLE2           , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_COLORWRITEENABLE3           , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_BLENDFACTOR                 , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_SRGBWRITEENABLE             , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_DEPTHBIAS                   , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP8                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP9                       , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP10                      , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP11                      , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP12                      , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP13                      , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP14                      , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_WRAP15                      , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_SEPARATEALPHABLENDENABLE    , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_SRCBLENDALPHA               , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_DESTBLENDALPHA              , &renderStates[dwCount++]);
-	pDevice->GetRenderState(D3DRS_BLENDOPALPHA                , &renderStates[dwCount++]);
-}
-
 /**
 * Sets all Direct3D 9 render states to their default values.
 * Use this function only if a game does not want to render.
+* Only states that differ from the game values are set (and restored later).
 ***/
 void StereoView::SetAllRenderStatesDefault(LPDIRECT3DDEVICE9 pDevice)
 {
@@ -958,236 +826,192 @@ void StereoView::SetAllRenderStatesDefault(LPDIRECT3DDEVICE9 pDevice)
 	float fData = 0.0f;
 	double dData = 0.0f;
 
-	pDevice->SetRenderState(D3DRS_ZENABLE                     , D3DZB_TRUE);
-	pDevice->SetRenderState(D3DRS_FILLMODE                    , D3DFILL_SOLID);
-	pDevice->SetRenderState(D3DRS_SHADEMODE                   , D3DSHADE_GOURAUD);
-	pDevice->SetRenderState(D3DRS_ZWRITEENABLE                , TRUE);
-	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE             , FALSE);
-	pDevice->SetRenderState(D3DRS_LASTPIXEL                   , TRUE);
-	pDevice->SetRenderState(D3DRS_SRCBLEND                    , D3DBLEND_ONE);
-	pDevice->SetRenderState(D3DRS_DESTBLEND                   , D3DBLEND_ZERO);
-	pDevice->SetRenderState(D3DRS_CULLMODE                    , D3DCULL_CCW);
-	pDevice->SetRenderState(D3DRS_ZFUNC                       , D3DCMP_LESSEQUAL);
-	pDevice->SetRenderState(D3DRS_ALPHAREF                    , 0);
-	pDevice->SetRenderState(D3DRS_ALPHAFUNC                   , D3DCMP_ALWAYS);
-	pDevice->SetRenderState(D3DRS_DITHERENABLE                , FALSE);
-	pDevice->SetRenderState(D3DRS_ALPHABLENDENABLE            , FALSE);
-	pDevice->SetRenderState(D3DRS_FOGENABLE                   , FALSE);
-	pDevice->SetRenderState(D3DRS_SPECULARENABLE              , FALSE);
-	pDevice->SetRenderState(D3DRS_FOGCOLOR                    , 0);
-	pDevice->SetRenderState(D3DRS_FOGTABLEMODE                , D3DFOG_NONE);
+	ChangeRenderState(D3DRS_ZENABLE                     , D3DZB_TRUE);
+	ChangeRenderState(D3DRS_FILLMODE                    , D3DFILL_SOLID);
+	ChangeRenderState(D3DRS_SHADEMODE                   , D3DSHADE_GOURAUD);
+	ChangeRenderState(D3DRS_ZWRITEENABLE                , TRUE);
+	ChangeRenderState(D3DRS_ALPHATESTENABLE             , FALSE);
+	ChangeRenderState(D3DRS_LASTPIXEL                   , TRUE);
+	ChangeRenderState(D3DRS_SRCBLEND                    , D3DBLEND_ONE);
+	ChangeRenderState(D3DRS_DESTBLEND                   , D3DBLEND_ZERO);
+	ChangeRenderState(D3DRS_CULLMODE                    , D3DCULL_CCW);
+	ChangeRenderState(D3DRS_ZFUNC                       , D3DCMP_LESSEQUAL);
+	ChangeRenderState(D3DRS_ALPHAREF                    , 0);
+	ChangeRenderState(D3DRS_ALPHAFUNC                   , D3DCMP_ALWAYS);
+	ChangeRenderState(D3DRS_DITHERENABLE                , FALSE);
+	ChangeRenderState(D3DRS_ALPHABLENDENABLE            , FALSE);
+	ChangeRenderState(D3DRS_FOGENABLE                   , FALSE);
+	ChangeRenderState(D3DRS_SPECULARENABLE              , FALSE);
+	ChangeRenderState(D3DRS_FOGCOLOR                    , 0);
+	ChangeRenderState(D3DRS_FOGTABLEMODE                , D3DFOG_NONE);
 	fData = 0.0f;
-	pDevice->SetRenderState(D3DRS_FOGSTART                    , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_FOGSTART                    , *((DWORD*)&fData));
 	fData = 1.0f;
-	pDevice->SetRenderState(D3DRS_FOGEND                      , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_FOGEND                      , *((DWORD*)&fData));
 	fData = 1.0f;
-	pDevice->SetRenderState(D3DRS_FOGDENSITY                  , *((DWORD*)&fData));
-	pDevice->SetRenderState(D3DRS_RANGEFOGENABLE              , FALSE);
-	pDevice->SetRenderState(D3DRS_STENCILENABLE               , FALSE);
-	pDevice->SetRenderState(D3DRS_STENCILFAIL                 , D3DSTENCILOP_KEEP);
-	pDevice->SetRenderState(D3DRS_STENCILZFAIL                , D3DSTENCILOP_KEEP);
-	pDevice->SetRenderState(D3DRS_STENCILPASS                 , D3DSTENCILOP_KEEP);
-	pDevice->SetRenderState(D3DRS_STENCILFUNC                 , D3DCMP_ALWAYS);
-	pDevice->SetRenderState(D3DRS_STENCILREF                  , 0);
-	pDevice->SetRenderState(D3DRS_STENCILMASK                 , 0xFFFFFFFF);
-	pDevice->SetRenderState(D3DRS_STENCILWRITEMASK            , 0xFFFFFFFF);
-	pDevice->SetRenderState(D3DRS_TEXTUREFACTOR               , 0xFFFFFFFF);
-	pDevice->SetRenderState(D3DRS_WRAP0                       , 0);
-	pDevice->SetRenderState(D3DRS_WRAP1                       , 0);
-	pDevice->SetRenderState(D3DRS_WRAP2                       , 0);
-	pDevice->SetRenderState(D3DRS_WRAP3                       , 0);
-	pDevice->SetRenderState(D3DRS_WRAP4                       , 0);
-	pDevice->SetRenderState(D3DRS_WRAP5                       , 0);
-	pDevice->SetRenderState(D3DRS_WRAP6                       , 0);
-	pDevice->SetRenderState(D3DRS_WRAP7                       , 0);
-	pDevice->SetRenderState(D3DRS_CLIPPING                    , TRUE);
-	pDevice->SetRenderState(D3DRS_LIGHTING                    , TRUE);
-	pDevice->SetRenderState(D3DRS_AMBIENT                     , 0);
-	pDevice->SetRenderState(D3DRS_FOGVERTEXMODE               , D3DFOG_NONE);
-	pDevice->SetRenderState(D3DRS_COLORVERTEX                 , TRUE);
-	pDevice->SetRenderState(D3DRS_LOCALVIEWER                 , TRUE);
-	pDevice->SetRenderState(D3DRS_NORMALIZENORMALS            , FALSE);
-	pDevice->SetRenderState(D3DRS_DIFFUSEMATERIALSOURCE       , D3DMCS_COLOR1);
-	pDevice->SetRenderState(D3DRS_SPECULARMATERIALSOURCE      , D3DMCS_COLOR2);
-	pDevice->SetRenderState(D3DRS_AMBIENTMATERIALSOURCE       , D3DMCS_MATERIAL);
-	pDevice->SetRenderState(D3DRS_EMISSIVEMATERIALSOURCE      , D3DMCS_MATERIAL);
-	pDevice->SetRenderState(D3DRS_VERTEXBLEND                 , D3DVBF_DISABLE);
-	pDevice->SetRenderState(D3DRS_CLIPPLANEENABLE             , 0);
-	pDevice->SetRenderState(D3DRS_POINTSIZE                   , 64);
+	ChangeRenderState(D3DRS_FOGDENSITY                  , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_RANGEFOGENABLE              , FALSE);
+	ChangeRenderState(D3DRS_STENCILENABLE               , FALSE);
+	ChangeRenderState(D3DRS_STENCILFAIL                 , D3DSTENCILOP_KEEP);
+	ChangeRenderState(D3DRS_STENCILZFAIL                , D3DSTENCILOP_KEEP);
+	ChangeRenderState(D3DRS_STENCILPASS                 , D3DSTENCILOP_KEEP);
+	ChangeRenderState(D3DRS_STENCILFUNC                 , D3DCMP_ALWAYS);
+	ChangeRenderState(D3DRS_STENCILREF                  , 0);
+	ChangeRenderState(D3DRS_STENCILMASK                 , 0xFFFFFFFF);
+	ChangeRenderState(D3DRS_STENCILWRITEMASK            , 0xFFFFFFFF);
+	ChangeRenderState(D3DRS_TEXTUREFACTOR               , 0xFFFFFFFF);
+	ChangeRenderState(D3DRS_WRAP0                       , 0);
+	ChangeRenderState(D3DRS_WRAP1                       , 0);
+	ChangeRenderState(D3DRS_WRAP2                       , 0);
+	ChangeRenderState(D3DRS_WRAP3                       , 0);
+	ChangeRenderState(D3DRS_WRAP4                       , 0);
+	ChangeRenderState(D3DRS_WRAP5                       , 0);
+	ChangeRenderState(D3DRS_WRAP6                       , 0);
+	ChangeRenderState(D3DRS_WRAP7                       , 0);
+	ChangeRenderState(D3DRS_CLIPPING                    , TRUE);
+	ChangeRenderState(D3DRS_LIGHTING                    , TRUE);
+	ChangeRenderState(D3DRS_AMBIENT                     , 0);
+	ChangeRenderState(D3DRS_FOGVERTEXMODE               , D3DFOG_NONE);
+	ChangeRenderState(D3DRS_COLORVERTEX                 , TRUE);
+	ChangeRenderState(D3DRS_LOCALVIEWER                 , TRUE);
+	ChangeRenderState(D3DRS_NORMALIZENORMALS            , FALSE);
+	ChangeRenderState(D3DRS_DIFFUSEMATERIALSOURCE       , D3DMCS_COLOR1);
+	ChangeRenderState(D3DRS_SPECULARMATERIALSOURCE      , D3DMCS_COLOR2);
+	ChangeRenderState(D3DRS_AMBIENTMATERIALSOURCE       , D3DMCS_MATERIAL);
+	ChangeRenderState(D3DRS_EMISSIVEMATERIALSOURCE      , D3DMCS_MATERIAL);
+	ChangeRenderState(D3DRS_VERTEXBLEND                 , D3DVBF_DISABLE);
+	ChangeRenderState(D3DRS_CLIPPLANEENABLE             , 0);
+	ChangeRenderState(D3DRS_POINTSIZE                   , 64);
 	fData = 1.0f;
-	pDevice->SetRenderState(D3DRS_POINTSIZE_MIN               , *((DWORD*)&fData));
-	pDevice->SetRenderState(D3DRS_POINTSPRITEENABLE           , FALSE);
-	pDevice->SetRenderState(D3DRS_POINTSCALEENABLE            , FALSE);
+	ChangeRenderState(D3DRS_POINTSIZE_MIN               , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_POINTSPRITEENABLE           , FALSE);
+	ChangeRenderState(D3DRS_POINTSCALEENABLE            , FALSE);
 	fData = 1.0f;
-	pDevice->SetRenderState(D3DRS_POINTSCALE_A                , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_POINTSCALE_A                , *((DWORD*)&fData));
 	fData = 0.0f;
-	pDevice->SetRenderState(D3DRS_POINTSCALE_B                , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_POINTSCALE_B                , *((DWORD*)&fData));
 	fData = 0.0f;
-	pDevice->SetRenderState(D3DRS_POINTSCALE_C                , *((DWORD*)&fData));
-	pDevice->SetRenderState(D3DRS_MULTISAMPLEANTIALIAS        , TRUE);
-	pDevice->SetRenderState(D3DRS_MULTISAMPLEMASK             , 0xFFFFFFFF);
-	pDevice->SetRenderState(D3DRS_PATCHEDGESTYLE              , D3DPATCHEDGE_DISCRETE);
-	pDevice->SetRenderState(D3DRS_DEBUGMONITORTOKEN           , D3DDMT_ENABLE);
+	ChangeRenderState(D3DRS_POINTSCALE_C                , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_MULTISAMPLEANTIALIAS        , TRUE);
+	ChangeRenderState(D3DRS_MULTISAMPLEMASK             , 0xFFFFFFFF);
+	ChangeRenderState(D3DRS_PATCHEDGESTYLE              , D3DPATCHEDGE_DISCRETE);
+	ChangeRenderState(D3DRS_DEBUGMONITORTOKEN           , D3DDMT_ENABLE);
 	dData = 64.0;
-	pDevice->SetRenderState(D3DRS_POINTSIZE_MAX               , *((DWORD*)&dData));
-	pDevice->SetRenderState(D3DRS_INDEXEDVERTEXBLENDENABLE    , FALSE);
-	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE            , 0x0000000F);
+	ChangeRenderState(D3DRS_POINTSIZE_MAX               , *((DWORD*)&dData));
+	ChangeRenderState(D3DRS_INDEXEDVERTEXBLENDENABLE    , FALSE);
+	ChangeRenderState(D3DRS_COLORWRITEENABLE            , 0x0000000F);
 	fData = 0.0f;
-	pDevice->SetRenderState(D3DRS_TWEENFACTOR                 , *((DWORD*)&fData));
-	pDevice->SetRenderState(D3DRS_BLENDOP                     , D3DBLENDOP_ADD);
-	pDevice->SetRenderState(D3DRS_POSITIONDEGREE              , D3DDEGREE_CUBIC);
-	pDevice->SetRenderState(D3DRS_NORMALDEGREE                , D3DDEGREE_LINEAR );
-	pDevice->SetRenderState(D3DRS_SCISSORTESTENABLE           , FALSE);
-	pDevice->SetRenderState(D3DRS_SLOPESCALEDEPTHBIAS         , 0);
-	pDevice->SetRenderState(D3DRS_ANTIALIASEDLINEENABLE       , FALSE);
+	ChangeRenderState(D3DRS_TWEENFACTOR                 , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_BLENDOP                     , D3DBLENDOP_ADD);
+	ChangeRenderState(D3DRS_POSITIONDEGREE              , D3DDEGREE_CUBIC);
+	ChangeRenderState(D3DRS_NORMALDEGREE                , D3DDEGREE_LINEAR );
+	ChangeRenderState(D3DRS_SCISSORTESTENABLE           , FALSE);
+	ChangeRenderState(D3DRS_SLOPESCALEDEPTHBIAS         , 0);
+	ChangeRenderState(D3DRS_ANTIALIASEDLINEENABLE       , FALSE);
 	fData = 1.0f;
-	pDevice->SetRenderState(D3DRS_MINTESSELLATIONLEVEL        , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_MINTESSELLATIONLEVEL        , *((DWORD*)&fData));
 	fData = 1.0f;
-	pDevice->SetRenderState(D3DRS_MAXTESSELLATIONLEVEL        , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_MAXTESSELLATIONLEVEL        , *((DWORD*)&fData));
 	fData = 0.0f;
-	pDevice->SetRenderState(D3DRS_ADAPTIVETESS_X              , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_ADAPTIVETESS_X              , *((DWORD*)&fData));
 	fData = 0.0f;
-	pDevice->SetRenderState(D3DRS_ADAPTIVETESS_Y              , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_ADAPTIVETESS_Y              , *((DWORD*)&fData));
 	fData = 1.0f;
-	pDevice->SetRenderState(D3DRS_ADAPTIVETESS_Z              , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_ADAPTIVETESS_Z              , *((DWORD*)&fData));
 	fData = 0.0f;
-	pDevice->SetRenderState(D3DRS_ADAPTIVETESS_W              , *((DWORD*)&fData));
-	pDevice->SetRenderState(D3DRS_ENABLEADAPTIVETESSELLATION  , FALSE);
-	pDevice->SetRenderState(D3DRS_TWOSIDEDSTENCILMODE         , FALSE);
-	pDevice->SetRenderState(D3DRS_CCW_STENCILFAIL             , D3DSTENCILOP_KEEP);
-	pDevice->SetRenderState(D3DRS_CCW_STENCILZFAIL            , D3DSTENCILOP_KEEP);
-	pDevice->SetRenderState(D3DRS_CCW_STENCILPASS             , D3DSTENCILOP_KEEP);
-	pDevice->SetRenderState(D3DRS_CCW_STENCILFUNC             , D3DCMP_ALWAYS);
-	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE1           , 0x0000000f);
-	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE2           , 0x0000000f);
-	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE3           , 0x0000000f);
-	pDevice->SetRenderState(D3DRS_BLENDFACTOR                 , 0xffffffff);
-	pDevice->SetRenderState(D3DRS_SRGBWRITEENABLE             , 0);
-	pDevice->SetRenderState(D3DRS_DEPTHBIAS                   , 0);
-	pDevice->SetRenderState(D3DRS_WRAP8                       , 0);
-	pDevice->SetRenderState(D3DRS_WRAP9                       , 0);
-	pDevice->SetRenderState(D3DRS_WRAP10                      , 0);
-	pDevice->SetRenderState(D3DRS_WRAP11                      , 0);
-	pDevice->SetRenderState(D3DRS_WRAP12                      , 0);
-	pDevice->SetRenderState(D3DRS_WRAP13                      , 0);
-	pDevice->SetRenderState(D3DRS_WRAP14                      , 0);
-	pDevice->SetRenderState(D3DRS_WRAP15                      , 0);
-	pDevice->SetRenderState(D3DRS_SEPARATEALPHABLENDENABLE    , FALSE);
-	pDevice->SetRenderState(D3DRS_SRCBLENDALPHA               , D3DBLEND_ONE);
-	pDevice->SetRenderState(D3DRS_DESTBLENDALPHA              , D3DBLEND_ZERO);
-	pDevice->SetRenderState(D3DRS_BLENDOPALPHA                , D3DBLENDOP_ADD);
+	ChangeRenderState(D3DRS_ADAPTIVETESS_W              , *((DWORD*)&fData));
+	ChangeRenderState(D3DRS_ENABLEADAPTIVETESSELLATION  , FALSE);
+	ChangeRenderState(D3DRS_TWOSIDEDSTENCILMODE         , FALSE);
+	ChangeRenderState(D3DRS_CCW_STENCILFAIL             , D3DSTENCILOP_KEEP);
+	ChangeRenderState(D3DRS_CCW_STENCILZFAIL            , D3DSTENCILOP_KEEP);
+	ChangeRenderState(D3DRS_CCW_STENCILPASS             , D3DSTENCILOP_KEEP);
+	ChangeRenderState(D3DRS_CCW_STENCILFUNC             , D3DCMP_ALWAYS);
+	ChangeRenderState(D3DRS_COLORWRITEENABLE1           , 0x0000000f);
+	ChangeRenderState(D3DRS_COLORWRITEENABLE2           , 0x0000000f);
+	ChangeRenderState(D3DRS_COLORWRITEENABLE3           , 0x0000000f);
+	ChangeRenderState(D3DRS_BLENDFACTOR                 , 0xffffffff);
+	ChangeRenderState(D3DRS_SRGBWRITEENABLE             , 0);
+	ChangeRenderState(D3DRS_DEPTHBIAS                   , 0);
+	ChangeRenderState(D3DRS_WRAP8                       , 0);
+	ChangeRenderState(D3DRS_WRAP9                       , 0);
+	ChangeRenderState(D3DRS_WRAP10                      , 0);
+	ChangeRenderState(D3DRS_WRAP11                      , 0);
+	ChangeRenderState(D3DRS_WRAP12                      , 0);
+	ChangeRenderState(D3DRS_WRAP13                      , 0);
+	ChangeRenderState(D3DRS_WRAP14                      , 0);
+	ChangeRenderState(D3DRS_WRAP15                      , 0);
+	ChangeRenderState(D3DRS_SEPARATEALPHABLENDENABLE    , FALSE);
+	ChangeRenderState(D3DRS_SRCBLENDALPHA               , D3DBLEND_ONE);
+	ChangeRenderState(D3DRS_DESTBLENDALPHA              , D3DBLEND_ZERO);
+	ChangeRenderState(D3DRS_BLENDOPALPHA                , D3DBLENDOP_ADD);
+}
+
+/**
+* Sets a render state for the stereo view output.
+* @see ChangeState()
+***/
+void StereoView::ChangeRenderState(D3DRENDERSTATETYPE State, DWORD Value)
+{
+	ChangeState(RenderStateShadow::RenderStateIndex(State), Value);
 }
 
 /**
-* Restores all Direct3D 9 render states.
-* Used for games that do not work with state blocks for some reason.
+* Sets a sampler state for the stereo view output.
+* @see ChangeState()
 ***/
-void StereoView::RestoreAllRenderStates(LPDIRECT3DDEVICE9 pDevice)
+void StereoView::ChangeSamplerState(DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD Value)
 {
-	SHOW_CALL("StereoView::RestoreAllRenderStates\n");
-	// set all Direct3D 9 RenderStates to saved values
-	DWORD dwCount = 0;
-	pDevice->SetRenderState(D3DRS_ZENABLE                     , renderStates[dwCount++]); 
-	pDevice->SetRenderState(D3DRS_FILLMODE                    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_SHADEMODE                   , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ZWRITEENABLE                , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ALPHATESTENABLE             , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_LASTPIXEL                   , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_SRCBLEND                    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_DESTBLEND                   , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_CULLMODE                    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ZFUNC                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ALPHAREF                    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ALPHAFUNC                   , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_DITHERENABLE                , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ALPHABLENDENABLE            , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_FOGENABLE                   , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_SPECULARENABLE              , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_FOGCOLOR                    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_FOGTABLEMODE                , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_FOGSTART                    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_FOGEND                      , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_FOGDENSITY                  , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_RANGEFOGENABLE              , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_STENCILENABLE               , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_STENCILFAIL                 , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_STENCILZFAIL                , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_STENCILPASS                 , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_STENCILFUNC                 , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_STENCILREF                  , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_STENCILMASK                 , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_STENCILWRITEMASK            , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_TEXTUREFACTOR               , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP0                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP1                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP2                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP3                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP4                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP5                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP6                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP7                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_CLIPPING                    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_LIGHTING                    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_AMBIENT                     , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_FOGVERTEXMODE               , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_COLORVERTEX                 , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_LOCALVIEWER                 , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_NORMALIZENORMALS            , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_DIFFUSEMATERIALSOURCE       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_SPECULARMATERIALSOURCE      , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_AMBIENTMATERIALSOURCE       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_EMISSIVEMATERIALSOURCE      , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_VERTEXBLEND                 , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_CLIPPLANEENABLE             , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_POINTSIZE                   , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_POINTSIZE_MIN               , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_POINTSPRITEENABLE           , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_POINTSCALEENABLE            , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_POINTSCALE_A                , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_POINTSCALE_B                , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_POINTSCALE_C                , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_MULTISAMPLEANTIALIAS        , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_MULTISAMPLEMASK             , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_PATCHEDGESTYLE              , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_DEBUGMONITORTOKEN           , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_POINTSIZE_MAX               , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_INDEXEDVERTEXBLENDENABLE    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE            , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_TWEENFACTOR                 , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_BLENDOP                     , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_POSITIONDEGREE              , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_NORMALDEGREE                , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_SCISSORTESTENABLE           , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_SLOPESCALEDEPTHBIAS         , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ANTIALIASEDLINEENABLE       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_MINTESSELLATIONLEVEL        , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_MAXTESSELLATIONLEVEL        , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ADAPTIVETESS_X              , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ADAPTIVETESS_Y              , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ADAPTIVETESS_Z              , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ADAPTIVETESS_W              , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_ENABLEADAPTIVETESSELLATION  , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_TWOSIDEDSTENCILMODE         , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_CCW_STENCILFAIL             , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_CCW_STENCILZFAIL            , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_CCW_STENCILPASS             , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_CCW_STENCILFUNC             , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE1           , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE2           , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_COLORWRITEENABLE3           , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_BLENDFACTOR                 , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_SRGBWRITEENABLE             , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_DEPTHBIAS                   , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP8                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP9                       , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP10                      , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP11                      , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP12                      , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP13                      , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP14                      , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_WRAP15                      , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_SEPARATEALPHABLENDENABLE    , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_SRCBLENDALPHA               , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_DESTBLENDALPHA              , renderStates[dwCount++]);
-	pDevice->SetRenderState(D3DRS_BLENDOPALPHA                , renderStates[dwCount++]);
+	ChangeState(RenderStateShadow::SamplerStateIndex(Sampler, Type), Value);
+}
+
+/**
+* Sets a texture stage state for the stereo view output.
+* @see ChangeState()
+***/
+void StereoView::ChangeTextureStageState(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value)
+{
+	ChangeState(RenderStateShadow::TextureStageStateIndex(Stage, Type), Value);
+}
+
+/**
+* Sets a state for the stereo view output, if it differs.
+* Compares against the value set earlier in this Present, or the game value from the state
+* shadow (read from the device once if unknown). Changed states are recorded to be restored
+* by RestoreChangedStates().
+* @param shadowIndex The RenderStateShadow index of the state.
+* @param Value The new value.
+***/
+void StereoView::ChangeState(UINT shadowIndex, DWORD Value)
+{
+	if (shadowIndex == SHADOW_INVALID_INDEX)
+		return;
+
+	DWORD current;
+	bool known = m_changedStates.Get(shadowIndex, &current);
+	if (!known)
+	{
+		current = m_pStateShadow->Fetch(m_pActualDevice, shadowIndex);
+		known = m_pStateShadow->IsKnown(shadowIndex);
+	}
+	if (known && (current == Value))
+		return;
+
+	RenderStateShadow::SetOnDevice(m_pActualDevice, shadowIndex, Value);
+	m_changedStates.Set(shadowIndex, Value);
+}
+
+/**
+* Sets all states changed by the stereo view back to the game values.
+* States that were set to the value the game already had are skipped.
+***/
+void StereoView::RestoreChangedStates()
+{
+	for (UINT index = m_changedStates.NextKnown(0); index != SHADOW_INVALID_INDEX; index = m_changedStates.NextKnown(index + 1))
+	{
+		DWORD changed, game;
+		m_changedStates.Get(index, &changed);
+		if (m_pStateShadow->Get(index, &game) && (game != changed))
+			RenderStateShadow::SetOnDevice(m_pActualDevice, index, game);
+	}
+	m_changedStates.ForgetAll();
 }
\ No newline at end of file
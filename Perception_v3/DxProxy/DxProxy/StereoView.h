@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "ProxyHelper.h"
 #include "D3DProxyDevice.h"
+#include "RenderStateShadow.h"
 #include <d3d9.h>
 #include <d3dx9.h>
 #include <map>
@@ -59,6 +60,7 @@ public:
 	virtual void PostReset();
 	virtual void SetVRMouseSquish(float squish){}
 	IDirect3DSurface9* GetBackBuffer();
+	void SetRenderStateShadow(RenderStateShadow* pShadow);
 
 	virtual std::string GetAdditionalFPSInfo() {return "";}
 
@@ -185,12 +187,16 @@ protected:
 	virtual void SetViewEffectInitialValues(); 
 	virtual void PostViewEffectCleanup(); 
 	virtual void CalculateShaderVariables();
+	virtual HRESULT DrawView();
 	virtual void SaveState();
 	virtual void SetState();
 	virtual void RestoreState();
-	virtual void SaveAllRenderStates(LPDIRECT3DDEVICE9 pDevice);
 	virtual void SetAllRenderStatesDefault(LPDIRECT3DDEVICE9 pDevice);
-	virtual void RestoreAllRenderStates(LPDIRECT3DDEVICE9 pDevice);
+	void ChangeRenderState(D3DRENDERSTATETYPE State, DWORD Value);
+	void ChangeSamplerState(DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD Value);
+	void ChangeTextureStageState(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value);
+	void ChangeState(UINT shadowIndex, DWORD Value);
+	void RestoreChangedStates();
 	
 	ProxyConfig *config;
 
@@ -260,11 +266,6 @@ protected:
 	***/
 	IDirect3DStateBlock9* sb;
 	/**
-	* Stores render states.
-	* For games (Half Life 2?) that do not work with direct 3d state block for some reason.
-	***/
-	DWORD renderStates[256];
-	/**
 	* View effect according to the stereo mode preset in stereo_mode.
 	***/
 	ID3DXEffect* viewEffect;
@@ -273,28 +274,22 @@ protected:
 	* Map of the shader effect file names.
 	***/
 	std::map<int, std::string> shaderEffect;
-	DWORD tssColorOp;            /**< Various states. */
-	DWORD tssColorArg1;          /**< Various states. */
-	DWORD tssAlphaOp;            /**< Various states. */
-	DWORD tssAlphaArg1;          /**< Various states. */
-	DWORD tssConstant;           /**< Various states. */
-	DWORD rsAlphaEnable;         /**< Various states. */
-	DWORD rsZEnable;             /**< Various states. */
-	DWORD rsZWriteEnable;        /**< Various states. */
-	DWORD rsDepthBias;           /**< Various states. */
-	DWORD rsSlopeScaleDepthBias; /**< Various states. */
-	DWORD rsSrgbEnable;          /**< Various states. */
-	DWORD ssSrgb;                /**< Various states. */  
-	DWORD ssSrgb1;               /**< Various states. */
-	DWORD ssAddressU;            /**< Various states. */
-	DWORD ssAddressV;            /**< Various states. */
-	DWORD ssAddressW;            /**< Various states. */
-	DWORD ssMag0;                /**< Various states. */
-	DWORD ssMag1;                /**< Various states. */
-	DWORD ssMin0;                /**< Various states. */
-	DWORD ssMin1;                /**< Various states. */
-	DWORD ssMip0;                /**< Various states. */
-	DWORD ssMip1;                /**< Various states. */
+	/**
+	* Render, sampler and texture stage states of the game.
+	* Points to the shadow of the proxy device, or to m_localStateShadow if there is none.
+	* The game states are read from here instead of being saved from the device each Present.
+	* @see SetRenderStateShadow()
+	***/
+	RenderStateShadow* m_pStateShadow;
+	/**
+	* Fallback shadow if no proxy device shadow is set, forgotten on each Present.
+	***/
+	RenderStateShadow m_localStateShadow;
+	/**
+	* States changed by the stereo view during the current Present (with the value set).
+	* Only these are restored to the game values. @see RestoreChangedStates()
+	***/
+	RenderStateShadow m_changedStates;
 	/**
 	* Determines how to save render states for stereo view output.
 	***/
@@ -29,6 +29,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "StereoViewFactory.h"
 #include "StereoViewInterleave.h"
+#include "StereoViewRift.h"
 #include "OculusDirectToRiftView.h"
 /**
 *  Get stereo view. 
@@ -47,10 +48,12 @@ StereoView* StereoViewFactory::Get(ProxyConfig *config, HMDisplayInfo *hmd, Moti
 	case StereoView::ANAGLYPH_GREEN_MAGENTA:
 	case StereoView::ANAGLYPH_GREEN_MAGENTA_GRAY:
 	case StereoView::SIDE_BY_SIDE:
-	case StereoView::DIY_RIFT:
 	case StereoView::OVER_UNDER:
 		return new StereoView(config);
 		break;
+	case StereoView::DIY_RIFT:
+		return new StereoViewRift(config, hmd);
+		break;
 	case StereoView::OCULUS_DIRECT_MODE:
 		return new OculusDirectToRiftView(config, hmd, tracker);
 		break;	
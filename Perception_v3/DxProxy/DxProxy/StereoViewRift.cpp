@@ -0,0 +1,243 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <StereoViewRift.cpp> and
+Class <StereoViewRift> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#include "StereoViewRift.h"
+
+/**
+* Constructor.
+***/ 
+StereoViewRift::StereoViewRift(ProxyConfig *config, HMDisplayInfo *hmd) : StereoView(config),
+	hmdInfo(hmd),
+	meshVertexBuffer(NULL),
+	meshIndexBuffer(NULL),
+	meshVertexDeclaration(NULL)
+{
+	OutputDebugString("Created StereoView Rift\n");
+
+	LensCenter[0] = 0.25f;
+	LensCenter[1] = 0.5f;
+	Scale[0] = Scale[1] = 1.0f;
+	ScaleIn[0] = ScaleIn[1] = 1.0f;
+}
+
+/**
+* Empty destructor.
+***/ 
+StereoViewRift::~StereoViewRift()
+{
+}
+
+/**
+* Releases the mesh buffers, then the base class resources.
+***/
+void StereoViewRift::ReleaseEverything()
+{
+	SHOW_CALL("StereoViewRift::ReleaseEverything()");
+
+	if (meshVertexBuffer)
+		meshVertexBuffer->Release();
+	meshVertexBuffer = NULL;
+
+	if (meshIndexBuffer)
+		meshIndexBuffer->Release();
+	meshIndexBuffer = NULL;
+
+	if (meshVertexDeclaration)
+		meshVertexDeclaration->Release();
+	meshVertexDeclaration = NULL;
+
+	StereoView::ReleaseEverything();
+}
+
+/**
+* Creates the screen quad and the distortion mesh buffers.
+* The mesh is loaded from the fx folder cache or generated (and cached) from the HMD profile.
+***/
+void StereoViewRift::InitVertexBuffers()
+{
+	SHOW_CALL("StereoViewRift::InitVertexBuffers\n");
+
+	StereoView::InitVertexBuffers();
+
+	// same lens space as OculusRiftView : y is scaled by ScaleIn[1] = 4 / aspect,
+	// twice the half screen extent so the mesh still covers the screen with a lens y offset
+	D3DSURFACE_DESC eyeTextureDescriptor;
+	leftSurface->GetDesc(&eyeTextureDescriptor);
+	float inputTextureAspectRatio = (float)eyeTextureDescriptor.Width / (float)eyeTextureDescriptor.Height;
+	float yExtent = 4.0f / inputTextureAspectRatio;
+
+	ProxyHelper helper = ProxyHelper();
+	if (!mesh.LoadOrGenerate(hmdInfo, yExtent, MESH_RESOLUTION, MESH_RESOLUTION, helper.GetPath("fx\\")))
+	{
+		OutputDebugString("StereoViewRift : Distortion mesh creation failed\n");
+		return;
+	}
+
+	const std::vector<DistortionVertex>& vertices = mesh.GetVertices();
+	const std::vector<WORD>& indices = mesh.GetIndices();
+	UINT vertexSize = (UINT)(vertices.size() * sizeof(DistortionVertex));
+	UINT indexSize = (UINT)(indices.size() * sizeof(WORD));
+
+	HRESULT hr = S_OK;
+	IDirect3DDevice9Ex *pDirect3DDevice9Ex = NULL;
+	if (SUCCEEDED(m_pActualDevice->QueryInterface(IID_IDirect3DDevice9Ex, reinterpret_cast<void**>(&pDirect3DDevice9Ex))))
+	{
+		//Must use default pool for DX9Ex 
+		hr = pDirect3DDevice9Ex->CreateVertexBuffer(vertexSize, D3DUSAGE_WRITEONLY, 0, D3DPOOL_DEFAULT, &meshVertexBuffer, NULL);
+		if (SUCCEEDED(hr))
+			hr = pDirect3DDevice9Ex->CreateIndexBuffer(indexSize, D3DUSAGE_WRITEONLY, D3DFMT_INDEX16, D3DPOOL_DEFAULT, &meshIndexBuffer, NULL);
+		pDirect3DDevice9Ex->Release();
+	}
+	else
+	{
+		hr = m_pActualDevice->CreateVertexBuffer(vertexSize, D3DUSAGE_WRITEONLY, 0, D3DPOOL_MANAGED, &meshVertexBuffer, NULL);
+		if (SUCCEEDED(hr))
+			hr = m_pActualDevice->CreateIndexBuffer(indexSize, D3DUSAGE_WRITEONLY, D3DFMT_INDEX16, D3DPOOL_MANAGED, &meshIndexBuffer, NULL);
+	}
+
+	if (FAILED(hr))
+	{
+		char buffer[256];
+		sprintf_s(buffer, "StereoViewRift : Create mesh buffers - Failed: 0x%0.8x", hr);
+		OutputDebugString(buffer);
+		return;
+	}
+
+	void* data;
+	if (SUCCEEDED(meshVertexBuffer->Lock(0, 0, &data, NULL)))
+	{
+		memcpy(data, &vertices[0], vertexSize);
+		meshVertexBuffer->Unlock();
+	}
+	if (SUCCEEDED(meshIndexBuffer->Lock(0, 0, &data, NULL)))
+	{
+		memcpy(data, &indices[0], indexSize);
+		meshIndexBuffer->Unlock();
+	}
+
+	// position, red, green and blue uv
+	D3DVERTEXELEMENT9 elements[] =
+	{
+		{ 0, 0, D3DDECLTYPE_FLOAT2, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_POSITION, 0 },
+		{ 0, 8, D3DDECLTYPE_FLOAT2, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 0 },
+		{ 0, 16, D3DDECLTYPE_FLOAT2, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 1 },
+		{ 0, 24, D3DDECLTYPE_FLOAT2, D3DDECLMETHOD_DEFAULT, D3DDECLUSAGE_TEXCOORD, 2 },
+		D3DDECL_END()
+	};
+	if (FAILED(m_pActualDevice->CreateVertexDeclaration(elements, &meshVertexDeclaration)))
+		OutputDebugString("StereoViewRift : CreateVertexDeclaration failed\n");
+}
+
+/**
+* Loads the distortion mesh shader effect.
+***/ 
+void StereoViewRift::InitShaderEffects()
+{
+	SHOW_CALL("StereoViewRift::InitShaderEffects\n");
+
+	shaderEffect[DIY_RIFT] = "SideBySideRiftMesh.fx";
+
+	ProxyHelper helper = ProxyHelper();
+	std::string viewPath = helper.GetPath("fx\\") + shaderEffect[config->stereo_mode];
+
+	if (FAILED(D3DXCreateEffectFromFile(m_pActualDevice, viewPath.c_str(), NULL, NULL, D3DXFX_DONOTSAVESTATE, NULL, &viewEffect, NULL))) {
+		OutputDebugString("Effect creation failed\n");
+	}
+}
+
+/**
+* Sets the lens to screen and texture space mapping.
+***/
+void StereoViewRift::SetViewEffectInitialValues()
+{
+	viewEffect->SetFloatArray("LensCenter", LensCenter, 2);
+	viewEffect->SetFloatArray("Scale", Scale, 2);
+	viewEffect->SetFloatArray("ScaleIn", ScaleIn, 2);
+	viewEffect->SetFloat("Chroma", chromaticAberrationCorrection ? 1.0f : 0.0f);
+	viewEffect->SetFloat("RightEye", 0.0f);
+}
+
+/**
+* Calculates the lens to screen and texture space mapping, same as OculusRiftView.
+***/ 
+void StereoViewRift::CalculateShaderVariables()
+{
+	SHOW_CALL("StereoViewRift::CalculateShaderVariables");
+
+	// Lens offset is in a -1 to 1 range, the half screen x is in a 0 to 0.5 range
+	LensCenter[0] = 0.25f + (hmdInfo->GetLensXCenterOffset() * 0.25f);
+	// Center of the half screen is 0.5 in y (0 to 1 range)
+	LensCenter[1] = 0.5f - config->YOffset;
+
+	D3DSURFACE_DESC eyeTextureDescriptor;
+	leftSurface->GetDesc(&eyeTextureDescriptor);
+	float inputTextureAspectRatio = (float)eyeTextureDescriptor.Width / (float)eyeTextureDescriptor.Height;
+
+	ScaleIn[0] = 4.0f;
+	ScaleIn[1] = 2.0f / (inputTextureAspectRatio * 0.5f);
+
+	float scaleFactor = (1.0f / (hmdInfo->GetScaleToFillHorizontal() + config->DistortionScale));
+	Scale[0] = (1.0f / 4.0f) * scaleFactor;
+	Scale[1] = (1.0f / 2.0f) * scaleFactor * inputTextureAspectRatio;
+}
+
+/**
+* Draws the mesh once per eye, mirrored for the right eye.
+* Falls back to the screen quad if the mesh failed to create.
+***/
+HRESULT StereoViewRift::DrawView()
+{
+	if ((!meshVertexBuffer) || (!meshIndexBuffer) || (!meshVertexDeclaration))
+		return StereoView::DrawView();
+
+	IDirect3DIndexBuffer9* lastIndices = NULL;
+	m_pActualDevice->GetIndices(&lastIndices);
+
+	m_pActualDevice->SetVertexDeclaration(meshVertexDeclaration);
+	m_pActualDevice->SetStreamSource(0, meshVertexBuffer, 0, sizeof(DistortionVertex));
+	m_pActualDevice->SetIndices(meshIndexBuffer);
+
+	UINT vertexCount = (UINT)mesh.GetVertices().size();
+	UINT primitiveCount = (UINT)mesh.GetIndices().size() / 3;
+	HRESULT hr = S_OK;
+	for (int eye = 0; eye < 2; eye++)
+	{
+		viewEffect->SetFloat("RightEye", (float)eye);
+		viewEffect->CommitChanges();
+		if (FAILED(m_pActualDevice->DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, 0, vertexCount, 0, primitiveCount)))
+			hr = E_FAIL;
+	}
+
+	m_pActualDevice->SetIndices(lastIndices);
+	if (lastIndices)
+		lastIndices->Release();
+	m_pActualDevice->SetStreamSource(0, screenVertexBuffer, 0, sizeof(TEXVERTEX));
+
+	return hr;
+}
@@ -0,0 +1,98 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <StereoViewRift.h> and
+Class <StereoViewRift> :
+Copyright (C) 2020 Denis Reischl
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+
+#ifndef STEREOVIEWRIFT_H_INCLUDED
+#define STEREOVIEWRIFT_H_INCLUDED
+
+#include "StereoView.h"
+#include "HMDisplayInfo.h"
+#include "DistortionMesh.h"
+
+/**
+* DIY Rift render class.
+* Draws both eyes through a precomputed DistortionMesh of the HMD profile
+* instead of evaluating the distortion per pixel.
+***/
+class StereoViewRift : public StereoView
+{
+public:
+	StereoViewRift(ProxyConfig *config, HMDisplayInfo *hmd);
+	~StereoViewRift();
+
+	/*** StereoView public methods ***/
+	virtual void ReleaseEverything();
+
+protected:
+	/*** StereoViewRift protected methods ***/
+	virtual void InitVertexBuffers();
+	virtual void InitShaderEffects();
+	virtual void SetViewEffectInitialValues();
+	virtual void CalculateShaderVariables();
+	virtual HRESULT DrawView();
+
+private:
+	/**
+	* Mesh tessellation, columns and rows.
+	***/
+	static const UINT MESH_RESOLUTION = 128;
+	/**
+	* The head mounted display info.
+	***/
+	HMDisplayInfo *hmdInfo;
+	/**
+	* The distortion mesh, left eye.
+	***/
+	DistortionMesh mesh;
+	/**
+	* Mesh vertex buffer.
+	***/
+	IDirect3DVertexBuffer9* meshVertexBuffer;
+	/**
+	* Mesh index buffer, 16 bit.
+	***/
+	IDirect3DIndexBuffer9* meshIndexBuffer;
+	/**
+	* Mesh vertex declaration.
+	***/
+	IDirect3DVertexDeclaration9* meshVertexDeclaration;
+	/**
+	* Lens center position, screen space (0.0 to 0.5 on x, 0.0 to 1.0 on y).
+	***/
+	float LensCenter[2];
+	/**
+	* Lens space to texture space scale.
+	***/
+	float Scale[2];
+	/**
+	* Screen space to lens space scale.
+	***/
+	float ScaleIn[2];
+};
+
+#endif
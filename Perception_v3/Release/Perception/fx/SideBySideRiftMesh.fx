@@ -0,0 +1,75 @@
+// Combines two images into one warped Side-by-Side image, drawn as a distortion mesh.
+// The mesh (DistortionMesh) holds the lens distortion and the chromatic aberration
+// correction per vertex, so this only maps the mesh to the screen and samples.
+
+sampler2D TexMap0;
+sampler2D TexMap1;
+
+float2 LensCenter;
+float2 Scale;
+float2 ScaleIn;
+float Chroma;
+float RightEye;
+
+struct VS_OUT
+{
+	float4 Position : POSITION;
+	float2 TexRed   : TEXCOORD0;
+	float2 TexGreen : TEXCOORD1;
+	float2 TexBlue  : TEXCOORD2;
+};
+
+// Lens space to texture space, same as HmdWarp() in OculusRift.fx
+float2 LensToTexture(float2 theta)
+{
+	float2 tex = float2(2.0f * Scale.x, Scale.y) * theta + 0.5f;
+	if (RightEye > 0.5f)
+		tex.x = 1.0f - tex.x;
+	return tex;
+}
+
+VS_OUT MeshVS(float2 Pos : POSITION, float2 Red : TEXCOORD0, float2 Green : TEXCOORD1, float2 Blue : TEXCOORD2)
+{
+	VS_OUT Out;
+
+	// lens space to screen space, left half of the screen, mirror for the right eye
+	float2 screen = LensCenter + Pos / ScaleIn;
+	if (RightEye > 0.5f)
+		screen.x = 1.0f - screen.x;
+	Out.Position = float4(screen.x * 2.0f - 1.0f, 1.0f - screen.y * 2.0f, 0.0f, 1.0f);
+
+	Out.TexGreen = LensToTexture(Green);
+	Out.TexRed = LensToTexture(lerp(Green, Red, Chroma));
+	Out.TexBlue = LensToTexture(lerp(Green, Blue, Chroma));
+	return Out;
+}
+
+float4 MeshPS(VS_OUT In) : COLOR
+{
+	if (any(clamp(In.TexBlue.xy, float2(0.0,0.0), float2(1.0, 1.0)) - In.TexBlue.xy))
+		return 0;
+
+	float4 outColor = float4(0.0f, 0.0f, 0.0f, 1.0f);
+	if (RightEye > 0.5f)
+	{
+		outColor.r = tex2D(TexMap1, In.TexRed).r;
+		outColor.g = tex2D(TexMap1, In.TexGreen).g;
+		outColor.b = tex2D(TexMap1, In.TexBlue).b;
+	}
+	else
+	{
+		outColor.r = tex2D(TexMap0, In.TexRed).r;
+		outColor.g = tex2D(TexMap0, In.TexGreen).g;
+		outColor.b = tex2D(TexMap0, In.TexBlue).b;
+	}
+	return outColor;
+}
+
+technique ViewShader
+{
+	pass P0
+	{
+		VertexShader = compile vs_2_0 MeshVS();
+		PixelShader  = compile ps_2_0 MeshPS();
+	}
+}
@@ -119,6 +119,300 @@ void EraseCharacter(string& string, char character)
 	}
 }
 
+/**
+* Profile cache file header.
+***/
+struct ProfileCacheHeader
+{
+	DWORD  magic;                 /**< 'VPCC' */
+	DWORD  version;               /**< Cache layout version. */
+	UINT64 sourceWriteTime;       /**< Write time of the "profiles.xml" the cache was built from. */
+	UINT64 sourceSize;            /**< Size of the "profiles.xml" the cache was built from. */
+	DWORD  entryCount;            /**< Number of profile entries. */
+	DWORD  elementsSize;          /**< Size of the raw element buffer in bytes. */
+};
+static const DWORD PROFILE_CACHE_MAGIC = 0x43435056;
+static const DWORD PROFILE_CACHE_VERSION = 1;
+
+/**
+* Constructor.
+***/
+ProfileCatalogue::ProfileCatalogue() :
+	m_sourceWriteTime(0),
+	m_sourceSize(0)
+{
+}
+
+/**
+* Case-insensitive FNV-1a hash.
+***/
+size_t ProfileCatalogue::ExeHash::operator()(const std::string& str) const
+{
+	size_t hash = 2166136261u;
+	for (size_t i = 0; i < str.size(); i++)
+	{
+		hash ^= (size_t)::tolower((unsigned char)str[i]);
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+/**
+* Loads the catalogue for the specified profile file.
+* Does nothing if the source file did not change since the last call. Otherwise the
+* binary cache is used if it matches the source file, else the source is parsed and
+* the cache is rewritten.
+* @param profilePath Full path of "profiles.xml".
+* @param cachePath Full path of the binary cache file.
+***/
+bool ProfileCatalogue::Load(const std::string& profilePath, const std::string& cachePath)
+{
+	WIN32_FILE_ATTRIBUTE_DATA fileData;
+	if (!GetFileAttributesExA(profilePath.c_str(), GetFileExInfoStandard, &fileData))
+	{
+		m_sourcePath.clear();
+		m_entries.clear();
+		m_elements.clear();
+		m_exeIndex.clear();
+		return false;
+	}
+	UINT64 writeTime = ((UINT64)fileData.ftLastWriteTime.dwHighDateTime << 32) | (UINT64)fileData.ftLastWriteTime.dwLowDateTime;
+	UINT64 size = ((UINT64)fileData.nFileSizeHigh << 32) | (UINT64)fileData.nFileSizeLow;
+
+	// catalogue in memory still up to date ?
+	if ((m_sourcePath == profilePath) && (m_sourceWriteTime == writeTime) && (m_sourceSize == size))
+		return true;
+
+	m_sourcePath = profilePath;
+	m_sourceWriteTime = writeTime;
+	m_sourceSize = size;
+
+	// binary cache matching ?
+	if (ReadCache(cachePath))
+		return true;
+
+	// parse the source, rewrite the cache
+	if (!Build(profilePath))
+	{
+		m_sourcePath.clear();
+		return false;
+	}
+	if (!WriteCache(cachePath))
+		debugf("Failed to write profile cache: %s\n", cachePath.c_str());
+
+	return true;
+}
+
+/**
+* Finds the first profile (in file order) matching the process name.
+* @param exe The process name (case-insensitive).
+* @param path The target path, checked against "dir_contains" if not NULL.
+* @param arch The cpu architecture filter.
+***/
+const ProfileCatalogue::ProfileEntry* ProfileCatalogue::Find(const std::string& exe, const char* path, ArchitectureFilter arch) const
+{
+	auto it = m_exeIndex.find(exe);
+	if (it == m_exeIndex.end())
+		return nullptr;
+
+	for (UINT index : it->second)
+	{
+		const ProfileEntry& entry = m_entries[index];
+		if ((arch == Architecture32bit) && (entry.is64bit)) continue;
+		if ((arch == Architecture64bit) && (!entry.is64bit)) continue;
+
+		//Check against dir name too if present
+		if (path && entry.dir_contains.length())
+		{
+			if (string(path).find(entry.dir_contains) == string::npos)
+				continue;
+		}
+
+		return &entry;
+	}
+	return nullptr;
+}
+
+/**
+* Parses the raw element of a single profile.
+* The <profile> node is the first child of the returned document.
+***/
+bool ProfileCatalogue::Materialize(const ProfileEntry* entry, xml_document& doc) const
+{
+	if ((!entry) || ((size_t)entry->elementOffset + entry->elementSize > m_elements.size()))
+		return false;
+
+	return doc.load_buffer(m_elements.data() + entry->elementOffset, entry->elementSize).status == status_ok;
+}
+
+/**
+* Parses the profile source file and fills entries and element buffer.
+***/
+bool ProfileCatalogue::Build(const std::string& profilePath)
+{
+	m_entries.clear();
+	m_elements.clear();
+	m_exeIndex.clear();
+
+	xml_document docProfiles;
+	xml_parse_result resultProfiles = docProfiles.load_file(profilePath.c_str());
+	if (resultProfiles.status != status_ok)
+		return false;
+
+	xml_node xml_profiles = docProfiles.child("profiles");
+	for (xml_node profile = xml_profiles.child("profile"); profile; profile = profile.next_sibling("profile"))
+	{
+		ProfileEntry entry;
+		entry.game_exe = strToLower(profile.attribute("game_exe").as_string());
+		entry.game_name = profile.attribute("game_name").as_string();
+		entry.dir_contains = profile.attribute("dir_contains").as_string();
+		entry.is64bit = string(profile.attribute("cpu_architecture").as_string("32bit")) == "64bit";
+
+		// keep the unformatted element for later materialization
+		std::ostringstream element;
+		profile.print(element, "", format_raw);
+		entry.elementOffset = (UINT)m_elements.size();
+		m_elements += element.str();
+		entry.elementSize = (UINT)m_elements.size() - entry.elementOffset;
+
+		m_entries.push_back(entry);
+	}
+
+	BuildIndex();
+	return true;
+}
+
+/**
+* Reads the binary cache, fails if it does not match the current source file.
+***/
+bool ProfileCatalogue::ReadCache(const std::string& cachePath)
+{
+	std::ifstream file(cachePath, std::ios::in | std::ios::binary | std::ios::ate);
+	if (!file.is_open())
+		return false;
+	std::streamoff fileSize = file.tellg();
+	if (fileSize < (std::streamoff)sizeof(ProfileCacheHeader))
+		return false;
+	std::string data((size_t)fileSize, '\0');
+	file.seekg(0, std::ios::beg);
+	if (!file.read(&data[0], fileSize))
+		return false;
+
+	ProfileCacheHeader header;
+	memcpy(&header, data.data(), sizeof(ProfileCacheHeader));
+	if ((header.magic != PROFILE_CACHE_MAGIC) ||
+		(header.version != PROFILE_CACHE_VERSION) ||
+		(header.sourceWriteTime != m_sourceWriteTime) ||
+		(header.sourceSize != m_sourceSize))
+		return false;
+
+	// read helpers, bounds checked
+	size_t pos = sizeof(ProfileCacheHeader);
+	auto readDword = [&](DWORD& value) -> bool
+	{
+		if (pos + sizeof(DWORD) > data.size()) return false;
+		memcpy(&value, data.data() + pos, sizeof(DWORD));
+		pos += sizeof(DWORD);
+		return true;
+	};
+	auto readString = [&](std::string& value) -> bool
+	{
+		DWORD length;
+		if ((!readDword(length)) || (pos + length > data.size())) return false;
+		value.assign(data.data() + pos, length);
+		pos += length;
+		return true;
+	};
+
+	// check the header counts against the file size before allocating anything, a corrupt cache is rebuilt
+	// (each entry is at least three string lengths and three dwords)
+	const size_t entrySizeMin = sizeof(DWORD) * 6;
+	size_t payloadSize = data.size() - sizeof(ProfileCacheHeader);
+	if (((size_t)header.elementsSize > payloadSize) ||
+		((size_t)header.entryCount > (payloadSize - header.elementsSize) / entrySizeMin))
+		return false;
+
+	std::vector<ProfileEntry> entries(header.entryCount);
+	for (ProfileEntry& entry : entries)
+	{
+		DWORD is64bit, elementOffset, elementSize;
+		if ((!readString(entry.game_exe)) ||
+			(!readString(entry.game_name)) ||
+			(!readString(entry.dir_contains)) ||
+			(!readDword(is64bit)) ||
+			(!readDword(elementOffset)) ||
+			(!readDword(elementSize)))
+			return false;
+		entry.is64bit = (is64bit != 0);
+		entry.elementOffset = (UINT)elementOffset;
+		entry.elementSize = (UINT)elementSize;
+		if ((size_t)entry.elementOffset + entry.elementSize > header.elementsSize)
+			return false;
+	}
+	if (pos + header.elementsSize != data.size())
+		return false;
+
+	m_entries.swap(entries);
+	m_elements.assign(data.data() + pos, header.elementsSize);
+	BuildIndex();
+	return true;
+}
+
+/**
+* Writes the binary cache.
+***/
+bool ProfileCatalogue::WriteCache(const std::string& cachePath) const
+{
+	std::ofstream file(cachePath, std::ios::out | std::ios::binary | std::ios::trunc);
+	if (!file.is_open())
+		return false;
+
+	ProfileCacheHeader header;
+	header.magic = PROFILE_CACHE_MAGIC;
+	header.version = PROFILE_CACHE_VERSION;
+	header.sourceWriteTime = m_sourceWriteTime;
+	header.sourceSize = m_sourceSize;
+	header.entryCount = (DWORD)m_entries.size();
+	header.elementsSize = (DWORD)m_elements.size();
+	file.write((const char*)&header, sizeof(ProfileCacheHeader));
+
+	auto writeDword = [&](DWORD value) { file.write((const char*)&value, sizeof(DWORD)); };
+	auto writeString = [&](const std::string& value) { writeDword((DWORD)value.size()); file.write(value.data(), value.size()); };
+	for (const ProfileEntry& entry : m_entries)
+	{
+		writeString(entry.game_exe);
+		writeString(entry.game_name);
+		writeString(entry.dir_contains);
+		writeDword(entry.is64bit ? 1 : 0);
+		writeDword(entry.elementOffset);
+		writeDword(entry.elementSize);
+	}
+	file.write(m_elements.data(), m_elements.size());
+
+	return file.good();
+}
+
+/**
+* Rebuilds the process name index from the entries.
+***/
+void ProfileCatalogue::BuildIndex()
+{
+	m_exeIndex.clear();
+	m_exeIndex.reserve(m_entries.size());
+	for (UINT i = 0; i < (UINT)m_entries.size(); i++)
+		m_exeIndex[m_entries[i].game_exe].push_back(i);
+}
+
+/**
+* Returns the process-wide profile catalogue, up to date with "cfg\profiles.xml".
+***/
+static const ProfileCatalogue& GetProfileCatalogue(const string& profilePath, const string& cachePath)
+{
+	static ProfileCatalogue catalogue;
+	catalogue.Load(profilePath, cachePath);
+	return catalogue;
+}
+
 /*!
 \brief Check if a process is running
 \param [in] processName Name of process to check if is running
@@ -741,49 +1035,27 @@ bool ProxyHelper::LoadConfig(ProxyConfig& config, OculusProfile& oculusProfile)
 	debugf("Got target exe as: %s\n", targetExe.c_str());
 	targetExe = strToLower(targetExe);
 
-	// get the profile
+	// get the profile, only the matching element is parsed
 	bool profileFound = false;
 	string profilePath = GetPath("cfg\\profiles.xml");
 	debugf("%s\n", profilePath.c_str());
 	string targetPath = GetTargetPath();
 
-	xml_document docProfiles;
-	xml_parse_result resultProfiles = docProfiles.load_file(profilePath.c_str());
-	xml_node profile;
+	const ProfileCatalogue& catalogue = GetProfileCatalogue(profilePath, GetPath("cfg\\profiles.cache"));
+	const ProfileCatalogue::ProfileEntry* entry = catalogue.Find(targetExe, targetPath.length() ? targetPath.c_str() : NULL,
+		string(CPUARCH_STR) == "64bit" ? ProfileCatalogue::Architecture64bit : ProfileCatalogue::Architecture32bit);
+
+	xml_document docProfile;
 	xml_node gameProfile;
 
-	if(resultProfiles.status == status_ok)
+	if (catalogue.Materialize(entry, docProfile))
 	{
-		xml_node xml_profiles = docProfiles.child("profiles");
-
-		for (xml_node profile = xml_profiles.child("profile"); profile; profile = profile.next_sibling("profile"))
-		{
-			// first, convert to lowercase
-			string profileProcess = profile.attribute("game_exe").as_string();
-			profileProcess = strToLower(profileProcess);
-
-			string cpuArch = profile.attribute("cpu_architecture").as_string("32bit");
-
-			// profile found - now has to match on exe name and cpu architecture
-			if(targetExe == profileProcess
-			   && cpuArch == string(CPUARCH_STR))
-			{
-				//Check against dir name too if present
-				if (string(profile.attribute("dir_contains").as_string()).length() && targetPath.length()>0)
-				{
-					if (targetPath.find(profile.attribute("dir_contains").as_string()) == string::npos)
-						continue;
-				}
-
-				debugf("Found specific profile: %s (%s)\n", profile.attribute("game_name").as_string(), cpuArch.c_str());
-				gameProfile = profile;
-				profileFound = true;
-				break;
-			}
-		}
+		gameProfile = docProfile.child("profile");
+		debugf("Found specific profile: %s (%s)\n", entry->game_name.c_str(), CPUARCH_STR);
+		profileFound = true;
 	}
 
-	if(resultProfiles.status == status_ok && profileFound && gameProfile)
+	if(profileFound && gameProfile)
 	{
 		OutputDebugString("Set the config to profile!!!\n");
 
@@ -1111,6 +1383,8 @@ void HandleGameProfile(ProxyHelper::ConfigTransferDirection dir, xml_node &node,
 	HANDLE_SETTING(draw_reticule,			true);
 	HANDLE_SETTING(draw_sky,				true);
 
+	HANDLE_SETTING(stereo_batch,			false);
+
 	HANDLE_SETTING(WorldFOV,                95.0f);
 	HANDLE_SETTING(PlayerFOV,               125.0f);
 	HANDLE_SETTING(FarPlaneFOV,             95.0f);
@@ -1183,59 +1457,26 @@ bool ProxyHelper::ParseGameType(std::string gameType, ProxyHelper::GameTypeEntry
 bool ProxyHelper::HasProfile(const char* name, const char *path)
 {
 	// get the profile
-	bool profileFound = false;
 	string profilePath = GetPath("cfg\\profiles.xml");
-	
-	xml_document docProfiles;
-	xml_parse_result resultProfiles = docProfiles.load_file(profilePath.c_str());
-	xml_node profile;
+	const ProfileCatalogue& catalogue = GetProfileCatalogue(profilePath, GetPath("cfg\\profiles.cache"));
 
-	if(resultProfiles.status == status_ok)
+	if (catalogue.Find(name, path, ProfileCatalogue::AnyArchitecture))
 	{
-		xml_node xml_profiles = docProfiles.child("profiles");
-
-		for (xml_node profile = xml_profiles.child("profile"); profile; profile = profile.next_sibling("profile"))
-		{
-			if(strcmp(name, profile.attribute("game_exe").value()) == 0)
-			{
-				//Check against dir name too if present
-				if (profile.attribute("dir_contains").as_string() && path)
-				{
-					if (string(path).find(profile.attribute("dir_contains").as_string()) == string::npos)
-						continue;
-				}
-
-				OutputDebugString("Found a profile!!!\n");
-				profileFound = true;
-				break;
-			}
-		}
+		OutputDebugString("Found a profile!!!\n");
+		return true;
 	}
 
-	return profileFound;
+	return false;
 }
 
 bool ProxyHelper::GetProfileGameExes(std::vector<std::pair<std::string, bool>> &gameExes)
 {
 	// get the profile
 	string profilePath = GetPath("cfg\\profiles.xml");
+	const ProfileCatalogue& catalogue = GetProfileCatalogue(profilePath, GetPath("cfg\\profiles.cache"));
 
-	xml_document docProfiles;
-	xml_parse_result resultProfiles = docProfiles.load_file(profilePath.c_str());
-	xml_node profile;
-
-	if(resultProfiles.status == status_ok)
-	{
-		xml_node xml_profiles = docProfiles.child("profiles");
-
-		for (xml_node profile = xml_profiles.child("profile"); profile; profile = profile.next_sibling("profile"))
-		{
-			string exe = profile.attribute("game_exe").value();
-			exe = strToLower(exe);
-			bool _64bit = profile.attribute("cpu_architecture").as_string("32bit") == string("64bit");
-			gameExes.push_back(std::make_pair(exe, _64bit));
-		}
-	}
+	for (const ProfileCatalogue::ProfileEntry& entry : catalogue.GetEntries())
+		gameExes.push_back(std::make_pair(entry.game_exe, entry.is64bit));
 
 	return gameExes.size() > 0;
 }
@@ -1249,38 +1490,16 @@ bool ProxyHelper::GetProfileGameExes(std::vector<std::pair<std::string, bool>> &
 bool ProxyHelper::GetProfile(char* name, char *path, bool _64bit, ProxyConfig& config)
 {
 	// get the profile
-	bool profileFound = false;
 	string profilePath = GetPath("cfg\\profiles.xml");
+	const ProfileCatalogue& catalogue = GetProfileCatalogue(profilePath, GetPath("cfg\\profiles.cache"));
 
-	xml_document docProfiles;
-	xml_parse_result resultProfiles = docProfiles.load_file(profilePath.c_str());
-	xml_node profile;
-
-	if(resultProfiles.status == status_ok)
+	if (catalogue.Find(name, path, _64bit ? ProfileCatalogue::Architecture64bit : ProfileCatalogue::Architecture32bit))
 	{
-		xml_node xml_profiles = docProfiles.child("profiles");
-
-		for (xml_node profile = xml_profiles.child("profile"); profile; profile = profile.next_sibling("profile"))
-		{
-			if(strcmp(name, profile.attribute("game_exe").value()) == 0 &&
-				_64bit == (profile.attribute("cpu_architecture").as_string("32bit") == string("64bit")))
-			{
-				//Check against dir name too if present
-				if (profile.attribute("dir_contains").as_string() && path)
-				{
-					if (string(path).find(profile.attribute("dir_contains").as_string()) == string::npos)
-						continue;
-				}
-
-				OutputDebugString("Found a profile!!!\n");
-				profileFound = true;
-
-				break;
-			}
-		}
+		OutputDebugString("Found a profile!!!\n");
+		return true;
 	}
 
-	return profileFound;
+	return false;
 }
 
 
@@ -35,6 +35,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <sstream>
 #include <string>
 #include <vector>
+#include <unordered_map>
 #include <windows.h>
 #include "ConfigDefaults.h"
 #include "InputControls.h"
@@ -103,6 +104,9 @@ struct ProxyConfig
 	bool        draw_player;
 	bool        draw_sky;
 
+	/// Defer the other side of a run of draws and replay it after a single side switch?
+	bool        stereo_batch;
+
 	/// Angle (in degrees) to turn by when a snap-turn button is pressed
 	float ComfortModeYawIncrement;
 	
@@ -170,6 +174,87 @@ struct ProxyConfig
 };
 extern const ProxyConfig defaultConfig;
 
+/**
+* Indexed game profile catalogue.
+* Holds a compact index of all <profile> elements in "profiles.xml", keyed by the
+* (case-insensitive) process name. The raw element text is kept per entry and only
+* parsed when a profile is actually requested. The index is persisted to a binary
+* cache file and rebuilt only if the source file changed (write time or size).
+***/
+class ProfileCatalogue
+{
+public:
+	ProfileCatalogue();
+
+	/**
+	* Profile index entry.
+	***/
+	struct ProfileEntry
+	{
+		std::string game_exe;          /**< Process name (lowercase). */
+		std::string game_name;         /**< Game name. */
+		std::string dir_contains;      /**< Part of the folder name, used to filter. */
+		bool        is64bit;           /**< True for 64-bit profiles. */
+		UINT        elementOffset;     /**< Offset of the raw <profile> element in the element buffer. */
+		UINT        elementSize;       /**< Size of the raw <profile> element in bytes. */
+	};
+
+	/**
+	* Cpu architecture filter for profile lookup.
+	***/
+	enum ArchitectureFilter
+	{
+		AnyArchitecture,
+		Architecture32bit,
+		Architecture64bit
+	};
+
+	bool                             Load(const std::string& profilePath, const std::string& cachePath);
+	const ProfileEntry*              Find(const std::string& exe, const char* path, ArchitectureFilter arch) const;
+	bool                             Materialize(const ProfileEntry* entry, pugi::xml_document& doc) const;
+	const std::vector<ProfileEntry>& GetEntries() const { return m_entries; }
+
+private:
+	/**
+	* Case-insensitive FNV-1a hash for process names.
+	***/
+	struct ExeHash
+	{
+		size_t operator()(const std::string& str) const;
+	};
+	/**
+	* Case-insensitive compare for process names.
+	***/
+	struct ExeEqual
+	{
+		bool operator()(const std::string& a, const std::string& b) const { return _stricmp(a.c_str(), b.c_str()) == 0; }
+	};
+
+	bool Build(const std::string& profilePath);
+	bool ReadCache(const std::string& cachePath);
+	bool WriteCache(const std::string& cachePath) const;
+	void BuildIndex();
+
+	/**
+	* Write time and size of the source file the catalogue was built from.
+	***/
+	UINT64 m_sourceWriteTime;
+	UINT64 m_sourceSize;
+	std::string m_sourcePath;
+	/**
+	* All profiles, in file order.
+	***/
+	std::vector<ProfileEntry> m_entries;
+	/**
+	* Raw (unformatted) <profile> elements, concatenated.
+	***/
+	std::string m_elements;
+	/**
+	* Process name -> indices into m_entries (file order).
+	***/
+	std::unordered_map<std::string, std::vector<UINT>, ExeHash, ExeEqual> m_exeIndex;
+};
+
 /**
 * Game configuration helper class.
 * Contains game configuration structure (ProxyConfig).
@@ -1,6 +1,7 @@
 #include <windows.h>
 #include "VireioUtil.h"
 #include <stdarg.h>
+#include "..\..\PluginSection\Include\Vireio_Log.h"
 
 namespace vireio
 {
@@ -14,13 +15,15 @@ namespace vireio
 		return std::string(buf);
 	}
 	
+	/**
+	* Logs asynchronously without rate limit, the data dumps (DataGatherer) call this in loops.
+	* Long messages are queued in several log entries.
+	***/
 	void debugf(const char *fmt, ...)
 	{
 		va_list args;
 		va_start(args, fmt);
-		char buf[8192];
-		vsnprintf_s(buf, 8192, fmt, args);
+		VireioLog::Get().WriteV(VIREIO_LOG_LEVEL_INFO, NULL, fmt, args);
 		va_end(args);
-		OutputDebugStringA(buf);
 	}
 }
\ No newline at end of file
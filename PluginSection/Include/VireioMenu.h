@@ -31,6 +31,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include<string>
 #include<vector>
+#include<sstream>
 #include"..\..\Aquilinus\Aquilinus\AQU_GlobalTypes.h"
 
 /**
@@ -234,6 +235,171 @@ inline UINT GetSelection(VireioSubMenu* psSubMenu, UINT unPrimalSelection)
 	return unIx;
 }
 
+/// <summary>
+/// Retained text of a sub menu.
+/// Keeps the formatted entry strings and the active entry count, an entry
+/// is only formatted again if its displayed value, type, activity or name
+/// changed since the last Update() call. An idle menu costs one compare per
+/// entry instead of a string stream per entry.
+/// </summary>
+class VireioMenuText
+{
+public:
+	VireioMenuText() : m_psSubMenu(nullptr), m_unActiveEntries(0) {}
+
+	/// <summary>
+	/// Updates the retained text, a different sub menu pointer rebuilds all entries.
+	/// </summary>
+	/// <param name="psSubMenu">The sub menu to be rendered</param>
+	/// <returns>True if any text changed</returns>
+	bool Update(const VireioSubMenu* psSubMenu)
+	{
+		bool bRebuild = (psSubMenu != m_psSubMenu) || (psSubMenu->asEntries.size() != m_asEntries.size());
+		bool bChanged = bRebuild;
+		if (bRebuild)
+		{
+			m_psSubMenu = psSubMenu;
+			m_asEntries.assign(psSubMenu->asEntries.size(), Entry());
+		}
+		if (m_strTitle != psSubMenu->strSubMenu)
+		{
+			m_strTitle = psSubMenu->strSubMenu;
+			bChanged = true;
+		}
+
+		for (size_t nIx = 0; nIx < psSubMenu->asEntries.size(); nIx++)
+		{
+			const VireioMenuEntry& sEntry = psSubMenu->asEntries[nIx];
+			Entry& sText = m_asEntries[nIx];
+			unsigned int unValue = GetValueBits(sEntry);
+
+			// unchanged ?
+			if ((!bRebuild) && (sText.bIsActive == sEntry.bIsActive) && (sText.eType == sEntry.eType) &&
+				(sText.unValue == unValue) && (sText.strEntry == sEntry.strEntry))
+				continue;
+
+			sText.bIsActive = sEntry.bIsActive;
+			sText.eType = sEntry.eType;
+			sText.unValue = unValue;
+			sText.strEntry = sEntry.strEntry;
+			sText.strText = sEntry.bIsActive ? Format(sEntry) : std::string();
+			bChanged = true;
+		}
+
+		// count active entries
+		if (bChanged)
+		{
+			m_unActiveEntries = 0;
+			for (size_t nIx = 0; nIx < m_asEntries.size(); nIx++)
+				if (m_asEntries[nIx].bIsActive) m_unActiveEntries++;
+		}
+		return bChanged;
+	}
+
+	/// <summary>Sub menu title.</summary>
+	const std::string& GetTitle() const { return m_strTitle; }
+	/// <summary>Number of entries, active or not.</summary>
+	size_t GetEntryCount() const { return m_asEntries.size(); }
+	/// <summary>True if the entry is active.</summary>
+	bool IsActive(size_t nIx) const { return m_asEntries[nIx].bIsActive; }
+	/// <summary>Formatted entry text, empty for inactive entries.</summary>
+	const std::string& GetText(size_t nIx) const { return m_asEntries[nIx].strText; }
+	/// <summary>Number of active entries.</summary>
+	UINT GetActiveEntries() const { return m_unActiveEntries; }
+
+private:
+	/// <summary>
+	/// Retained entry text and the values it was formatted from.
+	/// </summary>
+	struct Entry
+	{
+		Entry() : bIsActive(false), eType(VireioMenuEntry::Entry), unValue(0) {}
+		bool bIsActive;
+		VireioMenuEntry::EntryType eType;
+		unsigned int unValue;
+		std::string strEntry;
+		std::string strText;
+	};
+
+	/// <summary>
+	/// The displayed value of an entry as raw bits, by type.
+	/// </summary>
+	static unsigned int GetValueBits(const VireioMenuEntry& sEntry)
+	{
+		switch (sEntry.eType)
+		{
+		case VireioMenuEntry::Entry_Bool:
+			return sEntry.bValue ? 1 : 0;
+		case VireioMenuEntry::Entry_Int:
+			return (unsigned int)sEntry.nValue;
+		case VireioMenuEntry::Entry_UInt:
+			return sEntry.unValue;
+		case VireioMenuEntry::Entry_Float:
+		{
+			unsigned int unBits = 0;
+			memcpy(&unBits, &sEntry.fValue, sizeof(float));
+			return unBits;
+		}
+		default:
+			return 0;
+		}
+	}
+
+	/// <summary>
+	/// Formats the entry text.
+	/// </summary>
+	static std::string Format(const VireioMenuEntry& sEntry)
+	{
+		// create an output stream based on entry string
+		std::stringstream strOutput;
+		strOutput << sEntry.strEntry;
+
+		// switch by entry type
+		switch (sEntry.eType)
+		{
+		case VireioMenuEntry::Entry_Bool:
+			if (sEntry.bValue)
+				strOutput << " - True ";
+			else
+				strOutput << " - False ";
+			break;
+		case VireioMenuEntry::Entry_Int:
+			strOutput << " : " << sEntry.nValue;
+			break;
+		case VireioMenuEntry::Entry_UInt:
+			if (sEntry.bValueEnumeration)
+			{
+				// render the enumeration string
+				if (sEntry.unValue < (unsigned int)sEntry.astrValueEnumeration.size())
+					strOutput << " : " << sEntry.astrValueEnumeration[sEntry.unValue];
+			}
+			else
+			{
+				strOutput << " : " << sEntry.unValue;
+			}
+			break;
+		case VireioMenuEntry::Entry_Float:
+			strOutput << " : " << sEntry.fValue;
+			break;
+		case VireioMenuEntry::Entry:
+			break;
+		default:
+			strOutput << "ERROR";
+			break;
+		}
+		return strOutput.str();
+	}
+
+	/// <summary>Sub menu the text was built for.</summary>
+	const VireioSubMenu* m_psSubMenu;
+	/// <summary>Sub menu title.</summary>
+	std::string m_strTitle;
+	/// <summary>Retained entries.</summary>
+	std::vector<Entry> m_asEntries;
+	/// <summary>Number of active entries.</summary>
+	UINT m_unActiveEntries;
+};
+
 /// <summary>
 /// Provides the Vireio base directory through the Aquilinus configuration.
 /// </summary>
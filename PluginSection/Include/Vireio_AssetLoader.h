@@ -0,0 +1,258 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <Vireio_AssetLoader.h> :
+Copyright (C) 2020 Denis Reischl
+
+
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+v2.0.4 onwards 2014 by Grant Bagwell, Simon Brown and Neil Schneider
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown and Neil Schneider
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+#ifndef VIREIO_ASSET_LOADER
+#define VIREIO_ASSET_LOADER
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/// <summary>
+/// Asset loader service for the Vireio nodes.
+/// File reads and decoding run on a small set of worker threads, the
+/// completion callbacks are executed on the render thread by calling
+/// Poll() once per frame (usually in Present). The render thread never
+/// waits for a load, nodes render their placeholder (or nothing) until
+/// the completion callback handed over the decoded data.
+/// No D3D calls must be made in the load function, create resources in
+/// the completion callback.
+/// </summary>
+class VireioAssetLoader
+{
+public:
+	/// <summary>
+	/// Load function, executed on a worker thread.
+	/// @param bCancel Set if the load got cancelled, long running loads should check this flag.
+	/// @returns True if the asset was loaded successfully.
+	/// </summary>
+	typedef std::function<bool(const std::atomic<bool>& bCancel)> LoadFunction;
+	/// <summary>
+	/// Completion function, executed on the render thread within Poll().
+	/// @param bSucceeded The return value of the load function.
+	/// </summary>
+	typedef std::function<void(bool bSucceeded)> CompletionFunction;
+
+	/// <summary>
+	/// Constructor.
+	/// @param unThreadNumber Number of worker threads, asset loads are mostly i/o bound so keep this low.
+	/// </summary>
+	VireioAssetLoader(unsigned unThreadNumber = 2)
+		: m_bShutdown(false)
+		, m_unNextTicket(1)
+	{
+		if (!unThreadNumber) unThreadNumber = 1;
+		for (unsigned unI = 0; unI < unThreadNumber; unI++)
+			m_acWorkers.push_back(std::thread(&VireioAssetLoader::WorkerLoop, this));
+	}
+
+	/// <summary>
+	/// Destructor.
+	/// @see Shutdown()
+	/// </summary>
+	~VireioAssetLoader()
+	{
+		Shutdown();
+	}
+
+	/// <summary>
+	/// Cancels all pending loads and joins the workers. Completions not
+	/// polled yet are dropped, no load function runs after this returns.
+	/// Call this before anything the load functions use is torn down,
+	/// member loaders are otherwise only joined after the owner's destructor body.
+	/// </summary>
+	void Shutdown()
+	{
+		{
+			std::lock_guard<std::mutex> cLock(m_cMutex);
+			m_bShutdown = true;
+			for (auto& psTask : m_apsQueue) psTask->bCancel = true;
+			for (auto& psTask : m_apsRunning) psTask->bCancel = true;
+			m_apsDone.clear();
+		}
+		m_cCondition.notify_all();
+		for (std::thread& cWorker : m_acWorkers)
+			if (cWorker.joinable()) cWorker.join();
+	}
+
+	/// <summary>
+	/// Queues an asset load.
+	/// @returns Ticket to be used with Cancel() and IsPending(), never zero.
+	/// </summary>
+	unsigned Submit(LoadFunction fnLoad, CompletionFunction fnComplete)
+	{
+		std::shared_ptr<Task> psTask = std::make_shared<Task>();
+		psTask->fnLoad = std::move(fnLoad);
+		psTask->fnComplete = std::move(fnComplete);
+		psTask->bCancel = false;
+		psTask->bSucceeded = false;
+		{
+			std::lock_guard<std::mutex> cLock(m_cMutex);
+			psTask->unTicket = m_unNextTicket++;
+			if (!m_unNextTicket) m_unNextTicket = 1;
+			m_apsQueue.push_back(psTask);
+		}
+		m_cCondition.notify_one();
+		return psTask->unTicket;
+	}
+
+	/// <summary>
+	/// Cancels a load. The completion callback of a cancelled load is never called.
+	/// @returns True if the ticket was still pending.
+	/// </summary>
+	bool Cancel(unsigned unTicket)
+	{
+		std::lock_guard<std::mutex> cLock(m_cMutex);
+		for (auto it = m_apsQueue.begin(); it != m_apsQueue.end(); it++)
+			if ((*it)->unTicket == unTicket) { m_apsQueue.erase(it); return true; }
+		for (auto& psTask : m_apsRunning)
+			if (psTask->unTicket == unTicket) { psTask->bCancel = true; return true; }
+		for (auto it = m_apsDone.begin(); it != m_apsDone.end(); it++)
+			if ((*it)->unTicket == unTicket) { m_apsDone.erase(it); return true; }
+		return false;
+	}
+
+	/// <summary>
+	/// True if the load is queued, running or waiting for its completion.
+	/// </summary>
+	bool IsPending(unsigned unTicket)
+	{
+		std::lock_guard<std::mutex> cLock(m_cMutex);
+		for (auto& psTask : m_apsQueue) if (psTask->unTicket == unTicket) return true;
+		for (auto& psTask : m_apsRunning) if (psTask->unTicket == unTicket) return true;
+		for (auto& psTask : m_apsDone) if (psTask->unTicket == unTicket) return true;
+		return false;
+	}
+
+	/// <summary>
+	/// Executes the completion callbacks of all finished loads.
+	/// Call once per frame on the render thread. Never blocks on a worker,
+	/// the lock is only held to take over the completion list.
+	/// @param unMaxCompletions Maximum number of callbacks this call, spreads resource creation over frames.
+	/// @returns Number of executed completion callbacks.
+	/// </summary>
+	unsigned Poll(unsigned unMaxCompletions = ~0u)
+	{
+		std::deque<std::shared_ptr<Task>> apsDone;
+		{
+			std::lock_guard<std::mutex> cLock(m_cMutex);
+			if (m_apsDone.empty()) return 0;
+			while ((m_apsDone.size()) && (apsDone.size() < unMaxCompletions))
+			{
+				apsDone.push_back(m_apsDone.front());
+				m_apsDone.pop_front();
+			}
+		}
+
+		unsigned unExecuted = 0;
+		for (auto& psTask : apsDone)
+		{
+			if (psTask->bCancel) continue;
+			if (psTask->fnComplete) psTask->fnComplete(psTask->bSucceeded);
+			unExecuted++;
+		}
+		return unExecuted;
+	}
+
+private:
+	/// <summary>
+	/// A single asset load.
+	/// </summary>
+	struct Task
+	{
+		unsigned unTicket;
+		LoadFunction fnLoad;
+		CompletionFunction fnComplete;
+		std::atomic<bool> bCancel;
+		bool bSucceeded;
+	};
+
+	/// <summary>
+	/// Worker thread main loop.
+	/// </summary>
+	void WorkerLoop()
+	{
+		for (;;)
+		{
+			std::shared_ptr<Task> psTask;
+			{
+				std::unique_lock<std::mutex> cLock(m_cMutex);
+				m_cCondition.wait(cLock, [this] { return m_bShutdown || !m_apsQueue.empty(); });
+				if (m_bShutdown) return;
+				psTask = m_apsQueue.front();
+				m_apsQueue.pop_front();
+				m_apsRunning.push_back(psTask);
+			}
+
+			bool bSucceeded = false;
+			if (!psTask->bCancel && psTask->fnLoad)
+				bSucceeded = psTask->fnLoad(psTask->bCancel);
+
+			std::lock_guard<std::mutex> cLock(m_cMutex);
+			for (auto it = m_apsRunning.begin(); it != m_apsRunning.end(); it++)
+				if (*it == psTask) { m_apsRunning.erase(it); break; }
+			psTask->bSucceeded = bSucceeded;
+			if (!psTask->bCancel) m_apsDone.push_back(psTask);
+		}
+	}
+
+	/// <summary>
+	/// Worker threads.
+	/// </summary>
+	std::vector<std::thread> m_acWorkers;
+	/// <summary>
+	/// Guards the task lists and the shutdown flag.
+	/// </summary>
+	std::mutex m_cMutex;
+	/// <summary>
+	/// Signals new tasks or shutdown to the workers.
+	/// </summary>
+	std::condition_variable m_cCondition;
+	/// <summary>
+	/// Queued, running and finished (not yet polled) loads.
+	/// </summary>
+	std::deque<std::shared_ptr<Task>> m_apsQueue, m_apsRunning, m_apsDone;
+	/// <summary>
+	/// True if the loader shuts down.
+	/// </summary>
+	bool m_bShutdown;
+	/// <summary>
+	/// Next ticket to be handed out.
+	/// </summary>
+	unsigned m_unNextTicket;
+};
+
+#endif
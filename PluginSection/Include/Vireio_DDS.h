@@ -0,0 +1,197 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <Vireio_DDS.h> :
+Copyright (C) 2020 Denis Reischl
+
+
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+v2.0.4 onwards 2014 by Grant Bagwell, Simon Brown and Neil Schneider
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown and Neil Schneider
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+#ifndef VIREIO_DDS
+#define VIREIO_DDS
+
+#include <stdint.h>
+#include <dxgiformat.h>
+
+/// <summary>
+/// DDS style surface layout.
+/// Row pitch and row count of tightly packed surfaces, as stored in DDS
+/// files, for block compressed, packed and uncompressed DXGI formats.
+/// Used to point D3D11_SUBRESOURCE_DATA into texture data that comes with
+/// its mip chain already laid out (Oculus avatar assets).
+/// </summary>
+class VireioDDSLayout
+{
+public:
+	/// <summary>
+	/// Bits per pixel, 4 for 8 byte blocks and 8 for 16 byte blocks.
+	/// @returns Zero if the format is not supported.
+	/// </summary>
+	static uint32_t GetBitsPerPixel(DXGI_FORMAT eFormat)
+	{
+		switch (eFormat)
+		{
+			case DXGI_FORMAT_R32G32B32A32_TYPELESS:
+			case DXGI_FORMAT_R32G32B32A32_FLOAT:
+			case DXGI_FORMAT_R32G32B32A32_UINT:
+			case DXGI_FORMAT_R32G32B32A32_SINT:
+				return 128;
+			case DXGI_FORMAT_R32G32B32_TYPELESS:
+			case DXGI_FORMAT_R32G32B32_FLOAT:
+			case DXGI_FORMAT_R32G32B32_UINT:
+			case DXGI_FORMAT_R32G32B32_SINT:
+				return 96;
+			case DXGI_FORMAT_R16G16B16A16_TYPELESS:
+			case DXGI_FORMAT_R16G16B16A16_FLOAT:
+			case DXGI_FORMAT_R16G16B16A16_UNORM:
+			case DXGI_FORMAT_R16G16B16A16_UINT:
+			case DXGI_FORMAT_R16G16B16A16_SNORM:
+			case DXGI_FORMAT_R16G16B16A16_SINT:
+			case DXGI_FORMAT_R32G32_TYPELESS:
+			case DXGI_FORMAT_R32G32_FLOAT:
+			case DXGI_FORMAT_R32G32_UINT:
+			case DXGI_FORMAT_R32G32_SINT:
+				return 64;
+			case DXGI_FORMAT_R10G10B10A2_TYPELESS:
+			case DXGI_FORMAT_R10G10B10A2_UNORM:
+			case DXGI_FORMAT_R10G10B10A2_UINT:
+			case DXGI_FORMAT_R11G11B10_FLOAT:
+			case DXGI_FORMAT_R8G8B8A8_TYPELESS:
+			case DXGI_FORMAT_R8G8B8A8_UNORM:
+			case DXGI_FORMAT_R8G8B8A8_UNORM_SRGB:
+			case DXGI_FORMAT_R8G8B8A8_UINT:
+			case DXGI_FORMAT_R8G8B8A8_SNORM:
+			case DXGI_FORMAT_R8G8B8A8_SINT:
+			case DXGI_FORMAT_R16G16_TYPELESS:
+			case DXGI_FORMAT_R16G16_FLOAT:
+			case DXGI_FORMAT_R16G16_UNORM:
+			case DXGI_FORMAT_R16G16_UINT:
+			case DXGI_FORMAT_R16G16_SNORM:
+			case DXGI_FORMAT_R16G16_SINT:
+			case DXGI_FORMAT_D32_FLOAT:
+			case DXGI_FORMAT_R32_TYPELESS:
+			case DXGI_FORMAT_R32_FLOAT:
+			case DXGI_FORMAT_R32_UINT:
+			case DXGI_FORMAT_R32_SINT:
+			case DXGI_FORMAT_R9G9B9E5_SHAREDEXP:
+			case DXGI_FORMAT_R8G8_B8G8_UNORM:
+			case DXGI_FORMAT_G8R8_G8B8_UNORM:
+			case DXGI_FORMAT_B8G8R8A8_TYPELESS:
+			case DXGI_FORMAT_B8G8R8X8_TYPELESS:
+			case DXGI_FORMAT_B8G8R8A8_UNORM:
+			case DXGI_FORMAT_B8G8R8X8_UNORM:
+			case DXGI_FORMAT_B8G8R8A8_UNORM_SRGB:
+			case DXGI_FORMAT_B8G8R8X8_UNORM_SRGB:
+			case DXGI_FORMAT_YUY2:
+				return 32;
+			case DXGI_FORMAT_R8G8_TYPELESS:
+			case DXGI_FORMAT_R8G8_UNORM:
+			case DXGI_FORMAT_R8G8_UINT:
+			case DXGI_FORMAT_R8G8_SNORM:
+			case DXGI_FORMAT_R8G8_SINT:
+			case DXGI_FORMAT_R16_TYPELESS:
+			case DXGI_FORMAT_R16_FLOAT:
+			case DXGI_FORMAT_D16_UNORM:
+			case DXGI_FORMAT_R16_UNORM:
+			case DXGI_FORMAT_R16_UINT:
+			case DXGI_FORMAT_R16_SNORM:
+			case DXGI_FORMAT_R16_SINT:
+			case DXGI_FORMAT_B5G6R5_UNORM:
+			case DXGI_FORMAT_B5G5R5A1_UNORM:
+			case DXGI_FORMAT_B4G4R4A4_UNORM:
+				return 16;
+			case DXGI_FORMAT_R8_TYPELESS:
+			case DXGI_FORMAT_R8_UNORM:
+			case DXGI_FORMAT_R8_UINT:
+			case DXGI_FORMAT_R8_SNORM:
+			case DXGI_FORMAT_R8_SINT:
+			case DXGI_FORMAT_A8_UNORM:
+			case DXGI_FORMAT_BC2_TYPELESS:
+			case DXGI_FORMAT_BC2_UNORM:
+			case DXGI_FORMAT_BC2_UNORM_SRGB:
+			case DXGI_FORMAT_BC3_TYPELESS:
+			case DXGI_FORMAT_BC3_UNORM:
+			case DXGI_FORMAT_BC3_UNORM_SRGB:
+			case DXGI_FORMAT_BC5_TYPELESS:
+			case DXGI_FORMAT_BC5_UNORM:
+			case DXGI_FORMAT_BC5_SNORM:
+			case DXGI_FORMAT_BC6H_TYPELESS:
+			case DXGI_FORMAT_BC6H_UF16:
+			case DXGI_FORMAT_BC6H_SF16:
+			case DXGI_FORMAT_BC7_TYPELESS:
+			case DXGI_FORMAT_BC7_UNORM:
+			case DXGI_FORMAT_BC7_UNORM_SRGB:
+				return 8;
+			case DXGI_FORMAT_BC1_TYPELESS:
+			case DXGI_FORMAT_BC1_UNORM:
+			case DXGI_FORMAT_BC1_UNORM_SRGB:
+			case DXGI_FORMAT_BC4_TYPELESS:
+			case DXGI_FORMAT_BC4_UNORM:
+			case DXGI_FORMAT_BC4_SNORM:
+				return 4;
+			default:
+				return 0;
+		}
+	}
+
+	/// <summary>
+	/// True for the 4x4 block compressed formats.
+	/// </summary>
+	static bool IsBlockCompressed(DXGI_FORMAT eFormat)
+	{
+		return ((eFormat >= DXGI_FORMAT_BC1_TYPELESS) && (eFormat <= DXGI_FORMAT_BC5_SNORM)) ||
+			((eFormat >= DXGI_FORMAT_BC6H_TYPELESS) && (eFormat <= DXGI_FORMAT_BC7_UNORM_SRGB));
+	}
+
+	/// <summary>
+	/// Row pitch and row count of a single surface, tightly packed (as stored in DDS files).
+	/// Also used to lay out texture data from other sources.
+	/// @param unRowPitch Bytes per row (output), row of 4x4 blocks for block compressed formats.
+	/// @param unRowCount Rows (output), rows of 4x4 blocks for block compressed formats.
+	/// </summary>
+	static void GetSurfaceInfo(DXGI_FORMAT eFormat, uint32_t unWidth, uint32_t unHeight, uint64_t& unRowPitch, uint64_t& unRowCount)
+	{
+		if (IsBlockCompressed(eFormat))
+		{
+			uint64_t unBlocksWide = ((uint64_t)unWidth + 3) / 4;
+			uint64_t unBlocksHigh = ((uint64_t)unHeight + 3) / 4;
+			unRowPitch = (unBlocksWide ? unBlocksWide : 1) * GetBitsPerPixel(eFormat) * 2;
+			unRowCount = unBlocksHigh ? unBlocksHigh : 1;
+		}
+		else if ((eFormat == DXGI_FORMAT_R8G8_B8G8_UNORM) || (eFormat == DXGI_FORMAT_G8R8_G8B8_UNORM) || (eFormat == DXGI_FORMAT_YUY2))
+		{
+			// two pixels share four bytes
+			unRowPitch = (((uint64_t)unWidth + 1) >> 1) * 4;
+			unRowCount = unHeight;
+		}
+		else
+		{
+			unRowPitch = ((uint64_t)unWidth * GetBitsPerPixel(eFormat) + 7) / 8;
+			unRowCount = unHeight;
+		}
+	}
+};
+
+#endif
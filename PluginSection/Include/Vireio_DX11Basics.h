@@ -50,7 +50,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <iostream>
 #include <fstream>
 #include <vector>
+#include <algorithm>
+#include <unordered_map>
 #include"Vireio_DX11StateBlock.h"
+#include"Vireio_GlyphBatch.h"
 
 using namespace DirectX;
 #define float2 XMFLOAT2
@@ -220,24 +223,15 @@ static const char* VS3D_TEXT =
 "	float     fGamma;\n"
 "};\n"
 
-"cbuffer ConstantsGlyph : register(b1)\n"
-"{\n"
-"	uint unCharacter;\n"
-"	float fULeft;\n"
-"	float fVTop;\n"
-"	float fURight;\n"
-"	float fVBottom;\n"
-"	float fXOffset;\n"
-"	float fYOffset;\n"
-"	float fXAdvance;\n"
-"};\n"
-
-// input / output structures
+// input / output structures, glyph data per instance
 "struct VS_INPUT\n"
 "{\n"
 "	float4 vPosition : POSITION;\n"
 "	float4 vNormal : NORMAL;\n"
 "	float2 vTexcoord : TEXCOORD0;\n"
+"	float4 vTranslate : TEXCOORD1;\n"
+"	float4 vShape : TEXCOORD2;\n"
+"	float4 vUV : TEXCOORD3;\n"
 "};\n"
 
 "struct VS_OUTPUT\n"
@@ -252,13 +246,17 @@ static const char* VS3D_TEXT =
 "{\n"
 "	VS_OUTPUT Output;\n"
 
-"	Output.vPosition = mul(Input.vPosition, sWorldViewProjection);\n"
-"	Output.vNormal = mul(Input.vNormal, sWorld);\n"
-"	Output.vTexcoord = Input.vTexcoord;\n"
+// scale the unit quad to the glyph, translate to the glyph origin
+"	float4 vPos = float4(Input.vPosition.x * Input.vShape.x, 0.0f, Input.vPosition.z * Input.vShape.y - Input.vShape.z, 1.0f);\n"
+"	vPos.xyz += Input.vTranslate.xyz;\n"
+"	Output.vPosition = mul(vPos, sWorldViewProjection);\n"
+
+// pass glyph origin as normal, text fx use it for position based effects
+"	Output.vNormal = float4(Input.vTranslate.xyz, 1.0f);\n"
 
 // pass uv
-"	if (Input.vTexcoord.x < 0.5f) Output.vTexcoord.x = fULeft; else Output.vTexcoord.x = fURight;\n"
-"	if (Input.vTexcoord.y < 0.5f) Output.vTexcoord.y = fVTop; else Output.vTexcoord.y = fVBottom;\n"
+"	if (Input.vTexcoord.x < 0.5f) Output.vTexcoord.x = Input.vUV.x; else Output.vTexcoord.x = Input.vUV.z;\n"
+"	if (Input.vTexcoord.y < 0.5f) Output.vTexcoord.y = Input.vUV.y; else Output.vTexcoord.y = Input.vUV.w;\n"
 
 "	return Output;\n"
 "}\n";
@@ -1837,7 +1835,7 @@ static const char* PS_TEXT_FX_001 =
 "	if (afFragment4.r == 0.0f) discard;\n"
 
 // moire
-"	vec4 sPos4 = mul(vec4(1.0f, 1.0f, 1.0f, 1.0f), sWorld);\n"
+"	vec4 sPos4 = Input.vNormal + vec4(1.0f, 1.0f, 1.0f, 0.0f);\n"
 "	vec2 sPos = sPos4.xy;// Input.vTexcoord * 7.0f;\n"
 "	sPos.x += Input.vTexcoord.y * 7;\n"
 "	sPos.y += Input.vTexcoord.x * 7;\n"
@@ -2304,7 +2302,7 @@ enum VertexShaderTechnique
 {
 	PosUV2D,        /**< Position, UV, for 2D projection **/
 	PosNormUV,      /**< Position, Normal, UV. **/
-	PosNormUV_Text, /**< Position, Normal, UV -> Converts UV to text glyph UV. ***/
+	PosNormUV_Text, /**< Position, Normal, UV + GlyphInstance per instance -> Instanced text glyphes. ***/
 };
 
 /// <summary>
@@ -2339,21 +2337,6 @@ enum PixelShaderTechnique
 #pragma endregion
 
 #pragma region /// => Vireio font
-/// <summary>
-/// Glyph constant buffer structure.
-/// </summary>
-struct Glyph_Constants
-{
-	uint32_t unCharacter;
-	float fULeft;
-	float fVTop;
-	float fURight;
-	float fVBottom;
-	float fXOffset;
-	float fYOffset;
-	float fXAdvance;
-};
-
 /// <summary>
 /// Main vertex structure.
 /// </summary>
@@ -2368,6 +2351,163 @@ struct VertexPosUV
 HRESULT CreateVertexShaderTechnique(ID3D11Device* pcDevice, ID3D11VertexShader** ppcVertexShader, ID3D11InputLayout** ppcInputLayout, VertexShaderTechnique eTechnique);
 HRESULT CreatePixelShaderEffect(ID3D11Device* pcDevice, ID3D11PixelShader** ppcPixelShader, PixelShaderTechnique eTechnique);
 
+/// <summary>
+/// Microsoft description for a single character glyph.
+/// </summary>
+struct Glyph_MS
+{
+	uint32_t Character;
+	RECT Subrect;
+	float XOffset;
+	float YOffset;
+	float XAdvance;
+};
+
+/// <summary>
+/// Codepoint to glyph lookup table.
+/// Dense array for the (usually contiguous) lower codepoint range, hash
+/// map for sparse codepoints above the first large gap.
+/// </summary>
+struct SpriteFontGlyphTable
+{
+	/// <summary>
+	/// Builds the table.
+	/// @param pasGlyphes The glyph array (view into the file mapping).
+	/// @param unGlyphCount The number of glyphes.
+	/// @param unDefaultChar The fallback character, zero if none.
+	/// </summary>
+	void Build(const Glyph_MS* pasGlyphes, uint32_t unGlyphCount, uint32_t unDefaultChar)
+	{
+		static const uint32_t s_unMaxGap = 256;
+		m_pasGlyphes = pasGlyphes;
+		m_aunDense.clear();
+		m_aunSparse.clear();
+		m_psDefault = nullptr;
+
+		// MakeSpriteFont writes sorted glyphes, but do not rely on it
+		std::vector<uint32_t> aunOrder(unGlyphCount);
+		for (uint32_t unI = 0; unI < unGlyphCount; unI++) aunOrder[unI] = unI;
+		std::sort(aunOrder.begin(), aunOrder.end(), [pasGlyphes](uint32_t unA, uint32_t unB) { return pasGlyphes[unA].Character < pasGlyphes[unB].Character; });
+
+		// dense range ends at the first gap larger than s_unMaxGap codepoints
+		uint32_t unDenseEnd = 0;
+		for (uint32_t unIx : aunOrder)
+		{
+			if (pasGlyphes[unIx].Character > unDenseEnd + s_unMaxGap) break;
+			unDenseEnd = pasGlyphes[unIx].Character + 1;
+		}
+
+		m_aunDense.assign(unDenseEnd, s_unInvalid);
+		for (uint32_t unIx : aunOrder)
+		{
+			uint32_t unChar = pasGlyphes[unIx].Character;
+			if (unChar < unDenseEnd)
+				m_aunDense[unChar] = unIx;
+			else
+				m_aunSparse[unChar] = unIx;
+		}
+
+		if (unDefaultChar) m_psDefault = Find(unDefaultChar);
+	}
+
+	/// <summary>
+	/// Finds the glyph for a codepoint.
+	/// @returns The glyph, nullptr if not present.
+	/// </summary>
+	const Glyph_MS* Find(uint32_t unChar) const
+	{
+		if (unChar < (uint32_t)m_aunDense.size())
+		{
+			uint32_t unIx = m_aunDense[unChar];
+			return (unIx == s_unInvalid) ? nullptr : &m_pasGlyphes[unIx];
+		}
+		auto it = m_aunSparse.find(unChar);
+		return (it == m_aunSparse.end()) ? nullptr : &m_pasGlyphes[it->second];
+	}
+
+	/// <summary>
+	/// Finds the glyph for a codepoint, returns the default glyph if not present.
+	/// @returns The glyph, nullptr if not present and no default character set.
+	/// </summary>
+	const Glyph_MS* FindOrDefault(uint32_t unChar) const
+	{
+		const Glyph_MS* psGlyph = Find(unChar);
+		return psGlyph ? psGlyph : m_psDefault;
+	}
+
+private:
+	static const uint32_t s_unInvalid = 0xffffffff;
+	const Glyph_MS* m_pasGlyphes = nullptr;
+	const Glyph_MS* m_psDefault = nullptr;
+	std::vector<uint32_t> m_aunDense;
+	std::unordered_map<uint32_t, uint32_t> m_aunSparse;
+};
+
+/// <summary>
+/// Decoded .spritefont file.
+/// Filled by VireioFont::LoadSpriteFont() which does not touch D3D,
+/// so it may run on an asset loader worker thread. The file is mapped
+/// once, glyphes and texture rows point into the mapping which is kept
+/// until this structure is destroyed.
+/// </summary>
+struct SpriteFontData
+{
+	SpriteFontData()
+		: pasGlyphes(nullptr)
+		, unGlyphCount(0)
+		, fLineSpacing(0.0f)
+		, unDefaultChar(0)
+		, unTextureWidth(0)
+		, unTextureHeight(0)
+		, eTextureFormat(DXGI_FORMAT_UNKNOWN)
+		, unTextureStride(0)
+		, unTextureRows(0)
+		, pchTextureData(nullptr)
+		, hFile(INVALID_HANDLE_VALUE)
+		, hMapping(NULL)
+		, pvView(nullptr)
+	{}
+	~SpriteFontData() { Release(); }
+
+	/// <summary>
+	/// Unmaps the file, all views get invalid.
+	/// </summary>
+	void Release()
+	{
+		if (pvView) UnmapViewOfFile(pvView);
+		if (hMapping) CloseHandle(hMapping);
+		if (hFile != INVALID_HANDLE_VALUE) CloseHandle(hFile);
+		pvView = nullptr;
+		hMapping = NULL;
+		hFile = INVALID_HANDLE_VALUE;
+		pasGlyphes = nullptr;
+		pchTextureData = nullptr;
+		unGlyphCount = 0;
+	}
+
+	const Glyph_MS* pasGlyphes;         /**< Glyphes, view into the mapping **/
+	uint32_t unGlyphCount;              /**< Number of glyphes **/
+	float fLineSpacing;                 /**< Line spacing **/
+	uint32_t unDefaultChar;             /**< Fallback character, zero if none **/
+	uint32_t unTextureWidth;            /**< Texture width **/
+	uint32_t unTextureHeight;           /**< Texture height **/
+	DXGI_FORMAT eTextureFormat;         /**< Texture format **/
+	uint32_t unTextureStride;           /**< Texture row pitch **/
+	uint32_t unTextureRows;             /**< Texture row count **/
+	const uint8_t* pchTextureData;      /**< Texture rows, view into the mapping **/
+	SpriteFontGlyphTable cGlyphTable;   /**< Codepoint lookup **/
+
+private:
+	SpriteFontData(const SpriteFontData&);
+	SpriteFontData& operator=(const SpriteFontData&);
+
+	HANDLE hFile;
+	HANDLE hMapping;
+	LPVOID pvView;
+
+	friend class VireioFont;
+};
+
 /// <summary>
 /// Vireio font class.
 /// Does load .spritefont files and renders the chosen font glyphes.
@@ -2385,178 +2525,391 @@ public:
 	VireioFont(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, LPCSTR szPath, float fFontSize, float fAspect, HRESULT& nHr, UINT unTechnique)
 		: m_pcTexFont2D(nullptr)
 		, m_pcTexFontSRV(nullptr)
-		, m_asGlyphConstants(NULL)
-		, m_pcConstantsGlyph(nullptr)
+		, m_asGlyphShapes(256)
 		, m_pcVBGlyphes(nullptr)
+		, m_pcVBInstances(nullptr)
+		, m_unInstanceCapacity(0)
+		, m_pcConstantBuffer0(nullptr)
 		, m_pcBlendState(nullptr)
+		, m_pcVertexShader(nullptr)
+		, m_pcInputLayout(nullptr)
+		, m_pcPixelShader(nullptr)
+		, m_pcSampler(nullptr)
 		, m_fCenterTremble(0.0f)
+	{
+		SpriteFontData sData;
+		if (FAILED(nHr = LoadSpriteFont(szPath, sData)))
+			return;
+		Init(pcDevice, sData, fAspect, nHr, unTechnique);
+	}
+
+	/// <summary>
+	/// Constructor.
+	/// Creates the font from an already decoded .spritefont file.
+	/// @param pcDevice The D3D 11 device.
+	/// @param pcDeviceContext The D3D 11 device context.
+	/// @param sData The font data as provided by LoadSpriteFont().
+	/// </summary>
+	VireioFont(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, const SpriteFontData& sData, float fFontSize, float fAspect, HRESULT& nHr, UINT unTechnique)
+		: m_pcTexFont2D(nullptr)
+		, m_pcTexFontSRV(nullptr)
+		, m_asGlyphShapes(256)
+		, m_pcVBGlyphes(nullptr)
+		, m_pcVBInstances(nullptr)
+		, m_unInstanceCapacity(0)
+		, m_pcConstantBuffer0(nullptr)
+		, m_pcBlendState(nullptr)
+		, m_pcVertexShader(nullptr)
+		, m_pcInputLayout(nullptr)
+		, m_pcPixelShader(nullptr)
+		, m_pcSampler(nullptr)
+		, m_fCenterTremble(0.0f)
+	{
+		nHr = S_OK;
+		Init(pcDevice, sData, fAspect, nHr, unTechnique);
+	}
+
+	/// <summary>
+	/// Maps and validates a .spritefont file.
+	/// Does no D3D calls, can be used on a worker thread.
+	/// @param szPath File path to the .spritefont file.
+	/// @param sData The font data (output), views into the file mapping.
+	/// @returns E_FAIL if the file is missing, truncated or no MakeSpriteFont output.
+	/// </summary>
+	static HRESULT LoadSpriteFont(LPCSTR szPath, SpriteFontData& sData)
 	{
 		static const char s_szSpriteFontMagic[] = "DXTKfont";
-		/// <summary>
-		/// Microsoft description for a single character glyph.
-		/// </summary>
-		struct Glyph_MS
+		static const size_t s_nMagicSize = sizeof(s_szSpriteFontMagic) - 1;
+		sData.Release();
+
+		// map the file
+		sData.hFile = CreateFileA(szPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (sData.hFile == INVALID_HANDLE_VALUE)
 		{
-			uint32_t Character;
-			RECT Subrect;
-			float XOffset;
-			float YOffset;
-			float XAdvance;
-		};
-
-		// open file
-		std::ifstream cInFileStream;
-		cInFileStream.open(szPath, std::ios::in | std::ios::binary);
-		if (cInFileStream.is_open())
+			OutputDebugStringA("[VRO] Failed to open .spritefont file.\n");
+			return E_FAIL;
+		}
+		LARGE_INTEGER sSize = {};
+		if ((!GetFileSizeEx(sData.hFile, &sSize)) || (sSize.QuadPart < (LONGLONG)(s_nMagicSize + sizeof(uint32_t))))
 		{
-			// Validate the header.
-			char ch = 0;
-			for (char const* magic = s_szSpriteFontMagic; *magic; magic++)
-			{
-				cInFileStream.read(&ch, sizeof(char));
-				if (ch != *magic)
-				{
-					OutputDebugStringA("[VRO] SpriteFont provided with an invalid .spritefont file.\n");
-					throw std::exception("Not a MakeSpriteFont output binary");
-				}
-			}
+			OutputDebugStringA("[VRO] SpriteFont provided with an invalid .spritefont file.\n");
+			sData.Release();
+			return E_FAIL;
+		}
+		sData.hMapping = CreateFileMappingA(sData.hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (sData.hMapping) sData.pvView = MapViewOfFile(sData.hMapping, FILE_MAP_READ, 0, 0, 0);
+		if (!sData.pvView)
+		{
+			OutputDebugStringA("[VRO] Failed to map .spritefont file.\n");
+			sData.Release();
+			return E_FAIL;
+		}
+		const uint8_t* pchFile = (const uint8_t*)sData.pvView;
+		const uint64_t unFileSize = (uint64_t)sSize.QuadPart;
+		uint64_t unOffset = 0;
 
-			// Read the glyph count.
-			uint32_t unGlyphCount = 0;
-			std::vector<Glyph_MS> asGlyphes = std::vector<Glyph_MS>();
-			cInFileStream.read((char*)&unGlyphCount, sizeof(uint32_t));
+		// Validate the header.
+		if (memcmp(pchFile, s_szSpriteFontMagic, s_nMagicSize) != 0)
+		{
+			OutputDebugStringA("[VRO] SpriteFont provided with an invalid .spritefont file.\n");
+			sData.Release();
+			return E_FAIL;
+		}
+		unOffset += s_nMagicSize;
+
+		// glyph count, glyphes, font properties and texture description
+		uint32_t unGlyphCount = *(const uint32_t*)(pchFile + unOffset);
+		unOffset += sizeof(uint32_t);
+		const uint64_t unGlyphBytes = (uint64_t)unGlyphCount * sizeof(Glyph_MS);
+		const uint64_t unPropertyBytes = sizeof(float) + sizeof(uint32_t) * 6;
+		if (unOffset + unGlyphBytes + unPropertyBytes > unFileSize)
+		{
+			OutputDebugStringA("[VRO] Truncated .spritefont file.\n");
+			sData.Release();
+			return E_FAIL;
+		}
+		sData.pasGlyphes = (const Glyph_MS*)(pchFile + unOffset);
+		sData.unGlyphCount = unGlyphCount;
+		unOffset += unGlyphBytes;
+
+		const uint32_t* punProperties = (const uint32_t*)(pchFile + unOffset);
+		memcpy(&sData.fLineSpacing, &punProperties[0], sizeof(float));
+		sData.unDefaultChar = punProperties[1];
+		sData.unTextureWidth = punProperties[2];
+		sData.unTextureHeight = punProperties[3];
+		sData.eTextureFormat = (DXGI_FORMAT)punProperties[4];
+		sData.unTextureStride = punProperties[5];
+		sData.unTextureRows = punProperties[6];
+		unOffset += unPropertyBytes;
+
+		// texture rows
+		if ((!sData.unTextureWidth) || (!sData.unTextureHeight) || (!sData.unTextureStride) ||
+			(unOffset + (uint64_t)sData.unTextureStride * (uint64_t)sData.unTextureRows > unFileSize))
+		{
+			OutputDebugStringA("[VRO] Truncated .spritefont file.\n");
+			sData.Release();
+			return E_FAIL;
+		}
+		sData.pchTextureData = pchFile + unOffset;
 
-			// Loop through glyphes, read and assign
-			for (uint32_t unGlyphIx = 0; unGlyphIx < unGlyphCount; unGlyphIx++)
-			{
-				Glyph_MS sGlyph = {};
-				cInFileStream.read((char*)&sGlyph, sizeof(Glyph_MS));
-				asGlyphes.push_back(sGlyph);
-			}
+		// create the lookup table
+		sData.cGlyphTable.Build(sData.pasGlyphes, sData.unGlyphCount, sData.unDefaultChar);
 
-			// Read font properties.
-			float fLineSpacing = 0;
-			cInFileStream.read((char*)&fLineSpacing, sizeof(float));
-			uint32_t unDefaultChar = 0;
-			cInFileStream.read((char*)&unDefaultChar, sizeof(uint32_t));
-
-			// Read the texture data.
-			uint32_t unTextureWidth = 0;
-			cInFileStream.read((char*)&unTextureWidth, sizeof(uint32_t));
-			uint32_t unTextureHeight = 0;
-			cInFileStream.read((char*)&unTextureHeight, sizeof(uint32_t));
-			DXGI_FORMAT eTextureFormat = DXGI_FORMAT::DXGI_FORMAT_UNKNOWN;
-			cInFileStream.read((char*)&eTextureFormat, sizeof(DXGI_FORMAT));
-			uint32_t unTextureStride = 0;
-			cInFileStream.read((char*)&unTextureStride, sizeof(uint32_t));
-			uint32_t unTextureRows = 0;
-			cInFileStream.read((char*)&unTextureRows, sizeof(uint32_t));
-			uint8_t* pchTextureData = new uint8_t[unTextureStride * unTextureRows];
-			cInFileStream.read((char*)pchTextureData, sizeof(uint8_t) * unTextureStride * unTextureRows);
-
-			// Create the D3D texture.
-			CD3D11_TEXTURE2D_DESC sDescTex(eTextureFormat, unTextureWidth, unTextureHeight, 1, 1, D3D11_BIND_SHADER_RESOURCE, D3D11_USAGE_IMMUTABLE);
-			CD3D11_SHADER_RESOURCE_VIEW_DESC sDescView(D3D11_SRV_DIMENSION_TEXTURE2D, eTextureFormat);
-			D3D11_SUBRESOURCE_DATA sInitData = { pchTextureData, unTextureStride };
-
-			nHr = pcDevice->CreateTexture2D(&sDescTex, &sInitData, &m_pcTexFont2D);
-			if (FAILED(nHr)) return;
-			nHr = pcDevice->CreateShaderResourceView((ID3D11Resource*)m_pcTexFont2D, &sDescView, &m_pcTexFontSRV);
-			if (FAILED(nHr)) return;
-
-			// convert to glyph constants, first create constant array
-			Glyph_Constants sGC = {};
-			m_asGlyphConstants = std::vector<Glyph_Constants>(256, sGC);
-
-			// and create a vertex buffer for all glyphes, first create vertex array
-			VertexPosUV asVerticesGlyph[256 * 4] = {};
-
-			// loop through the available glyphes
-			float fFontSize = 128.0f;
-			float fSpace = 0.02f;
-			for (size_t unI = 0; unI < asGlyphes.size(); unI++)
-			{
-				// set glyph data
-				uint32_t unAscii = asGlyphes[unI].Character;
-				if (unAscii > 255)
-				{
-					OutputDebugStringA("[VRO] Invalid ascii code.");
-					continue;
-				}
-				m_asGlyphConstants[unAscii].unCharacter = unAscii;
-				m_asGlyphConstants[unAscii].fULeft = (float)asGlyphes[unI].Subrect.left / (float)unTextureWidth;
-				m_asGlyphConstants[unAscii].fURight = (float)asGlyphes[unI].Subrect.right / (float)unTextureWidth;
-				m_asGlyphConstants[unAscii].fVTop = (float)asGlyphes[unI].Subrect.top / (float)unTextureHeight;
-				m_asGlyphConstants[unAscii].fVBottom = (float)asGlyphes[unI].Subrect.bottom / (float)unTextureHeight;
-				m_asGlyphConstants[unAscii].fXOffset = asGlyphes[unI].XOffset;
-				m_asGlyphConstants[unAscii].fYOffset = asGlyphes[unI].YOffset;
-
-				// set x advance by glyph width
-				float fGlyphWidth = ((float)asGlyphes[unI].Subrect.right - (float)asGlyphes[unI].Subrect.left) / fFontSize;
-				float fGlyphHeight = ((float)asGlyphes[unI].Subrect.bottom - (float)asGlyphes[unI].Subrect.top) / fFontSize;
-				float fGlyphOffset = (fFontSize - asGlyphes[unI].YOffset) / fFontSize;
-				m_asGlyphConstants[unAscii].fXAdvance = -(fGlyphWidth + fSpace);
-
-				// set index data
-				uint32_t unIx = unAscii * 4;
-
-				// 0
-				asVerticesGlyph[unIx].afPos3 = XMFLOAT3(0.0f, 0.0f, -fGlyphOffset + fGlyphHeight);
-				asVerticesGlyph[unIx].afUV2 = XMFLOAT2(1.0f, 1.0f);
-
-				// 1
-				asVerticesGlyph[unIx + 1].afPos3 = XMFLOAT3(fGlyphWidth, 0.0f, -fGlyphOffset + fGlyphHeight);
-				asVerticesGlyph[unIx + 1].afUV2 = XMFLOAT2(0.0f, 1.0f);
-
-				// 2
-				asVerticesGlyph[unIx + 2].afPos3 = XMFLOAT3(0.0f, 0.0f, -fGlyphOffset);
-				asVerticesGlyph[unIx + 2].afUV2 = XMFLOAT2(1.0f, 0.0f);
-
-				// 3
-				asVerticesGlyph[unIx + 3].afPos3 = XMFLOAT3(fGlyphWidth, 0.0f, -fGlyphOffset);
-				asVerticesGlyph[unIx + 3].afUV2 = XMFLOAT2(0.0f, 0.0f);
+		return S_OK;
+	}
 
-			}
+	/// <summary>
+	/// Destructor.
+	/// </summary>
+	~VireioFont()
+	{
+		SAFE_RELEASE(m_pcSampler);
+		SAFE_RELEASE(m_pcVertexShader);
+		SAFE_RELEASE(m_pcPixelShader);
+		SAFE_RELEASE(m_pcInputLayout);
+		SAFE_RELEASE(m_pcTexFont2D);
+		SAFE_RELEASE(m_pcTexFontSRV);
+		SAFE_RELEASE(m_pcVBGlyphes);
+		SAFE_RELEASE(m_pcVBInstances);
+		SAFE_RELEASE(m_pcConstantBuffer0);
+		SAFE_RELEASE(m_pcBlendState);
+	}
+
+	/// <summary>
+	/// Set attributes for the text.
+	/// </summary>
+	void SetTextAttributes(float fX, float fY, float fZ)
+	{
+		// Build the view matrix.
+		D3DXVECTOR3 sPos = D3DXVECTOR3(fX, fY, fZ);
+		D3DXVECTOR3 sTarget = D3DXVECTOR3(0.0f, 0.01f, 0.0f);
+		D3DXVECTOR3 sUp = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
 
-			// set space x advance manually
-			m_asGlyphConstants[' '].fXAdvance = -fSpace * 10.0f;
-
-			// create the glyph constant buffer
-			D3D11_BUFFER_DESC sDescConst;
-			ZeroMemory(&sDescConst, sizeof(D3D11_BUFFER_DESC));
-			sDescConst.ByteWidth = sizeof(Glyph_Constants);
-			sDescConst.Usage = D3D11_USAGE_DEFAULT;
-			sDescConst.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
-			sDescConst.MiscFlags = 0;
-			sDescConst.StructureByteStride = 0;
-
-			// Fill in the subresource data.
-			D3D11_SUBRESOURCE_DATA sInitDataConst;
-			ZeroMemory(&sInitDataConst, sizeof(D3D11_SUBRESOURCE_DATA));
-			sInitDataConst.pSysMem = &m_asGlyphConstants['A'];
-			sInitDataConst.SysMemPitch = 0;
-			sInitDataConst.SysMemSlicePitch = 0;
-
-			// Create the buffer.
-			HRESULT nHr = pcDevice->CreateBuffer(&sDescConst, &sInitDataConst, &m_pcConstantsGlyph);
-
-			// create the glyph vertex buffer
-			D3D11_BUFFER_DESC sDescVtx;
-			ZeroMemory(&sDescVtx, sizeof(D3D11_BUFFER_DESC));
-			sDescVtx.Usage = D3D11_USAGE_IMMUTABLE;
-			sDescVtx.ByteWidth = sizeof(VertexPosUV) * 256 * 4;
-			sDescVtx.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-			sDescVtx.CPUAccessFlags = 0;
-			sDescVtx.MiscFlags = 0;
-			sDescVtx.StructureByteStride = 0;
-			D3D11_SUBRESOURCE_DATA sInitDataVtx;
-			ZeroMemory(&sInitDataVtx, sizeof(D3D11_SUBRESOURCE_DATA));
-			sInitDataVtx.pSysMem = asVerticesGlyph;
-			if (FAILED(nHr = pcDevice->CreateBuffer(&sDescVtx, &sInitDataVtx, &m_pcVBGlyphes)))
+		D3DXMatrixLookAtLH(&m_sView, &sPos, &sTarget, &sUp);
+	}
+
+	/// <summary>
+	/// Sets all fields before the render calls, starts a new glyph batch.
+	/// </summary>
+	void ToRender(ID3D11DeviceContext* pcContext, float fTime, float fScrollY, float fDistance, float fCenterTremble)
+	{
+		// set buffer fields
+		m_sConstantBuffer0.fGlobalTime = fTime;
+
+		// set scroll origin, distance, line index zero, additional tremble for the center object
+		m_fScrollY = fScrollY;
+		m_fDistance = -fDistance;
+		m_unLineIx = 0;
+		m_fCenterTremble = fCenterTremble;
+
+		// clear glyph batch
+		m_cGlyphBatch.Clear();
+	}
+
+	/// <summary>
+	/// Measures the text width.
+	/// @returns The measured text width in world space dimension.
+	/// </summary>
+	float MeasureText(LPCSTR szText)
+	{
+		return m_cGlyphBatch.Measure(szText);
+	}
+
+	/// <summary>
+	/// Empty line.
+	/// </summary>
+	void Enter() { m_unLineIx++; }
+
+	/// <summary>
+	/// Adds a new text line based on the vertical scroll origin to the glyph batch.
+	/// </summary>
+	void RenderTextLine(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, LPCSTR szText)
+	{
+		// get vertical origin, measure text
+		float fLineOrigin = m_fScrollY + (float)m_unLineIx * 1.4f;
+		float fTremble = 0.0f;
+		float fWidth = MeasureText(szText);
+
+		// set tremble for vertically centered line
+		if ((fLineOrigin > -0.5) && (fLineOrigin < 0.5f)) fTremble = (sin(m_sConstantBuffer0.fGlobalTime * 20.0f)) * 0.5f + m_fCenterTremble;
+
+		// render text centered
+		RenderText(pcDevice, pcContext, szText, fWidth * -0.5f, m_fDistance + fTremble, fLineOrigin);
+
+		// next line
+		m_unLineIx++;
+	}
+
+	/// <summary>
+	/// Adds text to the glyph batch, drawn by Flush().
+	/// </summary>
+	void RenderText(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, LPCSTR szText, float fX, float fY, float fZ)
+	{
+		m_cGlyphBatch.AddText(szText, fX, fY, fZ);
+	}
+
+	/// <summary>
+	/// Draws the glyph batch on the active render target, one instanced draw call.
+	/// Call after the RenderText() / RenderTextLine() calls of a frame.
+	/// </summary>
+	void Flush(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext)
+	{
+		UINT unInstanceCount = m_cGlyphBatch.GetInstanceCount();
+		if (!unInstanceCount) return;
+
+		// (re)create the instance buffer if too small
+		if (unInstanceCount > m_unInstanceCapacity)
+		{
+			SAFE_RELEASE(m_pcVBInstances);
+			m_unInstanceCapacity = 0;
+
+			UINT unCapacity = 1024;
+			while (unCapacity < unInstanceCount) unCapacity <<= 1;
+
+			D3D11_BUFFER_DESC sDescInst;
+			ZeroMemory(&sDescInst, sizeof(D3D11_BUFFER_DESC));
+			sDescInst.Usage = D3D11_USAGE_DYNAMIC;
+			sDescInst.ByteWidth = sizeof(GlyphInstance) * unCapacity;
+			sDescInst.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+			sDescInst.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+			if (FAILED(pcDevice->CreateBuffer(&sDescInst, NULL, &m_pcVBInstances)))
 			{
 				OutputDebugStringA("[VRO] Failed to create buffer !");
 				return;
 			}
+			m_unInstanceCapacity = unCapacity;
+		}
+
+		// upload the instance stream
+		D3D11_MAPPED_SUBRESOURCE sMapped = {};
+		if (FAILED(pcContext->Map(m_pcVBInstances, 0, D3D11_MAP_WRITE_DISCARD, 0, &sMapped))) return;
+		memcpy(sMapped.pData, m_cGlyphBatch.GetInstances(), sizeof(GlyphInstance) * unInstanceCount);
+		pcContext->Unmap(m_pcVBInstances, 0);
+
+		// update constant buffer, glyph translation is done per instance
+		D3DXMATRIX sWorld, sViewProj;
+		D3DXMatrixIdentity(&sWorld);
+		D3DXMatrixTranspose(&m_sConstantBuffer0.sWorld, &sWorld);
+		sViewProj = m_sView * m_sProj;
+		D3DXMatrixTranspose(&m_sConstantBuffer0.sWorldViewProjection, &sViewProj);
+		pcContext->UpdateSubresource(m_pcConstantBuffer0, 0, 0, &m_sConstantBuffer0, 0, 0);
+
+		// set unit quad and instance buffer, constant buffer, font texture
+		ID3D11Buffer* apcVB[2] = { m_pcVBGlyphes, m_pcVBInstances };
+		UINT aunStride[2] = { sizeof(VertexPosUV), sizeof(GlyphInstance) };
+		UINT aunOffset[2] = { 0, 0 };
+		pcContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+		pcContext->IASetVertexBuffers(0, 2, apcVB, aunStride, aunOffset);
+		pcContext->VSSetConstantBuffers(0, 1, &m_pcConstantBuffer0);
+		pcContext->PSSetConstantBuffers(0, 1, &m_pcConstantBuffer0);
+		pcContext->PSSetShaderResources(0, 1, &m_pcTexFontSRV);
+
+		// set shaders
+		pcContext->VSSetShader(m_pcVertexShader, nullptr, NULL);
+		pcContext->IASetInputLayout((ID3D11InputLayout*)m_pcInputLayout);
+		pcContext->PSSetShader(m_pcPixelShader, nullptr, NULL);
+
+		// Set the sampler
+		pcContext->PSSetSamplers(0, 1, &m_pcSampler);
+
+		// get old blend state
+		ID3D11BlendState* pcBlendStateOld = nullptr;
+		FLOAT afBlendFactor[4] = {};
+		UINT unMask = 0;
+		pcContext->OMGetBlendState(&pcBlendStateOld, afBlendFactor, &unMask);
+		pcContext->OMSetBlendState(m_pcBlendState, 0, 0xffffffff);
+
+		pcContext->DrawInstanced(4, unInstanceCount, 0, 0);
+
+		// set old blend state, release
+		pcContext->OMSetBlendState(pcBlendStateOld, afBlendFactor, unMask);
+		SAFE_RELEASE(pcBlendStateOld);
+
+		m_cGlyphBatch.Clear();
+	}
+
+private:
+	/// <summary>
+	/// Creates all D3D resources for the decoded font.
+	/// </summary>
+	void Init(ID3D11Device* pcDevice, const SpriteFontData& sData, float fAspect, HRESULT& nHr, UINT unTechnique)
+	{
+		// Create the D3D texture.
+		CD3D11_TEXTURE2D_DESC sDescTex(sData.eTextureFormat, sData.unTextureWidth, sData.unTextureHeight, 1, 1, D3D11_BIND_SHADER_RESOURCE, D3D11_USAGE_IMMUTABLE);
+		CD3D11_SHADER_RESOURCE_VIEW_DESC sDescView(D3D11_SRV_DIMENSION_TEXTURE2D, sData.eTextureFormat);
+		D3D11_SUBRESOURCE_DATA sInitData = { sData.pchTextureData, sData.unTextureStride };
+
+		nHr = pcDevice->CreateTexture2D(&sDescTex, &sInitData, &m_pcTexFont2D);
+		if (FAILED(nHr)) return;
+		nHr = pcDevice->CreateShaderResourceView((ID3D11Resource*)m_pcTexFont2D, &sDescView, &m_pcTexFontSRV);
+		if (FAILED(nHr)) return;
+
+		// convert to glyph shapes
+		GlyphShape sShape = {};
+		m_asGlyphShapes.assign(256, sShape);
+
+		// loop through the ascii codes, look up the glyphes (printable characters fall back to the default character)
+		float fFontSize = 128.0f;
+		float fSpace = 0.02f;
+		for (uint32_t unAscii = 0; unAscii < 256; unAscii++)
+		{
+			// set glyph data
+			const Glyph_MS* psGlyph = (unAscii < 32) ? sData.cGlyphTable.Find(unAscii) : sData.cGlyphTable.FindOrDefault(unAscii);
+			if (!psGlyph) continue;
+			m_asGlyphShapes[unAscii].fULeft = (float)psGlyph->Subrect.left / (float)sData.unTextureWidth;
+			m_asGlyphShapes[unAscii].fURight = (float)psGlyph->Subrect.right / (float)sData.unTextureWidth;
+			m_asGlyphShapes[unAscii].fVTop = (float)psGlyph->Subrect.top / (float)sData.unTextureHeight;
+			m_asGlyphShapes[unAscii].fVBottom = (float)psGlyph->Subrect.bottom / (float)sData.unTextureHeight;
+
+			// set quad dimensions, x advance by glyph width
+			float fGlyphWidth = ((float)psGlyph->Subrect.right - (float)psGlyph->Subrect.left) / fFontSize;
+			float fGlyphHeight = ((float)psGlyph->Subrect.bottom - (float)psGlyph->Subrect.top) / fFontSize;
+			float fGlyphOffset = (fFontSize - psGlyph->YOffset) / fFontSize;
+			m_asGlyphShapes[unAscii].fWidth = fGlyphWidth;
+			m_asGlyphShapes[unAscii].fHeight = fGlyphHeight;
+			m_asGlyphShapes[unAscii].fYOffset = fGlyphOffset;
+			m_asGlyphShapes[unAscii].fXAdvance = -(fGlyphWidth + fSpace);
+		}
+
+		// set space x advance manually
+		m_asGlyphShapes[' '].fXAdvance = -fSpace * 10.0f;
+		m_cGlyphBatch.SetShapes(&m_asGlyphShapes[0]);
+
+		// create the unit quad vertex buffer, scaled per glyph instance
+		VertexPosUV asVerticesGlyph[4] = {};
+
+		// 0
+		asVerticesGlyph[0].afPos3 = XMFLOAT3(0.0f, 0.0f, 1.0f);
+		asVerticesGlyph[0].afUV2 = XMFLOAT2(1.0f, 1.0f);
+
+		// 1
+		asVerticesGlyph[1].afPos3 = XMFLOAT3(1.0f, 0.0f, 1.0f);
+		asVerticesGlyph[1].afUV2 = XMFLOAT2(0.0f, 1.0f);
+
+		// 2
+		asVerticesGlyph[2].afPos3 = XMFLOAT3(0.0f, 0.0f, 0.0f);
+		asVerticesGlyph[2].afUV2 = XMFLOAT2(1.0f, 0.0f);
+
+		// 3
+		asVerticesGlyph[3].afPos3 = XMFLOAT3(1.0f, 0.0f, 0.0f);
+		asVerticesGlyph[3].afUV2 = XMFLOAT2(0.0f, 0.0f);
+
+		// create the glyph vertex buffer
+		D3D11_BUFFER_DESC sDescVtx;
+		ZeroMemory(&sDescVtx, sizeof(D3D11_BUFFER_DESC));
+		sDescVtx.Usage = D3D11_USAGE_IMMUTABLE;
+		sDescVtx.ByteWidth = sizeof(VertexPosUV) * 4;
+		sDescVtx.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+		sDescVtx.CPUAccessFlags = 0;
+		sDescVtx.MiscFlags = 0;
+		sDescVtx.StructureByteStride = 0;
+		D3D11_SUBRESOURCE_DATA sInitDataVtx;
+		ZeroMemory(&sInitDataVtx, sizeof(D3D11_SUBRESOURCE_DATA));
+		sInitDataVtx.pSysMem = asVerticesGlyph;
+		if (FAILED(nHr = pcDevice->CreateBuffer(&sDescVtx, &sInitDataVtx, &m_pcVBGlyphes)))
+		{
+			OutputDebugStringA("[VRO] Failed to create buffer !");
+			return;
 		}
 
 		// set first matrices
@@ -2657,155 +3010,6 @@ public:
 		if (FAILED(pcDevice->CreateSamplerState(&sampDesc, &m_pcSampler)))
 			OutputDebugString(L"[VRO] Failed to create sampler.");
 	}
-
-	/// <summary>
-	/// Destructor.
-	/// </summary>
-	~VireioFont()
-	{
-		SAFE_RELEASE(m_pcSampler);
-		SAFE_RELEASE(m_pcVertexShader);
-		SAFE_RELEASE(m_pcPixelShader);
-		SAFE_RELEASE(m_pcInputLayout);
-		SAFE_RELEASE(m_pcTexFont2D);
-		SAFE_RELEASE(m_pcTexFontSRV);
-		SAFE_RELEASE(m_pcConstantsGlyph);
-		SAFE_RELEASE(m_pcVBGlyphes);
-		SAFE_RELEASE(m_pcConstantBuffer0);
-		SAFE_RELEASE(m_pcBlendState);
-	}
-
-	/// <summary>
-	/// Set attributes for the text.
-	/// </summary>
-	void SetTextAttributes(float fX, float fY, float fZ)
-	{
-		// Build the view matrix.
-		D3DXVECTOR3 sPos = D3DXVECTOR3(fX, fY, fZ);
-		D3DXVECTOR3 sTarget = D3DXVECTOR3(0.0f, 0.01f, 0.0f);
-		D3DXVECTOR3 sUp = D3DXVECTOR3(0.0f, 1.0f, 0.0f);
-
-		D3DXMatrixLookAtLH(&m_sView, &sPos, &sTarget, &sUp);
-	}
-
-	/// <summary>
-	/// Sets all fields before the render calls.
-	/// </summary>
-	void ToRender(ID3D11DeviceContext* pcContext, float fTime, float fScrollY, float fDistance, float fCenterTremble)
-	{
-		UINT stride = sizeof(VertexPosUV);
-		UINT offset = 0;
-
-		// set glyph vertex buffer, constant buffers, font texture
-		pcContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
-		pcContext->IASetVertexBuffers(0, 1, &m_pcVBGlyphes, &stride, &offset);
-		pcContext->VSSetConstantBuffers(0, 1, &m_pcConstantBuffer0);
-		pcContext->VSSetConstantBuffers(1, 1, &m_pcConstantsGlyph);
-		pcContext->PSSetConstantBuffers(0, 1, &m_pcConstantBuffer0);
-		pcContext->PSSetShaderResources(0, 1, &m_pcTexFontSRV);
-
-		// set shaders
-		pcContext->VSSetShader(m_pcVertexShader, nullptr, NULL);
-		pcContext->IASetInputLayout((ID3D11InputLayout*)m_pcInputLayout);
-		pcContext->PSSetShader(m_pcPixelShader, nullptr, NULL);
-
-		// Set the sampler
-		pcContext->PSSetSamplers(0, 1, &m_pcSampler);
-
-		// set buffer fields
-		m_sConstantBuffer0.fGlobalTime = fTime;
-
-		// set scroll origin, distance, line index zero, additional tremble for the center object
-		m_fScrollY = fScrollY;
-		m_fDistance = -fDistance;
-		m_unLineIx = 0;
-		m_fCenterTremble = fCenterTremble;
-	}
-
-	/// <summary>
-	/// Measures the text width.
-	/// @returns The measured text width in world space dimension.
-	/// </summary>
-	float MeasureText(LPCSTR szText)
-	{
-		UINT unIx = 0;
-		float fReturn = 0.0f;
-		while (szText[unIx])
-		{
-			char ch = szText[unIx];
-			fReturn += m_asGlyphConstants[ch].fXAdvance;
-			unIx++;
-		}
-		return fReturn;
-	}
-
-	/// <summary>
-	/// Empty line.
-	/// </summary>
-	void Enter() { m_unLineIx++; }
-
-	/// <summary>
-	/// Renders a new text line based on the vertical scroll origin.
-	/// </summary>
-	void RenderTextLine(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, LPCSTR szText)
-	{
-		// get vertical origin, measure text
-		float fLineOrigin = m_fScrollY + (float)m_unLineIx * 1.4f;
-		float fTremble = 0.0f;
-		float fWidth = MeasureText(szText);
-
-		// set tremble for vertically centered line
-		if ((fLineOrigin > -0.5) && (fLineOrigin < 0.5f)) fTremble = (sin(m_sConstantBuffer0.fGlobalTime * 20.0f)) * 0.5f + m_fCenterTremble;
-
-		// render text centered
-		RenderText(pcDevice, pcContext, szText, fWidth * -0.5f, m_fDistance + fTremble, fLineOrigin);
-
-		// next line
-		m_unLineIx++;
-	}
-
-	/// <summary>
-	/// Draw text on active render target.
-	/// </summary>
-	void RenderText(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, LPCSTR szText, float fX, float fY, float fZ)
-	{
-		// get old blend state
-		ID3D11BlendState* pcBlendStateOld = nullptr;
-		FLOAT afBlendFactor[4] = {};
-		UINT unMask = 0;
-		pcContext->OMGetBlendState(&pcBlendStateOld, afBlendFactor, &unMask);
-		pcContext->OMSetBlendState(m_pcBlendState, 0, 0xffffffff);
-
-		UINT unIx = 0;
-		float fXTranslate = fX;
-		while (szText[unIx])
-		{
-			char ch = szText[unIx];
-
-			// update matrices
-			fXTranslate += m_asGlyphConstants[ch].fXAdvance;
-			D3DXMATRIX world, view, proj;
-			D3DXMatrixTranslation(&world, fXTranslate, fY, fZ);
-			D3DXMatrixTranspose(&m_sConstantBuffer0.sWorld, &world);
-			D3DXMATRIX wvp;
-			wvp = world * m_sView * m_sProj;
-			D3DXMatrixTranspose(&m_sConstantBuffer0.sWorldViewProjection, &wvp);
-
-			// update constant buffers
-			pcContext->UpdateSubresource(m_pcConstantBuffer0, 0, 0, &m_sConstantBuffer0, 0, 0);
-			pcContext->UpdateSubresource(m_pcConstantsGlyph, 0, 0, &m_asGlyphConstants[ch], 0, 0);
-
-			pcContext->Draw(4, (UINT)ch * 4);
-
-			unIx++;
-		}
-
-		// set old blend state, release
-		pcContext->OMSetBlendState(pcBlendStateOld, afBlendFactor, unMask);
-		SAFE_RELEASE(pcBlendStateOld);
-	}
-
-private:
 	/// <summary>
 	/// Font texture.
 	/// </summary>
@@ -2815,18 +3019,26 @@ private:
 	/// </summary>
 	ID3D11ShaderResourceView* m_pcTexFontSRV;
 	/// <summary>
-	 /// Glyph constants array.
+	/// Glyph shapes array.
 	/// Array size 256 for every ascii code.
 	/// </summary>
-	std::vector<Glyph_Constants> m_asGlyphConstants;
+	std::vector<GlyphShape> m_asGlyphShapes;
 	/// <summary>
-	 /// Glyph constant buffer.
+	/// Glyph instance stream of the current frame.
 	/// </summary>
-	ID3D11Buffer* m_pcConstantsGlyph;
+	VireioGlyphBatch m_cGlyphBatch;
 	/// <summary>
-	/// Vertex buffer containing all glyph vertices.
+	/// Vertex buffer containing the glyph unit quad.
 	/// </summary>
 	ID3D11Buffer* m_pcVBGlyphes;
+	/// <summary>
+	/// Dynamic vertex buffer containing the glyph instances.
+	/// </summary>
+	ID3D11Buffer* m_pcVBInstances;
+	/// <summary>
+	/// Glyph instance buffer capacity.
+	/// </summary>
+	UINT m_unInstanceCapacity;
 	/// <summary>
 	 /// Main constant structure.
 	/// </summary>
@@ -2953,12 +3165,26 @@ HRESULT CreateVertexShaderTechnique(ID3D11Device* pcDevice, ID3D11VertexShader**
 				{ "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 				{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 },
 			};
+			D3D11_INPUT_ELEMENT_DESC aLayout03[] =
+			{
+				{ "POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+				{ "NORMAL", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 12, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+				{ "TEXCOORD", 0, DXGI_FORMAT_R32G32_FLOAT, 0, 24, D3D11_INPUT_PER_VERTEX_DATA, 0 },
+				{ "TEXCOORD", 1, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 0, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+				{ "TEXCOORD", 2, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 16, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+				{ "TEXCOORD", 3, DXGI_FORMAT_R32G32B32A32_FLOAT, 1, 32, D3D11_INPUT_PER_INSTANCE_DATA, 1 },
+			};
 
 			if (eTechnique == VertexShaderTechnique::PosUV2D)
 			{
 				UINT unNumElements = sizeof(aLayout01) / sizeof(aLayout01[0]);
 				hr = pcDevice->CreateInputLayout(aLayout01, unNumElements, pcShader->GetBufferPointer(), pcShader->GetBufferSize(), ppcInputLayout);
 			}
+			else if (eTechnique == VertexShaderTechnique::PosNormUV_Text)
+			{
+				UINT unNumElements = sizeof(aLayout03) / sizeof(aLayout03[0]);
+				hr = pcDevice->CreateInputLayout(aLayout03, unNumElements, pcShader->GetBufferPointer(), pcShader->GetBufferSize(), ppcInputLayout);
+			}
 			else
 			{
 				UINT unNumElements = sizeof(aLayout02) / sizeof(aLayout02[0]);
@@ -41,6 +41,70 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #pragma comment(lib, "d3d11.lib")
 #endif
 
+/**
+* DirectX 11 state block mask.
+* Selects the stages and slot ranges a partial state block saves and
+* restores. Slot counts always start at slot 0.
+***/
+struct D3DX11_STATE_BLOCK_MASK
+{
+	BOOL VS, GS, HS, DS, PS;              /**< Shader + class instances per stage **/
+	UINT VSSamplers;                      /**< Number of vertex shader sampler slots **/
+	UINT VSShaderResources;               /**< Number of vertex shader resource slots **/
+	UINT VSConstantBuffers;               /**< Number of vertex shader constant buffer slots **/
+	UINT PSSamplers;                      /**< Number of pixel shader sampler slots **/
+	UINT PSShaderResources;               /**< Number of pixel shader resource slots **/
+	UINT PSConstantBuffers;               /**< Number of pixel shader constant buffer slots **/
+	UINT IAVertexBuffers;                 /**< Number of vertex buffer slots **/
+	BOOL IAIndexBuffer;                   /**< Index buffer, format and offset **/
+	BOOL IAInputLayout;                   /**< Input layout **/
+	BOOL IAPrimitiveTopology;             /**< Primitive topology **/
+	BOOL OMRenderTargets;                 /**< All render targets + depth stencil view **/
+	BOOL OMDepthStencilState;             /**< Depth stencil state + reference **/
+	BOOL OMBlendState;                    /**< Blend state, factor and sample mask **/
+	BOOL RSViewports;                     /**< Viewports **/
+	BOOL RSScissorRects;                  /**< Scissor rectangles **/
+	BOOL RSRasterizerState;               /**< Rasterizer state **/
+	BOOL SOTargets;                       /**< Stream output targets (restored with zero offsets) **/
+	BOOL Predication;                     /**< Predicate + value **/
+};
+
+/**
+* State block mask for the Vireio overlays (menu, cinema, direct mode renderers).
+* Covers everything these set between CreateStateblock() and ApplyStateblock() :
+* vertex/pixel shader, constant buffers 0-1, shader resource 0, sampler 0,
+* vertex buffers 0-1 (glyph instances), index buffer, input layout, topology, output merger and
+* rasterizer state. Geometry/hull/domain shaders, stream output and the
+* predication are saved since the overlays draw with those unbound.
+***/
+static const D3DX11_STATE_BLOCK_MASK D3DX11_STATE_BLOCK_MASK_OVERLAY =
+{
+	TRUE, TRUE, TRUE, TRUE, TRUE,
+	0, 0, 2,
+	1, 1, 2,
+	2, TRUE, TRUE, TRUE,
+	TRUE, TRUE, TRUE,
+	TRUE, TRUE, TRUE,
+	TRUE, TRUE
+};
+
+/**
+* State block mask for HMD runtimes drawing their distortion pass on the game
+* context (OSVR render manager). Like the overlay mask, with the first 4 sampler,
+* resource and constant buffer slots of the vertex and pixel shader since the
+* runtime shaders are not known here.
+***/
+static const D3DX11_STATE_BLOCK_MASK D3DX11_STATE_BLOCK_MASK_DISTORTION =
+{
+	TRUE, TRUE, TRUE, TRUE, TRUE,
+	4, 4, 4,
+	4, 4, 4,
+	2, TRUE, TRUE, TRUE,
+	TRUE, TRUE, TRUE,
+	TRUE, TRUE, TRUE,
+	TRUE, TRUE
+};
+
 /**
 * DirectX 11 state block structure.
 * (D3D11 has no state blocks any more...)
@@ -116,6 +180,9 @@ struct D3DX11_STATE_BLOCK
 	ID3D11Buffer*             SOBuffers[4];
 	ID3D11Predicate*          Predication;
 	BOOL                      PredicationValue;
+
+	BOOL                      Masked;
+	D3DX11_STATE_BLOCK_MASK   Mask;
 };
 
 /**
@@ -128,6 +195,203 @@ inline void SafeRelease(UINT dwCount, IUnknown** ppInterfaces)
 		ppInterfaces[dw]->Release();
 }
 
+/**
+* Create partial dx11 stateblock.
+* Only queries the stages and slots selected by the mask, the overlays
+* touch a handful of slots so this replaces hundreds of Get calls by a few.
+* Instantly RELEASE all IUnknown interfaces here since their ref count will be increased.
+***/
+void CreateStateblock(ID3D11DeviceContext* pcContext, D3DX11_STATE_BLOCK* sStateBlock, const D3DX11_STATE_BLOCK_MASK& sMask)
+{
+	memset(sStateBlock, 0, sizeof(D3DX11_STATE_BLOCK));
+	sStateBlock->Masked = TRUE;
+	sStateBlock->Mask = sMask;
+
+	// shaders, class instances are always released
+	if (sMask.VS)
+	{
+		sStateBlock->VSInterfaceCount = D3D11_SHADER_MAX_INTERFACES;
+		pcContext->VSGetShader(&sStateBlock->VS, sStateBlock->VSInterfaces, &sStateBlock->VSInterfaceCount);
+		if (sStateBlock->VS) sStateBlock->VS->Release();
+		SafeRelease(sStateBlock->VSInterfaceCount, (IUnknown**)sStateBlock->VSInterfaces);
+	}
+	if (sMask.GS)
+	{
+		sStateBlock->GSInterfaceCount = D3D11_SHADER_MAX_INTERFACES;
+		pcContext->GSGetShader(&sStateBlock->GS, sStateBlock->GSInterfaces, &sStateBlock->GSInterfaceCount);
+		if (sStateBlock->GS) sStateBlock->GS->Release();
+		SafeRelease(sStateBlock->GSInterfaceCount, (IUnknown**)sStateBlock->GSInterfaces);
+	}
+	if (sMask.HS)
+	{
+		sStateBlock->HSInterfaceCount = D3D11_SHADER_MAX_INTERFACES;
+		pcContext->HSGetShader(&sStateBlock->HS, sStateBlock->HSInterfaces, &sStateBlock->HSInterfaceCount);
+		if (sStateBlock->HS) sStateBlock->HS->Release();
+		SafeRelease(sStateBlock->HSInterfaceCount, (IUnknown**)sStateBlock->HSInterfaces);
+	}
+	if (sMask.DS)
+	{
+		sStateBlock->DSInterfaceCount = D3D11_SHADER_MAX_INTERFACES;
+		pcContext->DSGetShader(&sStateBlock->DS, sStateBlock->DSInterfaces, &sStateBlock->DSInterfaceCount);
+		if (sStateBlock->DS) sStateBlock->DS->Release();
+		SafeRelease(sStateBlock->DSInterfaceCount, (IUnknown**)sStateBlock->DSInterfaces);
+	}
+	if (sMask.PS)
+	{
+		sStateBlock->PSInterfaceCount = D3D11_SHADER_MAX_INTERFACES;
+		pcContext->PSGetShader(&sStateBlock->PS, sStateBlock->PSInterfaces, &sStateBlock->PSInterfaceCount);
+		if (sStateBlock->PS) sStateBlock->PS->Release();
+		SafeRelease(sStateBlock->PSInterfaceCount, (IUnknown**)sStateBlock->PSInterfaces);
+	}
+
+	// vertex shader slots
+	if (sMask.VSSamplers)
+	{
+		pcContext->VSGetSamplers(0, sMask.VSSamplers, sStateBlock->VSSamplers);
+		SafeRelease(sMask.VSSamplers, (IUnknown**)sStateBlock->VSSamplers);
+	}
+	if (sMask.VSShaderResources)
+	{
+		pcContext->VSGetShaderResources(0, sMask.VSShaderResources, sStateBlock->VSShaderResources);
+		SafeRelease(sMask.VSShaderResources, (IUnknown**)sStateBlock->VSShaderResources);
+	}
+	if (sMask.VSConstantBuffers)
+	{
+		pcContext->VSGetConstantBuffers(0, sMask.VSConstantBuffers, sStateBlock->VSConstantBuffers);
+		SafeRelease(sMask.VSConstantBuffers, (IUnknown**)sStateBlock->VSConstantBuffers);
+	}
+
+	// pixel shader slots
+	if (sMask.PSSamplers)
+	{
+		pcContext->PSGetSamplers(0, sMask.PSSamplers, sStateBlock->PSSamplers);
+		SafeRelease(sMask.PSSamplers, (IUnknown**)sStateBlock->PSSamplers);
+	}
+	if (sMask.PSShaderResources)
+	{
+		pcContext->PSGetShaderResources(0, sMask.PSShaderResources, sStateBlock->PSShaderResources);
+		SafeRelease(sMask.PSShaderResources, (IUnknown**)sStateBlock->PSShaderResources);
+	}
+	if (sMask.PSConstantBuffers)
+	{
+		pcContext->PSGetConstantBuffers(0, sMask.PSConstantBuffers, sStateBlock->PSConstantBuffers);
+		SafeRelease(sMask.PSConstantBuffers, (IUnknown**)sStateBlock->PSConstantBuffers);
+	}
+
+	// input assembler stage
+	if (sMask.IAVertexBuffers)
+	{
+		pcContext->IAGetVertexBuffers(0, sMask.IAVertexBuffers, sStateBlock->IAVertexBuffers, sStateBlock->IAVertexBuffersStrides, sStateBlock->IAVertexBuffersOffsets);
+		SafeRelease(sMask.IAVertexBuffers, (IUnknown**)sStateBlock->IAVertexBuffers);
+	}
+	if (sMask.IAIndexBuffer)
+	{
+		pcContext->IAGetIndexBuffer(&sStateBlock->IAIndexBuffer, &sStateBlock->IAIndexBufferFormat, &sStateBlock->IAIndexBufferOffset);
+		if (sStateBlock->IAIndexBuffer) sStateBlock->IAIndexBuffer->Release();
+	}
+	if (sMask.IAInputLayout)
+	{
+		pcContext->IAGetInputLayout(&sStateBlock->IAInputLayout);
+		if (sStateBlock->IAInputLayout) sStateBlock->IAInputLayout->Release();
+	}
+	if (sMask.IAPrimitiveTopology)
+		pcContext->IAGetPrimitiveTopology(&sStateBlock->IAPrimitiveTopology);
+
+	// output merger stage
+	if (sMask.OMRenderTargets)
+	{
+		pcContext->OMGetRenderTargets(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, sStateBlock->OMRenderTargets, &sStateBlock->OMRenderTargetStencilView);
+		SafeRelease(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, (IUnknown**)sStateBlock->OMRenderTargets);
+		if (sStateBlock->OMRenderTargetStencilView) sStateBlock->OMRenderTargetStencilView->Release();
+	}
+	if (sMask.OMDepthStencilState)
+	{
+		pcContext->OMGetDepthStencilState(&sStateBlock->OMDepthStencilState, &sStateBlock->OMDepthStencilRef);
+		if (sStateBlock->OMDepthStencilState) sStateBlock->OMDepthStencilState->Release();
+	}
+	if (sMask.OMBlendState)
+	{
+		pcContext->OMGetBlendState(&sStateBlock->OMBlendState, sStateBlock->OMBlendFactor, &sStateBlock->OMSampleMask);
+		if (sStateBlock->OMBlendState) sStateBlock->OMBlendState->Release();
+	}
+
+	// rasterizer stage
+	if (sMask.RSViewports)
+	{
+		sStateBlock->RSViewportCount = D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
+		pcContext->RSGetViewports(&sStateBlock->RSViewportCount, sStateBlock->RSViewports);
+	}
+	if (sMask.RSScissorRects)
+	{
+		sStateBlock->RSScissorRectCount = D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
+		pcContext->RSGetScissorRects(&sStateBlock->RSScissorRectCount, sStateBlock->RSScissorRects);
+	}
+	if (sMask.RSRasterizerState)
+	{
+		pcContext->RSGetState(&sStateBlock->RSRasterizerState);
+		if (sStateBlock->RSRasterizerState) sStateBlock->RSRasterizerState->Release();
+	}
+
+	// stream-output stage, predications
+	if (sMask.SOTargets)
+	{
+		pcContext->SOGetTargets(4, sStateBlock->SOBuffers);
+		SafeRelease(4, (IUnknown**)sStateBlock->SOBuffers);
+	}
+	if (sMask.Predication)
+	{
+		pcContext->GetPredication(&sStateBlock->Predication, &sStateBlock->PredicationValue);
+		if (sStateBlock->Predication) sStateBlock->Predication->Release();
+	}
+}
+
+/**
+* Apply partial dx11 stateblock.
+* Only sets the stages and slots captured by CreateStateblock() with a mask.
+***/
+void ApplyStateblockMasked(ID3D11DeviceContext* pcContext, D3DX11_STATE_BLOCK* sStateBlock)
+{
+	const D3DX11_STATE_BLOCK_MASK& sMask = sStateBlock->Mask;
+
+	// shaders
+	if (sMask.VS) pcContext->VSSetShader(sStateBlock->VS, sStateBlock->VSInterfaces, sStateBlock->VSInterfaceCount);
+	if (sMask.GS) pcContext->GSSetShader(sStateBlock->GS, sStateBlock->GSInterfaces, sStateBlock->GSInterfaceCount);
+	if (sMask.HS) pcContext->HSSetShader(sStateBlock->HS, sStateBlock->HSInterfaces, sStateBlock->HSInterfaceCount);
+	if (sMask.DS) pcContext->DSSetShader(sStateBlock->DS, sStateBlock->DSInterfaces, sStateBlock->DSInterfaceCount);
+	if (sMask.PS) pcContext->PSSetShader(sStateBlock->PS, sStateBlock->PSInterfaces, sStateBlock->PSInterfaceCount);
+
+	// vertex shader slots
+	if (sMask.VSSamplers) pcContext->VSSetSamplers(0, sMask.VSSamplers, sStateBlock->VSSamplers);
+	if (sMask.VSShaderResources) pcContext->VSSetShaderResources(0, sMask.VSShaderResources, sStateBlock->VSShaderResources);
+	if (sMask.VSConstantBuffers) pcContext->VSSetConstantBuffers(0, sMask.VSConstantBuffers, sStateBlock->VSConstantBuffers);
+
+	// pixel shader slots
+	if (sMask.PSSamplers) pcContext->PSSetSamplers(0, sMask.PSSamplers, sStateBlock->PSSamplers);
+	if (sMask.PSShaderResources) pcContext->PSSetShaderResources(0, sMask.PSShaderResources, sStateBlock->PSShaderResources);
+	if (sMask.PSConstantBuffers) pcContext->PSSetConstantBuffers(0, sMask.PSConstantBuffers, sStateBlock->PSConstantBuffers);
+
+	// input assembler stage
+	if (sMask.IAVertexBuffers) pcContext->IASetVertexBuffers(0, sMask.IAVertexBuffers, sStateBlock->IAVertexBuffers, sStateBlock->IAVertexBuffersStrides, sStateBlock->IAVertexBuffersOffsets);
+	if (sMask.IAIndexBuffer) pcContext->IASetIndexBuffer(sStateBlock->IAIndexBuffer, sStateBlock->IAIndexBufferFormat, sStateBlock->IAIndexBufferOffset);
+	if (sMask.IAInputLayout) pcContext->IASetInputLayout(sStateBlock->IAInputLayout);
+	if (sMask.IAPrimitiveTopology) pcContext->IASetPrimitiveTopology(sStateBlock->IAPrimitiveTopology);
+
+	// output merger stage
+	if (sMask.OMRenderTargets) pcContext->OMSetRenderTargets(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, sStateBlock->OMRenderTargets, sStateBlock->OMRenderTargetStencilView);
+	if (sMask.OMDepthStencilState) pcContext->OMSetDepthStencilState(sStateBlock->OMDepthStencilState, sStateBlock->OMDepthStencilRef);
+	if (sMask.OMBlendState) pcContext->OMSetBlendState(sStateBlock->OMBlendState, sStateBlock->OMBlendFactor, sStateBlock->OMSampleMask);
+
+	// rasterizer stage
+	if (sMask.RSViewports) pcContext->RSSetViewports(sStateBlock->RSViewportCount, sStateBlock->RSViewports);
+	if (sMask.RSScissorRects) pcContext->RSSetScissorRects(sStateBlock->RSScissorRectCount, sStateBlock->RSScissorRects);
+	if (sMask.RSRasterizerState) pcContext->RSSetState(sStateBlock->RSRasterizerState);
+
+	// stream-output stage, predications
+	UINT SOBuffersOffsets[4] = { 0 };
+	if (sMask.SOTargets) pcContext->SOSetTargets(4, sStateBlock->SOBuffers, SOBuffersOffsets);
+	if (sMask.Predication) pcContext->SetPredication(sStateBlock->Predication, sStateBlock->PredicationValue);
+}
+
 /**
 * Create dx11 stateblocks.
 * MS Docs about ->ClearState() :
@@ -291,6 +555,13 @@ void CreateStateblock(ID3D11DeviceContext* pcContext, D3DX11_STATE_BLOCK* sState
 ***/
 void ApplyStateblock(ID3D11DeviceContext* pcContext, D3DX11_STATE_BLOCK* sStateBlock)
 {
+	// partial state block ?
+	if (sStateBlock->Masked)
+	{
+		ApplyStateblockMasked(pcContext, sStateBlock);
+		return;
+	}
+
 	// can we ignore unordered access views here ? i assume we can...
 	// UINT minus_one[D3D11_PS_CS_UAV_REGISTER_COUNT];
 	// memset(minus_one, -1, sizeof(minus_one));
@@ -424,4 +695,50 @@ void ClearContextState(ID3D11DeviceContext* pcContext)
 	// stream-output stage, predications
 	pcContext->SOSetTargets(NULL, NULL, NULL);
 	pcContext->SetPredication(NULL, NULL);
-}
\ No newline at end of file
+}
+
+/**
+* Resets the stages and slots selected by the mask to the default settings.
+* Counterpart of ClearContextState() for partial state blocks, everything
+* not in the mask stays bound.
+***/
+void ClearContextState(ID3D11DeviceContext* pcContext, const D3DX11_STATE_BLOCK_MASK& sMask)
+{
+	static void* const s_apNull[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT] = {};
+	static const UINT s_aunZero[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT] = {};
+
+	// shaders
+	if (sMask.VS) pcContext->VSSetShader(NULL, NULL, NULL);
+	if (sMask.GS) pcContext->GSSetShader(NULL, NULL, NULL);
+	if (sMask.HS) pcContext->HSSetShader(NULL, NULL, NULL);
+	if (sMask.DS) pcContext->DSSetShader(NULL, NULL, NULL);
+	if (sMask.PS) pcContext->PSSetShader(NULL, NULL, NULL);
+
+	// shader slots
+	if (sMask.VSSamplers) pcContext->VSSetSamplers(0, sMask.VSSamplers, (ID3D11SamplerState* const*)s_apNull);
+	if (sMask.VSShaderResources) pcContext->VSSetShaderResources(0, sMask.VSShaderResources, (ID3D11ShaderResourceView* const*)s_apNull);
+	if (sMask.VSConstantBuffers) pcContext->VSSetConstantBuffers(0, sMask.VSConstantBuffers, (ID3D11Buffer* const*)s_apNull);
+	if (sMask.PSSamplers) pcContext->PSSetSamplers(0, sMask.PSSamplers, (ID3D11SamplerState* const*)s_apNull);
+	if (sMask.PSShaderResources) pcContext->PSSetShaderResources(0, sMask.PSShaderResources, (ID3D11ShaderResourceView* const*)s_apNull);
+	if (sMask.PSConstantBuffers) pcContext->PSSetConstantBuffers(0, sMask.PSConstantBuffers, (ID3D11Buffer* const*)s_apNull);
+
+	// input assembler stage
+	if (sMask.IAVertexBuffers) pcContext->IASetVertexBuffers(0, sMask.IAVertexBuffers, (ID3D11Buffer* const*)s_apNull, s_aunZero, s_aunZero);
+	if (sMask.IAIndexBuffer) pcContext->IASetIndexBuffer(NULL, DXGI_FORMAT_UNKNOWN, 0);
+	if (sMask.IAInputLayout) pcContext->IASetInputLayout(NULL);
+	if (sMask.IAPrimitiveTopology) pcContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED);
+
+	// output merger stage
+	if (sMask.OMRenderTargets) pcContext->OMSetRenderTargets(0, NULL, NULL);
+	if (sMask.OMDepthStencilState) pcContext->OMSetDepthStencilState(NULL, NULL);
+	if (sMask.OMBlendState) pcContext->OMSetBlendState(NULL, NULL, 0xffffffff);
+
+	// rasterizer stage
+	if (sMask.RSViewports) pcContext->RSSetViewports(0, NULL);
+	if (sMask.RSScissorRects) pcContext->RSSetScissorRects(0, NULL);
+	if (sMask.RSRasterizerState) pcContext->RSSetState(NULL);
+
+	// stream-output stage, predications
+	if (sMask.SOTargets) pcContext->SOSetTargets(NULL, NULL, NULL);
+	if (sMask.Predication) pcContext->SetPredication(NULL, NULL);
+}
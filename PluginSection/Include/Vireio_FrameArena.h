@@ -0,0 +1,303 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <Vireio_FrameArena.h> :
+Copyright (C) 2020 Denis Reischl
+
+
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+v2.0.4 onwards 2014 by Grant Bagwell, Simon Brown and Neil Schneider
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown and Neil Schneider
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+#ifndef VIREIO_FRAME_ARENA
+#define VIREIO_FRAME_ARENA
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <new>
+#include <vector>
+
+/// <summary>
+/// Poison freed arena memory by default in debug builds.
+/// </summary>
+#ifdef _DEBUG
+#define VIREIO_ARENA_POISON_DEFAULT true
+#else
+#define VIREIO_ARENA_POISON_DEFAULT false
+#endif
+
+/// <summary>
+/// Scratch memory arena for render thread hot paths.
+/// Allocation is a pointer bump, nothing is freed individually. A Scope
+/// rewinds the arena to where it was on entry of a method, the nodes do
+/// not see Present so there is no per frame reset. If a call needs more
+/// than the first block the blocks are merged into one when the outermost
+/// scope ends, so the steady state never calls the heap. Not thread safe,
+/// one arena per node and thread.
+/// Only for trivially destructible data, destructors are never called.
+/// </summary>
+class VireioFrameArena
+{
+public:
+	/// <summary>
+	/// Allocation counters.
+	/// </summary>
+	struct Stats
+	{
+		unsigned long long unAllocations;      /**< Allocations since construction. **/
+		unsigned long long unBytes;            /**< Bytes allocated since construction. **/
+		unsigned long long unHeapAllocations;  /**< Blocks allocated from the heap. **/
+		size_t unFrameBytes;                   /**< Bytes in use now. **/
+		size_t unPeakBytes;                    /**< Maximum bytes in use. **/
+		size_t unCapacity;                     /**< Bytes reserved in all blocks. **/
+	};
+
+	/// <summary>
+	/// Position in the arena, see GetMarker() and Rewind().
+	/// </summary>
+	struct Marker
+	{
+		size_t unBlock;
+		size_t unOffset;
+		size_t unFrameBytes;
+	};
+
+	/// <summary>
+	/// Rewinds the arena on scope exit.
+	/// </summary>
+	class Scope
+	{
+	public:
+		Scope(VireioFrameArena& cArena) : m_cArena(cArena), m_sMarker(cArena.GetMarker()) {}
+		~Scope() { m_cArena.Rewind(m_sMarker); }
+	private:
+		Scope(const Scope&);
+		Scope& operator=(const Scope&);
+		VireioFrameArena& m_cArena;
+		Marker m_sMarker;
+	};
+
+	/// <summary>
+	/// Constructor.
+	/// @param unBlockSize Size of the first block, allocated on first use.
+	/// @param bPoison True to fill rewound memory with 0xCD to catch lifetime bugs.
+	/// </summary>
+	VireioFrameArena(size_t unBlockSize = 64 * 1024, bool bPoison = VIREIO_ARENA_POISON_DEFAULT)
+		: m_unBlockSize(unBlockSize ? unBlockSize : 1024)
+		, m_unBlock(0)
+		, m_unOffset(0)
+		, m_bPoison(bPoison)
+	{
+		m_sStats = {};
+	}
+
+	~VireioFrameArena()
+	{
+		for (size_t unI = 0; unI < m_asBlocks.size(); unI++)
+			free(m_asBlocks[unI].pData);
+	}
+
+	/// <summary>
+	/// Allocates memory, valid until the arena is rewound to an earlier marker.
+	/// @param unAlign Alignment, must be a power of two.
+	/// </summary>
+	void* Allocate(size_t unSize, size_t unAlign = sizeof(void*) * 2)
+	{
+		if (!unSize) unSize = 1;
+
+		// find a block with enough space, starting at the current one
+		size_t unStart = 0;
+		while (true)
+		{
+			if (m_unBlock < m_asBlocks.size())
+			{
+				Block& sBlock = m_asBlocks[m_unBlock];
+				unStart = (((size_t)sBlock.pData + m_unOffset + unAlign - 1) & ~(unAlign - 1)) - (size_t)sBlock.pData;
+				if (unStart + unSize <= sBlock.unSize) break;
+
+				// next block, blocks too small are skipped
+				if (m_unBlock + 1 < m_asBlocks.size())
+				{
+					m_sStats.unFrameBytes += sBlock.unSize - m_unOffset;
+					m_unBlock++;
+					m_unOffset = 0;
+					continue;
+				}
+			}
+			if (!AddBlock(unSize + unAlign)) return nullptr;
+		}
+
+		Block& sBlock = m_asBlocks[m_unBlock];
+		m_sStats.unFrameBytes += (unStart + unSize) - m_unOffset;
+		m_unOffset = unStart + unSize;
+		if (m_sStats.unFrameBytes > m_sStats.unPeakBytes) m_sStats.unPeakBytes = m_sStats.unFrameBytes;
+		m_sStats.unAllocations++;
+		m_sStats.unBytes += unSize;
+		return sBlock.pData + unStart;
+	}
+
+	/// <summary>
+	/// Allocates an uninitialized array.
+	/// </summary>
+	template <typename T> T* AllocateArray(size_t unCount)
+	{
+		return (T*)Allocate(sizeof(T) * unCount, alignof(T));
+	}
+
+	/// <summary>
+	/// Current position.
+	/// </summary>
+	Marker GetMarker() const
+	{
+		Marker sMarker = { m_unBlock, m_unOffset, m_sStats.unFrameBytes };
+		return sMarker;
+	}
+
+	/// <summary>
+	/// Frees everything allocated after the marker was taken.
+	/// Rewinding the outermost scope merges the blocks if they did not fit into a single one.
+	/// </summary>
+	void Rewind(const Marker& sMarker)
+	{
+		if (m_bPoison)
+		{
+			for (size_t unI = sMarker.unBlock; (unI <= m_unBlock) && (unI < m_asBlocks.size()); unI++)
+			{
+				size_t unFrom = (unI == sMarker.unBlock) ? sMarker.unOffset : 0;
+				size_t unTo = (unI == m_unBlock) ? m_unOffset : m_asBlocks[unI].unSize;
+				if (unTo > unFrom) memset(m_asBlocks[unI].pData + unFrom, 0xCD, unTo - unFrom);
+			}
+		}
+		m_unBlock = sMarker.unBlock;
+		m_unOffset = sMarker.unOffset;
+		m_sStats.unFrameBytes = sMarker.unFrameBytes;
+
+		if ((!m_unBlock) && (!m_unOffset) && (m_asBlocks.size() > 1))
+		{
+			size_t unSize = m_sStats.unPeakBytes > m_unBlockSize ? m_sStats.unPeakBytes : m_unBlockSize;
+			for (size_t unI = 0; unI < m_asBlocks.size(); unI++)
+				free(m_asBlocks[unI].pData);
+			m_asBlocks.clear();
+			m_sStats.unCapacity = 0;
+			m_unBlockSize = unSize + (unSize >> 2);
+		}
+	}
+
+	/// <summary>
+	/// Enables memory poisoning on rewind.
+	/// </summary>
+	void SetPoison(bool bPoison) { m_bPoison = bPoison; }
+
+	/// <summary>
+	/// Allocation counters.
+	/// </summary>
+	const Stats& GetStats() const { return m_sStats; }
+
+private:
+	/// <summary>
+	/// A memory block.
+	/// </summary>
+	struct Block
+	{
+		uint8_t* pData;
+		size_t unSize;
+	};
+
+	/// <summary>
+	/// Appends a block and makes it current.
+	/// </summary>
+	bool AddBlock(size_t unMinSize)
+	{
+		size_t unSize = (unMinSize > m_unBlockSize) ? unMinSize : m_unBlockSize;
+		Block sBlock = { (uint8_t*)malloc(unSize), unSize };
+		if (!sBlock.pData) return false;
+		if (m_bPoison) memset(sBlock.pData, 0xCD, unSize);
+
+		// frame bytes count the skipped tail of the former block
+		if (m_unBlock < m_asBlocks.size())
+			m_sStats.unFrameBytes += m_asBlocks[m_unBlock].unSize - m_unOffset;
+		m_asBlocks.push_back(sBlock);
+		m_unBlock = m_asBlocks.size() - 1;
+		m_unOffset = 0;
+		m_sStats.unHeapAllocations++;
+		m_sStats.unCapacity += unSize;
+		return true;
+	}
+
+	/// <summary>
+	/// Memory blocks.
+	/// </summary>
+	std::vector<Block> m_asBlocks;
+	/// <summary>
+	/// Size of new blocks.
+	/// </summary>
+	size_t m_unBlockSize;
+	/// <summary>
+	/// Current block and offset.
+	/// </summary>
+	size_t m_unBlock, m_unOffset;
+	/// <summary>
+	/// True if freed memory is poisoned.
+	/// </summary>
+	bool m_bPoison;
+	/// <summary>
+	/// Allocation counters.
+	/// </summary>
+	Stats m_sStats;
+};
+
+/// <summary>
+/// STL allocator on a VireioFrameArena.
+/// Deallocation is a no-op, the memory returns on arena rewind.
+/// The container must not outlive the arena scope.
+/// </summary>
+template <typename T> class VireioArenaAllocator
+{
+public:
+	typedef T value_type;
+
+	VireioArenaAllocator(VireioFrameArena& cArena) : m_pcArena(&cArena) {}
+	template <typename U> VireioArenaAllocator(const VireioArenaAllocator<U>& cOther) : m_pcArena(cOther.GetArena()) {}
+
+	T* allocate(size_t unCount)
+	{
+		T* p = m_pcArena->AllocateArray<T>(unCount);
+		if (!p) throw std::bad_alloc();
+		return p;
+	}
+	void deallocate(T*, size_t) {}
+
+	template <typename U> struct rebind { typedef VireioArenaAllocator<U> other; };
+
+	VireioFrameArena* GetArena() const { return m_pcArena; }
+
+private:
+	VireioFrameArena* m_pcArena;
+};
+
+template <typename T, typename U> bool operator==(const VireioArenaAllocator<T>& cA, const VireioArenaAllocator<U>& cB) { return cA.GetArena() == cB.GetArena(); }
+template <typename T, typename U> bool operator!=(const VireioArenaAllocator<T>& cA, const VireioArenaAllocator<U>& cB) { return cA.GetArena() != cB.GetArena(); }
+
+#endif
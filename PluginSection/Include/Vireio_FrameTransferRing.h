@@ -0,0 +1,211 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <Vireio_FrameTransferRing.h> :
+Copyright (C) 2020 Denis Reischl
+
+
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+v2.0.4 onwards 2014 by Grant Bagwell, Simon Brown and Neil Schneider
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown and Neil Schneider
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+#ifndef VIREIO_FRAME_TRANSFER_RING
+#define VIREIO_FRAME_TRANSFER_RING
+
+/// <summary>
+/// Pacing logic for pipelined GPU readbacks.
+/// The readback of frame N is issued to a ring slot and consumed at frame
+/// N + latency earliest. A readback not finished in time stays in the ring
+/// until its slot gets reused (then it is dropped), the consumer never waits.
+/// Holds no API resources, the owner keeps one staging resource per slot and
+/// performs the actual copy/lock in the Consume() callback.
+/// Usage per frame : Issue() -> copy to slot, Consume() -> try lock, EndFrame().
+/// </summary>
+class VireioFrameTransferRing
+{
+public:
+	/// <summary>
+	/// Maximum latency in frames.
+	/// </summary>
+	static const unsigned MAX_LATENCY = 6;
+	/// <summary>
+	/// Maximum number of ring slots, one spare slot allows a late readback to be consumed a frame later.
+	/// </summary>
+	static const unsigned MAX_SLOTS = MAX_LATENCY + 2;
+
+	/// <summary>
+	/// Transfer statistics.
+	/// </summary>
+	struct Stats
+	{
+		unsigned long long unIssued;     /**< Readbacks issued. **/
+		unsigned long long unConsumed;   /**< Readbacks consumed. **/
+		unsigned long long unDropped;    /**< Readbacks overwritten or skipped before being consumed. **/
+		unsigned long long unBusy;       /**< Consume() calls where no readback was ready. **/
+		unsigned long long unLatencySum; /**< Sum of frames between issue and consumption. **/
+	};
+
+	/// <summary>
+	/// Constructor.
+	/// @param unLatency Frames between issuing a readback and consuming it, 0 = synchronous.
+	/// </summary>
+	VireioFrameTransferRing(unsigned unLatency = 1)
+	{
+		SetLatency(unLatency);
+	}
+
+	/// <summary>
+	/// Sets the latency, clamped to MAX_LATENCY. Resets the ring.
+	/// </summary>
+	void SetLatency(unsigned unLatency)
+	{
+		m_unLatency = (unLatency > MAX_LATENCY) ? MAX_LATENCY : unLatency;
+		Reset();
+	}
+
+	/// <summary>
+	/// Latency in frames.
+	/// </summary>
+	unsigned GetLatency() const { return m_unLatency; }
+
+	/// <summary>
+	/// Number of ring slots in use, the owner needs a staging resource for each.
+	/// </summary>
+	unsigned GetSlotCount() const { return m_unLatency + 2; }
+
+	/// <summary>
+	/// Clears all pending readbacks and the statistics.
+	/// Call whenever the staging resources are (re)created.
+	/// </summary>
+	void Reset()
+	{
+		m_unFrame = 0;
+		for (unsigned unI = 0; unI < MAX_SLOTS; unI++)
+		{
+			m_asSlots[unI].unFrame = 0;
+			m_asSlots[unI].bPending = false;
+		}
+		m_sStats = {};
+	}
+
+	/// <summary>
+	/// Reserves the slot for the readback of the current frame.
+	/// An unconsumed readback still in this slot is dropped.
+	/// @returns The slot index to issue the readback to.
+	/// </summary>
+	unsigned Issue()
+	{
+		unsigned unSlot = (unsigned)(m_unFrame % GetSlotCount());
+		if (m_asSlots[unSlot].bPending) m_sStats.unDropped++;
+		m_asSlots[unSlot].unFrame = m_unFrame;
+		m_asSlots[unSlot].bPending = true;
+		m_sStats.unIssued++;
+		return unSlot;
+	}
+
+	/// <summary>
+	/// Consumes the newest readback that is due (issued at least latency frames ago)
+	/// and ready. Due readbacks are tried newest first, the callback returns false
+	/// if the slot is still busy (D3DLOCK_DONOTWAIT et al.). Older pending readbacks
+	/// are dropped on success.
+	/// @param fnTryRead bool(unsigned unSlot), reads the slot if ready.
+	/// @returns True if a readback was consumed this frame.
+	/// </summary>
+	template <typename T> bool Consume(T fnTryRead)
+	{
+		for (unsigned unAge = m_unLatency; unAge < GetSlotCount(); unAge++)
+		{
+			if (unAge > m_unFrame) break;
+			unsigned unSlot = (unsigned)((m_unFrame - unAge) % GetSlotCount());
+			if ((!m_asSlots[unSlot].bPending) || (m_asSlots[unSlot].unFrame != m_unFrame - unAge)) continue;
+
+			if (fnTryRead(unSlot))
+			{
+				m_asSlots[unSlot].bPending = false;
+				m_sStats.unConsumed++;
+				m_sStats.unLatencySum += unAge;
+
+				// older readbacks are obsolete now
+				for (unsigned unI = 0; unI < GetSlotCount(); unI++)
+				{
+					if ((m_asSlots[unI].bPending) && (m_asSlots[unI].unFrame < m_unFrame - unAge))
+					{
+						m_asSlots[unI].bPending = false;
+						m_sStats.unDropped++;
+					}
+				}
+				return true;
+			}
+		}
+		m_sStats.unBusy++;
+		return false;
+	}
+
+	/// <summary>
+	/// Advances to the next frame.
+	/// </summary>
+	void EndFrame() { m_unFrame++; }
+
+	/// <summary>
+	/// Transfer statistics since the last reset.
+	/// </summary>
+	const Stats& GetStats() const { return m_sStats; }
+
+	/// <summary>
+	/// Average frames between issuing and consuming a readback.
+	/// </summary>
+	float GetAverageLatency() const
+	{
+		if (!m_sStats.unConsumed) return 0.0f;
+		return (float)((double)m_sStats.unLatencySum / (double)m_sStats.unConsumed);
+	}
+
+private:
+	/// <summary>
+	/// A ring slot.
+	/// </summary>
+	struct Slot
+	{
+		unsigned long long unFrame; /**< Frame the readback in this slot was issued. **/
+		bool bPending;              /**< True if issued and not yet consumed. **/
+	};
+
+	/// <summary>
+	/// Ring slots, GetSlotCount() in use.
+	/// </summary>
+	Slot m_asSlots[MAX_SLOTS];
+	/// <summary>
+	/// Current frame index.
+	/// </summary>
+	unsigned long long m_unFrame;
+	/// <summary>
+	/// Frames between issuing and consuming.
+	/// </summary>
+	unsigned m_unLatency;
+	/// <summary>
+	/// Transfer statistics.
+	/// </summary>
+	Stats m_sStats;
+};
+
+#endif
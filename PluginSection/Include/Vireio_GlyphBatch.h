@@ -0,0 +1,156 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <Vireio_GlyphBatch.h> :
+Copyright (C) 2020 Denis Reischl
+
+
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+v2.0.4 onwards 2014 by Grant Bagwell, Simon Brown and Neil Schneider
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown and Neil Schneider
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+#ifndef VIREIO_GLYPH_BATCH
+#define VIREIO_GLYPH_BATCH
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/// <summary>
+/// Shape of a single glyph, one per ascii code.
+/// Dimensions are in text space (font size 128 = 1.0).
+/// </summary>
+struct GlyphShape
+{
+	float fULeft;    /**< Texture left **/
+	float fVTop;     /**< Texture top **/
+	float fURight;   /**< Texture right **/
+	float fVBottom;  /**< Texture bottom **/
+	float fWidth;    /**< Quad width **/
+	float fHeight;   /**< Quad height **/
+	float fYOffset;  /**< Vertical offset of the quad bottom **/
+	float fXAdvance; /**< Cursor advance, negative (text runs along -x) **/
+};
+
+/// <summary>
+/// Per instance glyph data.
+/// Matches the per instance elements (TEXCOORD1..3) of the text vertex shader.
+/// </summary>
+struct GlyphInstance
+{
+	float afTranslate4[4]; /**< Glyph origin xyz, w unused **/
+	float afShape4[4];     /**< Width, height, vertical offset, unused **/
+	float afUV4[4];        /**< Texture left, top, right, bottom **/
+};
+
+/// <summary>
+/// CPU side text layout for the Vireio font.
+/// Turns strings into a glyph instance stream, the font draws the whole
+/// stream with a single instanced draw call. Holds no D3D resources.
+/// </summary>
+class VireioGlyphBatch
+{
+public:
+	VireioGlyphBatch() : m_pasShapes(nullptr) {}
+
+	/// <summary>
+	/// Sets the glyph shape table.
+	/// @param pasShapes 256 glyph shapes indexed by ascii code, must outlive the batch.
+	/// </summary>
+	void SetShapes(const GlyphShape* pasShapes) { m_pasShapes = pasShapes; }
+
+	/// <summary>
+	/// Measures the text width.
+	/// @returns The text width in text space (negative, text runs along -x).
+	/// </summary>
+	float Measure(const char* szText) const
+	{
+		float fWidth = 0.0f;
+		if (!m_pasShapes) return fWidth;
+		for (const unsigned char* pch = (const unsigned char*)szText; *pch; pch++)
+			fWidth += m_pasShapes[*pch].fXAdvance;
+		return fWidth;
+	}
+
+	/// <summary>
+	/// Lays out a string and appends its glyphes to the instance stream.
+	/// Glyphes without extent (space, unknown characters) only advance the cursor.
+	/// @returns The number of instances added.
+	/// </summary>
+	uint32_t AddText(const char* szText, float fX, float fY, float fZ)
+	{
+		if (!m_pasShapes) return 0;
+
+		size_t nStart = m_asInstances.size();
+		float fXTranslate = fX;
+		for (const unsigned char* pch = (const unsigned char*)szText; *pch; pch++)
+		{
+			const GlyphShape& sShape = m_pasShapes[*pch];
+			fXTranslate += sShape.fXAdvance;
+			if ((sShape.fWidth == 0.0f) || (sShape.fHeight == 0.0f)) continue;
+
+			GlyphInstance sInstance;
+			sInstance.afTranslate4[0] = fXTranslate;
+			sInstance.afTranslate4[1] = fY;
+			sInstance.afTranslate4[2] = fZ;
+			sInstance.afTranslate4[3] = 1.0f;
+			sInstance.afShape4[0] = sShape.fWidth;
+			sInstance.afShape4[1] = sShape.fHeight;
+			sInstance.afShape4[2] = sShape.fYOffset;
+			sInstance.afShape4[3] = 0.0f;
+			sInstance.afUV4[0] = sShape.fULeft;
+			sInstance.afUV4[1] = sShape.fVTop;
+			sInstance.afUV4[2] = sShape.fURight;
+			sInstance.afUV4[3] = sShape.fVBottom;
+			m_asInstances.push_back(sInstance);
+		}
+		return (uint32_t)(m_asInstances.size() - nStart);
+	}
+
+	/// <summary>
+	/// Clears the instance stream, keeps the capacity.
+	/// </summary>
+	void Clear() { m_asInstances.clear(); }
+
+	/// <summary>
+	/// The instance stream.
+	/// </summary>
+	const GlyphInstance* GetInstances() const { return m_asInstances.size() ? &m_asInstances[0] : nullptr; }
+
+	/// <summary>
+	/// Number of instances in the stream.
+	/// </summary>
+	uint32_t GetInstanceCount() const { return (uint32_t)m_asInstances.size(); }
+
+private:
+	/// <summary>
+	/// Glyph shapes (256) indexed by ascii code.
+	/// </summary>
+	const GlyphShape* m_pasShapes;
+	/// <summary>
+	/// Glyph instances, reused every frame.
+	/// </summary>
+	std::vector<GlyphInstance> m_asInstances;
+};
+
+#endif
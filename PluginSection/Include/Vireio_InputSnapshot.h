@@ -0,0 +1,274 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <Vireio_InputSnapshot.h> :
+Copyright (C) 2020 Denis Reischl
+
+
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+v2.0.4 onwards 2014 by Grant Bagwell, Simon Brown and Neil Schneider
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown and Neil Schneider
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+#ifndef VIREIO_INPUT_SNAPSHOT
+#define VIREIO_INPUT_SNAPSHOT
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+/// <summary>
+/// Raw input state of a single frame.
+/// Keys are indexed by virtual key code, controller fields follow XINPUT_GAMEPAD.
+/// </summary>
+struct VireioInputState
+{
+	uint32_t aunKeys[8];      /**< Key down bits, 256 virtual key codes **/
+	uint16_t unButtons;       /**< Controller buttons (XINPUT_GAMEPAD_...) **/
+	uint8_t unTriggerLeft;    /**< Left trigger **/
+	uint8_t unTriggerRight;   /**< Right trigger **/
+	int16_t nThumbLX;         /**< Left thumb x **/
+	int16_t nThumbLY;         /**< Left thumb y **/
+	int16_t nThumbRX;         /**< Right thumb x **/
+	int16_t nThumbRY;         /**< Right thumb y **/
+	bool bControllerAttached; /**< True if controller 0 is attached **/
+
+	/// <summary>
+	/// Sets a key down bit.
+	/// </summary>
+	void SetKey(uint8_t unKey, bool bDown)
+	{
+		if (bDown) aunKeys[unKey >> 5] |= (1u << (unKey & 31)); else aunKeys[unKey >> 5] &= ~(1u << (unKey & 31));
+	}
+
+	/// <summary>
+	/// True if the key is down.
+	/// </summary>
+	bool GetKey(uint8_t unKey) const { return (aunKeys[unKey >> 5] & (1u << (unKey & 31))) != 0; }
+};
+
+/// <summary>
+/// Input source, polls the device state.
+/// Implemented by the platform (see VireioInputSourceWin32) or by a
+/// scripted source to replay input.
+/// </summary>
+class VireioInputSource
+{
+public:
+	virtual ~VireioInputSource() {}
+
+	/// <summary>
+	/// Polls the device state.
+	/// @param aunKeys The bound virtual key codes, only these need to be polled.
+	/// @param sState The state to be filled, zeroed by the caller.
+	/// </summary>
+	virtual void Poll(const std::vector<uint8_t>& aunKeys, VireioInputState& sState) = 0;
+};
+
+/// <summary>
+/// Per frame input snapshot.
+/// Taken once per frame by the Stereo Presenter and handed to all nodes
+/// by the "Input" plug, so no node polls the OS itself. Keys have to be
+/// bound before they are polled, usually when the plug gets connected.
+/// A key bound mid frame reports its state from the next update on.
+/// </summary>
+class VireioInputSnapshot
+{
+public:
+	VireioInputSnapshot() : m_unTimeMs(0), m_unFrame(0)
+	{
+		memset(&m_sCurrent, 0, sizeof(VireioInputState));
+		memset(&m_sPrevious, 0, sizeof(VireioInputState));
+		memset(&m_aunBound[0], 0, sizeof(m_aunBound));
+		memset(&m_aunKeyDownMs[0], 0, sizeof(m_aunKeyDownMs));
+		memset(&m_aunButtonDownMs[0], 0, sizeof(m_aunButtonDownMs));
+	}
+
+	/// <summary>
+	/// Binds a virtual key code, a key bound twice is polled once.
+	/// </summary>
+	void Bind(uint8_t unKey)
+	{
+		if (m_aunBound[unKey >> 5] & (1u << (unKey & 31))) return;
+		m_aunBound[unKey >> 5] |= (1u << (unKey & 31));
+		m_aunKeys.push_back(unKey);
+	}
+
+	/// <summary>
+	/// Takes the snapshot for a new frame.
+	/// @param cSource The input source.
+	/// @param unTimeMs The current time in milliseconds.
+	/// </summary>
+	void Update(VireioInputSource& cSource, uint32_t unTimeMs)
+	{
+		m_sPrevious = m_sCurrent;
+		memset(&m_sCurrent, 0, sizeof(VireioInputState));
+		cSource.Poll(m_aunKeys, m_sCurrent);
+		m_unTimeMs = unTimeMs;
+		m_unFrame++;
+
+		// set the down time for new presses
+		for (size_t unI = 0; unI < m_aunKeys.size(); unI++)
+		{
+			uint8_t unKey = m_aunKeys[unI];
+			if (m_sCurrent.GetKey(unKey) && !m_sPrevious.GetKey(unKey))
+				m_aunKeyDownMs[unKey] = unTimeMs;
+		}
+		uint16_t unPressed = m_sCurrent.unButtons & ~m_sPrevious.unButtons;
+		for (unsigned unI = 0; unPressed; unI++, unPressed >>= 1)
+			if (unPressed & 1) m_aunButtonDownMs[unI] = unTimeMs;
+	}
+
+	/// <summary>
+	/// True if the key is down.
+	/// </summary>
+	bool IsDown(uint8_t unKey) const { return m_sCurrent.GetKey(unKey); }
+
+	/// <summary>
+	/// True if the key went down this frame.
+	/// </summary>
+	bool IsPressed(uint8_t unKey) const { return m_sCurrent.GetKey(unKey) && !m_sPrevious.GetKey(unKey); }
+
+	/// <summary>
+	/// True if the key went up this frame.
+	/// </summary>
+	bool IsReleased(uint8_t unKey) const { return !m_sCurrent.GetKey(unKey) && m_sPrevious.GetKey(unKey); }
+
+	/// <summary>
+	/// True if the key is down for at least the given time.
+	/// </summary>
+	bool IsHeld(uint8_t unKey, uint32_t unMs) const { return m_sCurrent.GetKey(unKey) && ((m_unTimeMs - m_aunKeyDownMs[unKey]) >= unMs); }
+
+	/// <summary>
+	/// True if all buttons in the mask (XINPUT_GAMEPAD_...) are down.
+	/// </summary>
+	bool IsButtonDown(uint16_t unMask) const { return (m_sCurrent.unButtons & unMask) == unMask; }
+
+	/// <summary>
+	/// True if all buttons in the mask are down and at least one of them went down this frame.
+	/// </summary>
+	bool IsButtonPressed(uint16_t unMask) const { return IsButtonDown(unMask) && ((m_sPrevious.unButtons & unMask) != unMask); }
+
+	/// <summary>
+	/// True if all buttons in the mask were down last frame and at least one of them is up now.
+	/// </summary>
+	bool IsButtonReleased(uint16_t unMask) const { return ((m_sPrevious.unButtons & unMask) == unMask) && !IsButtonDown(unMask); }
+
+	/// <summary>
+	/// True if all buttons in the mask are down for at least the given time.
+	/// </summary>
+	bool IsButtonHeld(uint16_t unMask, uint32_t unMs) const
+	{
+		if (!unMask || !IsButtonDown(unMask)) return false;
+		for (unsigned unI = 0; unI < 16; unI++)
+			if ((unMask & (1u << unI)) && ((m_unTimeMs - m_aunButtonDownMs[unI]) < unMs)) return false;
+		return true;
+	}
+
+	/// <summary>
+	/// The raw state of this frame (thumbs, triggers).
+	/// </summary>
+	const VireioInputState& GetState() const { return m_sCurrent; }
+
+	/// <summary>
+	/// Time of the snapshot in milliseconds.
+	/// </summary>
+	uint32_t GetTime() const { return m_unTimeMs; }
+
+	/// <summary>
+	/// Snapshot index, incremented each update. Nodes provoked more than once
+	/// per frame use this to handle edges only once.
+	/// </summary>
+	uint64_t GetFrame() const { return m_unFrame; }
+
+private:
+	/// <summary>
+	/// Current and previous frame state.
+	/// </summary>
+	VireioInputState m_sCurrent, m_sPrevious;
+	/// <summary>
+	/// Bound key bits and the bound key list (polling order).
+	/// </summary>
+	uint32_t m_aunBound[8];
+	std::vector<uint8_t> m_aunKeys;
+	/// <summary>
+	/// Time the keys and buttons went down.
+	/// </summary>
+	uint32_t m_aunKeyDownMs[256];
+	uint32_t m_aunButtonDownMs[16];
+	/// <summary>
+	/// Snapshot time and index.
+	/// </summary>
+	uint32_t m_unTimeMs;
+	uint64_t m_unFrame;
+};
+
+#ifdef _WIN32
+#include <windows.h>
+#include <XInput.h>
+
+/// <summary>
+/// Windows input source, keyboard by GetAsyncKeyState(), controller 0 by XInput.
+/// XInputGetState() on an unplugged controller is expensive, a missing
+/// controller is only looked up again every RETRY_MS.
+/// </summary>
+class VireioInputSourceWin32 : public VireioInputSource
+{
+public:
+	static const DWORD RETRY_MS = 1000;
+
+	VireioInputSourceWin32() : m_bControllerAttached(true), m_dwRetryTick(0) {}
+
+	virtual void Poll(const std::vector<uint8_t>& aunKeys, VireioInputState& sState)
+	{
+		for (size_t unI = 0; unI < aunKeys.size(); unI++)
+			sState.SetKey(aunKeys[unI], (GetAsyncKeyState((int)aunKeys[unI]) & 0x8000) != 0);
+
+		if ((!m_bControllerAttached) && ((GetTickCount() - m_dwRetryTick) < RETRY_MS)) return;
+
+		XINPUT_STATE sControllerState = {};
+		m_bControllerAttached = (XInputGetState(0, &sControllerState) == ERROR_SUCCESS);
+		if (!m_bControllerAttached)
+			m_dwRetryTick = GetTickCount();
+		else
+		{
+			sState.bControllerAttached = true;
+			sState.unButtons = sControllerState.Gamepad.wButtons;
+			sState.unTriggerLeft = sControllerState.Gamepad.bLeftTrigger;
+			sState.unTriggerRight = sControllerState.Gamepad.bRightTrigger;
+			sState.nThumbLX = sControllerState.Gamepad.sThumbLX;
+			sState.nThumbLY = sControllerState.Gamepad.sThumbLY;
+			sState.nThumbRX = sControllerState.Gamepad.sThumbRX;
+			sState.nThumbRY = sControllerState.Gamepad.sThumbRY;
+		}
+	}
+
+private:
+	/// <summary>
+	/// Controller state of the last lookup and the tick it failed.
+	/// </summary>
+	bool m_bControllerAttached;
+	DWORD m_dwRetryTick;
+};
+#endif
+
+#endif
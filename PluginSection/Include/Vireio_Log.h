@@ -0,0 +1,508 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <Vireio_Log.h> :
+Copyright (C) 2020 Denis Reischl
+
+
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+v2.0.4 onwards 2014 by Grant Bagwell, Simon Brown and Neil Schneider
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown and Neil Schneider
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+#ifndef VIREIO_LOG
+#define VIREIO_LOG
+
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/// <summary>
+/// Log levels. Messages above VIREIO_LOG_LEVEL are compiled out.
+/// </summary>
+#define VIREIO_LOG_LEVEL_NONE    0
+#define VIREIO_LOG_LEVEL_ERROR   1
+#define VIREIO_LOG_LEVEL_WARNING 2
+#define VIREIO_LOG_LEVEL_INFO    3
+#define VIREIO_LOG_LEVEL_DEBUG   4
+
+#ifndef VIREIO_LOG_LEVEL
+#ifdef _DEBUG
+#define VIREIO_LOG_LEVEL VIREIO_LOG_LEVEL_DEBUG
+#else
+#define VIREIO_LOG_LEVEL VIREIO_LOG_LEVEL_INFO
+#endif
+#endif
+
+/// <summary>
+/// Asynchronous log for the render thread.
+/// Callers only format the message and push it to a lock free ring, a
+/// background thread writes it (OutputDebugString by default). Each call
+/// site (identified by its format string) may emit RATE_BURST messages
+/// per RATE_WINDOW_MS, repeats of the same text are collapsed. Suppressed
+/// messages are counted and reported with the next message of the site.
+/// A full ring drops the message, callers never wait. Messages longer
+/// than MESSAGE_SIZE are queued in several entries (parts of messages of
+/// different threads may interleave).
+/// One log per module (plugin dll), created on first use. The writer
+/// thread starts with the first message and must be stopped by
+/// Shutdown() before the module is unloaded, the host calls the exported
+/// Vireio_Log_Shutdown() before FreeLibrary (see NOD_Plugin). A message
+/// logged after Shutdown() starts the writer again.
+/// </summary>
+class VireioLog
+{
+public:
+	/// <summary>
+	/// Ring size in messages, the drop threshold.
+	/// </summary>
+	static const uint32_t RING_SIZE = 1024;
+	/// <summary>
+	/// Maximum length of a ring entry, longer messages are split.
+	/// </summary>
+	static const uint32_t MESSAGE_SIZE = 248;
+	/// <summary>
+	/// Number of tracked call sites, sites beyond share the rate limit of a colliding entry.
+	/// </summary>
+	static const uint32_t SITE_NUMBER = 256;
+	/// <summary>
+	/// Messages per site and window.
+	/// </summary>
+	static const uint32_t RATE_BURST = 8;
+	static const uint32_t RATE_WINDOW_MS = 1000;
+
+	/// <summary>
+	/// Log counters.
+	/// </summary>
+	struct Stats
+	{
+		uint64_t unQueued;     /**< Messages queued. **/
+		uint64_t unWritten;    /**< Messages written by the writer thread. **/
+		uint64_t unSuppressed; /**< Messages suppressed by rate limit or deduplication. **/
+		uint64_t unDropped;    /**< Messages dropped, ring full. **/
+	};
+
+	/// <summary>
+	/// Output function, called on the writer thread.
+	/// </summary>
+	typedef void(*SinkFunction)(int nLevel, const char* szMessage);
+
+	/// <summary>
+	/// The log of this module.
+	/// </summary>
+	static VireioLog& Get()
+	{
+		static VireioLog* s_pcLog = new VireioLog();
+		return *s_pcLog;
+	}
+
+	/// <summary>
+	/// Logs a message.
+	/// @param pSite Call site key, usually the format string literal. Null disables rate limiting.
+	/// </summary>
+	void Write(int nLevel, const void* pSite, const char* szFormat, ...)
+	{
+		va_list sArgs;
+		va_start(sArgs, szFormat);
+		WriteV(nLevel, pSite, szFormat, sArgs);
+		va_end(sArgs);
+	}
+
+	/// <summary>
+	/// Logs a message, see Write().
+	/// </summary>
+	void WriteV(int nLevel, const void* pSite, const char* szFormat, va_list sArgs)
+	{
+		uint32_t unNow = GetTimeMs();
+		Site* psSite = pSite ? &m_asSites[SiteIndex(pSite)] : nullptr;
+
+		// rate limit, cheap test before formatting
+		if (psSite)
+		{
+			uint32_t unWindow = psSite->unWindowMs.load(std::memory_order_relaxed);
+			if ((unNow - unWindow) >= RATE_WINDOW_MS)
+			{
+				if (psSite->unWindowMs.compare_exchange_strong(unWindow, unNow, std::memory_order_relaxed))
+				{
+					psSite->unCount.store(0, std::memory_order_relaxed);
+					psSite->unLastHash.store(0, std::memory_order_relaxed);
+				}
+			}
+			if (psSite->unCount.fetch_add(1, std::memory_order_relaxed) >= RATE_BURST)
+			{
+				Suppress(psSite);
+				return;
+			}
+		}
+
+		char szMessage[MESSAGE_SIZE];
+		va_list sArgsLong;
+		va_copy(sArgsLong, sArgs);
+		int nLength = vsnprintf(szMessage, MESSAGE_SIZE, szFormat, sArgs);
+		if (nLength < 0)
+		{
+			va_end(sArgsLong);
+			return;
+		}
+
+		// long message, formatted again in full
+		const char* szText = szMessage;
+		std::vector<char> acLong;
+		if (nLength >= (int)MESSAGE_SIZE)
+		{
+			acLong.resize((size_t)nLength + 1);
+			vsnprintf(&acLong[0], acLong.size(), szFormat, sArgsLong);
+			szText = &acLong[0];
+		}
+		va_end(sArgsLong);
+
+		// deduplicate, same text as the last message of the site within the window
+		if (psSite)
+		{
+			uint32_t unHash = Hash(szText);
+			if (psSite->unLastHash.exchange(unHash, std::memory_order_relaxed) == unHash)
+			{
+				Suppress(psSite);
+				return;
+			}
+		}
+
+		// one entry per MESSAGE_SIZE - 1 characters, the last one reports the suppressed messages
+		uint32_t unSuppressed = psSite ? psSite->unSuppressed.exchange(0, std::memory_order_relaxed) : 0;
+		uint32_t unOffset = 0;
+		do
+		{
+			uint32_t unLength = (uint32_t)nLength - unOffset;
+			if (unLength > MESSAGE_SIZE - 1) unLength = MESSAGE_SIZE - 1;
+			bool bLast = (unOffset + unLength) == (uint32_t)nLength;
+			Push(nLevel, szText + unOffset, unLength, bLast ? unSuppressed : 0);
+			unOffset += unLength;
+		} while (unOffset < (uint32_t)nLength);
+	}
+
+	/// <summary>
+	/// Sets the output function, null restores the default.
+	/// </summary>
+	void SetSink(SinkFunction fnSink) { m_fnSink.store(fnSink ? fnSink : DefaultSink); }
+
+	/// <summary>
+	/// Stops and joins the writer thread, queued messages are written first.
+	/// Never call this under the loader lock (DllMain), the join would dead lock.
+	/// </summary>
+	void Shutdown()
+	{
+		std::lock_guard<std::mutex> cLock(m_cWriterMutex);
+		if (!m_bWriterStarted.load(std::memory_order_acquire)) return;
+		m_bStop.store(true, std::memory_order_release);
+		if (m_cWriter.joinable()) m_cWriter.join();
+		m_bStop.store(false, std::memory_order_relaxed);
+		m_bWriterStarted.store(false, std::memory_order_release);
+	}
+
+	/// <summary>
+	/// Waits until all queued messages are written.
+	/// </summary>
+	void Flush()
+	{
+		while (m_unWritten.load() < m_unQueued.load())
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+
+	/// <summary>
+	/// Log counters.
+	/// </summary>
+	Stats GetStats() const
+	{
+		Stats sStats;
+		sStats.unQueued = m_unQueued.load();
+		sStats.unWritten = m_unWritten.load();
+		sStats.unSuppressed = m_unSuppressed.load();
+		sStats.unDropped = m_unDropped.load();
+		return sStats;
+	}
+
+private:
+	/// <summary>
+	/// Ring slot, sequence handshake of a bounded MPMC queue (D. Vyukov).
+	/// </summary>
+	struct Slot
+	{
+		std::atomic<uint32_t> unSequence;
+		int nLevel;
+		uint32_t unSuppressed;
+		char szMessage[MESSAGE_SIZE];
+	};
+
+	/// <summary>
+	/// Call site state, updated without locks, limits are approximate under contention.
+	/// </summary>
+	struct Site
+	{
+		std::atomic<const void*> pKey;
+		std::atomic<uint32_t> unWindowMs;
+		std::atomic<uint32_t> unCount;
+		std::atomic<uint32_t> unLastHash;
+		std::atomic<uint32_t> unSuppressed;
+	};
+
+	VireioLog() : m_unEnqueue(0), m_unDequeue(0), m_bWriterStarted(false), m_bStop(false), m_fnSink(DefaultSink),
+		m_unQueued(0), m_unWritten(0), m_unSuppressed(0), m_unDropped(0), m_unDroppedReported(0)
+	{
+		for (uint32_t unI = 0; unI < RING_SIZE; unI++)
+			m_asRing[unI].unSequence.store(unI, std::memory_order_relaxed);
+		for (uint32_t unI = 0; unI < SITE_NUMBER; unI++)
+		{
+			m_asSites[unI].pKey.store(nullptr, std::memory_order_relaxed);
+			m_asSites[unI].unWindowMs.store(GetTimeMs(), std::memory_order_relaxed);
+			m_asSites[unI].unCount.store(0, std::memory_order_relaxed);
+			m_asSites[unI].unLastHash.store(0, std::memory_order_relaxed);
+			m_asSites[unI].unSuppressed.store(0, std::memory_order_relaxed);
+		}
+	}
+
+	/// <summary>
+	/// Queues a message, drops it if the ring is full.
+	/// </summary>
+	void Push(int nLevel, const char* szMessage, uint32_t unLength, uint32_t unSuppressed)
+	{
+		// start the writer on first use (or first use after Shutdown())
+		if (!m_bWriterStarted.load(std::memory_order_acquire))
+		{
+			std::lock_guard<std::mutex> cLock(m_cWriterMutex);
+			if (!m_bWriterStarted.load(std::memory_order_relaxed))
+			{
+				m_cWriter = std::thread(&VireioLog::WriterLoop, this);
+				m_bWriterStarted.store(true, std::memory_order_release);
+			}
+		}
+
+		uint32_t unPos = m_unEnqueue.load(std::memory_order_relaxed);
+		Slot* psSlot;
+		for (;;)
+		{
+			psSlot = &m_asRing[unPos & (RING_SIZE - 1)];
+			int32_t nDiff = (int32_t)(psSlot->unSequence.load(std::memory_order_acquire) - unPos);
+			if (nDiff == 0)
+			{
+				if (m_unEnqueue.compare_exchange_weak(unPos, unPos + 1, std::memory_order_relaxed)) break;
+			}
+			else if (nDiff < 0)
+			{
+				m_unDropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+			else unPos = m_unEnqueue.load(std::memory_order_relaxed);
+		}
+
+		psSlot->nLevel = nLevel;
+		psSlot->unSuppressed = unSuppressed;
+		memcpy(psSlot->szMessage, szMessage, unLength);
+		psSlot->szMessage[unLength] = 0;
+		m_unQueued.fetch_add(1, std::memory_order_relaxed);
+		psSlot->unSequence.store(unPos + 1, std::memory_order_release);
+	}
+
+	/// <summary>
+	/// Writer thread, the single consumer.
+	/// Sleeps longer the longer the ring stays empty, returns on an empty
+	/// ring once Shutdown() was called.
+	/// </summary>
+	void WriterLoop()
+	{
+		uint32_t unSleepMs = 1;
+		for (;;)
+		{
+			uint32_t unPos = m_unDequeue;
+			Slot* psSlot = &m_asRing[unPos & (RING_SIZE - 1)];
+			if (psSlot->unSequence.load(std::memory_order_acquire) != unPos + 1)
+			{
+				// report drops
+				uint64_t unDropped = m_unDropped.load(std::memory_order_relaxed);
+				if (unDropped != m_unDroppedReported)
+				{
+					char szMessage[64];
+					snprintf(szMessage, 64, "[LOG] %llu messages dropped", (unsigned long long)(unDropped - m_unDroppedReported));
+					m_unDroppedReported = unDropped;
+					(m_fnSink.load())(VIREIO_LOG_LEVEL_WARNING, szMessage);
+				}
+				if (m_bStop.load(std::memory_order_acquire)) return;
+
+				std::this_thread::sleep_for(std::chrono::milliseconds(unSleepMs));
+				if (unSleepMs < 32) unSleepMs <<= 1;
+				continue;
+			}
+			unSleepMs = 1;
+
+			char szMessage[MESSAGE_SIZE + 32];
+			if (psSlot->unSuppressed)
+				snprintf(szMessage, sizeof(szMessage), "%s (+%u suppressed)", psSlot->szMessage, psSlot->unSuppressed);
+			else
+				memcpy(szMessage, psSlot->szMessage, MESSAGE_SIZE);
+			int nLevel = psSlot->nLevel;
+
+			// hand the slot back to the producers before the (slow) output
+			psSlot->unSequence.store(unPos + RING_SIZE, std::memory_order_release);
+			m_unDequeue = unPos + 1;
+
+			(m_fnSink.load())(nLevel, szMessage);
+			m_unWritten.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	/// <summary>
+	/// Counts a suppressed message.
+	/// </summary>
+	void Suppress(Site* psSite)
+	{
+		psSite->unSuppressed.fetch_add(1, std::memory_order_relaxed);
+		m_unSuppressed.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/// <summary>
+	/// Site table index, linear probing, a full table shares the home entry.
+	/// </summary>
+	uint32_t SiteIndex(const void* pSite)
+	{
+		uint32_t unHome = (uint32_t)(((uintptr_t)pSite >> 3) * 2654435761u) & (SITE_NUMBER - 1);
+		for (uint32_t unI = 0; unI < SITE_NUMBER; unI++)
+		{
+			uint32_t unIx = (unHome + unI) & (SITE_NUMBER - 1);
+			const void* pKey = m_asSites[unIx].pKey.load(std::memory_order_relaxed);
+			if (pKey == pSite) return unIx;
+			if (!pKey)
+			{
+				if (m_asSites[unIx].pKey.compare_exchange_strong(pKey, pSite, std::memory_order_relaxed)) return unIx;
+				if (pKey == pSite) return unIx;
+			}
+		}
+		return unHome;
+	}
+
+	/// <summary>
+	/// FNV-1a, only used for deduplication.
+	/// </summary>
+	static uint32_t Hash(const char* sz)
+	{
+		uint32_t unHash = 2166136261u;
+		while (*sz) { unHash ^= (uint8_t)*sz++; unHash *= 16777619u; }
+		return unHash ? unHash : 1;
+	}
+
+	/// <summary>
+	/// Milliseconds, monotonic.
+	/// </summary>
+	static uint32_t GetTimeMs()
+	{
+		return (uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	/// <summary>
+	/// Default output, the debugger on windows, stderr elsewhere.
+	/// </summary>
+	static void DefaultSink(int nLevel, const char* szMessage)
+	{
+#ifdef _WIN32
+		OutputDebugStringA(szMessage);
+#else
+		fprintf(stderr, "%s\n", szMessage);
+#endif
+	}
+
+	/// <summary>
+	/// Message ring and positions.
+	/// </summary>
+	Slot m_asRing[RING_SIZE];
+	std::atomic<uint32_t> m_unEnqueue;
+	uint32_t m_unDequeue;
+	/// <summary>
+	/// Call sites.
+	/// </summary>
+	Site m_asSites[SITE_NUMBER];
+	/// <summary>
+	/// Writer thread, guarded by the writer mutex.
+	/// </summary>
+	std::thread m_cWriter;
+	std::mutex m_cWriterMutex;
+	/// <summary>
+	/// True if the writer thread runs.
+	/// </summary>
+	std::atomic<bool> m_bWriterStarted;
+	/// <summary>
+	/// Set by Shutdown(), the writer returns once the ring is empty.
+	/// </summary>
+	std::atomic<bool> m_bStop;
+	/// <summary>
+	/// Output function.
+	/// </summary>
+	std::atomic<SinkFunction> m_fnSink;
+	/// <summary>
+	/// Counters.
+	/// </summary>
+	std::atomic<uint64_t> m_unQueued, m_unWritten, m_unSuppressed, m_unDropped;
+	uint64_t m_unDroppedReported;
+};
+
+/// <summary>
+/// Logging macros, the format string literal identifies the call site.
+/// </summary>
+#if VIREIO_LOG_LEVEL >= VIREIO_LOG_LEVEL_ERROR
+#define VIREIO_LOG_ERROR(szFormat, ...) VireioLog::Get().Write(VIREIO_LOG_LEVEL_ERROR, szFormat, szFormat, ##__VA_ARGS__)
+#else
+#define VIREIO_LOG_ERROR(szFormat, ...) ((void)0)
+#endif
+#if VIREIO_LOG_LEVEL >= VIREIO_LOG_LEVEL_WARNING
+#define VIREIO_LOG_WARNING(szFormat, ...) VireioLog::Get().Write(VIREIO_LOG_LEVEL_WARNING, szFormat, szFormat, ##__VA_ARGS__)
+#else
+#define VIREIO_LOG_WARNING(szFormat, ...) ((void)0)
+#endif
+#if VIREIO_LOG_LEVEL >= VIREIO_LOG_LEVEL_INFO
+#define VIREIO_LOG_INFO(szFormat, ...) VireioLog::Get().Write(VIREIO_LOG_LEVEL_INFO, szFormat, szFormat, ##__VA_ARGS__)
+#else
+#define VIREIO_LOG_INFO(szFormat, ...) ((void)0)
+#endif
+#if VIREIO_LOG_LEVEL >= VIREIO_LOG_LEVEL_DEBUG
+#define VIREIO_LOG_DEBUG(szFormat, ...) VireioLog::Get().Write(VIREIO_LOG_LEVEL_DEBUG, szFormat, szFormat, ##__VA_ARGS__)
+#else
+#define VIREIO_LOG_DEBUG(szFormat, ...) ((void)0)
+#endif
+
+#ifdef _WIN32
+/// <summary>
+/// Stops the writer thread of this module, called by the host right
+/// before the plugin dll is freed.
+/// </summary>
+extern "C" __declspec(dllexport) inline void Vireio_Log_Shutdown()
+{
+	VireioLog::Get().Shutdown();
+}
+#endif
+
+#endif
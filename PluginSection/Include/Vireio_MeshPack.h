@@ -0,0 +1,415 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+
+File <Vireio_MeshPack.h> :
+Copyright (C) 2020 Denis Reischl
+
+
+
+Vireio Perception Version History:
+v1.0.0 2012 by Andres Hernandez
+v1.0.X 2013 by John Hicks, Neil Schneider
+v1.1.x 2013 by Primary Coding Author: Chris Drain
+Team Support: John Hicks, Phil Larkson, Neil Schneider
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown
+v2.0.4 onwards 2014 by Grant Bagwell, Simon Brown and Neil Schneider
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown and Neil Schneider
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+********************************************************************/
+#ifndef VIREIO_MESH_PACK
+#define VIREIO_MESH_PACK
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+
+/// <summary>
+/// .vmesh file flags.
+/// </summary>
+#define VIREIO_MESH_PACK_FLAG_LZ       0x01 /**< Payload is LZ compressed (LZ4 block layout) **/
+#define VIREIO_MESH_PACK_FLAG_INDEX32  0x02 /**< Indices are 32 bit, 16 bit otherwise **/
+
+/// <summary>
+/// Decoded mesh vertex.
+/// Same layout as ovrAvatarMeshVertex, can be copied into the vertex buffer as is.
+/// </summary>
+struct VireioMeshVertex
+{
+	float fX, fY, fZ;                /**< Position **/
+	float fNX, fNY, fNZ;             /**< Normal **/
+	float fTX, fTY, fTZ, fTW;        /**< Tangent, w = handedness **/
+	float fU, fV;                    /**< Texture coordinates **/
+	uint8_t aunBlendIndices[4];      /**< Joint indices **/
+	float afBlendWeights[4];         /**< Joint weights **/
+};
+
+/// <summary>
+/// Quantized vertex as stored in the .vmesh payload (28 bytes).
+/// Positions and uvs are 16 bit unorm within the mesh bounds, normals and
+/// tangents are octahedral 16 bit snorm, blend weights 8 bit unorm summing up to 255.
+/// </summary>
+struct VireioPackedVertex
+{
+	uint16_t aunPosition[3];
+	int16_t nTangentW;
+	int16_t anNormal[2];
+	int16_t anTangent[2];
+	uint16_t aunUV[2];
+	uint8_t aunBlendIndices[4];
+	uint8_t aunBlendWeights[4];
+};
+
+/// <summary>
+/// .vmesh file header, followed by the bind pose (unJointCount row major 4x4 float matrices)
+/// and the payload (vertices, then indices).
+/// </summary>
+struct VireioMeshPackHeader
+{
+	char acMagic[4];                 /**< "VMSH" **/
+	uint32_t unVersion;              /**< VireioMeshPack::VERSION **/
+	uint32_t unFlags;                /**< VIREIO_MESH_PACK_FLAG_ **/
+	uint32_t unVertexCount;          /**< Number of vertices **/
+	uint32_t unIndexCount;           /**< Number of indices **/
+	uint32_t unJointCount;           /**< Number of bind pose matrices **/
+	float afPositionMin[3];          /**< Position = min + quantized * scale **/
+	float afPositionScale[3];
+	float afUVMin[2];                /**< UV = min + quantized * scale **/
+	float afUVScale[2];
+	uint32_t unPayloadSize;          /**< Payload size in the file **/
+	uint32_t unRawSize;              /**< Payload size decompressed **/
+};
+
+/// <summary>
+/// Quantized binary mesh container (.vmesh).
+/// Replaces meshes compiled into the binary as initialized arrays. The file
+/// is mapped, validated on open and only decoded when the vertices are
+/// requested. Files are written by Scripts/convert_oculus_mesh.py which
+/// also reorders the indices for the post transform vertex cache and the
+/// vertices for fetch locality.
+/// Open() / Decode() do no API calls and can run on a worker thread.
+/// </summary>
+class VireioMeshPack
+{
+public:
+	/// <summary>
+	/// File version.
+	/// </summary>
+	static const uint32_t VERSION = 1;
+
+	VireioMeshPack()
+		: m_psHeader(nullptr)
+		, m_pafBindPose(nullptr)
+		, m_pchPayload(nullptr)
+#ifdef _WIN32
+		, m_hFile(INVALID_HANDLE_VALUE)
+		, m_hMapping(NULL)
+		, m_pvView(nullptr)
+#endif
+	{}
+	~VireioMeshPack() { Release(); }
+
+	/// <summary>
+	/// Validates a .vmesh file in memory, the memory must be kept until Release().
+	/// @returns False if no or a truncated .vmesh file.
+	/// </summary>
+	bool Open(const uint8_t* pchData, size_t nSize)
+	{
+		m_psHeader = nullptr;
+		m_pafBindPose = nullptr;
+		m_pchPayload = nullptr;
+		if ((!pchData) || (nSize < sizeof(VireioMeshPackHeader))) return false;
+
+		const VireioMeshPackHeader* psHeader = (const VireioMeshPackHeader*)pchData;
+		if ((memcmp(psHeader->acMagic, "VMSH", 4) != 0) || (psHeader->unVersion != VERSION)) return false;
+
+		// raw payload size must match the counts
+		uint64_t unIndexSize = (psHeader->unFlags & VIREIO_MESH_PACK_FLAG_INDEX32) ? 4 : 2;
+		uint64_t unRawSize = (uint64_t)psHeader->unVertexCount * sizeof(VireioPackedVertex) + (uint64_t)psHeader->unIndexCount * unIndexSize;
+		if (unRawSize != psHeader->unRawSize) return false;
+		if ((!(psHeader->unFlags & VIREIO_MESH_PACK_FLAG_LZ)) && (psHeader->unPayloadSize != psHeader->unRawSize)) return false;
+
+		uint64_t unOffset = sizeof(VireioMeshPackHeader);
+		uint64_t unBindPoseSize = (uint64_t)psHeader->unJointCount * 16 * sizeof(float);
+		if (unOffset + unBindPoseSize + psHeader->unPayloadSize > (uint64_t)nSize) return false;
+
+		m_psHeader = psHeader;
+		m_pafBindPose = (const float*)(pchData + unOffset);
+		m_pchPayload = pchData + unOffset + unBindPoseSize;
+		return true;
+	}
+
+#ifdef _WIN32
+	/// <summary>
+	/// Maps and validates a .vmesh file.
+	/// @returns False if the file is missing, truncated or no .vmesh file.
+	/// </summary>
+	bool Map(LPCWSTR szPath)
+	{
+		Release();
+
+		m_hFile = CreateFileW(szPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		if (m_hFile == INVALID_HANDLE_VALUE) return false;
+		LARGE_INTEGER sSize = {};
+		if (GetFileSizeEx(m_hFile, &sSize))
+		{
+			m_hMapping = CreateFileMappingW(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+			if (m_hMapping) m_pvView = MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+		}
+		if ((!m_pvView) || (!Open((const uint8_t*)m_pvView, (size_t)sSize.QuadPart)))
+		{
+			Release();
+			return false;
+		}
+		return true;
+	}
+#endif
+
+	/// <summary>
+	/// Unmaps the file, the bind pose pointer gets invalid.
+	/// </summary>
+	void Release()
+	{
+#ifdef _WIN32
+		if (m_pvView) UnmapViewOfFile(m_pvView);
+		if (m_hMapping) CloseHandle(m_hMapping);
+		if (m_hFile != INVALID_HANDLE_VALUE) CloseHandle(m_hFile);
+		m_pvView = nullptr;
+		m_hMapping = NULL;
+		m_hFile = INVALID_HANDLE_VALUE;
+#endif
+		m_psHeader = nullptr;
+		m_pafBindPose = nullptr;
+		m_pchPayload = nullptr;
+	}
+
+	uint32_t GetVertexCount() const { return m_psHeader ? m_psHeader->unVertexCount : 0; }
+	uint32_t GetIndexCount() const { return m_psHeader ? m_psHeader->unIndexCount : 0; }
+	uint32_t GetJointCount() const { return m_psHeader ? m_psHeader->unJointCount : 0; }
+
+	/// <summary>
+	/// Bind pose, GetJointCount() row major 4x4 matrices, view into the file.
+	/// </summary>
+	const float* GetBindPose() const { return m_pafBindPose; }
+
+	/// <summary>
+	/// Decompresses and dequantizes the mesh.
+	/// @param asVertices Decoded vertices (output).
+	/// @param aunIndices Indices (output), 16 bit index types fail for 32 bit meshes.
+	/// @returns False if not open, the index type is too small or the payload is corrupt.
+	/// </summary>
+	template <typename T> bool Decode(std::vector<VireioMeshVertex>& asVertices, std::vector<T>& aunIndices) const
+	{
+		if (!m_psHeader) return false;
+		bool bIndex32 = (m_psHeader->unFlags & VIREIO_MESH_PACK_FLAG_INDEX32) != 0;
+		if ((bIndex32) && (sizeof(T) < 4)) return false;
+
+		// decompress if necessary
+		const uint8_t* pchRaw = m_pchPayload;
+		std::vector<uint8_t> aunRaw;
+		if (m_psHeader->unFlags & VIREIO_MESH_PACK_FLAG_LZ)
+		{
+			aunRaw.resize(m_psHeader->unRawSize);
+			if (!LZDecompress(m_pchPayload, m_psHeader->unPayloadSize, aunRaw.data(), aunRaw.size())) return false;
+			pchRaw = aunRaw.data();
+		}
+
+		// vertices
+		const uint32_t unVertexCount = m_psHeader->unVertexCount;
+		asVertices.resize(unVertexCount);
+		for (uint32_t unI = 0; unI < unVertexCount; unI++)
+		{
+			VireioPackedVertex sPacked;
+			memcpy(&sPacked, pchRaw + unI * sizeof(VireioPackedVertex), sizeof(VireioPackedVertex));
+			Dequantize(sPacked, asVertices[unI]);
+		}
+		pchRaw += (size_t)unVertexCount * sizeof(VireioPackedVertex);
+
+		// indices, out of range indices mean a corrupt file
+		const uint32_t unIndexCount = m_psHeader->unIndexCount;
+		aunIndices.resize(unIndexCount);
+		for (uint32_t unI = 0; unI < unIndexCount; unI++)
+		{
+			uint32_t unIndex;
+			if (bIndex32)
+				memcpy(&unIndex, pchRaw + unI * 4, 4);
+			else
+			{
+				uint16_t unIndex16;
+				memcpy(&unIndex16, pchRaw + unI * 2, 2);
+				unIndex = unIndex16;
+			}
+			if (unIndex >= unVertexCount) return false;
+			aunIndices[unI] = (T)unIndex;
+		}
+		return true;
+	}
+
+	/// <summary>
+	/// Decompresses a LZ4 layout block.
+	/// @returns False if the block is corrupt or does not fill the destination exactly.
+	/// </summary>
+	static bool LZDecompress(const uint8_t* pchSrc, size_t nSrcSize, uint8_t* pchDst, size_t nDstSize)
+	{
+		const uint8_t* pchSrcEnd = pchSrc + nSrcSize;
+		uint8_t* pchOut = pchDst;
+		uint8_t* pchDstEnd = pchDst + nDstSize;
+
+		while (pchSrc < pchSrcEnd)
+		{
+			uint8_t unToken = *pchSrc++;
+
+			// literals
+			size_t nLength = unToken >> 4;
+			if (nLength == 15)
+			{
+				uint8_t unByte;
+				do
+				{
+					if (pchSrc >= pchSrcEnd) return false;
+					unByte = *pchSrc++;
+					nLength += unByte;
+				} while (unByte == 255);
+			}
+			if (((size_t)(pchSrcEnd - pchSrc) < nLength) || ((size_t)(pchDstEnd - pchOut) < nLength)) return false;
+			memcpy(pchOut, pchSrc, nLength);
+			pchOut += nLength;
+			pchSrc += nLength;
+			if (pchSrc == pchSrcEnd) break;
+
+			// match
+			if (pchSrcEnd - pchSrc < 2) return false;
+			size_t nOffset = (size_t)pchSrc[0] | ((size_t)pchSrc[1] << 8);
+			pchSrc += 2;
+			if ((!nOffset) || (nOffset > (size_t)(pchOut - pchDst))) return false;
+			nLength = (unToken & 15);
+			if (nLength == 15)
+			{
+				uint8_t unByte;
+				do
+				{
+					if (pchSrc >= pchSrcEnd) return false;
+					unByte = *pchSrc++;
+					nLength += unByte;
+				} while (unByte == 255);
+			}
+			nLength += 4;
+			if ((size_t)(pchDstEnd - pchOut) < nLength) return false;
+
+			// byte wise, matches may overlap
+			const uint8_t* pchMatch = pchOut - nOffset;
+			for (size_t nI = 0; nI < nLength; nI++) pchOut[nI] = pchMatch[nI];
+			pchOut += nLength;
+		}
+		return pchOut == pchDstEnd;
+	}
+
+	/// <summary>
+	/// Average cache miss ratio (transformed vertices per triangle) of a triangle list
+	/// for a FIFO post transform cache. 0.5 is optimal for regular grids, 3.0 is no reuse.
+	/// </summary>
+	template <typename T> static float GetACMR(const T* punIndices, size_t nIndexCount, uint32_t unVertexCount, uint32_t unCacheSize = 16)
+	{
+		if ((nIndexCount < 3) || (!unCacheSize)) return 0.0f;
+		std::vector<uint32_t> aunTimestamps(unVertexCount, 0);
+		uint32_t unTime = unCacheSize + 1;
+		size_t nMisses = 0;
+		for (size_t nI = 0; nI < nIndexCount; nI++)
+		{
+			uint32_t unIndex = (uint32_t)punIndices[nI];
+			if (unIndex >= unVertexCount) continue;
+			if (unTime - aunTimestamps[unIndex] > unCacheSize)
+			{
+				aunTimestamps[unIndex] = unTime++;
+				nMisses++;
+			}
+		}
+		return (float)nMisses / (float)(nIndexCount / 3);
+	}
+
+private:
+	/// <summary>
+	/// Decodes an octahedral encoded unit vector.
+	/// </summary>
+	static void OctDecode(const int16_t anOct[2], float& fX, float& fY, float& fZ)
+	{
+		fX = (float)anOct[0] / 32767.0f;
+		fY = (float)anOct[1] / 32767.0f;
+		fZ = 1.0f - fabsf(fX) - fabsf(fY);
+		if (fZ < 0.0f)
+		{
+			float fOX = fX;
+			fX = (1.0f - fabsf(fY)) * ((fOX >= 0.0f) ? 1.0f : -1.0f);
+			fY = (1.0f - fabsf(fOX)) * ((fY >= 0.0f) ? 1.0f : -1.0f);
+		}
+		float fLength = sqrtf(fX * fX + fY * fY + fZ * fZ);
+		if (fLength > 0.0f)
+		{
+			fX /= fLength;
+			fY /= fLength;
+			fZ /= fLength;
+		}
+	}
+
+	/// <summary>
+	/// Dequantizes a single vertex.
+	/// </summary>
+	void Dequantize(const VireioPackedVertex& sPacked, VireioMeshVertex& sVertex) const
+	{
+		const float* afMin = m_psHeader->afPositionMin;
+		const float* afScale = m_psHeader->afPositionScale;
+		sVertex.fX = afMin[0] + (float)sPacked.aunPosition[0] * afScale[0];
+		sVertex.fY = afMin[1] + (float)sPacked.aunPosition[1] * afScale[1];
+		sVertex.fZ = afMin[2] + (float)sPacked.aunPosition[2] * afScale[2];
+		OctDecode(sPacked.anNormal, sVertex.fNX, sVertex.fNY, sVertex.fNZ);
+		OctDecode(sPacked.anTangent, sVertex.fTX, sVertex.fTY, sVertex.fTZ);
+		sVertex.fTW = (sPacked.nTangentW < 0) ? -1.0f : 1.0f;
+		sVertex.fU = m_psHeader->afUVMin[0] + (float)sPacked.aunUV[0] * m_psHeader->afUVScale[0];
+		sVertex.fV = m_psHeader->afUVMin[1] + (float)sPacked.aunUV[1] * m_psHeader->afUVScale[1];
+		for (int nI = 0; nI < 4; nI++)
+		{
+			sVertex.aunBlendIndices[nI] = sPacked.aunBlendIndices[nI];
+			sVertex.afBlendWeights[nI] = (float)sPacked.aunBlendWeights[nI] / 255.0f;
+		}
+	}
+
+	/// <summary>
+	/// File header, view into the file.
+	/// </summary>
+	const VireioMeshPackHeader* m_psHeader;
+	/// <summary>
+	/// Bind pose matrices, view into the file.
+	/// </summary>
+	const float* m_pafBindPose;
+	/// <summary>
+	/// Payload, view into the file.
+	/// </summary>
+	const uint8_t* m_pchPayload;
+#ifdef _WIN32
+	HANDLE m_hFile;
+	HANDLE m_hMapping;
+	LPVOID m_pvView;
+#endif
+
+	VireioMeshPack(const VireioMeshPack&);
+	VireioMeshPack& operator=(const VireioMeshPack&);
+};
+
+#endif
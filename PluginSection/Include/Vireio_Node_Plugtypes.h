@@ -39,6 +39,8 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include<d3dx9.h>
 #include"..//..//Aquilinus/Aquilinus//AQU_NodesStructures.h"
 #include"..\..\..\Include\VireioMenu.h"
+#include"..\..\..\Include\Vireio_InputSnapshot.h"
+#include"..\..\..\Include\Vireio_Log.h"
 #include"..\VireioCore\VireioMatrixModifier\VireioMatrixModifier\VireioMatrixModifierDataStructures.h"
 
 #pragma region global fields
@@ -70,7 +72,8 @@ namespace VLink
 	{
 		TrackerData,
 		StereoData,
-		ModifierData
+		ModifierData,
+		InputData
 	};
 
 	/// <summary>
@@ -98,6 +101,8 @@ namespace VLink
 			return L"Stereo";
 		case _L::ModifierData:
 			return L"Modified";
+		case _L::InputData:
+			return L"Input";
 
 		default:
 			break;
@@ -670,6 +675,22 @@ struct StereoData : public VireioPluginData
 	const virtual unsigned GetPlugtype() { return VLink::Link(VLink::_L::StereoData); }
 };
 
+/// <summary>
+/// Per frame input snapshot, provided by the Stereo Presenter.
+/// Nodes query hotkeys here instead of polling the OS.
+/// </summary>
+struct InputData : public VireioPluginData
+{
+	/// <summary>
+	/// The snapshot, updated once per frame on present.
+	/// Bind the keys to be queried when the plug gets connected.
+	/// </summary>
+	VireioInputSnapshot* pcSnapshot;
+
+	/// <returns>Link identifier for this structure</returns>
+	const virtual unsigned GetPlugtype() { return VLink::Link(VLink::_L::InputData); }
+};
+
 #pragma endregion
 
 #pragma region /// => ImGui helpers
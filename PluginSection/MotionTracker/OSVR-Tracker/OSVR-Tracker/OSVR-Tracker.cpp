@@ -47,7 +47,8 @@ m_psOSVR_ClientContext(nullptr),
 m_psOSVR_ClientInterface(nullptr),
 m_hBitmapControl(nullptr),
 m_bControlUpdate(false),
-m_hFont(nullptr)
+m_hFont(nullptr),
+m_psInput(nullptr)
 {
 	ZeroMemory(&m_sState, sizeof(OSVR_PoseState));
 	ZeroMemory(&m_sTimestamp, sizeof(OSVR_TimeValue));
@@ -326,6 +327,34 @@ DWORD OSVR_Tracker::GetCommanderType(DWORD dwCommanderIndex)
 	return 0;
 }
 
+/**
+* Provides the name of the requested decommander.
+***/
+LPWSTR OSVR_Tracker::GetDecommanderName(DWORD dwDecommanderIndex)
+{
+	switch ((OSVR_Decommanders)dwDecommanderIndex)
+	{
+		case OSVR_Decommanders::Input:
+			return VLink::Name(VLink::_L::InputData);
+	}
+
+	return L"";
+}
+
+/**
+* Provides the type of the requested decommander.
+***/
+DWORD OSVR_Tracker::GetDecommanderType(DWORD dwDecommanderIndex)
+{
+	switch ((OSVR_Decommanders)dwDecommanderIndex)
+	{
+		case OSVR_Decommanders::Input:
+			return VLink::Link(VLink::_L::InputData);
+	}
+
+	return 0;
+}
+
 /**
 * Provides the pointer of the requested commander.
 ***/
@@ -370,6 +399,21 @@ void* OSVR_Tracker::GetOutputPointer(DWORD dwCommanderIndex)
 	return nullptr;
 }
 
+/**
+* Sets the input pointer for the requested decommander.
+***/
+void OSVR_Tracker::SetInputPointer(DWORD dwDecommanderIndex, void* pData)
+{
+	switch ((OSVR_Decommanders)dwDecommanderIndex)
+	{
+		case OSVR_Decommanders::Input:
+			m_psInput = (InputData*)pData;
+			if ((m_psInput) && (m_psInput->pcSnapshot))
+				m_psInput->pcSnapshot->Bind((uint8_t)m_nHotkeySync);
+			break;
+	}
+}
+
 /**
 * Tracker supports any calls.
 ***/
@@ -502,7 +546,8 @@ void* OSVR_Tracker::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3DMe
 
 			// resync yaw ?
 			static float s_fYawOrigin = 0.0f;
-			if (GetAsyncKeyState(m_nHotkeySync))
+			bool bHotkey = ((m_psInput) && (m_psInput->pcSnapshot) && (m_psInput->pcSnapshot->IsDown((uint8_t)m_nHotkeySync)));
+			if (bHotkey)
 			{
 				s_fYawOrigin = -m_afEulerPredicted[1];
 			}
@@ -55,6 +55,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include"..\..\..\Include\VireioMenu.h"
 
 #define NUMBER_OF_COMMANDERS                          15
+#define NUMBER_OF_DECOMMANDERS                         1
 
 #define FLOAT_PI                            (3.1415926f)
 
@@ -81,6 +82,14 @@ enum OSVR_Commanders
 	VireioMenu,                  /**<  The Vireio Menu node connector. ***/
 };
 
+/**
+* Node Decommander Enumeration.
+***/
+enum OSVR_Decommanders
+{
+	Input,                       /**<  The Vireio input snapshot. ***/
+};
+
 /**
 * Game timer helper class for OpenVR prediction model.
 * Based on class <GameTimer> by Frank Luna (C) 2011.
@@ -213,9 +222,13 @@ public:
 	virtual DWORD           GetNodeWidth() { return 4+256+4; }
 	virtual DWORD           GetNodeHeight() { return 128; }
 	virtual DWORD           GetCommandersNumber() { return NUMBER_OF_COMMANDERS; }
+	virtual DWORD           GetDecommandersNumber() { return NUMBER_OF_DECOMMANDERS; }
 	virtual LPWSTR          GetCommanderName(DWORD dwCommanderIndex);
+	virtual LPWSTR          GetDecommanderName(DWORD dwDecommanderIndex);
 	virtual DWORD           GetCommanderType(DWORD dwCommanderIndex);
+	virtual DWORD           GetDecommanderType(DWORD dwDecommanderIndex);
 	virtual void*           GetOutputPointer(DWORD dwCommanderIndex);
+	virtual void            SetInputPointer(DWORD dwDecommanderIndex, void* pData);
 	virtual bool            SupportsD3DMethod(int nD3DVersion, int nD3DInterface, int nD3DMethod);
 	virtual void*           Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3DMethod, DWORD dwNumberConnected, int& nProvokerIndex);
 private:
@@ -302,6 +315,10 @@ private:
 	***/
 	UINT m_nHotkeySync;
 	/**
+	* Input snapshot, if not connected the hotkey is up.
+	***/
+	InputData* m_psInput;
+	/**
 	* Vireio menu.
 	***/
 	VireioSubMenu m_sMenu;
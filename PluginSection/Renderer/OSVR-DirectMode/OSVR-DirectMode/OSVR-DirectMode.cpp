@@ -71,7 +71,8 @@ UINT32* OSVR_DirectMode::m_punTexResolutionHeight;
 ***/
 OSVR_DirectMode::OSVR_DirectMode() :AQU_Nodus(),
 m_pcRenderManager(nullptr),
-m_bHotkeySwitch(false)
+m_bHotkeySwitch(false),
+m_psInput(nullptr)
 {
 	m_pcVertexShader11 = nullptr;
 	m_pcPixelShader11 = nullptr;
@@ -221,6 +222,8 @@ LPWSTR OSVR_DirectMode::GetDecommanderName(DWORD dwDecommanderIndex)
 			return L"Target Width";
 		case OSVR_Decommanders::TargetHeight:
 			return L"Target Height";
+		case OSVR_Decommanders::Input:
+			return VLink::Name(VLink::_L::InputData);
 	}
 
 	return L"x";
@@ -259,6 +262,8 @@ DWORD OSVR_DirectMode::GetDecommanderType(DWORD dwDecommanderIndex)
 		case OSVR_Decommanders::TargetWidth:
 		case OSVR_Decommanders::TargetHeight:
 			return NOD_Plugtype::AQU_UINT;
+		case OSVR_Decommanders::Input:
+			return VLink::Link(VLink::_L::InputData);
 	}
 
 	return 0;
@@ -308,6 +313,11 @@ void OSVR_DirectMode::SetInputPointer(DWORD dwDecommanderIndex, void* pData)
 		case OSVR_Decommanders::TargetHeight:
 			m_punTexResolutionHeight = (UINT32*)pData;
 			break;
+		case OSVR_Decommanders::Input:
+			m_psInput = (InputData*)pData;
+			if ((m_psInput) && (m_psInput->pcSnapshot))
+				m_psInput->pcSnapshot->Bind(VK_F11);
+			break;
 	}
 }
 
@@ -329,7 +339,8 @@ void* OSVR_DirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 	if (eD3DMethod != METHOD_IDXGISWAPCHAIN_PRESENT) return nullptr;
 	if (!m_bHotkeySwitch)
 	{
-		if (GetAsyncKeyState(VK_F11))
+		bool bHotkey = ((m_psInput) && (m_psInput->pcSnapshot) && (m_psInput->pcSnapshot->IsDown(VK_F11)));
+		if (bHotkey)
 		{
 			m_bHotkeySwitch = true;
 		}
@@ -495,11 +506,11 @@ void* OSVR_DirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 		D3DX11_STATE_BLOCK sStateBlock;
 		if (m_eMethod == OSVR_DirectModeMethods::OSVR_D3D11_use_Game_Device)
 		{
-			// backup all states
-			CreateStateblock(pcContext, &sStateBlock);
+			// backup the states the render manager may set
+			CreateStateblock(pcContext, &sStateBlock, D3DX11_STATE_BLOCK_MASK_DISTORTION);
 
-			// clear all states
-			pcContext->ClearState();
+			// clear these states
+			ClearContextState(pcContext, D3DX11_STATE_BLOCK_MASK_DISTORTION);
 		}
 
 		// Update the context so we get our callbacks called and
@@ -81,7 +81,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define PNT_UINT_PLUG_TYPE                           112
 
 #define NUMBER_OF_COMMANDERS                           1
-#define NUMBER_OF_DECOMMANDERS                         11
+#define NUMBER_OF_DECOMMANDERS                         12
 
 /**
 * Node Commander Enumeration.
@@ -107,6 +107,7 @@ enum OSVR_Decommanders
 	ProjectionRight,
 	TargetWidth,
 	TargetHeight,
+	Input,
 };
 
 /**
@@ -237,6 +238,10 @@ private:
 	***/
 	bool m_bHotkeySwitch;
 	/**
+	* Input snapshot, if not connected the hotkey is up.
+	***/
+	InputData* m_psInput;
+	/**
 	* Zoom out switch.
 	***/
 	static BOOL* m_pbZoomOut;
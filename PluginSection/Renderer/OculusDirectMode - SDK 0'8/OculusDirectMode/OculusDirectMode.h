@@ -79,7 +79,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include"..\..\..\Include\Vireio_DX11Basics.h"
 #include"..\..\..\Include\Vireio_Node_Plugtypes.h"
 
-#define NUMBER_OF_DECOMMANDERS                         11
+#define NUMBER_OF_DECOMMANDERS                         12
 
 /**
 * Node Commander Enumeration.
@@ -97,6 +97,7 @@ enum ODM_Decommanders
 	HUDTexture11,
 	HUDTexture10,
 	HUDTexture9,
+	Input,
 };
 
 /**
@@ -346,6 +347,10 @@ private:
 	***/
 	bool m_bHotkeySwitch;
 	/**
+	* Input snapshot, if not connected the hotkey is up.
+	***/
+	InputData* m_psInput;
+	/**
 	* Zoom out switch.
 	***/
 	static BOOL* m_pbZoomOut;
@@ -86,6 +86,7 @@ m_pcMirrorTextureD3D11HMD(nullptr),
 m_hHMD(nullptr),
 m_phHMD_Tracker(nullptr),
 m_bHotkeySwitch(false),
+m_psInput(nullptr),
 m_ppcTexViewHud11(nullptr),
 m_pcTex11CopyHUD(nullptr)
 {
@@ -205,6 +206,8 @@ LPWSTR OculusDirectMode::GetDecommanderName(DWORD dwDecommanderIndex)
 			break;
 		case HUDTexture9:
 			break;
+		case ODM_Decommanders::Input:
+			return VLink::Name(VLink::_L::InputData);
 	}
 
 	return L"x";
@@ -231,6 +234,8 @@ DWORD OculusDirectMode::GetDecommanderType(DWORD dwDecommanderIndex)
 			break;
 		case HUDTexture9:
 			break;
+		case ODM_Decommanders::Input:
+			return VLink::Link(VLink::_L::InputData);
 	}
 
 	return 0;
@@ -262,6 +267,11 @@ void OculusDirectMode::SetInputPointer(DWORD dwDecommanderIndex, void* pData)
 			break;
 		case HUDTexture9:
 			break;
+		case ODM_Decommanders::Input:
+			m_psInput = (InputData*)pData;
+			if ((m_psInput) && (m_psInput->pcSnapshot))
+				m_psInput->pcSnapshot->Bind(VK_F11);
+			break;
 	}
 }
 
@@ -295,7 +305,7 @@ void* OculusDirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD
 	if (eD3DMethod != METHOD_IDXGISWAPCHAIN_PRESENT) return nullptr;
 	/*if (!m_bHotkeySwitch)
 	{
-	if (GetAsyncKeyState(VK_F11))
+	if ((m_psInput) && (m_psInput->pcSnapshot) && (m_psInput->pcSnapshot->IsDown(VK_F11)))
 	{
 	m_bHotkeySwitch = true;
 	}
@@ -88,7 +88,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #define PPNT_IDIRECT3DVERTEXBUFFER9_PLUG_TYPE       3049
 #define PPNT_IDIRECT3DVERTEXDECLARATION9_PLUG_TYPE  3050
 
-#define NUMBER_OF_DECOMMANDERS                         11
+#define NUMBER_OF_DECOMMANDERS                         12
 
 /**
 * Node Commander Enumeration.
@@ -106,6 +106,7 @@ enum ODM_Decommanders
 	HUDTexture11,
 	HUDTexture10,
 	HUDTexture9,
+	Input,
 };
 
 /**
@@ -445,6 +446,10 @@ private:
 	***/
 	bool m_bHotkeySwitch;
 	/**
+	* Input snapshot, if not connected the hotkey is up.
+	***/
+	InputData* m_psInput;
+	/**
 	* Zoom out switch.
 	***/
 	static BOOL* m_pbZoomOut;
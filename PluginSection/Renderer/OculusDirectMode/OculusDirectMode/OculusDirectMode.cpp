@@ -889,39 +889,51 @@ void* OculusDirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD
 #else
 		if (!m_asAssetMap.size())
 		{
-			// create the meshes manually for 32bit
+			// load the hand mesh for 32bit, decoded once from the mesh pack
 			AvatarData sData = {};
-
-			// create the vertex buffer
-			D3D11_BUFFER_DESC sDesc = {};
-			sDesc.Usage = D3D11_USAGE_DEFAULT;
-			sDesc.ByteWidth = sizeof(ovrAvatarMeshVertex)* unAvatarVertexCount_4070;
-			sDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-			sDesc.CPUAccessFlags = 0;
-			D3D11_SUBRESOURCE_DATA sInitData;
-			ZeroMemory(&sInitData, sizeof(sInitData));
-			sInitData.pSysMem = asAvatarVertices_4070;
-			if (FAILED(m_pcDeviceTemporary->CreateBuffer(&sDesc, &sInitData, &sData.sMesh.pcVertexBuffer)))
-				OutputDebugString(L"[OVR] Failed to create vertex buffer.");
-
-			// create index buffer
-			D3D11_BUFFER_DESC sIBDesc = {};
-			sIBDesc.Usage = D3D11_USAGE_DEFAULT;
-			sIBDesc.ByteWidth = sizeof(WORD)*unAvatarIndexCount_4070;
-			sIBDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-			sIBDesc.CPUAccessFlags = 0;
-			ZeroMemory(&sInitData, sizeof(sInitData));
-			sInitData.pSysMem = aunAvatarIndices_4070;
-			if (FAILED(m_pcDeviceTemporary->CreateBuffer(&sIBDesc, &sInitData, &sData.sMesh.pcElementBuffer)))
-				OutputDebugString(L"[OVR] Failed to create index buffer.");
-			sData.sMesh.unElementCount = unAvatarIndexCount_4070;
-
-			// Translate the bind pose
-			for (uint32_t i = 0; i < unJointCount_4070; ++i)
+			std::wstring strMeshPath = GetBaseDir() + L"..//..//mesh//OculusMesh_4070.vmesh";
+			VireioMeshPack cMeshPack;
+			std::vector<VireioMeshVertex> asVertices;
+			std::vector<uint16_t> aunIndices;
+			if ((cMeshPack.Map(strMeshPath.c_str())) && (cMeshPack.Decode(asVertices, aunIndices)))
 			{
-				sData.sMesh.asBindPose[i] = asBindPose_4070[i];
-				D3DXMatrixInverse((D3DXMATRIX*)&sData.sMesh.asInverseBindPose[i], NULL, (D3DXMATRIX*)&sData.sMesh.asBindPose[i]);
+				static_assert(sizeof(VireioMeshVertex) == sizeof(ovrAvatarMeshVertex), "Mesh pack vertex layout mismatch.");
+
+				// create the vertex buffer
+				D3D11_BUFFER_DESC sDesc = {};
+				sDesc.Usage = D3D11_USAGE_DEFAULT;
+				sDesc.ByteWidth = sizeof(ovrAvatarMeshVertex)* (UINT)asVertices.size();
+				sDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+				sDesc.CPUAccessFlags = 0;
+				D3D11_SUBRESOURCE_DATA sInitData;
+				ZeroMemory(&sInitData, sizeof(sInitData));
+				sInitData.pSysMem = asVertices.data();
+				if (FAILED(m_pcDeviceTemporary->CreateBuffer(&sDesc, &sInitData, &sData.sMesh.pcVertexBuffer)))
+					OutputDebugString(L"[OVR] Failed to create vertex buffer.");
+
+				// create index buffer
+				D3D11_BUFFER_DESC sIBDesc = {};
+				sIBDesc.Usage = D3D11_USAGE_DEFAULT;
+				sIBDesc.ByteWidth = sizeof(WORD)*(UINT)aunIndices.size();
+				sIBDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+				sIBDesc.CPUAccessFlags = 0;
+				ZeroMemory(&sInitData, sizeof(sInitData));
+				sInitData.pSysMem = aunIndices.data();
+				if (FAILED(m_pcDeviceTemporary->CreateBuffer(&sIBDesc, &sInitData, &sData.sMesh.pcElementBuffer)))
+					OutputDebugString(L"[OVR] Failed to create index buffer.");
+				sData.sMesh.unElementCount = (UINT)aunIndices.size();
+
+				// Translate the bind pose
+				uint32_t unJointCount = cMeshPack.GetJointCount();
+				if (unJointCount > OVR_AVATAR_MAXIMUM_JOINT_COUNT) unJointCount = OVR_AVATAR_MAXIMUM_JOINT_COUNT;
+				for (uint32_t i = 0; i < unJointCount; ++i)
+				{
+					memcpy(&sData.sMesh.asBindPose[i], cMeshPack.GetBindPose() + i * 16, sizeof(_D3DMATRIX));
+					D3DXMatrixInverse((D3DXMATRIX*)&sData.sMesh.asInverseBindPose[i], NULL, (D3DXMATRIX*)&sData.sMesh.asBindPose[i]);
+				}
 			}
+			else
+				OutputDebugString(L"[OVR] Failed to load hand mesh.");
 
 			m_asAssetMap.push_back(sData);
 		}
@@ -1767,6 +1779,7 @@ void* OculusDirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD
 						{
 							// get mesh... in the 32bit asset map we only have meshes
 							MeshData* data = &m_asAssetMap[i].sMesh;
+							if (!data->pcVertexBuffer) continue;
 
 							// Apply the material state
 							ovrAvatarMaterialState sState = {};
@@ -2396,56 +2409,33 @@ void OculusDirectMode::LoadTexture(ID3D11Device* pcDevice, const ovrAvatarTextur
 				else
 					eFormat = DXGI_FORMAT::DXGI_FORMAT_BC3_UNORM;
 
-				// create a dds file in memory... code from https://github.com/ClemensX/ShadedPath12/blob/master/ShadedPath12/ShadedPath12/vr.cpp
-				DDS_HEADER sHeader = {};
-				int nBlockSize;
-				if (data->format == ovrAvatarTextureFormat_DXT1)
+				// lay out the mip chain, the subresources point straight into the asset data
+				uint32_t unMipLevels = data->mipCount ? data->mipCount : 1;
+				std::vector<D3D11_SUBRESOURCE_DATA> asData(unMipLevels);
+				const BYTE* pchData = (const BYTE*)data->textureData;
+				for (uint32_t level = 0, width = data->sizeX, height = data->sizeY; level < unMipLevels; ++level)
 				{
-					nBlockSize = 8;
-					sHeader.ddspf.dwFourCC = 0x31545844;
+					uint64_t unRowPitch, unRowCount;
+					VireioDDSLayout::GetSurfaceInfo(eFormat, width, height, unRowPitch, unRowCount);
+					asData[level].pSysMem = pchData;
+					asData[level].SysMemPitch = (UINT)unRowPitch;
+					asData[level].SysMemSlicePitch = (UINT)(unRowPitch * unRowCount);
+					pchData += unRowPitch * unRowCount;
+					if (width > 1) width >>= 1;
+					if (height > 1) height >>= 1;
 				}
-				else
-				{
-					nBlockSize = 16;
-					sHeader.ddspf.dwFourCC = 0x35545844;
-				}
-				sHeader.dwSize = 0x7c;
-				sHeader.dwFlags = 0xa1007;
-				sHeader.dwHeight = data->sizeY;
-				sHeader.dwWidth = data->sizeX;
-				sHeader.dwPitchOrLinearSize = nBlockSize * max(1, ((sHeader.dwWidth + 3) / 4)) * max(1, ((sHeader.dwHeight + 3) / 4));
-				sHeader.dwDepth = 1;
-				sHeader.dwMipMapCount = data->mipCount;
-				sHeader.dwCaps = 0x401008;
-
-				sHeader.ddspf.dwSize = 0x20;
-				sHeader.ddspf.dwFlags = 0x04;
-
-				// create memory file stream
-				std::stringstream oMemoryFileStream;
-				/*std::ofstream oMemoryFileStream;
-				oMemoryFileStream.open("TEXTEST.dds");*/
-				uint32_t dwMagicNumber = DDS_MAGIC;
-				oMemoryFileStream.write((const char*)&dwMagicNumber, 4);
-				oMemoryFileStream.write((const char*)&sHeader, sizeof(sHeader));
-
-				int total = 0;
-				for (uint32_t level = 0, offset = 0, width = data->sizeX, height = data->sizeY; level < data->mipCount; ++level)
-				{
-					// int levelSize = blockSize * (width / 4) * (height / 4);
-					int levelSize = nBlockSize * max(1, ((width + 3) / 4)) * max(1, ((height + 3) / 4));
-
-					total += levelSize;
-					const char *mem = ((const char*)data->textureData) + offset;
-					oMemoryFileStream.write(mem, levelSize);
-					offset += levelSize;
-					width /= 2;
-					height /= 2;
-				}
-				//oMemoryFileStream.close();
-				HRESULT nHr = S_OK;
-				D3DX11CreateTextureFromMemory(pcDevice, oMemoryFileStream.str().c_str(), oMemoryFileStream.str().length(), NULL, NULL, (ID3D11Resource**)&texture->pcTexture, &nHr);
-				if (FAILED(nHr))
+
+				// create geometry texture
+				D3D11_TEXTURE2D_DESC sDesc = {};
+				sDesc.Width = data->sizeX;
+				sDesc.Height = data->sizeY;
+				sDesc.MipLevels = unMipLevels;
+				sDesc.ArraySize = 1;
+				sDesc.Format = eFormat;
+				sDesc.SampleDesc.Count = 1;
+				sDesc.Usage = D3D11_USAGE_DEFAULT;
+				sDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+				if (FAILED(pcDevice->CreateTexture2D(&sDesc, asData.data(), &texture->pcTexture)))
 				{
 					if (data->format == ovrAvatarTextureFormat_DXT1)
 						OutputDebugString(L"[OVR] Failed to create model texture. DXGI_FORMAT_BC1_UNORM");
@@ -2470,7 +2460,7 @@ void OculusDirectMode::LoadTexture(ID3D11Device* pcDevice, const ovrAvatarTextur
 		sDesc.Format = eFormat;
 		sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
 		sDesc.Texture2D.MostDetailedMip = 0;
-		sDesc.Texture2D.MipLevels = 1; // data->mipCount; // TODO !! MIP COUNT
+		sDesc.Texture2D.MipLevels = (UINT)-1;
 
 		if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)texture->pcTexture, &sDesc, &texture->pcSRV))))
 			OutputDebugString(L"[OVR] Failed to create model texture shader resource view!");
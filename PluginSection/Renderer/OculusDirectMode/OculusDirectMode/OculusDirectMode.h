@@ -87,7 +87,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include <OVR_CAPI_D3D.h>
 #ifdef _WIN64 // TODO !! NO 32BIT SUPPORT FOR AVATAR SDK RIGHT NOW
 #include <OVR_Platform.h>
-#include "DDS.h"
+#include "..\..\..\Include\Vireio_DDS.h"
 #else
 typedef uint64_t ovrAvatarAssetID;
 /// The maximum joint count that can be in a skinned mesh renderer.
@@ -208,7 +208,7 @@ typedef struct ovrAvatarMaterialState_
 	uint32_t                    layerCount;              ///< Number of layers
 	ovrAvatarMaterialLayerState layers[OVR_AVATAR_MAX_MATERIAL_LAYER_COUNT]; ///< State for each material layer
 } ovrAvatarMaterialState;
-#include"OculusMesh_4070.h" // include mesh for 32 bit
+#include"OculusHandPoses.h" // include hand poses for 32 bit, the hand mesh is loaded from "mesh/OculusMesh_4070.vmesh"
 #endif
 #include <inttypes.h>
 
@@ -216,8 +216,9 @@ typedef struct ovrAvatarMaterialState_
 #include"..\..\..\Include\Vireio_DX11Basics.h"
 #include"..\..\..\Include\Vireio_Node_Plugtypes.h"
 #include"..\..\..\Include\VireioMenu.h"
+#include"..\..\..\Include\Vireio_MeshPack.h"
 
-// #define _CREATE_MESH_FILES // define this to output mesh data to c++ ".h" files
+// #define _CREATE_MESH_FILES // define this to output mesh data to c++ ".h" files, convert them to ".vmesh" by Scripts/convert_oculus_mesh.py
 #ifdef _CREATE_MESH_FILES
 #include <iostream>
 #include <fstream>
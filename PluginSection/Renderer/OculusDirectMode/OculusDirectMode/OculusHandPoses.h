@@ -0,0 +1,293 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+Copyright (C) 2012 Andres Hernandez
+This file was exported from Vireio using Oculus Avatar SDK.
+Data Copyright : Copyright 2014-2016 Oculus VR, LLC All Rights reserved.
+
+Vireio Perception Version History :.
+v1.0.0 2012 by Andres Hernandez.
+v1.0.X 2013 by John Hicks, Neil Schneider.
+v1.1.x 2013 by Primary Coding Author : Chris Drain.
+Team Support : John Hicks, Phil Larkson, Neil Schneider.
+v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown.
+v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown, Samuel Austin.
+and Neil Schneider.
+
+This program is free software : you can redistribute it and / or modify.
+it under the terms of the GNU Lesser General Public License as published by.
+the Free Software Foundation, either version 3 of the License, or.
+(at your option) any later version..
+
+This program is distributed in the hope that it will be useful,.
+but WITHOUT ANY WARRANTY; without even the implied warranty of.
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the.
+GNU Lesser General Public License for more details..
+
+You should have received a copy of the GNU Lesser General Public License.
+along with this program.If not, see < http://www.gnu.org/licenses/>..
+********************************************************************/
+
+#pragma region poses
+const uint32_t unJointCount_4070 = 25;
+const D3DXMATRIX asPoseDefault[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.965899f, 0.246384f, 0.079587f, 0.000000f, 0.150149f, -0.783433f, 0.603066f, 0.000000f, 0.210936f, -0.570551f, -0.793711f, 0.000000f, -0.022414f, -0.030771f, 0.035514f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.216737f, 0.024541f, 0.975922f, 0.000000f, 0.901744f, -0.377963f, 0.209767f, 0.000000f, 0.374010f, 0.925496f, 0.059788f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.582121f, 0.179238f, 0.793102f, 0.000000f, 0.701820f, -0.381788f, 0.601405f, 0.000000f, 0.410591f, 0.906704f, 0.096454f, 0.000000f, -0.032684f, -0.006868f, -0.023565f, 1.000000f },
+	{ -0.661488f, 0.223389f, 0.715913f, 0.000000f, 0.627574f, -0.357751f, 0.691496f, 0.000000f, 0.410591f, 0.906704f, 0.096455f, 0.000000f, -0.019788f, -0.010838f, -0.041135f, 1.000000f },
+	{ -0.661488f, 0.223389f, 0.715913f, 0.000000f, 0.627574f, -0.357751f, 0.691496f, 0.000000f, 0.410591f, 0.906704f, 0.096455f, 0.000000f, -0.000524f, -0.017344f, -0.061984f, 1.000000f },
+	{ -0.248272f, 0.084264f, 0.965019f, 0.000000f, 0.960980f, -0.104018f, 0.256315f, 0.000000f, 0.121977f, 0.991000f, -0.055151f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ -0.801349f, 0.133336f, 0.583147f, 0.000000f, 0.585163f, -0.027658f, 0.810444f, 0.000000f, 0.124190f, 0.990685f, -0.055860f, 0.000000f, -0.041990f, -0.033199f, -0.026684f, 1.000000f },
+	{ -0.914386f, 0.135419f, 0.381523f, 0.000000f, 0.384478f, -0.004665f, 0.923123f, 0.000000f, 0.126788f, 0.990777f, -0.047800f, 0.000000f, -0.018278f, -0.037145f, -0.043940f, 1.000000f },
+	{ -0.914386f, 0.135419f, 0.381523f, 0.000000f, 0.384477f, -0.004665f, 0.923123f, 0.000000f, 0.126788f, 0.990777f, -0.047800f, 0.000000f, 0.005926f, -0.040729f, -0.054038f, 1.000000f },
+	{ -0.070221f, -0.409379f, -0.909658f, 0.000000f, -0.952892f, -0.242214f, 0.182564f, 0.000000f, -0.295070f, 0.879625f, -0.373086f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.487376f, 0.061230f, 0.871043f, 0.000000f, 0.786728f, 0.463586f, 0.407611f, 0.000000f, -0.378845f, 0.883934f, -0.274112f, 0.000000f, -0.043207f, -0.073252f, 0.033196f, 1.000000f },
+	{ -0.814140f, -0.179160f, 0.552338f, 0.000000f, 0.438863f, 0.433016f, 0.787335f, 0.000000f, -0.380230f, 0.883402f, -0.273909f, 0.000000f, -0.026950f, -0.075295f, 0.004142f, 1.000000f },
+	{ -0.918694f, -0.328664f, 0.219047f, 0.000000f, 0.103827f, 0.334131f, 0.936791f, 0.000000f, -0.381079f, 0.883367f, -0.272840f, 0.000000f, -0.012770f, -0.072174f, -0.005479f, 1.000000f },
+	{ -0.918694f, -0.328664f, 0.219047f, 0.000000f, 0.103827f, 0.334131f, 0.936791f, 0.000000f, -0.381079f, 0.883367f, -0.272840f, 0.000000f, 0.005091f, -0.065784f, -0.009738f, 1.000000f },
+	{ -0.284623f, 0.157698f, 0.945579f, 0.000000f, 0.953426f, 0.149289f, 0.262088f, 0.000000f, -0.099834f, 0.976137f, -0.192845f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ -0.852130f, 0.012657f, 0.523175f, 0.000000f, 0.513358f, 0.214429f, 0.830953f, 0.000000f, -0.101667f, 0.976657f, -0.189220f, 0.000000f, -0.040346f, -0.058609f, -0.012744f, 1.000000f },
+	{ -0.982254f, -0.066595f, 0.175331f, 0.000000f, 0.158820f, 0.201904f, 0.966442f, 0.000000f, -0.099761f, 0.977138f, -0.187745f, 0.000000f, -0.018382f, -0.058935f, -0.026229f, 1.000000f },
+	{ -0.982254f, -0.066595f, 0.175331f, 0.000000f, 0.158820f, 0.201904f, 0.966442f, 0.000000f, -0.099761f, 0.977138f, -0.187745f, 0.000000f, 0.005403f, -0.057322f, -0.030474f, 1.000000f },
+	{ -0.481274f, -0.152774f, 0.863155f, 0.000000f, -0.249293f, -0.920180f, -0.301866f, 0.000000f, 0.840375f, -0.360458f, 0.404773f, 0.000000f, -0.009764f, 0.002759f, 0.075239f, 1.000000f },
+	{ -0.391518f, 0.112725f, 0.913240f, 0.000000f, -0.374813f, -0.925939f, -0.046395f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.005920f, 0.007738f, 0.047110f, 1.000000f },
+	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.016245f, 0.004765f, 0.023026f, 1.000000f },
+	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.029808f, 0.001475f, -0.008064f, 1.000000f } };
+const D3DXMATRIX asPoseFist[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.873600f, 0.477917f, -0.091756f, 0.000000f, 0.456594f, -0.739721f, 0.494303f, 0.000000f, 0.168362f, -0.473718f, -0.864434f, 0.000000f, -0.017807f, -0.032510f, 0.034160f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.855185f, 0.342740f, 0.388829f, 0.000000f, 0.416634f, 0.008284f, 0.909037f, 0.000000f, 0.308342f, 0.939394f, -0.149881f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.163844f, -0.102724f, -0.981123f, 0.000000f, -0.937072f, 0.327034f, 0.122248f, 0.000000f, 0.308304f, 0.939413f, -0.149842f, 0.000000f, -0.006140f, -0.020097f, 0.000843f, 1.000000f },
+	{ 0.925781f, -0.332522f, -0.179884f, 0.000000f, -0.218811f, -0.083262f, -0.972208f, 0.000000f, 0.308304f, 0.939413f, -0.149842f, 0.000000f, -0.002511f, -0.017821f, 0.022578f, 1.000000f },
+	{ 0.925781f, -0.332522f, -0.179885f, 0.000000f, -0.218811f, -0.083262f, -0.972208f, 0.000000f, 0.308304f, 0.939413f, -0.149842f, 0.000000f, -0.029471f, -0.008137f, 0.027816f, 1.000000f },
+	{ -0.978051f, 0.158075f, 0.135755f, 0.000000f, 0.176508f, 0.282296f, 0.942950f, 0.000000f, 0.110734f, 0.946215f, -0.304001f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ 0.226701f, -0.321864f, -0.919245f, 0.000000f, -0.967650f, 0.032875f, -0.250149f, 0.000000f, 0.110734f, 0.946215f, -0.303998f, 0.000000f, -0.008444f, -0.036592f, 0.011435f, 1.000000f },
+	{ 0.951003f, -0.012031f, 0.308946f, 0.000000f, 0.288672f, -0.323322f, -0.901184f, 0.000000f, 0.110731f, 0.946213f, -0.304007f, 0.000000f, -0.015152f, -0.027068f, 0.038636f, 1.000000f },
+	{ 0.951003f, -0.012031f, 0.308946f, 0.000000f, 0.288672f, -0.323322f, -0.901184f, 0.000000f, 0.110731f, 0.946213f, -0.304007f, 0.000000f, -0.040325f, -0.026750f, 0.030458f, 1.000000f },
+	{ -0.084136f, -0.368123f, -0.925963f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.291472f, 0.897706f, -0.330405f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.977207f, -0.208294f, -0.041003f, 0.000000f, -0.147880f, 0.529323f, 0.835433f, 0.000000f, -0.152312f, 0.822454f, -0.548061f, 0.000000f, -0.043947f, -0.071015f, 0.032386f, 1.000000f },
+	{ 0.505648f, -0.411615f, -0.758218f, 0.000000f, -0.849189f, -0.392611f, -0.353178f, 0.000000f, -0.152311f, 0.822454f, -0.548062f, 0.000000f, -0.011352f, -0.064067f, 0.033754f, 1.000000f },
+	{ 0.937095f, 0.296408f, 0.184379f, 0.000000f, 0.314093f, -0.485503f, -0.815863f, 0.000000f, -0.152311f, 0.822453f, -0.548062f, 0.000000f, -0.020159f, -0.056898f, 0.046960f, 1.000000f },
+	{ 0.937095f, 0.296408f, 0.184379f, 0.000000f, 0.314093f, -0.485503f, -0.815863f, 0.000000f, -0.152311f, 0.822454f, -0.548062f, 0.000000f, -0.038378f, -0.062660f, 0.043376f, 1.000000f },
+	{ -0.994334f, 0.009383f, 0.105885f, 0.000000f, 0.102164f, 0.359520f, 0.927528f, 0.000000f, -0.029364f, 0.933091f, -0.358441f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ 0.330609f, -0.329349f, -0.884437f, 0.000000f, -0.943311f, -0.144479f, -0.298815f, 0.000000f, -0.029368f, 0.933089f, -0.358444f, 0.000000f, -0.012971f, -0.052888f, 0.019645f, 1.000000f },
+	{ 0.910974f, 0.172583f, 0.374623f, 0.000000f, 0.411418f, -0.315531f, -0.855089f, 0.000000f, -0.029368f, 0.933090f, -0.358444f, 0.000000f, -0.021492f, -0.044399f, 0.042442f, 1.000000f },
+	{ 0.910974f, 0.172583f, 0.374623f, 0.000000f, 0.411418f, -0.315531f, -0.855089f, 0.000000f, -0.029368f, 0.933090f, -0.358444f, 0.000000f, -0.043552f, -0.048578f, 0.033370f, 1.000000f },
+	{ -0.475331f, -0.046678f, 0.878568f, 0.000000f, -0.327112f, -0.917629f, -0.225730f, 0.000000f, 0.816736f, -0.394687f, 0.420908f, 0.000000f, -0.010062f, 0.001933f, 0.070744f, 1.000000f },
+	{ -0.377346f, 0.504038f, 0.776889f, 0.000000f, -0.578953f, -0.783155f, 0.226898f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.005428f, 0.003454f, 0.042113f, 1.000000f },
+	{ 0.448220f, 0.893919f, 0.002662f, 0.000000f, -0.525999f, 0.261331f, 0.809340f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.015379f, -0.009838f, 0.021625f, 1.000000f },
+	{ 0.448220f, 0.893919f, 0.002662f, 0.000000f, -0.525999f, 0.261331f, 0.809340f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.000104f, -0.040302f, 0.021535f, 1.000000f } };
+const D3DXMATRIX asPoseThumbRelaxed[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.951999f, 0.304127f, 0.034703f, 0.000000f, 0.228092f, -0.780422f, 0.582165f, 0.000000f, 0.204135f, -0.546305f, -0.812330f, 0.000000f, -0.021285f, -0.031197f, 0.035182f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.413394f, 0.135834f, 0.900364f, 0.000000f, 0.843950f, -0.314061f, 0.434873f, 0.000000f, 0.341840f, 0.939636f, 0.015194f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.888939f, 0.322452f, 0.325288f, 0.000000f, 0.285682f, -0.164783f, 0.944052f, 0.000000f, 0.358013f, 0.932133f, 0.054363f, 0.000000f, -0.024508f, -0.011495f, -0.020424f, 1.000000f },
+	{ -0.922851f, 0.362103f, -0.131252f, 0.000000f, -0.142030f, -0.003179f, 0.989858f, 0.000000f, 0.358013f, 0.932133f, 0.054363f, 0.000000f, -0.004815f, -0.018638f, -0.027630f, 1.000000f },
+	{ -0.922851f, 0.362103f, -0.131252f, 0.000000f, -0.142030f, -0.003179f, 0.989858f, 0.000000f, 0.358013f, 0.932133f, 0.054363f, 0.000000f, 0.022060f, -0.029183f, -0.023808f, 1.000000f },
+	{ -0.507561f, 0.145326f, 0.849272f, 0.000000f, 0.856710f, -0.019918f, 0.515415f, 0.000000f, 0.091819f, 0.989183f, -0.114393f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ -0.995205f, 0.096231f, 0.017527f, 0.000000f, 0.028319f, 0.111953f, 0.993311f, 0.000000f, 0.093625f, 0.989043f, -0.114141f, 0.000000f, -0.030071f, -0.036006f, -0.021363f, 1.000000f },
+	{ -0.848875f, 0.020013f, -0.528215f, 0.000000f, -0.520773f, 0.139596f, 0.842205f, 0.000000f, 0.090592f, 0.990006f, -0.108077f, 0.000000f, -0.000623f, -0.038854f, -0.021882f, 1.000000f },
+	{ -0.848875f, 0.020013f, -0.528215f, 0.000000f, -0.520773f, 0.139596f, 0.842205f, 0.000000f, 0.090592f, 0.990006f, -0.108077f, 0.000000f, 0.021847f, -0.039384f, -0.007900f, 1.000000f },
+	{ -0.073658f, -0.399990f, -0.913555f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.294295f, 0.883967f, -0.363307f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.707112f, 0.001509f, 0.707100f, 0.000000f, 0.608864f, 0.509784f, 0.607787f, 0.000000f, -0.359551f, 0.860301f, -0.361393f, 0.000000f, -0.043390f, -0.072743f, 0.033002f, 1.000000f },
+	{ -0.920047f, -0.391572f, -0.013570f, 0.000000f, -0.153312f, 0.327921f, 0.932182f, 0.000000f, -0.360566f, 0.859732f, -0.361736f, 0.000000f, -0.019804f, -0.072793f, 0.009416f, 1.000000f },
+	{ -0.655842f, -0.510053f, -0.556522f, 0.000000f, -0.662673f, 0.035884f, 0.748049f, 0.000000f, -0.361574f, 0.859394f, -0.361533f, 0.000000f, -0.003778f, -0.065972f, 0.009653f, 1.000000f },
+	{ -0.655842f, -0.510053f, -0.556522f, 0.000000f, -0.662673f, 0.035884f, 0.748048f, 0.000000f, -0.361574f, 0.859394f, -0.361533f, 0.000000f, 0.008972f, -0.056056f, 0.020472f, 1.000000f },
+	{ -0.548059f, 0.147052f, 0.823413f, 0.000000f, 0.830107f, 0.216537f, 0.513843f, 0.000000f, -0.102737f, 0.965136f, -0.240744f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ -0.992196f, -0.118099f, -0.040001f, 0.000000f, -0.066816f, 0.232711f, 0.970249f, 0.000000f, -0.105276f, 0.965349f, -0.238785f, 0.000000f, -0.030185f, -0.058198f, -0.008031f, 1.000000f },
+	{ -0.716899f, -0.238659f, -0.655056f, 0.000000f, -0.689220f, 0.101054f, 0.717472f, 0.000000f, -0.105034f, 0.965831f, -0.236934f, 0.000000f, -0.004611f, -0.055154f, -0.007000f, 1.000000f },
+	{ -0.716899f, -0.238659f, -0.655056f, 0.000000f, -0.689220f, 0.101054f, 0.717472f, 0.000000f, -0.105034f, 0.965831f, -0.236934f, 0.000000f, 0.012749f, -0.049375f, 0.008862f, 1.000000f },
+	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
+	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
+const D3DXMATRIX asPoseThumbRelaxed1[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.965632f, 0.247777f, 0.078487f, 0.000000f, 0.152041f, -0.783420f, 0.602609f, 0.000000f, 0.210801f, -0.569966f, -0.794168f, 0.000000f, -0.022387f, -0.030781f, 0.035506f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.216737f, 0.024541f, 0.975922f, 0.000000f, 0.901744f, -0.377963f, 0.209767f, 0.000000f, 0.374010f, 0.925496f, 0.059788f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.582121f, 0.179238f, 0.793102f, 0.000000f, 0.701820f, -0.381788f, 0.601405f, 0.000000f, 0.410591f, 0.906704f, 0.096454f, 0.000000f, -0.032684f, -0.006868f, -0.023565f, 1.000000f },
+	{ -0.661488f, 0.223389f, 0.715913f, 0.000000f, 0.627574f, -0.357751f, 0.691496f, 0.000000f, 0.410591f, 0.906704f, 0.096455f, 0.000000f, -0.019788f, -0.010838f, -0.041135f, 1.000000f },
+	{ -0.661488f, 0.223389f, 0.715913f, 0.000000f, 0.627574f, -0.357751f, 0.691496f, 0.000000f, 0.410591f, 0.906704f, 0.096455f, 0.000000f, -0.000524f, -0.017344f, -0.061984f, 1.000000f },
+	{ -0.249908f, 0.084769f, 0.964552f, 0.000000f, 0.960598f, -0.103446f, 0.257975f, 0.000000f, 0.121647f, 0.991016f, -0.055577f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ -0.802575f, 0.133384f, 0.581449f, 0.000000f, 0.583549f, -0.026853f, 0.811634f, 0.000000f, 0.123872f, 0.990700f, -0.056285f, 0.000000f, -0.041915f, -0.033223f, -0.026663f, 1.000000f },
+	{ -0.914697f, 0.135254f, 0.380837f, 0.000000f, 0.383817f, -0.004351f, 0.923400f, 0.000000f, 0.126551f, 0.990801f, -0.047933f, 0.000000f, -0.018166f, -0.037170f, -0.043868f, 1.000000f },
+	{ -0.914697f, 0.135254f, 0.380836f, 0.000000f, 0.383816f, -0.004351f, 0.923400f, 0.000000f, 0.126551f, 0.990801f, -0.047933f, 0.000000f, 0.006045f, -0.040750f, -0.053949f, 1.000000f },
+	{ -0.070824f, -0.408476f, -0.910017f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.294990f, 0.880078f, -0.372080f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.488469f, 0.059216f, 0.870570f, 0.000000f, 0.786410f, 0.462185f, 0.409810f, 0.000000f, -0.378097f, 0.884804f, -0.272331f, 0.000000f, -0.043239f, -0.073203f, 0.033179f, 1.000000f },
+	{ -0.814065f, -0.179421f, 0.552365f, 0.000000f, 0.439607f, 0.431165f, 0.787936f, 0.000000f, -0.379532f, 0.884254f, -0.272122f, 0.000000f, -0.026946f, -0.075178f, 0.004140f, 1.000000f },
+	{ -0.919243f, -0.329390f, 0.215626f, 0.000000f, 0.101389f, 0.331158f, 0.938113f, 0.000000f, -0.380411f, 0.884215f, -0.271018f, 0.000000f, -0.012767f, -0.072053f, -0.005481f, 1.000000f },
+	{ -0.919243f, -0.329390f, 0.215626f, 0.000000f, 0.101389f, 0.331158f, 0.938113f, 0.000000f, -0.380411f, 0.884215f, -0.271018f, 0.000000f, 0.005105f, -0.065649f, -0.009673f, 1.000000f },
+	{ -0.285086f, 0.158361f, 0.945330f, 0.000000f, 0.953221f, 0.150225f, 0.262300f, 0.000000f, -0.100473f, 0.975887f, -0.193780f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ -0.853084f, 0.012158f, 0.521632f, 0.000000f, 0.511640f, 0.215564f, 0.831720f, 0.000000f, -0.102332f, 0.976414f, -0.190114f, 0.000000f, -0.040328f, -0.058634f, -0.012734f, 1.000000f },
+	{ -0.982726f, -0.067755f, 0.172217f, 0.000000f, 0.155459f, 0.202652f, 0.966833f, 0.000000f, -0.100407f, 0.976904f, -0.188618f, 0.000000f, -0.018340f, -0.058948f, -0.026179f, 1.000000f },
+	{ -0.982726f, -0.067755f, 0.172217f, 0.000000f, 0.155459f, 0.202652f, 0.966833f, 0.000000f, -0.100407f, 0.976904f, -0.188618f, 0.000000f, 0.005457f, -0.057307f, -0.030350f, 1.000000f },
+	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
+	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
+const D3DXMATRIX asPoseThumb[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.873055f, 0.478794f, -0.092359f, 0.000000f, 0.457723f, -0.739387f, 0.493758f, 0.000000f, 0.168119f, -0.473353f, -0.864681f, 0.000000f, -0.017789f, -0.032517f, 0.034155f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.854834f, 0.342633f, 0.389695f, 0.000000f, 0.417373f, 0.007788f, 0.908702f, 0.000000f, 0.308317f, 0.939437f, -0.149663f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.164652f, -0.102217f, -0.981041f, 0.000000f, -0.936939f, 0.327069f, 0.123172f, 0.000000f, 0.308278f, 0.939456f, -0.149624f, 0.000000f, -0.006155f, -0.020092f, 0.000807f, 1.000000f },
+	{ 0.925300f, -0.332639f, -0.182126f, 0.000000f, -0.220869f, -0.082301f, -0.971824f, 0.000000f, 0.308278f, 0.939456f, -0.149623f, 0.000000f, -0.002507f, -0.017828f, 0.022540f, 1.000000f },
+	{ 0.925300f, -0.332639f, -0.182126f, 0.000000f, -0.220870f, -0.082301f, -0.971824f, 0.000000f, 0.308278f, 0.939456f, -0.149623f, 0.000000f, -0.029454f, -0.008141f, 0.027844f, 1.000000f },
+	{ -0.977869f, 0.158235f, 0.136878f, 0.000000f, 0.177597f, 0.281927f, 0.942856f, 0.000000f, 0.110603f, 0.946298f, -0.303789f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ 0.225628f, -0.321589f, -0.919605f, 0.000000f, -0.967915f, 0.033169f, -0.249080f, 0.000000f, 0.110604f, 0.946299f, -0.303786f, 0.000000f, -0.008453f, -0.036600f, 0.011383f, 1.000000f },
+	{ 0.950941f, -0.011902f, 0.309144f, 0.000000f, 0.288927f, -0.323076f, -0.901191f, 0.000000f, 0.110603f, 0.946299f, -0.303786f, 0.000000f, -0.015129f, -0.027084f, 0.038595f, 1.000000f },
+	{ 0.950941f, -0.011902f, 0.309144f, 0.000000f, 0.288927f, -0.323076f, -0.901191f, 0.000000f, 0.110603f, 0.946298f, -0.303786f, 0.000000f, -0.040300f, -0.026769f, 0.030412f, 1.000000f },
+	{ -0.084677f, -0.366455f, -0.926575f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.291315f, 0.898389f, -0.328685f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.977396f, -0.207627f, -0.039860f, 0.000000f, -0.146268f, 0.527944f, 0.836589f, 0.000000f, -0.152654f, 0.823509f, -0.546379f, 0.000000f, -0.043976f, -0.070925f, 0.032356f, 1.000000f },
+	{ 0.504227f, -0.410589f, -0.759719f, 0.000000f, -0.849972f, -0.391474f, -0.352557f, 0.000000f, -0.152654f, 0.823508f, -0.546381f, 0.000000f, -0.011374f, -0.063999f, 0.033685f, 1.000000f },
+	{ 0.937856f, 0.295052f, 0.182676f, 0.000000f, 0.311646f, -0.484541f, -0.817372f, 0.000000f, -0.152653f, 0.823508f, -0.546381f, 0.000000f, -0.020157f, -0.056848f, 0.046918f, 1.000000f },
+	{ 0.937856f, 0.295052f, 0.182676f, 0.000000f, 0.311646f, -0.484541f, -0.817372f, 0.000000f, -0.152653f, 0.823508f, -0.546381f, 0.000000f, -0.038390f, -0.062584f, 0.043367f, 1.000000f },
+	{ -0.994334f, 0.009383f, 0.105885f, 0.000000f, 0.102164f, 0.359520f, 0.927528f, 0.000000f, -0.029365f, 0.933091f, -0.358441f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ 0.330609f, -0.329348f, -0.884437f, 0.000000f, -0.943311f, -0.144479f, -0.298815f, 0.000000f, -0.029368f, 0.933089f, -0.358444f, 0.000000f, -0.012971f, -0.052888f, 0.019645f, 1.000000f },
+	{ 0.911485f, 0.172192f, 0.373557f, 0.000000f, 0.410283f, -0.315746f, -0.855555f, 0.000000f, -0.029370f, 0.933089f, -0.358445f, 0.000000f, -0.021492f, -0.044399f, 0.042442f, 1.000000f },
+	{ 0.911485f, 0.172192f, 0.373556f, 0.000000f, 0.410283f, -0.315746f, -0.855555f, 0.000000f, -0.029370f, 0.933089f, -0.358445f, 0.000000f, -0.043564f, -0.048568f, 0.033396f, 1.000000f },
+	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
+	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
+const D3DXMATRIX asPoseThumbPoint[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.873328f, 0.478356f, -0.092057f, 0.000000f, 0.457158f, -0.739554f, 0.494031f, 0.000000f, 0.168241f, -0.473536f, -0.864558f, 0.000000f, -0.017798f, -0.032514f, 0.034158f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.028073f, -0.031060f, 0.999123f, 0.000000f, 0.976059f, -0.216521f, 0.020693f, 0.000000f, 0.215688f, 0.975784f, 0.036395f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.128360f, -0.008615f, 0.991690f, 0.000000f, 0.967989f, -0.218568f, 0.123394f, 0.000000f, 0.215688f, 0.975784f, 0.036395f, 0.000000f, -0.040527f, -0.004556f, -0.024530f, 1.000000f },
+	{ 0.020016f, -0.041683f, 0.998930f, 0.000000f, 0.976257f, -0.214729f, -0.028522f, 0.000000f, 0.215688f, 0.975784f, 0.036395f, 0.000000f, -0.037684f, -0.004365f, -0.046499f, 1.000000f },
+	{ 0.020016f, -0.041683f, 0.998931f, 0.000000f, 0.976257f, -0.214729f, -0.028522f, 0.000000f, 0.215688f, 0.975784f, 0.036395f, 0.000000f, -0.038267f, -0.003151f, -0.075590f, 1.000000f },
+	{ -0.977685f, 0.158394f, 0.138002f, 0.000000f, 0.178687f, 0.281557f, 0.942761f, 0.000000f, 0.110472f, 0.946381f, -0.303577f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ 0.224555f, -0.321313f, -0.919964f, 0.000000f, -0.968180f, 0.033462f, -0.248011f, 0.000000f, 0.110473f, 0.946382f, -0.303574f, 0.000000f, -0.008461f, -0.036607f, 0.011332f, 1.000000f },
+	{ 0.951671f, -0.012652f, 0.306859f, 0.000000f, 0.286565f, -0.322810f, -0.902040f, 0.000000f, 0.110470f, 0.946379f, -0.303583f, 0.000000f, -0.015106f, -0.027099f, 0.038554f, 1.000000f },
+	{ 0.951671f, -0.012652f, 0.306859f, 0.000000f, 0.286565f, -0.322810f, -0.902039f, 0.000000f, 0.110470f, 0.946379f, -0.303583f, 0.000000f, -0.040296f, -0.026764f, 0.030432f, 1.000000f },
+	{ -0.084385f, -0.367353f, -0.926246f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.291400f, 0.898022f, -0.329611f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.977447f, -0.207580f, -0.038828f, 0.000000f, -0.145511f, 0.528764f, 0.836203f, 0.000000f, -0.153048f, 0.822994f, -0.547044f, 0.000000f, -0.043961f, -0.070974f, 0.032372f, 1.000000f },
+	{ 0.503545f, -0.411366f, -0.759750f, 0.000000f, -0.850305f, -0.391740f, -0.351455f, 0.000000f, -0.153048f, 0.822993f, -0.547046f, 0.000000f, -0.011357f, -0.064049f, 0.033667f, 1.000000f },
+	{ 0.938332f, 0.294684f, 0.180816f, 0.000000f, 0.310016f, -0.485639f, -0.817340f, 0.000000f, -0.153046f, 0.822992f, -0.547047f, 0.000000f, -0.020128f, -0.056884f, 0.046900f, 1.000000f },
+	{ 0.938332f, 0.294684f, 0.180816f, 0.000000f, 0.310016f, -0.485639f, -0.817340f, 0.000000f, -0.153046f, 0.822992f, -0.547047f, 0.000000f, -0.038370f, -0.062613f, 0.043385f, 1.000000f },
+	{ -0.994575f, 0.008878f, 0.103643f, 0.000000f, 0.099886f, 0.359707f, 0.927703f, 0.000000f, -0.029045f, 0.933023f, -0.358643f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ 0.332772f, -0.329303f, -0.883641f, 0.000000f, -0.942560f, -0.145015f, -0.300918f, 0.000000f, -0.029048f, 0.933022f, -0.358645f, 0.000000f, -0.012962f, -0.052868f, 0.019731f, 1.000000f },
+	{ 0.911064f, 0.172331f, 0.374518f, 0.000000f, 0.411240f, -0.315871f, -0.855049f, 0.000000f, -0.029052f, 0.933021f, -0.358648f, 0.000000f, -0.021539f, -0.044380f, 0.042508f, 1.000000f },
+	{ 0.911064f, 0.172331f, 0.374518f, 0.000000f, 0.411240f, -0.315871f, -0.855049f, 0.000000f, -0.029052f, 0.933021f, -0.358648f, 0.000000f, -0.043600f, -0.048553f, 0.033439f, 1.000000f },
+	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
+	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
+const D3DXMATRIX asPoseThumbPointRelaxed[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.965588f, 0.248009f, 0.078304f, 0.000000f, 0.152356f, -0.783417f, 0.602532f, 0.000000f, 0.210778f, -0.569868f, -0.794244f, 0.000000f, -0.022382f, -0.030783f, 0.035504f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.028642f, -0.032745f, 0.999054f, 0.000000f, 0.974461f, -0.223610f, 0.020608f, 0.000000f, 0.222723f, 0.974129f, 0.038313f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.128762f, -0.009561f, 0.991630f, 0.000000f, 0.966341f, -0.225792f, 0.123301f, 0.000000f, 0.222723f, 0.974129f, 0.038313f, 0.000000f, -0.040503f, -0.004486f, -0.024527f, 1.000000f },
+	{ 0.019369f, -0.043714f, 0.998857f, 0.000000f, 0.974689f, -0.221726f, -0.028604f, 0.000000f, 0.222723f, 0.974129f, 0.038313f, 0.000000f, -0.037651f, -0.004274f, -0.046495f, 1.000000f },
+	{ 0.019369f, -0.043714f, 0.998857f, 0.000000f, 0.974690f, -0.221726f, -0.028604f, 0.000000f, 0.222723f, 0.974129f, 0.038313f, 0.000000f, -0.038215f, -0.003001f, -0.075583f, 1.000000f },
+	{ -0.248837f, 0.084483f, 0.964855f, 0.000000f, 0.960857f, -0.103740f, 0.256889f, 0.000000f, 0.121797f, 0.991010f, -0.055362f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ -0.801911f, 0.133349f, 0.582372f, 0.000000f, 0.584430f, -0.027262f, 0.810987f, 0.000000f, 0.124021f, 0.990694f, -0.056072f, 0.000000f, -0.041964f, -0.033209f, -0.026677f, 1.000000f },
+	{ -0.914252f, 0.135314f, 0.381883f, 0.000000f, 0.384824f, -0.004757f, 0.922979f, 0.000000f, 0.126709f, 0.990791f, -0.047723f, 0.000000f, -0.018235f, -0.037155f, -0.043909f, 1.000000f },
+	{ -0.914252f, 0.135314f, 0.381883f, 0.000000f, 0.384824f, -0.004757f, 0.922979f, 0.000000f, 0.126709f, 0.990791f, -0.047723f, 0.000000f, 0.005965f, -0.040737f, -0.054018f, 1.000000f },
+	{ -0.070894f, -0.408267f, -0.910106f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.294973f, 0.880176f, -0.371863f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.488416f, 0.059040f, 0.870612f, 0.000000f, 0.786454f, 0.462058f, 0.409870f, 0.000000f, -0.378074f, 0.884882f, -0.272108f, 0.000000f, -0.043243f, -0.073191f, 0.033175f, 1.000000f },
+	{ -0.814041f, -0.179511f, 0.552371f, 0.000000f, 0.439671f, 0.430967f, 0.788009f, 0.000000f, -0.379509f, 0.884332f, -0.271899f, 0.000000f, -0.026952f, -0.075161f, 0.004135f, 1.000000f },
+	{ -0.919148f, -0.329085f, 0.216497f, 0.000000f, 0.102333f, 0.331253f, 0.937977f, 0.000000f, -0.380389f, 0.884293f, -0.270794f, 0.000000f, -0.012772f, -0.072034f, -0.005487f, 1.000000f },
+	{ -0.919148f, -0.329085f, 0.216497f, 0.000000f, 0.102333f, 0.331253f, 0.937977f, 0.000000f, -0.380389f, 0.884293f, -0.270794f, 0.000000f, 0.005097f, -0.065636f, -0.009696f, 1.000000f },
+	{ -0.283980f, 0.158367f, 0.945662f, 0.000000f, 0.953555f, 0.149956f, 0.261237f, 0.000000f, -0.100436f, 0.975927f, -0.193596f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ -0.852493f, 0.012343f, 0.522593f, 0.000000f, 0.512632f, 0.215369f, 0.831159f, 0.000000f, -0.102291f, 0.976455f, -0.189928f, 0.000000f, -0.040371f, -0.058634f, -0.012747f, 1.000000f },
+	{ -0.982549f, -0.067511f, 0.173318f, 0.000000f, 0.156601f, 0.202540f, 0.966672f, 0.000000f, -0.100365f, 0.976944f, -0.188433f, 0.000000f, -0.018397f, -0.058953f, -0.026217f, 1.000000f },
+	{ -0.982549f, -0.067511f, 0.173318f, 0.000000f, 0.156601f, 0.202540f, 0.966672f, 0.000000f, -0.100365f, 0.976944f, -0.188433f, 0.000000f, 0.005395f, -0.057318f, -0.030414f, 1.000000f },
+	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
+	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
+	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
+const D3DXMATRIX asPosePointRelaxed[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.965632f, 0.247777f, 0.078487f, 0.000000f, 0.152041f, -0.783420f, 0.602609f, 0.000000f, 0.210801f, -0.569966f, -0.794168f, 0.000000f, -0.022387f, -0.030781f, 0.035506f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.028060f, -0.031067f, 0.999123f, 0.000000f, 0.976058f, -0.216524f, 0.020680f, 0.000000f, 0.215691f, 0.975783f, 0.036399f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.128348f, -0.008621f, 0.991692f, 0.000000f, 0.967990f, -0.218571f, 0.123380f, 0.000000f, 0.215691f, 0.975783f, 0.036398f, 0.000000f, -0.040528f, -0.004556f, -0.024530f, 1.000000f },
+	{ 0.020029f, -0.041689f, 0.998930f, 0.000000f, 0.976256f, -0.214731f, -0.028536f, 0.000000f, 0.215691f, 0.975783f, 0.036398f, 0.000000f, -0.037684f, -0.004365f, -0.046499f, 1.000000f },
+	{ 0.020029f, -0.041689f, 0.998930f, 0.000000f, 0.976256f, -0.214731f, -0.028536f, 0.000000f, 0.215691f, 0.975783f, 0.036398f, 0.000000f, -0.038268f, -0.003151f, -0.075590f, 1.000000f },
+	{ -0.249908f, 0.084769f, 0.964552f, 0.000000f, 0.960598f, -0.103446f, 0.257975f, 0.000000f, 0.121647f, 0.991016f, -0.055577f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ -0.802575f, 0.133384f, 0.581449f, 0.000000f, 0.583549f, -0.026853f, 0.811634f, 0.000000f, 0.123872f, 0.990700f, -0.056285f, 0.000000f, -0.041915f, -0.033223f, -0.026663f, 1.000000f },
+	{ -0.914697f, 0.135254f, 0.380837f, 0.000000f, 0.383817f, -0.004351f, 0.923400f, 0.000000f, 0.126551f, 0.990801f, -0.047933f, 0.000000f, -0.018166f, -0.037170f, -0.043868f, 1.000000f },
+	{ -0.914697f, 0.135254f, 0.380836f, 0.000000f, 0.383816f, -0.004351f, 0.923400f, 0.000000f, 0.126551f, 0.990801f, -0.047933f, 0.000000f, 0.006045f, -0.040750f, -0.053949f, 1.000000f },
+	{ -0.070824f, -0.408476f, -0.910017f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.294990f, 0.880078f, -0.372080f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.488469f, 0.059216f, 0.870570f, 0.000000f, 0.786410f, 0.462185f, 0.409810f, 0.000000f, -0.378097f, 0.884804f, -0.272331f, 0.000000f, -0.043239f, -0.073203f, 0.033179f, 1.000000f },
+	{ -0.814065f, -0.179421f, 0.552365f, 0.000000f, 0.439607f, 0.431165f, 0.787936f, 0.000000f, -0.379532f, 0.884254f, -0.272122f, 0.000000f, -0.026946f, -0.075178f, 0.004140f, 1.000000f },
+	{ -0.919243f, -0.329390f, 0.215626f, 0.000000f, 0.101389f, 0.331158f, 0.938113f, 0.000000f, -0.380411f, 0.884215f, -0.271018f, 0.000000f, -0.012767f, -0.072053f, -0.005481f, 1.000000f },
+	{ -0.919243f, -0.329390f, 0.215626f, 0.000000f, 0.101389f, 0.331158f, 0.938113f, 0.000000f, -0.380411f, 0.884215f, -0.271018f, 0.000000f, 0.005105f, -0.065649f, -0.009673f, 1.000000f },
+	{ -0.285086f, 0.158361f, 0.945330f, 0.000000f, 0.953221f, 0.150225f, 0.262300f, 0.000000f, -0.100473f, 0.975887f, -0.193780f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ -0.853084f, 0.012158f, 0.521632f, 0.000000f, 0.511640f, 0.215564f, 0.831720f, 0.000000f, -0.102332f, 0.976414f, -0.190114f, 0.000000f, -0.040328f, -0.058634f, -0.012734f, 1.000000f },
+	{ -0.982726f, -0.067755f, 0.172217f, 0.000000f, 0.155459f, 0.202652f, 0.966833f, 0.000000f, -0.100407f, 0.976904f, -0.188618f, 0.000000f, -0.018340f, -0.058948f, -0.026179f, 1.000000f },
+	{ -0.982726f, -0.067755f, 0.172217f, 0.000000f, 0.155459f, 0.202652f, 0.966833f, 0.000000f, -0.100407f, 0.976904f, -0.188618f, 0.000000f, 0.005457f, -0.057307f, -0.030350f, 1.000000f },
+	{ -0.481274f, -0.152774f, 0.863155f, 0.000000f, -0.249293f, -0.920180f, -0.301866f, 0.000000f, 0.840375f, -0.360458f, 0.404773f, 0.000000f, -0.009764f, 0.002759f, 0.075239f, 1.000000f },
+	{ -0.391518f, 0.112725f, 0.913240f, 0.000000f, -0.374813f, -0.925939f, -0.046395f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.005920f, 0.007738f, 0.047110f, 1.000000f },
+	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.016245f, 0.004765f, 0.023026f, 1.000000f },
+	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.029808f, 0.001475f, -0.008064f, 1.000000f } };
+const D3DXMATRIX asPosePoint[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.873464f, 0.478136f, -0.091907f, 0.000000f, 0.456876f, -0.739637f, 0.494167f, 0.000000f, 0.168302f, -0.473627f, -0.864496f, 0.000000f, -0.017803f, -0.032512f, 0.034159f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.031458f, -0.032147f, 0.998988f, 0.000000f, 0.973844f, -0.226012f, 0.023394f, 0.000000f, 0.225031f, 0.973594f, 0.038416f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.131500f, -0.008720f, 0.991278f, 0.000000f, 0.965437f, -0.228120f, 0.126066f, 0.000000f, 0.225031f, 0.973594f, 0.038416f, 0.000000f, -0.040386f, -0.004511f, -0.024524f, 1.000000f },
+	{ 0.016526f, -0.043236f, 0.998928f, 0.000000f, 0.974211f, -0.224155f, -0.025819f, 0.000000f, 0.225031f, 0.973594f, 0.038416f, 0.000000f, -0.037473f, -0.004318f, -0.046484f, 1.000000f },
+	{ 0.016526f, -0.043236f, 0.998928f, 0.000000f, 0.974212f, -0.224155f, -0.025819f, 0.000000f, 0.225031f, 0.973594f, 0.038416f, 0.000000f, -0.037955f, -0.003059f, -0.075575f, 1.000000f },
+	{ -0.978051f, 0.158075f, 0.135755f, 0.000000f, 0.176508f, 0.282296f, 0.942950f, 0.000000f, 0.110734f, 0.946215f, -0.304001f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ 0.227924f, -0.321908f, -0.918928f, 0.000000f, -0.967363f, 0.032467f, -0.251310f, 0.000000f, 0.110734f, 0.946215f, -0.304001f, 0.000000f, -0.008444f, -0.036592f, 0.011435f, 1.000000f },
+	{ 0.950238f, -0.011182f, 0.311325f, 0.000000f, 0.291181f, -0.323348f, -0.900367f, 0.000000f, 0.110734f, 0.946214f, -0.304001f, 0.000000f, -0.015189f, -0.027067f, 0.038627f, 1.000000f },
+	{ 0.950238f, -0.011182f, 0.311325f, 0.000000f, 0.291182f, -0.323348f, -0.900367f, 0.000000f, 0.110734f, 0.946214f, -0.304001f, 0.000000f, -0.040341f, -0.026771f, 0.030386f, 1.000000f },
+	{ -0.084080f, -0.368294f, -0.925900f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.291488f, 0.897636f, -0.330581f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.977198f, -0.208335f, -0.041010f, 0.000000f, -0.147937f, 0.529470f, 0.835330f, 0.000000f, -0.152315f, 0.822350f, -0.548217f, 0.000000f, -0.043944f, -0.071024f, 0.032389f, 1.000000f },
+	{ 0.506891f, -0.411181f, -0.757623f, 0.000000f, -0.848447f, -0.393284f, -0.354213f, 0.000000f, -0.152315f, 0.822350f, -0.548217f, 0.000000f, -0.011349f, -0.064075f, 0.033757f, 1.000000f },
+	{ 0.936633f, 0.297157f, 0.185516f, 0.000000f, 0.315465f, -0.485221f, -0.815501f, 0.000000f, -0.152315f, 0.822349f, -0.548217f, 0.000000f, -0.020178f, -0.056913f, 0.046953f, 1.000000f },
+	{ 0.936633f, 0.297157f, 0.185516f, 0.000000f, 0.315465f, -0.485221f, -0.815501f, 0.000000f, -0.152315f, 0.822350f, -0.548217f, 0.000000f, -0.038388f, -0.062690f, 0.043347f, 1.000000f },
+	{ -0.994455f, 0.009131f, 0.104764f, 0.000000f, 0.101025f, 0.359614f, 0.927617f, 0.000000f, -0.029205f, 0.933057f, -0.358542f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ 0.332862f, -0.329145f, -0.883667f, 0.000000f, -0.942523f, -0.145153f, -0.300967f, 0.000000f, -0.029205f, 0.933057f, -0.358542f, 0.000000f, -0.012966f, -0.052878f, 0.019688f, 1.000000f },
+	{ 0.909993f, 0.173236f, 0.376700f, 0.000000f, 0.413594f, -0.315270f, -0.854135f, 0.000000f, -0.029205f, 0.933057f, -0.358542f, 0.000000f, -0.021546f, -0.044394f, 0.042465f, 1.000000f },
+	{ 0.909993f, 0.173236f, 0.376699f, 0.000000f, 0.413594f, -0.315270f, -0.854135f, 0.000000f, -0.029205f, 0.933057f, -0.358542f, 0.000000f, -0.043581f, -0.048589f, 0.033343f, 1.000000f },
+	{ -0.475331f, -0.046678f, 0.878568f, 0.000000f, -0.327112f, -0.917629f, -0.225730f, 0.000000f, 0.816736f, -0.394687f, 0.420908f, 0.000000f, -0.010062f, 0.001933f, 0.070744f, 1.000000f },
+	{ -0.377346f, 0.504038f, 0.776889f, 0.000000f, -0.578953f, -0.783155f, 0.226898f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.005428f, 0.003454f, 0.042113f, 1.000000f },
+	{ 0.448220f, 0.893919f, 0.002662f, 0.000000f, -0.525999f, 0.261331f, 0.809340f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.015379f, -0.009838f, 0.021625f, 1.000000f },
+	{ 0.448220f, 0.893919f, 0.002662f, 0.000000f, -0.525999f, 0.261331f, 0.809340f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.000104f, -0.040302f, 0.021535f, 1.000000f } };
+const D3DXMATRIX asPosePinch[] = {
+	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
+	{ 0.965586f, 0.248018f, 0.078298f, 0.000000f, 0.152368f, -0.783417f, 0.602530f, 0.000000f, 0.210778f, -0.569865f, -0.794247f, 0.000000f, -0.022383f, -0.030783f, 0.035505f, 1.000000f },
+	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
+	{ -0.513859f, 0.107625f, 0.851098f, 0.000000f, 0.781942f, -0.349319f, 0.516278f, 0.000000f, 0.352869f, 0.930803f, 0.095344f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
+	{ -0.912018f, 0.319422f, 0.257282f, 0.000000f, 0.208909f, -0.178042f, 0.961592f, 0.000000f, 0.352961f, 0.930737f, 0.095647f, 0.000000f, -0.020331f, -0.010322f, -0.018376f, 1.000000f },
+	{ -0.773463f, 0.347774f, -0.529913f, 0.000000f, -0.526473f, 0.113058f, 0.842642f, 0.000000f, 0.352961f, 0.930737f, 0.095647f, 0.000000f, -0.000127f, -0.017398f, -0.024076f, 1.000000f },
+	{ -0.773464f, 0.347774f, -0.529913f, 0.000000f, -0.526473f, 0.113058f, 0.842642f, 0.000000f, 0.352961f, 0.930737f, 0.095647f, 0.000000f, 0.022398f, -0.027526f, -0.008644f, 1.000000f },
+	{ -0.543003f, 0.123726f, 0.830567f, 0.000000f, 0.827865f, -0.086813f, 0.554169f, 0.000000f, 0.140669f, 0.988512f, -0.055288f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
+	{ -0.920718f, 0.151161f, 0.359762f, 0.000000f, 0.363985f, 0.000291f, 0.931405f, 0.000000f, 0.140688f, 0.988509f, -0.055288f, 0.000000f, -0.028442f, -0.035013f, -0.020504f, 1.000000f },
+	{ -0.984336f, 0.145646f, 0.099351f, 0.000000f, 0.106252f, 0.040378f, 0.993520f, 0.000000f, 0.140691f, 0.988513f, -0.055220f, 0.000000f, -0.001198f, -0.039486f, -0.031149f, 1.000000f },
+	{ -0.984336f, 0.145646f, 0.099351f, 0.000000f, 0.106252f, 0.040378f, 0.993519f, 0.000000f, 0.140690f, 0.988513f, -0.055220f, 0.000000f, 0.024857f, -0.043341f, -0.033779f, 1.000000f },
+	{ -0.052164f, -0.390756f, -0.919015f, 0.000000f, -0.954273f, -0.251746f, 0.161205f, 0.000000f, -0.294350f, 0.885401f, -0.359755f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
+	{ -0.370200f, 0.154532f, 0.916009f, 0.000000f, 0.821452f, 0.514911f, 0.245119f, 0.000000f, -0.433784f, 0.843200f, -0.317561f, 0.000000f, -0.042242f, -0.072269f, 0.032662f, 1.000000f },
+	{ -0.757591f, -0.150557f, 0.635129f, 0.000000f, 0.487727f, 0.516094f, 0.704108f, 0.000000f, -0.433795f, 0.843196f, -0.317558f, 0.000000f, -0.029894f, -0.077424f, 0.002108f, 1.000000f },
+	{ -0.876835f, -0.313994f, 0.364100f, 0.000000f, 0.207302f, 0.436380f, 0.875556f, 0.000000f, -0.433805f, 0.843197f, -0.317541f, 0.000000f, -0.016698f, -0.074801f, -0.008955f, 1.000000f },
+	{ -0.876834f, -0.313994f, 0.364100f, 0.000000f, 0.207302f, 0.436380f, 0.875556f, 0.000000f, -0.433805f, 0.843197f, -0.317541f, 0.000000f, 0.000349f, -0.068697f, -0.016033f, 1.000000f },
+	{ -0.428550f, 0.103824f, 0.897533f, 0.000000f, 0.901761f, 0.111065f, 0.417722f, 0.000000f, -0.056315f, 0.988375f, -0.141222f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
+	{ -0.870642f, 0.020596f, 0.491485f, 0.000000f, 0.488681f, 0.150620f, 0.859363f, 0.000000f, -0.056328f, 0.988377f, -0.141201f, 0.000000f, -0.034794f, -0.056531f, -0.010890f, 1.000000f },
+	{ -0.967508f, -0.019112f, 0.252115f, 0.000000f, 0.246487f, 0.150804f, 0.957342f, 0.000000f, -0.056316f, 0.988379f, -0.141193f, 0.000000f, -0.012353f, -0.057061f, -0.023559f, 1.000000f },
+	{ -0.967508f, -0.019112f, 0.252115f, 0.000000f, 0.246487f, 0.150804f, 0.957342f, 0.000000f, -0.056316f, 0.988379f, -0.141193f, 0.000000f, 0.011075f, -0.056599f, -0.029664f, 1.000000f },
+	{ -0.550105f, 0.366842f, 0.750207f, 0.000000f, -0.600946f, -0.797686f, -0.050597f, 0.000000f, 0.579868f, -0.478668f, 0.659264f, 0.000000f, -0.010062f, 0.001935f, 0.070753f, 1.000000f },
+	{ -0.392654f, 0.123396f, 0.911370f, 0.000000f, -0.787999f, -0.556105f, -0.264206f, 0.000000f, 0.474215f, -0.821901f, 0.315593f, 0.000000f, 0.007865f, -0.010020f, 0.046305f, 1.000000f },
+	{ -0.142559f, 0.282300f, 0.948674f, 0.000000f, -0.959244f, -0.275667f, -0.062117f, 0.000000f, 0.243982f, -0.918866f, 0.310093f, 0.000000f, 0.018220f, -0.013274f, 0.022271f, 1.000000f },
+	{ -0.142559f, 0.282300f, 0.948674f, 0.000000f, -0.959244f, -0.275667f, -0.062117f, 0.000000f, 0.243982f, -0.918866f, 0.310093f, 0.000000f, 0.023079f, -0.022895f, -0.010060f, 1.000000f } };
+
+#pragma endregion
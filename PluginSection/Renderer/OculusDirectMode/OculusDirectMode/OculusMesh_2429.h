@@ -1,3357 +0,0 @@
-/********************************************************************
-Vireio Perception: Open-Source Stereoscopic 3D Driver
-Copyright (C) 2012 Andres Hernandez
-This file was exported from Vireio using Oculus Avatar SDK.
-Data Copyright : Copyright 2014-2016 Oculus VR, LLC All Rights reserved.
-
-Vireio Perception Version History :.
-v1.0.0 2012 by Andres Hernandez.
-v1.0.X 2013 by John Hicks, Neil Schneider.
-v1.1.x 2013 by Primary Coding Author : Chris Drain.
-Team Support : John Hicks, Phil Larkson, Neil Schneider.
-v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown.
-v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown, Samuel Austin.
-and Neil Schneider.
-
-This program is free software : you can redistribute it and / or modify.
-it under the terms of the GNU Lesser General Public License as published by.
-the Free Software Foundation, either version 3 of the License, or.
-(at your option) any later version..
-
-This program is distributed in the hope that it will be useful,.
-but WITHOUT ANY WARRANTY; without even the implied warranty of.
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the.
-GNU Lesser General Public License for more details..
-
-You should have received a copy of the GNU Lesser General Public License.
-along with this program.If not, see < http://www.gnu.org/licenses/>..
-********************************************************************/
-
-const uint32_t unAvatarVertexCount_2429 = 2429;
-const ovrAvatarMeshVertex asAvatarVertices_2429[] = {
-	{ 0.024026,1.731126,-0.108193,0.141438,-0.536747,-0.831804,-0.956327,0.143035,-0.254910,-1.000000,0.463220,0.719900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026145,1.729390,-0.107025,-0.043419,-0.478275,-0.877136,-0.978615,0.197056,-0.059006,-1.000000,0.460540,0.718060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028895,1.730705,-0.107918,-0.054529,-0.328519,-0.942922,-0.981096,0.193230,-0.010586,-1.000000,0.458480,0.720830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027236,1.732929,-0.108825,0.093213,-0.433546,-0.896297,-0.965345,0.181045,-0.187967,-1.000000,0.460980,0.723010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021184,1.728799,-0.106896,0.204813,-0.597722,-0.775100,-0.943529,0.090102,-0.318802,-1.000000,0.464360,0.716010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023665,1.727656,-0.105696,-0.005105,-0.561561,-0.827420,-0.980779,0.164208,-0.105395,-1.000000,0.461540,0.714800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019804,1.725830,-0.104709,0.255446,-0.529864,-0.808697,-0.935304,0.076403,-0.345497,-1.000000,0.463550,0.711340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022009,1.725455,-0.104223,0.050934,-0.507996,-0.859852,-0.973332,0.167579,-0.156661,-1.000000,0.461360,0.711240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.017139,1.726073,-0.106249,0.432325,-0.500190,-0.750270,-0.860587,0.019555,-0.508928,-1.000000,0.466700,0.711650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.017707,1.730631,-0.109593,0.350609,-0.547461,-0.759842,-0.897561,0.035156,-0.439485,-1.000000,0.469260,0.718280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021291,1.733691,-0.110420,0.252467,-0.517616,-0.817517,-0.942384,0.060109,-0.329088,-1.000000,0.466900,0.722800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025253,1.735806,-0.110673,0.203942,-0.447041,-0.870955,-0.952350,0.115509,-0.282290,-1.000000,0.464270,0.726450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.030208,1.729149,-0.107757,-0.086801,-0.395157,-0.914503,-0.990888,0.129143,0.038249,-1.000000,0.456400,0.718920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027435,1.728086,-0.106725,-0.143164,-0.461286,-0.875625,-0.978932,0.196148,0.056723,-1.000000,0.458370,0.716630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025289,1.726745,-0.105509,-0.142990,-0.498873,-0.854798,-0.976235,0.213201,0.038877,-1.000000,0.459460,0.714080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021759,1.722500,-0.103005,0.171277,-0.481594,-0.859495,-0.944215,0.168834,-0.282761,-1.000000,0.460060,0.708130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020308,1.722142,-0.103033,0.293441,-0.340573,-0.893254,-0.915266,0.169687,-0.365369,-1.000000,0.461520,0.707100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023920,1.721336,-0.101155,0.029693,-0.325922,-0.944930,-0.981248,0.170614,-0.089682,-1.000000,0.457490,0.706250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022138,1.720225,-0.101717,0.203568,-0.143521,-0.968484,-0.962557,0.151526,-0.224776,-1.000000,0.458670,0.704430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028859,1.718988,-0.101519,-0.173906,-0.212031,-0.961665,-0.966952,0.221655,0.125991,-1.000000,0.452620,0.705060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027380,1.717340,-0.100810,-0.044266,-0.009446,-0.998975,-0.974805,0.219234,0.041121,-1.000000,0.452840,0.702420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020581,1.718524,-0.102129,0.310454,-0.056419,-0.948913,-0.940911,0.123839,-0.315199,-1.000000,0.459270,0.702000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025418,1.715481,-0.100870,0.058043,0.002854,-0.998310,-0.984046,0.168630,-0.056731,-1.000000,0.453260,0.699340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.033216,1.715290,-0.101907,-0.032156,-0.050457,-0.998208,-0.995558,0.090042,0.027519,-1.000000,0.446930,0.701180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031350,1.713191,-0.101808,-0.042541,-0.045931,-0.998038,-0.996631,0.072056,0.039165,-1.000000,0.447260,0.697110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.039680,1.714648,-0.101361,0.289225,-0.060301,-0.955360,-0.957127,-0.034921,-0.287556,-1.000000,0.441060,0.700260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.037869,1.712043,-0.101512,0.167175,-0.101973,-0.980640,-0.985927,-0.016630,-0.166347,-1.000000,0.441090,0.695200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045485,1.715275,-0.098409,0.552076,0.004204,-0.833783,-0.833455,-0.025694,-0.551989,-1.000000,0.435070,0.700620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044416,1.712121,-0.099269,0.438864,-0.028390,-0.898105,-0.898330,-0.036171,-0.437831,-1.000000,0.434520,0.694760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049433,1.716384,-0.094905,0.625568,-0.015223,-0.780021,-0.779964,-0.035171,-0.624835,-1.000000,0.429240,0.702390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049470,1.713040,-0.095421,0.567508,0.092737,-0.818129,-0.820149,-0.024107,-0.571642,-1.000000,0.427400,0.696280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051959,1.718243,-0.093041,0.565398,-0.240000,-0.789129,-0.818603,-0.046044,-0.572512,-1.000000,0.425440,0.704600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.052497,1.714785,-0.092524,0.579371,0.110558,-0.807531,-0.809683,-0.035583,-0.585787,-1.000000,0.422340,0.699060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040361,1.717386,-0.101365,0.355094,-0.188373,-0.915655,-0.934752,-0.058837,-0.350396,-1.000000,0.441780,0.704090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.034413,1.717387,-0.102316,-0.006215,-0.228599,-0.973501,-0.998317,0.057558,-0.007143,-1.000000,0.447130,0.704440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045283,1.718113,-0.098428,0.572614,-0.140945,-0.807618,-0.816356,-0.007499,-0.577501,-1.000000,0.436580,0.704510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048773,1.719189,-0.095715,0.583792,-0.231421,-0.778223,-0.797689,0.015086,-0.602881,-1.000000,0.432000,0.706000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051442,1.720986,-0.095050,0.452254,-0.478590,-0.752607,-0.850239,0.023508,-0.525872,-1.000000,0.428870,0.708130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.053736,1.710060,-0.093171,0.399483,0.430860,-0.809180,-0.886997,-0.041353,-0.459920,-1.000000,0.419370,0.691200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048959,1.707646,-0.096591,0.354312,0.374495,-0.856864,-0.915756,-0.046585,-0.399024,-1.000000,0.425880,0.687080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042296,1.707018,-0.099708,0.267264,0.242802,-0.932533,-0.955711,-0.056968,-0.288739,-1.000000,0.434670,0.686440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035278,1.707857,-0.101070,0.100372,0.086371,-0.991194,-0.993790,-0.039394,-0.104067,-1.000000,0.442090,0.688620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057118,1.705430,-0.095225,0.415137,0.437252,-0.797792,-0.886950,0.000000,-0.461865,-1.000000,0.415170,0.682470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051093,1.700461,-0.100627,0.348125,0.370299,-0.861213,-0.922258,-0.029428,-0.385454,-1.000000,0.423050,0.674740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061278,1.700722,-0.094786,0.629757,0.221657,-0.744496,-0.773331,0.088528,-0.627791,-1.000000,0.409960,0.675740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058321,1.693468,-0.099225,0.624664,0.099093,-0.774581,-0.778970,0.009482,-0.626990,-1.000000,0.414360,0.665170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.047525,1.692641,-0.105025,0.355229,0.304118,-0.883926,-0.915379,-0.078482,-0.394870,-1.000000,0.426690,0.664320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038860,1.696501,-0.105224,0.187645,0.465448,-0.864955,-0.951391,-0.132824,-0.277872,-1.000000,0.437170,0.670700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040670,1.701474,-0.102258,0.173632,0.418870,-0.891291,-0.969701,-0.085211,-0.228952,-1.000000,0.435330,0.677750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.030921,1.699589,-0.104284,0.212464,0.542719,-0.812598,-0.946195,-0.093452,-0.309810,-1.000000,0.446070,0.676660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032907,1.703272,-0.101978,0.114791,0.361803,-0.925160,-0.986370,-0.069011,-0.149374,-1.000000,0.443920,0.681980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.037109,1.692059,-0.108272,0.246670,0.446365,-0.860181,-0.922026,-0.165180,-0.350120,-1.000000,0.439100,0.665750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044875,1.687120,-0.107752,0.395759,0.264917,-0.879314,-0.891736,-0.118003,-0.436901,-1.000000,0.429390,0.658310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035613,1.688273,-0.110458,0.281356,0.376497,-0.882660,-0.928683,-0.124782,-0.349252,-1.000000,0.440850,0.661760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042729,1.682757,-0.109909,0.410978,0.222642,-0.884040,-0.898557,-0.064799,-0.434046,-1.000000,0.431570,0.653700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029365,1.696254,-0.107648,0.290637,0.561122,-0.775031,-0.908388,-0.092661,-0.407733,-1.000000,0.448010,0.672540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023987,1.703654,-0.103806,0.420319,0.494252,-0.760952,-0.874965,-0.001370,-0.484185,-1.000000,0.453880,0.682940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026151,1.706693,-0.101863,0.238112,0.296604,-0.924840,-0.968175,-0.003072,-0.250254,-1.000000,0.451270,0.687160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022763,1.701155,-0.107335,0.499954,0.552115,-0.667244,-0.801502,0.003104,-0.597984,-1.000000,0.455970,0.679210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028328,1.693281,-0.110035,0.310237,0.470315,-0.826170,-0.925805,-0.047952,-0.374948,-1.000000,0.449610,0.668890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054160,1.686324,-0.102602,0.629403,0.042183,-0.775933,-0.771801,-0.082252,-0.630522,-1.000000,0.419060,0.656570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050896,1.680650,-0.105482,0.637127,0.037474,-0.769847,-0.763857,-0.102661,-0.637168,-1.000000,0.422780,0.650750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057278,1.677648,-0.097872,0.803019,-0.157944,-0.574643,-0.595825,-0.192692,-0.779655,-1.000000,0.413540,0.645440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062002,1.685009,-0.093592,0.806562,-0.145023,-0.573084,-0.584944,-0.055694,-0.809159,-1.000000,0.407190,0.653470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061347,1.672685,-0.088311,0.876597,-0.230525,-0.422418,-0.465251,-0.181686,-0.866332,-1.000000,0.403000,0.635070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058237,1.667897,-0.092260,0.870707,-0.207268,-0.445992,-0.486777,-0.233903,-0.841628,-1.000000,0.408840,0.630140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054005,1.672640,-0.101069,0.794138,-0.138316,-0.591789,-0.607736,-0.183525,-0.772642,-1.000000,0.418160,0.640240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.055390,1.663991,-0.095737,0.848267,-0.192769,-0.493237,-0.527771,-0.231071,-0.817352,-1.000000,0.414050,0.625710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064819,1.696838,-0.091844,0.802109,0.009937,-0.597095,-0.594435,0.109008,-0.796721,-1.000000,0.404920,0.671060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061747,1.662738,-0.080897,0.926102,-0.202789,-0.318138,-0.341151,-0.090064,-0.935684,-1.000000,0.396330,0.618320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058658,1.658547,-0.086936,0.907462,-0.191892,-0.373752,-0.405397,-0.166388,-0.898870,-1.000000,0.404690,0.612870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056455,1.655626,-0.090400,0.872536,-0.197327,-0.446926,-0.484261,-0.228386,-0.844589,-1.000000,0.409940,0.609410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048313,1.676206,-0.107703,0.617563,0.019391,-0.786283,-0.786184,-0.014072,-0.617832,-1.000000,0.425410,0.645880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051367,1.668839,-0.103682,0.763243,-0.148037,-0.628923,-0.644228,-0.100100,-0.758255,-1.000000,0.421360,0.635910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.052932,1.660820,-0.098523,0.819696,-0.198304,-0.537377,-0.570689,-0.202296,-0.795858,-1.000000,0.417750,0.622050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054224,1.652083,-0.093142,0.854731,-0.207857,-0.475636,-0.515545,-0.233334,-0.824481,-1.000000,0.413980,0.605310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054815,1.641675,-0.087001,0.874508,-0.271117,-0.402158,-0.462905,-0.219090,-0.858905,-1.000000,0.410630,0.587140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057873,1.647074,-0.083183,0.909444,-0.225394,-0.349442,-0.389843,-0.169741,-0.905103,-1.000000,0.403940,0.593690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062268,1.707139,-0.090464,0.616476,0.381003,-0.689053,-0.771214,0.115795,-0.625955,-1.000000,0.406900,0.685750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059028,1.709913,-0.090763,0.457071,0.466533,-0.757253,-0.859165,0.011382,-0.511572,-1.000000,0.410960,0.690380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061662,1.713060,-0.087171,0.565959,0.351267,-0.745857,-0.811631,0.078578,-0.578862,-1.000000,0.405520,0.696360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059265,1.714628,-0.087840,0.512183,0.298474,-0.805346,-0.852527,0.062876,-0.518887,-1.000000,0.408830,0.699030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064108,1.712345,-0.085495,0.700209,0.300548,-0.647594,-0.698989,0.103952,-0.707536,-1.000000,0.402070,0.695450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065223,1.705131,-0.088474,0.766247,0.250870,-0.591548,-0.636183,0.166965,-0.753255,-1.000000,0.403060,0.683640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066615,1.712463,-0.082555,0.823484,0.249582,-0.509493,-0.544108,0.093079,-0.833836,-1.000000,0.398170,0.696210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067984,1.704148,-0.084942,0.859379,0.169714,-0.482354,-0.502839,0.109197,-0.857455,-1.000000,0.398900,0.683240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057312,1.717491,-0.088738,0.653589,-0.002538,-0.756845,-0.753425,0.092836,-0.650947,-1.000000,0.412820,0.703540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056147,1.713437,-0.090271,0.504216,0.297481,-0.810723,-0.848387,-0.004673,-0.529355,-1.000000,0.415140,0.696910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054571,1.717523,-0.091002,0.609840,-0.114701,-0.784180,-0.789208,0.002527,-0.614120,-1.000000,0.419250,0.703340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056485,1.722108,-0.091601,0.794647,-0.239355,-0.557893,-0.562139,0.056854,-0.825086,-1.000000,0.418380,0.709590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.055690,1.722868,-0.093635,0.763768,-0.314392,-0.563752,-0.593646,0.000000,-0.804726,-1.000000,0.422190,0.710520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054208,1.720695,-0.093194,0.570455,-0.454567,-0.684069,-0.773450,-0.017102,-0.633627,-1.000000,0.423320,0.707700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.053041,1.723654,-0.096666,0.521711,-0.500358,-0.690984,-0.798367,0.000000,-0.602172,-1.000000,0.428190,0.711580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054928,1.725253,-0.095661,0.787219,-0.145513,-0.599260,-0.612253,-0.068274,-0.787709,-1.000000,0.425600,0.713380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057632,1.725334,-0.091138,0.754807,-0.308890,-0.578665,-0.523993,0.246736,-0.815201,-1.000000,0.417000,0.713650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.055540,1.726770,-0.094534,0.768633,-0.187506,-0.611592,-0.622058,0.003831,-0.782962,-1.000000,0.423340,0.715040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056695,1.728327,-0.094195,0.627712,-0.401598,-0.666856,-0.687656,0.115425,-0.716803,-1.000000,0.421840,0.717530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058454,1.727290,-0.091700,0.607847,-0.482704,-0.630491,-0.501087,0.382774,-0.776142,-1.000000,0.416830,0.716760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057778,1.729497,-0.094143,0.571601,-0.468295,-0.673774,-0.651307,0.240498,-0.719695,-1.000000,0.420250,0.720020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059035,1.726487,-0.090498,0.597781,-0.461169,-0.655730,-0.455548,0.477650,-0.751217,-1.000000,0.413720,0.716660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058087,1.722255,-0.088645,0.748023,-0.233503,-0.621239,-0.543004,0.322871,-0.775178,-1.000000,0.412040,0.710230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059107,1.720125,-0.087103,0.583671,-0.096507,-0.806234,-0.745804,0.328927,-0.579296,-1.000000,0.408450,0.708330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.060694,1.719267,-0.085961,0.605743,-0.001202,-0.795659,-0.778585,0.205165,-0.593054,-1.000000,0.405600,0.707950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063058,1.719381,-0.084266,0.739875,0.038323,-0.671652,-0.671902,0.092017,-0.734901,-1.000000,0.402110,0.708880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059944,1.725762,-0.089169,0.613365,-0.385909,-0.689099,-0.537255,0.435662,-0.722188,-1.000000,0.410680,0.717050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058772,1.729987,-0.093631,0.618474,-0.413787,-0.668034,-0.612718,0.278336,-0.739666,-1.000000,0.417670,0.722330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.060156,1.730536,-0.092661,0.725487,-0.295699,-0.621475,-0.585492,0.209471,-0.783148,-1.000000,0.415180,0.724550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061544,1.725748,-0.087796,0.716401,-0.280388,-0.638868,-0.580096,0.269371,-0.768718,-1.000000,0.407730,0.718540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061755,1.731827,-0.091015,0.814778,-0.175090,-0.552703,-0.530664,0.158754,-0.832582,-1.000000,0.412500,0.727460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063634,1.726845,-0.085509,0.842988,-0.152964,-0.515726,-0.502354,0.119019,-0.856431,-1.000000,0.403970,0.721440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063566,1.734030,-0.088583,0.897347,-0.030197,-0.440292,-0.434204,0.118095,-0.893040,-1.000000,0.409090,0.731760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059599,1.737021,-0.094974,0.782933,0.027937,-0.621478,-0.622075,0.025196,-0.782552,-1.000000,0.418620,0.735050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061021,1.740321,-0.092554,0.838692,0.188797,-0.510834,-0.529628,0.064275,-0.845792,-1.000000,0.416040,0.740400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.055293,1.741037,-0.099221,0.682814,0.174934,-0.709340,-0.719610,-0.006675,-0.694346,-1.000000,0.425490,0.741450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.053911,1.737417,-0.100631,0.619089,-0.038703,-0.784366,-0.784909,0.001851,-0.619609,-1.000000,0.427190,0.736290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057862,1.734336,-0.096668,0.707293,-0.129629,-0.694933,-0.698121,0.026540,-0.715488,-1.000000,0.420800,0.731000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056130,1.744993,-0.096882,0.705526,0.343984,-0.619604,-0.661371,0.005489,-0.750038,-1.000000,0.423760,0.747710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.052665,1.735049,-0.100944,0.532269,-0.226364,-0.815750,-0.820698,0.098448,-0.562816,-1.000000,0.428710,0.732090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056350,1.732738,-0.097360,0.597815,-0.308147,-0.740043,-0.739564,0.144179,-0.657463,-1.000000,0.422790,0.727590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.055466,1.731868,-0.097562,0.518083,-0.429139,-0.739885,-0.756973,0.172696,-0.630213,-1.000000,0.425010,0.724000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051891,1.733825,-0.100837,0.455700,-0.385283,-0.802431,-0.832061,0.135900,-0.537778,-1.000000,0.430500,0.727820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054415,1.730690,-0.097538,0.496672,-0.443497,-0.746075,-0.813407,0.062041,-0.578376,-1.000000,0.426750,0.721210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051021,1.732700,-0.100670,0.449484,-0.416090,-0.790464,-0.860942,0.034184,-0.507554,-1.000000,0.432070,0.724550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.053021,1.729126,-0.097428,0.667504,-0.141970,-0.730947,-0.742082,-0.046086,-0.668722,-1.000000,0.428200,0.718640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049719,1.730929,-0.100383,0.633442,-0.066534,-0.770925,-0.773578,-0.077774,-0.628910,-1.000000,0.433350,0.721860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.052565,1.727019,-0.098536,0.764382,0.033933,-0.643870,-0.639447,-0.088073,-0.763774,-1.000000,0.429710,0.715910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049539,1.729010,-0.101531,0.713740,0.250216,-0.654192,-0.657465,-0.082682,-0.748935,-1.000000,0.434480,0.719390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049673,1.744390,-0.103223,0.578401,0.286360,-0.763839,-0.803204,0.036309,-0.594597,-1.000000,0.434480,0.746480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049392,1.748425,-0.100798,0.583110,0.406145,-0.703583,-0.772140,0.007837,-0.635404,-1.000000,0.433490,0.753620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042394,1.746836,-0.107159,0.444499,0.346701,-0.825966,-0.889160,0.058884,-0.453791,-1.000000,0.446520,0.749970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042510,1.742840,-0.107694,0.427214,0.043929,-0.903083,-0.902131,0.087434,-0.422511,-1.000000,0.446580,0.743080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.034528,1.743446,-0.110874,0.307277,0.045041,-0.950553,-0.949845,0.075491,-0.303471,-1.000000,0.456950,0.743070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.033980,1.747343,-0.110174,0.318011,0.315237,-0.894144,-0.947936,0.088911,-0.305796,-1.000000,0.457430,0.750090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041527,1.751233,-0.104638,0.461665,0.385330,-0.798991,-0.876349,0.058607,-0.478099,-1.000000,0.446340,0.757480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.033003,1.752692,-0.108007,0.359201,0.318532,-0.877218,-0.933239,0.128926,-0.335325,-1.000000,0.457550,0.758200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035027,1.740095,-0.110214,0.284973,-0.186764,-0.940165,-0.947261,0.095124,-0.306020,-1.000000,0.455860,0.737120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042305,1.739303,-0.107450,0.396134,-0.134272,-0.908322,-0.901092,0.133182,-0.412668,-1.000000,0.446590,0.737240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048800,1.740280,-0.104129,0.530952,0.011058,-0.847330,-0.845729,0.069715,-0.529039,-1.000000,0.435470,0.740390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048016,1.737265,-0.104234,0.472381,-0.164159,-0.865972,-0.861761,0.120196,-0.492870,-1.000000,0.436340,0.735430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025880,1.746994,-0.112400,0.279387,0.238909,-0.929982,-0.956906,0.149179,-0.249152,-1.000000,0.466550,0.748270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025234,1.752953,-0.110902,0.324367,0.252374,-0.911643,-0.940792,0.186392,-0.283139,-1.000000,0.466730,0.756650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026839,1.742849,-0.112935,0.251651,0.005199,-0.967804,-0.960849,0.121128,-0.249192,-1.000000,0.465530,0.741260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028058,1.739966,-0.111844,0.228480,-0.277237,-0.933240,-0.958932,0.101398,-0.264892,-1.000000,0.463350,0.735250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035968,1.737298,-0.109394,0.255364,-0.254986,-0.932615,-0.950752,0.109034,-0.290141,-1.000000,0.454190,0.731270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029656,1.736925,-0.110367,0.175773,-0.351663,-0.919476,-0.968793,0.104024,-0.224985,-1.000000,0.460140,0.729300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.036793,1.734873,-0.108492,0.238635,-0.187967,-0.952744,-0.955639,0.128967,-0.264804,-1.000000,0.452590,0.727470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031268,1.734363,-0.109128,0.101189,-0.312644,-0.944465,-0.976842,0.148673,-0.153873,-1.000000,0.457580,0.725630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.037601,1.732445,-0.108291,0.219559,0.007930,-0.975567,-0.971830,0.089590,-0.217990,-1.000000,0.451210,0.724680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032692,1.731813,-0.108502,0.017479,-0.162522,-0.986550,-0.984692,0.168348,-0.045179,-1.000000,0.455470,0.723110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041985,1.734695,-0.106349,0.423994,-0.162854,-0.890903,-0.897362,0.057350,-0.437552,-1.000000,0.446040,0.728020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042134,1.732455,-0.106403,0.464799,0.124623,-0.876602,-0.883673,0.003194,-0.468094,-1.000000,0.445450,0.725040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046821,1.734081,-0.103489,0.472350,-0.297241,-0.829779,-0.866772,0.014219,-0.498502,-1.000000,0.438410,0.727020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046142,1.732061,-0.103397,0.597372,0.071764,-0.798747,-0.796523,-0.062735,-0.601345,-1.000000,0.439090,0.724070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042145,1.736700,-0.106960,0.379912,-0.239689,-0.893429,-0.900176,0.126556,-0.416734,-1.000000,0.446440,0.731830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.047472,1.735461,-0.103899,0.428407,-0.318788,-0.845483,-0.868470,0.113048,-0.482679,-1.000000,0.437440,0.730590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038357,1.730512,-0.108195,0.217270,-0.267485,-0.938747,-0.972165,0.027094,-0.232725,-1.000000,0.449670,0.721970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.033932,1.729915,-0.108396,0.038500,-0.350048,-0.935940,-0.995612,0.066508,-0.065830,-1.000000,0.453550,0.720790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042647,1.730536,-0.106860,0.432865,-0.054766,-0.899794,-0.900969,0.006612,-0.433833,-1.000000,0.444760,0.722210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046460,1.730068,-0.104413,0.609012,0.191266,-0.769754,-0.781056,-0.024285,-0.623989,-1.000000,0.439450,0.721380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049138,1.727844,-0.102341,0.609935,-0.134125,-0.781018,-0.785996,0.023145,-0.617798,-1.000000,0.435640,0.717800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050903,1.726635,-0.100505,0.728379,-0.085196,-0.679857,-0.685149,-0.099039,-0.721638,-1.000000,0.432760,0.715940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051027,1.725248,-0.099414,0.513948,-0.529551,-0.674858,-0.805161,-0.026397,-0.592469,-1.000000,0.431940,0.713780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049432,1.724615,-0.099208,0.240518,-0.675133,-0.697386,-0.906969,0.099625,-0.409246,-1.000000,0.433560,0.712580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050558,1.722942,-0.097101,0.333245,-0.594398,-0.731874,-0.875544,0.092910,-0.474120,-1.000000,0.431060,0.710280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.047749,1.722128,-0.097718,0.497606,-0.398446,-0.770474,-0.818256,0.079121,-0.569383,-1.000000,0.434320,0.708910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044606,1.721387,-0.099926,0.538900,-0.267296,-0.798836,-0.830169,-0.007706,-0.557459,-1.000000,0.438380,0.707890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040493,1.720567,-0.102206,0.372746,-0.278972,-0.885006,-0.927797,-0.095684,-0.360607,-1.000000,0.442880,0.707460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035320,1.719964,-0.103264,0.048748,-0.326322,-0.944001,-0.998658,0.000000,-0.051787,-1.000000,0.447490,0.707460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.030375,1.720715,-0.102611,-0.209720,-0.332765,-0.919394,-0.969439,0.193190,0.151212,-1.000000,0.452160,0.707590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026443,1.722380,-0.102048,-0.142555,-0.448548,-0.882317,-0.976806,0.207652,0.052256,-1.000000,0.456130,0.708170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024020,1.723486,-0.103223,0.064526,-0.605107,-0.793525,-0.984581,0.090957,-0.149421,-1.000000,0.458520,0.709420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024011,1.725163,-0.104343,-0.056178,-0.508129,-0.859447,-0.978367,0.199678,-0.054104,-1.000000,0.459530,0.711550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026602,1.726099,-0.105233,-0.064067,-0.604013,-0.794395,-0.988983,0.144873,-0.030393,-1.000000,0.457880,0.713490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028604,1.726979,-0.106060,-0.049841,-0.618950,-0.783848,-0.990525,0.131194,-0.040612,-1.000000,0.456620,0.715260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031354,1.727823,-0.106836,0.025564,-0.625816,-0.779552,-0.993776,0.068671,-0.087717,-1.000000,0.454540,0.716980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.034850,1.728658,-0.107086,0.136409,-0.657157,-0.741308,-0.984821,-0.008881,-0.173345,-1.000000,0.451770,0.718410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023052,1.739154,-0.112928,0.253906,-0.345030,-0.903596,-0.947832,0.097397,-0.303526,-1.000000,0.468640,0.732230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018765,1.736868,-0.113327,0.293556,-0.407311,-0.864825,-0.938726,0.048094,-0.341293,-1.000000,0.472020,0.728100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021187,1.742494,-0.114243,0.259792,-0.060274,-0.963782,-0.951357,0.155194,-0.266149,-1.000000,0.471930,0.738110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016711,1.740494,-0.115232,0.254836,-0.164444,-0.952899,-0.954156,0.117223,-0.275401,-1.000000,0.476310,0.733570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015779,1.734172,-0.112938,0.346768,-0.455198,-0.820089,-0.910681,0.045902,-0.410552,-1.000000,0.474160,0.723400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013697,1.737183,-0.115223,0.285710,-0.283954,-0.915281,-0.938164,0.111961,-0.327587,-1.000000,0.479060,0.727940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013750,1.730502,-0.111692,0.506639,-0.428440,-0.748169,-0.826145,0.006939,-0.563415,-1.000000,0.474860,0.717940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.011481,1.733657,-0.114710,0.407286,-0.321049,-0.855012,-0.891121,0.065369,-0.449032,-1.000000,0.480930,0.722270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009299,1.730169,-0.114817,0.552999,-0.224975,-0.802233,-0.822490,0.006354,-0.568744,-1.000000,0.482850,0.717400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009482,1.736071,-0.116075,0.257234,-0.160875,-0.952864,-0.953132,0.120288,-0.277615,-1.000000,0.485070,0.725290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007390,1.732007,-0.116137,0.369601,-0.104640,-0.923280,-0.925465,0.047433,-0.375851,-1.000000,0.486850,0.719700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007259,1.737713,-0.116789,0.156778,-0.061076,-0.985744,-0.980508,0.110053,-0.162764,-1.000000,0.489040,0.727190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005474,1.733135,-0.116776,0.214460,-0.031656,-0.976220,-0.974160,0.065565,-0.216134,-1.000000,0.490420,0.720980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004047,1.738581,-0.117264,0.081001,-0.014662,-0.996606,-0.994181,0.070056,-0.081835,-1.000000,0.494050,0.727960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003075,1.733764,-0.117203,0.103265,0.006712,-0.994631,-0.993522,0.048385,-0.102823,-1.000000,0.494710,0.721580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.738850,-0.117454,0.000685,-0.000418,-1.000000,-0.999999,-0.001265,-0.000000,-1.000000,0.499930,0.728150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.734058,-0.117375,0.000730,0.018578,-0.999827,-0.999998,-0.001813,-0.000000,-1.000000,0.499930,0.721790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007724,1.726648,-0.115529,0.673552,-0.047852,-0.737589,-0.739134,-0.047603,-0.671875,-1.000000,0.484500,0.713080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005929,1.728138,-0.116722,0.465242,0.037804,-0.884376,-0.885065,0.003522,-0.465454,-1.000000,0.488390,0.714910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006850,1.722744,-0.116553,0.727847,0.103465,-0.677889,-0.674277,-0.072009,-0.734959,-1.000000,0.485890,0.708690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005140,1.724008,-0.117752,0.522770,0.167096,-0.835937,-0.845800,-0.020793,-0.533095,-1.000000,0.489660,0.710240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006408,1.718570,-0.118070,0.732691,0.216764,-0.645118,-0.651901,-0.048651,-0.756742,-1.000000,0.487030,0.703950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004697,1.719723,-0.119223,0.546252,0.269124,-0.793209,-0.820232,-0.020089,-0.571678,-1.000000,0.490560,0.705280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004397,1.715450,-0.121119,0.551693,0.353698,-0.755336,-0.807776,0.001083,-0.589488,-1.000000,0.491180,0.700210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006143,1.714409,-0.120074,0.711081,0.304133,-0.633930,-0.666872,0.006010,-0.745148,-1.000000,0.487830,0.698910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002803,1.716047,-0.121693,0.361826,0.408234,-0.838109,-0.900575,-0.079282,-0.427411,-1.000000,0.493800,0.701060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003065,1.720416,-0.119751,0.323776,0.319688,-0.890488,-0.926166,-0.085252,-0.367354,-1.000000,0.493280,0.706180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.001358,1.716345,-0.121973,0.181798,0.446096,-0.876327,-0.960336,-0.111072,-0.255768,-1.000000,0.496630,0.701710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.001522,1.720785,-0.119973,0.151712,0.344801,-0.926335,-0.973970,-0.107544,-0.199543,-1.000000,0.496280,0.706860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.716438,-0.122061,0.002165,0.459744,-0.888049,-0.999996,0.000000,-0.002924,-1.000000,0.499950,0.702000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.720908,-0.120052,0.001008,0.351915,-0.936032,-0.999998,-0.001096,-0.001489,-1.000000,0.499940,0.707150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003510,1.724810,-0.118272,0.298856,0.219312,-0.928756,-0.947717,-0.045898,-0.315795,-1.000000,0.492530,0.711150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.001836,1.725273,-0.118511,0.138287,0.238502,-0.961246,-0.985642,-0.061802,-0.157131,-1.000000,0.495810,0.711840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.725442,-0.118613,0.000644,0.242886,-0.970055,-0.999999,-0.001112,-0.000000,-1.000000,0.499930,0.712110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004260,1.729083,-0.117273,0.268922,0.098336,-0.958129,-0.963091,0.015358,-0.268738,-1.000000,0.491580,0.715950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002367,1.729659,-0.117588,0.126709,0.124529,-0.984092,-0.991800,0.000000,-0.127802,-1.000000,0.495290,0.716600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.729891,-0.117730,0.000631,0.131823,-0.991273,-0.999999,-0.001617,-0.000000,-1.000000,0.499930,0.716890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002713,1.711797,-0.124119,0.410178,0.476921,-0.777367,-0.865731,-0.064448,-0.496343,-1.000000,0.493860,0.694990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004215,1.711329,-0.123424,0.560639,0.418966,-0.714249,-0.795419,0.032688,-0.605178,-1.000000,0.491250,0.694210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002779,1.707654,-0.126874,0.459650,0.525047,-0.716273,-0.815227,-0.070505,-0.574833,-1.000000,0.493290,0.687790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004161,1.707449,-0.125950,0.581397,0.462324,-0.669503,-0.767284,0.037825,-0.640191,-1.000000,0.490690,0.687310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005885,1.710431,-0.122448,0.687002,0.367086,-0.627118,-0.696112,0.084882,-0.712898,-1.000000,0.488100,0.693040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005614,1.706827,-0.124995,0.674624,0.410193,-0.613697,-0.711451,0.139696,-0.688710,-1.000000,0.487920,0.686540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004332,1.704069,-0.128327,0.619276,0.534817,-0.574864,-0.725634,0.110164,-0.679205,-1.000000,0.490020,0.681200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005359,1.704305,-0.126985,0.672410,0.461722,-0.578513,-0.706762,0.168321,-0.687136,-1.000000,0.487960,0.681950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002995,1.704039,-0.129643,0.497340,0.614918,-0.611988,-0.782187,0.012679,-0.622914,-1.000000,0.492750,0.680980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.001402,1.707745,-0.127490,0.258392,0.583528,-0.769889,-0.921524,-0.090249,-0.377688,-1.000000,0.496360,0.688330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.001322,1.712021,-0.124533,0.222974,0.524770,-0.821523,-0.943229,-0.096676,-0.317761,-1.000000,0.496710,0.695630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.707780,-0.127701,0.005555,0.607354,-0.794412,-0.999984,0.004405,-0.003625,-1.000000,0.499950,0.688590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.712093,-0.124677,0.004193,0.543896,-0.839142,-0.999991,0.002786,-0.003191,-1.000000,0.499950,0.695910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.704201,-0.130698,0.005338,0.718563,-0.695442,-0.999985,0.002962,-0.004615,-1.000000,0.499950,0.681470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.001551,1.704140,-0.130441,0.275385,0.690236,-0.669131,-0.915935,-0.022985,-0.400669,-1.000000,0.496050,0.681310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005040,1.701530,-0.130341,0.675694,0.599950,-0.428365,-0.662845,0.240164,-0.709195,-1.000000,0.488980,0.676660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003450,1.701562,-0.132364,0.512843,0.705373,-0.489328,-0.745508,0.083288,-0.661272,-1.000000,0.492330,0.676030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.001835,1.701733,-0.133416,0.262910,0.773468,-0.576737,-0.900131,-0.018561,-0.435224,-1.000000,0.495900,0.676310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.701841,-0.133718,0.003783,0.790110,-0.612954,-0.999992,0.002153,-0.003396,-1.000000,0.499960,0.676570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007262,1.705214,-0.124088,0.744193,0.395411,-0.538355,-0.633619,0.162771,-0.756328,-1.000000,0.484330,0.684480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006424,1.702327,-0.127356,0.727055,0.490792,-0.480119,-0.640180,0.231896,-0.732389,-1.000000,0.485950,0.679160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009558,1.702851,-0.122411,0.790344,0.376490,-0.483333,-0.551456,0.093440,-0.828954,-1.000000,0.479600,0.681430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008931,1.698661,-0.127212,0.787853,0.471958,-0.395656,-0.531410,0.196259,-0.824067,-1.000000,0.482090,0.674510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009880,1.706719,-0.119092,0.804657,0.340849,-0.486157,-0.521483,0.014241,-0.853143,-1.000000,0.478640,0.687780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007740,1.708894,-0.121089,0.775753,0.336138,-0.534058,-0.585635,0.068287,-0.807693,-1.000000,0.483860,0.690960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006276,1.698978,-0.132544,0.719812,0.584042,-0.375187,-0.607382,0.268220,-0.747760,-1.000000,0.487940,0.672260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007504,1.695928,-0.135142,0.746166,0.520190,-0.415499,-0.601281,0.258607,-0.756031,-1.000000,0.487780,0.667460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.010351,1.694454,-0.130249,0.791051,0.509924,-0.337958,-0.514611,0.255966,-0.818326,-1.000000,0.482320,0.668300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008456,1.692125,-0.137272,0.771076,0.365445,-0.521433,-0.613265,0.205902,-0.762568,-1.000000,0.488220,0.662610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.011459,1.691313,-0.132418,0.798199,0.447528,-0.403232,-0.553383,0.280280,-0.784354,-1.000000,0.482910,0.664090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013950,1.692605,-0.123889,0.831882,0.455343,-0.317230,-0.392654,0.078990,-0.916288,-1.000000,0.475540,0.667630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014938,1.690009,-0.126685,0.811865,0.512730,-0.279256,-0.397536,0.135155,-0.907578,-1.000000,0.477130,0.664320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.017447,1.689467,-0.117609,0.823642,0.302856,-0.479471,-0.474648,-0.094555,-0.875082,-1.000000,0.468730,0.664120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.017120,1.693135,-0.116122,0.749905,0.277338,-0.600605,-0.620244,-0.021006,-0.784127,-1.000000,0.468050,0.667920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021363,1.688132,-0.114441,0.425563,0.173448,-0.888151,-0.897978,-0.040473,-0.438175,-1.000000,0.461640,0.661650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020697,1.683092,-0.115272,0.484799,0.099836,-0.868909,-0.872629,-0.011880,-0.488239,-1.000000,0.463640,0.655680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026244,1.682598,-0.114150,0.152757,0.101224,-0.983066,-0.986556,-0.042831,-0.157709,-1.000000,0.454680,0.654740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025029,1.678198,-0.114320,0.155266,0.056898,-0.986233,-0.987490,-0.018849,-0.156552,-1.000000,0.457210,0.648740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031605,1.677401,-0.114106,0.128430,0.042509,-0.990807,-0.989193,-0.065764,-0.131042,-1.000000,0.446990,0.646520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029853,1.673773,-0.114156,0.131109,0.017986,-0.991205,-0.987505,-0.085809,-0.132177,-1.000000,0.449760,0.640810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.036909,1.672154,-0.113178,0.245384,-0.047353,-0.968269,-0.966786,0.061713,-0.248026,-1.000000,0.439250,0.636900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.034849,1.669090,-0.113317,0.221519,-0.079341,-0.971923,-0.975036,-0.002420,-0.222032,-1.000000,0.442230,0.631320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028062,1.670258,-0.114678,0.301653,0.151740,-0.941265,-0.944789,-0.084945,-0.316476,-1.000000,0.453210,0.634930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032787,1.666102,-0.113511,0.343347,0.023969,-0.938903,-0.936254,-0.070495,-0.344178,-1.000000,0.445510,0.626290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041226,1.666698,-0.111092,0.397500,-0.166192,-0.902427,-0.875210,0.226803,-0.427280,-1.000000,0.434210,0.628710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038874,1.664117,-0.111366,0.357455,-0.175638,-0.917266,-0.911323,0.149198,-0.383707,-1.000000,0.437380,0.623240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.036711,1.661612,-0.111765,0.433682,-0.082964,-0.897239,-0.897902,0.043586,-0.438032,-1.000000,0.440590,0.618640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038859,1.675420,-0.112640,0.325361,0.049120,-0.944313,-0.943451,0.083999,-0.320694,-1.000000,0.436410,0.642860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.033028,1.681088,-0.113484,0.211245,0.166273,-0.963187,-0.975400,-0.027665,-0.218699,-1.000000,0.444680,0.652150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040796,1.678952,-0.111594,0.386785,0.149085,-0.910039,-0.921852,0.036610,-0.385809,-1.000000,0.433800,0.648630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.034315,1.684713,-0.112273,0.270677,0.290524,-0.917785,-0.953846,-0.047853,-0.296460,-1.000000,0.442650,0.657350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026984,1.686583,-0.113358,0.223017,0.242583,-0.944149,-0.974102,0.018427,-0.225357,-1.000000,0.452760,0.660040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027590,1.690123,-0.111927,0.289626,0.373528,-0.881245,-0.951274,0.010559,-0.308166,-1.000000,0.451130,0.664840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044052,1.660830,-0.107977,0.539461,-0.239434,-0.807250,-0.761490,0.270396,-0.589082,-1.000000,0.430960,0.620340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041540,1.658602,-0.108689,0.505101,-0.209598,-0.837223,-0.815281,0.202412,-0.542537,-1.000000,0.434360,0.615020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045801,1.653906,-0.104321,0.644271,-0.230332,-0.729288,-0.697015,0.215635,-0.683865,-1.000000,0.428190,0.609300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.043371,1.651819,-0.105781,0.612838,-0.211142,-0.761478,-0.747371,0.158103,-0.645322,-1.000000,0.432150,0.604550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.039360,1.656489,-0.109625,0.544215,-0.138278,-0.827472,-0.824788,0.092254,-0.557866,-1.000000,0.437770,0.610930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041060,1.650061,-0.107249,0.596217,-0.204718,-0.776283,-0.782364,0.068742,-0.619016,-1.000000,0.436050,0.601360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045945,1.672586,-0.109302,0.561746,-0.034257,-0.826600,-0.817672,0.129075,-0.561027,-1.000000,0.427920,0.640610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.043593,1.669476,-0.110450,0.485494,-0.101918,-0.868279,-0.838974,0.224926,-0.495510,-1.000000,0.430990,0.634750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046515,1.663229,-0.106944,0.622910,-0.218379,-0.751195,-0.718749,0.219334,-0.659767,-1.000000,0.427520,0.626330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048920,1.665829,-0.105552,0.700598,-0.183005,-0.689690,-0.692340,0.059601,-0.719106,-1.000000,0.424160,0.631580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.047041,1.645011,-0.100415,0.703608,-0.263149,-0.660066,-0.666108,0.079231,-0.741635,-1.000000,0.426190,0.594830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044371,1.643233,-0.102428,0.654887,-0.280166,-0.701877,-0.719167,0.054339,-0.692710,-1.000000,0.430910,0.591640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046814,1.634551,-0.095734,0.718892,-0.374728,-0.585468,-0.655668,-0.085830,-0.750155,-1.000000,0.425370,0.579140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.043797,1.633413,-0.098273,0.656812,-0.391062,-0.644724,-0.726252,-0.098043,-0.680401,-1.000000,0.430520,0.577890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041748,1.642110,-0.104254,0.590461,-0.303115,-0.747982,-0.785465,-0.002843,-0.618899,-1.000000,0.435360,0.589900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040956,1.633124,-0.100600,0.583158,-0.396386,-0.709087,-0.798724,-0.120521,-0.589504,-1.000000,0.435270,0.577950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048264,1.656070,-0.102721,0.706603,-0.230527,-0.669006,-0.661682,0.119806,-0.740151,-1.000000,0.424350,0.614780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050632,1.658280,-0.100817,0.770394,-0.216156,-0.599808,-0.625582,-0.074715,-0.776573,-1.000000,0.420850,0.618810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049601,1.647139,-0.098230,0.761615,-0.243748,-0.600441,-0.619273,0.000000,-0.785176,-1.000000,0.421600,0.598810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049727,1.636373,-0.093057,0.779964,-0.344796,-0.522276,-0.590287,-0.128098,-0.796964,-1.000000,0.420190,0.581360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038262,1.633518,-0.102683,0.495283,-0.385506,-0.778511,-0.865804,-0.145535,-0.478752,-1.000000,0.439710,0.578970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.039136,1.641792,-0.105822,0.490287,-0.330867,-0.806316,-0.859047,-0.027241,-0.511172,-1.000000,0.439560,0.589500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.036287,1.642608,-0.107567,0.374750,-0.337849,-0.863377,-0.923009,-0.048297,-0.381734,-1.000000,0.443900,0.590630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035439,1.634068,-0.104379,0.436980,-0.361224,-0.823751,-0.899440,-0.167789,-0.403554,-1.000000,0.443980,0.580250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.036847,1.648380,-0.109629,0.448319,-0.290139,-0.845476,-0.882924,0.003855,-0.469499,-1.000000,0.443060,0.598620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038873,1.648872,-0.108607,0.538478,-0.242465,-0.807002,-0.827174,0.030545,-0.561115,-1.000000,0.439780,0.599480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.037482,1.654564,-0.110774,0.561009,-0.115952,-0.819648,-0.824201,0.014116,-0.566122,-1.000000,0.441160,0.607870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035716,1.652988,-0.111643,0.496465,-0.187023,-0.847670,-0.865379,-0.029989,-0.500220,-1.000000,0.444300,0.605540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.034902,1.659136,-0.112693,0.519393,-0.000378,-0.854535,-0.854079,-0.032894,-0.519101,-1.000000,0.443930,0.614750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.033333,1.656828,-0.113695,0.526431,-0.046957,-0.848920,-0.849290,-0.075674,-0.522475,-1.000000,0.447160,0.611430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.030998,1.663025,-0.114694,0.476797,0.126700,-0.869834,-0.864850,-0.109307,-0.489986,-1.000000,0.449110,0.621530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029435,1.660054,-0.116066,0.528535,0.099262,-0.843088,-0.833145,-0.129863,-0.537591,-1.000000,0.452700,0.617060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024222,1.662875,-0.118807,0.502605,0.233124,-0.832491,-0.840447,-0.093882,-0.533699,-1.000000,0.462000,0.623110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026099,1.666555,-0.116553,0.444651,0.253018,-0.859225,-0.875037,-0.082171,-0.477031,-1.000000,0.457470,0.628920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018570,1.665275,-0.121339,0.487222,0.314597,-0.814643,-0.860803,0.015895,-0.508690,-1.000000,0.471910,0.627270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021016,1.669741,-0.117948,0.449763,0.328792,-0.830427,-0.885164,0.040048,-0.463553,-1.000000,0.466300,0.634460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015003,1.672276,-0.120279,0.504588,0.266703,-0.821134,-0.862082,0.103900,-0.496003,-1.000000,0.476560,0.637340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009699,1.667366,-0.125959,0.416222,0.301525,-0.857812,-0.906625,0.065809,-0.416774,-1.000000,0.482200,0.629000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027999,1.657366,-0.117037,0.552473,-0.023106,-0.833210,-0.821755,-0.182533,-0.539815,-1.000000,0.455900,0.613380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031798,1.654869,-0.114219,0.483764,-0.199515,-0.852154,-0.874963,-0.132824,-0.465615,-1.000000,0.449930,0.608770,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022742,1.659364,-0.120600,0.539475,0.143582,-0.829669,-0.818475,-0.141878,-0.556749,-1.000000,0.465990,0.618110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016899,1.660980,-0.123758,0.505956,0.252263,-0.824847,-0.848744,-0.024866,-0.528219,-1.000000,0.476300,0.621410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021599,1.656406,-0.121648,0.574493,-0.001671,-0.818508,-0.806074,-0.174804,-0.565410,-1.000000,0.468700,0.614430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026742,1.655130,-0.117494,0.569169,-0.194232,-0.798949,-0.817601,-0.236559,-0.524947,-1.000000,0.458410,0.610770,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.030366,1.653273,-0.114270,0.444651,-0.377129,-0.812440,-0.895370,-0.211884,-0.391684,-1.000000,0.452060,0.606840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032390,1.650740,-0.112023,0.245771,-0.454373,-0.856237,-0.967902,-0.162928,-0.191364,-1.000000,0.449080,0.602650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.034037,1.651695,-0.112043,0.356561,-0.330540,-0.873846,-0.933573,-0.089894,-0.346929,-1.000000,0.446960,0.603760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035099,1.647701,-0.109995,0.262446,-0.352595,-0.898220,-0.964234,-0.060067,-0.258156,-1.000000,0.445520,0.597700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015688,1.657591,-0.125563,0.525629,0.154683,-0.836533,-0.848259,0.020658,-0.529178,-1.000000,0.479010,0.617070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009062,1.658998,-0.129424,0.382829,0.201227,-0.901637,-0.920394,0.000000,-0.390992,-1.000000,0.487570,0.618410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008512,1.662695,-0.128166,0.338374,0.343576,-0.876047,-0.926620,-0.040541,-0.373807,-1.000000,0.485640,0.623040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031132,1.649845,-0.111594,0.177759,-0.523547,-0.833247,-0.978637,-0.182931,-0.093836,-1.000000,0.450610,0.601630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029215,1.651946,-0.114008,0.415611,-0.530982,-0.738462,-0.909542,-0.243306,-0.336949,-1.000000,0.453730,0.605370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009284,1.657187,-0.128678,0.331226,-0.303300,-0.893476,-0.936989,0.005754,-0.349311,-1.000000,0.488460,0.614700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015202,1.655809,-0.126069,0.429828,-0.299769,-0.851696,-0.869034,0.118609,-0.480324,-1.000000,0.480300,0.613770,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020709,1.653979,-0.121838,0.529557,-0.325327,-0.783410,-0.845744,-0.131209,-0.517205,-1.000000,0.470310,0.611650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025724,1.653354,-0.117493,0.552156,-0.393199,-0.735200,-0.833468,-0.237774,-0.498792,-1.000000,0.460230,0.608820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019928,1.652137,-0.121110,0.403187,-0.579888,-0.707933,-0.902150,-0.122098,-0.413785,-1.000000,0.471070,0.609360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024879,1.651932,-0.117184,0.493503,-0.571698,-0.655452,-0.861434,-0.217356,-0.459008,-1.000000,0.461710,0.607100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028219,1.650890,-0.113569,0.381403,-0.644633,-0.662555,-0.923328,-0.231018,-0.306750,-1.000000,0.455420,0.604090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029907,1.648987,-0.111041,0.098915,-0.503391,-0.858378,-0.993815,-0.093731,-0.059554,-1.000000,0.452450,0.600450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014624,1.654165,-0.124988,0.297259,-0.569431,-0.766411,-0.909743,0.074747,-0.408387,-1.000000,0.480650,0.611010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009505,1.655472,-0.127542,0.256465,-0.557115,-0.789841,-0.949156,0.009181,-0.314671,-1.000000,0.488650,0.611810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029015,1.648824,-0.110844,0.015609,-0.609954,-0.792283,-0.998384,-0.052809,0.020987,-1.000000,0.453900,0.600250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027430,1.650241,-0.113227,0.356455,-0.733445,-0.578790,-0.931094,-0.227483,-0.285158,-1.000000,0.456710,0.603300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024205,1.650847,-0.116731,0.428384,-0.687481,-0.586394,-0.893818,-0.227182,-0.386623,-1.000000,0.462740,0.605780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019329,1.650822,-0.119947,0.353105,-0.675430,-0.647388,-0.932833,-0.201149,-0.298933,-1.000000,0.471430,0.607570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013943,1.651317,-0.123098,0.267505,-0.645553,-0.715334,-0.951860,-0.061720,-0.300256,-1.000000,0.480500,0.609050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009007,1.652326,-0.125459,0.222068,-0.638480,-0.736905,-0.961110,-0.016085,-0.275696,-1.000000,0.488420,0.609580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.030301,1.645491,-0.109945,0.340621,-0.167935,-0.925081,-0.932665,0.063970,-0.355026,-1.000000,0.451870,0.594660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032617,1.647069,-0.110078,0.205415,-0.330075,-0.921333,-0.978631,-0.078173,-0.190184,-1.000000,0.448520,0.597060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029146,1.647047,-0.110210,0.204631,-0.043232,-0.977884,-0.959381,0.189348,-0.209130,-1.000000,0.453480,0.596450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027493,1.645435,-0.111288,0.487769,0.131837,-0.862960,-0.853858,-0.133681,-0.503047,-1.000000,0.456790,0.594240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028083,1.643134,-0.111166,0.550739,-0.088588,-0.829963,-0.833735,-0.105615,-0.541969,-1.000000,0.456180,0.591590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023976,1.643073,-0.113978,0.554130,0.051969,-0.830806,-0.769474,-0.348772,-0.535040,-1.000000,0.463740,0.593350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024442,1.640803,-0.113664,0.571820,-0.186520,-0.798894,-0.803174,-0.325670,-0.498849,-1.000000,0.463120,0.590380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019128,1.640189,-0.117367,0.568602,-0.150369,-0.808753,-0.798429,-0.337520,-0.498589,-1.000000,0.473880,0.592780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019368,1.637953,-0.116582,0.519861,-0.359663,-0.774846,-0.842977,-0.362860,-0.397142,-1.000000,0.473440,0.590040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019204,1.633844,-0.114404,0.436306,-0.433794,-0.788327,-0.895122,-0.298454,-0.331182,-1.000000,0.472690,0.584790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024341,1.635854,-0.112152,0.523663,-0.330963,-0.785010,-0.850294,-0.260052,-0.457573,-1.000000,0.462570,0.585080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018373,1.627380,-0.111407,0.429373,-0.281458,-0.858150,-0.901888,-0.183398,-0.391106,-1.000000,0.472120,0.577520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023907,1.630043,-0.109650,0.487311,-0.346599,-0.801497,-0.872969,-0.215742,-0.437470,-1.000000,0.461900,0.579050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013029,1.628788,-0.113623,0.275194,-0.342963,-0.898134,-0.959812,-0.151495,-0.236243,-1.000000,0.481880,0.580220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013723,1.632952,-0.116349,0.283196,-0.558812,-0.779442,-0.954904,-0.239889,-0.174961,-1.000000,0.482170,0.585960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013882,1.636127,-0.119061,0.368363,-0.563859,-0.739170,-0.927733,-0.274399,-0.253014,-1.000000,0.482700,0.590650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008413,1.629631,-0.114762,0.133509,-0.399147,-0.907114,-0.989825,-0.099157,-0.102052,-1.000000,0.489200,0.582110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008533,1.632859,-0.117595,0.127804,-0.676109,-0.725632,-0.990116,-0.129585,-0.053645,-1.000000,0.489500,0.587300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008511,1.635640,-0.120439,0.199001,-0.714113,-0.671149,-0.979376,-0.169347,-0.110205,-1.000000,0.489870,0.591550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012408,1.624529,-0.113550,0.360379,0.132155,-0.923397,-0.925702,-0.071270,-0.371478,-1.000000,0.482730,0.575100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015764,1.622563,-0.112419,0.480014,0.066513,-0.874736,-0.870941,-0.083342,-0.484269,-1.000000,0.476450,0.572510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008442,1.625693,-0.114630,0.237699,0.219445,-0.946226,-0.963169,-0.072834,-0.258846,-1.000000,0.489390,0.576900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020578,1.622339,-0.109374,0.548781,-0.094071,-0.830656,-0.834232,-0.125586,-0.536922,-1.000000,0.467620,0.571820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.017880,1.619494,-0.111666,0.600621,0.043635,-0.798342,-0.796964,-0.047315,-0.602170,-1.000000,0.473000,0.569080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014652,1.620075,-0.114063,0.539940,0.236473,-0.807802,-0.820922,-0.063992,-0.567443,-1.000000,0.478990,0.569970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015353,1.617655,-0.113970,0.596870,0.068544,-0.799405,-0.796731,-0.066956,-0.600614,-1.000000,0.477930,0.567510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012232,1.620659,-0.115325,0.439087,0.297882,-0.847626,-0.872042,-0.085733,-0.481864,-1.000000,0.483650,0.570790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008612,1.621377,-0.116800,0.298502,0.347889,-0.888746,-0.936134,-0.074634,-0.343633,-1.000000,0.489750,0.571920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014007,1.638414,-0.120528,0.465004,-0.384594,-0.797407,-0.881384,-0.285824,-0.376120,-1.000000,0.482930,0.593010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008824,1.637608,-0.122675,0.306229,-0.528607,-0.791706,-0.948336,-0.241880,-0.205313,-1.000000,0.489980,0.593670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012322,1.617127,-0.116081,0.483673,0.073183,-0.872184,-0.865780,-0.106176,-0.489031,-1.000000,0.483870,0.567370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008641,1.617253,-0.117900,0.310800,0.095987,-0.945616,-0.942614,-0.096564,-0.319615,-1.000000,0.490090,0.567920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004548,1.617530,-0.118755,0.101303,0.098445,-0.989973,-0.993260,-0.046324,-0.106246,-1.000000,0.495450,0.568480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004527,1.621901,-0.117607,0.109275,0.383183,-0.917186,-0.990750,-0.032696,-0.131700,-1.000000,0.495240,0.572670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.617707,-0.118815,0.000296,0.097369,-0.995248,-1.000000,0.000000,0.000000,-1.000000,0.500000,0.568710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.622112,-0.117633,0.000295,0.395532,-0.918452,-1.000000,0.000000,0.000000,-1.000000,0.500000,0.572920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004313,1.626327,-0.115053,0.080069,0.272407,-0.958845,-0.995268,-0.031279,-0.091997,-1.000000,0.495030,0.578000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.626566,-0.114961,0.000058,0.277821,-0.960633,-1.000000,0.000000,0.000000,-1.000000,0.500000,0.578370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004111,1.630180,-0.115143,0.028719,-0.433155,-0.900862,-0.999261,-0.035477,-0.014798,-1.000000,0.495000,0.583230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.630355,-0.115256,-0.000085,-0.446263,-0.894902,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.583540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004000,1.632995,-0.118174,0.039587,-0.740304,-0.671106,-0.998890,-0.046467,-0.007664,-1.000000,0.495210,0.588120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.633069,-0.118331,-0.000086,-0.761868,-0.647732,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.588370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004032,1.635554,-0.121274,0.091654,-0.799567,-0.593542,-0.995619,-0.084647,-0.039713,-1.000000,0.495420,0.592170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.635536,-0.121520,-0.000049,-0.828942,-0.559334,-0.999999,0.000000,0.001282,-1.000000,0.499990,0.592390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004084,1.637120,-0.123935,0.166219,-0.600339,-0.782281,-0.984054,-0.151930,-0.092497,-1.000000,0.495470,0.594150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.637029,-0.124464,-0.000008,-0.613837,-0.789433,-1.000000,-0.001008,-0.000000,-1.000000,0.499990,0.594340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004308,1.640319,-0.124984,0.173280,-0.145035,-0.974135,-0.975442,-0.161823,-0.149419,-1.000000,0.495430,0.595500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009149,1.640596,-0.123731,0.349865,-0.172092,-0.920858,-0.928060,-0.197630,-0.315668,-1.000000,0.489820,0.595030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004433,1.643725,-0.124934,0.113933,0.336849,-0.934640,-0.986810,-0.070532,-0.145712,-1.000000,0.495240,0.598200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.643733,-0.125038,-0.000006,0.389692,-0.920945,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.598370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.645884,-0.122511,-0.000019,0.679560,-0.733620,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.600700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004407,1.646146,-0.122901,0.050071,0.655976,-0.753119,-0.994880,-0.033523,-0.095344,-1.000000,0.495040,0.600620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004383,1.647590,-0.121407,0.067710,0.314447,-0.946857,-0.995948,-0.035000,-0.082844,-1.000000,0.494540,0.603660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.647435,-0.121550,-0.000035,0.235513,-0.971871,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.603650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.648583,-0.122296,-0.000062,-0.783861,-0.620936,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.605660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004389,1.648769,-0.121895,0.087891,-0.759999,-0.643954,-0.993720,-0.021951,-0.109723,-1.000000,0.494270,0.605610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009336,1.643578,-0.123756,0.323550,0.229915,-0.917853,-0.935107,-0.070477,-0.347286,-1.000000,0.489230,0.597790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009173,1.646041,-0.122285,0.236836,0.570840,-0.786162,-0.954316,-0.015048,-0.298420,-1.000000,0.489100,0.600370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014201,1.643503,-0.121295,0.523643,0.147886,-0.839004,-0.835748,-0.101910,-0.539574,-1.000000,0.482390,0.597340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013959,1.645885,-0.120512,0.445978,0.416682,-0.792137,-0.858715,-0.050392,-0.509969,-1.000000,0.481890,0.600160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018520,1.644175,-0.117539,0.606553,0.138027,-0.782970,-0.756955,-0.200905,-0.621816,-1.000000,0.473840,0.597250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018179,1.646280,-0.117178,0.567681,0.198306,-0.799007,-0.777898,-0.188471,-0.599461,-1.000000,0.473070,0.600030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022652,1.645867,-0.113931,0.566325,0.094608,-0.818734,-0.783735,-0.245560,-0.570491,-1.000000,0.464590,0.597510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022222,1.647542,-0.114251,0.566638,-0.050395,-0.822424,-0.811677,-0.205889,-0.546617,-1.000000,0.464670,0.599930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026199,1.647389,-0.111661,0.529847,-0.012829,-0.847997,-0.824580,-0.241607,-0.511560,-1.000000,0.458380,0.598040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025425,1.648609,-0.112604,0.528555,-0.399638,-0.748945,-0.846493,-0.181744,-0.500419,-1.000000,0.459140,0.600590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022432,1.648583,-0.114773,0.476643,-0.547816,-0.687538,-0.872479,-0.199005,-0.446293,-1.000000,0.464090,0.602010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026179,1.649437,-0.112837,0.418216,-0.747910,-0.515487,-0.871435,-0.170219,-0.460029,-1.000000,0.458130,0.602180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023141,1.649373,-0.115555,0.385291,-0.754806,-0.530866,-0.906019,-0.200224,-0.372881,-1.000000,0.463480,0.603790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018487,1.648894,-0.117822,0.349996,-0.723147,-0.595450,-0.923929,-0.161676,-0.346722,-1.000000,0.471910,0.604660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018050,1.647939,-0.117009,0.512665,-0.218875,-0.830222,-0.857180,-0.185844,-0.480317,-1.000000,0.472380,0.602420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013596,1.648439,-0.119776,0.278838,-0.677908,-0.680213,-0.944361,-0.064895,-0.322444,-1.000000,0.480730,0.605120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013559,1.647459,-0.119477,0.410167,0.212603,-0.886884,-0.899544,-0.065926,-0.431826,-1.000000,0.481090,0.603010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008879,1.648607,-0.121131,0.146180,-0.705822,-0.693143,-0.978059,0.002016,-0.208320,-1.000000,0.488060,0.605350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008936,1.647576,-0.120851,0.213145,0.385703,-0.897665,-0.971750,-0.011612,-0.235725,-1.000000,0.488420,0.603370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027859,1.648042,-0.110638,0.494588,-0.149179,-0.856229,-0.865761,-0.171196,-0.470267,-1.000000,0.455850,0.598460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027535,1.648852,-0.111235,0.459038,-0.514965,-0.723944,-0.878814,-0.143715,-0.455008,-1.000000,0.456210,0.600430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028496,1.647616,-0.110298,0.307733,-0.003361,-0.951467,-0.951175,0.023948,-0.307723,-1.000000,0.454490,0.597320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026901,1.646373,-0.111357,0.471962,0.198946,-0.858879,-0.825063,-0.243639,-0.509815,-1.000000,0.457390,0.595700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023335,1.644305,-0.113931,0.537810,0.170735,-0.825597,-0.771291,-0.295752,-0.563596,-1.000000,0.464160,0.594850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018828,1.641947,-0.117535,0.594852,0.029944,-0.803277,-0.771474,-0.259421,-0.580972,-1.000000,0.474030,0.594280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014107,1.640793,-0.121132,0.522821,-0.125839,-0.843103,-0.844209,-0.213572,-0.491629,-1.000000,0.482860,0.594450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028366,1.648873,-0.110867,0.159424,-0.698284,-0.697842,-0.984679,-0.061887,-0.163027,-1.000000,0.454900,0.600320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026822,1.649838,-0.113013,0.364502,-0.778667,-0.510701,-0.917863,-0.207932,-0.338070,-1.000000,0.457480,0.602820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023676,1.650087,-0.116193,0.384224,-0.751312,-0.536566,-0.913581,-0.225553,-0.338373,-1.000000,0.463200,0.604890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018918,1.649820,-0.118843,0.328088,-0.745624,-0.580003,-0.940771,-0.202339,-0.272045,-1.000000,0.471620,0.606320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013823,1.649570,-0.121255,0.241074,-0.751309,-0.614344,-0.962034,-0.101535,-0.253339,-1.000000,0.480410,0.607540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008840,1.649634,-0.122950,0.154846,-0.763490,-0.626982,-0.975741,-0.018772,-0.218121,-1.000000,0.488100,0.607940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004322,1.649757,-0.123880,0.139058,-0.800894,-0.582436,-0.988108,-0.073249,-0.135190,-1.000000,0.494440,0.608100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.649439,-0.124278,-0.000088,-0.843607,-0.536960,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.608230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004232,1.652449,-0.126927,0.207965,-0.677226,-0.705773,-0.975362,-0.197887,-0.097521,-1.000000,0.494710,0.609810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.650789,-0.126603,-0.000051,-0.747251,-0.664542,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.609910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004215,1.655135,-0.129372,0.206662,-0.529845,-0.822530,-0.971260,-0.212559,-0.107107,-1.000000,0.494900,0.611990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.653394,-0.128928,-0.000116,-0.592854,-0.805310,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.612020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004390,1.656691,-0.129846,0.157166,-0.323326,-0.933145,-0.981825,-0.152948,-0.112370,-1.000000,0.494880,0.614740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.655550,-0.129745,-0.000022,-0.291346,-0.956618,-1.000000,0.000000,0.000000,-1.000000,0.499980,0.614700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004716,1.658806,-0.130348,-0.037699,0.305180,-0.951548,-0.981794,-0.188711,-0.021626,-1.000000,0.494340,0.618530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.657700,-0.130305,-0.000066,0.321054,-0.947061,-1.000000,0.000000,0.000000,-1.000000,0.499980,0.618160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004924,1.662180,-0.128192,-0.169456,0.463412,-0.869790,-0.971338,-0.227808,0.067867,-1.000000,0.493460,0.623350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.660105,-0.127591,-0.000015,0.534255,-0.845323,-1.000000,0.000000,0.000000,-1.000000,0.499980,0.623090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005616,1.666871,-0.126151,-0.001532,0.200735,-0.979644,-0.999595,-0.028142,-0.004203,-1.000000,0.492020,0.628710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.666491,-0.124487,-0.000006,0.123440,-0.992352,-1.000000,0.000000,0.000000,-1.000000,0.499980,0.628480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006056,1.671661,-0.126411,0.298074,-0.163915,-0.940364,-0.943376,0.099664,-0.316401,-1.000000,0.490020,0.634290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.671351,-0.126940,-0.000323,-0.474800,-0.880094,-1.000000,0.000000,0.000000,-1.000000,0.499980,0.633220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003827,1.673785,-0.129161,0.259063,-0.737834,-0.623287,-0.913047,0.023386,-0.407183,-1.000000,0.492960,0.637050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.673497,-0.129745,-0.001692,-0.791649,-0.610974,-0.999998,0.000000,0.002083,-1.000000,0.499980,0.636520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002944,1.676658,-0.133388,0.299362,-0.786119,-0.540739,-0.916358,-0.078978,-0.392493,-1.000000,0.495730,0.642180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.676824,-0.134333,-0.002831,-0.839004,-0.544118,-0.999996,0.002351,0.001579,-1.000000,0.499980,0.642710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002560,1.680010,-0.139067,0.329065,-0.749285,-0.574707,-0.908282,-0.084644,-0.409706,-1.000000,0.496910,0.647950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.680090,-0.139785,-0.001268,-0.782693,-0.622406,-0.999998,0.002148,0.000000,-1.000000,0.499970,0.648170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002993,1.683685,-0.142610,0.406253,-0.485505,-0.774108,-0.897155,-0.051154,-0.438745,-1.000000,0.496510,0.652620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006152,1.683692,-0.139993,0.640331,-0.446973,-0.624653,-0.696911,0.003834,-0.717147,-1.000000,0.492730,0.652550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006008,1.687674,-0.141487,0.671845,-0.009243,-0.740634,-0.740692,-0.008159,-0.671796,-1.000000,0.493040,0.657110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003110,1.687083,-0.143366,0.407107,-0.035415,-0.912694,-0.912918,-0.047588,-0.405360,-1.000000,0.496580,0.656730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005664,1.691723,-0.140769,0.622787,0.336984,-0.706101,-0.756246,0.027916,-0.653692,-1.000000,0.492740,0.661750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003070,1.690976,-0.142664,0.324654,0.343700,-0.881175,-0.935080,-0.023446,-0.353660,-1.000000,0.496490,0.660980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005058,1.696027,-0.138358,0.576496,0.546879,-0.607105,-0.748783,0.056172,-0.660430,-1.000000,0.492230,0.666810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002796,1.695648,-0.140016,0.270077,0.571990,-0.774523,-0.937982,-0.025300,-0.345760,-1.000000,0.496100,0.666440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004248,1.699205,-0.135305,0.538321,0.677284,-0.501495,-0.728852,0.075429,-0.680504,-1.000000,0.492030,0.671610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.002334,1.699255,-0.136634,0.248671,0.722412,-0.645201,-0.902364,-0.069290,-0.425367,-1.000000,0.495860,0.671820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004708,1.679695,-0.136288,0.536843,-0.692769,-0.481530,-0.698520,-0.044886,-0.714181,-1.000000,0.493970,0.646720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.695540,-0.140458,0.000895,0.581563,-0.813501,-1.000000,0.000000,0.000000,-1.000000,0.499960,0.666380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.699294,-0.136951,0.002056,0.728047,-0.685525,-0.999998,0.001242,-0.001680,-1.000000,0.499960,0.672310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.690693,-0.143321,0.000581,0.351656,-0.936129,-0.999999,0.001140,0.000000,-1.000000,0.499970,0.660680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.686821,-0.143992,0.001392,-0.024369,-0.999702,-0.999999,0.000000,-0.001402,-1.000000,0.499970,0.656510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.683598,-0.143152,0.001174,-0.510760,-0.859722,-0.999999,0.000000,-0.001600,-1.000000,0.499970,0.652580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002315,1.699264,-0.136640,-0.247613,0.721632,-0.646479,-0.902996,0.069928,0.423920,-1.000000,0.504060,0.671830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002765,1.695653,-0.140017,-0.270524,0.571412,-0.774793,-0.938473,0.022936,0.344590,-1.000000,0.503830,0.666450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004233,1.699216,-0.135312,-0.538763,0.675438,-0.503505,-0.729808,-0.075632,0.679456,-1.000000,0.507890,0.671620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005035,1.696030,-0.138359,-0.576536,0.545699,-0.608127,-0.749853,-0.057749,0.659079,-1.000000,0.507700,0.666830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003035,1.690982,-0.142664,-0.326040,0.343341,-0.880803,-0.934649,0.022757,0.354843,-1.000000,0.503450,0.660980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005637,1.691728,-0.140767,-0.622247,0.336520,-0.706798,-0.757257,-0.029904,0.652431,-1.000000,0.507190,0.661760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003054,1.687092,-0.143370,-0.409577,-0.036785,-0.911534,-0.911820,0.048094,0.407765,-1.000000,0.503360,0.656740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005976,1.687683,-0.141488,-0.669878,-0.011042,-0.742389,-0.742468,0.007252,0.669842,-1.000000,0.506890,0.657120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002867,1.683698,-0.142635,-0.407410,-0.485575,-0.773456,-0.897337,0.055454,0.437849,-1.000000,0.503430,0.652630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006112,1.683713,-0.140005,-0.637282,-0.448281,-0.626829,-0.699843,-0.003877,0.714286,-1.000000,0.507210,0.652560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002499,1.680028,-0.139076,-0.334809,-0.747708,-0.573442,-0.907070,0.090925,0.411044,-1.000000,0.503040,0.647950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004660,1.679731,-0.136296,-0.535181,-0.693154,-0.482825,-0.700955,0.045421,0.711757,-1.000000,0.505970,0.646730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002898,1.676683,-0.133386,-0.305095,-0.783898,-0.540759,-0.915362,0.084732,0.393615,-1.000000,0.504220,0.642190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003790,1.673795,-0.129161,-0.262666,-0.735629,-0.624385,-0.912316,-0.021336,0.408930,-1.000000,0.506990,0.637060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006023,1.671667,-0.126410,-0.299169,-0.163057,-0.940165,-0.942936,-0.100426,0.317468,-1.000000,0.509930,0.634300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005586,1.666873,-0.126151,0.001317,0.201112,-0.979567,-0.999645,0.026335,0.004063,-1.000000,0.507930,0.628720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004894,1.662181,-0.128193,0.170119,0.463167,-0.869790,-0.971291,0.227765,-0.068685,-1.000000,0.506500,0.623350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004686,1.658806,-0.130348,0.037949,0.304893,-0.951630,-0.981778,0.188827,0.021347,-1.000000,0.505620,0.618540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004360,1.656692,-0.129846,-0.157691,-0.323457,-0.933011,-0.981726,0.153276,0.112787,-1.000000,0.505090,0.614740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004185,1.655135,-0.129372,-0.207310,-0.529740,-0.822435,-0.971080,0.213211,0.107447,-1.000000,0.505070,0.612000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004202,1.652450,-0.126928,-0.208648,-0.677006,-0.705782,-0.975237,0.198147,0.098238,-1.000000,0.505260,0.609820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008978,1.652327,-0.125460,-0.222002,-0.638501,-0.736907,-0.960856,0.014793,0.276652,-1.000000,0.511550,0.609590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009476,1.655473,-0.127542,-0.256379,-0.557155,-0.789841,-0.948933,-0.010333,0.315308,-1.000000,0.511320,0.611820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014594,1.654164,-0.124988,-0.297146,-0.569434,-0.766452,-0.909125,-0.076655,0.409409,-1.000000,0.519320,0.611030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015172,1.655808,-0.126070,-0.429813,-0.299763,-0.851706,-0.868931,-0.119042,0.480403,-1.000000,0.519670,0.613790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019897,1.652136,-0.121110,-0.403128,-0.579865,-0.707986,-0.901984,0.121037,0.414457,-1.000000,0.528900,0.609390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020679,1.653977,-0.121838,-0.529541,-0.325292,-0.783436,-0.845760,0.131268,0.517164,-1.000000,0.529660,0.611670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015658,1.657590,-0.125563,-0.525662,0.154621,-0.836524,-0.848273,-0.021143,0.529137,-1.000000,0.520960,0.617080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021569,1.656404,-0.121649,-0.574485,-0.001718,-0.818513,-0.806202,0.173992,0.565478,-1.000000,0.531270,0.614450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016869,1.660979,-0.123758,-0.505986,0.252174,-0.824856,-0.848844,0.024173,0.528091,-1.000000,0.523670,0.621430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022712,1.659363,-0.120600,-0.539491,0.143499,-0.829673,-0.818638,0.141068,0.556715,-1.000000,0.533970,0.618130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018540,1.665275,-0.121340,-0.487259,0.314490,-0.814662,-0.860916,-0.016712,0.508473,-1.000000,0.528050,0.627290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.024192,1.662874,-0.118807,-0.502626,0.233046,-0.832500,-0.840665,0.092827,0.533541,-1.000000,0.537960,0.623140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026069,1.666554,-0.116553,-0.444676,0.252935,-0.859236,-0.875099,0.081833,0.476974,-1.000000,0.542490,0.628950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.030968,1.663025,-0.114694,-0.476791,0.126635,-0.869847,-0.864959,0.108675,0.489934,-1.000000,0.550850,0.621570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029405,1.660053,-0.116066,-0.528540,0.099221,-0.843090,-0.833337,0.128705,0.537572,-1.000000,0.547270,0.617100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.033304,1.656827,-0.113695,-0.526442,-0.046957,-0.848913,-0.849315,0.074868,0.522550,-1.000000,0.552810,0.611470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.034872,1.659136,-0.112693,-0.519381,-0.000416,-0.854543,-0.854109,0.032126,0.519101,-1.000000,0.556030,0.614800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035687,1.652988,-0.111643,-0.496497,-0.187017,-0.847653,-0.865279,0.028826,0.500461,-1.000000,0.555670,0.605580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.037453,1.654564,-0.110774,-0.561023,-0.115960,-0.819638,-0.824121,-0.015009,0.566215,-1.000000,0.558810,0.607920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.036817,1.648380,-0.109629,-0.448393,-0.290120,-0.845443,-0.882652,-0.005445,0.469995,-1.000000,0.556920,0.598660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038844,1.648872,-0.108607,-0.538525,-0.242445,-0.806977,-0.826973,-0.031572,0.561355,-1.000000,0.560200,0.599530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020986,1.669742,-0.117949,-0.449818,0.328662,-0.830449,-0.885292,-0.041240,0.463203,-1.000000,0.533650,0.634490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.039107,1.641792,-0.105821,-0.490331,-0.330855,-0.806295,-0.859048,0.027422,0.511159,-1.000000,0.560430,0.589550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.036257,1.642608,-0.107567,-0.374785,-0.337852,-0.863361,-0.922891,0.047193,0.382159,-1.000000,0.556090,0.590680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038232,1.633518,-0.102683,-0.495306,-0.385507,-0.778496,-0.865800,0.145673,0.478716,-1.000000,0.560280,0.579020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035410,1.634068,-0.104379,-0.436993,-0.361233,-0.823740,-0.899421,0.166445,0.404151,-1.000000,0.556010,0.580300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028032,1.670258,-0.114678,-0.301678,0.151662,-0.941270,-0.944832,0.084576,0.316447,-1.000000,0.546740,0.634960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032758,1.666102,-0.113512,-0.343358,0.023915,-0.938900,-0.936282,0.070087,0.344186,-1.000000,0.554450,0.626330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.034819,1.669090,-0.113317,-0.221604,-0.079331,-0.971904,-0.975009,0.001928,0.222155,-1.000000,0.557720,0.631360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029824,1.673774,-0.114157,-0.131197,0.017978,-0.991193,-0.987528,0.085419,0.132262,-1.000000,0.550180,0.640840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.036879,1.672154,-0.113177,-0.245479,-0.047327,-0.968246,-0.966680,-0.062845,0.248154,-1.000000,0.560700,0.636940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031576,1.677402,-0.114107,-0.128560,0.042550,-0.990789,-0.989240,0.064854,0.131145,-1.000000,0.552950,0.646550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025001,1.678199,-0.114321,-0.155377,0.056845,-0.986218,-0.987487,0.018334,0.156634,-1.000000,0.542730,0.648770,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026215,1.682599,-0.114150,-0.152956,0.101247,-0.983033,-0.986581,0.041857,0.157819,-1.000000,0.545260,0.654780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041197,1.666698,-0.111092,-0.397565,-0.166173,-0.902402,-0.874967,-0.227548,0.427381,-1.000000,0.565750,0.628760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038844,1.664117,-0.111365,-0.357544,-0.175631,-0.917233,-0.911247,-0.149386,0.383814,-1.000000,0.562590,0.623280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.036681,1.661613,-0.111765,-0.433691,-0.083005,-0.897231,-0.897907,-0.043438,0.438036,-1.000000,0.559370,0.618690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020669,1.683095,-0.115274,-0.484993,0.099611,-0.868827,-0.872660,0.009602,0.488234,-1.000000,0.536300,0.655710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021335,1.688135,-0.114442,-0.425978,0.173239,-0.887993,-0.897972,0.038809,0.438337,-1.000000,0.538300,0.661680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038830,1.675421,-0.112639,-0.325398,0.049121,-0.944300,-0.943361,-0.085192,0.320643,-1.000000,0.563540,0.642910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032999,1.681089,-0.113484,-0.211333,0.166277,-0.963167,-0.975451,0.026549,0.218611,-1.000000,0.555260,0.652190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040767,1.678952,-0.111594,-0.386806,0.149081,-0.910031,-0.921859,-0.037244,0.385732,-1.000000,0.566140,0.648680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.034285,1.684714,-0.112273,-0.270740,0.290513,-0.917770,-0.953899,0.047312,0.296374,-1.000000,0.557290,0.657400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026955,1.686584,-0.113359,-0.223221,0.242581,-0.944101,-0.974087,-0.019317,0.225347,-1.000000,0.547180,0.660080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027561,1.690123,-0.111927,-0.289815,0.373494,-0.881198,-0.951290,-0.011265,0.308093,-1.000000,0.548810,0.664870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044023,1.660831,-0.107977,-0.539492,-0.239426,-0.807232,-0.761352,-0.270704,0.589120,-1.000000,0.569000,0.620390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041511,1.658603,-0.108688,-0.505127,-0.209596,-0.837208,-0.815273,-0.202383,0.542559,-1.000000,0.565610,0.615070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045772,1.653908,-0.104321,-0.644283,-0.230332,-0.729279,-0.696840,-0.216131,0.683887,-1.000000,0.571790,0.609350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043342,1.651820,-0.105780,-0.612836,-0.211145,-0.761478,-0.747347,-0.158193,0.645328,-1.000000,0.567830,0.604600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.039331,1.656489,-0.109625,-0.544226,-0.138299,-0.827461,-0.824799,-0.092123,0.557871,-1.000000,0.562200,0.610980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041031,1.650061,-0.107248,-0.596226,-0.204714,-0.776277,-0.782338,-0.068849,0.619037,-1.000000,0.563920,0.601410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045916,1.672586,-0.109302,-0.561751,-0.034256,-0.826597,-0.817625,-0.129420,0.561017,-1.000000,0.572030,0.640670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043564,1.669477,-0.110449,-0.485506,-0.101918,-0.868272,-0.838813,-0.225533,0.495507,-1.000000,0.568960,0.634810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046486,1.663231,-0.106943,-0.622929,-0.218369,-0.751182,-0.718591,-0.219779,0.659791,-1.000000,0.572440,0.626380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048891,1.665830,-0.105551,-0.700611,-0.182986,-0.689681,-0.692273,-0.059926,0.719143,-1.000000,0.575790,0.631640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.047012,1.645013,-0.100415,-0.703620,-0.263142,-0.660057,-0.666015,-0.079549,0.741685,-1.000000,0.573790,0.594890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044342,1.643234,-0.102427,-0.654887,-0.280163,-0.701877,-0.718940,-0.055276,0.692871,-1.000000,0.569070,0.591700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046785,1.634551,-0.095733,-0.718897,-0.374725,-0.585464,-0.655326,0.084484,0.750607,-1.000000,0.574630,0.579200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043768,1.633414,-0.098272,-0.656815,-0.391055,-0.644724,-0.726050,0.097139,0.680746,-1.000000,0.569470,0.577940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041719,1.642111,-0.104254,-0.590492,-0.303100,-0.747964,-0.785305,0.002138,0.619105,-1.000000,0.564630,0.589950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040927,1.633124,-0.100600,-0.583193,-0.396376,-0.709064,-0.798682,0.120435,0.589578,-1.000000,0.564720,0.578000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048235,1.656072,-0.102720,-0.706628,-0.230520,-0.668983,-0.661511,-0.120368,0.740213,-1.000000,0.575620,0.614840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050603,1.658281,-0.100816,-0.770422,-0.216136,-0.599780,-0.625508,0.074392,0.776663,-1.000000,0.579110,0.618870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049573,1.647141,-0.098229,-0.761633,-0.243743,-0.600420,-0.619188,0.000000,0.785243,-1.000000,0.578380,0.598870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049698,1.636374,-0.093056,-0.779982,-0.344788,-0.522253,-0.590093,0.127343,0.797229,-1.000000,0.579810,0.581430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.039001,1.624810,-0.096856,-0.596492,-0.479689,-0.643503,-0.795817,0.249312,0.551833,-1.000000,0.564110,0.566760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041678,1.624267,-0.093851,-0.651202,-0.505624,-0.565934,-0.735249,0.235606,0.635530,-1.000000,0.568810,0.564740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.036564,1.626029,-0.099610,-0.547248,-0.437173,-0.713722,-0.836897,0.297085,0.459721,-1.000000,0.559770,0.569630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.034201,1.627292,-0.101957,-0.504846,-0.388467,-0.770859,-0.858631,0.317844,0.402154,-1.000000,0.555610,0.572480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.034625,1.620289,-0.097390,-0.614842,-0.477047,-0.628009,-0.788345,0.393927,0.472583,-1.000000,0.558450,0.562430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032931,1.622280,-0.100325,-0.591435,-0.402719,-0.698586,-0.796581,0.426271,0.428663,-1.000000,0.554680,0.566900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031856,1.628065,-0.103782,-0.501037,-0.356452,-0.788609,-0.860973,0.297619,0.412490,-1.000000,0.551810,0.574410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032754,1.633906,-0.105817,-0.462086,-0.330365,-0.823004,-0.886456,0.199187,0.417755,-1.000000,0.552110,0.580800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029614,1.628018,-0.105194,-0.506808,-0.350318,-0.787669,-0.860122,0.266700,0.434811,-1.000000,0.548320,0.575180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.030288,1.633117,-0.107108,-0.511673,-0.316839,-0.798626,-0.858795,0.216452,0.464349,-1.000000,0.548420,0.580670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.033252,1.640806,-0.107953,-0.358253,-0.295852,-0.885509,-0.932990,0.078497,0.351237,-1.000000,0.552140,0.588720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.030826,1.639493,-0.108884,-0.478336,-0.225070,-0.848845,-0.877655,0.089219,0.470915,-1.000000,0.548480,0.587470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027555,1.631860,-0.108313,-0.510821,-0.338181,-0.790377,-0.859337,0.227081,0.458229,-1.000000,0.544280,0.580070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028126,1.637877,-0.110233,-0.544950,-0.242992,-0.802486,-0.838229,0.180742,0.514494,-1.000000,0.544150,0.586130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023877,1.630042,-0.109650,-0.487278,-0.346622,-0.801507,-0.873019,0.214315,0.438071,-1.000000,0.538100,0.579080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.024310,1.635852,-0.112152,-0.523653,-0.330979,-0.785010,-0.850361,0.259000,0.458046,-1.000000,0.537420,0.585100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018343,1.627380,-0.111406,-0.429304,-0.281484,-0.858175,-0.901950,0.182796,0.391245,-1.000000,0.527880,0.577540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019173,1.633843,-0.114404,-0.436246,-0.433852,-0.788328,-0.895162,0.298341,0.331176,-1.000000,0.527300,0.584810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.024411,1.640802,-0.113665,-0.571819,-0.186529,-0.798893,-0.803283,0.325074,0.499063,-1.000000,0.536870,0.590400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019337,1.637951,-0.116583,-0.519829,-0.359694,-0.774854,-0.843105,0.362184,0.397488,-1.000000,0.526550,0.590060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013000,1.628788,-0.113622,-0.275100,-0.343029,-0.898138,-0.959894,0.150529,0.236524,-1.000000,0.518120,0.580240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013694,1.632953,-0.116348,-0.283090,-0.558920,-0.779403,-0.955075,0.238594,0.175798,-1.000000,0.517820,0.585980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013853,1.636127,-0.119061,-0.368286,-0.563938,-0.739147,-0.927885,0.272777,0.254209,-1.000000,0.517280,0.590660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008383,1.629632,-0.114761,-0.133484,-0.399111,-0.907134,-0.989885,0.098076,0.102511,-1.000000,0.510790,0.582120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008503,1.632861,-0.117595,-0.127792,-0.676216,-0.725535,-0.990147,0.129210,0.053972,-1.000000,0.510490,0.587300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008481,1.635641,-0.120440,-0.198987,-0.714202,-0.671058,-0.979367,0.169579,0.109927,-1.000000,0.510110,0.591550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012378,1.624529,-0.113549,-0.360327,0.132196,-0.923411,-0.925880,0.069889,0.371296,-1.000000,0.517270,0.575110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015734,1.622563,-0.112418,-0.479994,0.066532,-0.874745,-0.871241,0.080567,0.484199,-1.000000,0.523550,0.572530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008411,1.625692,-0.114629,-0.237286,0.219773,-0.946253,-0.963453,0.071410,0.258184,-1.000000,0.510600,0.576910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020548,1.622338,-0.109373,-0.548746,-0.094087,-0.830678,-0.834296,0.124844,0.536995,-1.000000,0.532380,0.571840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.017850,1.619493,-0.111666,-0.600627,0.043661,-0.798336,-0.796929,0.047767,0.602181,-1.000000,0.527000,0.569110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014623,1.620074,-0.114063,-0.539967,0.236532,-0.807768,-0.821408,0.061308,0.567037,-1.000000,0.521010,0.569980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015323,1.617654,-0.113969,-0.596896,0.068545,-0.799385,-0.797016,0.063702,0.600589,-1.000000,0.522080,0.567530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012203,1.620658,-0.115325,-0.438951,0.297892,-0.847693,-0.871987,0.086307,0.481860,-1.000000,0.516350,0.570810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008577,1.621377,-0.116801,-0.297051,0.347634,-0.889332,-0.937135,0.072490,0.341354,-1.000000,0.510250,0.571930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013977,1.638414,-0.120528,-0.464992,-0.384592,-0.797415,-0.881527,0.284366,0.376890,-1.000000,0.517050,0.593020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019097,1.640188,-0.117367,-0.568590,-0.150310,-0.808772,-0.798762,0.335952,0.499116,-1.000000,0.526100,0.592800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023945,1.643072,-0.113979,-0.554088,0.052007,-0.830832,-0.769568,0.348551,0.535049,-1.000000,0.536240,0.593380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028053,1.643132,-0.111166,-0.550706,-0.088604,-0.829984,-0.833847,0.103331,0.542238,-1.000000,0.543810,0.591620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027462,1.645433,-0.111289,-0.487703,0.131836,-0.862998,-0.854147,0.132321,0.502915,-1.000000,0.543190,0.594270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.030270,1.645490,-0.109945,-0.340661,-0.167952,-0.925063,-0.932538,-0.064885,0.355194,-1.000000,0.548110,0.594700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029116,1.647046,-0.110210,-0.204547,-0.043311,-0.977898,-0.959036,-0.191155,0.209067,-1.000000,0.546500,0.596490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028985,1.648823,-0.110844,-0.015717,-0.609926,-0.792303,-0.998397,0.052659,-0.020733,-1.000000,0.546080,0.600290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029876,1.648986,-0.111041,-0.099046,-0.503421,-0.858346,-0.993739,0.094861,0.059033,-1.000000,0.547530,0.600480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028189,1.650889,-0.113570,-0.381491,-0.644580,-0.662556,-0.923299,0.231173,0.306722,-1.000000,0.544560,0.604130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029185,1.651945,-0.114008,-0.415682,-0.530909,-0.738474,-0.909510,0.243182,0.337127,-1.000000,0.546250,0.605400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025693,1.653352,-0.117493,-0.552158,-0.393132,-0.735234,-0.833456,0.237244,0.499066,-1.000000,0.539740,0.608850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026711,1.655128,-0.117494,-0.569157,-0.194242,-0.798956,-0.817680,0.235786,0.525171,-1.000000,0.541560,0.610800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.030336,1.653273,-0.114271,-0.444708,-0.377078,-0.812433,-0.895390,0.210067,0.392617,-1.000000,0.547910,0.606880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027969,1.657365,-0.117037,-0.552477,-0.023138,-0.833207,-0.821947,0.181180,0.539979,-1.000000,0.544070,0.613410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031768,1.654869,-0.114219,-0.483801,-0.199510,-0.852134,-0.874950,0.132479,0.465738,-1.000000,0.550040,0.608810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.034007,1.651695,-0.112043,-0.356646,-0.330520,-0.873819,-0.933541,0.089918,0.347010,-1.000000,0.553020,0.603800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035069,1.647701,-0.109995,-0.262502,-0.352597,-0.898203,-0.964214,0.059971,0.258252,-1.000000,0.554460,0.597740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032360,1.650739,-0.112024,-0.245886,-0.454335,-0.856224,-0.967897,0.162578,0.191688,-1.000000,0.550900,0.602690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031102,1.649844,-0.111595,-0.177894,-0.523501,-0.833247,-0.978891,0.180729,0.095443,-1.000000,0.549370,0.601670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032587,1.647068,-0.110078,-0.205473,-0.330100,-0.921311,-0.978625,0.077582,0.190458,-1.000000,0.551460,0.597100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065435,1.684508,-0.087152,0.875569,-0.217063,-0.431581,-0.437983,0.020276,-0.898755,-1.000000,0.400770,0.652670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067663,1.694784,-0.087195,0.880800,-0.075599,-0.467414,-0.463335,0.065724,-0.883743,-1.000000,0.399980,0.668890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063684,1.676581,-0.085746,0.885691,-0.254263,-0.388461,-0.413626,-0.052120,-0.908954,-1.000000,0.399770,0.640070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064586,1.674046,-0.081157,0.918433,-0.250136,-0.306453,-0.321909,-0.022355,-0.946507,-1.000000,0.395340,0.635940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066199,1.672749,-0.074418,0.936886,-0.237446,-0.256639,-0.267860,-0.015694,-0.963330,-1.000000,0.388600,0.634180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064220,1.661321,-0.071857,0.944149,-0.193382,-0.266806,-0.281887,-0.054670,-0.957889,-1.000000,0.386970,0.615580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068291,1.673330,-0.066140,0.956673,-0.220876,-0.189709,-0.204922,-0.047915,-0.977605,-1.000000,0.378370,0.634420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071092,1.684108,-0.067045,0.951750,-0.256148,-0.168996,-0.177532,-0.010398,-0.984060,-1.000000,0.378510,0.652060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070553,1.675648,-0.054648,0.967031,-0.226372,-0.116648,-0.123379,-0.015767,-0.992234,-1.000000,0.362010,0.637490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.073664,1.686573,-0.055226,0.963624,-0.240908,-0.115728,-0.115322,0.015832,-0.993202,-1.000000,0.363340,0.656410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.076274,1.698282,-0.054532,0.989682,-0.047784,-0.135078,-0.132768,0.048607,-0.989954,-1.000000,0.363450,0.676740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074093,1.695372,-0.066618,0.980197,-0.105012,-0.167888,-0.165119,0.034595,-0.985667,-1.000000,0.377280,0.670880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.078146,1.700960,-0.038211,0.991516,-0.033503,-0.125594,-0.122045,0.092606,-0.988195,-1.000000,0.345150,0.682970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.075968,1.689433,-0.039669,0.970969,-0.214233,-0.106415,-0.093855,0.068000,-0.993261,-1.000000,0.344660,0.662120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.073752,1.706113,-0.066077,0.975864,0.122725,-0.180633,-0.190311,0.072244,-0.979062,-1.000000,0.377350,0.688710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074420,1.711835,-0.055500,0.978032,0.106429,-0.179236,-0.187749,0.076157,-0.979260,-1.000000,0.366330,0.699520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071728,1.714963,-0.064735,0.960850,0.164785,-0.222741,-0.239373,0.088871,-0.966852,-1.000000,0.377370,0.703520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.077505,1.713487,-0.037118,0.984914,0.063420,-0.161005,-0.168325,0.135287,-0.976404,-1.000000,0.345810,0.705180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.075921,1.727226,-0.039624,0.980547,0.020409,-0.195219,-0.196179,0.134169,-0.971346,-1.000000,0.351180,0.728520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072810,1.726261,-0.054025,0.974006,0.055133,-0.219710,-0.224330,0.100168,-0.969352,-1.000000,0.367510,0.724140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072894,1.678489,-0.039771,0.961155,-0.259011,-0.095367,-0.081807,0.062663,-0.994676,-1.000000,0.342350,0.642550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069081,1.664428,-0.052353,0.978808,-0.178036,-0.101183,-0.109345,-0.036619,-0.993329,-1.000000,0.359090,0.618440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066847,1.662053,-0.063457,0.962678,-0.180754,-0.201441,-0.217466,-0.073513,-0.973296,-1.000000,0.375960,0.615750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070197,1.667506,-0.038712,0.971752,-0.232426,-0.040942,-0.029355,0.053095,-0.998158,-1.000000,0.338820,0.623320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067458,1.653431,-0.049348,0.975460,-0.209533,-0.067627,-0.076257,-0.033377,-0.996529,-1.000000,0.355910,0.599360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065404,1.650578,-0.059750,0.958583,-0.222398,-0.177924,-0.199780,-0.079799,-0.976586,-1.000000,0.373250,0.595670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068127,1.656911,-0.037223,0.973179,-0.227537,0.033909,0.045084,0.044093,-0.998010,-1.000000,0.335980,0.605310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064922,1.643596,-0.046884,0.956983,-0.287613,-0.038245,-0.049110,-0.030654,-0.998323,-1.000000,0.354950,0.582060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065762,1.646890,-0.036636,0.956199,-0.280145,0.084863,0.102268,0.048081,-0.993594,-1.000000,0.335760,0.588090,4,3,2,2,0.984948,0.015052,0.000000,0.000000},
-	{ 0.063128,1.640399,-0.056151,0.940250,-0.313494,-0.132862,-0.168469,-0.089247,-0.981658,-1.000000,0.372120,0.577650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.075279,1.742418,-0.044968,0.968954,0.015909,-0.246727,-0.246681,0.129264,-0.960437,-1.000000,0.360980,0.753510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071997,1.739632,-0.057327,0.960401,0.043434,-0.275217,-0.278527,0.123694,-0.952430,-1.000000,0.374690,0.746030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071846,1.759490,-0.052624,0.945356,0.124297,-0.301418,-0.318334,0.152066,-0.935703,-1.000000,0.375920,0.780400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068630,1.752209,-0.063540,0.931875,0.118466,-0.342892,-0.358218,0.151058,-0.921337,-1.000000,0.386330,0.765380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069511,1.736904,-0.065714,0.957814,0.078284,-0.276522,-0.284152,0.113941,-0.951985,-1.000000,0.383660,0.739760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066483,1.747321,-0.070798,0.930062,0.151070,-0.334905,-0.355229,0.137058,-0.924677,-1.000000,0.393110,0.755540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063473,1.763120,-0.071330,0.898188,0.174388,-0.403542,-0.431841,0.178181,-0.884175,-1.000000,0.400820,0.780790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061923,1.756674,-0.077609,0.895854,0.199561,-0.397016,-0.429457,0.159479,-0.888894,-1.000000,0.405570,0.768390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058046,1.772679,-0.078459,0.806755,0.286803,-0.516615,-0.575928,0.186191,-0.796015,-1.000000,0.415710,0.793620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056669,1.764981,-0.084013,0.802405,0.278684,-0.527713,-0.580436,0.158921,-0.798648,-1.000000,0.418310,0.779270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049993,1.779602,-0.083884,0.655324,0.405874,-0.637038,-0.741949,0.187732,-0.643637,-1.000000,0.430150,0.802210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049372,1.771139,-0.089096,0.648278,0.375675,-0.662272,-0.748256,0.153395,-0.645432,-1.000000,0.431310,0.787130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040699,1.775221,-0.093851,0.542996,0.421201,-0.726460,-0.835298,0.182107,-0.518762,-1.000000,0.445160,0.791080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040965,1.783974,-0.088758,0.545707,0.455986,-0.703051,-0.832986,0.203753,-0.514412,-1.000000,0.444690,0.806140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032591,1.777460,-0.098033,0.466026,0.440822,-0.767135,-0.884138,0.199237,-0.422617,-1.000000,0.457130,0.791560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032473,1.786161,-0.093176,0.451878,0.491943,-0.744177,-0.889560,0.185827,-0.417315,-1.000000,0.457030,0.806270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025080,1.786418,-0.097003,0.381651,0.504882,-0.774233,-0.922555,0.156526,-0.352693,-1.000000,0.467330,0.804370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025499,1.778320,-0.101410,0.387569,0.453193,-0.802750,-0.921737,0.177453,-0.344835,-1.000000,0.466820,0.790480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019241,1.786592,-0.099314,0.275117,0.536910,-0.797520,-0.960799,0.123967,-0.247985,-1.000000,0.475090,0.803170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019148,1.778523,-0.103992,0.301389,0.465339,-0.832240,-0.953500,0.145735,-0.263816,-1.000000,0.475170,0.789020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012814,1.786837,-0.101155,0.217777,0.543321,-0.810787,-0.975992,0.118204,-0.182941,-1.000000,0.483760,0.802130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012908,1.778527,-0.105936,0.211243,0.474443,-0.854564,-0.977422,0.106818,-0.182308,-1.000000,0.483300,0.787720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007040,1.787184,-0.102052,0.089264,0.560585,-0.823272,-0.995781,0.067861,-0.061760,-1.000000,0.491220,0.801660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006615,1.778521,-0.107135,0.101414,0.482798,-0.869840,-0.994828,0.054258,-0.085871,-1.000000,0.491470,0.786890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.787902,-0.101974,0.000092,0.577667,-0.816273,-1.000000,0.000000,0.000000,-1.000000,0.499910,0.802210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.778567,-0.107509,0.000212,0.486862,-0.873479,-1.000000,0.000000,0.000000,-1.000000,0.499920,0.786600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.798679,-0.093649,0.000030,0.719265,-0.694736,-1.000000,0.000000,0.000000,-1.000000,0.499900,0.822500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.010520,1.796330,-0.094559,0.144248,0.692141,-0.707201,-0.989426,0.089975,-0.113755,-1.000000,0.487360,0.819520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.809937,-0.079985,0.000009,0.869327,-0.494236,-1.000000,0.000000,0.000000,-1.000000,0.499890,0.848020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.011939,1.808788,-0.080421,0.124751,0.838115,-0.531038,-0.989613,0.066571,-0.127412,-1.000000,0.483970,0.846450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021858,1.807545,-0.078756,0.270544,0.804686,-0.528476,-0.950582,0.136436,-0.278889,-1.000000,0.469360,0.845620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021936,1.795454,-0.091759,0.282951,0.662682,-0.693391,-0.954102,0.120515,-0.274162,-1.000000,0.471500,0.820480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.033400,1.805735,-0.074329,0.385472,0.800198,-0.459450,-0.889793,0.190531,-0.414688,-1.000000,0.451560,0.846250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032525,1.796059,-0.086061,0.412828,0.634000,-0.653925,-0.899941,0.173355,-0.400067,-1.000000,0.456060,0.824480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044469,1.801372,-0.069630,0.563414,0.710520,-0.421576,-0.757607,0.240792,-0.606672,-1.000000,0.433290,0.842690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042045,1.793364,-0.081281,0.554681,0.574582,-0.601818,-0.811905,0.215513,-0.542553,-1.000000,0.441570,0.823690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054403,1.794316,-0.064481,0.720715,0.579558,-0.380372,-0.598088,0.242405,-0.763892,-1.000000,0.414780,0.834080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051546,1.788067,-0.076127,0.687029,0.497346,-0.529753,-0.689591,0.216474,-0.691088,-1.000000,0.425400,0.818380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.060100,1.779904,-0.070468,0.825523,0.356855,-0.437225,-0.524976,0.201193,-0.826995,-1.000000,0.409440,0.807920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062740,1.784814,-0.059047,0.848297,0.411081,-0.333772,-0.447024,0.218089,-0.867529,-1.000000,0.398070,0.820620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065739,1.769517,-0.063565,0.904080,0.208146,-0.373248,-0.410801,0.182483,-0.893276,-1.000000,0.394120,0.793660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068471,1.773215,-0.053932,0.914783,0.264582,-0.305235,-0.358876,0.185475,-0.914772,-1.000000,0.384230,0.803080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072629,1.775751,-0.038911,0.922554,0.310405,-0.229223,-0.285589,0.149790,-0.946574,-1.000000,0.367200,0.812360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.077154,1.761132,-0.034453,0.965767,0.132328,-0.223123,-0.239297,0.122361,-0.963206,-1.000000,0.355010,0.787740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.079060,1.744709,-0.028632,0.982292,0.001461,-0.187350,-0.185940,0.130277,-0.973886,-1.000000,0.342400,0.761070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.079333,1.728252,-0.021838,0.988369,-0.001207,-0.152069,-0.148416,0.210322,-0.966301,-1.000000,0.330340,0.735600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081041,1.711902,-0.014302,0.981724,0.057224,-0.181505,-0.187715,0.134141,-0.973021,-1.000000,0.319250,0.711040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.079523,1.701495,-0.022614,0.990457,-0.047859,-0.129248,-0.121208,0.143925,-0.982138,-1.000000,0.328280,0.687490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.078022,1.690068,-0.025546,0.976934,-0.167440,-0.132525,-0.105954,0.158739,-0.981619,-1.000000,0.328740,0.665870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.075236,1.680098,-0.026429,0.944045,-0.283125,-0.169175,-0.113965,0.201316,-0.972874,-1.000000,0.326410,0.648290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071224,1.669473,-0.025964,0.936105,-0.326723,-0.130230,-0.058401,0.220738,-0.973583,-1.000000,0.321460,0.629660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067575,1.659865,-0.025296,0.938890,-0.343950,-0.013587,0.054743,0.188170,-0.980610,-1.000000,0.317630,0.612100,4,3,2,2,0.978924,0.021076,0.000000,0.000000},
-	{ 0.064764,1.649221,-0.026543,0.928674,-0.351246,0.119125,0.182709,0.153733,-0.971074,-1.000000,0.318590,0.593650,4,3,2,2,0.939915,0.060085,0.000000,0.000000},
-	{ 0.080900,1.699838,-0.013944,0.968614,-0.119588,-0.217911,-0.204708,0.113503,-0.972220,-1.000000,0.319610,0.686510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.078202,1.683920,-0.017927,0.955879,-0.182194,-0.230435,-0.171291,0.291583,-0.941084,-1.000000,0.319130,0.658660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074683,1.668771,-0.015882,0.869177,-0.359818,-0.339208,-0.192142,0.386319,-0.902130,-1.000000,0.308560,0.635590,4,3,2,2,0.991189,0.008811,0.000000,0.000000},
-	{ 0.069919,1.661186,-0.013826,0.859083,-0.500300,-0.108054,0.001961,0.214326,-0.976760,-1.000000,0.300440,0.620870,4,3,2,2,0.926555,0.073445,0.000000,0.000000},
-	{ 0.063168,1.649145,-0.015671,0.898725,-0.430679,0.082514,0.166805,0.161734,-0.972635,-1.000000,0.301350,0.597520,4,3,2,2,0.808758,0.191242,0.000000,0.000000},
-	{ 0.061392,1.638392,-0.030446,0.876613,-0.439127,0.196766,0.281221,0.135713,-0.949998,-1.000000,0.327020,0.573820,4,3,2,2,0.928180,0.071820,0.000000,0.000000},
-	{ 0.062778,1.638094,-0.037525,0.916531,-0.381534,0.120012,0.143248,0.032979,-0.989137,-1.000000,0.340100,0.572200,4,3,2,2,0.977976,0.022024,0.000000,0.000000},
-	{ 0.057385,1.630212,-0.035823,0.796638,-0.571823,0.195926,0.280999,0.063363,-0.957614,-1.000000,0.342830,0.556050,4,3,2,2,0.935407,0.064593,0.000000,0.000000},
-	{ 0.060176,1.632419,-0.038882,0.837001,-0.522756,0.161725,0.172733,-0.028027,-0.984570,-1.000000,0.346420,0.561110,4,3,2,2,0.973533,0.026467,0.000000,0.000000},
-	{ 0.058754,1.629294,-0.043992,0.827464,-0.557822,0.064329,0.023535,-0.080009,-0.996516,-1.000000,0.359620,0.555150,4,3,2,2,0.987443,0.012557,0.000000,0.000000},
-	{ 0.062063,1.635394,-0.045327,0.920505,-0.390417,-0.015691,-0.036021,-0.044804,-0.998346,-1.000000,0.356850,0.567170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.060072,1.632183,-0.053094,0.897249,-0.433217,-0.085248,-0.153117,-0.124207,-0.980371,-1.000000,0.372940,0.562550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056380,1.625734,-0.050486,0.815542,-0.578687,-0.003510,-0.127451,-0.173693,-0.976518,-1.000000,0.374750,0.549890,4,3,2,2,0.992160,0.007840,0.000000,0.000000},
-	{ 0.053816,1.622582,-0.056221,0.800009,-0.598858,-0.036811,-0.221937,-0.238366,-0.945476,-1.000000,0.385460,0.546560,4,3,2,2,0.994151,0.005849,0.000000,0.000000},
-	{ 0.057804,1.629374,-0.059738,0.881297,-0.457307,-0.119108,-0.222992,-0.180218,-0.958017,-1.000000,0.384130,0.559590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054445,1.624586,-0.042099,0.760707,-0.636293,0.128280,0.115173,-0.062179,-0.991398,-1.000000,0.361320,0.544870,4,3,2,2,0.933308,0.066692,0.000000,0.000000},
-	{ 0.051798,1.620572,-0.048202,0.746398,-0.661694,0.071064,-0.076007,-0.190843,-0.978674,-1.000000,0.377050,0.538760,4,3,2,2,0.939909,0.060091,0.000000,0.000000},
-	{ 0.049244,1.617455,-0.053192,0.729376,-0.683943,0.015243,-0.224019,-0.259834,-0.939309,-1.000000,0.387250,0.535390,4,3,2,2,0.948658,0.051342,0.000000,0.000000},
-	{ 0.057504,1.634718,-0.023970,0.895160,-0.433768,0.102641,0.226813,0.245025,-0.942612,-1.000000,0.317790,0.569320,4,3,2,2,0.777237,0.222763,0.000000,0.000000},
-	{ 0.051226,1.622782,-0.032490,0.881468,-0.472240,-0.001962,0.121656,0.231089,-0.965297,-1.000000,0.344300,0.542560,4,3,2,2,0.773207,0.226793,0.000000,0.000000},
-	{ 0.053281,1.625692,-0.018703,0.943844,-0.328759,-0.032811,0.056508,0.258477,-0.964363,-1.000000,0.313040,0.556650,4,3,2,2,0.591266,0.408734,0.000000,0.000000},
-	{ 0.048140,1.613695,-0.026993,0.932102,-0.296680,-0.207768,-0.114780,0.302116,-0.946336,-1.000000,0.340290,0.530460,4,3,2,2,0.533923,0.466077,0.000000,0.000000},
-	{ 0.042613,1.603063,-0.034469,0.888247,-0.298719,-0.348976,-0.311618,0.166330,-0.935536,-1.000000,0.371800,0.507800,4,3,2,2,0.503983,0.496017,0.000000,0.000000},
-	{ 0.044861,1.612184,-0.037878,0.881815,-0.437645,-0.175695,-0.131764,0.129075,-0.982842,-1.000000,0.369290,0.522390,4,3,2,2,0.680822,0.319178,0.000000,0.000000},
-	{ 0.039648,1.605428,-0.046099,0.804560,-0.519557,-0.287652,-0.361480,-0.044137,-0.931335,-1.000000,0.393510,0.511090,4,3,2,2,0.716883,0.283117,0.000000,0.000000},
-	{ 0.036175,1.594495,-0.041325,0.776134,-0.384103,-0.500081,-0.532375,0.025856,-0.846114,-1.000000,0.401100,0.491830,3,4,2,2,0.510356,0.489644,0.000000,0.000000},
-	{ 0.029368,1.596927,-0.053185,0.630867,-0.606387,-0.484047,-0.628406,-0.033402,-0.777168,-1.000000,0.422450,0.496480,4,3,2,2,0.706241,0.293759,0.000000,0.000000},
-	{ 0.027425,1.587772,-0.046957,0.582333,-0.465975,-0.666149,-0.754987,-0.006123,-0.655711,-1.000000,0.429420,0.480270,3,4,2,2,0.529100,0.470900,0.000000,0.000000},
-	{ 0.017467,1.590500,-0.055418,0.364542,-0.626475,-0.688940,-0.853815,0.070394,-0.515795,-1.000000,0.452740,0.483920,4,3,2,2,0.633581,0.366419,0.000000,0.000000},
-	{ 0.017383,1.583621,-0.050306,0.351774,-0.498854,-0.792085,-0.904598,0.036457,-0.424703,-1.000000,0.456460,0.473110,3,4,2,2,0.561242,0.438758,0.000000,0.000000},
-	{ 0.008132,1.587439,-0.054974,0.105236,-0.613360,-0.782761,-0.968491,0.115450,-0.220671,-1.000000,0.477980,0.476980,4,3,2,2,0.551018,0.448982,0.000000,0.000000},
-	{ 0.008261,1.582138,-0.051560,0.120002,-0.485277,-0.866086,-0.979604,0.083745,-0.182654,-1.000000,0.479530,0.469550,3,4,2,2,0.585312,0.414688,0.000000,0.000000},
-	{ 0.000000,1.587029,-0.054654,-0.000028,-0.603338,-0.797485,-1.000000,0.000000,0.000000,-1.000000,0.500000,0.475200,4,3,2,2,0.533555,0.466445,0.000000,0.000000},
-	{ 0.000000,1.581967,-0.051574,-0.000016,-0.466370,-0.884590,-1.000000,0.000000,0.000000,-1.000000,0.500040,0.468480,3,4,2,2,0.585471,0.414529,0.000000,0.000000},
-	{ 0.050653,1.613038,-0.015364,0.976129,-0.183526,-0.116144,-0.086172,0.163608,-0.982755,-1.000000,0.312770,0.535740,3,4,2,2,0.679185,0.320815,0.000000,0.000000},
-	{ 0.046609,1.601828,-0.024333,0.932106,-0.167637,-0.321055,-0.281372,0.222991,-0.933330,-1.000000,0.342510,0.511360,3,4,2,2,0.685879,0.314121,0.000000,0.000000},
-	{ 0.049124,1.598558,-0.013710,0.984488,-0.087758,-0.151928,-0.143799,0.092548,-0.985270,-1.000000,0.316820,0.507980,3,4,2,2,0.835816,0.164184,0.000000,0.000000},
-	{ 0.045552,1.588660,-0.022577,0.911984,-0.096580,-0.398694,-0.381962,0.154588,-0.911157,-1.000000,0.348230,0.486550,3,4,2,2,0.846169,0.153831,0.000000,0.000000},
-	{ 0.040276,1.580097,-0.029288,0.786305,-0.149260,-0.599538,-0.586921,0.122670,-0.800297,-1.000000,0.382330,0.467340,3,4,2,2,0.847414,0.152586,0.000000,0.000000},
-	{ 0.041248,1.592134,-0.031620,0.846361,-0.207511,-0.490522,-0.466697,0.154840,-0.870757,-1.000000,0.376500,0.489360,3,4,2,2,0.699757,0.300243,0.000000,0.000000},
-	{ 0.033286,1.573054,-0.034791,0.629278,-0.225038,-0.743887,-0.765444,-0.013748,-0.643355,-1.000000,0.414210,0.453680,3,4,2,2,0.875025,0.124975,0.000000,0.000000},
-	{ 0.034434,1.584343,-0.037784,0.712999,-0.290205,-0.638290,-0.662326,0.020017,-0.748949,-1.000000,0.408370,0.473530,3,4,2,2,0.738910,0.261090,0.000000,0.000000},
-	{ 0.025836,1.578383,-0.042785,0.519622,-0.375059,-0.767674,-0.840642,-0.063862,-0.537812,-1.000000,0.436770,0.464150,3,4,2,2,0.751831,0.248169,0.000000,0.000000},
-	{ 0.024487,1.567703,-0.038812,0.440844,-0.297455,-0.846863,-0.897340,-0.124073,-0.423540,-1.000000,0.441310,0.446130,3,4,2,2,0.874397,0.125603,0.000000,0.000000},
-	{ 0.015006,1.573898,-0.045992,0.331559,-0.410705,-0.849347,-0.938946,-0.055938,-0.339487,-1.000000,0.464690,0.458700,3,4,2,2,0.758099,0.241901,0.000000,0.000000},
-	{ 0.015633,1.564216,-0.041121,0.311155,-0.340302,-0.887343,-0.948476,-0.169947,-0.267416,-1.000000,0.463190,0.442940,3,4,2,2,0.859799,0.140201,0.000000,0.000000},
-	{ 0.048745,1.583005,-0.012512,0.975050,0.010332,-0.221743,-0.221537,0.108623,-0.969083,-1.000000,0.322500,0.477960,3,4,2,2,0.938733,0.061268,0.000000,0.000000},
-	{ 0.045527,1.574271,-0.020747,0.872547,-0.033431,-0.487385,-0.477551,0.151951,-0.865365,-1.000000,0.353700,0.459490,3,4,2,2,0.928883,0.069056,0.002062,0.000000},
-	{ 0.050374,1.566898,-0.010391,0.903518,0.177766,-0.389941,-0.412278,0.112201,-0.904123,-1.000000,0.327340,0.449230,3,2,2,2,0.897189,0.102811,0.000000,0.000000},
-	{ 0.046748,1.558703,-0.018404,0.775518,0.101201,-0.623161,-0.630899,0.160492,-0.759084,-1.000000,0.355860,0.432470,3,2,2,2,0.876582,0.123418,0.000000,0.000000},
-	{ 0.040637,1.551349,-0.025058,0.635666,0.066392,-0.769104,-0.770512,0.115648,-0.626847,-1.000000,0.387050,0.417250,3,2,2,2,0.872779,0.127221,0.000000,0.000000},
-	{ 0.040001,1.566477,-0.027028,0.723753,-0.090771,-0.684063,-0.676159,0.104686,-0.729281,-1.000000,0.386000,0.442830,3,4,2,2,0.938329,0.057888,0.003783,0.000000},
-	{ 0.032768,1.545092,-0.030779,0.475376,0.078704,-0.876255,-0.878319,-0.014980,-0.477841,-1.000000,0.419090,0.406230,3,2,2,2,0.891601,0.108399,0.000000,0.000000},
-	{ 0.032560,1.559882,-0.032119,0.550151,-0.128377,-0.825138,-0.834182,-0.039042,-0.550106,-1.000000,0.417880,0.430900,3,4,2,2,0.943725,0.052123,0.004152,0.000000},
-	{ 0.023496,1.554690,-0.035511,0.345997,-0.147303,-0.926600,-0.934838,-0.138098,-0.327120,-1.000000,0.444660,0.424150,3,4,2,2,0.945015,0.052218,0.002768,0.000000},
-	{ 0.023928,1.539889,-0.034788,0.257215,0.097219,-0.961452,-0.956340,-0.117254,-0.267703,-1.000000,0.445270,0.399210,3,2,2,2,0.925421,0.074579,0.000000,0.000000},
-	{ 0.013400,1.551196,-0.037269,0.189289,-0.149508,-0.970473,-0.976815,-0.129332,-0.170601,-1.000000,0.468110,0.420910,3,4,2,2,0.952991,0.044634,0.002375,0.000000},
-	{ 0.015112,1.535278,-0.036229,0.051313,0.100891,-0.993573,-0.990551,-0.121559,-0.063500,-1.000000,0.465740,0.393940,3,2,2,2,0.891883,0.108117,0.000000,0.000000},
-	{ 0.006118,1.544710,-0.037133,0.074936,-0.099069,-0.992255,-0.996719,-0.037965,-0.071482,-1.000000,0.485400,0.410420,3,4,2,2,0.944594,0.054063,0.001343,0.000000},
-	{ 0.007312,1.531530,-0.036567,-0.025358,0.095155,-0.995139,-0.996823,-0.077591,0.017982,-1.000000,0.483380,0.389240,3,2,2,2,0.825813,0.174187,0.000000,0.000000},
-	{ 0.000000,1.543239,-0.037528,-0.000033,-0.098874,-0.995100,-1.000000,0.000000,0.000000,-1.000000,0.500070,0.407930,3,4,2,2,0.941909,0.056772,0.001320,0.000000},
-	{ 0.000000,1.530172,-0.037038,0.000032,0.083797,-0.996483,-1.000000,0.000000,0.000000,-1.000000,0.500100,0.387500,3,2,2,2,0.775697,0.224303,0.000000,0.000000},
-	{ 0.056210,1.551156,-0.009223,0.700232,0.384895,-0.601274,-0.655960,0.014467,-0.754657,-1.000000,0.328110,0.422850,3,2,2,2,0.709936,0.290064,0.000000,0.000000},
-	{ 0.051053,1.542943,-0.017985,0.602496,0.306564,-0.736897,-0.789498,0.093557,-0.606581,-1.000000,0.356800,0.407320,3,2,2,2,0.645396,0.354604,0.000000,0.000000},
-	{ 0.043732,1.535702,-0.025900,0.516685,0.292445,-0.804682,-0.853165,0.097115,-0.512522,-1.000000,0.388570,0.392940,3,2,2,2,0.612300,0.387700,0.000000,0.000000},
-	{ 0.035274,1.529706,-0.032974,0.402529,0.315017,-0.859497,-0.907913,0.017487,-0.418795,-1.000000,0.419530,0.381720,3,2,2,2,0.628724,0.371276,0.000000,0.000000},
-	{ 0.026186,1.524739,-0.038158,0.195981,0.343815,-0.918359,-0.966756,-0.089114,-0.239672,-1.000000,0.444630,0.374370,3,2,2,2,0.615118,0.384882,0.000000,0.000000},
-	{ 0.016931,1.520383,-0.040125,-0.054290,0.349738,-0.935273,-0.986662,-0.162745,-0.003584,-1.000000,0.463930,0.369480,3,2,2,2,0.572176,0.427824,0.000000,0.000000},
-	{ 0.008213,1.516634,-0.039421,-0.146057,0.340207,-0.928938,-0.983741,-0.149142,0.100053,-1.000000,0.481970,0.366410,3,2,2,2,0.521982,0.478018,0.000000,0.000000},
-	{ 0.000000,1.515050,-0.038912,0.000112,0.344489,-0.938790,-1.000000,0.000000,0.000000,-1.000000,0.500130,0.365320,3,2,2,2,0.514915,0.485085,0.000000,0.000000},
-	{ 0.004979,1.554280,-0.039619,0.128937,-0.292241,-0.947613,-0.991534,-0.052786,-0.118634,-1.000000,0.487870,0.428160,3,4,2,2,0.910691,0.089309,0.000000,0.000000},
-	{ 0.008850,1.556408,-0.039689,0.187410,-0.323207,-0.927585,-0.980537,-0.117817,-0.157056,-1.000000,0.478610,0.431400,3,4,2,2,0.899075,0.100925,0.000000,0.000000},
-	{ 0.004797,1.561897,-0.042906,0.105365,-0.398344,-0.911164,-0.993980,-0.014507,-0.108599,-1.000000,0.489040,0.441340,3,4,2,2,0.855252,0.144748,0.000000,0.000000},
-	{ 0.009437,1.562637,-0.042357,0.211120,-0.385045,-0.898426,-0.977337,-0.097736,-0.187776,-1.000000,0.478010,0.442160,3,4,2,2,0.849153,0.150847,0.000000,0.000000},
-	{ 0.005428,1.568652,-0.045890,0.102411,-0.386689,-0.916506,-0.989843,0.051718,-0.132426,-1.000000,0.488100,0.451260,3,4,2,2,0.775506,0.224494,0.000000,0.000000},
-	{ 0.009484,1.568080,-0.044990,0.226567,-0.402715,-0.886842,-0.971730,-0.031390,-0.234000,-1.000000,0.478400,0.450840,3,4,2,2,0.787169,0.212831,0.000000,0.000000},
-	{ 0.000000,1.568829,-0.046190,-0.000007,-0.382760,-0.923848,-1.000000,0.000000,0.000000,-1.000000,0.500050,0.451040,3,4,2,2,0.772509,0.227491,0.000000,0.000000},
-	{ 0.000000,1.561628,-0.043049,-0.000024,-0.392399,-0.919795,-1.000000,0.000000,0.000000,-1.000000,0.500030,0.440880,3,4,2,2,0.844761,0.155239,0.000000,0.000000},
-	{ 0.000000,1.553368,-0.039747,-0.000045,-0.286269,-0.958149,-1.000000,0.000000,0.000000,-1.000000,0.500030,0.426730,3,4,2,2,0.898634,0.101366,0.000000,0.000000},
-	{ 0.007000,1.575392,-0.048518,0.120926,-0.405111,-0.906235,-0.985431,0.060998,-0.158761,-1.000000,0.483880,0.460160,3,4,2,2,0.699389,0.300611,0.000000,0.000000},
-	{ 0.000000,1.575661,-0.048842,-0.000007,-0.388586,-0.921413,-1.000000,0.000000,0.000000,-1.000000,0.500050,0.459750,3,4,2,2,0.693175,0.306825,0.000000,0.000000},
-	{ -0.004758,1.561897,-0.042906,-0.105814,-0.398297,-0.911133,-0.993888,0.013365,0.109583,-1.000000,0.511050,0.441340,3,4,2,2,0.855233,0.144767,0.000000,0.000000},
-	{ -0.005375,1.568652,-0.045890,-0.102725,-0.386650,-0.916488,-0.989698,-0.052645,0.133141,-1.000000,0.512000,0.451270,3,4,2,2,0.775484,0.224516,0.000000,0.000000},
-	{ -0.009406,1.562637,-0.042356,-0.210935,-0.385010,-0.898484,-0.977401,0.096180,0.188248,-1.000000,0.522100,0.442180,3,4,2,2,0.849069,0.150931,0.000000,0.000000},
-	{ -0.009451,1.568081,-0.044990,-0.226172,-0.402606,-0.886992,-0.971798,0.030874,0.233783,-1.000000,0.521710,0.450850,3,4,2,2,0.787031,0.212969,0.000000,0.000000},
-	{ -0.006950,1.575393,-0.048518,-0.121135,-0.405120,-0.906203,-0.985273,-0.061918,0.159385,-1.000000,0.516220,0.460170,3,4,2,2,0.699215,0.300785,0.000000,0.000000},
-	{ -0.008214,1.582139,-0.051560,-0.120125,-0.485294,-0.866060,-0.979430,-0.084539,0.183221,-1.000000,0.520550,0.469560,3,4,2,2,0.580511,0.419489,0.000000,0.000000},
-	{ -0.008086,1.587439,-0.054974,-0.105366,-0.613385,-0.782724,-0.968116,-0.116611,0.221706,-1.000000,0.522070,0.476980,4,3,2,2,0.554643,0.445357,0.000000,0.000000},
-	{ -0.017350,1.583621,-0.050307,-0.351534,-0.498844,-0.792199,-0.904400,-0.037637,0.425023,-1.000000,0.543620,0.473130,3,4,2,2,0.551689,0.448311,0.000000,0.000000},
-	{ -0.017432,1.590500,-0.055418,-0.364354,-0.626418,-0.689091,-0.853423,-0.071548,0.516284,-1.000000,0.547330,0.483950,4,3,2,2,0.639965,0.360035,0.000000,0.000000},
-	{ -0.027394,1.587772,-0.046957,-0.582267,-0.465956,-0.666220,-0.754676,0.005001,0.656078,-1.000000,0.570650,0.480320,3,4,2,2,0.529006,0.470994,0.000000,0.000000},
-	{ -0.029336,1.596928,-0.053185,-0.630759,-0.606388,-0.484187,-0.628138,0.032632,0.777418,-1.000000,0.577610,0.496530,4,3,2,2,0.705966,0.294034,0.000000,0.000000},
-	{ -0.036145,1.594495,-0.041325,-0.776108,-0.384103,-0.500122,-0.532049,-0.026867,0.846287,-1.000000,0.598960,0.491900,3,4,2,2,0.510236,0.489764,0.000000,0.000000},
-	{ -0.039618,1.605428,-0.046099,-0.804533,-0.519580,-0.287686,-0.361064,0.043300,0.931535,-1.000000,0.606540,0.511170,4,3,2,2,0.716676,0.283324,0.000000,0.000000},
-	{ -0.042583,1.603063,-0.034469,-0.888240,-0.298730,-0.348986,-0.311269,-0.167329,0.935475,-1.000000,0.628250,0.507900,4,3,2,2,0.504116,0.495884,0.000000,0.000000},
-	{ -0.044831,1.612184,-0.037878,-0.881807,-0.437656,-0.175710,-0.131363,-0.129894,0.982788,-1.000000,0.630740,0.522490,4,3,2,2,0.680609,0.319391,0.000000,0.000000},
-	{ -0.051196,1.622782,-0.032490,-0.881467,-0.472241,-0.001983,0.122063,-0.231891,0.965053,-1.000000,0.655720,0.542680,4,3,2,2,0.772940,0.227060,0.000000,0.000000},
-	{ -0.048111,1.613695,-0.026993,-0.932095,-0.296692,-0.207782,-0.114419,-0.303096,0.946066,-1.000000,0.659740,0.530590,4,3,2,2,0.533734,0.466266,0.000000,0.000000},
-	{ -0.053251,1.625692,-0.018704,-0.943842,-0.328764,-0.032813,0.056814,-0.259333,0.964116,-1.000000,0.686970,0.556800,4,3,2,2,0.591049,0.408951,0.000000,0.000000},
-	{ -0.057475,1.634718,-0.023970,-0.895164,-0.433761,0.102628,0.227143,-0.245807,0.942329,-1.000000,0.682210,0.569460,4,3,2,2,0.777062,0.222938,0.000000,0.000000},
-	{ -0.057355,1.630212,-0.035823,-0.796645,-0.571821,0.195903,0.281337,-0.063923,0.957478,-1.000000,0.657180,0.556170,4,3,2,2,0.935328,0.064672,0.000000,0.000000},
-	{ -0.061362,1.638393,-0.030447,-0.876621,-0.439119,0.196750,0.281508,-0.136410,0.949813,-1.000000,0.672970,0.573950,4,3,2,2,0.928158,0.071842,0.000000,0.000000},
-	{ -0.062749,1.638095,-0.037525,-0.916534,-0.381532,0.119997,0.143505,-0.033657,0.989077,-1.000000,0.659900,0.572320,4,3,2,2,0.977972,0.022028,0.000000,0.000000},
-	{ -0.060146,1.632419,-0.038882,-0.837008,-0.522753,0.161700,0.172998,0.027545,0.984537,-1.000000,0.653580,0.561230,4,3,2,2,0.973526,0.026474,0.000000,0.000000},
-	{ -0.058724,1.629295,-0.043992,-0.827470,-0.557814,0.064319,0.023971,0.079349,0.996559,-1.000000,0.640390,0.555260,4,3,2,2,0.987446,0.012554,0.000000,0.000000},
-	{ -0.062034,1.635394,-0.045327,-0.920505,-0.390414,-0.015701,-0.035744,0.044124,0.998386,-1.000000,0.643150,0.567280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.060042,1.632183,-0.053094,-0.897250,-0.433214,-0.085253,-0.152809,0.123535,0.980504,-1.000000,0.627060,0.562650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056350,1.625734,-0.050485,-0.815544,-0.578684,-0.003520,-0.126962,0.172987,0.976707,-1.000000,0.625270,0.549990,4,3,2,2,0.992159,0.007841,0.000000,0.000000},
-	{ -0.053786,1.622582,-0.056221,-0.800013,-0.598852,-0.036822,-0.221450,0.237685,0.945762,-1.000000,0.614560,0.546650,4,3,2,2,0.994149,0.005851,0.000000,0.000000},
-	{ -0.057774,1.629375,-0.059738,-0.881298,-0.457304,-0.119113,-0.222664,0.179525,0.958223,-1.000000,0.615880,0.559680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054415,1.624586,-0.042099,-0.760713,-0.636290,0.128263,0.115819,0.061374,0.991372,-1.000000,0.638690,0.544980,4,3,2,2,0.933196,0.066804,0.000000,0.000000},
-	{ -0.051769,1.620572,-0.048203,-0.746400,-0.661693,0.071057,-0.075151,0.189894,0.978924,-1.000000,0.622970,0.538850,4,3,2,2,0.939827,0.060173,0.000000,0.000000},
-	{ -0.049214,1.617456,-0.053192,-0.729381,-0.683938,0.015221,-0.223472,0.259231,0.939606,-1.000000,0.612770,0.535470,4,3,2,2,0.948609,0.051391,0.000000,0.000000},
-	{ -0.050623,1.613038,-0.015364,-0.976127,-0.183537,-0.116147,-0.086002,-0.164438,0.982631,-1.000000,0.687250,0.535890,3,4,2,2,0.679259,0.320741,0.000000,0.000000},
-	{ -0.060913,1.638052,-0.063696,-0.927388,-0.322416,-0.189734,-0.239544,0.122218,0.963162,-1.000000,0.616300,0.575140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063098,1.640399,-0.056151,-0.940251,-0.313491,-0.132862,-0.168274,0.088626,0.981748,-1.000000,0.627870,0.577750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065374,1.650578,-0.059750,-0.958584,-0.222398,-0.177924,-0.199619,0.079031,0.976681,-1.000000,0.626730,0.595770,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064892,1.643596,-0.046884,-0.956983,-0.287610,-0.038256,-0.048899,0.029911,0.998356,-1.000000,0.645040,0.582170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067428,1.653431,-0.049348,-0.975460,-0.209531,-0.067637,-0.076110,0.032632,0.996565,-1.000000,0.644060,0.599480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066817,1.662053,-0.063457,-0.962677,-0.180756,-0.201444,-0.217360,0.072851,0.973369,-1.000000,0.624010,0.615850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069051,1.664428,-0.052353,-0.978806,-0.178042,-0.101188,-0.109235,0.035963,0.993365,-1.000000,0.640870,0.618550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068261,1.673330,-0.066140,-0.956672,-0.220878,-0.189713,-0.204793,0.047288,0.977662,-1.000000,0.621580,0.634520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070523,1.675648,-0.054648,-0.967029,-0.226375,-0.116657,-0.123268,0.015244,0.992256,-1.000000,0.637930,0.637600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071062,1.684108,-0.067045,-0.951750,-0.256144,-0.169005,-0.177376,0.009764,0.984095,-1.000000,0.621430,0.652160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.073634,1.686573,-0.055226,-0.963624,-0.240902,-0.115739,-0.115201,-0.016367,0.993207,-1.000000,0.636590,0.656520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.076244,1.698283,-0.054532,-0.989681,-0.047788,-0.135085,-0.132742,-0.049215,0.989928,-1.000000,0.636470,0.676850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074063,1.695372,-0.066618,-0.980195,-0.105012,-0.167898,-0.165061,-0.035209,0.985655,-1.000000,0.622640,0.670980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.078117,1.700960,-0.038210,-0.991514,-0.033508,-0.125610,-0.122031,-0.093247,0.988136,-1.000000,0.654760,0.683100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.075938,1.689433,-0.039669,-0.970968,-0.214225,-0.106434,-0.093741,-0.068593,0.993231,-1.000000,0.655270,0.662250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.073722,1.706113,-0.066077,-0.975865,0.122708,-0.180640,-0.190390,-0.072931,0.978996,-1.000000,0.622560,0.688810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074390,1.711835,-0.055500,-0.978033,0.106416,-0.179242,-0.187808,-0.076762,0.979202,-1.000000,0.633570,0.699630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071699,1.714963,-0.064735,-0.960852,0.164769,-0.222743,-0.239477,-0.089598,0.966759,-1.000000,0.622530,0.703620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.077476,1.713488,-0.037118,-0.984913,0.063409,-0.161017,-0.168358,-0.135841,0.976321,-1.000000,0.654090,0.705310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.075892,1.727226,-0.039624,-0.980546,0.020410,-0.195227,-0.196185,-0.134590,0.971286,-1.000000,0.648710,0.728640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072781,1.726261,-0.054025,-0.974005,0.055128,-0.219714,-0.224350,-0.100670,0.969295,-1.000000,0.632380,0.724250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072864,1.678489,-0.039771,-0.961152,-0.259016,-0.095384,-0.081661,-0.063258,0.994651,-1.000000,0.657600,0.642670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070167,1.667506,-0.038712,-0.971749,-0.232437,-0.040951,-0.029199,-0.053781,0.998126,-1.000000,0.661140,0.623450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068097,1.656911,-0.037223,-0.973178,-0.227540,0.033903,0.045240,-0.044795,0.997971,-1.000000,0.663980,0.605440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065732,1.646890,-0.036636,-0.956201,-0.280141,0.084854,0.102441,-0.048715,0.993546,-1.000000,0.664220,0.588220,4,3,2,2,0.984946,0.015054,0.000000,0.000000},
-	{ -0.075249,1.742418,-0.044968,-0.968953,0.015918,-0.246731,-0.246677,-0.129781,0.960368,-1.000000,0.638880,0.753620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071967,1.739632,-0.057327,-0.960400,0.043440,-0.275217,-0.278531,-0.124137,0.952371,-1.000000,0.625180,0.746130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071816,1.759490,-0.052624,-0.945356,0.124296,-0.301417,-0.318378,-0.152687,0.935587,-1.000000,0.623920,0.780490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068600,1.752209,-0.063540,-0.931875,0.118468,-0.342890,-0.358249,-0.151623,0.921232,-1.000000,0.613520,0.765470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069482,1.736904,-0.065714,-0.957813,0.078286,-0.276525,-0.284181,-0.114542,0.951904,-1.000000,0.616210,0.739860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066454,1.747321,-0.070798,-0.930062,0.151074,-0.334906,-0.355291,-0.137699,0.924558,-1.000000,0.606750,0.755620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063443,1.763120,-0.071329,-0.898194,0.174375,-0.403535,-0.431886,-0.178826,0.884023,-1.000000,0.599020,0.780870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061894,1.756674,-0.077609,-0.895864,0.199550,-0.396998,-0.429513,-0.160120,0.888752,-1.000000,0.594280,0.768460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058016,1.772680,-0.078459,-0.806794,0.286774,-0.516570,-0.575972,-0.186888,0.795820,-1.000000,0.584110,0.793680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056640,1.764981,-0.084013,-0.802453,0.278642,-0.527662,-0.580470,-0.159578,0.798492,-1.000000,0.581530,0.779330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049964,1.779603,-0.083886,-0.655402,0.405869,-0.636961,-0.741967,-0.188341,0.643438,-1.000000,0.569680,0.802260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049343,1.771140,-0.089098,-0.648380,0.375636,-0.662194,-0.748275,-0.154129,0.645235,-1.000000,0.568530,0.787180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040672,1.775223,-0.093853,-0.543095,0.421217,-0.726377,-0.835296,-0.182823,0.518514,-1.000000,0.554670,0.791120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040937,1.783975,-0.088760,-0.545769,0.456028,-0.702976,-0.832997,-0.204318,0.514170,-1.000000,0.555130,0.806180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032563,1.777462,-0.098036,-0.466077,0.440904,-0.767057,-0.884136,-0.199953,0.422282,-1.000000,0.542700,0.791590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032445,1.786162,-0.093178,-0.451882,0.492025,-0.744119,-0.889601,-0.186433,0.416957,-1.000000,0.542790,0.806300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025052,1.786419,-0.097006,-0.381613,0.505003,-0.774173,-0.922591,-0.156865,0.352447,-1.000000,0.532490,0.804390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025471,1.778322,-0.101414,-0.387574,0.453340,-0.802664,-0.921738,-0.177711,0.344700,-1.000000,0.533010,0.790500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019213,1.786592,-0.099316,-0.275030,0.537040,-0.797462,-0.960839,-0.124307,0.247663,-1.000000,0.524730,0.803190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019119,1.778525,-0.103997,-0.301334,0.465554,-0.832140,-0.953518,-0.146258,0.263461,-1.000000,0.524660,0.789040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012785,1.786837,-0.101157,-0.217667,0.543457,-0.810725,-0.976020,-0.119032,0.182255,-1.000000,0.516060,0.802140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012879,1.778528,-0.105940,-0.211081,0.474674,-0.854476,-0.977452,-0.107586,0.181694,-1.000000,0.516530,0.787730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007011,1.787184,-0.102054,-0.089319,0.560616,-0.823244,-0.995763,-0.068427,0.061440,-1.000000,0.508600,0.801660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006586,1.778522,-0.107138,-0.101317,0.482930,-0.869778,-0.994834,-0.054777,0.085470,-1.000000,0.508370,0.786890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.010491,1.796330,-0.094560,-0.144386,0.692126,-0.707188,-0.989417,-0.090582,0.113355,-1.000000,0.512450,0.819530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011910,1.808788,-0.080421,-0.124896,0.838076,-0.531064,-0.989636,-0.067003,0.127007,-1.000000,0.515820,0.846470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021829,1.807546,-0.078756,-0.270501,0.804721,-0.528444,-0.950634,-0.136567,0.278647,-1.000000,0.530430,0.845640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021907,1.795455,-0.091761,-0.282897,0.662731,-0.693367,-0.954166,-0.120851,0.273794,-1.000000,0.528310,0.820500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.033371,1.805736,-0.074329,-0.385450,0.800231,-0.459411,-0.889932,-0.190836,0.414250,-1.000000,0.548230,0.846280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032497,1.796061,-0.086062,-0.412817,0.634046,-0.653887,-0.900025,-0.173799,0.399686,-1.000000,0.543750,0.824510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044440,1.801373,-0.069630,-0.563423,0.710532,-0.421542,-0.757829,-0.241285,0.606198,-1.000000,0.566500,0.842730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042017,1.793365,-0.081282,-0.554714,0.574597,-0.601773,-0.811976,-0.215966,0.542266,-1.000000,0.558230,0.823730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054374,1.794317,-0.064481,-0.720745,0.579536,-0.380348,-0.598359,-0.243099,0.763459,-1.000000,0.585010,0.834140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051517,1.788068,-0.076128,-0.687075,0.497325,-0.529713,-0.689724,-0.217157,0.690741,-1.000000,0.574410,0.818430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.060071,1.779904,-0.070468,-0.825546,0.356831,-0.437201,-0.525110,-0.201930,0.826731,-1.000000,0.590380,0.807990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062711,1.784813,-0.059048,-0.848313,0.411062,-0.333757,-0.447230,-0.218806,0.867242,-1.000000,0.601740,0.820700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065709,1.769517,-0.063565,-0.904086,0.208134,-0.373241,-0.410855,-0.183004,0.893145,-1.000000,0.605710,0.793740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068442,1.773215,-0.053932,-0.914788,0.264575,-0.305227,-0.358979,-0.186053,0.914614,-1.000000,0.615600,0.803170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072599,1.775750,-0.038911,-0.922558,0.310393,-0.229223,-0.285713,-0.150248,0.946464,-1.000000,0.632610,0.812460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.077124,1.761132,-0.034453,-0.965767,0.132329,-0.223123,-0.239355,-0.122923,0.963120,-1.000000,0.644830,0.787860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.079031,1.744709,-0.028632,-0.982291,0.001473,-0.187355,-0.185936,-0.130738,0.973825,-1.000000,0.657450,0.761190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.079304,1.728252,-0.021838,-0.988367,-0.001200,-0.152080,-0.148405,-0.211015,0.966151,-1.000000,0.669530,0.735730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081012,1.711902,-0.014302,-0.981722,0.057219,-0.181518,-0.187741,-0.134591,0.972954,-1.000000,0.680660,0.711190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.079493,1.701495,-0.022614,-0.990454,-0.047861,-0.129270,-0.121207,-0.144262,0.982088,-1.000000,0.671630,0.687640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.077993,1.690068,-0.025546,-0.976932,-0.167433,-0.132552,-0.105925,-0.159037,0.981574,-1.000000,0.671190,0.666010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.075207,1.680098,-0.026429,-0.944038,-0.283135,-0.169195,-0.113798,-0.201880,0.972777,-1.000000,0.673520,0.648430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071195,1.669473,-0.025964,-0.936097,-0.326742,-0.130241,-0.058133,-0.221468,0.973433,-1.000000,0.678490,0.629800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067545,1.659865,-0.025296,-0.938888,-0.343955,-0.013591,0.054989,-0.188846,0.980466,-1.000000,0.682330,0.612250,4,3,2,2,0.978919,0.021081,0.000000,0.000000},
-	{ -0.064735,1.649221,-0.026543,-0.928679,-0.351236,0.119117,0.182961,-0.154482,0.970907,-1.000000,0.681390,0.593790,4,3,2,2,0.939894,0.060106,0.000000,0.000000},
-	{ -0.080871,1.699838,-0.013944,-0.968618,-0.119585,-0.217894,-0.204633,-0.113915,0.972188,-1.000000,0.680300,0.686660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.078173,1.683920,-0.017927,-0.955879,-0.182197,-0.230432,-0.171171,-0.292041,0.940963,-1.000000,0.680800,0.658800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074653,1.668771,-0.015882,-0.869164,-0.359836,-0.339222,-0.191896,-0.386793,0.901980,-1.000000,0.691380,0.635750,4,3,2,2,0.991156,0.008844,0.000000,0.000000},
-	{ -0.069889,1.661186,-0.013826,-0.859074,-0.500310,-0.108077,0.002321,-0.214955,0.976621,-1.000000,0.699510,0.621030,4,3,2,2,0.926284,0.073716,0.000000,0.000000},
-	{ -0.063138,1.649145,-0.015671,-0.898731,-0.430669,0.082496,0.167107,-0.162443,0.972465,-1.000000,0.698620,0.597680,4,3,2,2,0.808631,0.191369,0.000000,0.000000},
-	{ -0.057563,1.637553,-0.009802,-0.921500,-0.367801,0.124741,0.191668,-0.151326,0.969724,-1.000000,0.706020,0.580760,4,3,2,2,0.645250,0.354750,0.000000,0.000000},
-	{ -0.053118,1.624625,-0.004879,-0.967318,-0.229801,0.107182,0.132625,-0.098255,0.986284,-1.000000,0.710150,0.558790,3,4,2,2,0.630233,0.369767,0.000000,0.000000},
-	{ -0.061807,1.650503,0.000200,-0.875903,-0.433569,0.211689,0.279276,-0.097815,0.955216,-1.000000,0.720980,0.601970,4,3,2,2,0.690030,0.309970,0.000000,0.000000},
-	{ -0.053561,1.637593,0.008158,-0.886197,-0.274592,0.373168,0.428600,-0.180007,0.885381,-1.000000,0.732340,0.583440,3,4,2,2,0.604399,0.395601,0.000000,0.000000},
-	{ -0.050618,1.609186,-0.002166,-0.991235,-0.107920,0.076203,0.085175,-0.081118,0.993058,-1.000000,0.710230,0.529690,3,4,2,2,0.815151,0.184849,0.000000,0.000000},
-	{ -0.049258,1.618499,0.010643,-0.939842,-0.104352,0.325280,0.340003,-0.193525,0.920297,-1.000000,0.734940,0.550020,3,4,2,2,0.801004,0.198996,0.000000,0.000000},
-	{ -0.045424,1.639742,0.022586,-0.731071,-0.223290,0.644730,0.678039,-0.343209,0.649977,-1.000000,0.759850,0.595670,3,4,2,2,0.607118,0.392882,0.000000,0.000000},
-	{ -0.043213,1.623644,0.022645,-0.784239,-0.050063,0.618436,0.587094,-0.382329,0.713544,-1.000000,0.761190,0.566910,3,4,2,2,0.819867,0.180133,0.000000,0.000000},
-	{ -0.032722,1.640832,0.033204,-0.524054,-0.166043,0.835343,0.802721,-0.424063,0.419297,-1.000000,0.794540,0.609380,3,4,2,2,0.618363,0.381637,0.000000,0.000000},
-	{ -0.031509,1.624953,0.032940,-0.556649,0.019359,0.830522,0.706785,-0.514341,0.485704,-1.000000,0.797910,0.584090,3,4,2,2,0.826171,0.173829,0.000000,0.000000},
-	{ -0.016288,1.641418,0.041157,-0.315749,-0.142180,0.938130,0.864885,-0.449749,0.222934,-1.000000,0.837800,0.624990,3,4,2,2,0.630471,0.369529,0.000000,0.000000},
-	{ -0.015424,1.624527,0.040896,-0.333039,0.066856,0.940540,0.748949,-0.587250,0.306941,-1.000000,0.839480,0.601270,3,4,2,2,0.835387,0.164613,0.000000,0.000000},
-	{ 0.000000,1.641764,0.044214,0.000002,-0.137519,0.990499,0.916512,-0.396207,-0.055010,-1.000000,0.865340,0.636410,3,4,2,2,0.613219,0.386781,0.000000,0.000000},
-	{ 0.000000,1.624241,0.043907,0.000002,0.088777,0.996051,0.778095,-0.625666,0.055763,-1.000000,0.865490,0.615300,3,4,2,2,0.828286,0.171714,0.000000,0.000000},
-	{ -0.018290,1.655575,0.044379,-0.304166,-0.354351,0.884262,0.916697,-0.361379,0.170508,-1.000000,0.837870,0.647560,4,3,2,2,0.686213,0.313787,0.000000,0.000000},
-	{ 0.000000,1.655771,0.048019,0.000000,-0.350957,0.936392,0.964045,-0.248836,-0.093264,-1.000000,0.867830,0.657550,4,3,2,2,0.671053,0.328947,0.000000,0.000000},
-	{ -0.020151,1.667115,0.049794,-0.278159,-0.507930,0.815251,0.943794,-0.302296,0.133677,-1.000000,0.839720,0.666460,4,3,2,2,0.893923,0.106077,0.000000,0.000000},
-	{ -0.036469,1.655453,0.035550,-0.489149,-0.371838,0.788967,0.861066,-0.349951,0.368918,-1.000000,0.791850,0.632160,4,3,2,2,0.662177,0.337823,0.000000,0.000000},
-	{ -0.042872,1.669808,0.040436,-0.471299,-0.507614,0.721253,0.881973,-0.272167,0.384772,-1.000000,0.791080,0.655460,4,3,2,2,0.949375,0.050625,0.000000,0.000000},
-	{ -0.020934,1.676916,0.056510,-0.241614,-0.575466,0.781321,0.963564,-0.237493,0.123049,-1.000000,0.843920,0.684290,4,3,2,2,0.964983,0.035017,0.000000,0.000000},
-	{ 0.000000,1.676419,0.059522,0.000000,-0.576979,0.816759,0.986591,-0.133303,-0.094169,-1.000000,0.875150,0.692150,4,3,2,2,0.958019,0.041981,0.000000,0.000000},
-	{ 0.000000,1.686171,0.066680,0.000001,-0.551532,0.834154,0.991294,-0.109831,-0.072620,-1.000000,0.879880,0.714070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022197,1.686790,0.063596,-0.247629,-0.535223,0.807599,0.965669,-0.203895,0.160969,-1.000000,0.846390,0.706000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.698046,0.074043,0.000002,-0.410371,0.911919,0.989046,-0.134606,-0.060576,-1.000000,0.883670,0.741980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.024223,1.699159,0.070658,-0.273633,-0.398694,0.875310,0.956307,-0.210195,0.203212,-1.000000,0.846770,0.734450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.715040,0.079931,0.000001,-0.213068,0.977037,0.971020,-0.233511,-0.050924,-1.000000,0.882980,0.782510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026414,1.716492,0.076440,-0.289407,-0.205318,0.934927,0.933511,-0.276521,0.228242,-1.000000,0.843010,0.771760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.738223,0.082836,0.000000,-0.016231,0.999868,0.920446,-0.390819,-0.006344,-1.000000,0.872600,0.832090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028138,1.739591,0.079070,-0.299904,-0.007291,0.953942,0.878365,-0.392258,0.273146,-1.000000,0.832140,0.813760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.762747,0.080543,-0.000001,0.192353,0.981326,0.843756,-0.526704,0.103242,-1.000000,0.854010,0.874570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028447,1.763814,0.076987,-0.287845,0.186190,0.939403,0.805172,-0.484033,0.342651,-1.000000,0.816390,0.850110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.785525,0.073147,-0.000003,0.445123,0.895469,0.743941,-0.598392,0.297454,-1.000000,0.827340,0.911940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027126,1.784971,0.070179,-0.246377,0.434581,0.866278,0.712276,-0.524952,0.465927,-1.000000,0.796240,0.880420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025832,1.801827,0.057743,-0.233128,0.699103,0.675948,0.565137,-0.468271,0.679222,-1.000000,0.771290,0.904970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.804183,0.059922,-0.000003,0.714212,0.699929,0.599351,-0.560282,0.571719,-1.000000,0.792890,0.940630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.024642,1.814490,0.039658,-0.241255,0.878228,0.412931,0.375737,-0.307784,0.874123,-1.000000,0.739760,0.924000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.817507,0.040870,-0.000001,0.901522,0.432734,0.406573,-0.395353,0.823647,-1.000000,0.753630,0.961230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.824787,0.016901,0.000001,0.986017,0.166645,0.214131,-0.162780,0.963146,-1.000000,0.709990,0.973520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023023,1.821617,0.016668,-0.244687,0.956738,0.157417,0.180175,-0.114659,0.976929,-1.000000,0.702550,0.937200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.825830,-0.009024,-0.000000,0.999667,-0.025791,0.079720,0.025709,0.996486,-1.000000,0.665430,0.978740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021683,1.822871,-0.008719,-0.236889,0.971291,-0.021844,0.049599,0.034545,0.998172,-1.000000,0.661830,0.943030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042281,1.813503,0.016190,-0.450638,0.881538,0.140767,0.132402,-0.089941,0.987107,-1.000000,0.698020,0.904310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041109,1.815543,-0.007487,-0.434688,0.900530,-0.009575,0.008203,0.014591,0.999860,-1.000000,0.661060,0.908450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057975,1.803154,0.016358,-0.624712,0.769430,0.133088,0.105856,-0.085416,0.990706,-1.000000,0.697310,0.873740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057307,1.805481,-0.005642,-0.629066,0.777284,-0.010265,-0.027771,-0.009275,0.999571,-1.000000,0.663960,0.876720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068970,1.791384,0.017767,-0.792342,0.592152,0.146800,0.107343,-0.101555,0.989022,-1.000000,0.701000,0.847650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069307,1.793064,-0.003451,-0.799574,0.600011,-0.025845,-0.049025,-0.022319,0.998548,-1.000000,0.670270,0.848730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.077073,1.779683,-0.000557,-0.917498,0.397174,-0.021226,-0.049285,-0.060572,0.996946,-1.000000,0.679050,0.824130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.075835,1.779097,0.019941,-0.903044,0.383155,0.194176,0.144532,-0.154658,0.977339,-1.000000,0.706660,0.826370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081254,1.765489,0.002491,-0.983617,0.180206,0.004872,-0.014953,-0.108493,0.993985,-1.000000,0.688280,0.800880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.079583,1.765412,0.022144,-0.953846,0.173138,0.245360,0.209382,-0.202241,0.956691,-1.000000,0.713720,0.805100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.082704,1.749016,0.006560,-0.998933,0.021188,0.041024,0.037258,-0.154877,0.987231,-1.000000,0.699680,0.775520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.080296,1.748188,0.024437,-0.957829,0.014143,0.286989,0.276786,-0.222766,0.934754,-1.000000,0.723410,0.779280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081858,1.731397,0.010523,-0.997470,-0.013796,0.069739,0.070934,-0.128082,0.989224,-1.000000,0.711400,0.751400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.078763,1.727086,0.025405,-0.933103,-0.055560,0.355292,0.359482,-0.170404,0.917461,-1.000000,0.734120,0.747060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081811,1.720489,0.014967,-0.950003,0.163461,0.266036,0.257800,-0.070082,0.963653,-1.000000,0.722280,0.736400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.082991,1.717079,0.004977,-0.960551,0.277532,0.017845,-0.014037,-0.112467,0.993556,-1.000000,0.706860,0.729910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081221,1.729212,-0.004765,-0.996469,-0.002579,-0.083923,-0.081210,-0.224242,0.971144,-1.000000,0.691540,0.745230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.080019,1.763730,-0.016211,-0.978802,0.160270,-0.127513,-0.142433,-0.085291,0.986123,-1.000000,0.665590,0.795460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.075392,1.778447,-0.020633,-0.917540,0.373426,-0.136647,-0.167185,-0.050484,0.984632,-1.000000,0.653350,0.820700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081790,1.747279,-0.010889,-0.994917,0.007935,-0.100386,-0.100435,-0.150260,0.983532,-1.000000,0.678230,0.769220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065991,1.787795,-0.044463,-0.867989,0.434277,-0.240829,-0.357988,-0.211119,0.909546,-1.000000,0.617770,0.832220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066088,1.793187,-0.028804,-0.800943,0.584966,-0.127691,-0.221768,-0.091738,0.970774,-1.000000,0.633190,0.849720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058898,1.796932,-0.048881,-0.741434,0.630808,-0.228817,-0.469506,-0.244051,0.848530,-1.000000,0.603060,0.847470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054110,1.806229,-0.029840,-0.614671,0.781983,-0.103356,-0.079889,0.068640,0.994438,-1.000000,0.626460,0.880120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048835,1.805785,-0.052471,-0.580631,0.783528,-0.221250,-0.640766,-0.272121,0.717892,-1.000000,0.583740,0.862440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054110,1.806229,-0.029840,-0.614671,0.781983,-0.103356,-0.474996,-0.262346,0.839972,-1.000000,0.612560,0.881440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038610,1.814880,-0.032826,-0.398831,0.910255,-0.111220,-0.025653,0.110161,0.993583,-1.000000,0.620790,0.912180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035451,1.812286,-0.056715,-0.368948,0.899664,-0.233413,-0.837864,-0.213230,0.502511,-1.000000,0.559320,0.872210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038610,1.814880,-0.032826,-0.398831,0.910255,-0.111220,-0.718702,-0.234940,0.654423,-1.000000,0.581120,0.902560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018164,1.815410,-0.062988,-0.190275,0.944989,-0.266065,-0.959816,-0.122121,0.252666,-1.000000,0.529130,0.873070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020274,1.820713,-0.035194,-0.212957,0.967782,-0.134342,-0.929971,-0.158597,0.331665,-1.000000,0.542400,0.916740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020274,1.820713,-0.035194,-0.212957,0.967782,-0.134342,0.007542,0.139121,0.990247,-1.000000,0.618730,0.946340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.818150,-0.060875,-0.000005,0.965730,-0.259549,-1.000000,0.000000,0.000000,-1.000000,0.499880,0.880970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.823184,-0.035649,-0.000002,0.989675,-0.143333,-1.000000,0.000000,0.000000,-1.000000,0.499870,0.920600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020303,1.820713,-0.035194,0.212802,0.967816,-0.134345,-0.929776,0.158304,-0.332349,-1.000000,0.457340,0.916720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018193,1.815410,-0.062988,0.190118,0.945020,-0.266069,-0.959739,0.121819,-0.253101,-1.000000,0.470640,0.873050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038640,1.814880,-0.032825,0.398840,0.910250,-0.111226,-0.718164,0.234622,-0.655128,-1.000000,0.418630,0.902500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035480,1.812286,-0.056715,0.368967,0.899653,-0.233426,-0.837541,0.212939,-0.503172,-1.000000,0.440450,0.872170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054139,1.806229,-0.029840,0.614669,0.781984,-0.103363,-0.474590,0.261973,-0.840318,-1.000000,0.387200,0.881360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048864,1.805785,-0.052471,0.580629,0.783523,-0.221272,-0.640416,0.271710,-0.718360,-1.000000,0.416040,0.862380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058927,1.796932,-0.048881,0.741417,0.630823,-0.228829,-0.469171,0.243498,-0.848874,-1.000000,0.396730,0.847400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066020,1.787795,-0.044463,0.867980,0.434292,-0.240834,-0.357780,0.210562,-0.909757,-1.000000,0.382030,0.832120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.075422,1.778447,-0.020633,0.917536,0.373437,-0.136647,-0.166949,0.049876,-0.984703,-1.000000,0.346460,0.820580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.080049,1.763730,-0.016211,0.978802,0.160271,-0.127512,-0.142351,0.084752,-0.986181,-1.000000,0.334240,0.795330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081819,1.747279,-0.010889,0.994917,0.007921,-0.100382,-0.100436,0.149323,-0.983674,-1.000000,0.321620,0.769080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081250,1.729212,-0.004765,0.996469,-0.002595,-0.083915,-0.081216,0.223439,-0.971329,-1.000000,0.308330,0.745070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.077103,1.779683,-0.000557,0.917494,0.397182,-0.021225,-0.049000,0.059911,-0.997000,-1.000000,0.320760,0.823990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081284,1.765489,0.002491,0.983617,0.180206,0.004876,-0.014806,0.107716,-0.994071,-1.000000,0.311550,0.800730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.075865,1.779097,0.019941,0.903043,0.383155,0.194178,0.144799,0.154060,-0.977394,-1.000000,0.293150,0.826200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.079613,1.765412,0.022144,0.953844,0.173137,0.245366,0.209528,0.201617,-0.956791,-1.000000,0.286100,0.804930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.082733,1.749016,0.006560,0.998934,0.021176,0.041028,0.037285,0.154134,-0.987346,-1.000000,0.300170,0.775350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.080325,1.748188,0.024437,0.957830,0.014136,0.286989,0.276826,0.222268,-0.934861,-1.000000,0.276430,0.779100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081887,1.731397,0.010523,0.997470,-0.013813,0.069738,0.070933,0.127616,-0.989284,-1.000000,0.288460,0.751230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.083020,1.717078,0.004977,0.960557,0.277510,0.017848,-0.013943,0.112163,-0.993592,-1.000000,0.293010,0.729740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081840,1.720489,0.014968,0.950012,0.163432,0.266020,0.257860,0.069660,-0.963668,-1.000000,0.277590,0.736220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.078792,1.727086,0.025405,0.933104,-0.055567,0.355287,0.359484,0.169911,-0.917552,-1.000000,0.265750,0.746880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069000,1.791384,0.017767,0.792344,0.592151,0.146794,0.107794,0.100945,-0.989035,-1.000000,0.298800,0.847490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069336,1.793064,-0.003451,0.799570,0.600016,-0.025849,-0.048611,0.021759,-0.998581,-1.000000,0.329520,0.848590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066117,1.793187,-0.028804,0.800936,0.584975,-0.127693,-0.221388,0.091182,-0.970914,-1.000000,0.366600,0.849620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054139,1.806229,-0.029840,0.614669,0.781984,-0.103363,-0.079290,-0.069122,-0.994452,-1.000000,0.373310,0.880020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057336,1.805481,-0.005642,0.629064,0.777286,-0.010271,-0.027218,0.008819,-0.999591,-1.000000,0.335810,0.876590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058005,1.803154,0.016358,0.624711,0.769433,0.133079,0.106408,0.084953,-0.990687,-1.000000,0.302470,0.873590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038640,1.814880,-0.032825,0.398840,0.910250,-0.111226,-0.024922,-0.110487,-0.993565,-1.000000,0.378950,0.912090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041138,1.815543,-0.007487,0.434690,0.900529,-0.009578,0.008953,-0.014957,-0.999848,-1.000000,0.338680,0.908320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042310,1.813503,0.016190,0.450636,0.881540,0.140766,0.133038,0.089606,-0.987052,-1.000000,0.301730,0.904150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020303,1.820713,-0.035194,0.212802,0.967816,-0.134345,0.008250,-0.139269,-0.990220,-1.000000,0.380990,0.946250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021713,1.822871,-0.008719,0.236725,0.971331,-0.021846,0.050489,-0.034753,-0.998120,-1.000000,0.337890,0.942910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023052,1.821617,0.016668,0.244520,0.956779,0.157431,0.181117,0.114435,-0.976781,-1.000000,0.297170,0.937040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.823184,-0.035649,-0.000002,0.989675,-0.143333,0.035499,-0.143243,-0.989051,-1.000000,0.378780,0.981030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.825830,-0.009024,-0.000000,0.999667,-0.025791,0.080630,-0.025707,-0.996413,-1.000000,0.334260,0.978610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.824787,0.016901,0.000001,0.986017,0.166645,0.215201,0.162740,-0.962914,-1.000000,0.289710,0.973360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057193,1.798250,0.033980,0.611130,0.727680,0.311452,0.257441,0.189355,-0.947560,-1.000000,0.275210,0.867780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064625,1.789306,0.035150,0.767528,0.540556,0.344529,0.263988,0.223227,-0.938339,-1.000000,0.272430,0.848980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068920,1.778117,0.039260,0.821876,0.341696,0.455812,0.365631,0.297174,-0.882044,-1.000000,0.264740,0.831940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071143,1.764204,0.043137,0.830560,0.152779,0.535564,0.467458,0.331502,-0.819506,-1.000000,0.255710,0.812410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071470,1.745306,0.045636,0.832405,0.010517,0.554068,0.519353,0.333984,-0.786592,-1.000000,0.244800,0.785180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069456,1.724237,0.046490,0.814914,-0.119104,0.567212,0.572720,0.315621,-0.756555,-1.000000,0.234000,0.753230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024671,1.814490,0.039658,0.241091,0.878261,0.412956,0.376634,0.307488,-0.873841,-1.000000,0.259980,0.923810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.043705,1.807102,0.036612,0.454121,0.813771,0.362700,0.316561,0.233155,-0.919471,-1.000000,0.269870,0.893180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.817507,0.040870,-0.000001,0.901522,0.432734,0.407758,0.395125,-0.823170,-1.000000,0.246080,0.961030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.804183,0.059922,-0.000003,0.714212,0.699929,0.600361,0.559755,-0.571175,-1.000000,0.206840,0.940400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025861,1.801827,0.057743,0.232969,0.699128,0.675978,0.565932,0.467812,-0.678876,-1.000000,0.228460,0.904760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044777,1.796273,0.051605,0.459353,0.650292,0.605074,0.487982,0.384441,-0.783632,-1.000000,0.244950,0.877820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057092,1.790791,0.044826,0.625190,0.566009,0.537374,0.415558,0.341403,-0.843063,-1.000000,0.257100,0.858440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.053647,1.742244,0.065827,0.599785,0.007299,0.800128,0.736278,0.386489,-0.555447,-1.000000,0.207750,0.796990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.053659,1.766262,0.062321,0.594199,0.165731,0.787058,0.674797,0.429785,-0.599946,-1.000000,0.222670,0.831110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051229,1.719857,0.065109,0.575604,-0.173176,0.799181,0.801633,0.312454,-0.509664,-1.000000,0.197570,0.761730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065734,1.706042,0.045683,0.753079,-0.265382,0.602033,0.657460,0.268981,-0.703843,-1.000000,0.225970,0.723030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074986,1.708930,0.030254,0.862061,-0.151845,0.483521,0.505904,0.201006,-0.838843,-1.000000,0.249380,0.719350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081859,1.709046,0.020841,0.797005,0.057964,0.601185,0.598503,0.057873,-0.799028,-1.000000,0.262990,0.717610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070788,1.693964,0.030846,0.766620,-0.321443,0.555849,0.627399,0.190808,-0.754959,-1.000000,0.241180,0.692950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.077582,1.695164,0.022812,0.663632,-0.258685,0.701908,0.741035,0.099056,-0.664120,-1.000000,0.252790,0.692190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072369,1.682340,0.021079,0.651537,-0.444902,0.614461,0.716732,0.095594,-0.690765,-1.000000,0.250410,0.667240,4,3,2,2,0.975253,0.024747,0.000000,0.000000},
-	{ 0.079094,1.681638,0.015269,0.299882,-0.504875,0.809427,0.884420,-0.170911,-0.434270,-1.000000,0.259630,0.665680,4,3,2,2,0.988896,0.011104,0.000000,0.000000},
-	{ 0.084748,1.695951,0.019763,0.145316,-0.138139,0.979694,0.988974,-0.008275,-0.147859,-1.000000,0.260250,0.693240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.091963,1.698009,0.021501,-0.262673,0.004806,0.964873,0.958573,0.115495,0.260383,-1.000000,0.266180,0.696300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.089062,1.686104,0.018168,-0.186312,-0.304720,0.934042,0.955677,-0.276797,0.100326,-1.000000,0.265530,0.678900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.094506,1.687375,0.019693,-0.001720,-0.307201,0.951643,0.996430,-0.080845,-0.024297,-1.000000,0.270070,0.682370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.097422,1.699157,0.022826,-0.040134,-0.056684,0.997585,0.976772,0.208096,0.051121,-1.000000,0.270720,0.696790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.098564,1.686878,0.018415,0.443437,-0.381580,0.811024,0.888276,0.066247,-0.454507,-1.000000,0.274150,0.681730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.102663,1.699581,0.021311,0.505439,-0.158661,0.848150,0.842758,0.301722,-0.445783,-1.000000,0.275410,0.695640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.100797,1.685673,0.015368,0.864091,-0.408915,0.293489,0.436502,0.318445,-0.841462,-1.000000,0.278240,0.679740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.105844,1.699486,0.018210,0.914786,-0.206008,0.347457,0.403564,0.429118,-0.808080,-1.000000,0.279960,0.693720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.105983,1.711364,0.017275,0.913481,0.205306,0.351286,0.263512,0.359320,-0.895238,-1.000000,0.284040,0.705860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.103230,1.710930,0.020578,0.508632,0.239706,0.826943,0.684103,0.470665,-0.557206,-1.000000,0.279830,0.707110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.100305,1.717298,0.016853,0.343350,0.772371,0.534373,0.393465,0.398337,-0.828561,-1.000000,0.283790,0.712400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.103442,1.716400,0.014130,0.744966,0.667049,-0.008436,-0.092303,0.090544,-0.991606,-1.000000,0.287100,0.710380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.097101,1.676269,0.012218,0.742785,-0.592478,0.311834,0.456908,0.108122,-0.882919,-1.000000,0.278350,0.668540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.094992,1.676593,0.014637,0.338928,-0.590555,0.732374,0.822364,-0.192165,-0.535527,-1.000000,0.274770,0.668710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.095943,1.720518,0.011233,0.154819,0.977635,0.142338,0.047175,0.136595,-0.989503,-1.000000,0.288640,0.716680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.099197,1.719228,0.009126,0.590589,0.767670,-0.248773,-0.352243,-0.032124,-0.935357,-1.000000,0.291510,0.713820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.089873,1.720611,0.004411,-0.098067,0.965153,-0.242616,-0.344151,-0.261640,-0.901723,-1.000000,0.294410,0.720900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.094149,1.719581,0.003487,0.466317,0.695267,-0.546948,-0.598749,-0.207072,-0.773706,-1.000000,0.296440,0.716090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.084627,1.716792,-0.002958,-0.009092,0.873288,-0.487119,-0.632816,-0.382207,-0.673396,-1.000000,0.302880,0.719410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.089285,1.715714,-0.003334,0.561026,0.487514,-0.669014,-0.646509,-0.246693,-0.721920,-1.000000,0.304100,0.713470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.085555,1.709163,-0.008305,0.783620,0.143665,-0.604401,-0.595068,-0.105836,-0.796676,-1.000000,0.312930,0.705890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.090903,1.669529,0.006113,0.614896,-0.782993,0.093938,0.290831,0.114430,-0.949907,-1.000000,0.282070,0.656010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.088029,1.668389,0.007869,0.247848,-0.817262,0.520244,0.649924,-0.257970,-0.714878,-1.000000,0.278680,0.653550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.083775,1.664471,-0.001882,0.625491,-0.750215,-0.214333,0.017153,0.287860,-0.957519,-1.000000,0.289300,0.643470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081503,1.662792,-0.000516,0.285453,-0.930041,0.231389,0.382134,-0.110963,-0.917421,-1.000000,0.286400,0.640480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.077090,1.663637,-0.009031,0.587194,-0.589388,-0.554820,-0.248273,0.521254,-0.816489,-1.000000,0.297000,0.633860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.077519,1.661131,-0.006108,0.320196,-0.935767,-0.147699,0.089361,0.185046,-0.978659,-1.000000,0.291820,0.633500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.087537,1.719858,0.006984,-0.436069,0.889321,0.137666,0.024849,0.164817,-0.986011,-1.000000,0.291000,0.722910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.092652,1.719801,0.012649,-0.221477,0.892374,0.393214,0.172427,0.432711,-0.884890,-1.000000,0.286070,0.718850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.078678,1.663410,0.000173,-0.262303,-0.763356,0.590327,0.485310,-0.633106,-0.603034,-1.000000,0.283740,0.638100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074710,1.661556,-0.006372,-0.139921,-0.986119,0.089395,0.086270,-0.102081,-0.991028,-1.000000,0.291310,0.629910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.084601,1.669210,0.008691,-0.180318,-0.637121,0.749375,0.740565,-0.589342,-0.322863,-1.000000,0.275170,0.651820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.091320,1.677441,0.015402,-0.074140,-0.472140,0.878400,0.916803,-0.378856,-0.126254,-1.000000,0.271100,0.668080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.086268,1.677054,0.013569,-0.197735,-0.486080,0.851250,0.875536,-0.478109,-0.069633,-1.000000,0.267920,0.663510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.080832,1.670285,0.007623,-0.363700,-0.564866,0.740708,0.677764,-0.705958,-0.205571,-1.000000,0.272340,0.648540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072117,1.662241,-0.010488,0.498592,-0.721016,-0.481187,-0.042165,0.534277,-0.844257,-1.000000,0.296650,0.626350,4,3,2,2,0.973870,0.026130,0.000000,0.000000},
-	{ 0.075999,1.664483,-0.000792,-0.395586,-0.669492,0.628722,0.464129,-0.736444,-0.492174,-1.000000,0.282330,0.634670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.073217,1.662265,-0.006570,-0.258294,-0.913306,0.314891,0.056704,-0.339723,-0.938815,-1.000000,0.289780,0.627220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071354,1.661940,-0.010074,-0.056660,-0.989724,0.131283,-0.094055,-0.125618,-0.987610,-1.000000,0.295140,0.624520,4,3,2,2,0.968382,0.031618,0.000000,0.000000},
-	{ 0.077179,1.671307,0.006889,0.353570,-0.693554,0.627671,0.660169,-0.290367,-0.692722,-1.000000,0.269440,0.645300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072390,1.662822,-0.004900,0.693344,-0.694581,0.191916,0.152668,-0.118693,-0.981124,-1.000000,0.286570,0.626320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067017,1.657108,-0.005197,0.837485,-0.538002,0.095773,0.141937,0.044914,-0.988856,-1.000000,0.287690,0.613610,4,3,2,2,0.824510,0.175490,0.000000,0.000000},
-	{ 0.061836,1.650503,0.000200,0.875899,-0.433570,0.211702,0.279030,0.097223,-0.955348,-1.000000,0.278990,0.601790,4,3,2,2,0.690212,0.309788,0.000000,0.000000},
-	{ 0.057592,1.637553,-0.009802,0.921498,-0.367802,0.124752,0.191425,0.150633,-0.969879,-1.000000,0.293970,0.580600,4,3,2,2,0.645371,0.354629,0.000000,0.000000},
-	{ 0.053148,1.624625,-0.004879,0.967319,-0.229793,0.107185,0.132465,0.097526,-0.986378,-1.000000,0.289850,0.558620,3,4,2,2,0.630090,0.369910,0.000000,0.000000},
-	{ 0.053590,1.637594,0.008158,0.886196,-0.274590,0.373171,0.428483,0.179360,-0.885569,-1.000000,0.267630,0.583260,3,4,2,2,0.604159,0.395841,0.000000,0.000000},
-	{ 0.050648,1.609186,-0.002166,0.991235,-0.107915,0.076211,0.085106,0.080367,-0.993125,-1.000000,0.289790,0.529520,3,4,2,2,0.815086,0.184914,0.000000,0.000000},
-	{ 0.049288,1.618499,0.010643,0.939842,-0.104349,0.325282,0.339984,0.192921,-0.920431,-1.000000,0.265060,0.549830,3,4,2,2,0.800885,0.199115,0.000000,0.000000},
-	{ 0.045454,1.639742,0.022586,0.731075,-0.223288,0.644727,0.678092,0.342533,-0.650279,-1.000000,0.240120,0.595460,3,4,2,2,0.606933,0.393067,0.000000,0.000000},
-	{ 0.043242,1.623643,0.022645,0.784240,-0.050064,0.618434,0.587247,0.381616,-0.713800,-1.000000,0.238800,0.566710,3,4,2,2,0.819737,0.180263,0.000000,0.000000},
-	{ 0.032751,1.640832,0.033204,0.524053,-0.166042,0.835343,0.802953,0.423336,-0.419586,-1.000000,0.205420,0.609150,3,4,2,2,0.618223,0.381777,0.000000,0.000000},
-	{ 0.031538,1.624953,0.032940,0.556646,0.019356,0.830524,0.707171,0.513587,-0.485940,-1.000000,0.202060,0.583850,3,4,2,2,0.826102,0.173898,0.000000,0.000000},
-	{ 0.016317,1.641418,0.041157,0.315493,-0.142176,0.938217,0.865310,0.448923,-0.222948,-1.000000,0.162150,0.624730,3,4,2,2,0.630358,0.369642,0.000000,0.000000},
-	{ 0.015453,1.624527,0.040895,0.332758,0.066875,0.940638,0.749572,0.586494,-0.306864,-1.000000,0.160470,0.601000,3,4,2,2,0.835391,0.164609,0.000000,0.000000},
-	{ 0.000000,1.641764,0.044214,0.000002,-0.137519,0.990499,0.916925,0.395268,0.054877,-1.000000,0.134600,0.636140,3,4,2,2,0.613219,0.386781,0.000000,0.000000},
-	{ 0.000000,1.624241,0.043907,0.000002,0.088777,0.996051,0.778839,0.624747,-0.055685,-1.000000,0.134460,0.615030,3,4,2,2,0.828286,0.171714,0.000000,0.000000},
-	{ 0.018319,1.655575,0.044379,0.303963,-0.354349,0.884332,0.916968,0.360603,-0.170688,-1.000000,0.162060,0.647300,4,3,2,2,0.686275,0.313725,0.000000,0.000000},
-	{ 0.000000,1.655771,0.048019,0.000000,-0.350957,0.936392,0.964305,0.247950,0.092931,-1.000000,0.132100,0.657270,4,3,2,2,0.671053,0.328947,0.000000,0.000000},
-	{ 0.020180,1.667115,0.049794,0.277994,-0.507936,0.815304,0.943980,0.301579,-0.133984,-1.000000,0.160200,0.666200,4,3,2,2,0.893998,0.106002,0.000000,0.000000},
-	{ 0.036499,1.655453,0.035551,0.489151,-0.371834,0.788968,0.861167,0.349311,-0.369287,-1.000000,0.208090,0.631930,4,3,2,2,0.662366,0.337634,0.000000,0.000000},
-	{ 0.042902,1.669808,0.040436,0.471302,-0.507613,0.721251,0.881972,0.271647,-0.385142,-1.000000,0.208860,0.655230,4,3,2,2,0.949384,0.050616,0.000000,0.000000},
-	{ 0.020963,1.676916,0.056510,0.241458,-0.575477,0.781361,0.963669,0.236944,-0.123285,-1.000000,0.155990,0.684030,4,3,2,2,0.965013,0.034987,0.000000,0.000000},
-	{ 0.000000,1.676419,0.059522,0.000000,-0.576979,0.816759,0.986683,0.132848,0.093847,-1.000000,0.124750,0.691880,4,3,2,2,0.958019,0.041981,0.000000,0.000000},
-	{ 0.000000,1.686171,0.066680,0.000001,-0.551532,0.834154,0.991373,0.109331,0.072287,-1.000000,0.120010,0.713780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022226,1.686791,0.063597,0.247477,-0.535236,0.807637,0.965752,0.203338,-0.161171,-1.000000,0.153510,0.705730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.698046,0.074043,0.000002,-0.410371,0.911919,0.989153,0.133954,0.060278,-1.000000,0.116200,0.741690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024253,1.699159,0.070658,0.273480,-0.398705,0.875353,0.956414,0.209580,-0.203346,-1.000000,0.153100,0.734190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.715040,0.079931,0.000001,-0.213068,0.977037,0.971201,0.232792,0.050765,-1.000000,0.116870,0.782220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026443,1.716492,0.076440,0.289253,-0.205325,0.934973,0.933686,0.275909,-0.228263,-1.000000,0.156850,0.771500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.738223,0.082836,0.000000,-0.016231,0.999868,0.920779,0.390034,0.006331,-1.000000,0.127210,0.831810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028167,1.739591,0.079070,0.299753,-0.007292,0.953989,0.878683,0.391579,-0.273098,-1.000000,0.167680,0.813510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.762747,0.080543,-0.000001,0.192353,0.981326,0.844273,0.525905,-0.103084,-1.000000,0.145770,0.874300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028476,1.763814,0.076987,0.287693,0.186196,0.939449,0.805644,0.483343,-0.342515,-1.000000,0.183400,0.849860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.785525,0.073147,-0.000003,0.445123,0.895469,0.744717,0.597619,-0.297064,-1.000000,0.172410,0.911690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027156,1.784972,0.070179,0.246220,0.434592,0.866317,0.712942,0.524298,-0.465645,-1.000000,0.203540,0.880190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046638,1.782452,0.061075,0.474053,0.411064,0.778653,0.628598,0.461242,-0.626195,-1.000000,0.227250,0.858750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.047497,1.701885,0.060893,0.528003,-0.354504,0.771712,0.848775,0.250419,-0.465693,-1.000000,0.192900,0.727980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.060460,1.691479,0.042773,0.665648,-0.406022,0.626146,0.735564,0.215385,-0.642304,-1.000000,0.222290,0.694620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.054955,1.680199,0.040119,0.588876,-0.499390,0.635480,0.793725,0.209069,-0.571219,-1.000000,0.219500,0.671490,4,3,2,2,0.980033,0.019967,0.000000,0.000000},
-	{ 0.065263,1.681304,0.029513,0.672931,-0.461439,0.578133,0.702634,0.154427,-0.694591,-1.000000,0.237670,0.668690,4,3,2,2,0.975398,0.024602,0.000000,0.000000},
-	{ 0.057957,1.669049,0.027392,0.617157,-0.502459,0.605518,0.765637,0.206039,-0.609383,-1.000000,0.237410,0.645540,4,3,2,2,0.922532,0.077468,0.000000,0.000000},
-	{ 0.043491,1.688614,0.055083,0.466319,-0.485773,0.739304,0.884064,0.226390,-0.408874,-1.000000,0.192780,0.698200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040785,1.678648,0.049289,0.405769,-0.552668,0.727949,0.913972,0.243055,-0.324930,-1.000000,0.194140,0.676150,4,3,2,2,0.978848,0.021153,0.000000,0.000000},
-	{ 0.050584,1.655279,0.024454,0.656241,-0.404326,0.637078,0.753135,0.299265,-0.585857,-1.000000,0.239760,0.621150,4,3,2,2,0.687734,0.312266,0.000000,0.000000},
-	{ 0.060539,1.656637,0.012341,0.754698,-0.457188,0.470541,0.595642,0.176818,-0.783547,-1.000000,0.261660,0.615040,4,3,2,2,0.707288,0.292712,0.000000,0.000000},
-	{ 0.066294,1.669709,0.018065,0.668544,-0.504004,0.546836,0.690781,0.148509,-0.707649,-1.000000,0.252870,0.641630,4,3,2,2,0.879902,0.120098,0.000000,0.000000},
-	{ 0.069465,1.667779,0.011073,0.654283,-0.575673,0.490423,0.606103,0.011337,-0.795305,-1.000000,0.262770,0.635990,4,3,2,2,0.863806,0.136194,0.000000,0.000000},
-	{ 0.069263,1.662412,0.002699,0.717812,-0.612417,0.331198,0.406012,-0.018240,-0.913686,-1.000000,0.275800,0.624400,4,3,2,2,0.842454,0.157546,0.000000,0.000000},
-	{ 0.017698,1.687322,-0.120334,0.896211,0.394959,-0.202022,-0.223479,0.008555,-0.974671,-1.000000,0.470810,0.661710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019283,1.682842,-0.117307,0.942870,0.117172,-0.311877,-0.325277,0.121312,-0.937805,-1.000000,0.467190,0.655190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018095,1.686099,-0.123458,0.886100,0.442831,-0.136850,-0.228125,0.159662,-0.960452,-1.000000,0.473530,0.659040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015698,1.687749,-0.128661,0.819990,0.365374,-0.440588,-0.516555,0.140817,-0.844595,-1.000000,0.478130,0.660760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012270,1.688151,-0.133317,0.811587,0.190592,-0.552269,-0.582859,0.199369,-0.787736,-1.000000,0.483000,0.659760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009087,1.688230,-0.137946,0.788527,0.069474,-0.611064,-0.614543,0.127352,-0.778536,-1.000000,0.488380,0.658020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018140,1.685290,-0.125217,0.920321,0.220563,-0.323049,-0.361919,0.166814,-0.917163,-1.000000,0.475290,0.656180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016608,1.685500,-0.128407,0.823869,-0.019972,-0.566429,-0.564781,0.054957,-0.823409,-1.000000,0.477850,0.655740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013121,1.684452,-0.132210,0.728616,-0.245625,-0.639364,-0.656531,0.015515,-0.754139,-1.000000,0.482250,0.654360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009304,1.684947,-0.136930,0.741048,-0.300266,-0.600574,-0.609736,0.073651,-0.789175,-1.000000,0.488140,0.654120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019056,1.683085,-0.120357,0.991516,0.090712,-0.093097,-0.111990,0.232585,-0.966107,-1.000000,0.470810,0.654370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018671,1.680067,-0.120735,0.871273,-0.367380,-0.325446,-0.249337,0.239831,-0.938250,-1.000000,0.472140,0.647840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019041,1.678398,-0.117221,0.844257,-0.215055,-0.490898,-0.420645,0.301683,-0.855596,-1.000000,0.469850,0.647350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018779,1.683859,-0.123451,0.980679,-0.003751,-0.195587,-0.188593,0.247493,-0.950358,-1.000000,0.473970,0.654210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.017943,1.682787,-0.125316,0.824573,-0.356851,-0.439019,-0.436650,0.092011,-0.894914,-1.000000,0.475410,0.651370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015528,1.681339,-0.128091,0.670879,-0.479776,-0.565452,-0.670158,-0.065774,-0.739299,-1.000000,0.478490,0.649500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016280,1.675174,-0.119803,0.731754,-0.375796,-0.568606,-0.541342,0.186423,-0.819875,-1.000000,0.475570,0.641970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015295,1.677794,-0.123964,0.644743,-0.570862,-0.508353,-0.583801,0.061557,-0.809560,-1.000000,0.477140,0.644330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020181,1.676844,-0.115716,0.455685,0.147375,-0.877856,-0.888428,0.136449,-0.438266,-1.000000,0.466400,0.645810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.011786,1.674166,-0.123354,0.552849,-0.475302,-0.684431,-0.720005,0.140991,-0.679495,-1.000000,0.481100,0.639140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006898,1.673845,-0.127137,0.551458,-0.470533,-0.688834,-0.747244,0.088449,-0.658638,-1.000000,0.487440,0.637460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006056,1.676363,-0.130092,0.594427,-0.557626,-0.579404,-0.713403,-0.033180,-0.699968,-1.000000,0.489870,0.640980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.010322,1.676063,-0.125853,0.530581,-0.539883,-0.653460,-0.742131,0.076600,-0.665864,-1.000000,0.482310,0.641140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009092,1.677195,-0.127285,0.571254,-0.332135,-0.750570,-0.764720,0.116768,-0.633694,-1.000000,0.483530,0.642740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.011996,1.678340,-0.126722,0.373844,-0.674551,-0.636570,-0.870494,-0.018291,-0.491840,-1.000000,0.480740,0.645060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012754,1.680285,-0.128978,0.388434,-0.684269,-0.617167,-0.876822,-0.068496,-0.475912,-1.000000,0.481260,0.648360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.011161,1.681742,-0.131776,0.484678,-0.659413,-0.574684,-0.762743,0.002974,-0.646695,-1.000000,0.484050,0.650920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008710,1.682060,-0.134612,0.590239,-0.644794,-0.485653,-0.608331,0.040168,-0.792666,-1.000000,0.487800,0.651220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006669,1.677748,-0.129758,0.814488,-0.265261,-0.515991,-0.531735,0.014487,-0.846787,-1.000000,0.488250,0.642630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005858,1.679540,-0.133518,0.800450,-0.478980,-0.360358,-0.429024,-0.037981,-0.902494,-1.000000,0.491150,0.646040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006712,1.681255,-0.135899,0.621201,-0.657358,-0.426601,-0.496558,0.090956,-0.863225,-1.000000,0.490790,0.649770,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006631,1.679564,-0.131564,0.714870,-0.579659,-0.391097,-0.501248,-0.034819,-0.864603,-1.000000,0.488790,0.645840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007004,1.678227,-0.129566,0.717627,-0.423176,-0.553112,-0.545237,0.152719,-0.824253,-1.000000,0.487540,0.643660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008005,1.679799,-0.130000,0.493480,-0.687426,-0.532844,-0.665549,0.095946,-0.740162,-1.000000,0.486020,0.646360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008332,1.678127,-0.128252,0.519654,-0.496069,-0.695611,-0.718543,0.186726,-0.669948,-1.000000,0.484770,0.644250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.010080,1.679958,-0.129013,0.218772,-0.778765,-0.587932,-0.852905,0.140082,-0.502921,-1.000000,0.483480,0.647320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009631,1.681031,-0.130750,0.242799,-0.865341,-0.438444,-0.782400,0.092515,-0.615866,-1.000000,0.484880,0.649020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007991,1.680856,-0.132125,0.421422,-0.842830,-0.334725,-0.645279,-0.019345,-0.763702,-1.000000,0.487110,0.648690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.010050,1.678600,-0.127485,0.279562,-0.631515,-0.723211,-0.896273,0.098459,-0.432436,-1.000000,0.482610,0.645490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006755,1.680370,-0.133231,0.593715,-0.756916,-0.273095,-0.454783,-0.035655,-0.889888,-1.000000,0.489330,0.648150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018409,1.708440,-0.105586,0.628341,0.395299,-0.670020,-0.736373,0.024465,-0.676133,-1.000000,0.461470,0.689250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.017267,1.706071,-0.108734,0.672503,0.449774,-0.587745,-0.656237,-0.004793,-0.754540,-1.000000,0.463680,0.685920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020410,1.710746,-0.102951,0.472036,0.257331,-0.843186,-0.878773,0.061090,-0.473314,-1.000000,0.458350,0.692730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022020,1.698583,-0.109845,0.505479,0.483090,-0.714924,-0.823817,0.023850,-0.566354,-1.000000,0.457470,0.675630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016761,1.703506,-0.111356,0.672358,0.436439,-0.597876,-0.661053,-0.009418,-0.750280,-1.000000,0.465040,0.682280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012698,1.707414,-0.113693,0.772099,0.369041,-0.517370,-0.532920,-0.067520,-0.843467,-1.000000,0.471910,0.688320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013079,1.710566,-0.110952,0.779976,0.324609,-0.535039,-0.543063,-0.073794,-0.836443,-1.000000,0.470620,0.692350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028731,1.710172,-0.101052,0.058422,0.075640,-0.995422,-0.998033,0.027124,-0.056515,-1.000000,0.448820,0.692160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023054,1.713251,-0.101304,0.245633,0.100620,-0.964126,-0.967035,0.094328,-0.236530,-1.000000,0.455090,0.695980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018468,1.716850,-0.102993,0.486241,0.059073,-0.871826,-0.873813,0.038176,-0.484762,-1.000000,0.461210,0.699640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015927,1.715197,-0.104926,0.672550,0.182544,-0.717185,-0.724626,-0.034403,-0.688284,-1.000000,0.464710,0.697760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014018,1.713326,-0.107982,0.767353,0.260487,-0.585932,-0.589186,-0.074168,-0.804586,-1.000000,0.468360,0.695760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.010029,1.710478,-0.116193,0.825734,0.299823,-0.477776,-0.478735,-0.075413,-0.874715,-1.000000,0.477890,0.693170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.010282,1.714295,-0.113558,0.837961,0.222074,-0.498503,-0.485186,-0.115018,-0.866814,-1.000000,0.476700,0.697830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007998,1.712788,-0.118433,0.807140,0.278858,-0.520349,-0.531717,-0.039599,-0.845996,-1.000000,0.483300,0.696700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008234,1.716847,-0.116152,0.827888,0.192077,-0.526980,-0.516225,-0.106489,-0.849807,-1.000000,0.482210,0.701540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008635,1.720988,-0.114406,0.827723,0.089930,-0.553883,-0.543347,-0.118120,-0.831157,-1.000000,0.480940,0.706200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.011051,1.718627,-0.110874,0.830894,0.120559,-0.543213,-0.534377,-0.099232,-0.839401,-1.000000,0.474650,0.702770,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009354,1.724670,-0.113318,0.784450,-0.081112,-0.614865,-0.620034,-0.080215,-0.780463,-1.000000,0.479920,0.710450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.010628,1.722850,-0.111219,0.815755,-0.052689,-0.575992,-0.578356,-0.062378,-0.813396,-1.000000,0.476200,0.707900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.010906,1.727612,-0.112356,0.651380,-0.296587,-0.698384,-0.736367,-0.025181,-0.676114,-1.000000,0.478120,0.714040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012104,1.724209,-0.109760,0.726074,-0.227529,-0.648882,-0.675265,-0.057875,-0.735301,-1.000000,0.473790,0.709550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014408,1.725628,-0.108127,0.587470,-0.396280,-0.705579,-0.776084,-0.028852,-0.629969,-1.000000,0.470550,0.711140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013263,1.719919,-0.107370,0.769379,0.004017,-0.638780,-0.636416,-0.081367,-0.767043,-1.000000,0.470020,0.703930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015481,1.721046,-0.104874,0.627695,-0.148228,-0.764217,-0.775352,-0.031410,-0.630748,-1.000000,0.466370,0.704990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018065,1.721864,-0.103478,0.448626,-0.261117,-0.854723,-0.875456,0.063960,-0.479048,-1.000000,0.463510,0.706130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021646,1.695674,-0.111855,0.487349,0.394956,-0.778781,-0.859382,0.058867,-0.507934,-1.000000,0.458750,0.671600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021483,1.692183,-0.113386,0.434260,0.281216,-0.855766,-0.897598,0.055211,-0.437344,-1.000000,0.460080,0.666850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016655,1.700610,-0.113553,0.685307,0.386310,-0.617348,-0.673428,0.013473,-0.739130,-1.000000,0.466010,0.678030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016836,1.697123,-0.115081,0.708628,0.307642,-0.634982,-0.673944,0.028656,-0.738226,-1.000000,0.467040,0.673000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012746,1.700349,-0.119000,0.796376,0.342547,-0.498444,-0.535818,0.017366,-0.844155,-1.000000,0.473670,0.677790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012640,1.704049,-0.116394,0.773792,0.367509,-0.515930,-0.546722,-0.023866,-0.836974,-1.000000,0.472740,0.683520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013111,1.696325,-0.121364,0.825231,0.373217,-0.423913,-0.471376,0.041661,-0.880948,-1.000000,0.474710,0.672030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051943,1.649407,-0.095801,0.815120,-0.224646,-0.533961,-0.569637,-0.143238,-0.809319,-1.000000,0.417630,0.602180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.052271,1.638688,-0.090182,0.831825,-0.307975,-0.461756,-0.529064,-0.188438,-0.827395,-1.000000,0.415450,0.583910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050686,1.628305,-0.084246,0.804290,-0.446066,-0.392610,-0.527679,-0.232297,-0.817064,-1.000000,0.414970,0.566310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.053638,1.630848,-0.080613,0.856451,-0.387975,-0.340541,-0.443799,-0.216393,-0.869607,-1.000000,0.409210,0.568560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056449,1.633659,-0.076068,0.896309,-0.338031,-0.286992,-0.362736,-0.186666,-0.913005,-1.000000,0.401730,0.571310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058840,1.636032,-0.070239,0.918147,-0.320877,-0.232474,-0.292419,-0.152787,-0.944006,-1.000000,0.392630,0.573280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.060764,1.647830,-0.075355,0.933351,-0.216659,-0.286208,-0.311911,-0.094861,-0.945364,-1.000000,0.393580,0.593610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.055690,1.626676,-0.065450,0.868241,-0.475175,-0.142708,-0.265159,-0.201304,-0.942957,-1.000000,0.392880,0.557220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.053254,1.624035,-0.070540,0.836048,-0.512436,-0.196043,-0.337134,-0.197914,-0.920419,-1.000000,0.401810,0.554700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051212,1.619566,-0.061151,0.771551,-0.634032,-0.052079,-0.259308,-0.238682,-0.935837,-1.000000,0.393980,0.543710,4,3,2,2,0.994229,0.005771,0.000000,0.000000},
-	{ 0.048483,1.616754,-0.065786,0.727378,-0.679835,-0.093522,-0.314501,-0.209118,-0.925937,-1.000000,0.402970,0.540610,4,3,2,2,0.995328,0.004672,0.000000,0.000000},
-	{ 0.046026,1.614339,-0.057279,0.695835,-0.717927,-0.019863,-0.279400,-0.245117,-0.928361,-1.000000,0.395680,0.531730,4,3,2,2,0.942703,0.057297,0.000000,0.000000},
-	{ 0.042428,1.611341,-0.061603,0.653419,-0.753819,-0.069290,-0.331880,-0.203000,-0.921220,-1.000000,0.405460,0.527680,4,3,2,2,0.947746,0.052254,0.000000,0.000000},
-	{ 0.047671,1.626265,-0.087518,0.753550,-0.485704,-0.443006,-0.597191,-0.224051,-0.770171,-1.000000,0.420350,0.564760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044627,1.624821,-0.090701,0.702917,-0.506984,-0.498874,-0.667093,-0.226573,-0.709684,-1.000000,0.425880,0.564050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041708,1.624266,-0.093851,0.651199,-0.505624,-0.565937,-0.735439,-0.236432,-0.635003,-1.000000,0.431190,0.564690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.039030,1.624809,-0.096856,0.596476,-0.479696,-0.643512,-0.795937,-0.250184,-0.551264,-1.000000,0.435890,0.566710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.036593,1.626029,-0.099610,0.547242,-0.437169,-0.713729,-0.836896,-0.297451,-0.459486,-1.000000,0.440230,0.569590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.034230,1.627292,-0.101957,0.504846,-0.388453,-0.770866,-0.858621,-0.317936,-0.402104,-1.000000,0.444390,0.572430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.034655,1.620288,-0.097390,0.614849,-0.477044,-0.628004,-0.788336,-0.394034,-0.472507,-1.000000,0.441550,0.562390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032961,1.622280,-0.100325,0.591432,-0.402712,-0.698592,-0.796666,-0.425725,-0.429047,-1.000000,0.445320,0.566860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031886,1.628065,-0.103782,0.500996,-0.356439,-0.788641,-0.860873,-0.298834,-0.411820,-1.000000,0.448190,0.574370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032784,1.633907,-0.105817,0.462056,-0.330361,-0.823023,-0.886434,-0.200508,-0.417172,-1.000000,0.447880,0.580760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029644,1.628018,-0.105194,0.506780,-0.350314,-0.787689,-0.860124,-0.266923,-0.434672,-1.000000,0.451680,0.575140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.030318,1.633118,-0.107109,0.511651,-0.316830,-0.798644,-0.858768,-0.217809,-0.463763,-1.000000,0.451580,0.580630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.033282,1.640806,-0.107953,0.358227,-0.295844,-0.885522,-0.933045,-0.079734,-0.350814,-1.000000,0.447850,0.588680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.030856,1.639494,-0.108884,0.478316,-0.225061,-0.848859,-0.877704,-0.090446,-0.470590,-1.000000,0.451510,0.587430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027585,1.631861,-0.108313,0.510807,-0.338176,-0.790388,-0.859302,-0.228676,-0.457502,-1.000000,0.455720,0.580040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028156,1.637878,-0.110232,0.544960,-0.242986,-0.802481,-0.838168,-0.183232,-0.513713,-1.000000,0.455840,0.586100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029293,1.624367,-0.103868,0.519771,-0.308639,-0.796605,-0.846265,-0.313642,-0.430656,-1.000000,0.451890,0.571380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031132,1.623826,-0.102458,0.542620,-0.344097,-0.766264,-0.825856,-0.385122,-0.411877,-1.000000,0.448830,0.569970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027174,1.627112,-0.106297,0.507508,-0.328622,-0.796520,-0.859749,-0.254458,-0.442812,-1.000000,0.455460,0.574940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027204,1.623468,-0.104945,0.550514,-0.229790,-0.802578,-0.826139,-0.288285,-0.484135,-1.000000,0.455190,0.571220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024580,1.621285,-0.106378,0.595238,-0.121367,-0.794331,-0.795977,-0.224449,-0.562177,-1.000000,0.459840,0.570000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024024,1.625177,-0.107546,0.514959,-0.234584,-0.824493,-0.855016,-0.209416,-0.474440,-1.000000,0.460640,0.573870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021763,1.618581,-0.108515,0.636757,-0.045828,-0.769701,-0.766853,-0.141827,-0.625957,-1.000000,0.466000,0.567930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018971,1.616197,-0.110968,0.657755,-0.041020,-0.752114,-0.751950,-0.093977,-0.652487,-1.000000,0.471550,0.565990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015925,1.614581,-0.113474,0.617944,-0.095052,-0.780455,-0.786181,-0.084824,-0.612147,-1.000000,0.477320,0.564810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012460,1.613743,-0.115904,0.496925,-0.148882,-0.854927,-0.867689,-0.100515,-0.486839,-1.000000,0.483910,0.564420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008536,1.613521,-0.117722,0.290881,-0.181941,-0.939300,-0.956434,-0.080897,-0.280517,-1.000000,0.490330,0.564650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004407,1.613683,-0.118427,0.071295,-0.197587,-0.977689,-0.997129,-0.039205,-0.064790,-1.000000,0.495630,0.565080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.613850,-0.118332,-0.000233,-0.202076,-0.979370,-1.000000,0.000000,0.000000,-1.000000,0.500000,0.565290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019598,1.613163,-0.109950,0.676807,-0.205506,-0.706895,-0.735845,-0.160743,-0.657794,-1.000000,0.470710,0.562900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022569,1.615346,-0.107495,0.684496,-0.155219,-0.712301,-0.727726,-0.203598,-0.654952,-1.000000,0.464910,0.564510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023174,1.612440,-0.105946,0.709670,-0.314544,-0.630422,-0.704298,-0.293537,-0.646375,-1.000000,0.463550,0.560460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019998,1.610338,-0.108340,0.670005,-0.374967,-0.640697,-0.736243,-0.225099,-0.638183,-1.000000,0.469690,0.559130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016273,1.611604,-0.112512,0.611931,-0.286415,-0.737230,-0.785732,-0.113650,-0.608037,-1.000000,0.476940,0.561850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016463,1.608777,-0.110838,0.578260,-0.466470,-0.669344,-0.794953,-0.137646,-0.590849,-1.000000,0.476310,0.558150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012408,1.607783,-0.113228,0.431717,-0.550248,-0.714736,-0.878219,-0.075628,-0.472241,-1.000000,0.483580,0.557400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012471,1.610641,-0.114964,0.473416,-0.365999,-0.801201,-0.874545,-0.086755,-0.477122,-1.000000,0.483890,0.561280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008065,1.607342,-0.114889,0.234593,-0.592118,-0.770949,-0.964498,-0.042828,-0.260595,-1.000000,0.490320,0.557130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008324,1.610300,-0.116671,0.257693,-0.414510,-0.872798,-0.964116,-0.050625,-0.260611,-1.000000,0.490460,0.561260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003892,1.607323,-0.115475,0.052465,-0.585224,-0.809172,-0.998365,-0.012322,-0.055820,-1.000000,0.495700,0.557230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004189,1.610450,-0.117311,0.050503,-0.418169,-0.906964,-0.998683,-0.012965,-0.049633,-1.000000,0.495740,0.561550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.607393,-0.115385,-0.000425,-0.573409,-0.819269,-1.000000,0.000000,0.000000,-1.000000,0.500010,0.557310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.610596,-0.117262,-0.000577,-0.412620,-0.910903,-1.000000,0.000000,0.000000,-1.000000,0.500000,0.561710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.603965,-0.112699,-0.000228,-0.697056,-0.717016,-1.000000,0.000000,0.000000,-1.000000,0.500010,0.552220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003588,1.604006,-0.112648,0.067528,-0.703211,-0.707767,-0.996701,-0.015534,-0.079661,-1.000000,0.495400,0.552230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003588,1.600855,-0.109022,0.077891,-0.791428,-0.606279,-0.994870,-0.022333,-0.098662,-1.000000,0.494870,0.547290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.600797,-0.109093,-0.000141,-0.793492,-0.608580,-1.000000,0.000000,0.000000,-1.000000,0.500010,0.547230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.598459,-0.105613,-0.000103,-0.881780,-0.471660,-1.000000,0.000000,0.001043,-1.000000,0.500010,0.542780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.003913,1.598569,-0.105486,0.082132,-0.878818,-0.470035,-0.992863,-0.031229,-0.115100,-1.000000,0.494130,0.542870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007864,1.601147,-0.108519,0.203060,-0.770982,-0.603616,-0.965053,-0.053293,-0.256579,-1.000000,0.488770,0.547550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008386,1.598910,-0.105014,0.184348,-0.861836,-0.472498,-0.965009,-0.067503,-0.253379,-1.000000,0.487410,0.543270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012544,1.601900,-0.107350,0.362813,-0.716714,-0.595557,-0.903000,-0.112576,-0.414630,-1.000000,0.481490,0.548200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012961,1.599747,-0.104075,0.336524,-0.813796,-0.473800,-0.904690,-0.139777,-0.402491,-1.000000,0.479790,0.544090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016712,1.603194,-0.105606,0.528067,-0.638923,-0.559395,-0.820010,-0.212418,-0.531471,-1.000000,0.473840,0.549120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016824,1.601118,-0.102683,0.505106,-0.730611,-0.459430,-0.818714,-0.237185,-0.522925,-1.000000,0.472260,0.545140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020193,1.604862,-0.103457,0.659284,-0.572528,-0.487397,-0.730017,-0.332173,-0.597274,-1.000000,0.466870,0.549840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019862,1.602644,-0.100858,0.653433,-0.637282,-0.408529,-0.722410,-0.363742,-0.588061,-1.000000,0.465880,0.545780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.016558,1.605926,-0.108387,0.545193,-0.564965,-0.619337,-0.812082,-0.172571,-0.557443,-1.000000,0.475240,0.553690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020213,1.607536,-0.106087,0.659809,-0.491992,-0.567975,-0.738241,-0.283402,-0.612114,-1.000000,0.468290,0.554570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012317,1.604809,-0.110481,0.392371,-0.646255,-0.654523,-0.888891,-0.083472,-0.450451,-1.000000,0.482770,0.552830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.007769,1.604185,-0.112070,0.218909,-0.696173,-0.683683,-0.962882,-0.040728,-0.266833,-1.000000,0.489760,0.552330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023328,1.606897,-0.100952,0.723842,-0.540842,-0.428418,-0.670774,-0.406183,-0.620547,-1.000000,0.460160,0.550310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022567,1.604229,-0.098318,0.710223,-0.607108,-0.356376,-0.682118,-0.468306,-0.561608,-1.000000,0.459630,0.545470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023506,1.609643,-0.103729,0.722716,-0.452686,-0.522261,-0.684176,-0.361555,-0.633389,-1.000000,0.461700,0.555580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026507,1.609407,-0.098447,0.734729,-0.527045,-0.427080,-0.664718,-0.433729,-0.608300,-1.000000,0.452890,0.551260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025671,1.606213,-0.095470,0.710359,-0.604188,-0.361036,-0.681803,-0.463343,-0.566090,-1.000000,0.452230,0.545060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026592,1.612301,-0.101548,0.742336,-0.431503,-0.512584,-0.667598,-0.411237,-0.620643,-1.000000,0.454920,0.557230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026102,1.615063,-0.103859,0.716462,-0.284456,-0.636999,-0.695634,-0.360263,-0.621533,-1.000000,0.457190,0.562430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025364,1.617982,-0.105403,0.662597,-0.148935,-0.734019,-0.740546,-0.276906,-0.612303,-1.000000,0.458870,0.566520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029290,1.615317,-0.100053,0.728006,-0.414991,-0.545701,-0.685532,-0.432152,-0.585910,-1.000000,0.450070,0.559560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029654,1.612371,-0.096728,0.721449,-0.512082,-0.466136,-0.684671,-0.426783,-0.590831,-1.000000,0.447530,0.553370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031386,1.618531,-0.099631,0.674439,-0.409501,-0.614362,-0.735177,-0.449300,-0.507587,-1.000000,0.447090,0.562730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032387,1.615916,-0.096342,0.679830,-0.498518,-0.537877,-0.732328,-0.422391,-0.534117,-1.000000,0.443930,0.557060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.030130,1.620654,-0.101930,0.622217,-0.319891,-0.714504,-0.769260,-0.419133,-0.482251,-1.000000,0.450150,0.566870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028457,1.617896,-0.102384,0.692624,-0.284681,-0.662743,-0.713425,-0.405771,-0.571292,-1.000000,0.452730,0.564510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029119,1.622003,-0.103203,0.564490,-0.257721,-0.784175,-0.809206,-0.360266,-0.464106,-1.000000,0.452140,0.569010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027626,1.620489,-0.103864,0.622572,-0.188498,-0.759521,-0.765491,-0.348310,-0.541021,-1.000000,0.454540,0.568120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029129,1.608882,-0.093213,0.703248,-0.595977,-0.387625,-0.690658,-0.443388,-0.571313,-1.000000,0.446160,0.546190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032785,1.612760,-0.092467,0.673530,-0.585601,-0.451030,-0.727843,-0.419071,-0.542792,-1.000000,0.441340,0.550150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026951,1.604787,-0.090073,0.666361,-0.706063,-0.239660,-0.682909,-0.448892,-0.576308,-1.000000,0.447260,0.536830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032120,1.608778,-0.087366,0.646115,-0.690927,-0.324276,-0.705850,-0.379284,-0.598263,-1.000000,0.439340,0.539680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.022583,1.600438,-0.087587,0.556730,-0.823608,-0.108264,-0.700308,-0.395245,-0.594433,-1.000000,0.453610,0.525140,4,3,2,2,0.998313,0.001687,0.000000,0.000000},
-	{ 0.020036,1.599483,-0.092018,0.535555,-0.831946,-0.145078,-0.770201,-0.410715,-0.487959,-1.000000,0.459470,0.530070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023565,1.602882,-0.093297,0.658507,-0.705294,-0.262542,-0.708919,-0.464250,-0.530948,-1.000000,0.453920,0.538150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025980,1.602159,-0.082484,0.563576,-0.815308,-0.132871,-0.657795,-0.345634,-0.669211,-1.000000,0.446360,0.522800,4,3,2,2,0.987012,0.012988,0.000000,0.000000},
-	{ 0.020987,1.601746,-0.096662,0.652118,-0.706627,-0.274627,-0.724964,-0.475293,-0.498522,-1.000000,0.460920,0.541130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019458,1.601234,-0.099079,0.622435,-0.715336,-0.317599,-0.730975,-0.386277,-0.562553,-1.000000,0.465510,0.542990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.017168,1.599803,-0.099653,0.485310,-0.811535,-0.325402,-0.816929,-0.288230,-0.499550,-1.000000,0.470010,0.541510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018199,1.599330,-0.096151,0.515418,-0.827916,-0.221132,-0.804822,-0.379058,-0.456702,-1.000000,0.465610,0.536780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013493,1.598242,-0.100399,0.325599,-0.885100,-0.332540,-0.908246,-0.195022,-0.370210,-1.000000,0.477360,0.539770,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014266,1.597239,-0.096185,0.347123,-0.913070,-0.214032,-0.905823,-0.267325,-0.328668,-1.000000,0.473550,0.533080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009468,1.595939,-0.096240,0.187877,-0.957842,-0.217352,-0.969816,-0.145891,-0.195377,-1.000000,0.482710,0.530910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.008948,1.597239,-0.100949,0.177057,-0.925737,-0.334158,-0.967975,-0.102397,-0.229215,-1.000000,0.485500,0.538560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004499,1.595330,-0.096337,0.086690,-0.972509,-0.216125,-0.991348,-0.062748,-0.115289,-1.000000,0.491640,0.529850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004239,1.596800,-0.101266,0.087517,-0.937272,-0.337434,-0.991579,-0.049507,-0.119663,-1.000000,0.493110,0.537960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.595040,-0.096467,-0.000326,-0.977024,-0.213131,-1.000000,0.000000,0.000000,-1.000000,0.500020,0.529200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.596584,-0.101435,-0.000177,-0.939578,-0.342335,-0.999999,0.000000,0.001100,-1.000000,0.500010,0.537810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.594324,-0.090741,-0.000608,-0.996916,-0.078471,-0.999999,0.000000,0.001373,-1.000000,0.500020,0.516670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004722,1.594435,-0.090775,0.080511,-0.993276,-0.083190,-0.986691,-0.067590,-0.147895,-1.000000,0.490040,0.517430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009854,1.595063,-0.090928,0.212536,-0.973826,-0.080569,-0.948690,-0.185886,-0.255802,-1.000000,0.479440,0.519830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.015222,1.596739,-0.091309,0.377296,-0.921960,-0.087393,-0.866790,-0.318334,-0.383847,-1.000000,0.468800,0.523460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.004850,1.594316,-0.084928,0.089059,-0.995832,0.019695,-0.973381,-0.091210,-0.210264,-1.000000,0.489180,0.508710,4,3,2,2,0.995426,0.004574,0.000000,0.000000},
-	{ 0.010055,1.595043,-0.085173,0.226937,-0.973565,0.025907,-0.893944,-0.218786,-0.391148,-1.000000,0.477350,0.511120,4,3,2,2,0.991941,0.008059,0.000000,0.000000},
-	{ 0.004961,1.594652,-0.079067,0.119355,-0.992424,0.029119,-0.958146,-0.122820,-0.258596,-1.000000,0.487880,0.502760,4,3,2,2,0.964337,0.035663,0.000000,0.000000},
-	{ 0.009966,1.595522,-0.079400,0.232327,-0.971180,0.053224,-0.848178,-0.229077,-0.477617,-1.000000,0.475520,0.505260,4,3,2,2,0.964354,0.035646,0.000000,0.000000},
-	{ 0.005206,1.594710,-0.073272,0.151524,-0.986863,-0.056058,-0.944324,-0.127770,-0.303196,-1.000000,0.486220,0.497050,4,3,2,2,0.916583,0.083417,0.000000,0.000000},
-	{ 0.010262,1.595834,-0.073761,0.250984,-0.967503,-0.030730,-0.837818,-0.201222,-0.507515,-1.000000,0.472960,0.500020,4,3,2,2,0.917180,0.082820,0.000000,0.000000},
-	{ 0.005612,1.594095,-0.067665,0.152979,-0.972754,-0.174203,-0.946903,-0.093843,-0.307519,-1.000000,0.484510,0.491620,4,3,2,2,0.859512,0.140488,0.000000,0.000000},
-	{ 0.011040,1.595525,-0.068291,0.252285,-0.950687,-0.180406,-0.850400,-0.128871,-0.510110,-1.000000,0.469920,0.495040,4,3,2,2,0.861741,0.138259,0.000000,0.000000},
-	{ 0.006144,1.592944,-0.062613,0.122988,-0.932048,-0.340823,-0.955401,-0.018290,-0.294744,-1.000000,0.482530,0.486590,4,3,2,2,0.763994,0.236006,0.000000,0.000000},
-	{ 0.012091,1.594340,-0.063293,0.228193,-0.908661,-0.349662,-0.865006,-0.024375,-0.501170,-1.000000,0.466380,0.490450,4,3,2,2,0.790324,0.209676,0.000000,0.000000},
-	{ 0.007014,1.590919,-0.058400,0.096958,-0.796856,-0.596339,-0.962933,0.076428,-0.258689,-1.000000,0.480070,0.481950,4,3,2,2,0.657596,0.342404,0.000000,0.000000},
-	{ 0.013451,1.592554,-0.059065,0.194952,-0.802019,-0.564588,-0.889729,0.097640,-0.445925,-1.000000,0.462130,0.486440,4,3,2,2,0.701812,0.298188,0.000000,0.000000},
-	{ 0.000000,1.590478,-0.058051,-0.000052,-0.800091,-0.599879,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.480310,4,3,2,2,0.633497,0.366503,0.000000,0.000000},
-	{ 0.000000,1.592464,-0.062339,-0.000117,-0.944032,-0.329853,-0.999999,0.000000,-0.001328,-1.000000,0.500000,0.485210,4,3,2,2,0.747186,0.252814,0.000000,0.000000},
-	{ 0.000000,1.593503,-0.067464,-0.000185,-0.986067,-0.166348,-1.000000,0.000000,0.000000,-1.000000,0.500010,0.490470,4,3,2,2,0.863274,0.136726,0.000000,0.000000},
-	{ 0.000000,1.594149,-0.073149,-0.000214,-0.997692,-0.067906,-0.999971,0.000000,0.007593,-1.000000,0.500040,0.496020,4,3,2,2,0.926320,0.073680,0.000000,0.000000},
-	{ 0.000000,1.594382,-0.078929,-0.000462,-0.999929,0.011878,-0.999991,0.000000,0.004245,-1.000000,0.500030,0.502030,4,3,2,2,0.966853,0.033147,0.000000,0.000000},
-	{ 0.000000,1.594212,-0.084807,-0.000758,-0.999925,0.012257,-0.999995,0.000000,0.003245,-1.000000,0.500030,0.507960,4,3,2,2,0.994645,0.005355,0.000000,0.000000},
-	{ 0.019151,1.594655,-0.059638,0.399049,-0.803966,-0.440906,-0.751453,-0.011201,-0.659691,-1.000000,0.448670,0.491590,4,3,2,2,0.741588,0.258412,0.000000,0.000000},
-	{ 0.025904,1.598591,-0.060536,0.498674,-0.788854,-0.359212,-0.647239,-0.063234,-0.759660,-1.000000,0.432700,0.500630,4,3,2,2,0.790826,0.209174,0.000000,0.000000},
-	{ 0.032546,1.603804,-0.063078,0.567077,-0.789786,-0.233799,-0.530407,-0.132992,-0.837246,-1.000000,0.421470,0.512750,4,3,2,2,0.859928,0.140072,0.000000,0.000000},
-	{ 0.036528,1.605600,-0.057670,0.663063,-0.721768,-0.198491,-0.420603,-0.139878,-0.896397,-1.000000,0.410320,0.514470,4,3,2,2,0.832181,0.167819,0.000000,0.000000},
-	{ 0.039017,1.608981,-0.066345,0.602950,-0.788946,-0.118389,-0.431993,-0.198119,-0.879847,-1.000000,0.415080,0.525060,4,3,2,2,0.947883,0.052117,0.000000,0.000000},
-	{ 0.045265,1.614449,-0.070278,0.679971,-0.717035,-0.153296,-0.422222,-0.211970,-0.881361,-1.000000,0.411600,0.538050,4,3,2,2,0.993771,0.006229,0.000000,0.000000},
-	{ 0.050328,1.621579,-0.075008,0.785617,-0.561576,-0.259688,-0.441209,-0.214246,-0.871455,-1.000000,0.409730,0.552340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.047108,1.619462,-0.078982,0.736830,-0.600518,-0.310579,-0.536863,-0.240496,-0.808666,-1.000000,0.416340,0.550680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.043889,1.617833,-0.082647,0.699965,-0.619835,-0.354757,-0.613325,-0.267218,-0.743254,-1.000000,0.422430,0.549970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038807,1.611151,-0.078683,0.640625,-0.728775,-0.241840,-0.611450,-0.293660,-0.734774,-1.000000,0.426060,0.536530,4,3,2,2,0.998907,0.001093,0.000000,0.000000},
-	{ 0.035716,1.609829,-0.082621,0.632893,-0.713668,-0.300206,-0.674434,-0.317751,-0.666463,-1.000000,0.432740,0.537490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040780,1.616728,-0.086250,0.670922,-0.622871,-0.402363,-0.677959,-0.295438,-0.673118,-1.000000,0.428370,0.550460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038117,1.616671,-0.090030,0.651328,-0.604625,-0.458476,-0.728170,-0.328118,-0.601753,-1.000000,0.433690,0.552800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.036313,1.618153,-0.093865,0.631903,-0.550369,-0.545703,-0.768767,-0.355629,-0.531532,-1.000000,0.437840,0.557390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.011674,1.740345,-0.116263,0.187511,-0.066520,-0.980007,-0.970280,0.142819,-0.195344,-1.000000,0.483050,0.732130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.009186,1.742876,-0.116782,0.140624,0.043238,-0.989119,-0.982514,0.129232,-0.134035,-1.000000,0.487320,0.735690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012343,1.749664,-0.115632,0.194300,0.157142,-0.968274,-0.969630,0.180244,-0.165320,-1.000000,0.483570,0.747550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014978,1.744267,-0.115773,0.210248,0.066455,-0.975387,-0.965173,0.172980,-0.196261,-1.000000,0.479660,0.739480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019718,1.746287,-0.114377,0.264150,0.154946,-0.951954,-0.951043,0.206038,-0.230361,-1.000000,0.473930,0.744890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018870,1.752047,-0.113456,0.283697,0.205496,-0.936636,-0.943971,0.231617,-0.235103,-1.000000,0.474940,0.753370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005035,1.744282,-0.117179,0.086576,0.068387,-0.993895,-0.992773,0.089144,-0.080345,-1.000000,0.493150,0.737160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.005888,1.750994,-0.116371,0.106926,0.150245,-0.982850,-0.991856,0.084921,-0.094924,-1.000000,0.492150,0.748280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.744738,-0.117370,0.000578,0.072604,-0.997361,-1.000000,0.000000,0.000000,-1.000000,0.499930,0.737380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.751372,-0.116630,0.000514,0.148416,-0.988925,-1.000000,0.000000,0.000000,-1.000000,0.499930,0.748450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.018851,1.758627,-0.111927,0.303911,0.214205,-0.928307,-0.941643,0.215563,-0.258536,-1.000000,0.475210,0.761830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025292,1.759202,-0.109420,0.357607,0.229666,-0.905191,-0.928327,0.192891,-0.317807,-1.000000,0.466870,0.764380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032760,1.758719,-0.106456,0.403848,0.259424,-0.877272,-0.914430,0.142697,-0.378755,-1.000000,0.457440,0.765500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041229,1.756793,-0.102779,0.494038,0.295641,-0.817632,-0.864943,0.071600,-0.496736,-1.000000,0.445960,0.764380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049212,1.753260,-0.098295,0.604320,0.338166,-0.721416,-0.768593,0.008880,-0.639677,-1.000000,0.432590,0.760180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056048,1.748846,-0.094039,0.723969,0.367495,-0.583795,-0.632737,0.016639,-0.774188,-1.000000,0.422300,0.753790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061534,1.743562,-0.089613,0.860260,0.288372,-0.420470,-0.458618,0.077349,-0.885261,-1.000000,0.413570,0.745940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064703,1.736951,-0.085084,0.938215,0.106405,-0.329288,-0.338952,0.090790,-0.936413,-1.000000,0.405610,0.736590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065763,1.728945,-0.082118,0.931843,-0.032162,-0.361434,-0.360064,0.041493,-0.932004,-1.000000,0.399890,0.725040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065497,1.720420,-0.081265,0.875109,0.067302,-0.479223,-0.481979,0.032487,-0.875580,-1.000000,0.397990,0.710950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049498,1.758469,-0.096044,0.637723,0.327822,-0.697024,-0.750813,0.062474,-0.657554,-1.000000,0.431900,0.767270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041262,1.762369,-0.100753,0.524293,0.334015,-0.783295,-0.846671,0.106273,-0.521396,-1.000000,0.445530,0.771620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041101,1.768228,-0.097894,0.540597,0.409379,-0.734958,-0.833658,0.143340,-0.533355,-1.000000,0.445220,0.780090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049558,1.764225,-0.093101,0.653788,0.372650,-0.658554,-0.735873,0.110445,-0.668051,-1.000000,0.431500,0.775860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032919,1.770429,-0.101929,0.456235,0.415041,-0.787141,-0.889286,0.180904,-0.420052,-1.000000,0.457130,0.781100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025749,1.771260,-0.105206,0.383451,0.407788,-0.828658,-0.923483,0.180944,-0.338286,-1.000000,0.466830,0.780190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019286,1.771294,-0.107856,0.307019,0.404349,-0.861535,-0.951154,0.161133,-0.263330,-1.000000,0.475260,0.778500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.013014,1.771045,-0.109889,0.215250,0.405402,-0.888435,-0.976218,0.113360,-0.184791,-1.000000,0.483360,0.776840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006600,1.770795,-0.111169,0.107678,0.407517,-0.906827,-0.994152,0.051610,-0.094855,-1.000000,0.491560,0.775790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.770683,-0.111608,0.000323,0.408233,-0.912878,-1.000000,0.000000,0.000000,-1.000000,0.499920,0.775420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056388,1.758526,-0.088044,0.796884,0.311077,-0.517887,-0.572181,0.113533,-0.812231,-1.000000,0.419620,0.768600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061520,1.751405,-0.082264,0.894493,0.263011,-0.361535,-0.403077,0.124576,-0.906648,-1.000000,0.408570,0.759210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065467,1.743403,-0.076281,0.941501,0.201707,-0.269983,-0.296910,0.117445,-0.947656,-1.000000,0.397970,0.748190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068217,1.734371,-0.072030,0.966156,0.103418,-0.236319,-0.246083,0.094762,-0.964605,-1.000000,0.390050,0.734420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069110,1.724232,-0.070598,0.966725,0.089160,-0.239776,-0.246742,0.077548,-0.965974,-1.000000,0.386220,0.718040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070707,1.725564,-0.063661,0.968300,0.080027,-0.236624,-0.243804,0.096642,-0.964997,-1.000000,0.378410,0.721380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070267,1.714281,-0.071690,0.947429,0.198774,-0.250735,-0.272525,0.090697,-0.957864,-1.000000,0.385620,0.701220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072498,1.704626,-0.073703,0.961386,0.121020,-0.247165,-0.256564,0.069245,-0.964043,-1.000000,0.386030,0.685330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072173,1.694025,-0.075038,0.960495,-0.140041,-0.240496,-0.240174,0.019452,-0.970535,-1.000000,0.386970,0.668320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068959,1.683280,-0.075315,0.934449,-0.263973,-0.239004,-0.250709,-0.011057,-0.967999,-1.000000,0.388530,0.650980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067163,1.683682,-0.081662,0.915499,-0.255669,-0.310635,-0.317605,0.014664,-0.948110,-1.000000,0.395400,0.651640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070125,1.693966,-0.081689,0.930934,-0.121684,-0.344318,-0.343267,0.030162,-0.938753,-1.000000,0.394240,0.668030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070486,1.704046,-0.079992,0.924371,0.131532,-0.358103,-0.369237,0.072422,-0.926509,-1.000000,0.393320,0.683750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068763,1.713225,-0.077879,0.909456,0.220432,-0.352562,-0.378634,0.088637,-0.921293,-1.000000,0.392730,0.698340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067514,1.722234,-0.076596,0.947240,0.083985,-0.309328,-0.313436,0.040842,-0.948731,-1.000000,0.392760,0.714190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067195,1.731649,-0.077480,0.965848,0.063255,-0.251269,-0.254900,0.057896,-0.965233,-1.000000,0.395370,0.729430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065392,1.740036,-0.081111,0.946719,0.196967,-0.254808,-0.278416,0.102839,-0.954939,-1.000000,0.402020,0.741980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061573,1.747137,-0.086145,0.878696,0.304774,-0.367432,-0.412235,0.096287,-0.905975,-1.000000,0.411110,0.752010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056252,1.753275,-0.091206,0.765929,0.328738,-0.552526,-0.601770,0.064029,-0.796098,-1.000000,0.420890,0.760490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038680,1.729227,-0.106615,0.186493,-0.695231,-0.694171,-0.966281,-0.002114,-0.257479,-1.000000,0.448200,0.719290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042577,1.729143,-0.105756,0.219913,-0.664041,-0.714624,-0.946575,0.031869,-0.320904,-1.000000,0.443950,0.719510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046298,1.728660,-0.104327,0.378462,-0.467945,-0.798620,-0.893844,0.039353,-0.446648,-1.000000,0.439540,0.719020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045949,1.727610,-0.103203,0.143227,-0.730751,-0.667449,-0.938074,0.114713,-0.326893,-1.000000,0.439110,0.716710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042502,1.728040,-0.104170,0.185639,-0.703550,-0.685971,-0.957578,0.027066,-0.286902,-1.000000,0.442920,0.716790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.039015,1.727812,-0.105026,0.243121,-0.598463,-0.763371,-0.963828,-0.060438,-0.259581,-1.000000,0.446770,0.716520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035537,1.727043,-0.105701,0.172524,-0.537842,-0.825204,-0.982914,-0.039435,-0.179794,-1.000000,0.450200,0.715880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032107,1.726344,-0.105609,0.021611,-0.569697,-0.821571,-0.994500,0.071988,-0.076078,-1.000000,0.453080,0.714890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029315,1.725946,-0.105128,-0.053341,-0.634176,-0.771347,-0.989394,0.138075,-0.045100,-1.000000,0.455410,0.713740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027196,1.725557,-0.104722,-0.004617,-0.677466,-0.735540,-0.990393,0.104757,-0.090269,-1.000000,0.457030,0.712700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025742,1.725223,-0.104484,-0.011047,-0.608517,-0.793464,-0.989950,0.118534,-0.077123,-1.000000,0.458050,0.712020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026104,1.724300,-0.103616,0.020339,-0.624930,-0.780416,-0.988521,0.104314,-0.109294,-1.000000,0.457220,0.710700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028296,1.723554,-0.103130,-0.185639,-0.450674,-0.873173,-0.969417,0.229170,0.087818,-1.000000,0.455170,0.710140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.031643,1.722634,-0.103717,-0.153170,-0.357448,-0.921287,-0.982662,0.153656,0.103758,-1.000000,0.451890,0.710150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035837,1.722562,-0.104034,0.105278,-0.310331,-0.944781,-0.994358,-0.045258,-0.095936,-1.000000,0.448070,0.710390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040081,1.723448,-0.103176,0.358690,-0.261336,-0.896128,-0.933307,-0.117571,-0.339285,-1.000000,0.444100,0.710640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.043590,1.724181,-0.101374,0.452652,-0.320627,-0.832048,-0.879694,-0.008042,-0.475473,-1.000000,0.440090,0.711020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046726,1.724458,-0.099809,0.372217,-0.505380,-0.778489,-0.868849,0.105266,-0.483757,-1.000000,0.436420,0.711680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027458,1.724922,-0.104098,-0.024170,-0.635244,-0.771933,-0.989120,0.127280,-0.073772,-1.000000,0.456460,0.711720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.029321,1.724835,-0.104180,-0.148356,-0.514404,-0.844618,-0.978204,0.201804,0.048915,-1.000000,0.454840,0.712020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032239,1.724674,-0.104636,-0.065914,-0.423701,-0.903401,-0.993608,0.111022,0.020426,-1.000000,0.452150,0.712600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035874,1.725066,-0.104786,0.149930,-0.351421,-0.924134,-0.988689,-0.056953,-0.138746,-1.000000,0.448960,0.713210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.039464,1.726013,-0.103974,0.322337,-0.350598,-0.879306,-0.946612,-0.114559,-0.301333,-1.000000,0.445400,0.713650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042731,1.726560,-0.102726,0.325771,-0.477780,-0.815843,-0.928913,-0.001068,-0.370295,-1.000000,0.441630,0.713980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046026,1.726366,-0.101697,0.215409,-0.634835,-0.742013,-0.917714,0.128106,-0.376018,-1.000000,0.438060,0.714270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048664,1.725965,-0.100918,0.143355,-0.720757,-0.678203,-0.916444,0.162018,-0.365897,-1.000000,0.435250,0.714540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050017,1.725915,-0.100543,0.267215,-0.691274,-0.671369,-0.898989,0.072056,-0.432004,-1.000000,0.433680,0.714790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.049977,1.726473,-0.101080,0.375485,-0.555313,-0.742051,-0.881176,0.034290,-0.471544,-1.000000,0.434070,0.715800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048604,1.726942,-0.102023,0.202342,-0.680096,-0.704647,-0.910065,0.135181,-0.391800,-1.000000,0.435970,0.716310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012643,1.757907,-0.113894,0.219241,0.205537,-0.953776,-0.968058,0.167704,-0.186384,-1.000000,0.483470,0.758970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006324,1.757881,-0.115087,0.117607,0.203143,-0.972060,-0.992175,0.065364,-0.106381,-1.000000,0.491750,0.758000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.757945,-0.115454,0.000466,0.204902,-0.978782,-1.000000,0.000000,0.000000,-1.000000,0.499930,0.757920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.764155,-0.113958,0.000406,0.288771,-0.957398,-1.000000,0.000000,0.000000,-1.000000,0.499920,0.766450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.006522,1.764232,-0.113577,0.114685,0.285199,-0.951582,-0.993108,0.056199,-0.102846,-1.000000,0.491640,0.766740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.012916,1.764497,-0.112346,0.224634,0.280334,-0.933248,-0.971879,0.133894,-0.193712,-1.000000,0.483430,0.767850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.019162,1.764944,-0.110327,0.311922,0.283777,-0.906739,-0.946043,0.180949,-0.268812,-1.000000,0.475300,0.769920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025647,1.765154,-0.107744,0.374328,0.299471,-0.877608,-0.925405,0.181054,-0.332933,-1.000000,0.466880,0.771900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.032952,1.764481,-0.104606,0.434940,0.323239,-0.840442,-0.900459,0.156129,-0.405952,-1.000000,0.457240,0.772800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006571,1.770797,-0.111173,-0.107427,0.407632,-0.906805,-0.994175,-0.051985,0.094409,-1.000000,0.508280,0.775790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012986,1.771048,-0.109895,-0.215064,0.405571,-0.888403,-0.976245,-0.113806,0.184375,-1.000000,0.516480,0.776850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019259,1.771296,-0.107862,-0.307040,0.404476,-0.861467,-0.951128,-0.161694,0.263078,-1.000000,0.524580,0.778510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025722,1.771262,-0.105211,-0.383549,0.407835,-0.828589,-0.923437,-0.181465,0.338135,-1.000000,0.533000,0.780210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032892,1.770431,-0.101933,-0.456356,0.415007,-0.787088,-0.889240,-0.181407,0.419933,-1.000000,0.542710,0.781120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041073,1.768230,-0.097896,-0.540723,0.409297,-0.734911,-0.833683,-0.144205,0.533083,-1.000000,0.554620,0.780120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049529,1.764226,-0.093102,-0.653885,0.372564,-0.658506,-0.735981,-0.111442,0.667767,-1.000000,0.568340,0.775910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056359,1.758526,-0.088044,-0.796929,0.311029,-0.517848,-0.572255,-0.114161,0.812091,-1.000000,0.580230,0.768660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061490,1.751405,-0.082264,-0.894504,0.262993,-0.361522,-0.403202,-0.125281,0.906495,-1.000000,0.591290,0.759280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065437,1.743403,-0.076281,-0.941499,0.201701,-0.269993,-0.297027,-0.118107,0.947537,-1.000000,0.601900,0.748270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068188,1.734371,-0.072030,-0.966153,0.103416,-0.236335,-0.246168,-0.095654,0.964495,-1.000000,0.609830,0.734510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069080,1.724232,-0.070597,-0.966723,0.089155,-0.239789,-0.246816,-0.078458,0.965881,-1.000000,0.613670,0.718130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070678,1.725564,-0.063661,-0.968300,0.080021,-0.236626,-0.243843,-0.097331,0.964918,-1.000000,0.621480,0.721480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070237,1.714281,-0.071690,-0.947431,0.198755,-0.250742,-0.272627,-0.091268,0.957781,-1.000000,0.614280,0.701310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072468,1.704626,-0.073703,-0.961387,0.121007,-0.247167,-0.256642,-0.070010,0.963968,-1.000000,0.613880,0.685420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072143,1.694025,-0.075037,-0.960495,-0.140038,-0.240495,-0.240058,-0.020262,0.970547,-1.000000,0.612950,0.668410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068929,1.683280,-0.075315,-0.934451,-0.263969,-0.239003,-0.250595,0.010630,0.968034,-1.000000,0.611410,0.651070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066169,1.672749,-0.074418,-0.936887,-0.237446,-0.256638,-0.267757,0.015254,0.963366,-1.000000,0.611350,0.634270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064190,1.661322,-0.071857,-0.944148,-0.193383,-0.266809,-0.281770,0.053983,0.957962,-1.000000,0.612990,0.615670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062976,1.648947,-0.067948,-0.944128,-0.219621,-0.245740,-0.270878,0.092348,0.958174,-1.000000,0.615260,0.594310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058810,1.636032,-0.070238,-0.918146,-0.320876,-0.232479,-0.292169,0.151900,0.944227,-1.000000,0.607370,0.573370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.055660,1.626676,-0.065449,-0.868244,-0.475170,-0.142709,-0.264888,0.200754,0.943150,-1.000000,0.607130,0.557300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056419,1.633659,-0.076067,-0.896313,-0.338027,-0.286985,-0.362511,0.185883,0.913254,-1.000000,0.598270,0.571380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057843,1.647074,-0.083183,-0.909449,-0.225391,-0.349431,-0.389768,0.169324,0.905213,-1.000000,0.596040,0.593760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.060734,1.647830,-0.075354,-0.933350,-0.216661,-0.286210,-0.311785,0.094153,0.945476,-1.000000,0.606410,0.593690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061717,1.662738,-0.080897,-0.926102,-0.202791,-0.318137,-0.341034,0.089364,0.935794,-1.000000,0.603640,0.618400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058628,1.658547,-0.086935,-0.907464,-0.191892,-0.373748,-0.405393,0.166381,0.898874,-1.000000,0.595280,0.612940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058207,1.667898,-0.092259,-0.870710,-0.207269,-0.445987,-0.486724,0.233250,0.841840,-1.000000,0.591110,0.630210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061317,1.672685,-0.088310,-0.876599,-0.230525,-0.422412,-0.465154,0.180980,0.866532,-1.000000,0.596950,0.635150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057248,1.677648,-0.097871,-0.803027,-0.157952,-0.574629,-0.595802,0.191829,0.779886,-1.000000,0.586400,0.645500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061972,1.685009,-0.093591,-0.806572,-0.145030,-0.573069,-0.584884,0.055176,0.809238,-1.000000,0.592750,0.653540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.053975,1.672640,-0.101068,-0.794147,-0.138316,-0.591776,-0.607723,0.183258,0.772715,-1.000000,0.581790,0.640300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.055361,1.663992,-0.095736,-0.848278,-0.192762,-0.493221,-0.527723,0.230411,0.817569,-1.000000,0.585910,0.625780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054130,1.686324,-0.102602,-0.629416,0.042175,-0.775923,-0.771833,0.081792,0.630543,-1.000000,0.580880,0.656630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058292,1.693468,-0.099224,-0.624681,0.099087,-0.774568,-0.778991,-0.010129,0.626953,-1.000000,0.585570,0.665230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.047495,1.692641,-0.105025,-0.355246,0.304111,-0.883921,-0.915470,0.077988,0.394757,-1.000000,0.573240,0.664380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051064,1.700461,-0.100626,-0.348143,0.370299,-0.861206,-0.922345,0.028903,0.385286,-1.000000,0.576870,0.674800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038831,1.696501,-0.105224,-0.187677,0.465435,-0.864955,-0.951515,0.132346,0.277674,-1.000000,0.562760,0.670740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040641,1.701474,-0.102259,-0.173662,0.418866,-0.891287,-0.969812,0.084589,0.228715,-1.000000,0.564590,0.677800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.030891,1.699589,-0.104285,-0.212558,0.542747,-0.812555,-0.946287,0.093005,0.309664,-1.000000,0.553850,0.676700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032878,1.703272,-0.101979,-0.114831,0.361812,-0.925152,-0.986408,0.068656,0.149285,-1.000000,0.556000,0.682020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.037080,1.692060,-0.108272,-0.246717,0.446359,-0.860171,-0.922394,0.164039,0.349687,-1.000000,0.560830,0.665800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044845,1.687120,-0.107752,-0.395774,0.264904,-0.879312,-0.891919,0.117175,0.436749,-1.000000,0.570550,0.658370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035583,1.688273,-0.110458,-0.281409,0.376480,-0.882650,-0.928946,0.123707,0.348934,-1.000000,0.559090,0.661800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042699,1.682757,-0.109908,-0.410999,0.222637,-0.884032,-0.898647,0.064167,0.433954,-1.000000,0.568370,0.653750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029336,1.696254,-0.107648,-0.290786,0.561130,-0.774969,-0.908702,0.091579,0.407275,-1.000000,0.551920,0.672580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023959,1.703654,-0.103807,-0.420560,0.494316,-0.760777,-0.875109,0.000000,0.483925,-1.000000,0.546040,0.682980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026122,1.706693,-0.101863,-0.238213,0.296636,-0.924804,-0.968180,0.002663,0.250240,-1.000000,0.548650,0.687200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022735,1.701157,-0.107337,-0.500316,0.552126,-0.666964,-0.801599,-0.004184,0.597847,-1.000000,0.543950,0.679240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028299,1.693282,-0.110035,-0.310407,0.470281,-0.826125,-0.926023,0.046758,0.374560,-1.000000,0.550310,0.668920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061249,1.700722,-0.094785,-0.629762,0.221646,-0.744495,-0.773398,-0.089471,0.627575,-1.000000,0.589960,0.675810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057088,1.705430,-0.095225,-0.415143,0.437242,-0.797794,-0.887188,0.000000,0.461407,-1.000000,0.584750,0.682530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064789,1.696839,-0.091844,-0.802119,0.009925,-0.597081,-0.594377,-0.109753,0.796662,-1.000000,0.595010,0.671140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050866,1.680651,-0.105482,-0.637138,0.037459,-0.769839,-0.763866,0.102505,0.637182,-1.000000,0.577170,0.650800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048284,1.676206,-0.107703,-0.617573,0.019402,-0.786274,-0.786174,0.014116,0.617843,-1.000000,0.574530,0.645940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051338,1.668840,-0.103681,-0.763259,-0.148022,-0.628908,-0.644199,0.099877,0.758309,-1.000000,0.578590,0.635970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.052903,1.660821,-0.098523,-0.819718,-0.198286,-0.537350,-0.570616,0.201493,0.796114,-1.000000,0.582210,0.622110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056425,1.655626,-0.090400,-0.872549,-0.197320,-0.446904,-0.484228,0.228232,0.844650,-1.000000,0.590030,0.609490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054195,1.652084,-0.093141,-0.854752,-0.207846,-0.475603,-0.515439,0.232212,0.824864,-1.000000,0.586000,0.605380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054785,1.641675,-0.087001,-0.874518,-0.271115,-0.402139,-0.462861,0.218926,0.858971,-1.000000,0.589360,0.587210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067633,1.694784,-0.087194,-0.880805,-0.075606,-0.467405,-0.463318,-0.065791,0.883746,-1.000000,0.599950,0.668970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065405,1.684508,-0.087151,-0.875573,-0.217064,-0.431573,-0.437792,-0.021148,0.898827,-1.000000,0.599170,0.652740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063654,1.676581,-0.085746,-0.885693,-0.254256,-0.388461,-0.413434,0.051244,0.909091,-1.000000,0.600170,0.640140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064556,1.674046,-0.081157,-0.918434,-0.250134,-0.306450,-0.321723,0.021585,0.946588,-1.000000,0.604610,0.636030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.053608,1.630849,-0.080612,-0.856452,-0.387971,-0.340541,-0.443762,0.216273,0.869656,-1.000000,0.590790,0.568630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050656,1.628305,-0.084245,-0.804297,-0.446059,-0.392604,-0.527510,0.231793,0.817316,-1.000000,0.585030,0.566380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.052242,1.638689,-0.090181,-0.831835,-0.307973,-0.461739,-0.529020,0.188295,0.827455,-1.000000,0.584540,0.583980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051914,1.649408,-0.095801,-0.815142,-0.224640,-0.533929,-0.569523,0.142507,0.809528,-1.000000,0.582350,0.602240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021992,1.698585,-0.109847,-0.505956,0.483025,-0.714629,-0.823723,-0.024772,0.566451,-1.000000,0.542450,0.675660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.017242,1.706074,-0.108736,-0.673210,0.449639,-0.587037,-0.655828,0.003660,0.754902,-1.000000,0.536240,0.685940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018382,1.708441,-0.105588,-0.628907,0.395247,-0.669519,-0.736230,-0.025982,0.676233,-1.000000,0.538450,0.689280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020382,1.710746,-0.102952,-0.472427,0.257348,-0.842962,-0.878619,-0.062012,0.473479,-1.000000,0.541560,0.692760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016737,1.703510,-0.111360,-0.673244,0.436241,-0.597023,-0.660273,0.008767,0.750975,-1.000000,0.534880,0.682310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012680,1.707423,-0.113701,-0.772752,0.368937,-0.516468,-0.532143,0.066915,0.844006,-1.000000,0.528010,0.688340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013059,1.710572,-0.110959,-0.780629,0.324485,-0.534162,-0.542433,0.072798,0.836939,-1.000000,0.529290,0.692370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028702,1.710173,-0.101052,-0.058470,0.075652,-0.995419,-0.998021,-0.027543,0.056530,-1.000000,0.551090,0.692200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035248,1.707857,-0.101070,-0.100407,0.086390,-0.991189,-0.993800,0.039100,0.104080,-1.000000,0.557820,0.688660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031321,1.713191,-0.101808,0.042497,-0.045927,-0.998040,-0.996590,-0.072672,-0.039091,-1.000000,0.552650,0.697150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.037839,1.712043,-0.101512,-0.167232,-0.101962,-0.980631,-0.985917,0.016554,0.166412,-1.000000,0.558820,0.695240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.039651,1.714649,-0.101360,-0.289287,-0.060336,-0.955339,-0.957121,0.034084,0.287675,-1.000000,0.558850,0.700300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.033188,1.715290,-0.101907,0.032103,-0.050526,-0.998207,-0.995510,-0.090594,-0.027431,-1.000000,0.552980,0.701210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045455,1.715275,-0.098408,-0.552123,0.004189,-0.833752,-0.833442,0.024948,0.552043,-1.000000,0.564830,0.700670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044387,1.712121,-0.099269,-0.438901,-0.028370,-0.898088,-0.898318,0.035830,0.437882,-1.000000,0.565390,0.694800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049404,1.716384,-0.094904,-0.625560,-0.015260,-0.780027,-0.779982,0.034500,0.624850,-1.000000,0.570660,0.702450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049441,1.713040,-0.095420,-0.567492,0.092757,-0.818137,-0.820228,0.023153,0.571568,-1.000000,0.572510,0.696330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051929,1.718243,-0.093041,-0.565361,-0.240037,-0.789144,-0.818643,0.046200,0.572442,-1.000000,0.574460,0.704650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.052467,1.714785,-0.092523,-0.579323,0.110561,-0.807565,-0.809761,0.035126,0.585708,-1.000000,0.577560,0.699120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040332,1.717387,-0.101365,-0.355158,-0.188360,-0.915633,-0.934714,0.057825,0.350664,-1.000000,0.558120,0.704130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.034384,1.717387,-0.102316,0.006123,-0.228608,-0.973499,-0.998285,-0.058073,0.007359,-1.000000,0.552780,0.704480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045254,1.718113,-0.098428,-0.572629,-0.140947,-0.807607,-0.816296,0.006858,0.577593,-1.000000,0.563320,0.704560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048743,1.719190,-0.095714,-0.583753,-0.231471,-0.778237,-0.797386,-0.017174,0.603225,-1.000000,0.567900,0.706050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051412,1.720986,-0.095050,-0.452241,-0.478630,-0.752590,-0.849907,-0.024591,0.526359,-1.000000,0.571030,0.708190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.053707,1.710061,-0.093171,-0.399470,0.430872,-0.809180,-0.887218,0.040515,0.459569,-1.000000,0.580550,0.691260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048929,1.707646,-0.096590,-0.354324,0.374507,-0.856854,-0.915871,0.045992,0.398830,-1.000000,0.574040,0.687130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042266,1.707018,-0.099708,-0.267302,0.242825,-0.932516,-0.955741,0.056630,0.288706,-1.000000,0.565250,0.686490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054178,1.720696,-0.093194,-0.570501,-0.454540,-0.684048,-0.772888,0.015409,0.634355,-1.000000,0.576570,0.707760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.053011,1.723655,-0.096666,-0.521818,-0.500257,-0.690977,-0.797881,0.000000,0.602814,-1.000000,0.571700,0.711630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.055660,1.722869,-0.093635,-0.763804,-0.314309,-0.563749,-0.592790,-0.003942,0.805348,-1.000000,0.577710,0.710580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054898,1.725254,-0.095661,-0.787223,-0.145476,-0.599263,-0.612128,0.066636,0.787946,-1.000000,0.574290,0.713440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054541,1.717523,-0.091002,-0.609787,-0.114703,-0.784221,-0.789127,-0.004191,0.614215,-1.000000,0.580650,0.703400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056456,1.722108,-0.091601,-0.794654,-0.239317,-0.557899,-0.561705,-0.058695,0.825253,-1.000000,0.581510,0.709660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057282,1.717491,-0.088738,-0.653533,-0.002519,-0.756894,-0.753408,-0.093747,0.650836,-1.000000,0.587080,0.703610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056118,1.713437,-0.090271,-0.504169,0.297477,-0.810753,-0.848574,0.003750,0.529064,-1.000000,0.584770,0.696970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058999,1.709913,-0.090763,-0.457092,0.466512,-0.757253,-0.859543,-0.012882,0.510900,-1.000000,0.588950,0.690450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059235,1.714628,-0.087840,-0.512190,0.298447,-0.805351,-0.852672,-0.064231,0.518483,-1.000000,0.591080,0.699100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061632,1.713060,-0.087170,-0.566002,0.351240,-0.745837,-0.811625,-0.078735,0.578849,-1.000000,0.594390,0.696440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062238,1.707139,-0.090464,-0.616489,0.380979,-0.689055,-0.771220,-0.115872,0.625935,-1.000000,0.593020,0.685830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064079,1.712345,-0.085495,-0.700231,0.300536,-0.647576,-0.698956,-0.103872,0.707582,-1.000000,0.597840,0.695520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065193,1.705131,-0.088474,-0.766261,0.250853,-0.591538,-0.636190,-0.167194,0.753199,-1.000000,0.596860,0.683710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066586,1.712463,-0.082554,-0.823499,0.249572,-0.509474,-0.544264,-0.094145,0.833615,-1.000000,0.601740,0.696290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067954,1.704148,-0.084942,-0.859390,0.169699,-0.482340,-0.502878,-0.109786,0.857357,-1.000000,0.601010,0.683320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.060665,1.719267,-0.085961,-0.605804,-0.001176,-0.795613,-0.778376,-0.206157,0.592984,-1.000000,0.594290,0.708020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063029,1.719381,-0.084266,-0.739909,0.038342,-0.671614,-0.671847,-0.092612,0.734878,-1.000000,0.597790,0.708960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059078,1.720124,-0.087103,-0.583701,-0.096454,-0.806219,-0.745746,-0.329073,0.579288,-1.000000,0.591450,0.708400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058058,1.722255,-0.088645,-0.748006,-0.233449,-0.621279,-0.543000,-0.322998,0.775128,-1.000000,0.587860,0.710300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059005,1.726487,-0.090498,-0.597761,-0.461149,-0.655762,-0.454866,-0.478471,0.751107,-1.000000,0.586170,0.716720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059914,1.725762,-0.089168,-0.613372,-0.385873,-0.689114,-0.535944,-0.437529,0.722034,-1.000000,0.589210,0.717120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058742,1.729988,-0.093631,-0.618531,-0.413751,-0.668004,-0.612583,-0.278502,0.739715,-1.000000,0.582210,0.722390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.060127,1.730536,-0.092661,-0.725483,-0.295701,-0.621478,-0.585101,-0.210485,0.783168,-1.000000,0.584700,0.724620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061514,1.725748,-0.087796,-0.716445,-0.280344,-0.638838,-0.579651,-0.270354,0.768709,-1.000000,0.592160,0.718620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061725,1.731827,-0.091015,-0.814791,-0.175080,-0.552687,-0.530506,-0.159351,0.832569,-1.000000,0.587380,0.727530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063604,1.726845,-0.085509,-0.843004,-0.152945,-0.515706,-0.502291,-0.119235,0.856438,-1.000000,0.595920,0.721520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063536,1.734031,-0.088583,-0.897349,-0.030202,-0.440288,-0.434129,-0.118986,0.892958,-1.000000,0.590790,0.731830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057602,1.725334,-0.091138,-0.754797,-0.308873,-0.578687,-0.523968,-0.246853,0.815182,-1.000000,0.582890,0.713720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058424,1.727290,-0.091700,-0.607842,-0.482740,-0.630468,-0.501239,-0.382543,0.776157,-1.000000,0.583060,0.716820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056666,1.728327,-0.094195,-0.627677,-0.401630,-0.666870,-0.687230,-0.116543,0.717030,-1.000000,0.578040,0.717590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057749,1.729497,-0.094143,-0.571602,-0.468312,-0.673762,-0.651377,-0.240359,0.719678,-1.000000,0.579630,0.720090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.055510,1.726771,-0.094534,-0.768624,-0.187519,-0.611599,-0.621852,-0.005249,0.783117,-1.000000,0.576550,0.715100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059569,1.737021,-0.094974,-0.782939,0.027934,-0.621471,-0.622074,-0.026245,0.782518,-1.000000,0.581260,0.735110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.060991,1.740321,-0.092554,-0.838699,0.188775,-0.510830,-0.529747,-0.065259,0.845642,-1.000000,0.583830,0.740470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.055263,1.741037,-0.099220,-0.682818,0.174923,-0.709338,-0.719706,0.005907,0.694254,-1.000000,0.574380,0.741500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.053882,1.737417,-0.100631,-0.619095,-0.038676,-0.784363,-0.784895,-0.002231,0.619625,-1.000000,0.572680,0.736340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057833,1.734336,-0.096668,-0.707294,-0.129613,-0.694935,-0.698057,-0.027112,0.715528,-1.000000,0.579080,0.731060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056100,1.744993,-0.096882,-0.705553,0.343925,-0.619605,-0.661640,-0.006534,0.749793,-1.000000,0.576100,0.747770,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.052636,1.735049,-0.100943,-0.532292,-0.226353,-0.815738,-0.820584,-0.098917,0.562901,-1.000000,0.571170,0.732150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056320,1.732738,-0.097360,-0.597854,-0.308111,-0.740026,-0.739451,-0.144448,0.657531,-1.000000,0.577090,0.727650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.055436,1.731868,-0.097562,-0.518085,-0.429124,-0.739893,-0.756729,-0.173248,0.630354,-1.000000,0.574870,0.724060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051861,1.733826,-0.100836,-0.455727,-0.385261,-0.802426,-0.831855,-0.136455,0.537956,-1.000000,0.569380,0.727870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054385,1.730690,-0.097538,-0.496628,-0.443557,-0.746069,-0.812918,-0.063539,0.578902,-1.000000,0.573130,0.721270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050992,1.732700,-0.100670,-0.449447,-0.416163,-0.790447,-0.860690,-0.035186,0.507912,-1.000000,0.567810,0.724600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.052991,1.729126,-0.097428,-0.667455,-0.142063,-0.730973,-0.742012,0.044328,0.668920,-1.000000,0.571690,0.718690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049690,1.730929,-0.100383,-0.633394,-0.066666,-0.770952,-0.773635,0.076901,0.628948,-1.000000,0.566530,0.721900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.052536,1.727019,-0.098536,-0.764356,0.033946,-0.643900,-0.639556,0.087113,0.763793,-1.000000,0.570180,0.715960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049510,1.729010,-0.101530,-0.713728,0.250214,-0.654206,-0.657445,0.082820,0.748937,-1.000000,0.565410,0.719430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049643,1.744390,-0.103223,-0.578418,0.286311,-0.763845,-0.803299,-0.037000,0.594426,-1.000000,0.565390,0.746530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049363,1.748425,-0.100798,-0.583158,0.406034,-0.703607,-0.772437,-0.008972,0.635028,-1.000000,0.566360,0.753660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042365,1.746836,-0.107158,-0.444563,0.346578,-0.825983,-0.889215,-0.059589,0.453592,-1.000000,0.553340,0.750000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042481,1.742840,-0.107694,-0.427239,0.043929,-0.903071,-0.902056,-0.088464,0.422455,-1.000000,0.553290,0.743120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.034498,1.743446,-0.110874,-0.307336,0.045003,-0.950536,-0.949779,-0.076293,0.303479,-1.000000,0.542920,0.743090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.033950,1.747344,-0.110174,-0.318138,0.315028,-0.894173,-0.947905,-0.089535,0.305711,-1.000000,0.542430,0.750120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041498,1.751234,-0.104638,-0.461767,0.385149,-0.799019,-0.876391,-0.059195,0.477948,-1.000000,0.553520,0.757510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032974,1.752694,-0.108009,-0.359372,0.318275,-0.877241,-0.933168,-0.129636,0.335249,-1.000000,0.542300,0.758230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.034997,1.740095,-0.110213,-0.285010,-0.186769,-0.940152,-0.947143,-0.095826,0.306166,-1.000000,0.544010,0.737150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042275,1.739303,-0.107450,-0.396156,-0.134284,-0.908311,-0.900978,-0.133756,0.412732,-1.000000,0.553280,0.737280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048770,1.740281,-0.104129,-0.530966,0.011078,-0.847321,-0.845694,-0.070208,0.529029,-1.000000,0.564400,0.740440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.047987,1.737265,-0.104233,-0.472402,-0.164177,-0.865958,-0.861642,-0.120757,0.492942,-1.000000,0.563530,0.735470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025851,1.746995,-0.112400,-0.279602,0.238598,-0.929996,-0.956784,-0.149873,0.249205,-1.000000,0.533300,0.748280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025206,1.752955,-0.110905,-0.324606,0.252064,-0.911644,-0.940598,-0.187448,0.283087,-1.000000,0.533120,0.756670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026809,1.742849,-0.112936,-0.251778,0.005111,-0.967771,-0.960776,-0.121451,0.249317,-1.000000,0.534330,0.741280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028029,1.739966,-0.111844,-0.228572,-0.277214,-0.933224,-0.958821,-0.101887,0.265106,-1.000000,0.536520,0.735270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035939,1.737298,-0.109394,-0.255400,-0.254970,-0.932610,-0.950651,-0.109531,0.290286,-1.000000,0.545680,0.731300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029627,1.736925,-0.110367,-0.175863,-0.351652,-0.919463,-0.968724,-0.104279,0.225167,-1.000000,0.539730,0.729330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.036764,1.734873,-0.108492,-0.238669,-0.187926,-0.952744,-0.955387,-0.130345,0.265041,-1.000000,0.547290,0.727500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031239,1.734363,-0.109128,-0.101255,-0.312583,-0.944478,-0.977067,-0.147506,0.153566,-1.000000,0.542290,0.725650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.037572,1.732445,-0.108291,-0.219633,0.007914,-0.975551,-0.971666,-0.091288,0.218017,-1.000000,0.548660,0.724710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032663,1.731813,-0.108503,-0.017536,-0.162482,-0.986556,-0.984311,-0.170457,0.045570,-1.000000,0.544400,0.723120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041955,1.734695,-0.106349,-0.424001,-0.162886,-0.890894,-0.897257,-0.058149,0.437662,-1.000000,0.553840,0.728060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042104,1.732455,-0.106402,-0.464841,0.124568,-0.876588,-0.883713,-0.004297,0.468009,-1.000000,0.554430,0.725080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046791,1.734081,-0.103488,-0.472309,-0.297304,-0.829780,-0.866723,-0.014621,0.498575,-1.000000,0.561470,0.727060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046113,1.732061,-0.103397,-0.597357,0.071638,-0.798769,-0.796577,0.062369,0.601311,-1.000000,0.560790,0.724120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042116,1.736700,-0.106960,-0.379942,-0.239669,-0.893422,-0.900028,-0.127169,0.416865,-1.000000,0.553430,0.731870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.047443,1.735461,-0.103899,-0.428439,-0.318762,-0.845477,-0.868318,-0.113570,0.482832,-1.000000,0.562440,0.730640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038328,1.730512,-0.108194,-0.217336,-0.267487,-0.938731,-0.972053,-0.028138,0.233069,-1.000000,0.550210,0.722000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.033903,1.729915,-0.108396,-0.038583,-0.350124,-0.935908,-0.995494,-0.067720,0.066374,-1.000000,0.546330,0.720820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042618,1.730536,-0.106859,-0.432920,-0.054661,-0.899774,-0.900922,-0.007345,0.433919,-1.000000,0.555130,0.722250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046431,1.730068,-0.104413,-0.609053,0.191312,-0.769711,-0.781026,0.024227,0.624028,-1.000000,0.560430,0.721420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049109,1.727844,-0.102340,-0.610051,-0.133857,-0.780974,-0.785921,-0.023206,0.617892,-1.000000,0.564250,0.717850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050873,1.726636,-0.100505,-0.728433,-0.084964,-0.679828,-0.685089,0.099272,0.721664,-1.000000,0.567130,0.715990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050998,1.725249,-0.099414,-0.514093,-0.529382,-0.674880,-0.805105,0.026454,0.592542,-1.000000,0.567950,0.713830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049403,1.724615,-0.099208,-0.240503,-0.675153,-0.697371,-0.906970,-0.099630,0.409243,-1.000000,0.566340,0.712630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050528,1.722942,-0.097101,-0.333247,-0.594440,-0.731838,-0.875195,-0.093677,0.474615,-1.000000,0.568840,0.710330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.047720,1.722128,-0.097717,-0.497557,-0.398509,-0.770472,-0.818273,-0.079135,0.569357,-1.000000,0.565580,0.708960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044577,1.721387,-0.099926,-0.538910,-0.267318,-0.798822,-0.830030,0.006835,0.557676,-1.000000,0.561520,0.707940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040464,1.720567,-0.102206,-0.372801,-0.278953,-0.884988,-0.927756,0.094591,0.361001,-1.000000,0.557020,0.707500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035291,1.719964,-0.103264,-0.048857,-0.326272,-0.944012,-0.998638,-0.001376,0.052159,-1.000000,0.552420,0.707500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.030346,1.720715,-0.102612,0.209668,-0.332763,-0.919406,-0.969199,-0.194979,-0.150454,-1.000000,0.547750,0.707620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028830,1.718988,-0.101520,0.173956,-0.212066,-0.961648,-0.966670,-0.223060,-0.125674,-1.000000,0.547290,0.705090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027351,1.717340,-0.100810,0.044299,-0.009426,-0.998974,-0.974613,-0.220085,-0.041142,-1.000000,0.547070,0.702450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022109,1.720225,-0.101716,-0.203657,-0.143467,-0.968474,-0.962422,-0.152157,0.224925,-1.000000,0.541240,0.704450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020553,1.718524,-0.102129,-0.310791,-0.056260,-0.948812,-0.940759,-0.124184,0.315517,-1.000000,0.540640,0.702020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025389,1.715481,-0.100870,-0.058112,0.002959,-0.998306,-0.983943,-0.169213,0.056775,-1.000000,0.546650,0.699360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023893,1.721336,-0.101155,-0.029532,-0.326005,-0.944907,-0.981151,-0.171155,0.089716,-1.000000,0.542420,0.706270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023026,1.713251,-0.101305,-0.245835,0.100681,-0.964069,-0.966944,-0.094955,0.236651,-1.000000,0.544820,0.696010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018441,1.716850,-0.102994,-0.486853,0.059206,-0.871475,-0.873470,-0.038625,0.485343,-1.000000,0.538700,0.699660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015902,1.715197,-0.104930,-0.673240,0.182585,-0.716527,-0.724086,0.033559,0.688893,-1.000000,0.535210,0.697780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013996,1.713329,-0.107988,-0.768002,0.260402,-0.585118,-0.588585,0.073172,0.805117,-1.000000,0.531560,0.695780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.010264,1.714302,-0.113567,-0.837903,0.222382,-0.498462,-0.485222,0.114730,0.866832,-1.000000,0.523210,0.697850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.010012,1.710487,-0.116202,-0.825515,0.300373,-0.477809,-0.478944,0.075016,0.874634,-1.000000,0.522020,0.693190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007976,1.712797,-0.118437,-0.806663,0.279604,-0.520689,-0.532235,0.039352,0.845682,-1.000000,0.516620,0.696720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008212,1.716854,-0.116156,-0.827480,0.192382,-0.527510,-0.516755,0.106572,0.849475,-1.000000,0.517710,0.701560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008614,1.720991,-0.114413,-0.827320,0.090205,-0.554440,-0.543835,0.118525,0.830780,-1.000000,0.518980,0.706210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011033,1.718628,-0.110884,-0.831081,0.120701,-0.542895,-0.534094,0.098969,0.839612,-1.000000,0.525270,0.702780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009331,1.724667,-0.113328,-0.783977,-0.080267,-0.615579,-0.620644,0.079860,0.780015,-1.000000,0.519990,0.710450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.010608,1.722846,-0.111232,-0.815797,-0.052372,-0.575962,-0.578303,0.062912,0.813393,-1.000000,0.523720,0.707910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.010879,1.727603,-0.112369,-0.651497,-0.295523,-0.698726,-0.736267,0.024222,0.676257,-1.000000,0.521790,0.714040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012081,1.724203,-0.109771,-0.726971,-0.226977,-0.648070,-0.674229,0.057121,0.736310,-1.000000,0.526120,0.709550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013721,1.730496,-0.111699,-0.507296,-0.427652,-0.748174,-0.825621,-0.007634,0.564173,-1.000000,0.525030,0.717940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014382,1.725624,-0.108133,-0.588646,-0.395855,-0.704837,-0.774765,0.027404,0.631656,-1.000000,0.529350,0.711150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006123,1.714418,-0.120075,-0.711570,0.304362,-0.633271,-0.666309,-0.006332,0.745649,-1.000000,0.512090,0.698930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006389,1.718578,-0.118071,-0.732813,0.216559,-0.645049,-0.651792,0.048723,0.756831,-1.000000,0.512890,0.703970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004382,1.715459,-0.121119,-0.553478,0.353796,-0.753983,-0.806828,-0.003177,0.590778,-1.000000,0.508730,0.700230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004681,1.719731,-0.119222,-0.547338,0.268840,-0.792557,-0.819554,0.019698,0.572664,-1.000000,0.509340,0.705300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002796,1.716055,-0.121696,-0.363593,0.408678,-0.837127,-0.899819,0.078495,0.429143,-1.000000,0.506100,0.701070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003056,1.720423,-0.119751,-0.325082,0.319673,-0.890017,-0.925897,0.083933,0.368334,-1.000000,0.506610,0.706200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.001359,1.716350,-0.121976,-0.179767,0.446927,-0.876322,-0.960833,0.111225,0.253829,-1.000000,0.503260,0.701720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.001518,1.720789,-0.119974,-0.150948,0.345063,-0.926362,-0.974617,0.104784,0.197842,-1.000000,0.503610,0.706870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005123,1.724015,-0.117752,-0.523653,0.167030,-0.835397,-0.845190,0.021260,0.534043,-1.000000,0.510240,0.710260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006831,1.722749,-0.116557,-0.727766,0.103728,-0.677936,-0.674209,0.072955,0.734928,-1.000000,0.514020,0.708710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003499,1.724816,-0.118273,-0.299703,0.219117,-0.928529,-0.947652,0.043998,0.316258,-1.000000,0.507350,0.711170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.001829,1.725278,-0.118512,-0.137832,0.238476,-0.961317,-0.985986,0.059062,0.156021,-1.000000,0.504060,0.711850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005906,1.728137,-0.116727,-0.466310,0.037645,-0.883820,-0.884482,-0.002106,0.466570,-1.000000,0.511500,0.714920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007698,1.726647,-0.115534,-0.673367,-0.047108,-0.737806,-0.739295,0.048910,0.671603,-1.000000,0.515410,0.713080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004244,1.729083,-0.117278,-0.269435,0.098062,-0.958013,-0.962952,-0.015731,0.269214,-1.000000,0.508300,0.715960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002359,1.729660,-0.117591,-0.126059,0.124469,-0.984183,-0.991917,-0.001355,0.126878,-1.000000,0.504580,0.716610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007359,1.731997,-0.116144,-0.370653,-0.104973,-0.922820,-0.925210,-0.045201,0.376754,-1.000000,0.513040,0.719690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009265,1.730161,-0.114823,-0.552987,-0.224246,-0.802446,-0.822570,-0.006349,0.568629,-1.000000,0.517040,0.717390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009445,1.736058,-0.116082,-0.258276,-0.161020,-0.952558,-0.953015,-0.119089,0.278531,-1.000000,0.514800,0.725280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011445,1.733648,-0.114715,-0.407712,-0.320465,-0.855028,-0.890996,-0.065208,0.449303,-1.000000,0.518950,0.722260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007228,1.737700,-0.116798,-0.156929,-0.060968,-0.985726,-0.980528,-0.109696,0.162887,-1.000000,0.510830,0.727180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005448,1.733121,-0.116785,-0.214693,-0.031766,-0.976165,-0.974190,-0.064382,0.216354,-1.000000,0.509450,0.720980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004026,1.738572,-0.117269,-0.080255,-0.014531,-0.996668,-0.994180,-0.070931,0.081089,-1.000000,0.505810,0.727960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003060,1.733754,-0.117208,-0.102373,0.006791,-0.994723,-0.993500,-0.050726,0.101901,-1.000000,0.505150,0.721580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011643,1.740339,-0.116269,-0.188241,-0.066806,-0.979848,-0.970238,-0.142091,0.196082,-1.000000,0.516820,0.732130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013665,1.737179,-0.115224,-0.286358,-0.283875,-0.915103,-0.938018,-0.111569,0.328139,-1.000000,0.520810,0.727930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015749,1.734169,-0.112942,-0.347200,-0.454729,-0.820167,-0.910317,-0.046721,0.411267,-1.000000,0.525720,0.723400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014948,1.744265,-0.115778,-0.210670,0.066091,-0.975321,-0.965059,-0.173090,0.196725,-1.000000,0.520200,0.739480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012314,1.749664,-0.115639,-0.194376,0.156981,-0.968284,-0.969579,-0.180463,0.165379,-1.000000,0.516280,0.747550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009155,1.742871,-0.116790,-0.140736,0.043202,-0.989104,-0.982450,-0.129626,0.134127,-1.000000,0.512540,0.735690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016680,1.740492,-0.115234,-0.255238,-0.164632,-0.952759,-0.953930,-0.117851,0.275916,-1.000000,0.523550,0.733570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018735,1.736866,-0.113329,-0.293847,-0.407152,-0.864801,-0.938385,-0.049295,0.342058,-1.000000,0.527840,0.728110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019689,1.746288,-0.114380,-0.264468,0.154571,-0.951927,-0.950870,-0.206521,0.230641,-1.000000,0.525930,0.744900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021157,1.742493,-0.114244,-0.260019,-0.060459,-0.963709,-0.951152,-0.155988,0.266417,-1.000000,0.527930,0.738120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018842,1.752050,-0.113461,-0.283972,0.205204,-0.936617,-0.943794,-0.232150,0.235286,-1.000000,0.524910,0.753380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023022,1.739153,-0.112929,-0.254065,-0.344989,-0.903567,-0.947658,-0.097995,0.303878,-1.000000,0.531230,0.732250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005007,1.744279,-0.117185,-0.086132,0.068438,-0.993930,-0.992740,-0.089969,0.079834,-1.000000,0.506710,0.737150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005860,1.750994,-0.116377,-0.106596,0.150247,-0.982885,-0.991873,-0.085126,0.094558,-1.000000,0.507710,0.748280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025224,1.735806,-0.110674,-0.204103,-0.447015,-0.870930,-0.951979,-0.116758,0.283025,-1.000000,0.535610,0.726470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021261,1.733690,-0.110421,-0.252828,-0.517547,-0.817449,-0.941962,-0.061210,0.330092,-1.000000,0.532990,0.722810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027207,1.732928,-0.108826,-0.093341,-0.433526,-0.896294,-0.965802,-0.179290,0.187300,-1.000000,0.538900,0.723040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023997,1.731125,-0.108194,-0.141675,-0.536755,-0.831759,-0.956547,-0.142081,0.254619,-1.000000,0.536690,0.719920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028866,1.730704,-0.107919,0.054465,-0.328494,-0.942934,-0.980947,-0.193967,0.010913,-1.000000,0.541350,0.720830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026116,1.729390,-0.107025,0.043316,-0.478298,-0.877129,-0.978895,-0.195830,0.058444,-1.000000,0.539360,0.718060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021155,1.728798,-0.106897,-0.205178,-0.597760,-0.774974,-0.943474,-0.089795,0.319051,-1.000000,0.535530,0.716030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023635,1.727656,-0.105696,0.004978,-0.561616,-0.827383,-0.981103,-0.162783,0.104592,-1.000000,0.538360,0.714820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019775,1.725829,-0.104710,-0.255839,-0.529904,-0.808546,-0.935556,-0.074935,0.345138,-1.000000,0.536350,0.711350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021980,1.725454,-0.104224,-0.051092,-0.508112,-0.859774,-0.973217,-0.167882,0.157049,-1.000000,0.538540,0.711250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.017111,1.726072,-0.106251,-0.433134,-0.500088,-0.749871,-0.860067,-0.019529,0.509807,-1.000000,0.533200,0.711670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.017678,1.730629,-0.109595,-0.351379,-0.547322,-0.759586,-0.896878,-0.035976,0.440812,-1.000000,0.530640,0.718290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.030178,1.729149,-0.107757,0.086731,-0.395230,-0.914479,-0.990313,-0.134113,-0.035961,-1.000000,0.543480,0.718950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027406,1.728086,-0.106725,0.143051,-0.461346,-0.875612,-0.978666,-0.197766,-0.055688,-1.000000,0.541530,0.716640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025260,1.726745,-0.105510,0.142886,-0.498951,-0.854770,-0.976516,-0.211773,-0.039621,-1.000000,0.540440,0.714090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021730,1.722500,-0.103005,-0.171398,-0.481725,-0.859397,-0.943171,-0.171840,0.284429,-1.000000,0.539850,0.708150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020279,1.722142,-0.103033,-0.293871,-0.340602,-0.893102,-0.914996,-0.169990,0.365904,-1.000000,0.538380,0.707110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018037,1.721863,-0.103479,-0.449324,-0.260995,-0.854394,-0.875292,-0.062803,0.479499,-1.000000,0.536390,0.706150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015455,1.721044,-0.104877,-0.628659,-0.147960,-0.763476,-0.774499,0.030394,0.631845,-1.000000,0.533540,0.705010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013240,1.719917,-0.107378,-0.770209,0.004210,-0.637778,-0.635486,0.079884,0.767968,-1.000000,0.529890,0.703940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063006,1.648947,-0.067949,0.944129,-0.219621,-0.245737,-0.271010,-0.093051,-0.958068,-1.000000,0.384730,0.594220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.060943,1.638052,-0.063696,0.927389,-0.322414,-0.189731,-0.239669,-0.122639,-0.963077,-1.000000,0.383690,0.575050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045625,1.613946,-0.050986,0.748657,-0.661718,-0.040529,-0.251390,-0.226788,-0.940941,-1.000000,0.388980,0.527430,4,3,2,2,0.878097,0.121903,0.000000,0.000000},
-	{ 0.046637,1.615114,-0.046532,0.788408,-0.615135,-0.004577,-0.105006,-0.127245,-0.986297,-1.000000,0.381360,0.527740,4,3,2,2,0.834349,0.165651,0.000000,0.000000},
-	{ 0.049134,1.618925,-0.040253,0.793307,-0.604812,0.069764,0.092980,0.007113,-0.995643,-1.000000,0.365460,0.533790,4,3,2,2,0.808625,0.191375,0.000000,0.000000},
-	{ 0.041623,1.609851,-0.053170,0.721297,-0.680755,-0.127685,-0.339672,-0.187012,-0.921764,-1.000000,0.397240,0.521030,4,3,2,2,0.842148,0.157852,0.000000,0.000000},
-	{ 0.081319,1.666383,-0.007814,0.694678,-0.380376,-0.610521,-0.401122,0.499684,-0.767735,-1.000000,0.297500,0.641630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.086305,1.667968,-0.002494,0.745250,-0.426866,-0.512238,-0.317847,0.447897,-0.835680,-1.000000,0.291910,0.648820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.088950,1.672131,-0.000567,0.696139,0.025954,-0.717438,-0.635611,0.486872,-0.599128,-1.000000,0.292240,0.655550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.079917,1.670717,-0.010044,0.812631,-0.121406,-0.569992,-0.448344,0.494606,-0.744548,-1.000000,0.303770,0.644810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.092940,1.671773,0.004058,0.814080,-0.373763,-0.444495,-0.272576,0.429931,-0.860733,-1.000000,0.285760,0.658990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.098772,1.682238,0.009984,0.849776,-0.189911,-0.491746,-0.344128,0.506793,-0.790403,-1.000000,0.283750,0.673870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.097315,1.676057,0.009368,0.869192,-0.323029,-0.374376,-0.196876,0.468438,-0.861281,-1.000000,0.281670,0.667390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.106038,1.699394,0.014989,0.930702,-0.176972,-0.320116,-0.215005,0.443327,-0.870192,-1.000000,0.284470,0.692000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.104964,1.712481,0.013375,0.875227,0.107467,-0.471623,-0.483353,0.156724,-0.861283,-1.000000,0.289340,0.705960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.098171,1.716517,0.006272,0.737807,0.044063,-0.673572,-0.667118,-0.104565,-0.737577,-1.000000,0.296430,0.710890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.091277,1.713213,-0.001217,0.761740,-0.127785,-0.635156,-0.647164,-0.196271,-0.736653,-1.000000,0.304690,0.708620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.086873,1.708066,-0.005137,0.852956,-0.275060,-0.443631,-0.496705,-0.166422,-0.851814,-1.000000,0.310850,0.703150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.084932,1.704139,-0.006032,0.900270,-0.421721,-0.108005,-0.148657,-0.064628,-0.986775,-1.000000,0.312450,0.696000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.083673,1.703278,-0.009161,0.901400,-0.179046,-0.394233,-0.395813,0.028362,-0.917893,-1.000000,0.315110,0.694240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.082349,1.698426,-0.006041,0.975380,-0.204005,-0.083760,-0.078973,0.031509,-0.996379,-1.000000,0.312170,0.684760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.080750,1.691598,-0.008752,0.976752,-0.128024,-0.171948,-0.149061,0.170859,-0.973955,-1.000000,0.312640,0.674320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.082231,1.701355,-0.002998,0.914505,-0.373775,-0.154829,-0.180444,-0.034302,-0.982987,-1.000000,0.310460,0.689480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.078717,1.680416,-0.012080,0.943922,-0.130439,-0.303310,-0.233260,0.386691,-0.892222,-1.000000,0.311860,0.656560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081291,1.693114,-0.000603,0.713041,0.225112,-0.664001,-0.694223,0.094150,-0.713575,-1.000000,0.306460,0.677990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081527,1.689066,-0.004180,0.856007,0.110326,-0.505055,-0.516335,0.230643,-0.824743,-1.000000,0.307320,0.671880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081626,1.698200,0.001569,0.690817,0.088141,-0.717638,-0.720798,0.006018,-0.693119,-1.000000,0.306860,0.684590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.079169,1.678231,-0.008348,0.918029,0.033817,-0.395070,-0.369936,0.431687,-0.822674,-1.000000,0.307130,0.656200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.079874,1.673931,-0.007985,0.818385,0.278337,-0.502767,-0.574665,0.392602,-0.718069,-1.000000,0.304220,0.651140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.084240,1.675155,-0.003220,0.653194,0.154264,-0.741310,-0.728073,0.396848,-0.558947,-1.000000,0.298940,0.656060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.080029,1.683786,-0.007109,0.922558,-0.043334,-0.383418,-0.347386,0.339256,-0.874202,-1.000000,0.308180,0.663970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.082981,1.681907,-0.003607,0.676130,0.088481,-0.731451,-0.712293,0.332329,-0.618220,-1.000000,0.303020,0.663630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.094846,1.683051,0.005431,0.581875,0.075141,-0.809799,-0.748596,0.438633,-0.497198,-1.000000,0.290440,0.671250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.088573,1.686695,0.000658,0.497521,0.180010,-0.848569,-0.853795,0.274517,-0.442351,-1.000000,0.299090,0.671940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.103433,1.699452,0.010546,0.591251,-0.031075,-0.805888,-0.756348,0.325471,-0.567456,-1.000000,0.290120,0.690120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.089527,1.701299,0.006696,0.486287,-0.010869,-0.873731,-0.870467,0.081218,-0.485480,-1.000000,0.301850,0.689440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.103899,1.709405,0.011335,0.601274,-0.065666,-0.796340,-0.773722,0.201055,-0.600775,-1.000000,0.292530,0.701670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.097031,1.711000,0.006357,0.533004,-0.215519,-0.818204,-0.837959,0.000000,-0.545734,-1.000000,0.299190,0.703090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.084484,1.704390,0.000092,0.681193,-0.531299,-0.503683,-0.600335,-0.011607,-0.799664,-1.000000,0.308140,0.694250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.089425,1.709031,0.000455,0.658064,-0.484804,-0.576122,-0.710901,-0.147882,-0.687569,-1.000000,0.306200,0.701920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.086788,1.707036,-0.003313,0.795175,-0.586009,-0.155852,-0.339589,-0.217424,-0.915099,-1.000000,0.309780,0.700600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.085330,1.705000,-0.003738,0.777193,-0.629238,0.005600,-0.094400,-0.125387,-0.987606,-1.000000,0.310640,0.696930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.096719,1.716846,0.018273,-0.079183,0.652742,0.753431,0.356092,0.724459,-0.590218,-1.000000,0.280810,0.714380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.098674,1.710458,0.021940,-0.067926,0.227518,0.971402,0.767356,0.634164,-0.094874,-1.000000,0.276180,0.709470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.093788,1.711806,0.018699,-0.430547,0.304417,0.849682,0.568957,0.822343,-0.006322,-1.000000,0.274270,0.716520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.094248,1.716437,0.017062,-0.608250,0.355160,0.709854,0.080550,0.917312,-0.389936,-1.000000,0.280480,0.716690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.088091,1.709738,0.017642,0.211988,0.435895,0.874675,0.901887,0.257438,-0.346878,-1.000000,0.270490,0.718070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.090577,1.718429,0.012744,-0.661377,0.404515,0.631624,-0.036205,0.823905,-0.565570,-1.000000,0.284620,0.720440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058183,1.779675,0.052570,0.693458,0.360767,0.623669,0.498301,0.385062,-0.776804,-1.000000,0.243460,0.844120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.666717,0.053256,0.000001,-0.502487,0.864585,0.978007,0.180330,0.104805,-1.000000,0.128890,0.674760,4,3,2,2,0.866525,0.133475,0.000000,0.000000},
-	{ 0.000000,1.606352,0.047509,0.000003,0.254857,0.966979,0.594773,0.777348,-0.204880,-1.000000,0.130350,0.598430,3,4,2,2,0.921304,0.078696,0.000000,0.000000},
-	{ 0.015944,1.607229,0.044009,0.359273,0.220109,0.906904,0.591834,0.697636,-0.403776,-1.000000,0.156300,0.579120,3,4,2,2,0.935014,0.064986,0.000000,0.000000},
-	{ 0.017536,1.592468,0.048353,0.377569,0.309900,0.872585,0.466752,0.750170,-0.468389,-1.000000,0.148700,0.561030,3,2,2,2,0.891313,0.108687,0.000000,0.000000},
-	{ 0.000000,1.591355,0.052674,0.000004,0.320844,0.947132,0.497742,0.821471,-0.278278,-1.000000,0.122050,0.586010,3,2,2,2,0.845342,0.154658,0.000000,0.000000},
-	{ 0.035250,1.593325,0.035997,0.644634,0.281498,0.710779,0.419769,0.646715,-0.636831,-1.000000,0.195700,0.530310,3,2,2,2,0.946189,0.053811,0.000000,0.000000},
-	{ 0.032701,1.608642,0.034012,0.605616,0.149549,0.781578,0.573779,0.598472,-0.559114,-1.000000,0.199400,0.555840,3,4,2,2,0.941644,0.058355,0.000000,0.000000},
-	{ 0.044753,1.590172,0.023461,0.871897,0.248814,0.421768,0.282599,0.447735,-0.848334,-1.000000,0.236920,0.505330,3,2,2,2,0.938745,0.061255,0.000000,0.000000},
-	{ 0.043186,1.607070,0.022896,0.835683,0.061523,0.545755,0.471339,0.429727,-0.770178,-1.000000,0.237980,0.535810,3,4,2,2,0.942599,0.057401,0.000000,0.000000},
-	{ 0.049046,1.583490,0.011384,0.964694,0.241797,0.104401,0.049238,0.223835,-0.973382,-1.000000,0.267670,0.485360,3,2,2,2,0.921020,0.078980,0.000000,0.000000},
-	{ 0.047992,1.601157,0.011126,0.967917,0.009030,0.251108,0.242663,0.225732,-0.943483,-1.000000,0.265230,0.517360,3,4,2,2,0.919075,0.080925,0.000000,0.000000},
-	{ 0.050963,1.575290,-0.000435,0.963075,0.232816,-0.135216,-0.166871,0.122047,-0.978396,-1.000000,0.298310,0.466190,3,2,2,2,0.912945,0.087055,0.000000,0.000000},
-	{ 0.049504,1.592290,-0.001503,0.999706,0.009964,0.022094,0.020789,0.116118,-0.993018,-1.000000,0.293110,0.497270,3,4,2,2,0.943333,0.056667,0.000000,0.000000},
-	{ 0.000000,1.580366,0.056576,0.000001,0.400048,0.916494,0.432902,0.826165,-0.360620,-1.000000,0.112550,0.576420,3,2,2,2,0.681759,0.318241,0.000000,0.000000},
-	{ 0.020450,1.580799,0.051626,0.365516,0.427134,0.827015,0.346973,0.761932,-0.546872,-1.000000,0.140680,0.546180,3,2,2,2,0.771472,0.228528,0.000000,0.000000},
-	{ 0.039609,1.580212,0.039052,0.604903,0.498202,0.621198,0.236792,0.632278,-0.737668,-1.000000,0.192650,0.507190,3,2,2,2,0.838090,0.161910,0.000000,0.000000},
-	{ 0.050794,1.575343,0.025500,0.780097,0.579894,0.234885,0.025826,0.345256,-0.938153,-1.000000,0.236200,0.476490,3,2,2,2,0.812285,0.187715,0.000000,0.000000},
-	{ 0.056177,1.567862,0.012845,0.806643,0.573652,-0.142304,-0.228255,0.080265,-0.970287,-1.000000,0.270280,0.455520,3,2,2,2,0.744020,0.255980,0.000000,0.000000},
-	{ 0.057955,1.559611,0.001113,0.773831,0.496408,-0.393401,-0.445114,-0.015679,-0.895336,-1.000000,0.300910,0.437740,3,2,2,2,0.749033,0.250967,0.000000,0.000000},
-	{ 0.070037,1.545483,0.000640,0.517785,0.617477,-0.592133,-0.625511,-0.198940,-0.754426,-1.000000,0.297110,0.409490,2,3,2,2,0.660874,0.339126,0.000000,0.000000},
-	{ 0.065660,1.536072,-0.010712,0.492063,0.496701,-0.714956,-0.780385,-0.112322,-0.615128,-1.000000,0.324850,0.395310,2,3,2,2,0.706194,0.293806,0.000000,0.000000},
-	{ 0.084648,1.531922,-0.003046,0.337293,0.651080,-0.679947,-0.711987,-0.296096,-0.636712,-1.000000,0.292080,0.379720,2,3,2,2,0.913706,0.086294,0.000000,0.000000},
-	{ 0.069749,1.555080,0.013874,0.551391,0.751859,-0.361492,-0.413158,-0.130337,-0.901284,-1.000000,0.269200,0.425080,2,3,2,2,0.618852,0.381148,0.000000,0.000000},
-	{ 0.087864,1.543773,0.011813,0.376146,0.779035,-0.501616,-0.524647,-0.267152,-0.808317,-1.000000,0.263290,0.394140,2,3,2,2,0.874981,0.125019,0.000000,0.000000},
-	{ 0.063118,1.563682,0.028279,0.567222,0.822336,0.044967,-0.180703,0.177542,-0.967381,-1.000000,0.233900,0.447090,2,3,2,2,0.544099,0.455901,0.000000,0.000000},
-	{ 0.081865,1.554036,0.029950,0.426274,0.904184,-0.027253,-0.285940,0.106100,-0.952356,-1.000000,0.228160,0.415050,2,3,2,2,0.834963,0.165037,0.000000,0.000000},
-	{ 0.047984,1.569338,0.042791,0.475127,0.730817,0.490063,0.025764,0.545149,-0.837943,-1.000000,0.191720,0.482630,3,2,2,2,0.546229,0.453771,0.000000,0.000000},
-	{ 0.061759,1.559816,0.047687,0.360339,0.834532,0.416788,-0.122318,0.485217,-0.865796,-1.000000,0.188900,0.454990,2,3,2,2,0.767339,0.232661,0.000000,0.000000},
-	{ 0.024763,1.571072,0.055626,0.305035,0.607743,0.733213,0.219306,0.704388,-0.675087,-1.000000,0.133840,0.532920,3,2,2,2,0.514469,0.485531,0.000000,0.000000},
-	{ 0.030926,1.562027,0.061582,0.245435,0.724240,0.644390,0.133097,0.633252,-0.762415,-1.000000,0.126570,0.518930,2,3,2,2,0.765375,0.234625,0.000000,0.000000},
-	{ 0.000000,1.562969,0.067914,-0.000000,0.674546,0.738233,0.344036,0.693169,-0.633369,-1.000000,0.092130,0.562940,2,3,2,2,0.780505,0.219494,0.000000,0.000000},
-	{ 0.000000,1.571398,0.061231,-0.000000,0.562504,0.826794,0.379652,0.764892,-0.520389,-1.000000,0.103200,0.569590,2,3,2,2,0.569122,0.430878,0.000000,0.000000},
-	{ 0.076464,1.520736,-0.014420,0.318042,0.627974,-0.710280,-0.820343,-0.193289,-0.538216,-1.000000,0.321730,0.365960,2,3,2,2,0.974344,0.025656,0.000000,0.000000},
-	{ 0.058156,1.527493,-0.020767,0.470225,0.459798,-0.753309,-0.846323,-0.007104,-0.532622,-1.000000,0.355550,0.381130,2,3,2,2,0.738342,0.261658,0.000000,0.000000},
-	{ 0.066689,1.512579,-0.025673,0.301174,0.655610,-0.692437,-0.872885,-0.102784,-0.476977,-1.000000,0.352400,0.353030,2,3,2,2,0.984365,0.015635,0.000000,0.000000},
-	{ 0.049102,1.520343,-0.030030,0.419567,0.482630,-0.768787,-0.886687,0.036627,-0.460917,-1.000000,0.389430,0.368160,2,3,2,2,0.732128,0.267872,0.000000,0.000000},
-	{ 0.056183,1.506539,-0.037334,0.274146,0.656149,-0.703073,-0.914695,-0.047833,-0.401304,-1.000000,0.386960,0.339810,2,3,2,2,0.920392,0.079608,0.000000,0.000000},
-	{ 0.039487,1.514697,-0.038287,0.320814,0.505870,-0.800733,-0.928334,0.000000,-0.371746,-1.000000,0.419780,0.356760,2,3,2,2,0.733705,0.266295,0.000000,0.000000},
-	{ 0.045277,1.501082,-0.046665,0.220923,0.618496,-0.754093,-0.945090,-0.055160,-0.322120,-1.000000,0.417060,0.327950,2,3,2,2,0.902156,0.097844,0.000000,0.000000},
-	{ 0.029562,1.510024,-0.044512,0.158496,0.517267,-0.841019,-0.968151,-0.085778,-0.235213,-1.000000,0.443260,0.348320,2,3,2,2,0.735353,0.264647,0.000000,0.000000},
-	{ 0.034158,1.496275,-0.053404,0.135118,0.583460,-0.800823,-0.966381,-0.100833,-0.236516,-1.000000,0.440720,0.319460,2,3,2,2,0.889296,0.110704,0.000000,0.000000},
-	{ 0.019477,1.505953,-0.047685,-0.065398,0.529052,-0.846066,-0.985922,-0.165016,-0.026977,-1.000000,0.462590,0.343280,2,3,2,2,0.776841,0.223159,0.000000,0.000000},
-	{ 0.023063,1.492201,-0.057624,0.000785,0.575919,-0.817506,-0.984495,-0.142953,-0.101654,-1.000000,0.460460,0.313890,2,3,2,2,0.913386,0.086614,0.000000,0.000000},
-	{ 0.009492,1.502288,-0.047325,-0.165920,0.559049,-0.812364,-0.983663,-0.152172,0.096185,-1.000000,0.481000,0.340390,2,3,2,2,0.840162,0.159838,0.000000,0.000000},
-	{ 0.011644,1.488747,-0.059219,-0.074240,0.603396,-0.793979,-0.992754,-0.120151,0.001516,-1.000000,0.479830,0.310370,2,3,2,2,0.932464,0.067536,0.000000,0.000000},
-	{ 0.000000,1.487198,-0.059209,0.000060,0.628290,-0.777979,-1.000000,0.000000,0.000000,-1.000000,0.500120,0.309160,2,3,2,2,0.973714,0.026286,0.000000,0.000000},
-	{ 0.000000,1.500546,-0.046310,0.000115,0.592580,-0.805512,-1.000000,0.000000,0.000000,-1.000000,0.500160,0.339500,2,3,2,2,0.894303,0.105697,0.000000,0.000000},
-	{ 0.027930,1.478223,-0.066555,0.096580,0.478494,-0.872763,-0.978517,-0.114821,-0.171233,-1.000000,0.454900,0.284030,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.039329,1.482522,-0.062157,0.228059,0.461402,-0.857378,-0.955233,-0.064421,-0.288756,-1.000000,0.436150,0.289970,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.052597,1.488324,-0.055788,0.261303,0.493829,-0.829370,-0.946161,-0.039026,-0.321336,-1.000000,0.410860,0.299210,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064665,1.494424,-0.047548,0.327202,0.541084,-0.774705,-0.903642,-0.060594,-0.423981,-1.000000,0.382860,0.310080,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.077672,1.501870,-0.036214,0.325710,0.589544,-0.739155,-0.867525,-0.124485,-0.481564,-1.000000,0.347300,0.322410,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.088427,1.508351,-0.024253,0.302310,0.639822,-0.706567,-0.823082,-0.198651,-0.532047,-1.000000,0.318520,0.331950,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.100319,1.516781,-0.009498,0.257458,0.638913,-0.724918,-0.766694,-0.321542,-0.555690,-1.000000,0.287270,0.343050,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.108465,1.531663,0.007227,0.275507,0.750508,-0.600694,-0.628879,-0.331895,-0.703105,-1.000000,0.252700,0.360120,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.106316,1.544371,0.028407,0.355743,0.928901,-0.102910,-0.330337,0.021970,-0.943607,-1.000000,0.217790,0.381100,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.083428,1.548100,0.054797,0.318124,0.871099,0.374144,-0.157248,0.437662,-0.885282,-1.000000,0.179010,0.421050,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.037413,1.552074,0.070696,0.201527,0.759115,0.618975,0.148675,0.600911,-0.785367,-1.000000,0.115470,0.505020,2,3,2,2,0.923933,0.076067,0.000000,0.000000},
-	{ 0.000000,1.553069,0.076916,0.000001,0.710104,0.704097,0.331299,0.664334,-0.670001,-1.000000,0.078550,0.555730,2,3,2,2,0.907943,0.092057,0.000000,0.000000},
-	{ 0.000000,1.539958,0.089390,0.000001,0.665379,0.746505,0.385049,0.688947,-0.614076,-1.000000,0.057190,0.546180,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040957,1.539688,0.083753,0.159843,0.707489,0.688411,0.329592,0.619108,-0.712793,-1.000000,0.092240,0.492130,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.083467,1.537999,0.072241,0.229852,0.768307,0.597388,0.104967,0.590671,-0.800056,-1.000000,0.136010,0.425150,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.119181,1.536068,0.053529,0.293940,0.911315,0.288277,-0.080294,0.324077,-0.942617,-1.000000,0.166840,0.368020,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.130909,1.534714,0.025800,0.265944,0.942316,-0.203259,-0.406669,-0.081502,-0.909933,-1.000000,0.204400,0.347830,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.131245,1.520384,0.001806,0.203057,0.714378,-0.669651,-0.705142,-0.367819,-0.606205,-1.000000,0.237370,0.322550,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.117676,1.495371,-0.021254,0.327645,0.490353,-0.807590,-0.814246,-0.287007,-0.504610,-1.000000,0.281310,0.294940,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.522352,0.102792,0.000002,0.580406,0.814327,0.404689,0.744665,-0.530755,-1.000000,0.027330,0.532850,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.043548,1.522983,0.097788,0.132916,0.620441,0.772907,0.375019,0.690366,-0.618673,-1.000000,0.062140,0.474210,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.088799,1.523558,0.086577,0.207853,0.698920,0.684330,0.193171,0.656502,-0.729171,-1.000000,0.101520,0.406510,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.122062,1.525836,0.071784,0.250859,0.777256,0.577013,0.111672,0.568857,-0.814820,-1.000000,0.131750,0.363590,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.141799,1.533184,0.048138,0.193776,0.978948,0.064115,-0.181046,0.099915,-0.978386,-1.000000,0.167380,0.341950,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.143496,1.530854,0.024988,0.159836,0.959427,-0.232276,-0.439795,-0.141447,-0.886890,-1.000000,0.196540,0.331070,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.143356,1.522373,0.005617,0.118739,0.862282,-0.492312,-0.660074,-0.301849,-0.687888,-1.000000,0.220240,0.314450,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.140862,1.512413,-0.005606,0.151902,0.559015,-0.815124,-0.780739,-0.437863,-0.445782,-1.000000,0.235750,0.301980,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.134349,1.489483,-0.018011,0.343046,0.395263,-0.852107,-0.828180,-0.300763,-0.472927,-1.000000,0.259780,0.278100,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.508610,0.110208,0.000005,0.518901,0.854835,0.414033,0.778122,-0.472337,-1.000000,0.005490,0.523040,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044860,1.509586,0.106735,0.118846,0.571815,0.811729,0.394554,0.723009,-0.567084,-1.000000,0.040490,0.462660,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.095415,1.510506,0.097096,0.200370,0.657742,0.726104,0.104533,0.722550,-0.683369,-1.000000,0.077590,0.395350,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.120899,1.510306,0.088764,0.241427,0.696353,0.675874,0.130387,0.666884,-0.733665,-1.000000,0.094840,0.360460,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.132268,1.454623,-0.029006,0.519184,0.268770,-0.811302,-0.817419,-0.121016,-0.563189,-1.000000,0.274140,0.231670,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.110839,1.455171,-0.042570,0.497348,0.322379,-0.805429,-0.830355,-0.092043,-0.549581,-1.000000,0.307010,0.236970,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.133249,1.415560,-0.036691,0.643269,0.201278,-0.738710,-0.749336,-0.032545,-0.661389,-1.000000,0.277130,0.173280,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.114495,1.410953,-0.055558,0.588223,0.229768,-0.775371,-0.798197,0.010941,-0.602297,-1.000000,0.307250,0.166570,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.135085,1.382267,-0.040628,0.736979,0.121594,-0.664888,-0.672501,0.033160,-0.739353,-1.000000,0.276660,0.121530,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.119161,1.377817,-0.060402,0.637682,0.101604,-0.763569,-0.769997,0.056277,-0.635561,-1.000000,0.305860,0.112500,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.135729,1.366264,-0.039755,0.785173,0.019855,-0.618958,-0.619153,0.045122,-0.783973,-1.000000,0.276270,0.096780,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.122948,1.360316,-0.056727,0.669664,-0.040363,-0.741566,-0.738672,0.067192,-0.670708,-1.000000,0.305060,0.087090,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.085144,1.365151,-0.086833,0.419789,0.047852,-0.906360,-0.906394,0.074027,-0.415896,-1.000000,0.368860,0.087280,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.085568,1.342221,-0.083875,0.414097,-0.123128,-0.901866,-0.895669,0.121412,-0.427827,-1.000000,0.367350,0.059440,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.042586,1.351304,-0.098123,0.141538,-0.012853,-0.989849,-0.988430,0.053244,-0.142027,-1.000000,0.432020,0.063150,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.081219,1.400842,-0.082077,0.398703,0.225653,-0.888885,-0.914919,0.031364,-0.402418,-1.000000,0.371840,0.145700,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040418,1.389942,-0.095306,0.132924,0.171991,-0.976089,-0.990605,-0.008879,-0.136465,-1.000000,0.435260,0.126740,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.076203,1.438802,-0.071194,0.387933,0.335003,-0.858651,-0.911606,0.002046,-0.411059,-1.000000,0.377370,0.211120,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.035639,1.432360,-0.084420,0.156265,0.293913,-0.942972,-0.984640,-0.028925,-0.172185,-1.000000,0.441890,0.199200,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.384187,-0.096021,0.000001,0.136016,-0.990707,-1.000000,0.000000,0.000000,-1.000000,0.500180,0.118570,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.421713,-0.088573,0.000002,0.239799,-0.970823,-1.000000,0.000000,0.000000,-1.000000,0.500160,0.184670,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.345312,-0.098121,-0.000008,-0.028197,-0.999602,-1.000000,0.000000,0.000000,-1.000000,0.500190,0.052900,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.044010,1.325742,-0.092603,0.155903,-0.142615,-0.977423,-0.981962,0.084795,-0.168999,-1.000000,0.430410,0.031760,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.317022,-0.096336,-0.000013,-0.132740,-0.991151,-1.000000,0.000000,0.000000,-1.000000,0.500200,0.019990,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.450135,-0.080348,-0.000001,0.311855,-0.950130,-1.000000,0.000000,0.000000,-1.000000,0.500140,0.235380,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.020298,1.454425,-0.078153,0.067514,0.336206,-0.939366,-0.992269,-0.075646,-0.098390,-1.000000,0.466120,0.241120,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.039192,1.463635,-0.070891,0.241896,0.394519,-0.886477,-0.961416,-0.025908,-0.273875,-1.000000,0.437270,0.255660,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066537,1.472418,-0.057129,0.362602,0.408310,-0.837737,-0.911867,-0.030139,-0.409378,-1.000000,0.388320,0.271970,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.093080,1.486573,-0.037564,0.409056,0.443622,-0.797416,-0.847807,-0.138431,-0.511918,-1.000000,0.328010,0.291010,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.014898,1.473299,-0.070290,0.042253,0.463312,-0.885187,-0.990967,-0.093433,-0.096205,-1.000000,0.475740,0.277770,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.471345,-0.071698,0.000006,0.463388,-0.886156,-1.000000,0.000000,0.000000,-1.000000,0.500130,0.275710,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014870,1.473299,-0.070290,-0.042295,0.463277,-0.885204,-0.991029,0.092975,0.096010,-1.000000,0.524510,0.277790,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011618,1.488748,-0.059221,0.074349,0.603330,-0.794018,-0.992807,0.119707,-0.002004,-1.000000,0.520400,0.310380,2,3,2,2,0.932467,0.067533,0.000000,0.000000},
-	{ -0.009469,1.502290,-0.047328,0.166196,0.558992,-0.812347,-0.983674,0.151645,-0.096897,-1.000000,0.519210,0.340400,2,3,2,2,0.840245,0.159755,0.000000,0.000000},
-	{ -0.023035,1.492201,-0.057625,-0.000860,0.575900,-0.817519,-0.984592,0.142470,0.101399,-1.000000,0.539770,0.313920,2,3,2,2,0.913364,0.086636,0.000000,0.000000},
-	{ -0.019451,1.505954,-0.047687,0.065299,0.529055,-0.846071,-0.986010,0.164520,0.026776,-1.000000,0.537620,0.343310,2,3,2,2,0.776827,0.223173,0.000000,0.000000},
-	{ -0.034129,1.496275,-0.053404,-0.135159,0.583457,-0.800818,-0.966473,0.100451,0.236304,-1.000000,0.559500,0.319490,2,3,2,2,0.889191,0.110809,0.000000,0.000000},
-	{ -0.029534,1.510024,-0.044512,-0.158580,0.517267,-0.841004,-0.968276,0.085125,0.234936,-1.000000,0.556940,0.348350,2,3,2,2,0.735190,0.264810,0.000000,0.000000},
-	{ -0.045248,1.501082,-0.046665,-0.220935,0.618497,-0.754088,-0.945316,0.054408,0.321587,-1.000000,0.583160,0.328000,2,3,2,2,0.902050,0.097950,0.000000,0.000000},
-	{ -0.039458,1.514697,-0.038286,-0.320836,0.505872,-0.800723,-0.928512,-0.001168,0.371301,-1.000000,0.580410,0.356820,2,3,2,2,0.733492,0.266508,0.000000,0.000000},
-	{ -0.056154,1.506539,-0.037334,-0.274146,0.656145,-0.703077,-0.914955,0.047176,0.400788,-1.000000,0.613250,0.339890,2,3,2,2,0.920295,0.079705,0.000000,0.000000},
-	{ -0.049072,1.520343,-0.030029,-0.419570,0.482635,-0.768781,-0.886875,-0.037487,0.460486,-1.000000,0.610750,0.368230,2,3,2,2,0.731831,0.268169,0.000000,0.000000},
-	{ -0.066660,1.512579,-0.025673,-0.301164,0.655610,-0.692442,-0.873266,0.102055,0.476437,-1.000000,0.647800,0.353130,2,3,2,2,0.984349,0.015651,0.000000,0.000000},
-	{ -0.058127,1.527493,-0.020767,-0.470217,0.459804,-0.753310,-0.846626,0.006045,0.532155,-1.000000,0.644630,0.381230,2,3,2,2,0.738064,0.261936,0.000000,0.000000},
-	{ -0.076434,1.520736,-0.014420,-0.318037,0.627979,-0.710278,-0.820713,0.192704,0.537861,-1.000000,0.678460,0.366090,2,3,2,2,0.974317,0.025683,0.000000,0.000000},
-	{ -0.065631,1.536072,-0.010712,-0.492056,0.496704,-0.714959,-0.780765,0.111486,0.614798,-1.000000,0.675300,0.395440,2,3,2,2,0.705922,0.294078,0.000000,0.000000},
-	{ -0.084618,1.531922,-0.003046,-0.337289,0.651082,-0.679948,-0.712540,0.295471,0.636383,-1.000000,0.708100,0.379860,2,3,2,2,0.913611,0.086389,0.000000,0.000000},
-	{ -0.070007,1.545483,0.000640,-0.517778,0.617475,-0.592141,-0.626086,0.198204,0.754143,-1.000000,0.703040,0.409640,2,3,2,2,0.660552,0.339448,0.000000,0.000000},
-	{ -0.069720,1.555080,0.013874,-0.551388,0.751862,-0.361490,-0.414036,0.129552,0.900994,-1.000000,0.730930,0.425250,2,3,2,2,0.618515,0.381485,0.000000,0.000000},
-	{ -0.087835,1.543774,0.011813,-0.376140,0.779036,-0.501619,-0.525679,0.266391,0.807897,-1.000000,0.736870,0.394320,2,3,2,2,0.874836,0.125164,0.000000,0.000000},
-	{ -0.063088,1.563682,0.028279,-0.567220,0.822338,0.044968,-0.181773,-0.178261,0.967048,-1.000000,0.766190,0.447290,2,3,2,2,0.543767,0.456233,0.000000,0.000000},
-	{ -0.081836,1.554036,0.029950,-0.426269,0.904186,-0.027255,-0.287281,-0.106743,0.951880,-1.000000,0.771980,0.415260,2,3,2,2,0.834805,0.165195,0.000000,0.000000},
-	{ -0.047954,1.569338,0.042791,-0.475127,0.730816,0.490063,0.024673,-0.545658,0.837644,-1.000000,0.808330,0.482880,3,2,2,2,0.546590,0.453410,0.000000,0.000000},
-	{ -0.061729,1.559816,0.047688,-0.360340,0.834533,0.416785,-0.123586,-0.485572,0.865417,-1.000000,0.811180,0.455250,2,3,2,2,0.767151,0.232849,0.000000,0.000000},
-	{ -0.024733,1.571072,0.055626,-0.305184,0.607767,0.733131,0.217689,-0.704950,0.675024,-1.000000,0.866130,0.533210,3,2,2,2,0.514637,0.485363,0.000000,0.000000},
-	{ -0.030897,1.562027,0.061582,-0.245526,0.724252,0.644341,0.131389,-0.633691,0.762347,-1.000000,0.873430,0.519240,2,3,2,2,0.765289,0.234711,0.000000,0.000000},
-	{ 0.000000,1.562969,0.067914,-0.000000,0.674546,0.738233,0.341828,-0.693764,0.633913,-1.000000,0.907800,0.563300,2,3,2,2,0.780505,0.219494,0.000000,0.000000},
-	{ 0.000000,1.571398,0.061231,-0.000000,0.562504,0.826794,0.377605,-0.765584,0.520860,-1.000000,0.896720,0.569920,2,3,2,2,0.569122,0.430878,0.000000,0.000000},
-	{ -0.037384,1.552074,0.070696,-0.201589,0.759131,0.618936,0.146808,-0.601353,0.785380,-1.000000,0.884540,0.505350,2,3,2,2,0.923891,0.076109,0.000000,0.000000},
-	{ 0.000000,1.553069,0.076916,0.000001,0.710104,0.704097,0.329172,-0.664858,0.670529,-1.000000,0.921380,0.556130,2,3,2,2,0.907943,0.092057,0.000000,0.000000},
-	{ -0.083398,1.548100,0.054797,-0.318123,0.871100,0.374142,-0.158818,-0.438034,0.884818,-1.000000,0.821130,0.421320,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.106286,1.544371,0.028407,-0.355742,0.928901,-0.102907,-0.331793,-0.022589,0.943082,-1.000000,0.782400,0.381320,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.108436,1.531663,0.007227,-0.275507,0.750509,-0.600693,-0.629797,0.331173,0.702624,-1.000000,0.747500,0.360300,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.100290,1.516782,-0.009498,-0.257459,0.638913,-0.724917,-0.767126,0.321028,0.555390,-1.000000,0.712940,0.343200,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.539958,0.089390,0.000001,0.665379,0.746505,0.383088,-0.689556,0.614619,-1.000000,0.942750,0.546620,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040928,1.539688,0.083753,-0.159895,0.707501,0.688386,0.327532,-0.619828,0.713117,-1.000000,0.907800,0.492510,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.083437,1.537999,0.072241,-0.229853,0.768305,0.597390,0.103431,-0.591064,0.799966,-1.000000,0.864140,0.425480,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.119152,1.536068,0.053529,-0.293938,0.911315,0.288279,-0.082073,-0.324553,0.942300,-1.000000,0.833370,0.368310,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.130880,1.534714,0.025800,-0.265945,0.942317,-0.203254,-0.408116,0.080959,0.909333,-1.000000,0.795830,0.348070,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.131215,1.520384,0.001805,-0.203060,0.714377,-0.669651,-0.706043,0.367027,0.605635,-1.000000,0.762880,0.322740,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.117646,1.495371,-0.021255,-0.327644,0.490352,-0.807592,-0.814602,0.286395,0.504382,-1.000000,0.718950,0.295090,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.522352,0.102792,0.000002,0.580406,0.814327,0.402789,-0.745349,0.531241,-1.000000,0.972640,0.533350,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043519,1.522983,0.097788,-0.132967,0.620442,0.772898,0.373201,-0.691084,0.618970,-1.000000,0.937930,0.474660,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.088769,1.523558,0.086577,-0.207863,0.698895,0.684352,0.191439,-0.657036,0.729146,-1.000000,0.898660,0.406880,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.122032,1.525836,0.071784,-0.250856,0.777240,0.577035,0.110185,-0.569296,0.814716,-1.000000,0.868470,0.363930,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.141771,1.533184,0.048138,-0.193770,0.978950,0.064114,-0.182880,-0.100251,0.978011,-1.000000,0.832860,0.342240,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.143466,1.530854,0.024988,-0.159839,0.959428,-0.232272,-0.441001,0.141109,0.886344,-1.000000,0.803710,0.331320,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.143326,1.522373,0.005617,-0.118748,0.862278,-0.492317,-0.661371,0.301136,0.686954,-1.000000,0.780020,0.314670,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.140832,1.512413,-0.005606,-0.151897,0.559020,-0.815122,-0.781409,0.437085,0.445373,-1.000000,0.764510,0.302170,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.134319,1.489483,-0.018012,-0.343045,0.395260,-0.852109,-0.828507,0.300125,0.472760,-1.000000,0.740490,0.278260,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.508610,0.110208,0.000005,0.518901,0.854835,0.412114,-0.778868,0.472786,-1.000000,0.994490,0.523580,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044830,1.509587,0.106735,-0.118900,0.571810,0.811724,0.393074,-0.723625,0.567327,-1.000000,0.959600,0.463140,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.095385,1.510504,0.097094,-0.200384,0.657688,0.726149,0.102264,-0.723092,0.683140,-1.000000,0.922610,0.395770,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.120870,1.510306,0.088764,-0.241414,0.696296,0.675937,0.128835,-0.667377,0.733491,-1.000000,0.905390,0.360840,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.132238,1.454623,-0.029006,-0.519183,0.268766,-0.811304,-0.817566,0.120458,0.563095,-1.000000,0.726160,0.231810,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.110810,1.455171,-0.042570,-0.497349,0.322375,-0.805431,-0.830512,0.091456,0.549441,-1.000000,0.693290,0.237090,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.133219,1.415560,-0.036691,-0.643264,0.201275,-0.738715,-0.749416,0.032075,0.661322,-1.000000,0.723190,0.173410,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.114465,1.410953,-0.055558,-0.588223,0.229763,-0.775373,-0.798256,-0.011376,0.602211,-1.000000,0.693080,0.166680,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.135055,1.382267,-0.040628,-0.736970,0.121588,-0.664900,-0.672532,-0.033452,0.739312,-1.000000,0.723680,0.121650,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.119131,1.377817,-0.060401,-0.637684,0.101599,-0.763568,-0.770003,-0.056660,0.635519,-1.000000,0.694490,0.112610,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.135699,1.366264,-0.039755,-0.785164,0.019842,-0.618971,-0.619161,-0.045456,0.783948,-1.000000,0.724080,0.096900,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.122919,1.360316,-0.056727,-0.669668,-0.040369,-0.741562,-0.738633,-0.067649,0.670705,-1.000000,0.695300,0.087190,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.085115,1.365151,-0.086833,-0.419794,0.047842,-0.906358,-0.906368,-0.074526,0.415865,-1.000000,0.631500,0.087350,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.085539,1.342221,-0.083875,-0.414094,-0.123156,-0.901864,-0.895581,-0.121939,0.427861,-1.000000,0.633020,0.059510,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042557,1.351304,-0.098123,-0.141595,-0.012868,-0.989841,-0.988390,-0.053818,0.142087,-1.000000,0.568350,0.063190,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081189,1.400842,-0.082077,-0.398708,0.225649,-0.888884,-0.914948,-0.031859,0.402311,-1.000000,0.628500,0.145780,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040388,1.389942,-0.095306,-0.132973,0.171998,-0.976081,-0.990616,0.008334,0.136422,-1.000000,0.565090,0.126780,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.076174,1.438803,-0.071193,-0.387934,0.335001,-0.858651,-0.911682,-0.002578,0.410888,-1.000000,0.622930,0.211200,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035610,1.432360,-0.084420,-0.156320,0.293932,-0.942957,-0.984677,0.028344,0.172071,-1.000000,0.558420,0.199240,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043980,1.325741,-0.092601,-0.155975,-0.142655,-0.977405,-0.981880,-0.085422,0.169157,-1.000000,0.569980,0.031790,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020269,1.454425,-0.078152,-0.067568,0.336228,-0.939353,-0.992322,0.075109,0.098263,-1.000000,0.534160,0.241140,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.039163,1.463635,-0.070890,-0.241897,0.394520,-0.886476,-0.961496,0.025346,0.273648,-1.000000,0.563000,0.255700,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066507,1.472418,-0.057129,-0.362600,0.408311,-0.837737,-0.911991,0.029553,0.409144,-1.000000,0.611950,0.272040,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.093050,1.486573,-0.037564,-0.409054,0.443621,-0.797418,-0.848089,0.137695,0.511649,-1.000000,0.672240,0.291120,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.088397,1.508351,-0.024253,-0.302307,0.639821,-0.706568,-0.823475,0.198047,0.531664,-1.000000,0.681700,0.332080,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.077643,1.501870,-0.036214,-0.325701,0.589544,-0.739160,-0.867873,0.123758,0.481124,-1.000000,0.652930,0.322510,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064635,1.494424,-0.047548,-0.327197,0.541082,-0.774707,-0.903849,0.059973,0.423628,-1.000000,0.617380,0.310150,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.052568,1.488324,-0.055788,-0.261312,0.493823,-0.829370,-0.946284,0.038450,0.321042,-1.000000,0.589380,0.299270,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.039300,1.482522,-0.062157,-0.228074,0.461392,-0.857380,-0.955350,0.063850,0.288495,-1.000000,0.564100,0.290010,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027901,1.478223,-0.066555,-0.096611,0.478469,-0.872774,-0.978611,0.114348,0.171014,-1.000000,0.545350,0.284060,2,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023528,1.674016,-0.115178,0.328652,0.218449,-0.918841,-0.943300,0.027895,-0.330768,-1.000000,0.460700,0.641820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004281,1.613686,-0.118423,-0.071225,-0.198049,-0.977601,-0.997147,0.038683,0.064812,-1.000000,0.504380,0.565090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004431,1.617533,-0.118760,-0.101359,0.098095,-0.990002,-0.993374,0.044203,0.106084,-1.000000,0.504550,0.568490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008493,1.613521,-0.117724,-0.287577,-0.182441,-0.940220,-0.957455,0.079417,0.277439,-1.000000,0.509680,0.564650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008601,1.617252,-0.117903,-0.308095,0.095344,-0.946566,-0.943724,0.095144,0.316754,-1.000000,0.509920,0.567930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012292,1.617126,-0.116080,-0.483364,0.073077,-0.872364,-0.866158,0.104646,0.488692,-1.000000,0.516130,0.567380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004443,1.621903,-0.117610,-0.109613,0.383166,-0.917152,-0.990874,0.030701,0.131250,-1.000000,0.504760,0.572670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004273,1.626327,-0.115052,-0.080682,0.272005,-0.958908,-0.995259,0.030446,0.092377,-1.000000,0.504960,0.578000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004081,1.630181,-0.115143,-0.029017,-0.433171,-0.900844,-0.999260,0.035336,0.015196,-1.000000,0.504980,0.583240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003970,1.632996,-0.118174,-0.039848,-0.740290,-0.671105,-0.998880,0.046667,0.007831,-1.000000,0.504770,0.588130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004003,1.635555,-0.121274,-0.092031,-0.799517,-0.593551,-0.995597,0.084545,0.040486,-1.000000,0.504560,0.592180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004055,1.637120,-0.123935,-0.166790,-0.600227,-0.782246,-0.984114,0.150285,0.094517,-1.000000,0.504510,0.594160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008794,1.637609,-0.122675,-0.306243,-0.528583,-0.791716,-0.948322,0.241973,0.205269,-1.000000,0.510000,0.593680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009119,1.640596,-0.123731,-0.349883,-0.172049,-0.920859,-0.928177,0.196682,0.315916,-1.000000,0.510160,0.595040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014077,1.640792,-0.121132,-0.522860,-0.125810,-0.843083,-0.844371,0.212028,0.492019,-1.000000,0.517120,0.594460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014171,1.643502,-0.121295,-0.523677,0.147915,-0.838978,-0.835836,0.101235,0.539564,-1.000000,0.517590,0.597360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009306,1.643577,-0.123756,-0.323592,0.229991,-0.917819,-0.935347,0.068724,0.346993,-1.000000,0.510750,0.597800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009143,1.646041,-0.122285,-0.236901,0.570893,-0.786104,-0.954503,0.014073,0.297870,-1.000000,0.510880,0.600380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013929,1.645883,-0.120512,-0.446013,0.416711,-0.792102,-0.858764,0.050115,0.509914,-1.000000,0.518090,0.600170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018488,1.644174,-0.117539,-0.606581,0.138055,-0.782943,-0.757131,0.200090,0.621865,-1.000000,0.526140,0.597260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018148,1.646278,-0.117178,-0.567707,0.198312,-0.798987,-0.778355,0.186763,0.599402,-1.000000,0.526910,0.600050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022621,1.645865,-0.113932,-0.566329,0.094597,-0.818733,-0.783973,0.244656,0.570553,-1.000000,0.535390,0.597540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022191,1.647540,-0.114251,-0.566661,-0.050474,-0.822403,-0.811728,0.205481,0.546695,-1.000000,0.535310,0.599960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026168,1.647388,-0.111661,-0.529808,-0.012888,-0.848019,-0.824607,0.241625,0.511509,-1.000000,0.541600,0.598070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025394,1.648607,-0.112604,-0.528595,-0.399813,-0.748824,-0.846454,0.181688,0.500506,-1.000000,0.540830,0.600620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022401,1.648580,-0.114773,-0.476593,-0.547805,-0.687581,-0.872380,0.198008,0.446930,-1.000000,0.535880,0.602030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026148,1.649435,-0.112837,-0.418314,-0.747887,-0.515440,-0.871414,0.170365,0.460015,-1.000000,0.541840,0.602210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023110,1.649371,-0.115555,-0.385255,-0.754776,-0.530936,-0.905783,0.199274,0.373962,-1.000000,0.536500,0.603820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018456,1.648892,-0.117823,-0.349971,-0.723144,-0.595469,-0.923847,0.161256,0.347136,-1.000000,0.528060,0.604680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018019,1.647937,-0.117009,-0.512726,-0.218811,-0.830201,-0.857174,0.185237,0.480563,-1.000000,0.527590,0.602440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013564,1.648431,-0.119775,-0.278362,-0.677742,-0.680573,-0.944238,0.063356,0.323111,-1.000000,0.519240,0.605130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013528,1.647459,-0.119477,-0.410115,0.212889,-0.886839,-0.899812,0.064206,0.431528,-1.000000,0.518890,0.603020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008848,1.648617,-0.121129,-0.145802,-0.706074,-0.692966,-0.977958,-0.002959,0.208780,-1.000000,0.511910,0.605360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008905,1.647575,-0.120850,-0.213130,0.385737,-0.897654,-0.971752,0.011626,0.235719,-1.000000,0.511550,0.603370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027829,1.648041,-0.110638,-0.494490,-0.149285,-0.856267,-0.865820,0.171189,0.470160,-1.000000,0.544130,0.598490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027504,1.648851,-0.111235,-0.458995,-0.515078,-0.723891,-0.878851,0.143854,0.454892,-1.000000,0.543760,0.600460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004378,1.646146,-0.122900,-0.050297,0.655948,-0.753128,-0.994948,0.032691,0.094920,-1.000000,0.504940,0.600620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004403,1.643725,-0.124934,-0.114330,0.336729,-0.934635,-0.986878,0.069485,0.145754,-1.000000,0.504740,0.598200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004353,1.647590,-0.121406,-0.068199,0.314601,-0.946771,-0.995919,0.034751,0.083287,-1.000000,0.505430,0.603660,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004358,1.648769,-0.121894,-0.088697,-0.759786,-0.644094,-0.993610,0.022181,0.110664,-1.000000,0.505700,0.605610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004292,1.649757,-0.123880,-0.139669,-0.800872,-0.582320,-0.987953,0.073126,0.136390,-1.000000,0.505540,0.608100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004279,1.640320,-0.124984,-0.173833,-0.145094,-0.974027,-0.975583,0.160197,0.150248,-1.000000,0.504550,0.595500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.640080,-0.125354,0.000000,-0.121420,-0.992601,-1.000000,0.000000,0.000000,-1.000000,0.499990,0.595640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008810,1.649636,-0.122950,-0.154687,-0.763826,-0.626612,-0.975436,0.017395,0.219595,-1.000000,0.511870,0.607950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013792,1.649571,-0.121255,-0.240681,-0.751392,-0.614397,-0.961979,0.100465,0.253974,-1.000000,0.519560,0.607560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018887,1.649817,-0.118844,-0.328130,-0.745430,-0.580228,-0.940670,0.201646,0.272908,-1.000000,0.528350,0.606340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023645,1.650085,-0.116194,-0.384277,-0.751243,-0.536623,-0.913471,0.225155,0.338934,-1.000000,0.536770,0.604920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026792,1.649836,-0.113013,-0.364628,-0.778582,-0.510741,-0.917854,0.208155,0.337958,-1.000000,0.542500,0.602850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028336,1.648872,-0.110868,-0.159547,-0.698350,-0.697748,-0.984210,0.057644,0.167356,-1.000000,0.545080,0.600350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028465,1.647615,-0.110299,-0.307705,-0.003355,-0.951476,-0.951083,-0.027854,0.307677,-1.000000,0.545490,0.597350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026870,1.646371,-0.111358,-0.471860,0.198959,-0.858932,-0.825124,0.243630,0.509720,-1.000000,0.542590,0.595730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023304,1.644302,-0.113931,-0.537766,0.170783,-0.825615,-0.771598,0.294953,0.563595,-1.000000,0.535820,0.594880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018797,1.641945,-0.117535,-0.594865,0.029994,-0.803266,-0.771742,0.258195,0.581162,-1.000000,0.525950,0.594300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.024174,1.650845,-0.116731,-0.428414,-0.687443,-0.586416,-0.893751,0.226912,0.386937,-1.000000,0.537230,0.605810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019298,1.650820,-0.119948,-0.353003,-0.675455,-0.647417,-0.932720,0.199599,0.300321,-1.000000,0.528550,0.607590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.024848,1.651930,-0.117184,-0.493529,-0.571663,-0.655462,-0.861336,0.216811,0.459449,-1.000000,0.538260,0.607130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027400,1.650239,-0.113227,-0.356539,-0.733391,-0.578807,-0.930728,0.224835,0.288436,-1.000000,0.543270,0.603330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013912,1.651316,-0.123098,-0.267350,-0.645609,-0.715341,-0.951559,0.059895,0.301577,-1.000000,0.519470,0.609060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.033147,1.606062,-0.075593,0.570159,-0.811291,-0.129329,-0.581025,-0.286919,-0.761634,-1.000000,0.430940,0.524720,4,3,2,2,0.987053,0.012947,0.000000,0.000000},
-	{ 0.030592,1.604742,-0.079489,0.581456,-0.791510,-0.188204,-0.632257,-0.294028,-0.716797,-1.000000,0.437870,0.525450,4,3,2,2,0.988182,0.011818,0.000000,0.000000},
-	{ 0.041965,1.612605,-0.074592,0.649093,-0.733287,-0.202407,-0.527039,-0.241628,-0.814767,-1.000000,0.419180,0.536670,4,3,2,2,0.997108,0.002892,0.000000,0.000000},
-	{ 0.035862,1.607376,-0.071132,0.569989,-0.810587,-0.134392,-0.522268,-0.231155,-0.820855,-1.000000,0.423500,0.524230,4,3,2,2,0.962687,0.037313,0.000000,0.000000},
-	{ 0.029566,1.603060,-0.068364,0.504407,-0.848046,-0.162453,-0.568675,-0.184693,-0.801559,-1.000000,0.430050,0.513380,4,3,2,2,0.890142,0.109858,0.000000,0.000000},
-	{ 0.027328,1.602372,-0.073193,0.475992,-0.875562,-0.082602,-0.593318,-0.250378,-0.765039,-1.000000,0.437240,0.514990,4,3,2,2,0.917479,0.082521,0.000000,0.000000},
-	{ 0.025840,1.601649,-0.077536,0.463666,-0.885455,-0.031369,-0.628211,-0.303582,-0.716372,-1.000000,0.443290,0.517210,4,3,2,2,0.960147,0.039853,0.000000,0.000000},
-	{ 0.023608,1.599373,-0.066036,0.428439,-0.869325,-0.246403,-0.663258,-0.117382,-0.739128,-1.000000,0.439770,0.503670,4,3,2,2,0.848618,0.151382,0.000000,0.000000},
-	{ 0.021667,1.599615,-0.071137,0.392889,-0.912191,-0.116384,-0.678719,-0.202254,-0.705998,-1.000000,0.445970,0.506740,4,3,2,2,0.895516,0.104484,0.000000,0.000000},
-	{ 0.020377,1.599271,-0.076012,0.395145,-0.918575,-0.008933,-0.677730,-0.284949,-0.677854,-1.000000,0.451410,0.510160,4,3,2,2,0.940452,0.059548,0.000000,0.000000},
-	{ 0.019393,1.598547,-0.080708,0.431755,-0.901983,0.003801,-0.681798,-0.329112,-0.653328,-1.000000,0.456490,0.513570,4,3,2,2,0.974162,0.025838,0.000000,0.000000},
-	{ 0.016365,1.597067,-0.085110,0.389841,-0.920869,-0.004922,-0.776060,-0.325650,-0.540077,-1.000000,0.464600,0.515370,4,3,2,2,0.990042,0.009958,0.000000,0.000000},
-	{ 0.017860,1.596455,-0.064359,0.330586,-0.888048,-0.319504,-0.776758,-0.063730,-0.626567,-1.000000,0.452500,0.495940,4,3,2,2,0.819373,0.180627,0.000000,0.000000},
-	{ 0.016312,1.597374,-0.069448,0.323170,-0.932461,-0.161485,-0.771595,-0.160834,-0.615446,-1.000000,0.457020,0.500070,4,3,2,2,0.876664,0.123336,0.000000,0.000000},
-	{ 0.015253,1.597364,-0.074646,0.324165,-0.945968,-0.007814,-0.754748,-0.253640,-0.604997,-1.000000,0.461240,0.504420,4,3,2,2,0.926691,0.073309,0.000000,0.000000},
-	{ 0.014870,1.596892,-0.079715,0.313382,-0.947588,0.062200,-0.760064,-0.289553,-0.581775,-1.000000,0.464720,0.508930,4,3,2,2,0.965737,0.034263,0.000000,0.000000},
-	{ -0.001326,1.712030,-0.124541,-0.218595,0.526127,-0.821831,-0.943894,0.099648,0.314856,-1.000000,0.503190,0.695630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.001402,1.707759,-0.127501,-0.252093,0.584721,-0.771071,-0.922750,0.094785,0.373561,-1.000000,0.503540,0.688330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.001548,1.704153,-0.130452,-0.268928,0.691046,-0.670920,-0.917855,0.027255,0.395980,-1.000000,0.503850,0.681320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002707,1.711810,-0.124127,-0.411393,0.477939,-0.776099,-0.865449,0.062284,0.497111,-1.000000,0.506040,0.695000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002776,1.707673,-0.126887,-0.459086,0.525992,-0.715942,-0.815234,0.070821,0.574786,-1.000000,0.506620,0.687800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004203,1.711342,-0.123429,-0.562759,0.419676,-0.712161,-0.794054,-0.035014,0.606838,-1.000000,0.508660,0.694230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004156,1.707469,-0.125963,-0.582768,0.463311,-0.667626,-0.765909,-0.038572,0.641790,-1.000000,0.509220,0.687320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005867,1.710442,-0.122451,-0.688089,0.367786,-0.625514,-0.694951,-0.086022,0.713893,-1.000000,0.511820,0.693060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005603,1.706845,-0.125004,-0.676301,0.411038,-0.611282,-0.709845,-0.141934,0.689909,-1.000000,0.512000,0.686550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004330,1.704093,-0.128342,-0.619428,0.534681,-0.574826,-0.725606,-0.110427,0.679192,-1.000000,0.509900,0.681220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005355,1.704329,-0.127000,-0.674122,0.461958,-0.576328,-0.704696,-0.168496,0.689212,-1.000000,0.511960,0.681960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.002992,1.704059,-0.129657,-0.495640,0.615145,-0.613138,-0.783313,-0.011648,0.621518,-1.000000,0.507160,0.680990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005034,1.701551,-0.130354,-0.676548,0.598051,-0.429671,-0.663247,-0.241333,0.708422,-1.000000,0.510950,0.676670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003443,1.701582,-0.132376,-0.512390,0.704196,-0.491491,-0.746516,-0.082365,0.660249,-1.000000,0.507590,0.676040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.001825,1.701746,-0.133424,-0.258874,0.773434,-0.578606,-0.901606,0.021425,0.432027,-1.000000,0.504020,0.676320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007248,1.705230,-0.124095,-0.744737,0.396188,-0.537030,-0.633117,-0.164990,0.756268,-1.000000,0.515590,0.684500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006418,1.702349,-0.127369,-0.727938,0.490016,-0.479574,-0.639573,-0.233220,0.732499,-1.000000,0.513970,0.679180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009546,1.702866,-0.122422,-0.790686,0.376724,-0.482591,-0.551078,-0.094562,0.829078,-1.000000,0.520330,0.681450,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008921,1.698678,-0.127222,-0.788454,0.470707,-0.395950,-0.531192,-0.196514,0.824146,-1.000000,0.517830,0.674530,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009865,1.706730,-0.119101,-0.804541,0.341539,-0.485866,-0.521570,-0.015063,0.853075,-1.000000,0.521280,0.687800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007722,1.708905,-0.121094,-0.775532,0.337217,-0.533699,-0.585754,-0.069059,0.807541,-1.000000,0.516060,0.690980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006263,1.698990,-0.132551,-0.720583,0.581979,-0.376909,-0.608000,-0.269045,0.746961,-1.000000,0.511990,0.672280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007483,1.695931,-0.135144,-0.746471,0.518705,-0.416804,-0.601705,-0.258708,0.755660,-1.000000,0.512140,0.667480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.010334,1.694464,-0.130254,-0.791641,0.508308,-0.339008,-0.514635,-0.255674,0.818402,-1.000000,0.517610,0.668320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008430,1.692128,-0.137271,-0.770983,0.364731,-0.522070,-0.613742,-0.206671,0.761976,-1.000000,0.511710,0.662630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011435,1.691319,-0.132420,-0.798494,0.446358,-0.403945,-0.553393,-0.280092,0.784414,-1.000000,0.517020,0.664110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013930,1.692617,-0.123893,-0.832643,0.453730,-0.317546,-0.392519,-0.079004,0.916345,-1.000000,0.524390,0.667650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014911,1.690016,-0.126686,-0.812622,0.511228,-0.279805,-0.397561,-0.135219,0.907558,-1.000000,0.522800,0.664340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.017422,1.689475,-0.117611,-0.824051,0.301843,-0.479406,-0.474899,0.093344,0.875076,-1.000000,0.531200,0.664140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.017096,1.693142,-0.116128,-0.750665,0.276637,-0.599978,-0.619725,0.019941,0.784566,-1.000000,0.531880,0.667940,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.017671,1.687327,-0.120335,-0.896602,0.393811,-0.202530,-0.223662,-0.007982,0.974634,-1.000000,0.529120,0.661730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019255,1.682846,-0.117309,-0.942832,0.116736,-0.312154,-0.325587,-0.122708,0.937516,-1.000000,0.532750,0.655210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016813,1.697127,-0.115088,-0.709614,0.307353,-0.634021,-0.673149,-0.029925,0.738901,-1.000000,0.532890,0.673020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021456,1.692186,-0.113388,-0.434975,0.281119,-0.855435,-0.897341,-0.056549,0.437699,-1.000000,0.539850,0.666870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016632,1.700614,-0.113558,-0.686299,0.386108,-0.616372,-0.672721,-0.014836,0.739747,-1.000000,0.533920,0.678050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021619,1.695676,-0.111857,-0.487993,0.394874,-0.778420,-0.859181,-0.060117,0.508127,-1.000000,0.541180,0.671630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012731,1.700359,-0.119011,-0.797022,0.342344,-0.497550,-0.535135,-0.018403,0.844566,-1.000000,0.526250,0.677810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012624,1.704058,-0.116403,-0.774441,0.367473,-0.514980,-0.546030,0.022869,0.837454,-1.000000,0.527180,0.683550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013096,1.696338,-0.121373,-0.825863,0.372258,-0.423525,-0.470921,-0.042233,0.881164,-1.000000,0.525220,0.672050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019027,1.683088,-0.120359,-0.991512,0.090387,-0.093460,-0.112258,-0.232472,0.966103,-1.000000,0.529130,0.654390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018641,1.680072,-0.120739,-0.871129,-0.367567,-0.325620,-0.249018,-0.240850,0.938073,-1.000000,0.527800,0.647860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019012,1.678402,-0.117223,-0.844128,-0.215285,-0.491020,-0.420382,-0.302647,0.855385,-1.000000,0.530090,0.647380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018749,1.683862,-0.123453,-0.980637,-0.003829,-0.195799,-0.188784,-0.247421,0.950339,-1.000000,0.525970,0.654230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018065,1.686102,-0.123459,-0.886452,0.441966,-0.137364,-0.228301,-0.159393,0.960454,-1.000000,0.526400,0.659070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015668,1.687753,-0.128662,-0.820316,0.364680,-0.440556,-0.516395,-0.141227,0.844625,-1.000000,0.521800,0.660780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012242,1.688156,-0.133319,-0.811633,0.190187,-0.552342,-0.582839,-0.199890,0.787618,-1.000000,0.516940,0.659780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009059,1.688236,-0.137947,-0.788274,0.069259,-0.611414,-0.614835,-0.128285,0.778152,-1.000000,0.511550,0.658030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018110,1.685293,-0.125219,-0.920303,0.220490,-0.323151,-0.362070,-0.167251,0.917024,-1.000000,0.524650,0.656200,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016578,1.685503,-0.128409,-0.823949,-0.019782,-0.566319,-0.564661,-0.055306,0.823468,-1.000000,0.522080,0.655760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013090,1.684459,-0.132214,-0.728618,-0.245426,-0.639439,-0.656391,-0.016434,0.754242,-1.000000,0.517690,0.654380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009275,1.684957,-0.136934,-0.740464,-0.300857,-0.600997,-0.609816,-0.075188,0.788968,-1.000000,0.511800,0.654140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.017912,1.682792,-0.125319,-0.824466,-0.356962,-0.439129,-0.436619,-0.092428,0.894886,-1.000000,0.524530,0.651390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015497,1.681348,-0.128098,-0.670847,-0.479738,-0.565523,-0.669526,0.063869,0.740038,-1.000000,0.521450,0.649520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015264,1.677805,-0.123972,-0.644230,-0.571192,-0.508633,-0.583179,-0.063415,0.809864,-1.000000,0.522810,0.644350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016250,1.675180,-0.119806,-0.731443,-0.376093,-0.568811,-0.541043,-0.187633,0.819796,-1.000000,0.524380,0.641990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020152,1.676847,-0.115717,-0.455753,0.147152,-0.877859,-0.888333,-0.137422,0.438155,-1.000000,0.533540,0.645840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014972,1.672279,-0.120280,-0.504640,0.266363,-0.821212,-0.862109,-0.104910,0.495744,-1.000000,0.523390,0.637350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011754,1.674177,-0.123357,-0.552411,-0.475238,-0.684829,-0.719899,-0.142172,0.679361,-1.000000,0.518860,0.639160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009670,1.667367,-0.125959,-0.416227,0.301467,-0.857830,-0.906709,-0.066985,0.416403,-1.000000,0.517760,0.629020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008482,1.662696,-0.128166,-0.338397,0.343481,-0.876076,-0.926904,0.038888,0.373278,-1.000000,0.514320,0.623050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009032,1.658998,-0.129424,-0.382861,0.201152,-0.901640,-0.920418,0.000000,0.390935,-1.000000,0.512390,0.618420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009254,1.657187,-0.128678,-0.331230,-0.303274,-0.893483,-0.936878,-0.006699,0.349592,-1.000000,0.511510,0.614710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006864,1.673858,-0.127141,-0.551295,-0.469827,-0.689446,-0.747018,-0.090026,0.658680,-1.000000,0.512510,0.637470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006017,1.676394,-0.130103,-0.593036,-0.557508,-0.580942,-0.715531,0.034050,0.697750,-1.000000,0.510080,0.640980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.010287,1.676084,-0.125861,-0.530011,-0.540046,-0.653788,-0.741051,-0.079821,0.666687,-1.000000,0.517640,0.641160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009057,1.677225,-0.127299,-0.570456,-0.335713,-0.749585,-0.763051,-0.121025,0.634907,-1.000000,0.516420,0.642750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011967,1.678360,-0.126739,-0.372989,-0.675541,-0.636022,-0.869354,0.014932,0.493964,-1.000000,0.519200,0.645070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012723,1.680297,-0.128991,-0.388395,-0.684315,-0.617141,-0.876299,0.067119,0.477070,-1.000000,0.518690,0.648370,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011130,1.681752,-0.131784,-0.484379,-0.659384,-0.574970,-0.762703,-0.003667,0.646738,-1.000000,0.515890,0.650930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008680,1.682078,-0.134619,-0.588880,-0.645388,-0.486513,-0.608140,-0.042655,0.792683,-1.000000,0.512140,0.651230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006637,1.677793,-0.129784,-0.811986,-0.270434,-0.517247,-0.534017,-0.013492,0.845366,-1.000000,0.511700,0.642640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.005826,1.679566,-0.133531,-0.795908,-0.484170,-0.363470,-0.432605,0.034823,0.900911,-1.000000,0.508800,0.646050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006678,1.681287,-0.135910,-0.618108,-0.659166,-0.428302,-0.498264,-0.092891,0.862035,-1.000000,0.509150,0.649780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006600,1.679592,-0.131581,-0.712522,-0.583092,-0.390278,-0.501520,0.034232,0.864469,-1.000000,0.511150,0.645850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006971,1.678271,-0.129591,-0.716384,-0.425735,-0.552760,-0.545077,-0.153040,0.824299,-1.000000,0.512410,0.643670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007975,1.679821,-0.130021,-0.491004,-0.690630,-0.530985,-0.664562,-0.097157,0.740890,-1.000000,0.513920,0.646380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008299,1.678164,-0.128270,-0.518565,-0.498282,-0.694842,-0.717356,-0.188680,0.670672,-1.000000,0.515180,0.644260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.010049,1.679976,-0.129030,-0.217177,-0.780285,-0.586506,-0.854072,-0.139038,0.501229,-1.000000,0.516460,0.647340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009600,1.681043,-0.130762,-0.242367,-0.865559,-0.438253,-0.782535,-0.092614,0.615680,-1.000000,0.515060,0.649040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007961,1.680869,-0.132139,-0.419891,-0.843290,-0.335490,-0.643921,0.016310,0.764918,-1.000000,0.512830,0.648700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.010018,1.678629,-0.127503,-0.277461,-0.633324,-0.722438,-0.896336,-0.100033,0.431943,-1.000000,0.517330,0.645500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006727,1.680386,-0.133245,-0.590521,-0.758465,-0.275709,-0.456071,0.031788,0.889375,-1.000000,0.510620,0.648160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.047642,1.626265,-0.087518,-0.753557,-0.485701,-0.442997,-0.596955,0.223359,0.770556,-1.000000,0.579660,0.564820,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044597,1.624821,-0.090701,-0.702915,-0.506984,-0.498877,-0.666914,0.225959,0.710048,-1.000000,0.574120,0.564110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038088,1.616671,-0.090030,-0.651329,-0.604624,-0.458476,-0.727955,0.327389,0.602410,-1.000000,0.566320,0.552860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.036283,1.618153,-0.093865,-0.631905,-0.550371,-0.545699,-0.768662,0.354844,0.532208,-1.000000,0.562170,0.557440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032090,1.608779,-0.087366,-0.646141,-0.690909,-0.324263,-0.705765,0.379172,0.598435,-1.000000,0.560680,0.539730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032756,1.612760,-0.092467,-0.673532,-0.585600,-0.451030,-0.727763,0.418647,0.543227,-1.000000,0.558680,0.550190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026922,1.604787,-0.090073,-0.666471,-0.705965,-0.239646,-0.682695,0.448745,0.576677,-1.000000,0.552770,0.536880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022554,1.600436,-0.087587,-0.556721,-0.823632,-0.108126,-0.700072,0.395118,0.594794,-1.000000,0.546420,0.525180,4,3,2,2,0.998318,0.001682,0.000000,0.000000},
-	{ -0.020007,1.599482,-0.092017,-0.535438,-0.831994,-0.145231,-0.770064,0.410308,0.488517,-1.000000,0.540560,0.530110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023535,1.602882,-0.093297,-0.658585,-0.705151,-0.262731,-0.708670,0.463765,0.531703,-1.000000,0.546110,0.538190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025949,1.602159,-0.082484,-0.563620,-0.815308,-0.132686,-0.657574,0.345634,0.669428,-1.000000,0.553680,0.522840,4,3,2,2,0.986999,0.013001,0.000000,0.000000},
-	{ -0.029099,1.608882,-0.093213,-0.703246,-0.595970,-0.387641,-0.690630,0.443250,0.571454,-1.000000,0.553860,0.546240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032357,1.615916,-0.096342,-0.679829,-0.498518,-0.537878,-0.732314,0.422110,0.534359,-1.000000,0.556080,0.557110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029624,1.612371,-0.096727,-0.721433,-0.512093,-0.466149,-0.684646,0.426463,0.591091,-1.000000,0.552490,0.553410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031356,1.618531,-0.099631,-0.674443,-0.409506,-0.614354,-0.735187,0.449140,0.507714,-1.000000,0.552910,0.562780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029260,1.615318,-0.100053,-0.727993,-0.415011,-0.545703,-0.685538,0.431408,0.586451,-1.000000,0.549940,0.559600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.030100,1.620654,-0.101930,-0.622237,-0.319906,-0.714480,-0.769346,0.418560,0.482611,-1.000000,0.549850,0.566910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028427,1.617896,-0.102383,-0.692619,-0.284706,-0.662737,-0.713657,0.403915,0.572317,-1.000000,0.547270,0.564550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029089,1.622002,-0.103203,-0.564491,-0.257745,-0.784167,-0.809632,0.357916,0.465180,-1.000000,0.547860,0.569050,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027596,1.620489,-0.103863,-0.622540,-0.188537,-0.759538,-0.765856,0.346392,0.541735,-1.000000,0.545470,0.568150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026477,1.609407,-0.098446,-0.734697,-0.527058,-0.427118,-0.664691,0.433358,0.608594,-1.000000,0.547120,0.551300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026562,1.612301,-0.101548,-0.742312,-0.431541,-0.512586,-0.667566,0.410443,0.621202,-1.000000,0.545090,0.557270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023298,1.606898,-0.100951,-0.723809,-0.540864,-0.428447,-0.670681,0.405573,0.621046,-1.000000,0.539860,0.550350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022537,1.604230,-0.098317,-0.710183,-0.607118,-0.356437,-0.682067,0.467902,0.562008,-1.000000,0.540390,0.545500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019831,1.602645,-0.100857,-0.653357,-0.637313,-0.408605,-0.722419,0.363482,0.588211,-1.000000,0.534140,0.545810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020163,1.604862,-0.103457,-0.659221,-0.572597,-0.487401,-0.729833,0.331175,0.598053,-1.000000,0.533140,0.549870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016794,1.601119,-0.102682,-0.505051,-0.730588,-0.459527,-0.818173,0.235745,0.524422,-1.000000,0.527760,0.545170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016681,1.603195,-0.105605,-0.527969,-0.639006,-0.559392,-0.819722,0.211223,0.532391,-1.000000,0.526180,0.549140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016528,1.605927,-0.108385,-0.545116,-0.565089,-0.619292,-0.811805,0.171343,0.558224,-1.000000,0.524770,0.553710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020183,1.607536,-0.106087,-0.659768,-0.492080,-0.567947,-0.738152,0.282717,0.612538,-1.000000,0.531720,0.554600,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012931,1.599748,-0.104074,-0.336509,-0.813747,-0.473896,-0.904378,0.139035,0.403448,-1.000000,0.520230,0.544100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012513,1.601902,-0.107348,-0.362737,-0.716732,-0.595582,-0.902820,0.111891,0.415207,-1.000000,0.518520,0.548220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012287,1.604810,-0.110480,-0.392144,-0.646350,-0.654565,-0.888803,0.082758,0.450755,-1.000000,0.517240,0.552840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008356,1.598911,-0.105013,-0.184441,-0.861771,-0.472580,-0.964873,0.067236,0.253967,-1.000000,0.512610,0.543280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007833,1.601148,-0.108517,-0.202955,-0.770844,-0.603828,-0.964836,0.052237,0.257609,-1.000000,0.511250,0.547560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007732,1.604185,-0.112070,-0.217963,-0.696005,-0.684156,-0.962951,0.039307,0.266797,-1.000000,0.510260,0.552340,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003883,1.598569,-0.105486,-0.082608,-0.878746,-0.470086,-0.992675,0.030826,0.116818,-1.000000,0.505890,0.542880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003557,1.600856,-0.109021,-0.078553,-0.791261,-0.606412,-0.994717,0.021884,0.100298,-1.000000,0.505150,0.547290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003515,1.604007,-0.112647,-0.067989,-0.703064,-0.707869,-0.996651,0.015549,0.080282,-1.000000,0.504610,0.552230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.003790,1.607326,-0.115473,-0.052707,-0.585044,-0.809287,-0.998349,0.012334,0.056104,-1.000000,0.504310,0.557240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004075,1.610455,-0.117307,-0.050617,-0.418089,-0.906995,-0.998675,0.012787,0.049839,-1.000000,0.504270,0.561560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008281,1.610301,-0.116673,-0.254759,-0.414578,-0.873626,-0.964837,0.048522,0.258331,-1.000000,0.509550,0.561270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008023,1.607342,-0.114889,-0.232559,-0.592013,-0.771645,-0.964901,0.040925,0.259404,-1.000000,0.509690,0.557140,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012440,1.610640,-0.114964,-0.472956,-0.366242,-0.801361,-0.874661,0.085524,0.477130,-1.000000,0.516120,0.561300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012378,1.607783,-0.113227,-0.431316,-0.550449,-0.714823,-0.878308,0.075052,0.472168,-1.000000,0.516430,0.557420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016243,1.611604,-0.112511,-0.611921,-0.286484,-0.737211,-0.785635,0.112600,0.608358,-1.000000,0.523070,0.561870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016433,1.608777,-0.110837,-0.578220,-0.466585,-0.669298,-0.794763,0.136679,0.591330,-1.000000,0.523700,0.558170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019968,1.610338,-0.108339,-0.669984,-0.375036,-0.640680,-0.736176,0.224335,0.638528,-1.000000,0.530320,0.559160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019568,1.613162,-0.109950,-0.676806,-0.205545,-0.706884,-0.735813,0.159329,0.658174,-1.000000,0.529300,0.562930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023144,1.612440,-0.105946,-0.709665,-0.314583,-0.630407,-0.704303,0.293566,0.646357,-1.000000,0.536460,0.560490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022539,1.615346,-0.107494,-0.684488,-0.155226,-0.712306,-0.727759,0.203028,0.655093,-1.000000,0.535090,0.564540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023476,1.609643,-0.103728,-0.722704,-0.452735,-0.522236,-0.684091,0.360783,0.633920,-1.000000,0.538310,0.555610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026072,1.615063,-0.103859,-0.716448,-0.284485,-0.637000,-0.695714,0.359147,0.622090,-1.000000,0.542820,0.562460,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025334,1.617982,-0.105403,-0.662579,-0.148943,-0.734034,-0.740612,0.276477,0.612417,-1.000000,0.541140,0.566550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.024550,1.621285,-0.106377,-0.595219,-0.121401,-0.794340,-0.796177,0.222827,0.562540,-1.000000,0.540170,0.570040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027174,1.623468,-0.104945,-0.550471,-0.229825,-0.802597,-0.826263,0.287544,0.484364,-1.000000,0.544810,0.571260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027144,1.627111,-0.106297,-0.507508,-0.328643,-0.796510,-0.859813,0.253432,0.443276,-1.000000,0.544540,0.574980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029263,1.624367,-0.103868,-0.519799,-0.308644,-0.796585,-0.846402,0.312474,0.431235,-1.000000,0.548110,0.571420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031102,1.623826,-0.102458,-0.542656,-0.344102,-0.766237,-0.826043,0.383971,0.412577,-1.000000,0.551170,0.570020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023994,1.625176,-0.107546,-0.514918,-0.234621,-0.824507,-0.855191,0.207037,0.475167,-1.000000,0.539360,0.573900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021734,1.618581,-0.108515,-0.636763,-0.045831,-0.769696,-0.766996,0.139997,0.626193,-1.000000,0.534010,0.567950,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018941,1.616197,-0.110968,-0.657770,-0.041018,-0.752101,-0.751938,0.093964,0.652503,-1.000000,0.528450,0.566010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015895,1.614580,-0.113473,-0.617952,-0.095084,-0.780445,-0.786186,0.083380,0.612339,-1.000000,0.522690,0.564830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012430,1.613742,-0.115903,-0.496507,-0.149035,-0.855143,-0.867958,0.098133,0.486845,-1.000000,0.516090,0.564430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.020957,1.601746,-0.096661,-0.652130,-0.706522,-0.274869,-0.724884,0.474964,0.498952,-1.000000,0.539100,0.541160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018170,1.599330,-0.096150,-0.515387,-0.827887,-0.221314,-0.804646,0.378660,0.457343,-1.000000,0.534410,0.536810,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.017138,1.599804,-0.099652,-0.485350,-0.811440,-0.325575,-0.816694,0.287805,0.500179,-1.000000,0.530010,0.541540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019428,1.601234,-0.099079,-0.622384,-0.715315,-0.317747,-0.731048,0.386203,0.562509,-1.000000,0.534510,0.543020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.013464,1.598243,-0.100399,-0.325556,-0.885063,-0.332680,-0.907962,0.194448,0.371208,-1.000000,0.522670,0.539790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014237,1.597238,-0.096186,-0.346996,-0.913114,-0.214047,-0.905681,0.266968,0.329347,-1.000000,0.526480,0.533100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009438,1.595939,-0.096240,-0.187606,-0.957917,-0.217255,-0.969770,0.145499,0.195898,-1.000000,0.517320,0.530930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.008918,1.597240,-0.100948,-0.176973,-0.925763,-0.334130,-0.967812,0.101966,0.230092,-1.000000,0.514530,0.538580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004469,1.595334,-0.096338,-0.087098,-0.972497,-0.216020,-0.991173,0.062841,0.116731,-1.000000,0.508390,0.529860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004210,1.596800,-0.101266,-0.087959,-0.937287,-0.337279,-0.991383,0.049375,0.121331,-1.000000,0.506920,0.537970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.004691,1.594438,-0.090774,-0.081001,-0.993275,-0.082722,-0.986435,0.068001,0.149404,-1.000000,0.510000,0.517440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.009824,1.595064,-0.090927,-0.212055,-0.973965,-0.080159,-0.948521,0.185380,0.256792,-1.000000,0.520600,0.519850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.015191,1.596740,-0.091309,-0.376979,-0.922101,-0.087273,-0.866595,0.317880,0.384662,-1.000000,0.531230,0.523490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025642,1.606213,-0.095469,-0.710338,-0.604184,-0.361083,-0.681598,0.462456,0.567062,-1.000000,0.547790,0.545100,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.016335,1.597067,-0.085109,-0.389508,-0.921010,-0.004765,-0.775830,0.325312,0.540610,-1.000000,0.535440,0.515400,4,3,2,2,0.990043,0.009957,0.000000,0.000000},
-	{ -0.019363,1.598547,-0.080707,-0.431694,-0.902010,0.004169,-0.681208,0.329043,0.653977,-1.000000,0.543550,0.513610,4,3,2,2,0.974174,0.025826,0.000000,0.000000},
-	{ -0.020346,1.599272,-0.076011,-0.395037,-0.918623,-0.008824,-0.677738,0.284938,0.677851,-1.000000,0.548630,0.510200,4,3,2,2,0.940461,0.059539,0.000000,0.000000},
-	{ -0.025809,1.601649,-0.077536,-0.463551,-0.885517,-0.031319,-0.627702,0.303232,0.716966,-1.000000,0.556750,0.517250,4,3,2,2,0.960098,0.039902,0.000000,0.000000},
-	{ -0.030562,1.604741,-0.079489,-0.581409,-0.791538,-0.188231,-0.631746,0.293412,0.717500,-1.000000,0.562160,0.525500,4,3,2,2,0.988164,0.011836,0.000000,0.000000},
-	{ -0.035686,1.609829,-0.082621,-0.632885,-0.713668,-0.300223,-0.674177,0.317299,0.666938,-1.000000,0.567290,0.537540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040750,1.616728,-0.086250,-0.670918,-0.622871,-0.402368,-0.677908,0.295300,0.673231,-1.000000,0.571650,0.550520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043860,1.617833,-0.082647,-0.699963,-0.619830,-0.354771,-0.613082,0.266709,0.743638,-1.000000,0.577580,0.550030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038778,1.611151,-0.078683,-0.640625,-0.728772,-0.241849,-0.610980,0.293026,0.735418,-1.000000,0.573960,0.536590,4,3,2,2,0.998910,0.001090,0.000000,0.000000},
-	{ -0.033117,1.606061,-0.075593,-0.570127,-0.811311,-0.129339,-0.580574,0.286482,0.762143,-1.000000,0.569100,0.524780,4,3,2,2,0.987067,0.012933,0.000000,0.000000},
-	{ -0.047078,1.619463,-0.078982,-0.736835,-0.600512,-0.310579,-0.536579,0.239977,0.809008,-1.000000,0.583680,0.550750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041935,1.612605,-0.074592,-0.649101,-0.733281,-0.202405,-0.526720,0.241269,0.815080,-1.000000,0.580840,0.536740,4,3,2,2,0.997107,0.002893,0.000000,0.000000},
-	{ -0.035832,1.607376,-0.071132,-0.569975,-0.810607,-0.134333,-0.522287,0.231217,0.820826,-1.000000,0.576530,0.524290,4,3,2,2,0.962649,0.037351,0.000000,0.000000},
-	{ -0.050298,1.621579,-0.075008,-0.785619,-0.561572,-0.259693,-0.441009,0.213873,0.871647,-1.000000,0.590280,0.552410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.053224,1.624035,-0.070539,-0.836051,-0.512430,-0.196046,-0.336886,0.197434,0.920613,-1.000000,0.598200,0.554780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051182,1.619567,-0.061151,-0.771557,-0.634025,-0.052076,-0.258856,0.238119,0.936105,-1.000000,0.606040,0.543790,4,3,2,2,0.994226,0.005774,0.000000,0.000000},
-	{ -0.048453,1.616754,-0.065786,-0.727384,-0.679827,-0.093526,-0.314132,0.208693,0.926158,-1.000000,0.597060,0.540680,4,3,2,2,0.995326,0.004674,0.000000,0.000000},
-	{ -0.045996,1.614339,-0.057279,-0.695839,-0.717923,-0.019854,-0.279027,0.244765,0.928565,-1.000000,0.604340,0.531810,4,3,2,2,0.942637,0.057363,0.000000,0.000000},
-	{ -0.042398,1.611341,-0.061603,-0.653399,-0.753836,-0.069291,-0.331256,0.202412,0.921574,-1.000000,0.594580,0.527750,4,3,2,2,0.947698,0.052302,0.000000,0.000000},
-	{ -0.045235,1.614449,-0.070277,-0.679976,-0.717029,-0.153300,-0.422188,0.211932,0.881386,-1.000000,0.588430,0.538120,4,3,2,2,0.993761,0.006239,0.000000,0.000000},
-	{ -0.038987,1.608981,-0.066345,-0.602915,-0.788975,-0.118372,-0.431611,0.197781,0.880111,-1.000000,0.584950,0.525120,4,3,2,2,0.947815,0.052185,0.000000,0.000000},
-	{ -0.041593,1.609851,-0.053170,-0.721267,-0.680787,-0.127683,-0.339400,0.186670,0.921934,-1.000000,0.602800,0.521110,4,3,2,2,0.841954,0.158046,0.000000,0.000000},
-	{ -0.036498,1.605600,-0.057670,-0.662954,-0.721852,-0.198550,-0.419907,0.138957,0.896866,-1.000000,0.589720,0.514540,4,3,2,2,0.831991,0.168009,0.000000,0.000000},
-	{ -0.032515,1.603805,-0.063078,-0.566902,-0.789916,-0.233786,-0.530299,0.132756,0.837352,-1.000000,0.578580,0.512800,4,3,2,2,0.859785,0.140215,0.000000,0.000000},
-	{ -0.029535,1.603060,-0.068364,-0.504324,-0.848136,-0.162244,-0.568393,0.184605,0.801780,-1.000000,0.570000,0.513440,4,3,2,2,0.890013,0.109987,0.000000,0.000000},
-	{ -0.025869,1.598594,-0.060535,-0.498559,-0.788903,-0.359263,-0.647037,0.062866,0.759862,-1.000000,0.567360,0.500680,4,3,2,2,0.790665,0.209335,0.000000,0.000000},
-	{ -0.023575,1.599374,-0.066036,-0.428359,-0.869435,-0.246153,-0.662431,0.116877,0.739950,-1.000000,0.560280,0.503710,4,3,2,2,0.848531,0.151469,0.000000,0.000000},
-	{ -0.027297,1.602372,-0.073194,-0.475876,-0.875624,-0.082607,-0.592383,0.249679,0.765992,-1.000000,0.562800,0.515040,4,3,2,2,0.917350,0.082650,0.000000,0.000000},
-	{ -0.021635,1.599615,-0.071137,-0.392698,-0.912275,-0.116370,-0.678637,0.202051,0.706135,-1.000000,0.554080,0.506780,4,3,2,2,0.895493,0.104507,0.000000,0.000000},
-	{ -0.019116,1.594655,-0.059638,-0.399042,-0.803879,-0.441071,-0.750822,0.010344,0.660424,-1.000000,0.551400,0.491630,4,3,2,2,0.737439,0.262561,0.000000,0.000000},
-	{ -0.017825,1.596456,-0.064359,-0.330433,-0.888107,-0.319500,-0.776354,0.063246,0.627116,-1.000000,0.547560,0.495970,4,3,2,2,0.817343,0.182657,0.000000,0.000000},
-	{ -0.016278,1.597376,-0.069447,-0.322852,-0.932581,-0.161431,-0.771221,0.160352,0.616041,-1.000000,0.543030,0.500110,4,3,2,2,0.876651,0.123349,0.000000,0.000000},
-	{ -0.015220,1.597365,-0.074645,-0.323926,-0.946052,-0.007574,-0.754094,0.253349,0.605934,-1.000000,0.538810,0.504460,4,3,2,2,0.926682,0.073318,0.000000,0.000000},
-	{ -0.014838,1.596893,-0.079715,-0.313097,-0.947676,0.062291,-0.759631,0.289257,0.582487,-1.000000,0.535330,0.508960,4,3,2,2,0.965730,0.034270,0.000000,0.000000},
-	{ -0.013414,1.592554,-0.059065,-0.194783,-0.801977,-0.564706,-0.888820,-0.099158,0.447399,-1.000000,0.537930,0.486460,4,3,2,2,0.700684,0.299316,0.000000,0.000000},
-	{ -0.006974,1.590919,-0.058399,-0.097262,-0.796814,-0.596345,-0.962305,-0.077620,0.260662,-1.000000,0.519950,0.481940,4,3,2,2,0.656683,0.343317,0.000000,0.000000},
-	{ -0.012053,1.594341,-0.063292,-0.228032,-0.908618,-0.349879,-0.863667,0.022853,0.503544,-1.000000,0.533670,0.490470,4,3,2,2,0.787590,0.212410,0.000000,0.000000},
-	{ -0.006105,1.592945,-0.062612,-0.123510,-0.931901,-0.341036,-0.954627,0.017732,0.297276,-1.000000,0.517500,0.486570,4,3,2,2,0.754302,0.245698,0.000000,0.000000},
-	{ -0.011003,1.595529,-0.068290,-0.252161,-0.950722,-0.180394,-0.848404,0.127541,0.513755,-1.000000,0.530140,0.495050,4,3,2,2,0.861707,0.138293,0.000000,0.000000},
-	{ -0.005574,1.594097,-0.067664,-0.153763,-0.972618,-0.174273,-0.947492,0.095085,0.305316,-1.000000,0.515540,0.491580,4,3,2,2,0.859537,0.140463,0.000000,0.000000},
-	{ -0.010228,1.595837,-0.073760,-0.250868,-0.967541,-0.030490,-0.839743,0.201848,0.504073,-1.000000,0.527100,0.500050,4,3,2,2,0.917157,0.082843,0.000000,0.000000},
-	{ -0.005170,1.594712,-0.073272,-0.152318,-0.986747,-0.055939,-0.944223,0.128567,0.303171,-1.000000,0.513840,0.497130,4,3,2,2,0.916600,0.083400,0.000000,0.000000},
-	{ -0.009933,1.595524,-0.079400,-0.231895,-0.971296,0.052992,-0.848856,0.228665,0.476609,-1.000000,0.524530,0.505300,4,3,2,2,0.964351,0.035649,0.000000,0.000000},
-	{ -0.004927,1.594655,-0.079066,-0.120010,-0.992357,0.028734,-0.956428,0.123328,0.264644,-1.000000,0.512180,0.502800,4,3,2,2,0.964347,0.035653,0.000000,0.000000},
-	{ -0.010023,1.595047,-0.085172,-0.226284,-0.973715,0.025975,-0.893925,0.218186,0.391527,-1.000000,0.522700,0.511150,4,3,2,2,0.991950,0.008050,0.000000,0.000000},
-	{ -0.004816,1.594328,-0.084925,-0.089638,-0.995779,0.019727,-0.972638,0.091783,0.213426,-1.000000,0.510870,0.508740,4,3,2,2,0.995450,0.004549,0.000000,0.000000},
-	{ -0.034821,1.728658,-0.107086,-0.136454,-0.657157,-0.741299,-0.984821,0.008958,0.173340,-1.000000,0.548120,0.718440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038651,1.729227,-0.106615,-0.186496,-0.695190,-0.694212,-0.966107,0.001399,0.258139,-1.000000,0.551690,0.719330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042548,1.729143,-0.105756,-0.219970,-0.663924,-0.714715,-0.946482,-0.032133,0.321152,-1.000000,0.555940,0.719550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046269,1.728660,-0.104327,-0.378583,-0.467718,-0.798696,-0.893725,-0.039671,0.446858,-1.000000,0.560350,0.719060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031325,1.727823,-0.106836,-0.025636,-0.625853,-0.779520,-0.993551,-0.070205,0.089041,-1.000000,0.545350,0.717020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028575,1.726979,-0.106060,0.049762,-0.618964,-0.783841,-0.989926,-0.134723,0.043539,-1.000000,0.543280,0.715270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026573,1.726099,-0.105233,0.063961,-0.603977,-0.794431,-0.988882,-0.145445,0.030960,-1.000000,0.542020,0.713500,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023982,1.725163,-0.104343,0.056051,-0.508320,-0.859342,-0.978224,-0.200230,0.054635,-1.000000,0.540370,0.711560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023992,1.723486,-0.103223,-0.064519,-0.605205,-0.793451,-0.984423,-0.091709,0.150000,-1.000000,0.541380,0.709440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026414,1.722380,-0.102049,0.142668,-0.448591,-0.882277,-0.976646,-0.208484,-0.051926,-1.000000,0.543770,0.708190,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025713,1.725223,-0.104484,0.011092,-0.608623,-0.793382,-0.989727,-0.119786,0.078053,-1.000000,0.541850,0.712030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028268,1.723553,-0.103131,0.185620,-0.450629,-0.873201,-0.969213,-0.230265,-0.087198,-1.000000,0.544730,0.710160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.031615,1.722634,-0.103717,0.153056,-0.357431,-0.921313,-0.982446,-0.155652,-0.102826,-1.000000,0.548010,0.710180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035808,1.722563,-0.104034,-0.105355,-0.310329,-0.944773,-0.994367,0.043932,0.096455,-1.000000,0.551830,0.710430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040052,1.723449,-0.103176,-0.358733,-0.261351,-0.896106,-0.933306,0.116739,0.339577,-1.000000,0.555800,0.710680,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043561,1.724181,-0.101374,-0.452677,-0.320672,-0.832018,-0.879496,0.006878,0.475857,-1.000000,0.559800,0.711070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046696,1.724458,-0.099808,-0.372198,-0.505455,-0.778450,-0.868646,-0.105783,0.484009,-1.000000,0.563470,0.711730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026075,1.724300,-0.103616,-0.020211,-0.624873,-0.780465,-0.988295,-0.105577,0.110122,-1.000000,0.542680,0.710720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027167,1.725557,-0.104722,0.004531,-0.677496,-0.735513,-0.989887,-0.107326,0.092763,-1.000000,0.542870,0.712710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027429,1.724921,-0.104099,0.024211,-0.635170,-0.771993,-0.988750,-0.129229,0.075316,-1.000000,0.543440,0.711740,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029293,1.724835,-0.104180,0.148264,-0.514317,-0.844687,-0.977973,-0.203148,-0.047966,-1.000000,0.545060,0.712040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032210,1.724674,-0.104636,0.065811,-0.423691,-0.903413,-0.993495,-0.112146,-0.019778,-1.000000,0.547750,0.712630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035845,1.725067,-0.104786,-0.149991,-0.351413,-0.924128,-0.988684,0.055692,0.139291,-1.000000,0.550940,0.713240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.039435,1.726013,-0.103973,-0.322373,-0.350609,-0.879289,-0.946593,0.113447,0.301813,-1.000000,0.554490,0.713690,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042702,1.726560,-0.102726,-0.325760,-0.477823,-0.815822,-0.928818,0.000000,0.370535,-1.000000,0.558260,0.714020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045997,1.726366,-0.101696,-0.215381,-0.634849,-0.742010,-0.917241,-0.129211,0.376795,-1.000000,0.561830,0.714310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048635,1.725965,-0.100918,-0.143343,-0.720731,-0.678233,-0.916076,-0.162706,0.366513,-1.000000,0.564640,0.714590,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049987,1.725916,-0.100543,-0.267361,-0.691071,-0.671519,-0.898948,-0.072076,0.432086,-1.000000,0.566210,0.714840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049948,1.726474,-0.101080,-0.375739,-0.555051,-0.742118,-0.881094,-0.034225,0.471701,-1.000000,0.565820,0.715850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048575,1.726942,-0.102023,-0.202457,-0.680001,-0.704705,-0.909544,-0.136143,0.392677,-1.000000,0.563920,0.716360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045920,1.727610,-0.103203,-0.143234,-0.730711,-0.667492,-0.937742,-0.115432,0.327591,-1.000000,0.560770,0.716750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.042473,1.728040,-0.104170,-0.185610,-0.703570,-0.685958,-0.957438,-0.027545,0.287321,-1.000000,0.556970,0.716830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038986,1.727812,-0.105026,-0.243118,-0.598505,-0.763339,-0.963734,0.059761,0.260086,-1.000000,0.553120,0.716550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.035508,1.727043,-0.105701,-0.172562,-0.537840,-0.825197,-0.982884,0.039156,0.180016,-1.000000,0.549690,0.715910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032078,1.726345,-0.105610,-0.021688,-0.569700,-0.821567,-0.994472,-0.072152,0.076285,-1.000000,0.546820,0.714920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.029286,1.725946,-0.105129,0.053293,-0.634185,-0.771343,-0.988864,-0.141003,0.047608,-1.000000,0.544490,0.713760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049183,1.753260,-0.098296,-0.604383,0.338061,-0.721413,-0.768799,-0.009961,0.639413,-1.000000,0.567270,0.760230,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056018,1.748846,-0.094039,-0.724007,0.367427,-0.583790,-0.632919,-0.017338,0.774024,-1.000000,0.577560,0.753850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041200,1.756793,-0.102781,-0.494153,0.295497,-0.817615,-0.864989,-0.072759,0.496488,-1.000000,0.553890,0.764420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032732,1.758721,-0.106459,-0.404024,0.259260,-0.877240,-0.914329,-0.143486,0.378700,-1.000000,0.542410,0.765520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025264,1.759204,-0.109424,-0.357827,0.229504,-0.905145,-0.928157,-0.193706,0.317809,-1.000000,0.532980,0.764400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.018823,1.758631,-0.111933,-0.304104,0.214083,-0.928272,-0.941501,-0.216107,0.258598,-1.000000,0.524630,0.761840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012615,1.757910,-0.113902,-0.219183,0.205503,-0.953796,-0.968033,-0.167988,0.186260,-1.000000,0.516380,0.758980,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006296,1.757882,-0.115093,-0.117280,0.203180,-0.972092,-0.992193,-0.065774,0.105958,-1.000000,0.508100,0.758000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.006493,1.764234,-0.113582,-0.114360,0.285282,-0.951597,-0.993132,-0.056644,0.102370,-1.000000,0.508200,0.766750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.012887,1.764499,-0.112353,-0.224475,0.280427,-0.933258,-0.971909,-0.133942,0.193525,-1.000000,0.516410,0.767860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.019134,1.764947,-0.110334,-0.312029,0.283793,-0.906697,-0.945961,-0.181495,0.268734,-1.000000,0.524540,0.769930,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025619,1.765156,-0.107750,-0.374506,0.299406,-0.877554,-0.925279,-0.181958,0.332793,-1.000000,0.532960,0.771920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.032924,1.764482,-0.104610,-0.435108,0.323125,-0.840400,-0.900378,-0.156656,0.405928,-1.000000,0.542600,0.772830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.041234,1.762370,-0.100755,-0.524417,0.333895,-0.783263,-0.846686,-0.107198,0.521183,-1.000000,0.554320,0.771650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049469,1.758470,-0.096045,-0.637805,0.327730,-0.696992,-0.750920,-0.063399,0.657343,-1.000000,0.567940,0.767320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056223,1.753275,-0.091206,-0.765969,0.328681,-0.552504,-0.601866,-0.064588,0.795981,-1.000000,0.578960,0.760550,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061543,1.747137,-0.086145,-0.878708,0.304741,-0.367431,-0.412355,-0.096793,0.905867,-1.000000,0.588750,0.752070,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065362,1.740036,-0.081111,-0.946718,0.196953,-0.254822,-0.278512,-0.103345,0.954856,-1.000000,0.597850,0.742060,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067165,1.731649,-0.077480,-0.965841,0.063253,-0.251295,-0.254952,-0.058437,0.965186,-1.000000,0.604510,0.729510,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067484,1.722234,-0.076596,-0.947232,0.083979,-0.309354,-0.313495,-0.041337,0.948690,-1.000000,0.607130,0.714270,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068733,1.713225,-0.077878,-0.909457,0.220419,-0.352567,-0.378738,-0.089207,0.921194,-1.000000,0.607180,0.698430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070456,1.704046,-0.079991,-0.924375,0.131520,-0.358096,-0.369282,-0.072978,0.926447,-1.000000,0.606600,0.683830,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070095,1.693966,-0.081688,-0.930936,-0.121689,-0.344310,-0.343192,-0.030700,0.938763,-1.000000,0.605680,0.668110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067133,1.683682,-0.081662,-0.915501,-0.255667,-0.310630,-0.317313,-0.015787,0.948189,-1.000000,0.604540,0.651730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065467,1.720421,-0.081264,-0.875111,0.067307,-0.479219,-0.481982,-0.032642,0.875573,-1.000000,0.601910,0.711030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065733,1.728945,-0.082118,-0.931837,-0.032162,-0.361449,-0.360071,-0.041686,0.931993,-1.000000,0.600000,0.725120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064673,1.736951,-0.085084,-0.938210,0.106394,-0.329306,-0.339014,-0.091426,0.936328,-1.000000,0.594270,0.736670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061504,1.743562,-0.089612,-0.860268,0.288334,-0.420478,-0.458696,-0.077682,0.885191,-1.000000,0.586290,0.746010,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.823184,-0.035649,-0.000002,0.989675,-0.143333,0.034706,0.143247,0.989078,-1.000000,0.620910,0.981130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.105953,1.711364,0.017275,-0.913504,0.205299,0.351232,0.263462,-0.359320,0.895253,-1.000000,0.715860,0.706030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.103200,1.710930,0.020578,-0.508659,0.239700,0.826928,0.682985,-0.472451,0.557065,-1.000000,0.720060,0.707310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.102634,1.699581,0.021311,-0.505474,-0.158661,0.848129,0.843344,-0.298630,0.446757,-1.000000,0.724470,0.695800,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.105814,1.699486,0.018210,-0.914811,-0.206006,0.347395,0.403494,-0.428443,0.808473,-1.000000,0.719940,0.693890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.100276,1.717298,0.016852,-0.343351,0.772368,0.534376,0.399323,-0.394927,0.827390,-1.000000,0.716090,0.712570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.103413,1.716400,0.014130,-0.744984,0.667029,-0.008441,-0.088896,-0.086728,0.992258,-1.000000,0.712790,0.710570,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.100767,1.685674,0.015368,-0.864115,-0.408894,0.293448,0.436549,-0.318783,0.841310,-1.000000,0.721670,0.679900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.098535,1.686879,0.018415,-0.443470,-0.381576,0.811008,0.888391,-0.067274,0.454132,-1.000000,0.725760,0.681900,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.097072,1.676269,0.012218,-0.742794,-0.592469,0.311829,0.457609,-0.109284,0.882412,-1.000000,0.721570,0.668710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.094963,1.676592,0.014637,-0.338943,-0.590554,0.732369,0.823026,0.191011,0.534923,-1.000000,0.725150,0.668890,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.095914,1.720518,0.011233,-0.154832,0.977634,0.142332,0.050790,-0.136002,0.989406,-1.000000,0.711330,0.716880,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.099167,1.719228,0.009126,-0.590620,0.767640,-0.248792,-0.352085,0.032273,0.935411,-1.000000,0.708420,0.714020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.089844,1.720611,0.004411,0.098037,0.965156,-0.242614,-0.344511,0.261629,0.901589,-1.000000,0.705530,0.721080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.094119,1.719581,0.003488,-0.466378,0.695220,-0.546955,-0.599626,0.206118,0.773281,-1.000000,0.703490,0.716280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.084598,1.716793,-0.002958,0.009064,0.873278,-0.487139,-0.633572,0.381912,0.672852,-1.000000,0.697010,0.719580,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.089256,1.715714,-0.003334,-0.561082,0.487469,-0.669000,-0.647019,0.245818,0.721762,-1.000000,0.695790,0.713630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.085526,1.709163,-0.008305,-0.783650,0.143624,-0.604372,-0.595116,0.105405,0.796697,-1.000000,0.686970,0.706040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.090874,1.669529,0.006113,-0.614909,-0.782986,0.093920,0.291802,-0.115269,0.949507,-1.000000,0.717870,0.656180,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.088000,1.668388,0.007869,-0.247850,-0.817269,0.520233,0.650838,0.257303,0.714287,-1.000000,0.721260,0.653730,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.083746,1.664471,-0.001882,-0.625507,-0.750197,-0.214349,0.017743,-0.288336,0.957365,-1.000000,0.710640,0.643640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081473,1.662792,-0.000516,-0.285444,-0.930046,0.231379,0.383359,0.110468,0.916969,-1.000000,0.713550,0.640650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.077061,1.663636,-0.009031,-0.587180,-0.589380,-0.554844,-0.247598,-0.521823,0.816331,-1.000000,0.702940,0.634020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.077490,1.661130,-0.006108,-0.320163,-0.935773,-0.147729,0.091039,-0.185606,0.978398,-1.000000,0.708120,0.633670,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.087508,1.719858,0.006984,0.436048,0.889328,0.137687,0.025274,-0.165041,0.985963,-1.000000,0.708950,0.723080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.092623,1.719801,0.012649,0.221465,0.892378,0.393211,0.175393,-0.433099,0.884117,-1.000000,0.713920,0.719030,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.078649,1.663410,0.000173,0.262324,-0.763355,0.590318,0.485768,0.633040,0.602735,-1.000000,0.716200,0.638280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074681,1.661556,-0.006372,0.139980,-0.986111,0.089388,0.086851,0.102157,0.990970,-1.000000,0.708630,0.630080,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.084572,1.669210,0.008691,0.180331,-0.637129,0.749365,0.740845,0.589128,0.322610,-1.000000,0.724770,0.652000,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.091291,1.677441,0.015402,0.074141,-0.472146,0.878397,0.917126,0.378199,0.125875,-1.000000,0.728820,0.668260,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.094477,1.687375,0.019694,0.001710,-0.307202,0.951643,0.996572,0.079233,0.023787,-1.000000,0.729850,0.682540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.097393,1.699157,0.022826,0.040131,-0.056679,0.997586,0.976317,-0.210196,-0.051218,-1.000000,0.729180,0.696910,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.098645,1.710458,0.021940,0.067936,0.227523,0.971400,0.767313,-0.634214,0.094884,-1.000000,0.723740,0.709650,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.096689,1.716846,0.018274,0.079182,0.652737,0.753435,0.359322,-0.723689,0.589204,-1.000000,0.719090,0.714520,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.093759,1.711806,0.018699,0.430550,0.304425,0.849678,0.567909,-0.823061,0.007117,-1.000000,0.725630,0.716700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.091935,1.698009,0.021501,0.262677,0.004814,0.964872,0.958094,-0.119721,-0.260234,-1.000000,0.733720,0.696490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.094219,1.716437,0.017062,0.608245,0.355152,0.709863,0.077973,-0.916725,0.391837,-1.000000,0.719490,0.716870,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.089033,1.686104,0.018168,0.186320,-0.304714,0.934042,0.955936,0.275755,-0.100728,-1.000000,0.734380,0.679090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.086239,1.677054,0.013569,0.197736,-0.486095,0.851241,0.875816,0.477643,0.069310,-1.000000,0.732000,0.663700,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.080803,1.670285,0.007623,0.363711,-0.564873,0.740698,0.677909,0.705861,0.205427,-1.000000,0.727590,0.648720,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.079065,1.681638,0.015269,-0.299876,-0.504879,0.809427,0.884466,0.170806,0.434217,-1.000000,0.740300,0.665860,4,3,2,2,0.988818,0.011182,0.000000,0.000000},
-	{ -0.084719,1.695951,0.019763,-0.145312,-0.138137,0.979695,0.988972,0.008344,0.147865,-1.000000,0.739660,0.693430,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.077553,1.695164,0.022812,-0.663622,-0.258683,0.701919,0.741085,-0.099427,0.664008,-1.000000,0.747120,0.692380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072340,1.682340,0.021079,-0.651528,-0.444902,0.614470,0.716923,-0.096241,0.690478,-1.000000,0.749520,0.667440,4,3,2,2,0.975215,0.024785,0.000000,0.000000},
-	{ -0.070759,1.693964,0.030846,-0.766616,-0.321441,0.555855,0.627476,-0.191295,0.754771,-1.000000,0.758720,0.693150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081830,1.709046,0.020841,-0.796989,0.057974,0.601205,0.598507,-0.058068,0.799011,-1.000000,0.736890,0.717790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074957,1.708930,0.030254,-0.862057,-0.151839,0.483531,0.505930,-0.201583,0.838689,-1.000000,0.750500,0.719540,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065234,1.681304,0.029513,-0.672933,-0.461440,0.578130,0.702716,-0.154743,0.694438,-1.000000,0.762250,0.668890,4,3,2,2,0.975387,0.024613,0.000000,0.000000},
-	{ -0.069427,1.724237,0.046490,-0.814914,-0.119100,0.567212,0.572660,-0.316249,0.756338,-1.000000,0.765860,0.753440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071440,1.745306,0.045636,-0.832405,0.010520,0.554068,0.519252,-0.334479,0.786448,-1.000000,0.755040,0.785380,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071114,1.764204,0.043137,-0.830560,0.152783,0.535563,0.467229,-0.332198,0.819354,-1.000000,0.744110,0.812610,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068891,1.778117,0.039260,-0.821872,0.341705,0.455812,0.365317,-0.297812,0.881959,-1.000000,0.735060,0.832120,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064596,1.789305,0.035150,-0.767520,0.540563,0.344534,0.263676,-0.223669,0.938322,-1.000000,0.727360,0.849160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057164,1.798250,0.033980,-0.611133,0.727675,0.311458,0.256874,-0.189861,0.947612,-1.000000,0.724570,0.867960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043676,1.807102,0.036612,-0.454126,0.813765,0.362705,0.315961,-0.233544,0.919579,-1.000000,0.729890,0.893360,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044747,1.796273,0.051605,-0.459355,0.650287,0.605079,0.487496,-0.384876,0.783721,-1.000000,0.754830,0.878020,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057062,1.790791,0.044826,-0.625190,0.566012,0.537371,0.415158,-0.341854,0.843078,-1.000000,0.742690,0.858630,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058153,1.779675,0.052570,-0.693455,0.360777,0.623667,0.497911,-0.385691,0.776741,-1.000000,0.756340,0.844320,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.053629,1.766262,0.062321,-0.594199,0.165735,0.787057,0.674522,-0.430337,0.599858,-1.000000,0.777140,0.831330,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046609,1.782452,0.061075,-0.474054,0.411072,0.778648,0.628157,-0.461796,0.626229,-1.000000,0.772530,0.858960,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.053617,1.742244,0.065827,-0.599785,0.007301,0.800128,0.736107,-0.386990,0.555325,-1.000000,0.792080,0.797210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051200,1.719856,0.065109,-0.575606,-0.173173,0.799180,0.801543,-0.312965,0.509492,-1.000000,0.802290,0.761970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065705,1.706042,0.045683,-0.753079,-0.265378,0.602035,0.657475,-0.269513,0.703626,-1.000000,0.773920,0.723240,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.060431,1.691479,0.042773,-0.665648,-0.406018,0.626149,0.735641,-0.215917,0.642037,-1.000000,0.777620,0.694840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.054926,1.680199,0.040119,-0.588877,-0.499390,0.635478,0.793821,-0.209607,0.570889,-1.000000,0.780420,0.671710,4,3,2,2,0.980025,0.019975,0.000000,0.000000},
-	{ -0.057927,1.669049,0.027392,-0.617155,-0.502465,0.605515,0.765759,-0.206601,0.609039,-1.000000,0.762530,0.645750,4,3,2,2,0.922550,0.077450,0.000000,0.000000},
-	{ -0.047467,1.701885,0.060893,-0.528005,-0.354501,0.771712,0.848759,-0.250883,0.465473,-1.000000,0.806980,0.728210,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043461,1.688613,0.055083,-0.466317,-0.485774,0.739305,0.884082,-0.226849,0.408580,-1.000000,0.807120,0.698440,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.040756,1.678648,0.049289,-0.405765,-0.552665,0.727953,0.913975,-0.243500,0.324588,-1.000000,0.805780,0.676390,4,3,2,2,0.978834,0.021166,0.000000,0.000000},
-	{ -0.050555,1.655279,0.024454,-0.656239,-0.404332,0.637076,0.753164,-0.299788,0.585552,-1.000000,0.760200,0.621350,4,3,2,2,0.687574,0.312426,0.000000,0.000000},
-	{ -0.060510,1.656637,0.012340,-0.754695,-0.457193,0.470541,0.595775,-0.177231,0.783352,-1.000000,0.738290,0.615230,4,3,2,2,0.707067,0.292933,0.000000,0.000000},
-	{ -0.066265,1.669709,0.018065,-0.668536,-0.504010,0.546840,0.690992,-0.149138,0.707311,-1.000000,0.747070,0.641820,4,3,2,2,0.879811,0.120189,0.000000,0.000000},
-	{ -0.069436,1.667779,0.011074,-0.654275,-0.575682,0.490423,0.606287,-0.011662,0.795160,-1.000000,0.737170,0.636170,4,3,2,2,0.863584,0.136416,0.000000,0.000000},
-	{ -0.069234,1.662412,0.002699,-0.717808,-0.612422,0.331198,0.406320,0.017813,0.913557,-1.000000,0.724150,0.624580,4,3,2,2,0.842206,0.157794,0.000000,0.000000},
-	{ -0.066987,1.657108,-0.005197,-0.837490,-0.538000,0.095743,0.142329,-0.045597,0.988769,-1.000000,0.712270,0.613780,4,3,2,2,0.824281,0.175719,0.000000,0.000000},
-	{ -0.072361,1.662822,-0.004900,-0.693346,-0.694583,0.191900,0.152994,0.118343,0.981116,-1.000000,0.713390,0.626490,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071324,1.661940,-0.010074,0.056498,-0.989734,0.131278,-0.094082,0.125625,0.987607,-1.000000,0.704810,0.624690,4,3,2,2,0.968247,0.031753,0.000000,0.000000},
-	{ -0.072087,1.662241,-0.010488,-0.498523,-0.721050,-0.481208,-0.039691,-0.535538,0.843578,-1.000000,0.703300,0.626520,4,3,2,2,0.973761,0.026239,0.000000,0.000000},
-	{ -0.073188,1.662265,-0.006570,0.258233,-0.913324,0.314890,0.056690,0.339709,0.938821,-1.000000,0.710170,0.627390,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.075969,1.664483,-0.000792,0.395585,-0.669479,0.628737,0.463834,0.736490,0.492382,-1.000000,0.717620,0.634840,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.077150,1.671307,0.006889,-0.353568,-0.693561,0.627665,0.660301,0.290231,0.692653,-1.000000,0.730500,0.645480,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.079887,1.670717,-0.010043,-0.812633,-0.121404,-0.569990,-0.448200,-0.494935,0.744417,-1.000000,0.696170,0.644970,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081290,1.666383,-0.007814,-0.694699,-0.380336,-0.610523,-0.400798,-0.500123,0.767619,-1.000000,0.702440,0.641790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.088921,1.672131,-0.000567,-0.696121,0.025993,-0.717453,-0.635233,-0.487929,0.598668,-1.000000,0.707690,0.655710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.086276,1.667968,-0.002494,-0.745262,-0.426830,-0.512251,-0.317371,-0.448567,0.835502,-1.000000,0.708030,0.648990,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.092911,1.671773,0.004058,-0.814084,-0.373745,-0.444502,-0.272152,-0.430632,0.860517,-1.000000,0.714170,0.659160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.098743,1.682238,0.009984,-0.849760,-0.189862,-0.491792,-0.344146,-0.506888,0.790334,-1.000000,0.716160,0.674040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.097286,1.676058,0.009368,-0.869202,-0.322997,-0.374379,-0.196866,-0.468487,0.861257,-1.000000,0.718240,0.667560,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.106008,1.699394,0.014989,-0.930686,-0.176943,-0.320178,-0.215230,-0.442866,0.870371,-1.000000,0.715420,0.692170,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.104934,1.712481,0.013375,-0.875208,0.107446,-0.471663,-0.483336,-0.154092,0.861767,-1.000000,0.710560,0.706150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.098141,1.716517,0.006273,-0.737813,0.044021,-0.673568,-0.667206,0.103688,0.737621,-1.000000,0.703480,0.711090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.091247,1.713213,-0.001217,-0.761755,-0.127790,-0.635137,-0.647192,0.194794,0.737020,-1.000000,0.695220,0.708780,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.086844,1.708066,-0.005137,-0.852966,-0.275055,-0.443614,-0.496569,0.165730,0.852029,-1.000000,0.689060,0.703310,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.084902,1.704139,-0.006032,-0.900253,-0.421770,-0.107951,-0.148542,0.064488,0.986801,-1.000000,0.687470,0.696160,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.083643,1.703278,-0.009161,-0.901423,-0.179059,-0.394175,-0.395683,-0.028758,0.917937,-1.000000,0.684800,0.694400,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.082319,1.698426,-0.006041,-0.975386,-0.204000,-0.083701,-0.078830,-0.031901,0.996378,-1.000000,0.687740,0.684920,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.080720,1.691598,-0.008751,-0.976761,-0.128008,-0.171909,-0.148887,-0.171730,0.973828,-1.000000,0.687280,0.674470,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.082201,1.701355,-0.002998,-0.914502,-0.373788,-0.154815,-0.180228,0.033786,0.983044,-1.000000,0.689450,0.689640,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.078687,1.680416,-0.012080,-0.943924,-0.130448,-0.303301,-0.233046,-0.387484,0.891934,-1.000000,0.688070,0.656710,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081261,1.693114,-0.000602,-0.713028,0.225138,-0.664007,-0.694339,-0.095185,0.713326,-1.000000,0.693450,0.678150,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081497,1.689066,-0.004179,-0.856008,0.110388,-0.505039,-0.516309,-0.231646,0.824479,-1.000000,0.692600,0.672040,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.081596,1.698200,0.001569,-0.690800,0.088148,-0.717653,-0.720871,-0.007037,0.693033,-1.000000,0.693060,0.684750,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.079139,1.678231,-0.008348,-0.918014,0.033811,-0.395104,-0.369918,-0.431980,0.822529,-1.000000,0.692800,0.656350,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.079844,1.673931,-0.007985,-0.818377,0.278293,-0.502805,-0.574678,-0.393080,0.717797,-1.000000,0.695720,0.651300,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.084210,1.675154,-0.003220,-0.653192,0.154265,-0.741311,-0.728032,-0.397032,0.558870,-1.000000,0.700990,0.656220,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.080000,1.683786,-0.007109,-0.922560,-0.043295,-0.383417,-0.347265,-0.339989,0.873965,-1.000000,0.691740,0.664130,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.082952,1.681907,-0.003607,-0.676144,0.088503,-0.731434,-0.712234,-0.332579,0.618154,-1.000000,0.696910,0.663790,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.094816,1.683051,0.005432,-0.581877,0.075161,-0.809797,-0.748438,-0.439088,0.497034,-1.000000,0.709470,0.671410,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.088543,1.686695,0.000659,-0.497539,0.180022,-0.848556,-0.853809,-0.274379,0.442410,-1.000000,0.700820,0.672110,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.103403,1.699452,0.010547,-0.591244,-0.031065,-0.805894,-0.756455,-0.325133,0.567506,-1.000000,0.709780,0.690290,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.089498,1.701299,0.006696,-0.486296,-0.010875,-0.873726,-0.870430,-0.081627,0.485477,-1.000000,0.698060,0.689620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.103870,1.709405,0.011335,-0.601258,-0.065681,-0.796351,-0.773903,-0.200213,0.600823,-1.000000,0.707380,0.701860,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.097002,1.711000,0.006357,-0.533007,-0.215528,-0.818200,-0.837842,0.000000,0.545913,-1.000000,0.700730,0.703280,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.084454,1.704390,0.000092,-0.681176,-0.531309,-0.503696,-0.599840,0.010567,0.800050,-1.000000,0.691780,0.694420,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.089396,1.709031,0.000455,-0.658058,-0.484797,-0.576135,-0.710565,0.146685,0.688172,-1.000000,0.693710,0.702090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.086759,1.707037,-0.003313,-0.795170,-0.586024,-0.155820,-0.339069,0.216661,0.915473,-1.000000,0.690130,0.700760,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.085300,1.705000,-0.003738,-0.777153,-0.629287,0.005644,-0.093995,0.124940,0.987702,-1.000000,0.689280,0.697090,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.666717,0.053256,0.000001,-0.502487,0.864585,0.977826,-0.181061,-0.105232,-1.000000,0.871020,0.675040,4,3,2,2,0.866525,0.133475,0.000000,0.000000},
-	{ -0.090548,1.718429,0.012744,0.661354,0.404509,0.631651,-0.036608,-0.823708,0.565831,-1.000000,0.715360,0.720620,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.088063,1.709738,0.017643,-0.211973,0.435888,0.874682,0.901845,-0.257553,0.346904,-1.000000,0.729400,0.718250,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046579,1.601828,-0.024333,-0.932101,-0.167645,-0.321064,-0.281166,-0.223890,0.933177,-1.000000,0.657540,0.511480,3,4,2,2,0.685802,0.314198,0.000000,0.000000},
-	{ -0.049094,1.598558,-0.013710,-0.984486,-0.087763,-0.151936,-0.143702,-0.093574,0.985187,-1.000000,0.683220,0.508120,3,4,2,2,0.835846,0.164154,0.000000,0.000000},
-	{ -0.045522,1.588660,-0.022577,-0.911981,-0.096582,-0.398701,-0.381797,-0.155710,0.911035,-1.000000,0.651830,0.486660,3,4,2,2,0.846117,0.153883,0.000000,0.000000},
-	{ -0.040247,1.580097,-0.029288,-0.786301,-0.149258,-0.599543,-0.586728,-0.123678,0.800284,-1.000000,0.617750,0.467420,3,4,2,2,0.847323,0.152677,0.000000,0.000000},
-	{ -0.041218,1.592135,-0.031620,-0.846358,-0.207513,-0.490527,-0.466442,-0.155822,0.870719,-1.000000,0.623560,0.489450,3,4,2,2,0.699598,0.300402,0.000000,0.000000},
-	{ -0.033257,1.573054,-0.034791,-0.629277,-0.225033,-0.743888,-0.765285,0.012594,0.643568,-1.000000,0.585890,0.453740,3,4,2,2,0.874986,0.125014,0.000000,0.000000},
-	{ -0.034403,1.584343,-0.037784,-0.712984,-0.290204,-0.638307,-0.662098,-0.021037,0.749122,-1.000000,0.591710,0.473600,3,4,2,2,0.738827,0.261173,0.000000,0.000000},
-	{ -0.025805,1.578382,-0.042785,-0.519592,-0.375058,-0.767695,-0.840455,0.062600,0.538253,-1.000000,0.563320,0.464190,3,4,2,2,0.751734,0.248266,0.000000,0.000000},
-	{ -0.024457,1.567703,-0.038812,-0.440841,-0.297444,-0.846869,-0.897319,0.123072,0.423877,-1.000000,0.558800,0.446170,3,4,2,2,0.874321,0.125679,0.000000,0.000000},
-	{ -0.014974,1.573898,-0.045993,-0.331313,-0.410700,-0.849445,-0.938939,0.054895,0.339678,-1.000000,0.535400,0.458720,3,4,2,2,0.758015,0.241985,0.000000,0.000000},
-	{ -0.015603,1.564216,-0.041120,-0.311125,-0.340291,-0.887358,-0.948549,0.168949,0.267790,-1.000000,0.536920,0.442970,3,4,2,2,0.859691,0.140309,0.000000,0.000000},
-	{ -0.045497,1.574271,-0.020747,-0.872545,-0.033428,-0.487389,-0.477436,-0.153091,0.865227,-1.000000,0.646390,0.459590,3,4,2,2,0.928905,0.069113,0.001983,0.000000},
-	{ -0.039971,1.566477,-0.027027,-0.723757,-0.090764,-0.684060,-0.675997,-0.105820,0.729267,-1.000000,0.614110,0.442910,3,4,2,2,0.938412,0.057937,0.003652,0.000000},
-	{ -0.040608,1.551349,-0.025058,-0.635670,0.066402,-0.769100,-0.770456,-0.116754,0.626711,-1.000000,0.613080,0.417320,3,2,2,2,0.873051,0.126949,0.000000,0.000000},
-	{ -0.046718,1.558703,-0.018404,-0.775511,0.101209,-0.623169,-0.630877,-0.161801,0.758824,-1.000000,0.644260,0.432570,3,2,2,2,0.876774,0.123226,0.000000,0.000000},
-	{ -0.050344,1.566898,-0.010391,-0.903510,0.177771,-0.389957,-0.412425,-0.113294,0.903919,-1.000000,0.672760,0.449350,3,2,2,2,0.897334,0.102666,0.000000,0.000000},
-	{ -0.048715,1.583005,-0.012512,-0.975048,0.010333,-0.221753,-0.221531,-0.109755,0.968957,-1.000000,0.677570,0.478090,3,4,2,2,0.938712,0.061288,0.000000,0.000000},
-	{ -0.032739,1.545092,-0.030778,-0.475400,0.078717,-0.876241,-0.878357,0.013952,0.477801,-1.000000,0.581050,0.406290,3,2,2,2,0.891932,0.108068,0.000000,0.000000},
-	{ -0.032531,1.559882,-0.032119,-0.550162,-0.128361,-0.825133,-0.834133,0.037973,0.550255,-1.000000,0.582240,0.430960,3,4,2,2,0.943816,0.052170,0.004014,0.000000},
-	{ -0.023466,1.554690,-0.035511,-0.346014,-0.147278,-0.926598,-0.934919,0.137014,0.327344,-1.000000,0.555470,0.424190,3,4,2,2,0.945077,0.052269,0.002654,0.000000},
-	{ -0.023899,1.539889,-0.034788,-0.257260,0.097247,-0.961437,-0.956483,0.116134,0.267681,-1.000000,0.554890,0.399250,3,2,2,2,0.925768,0.074232,0.000000,0.000000},
-	{ -0.013371,1.551196,-0.037269,-0.189282,-0.149487,-0.970477,-0.976915,0.128357,0.170766,-1.000000,0.532020,0.420930,3,4,2,2,0.953032,0.044646,0.002323,0.000000},
-	{ -0.015085,1.535278,-0.036230,-0.051319,0.100928,-0.993569,-0.990678,0.120562,0.063416,-1.000000,0.534420,0.393960,3,2,2,2,0.892062,0.107938,0.000000,0.000000},
-	{ -0.006091,1.544710,-0.037132,-0.075069,-0.099002,-0.992252,-0.996734,0.037137,0.071703,-1.000000,0.514740,0.410430,3,4,2,2,0.944652,0.054159,0.001189,0.000000},
-	{ -0.007287,1.531530,-0.036567,0.025443,0.095244,-0.995129,-0.996877,0.076860,-0.018131,-1.000000,0.516780,0.389250,3,2,2,2,0.825848,0.174152,0.000000,0.000000},
-	{ -0.056180,1.551156,-0.009223,-0.700218,0.384898,-0.601289,-0.656285,-0.015480,0.754354,-1.000000,0.672020,0.422980,3,2,2,2,0.710426,0.289574,0.000000,0.000000},
-	{ -0.051023,1.542942,-0.017985,-0.602488,0.306571,-0.736900,-0.789659,-0.094827,0.606174,-1.000000,0.643340,0.407420,3,2,2,2,0.645835,0.354165,0.000000,0.000000},
-	{ -0.043703,1.535702,-0.025899,-0.516691,0.292451,-0.804676,-0.853248,-0.098275,0.512163,-1.000000,0.611580,0.393020,3,2,2,2,0.612704,0.387296,0.000000,0.000000},
-	{ -0.035245,1.529706,-0.032974,-0.402558,0.315024,-0.859481,-0.908014,-0.018433,0.418534,-1.000000,0.580640,0.381770,3,2,2,2,0.629144,0.370856,0.000000,0.000000},
-	{ -0.026158,1.524739,-0.038158,-0.196068,0.343833,-0.918334,-0.966909,0.088107,0.239427,-1.000000,0.555550,0.374410,3,2,2,2,0.615447,0.384553,0.000000,0.000000},
-	{ -0.016905,1.520383,-0.040126,0.054238,0.349787,-0.935258,-0.986792,0.161959,0.003346,-1.000000,0.536250,0.369500,3,2,2,2,0.572330,0.427670,0.000000,0.000000},
-	{ -0.008190,1.516635,-0.039423,0.146346,0.340263,-0.928872,-0.983771,0.148606,-0.100558,-1.000000,0.518220,0.366420,3,2,2,2,0.522022,0.477978,0.000000,0.000000},
-	{ -0.004949,1.554280,-0.039619,-0.129356,-0.292168,-0.947579,-0.991491,0.052184,0.119261,-1.000000,0.512230,0.428170,3,4,2,2,0.910642,0.089358,0.000000,0.000000},
-	{ -0.008820,1.556408,-0.039689,-0.187334,-0.323176,-0.927611,-0.980608,0.116863,0.157322,-1.000000,0.521510,0.431410,3,4,2,2,0.898986,0.101014,0.000000,0.000000},
-	{ 0.000000,1.606352,0.047509,0.000003,0.254857,0.966979,0.593722,-0.778100,0.205074,-1.000000,0.869610,0.598710,3,4,2,2,0.921304,0.078696,0.000000,0.000000},
-	{ 0.000000,1.591355,0.052674,0.000004,0.320844,0.947132,0.496623,-0.822080,0.278479,-1.000000,0.877890,0.586300,3,2,2,2,0.845342,0.154658,0.000000,0.000000},
-	{ -0.017507,1.592469,0.048353,-0.377835,0.309883,0.872476,0.465918,-0.750684,0.468396,-1.000000,0.851260,0.561310,3,2,2,2,0.891318,0.108682,0.000000,0.000000},
-	{ -0.015915,1.607228,0.044009,-0.359556,0.220074,0.906800,0.591062,-0.698262,0.403826,-1.000000,0.843660,0.579390,3,4,2,2,0.934988,0.065012,0.000000,0.000000},
-	{ -0.035221,1.593325,0.035997,-0.644634,0.281496,0.710779,0.419323,-0.647210,0.636621,-1.000000,0.804300,0.530550,3,2,2,2,0.946245,0.053755,0.000000,0.000000},
-	{ -0.032672,1.608642,0.034012,-0.605617,0.149548,0.781578,0.573343,-0.599095,0.558895,-1.000000,0.800590,0.556080,3,4,2,2,0.941631,0.058369,0.000000,0.000000},
-	{ -0.044724,1.590172,0.023461,-0.871898,0.248814,0.421766,0.282238,-0.448505,0.848047,-1.000000,0.763110,0.505540,3,2,2,2,0.938822,0.061178,0.000000,0.000000},
-	{ -0.043156,1.607070,0.022896,-0.835685,0.061522,0.545752,0.471089,-0.430519,0.769889,-1.000000,0.762020,0.536020,3,4,2,2,0.942675,0.057325,0.000000,0.000000},
-	{ -0.049016,1.583490,0.011384,-0.964693,0.241801,0.104398,0.048978,-0.224766,0.973181,-1.000000,0.732390,0.485540,3,2,2,2,0.921146,0.078854,0.000000,0.000000},
-	{ -0.047962,1.601157,0.011126,-0.967919,0.009029,0.251102,0.242602,-0.226560,0.943300,-1.000000,0.734790,0.517540,3,4,2,2,0.919109,0.080891,0.000000,0.000000},
-	{ -0.050934,1.575290,-0.000435,-0.963071,0.232822,-0.135233,-0.167141,-0.123196,0.978206,-1.000000,0.701770,0.466340,3,2,2,2,0.913072,0.086928,0.000000,0.000000},
-	{ -0.049474,1.592290,-0.001503,-0.999706,0.009965,0.022082,0.020765,-0.117035,0.992911,-1.000000,0.706940,0.497430,3,4,2,2,0.943325,0.056675,0.000000,0.000000},
-	{ 0.000000,1.580366,0.056576,0.000001,0.400048,0.916494,0.431279,-0.826878,0.360931,-1.000000,0.887370,0.576720,3,2,2,2,0.681759,0.318241,0.000000,0.000000},
-	{ -0.020421,1.580799,0.051626,-0.365735,0.427155,0.826908,0.345850,-0.762469,0.546835,-1.000000,0.859290,0.546460,3,2,2,2,0.771579,0.228421,0.000000,0.000000},
-	{ -0.039579,1.580212,0.039052,-0.604906,0.498206,0.621192,0.236125,-0.632790,0.737443,-1.000000,0.807370,0.507430,3,2,2,2,0.838358,0.161642,0.000000,0.000000},
-	{ -0.050765,1.575343,0.025500,-0.780097,0.579895,0.234885,0.025236,-0.345952,0.937913,-1.000000,0.763860,0.476690,3,2,2,2,0.812717,0.187283,0.000000,0.000000},
-	{ -0.056148,1.567862,0.012845,-0.806641,0.573655,-0.142303,-0.228859,-0.081169,0.970070,-1.000000,0.729810,0.455700,3,2,2,2,0.744441,0.255559,0.000000,0.000000},
-	{ -0.057925,1.559611,0.001113,-0.773825,0.496408,-0.393414,-0.445630,0.014713,0.895096,-1.000000,0.699210,0.437880,3,2,2,2,0.749543,0.250457,0.000000,0.000000},
-	{ -0.023499,1.674017,-0.115179,-0.328705,0.218314,-0.918854,-0.943291,-0.028055,0.330781,-1.000000,0.539240,0.641850,4,2,2,2,1.000000,0.000000,0.000000,0.000000},
-	{ -0.049105,1.618925,-0.040253,-0.793304,-0.604816,0.069766,0.093464,-0.007749,0.995592,-1.000000,0.634570,0.533900,4,3,2,2,0.808342,0.191658,0.000000,0.000000},
-	{ -0.046607,1.615114,-0.046532,-0.788404,-0.615141,-0.004575,-0.104008,0.125966,0.986567,-1.000000,0.618680,0.527840,4,3,2,2,0.834090,0.165910,0.000000,0.000000},
-	{ -0.045595,1.613946,-0.050987,-0.748656,-0.661719,-0.040534,-0.250506,0.225750,0.941426,-1.000000,0.611050,0.527510,4,3,2,2,0.877925,0.122075,0.000000,0.000000}};
-
-const uint32_t unAvatarIndexCount_2429 = 14274;
-const uint32_t aunAvatarVertices_2429[] = {
-2,1,0,3,2,0,0,1,4,1,5,4,4,5,6,5,
-7,6,4,6,8,9,4,8,0,4,9,10,0,9,3,0,
-10,11,3,10,2,12,1,12,13,1,1,13,5,13,14,5,
-5,14,7,6,7,15,16,6,15,8,6,16,16,15,17,18,
-16,17,18,17,19,20,18,19,21,18,20,22,21,20,22,20,
-23,24,22,23,24,23,25,26,24,25,26,25,27,28,26,27,
-27,29,28,29,30,28,29,31,30,31,32,30,25,23,33,23,
-34,33,20,19,34,23,20,34,25,33,35,27,25,35,36,29,
-27,35,36,27,29,36,31,36,37,31,32,38,30,38,39,30,
-30,39,40,28,30,40,26,28,40,41,26,40,38,42,39,42,
-43,39,39,43,40,42,44,43,44,45,43,43,45,46,43,46,
-47,48,43,47,43,48,40,47,49,48,49,50,48,50,41,40,
-48,50,40,47,46,51,46,52,51,51,52,53,52,54,53,55,
-49,47,51,55,47,49,56,50,56,57,50,58,56,49,55,58,
-49,59,55,51,53,59,51,55,59,58,45,60,46,46,60,52,
-60,61,52,52,61,54,60,62,61,63,62,60,63,64,62,64,
-65,62,62,65,66,62,66,61,65,67,66,45,63,60,68,63,
-45,44,68,45,64,69,65,69,70,65,65,70,67,70,71,67,
-61,66,72,61,72,54,66,73,72,74,73,66,67,74,66,67,
-71,74,71,75,74,75,71,76,71,77,76,77,70,69,71,70,
-77,44,78,68,79,78,44,80,78,79,81,80,79,80,82,78,
-82,83,78,82,84,83,84,85,83,86,81,79,87,86,79,87,
-88,86,88,89,86,90,89,88,91,90,88,91,92,90,92,93,
-90,90,93,89,37,92,91,31,37,91,91,88,32,31,91,32,
-32,88,87,38,32,87,38,87,42,87,79,42,42,79,44,89,
-94,86,94,89,95,93,95,89,96,94,95,97,94,96,98,97,
-96,97,99,94,97,98,99,99,100,94,101,100,99,101,81,100,
-80,81,101,102,80,101,82,80,102,103,82,102,81,86,100,94,
-100,86,104,101,99,102,101,104,104,99,105,98,105,99,106,104,
-105,107,104,106,107,102,104,103,102,107,108,107,106,109,107,108,
-109,103,107,110,109,108,110,108,111,112,110,111,112,111,113,113,
-111,114,111,115,114,108,106,115,111,108,115,116,112,113,114,115,
-117,115,118,117,106,105,118,115,106,118,117,118,119,118,105,119,
-120,117,119,119,121,120,121,122,120,121,123,122,123,124,122,123,
-125,124,125,126,124,116,113,127,128,116,127,127,129,128,130,129,
-127,130,131,129,131,132,129,129,132,133,129,133,128,132,134,133,
-135,131,130,136,135,130,137,130,127,136,130,137,138,136,137,134,
-132,139,140,134,139,132,131,141,139,132,141,131,135,142,141,131,
-142,142,135,143,144,142,143,143,145,144,145,146,144,145,147,146,
-147,148,146,147,145,149,150,147,149,150,149,151,152,150,151,145,
-143,153,149,145,153,149,153,154,151,149,154,147,155,148,155,147,
-150,155,156,148,157,150,152,157,155,150,158,157,152,154,153,138,
-153,136,138,135,136,153,143,135,153,138,117,154,114,117,138,137,
-114,138,113,114,137,127,113,137,117,120,154,154,120,151,120,122,
-151,151,122,152,122,124,152,152,124,158,124,126,158,126,159,158,
-160,159,126,125,160,126,161,160,125,92,161,125,92,125,93,95,
-93,125,123,95,125,96,95,123,121,96,123,98,96,121,119,98,
-121,105,98,119,162,161,92,163,162,92,37,163,92,164,163,37,
-36,164,37,165,164,36,35,165,36,35,33,165,33,166,165,167,
-166,33,34,167,33,168,167,34,19,168,34,169,168,19,17,169,
-19,170,169,17,15,170,17,171,170,15,7,171,15,14,171,7,
-14,172,171,173,172,14,13,173,14,174,173,13,12,174,13,175,
-174,12,156,175,12,148,156,12,2,148,12,146,148,2,3,146,
-2,144,146,3,11,144,3,142,144,11,176,142,11,177,176,11,
-178,176,177,179,178,177,179,177,180,181,179,180,181,180,182,183,
-181,182,184,183,182,185,183,184,186,185,184,187,185,186,188,187,
-186,189,187,188,190,189,188,191,189,190,192,191,190,186,184,193,
-194,186,193,188,186,194,194,193,195,196,194,195,196,195,197,198,
-196,197,199,198,197,200,199,197,199,201,198,201,202,198,201,203,
-202,203,204,202,203,205,204,205,206,204,207,196,198,202,207,198,
-208,207,202,204,208,202,209,208,204,206,209,204,210,194,196,207,
-210,196,211,210,207,208,211,207,212,211,208,209,212,208,211,190,
-210,190,188,210,210,188,194,192,190,211,212,192,211,201,213,203,
-214,213,201,215,213,214,216,215,214,216,214,217,218,216,217,219,
-216,218,220,219,218,221,215,216,219,221,216,215,222,213,222,223,
-213,222,224,223,224,225,223,226,224,222,227,226,222,227,222,215,
-221,227,215,219,228,221,228,219,220,228,229,221,221,229,230,227,
-221,230,227,230,226,230,231,226,220,218,232,233,220,232,233,228,
-220,233,232,234,235,233,234,234,232,236,232,237,236,232,218,237,
-218,217,237,228,238,229,238,228,233,235,238,233,239,238,235,240,
-239,235,241,239,240,242,241,240,242,240,243,244,242,243,244,243,
-245,245,243,246,245,246,247,248,245,247,248,247,249,250,248,249,
-250,249,251,252,250,251,251,253,252,253,254,252,252,254,255,254,
-256,255,253,257,254,257,258,254,254,258,256,258,259,256,260,253,
-251,261,260,251,251,249,261,262,260,261,263,262,261,261,264,263,
-249,264,261,264,265,263,257,266,258,266,267,258,258,267,259,266,
-268,267,268,269,267,267,269,270,267,270,259,269,271,270,262,272,
-260,272,273,260,260,273,253,273,257,253,273,272,274,274,266,257,
-273,274,257,268,266,274,272,275,274,268,276,269,276,277,269,269,
-277,271,276,278,277,278,279,277,277,279,280,277,280,271,279,281,
-280,274,275,282,275,283,282,276,268,282,282,268,274,284,276,282,
-285,278,276,284,285,276,280,281,286,287,280,286,287,286,288,286,
-289,288,287,288,290,291,287,290,291,290,292,290,293,292,292,293,
-294,293,295,294,294,295,296,295,297,296,296,297,298,299,296,298,
-298,300,299,300,301,299,299,255,296,255,299,301,255,256,296,294,
-296,256,259,294,256,292,294,259,270,292,259,291,292,270,271,291,
-270,291,271,287,271,280,287,301,300,302,300,303,302,297,304,298,
-305,304,297,304,306,298,306,307,300,298,306,300,306,304,308,306,
-308,307,304,309,308,310,309,304,305,310,304,311,310,305,312,311,
-305,312,305,295,293,312,295,313,312,293,312,313,311,290,313,293,
-290,288,313,295,305,297,308,314,307,314,315,307,315,316,307,307,
-316,300,316,303,300,311,317,310,317,318,310,319,315,314,320,319,
-314,321,320,314,308,321,314,322,321,308,318,322,309,309,322,308,
-310,318,309,321,322,323,321,323,320,322,324,323,325,324,322,318,
-325,322,326,325,318,317,326,318,323,327,320,328,319,320,327,328,
-320,326,329,325,329,330,325,325,330,324,330,331,324,324,331,323,
-331,332,323,323,332,327,332,333,327,334,328,327,333,334,327,329,
-326,335,335,326,317,336,335,317,311,336,317,313,336,311,337,329,
-335,337,335,338,335,339,338,338,339,340,339,341,340,342,340,341,
-343,342,341,344,343,341,345,344,341,345,341,339,346,344,345,347,
-346,345,344,346,348,349,344,348,343,344,349,350,343,349,348,351,
-349,351,352,349,349,352,350,352,353,350,348,346,354,346,355,354,
-356,351,348,354,356,348,346,357,355,346,347,357,357,358,355,355,
-358,359,355,359,354,358,360,359,359,361,354,359,360,361,362,356,
-354,361,362,354,350,353,363,343,350,363,342,343,363,353,364,363,
-360,365,361,366,362,361,365,366,361,362,366,367,368,362,367,356,
-362,368,368,367,369,370,368,369,371,368,370,372,371,370,373,371,
-372,374,373,372,375,373,374,376,375,374,377,375,376,378,377,376,
-379,377,378,379,364,377,380,379,378,371,356,368,351,356,371,373,
-351,371,352,351,373,375,352,373,353,352,375,377,353,375,364,353,
-377,379,381,364,381,382,364,381,383,382,384,383,381,384,385,383,
-385,386,383,387,386,385,388,387,385,388,389,387,389,390,387,383,
-386,391,383,391,382,386,392,391,391,392,393,382,391,393,392,394,
-393,393,394,395,394,396,395,395,396,397,396,398,397,397,398,399,
-398,400,399,400,398,401,400,401,402,401,403,402,404,403,401,405,
-404,401,398,396,405,401,398,405,406,404,405,407,406,405,396,394,
-407,405,396,407,394,392,407,408,406,407,409,408,407,392,409,407,
-399,400,410,400,411,410,402,411,400,409,392,386,387,409,386,390,
-408,409,387,390,409,410,411,412,410,412,399,412,413,399,399,413,
-397,413,414,397,395,397,414,415,395,414,395,415,393,415,416,393,
-416,382,393,411,417,412,417,411,418,411,402,418,418,402,419,402,
-403,419,419,403,420,403,404,420,420,404,421,404,406,421,421,406,
-422,406,408,422,422,408,390,423,422,390,423,390,389,424,423,389,
-425,423,424,423,425,422,426,425,424,427,425,426,428,427,426,429,
-427,428,430,429,428,431,429,430,432,431,430,433,431,432,434,433,
-432,435,433,434,436,435,434,437,435,436,438,437,436,439,437,438,
-440,439,438,441,439,440,442,441,440,443,441,442,444,443,442,445,
-443,444,443,445,446,446,445,447,445,448,447,447,448,449,448,450,
-449,449,450,451,450,452,451,451,452,453,452,454,453,455,443,446,
-441,443,455,454,452,456,457,454,456,452,450,458,456,452,458,450,
-448,459,458,450,459,448,445,460,459,448,460,460,445,444,451,453,
-238,239,451,238,449,451,239,241,449,239,238,453,229,229,453,454,
-230,229,454,454,457,231,230,454,231,461,457,456,457,461,231,462,
-461,456,462,456,458,461,462,463,462,464,463,462,465,464,465,462,
-458,465,458,459,465,466,464,465,467,466,467,468,466,467,469,468,
-469,470,468,469,471,470,471,472,470,467,465,459,467,459,460,469,
-467,460,469,460,444,471,469,444,471,444,442,473,471,442,471,473,
-472,473,442,440,474,473,440,474,440,438,475,474,438,475,438,436,
-476,475,436,476,436,434,477,476,434,477,434,432,478,477,432,478,
-432,430,479,478,430,479,430,428,480,479,428,480,428,426,481,480,
-426,480,481,482,483,480,482,483,482,484,483,484,485,484,486,485,
-486,487,485,485,487,488,487,489,488,488,489,490,489,491,490,490,
-491,492,491,493,492,492,493,494,495,494,493,496,495,493,496,497,
-495,497,498,495,497,499,498,499,500,498,499,501,500,501,502,500,
-503,492,494,504,502,501,505,504,501,506,504,505,507,506,505,508,
-494,495,494,508,503,509,508,495,495,498,509,509,510,508,510,511,
-508,510,512,511,512,513,511,514,511,513,515,514,513,516,512,510,
-517,516,510,517,510,509,518,517,509,519,514,515,520,519,515,512,
-521,513,521,522,513,515,513,522,521,523,522,523,524,522,525,522,
-524,525,515,522,526,525,524,527,516,517,528,527,517,528,517,518,
-529,527,528,530,529,528,530,528,531,531,528,518,532,530,531,533,
-523,521,534,533,521,534,521,512,516,534,512,533,534,535,535,534,
-516,527,535,516,527,529,535,536,533,535,537,529,530,538,537,530,
-538,530,532,539,537,538,540,539,538,540,538,541,541,538,532,542,
-540,541,536,535,543,544,536,543,537,545,543,529,537,543,529,543,
-535,546,545,537,539,546,537,542,541,506,541,504,506,541,532,504,
-532,502,504,502,532,531,500,502,531,500,531,518,498,500,518,498,
-518,509,547,542,506,547,548,542,549,547,506,549,506,507,550,549,
-507,551,549,550,552,551,550,550,507,553,507,554,553,553,554,555,
-554,556,555,556,554,557,558,556,557,559,556,558,560,559,558,561,
-559,560,562,561,560,563,561,562,564,563,562,564,562,565,566,564,
-565,563,564,567,564,568,567,564,566,568,566,569,568,570,567,568,
-571,570,568,571,568,569,572,571,569,563,567,573,574,563,573,575,
-573,567,570,575,567,576,563,574,561,563,576,577,576,574,577,574,
-578,578,574,573,579,577,578,580,578,573,579,578,580,581,580,573,
-575,581,573,569,566,582,572,569,582,566,583,582,583,566,565,584,
-583,565,565,585,584,585,586,584,565,562,585,562,560,585,585,587,
-586,587,588,586,589,588,587,590,589,587,589,590,591,591,590,592,
-591,592,593,593,592,594,592,595,594,594,595,596,594,596,489,593,
-594,489,596,491,489,491,596,493,596,496,493,596,597,496,595,597,
-596,597,497,496,597,598,497,598,499,497,598,599,499,599,501,499,
-505,501,599,600,598,597,595,600,597,599,598,600,601,600,595,592,
-601,595,590,601,592,602,599,600,602,600,601,587,602,601,590,587,
-601,599,602,557,505,599,557,557,554,505,554,507,505,602,587,558,
-557,602,558,587,585,558,585,560,558,604,603,63,68,604,63,68,
-83,604,78,83,68,83,85,604,63,603,64,603,605,64,64,605,
-69,605,606,69,606,607,69,607,608,69,607,609,608,610,609,607,
-611,609,610,612,611,610,613,612,610,614,613,610,612,613,615,616,
-612,615,611,612,616,614,617,613,617,618,613,619,618,617,613,618,
-620,615,613,620,620,618,621,618,622,621,622,618,619,623,611,616,
-611,624,609,624,611,623,624,625,609,626,624,623,624,627,625,627,
-624,626,627,628,625,629,627,626,630,627,629,627,630,628,631,630,
-629,630,632,628,621,622,633,622,634,633,633,634,635,634,636,635,
-636,634,637,638,636,637,639,636,638,640,639,638,641,639,640,642,
-641,640,643,641,642,644,643,642,644,645,643,645,646,643,645,647,
-646,647,648,646,649,648,647,650,649,647,651,649,650,652,651,650,
-653,651,652,654,653,652,655,653,654,656,655,654,657,655,656,658,
-657,656,657,659,655,659,660,655,655,660,653,653,660,651,659,661,
-660,661,662,660,662,663,660,663,664,660,660,664,651,651,664,649,
-663,665,664,665,666,664,665,667,666,667,668,666,667,669,668,669,
-670,668,670,669,671,669,672,671,671,672,673,672,674,673,673,674,
-635,674,675,635,674,672,675,675,676,635,635,676,633,676,677,633,
-633,677,621,677,678,621,620,621,678,679,620,678,620,679,615,679,
-680,615,615,680,616,680,681,616,616,681,623,681,682,623,623,682,
-626,682,683,626,626,683,629,683,684,629,629,684,631,684,685,631,
-679,686,680,680,686,681,686,687,681,681,687,682,682,687,683,687,
-688,683,683,688,684,688,689,684,684,689,685,689,690,685,631,685,
-691,692,631,691,692,691,693,694,692,693,694,695,692,694,693,695,
-695,696,692,696,695,697,695,698,697,697,698,699,700,697,699,695,
-701,698,693,701,695,701,702,698,698,702,699,702,703,699,691,704,
-693,704,705,693,704,706,705,706,707,705,707,708,705,708,709,705,
-709,708,710,708,711,710,710,711,712,711,713,712,712,713,714,713,
-715,714,714,715,716,715,717,716,716,717,718,717,719,718,706,720,
-707,720,721,707,707,721,708,720,722,721,722,723,721,723,724,721,
-724,725,721,724,726,725,726,727,725,727,726,728,727,728,713,713,
-728,715,726,729,728,728,729,730,728,730,715,715,730,717,729,731,
-730,721,725,708,725,727,711,708,725,711,711,727,713,722,732,723,
-732,733,723,723,733,724,732,734,733,734,735,733,735,736,733,736,
-737,733,736,738,737,738,739,737,739,738,740,739,740,729,729,740,
-731,738,741,740,740,741,742,740,742,731,741,743,742,742,743,744,
-743,745,744,744,745,746,745,747,746,734,748,735,748,749,735,735,
-749,736,749,750,736,736,750,738,750,751,738,738,751,741,751,752,
-741,741,752,743,752,753,743,743,753,745,753,754,745,745,754,747,
-754,755,747,744,756,742,756,757,742,757,756,758,759,757,758,759,
-758,760,761,759,760,760,758,762,758,763,762,758,756,763,756,764,
-763,761,760,765,730,761,765,759,761,730,730,765,717,717,765,719,
-765,766,719,760,762,766,765,760,766,731,759,730,757,759,731,742,
-757,731,764,756,744,746,764,744,763,767,762,767,768,762,762,768,
-766,767,769,768,769,770,768,766,771,719,768,770,771,768,771,766,
-771,772,719,719,772,718,772,773,718,772,774,773,774,775,773,774,
-776,775,776,777,775,776,778,777,778,779,777,778,780,779,780,781,
-779,781,780,782,780,783,782,783,784,782,784,785,782,782,785,786,
-785,787,786,787,788,786,788,789,786,790,789,788,786,789,790,791,
-790,788,790,791,792,793,790,792,793,792,794,792,795,794,796,790,
-793,796,786,790,797,796,793,797,793,794,798,797,794,799,784,783,
-800,795,792,801,800,792,792,791,801,801,802,800,801,803,802,791,
-803,801,803,791,788,803,804,802,802,804,805,804,806,805,805,806,
-807,806,808,807,807,808,809,808,810,809,810,811,809,811,812,809,
-811,810,813,810,814,813,810,808,814,815,812,811,816,815,811,816,
-817,815,811,813,818,816,811,818,816,818,819,820,816,819,816,820,
-817,808,821,814,808,806,821,806,822,821,806,804,822,804,823,822,
-804,803,823,803,824,823,820,819,825,826,820,825,826,825,827,828,
-826,827,826,828,829,828,830,829,828,831,830,831,832,830,831,833,
-832,833,834,832,833,835,834,835,836,834,837,836,835,838,837,835,
-839,837,838,840,839,838,840,841,839,841,842,839,841,843,842,843,
-844,842,843,845,844,845,846,844,845,847,846,847,848,846,847,657,
-848,657,658,848,659,657,847,849,659,847,849,847,845,849,845,843,
-661,659,849,850,661,849,851,850,849,852,851,849,852,849,843,852,
-843,841,853,851,852,854,853,852,855,853,854,856,855,854,857,855,
-856,858,857,856,857,858,859,860,857,859,860,859,861,862,860,861,
-862,861,827,863,862,827,860,862,863,864,863,827,864,827,825,865,
-864,825,865,825,819,866,865,819,819,818,866,818,867,866,867,818,
-813,868,867,813,868,813,814,869,868,814,869,814,821,870,869,821,
-870,821,822,871,870,822,871,822,823,872,871,823,872,823,824,873,
-872,824,874,867,868,874,868,869,875,874,869,875,869,870,875,870,
-871,876,875,871,876,871,872,877,876,872,877,872,873,878,877,873,
-873,824,787,824,788,787,824,803,788,873,787,785,878,873,785,878,
-785,784,879,878,784,879,784,799,880,879,799,881,879,880,878,879,
-881,882,881,880,882,880,883,884,882,883,885,882,884,886,885,884,
-885,886,887,886,888,887,887,888,889,888,890,889,889,890,891,890,
-892,891,889,891,893,891,894,893,893,894,895,893,895,896,889,893,
-896,887,889,896,895,897,896,897,895,898,898,895,899,898,899,900,
-901,898,900,901,900,902,903,901,902,903,902,904,905,903,904,905,
-904,906,907,905,906,907,906,908,909,907,908,909,908,910,911,909,
-910,911,910,912,910,913,912,912,913,914,913,915,914,915,916,914,
-916,917,914,916,918,917,918,919,917,917,919,920,919,921,920,920,
-921,922,921,923,922,922,923,924,923,925,924,925,926,924,926,927,
-924,926,928,927,928,929,927,928,930,929,930,931,929,930,932,931,
-932,933,931,933,932,934,934,932,935,932,936,935,932,930,936,928,
-926,937,926,938,937,937,938,864,937,864,865,939,937,865,928,937,
-939,930,928,939,930,939,936,939,865,866,936,939,866,936,866,935,
-938,863,864,940,863,938,940,860,863,941,940,938,941,938,926,925,
-941,926,857,860,940,942,857,940,942,940,941,943,941,925,923,943,
-925,855,857,942,944,855,942,942,941,945,944,942,945,946,943,923,
-921,946,923,853,855,944,947,853,944,947,944,945,948,947,945,851,
-853,947,949,851,947,949,947,948,950,949,948,951,946,921,919,951,
-921,850,851,949,952,949,950,953,952,950,952,953,954,955,952,954,
-955,954,956,957,955,956,957,956,958,959,957,958,960,959,958,667,
-959,960,669,667,960,669,960,961,672,669,961,672,961,675,675,961,
-962,675,962,676,962,963,676,676,963,677,963,964,677,677,964,678,
-964,965,678,962,966,963,966,967,963,963,967,964,967,966,968,969,
-967,968,970,967,969,967,970,964,964,970,965,971,970,969,972,970,
-971,970,972,965,965,972,973,678,965,973,972,974,973,972,975,974,
-975,972,971,968,966,976,966,977,976,978,977,966,962,978,966,961,
-978,962,961,960,978,978,979,977,979,980,977,977,980,976,980,981,
-976,978,960,958,979,982,980,982,983,980,980,983,981,983,984,981,
-982,985,983,985,986,983,983,986,984,986,987,984,985,988,986,988,
-989,986,986,989,987,989,990,987,981,984,991,981,991,992,976,981,
-992,976,992,968,992,993,968,968,993,969,993,994,969,969,994,971,
-994,995,971,971,995,975,995,996,975,987,990,997,987,997,998,984,
-998,991,984,987,998,990,999,997,999,1000,997,1000,1001,997,997,1001,
-998,1001,1002,998,998,1002,991,1002,1003,991,991,1003,992,995,1004,996,
-1005,1004,995,1004,1006,996,996,1006,1007,996,1007,1008,975,996,1008,975,
-1008,1009,974,975,1009,1008,1010,1009,1010,1011,1009,1011,1010,1012,1011,1012,
-1013,1014,1011,1013,1009,1011,1014,1015,1014,1013,1016,1015,1013,1015,1016,1017,
-1018,1015,1017,1018,1017,1019,1020,1018,1019,1019,1021,1020,1021,1022,1020,1020,
-1022,1023,1024,1020,1023,1024,1023,1025,1023,1026,1025,1027,1021,1019,1028,1027,
-1019,1019,1017,1028,1025,1026,1029,1026,1030,1029,1029,1030,1031,1030,1032,1031,
-1031,1032,1033,1032,1034,1033,1033,1034,679,1034,1035,679,1036,1027,1028,1037,
-1036,1028,1038,1036,1037,1039,1038,1037,1040,1038,1039,1041,1040,1039,1033,973,
-1031,679,973,1033,973,1042,1031,1031,1042,1029,1042,1043,1029,1042,973,1043,
-1039,1044,1041,1044,1045,1041,1041,1045,1040,1046,1044,1039,1037,1046,1039,1047,
-1046,1037,1028,1047,1037,1017,1047,1028,1017,1016,1047,1016,1048,1047,1047,1048,
-1046,1048,1049,1046,1046,1049,1044,1045,1050,1040,1040,1050,688,1050,689,688,
-1044,1051,1045,1049,1051,1044,1051,1052,1045,1045,1052,1050,1052,1053,1050,1050,
-1053,689,1016,1013,1048,1013,1054,1048,1048,1054,1049,1049,1054,1051,1051,1055,
-1052,1054,1055,1051,1055,689,1053,1052,1055,1053,690,689,1055,1056,690,1055,
-1056,1055,1054,690,1056,1057,1058,690,1057,1058,1057,1059,1057,1060,1059,1059,
-1060,1061,1060,1062,1061,1060,1063,1062,1063,1064,1062,1064,1063,1065,1066,1064,
-1065,1066,1065,1067,1068,1066,1067,1068,1067,1069,1070,1068,1069,1069,1067,1071,
-1072,1069,1071,1072,1071,1073,1073,1071,1074,1067,1065,1074,1071,1067,1074,1075,
-1073,1074,1073,1075,1076,1073,1076,1077,1077,1076,1078,1076,1079,1078,1078,1079,
-1080,1079,1081,1080,1080,1081,1082,1081,1083,1082,1082,1083,1084,1083,1085,1084,
-1084,1085,1086,1085,1087,1086,1086,1087,1088,1087,1089,1088,1088,1089,1001,1000,
-1088,1001,1001,1089,1002,1089,1090,1002,1005,1090,1089,1087,1005,1089,1087,1085,
-1005,1085,1004,1005,1006,1004,1085,1083,1006,1085,1091,1006,1083,1006,1091,1007,
-1007,1091,1092,1007,1092,1008,1092,1010,1008,1010,1092,1093,1094,1010,1093,1010,
-1094,1012,1094,1093,1095,1093,1075,1095,1091,1096,1092,1092,1096,1093,1096,1097,
-1093,1093,1097,1075,1096,1091,1081,1081,1091,1083,1079,1096,1081,1097,1096,1079,
-1076,1097,1079,1075,1097,1076,1095,1075,1098,1075,1074,1098,1074,1065,1098,1065,
-1063,1098,1098,1063,1060,1099,1098,1060,1098,1099,1095,1100,1012,1094,1099,1100,
-1095,1095,1100,1094,1099,1101,1100,1100,1101,1012,1101,1013,1012,1102,1101,1099,
-1101,1102,1013,1057,1102,1099,1057,1099,1060,1056,1102,1057,1102,1054,1013,1102,
-1056,1054,1103,245,248,1104,1103,248,1103,244,245,1103,1105,244,1105,1106,
-244,244,1106,242,1106,1107,242,242,1107,241,1107,1108,241,1105,1109,1106,
-1109,1110,1106,1106,1110,1107,1110,1111,1107,1107,1111,1108,1111,1112,1108,1113,
-1105,1103,1104,1113,1103,1114,1113,1104,1115,1114,1104,1116,1109,1105,1113,1116,
-1105,1113,1114,1116,1117,1110,1109,1116,1117,1109,1114,1117,1116,1118,1111,1110,
-1117,1118,1110,1115,1119,1114,1119,1120,1114,1120,1118,1117,1114,1120,1117,1108,
-447,241,447,449,241,446,447,1108,1112,446,1108,1115,1121,1119,248,1121,
-1115,1104,248,1115,1121,302,1119,302,1122,1119,1119,1122,1120,302,437,1122,
-437,302,435,302,303,435,435,303,433,303,316,433,433,316,431,316,
-315,431,431,315,429,315,319,429,429,319,427,319,328,427,427,328,
-334,425,427,334,437,1123,1122,437,439,1123,1123,439,1124,439,441,1124,
-1124,441,455,1123,1124,1125,1122,1123,1125,1122,1125,1120,1125,1126,1120,1126,
-1127,1120,1120,1127,1118,1127,1128,1118,1118,1128,1111,1128,1129,1111,1111,1129,
-1112,1129,1130,1112,1131,1126,1125,1124,1131,1125,1132,1131,1124,455,1132,1124,
-1133,1132,455,446,1133,455,1130,1133,446,1112,1130,446,1132,1134,1131,1134,
-1135,1131,1131,1135,1126,1135,1134,1136,1137,1135,1136,1135,1137,1126,1126,1137,
-1127,1137,1136,1138,1128,1138,1129,1138,1136,1139,1138,1139,1129,1129,1139,1130,
-1136,1140,1139,1136,1134,1140,1139,1140,1130,1130,1140,1133,1141,1137,1138,1134,
-1142,1140,1140,1142,1133,1142,1134,1132,1133,1142,1132,1137,1141,1127,1141,1138,
-1128,1127,1141,1128,1144,1143,56,58,1144,56,56,1143,57,1143,1145,57,
-58,1146,1144,59,1146,58,1146,1147,1144,1147,1148,1144,1148,1149,1144,1144,
-1149,1143,57,1145,1150,57,1150,41,1150,24,41,24,26,41,50,57,
-41,1145,1151,1150,1150,1151,24,1151,22,24,1151,1152,22,1152,21,22,
-1153,1152,1151,1145,1153,1151,1154,1153,1145,1149,1154,1143,1143,1154,1145,1148,
-1155,1149,1155,1156,1149,1149,1156,1154,1155,1157,1156,1157,1158,1156,1158,1159,
-1156,1159,1160,1156,1156,1160,1154,1154,1160,1153,1159,1161,1160,1161,1162,1160,
-1161,1163,1162,1163,1164,1162,1163,182,1164,182,1165,1164,1157,200,1158,200,
-197,1158,1158,197,1159,197,195,1159,1159,195,1161,195,193,1161,1161,193,
-1163,193,184,1163,1163,184,182,1162,1164,1166,1160,1162,1166,1160,1166,1153,
-1153,1166,1152,1166,1167,1152,1164,1165,1167,1166,1164,1167,1152,1167,21,1167,
-1168,21,21,1168,18,1168,16,18,1168,8,16,1167,1165,8,1168,1167,
-8,1165,182,9,8,1165,9,182,180,9,9,180,10,180,177,10,
-10,177,11,264,1170,1169,265,264,1169,1169,1170,1171,1170,1172,1171,264,
-249,1170,249,247,1170,1170,247,1172,247,246,1172,1172,1173,1171,1173,1174,
-1171,1175,1173,1172,246,1175,1172,243,1175,246,243,240,1175,240,235,1175,
-1175,235,1173,235,234,1173,1173,234,1174,234,236,1174,1171,1174,1148,1147,
-1171,1148,1169,1171,1147,1146,1169,1147,265,1169,1146,59,265,1146,263,265,
-59,53,263,59,262,263,53,54,262,53,272,262,54,72,272,54,
-72,73,272,73,275,272,283,275,73,74,283,73,74,75,283,75,
-1176,283,1176,75,1177,75,76,1177,1178,1177,76,1179,1178,76,1179,76,
-77,1180,1179,77,1181,1180,77,1182,1181,77,1182,77,69,1181,1183,1180,
-1183,1184,1180,1183,1185,1184,1185,1186,1184,1185,1187,1186,1187,1188,1186,1178,
-1189,1177,1189,285,1177,285,1189,278,1189,1190,278,278,1190,279,1190,1191,
-279,279,1191,281,1191,1192,281,281,1192,286,1192,1193,286,286,1193,289,
-1193,1194,289,1193,1195,1194,1195,1196,1194,289,1194,1197,1198,289,1197,1198,
-1197,1199,1200,1198,1199,1198,1200,1201,1200,1202,1201,1200,1203,1202,1203,1204,
-1202,1203,347,1204,347,345,1204,1204,345,339,1204,339,1202,1199,1197,1205,
-1197,1206,1205,1194,1196,1206,1197,1194,1206,339,335,1202,1198,1201,288,289,
-1198,288,313,288,1201,336,313,1201,336,1201,1202,335,336,1202,1207,1203,
-1200,1199,1207,1200,1208,1207,1199,1205,1208,1199,1208,1209,1207,1209,1210,1207,
-1210,1209,1211,357,1210,1211,357,1211,358,1211,1212,358,358,1212,360,1212,
-1213,360,360,1213,365,1213,1214,365,365,1214,366,1214,1215,366,366,1215,
-367,1215,1216,367,367,1216,1217,369,367,1217,347,1210,357,1210,347,1203,
-1207,1210,1203,1212,1218,1213,1219,1218,1212,1219,1220,1218,1220,1221,1218,1218,
-1221,1222,1221,1223,1222,1223,1224,1222,1224,1225,1222,1224,1226,1225,1226,1227,
-1225,1227,1226,1228,1229,1227,1228,1229,1228,1230,1231,1229,1230,1230,1228,1232,
-1228,1233,1232,1232,1233,1234,1235,1232,1234,1235,1234,1236,1234,1237,1236,1234,
-1238,1237,1238,1239,1237,1239,1238,1240,1241,1239,1240,1241,1240,1242,1243,1241,
-1242,1243,1242,1244,1245,1243,1244,1242,1246,1244,1242,1240,1246,1246,1247,1244,
-1240,1248,1246,1240,1238,1248,1238,1249,1248,1249,1238,1234,1233,1249,1234,1244,
-1250,1245,1244,1247,1250,1250,1251,1245,1247,1252,1250,1233,1228,1249,1228,1226,
-1249,1249,1226,1248,1226,1224,1248,1248,1224,1246,1224,1223,1246,1246,1223,1221,
-1247,1246,1221,1247,1221,1252,1221,1220,1252,1250,1253,1251,1253,1254,1251,1255,
-1253,1250,1252,1255,1250,1256,1255,1252,1220,1256,1252,1257,1256,1220,1219,1257,
-1220,1253,1255,1258,1259,1253,1258,1253,1259,1254,1259,1258,1260,1261,1259,1260,
-1260,1258,1262,1258,1263,1262,1255,1256,1263,1258,1255,1263,1262,1263,1264,1263,
-1265,1264,1256,1257,1265,1263,1256,1265,1259,1266,1254,1259,1261,1266,1261,1267,
-1266,1266,1267,1268,1267,1269,1268,1268,1269,1270,1268,1270,1271,1272,1268,1271,
-1266,1268,1272,1269,1273,1270,1254,1266,1272,1254,1272,1251,1272,1274,1251,1251,
-1274,1275,1276,1275,1274,1277,1276,1274,1277,1274,1272,1271,1277,1272,1276,1277,
-1278,1277,1279,1278,1279,1277,1271,1279,1280,1278,1280,1281,1278,1281,1280,1282,
-1283,1281,1282,1283,1282,1284,1285,1283,1284,1284,1282,1286,1282,1287,1286,1288,
-1287,1282,1280,1288,1282,1289,1288,1280,1279,1289,1280,1275,1276,1243,1245,1275,
-1243,1276,1278,1241,1243,1276,1241,1278,1281,1239,1241,1278,1239,1239,1281,1283,
-1237,1239,1283,1237,1283,1285,1236,1237,1285,1290,1287,1288,1291,1290,1288,1291,
-1288,1289,1292,1290,1291,1293,1292,1291,1294,1292,1293,1295,1294,1293,1296,1294,
-1295,1297,1296,1295,1298,1296,1297,1299,1298,1297,1300,1298,1299,1301,1300,1299,
-716,1300,1301,714,716,1301,716,718,1300,718,1302,1300,1300,1302,1298,1302,
-1303,1298,1298,1303,1296,1303,1304,1296,1296,1304,1294,1304,1305,1294,1294,1305,
-1292,1305,1306,1292,1292,1306,1290,1306,1307,1290,1290,1307,1287,1307,1286,1287,
-714,1301,1308,714,1308,1309,712,714,1309,712,1309,1310,1311,712,1310,1311,
-1310,1312,1188,1311,1312,1186,1188,1312,1313,1186,1312,1184,1186,1313,1314,1184,
-1313,1180,1184,1314,1179,1180,1314,1179,1314,1315,1178,1179,1315,1178,1315,1316,
-1316,1315,1317,1316,1317,1318,1319,1316,1318,1319,1318,1269,1320,1319,1269,1321,
-1320,1269,1321,1192,1320,1193,1192,1321,1195,1193,1321,1192,1191,1320,1267,1321,
-1269,1195,1321,1267,1261,1195,1267,1195,1261,1196,1261,1260,1196,1196,1260,1262,
-1206,1196,1262,1206,1262,1264,1205,1206,1264,1205,1264,1208,1264,1265,1208,1208,
-1265,1209,1265,1257,1209,1209,1257,1211,1257,1219,1211,1211,1219,1212,1191,1190,
-1320,1190,1319,1320,1190,1189,1319,1189,1316,1319,1189,1178,1316,1322,181,183,
-185,1322,183,1323,1322,185,187,1323,185,1323,1324,1322,1324,1325,1322,1322,
-1325,181,1325,179,181,1325,1326,179,1326,178,179,1327,1326,1325,1324,1327,
-1325,187,189,1323,189,1328,1323,1323,1328,1324,1328,1329,1324,189,191,1328,
-191,1330,1328,1328,1330,1329,1330,1331,1329,1327,140,1326,140,139,1326,1326,
-139,178,139,141,178,178,141,176,141,142,176,1327,1332,140,1332,1333,
-140,140,1333,134,1333,1334,134,134,1334,1335,133,134,1335,133,1335,1336,
-128,133,1336,128,1336,116,1336,1337,116,116,1337,112,1337,1338,112,112,
-1338,110,1338,1339,110,110,1339,109,1339,1340,109,109,1340,103,1340,1341,
-103,103,1341,82,1341,84,82,1336,1335,1342,1336,1342,1337,1335,1343,1342,
-1343,1344,1342,1344,1345,1342,1344,645,1345,647,645,1344,1346,647,1344,1346,
-1344,1343,650,647,1346,1347,650,1346,652,650,1347,1348,652,1347,654,652,
-1348,1349,654,1348,656,654,1349,1350,656,1349,658,656,1350,1351,658,1350,
-645,644,1345,1345,644,1352,644,642,1352,1352,642,1353,642,640,1353,1353,
-640,1354,640,638,1354,1354,638,1355,638,637,1355,1355,637,1356,637,1357,
-1356,637,634,1357,634,622,1357,1357,622,619,1357,619,1358,1356,1357,1358,
-1358,619,1359,619,617,1359,1359,617,614,1360,1359,614,1360,614,1361,614,
-610,1361,1361,610,607,1361,607,606,1362,1361,606,1360,1361,1362,1363,1360,
-1362,1360,1363,1359,1363,1364,1359,1358,1359,1364,1365,1358,1364,1356,1358,1365,
-1366,1356,1365,1355,1356,1366,1367,1355,1366,1354,1355,1367,1368,1354,1367,1353,
-1354,1368,1369,1353,1368,1352,1353,1369,1370,1352,1369,1345,1352,1370,1342,1345,
-1370,1342,1370,1337,1370,1369,1338,1337,1370,1338,1369,1368,1339,1338,1369,1339,
-1368,1367,1340,1339,1368,1340,1367,1366,1341,1340,1367,1341,1341,1366,84,1366,
-1365,84,84,1365,85,1365,1364,85,85,1364,1363,604,85,1363,604,1363,
-603,1363,1362,603,603,1362,605,1362,606,605,1371,175,156,155,1371,156,
-1372,1371,155,157,1372,155,1373,1372,157,158,1373,157,159,1373,158,1373,
-1374,1372,1374,1375,1372,1372,1375,1371,1375,1376,1371,1371,1376,175,1376,1377,
-175,175,1377,174,1377,1378,174,174,1378,173,1378,1379,173,173,1379,172,
-1379,1380,172,172,1380,1381,172,1381,171,171,1381,170,1381,1382,170,1381,
-1380,1382,170,1382,169,1382,1383,169,169,1383,168,1383,1384,168,168,1384,
-167,1384,1385,167,167,1385,166,1385,1386,166,166,1386,1387,165,166,1387,
-165,1387,164,1387,1388,164,164,1388,163,1388,162,163,1382,1389,1383,1380,
-1389,1382,1389,1390,1383,1383,1390,1384,1390,1389,1380,1390,1391,1384,1384,1391,
-1385,1391,1392,1385,1385,1392,1386,1392,1393,1386,1386,1393,1387,1393,1394,1387,
-1387,1394,1388,1394,1395,1388,1388,1395,162,1395,1396,162,162,1396,161,1396,
-1397,161,161,1397,160,1397,1398,160,160,1398,159,1398,1399,159,1397,1396,
-1399,1398,1397,1399,159,1399,1373,1399,1374,1373,1396,1395,1374,1399,1396,1374,
-1393,1392,1377,1376,1393,1377,1394,1393,1376,1395,1394,1375,1374,1395,1375,1375,
-1394,1376,1377,1392,1378,1392,1391,1378,1378,1391,1379,1391,1390,1379,1379,1390,
-1380,1400,1332,1327,1324,1400,1327,1401,1400,1324,1329,1401,1324,1402,1401,1329,
-1331,1402,1329,1402,1403,1401,1403,1404,1401,1401,1404,1400,1403,1351,1404,1351,
-1350,1404,1404,1350,1405,1404,1405,1400,1400,1405,1332,1350,1349,1405,1405,1349,
-1406,1405,1406,1332,1349,1348,1406,1406,1348,1407,1348,1347,1407,1407,1347,1408,
-1347,1346,1408,1408,1346,1343,1406,1407,1333,1332,1406,1333,1407,1408,1334,1333,
-1407,1334,1334,1408,1343,1335,1334,1343,658,1351,1409,848,658,1409,848,1409,
-1410,846,848,1410,846,1410,1411,844,846,1411,844,1411,1412,842,844,1412,
-842,1412,1413,839,842,1413,839,1413,1414,837,839,1414,837,1414,1415,836,
-837,1415,836,1415,1416,834,836,1416,834,1416,1417,832,834,1417,832,1417,
-1418,830,832,1418,830,1418,1419,829,830,1419,829,1419,1420,1421,829,1420,
-826,829,1421,820,826,1421,820,1421,817,1421,1420,1422,817,1421,1422,817,
-1422,1423,815,817,1423,815,1423,812,1423,1424,812,812,1424,1425,809,812,
-1425,809,1425,1426,807,809,1426,807,1426,1427,805,807,1427,805,1427,1428,
-802,805,1428,802,1428,800,800,1428,1429,1429,1430,800,1430,1429,1431,1431,
-1429,1432,1429,1433,1432,1428,1433,1429,1428,1427,1433,1432,1433,1434,1427,1434,
-1433,1427,1426,1434,1435,1432,1434,1435,1434,1436,1434,1437,1436,1436,1437,1438,
-1437,1439,1438,1436,1438,1440,1441,1436,1440,1435,1436,1441,1438,1439,1442,1439,
-1443,1442,1442,1443,1444,1443,1445,1444,1444,1445,1446,1445,1447,1446,1448,1446,
-1447,1449,1448,1447,1444,1446,1450,1451,1444,1450,1442,1444,1451,1451,1450,1452,
-1453,1451,1452,1454,1450,1446,1448,1454,1446,1455,1448,1449,1456,1455,1449,1457,
-1454,1448,1455,1457,1448,1458,1452,1450,1454,1458,1450,1458,1454,1457,1443,1459,
-1445,1459,1460,1445,1461,1459,1443,1439,1461,1443,1462,1451,1453,1462,1442,1451,
-1438,1442,1462,1440,1438,1462,1463,1462,1453,1440,1462,1463,1464,1440,1463,1464,
-1465,1440,1465,1441,1440,1466,1441,1465,1466,1435,1441,1467,1466,1465,1466,1467,
-1468,1432,1466,1468,1435,1466,1432,1469,1461,1439,1470,1469,1439,1470,1439,1437,
-1471,1470,1437,1471,1437,1434,1472,1471,1434,1468,1473,1432,1473,1431,1432,1474,
-1473,1468,1475,1474,1468,1468,1467,1475,1467,1476,1475,1476,1467,544,1467,1465,
-544,544,1465,1464,536,544,1464,536,1464,533,1464,1463,533,533,1463,1453,
-523,533,1453,523,1453,1452,524,523,1452,524,1452,1458,526,524,1458,526,
-1458,1477,1477,1458,1457,1477,1457,1478,1478,1457,1455,1479,1478,1455,1479,1455,
-1456,1480,1479,1456,1481,1477,1478,1482,1481,1478,1483,1482,1478,1483,1478,1479,
-1480,1456,1484,1484,1456,1485,1486,1484,1485,1487,1486,1485,1486,1487,1488,1489,
-1486,1488,1488,1487,1490,1487,1491,1490,1492,1490,1491,1493,1492,1491,1494,1492,
-1493,1495,1494,1493,1489,1488,1496,1497,1489,1496,1488,1490,1498,1496,1488,1498,
-1499,1498,1490,1492,1499,1490,1499,1492,1494,1500,1499,1494,1501,1495,1493,1502,
-1501,1493,1493,1491,1503,1502,1493,1503,1491,1487,1503,1487,1485,1503,1460,1501,
-1502,1445,1460,1502,1445,1502,1503,1447,1445,1503,1449,1447,1503,1485,1449,1503,
-1500,1494,1504,1505,1500,1504,1505,1504,1506,1507,1505,1506,1506,1504,1508,1509,
-1506,1508,1507,1506,1509,1509,1508,1510,1508,1511,1510,1510,1511,1512,1512,1511,
-1460,1513,1510,1512,1514,1513,1512,1515,1514,1512,1516,1514,1515,1517,1516,1515,
-1518,1516,1517,1519,1518,1517,1508,1495,1511,1508,1504,1495,1504,1494,1495,1495,
-1501,1511,1511,1501,1460,1512,1460,1459,1515,1512,1459,1515,1459,1461,1517,1515,
-1461,1517,1461,1469,1519,1517,1469,1514,1516,1520,1516,1521,1520,1514,1520,1522,
-1513,1514,1522,1513,1522,1523,1510,1513,1523,1523,1522,1524,1522,1525,1524,1522,
-1520,1525,1524,1525,1526,1525,1527,1526,1525,1528,1527,1520,1528,1525,1520,1521,
-1528,1528,1529,1527,1528,1530,1529,1521,1530,1528,1530,1531,1529,1523,1524,1532,
-1523,1532,1510,1524,1533,1532,1532,1533,1534,1533,1535,1534,1535,1533,1524,1526,
-1535,1524,1532,1534,1536,1509,1532,1536,1532,1509,1510,1536,1507,1509,1529,1531,
-1537,1531,1538,1537,1537,1538,1539,1537,1539,1540,1541,1537,1540,1529,1537,1541,
-1538,1542,1539,1541,1540,1543,1544,1541,1543,1544,1543,1545,1543,1546,1545,1547,
-1545,1546,1535,1545,1547,1534,1535,1547,1548,1547,1546,1549,1547,1548,1550,1549,
-1548,1551,1549,1550,1552,1551,1550,1539,1542,1553,1542,1554,1553,1555,1553,1554,
-1555,1556,1553,1557,1556,1555,1558,1557,1555,1558,1555,1559,1559,1555,1554,1560,
-1558,1559,1557,1561,1556,1561,1562,1556,1556,1563,1553,1556,1562,1563,1562,1564,
-1563,1558,1560,1565,1560,1566,1565,1558,1565,1567,1557,1558,1567,1557,1567,1568,
-1561,1557,1568,1561,1568,1569,1568,1570,1569,1571,1569,1570,1572,1571,1570,1573,
-1571,1572,1574,1573,1572,1571,1573,1575,1573,1576,1575,1575,1576,1577,1576,1578,
-1577,1571,1575,1579,1569,1571,1579,1575,1577,1580,1579,1575,1580,1581,1573,1574,
-1573,1581,1576,1582,1581,1574,1576,1583,1578,1581,1583,1576,1583,1584,1578,1579,
-1580,1564,1562,1579,1564,1562,1561,1579,1561,1569,1579,1543,1564,1580,1543,1540,
-1564,1540,1563,1564,1540,1539,1563,1539,1553,1563,1546,1543,1580,1546,1580,1577,
-1548,1546,1577,1548,1577,1578,1550,1548,1578,1550,1578,1584,1552,1550,1584,1585,
-1552,1584,1585,1586,1552,1586,1551,1552,1586,1587,1551,1587,1505,1551,1551,1505,
-1507,1507,1536,1551,1536,1549,1551,1536,1534,1549,1534,1547,1549,1587,1588,1505,
-1588,1589,1505,1589,1500,1505,1589,1590,1500,1590,1499,1500,1590,1591,1499,1591,
-1498,1499,1496,1498,1591,1592,1496,1591,1592,1593,1496,1593,1497,1496,1593,1594,
-1497,1594,1595,1497,1595,1596,1497,1597,1596,1595,1597,1598,1596,1598,1599,1596,
-1600,1597,1595,1596,1599,1489,1596,1489,1497,1599,1486,1489,1599,1601,1486,1601,
-1484,1486,1601,1480,1484,1602,1601,1599,1598,1602,1599,1603,1480,1601,1602,1603,
-1601,1603,1604,1480,1604,1479,1480,1604,1483,1479,1605,1483,1604,1605,1606,1483,
-1607,1606,1605,1608,1607,1605,1609,1608,1605,1610,1609,1605,1610,1605,1604,1610,
-1604,1603,1611,1609,1610,1612,1611,1610,1613,1611,1612,1614,1613,1612,1615,1613,
-1614,1616,1615,1614,1617,1607,1608,1618,1617,1608,1618,1608,1609,1619,1617,1618,
-1620,1619,1618,1621,1619,1620,1622,1621,1620,1623,1621,1622,1624,1623,1622,205,
-1623,1624,206,205,1624,1625,1620,1618,1626,1625,1618,1627,1622,1620,1625,1627,
-1620,1628,1624,1622,1627,1628,1622,209,206,1624,1628,209,1624,1629,1625,1626,
-1630,1629,1626,1631,1627,1625,1629,1631,1625,1632,1628,1627,1631,1632,1627,212,
-209,1628,1632,212,1628,1633,1629,1630,1634,1633,1630,1635,1633,1634,1636,1635,
-1634,1635,1637,1633,1637,1638,1633,1638,1631,1629,1633,1638,1629,1637,1639,1638,
-1639,1640,1638,1640,1632,1631,1638,1640,1631,1639,191,1640,191,192,1640,192,
-212,1632,1640,192,1632,1634,1630,1613,1630,1611,1613,1630,1626,1611,1626,1609,
-1611,1626,1618,1609,1634,1613,1615,1636,1634,1615,1641,1635,1636,1642,1641,1636,
-1642,1636,1615,1643,1642,1615,1644,1641,1642,1644,1645,1641,1645,1646,1641,1641,
-1646,1635,1646,1637,1635,1647,1644,1642,1647,1642,1643,1648,1647,1643,1649,1644,
-1647,1650,1649,1647,1650,1647,1648,1651,1645,1644,1649,1651,1644,1652,1650,1648,
-1639,1637,1646,1653,1639,1646,1653,1646,1645,1654,1653,1645,191,1639,1653,1330,
-191,1653,1330,1653,1654,1331,1330,1654,1652,1648,1655,1648,1656,1655,1657,1655,
-1656,1658,1657,1656,1659,1657,1658,1660,1659,1658,1660,1658,1661,1662,1660,1661,
-1662,1661,1663,1664,1662,1663,1663,1661,1665,1661,1666,1665,1658,1656,1666,1661,
-1658,1666,1667,1659,1660,1668,1667,1660,1668,1660,1662,1669,1668,1662,1669,1662,
-1664,1664,1663,1670,1663,1671,1670,1663,1665,1671,1670,1671,1600,1671,1597,1600,
-1671,1672,1597,1665,1672,1671,1672,1598,1597,1672,1673,1598,1673,1672,1665,1673,
-1602,1598,1673,1674,1602,1674,1603,1602,1674,1610,1603,1612,1610,1674,1614,1612,
-1674,1614,1674,1673,1616,1614,1673,1616,1673,1665,1616,1665,1666,1615,1616,1666,
-1643,1615,1666,1643,1666,1656,1648,1643,1656,665,957,959,667,665,959,665,
-663,957,663,955,957,663,662,955,662,661,955,661,952,955,952,661,
-949,661,850,949,664,666,648,649,664,648,648,666,646,666,668,646,
-646,668,643,668,670,643,643,670,641,670,671,641,641,671,639,671,
-673,639,639,673,636,673,635,636,609,625,608,608,625,1675,625,628,
-1675,1675,628,1676,628,632,1676,1676,632,697,700,1676,697,696,697,632,
-630,696,632,696,630,692,630,631,692,700,1183,1676,1183,700,1185,700,
-699,1185,699,703,1185,703,1187,1185,703,1677,1187,1678,1677,703,702,1678,
-703,1679,1678,702,701,1679,702,701,693,1679,693,705,1679,1679,709,1678,
-709,1679,705,709,710,1678,1678,710,1680,1677,1678,1680,1677,1680,1187,1187,
-1680,1188,1680,1311,1188,1680,710,1311,710,712,1311,1683,1682,1681,1684,1683,
-1681,1683,1685,1682,1683,1686,1685,1686,1687,1685,1684,1681,1040,688,1684,1040,
-1681,1682,1038,1040,1681,1038,1682,1685,1036,1038,1682,1036,1687,1686,1021,1021,
-1686,1022,1686,1688,1022,1023,1022,1688,1689,1023,1688,1023,1689,1026,1026,1689,
-1030,1689,1690,1030,1030,1690,1032,1032,1690,1034,1690,1691,1034,1034,1691,1035,
-1691,1692,1035,1692,1693,1035,1693,1694,1035,1035,1694,679,1694,686,679,1694,
-1695,686,1695,1696,686,1697,1695,1694,1693,1697,1694,1696,1698,686,1698,687,
-686,687,1698,1684,688,687,1684,1695,1699,1696,1699,1700,1696,1701,1699,1695,
-1697,1701,1695,1698,1702,1684,1702,1703,1684,1703,1702,1704,1704,1702,1705,1705,
-1702,1698,1696,1705,1698,1706,1704,1705,1706,1705,1696,1700,1706,1696,1707,1704,
-1706,1708,1707,1706,1708,1706,1700,1699,1708,1700,1709,1707,1708,1710,1709,1708,
-1710,1708,1699,1701,1710,1699,1711,1709,1710,1712,1711,1710,1712,1710,1713,1713,
-1710,1701,1714,1712,1713,1715,1714,1713,1716,1715,1713,1703,1704,1683,1684,1703,
-1683,1716,1713,1697,1693,1716,1697,1715,1716,1693,1692,1715,1693,1714,1715,1692,
-1691,1714,1692,1712,1714,1691,1707,1709,1688,1686,1707,1688,1704,1707,1686,1683,
-1704,1686,1711,1712,1690,1689,1711,1690,1709,1711,1689,1688,1709,1689,1690,1712,
-1691,1697,1713,1701,1043,1717,1025,1029,1043,1025,1025,1717,1024,1717,1718,1024,
-1024,1718,1020,1718,1018,1020,1718,1719,1018,1719,1015,1018,1720,1719,1718,1717,
-1720,1718,1719,1721,1015,1721,1014,1015,1721,1009,1014,1722,1720,1717,1043,1722,
-1717,973,1722,1043,973,1719,1720,1722,973,1720,1721,973,1009,1719,973,1721,
-973,974,1009,679,678,973,994,1005,995,1723,1005,994,993,1723,994,1003,
-1723,993,992,1003,993,1090,1723,1003,1005,1723,1090,1002,1090,1003,1724,1073,
-1077,1724,1072,1073,1727,1726,1725,1728,1727,1725,1727,1729,1726,1729,1730,1726,
-1729,1731,1730,1731,1732,1730,1732,1731,1733,1734,1732,1733,1734,1733,1735,1736,
-1734,1735,1728,1737,1727,1737,1738,1727,1727,1738,1729,1738,1739,1729,1729,1739,
-1731,1739,1740,1731,1731,1740,1741,1733,1731,1741,1733,1741,1742,1735,1733,1742,
-1730,1732,1064,1064,1732,1734,1066,1730,1064,1726,1730,1066,1068,1726,1066,1725,
-1726,1068,1070,1725,1068,1062,1064,1734,1062,1734,1736,1061,1062,1736,1061,1736,
-732,722,1061,732,1059,1061,722,720,1059,722,1058,1059,720,706,1058,720,
-690,1058,706,704,690,706,685,690,704,691,685,704,732,1736,734,1736,
-1735,734,734,1735,748,1735,1742,748,1742,1743,748,1743,1744,748,1743,1745,
-1744,1743,1746,1745,1746,1747,1745,1746,1748,1747,1748,1749,1747,1749,1748,1750,
-1751,1749,1750,1751,1750,1752,1753,1751,1752,1753,1752,1754,1752,1755,1754,1745,
-1756,1744,1744,1756,1757,1756,1758,1757,1759,1757,1758,1760,1759,1758,1759,1760,
-1761,1760,1762,1761,1761,1762,1763,1762,1764,1763,1763,1764,1765,1764,1766,1765,
-1765,1766,1767,1766,1768,1767,1767,1768,1769,1770,1767,1769,1767,1770,755,754,
-1767,755,1765,1767,754,753,1765,754,1763,1765,753,752,1763,753,1761,1763,
-752,751,1761,752,1761,751,1759,751,750,1759,750,749,1759,749,1757,1759,
-1744,1757,749,748,1744,749,1766,1771,1768,1772,1771,1766,1764,1772,1766,1773,
-1772,1764,1762,1773,1764,1774,1773,1762,1760,1774,1762,1775,1774,1760,1758,1775,
-1760,1776,1775,1758,1756,1776,1758,1777,1776,1756,1745,1777,1756,1745,1747,1777,
-1747,1778,1777,1747,1749,1778,1749,1779,1778,1779,1749,1751,1780,1779,1751,1781,
-1780,1751,1753,1781,1751,1781,1753,1754,1782,1781,1754,1782,1783,1781,1783,1784,
-1781,1781,1784,1780,1784,1785,1780,1785,1786,1780,1780,1786,1779,1786,1787,1779,
-1779,1787,1788,1778,1779,1788,1777,1778,1788,1789,1777,1788,1783,1790,1784,1790,
-1791,1784,1784,1791,1785,1791,1792,1785,1785,1792,1786,1792,1793,1786,1793,1794,
-1786,1786,1794,1787,1794,1795,1787,1788,1787,1795,1796,1788,1795,1788,1797,1789,
-1797,1788,1796,1797,1798,1789,1790,1799,1791,1799,1800,1791,1791,1800,1792,1800,
-1801,1792,1792,1801,1802,1793,1792,1802,1798,1803,1789,1803,1804,1789,1803,1805,
-1804,1805,1806,1804,1805,1807,1806,1807,1808,1806,1807,1809,1808,1809,1810,1808,
-1811,1808,1810,1806,1808,1811,1812,1811,1810,1813,1811,1812,1814,1811,1813,1814,
-1806,1811,1804,1806,1814,1815,1814,1813,1816,1814,1815,1816,1804,1814,1817,1816,
-1815,1815,1818,1817,1815,1813,1818,1818,1819,1817,1813,1820,1818,1821,1813,1812,
-1813,1821,1820,1821,1822,1820,1817,1819,1823,1824,1817,1823,1824,1825,1817,1826,
-1816,1817,1825,1826,1817,1816,1826,1827,1804,1816,1827,1789,1804,1827,1789,1827,
-1776,1777,1789,1776,1776,1827,1775,1827,1826,1774,1775,1827,1774,1774,1826,1773,
-1826,1825,1772,1773,1826,1772,1772,1825,1771,1825,1824,1828,1771,1825,1828,1771,
-1828,1768,1768,1828,1769,1828,1829,1769,1828,1824,1829,1824,1823,1829,1829,1830,
-1769,1830,1831,1769,1831,1832,1769,1831,1833,1832,1833,1834,1832,1833,1835,1834,
-1835,1836,1834,1835,1837,1836,1837,1838,1836,1837,1839,1838,1839,1840,1838,1840,
-1839,1841,1842,1840,1841,1841,1843,1842,1843,1844,1842,1843,1845,1844,1845,1846,
-1844,1847,1846,1845,1848,1847,1845,1849,1847,1848,1850,1849,1848,1849,1850,1851,
-1850,1852,1851,1851,1852,1853,1852,1854,1853,1853,1854,1855,1856,1853,1855,1854,
-1857,1855,1857,1854,1852,1857,1858,1855,1859,1857,1852,1860,1859,1852,1850,1860,
-1852,1850,1848,1861,1860,1850,1861,1861,1848,1862,1848,1845,1862,1863,1858,1857,
-1864,1863,1857,1864,1857,1859,1865,1864,1859,1866,1865,1859,1866,1859,1860,1867,
-1866,1860,1860,1861,1868,1867,1860,1868,1861,1862,1868,1862,1869,1868,1870,1863,
-1864,1871,1870,1864,1871,1864,1865,1872,1871,1865,1872,1865,1866,1873,1872,1866,
-1874,1873,1866,1874,1866,1867,1875,1874,1867,1867,1868,1875,1868,1876,1875,1877,
-1868,1869,1868,1877,1876,1878,1877,1869,1879,1870,1871,1880,1879,1871,1880,1871,
-1872,1881,1880,1872,1872,1873,1882,1881,1872,1882,1883,1878,1869,1884,1883,1869,
-1885,1883,1884,1886,1885,1884,1887,1885,1886,1888,1887,1886,1889,1887,1888,1890,
-1889,1888,1888,1891,1890,1888,1886,1891,1891,1892,1890,1891,1893,1892,1891,1894,
-1893,1886,1894,1891,1886,1884,1894,1894,1895,1893,1894,1896,1895,1884,1896,1894,
-1896,1897,1895,1818,1895,1897,1893,1895,1818,1819,1818,1897,1820,1893,1818,1893,
-1898,1892,1898,1893,1820,1822,1898,1820,1819,1897,1823,1897,1899,1823,1900,1899,
-1897,1901,1900,1897,1896,1901,1897,1901,1896,1902,1896,1884,1902,1884,1869,1902,
-1902,1869,1903,1869,1862,1903,1903,1862,1843,1862,1845,1843,1903,1843,1841,1904,
-1903,1841,1902,1903,1904,1904,1841,1839,1905,1904,1839,1902,1904,1905,1901,1902,
-1905,1905,1839,1837,1906,1905,1837,1901,1905,1906,1906,1837,1835,1907,1906,1835,
-1901,1906,1907,1907,1835,1833,1908,1907,1833,1908,1833,1831,1830,1908,1831,1900,
-1907,1908,1900,1908,1830,1900,1901,1907,1899,1900,1830,1899,1830,1829,1823,1899,
-1829,733,737,724,724,737,726,737,739,726,726,739,729,250,1909,1121,
-248,250,1121,1121,1909,302,1909,301,302,250,252,1909,252,255,1909,1909,
-255,301,1245,1251,1275,1218,1222,1213,1213,1222,1214,1222,1225,1214,1214,1225,
-1215,1225,1227,1215,1215,1227,1216,1227,1229,1216,1216,1229,1231,1217,1216,1231,
-1910,1217,1231,1910,1911,1217,1910,1912,1911,1912,1913,1911,1913,581,1911,581,
-1913,580,1913,1914,580,1914,579,580,581,1915,1911,1911,1915,369,1911,369,
-1217,1915,370,369,1915,1916,370,1916,372,370,1916,1917,372,1917,374,372,
-1917,1918,374,1918,376,374,1918,1919,376,1919,378,376,1919,1920,378,1920,
-380,378,575,1916,1915,581,575,1915,570,1917,1916,575,570,1916,571,1918,
-1917,570,571,1917,572,1919,1918,571,572,1918,1921,1920,1919,572,1921,1919,
-1921,572,582,1921,582,1922,582,1923,1922,1922,1923,1924,1925,1922,1924,1926,
-1925,1924,1927,1926,1924,1927,1924,1928,1929,1927,1928,1929,1928,1930,1931,1929,
-1930,1931,1930,1932,1933,1931,1932,1931,1933,1934,1934,1933,1935,1936,1934,1935,
-1936,1937,1934,1937,1938,1934,1931,1934,1938,1929,1931,1938,1937,1939,1938,1939,
-1940,1938,1929,1938,1940,1927,1929,1940,1926,1927,1940,1939,1941,1940,1941,1942,
-1940,1942,1926,1940,1933,1932,1943,1944,1933,1943,1944,1935,1933,1926,1942,1945,
-1926,1945,1925,1945,1946,1925,1945,385,1946,385,384,1946,1945,1947,385,1942,
-1947,1945,1947,388,385,389,388,1947,1948,389,1947,1948,1947,1942,1941,1948,
-1942,1948,1949,389,1949,424,389,1946,384,1950,384,1951,1950,1951,384,381,
-1951,381,379,380,1951,379,1946,1950,1922,1925,1946,1922,1952,1949,1948,1941,
-1952,1948,1941,1939,1952,1939,1953,1952,1939,1937,1953,1937,1954,1953,1937,1936,
-1954,1936,1955,1954,1936,1935,1955,1935,1956,1955,1935,1944,1956,1944,1957,1956,
-1957,1944,1958,1944,1943,1958,1958,1943,1932,1959,1958,1932,1959,1932,1930,1960,
-1959,1930,1930,1928,1960,1928,1961,1960,1961,1928,1924,1923,1961,1924,1955,1956,
-1962,1955,1962,1963,1963,1962,486,1962,1964,486,1964,593,486,593,487,486,
-487,593,489,1964,591,593,1965,591,1964,1962,1965,1964,1965,589,591,1963,
-486,484,1966,1963,484,482,1966,484,1953,1966,482,1952,1953,482,482,481,
-1952,481,1949,1952,1949,481,424,481,426,424,1953,1954,1966,1954,1963,1966,
-1954,1955,1963,1957,589,1965,1956,1957,1965,1956,1965,1962,1957,1958,588,589,
-1957,588,588,1958,1959,586,588,1959,586,1959,1960,584,586,1960,1960,1961,
-584,1961,583,584,583,1961,1923,582,583,1923,1318,1317,1967,1968,1318,1967,
-1269,1318,1968,1273,1269,1968,1317,1969,1967,1315,1969,1317,1969,1970,1967,1315,
-1314,1969,1314,1313,1969,1969,1313,1970,1313,1312,1970,1970,1971,1967,1971,1972,
-1967,1967,1972,1968,1972,1973,1968,1968,1973,1273,1310,1971,1970,1312,1310,1970,
-1971,1974,1972,1974,1975,1972,1972,1975,1973,1975,1976,1973,1973,1976,1273,1976,
-1977,1273,1309,1974,1971,1310,1309,1971,1273,1977,1270,1977,1978,1270,1270,1978,
-1271,1978,1289,1271,1309,1308,1974,1308,1979,1974,1974,1979,1975,1979,1980,1975,
-1975,1980,1976,1980,1981,1976,1976,1981,1977,1981,1982,1977,1977,1982,1978,1308,
-1301,1979,1301,1299,1979,1979,1299,1980,1299,1297,1980,1980,1297,1981,1297,1295,
-1981,1981,1295,1982,1295,1293,1982,1982,1293,1978,1293,1291,1978,1978,1291,1289,
-1289,1279,1271,1174,236,1155,1148,1174,1155,1155,236,1157,236,237,1157,1157,
-237,200,237,217,200,200,217,199,217,214,199,199,214,201,213,223,
-203,203,223,225,205,203,225,1623,205,225,1983,1623,225,225,224,1983,
-224,1984,1983,224,226,1984,226,1985,1984,1983,1984,1986,1983,1986,1623,1984,
-1987,1986,1984,1985,1987,1986,1987,1988,1987,1989,1988,1988,1989,1990,1989,1991,
-1990,1989,1992,1991,1992,1993,1991,1994,1992,1989,1987,1994,1989,1985,1994,1987,
-1995,1992,1994,1992,1995,1993,1996,1995,1994,1994,1985,1997,1996,1994,1997,1997,
-1985,226,231,1997,226,1991,1993,1998,1993,1999,1998,1995,1999,1993,1998,1999,
-2000,1999,2001,2000,1998,2000,2002,2003,1998,2002,1991,1998,2003,1990,1991,2003,
-2004,1995,1996,2004,2001,1999,1995,2004,1999,2004,2005,2001,2005,2006,2001,2005,
-2007,2006,2007,2008,2006,2006,2008,2009,2008,2010,2009,2009,2010,2011,2009,2011,
-2012,2012,2011,520,2011,519,520,2011,2013,519,2010,2013,2011,2013,2014,519,
-2012,520,2015,520,2016,2015,2015,2016,2017,2016,2018,2017,2016,525,2018,525,
-526,2018,515,525,2016,520,515,2016,2019,2015,2017,2020,2019,2017,2021,2012,
-2015,2019,2021,2015,2021,2009,2012,2006,2009,2021,2001,2006,2021,2001,2021,2019,
-2022,2014,2013,2022,2023,2014,2023,2024,2014,2023,2022,2025,2025,2022,2026,2026,
-2022,2013,2026,2013,2010,2027,2026,2010,2027,2010,2008,2028,2027,2008,2028,2008,
-2007,2029,2028,2007,2030,2026,2027,2030,2025,2026,2031,2030,2027,2031,2027,2028,
-2032,2031,2028,2032,2028,2029,2033,2032,2029,2034,2025,2030,2031,2034,2030,2034,
-2023,2025,2035,2034,2031,2032,2035,2031,2035,2036,2034,2036,2023,2034,2036,2037,
-2023,2037,2024,2023,468,2029,2007,466,468,2007,466,2007,2005,464,466,2005,
-464,2005,2004,463,464,2004,463,2004,1996,463,1996,461,1996,1997,461,461,
-1997,231,2038,2024,2037,2038,519,2024,519,2014,2024,2039,2038,2037,2040,2039,
-2037,475,2039,2040,2039,475,476,2041,2039,476,2041,492,2039,492,503,2039,
-2041,2042,492,2042,490,492,2042,2043,490,2043,488,490,2043,2044,488,2044,
-485,488,2044,483,485,483,2044,480,2044,479,480,2044,2043,479,2043,478,
-479,2043,2042,478,2042,477,478,2041,476,477,2042,2041,477,474,475,2045,
-474,2045,2046,473,474,2046,473,2046,472,2045,475,2040,2045,2040,2047,2046,
-2045,2047,2047,2040,2036,2040,2037,2036,2048,2047,2036,2049,2048,2036,2049,2036,
-2035,2050,2049,2035,2050,2035,2032,2051,2050,2032,2051,2032,2033,2052,2051,2033,
-2053,2046,2047,2048,2053,2047,2054,472,2046,2053,2054,2046,2054,2055,472,2052,
-2033,470,2055,2052,470,470,2033,2029,468,470,2029,2055,470,472,2056,2054,
-2053,2057,2056,2053,2056,2057,2058,2057,2059,2058,2058,2059,2060,2058,2060,2061,
-2062,2058,2061,2056,2058,2062,2062,2061,2052,2062,2052,2055,2059,2063,2060,2064,
-2056,2062,2064,2062,2055,2064,2055,2054,2056,2064,2054,2059,2057,2048,2057,2053,
-2048,2059,2048,2049,2063,2059,2049,2063,2049,2050,2060,2063,2050,2060,2050,2051,
-2061,2060,2051,2061,2051,2052,1176,1177,285,284,1176,285,1176,284,282,283,
-1176,282,1741,1746,1743,1742,1741,1743,1741,1740,1746,1740,1748,1746,1748,1740,
-1750,1740,1739,1750,1750,1739,1752,1739,1738,1752,1738,1737,1752,1737,1755,1752,
-1027,1687,1021,1685,1687,1027,1036,1685,1027,1183,1181,1676,1675,1676,1181,1182,
-1675,1181,608,1675,1182,69,608,1182,425,334,422,421,422,334,333,421,
-334,420,421,333,332,420,333,419,420,332,331,419,332,418,419,331,
-330,418,331,417,418,330,329,417,330,417,329,337,412,417,337,412,
-337,413,337,338,413,413,338,414,338,340,414,415,414,340,342,415,
-340,415,342,416,342,363,416,416,363,382,363,364,382,2065,546,539,
-2066,2065,539,2066,539,540,548,2066,540,548,540,542,2066,548,2067,548,
-547,2067,547,2068,2067,547,549,2068,549,551,2068,2067,2068,2069,2068,2070,
-2069,2068,551,2070,2069,2070,2071,2069,2071,2072,2072,2071,2073,2071,2074,2073,
-2075,2069,2072,2070,2076,2071,2071,2076,2074,2070,2077,2076,551,2077,2070,2077,
-2078,2076,2078,2077,2079,2080,2078,2079,2080,2079,2081,2082,2080,2081,2082,2081,
-2083,2084,2082,2083,2085,2078,2080,2086,2085,2080,2086,2080,2082,2085,2086,2087,
-2085,2087,2088,2088,2087,2089,2087,2090,2089,2091,2089,2090,2092,2091,2090,2093,
-2092,2090,2094,2093,2090,2094,2090,2087,2095,2091,2092,2096,2095,2092,2096,2092,
-2093,2097,2096,2093,2098,2095,2096,2099,2098,2096,2099,2096,2097,2100,2099,2097,
-2098,2099,2101,2099,2102,2101,2099,2100,2102,2101,2102,1236,2102,1235,1236,1232,
-1235,2102,2103,1232,2102,2100,2103,2102,2103,2104,1232,2104,2103,2100,2104,1230,
-1232,2104,2105,1230,2105,1231,1230,2106,2105,2104,2107,2106,2104,2107,2104,2100,
-2107,2100,2097,2106,2107,2108,2107,2109,2108,2108,2109,2110,2109,2111,2110,2111,
-2112,2110,2112,2113,2110,2112,2114,2113,2114,2115,2113,2109,2107,2097,2109,2097,
-2093,2111,2109,2093,2111,2093,2112,2093,2094,2112,2112,2094,2116,2114,2112,2116,
-2116,2094,2087,2086,2116,2087,2117,2114,2116,2086,2117,2116,2118,2115,2114,2117,
-2118,2114,2117,2086,2082,2117,2082,2084,2118,2117,2084,2118,2084,2119,2084,2120,
-2119,2119,2120,2121,2121,2120,555,2121,555,556,559,2121,556,2120,2122,555,
-553,555,2122,2123,553,2122,550,553,2123,552,550,2123,2124,2119,2121,2124,
-2121,559,2119,2124,2125,2118,2119,2125,2124,576,2125,2125,576,577,2126,2125,
-577,2126,577,579,2127,2126,579,2127,579,1914,2128,2127,1914,2128,1914,1913,
-1912,2128,1913,2124,561,576,561,2124,559,552,2123,2081,2079,552,2081,2081,
-2123,2083,2123,2122,2083,2083,2122,2120,2084,2083,2120,2113,2126,2127,2110,2113,
-2127,2110,2127,2128,2108,2110,2128,2108,2128,1912,2106,2108,1912,2106,1912,1910,
-2105,2106,1910,2105,1910,1231,2079,2077,552,2077,551,552,2113,2115,2126,2115,
-2125,2126,2115,2118,2125,2131,2130,2129,2132,2131,2129,2130,2131,2133,2134,2130,
-2133,2135,2134,2133,2136,2135,2133,2135,2136,2137,2136,2138,2137,2137,2138,1284,
-2138,1285,1284,2137,1284,1286,2139,2137,1286,2140,2135,2137,2139,2140,2137,2141,
-2134,2135,2140,2141,2135,2129,2088,2132,2129,2074,2088,2074,2142,2088,2142,2085,
-2088,2078,2085,2142,2076,2078,2142,2076,2142,2074,2136,2098,2138,2136,2133,2098,
-2133,2095,2098,2133,2131,2095,2131,2091,2095,2131,2132,2091,2088,2089,2132,2132,
-2089,2091,2129,2130,2074,2130,2073,2074,2130,2134,2073,2134,2141,2073,2141,2143,
-2073,2143,2072,2073,2143,2144,2072,2144,2075,2072,2144,2145,2075,2145,2146,2075,
-2146,2147,2075,2069,2075,2147,2148,2069,2147,2148,2149,2069,2149,2067,2069,2149,
-2066,2067,2065,2066,2149,2150,2065,2149,2150,2149,2148,2151,2150,2148,2148,2147,
-2152,2151,2148,2152,2153,2150,2151,2154,2153,2151,2154,2151,2152,1474,2065,2150,
-2153,1474,2150,2065,1474,1475,546,2065,1475,1475,1476,546,1476,545,546,545,
-1476,543,1476,544,543,2155,2154,2152,1473,1474,2153,2156,1473,2153,2156,2153,
-2154,1431,1473,2156,2157,1431,2156,2157,1430,1431,2158,1430,2157,2159,2158,2157,
-2160,2158,2159,2161,2160,2159,2157,2156,2162,2159,2157,2162,2159,2162,2163,2161,
-2159,2163,2163,2162,2155,2162,2156,2154,2162,2154,2155,2164,2160,2161,2165,2164,
-2161,2165,2161,2163,2166,2165,2163,2166,2163,2155,2167,2166,2155,777,2165,2166,
-2168,777,2166,2168,2166,2167,2169,2168,2167,2169,2167,2170,2170,2167,2152,2167,
-2155,2152,2170,2152,2147,2146,2170,2147,2171,2169,2170,2171,2170,2146,2145,2171,
-2146,775,777,2168,2172,775,2168,2172,2168,2169,2173,2172,2169,2173,2169,2171,
-2174,2173,2171,2174,2171,2145,2175,2174,2145,2175,2145,2144,2176,2175,2144,2176,
-2144,2143,2177,775,2172,2177,2172,2173,773,775,2177,2178,773,2177,2178,2177,
-2179,2179,2177,2173,2179,2173,2174,2180,2178,2179,2180,2179,2181,2181,2179,2174,
-2181,2174,2175,2182,2180,2181,2182,2181,2183,2183,2181,2175,2183,2175,2176,2184,
-2182,2183,2184,2183,2185,2185,2183,2176,2185,2176,2143,2186,2184,2185,2186,2185,
-2187,2187,2185,2143,2188,2186,2187,2188,2187,2140,2139,2188,2140,718,773,2178,
-1302,718,2178,1302,2178,2180,1303,1302,2180,1303,2180,2182,1304,1303,2182,1304,
-2182,2184,1305,1304,2184,1305,2184,2186,1306,1305,2186,1306,2186,2188,1307,1306,
-2188,1307,2188,2139,1286,1307,2139,2140,2187,2141,2187,2143,2141,1456,1449,1485,
-2000,2001,2019,2000,2019,2020,2002,2000,2020,2002,2020,1606,2020,1482,1606,1606,
-1482,1483,2020,2017,1482,2017,1481,1482,2017,2018,1481,2018,1477,1481,2018,526,
-1477,2002,1606,1607,2003,2002,1607,2003,1607,1617,1990,2003,1617,1990,1617,1619,
-1988,1990,1619,1988,1619,1621,1986,1988,1621,1986,1621,1623,1566,1651,1649,1565,
-1566,1649,1565,1649,1650,1567,1565,1650,1567,1650,1652,1568,1567,1652,1568,1652,
-1655,1570,1568,1655,1570,1655,1657,1572,1570,1657,1572,1657,1659,1574,1572,1659,
-1574,1659,1667,1582,1574,1667,2189,1582,1667,2189,2190,1582,2190,1581,1582,2190,
-2191,1581,2191,1583,1581,2191,2192,1583,2192,1584,1583,2192,1585,1584,2193,2189,
-1667,2193,1667,1668,2194,2193,1668,2194,1668,1669,2195,2194,1669,2195,1669,2196,
-2196,1669,1664,2196,1664,1670,2197,2196,1670,2197,1670,1600,2198,2197,1600,2198,
-1600,1595,1594,2198,1595,2199,2195,2196,2199,2196,2197,2200,2198,1594,2201,2200,
-1594,2201,1594,1593,2202,2201,1593,2202,1593,1592,2203,2202,1592,2203,1592,2204,
-1592,1591,2204,2204,1591,1590,2205,2204,1590,2205,1590,1589,1588,2205,1589,2200,
-2206,2198,2206,2199,2197,2206,2197,2198,2207,2199,2206,2208,2207,2206,2208,2206,
-2200,2209,2208,2200,2208,2209,2207,2209,2200,2201,2210,2209,2201,2210,2201,2202,
-2211,2210,2202,2211,2202,2203,2212,2211,2203,2212,2203,2204,2213,2212,2204,2213,
-2204,2205,2214,2213,2205,2214,2205,1588,2215,2214,1588,2215,1588,1587,2216,2215,
-1587,2216,1587,1586,2217,2216,1586,2217,1586,1585,2218,2217,1585,2216,2217,2218,
-2215,2216,2218,2218,1585,2192,2219,2218,2192,2215,2218,2219,2214,2215,2219,2219,
-2192,2191,2220,2219,2191,2214,2219,2220,2213,2214,2220,2220,2191,2190,2221,2220,
-2190,2221,2190,2189,2222,2221,2189,2222,2189,2193,2223,2222,2193,2223,2193,2194,
-2224,2223,2194,2224,2194,2195,2207,2224,2195,2207,2195,2199,2212,2221,2222,2211,
-2212,2222,2211,2222,2223,2213,2220,2221,2212,2213,2221,2210,2223,2224,2210,2211,
-2223,2209,2210,2224,2209,2224,2207,1527,1529,1541,1527,1541,1544,1526,1527,1544,
-1526,1544,1545,1535,1526,1545,2225,1554,1542,2226,2225,1542,1559,1554,2225,2227,
-1559,2225,1560,1559,2227,2228,1560,2227,2228,2229,1560,2229,1566,1560,2229,2230,
-1566,2230,1651,1566,2230,2231,1651,2231,1645,1651,2231,2232,1645,2232,1654,1645,
-2232,1402,1654,1402,1331,1654,1403,1402,2232,2233,1403,2232,2233,2232,2231,1351,
-1403,2233,1409,1351,2233,1409,2233,2234,2234,2233,2231,2234,2231,2230,1410,1409,
-2234,1410,2234,2235,2235,2234,2230,1411,1410,2235,1411,2235,2236,1412,1411,2236,
-1412,2236,2237,1413,1412,2237,1413,2237,2238,1414,1413,2238,1414,2238,2239,1415,
-1414,2239,1415,2239,2240,1416,1415,2240,1416,2240,2241,1417,1416,2241,1417,2241,
-2242,1418,1417,2242,1418,2242,2243,1419,1418,2243,1419,2243,2244,1420,1419,2244,
-1420,2244,2245,1422,1420,2245,1422,2245,2246,1423,1422,2246,2246,2247,1423,2247,
-1424,1423,1424,2247,2248,1425,1424,2248,1425,2248,1472,1426,1425,1472,1426,1472,
-1434,2244,2243,2249,2243,2250,2249,2249,2250,1521,2250,1530,1521,2250,2251,1530,
-2251,1531,1530,2249,1521,1516,1518,2249,1516,2251,2252,1531,2252,1538,1531,2252,
-2226,1538,2226,1542,1538,2240,2226,2252,2240,2239,2226,2239,2225,2226,2227,2225,
-2239,2238,2227,2239,2228,2227,2238,2237,2228,2238,2237,2236,2228,2236,2229,2228,
-2236,2235,2229,2235,2230,2229,2241,2240,2252,2241,2252,2251,2242,2241,2251,2242,
-2251,2250,2243,2242,2250,2253,951,919,918,2253,919,852,841,840,854,852,
-840,854,840,838,856,854,838,856,838,835,858,856,835,858,835,833,
-859,858,833,859,833,831,861,859,831,861,831,828,827,861,828,2256,
-2255,2254,2257,2256,2254,2254,2255,2258,2259,2254,2258,2257,2260,2256,2260,2261,
-2256,2260,2262,2261,2262,2263,2261,2259,2258,2264,2265,2259,2264,2265,2264,2266,
-2267,2265,2266,2267,2266,2268,2269,2267,2268,2269,2268,867,2270,2269,867,2262,
-2271,2263,2271,2272,2263,2271,2273,2272,2273,2274,2272,2273,2275,2274,2275,2276,
-2274,935,2268,2266,935,867,2268,2277,935,2266,2277,2266,2264,2278,2277,2264,
-935,2277,2278,2279,2274,2276,2280,2279,2276,2280,2276,2275,2281,2272,2274,2279,
-2281,2274,2281,2282,2272,2282,2263,2272,2282,2283,2263,2283,2261,2263,2283,2284,
-2261,2284,2256,2261,2284,2285,2256,2285,2255,2256,2285,2286,2255,2286,2278,2258,
-2286,2258,2255,2278,2264,2258,2287,2285,2284,2288,2287,2284,2288,2284,2283,2289,
-2286,2285,2287,2289,2285,2290,2288,2283,2290,2283,2282,2291,2290,2282,2291,2282,
-2281,2292,2291,2281,2288,2290,2293,2293,2290,2291,2294,2288,2293,2295,2294,2293,
-2296,2295,2293,2297,2295,2296,2295,2297,2298,2295,2298,2294,2297,2299,2298,2299,
-933,2298,933,934,2298,2300,2297,2296,2301,933,2299,2301,2302,933,2302,931,
-933,2302,2303,931,2303,929,931,2303,2304,929,2304,927,929,2304,2305,927,
-2305,924,927,922,924,2305,2306,922,2305,920,922,2306,2307,920,2306,917,
-920,2307,914,917,2307,912,914,2307,2308,912,2307,2308,2307,2306,2309,2308,
-2306,2309,2306,2305,2309,2305,2304,2310,2304,2303,2310,2309,2304,2311,2310,2303,
-911,912,2308,2312,911,2308,2312,2311,911,2312,2308,2309,2310,2312,2309,2310,
-2311,2312,2311,909,911,907,909,2311,2313,907,2311,2313,2311,2302,2311,2303,
-2302,2313,2302,2301,2314,2313,2301,2313,2314,907,2314,2301,2315,2315,2301,2299,
-2316,2315,2299,2297,2316,2299,2316,2297,2317,2297,2300,2317,2317,2300,2318,897,
-2317,2318,2319,2314,2315,2319,2315,2316,2320,2319,2316,2320,2316,2317,2321,2320,
-2317,2321,2317,897,2314,2319,905,2314,905,907,2319,903,905,2319,2320,903,
-2320,901,903,2320,2321,901,2321,898,901,2321,897,898,897,2318,2322,896,
-897,2322,887,896,2322,885,887,2322,885,2322,882,2322,2323,882,2323,2322,
-2318,2324,2323,2318,2325,2323,2324,2325,2324,2296,2296,2324,2300,2324,2318,2300,
-2293,2325,2296,2325,2326,2323,2326,2325,2293,2326,881,2323,2323,881,882,2326,
-2327,881,2327,878,881,878,2327,2328,877,878,2328,877,2328,2329,2329,2330,
-877,877,2330,876,2330,2275,876,2330,2280,2275,2331,2280,2330,2329,2331,2330,
-2328,2331,2329,2331,2332,2280,2328,2332,2331,2332,2279,2280,2332,2292,2279,2292,
-2281,2279,2333,2292,2332,2328,2333,2332,2328,2327,2333,2333,2291,2292,2333,2293,
-2291,2333,2326,2293,2327,2326,2333,2334,876,2275,2335,2334,2275,2336,2334,2335,
-2337,2336,2335,2338,2336,2337,2339,2336,2338,2340,2339,2338,2337,2335,2273,2335,
-2275,2273,2337,2273,2271,2338,2337,2271,2339,2340,2260,2339,2260,2257,2341,2339,
-2257,2257,2254,2341,2254,2342,2341,2342,2254,2259,2342,2259,2265,2343,2342,2265,
-2343,2265,2267,2343,2267,2269,2344,2343,2269,2344,2269,2270,2345,2344,2270,2346,
-2345,2270,2347,2346,2270,2347,2270,867,874,2347,867,2348,2347,874,2349,2348,
-874,2350,2346,2347,2348,2350,2347,2351,2349,874,875,2351,874,2351,875,2334,
-875,876,2334,2352,2348,2349,2353,2352,2349,2354,2350,2348,2352,2354,2348,2355,
-2351,2334,2356,2355,2334,2355,2356,2357,2355,2357,2358,2358,2349,2351,2355,2358,
-2351,2357,2359,2358,2359,2353,2349,2358,2359,2349,2357,2360,2359,2360,2361,2359,
-2361,2352,2353,2359,2361,2353,2360,2362,2361,2362,2363,2361,2363,2354,2352,2361,
-2363,2352,2362,2364,2363,2364,2365,2363,2363,2365,2366,2363,2366,2354,2365,2367,
-2366,2367,2368,2366,2368,2369,2366,2357,2356,2336,2356,2334,2336,2366,2369,2350,
-2369,2346,2350,2369,2368,2346,2368,2345,2346,2368,2367,2345,2367,2344,2345,2367,
-2365,2344,2362,2360,2341,2360,2339,2341,2357,2336,2339,2360,2357,2339,2365,2364,
-2343,2365,2343,2344,2364,2342,2343,2362,2341,2342,2364,2362,2342,2366,2350,2354,
-895,2370,899,894,2370,895,866,867,935,2371,935,2278,2371,2278,2286,2289,
-2371,2286,935,2371,2289,2287,935,2289,935,2287,2372,2372,2287,2288,2294,2372,
-2288,2298,2372,2294,935,2372,2298,934,935,2298,2374,799,2373,2375,2374,2373,
-2376,2375,2373,2377,2376,2373,2378,2376,2377,2379,2378,2377,2378,2379,2380,2381,
-2378,2380,2381,2380,2382,2383,2381,2382,2373,799,783,2373,783,780,2377,2373,
-780,2377,780,778,2379,2377,778,2379,778,776,2380,2379,776,2380,776,774,
-2382,2380,774,2382,774,772,771,2382,772,2384,2375,2376,2385,2384,2376,2385,
-2386,2384,2386,2387,2384,2387,2388,2384,2388,2389,2384,2390,2386,2385,2391,2390,
-2385,2390,2391,2392,2393,2390,2392,2393,2392,2394,2395,2393,2394,2395,2394,2396,
-2397,2395,2396,2397,2396,746,747,2397,746,2398,2388,2387,2399,2398,2387,2399,
-2387,2386,2400,2399,2386,2400,2386,2390,2401,2400,2390,2401,2390,2393,2402,2401,
-2393,2402,2393,2395,2403,2402,2395,2403,2395,2397,2404,2403,2397,2404,2397,747,
-755,2404,747,2405,2396,2394,2406,2405,2394,2405,2406,767,2406,769,767,2405,
-767,763,764,2405,763,769,2406,2383,769,2383,2382,770,769,2382,770,2382,
-771,2406,2394,2383,2394,2392,2383,2392,2381,2383,2392,2391,2381,2391,2378,2381,
-2391,2385,2378,2385,2376,2378,764,746,2396,2405,764,2396,2409,2408,2407,2410,
-2409,2407,2411,2409,2410,2412,2411,2410,2413,2411,2412,2414,2413,2412,2413,2414,
-2415,2414,2416,2415,2415,2416,2417,2416,2418,2417,2419,2408,2409,2420,2419,2409,
-2420,2409,2411,2421,2420,2411,2421,2411,2413,2422,2421,2413,2413,2415,2423,2422,
-2413,2423,2415,2417,2424,2423,2415,2424,2412,2410,888,2410,890,888,2410,2407,
-890,2407,892,890,2414,886,2416,2412,888,886,2414,2412,886,2417,2418,2388,
-2417,2388,2398,2424,2417,2398,1846,2424,2398,2423,2424,1846,1844,1846,2398,1844,
-2398,2399,1842,1844,2399,1842,2399,1840,2399,2400,1840,2400,2401,1840,2401,1838,
-1840,1838,2401,2402,1836,1838,2402,1836,2402,2403,1834,1836,2403,1834,2403,2404,
-1832,1834,2404,1832,2404,755,1770,1832,755,1832,1770,1769,886,884,2416,2416,
-884,2418,884,883,2418,2418,883,2389,883,2374,2389,2389,2374,2375,2384,2389,
-2375,883,880,2374,880,799,2374,2418,2389,2388,514,519,2038,2425,514,2038,
-2425,2038,2039,503,2425,2039,511,514,2425,508,511,2425,508,2425,503,2098,
-2101,2138,2138,2101,1285,2101,1236,1285,1847,2423,1846,2422,2423,1847,1849,2422,
-1847,2422,1849,1851,2421,2422,1851,2421,1851,1853,2420,2421,1853,2419,2420,1853,
-1856,2419,1853,2426,796,797,2427,2426,797,786,796,2426,782,786,2426,2427,
-797,798,2428,2427,798,781,2426,2427,2426,781,782,779,781,2427,2427,2428,
-2164,779,2427,2164,779,2164,2165,777,779,2165,2428,798,2160,2164,2428,2160,
-2160,798,2158,798,794,2158,794,795,2158,795,1430,2158,1430,795,800,2340,
-2262,2260,2340,2338,2262,2338,2271,2262,2244,2249,1518,2245,2244,1518,2245,1518,
-1519,2246,2245,1519,2246,1519,2247,1519,1469,2247,2247,1469,1470,2248,2247,1470,
-2248,1470,1471,1472,2248,1471,1950,1920,1921,1922,1950,1921,1950,1951,1920,1951,
-380,1920};
-
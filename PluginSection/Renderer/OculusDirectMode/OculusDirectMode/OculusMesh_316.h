@@ -1,459 +0,0 @@
-/********************************************************************
-Vireio Perception: Open-Source Stereoscopic 3D Driver
-Copyright (C) 2012 Andres Hernandez
-This file was exported from Vireio using Oculus Avatar SDK.
-Data Copyright : Copyright 2014-2016 Oculus VR, LLC All Rights reserved.
-
-Vireio Perception Version History :.
-v1.0.0 2012 by Andres Hernandez.
-v1.0.X 2013 by John Hicks, Neil Schneider.
-v1.1.x 2013 by Primary Coding Author : Chris Drain.
-Team Support : John Hicks, Phil Larkson, Neil Schneider.
-v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown.
-v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown, Samuel Austin.
-and Neil Schneider.
-
-This program is free software : you can redistribute it and / or modify.
-it under the terms of the GNU Lesser General Public License as published by.
-the Free Software Foundation, either version 3 of the License, or.
-(at your option) any later version..
-
-This program is distributed in the hope that it will be useful,.
-but WITHOUT ANY WARRANTY; without even the implied warranty of.
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the.
-GNU Lesser General Public License for more details..
-
-You should have received a copy of the GNU Lesser General Public License.
-along with this program.If not, see < http://www.gnu.org/licenses/>..
-********************************************************************/
-
-const uint32_t unAvatarVertexCount_316 = 316;
-const ovrAvatarMeshVertex asAvatarVertices_316[] = {
-	{ 0.000015,1.580144,0.090938,0.000000,0.504021,0.863691,-0.999995,0.002787,-0.001626,-1.000000,0.490871,0.820768,2,3,3,3,0.797269,0.202731,0.000000,0.000000},
-	{ 0.000015,1.581029,0.090441,0.000002,0.974186,-0.225746,-0.999999,0.000000,-0.001733,-1.000000,0.490883,0.818789,2,3,3,3,0.785170,0.214830,0.000000,0.000000},
-	{ 0.028797,1.581831,0.085694,-0.077124,0.981271,-0.176518,-0.986345,-0.049252,0.157157,-1.000000,0.425738,0.808647,2,3,3,3,0.735924,0.264076,0.000000,0.000000},
-	{ 0.029305,1.580982,0.086155,0.331637,0.662691,0.671459,-0.935159,0.324831,0.141290,-1.000000,0.424539,0.810373,2,3,3,3,0.747443,0.252557,0.000000,0.000000},
-	{ 0.063407,1.577631,0.056870,0.478548,0.798261,0.365747,-0.870167,0.486874,0.075913,-1.000000,0.339915,0.753833,2,3,3,3,0.752538,0.247462,0.000000,0.000000},
-	{ 0.061974,1.578447,0.056673,-0.051451,0.975722,-0.212885,-0.983994,-0.013112,0.177720,-1.000000,0.343073,0.753158,2,3,3,3,0.739054,0.260946,0.000000,0.000000},
-	{ 0.078903,1.569879,0.032737,0.475221,0.870588,-0.127441,-0.879350,0.474895,-0.034900,-1.000000,0.300271,0.700114,2,3,3,3,0.775606,0.224394,0.000000,0.000000},
-	{ 0.077236,1.570779,0.032838,0.018131,0.936003,-0.351525,-0.987121,0.072650,0.142530,-1.000000,0.303931,0.700523,2,3,3,3,0.758042,0.241958,0.000000,0.000000},
-	{ 0.079937,1.559634,0.014065,0.431189,0.780347,-0.452918,-0.895882,0.429880,-0.112247,-1.000000,0.292514,0.649393,2,3,3,3,0.811272,0.188728,0.000000,0.000000},
-	{ 0.078357,1.560644,0.014346,-0.024771,0.877743,-0.478492,-0.992886,0.034161,0.114066,-1.000000,0.296066,0.650883,2,3,3,3,0.792378,0.207622,0.000000,0.000000},
-	{ 0.077943,1.551978,-0.000190,0.472889,0.727749,-0.496747,-0.873737,0.460139,-0.157654,-1.000000,0.295561,0.608176,2,3,3,3,0.838890,0.161110,0.000000,0.000000},
-	{ 0.076512,1.553026,0.000288,-0.029239,0.896250,-0.442584,-0.994904,0.016651,0.099446,-1.000000,0.298721,0.610144,2,3,3,3,0.780374,0.219626,0.000000,0.000000},
-	{ 0.073315,1.546327,-0.015118,0.012089,0.878554,-0.477491,-0.996870,0.047899,0.062892,-1.000000,0.305786,0.569727,2,3,3,3,0.745743,0.254257,0.000000,0.000000},
-	{ 0.074356,1.545029,-0.015688,0.486891,0.634079,-0.600734,-0.858889,0.472668,-0.197219,-1.000000,0.303405,0.567342,2,3,3,3,0.782043,0.217957,0.000000,0.000000},
-	{ 0.064382,1.536413,-0.028840,-0.063440,0.812296,-0.579785,-0.996442,-0.019258,0.082049,-1.000000,0.323823,0.530289,2,3,3,3,0.694639,0.305361,0.000000,0.000000},
-	{ 0.065166,1.535036,-0.029399,0.383365,0.544942,-0.745701,-0.904555,0.384634,-0.183950,-1.000000,0.322090,0.527576,2,3,3,3,0.725769,0.274231,0.000000,0.000000},
-	{ 0.050994,1.526285,-0.039937,-0.129089,0.825774,-0.549029,-0.984952,-0.042615,0.167489,-1.000000,0.352814,0.493401,2,3,3,3,0.758839,0.241161,0.000000,0.000000},
-	{ 0.051665,1.524977,-0.040836,0.283061,0.565916,-0.774349,-0.939667,0.325343,-0.105723,-1.000000,0.351727,0.490346,2,3,3,3,0.785428,0.214572,0.000000,0.000000},
-	{ 0.038499,1.519094,-0.048683,-0.116709,0.857515,-0.501046,-0.983174,-0.028371,0.180456,-1.000000,0.384681,0.464077,2,3,3,3,0.786586,0.213414,0.000000,0.000000},
-	{ 0.039059,1.517814,-0.049702,0.197599,0.590159,-0.782731,-0.962410,0.268569,-0.040464,-1.000000,0.383988,0.460944,2,3,3,3,0.812054,0.187946,0.000000,0.000000},
-	{ 0.028106,1.514552,-0.054701,-0.096172,0.850362,-0.517335,-0.989296,-0.024357,0.143872,-1.000000,0.412848,0.445189,2,3,3,3,0.769575,0.230425,0.000000,0.000000},
-	{ 0.028509,1.513191,-0.055672,0.117091,0.549377,-0.827330,-0.982348,0.186443,-0.015226,-1.000000,0.412469,0.442102,2,3,3,3,0.789310,0.210690,0.000000,0.000000},
-	{ 0.018708,1.511424,-0.057488,-0.138327,0.837794,-0.528173,-0.987046,-0.072852,0.142945,-1.000000,0.438203,0.435172,2,3,3,3,0.813268,0.186732,0.000000,0.000000},
-	{ 0.019000,1.509977,-0.058429,0.032511,0.501900,-0.864314,-0.995809,0.090232,0.014940,-1.000000,0.438132,0.432036,2,3,3,3,0.851370,0.148630,0.000000,0.000000},
-	{ 0.009634,1.508737,-0.058984,-0.112451,0.845296,-0.522331,-0.991533,-0.061099,0.114586,-1.000000,0.463805,0.428316,2,3,3,3,0.853432,0.146568,0.000000,0.000000},
-	{ 0.009787,1.507278,-0.060038,0.016536,0.500112,-0.865802,-0.998702,0.049975,0.009793,-1.000000,0.463892,0.425091,2,3,3,3,0.872234,0.127766,0.000000,0.000000},
-	{ -0.000011,1.506128,-0.060800,0.000022,0.508114,-0.861290,-0.999942,0.009320,0.005473,-1.000000,0.491565,0.421850,2,3,3,3,0.933313,0.066687,0.000000,0.000000},
-	{ -0.000014,1.507530,-0.059570,0.000051,0.858394,-0.512991,-0.999919,0.006580,0.010911,-1.000000,0.491579,0.425105,2,3,3,3,0.907274,0.092726,0.000000,0.000000},
-	{ -0.009607,1.508737,-0.058984,0.112834,0.845243,-0.522334,-0.992434,0.070261,-0.100687,-1.000000,0.519298,0.427830,2,3,3,3,0.853432,0.146568,0.000000,0.000000},
-	{ -0.009760,1.507278,-0.060039,-0.016473,0.500084,-0.865820,-0.999390,-0.034893,-0.001139,-1.000000,0.519192,0.424645,2,3,3,3,0.872235,0.127765,0.000000,0.000000},
-	{ -0.018971,1.509977,-0.058430,-0.032485,0.501929,-0.864299,-0.996212,-0.086048,-0.012528,-1.000000,0.545127,0.431305,2,3,3,3,0.851352,0.148648,0.000000,0.000000},
-	{ -0.018678,1.511424,-0.057489,0.138375,0.837847,-0.528076,-0.987181,0.073866,-0.141481,-1.000000,0.545090,0.434392,2,3,3,3,0.813248,0.186752,0.000000,0.000000},
-	{ -0.028479,1.513191,-0.055673,-0.117145,0.549432,-0.827286,-0.981605,-0.190514,0.012469,-1.000000,0.570962,0.441298,2,3,3,3,0.789089,0.210911,0.000000,0.000000},
-	{ -0.028077,1.514552,-0.054702,0.096164,0.850429,-0.517227,-0.988366,0.020066,-0.150767,-1.000000,0.570617,0.444355,2,3,3,3,0.769360,0.230640,0.000000,0.000000},
-	{ -0.039029,1.517814,-0.049701,-0.197592,0.590225,-0.782683,-0.960801,-0.274997,0.035182,-1.000000,0.599562,0.460297,2,3,3,3,0.811893,0.188107,0.000000,0.000000},
-	{ -0.038469,1.519094,-0.048682,0.116731,0.857554,-0.500974,-0.981531,0.022634,-0.189961,-1.000000,0.598892,0.463419,2,3,3,3,0.786412,0.213588,0.000000,0.000000},
-	{ -0.051634,1.524976,-0.040835,-0.283005,0.565993,-0.774313,-0.938381,-0.330365,0.101487,-1.000000,0.631762,0.490092,2,3,3,3,0.785240,0.214760,0.000000,0.000000},
-	{ -0.050963,1.526284,-0.039936,0.129133,0.825816,-0.548956,-0.983964,0.038019,-0.174268,-1.000000,0.630671,0.493152,2,3,3,3,0.758640,0.241360,0.000000,0.000000},
-	{ -0.065135,1.535035,-0.029399,-0.383226,0.545019,-0.745716,-0.903975,-0.387082,0.181650,-1.000000,0.661199,0.527758,2,3,3,3,0.725442,0.274558,0.000000,0.000000},
-	{ -0.064351,1.536412,-0.028839,0.063578,0.812314,-0.579745,-0.996200,0.017010,-0.085414,-1.000000,0.659447,0.530479,2,3,3,3,0.694290,0.305710,0.000000,0.000000},
-	{ -0.074326,1.545028,-0.015689,-0.486716,0.634173,-0.600777,-0.858831,-0.473140,0.196335,-1.000000,0.679747,0.567834,2,3,3,3,0.781808,0.218192,0.000000,0.000000},
-	{ -0.073285,1.546326,-0.015118,-0.011904,0.878561,-0.477482,-0.996813,-0.048097,-0.063647,-1.000000,0.677352,0.570230,2,3,3,3,0.745480,0.254520,0.000000,0.000000},
-	{ -0.077914,1.551978,-0.000190,-0.472726,0.727837,-0.496773,-0.873635,-0.460848,0.156144,-1.000000,0.687524,0.608939,2,3,3,3,0.838682,0.161318,0.000000,0.000000},
-	{ -0.076482,1.553026,0.000288,0.029434,0.896255,-0.442561,-0.994797,-0.016936,-0.100460,-1.000000,0.684353,0.610905,2,3,3,3,0.780120,0.219880,0.000000,0.000000},
-	{ -0.078327,1.560643,0.014346,0.024886,0.877746,-0.478479,-0.992664,-0.034951,-0.115747,-1.000000,0.686929,0.651857,2,3,3,3,0.792138,0.207862,0.000000,0.000000},
-	{ -0.079908,1.559634,0.014065,-0.431079,0.780414,-0.452906,-0.895753,-0.430550,0.110692,-1.000000,0.690478,0.650369,2,3,3,3,0.811056,0.188944,0.000000,0.000000},
-	{ -0.077206,1.570779,0.032838,-0.018069,0.936015,-0.351497,-0.985961,-0.075046,-0.149159,-1.000000,0.678866,0.701672,2,3,3,3,0.757822,0.242178,0.000000,0.000000},
-	{ -0.078874,1.569879,0.032737,-0.475176,0.870613,-0.127443,-0.879218,-0.475469,0.030084,-1.000000,0.682509,0.701298,2,3,3,3,0.775396,0.224604,0.000000,0.000000},
-	{ -0.061944,1.578447,0.056673,0.051472,0.975719,-0.212893,-0.983130,0.012041,-0.182509,-1.000000,0.639234,0.754274,2,3,3,3,0.738882,0.261118,0.000000,0.000000},
-	{ -0.063377,1.577631,0.056870,-0.478541,0.798267,0.365744,-0.870692,-0.485263,-0.080093,-1.000000,0.642396,0.754955,2,3,3,3,0.752366,0.247634,0.000000,0.000000},
-	{ -0.028767,1.581831,0.085694,0.077127,0.981257,-0.176597,-0.985617,0.048326,-0.161936,-1.000000,0.555935,0.809018,2,3,3,3,0.735840,0.264160,0.000000,0.000000},
-	{ -0.029276,1.580982,0.086155,-0.331637,0.662697,0.671454,-0.936058,-0.319807,-0.146692,-1.000000,0.557166,0.810743,2,3,3,3,0.747358,0.252642,0.000000,0.000000},
-	{ 0.000015,1.579538,0.088971,0.000001,0.655397,-0.755285,-0.999995,-0.002484,-0.002156,-1.000000,0.490853,0.814731,2,3,3,3,0.793447,0.206553,0.000000,0.000000},
-	{ 0.028213,1.580324,0.084321,-0.335203,0.658105,-0.674194,-0.936016,-0.314119,0.158756,-1.000000,0.426863,0.804689,2,3,3,3,0.744447,0.255553,0.000000,0.000000},
-	{ 0.060717,1.577009,0.055889,-0.485634,0.652296,-0.581953,-0.870050,-0.425167,0.249490,-1.000000,0.345525,0.750170,2,3,3,3,0.737761,0.262239,0.000000,0.000000},
-	{ 0.075708,1.569533,0.032523,-0.539214,0.676835,-0.501141,-0.842164,-0.431353,0.323565,-1.000000,0.306970,0.698074,2,3,3,3,0.749838,0.250162,0.000000,0.000000},
-	{ 0.076845,1.559651,0.014385,-0.587382,0.712265,-0.384267,-0.804324,-0.461144,0.374711,-1.000000,0.299399,0.649209,2,3,3,3,0.758773,0.241227,0.000000,0.000000},
-	{ 0.075021,1.552162,0.000606,-0.605914,0.748662,-0.269024,-0.784723,-0.506919,0.356710,-1.000000,0.302151,0.609443,2,3,3,3,0.770602,0.229398,0.000000,0.000000},
-	{ 0.071881,1.545580,-0.014530,-0.604530,0.772650,-0.193794,-0.781031,-0.527082,0.334925,-1.000000,0.309005,0.569889,2,3,3,3,0.736616,0.263384,0.000000,0.000000},
-	{ 0.063091,1.535831,-0.027949,-0.586323,0.799020,-0.133388,-0.780106,-0.512549,0.358787,-1.000000,0.326787,0.531109,2,3,3,3,0.686417,0.313583,0.000000,0.000000},
-	{ 0.049963,1.525904,-0.038802,-0.534862,0.843744,-0.044936,-0.788459,-0.479285,0.385510,-1.000000,0.355214,0.494876,2,3,3,3,0.753091,0.246909,0.000000,0.000000},
-	{ 0.037720,1.518858,-0.047371,-0.466478,0.884366,0.017161,-0.819703,-0.439498,0.367327,-1.000000,0.386494,0.466078,2,3,3,3,0.779822,0.220178,0.000000,0.000000},
-	{ 0.027537,1.514407,-0.053299,-0.387095,0.919810,0.064083,-0.868077,-0.386987,0.310940,-1.000000,0.414255,0.447468,2,3,3,3,0.764795,0.235205,0.000000,0.000000},
-	{ 0.018329,1.511344,-0.056022,-0.313503,0.945088,0.092333,-0.902885,-0.326790,0.279299,-1.000000,0.439281,0.437578,2,3,3,3,0.805553,0.194447,0.000000,0.000000},
-	{ 0.009439,1.508712,-0.057520,-0.203613,0.973603,0.103142,-0.951494,-0.221600,0.213432,-1.000000,0.464420,0.430786,2,3,3,3,0.844512,0.155488,0.000000,0.000000},
-	{ -0.000014,1.507536,-0.058138,0.000021,0.993991,0.109459,-0.999842,-0.001926,0.017684,-1.000000,0.491581,0.427533,2,3,3,3,0.890556,0.109444,0.000000,0.000000},
-	{ -0.009412,1.508712,-0.057520,0.204224,0.973484,0.103065,-0.956156,0.220940,-0.192228,-1.000000,0.518694,0.430274,2,3,3,3,0.844505,0.155495,0.000000,0.000000},
-	{ -0.018299,1.511344,-0.056023,0.313528,0.945082,0.092304,-0.903142,0.326809,-0.278443,-1.000000,0.544036,0.436759,2,3,3,3,0.805529,0.194471,0.000000,0.000000},
-	{ -0.027507,1.514407,-0.053299,0.387097,0.919811,0.064061,-0.864614,0.386248,-0.321333,-1.000000,0.569240,0.446601,2,3,3,3,0.764580,0.235420,0.000000,0.000000},
-	{ -0.037690,1.518858,-0.047370,0.466465,0.884373,0.017171,-0.815085,0.437298,-0.380009,-1.000000,0.597097,0.465395,2,3,3,3,0.779646,0.220354,0.000000,0.000000},
-	{ -0.049932,1.525903,-0.038801,0.534846,0.843756,-0.044893,-0.785742,0.477127,-0.393648,-1.000000,0.628274,0.494613,2,3,3,3,0.752890,0.247110,0.000000,0.000000},
-	{ -0.063060,1.535829,-0.027948,0.586342,0.799011,-0.133359,-0.779432,0.511628,-0.361556,-1.000000,0.656476,0.531295,2,3,3,3,0.686081,0.313919,0.000000,0.000000},
-	{ -0.071851,1.545578,-0.014531,0.604559,0.772628,-0.193790,-0.781052,0.527205,-0.334684,-1.000000,0.674125,0.570395,2,3,3,3,0.736346,0.263654,0.000000,0.000000},
-	{ -0.074991,1.552161,0.000607,0.605937,0.748642,-0.269026,-0.784928,0.507667,-0.355192,-1.000000,0.680918,0.610205,2,3,3,3,0.770340,0.229660,0.000000,0.000000},
-	{ -0.076816,1.559651,0.014385,0.587399,0.712252,-0.384265,-0.804335,0.461295,-0.374501,-1.000000,0.683605,0.650170,2,3,3,3,0.758507,0.241493,0.000000,0.000000},
-	{ -0.075679,1.569532,0.032524,0.539221,0.676831,-0.501140,-0.842151,0.429923,-0.325498,-1.000000,0.675856,0.699199,2,3,3,3,0.749612,0.250388,0.000000,0.000000},
-	{ -0.060687,1.577009,0.055889,0.485633,0.652297,-0.581953,-0.870595,0.420980,-0.254636,-1.000000,0.636844,0.751257,2,3,3,3,0.737586,0.262414,0.000000,0.000000},
-	{ -0.028183,1.580324,0.084321,0.335200,0.658104,-0.674196,-0.936938,0.307992,-0.165190,-1.000000,0.554850,0.805036,2,3,3,3,0.744366,0.255634,0.000000,0.000000},
-	{ 0.000015,1.566180,0.077596,0.000000,0.258462,-0.966021,-0.999998,-0.001997,-0.000000,-1.000000,0.491006,0.781996,2,3,3,3,0.876487,0.123513,0.000000,0.000000},
-	{ 0.023692,1.566839,0.073691,-0.448929,0.283667,-0.847346,-0.859728,-0.395609,0.323050,-1.000000,0.435610,0.772146,2,3,3,3,0.829539,0.170461,0.000000,0.000000},
-	{ 0.050984,1.564056,0.049817,-0.673983,0.271778,-0.686938,-0.685653,-0.576282,0.444724,-1.000000,0.364679,0.725112,2,3,3,3,0.740320,0.259680,0.000000,0.000000},
-	{ 0.063776,1.557974,0.030122,-0.824722,0.302298,-0.477964,-0.537592,-0.681445,0.496616,-1.000000,0.331593,0.677823,2,3,3,3,0.735724,0.264276,0.000000,0.000000},
-	{ 0.064726,1.549707,0.014862,-0.944283,0.302243,-0.130304,-0.327374,-0.821603,0.466685,-1.000000,0.325887,0.635091,2,3,3,3,0.709762,0.290238,0.000000,0.000000},
-	{ 0.062864,1.543008,0.003333,-0.945912,0.322622,0.034144,-0.289523,-0.886951,0.359854,-1.000000,0.329565,0.602536,2,3,3,3,0.725892,0.274108,0.000000,0.000000},
-	{ 0.060093,1.537314,-0.009500,-0.916288,0.378792,0.130127,-0.329806,-0.897924,0.291481,-1.000000,0.335260,0.569294,2,3,3,3,0.683697,0.316303,0.000000,0.000000},
-	{ 0.052600,1.529029,-0.020523,-0.837138,0.380084,0.393366,-0.331614,-0.924569,0.187630,-1.000000,0.350820,0.536210,2,3,3,3,0.677794,0.322206,0.000000,0.000000},
-	{ 0.041808,1.521042,-0.029480,-0.723320,0.359632,0.589469,-0.390106,-0.917209,0.080897,-1.000000,0.374896,0.504838,2,3,3,3,0.733096,0.266904,0.000000,0.000000},
-	{ 0.031649,1.515245,-0.036684,-0.645842,0.356204,0.675283,-0.493423,-0.869690,-0.013159,-1.000000,0.401695,0.480435,2,3,3,3,0.752702,0.247298,0.000000,0.000000},
-	{ 0.023123,1.511496,-0.041848,-0.511177,0.389767,0.766015,-0.645521,-0.762544,-0.042768,-1.000000,0.425889,0.464460,2,3,3,3,0.743034,0.256966,0.000000,0.000000},
-	{ 0.015393,1.508926,-0.044015,-0.241707,0.441555,0.864064,-0.806436,-0.586647,0.074203,-1.000000,0.447786,0.455491,2,3,3,3,0.766986,0.233014,0.000000,0.000000},
-	{ 0.007928,1.506721,-0.043356,-0.056464,0.417740,0.906810,-0.920350,-0.373834,0.114907,-1.000000,0.469288,0.451569,2,3,3,3,0.789019,0.210981,0.000000,0.000000},
-	{ -0.000009,1.505806,-0.043745,-0.000030,0.443904,0.896074,-0.999614,-0.024893,0.012298,-1.000000,0.491616,0.449121,2,3,3,3,0.828730,0.171270,0.000000,0.000000},
-	{ -0.007901,1.506721,-0.043357,0.056601,0.417594,0.906869,-0.932572,0.346469,-0.101337,-1.000000,0.513991,0.450832,2,3,3,3,0.789046,0.210954,0.000000,0.000000},
-	{ -0.015364,1.508926,-0.044016,0.241760,0.441567,0.864043,-0.808649,0.583855,-0.072117,-1.000000,0.535685,0.454247,2,3,3,3,0.766937,0.233063,0.000000,0.000000},
-	{ -0.023093,1.511496,-0.041849,0.511241,0.389785,0.765963,-0.635560,0.771402,0.031651,-1.000000,0.557748,0.463152,2,3,3,3,0.742875,0.257125,0.000000,0.000000},
-	{ -0.031619,1.515245,-0.036682,0.645869,0.356175,0.675272,-0.478336,0.878159,-0.005680,-1.000000,0.582017,0.479389,2,3,3,3,0.752506,0.247494,0.000000,0.000000},
-	{ -0.041777,1.521042,-0.029478,0.723327,0.359615,0.589470,-0.377717,0.920699,-0.098197,-1.000000,0.608633,0.504355,2,3,3,3,0.732887,0.267113,0.000000,0.000000},
-	{ -0.052567,1.529026,-0.020521,0.837137,0.380060,0.393390,-0.326343,0.924192,-0.198415,-1.000000,0.632394,0.536321,2,3,3,3,0.677490,0.322510,0.000000,0.000000},
-	{ -0.060060,1.537311,-0.009499,0.916288,0.378794,0.130119,-0.328853,0.896975,-0.295453,-1.000000,0.647793,0.569784,2,3,3,3,0.683373,0.316627,0.000000,0.000000},
-	{ -0.062832,1.543005,0.003334,0.945910,0.322626,0.034158,-0.289696,0.887344,-0.358743,-1.000000,0.653454,0.603336,2,3,3,3,0.725607,0.274393,0.000000,0.000000},
-	{ -0.064695,1.549705,0.014863,0.944282,0.302252,-0.130291,-0.327590,0.824722,-0.460997,-1.000000,0.657115,0.636085,2,3,3,3,0.709461,0.290539,0.000000,0.000000},
-	{ -0.063746,1.557973,0.030122,0.824722,0.302305,-0.477959,-0.537011,0.683643,-0.494219,-1.000000,0.651469,0.678881,2,3,3,3,0.735484,0.264516,0.000000,0.000000},
-	{ -0.050955,1.564056,0.049817,0.673982,0.271781,-0.686938,-0.687557,0.570889,-0.448722,-1.000000,0.617958,0.726210,2,3,3,3,0.740152,0.259848,0.000000,0.000000},
-	{ -0.023662,1.566839,0.073691,0.448929,0.283667,-0.847346,-0.861549,0.388977,-0.326236,-1.000000,0.546414,0.772286,2,3,3,3,0.829476,0.170524,0.000000,0.000000},
-	{ 0.000015,1.533096,0.077596,-0.000001,0.000000,-1.000000,-0.999991,0.004351,0.000000,-1.000000,0.490839,0.724560,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023692,1.533755,0.073691,-0.482150,0.000000,-0.876089,-0.803131,-0.399522,0.441998,-1.000000,0.449165,0.719381,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050984,1.530972,0.049817,-0.746475,0.001487,-0.665412,-0.489927,-0.677909,0.548097,-1.000000,0.397786,0.676066,2,3,3,3,0.962193,0.037807,0.000000,0.000000},
-	{ 0.063437,1.524579,0.030241,-0.955839,0.014968,-0.293511,-0.171468,-0.839507,0.515585,-1.000000,0.375263,0.638306,2,3,3,3,0.850647,0.149353,0.000000,0.000000},
-	{ 0.063351,1.515240,0.015418,-0.995285,0.043406,0.086737,-0.009093,-0.932091,0.362110,-1.000000,0.377424,0.607835,2,3,3,3,0.896811,0.103189,0.000000,0.000000},
-	{ 0.060661,1.507648,0.004386,-0.981119,0.065266,0.182059,-0.024889,-0.976120,0.215803,-1.000000,0.383788,0.585174,2,3,3,3,0.954570,0.045430,0.000000,0.000000},
-	{ 0.057766,1.501939,-0.007792,-0.915307,0.073260,0.396037,-0.055884,-0.996907,0.055256,-1.000000,0.390898,0.562794,2,3,3,3,0.960691,0.039309,0.000000,0.000000},
-	{ 0.051197,1.494804,-0.018451,-0.750228,0.066309,0.657846,-0.170514,-0.980706,-0.095607,-1.000000,0.405118,0.542015,2,3,3,3,0.971001,0.028999,0.000000,0.000000},
-	{ 0.041398,1.487903,-0.027548,-0.638091,0.053340,0.768112,-0.325539,-0.922736,-0.206356,-1.000000,0.424584,0.523730,2,3,3,3,0.987023,0.012977,0.000000,0.000000},
-	{ 0.031568,1.482273,-0.034995,-0.564016,0.046835,0.824434,-0.464914,-0.843129,-0.270163,-1.000000,0.443529,0.509534,2,3,3,3,0.994954,0.005046,0.000000,0.000000},
-	{ 0.023117,1.478501,-0.040017,-0.389980,0.053115,0.919290,-0.641981,-0.731384,-0.230083,-1.000000,0.458077,0.500020,2,3,3,3,0.997486,0.002514,0.000000,0.000000},
-	{ 0.015399,1.475918,-0.041861,-0.071265,0.063863,0.995411,-0.789556,-0.613438,-0.017170,-1.000000,0.470502,0.494988,2,3,3,3,0.998005,0.001995,0.000000,0.000000},
-	{ 0.007932,1.473703,-0.041100,0.001335,0.068332,0.997662,-0.905029,-0.424271,0.030270,-1.000000,0.481526,0.491319,2,3,3,3,0.998347,0.001653,0.000000,0.000000},
-	{ -0.000009,1.472786,-0.041400,-0.000051,0.069517,0.997581,-0.996147,-0.087495,0.006046,-1.000000,0.492891,0.489465,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.007905,1.473703,-0.041100,-0.001366,0.068333,0.997662,-0.948343,0.316413,-0.022970,-1.000000,0.503902,0.489533,2,3,3,3,0.998348,0.001652,0.000000,0.000000},
-	{ -0.015370,1.475918,-0.041861,0.071296,0.063868,0.995408,-0.811325,0.584231,0.020626,-1.000000,0.514810,0.492353,2,3,3,3,0.998006,0.001995,0.000000,0.000000},
-	{ -0.023088,1.478501,-0.040018,0.390040,0.053102,0.919265,-0.641850,0.731500,0.230078,-1.000000,0.526492,0.497077,2,3,3,3,0.997490,0.002510,0.000000,0.000000},
-	{ -0.031539,1.482273,-0.034995,0.564062,0.046793,0.824405,-0.450021,0.854512,0.259404,-1.000000,0.540554,0.506378,2,3,3,3,0.994956,0.005044,0.000000,0.000000},
-	{ -0.041369,1.487903,-0.027548,0.638094,0.053276,0.768113,-0.298815,0.936547,0.183277,-1.000000,0.558599,0.521145,2,3,3,3,0.987011,0.012989,0.000000,0.000000},
-	{ -0.051168,1.494804,-0.018451,0.750221,0.066233,0.657862,-0.147961,0.986555,0.069408,-1.000000,0.577604,0.540391,2,3,3,3,0.970968,0.029032,0.000000,0.000000},
-	{ -0.057736,1.501939,-0.007791,0.915298,0.073188,0.396073,-0.047165,0.996063,-0.075061,-1.000000,0.591709,0.562305,2,3,3,3,0.960639,0.039361,0.000000,0.000000},
-	{ -0.060631,1.507648,0.004387,0.981114,0.065208,0.182107,-0.023574,0.974755,-0.222027,-1.000000,0.599046,0.585502,2,3,3,3,0.954515,0.045485,0.000000,0.000000},
-	{ -0.063321,1.515239,0.015418,0.995281,0.043369,0.086798,-0.009659,0.934391,-0.356117,-1.000000,0.605531,0.608901,2,3,3,3,0.896679,0.103321,0.000000,0.000000},
-	{ -0.063407,1.524578,0.030241,0.955849,0.014954,-0.293478,-0.168753,0.845540,-0.506541,-1.000000,0.607832,0.640243,2,3,3,3,0.850456,0.149544,0.000000,0.000000},
-	{ -0.050955,1.530972,0.049817,0.746480,0.001485,-0.665406,-0.493386,0.672210,-0.552000,-1.000000,0.585955,0.677472,2,3,3,3,0.962170,0.037829,0.000000,0.000000},
-	{ -0.023662,1.533755,0.073691,0.482151,0.000000,-0.876088,-0.803990,0.397264,-0.442472,-1.000000,0.533105,0.718649,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000015,1.570214,0.096368,-0.000001,0.664502,0.747286,-0.999997,0.001879,-0.001672,-1.000000,0.490639,0.851614,2,3,3,3,0.914764,0.085236,0.000000,0.000000},
-	{ 0.034817,1.571454,0.091305,0.242484,0.783042,0.572753,-0.970143,0.192761,0.147191,-1.000000,0.407864,0.837885,2,3,3,3,0.868817,0.131183,0.000000,0.000000},
-	{ 0.038825,1.563104,0.095731,0.288861,0.631492,0.719567,-0.943161,0.316723,0.100665,-1.000000,0.397004,0.855411,2,3,3,3,0.961303,0.038697,0.000000,0.000000},
-	{ 0.000015,1.561510,0.100504,-0.000001,0.461885,0.886940,-0.999990,0.003869,-0.002016,-1.000000,0.490489,0.871240,2,3,3,3,0.991227,0.008773,0.000000,0.000000},
-	{ 0.079855,1.568206,0.059368,0.365364,0.870311,0.330253,-0.930854,0.343257,0.125238,-1.000000,0.297435,0.767411,2,3,3,3,0.895506,0.104494,0.000000,0.000000},
-	{ 0.095805,1.558824,0.062757,0.402936,0.845145,0.351244,-0.907594,0.418444,0.034327,-1.000000,0.259426,0.777272,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.114222,1.552517,0.030570,0.374172,0.907014,-0.193187,-0.924796,0.380429,-0.005067,-1.000000,0.213986,0.693570,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.097486,1.559895,0.031653,0.364657,0.915320,-0.170921,-0.926155,0.375513,0.035020,-1.000000,0.252670,0.697538,2,3,3,3,0.940292,0.059708,0.000000,0.000000},
-	{ 0.112112,1.538241,0.007770,0.314900,0.738670,-0.595990,-0.927239,0.373494,-0.027013,-1.000000,0.210299,0.621754,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.097020,1.547778,0.011056,0.306606,0.788567,-0.533062,-0.933742,0.357865,-0.007673,-1.000000,0.247289,0.634741,2,3,3,3,0.981237,0.018763,0.000000,0.000000},
-	{ 0.104254,1.524755,-0.011602,0.358670,0.606473,-0.709610,-0.909121,0.399428,-0.118138,-1.000000,0.224867,0.555639,2,3,3,3,0.998681,0.001319,0.000000,0.000000},
-	{ 0.092786,1.538755,-0.005485,0.369336,0.711934,-0.597277,-0.915860,0.387755,-0.104147,-1.000000,0.255395,0.583514,2,3,3,3,0.978383,0.021617,0.000000,0.000000},
-	{ 0.000015,1.546866,0.107807,-0.000000,0.475057,0.879955,-0.999989,0.004163,-0.002248,-1.000000,0.490243,0.904757,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.040508,1.548139,0.103575,0.208783,0.572584,0.792816,-0.964736,0.253460,0.071005,-1.000000,0.390836,0.889940,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.089439,1.546775,0.085558,0.313431,0.672402,0.670549,-0.930160,0.359577,0.074209,-1.000000,0.274037,0.840483,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.128147,1.545865,0.062179,0.363883,0.887209,0.283638,-0.929890,0.363610,0.055610,-1.000000,0.184691,0.777496,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.135263,1.543970,0.029875,0.310867,0.921271,-0.233713,-0.944166,0.327565,0.035368,-1.000000,0.164938,0.692117,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.134965,1.527472,0.002036,0.248710,0.706197,-0.662894,-0.944543,0.328355,-0.004576,-1.000000,0.156652,0.604650,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.121228,1.500548,-0.021537,0.343963,0.460372,-0.818381,-0.914653,0.361386,-0.181132,-1.000000,0.181095,0.500377,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000015,1.527758,0.118315,0.000002,0.480516,0.876986,-0.999987,0.004424,-0.002422,-1.000000,0.489886,0.952316,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.043904,1.528699,0.114168,0.158934,0.538647,0.827405,-0.974282,0.221156,0.043173,-1.000000,0.379033,0.936566,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.095192,1.528784,0.100537,0.263101,0.634395,0.726857,-0.944741,0.322127,0.060819,-1.000000,0.256365,0.891697,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.127622,1.532246,0.082285,0.322875,0.715039,0.620057,-0.931783,0.355013,0.075803,-1.000000,0.182348,0.839635,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.144445,1.542007,0.055798,0.295668,0.952109,0.077898,-0.954517,0.291165,0.064185,-1.000000,0.146700,0.762825,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.146132,1.540161,0.029783,0.237101,0.940476,-0.243490,-0.962685,0.261112,0.071119,-1.000000,0.139633,0.693505,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.145880,1.529505,0.007722,0.193776,0.847894,-0.493484,-0.961450,0.264167,0.076354,-1.000000,0.133944,0.626811,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.143395,1.518549,-0.005034,0.161792,0.565903,-0.808441,-0.957213,0.289179,0.010858,-1.000000,0.135370,0.579837,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.136977,1.495855,-0.019020,0.296234,0.389171,-0.872234,-0.924057,0.347770,-0.158667,-1.000000,0.144338,0.503066,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000015,1.514337,0.125306,0.000004,0.474628,0.880187,-0.999986,0.004587,-0.002469,-1.000000,0.489585,0.985909,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045481,1.515195,0.121575,0.133973,0.526911,0.839295,-0.978218,0.205825,0.026931,-1.000000,0.372393,0.970532,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.097454,1.515933,0.110806,0.228357,0.608141,0.760275,-0.953494,0.297496,0.048426,-1.000000,0.247316,0.928485,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.122817,1.516132,0.101107,0.290465,0.665274,0.687780,-0.941407,0.327437,0.080855,-1.000000,0.188806,0.901826,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.134153,1.461358,-0.028801,0.480822,0.287529,-0.828334,-0.857462,0.351596,-0.375685,-1.000000,0.142668,0.407285,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.114942,1.460887,-0.039504,0.488446,0.343281,-0.802234,-0.860872,0.339765,-0.378761,-1.000000,0.190596,0.386075,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.134119,1.422704,-0.039131,0.612670,0.277842,-0.739891,-0.783746,0.334247,-0.523469,-1.000000,0.135712,0.306746,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.117914,1.417132,-0.057783,0.555278,0.298152,-0.776384,-0.827061,0.296049,-0.477833,-1.000000,0.186260,0.271523,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.135107,1.389970,-0.051122,0.682237,0.229090,-0.694312,-0.727190,0.311080,-0.611902,-1.000000,0.133498,0.220608,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.119941,1.383842,-0.067795,0.571772,0.134398,-0.809330,-0.805270,0.280601,-0.522306,-1.000000,0.180566,0.189689,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.135886,1.374711,-0.053618,0.693826,0.105550,-0.712365,-0.704152,0.306735,-0.640378,-1.000000,0.127665,0.184527,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.121147,1.368355,-0.067922,0.542277,-0.007963,-0.840162,-0.805939,0.277708,-0.522820,-1.000000,0.171640,0.155302,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.084739,1.367343,-0.088105,0.422707,0.032246,-0.905693,-0.888620,0.211003,-0.407226,-1.000000,0.272218,0.128075,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.085767,1.350400,-0.085033,0.426086,-0.050975,-0.903245,-0.881915,0.199172,-0.427265,-1.000000,0.262259,0.090443,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046055,1.352413,-0.101945,0.229242,0.010261,-0.973315,-0.967475,0.112286,-0.226682,-1.000000,0.371947,0.079088,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.082125,1.402583,-0.088585,0.414363,0.233572,-0.879629,-0.903073,0.225493,-0.365530,-1.000000,0.287818,0.205101,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.043760,1.390812,-0.101804,0.205300,0.151686,-0.966873,-0.975011,0.117380,-0.188614,-1.000000,0.382646,0.163700,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.076654,1.441365,-0.073099,0.414385,0.372016,-0.830595,-0.904900,0.265854,-0.332382,-1.000000,0.296841,0.297572,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038219,1.433637,-0.091116,0.209849,0.319039,-0.924217,-0.975033,0.138502,-0.173576,-1.000000,0.396709,0.258938,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000015,1.385715,-0.106047,0.000001,0.129632,-0.991562,-0.999987,0.005133,0.000000,-1.000000,0.490088,0.146483,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000015,1.424770,-0.097768,0.000001,0.259128,-0.965843,-0.999991,0.004136,0.001109,-1.000000,0.490677,0.232942,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000015,1.346066,-0.108980,-0.000005,0.026189,-0.999657,-0.999982,0.006009,0.000000,-1.000000,0.489399,0.058997,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046847,1.333318,-0.102130,0.239260,-0.021142,-0.970725,-0.965542,0.100242,-0.240166,-1.000000,0.367978,0.036048,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000015,1.326048,-0.108650,-0.000018,-0.000781,-1.000000,-0.999981,0.006245,0.000000,-1.000000,0.489014,0.014091,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000015,1.454234,-0.087462,0.000002,0.365584,-0.930778,-0.999993,0.003542,0.001389,-1.000000,0.491038,0.299471,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.021481,1.457292,-0.084205,0.112423,0.380301,-0.918005,-0.992667,0.084279,-0.086652,-1.000000,0.437459,0.309004,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.038493,1.465537,-0.076247,0.298338,0.398776,-0.867163,-0.950691,0.204815,-0.232888,-1.000000,0.393369,0.333990,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065545,1.475786,-0.060527,0.412757,0.371331,-0.831712,-0.899749,0.308297,-0.308878,-1.000000,0.320953,0.375555,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.096273,1.491142,-0.038373,0.455687,0.378734,-0.805550,-0.870211,0.379965,-0.313622,-1.000000,0.241793,0.444472,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.093038,1.514962,-0.027039,0.430641,0.521199,-0.736817,-0.884807,0.404776,-0.230810,-1.000000,0.251339,0.506288,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.084942,1.529497,-0.021548,0.383855,0.636553,-0.668922,-0.916874,0.348674,-0.194338,-1.000000,0.273032,0.536304,2,3,3,3,0.993567,0.006433,0.000000,0.000000},
-	{ 0.073447,1.519341,-0.035049,0.331509,0.605286,-0.723692,-0.940514,0.272509,-0.202908,-1.000000,0.298757,0.494721,2,3,3,3,0.987389,0.012611,0.000000,0.000000},
-	{ 0.081046,1.507109,-0.040145,0.460276,0.406731,-0.789123,-0.869324,0.386774,-0.307704,-1.000000,0.281823,0.467727,2,3,3,3,0.998198,0.001802,0.000000,0.000000},
-	{ 0.058949,1.510429,-0.049446,0.299393,0.581708,-0.756294,-0.952786,0.224330,-0.204633,-1.000000,0.335781,0.453747,2,3,3,3,0.986512,0.013488,0.000000,0.000000},
-	{ 0.064843,1.498065,-0.054200,0.436647,0.361572,-0.823775,-0.881214,0.356243,-0.310730,-1.000000,0.323940,0.426160,2,3,3,3,0.997528,0.002472,0.000000,0.000000},
-	{ 0.045328,1.503487,-0.059198,0.220040,0.503047,-0.835779,-0.973699,0.165165,-0.156940,-1.000000,0.372053,0.423848,2,3,3,3,0.984924,0.015076,0.000000,0.000000},
-	{ 0.050802,1.490801,-0.062897,0.322228,0.333184,-0.886091,-0.932094,0.275245,-0.235460,-1.000000,0.360380,0.398028,2,3,3,3,0.996636,0.003364,0.000000,0.000000},
-	{ 0.033039,1.497938,-0.064602,0.131903,0.443331,-0.886600,-0.990445,0.095251,-0.099723,-1.000000,0.404131,0.404646,2,3,3,3,0.994705,0.005295,0.000000,0.000000},
-	{ 0.036980,1.484473,-0.068225,0.266960,0.326162,-0.906836,-0.955337,0.213323,-0.204512,-1.000000,0.395559,0.376803,2,3,3,3,0.998682,0.001318,0.000000,0.000000},
-	{ 0.022509,1.493960,-0.066960,0.074741,0.461942,-0.883755,-0.997187,0.039645,-0.063611,-1.000000,0.431704,0.393429,2,3,3,3,0.997193,0.002807,0.000000,0.000000},
-	{ 0.026520,1.480700,-0.071742,0.145715,0.402742,-0.903640,-0.987206,0.118958,-0.106172,-1.000000,0.422946,0.364683,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.011748,1.491020,-0.069093,0.063240,0.477914,-0.876127,-0.997985,0.025695,-0.058020,-1.000000,0.460374,0.385351,2,3,3,3,0.997685,0.002315,0.000000,0.000000},
-	{ 0.014487,1.477092,-0.074983,0.099307,0.427134,-0.898719,-0.994590,0.070280,-0.076499,-1.000000,0.454173,0.353866,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000014,1.490345,-0.070374,0.000032,0.479482,-0.877552,-0.999990,0.003881,0.002084,-1.000000,0.491398,0.382499,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000015,1.475829,-0.076399,0.000015,0.432086,-0.901832,-0.999992,0.003691,0.001751,-1.000000,0.491273,0.349658,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.014458,1.477092,-0.074984,-0.099295,0.427112,-0.898730,-0.994794,-0.063419,0.079769,-1.000000,0.528422,0.353619,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.011718,1.491019,-0.069095,-0.063204,0.477863,-0.876158,-0.997915,-0.018736,0.061769,-1.000000,0.522462,0.385093,2,3,3,3,0.997684,0.002316,0.000000,0.000000},
-	{ -0.026490,1.480700,-0.071743,-0.145731,0.402706,-0.903654,-0.987556,-0.113806,0.108545,-1.000000,0.559774,0.364257,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.022480,1.493960,-0.066963,-0.074764,0.461886,-0.883783,-0.997201,-0.035253,0.065935,-1.000000,0.551250,0.392972,2,3,3,3,0.997197,0.002803,0.000000,0.000000},
-	{ -0.036951,1.484473,-0.068226,-0.266986,0.326137,-0.906837,-0.955668,-0.210841,0.205535,-1.000000,0.587297,0.376268,2,3,3,3,0.998684,0.001316,0.000000,0.000000},
-	{ -0.033010,1.497938,-0.064604,-0.131952,0.443300,-0.886608,-0.990482,-0.094315,0.100254,-1.000000,0.578967,0.404078,2,3,3,3,0.994712,0.005288,0.000000,0.000000},
-	{ -0.050773,1.490801,-0.062898,-0.322242,0.333167,-0.886093,-0.932209,-0.274590,0.235768,-1.000000,0.622659,0.397449,2,3,3,3,0.996634,0.003366,0.000000,0.000000},
-	{ -0.045299,1.503487,-0.059198,-0.220050,0.503042,-0.835779,-0.973600,-0.166539,0.156099,-1.000000,0.611211,0.423288,2,3,3,3,0.984910,0.015090,0.000000,0.000000},
-	{ -0.064813,1.498065,-0.054201,-0.436655,0.361543,-0.823784,-0.881208,-0.356243,0.310745,-1.000000,0.659258,0.425681,2,3,3,3,0.997526,0.002474,0.000000,0.000000},
-	{ -0.058919,1.510429,-0.049447,-0.299365,0.581715,-0.756299,-0.952692,-0.225865,0.203377,-1.000000,0.647591,0.453381,2,3,3,3,0.986499,0.013501,0.000000,0.000000},
-	{ -0.081017,1.507108,-0.040147,-0.460276,0.406696,-0.789141,-0.869469,-0.386092,0.308150,-1.000000,0.701478,0.467484,2,3,3,3,0.998196,0.001804,0.000000,0.000000},
-	{ -0.073417,1.519341,-0.035051,-0.331450,0.605292,-0.723714,-0.940493,-0.272889,0.202495,-1.000000,0.684601,0.494691,2,3,3,3,0.987374,0.012626,0.000000,0.000000},
-	{ -0.093010,1.514963,-0.027041,-0.430653,0.521139,-0.736853,-0.885002,-0.403915,0.231570,-1.000000,0.731979,0.506331,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.084914,1.529498,-0.021550,-0.383806,0.636548,-0.668954,-0.916922,-0.348465,0.194491,-1.000000,0.710257,0.536599,2,3,3,3,0.993561,0.006439,0.000000,0.000000},
-	{ -0.104226,1.524758,-0.011604,-0.358728,0.606429,-0.709618,-0.909155,-0.399277,0.118382,-1.000000,0.758425,0.556062,2,3,3,3,0.998681,0.001319,0.000000,0.000000},
-	{ -0.092759,1.538757,-0.005486,-0.369332,0.711932,-0.597282,-0.915709,-0.388316,0.103379,-1.000000,0.727803,0.584138,2,3,3,3,0.978362,0.021638,0.000000,0.000000},
-	{ -0.096993,1.547780,0.011055,-0.306651,0.788589,-0.533003,-0.933466,-0.358608,0.006480,-1.000000,0.735749,0.635692,2,3,3,3,0.981213,0.018787,0.000000,0.000000},
-	{ -0.112084,1.538243,0.007769,-0.314975,0.738665,-0.595958,-0.926841,-0.374583,0.025574,-1.000000,0.772815,0.622710,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.097457,1.559895,0.031653,-0.364676,0.915324,-0.170860,-0.925726,-0.376151,-0.039268,-1.000000,0.730046,0.698860,2,3,3,3,0.940224,0.059776,0.000000,0.000000},
-	{ -0.114193,1.552518,0.030570,-0.374202,0.907011,-0.193144,-0.924518,-0.381135,0.001360,-1.000000,0.768753,0.695021,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.079826,1.568205,0.059368,-0.365365,0.870311,0.330253,-0.930864,-0.341698,-0.129360,-1.000000,0.684747,0.768763,2,3,3,3,0.895402,0.104598,0.000000,0.000000},
-	{ -0.095776,1.558824,0.062757,-0.402936,0.845142,0.351251,-0.908307,-0.416374,-0.040127,-1.000000,0.722643,0.778908,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038795,1.563104,0.095731,-0.288861,0.631497,0.719563,-0.944494,-0.310835,-0.106365,-1.000000,0.584184,0.856090,2,3,3,3,0.961286,0.038714,0.000000,0.000000},
-	{ -0.034787,1.571454,0.091305,-0.242483,0.783045,0.572750,-0.970096,-0.189134,-0.152129,-1.000000,0.573527,0.838463,2,3,3,3,0.868755,0.131245,0.000000,0.000000},
-	{ -0.040478,1.548139,0.103575,-0.208782,0.572584,0.792816,-0.966152,-0.246373,-0.076494,-1.000000,0.589849,0.890714,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.089410,1.546775,0.085558,-0.313429,0.672402,0.670551,-0.931770,-0.354001,-0.080550,-1.000000,0.707246,0.842202,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.128118,1.545865,0.062179,-0.363880,0.887209,0.283640,-0.930225,-0.361728,-0.061915,-1.000000,0.797306,0.779709,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.135234,1.543970,0.029875,-0.310889,0.921268,-0.233694,-0.943710,-0.328431,-0.039302,-1.000000,0.817810,0.693814,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.134935,1.527472,0.002036,-0.248771,0.706182,-0.662888,-0.944326,-0.328989,0.003915,-1.000000,0.826562,0.605559,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.121199,1.500548,-0.021537,-0.343994,0.460338,-0.818387,-0.915297,-0.358879,0.182860,-1.000000,0.802250,0.500208,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043874,1.528699,0.114168,-0.158940,0.538640,0.827409,-0.975795,-0.213209,-0.048646,-1.000000,0.600911,0.937516,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.095162,1.528784,0.100537,-0.263109,0.634373,0.726874,-0.946680,-0.314964,-0.067790,-1.000000,0.724131,0.893746,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.127593,1.532247,0.082285,-0.322875,0.715029,0.620070,-0.933265,-0.349476,-0.082962,-1.000000,0.798867,0.842297,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.144416,1.542008,0.055798,-0.295656,0.952113,0.077900,-0.954258,-0.290553,-0.070504,-1.000000,0.835425,0.765242,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.146102,1.540161,0.029783,-0.237102,0.940478,-0.243482,-0.962083,-0.262098,-0.075512,-1.000000,0.843089,0.695362,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.145851,1.529505,0.007722,-0.193785,0.847892,-0.493485,-0.961008,-0.265206,-0.078295,-1.000000,0.849172,0.628000,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.143365,1.518549,-0.005034,-0.161793,0.565903,-0.808441,-0.957422,-0.288507,-0.010345,-1.000000,0.847908,0.580472,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.136947,1.495855,-0.019020,-0.296235,0.389171,-0.872233,-0.925100,-0.344051,0.160682,-1.000000,0.838994,0.502726,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045452,1.515195,0.121575,-0.133988,0.526897,0.839302,-0.979755,-0.197566,-0.032382,-1.000000,0.606957,0.971592,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.097424,1.515931,0.110804,-0.228377,0.608096,0.760305,-0.955569,-0.289497,-0.055488,-1.000000,0.732571,0.930715,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.122788,1.516132,0.101107,-0.290467,0.665226,0.687826,-0.943245,-0.319993,-0.088851,-1.000000,0.791459,0.904719,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.134124,1.461358,-0.028801,-0.480818,0.287530,-0.828336,-0.858938,-0.344276,0.379077,-1.000000,0.840328,0.405707,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.114912,1.460887,-0.039504,-0.488445,0.343281,-0.802234,-0.861888,-0.333376,0.382112,-1.000000,0.792264,0.384764,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.134090,1.422704,-0.039131,-0.612661,0.277843,-0.739899,-0.784863,-0.323971,0.528236,-1.000000,0.846383,0.304053,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.117885,1.417132,-0.057783,-0.555277,0.298151,-0.776385,-0.827943,-0.286396,0.482169,-1.000000,0.795445,0.269223,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.135078,1.389970,-0.051123,-0.682223,0.229091,-0.694326,-0.728111,-0.299288,0.616670,-1.000000,0.847528,0.217283,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.119911,1.383842,-0.067794,-0.571771,0.134393,-0.809331,-0.807070,-0.269335,0.525449,-1.000000,0.800051,0.186872,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.135857,1.374711,-0.053618,-0.693802,0.105541,-0.712390,-0.706044,-0.294617,0.643974,-1.000000,0.852837,0.180990,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.121117,1.368355,-0.067922,-0.542278,-0.007976,-0.840161,-0.808721,-0.266191,0.524512,-1.000000,0.808458,0.152253,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.084709,1.367343,-0.088105,-0.422713,0.032231,-0.905691,-0.890490,-0.200419,0.408485,-1.000000,0.707587,0.126009,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.085738,1.350400,-0.085032,-0.426093,-0.051028,-0.903239,-0.884135,-0.188076,0.427706,-1.000000,0.716948,0.088140,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046025,1.352413,-0.101945,-0.229248,0.010236,-0.973314,-0.968613,-0.101121,0.227078,-1.000000,0.607157,0.077903,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.082095,1.402583,-0.088585,-0.414366,0.233571,-0.879628,-0.904090,-0.216623,0.368368,-1.000000,0.693115,0.203464,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.043730,1.390812,-0.101805,-0.205300,0.151687,-0.966873,-0.975780,-0.107970,0.190253,-1.000000,0.597758,0.162774,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.076624,1.441365,-0.073099,-0.414387,0.372016,-0.830595,-0.905555,-0.259638,0.335496,-1.000000,0.685241,0.296384,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038189,1.433637,-0.091116,-0.209849,0.319039,-0.924217,-0.975570,-0.131176,0.176227,-1.000000,0.584944,0.258287,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046817,1.333317,-0.102128,-0.239283,-0.021210,-0.970718,-0.966672,-0.088546,0.240220,-1.000000,0.610411,0.034731,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.021451,1.457292,-0.084205,-0.112421,0.380295,-0.918007,-0.992962,-0.077638,0.089438,-1.000000,0.544730,0.308663,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.038464,1.465537,-0.076247,-0.298343,0.398770,-0.867165,-0.951132,-0.200000,0.235261,-1.000000,0.589091,0.333427,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065515,1.475786,-0.060527,-0.412762,0.371324,-0.831713,-0.900240,-0.305212,0.310506,-1.000000,0.661895,0.374841,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.096243,1.491142,-0.038373,-0.455695,0.378713,-0.805555,-0.870754,-0.377480,0.315114,-1.000000,0.741402,0.443965,2,3,3,3,1.000000,0.000000,0.000000,0.000000},
-	{ -0.044118,1.506169,-0.057498,-0.273412,0.472172,-0.838033,-0.960910,-0.173537,0.215726,-1.000000,0.606965,0.432736,2,3,3,3,0.974580,0.025420,0.000000,0.000000},
-	{ -0.032158,1.500796,-0.063035,-0.167568,0.423513,-0.890257,-0.985834,-0.078594,0.148170,-1.000000,0.575714,0.413783,2,3,3,3,0.976570,0.023430,0.000000,0.000000},
-	{ -0.057547,1.513126,-0.047975,-0.371771,0.458440,-0.807230,-0.925349,-0.252576,0.282728,-1.000000,0.642189,0.462692,2,3,3,3,0.970275,0.029725,0.000000,0.000000},
-	{ -0.071923,1.522331,-0.034110,-0.471848,0.433028,-0.768014,-0.874397,-0.341564,0.344623,-1.000000,0.677292,0.503075,2,3,3,3,0.947466,0.052534,0.000000,0.000000},
-	{ -0.083050,1.532527,-0.020582,-0.574550,0.499375,-0.648473,-0.810569,-0.456990,0.366249,-1.000000,0.701032,0.544201,2,3,3,3,0.969545,0.030455,0.000000,0.000000},
-	{ -0.090161,1.541431,-0.004588,-0.607251,0.619738,-0.497163,-0.794332,-0.486817,0.363381,-1.000000,0.716562,0.589795,2,3,3,3,0.974711,0.025289,0.000000,0.000000},
-	{ -0.093935,1.550161,0.011555,-0.575955,0.694431,-0.431325,-0.816997,-0.507129,0.274474,-1.000000,0.723104,0.638445,2,3,3,3,0.976227,0.023773,0.000000,0.000000},
-	{ -0.094012,1.561806,0.031842,-0.624862,0.765261,-0.154672,-0.753048,-0.643048,-0.139317,-1.000000,0.715920,0.697397,2,3,3,3,0.922131,0.077869,0.000000,0.000000},
-	{ -0.076740,1.569974,0.058899,-0.618656,0.679852,0.393785,-0.784757,-0.558775,-0.268193,-1.000000,0.672675,0.761520,2,3,3,3,0.872115,0.127885,0.000000,0.000000},
-	{ -0.033753,1.573241,0.090339,-0.427066,0.477513,0.767851,-0.895711,-0.339636,-0.286966,-1.000000,0.568234,0.826671,2,3,3,3,0.840755,0.159245,0.000000,0.000000},
-	{ 0.000015,1.572077,0.095350,-0.000001,0.249228,0.968445,-0.999995,0.003040,0.000000,-1.000000,0.490721,0.838992,2,3,3,3,0.897976,0.102024,0.000000,0.000000},
-	{ 0.033783,1.573241,0.090339,0.427064,0.477512,0.767853,-0.894766,0.345654,0.282696,-1.000000,0.413298,0.826163,2,3,3,3,0.840830,0.159170,0.000000,0.000000},
-	{ 0.076769,1.569974,0.058899,0.618664,0.679843,0.393787,-0.784607,0.560516,0.264979,-1.000000,0.309534,0.760195,2,3,3,3,0.872244,0.127756,0.000000,0.000000},
-	{ 0.094040,1.561806,0.031842,0.624916,0.765213,-0.154689,-0.753416,0.643043,0.137328,-1.000000,0.266832,0.696153,2,3,3,3,0.922223,0.077777,0.000000,0.000000},
-	{ 0.093963,1.550159,0.011556,0.576067,0.694341,-0.431320,-0.816876,0.507963,-0.273291,-1.000000,0.259914,0.637474,2,3,3,3,0.976257,0.023743,0.000000,0.000000},
-	{ 0.090189,1.541429,-0.004586,0.607389,0.619635,-0.497123,-0.794231,0.486746,-0.363698,-1.000000,0.266604,0.589146,2,3,3,3,0.974736,0.025264,0.000000,0.000000},
-	{ 0.083079,1.532526,-0.020580,0.574701,0.499278,-0.648414,-0.810638,0.455928,-0.367418,-1.000000,0.282225,0.543862,2,3,3,3,0.969572,0.030428,0.000000,0.000000},
-	{ 0.071953,1.522332,-0.034109,0.471943,0.432949,-0.768001,-0.874520,0.340299,-0.345560,-1.000000,0.306068,0.503052,2,3,3,3,0.947519,0.052481,0.000000,0.000000},
-	{ 0.057577,1.513126,-0.047974,0.371818,0.458360,-0.807253,-0.925681,0.248413,-0.285317,-1.000000,0.341232,0.463032,2,3,3,3,0.970301,0.029699,0.000000,0.000000},
-	{ 0.044148,1.506169,-0.057498,0.273401,0.472108,-0.838073,-0.961133,0.168867,-0.218419,-1.000000,0.376378,0.433309,2,3,3,3,0.974604,0.025396,0.000000,0.000000},
-	{ 0.032187,1.500796,-0.063033,0.167518,0.423473,-0.890285,-0.985852,0.077256,-0.148752,-1.000000,0.407471,0.414388,2,3,3,3,0.976572,0.023428,0.000000,0.000000},
-	{ 0.021850,1.496959,-0.065517,0.079077,0.380871,-0.921240,-0.996741,0.015397,-0.079192,-1.000000,0.434221,0.403478,2,3,3,3,0.982738,0.017262,0.000000,0.000000},
-	{ 0.011379,1.494065,-0.067386,0.051055,0.373020,-0.926417,-0.998637,0.008987,-0.051416,-1.000000,0.461666,0.395810,2,3,3,3,0.994396,0.005604,0.000000,0.000000},
-	{ 0.000009,1.493302,-0.068313,0.000060,0.384272,-0.923220,-0.999987,0.004825,0.001943,-1.000000,0.491445,0.393068,2,3,3,3,0.998964,0.001036,0.000000,0.000000},
-	{ -0.011351,1.494065,-0.067388,-0.051044,0.372849,-0.926487,-0.998494,0.000000,0.054862,-1.000000,0.521241,0.395527,2,3,3,3,0.994405,0.005595,0.000000,0.000000},
-	{ -0.021821,1.496959,-0.065520,-0.079048,0.380884,-0.921238,-0.996665,-0.011433,0.080793,-1.000000,0.548810,0.402983,2,3,3,3,0.982750,0.017250,0.000000,0.000000},
-	{ -0.021593,1.495015,-0.064349,-0.020796,0.487914,-0.872644,-0.995291,0.072546,0.064281,-1.000000,0.548852,0.398709,2,3,3,3,0.991452,0.008548,0.000000,0.000000},
-	{ -0.011244,1.492172,-0.066317,-0.027378,0.548329,-0.835814,-0.997482,0.039733,0.058740,-1.000000,0.521330,0.391444,2,3,3,3,0.997451,0.002549,0.000000,0.000000},
-	{ -0.031765,1.498824,-0.061973,-0.058515,0.534024,-0.843442,-0.993793,0.048911,0.099913,-1.000000,0.575949,0.409482,2,3,3,3,0.987395,0.012605,0.000000,0.000000},
-	{ -0.043587,1.504147,-0.056605,-0.169434,0.588338,-0.790664,-0.979243,-0.009942,0.202447,-1.000000,0.607775,0.428505,2,3,3,3,0.979634,0.020366,0.000000,0.000000},
-	{ -0.056776,1.510920,-0.047220,-0.300130,0.583430,-0.754673,-0.946558,-0.084196,0.311351,-1.000000,0.643510,0.458122,2,3,3,3,0.980489,0.019511,0.000000,0.000000},
-	{ -0.070864,1.519758,-0.033439,-0.401226,0.525711,-0.750097,-0.914106,-0.177459,0.364581,-1.000000,0.679272,0.497975,2,3,3,3,0.961678,0.038322,0.000000,0.000000},
-	{ -0.081968,1.529748,-0.020332,-0.468271,0.552127,-0.689839,-0.883507,-0.282209,0.373863,-1.000000,0.703745,0.538828,2,3,3,3,0.980302,0.019698,0.000000,0.000000},
-	{ -0.089336,1.538707,-0.004641,-0.495787,0.658995,-0.565616,-0.868437,-0.378852,0.319825,-1.000000,0.720087,0.584687,2,3,3,3,0.972247,0.027753,0.000000,0.000000},
-	{ -0.093291,1.547436,0.011305,-0.424109,0.754698,-0.500562,-0.900570,-0.409708,0.145304,-1.000000,0.727654,0.633837,2,3,3,3,0.981584,0.018416,0.000000,0.000000},
-	{ -0.093427,1.558864,0.031301,-0.404038,0.875318,-0.265655,-0.786472,-0.480717,-0.387781,-1.000000,0.721763,0.695794,2,3,3,3,0.925967,0.074033,0.000000,0.000000},
-	{ -0.076315,1.566804,0.058035,-0.414993,0.882848,0.219908,-0.865065,-0.308001,-0.395977,-1.000000,0.677839,0.765000,2,3,3,3,0.884000,0.116000,0.000000,0.000000},
-	{ -0.033410,1.569980,0.088930,-0.334859,0.707136,0.622759,-0.933929,-0.161339,-0.318977,-1.000000,0.570972,0.832854,2,3,3,3,0.872044,0.127956,0.000000,0.000000},
-	{ 0.000015,1.568809,0.093840,-0.000001,0.577739,0.816222,-1.000000,0.000000,0.000000,-1.000000,0.490676,0.845884,2,3,3,3,0.917443,0.082557,0.000000,0.000000},
-	{ 0.033439,1.569980,0.088930,0.334865,0.707156,0.622732,-0.934352,0.163725,0.316513,-1.000000,0.410482,0.832306,2,3,3,3,0.872101,0.127899,0.000000,0.000000},
-	{ 0.076344,1.566804,0.058036,0.414997,0.882848,0.219903,-0.865609,0.308694,0.394246,-1.000000,0.304355,0.763669,2,3,3,3,0.884113,0.115887,0.000000,0.000000},
-	{ 0.093456,1.558863,0.031301,0.404080,0.875287,-0.265691,-0.788508,0.480535,0.383852,-1.000000,0.260993,0.694545,2,3,3,3,0.926054,0.073946,0.000000,0.000000},
-	{ 0.093318,1.547434,0.011306,0.424216,0.754626,-0.500580,-0.900461,0.410106,-0.144857,-1.000000,0.255382,0.632899,2,3,3,3,0.981608,0.018392,0.000000,0.000000},
-	{ 0.089363,1.538706,-0.004639,0.495917,0.658929,-0.565578,-0.868366,0.378235,-0.320747,-1.000000,0.263098,0.584071,2,3,3,3,0.972276,0.027724,0.000000,0.000000},
-	{ 0.081997,1.529748,-0.020330,0.468444,0.552035,-0.689795,-0.883395,0.281058,-0.374992,-1.000000,0.279534,0.538517,2,3,3,3,0.980316,0.019684,0.000000,0.000000},
-	{ 0.070894,1.519758,-0.033438,0.401377,0.525584,-0.750106,-0.913971,0.176534,-0.365366,-1.000000,0.304088,0.497991,2,3,3,3,0.961711,0.038289,0.000000,0.000000},
-	{ 0.056806,1.510920,-0.047219,0.300227,0.583334,-0.754709,-0.946189,0.081934,-0.313070,-1.000000,0.339890,0.458479,2,3,3,3,0.980505,0.019495,0.000000,0.000000},
-	{ 0.043616,1.504147,-0.056604,0.169419,0.588311,-0.790688,-0.978985,0.008050,-0.203775,-1.000000,0.375534,0.429073,2,3,3,3,0.979652,0.020348,0.000000,0.000000},
-	{ 0.031794,1.498824,-0.061971,0.058459,0.534019,-0.843449,-0.993830,-0.048639,-0.099677,-1.000000,0.407194,0.410069,2,3,3,3,0.987384,0.012616,0.000000,0.000000},
-	{ 0.021623,1.495015,-0.064346,0.020804,0.487934,-0.872633,-0.995647,-0.069201,-0.062430,-1.000000,0.434144,0.399182,2,3,3,3,0.991438,0.008562,0.000000,0.000000},
-	{ 0.011273,1.492172,-0.066316,0.027442,0.548295,-0.835835,-0.997881,-0.034325,-0.055280,-1.000000,0.461549,0.391713,2,3,3,3,0.997451,0.002549,0.000000,0.000000},
-	{ 0.000012,1.491480,-0.067408,0.000096,0.573036,-0.819530,-0.999993,0.003210,0.002127,-1.000000,0.491426,0.389241,2,3,3,3,0.998984,0.001016,0.000000,0.000000}};
-
-const uint32_t unAvatarIndexCount_316 = 1716;
-const uint32_t aunAvatarVertices_316[] = {
-2,1,0,3,2,0,3,4,2,4,5,2,4,6,5,6,
-7,5,7,6,8,9,7,8,9,8,10,11,9,10,11,10,
-12,10,13,12,12,13,14,13,15,14,16,14,15,17,16,15,
-16,17,18,17,19,18,18,19,20,19,21,20,20,21,22,21,
-23,22,22,23,24,23,25,24,24,25,26,27,24,26,28,27,
-26,29,28,26,29,30,28,30,31,28,30,32,31,32,33,31,
-32,34,33,34,35,33,34,36,35,36,37,35,37,36,38,39,
-37,38,38,40,39,40,41,39,40,42,41,42,43,41,44,43,
-42,45,44,42,46,44,45,47,46,45,46,47,48,47,49,48,
-48,49,50,49,51,50,50,51,0,1,50,0,1,52,50,53,
-52,1,2,53,1,54,53,2,5,54,2,55,54,5,7,55,
-5,56,55,7,9,56,7,57,56,9,11,57,9,58,57,11,
-12,58,11,59,58,12,14,59,12,60,59,14,16,60,14,61,
-60,16,18,61,16,62,61,18,20,62,18,63,62,20,22,63,
-20,64,63,22,24,64,22,65,64,24,27,65,24,66,65,27,
-28,66,27,67,66,28,31,67,28,68,67,31,33,68,31,69,
-68,33,35,69,33,70,69,35,37,70,35,71,70,37,39,71,
-37,72,71,39,41,72,39,73,72,41,43,73,41,74,73,43,
-44,74,43,75,74,44,46,75,44,76,75,46,48,76,46,77,
-76,48,50,77,48,52,77,50,52,78,77,79,78,52,53,79,
-52,80,79,53,54,80,53,81,80,54,55,81,54,82,81,55,
-56,82,55,83,82,56,57,83,56,84,83,57,58,84,57,85,
-84,58,59,85,58,86,85,59,60,86,59,87,86,60,61,87,
-60,88,87,61,62,88,61,89,88,62,63,89,62,90,89,63,
-64,90,63,91,90,64,65,91,64,92,91,65,66,92,65,93,
-92,66,67,93,66,94,93,67,68,94,67,95,94,68,69,95,
-68,96,95,69,70,96,69,97,96,70,71,97,70,98,97,71,
-72,98,71,99,98,72,73,99,72,100,99,73,74,100,73,101,
-100,74,75,101,74,102,101,75,76,102,75,103,102,76,77,103,
-76,78,103,77,78,104,103,105,104,78,79,105,78,106,105,79,
-80,106,79,107,106,80,81,107,80,108,107,81,82,108,81,109,
-108,82,83,109,82,110,109,83,84,110,83,111,110,84,85,111,
-84,112,111,85,86,112,85,113,112,86,87,113,86,114,113,87,
-88,114,87,115,114,88,89,115,88,116,115,89,90,116,89,117,
-116,90,91,117,90,118,117,91,92,118,91,119,118,92,93,119,
-92,120,119,93,94,120,93,121,120,94,95,121,94,122,121,95,
-96,122,95,123,122,96,97,123,96,124,123,97,98,124,97,125,
-124,98,99,125,98,126,125,99,100,126,99,127,126,100,101,127,
-100,128,127,101,102,128,101,129,128,102,103,129,102,104,129,103,
-132,131,130,133,132,130,131,132,134,132,135,134,135,136,134,136,
-137,134,137,136,138,139,137,138,139,138,140,141,139,140,133,142,
-132,142,143,132,132,143,135,143,144,135,144,145,135,135,145,136,
-145,146,136,136,146,147,138,136,147,140,138,147,148,140,147,142,
-149,143,149,150,143,143,150,144,150,151,144,144,151,145,151,152,
-145,152,153,145,145,153,146,153,154,146,147,146,154,155,147,154,
-147,156,148,156,147,155,156,157,148,149,158,150,158,159,150,150,
-159,151,159,160,151,151,160,161,152,151,161,157,162,148,162,163,
-148,162,164,163,164,165,163,164,166,165,166,167,165,166,168,167,
-168,169,167,170,167,169,165,167,170,171,170,169,172,170,171,173,
-170,172,173,165,170,163,165,173,174,173,172,175,173,174,175,163,
-173,176,175,174,174,177,176,174,172,177,177,178,176,172,179,177,
-180,172,171,172,180,179,180,181,179,176,178,182,183,176,182,183,
-184,176,185,175,176,184,185,176,175,185,186,163,175,186,148,163,
-186,148,186,187,140,148,187,140,187,188,141,140,188,188,187,189,
-187,190,189,187,186,190,189,190,191,190,192,191,186,185,192,190,
-186,192,191,192,193,192,194,193,192,185,194,193,194,195,194,196,
-195,194,185,196,195,196,197,196,198,197,197,198,199,198,200,199,
-199,200,201,200,202,201,196,184,198,198,184,200,185,184,196,184,
-183,200,200,183,202,183,182,202,202,203,201,203,204,201,203,205,
-204,205,206,204,205,207,206,207,208,206,207,209,208,209,210,208,
-209,211,210,211,212,210,211,213,212,213,214,212,213,215,214,215,
-216,214,215,217,216,217,218,216,219,218,217,220,219,217,221,219,
-220,222,221,220,221,222,223,222,224,223,224,225,223,225,226,223,
-226,225,130,225,133,130,142,133,225,227,142,225,227,225,224,228,
-227,224,229,228,224,229,224,222,230,229,222,222,220,231,230,222,
-231,220,217,231,217,232,231,149,142,227,233,149,227,233,227,228,
-234,233,228,234,228,229,235,234,229,236,235,229,236,229,230,237,
-236,230,230,231,237,231,238,237,239,231,232,231,239,238,240,239,
-232,158,149,233,241,158,233,241,233,234,242,241,234,234,235,243,
-242,234,243,244,240,232,245,244,232,246,244,245,247,246,245,248,
-246,247,249,248,247,250,248,249,251,250,249,249,252,251,249,247,
-252,252,253,251,252,254,253,252,255,254,247,255,252,247,245,255,
-255,256,254,255,257,256,245,257,255,257,258,256,177,256,258,254,
-256,177,178,177,258,179,254,177,254,259,253,259,254,179,181,259,
-179,178,258,182,258,260,182,261,260,258,262,261,258,257,262,258,
-262,257,263,257,245,263,245,232,263,263,232,215,232,217,215,263,
-215,213,263,213,211,262,263,211,262,211,209,262,209,207,261,262,
-207,261,207,205,261,205,203,260,261,203,260,203,202,182,260,202,
-32,265,264,34,32,264,34,264,36,264,266,36,36,266,267,38,
-36,267,38,267,40,267,268,40,40,268,269,42,40,269,42,269,
-270,45,42,270,45,270,271,47,45,271,47,271,272,49,47,272,
-49,272,273,51,49,273,51,273,274,0,51,274,0,274,3,274,
-275,3,3,275,4,275,276,4,4,276,6,276,277,6,6,277,
-8,277,278,8,8,278,10,278,279,10,10,279,13,279,280,13,
-13,280,15,280,281,15,15,281,17,281,282,17,17,282,19,282,
-283,19,19,283,21,283,284,21,21,284,23,284,285,23,23,285,
-25,285,286,25,25,286,26,286,287,26,29,26,287,288,29,287,
-29,288,289,30,29,289,30,289,265,32,30,265,289,288,290,288,
-291,290,289,290,292,265,289,292,265,292,293,264,265,293,264,293,
-266,293,294,266,266,294,295,267,266,295,267,295,268,295,296,268,
-268,296,297,269,268,297,269,297,298,270,269,298,270,298,299,271,
-270,299,271,299,300,272,271,300,272,300,301,273,272,301,273,301,
-302,274,273,302,274,302,275,302,303,275,275,303,276,303,304,276,
-276,304,277,304,305,277,277,305,278,305,306,278,278,306,279,306,
-307,279,279,307,280,307,308,280,280,308,281,308,309,281,281,309,
-282,309,310,282,282,310,283,310,311,283,283,311,284,311,312,284,
-284,312,285,312,313,285,285,313,286,313,314,286,286,314,287,314,
-315,287,288,287,315,291,288,315,309,189,310,188,189,309,189,191,
-310,310,191,311,191,193,311,311,193,312,193,195,312,312,195,313,
-195,197,313,313,197,314,197,199,314,314,199,315,199,201,315,315,
-201,204,291,315,204,291,204,206,290,291,206,290,206,208,292,290,
-208,292,208,210,293,292,210,293,210,294,210,212,294,294,212,214,
-295,294,214,295,214,296,214,216,296,296,216,218,297,296,218,297,
-218,219,298,297,219,298,219,221,299,298,221,299,221,223,300,299,
-223,300,223,226,301,300,226,301,226,130,302,301,130,302,130,303,
-130,131,303,303,131,304,131,134,304,304,134,305,134,137,305,305,
-137,306,137,139,306,306,139,307,139,141,307,307,141,308,141,188,
-308,308,188,309};
-
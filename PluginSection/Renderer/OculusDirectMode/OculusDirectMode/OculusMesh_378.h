@@ -1,533 +0,0 @@
-/********************************************************************
-Vireio Perception: Open-Source Stereoscopic 3D Driver
-Copyright (C) 2012 Andres Hernandez
-This file was exported from Vireio using Oculus Avatar SDK.
-Data Copyright : Copyright 2014-2016 Oculus VR, LLC All Rights reserved.
-
-Vireio Perception Version History :.
-v1.0.0 2012 by Andres Hernandez.
-v1.0.X 2013 by John Hicks, Neil Schneider.
-v1.1.x 2013 by Primary Coding Author : Chris Drain.
-Team Support : John Hicks, Phil Larkson, Neil Schneider.
-v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown.
-v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown, Samuel Austin.
-and Neil Schneider.
-
-This program is free software : you can redistribute it and / or modify.
-it under the terms of the GNU Lesser General Public License as published by.
-the Free Software Foundation, either version 3 of the License, or.
-(at your option) any later version..
-
-This program is distributed in the hope that it will be useful,.
-but WITHOUT ANY WARRANTY; without even the implied warranty of.
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the.
-GNU Lesser General Public License for more details..
-
-You should have received a copy of the GNU Lesser General Public License.
-along with this program.If not, see < http://www.gnu.org/licenses/>..
-********************************************************************/
-
-const uint32_t unAvatarVertexCount_378 = 378;
-const ovrAvatarMeshVertex asAvatarVertices_378[] = {
-	{ 0.041888,1.121938,-0.115589,0.136923,-0.004500,-0.480881,0.480886,0.000000,0.136926,1.000000,0.550000,0.750000,0,1,0,0,0.250015,0.749985,0.000000,0.000000},
-	{ 0.040526,0.934931,-0.114152,0.139652,-0.029836,-0.479869,0.480082,0.000000,0.139718,1.000000,0.550000,0.625000,0,1,0,0,0.375025,0.624975,0.000000,0.000000},
-	{ 0.080420,0.934890,-0.096362,0.268630,-0.039385,-0.421248,0.421569,0.000000,0.268849,1.000000,0.600000,0.625000,0,1,0,0,0.375052,0.624948,0.000000,0.000000},
-	{ 0.083804,1.121888,-0.097372,0.264218,-0.013124,-0.424436,0.424470,0.000000,0.264244,1.000000,0.600000,0.750000,0,1,0,0,0.250048,0.749952,0.000000,0.000000},
-	{ 0.113715,0.934826,-0.067478,0.381259,-0.055077,-0.322310,0.322752,-0.002230,0.381877,1.000000,0.649999,0.625000,0,1,0,0,0.375094,0.624906,0.000000,0.000000},
-	{ 0.119091,1.121808,-0.067543,0.377419,-0.027617,-0.327665,0.327761,-0.002668,0.377586,1.000000,0.650000,0.750000,0,1,0,0,0.250101,0.749899,0.000000,0.000000},
-	{ 0.136308,0.934508,-0.030232,0.464074,-0.073969,-0.182393,0.182672,-0.006317,0.465426,1.000000,0.700000,0.625000,0,1,0,0,0.375307,0.624693,0.000000,0.000000},
-	{ 0.143252,1.121413,-0.028904,0.462810,-0.045460,-0.187856,0.187891,-0.007340,0.463340,1.000000,0.700000,0.750000,0,1,0,0,0.250366,0.749634,0.000000,0.000000},
-	{ 0.144127,0.933849,0.010026,0.497549,-0.089275,0.021269,-0.021355,0.000000,0.499544,1.000000,0.750000,0.625000,0,1,0,0,0.375748,0.624252,0.000000,0.000000},
-	{ 0.151616,1.120595,0.012653,0.498432,-0.060754,0.025346,-0.025404,0.000000,0.499354,1.000000,0.750000,0.750000,0,1,0,0,0.250912,0.749088,0.000000,0.000000},
-	{ 0.132711,0.934419,0.053440,0.450237,-0.089758,0.212774,-0.213417,0.005315,0.452157,1.000000,0.799999,0.625000,0,1,0,0,0.375366,0.624634,0.000000,0.000000},
-	{ 0.138797,1.121303,0.058115,0.446400,-0.062055,0.223079,-0.223337,0.006076,0.447338,1.000000,0.799999,0.750000,0,1,0,0,0.250439,0.749561,0.000000,0.000000},
-	{ 0.106049,0.934732,0.090679,0.350705,-0.082663,0.353974,-0.355145,0.001519,0.351954,1.000000,0.850000,0.625000,0,1,0,0,0.375157,0.624843,0.000000,0.000000},
-	{ 0.109603,1.121691,0.096746,0.340974,-0.056459,0.364609,-0.365153,0.001943,0.341559,1.000000,0.850000,0.750000,0,1,0,0,0.250180,0.749820,0.000000,0.000000},
-	{ 0.070860,0.934772,0.114734,0.238386,-0.073416,0.437978,-0.439175,0.000000,0.239009,1.000000,0.900000,0.625000,0,1,0,0,0.375131,0.624869,0.000000,0.000000},
-	{ 0.071972,1.121741,0.120598,0.227541,-0.048586,0.444561,-0.445093,0.000000,0.227799,1.000000,0.900000,0.750000,0,1,0,0,0.250146,0.749854,0.000000,0.000000},
-	{ 0.034263,0.934715,0.129754,0.130810,-0.069180,0.481344,-0.482510,-0.001131,0.131086,1.000000,0.950000,0.625000,0,1,0,0,0.375169,0.624831,0.000000,0.000000},
-	{ 0.034136,1.121670,0.135385,0.125703,-0.044745,0.483423,-0.483914,-0.001111,0.125805,1.000000,0.950000,0.750000,0,1,0,0,0.250194,0.749806,0.000000,0.000000},
-	{ 0.000000,0.934685,0.133990,-0.000005,-0.068748,0.498817,-0.499984,0.008049,0.000000,1.000000,1.000000,0.625000,0,1,0,0,0.375189,0.624811,0.000000,0.000000},
-	{ 0.000000,1.121633,0.139318,-0.000006,-0.044601,0.499502,-0.499995,0.004544,0.000000,1.000000,1.000000,0.750000,0,1,0,0,0.250218,0.749782,0.000000,0.000000},
-	{ 0.033395,1.308619,0.138799,0.120537,-0.020475,0.485145,-0.485249,-0.001049,0.120552,1.000000,0.950000,0.875000,0,1,0,0,0.125223,0.874777,0.000000,0.000000},
-	{ 0.000000,1.308576,0.142355,-0.000007,-0.019981,0.499900,-0.499999,0.001449,0.000000,1.000000,1.000000,0.875000,0,1,0,0,0.125252,0.874748,0.000000,0.000000},
-	{ 0.031973,1.495558,0.139607,0.118701,0.007325,0.485692,-0.485704,0.000000,0.118707,1.000000,0.950000,1.000000,0,1,0,0,0.000258,0.999742,0.000000,0.000000},
-	{ 0.070179,1.495653,0.126115,0.213559,0.002952,0.452095,-0.452097,0.000000,0.213561,1.000000,0.900000,1.000000,0,1,0,0,0.000195,0.999805,0.000000,0.000000},
-	{ 0.071807,1.308703,0.124515,0.216964,-0.024777,0.450303,-0.450444,0.000000,0.217026,1.000000,0.900000,0.875000,0,1,0,0,0.125167,0.874833,0.000000,0.000000},
-	{ 0.110606,1.495587,0.104002,0.327689,-0.002887,0.377648,-0.377645,0.002813,0.327692,1.000000,0.850000,1.000000,0,1,0,0,0.000239,0.999761,0.000000,0.000000},
-	{ 0.111239,1.308644,0.101295,0.331356,-0.031877,0.374098,-0.374262,0.002406,0.331552,1.000000,0.850000,0.875000,0,1,0,0,0.125206,0.874794,0.000000,0.000000},
-	{ 0.143244,1.495069,0.064738,0.440404,-0.005614,0.236720,-0.236700,0.007288,0.440409,1.000000,0.799999,1.000000,0,1,0,0,0.000585,0.999415,0.000000,0.000000},
-	{ 0.142473,1.308187,0.061947,0.442286,-0.036174,0.232500,-0.232537,0.006814,0.442623,1.000000,0.799999,0.875000,0,1,0,0,0.125512,0.874488,0.000000,0.000000},
-	{ 0.158161,1.494124,0.017710,0.499014,-0.001353,0.031377,-0.031378,-0.001656,0.499014,1.000000,0.750000,1.000000,0,1,0,0,0.001217,0.998783,0.000000,0.000000},
-	{ 0.156484,1.307351,0.015225,0.498858,-0.033458,0.029346,-0.029378,0.000000,0.499136,1.000000,0.750000,0.875000,0,1,0,0,0.126070,0.873930,0.000000,0.000000},
-	{ 0.149171,1.495215,-0.024131,0.460600,0.012933,-0.194437,0.194499,-0.008993,0.460597,1.000000,0.700000,1.000000,0,1,0,0,0.000488,0.999512,0.000000,0.000000},
-	{ 0.147718,1.308316,-0.026904,0.461199,-0.018286,-0.192904,0.192860,-0.008264,0.461289,1.000000,0.700000,0.875000,0,1,0,0,0.125425,0.874575,0.000000,0.000000},
-	{ 0.123216,1.495743,-0.063403,0.372308,0.028032,-0.333452,0.333619,-0.003583,0.372418,1.000000,0.650000,1.000000,0,1,0,0,0.000135,0.999865,0.000000,0.000000},
-	{ 0.122402,1.308782,-0.066260,0.373464,-0.001677,-0.332451,0.332448,-0.003075,0.373465,1.000000,0.650000,0.875000,0,1,0,0,0.125114,0.874886,0.000000,0.000000},
-	{ 0.085906,1.495849,-0.093460,0.258585,0.040253,-0.427468,0.427826,-0.001123,0.258775,1.000000,0.600000,1.000000,0,1,0,0,0.000064,0.999936,0.000000,0.000000},
-	{ 0.085729,1.308876,-0.096512,0.259839,0.011708,-0.427141,0.427173,0.000000,0.259853,1.000000,0.600000,0.875000,0,1,0,0,0.125051,0.874949,0.000000,0.000000},
-	{ 0.042279,1.495916,-0.111517,0.133360,0.047594,-0.481299,0.481851,0.000000,0.133490,1.000000,0.550000,1.000000,0,1,0,0,0.000019,0.999981,0.000000,0.000000},
-	{ 0.042517,1.308935,-0.114836,0.134214,0.019711,-0.481549,0.481644,0.000000,0.134235,1.000000,0.550000,0.875000,0,1,0,0,0.125012,0.874988,0.000000,0.000000},
-	{ -0.000003,1.495945,-0.116890,-0.000275,0.050054,-0.499373,0.500000,0.000000,0.000000,1.000000,0.500000,1.000000,0,1,0,0,0.000000,1.000000,0.000000,0.000000},
-	{ -0.000002,1.308960,-0.120398,-0.000264,0.022366,-0.499875,0.500000,0.000000,0.000000,1.000000,0.500000,0.875000,0,1,0,0,0.124995,0.875005,0.000000,0.000000},
-	{ -0.042262,1.495914,-0.111466,-0.133439,0.047626,-0.481276,0.481829,0.000000,-0.133569,1.000000,0.450000,1.000000,0,1,0,0,0.000021,0.999979,0.000000,0.000000},
-	{ -0.042502,1.308933,-0.114791,-0.134291,0.019752,-0.481527,0.481623,0.000000,-0.134312,1.000000,0.450000,0.875000,0,1,0,0,0.125013,0.874987,0.000000,0.000000},
-	{ -0.085892,1.495848,-0.093449,-0.258376,0.040288,-0.427593,0.427952,0.001119,-0.258566,1.000000,0.400000,1.000000,0,1,0,0,0.000065,0.999935,0.000000,0.000000},
-	{ -0.085717,1.308875,-0.096502,-0.259637,0.011746,-0.427263,0.427295,0.000000,-0.259651,1.000000,0.400000,0.875000,0,1,0,0,0.125052,0.874948,0.000000,0.000000},
-	{ -0.123213,1.495743,-0.063402,-0.372260,0.028044,-0.333505,0.333670,0.003437,-0.372372,1.000000,0.350000,1.000000,0,1,0,0,0.000135,0.999865,0.000000,0.000000},
-	{ -0.122399,1.308782,-0.066259,-0.373418,-0.001664,-0.332503,0.332500,0.002984,-0.373419,1.000000,0.350000,0.875000,0,1,0,0,0.125114,0.874886,0.000000,0.000000},
-	{ -0.149168,1.495215,-0.024130,-0.460601,0.012938,-0.194435,0.194498,0.009333,-0.460596,1.000000,0.300000,1.000000,0,1,0,0,0.000488,0.999512,0.000000,0.000000},
-	{ -0.147715,1.308316,-0.026903,-0.461200,-0.018281,-0.192902,0.192856,0.008516,-0.461290,1.000000,0.300000,0.875000,0,1,0,0,0.125425,0.874575,0.000000,0.000000},
-	{ -0.158157,1.494124,0.017710,-0.499014,-0.001348,0.031376,-0.031376,0.001284,-0.499014,1.000000,0.250000,1.000000,0,1,0,0,0.001217,0.998783,0.000000,0.000000},
-	{ -0.156481,1.307351,0.015225,-0.498858,-0.033453,0.029344,-0.029373,0.000000,-0.499137,1.000000,0.250000,0.875000,0,1,0,0,0.126070,0.873930,0.000000,0.000000},
-	{ -0.143241,1.495069,0.064737,-0.440408,-0.005609,0.236713,-0.236693,-0.007151,-0.440413,1.000000,0.200000,1.000000,0,1,0,0,0.000585,0.999415,0.000000,0.000000},
-	{ -0.142471,1.308187,0.061945,-0.442290,-0.036170,0.232493,-0.232531,-0.006781,-0.442626,1.000000,0.200000,0.875000,0,1,0,0,0.125512,0.874488,0.000000,0.000000},
-	{ -0.110604,1.495587,0.104000,-0.327688,-0.002884,0.377648,-0.377646,-0.002813,-0.327691,1.000000,0.150000,1.000000,0,1,0,0,0.000239,0.999761,0.000000,0.000000},
-	{ -0.111238,1.308644,0.101294,-0.331355,-0.031874,0.374098,-0.374262,-0.002406,-0.331552,1.000000,0.150000,0.875000,0,1,0,0,0.125206,0.874794,0.000000,0.000000},
-	{ -0.070177,1.495653,0.126113,-0.213562,0.002955,0.452094,-0.452096,0.000000,-0.213563,1.000000,0.100001,1.000000,0,1,0,0,0.000195,0.999805,0.000000,0.000000},
-	{ -0.071806,1.308703,0.124513,-0.216966,-0.024774,0.450302,-0.450442,0.000000,-0.217029,1.000000,0.100001,0.875000,0,1,0,0,0.125167,0.874833,0.000000,0.000000},
-	{ -0.031973,1.495558,0.139606,-0.118716,0.007327,0.485688,-0.485701,0.000000,-0.118722,1.000000,0.050001,1.000000,0,1,0,0,0.000258,0.999742,0.000000,0.000000},
-	{ -0.033395,1.308619,0.138798,-0.120552,-0.020472,0.485142,-0.485246,0.001145,-0.120565,1.000000,0.050001,0.875000,0,1,0,0,0.125223,0.874777,0.000000,0.000000},
-	{ 0.000000,1.495510,0.142713,-0.000008,0.007876,0.499985,-0.499999,0.001517,0.000000,1.000000,0.000000,1.000000,0,1,0,0,0.000291,0.999709,0.000000,0.000000},
-	{ 0.000000,1.308576,0.142355,-0.000007,-0.019981,0.499900,-0.499999,-0.001515,-0.000000,1.000000,0.000000,0.875000,0,1,0,0,0.125252,0.874748,0.000000,0.000000},
-	{ -0.119089,1.121808,-0.067542,-0.377380,-0.027604,-0.327710,0.327807,0.002625,-0.377546,1.000000,0.350000,0.750000,0,1,0,0,0.250102,0.749898,0.000000,0.000000},
-	{ -0.083794,1.121887,-0.097363,-0.264043,-0.013084,-0.424545,0.424579,0.000000,-0.264070,1.000000,0.400000,0.750000,0,1,0,0,0.250049,0.749951,0.000000,0.000000},
-	{ -0.080412,0.934889,-0.096355,-0.268485,-0.039343,-0.421342,0.421662,0.000000,-0.268702,1.000000,0.400000,0.625000,0,1,0,0,0.375052,0.624948,0.000000,0.000000},
-	{ -0.113714,0.934826,-0.067477,-0.381226,-0.055064,-0.322349,0.322791,0.002239,-0.381844,1.000000,0.350000,0.625000,0,1,0,0,0.375095,0.624905,0.000000,0.000000},
-	{ -0.143250,1.121413,-0.028903,-0.462811,-0.045455,-0.187855,0.187885,0.007518,-0.463341,1.000000,0.300000,0.750000,0,1,0,0,0.250366,0.749634,0.000000,0.000000},
-	{ -0.136306,0.934508,-0.030232,-0.464075,-0.073964,-0.182391,0.182667,0.006416,-0.465427,1.000000,0.300000,0.625000,0,1,0,0,0.375307,0.624693,0.000000,0.000000},
-	{ -0.151613,1.120595,0.012653,-0.498433,-0.060749,0.025344,-0.025398,0.000000,-0.499355,1.000000,0.250000,0.750000,0,1,0,0,0.250912,0.749088,0.000000,0.000000},
-	{ -0.144125,0.933849,0.010026,-0.497549,-0.089269,0.021267,-0.021348,0.000000,-0.499544,1.000000,0.250000,0.625000,0,1,0,0,0.375748,0.624252,0.000000,0.000000},
-	{ -0.138795,1.121303,0.058114,-0.446403,-0.062051,0.223073,-0.223330,-0.006075,-0.447341,1.000000,0.200000,0.750000,0,1,0,0,0.250439,0.749561,0.000000,0.000000},
-	{ -0.132710,0.934419,0.053439,-0.450239,-0.089754,0.212769,-0.213411,-0.005314,-0.452160,1.000000,0.200000,0.625000,0,1,0,0,0.375366,0.624634,0.000000,0.000000},
-	{ -0.109602,1.121691,0.096745,-0.340974,-0.056456,0.364609,-0.365153,-0.001943,-0.341558,1.000000,0.150000,0.750000,0,1,0,0,0.250180,0.749820,0.000000,0.000000},
-	{ -0.106048,0.934732,0.090678,-0.350705,-0.082660,0.353974,-0.355145,-0.001519,-0.351954,1.000000,0.150000,0.625000,0,1,0,0,0.375158,0.624842,0.000000,0.000000},
-	{ -0.071970,1.121741,0.120597,-0.227543,-0.048582,0.444560,-0.445091,0.000000,-0.227803,1.000000,0.100001,0.750000,0,1,0,0,0.250146,0.749854,0.000000,0.000000},
-	{ -0.070859,0.934772,0.114732,-0.238387,-0.073413,0.437977,-0.439171,0.000000,-0.239016,1.000000,0.100001,0.625000,0,1,0,0,0.375131,0.624869,0.000000,0.000000},
-	{ -0.034136,1.121670,0.135384,-0.125715,-0.044743,0.483420,-0.483912,0.001282,-0.125813,1.000000,0.050001,0.750000,0,1,0,0,0.250194,0.749806,0.000000,0.000000},
-	{ -0.034263,0.934715,0.129754,-0.130820,-0.069177,0.481342,-0.482509,0.001343,-0.131089,1.000000,0.050001,0.625000,0,1,0,0,0.375169,0.624831,0.000000,0.000000},
-	{ 0.000000,1.121633,0.139318,-0.000006,-0.044601,0.499502,-0.499995,-0.004653,-0.000000,1.000000,0.000000,0.750000,0,1,0,0,0.250218,0.749782,0.000000,0.000000},
-	{ 0.000000,0.934685,0.133990,-0.000005,-0.068748,0.498817,-0.499983,-0.008126,-0.000000,1.000000,0.000000,0.625000,0,1,0,0,0.375189,0.624811,0.000000,0.000000},
-	{ -0.100863,0.747767,0.083325,-0.362910,-0.041334,0.343321,-0.343594,-0.001361,-0.363240,1.000000,0.150000,0.500000,0,1,0,0,0.500139,0.499861,0.000000,0.000000},
-	{ -0.124583,0.747535,0.048051,-0.456793,-0.046808,0.201972,-0.202104,-0.004077,-0.457329,1.000000,0.200000,0.500000,0,1,0,0,0.500294,0.499706,0.000000,0.000000},
-	{ -0.112419,0.560653,0.041732,-0.455763,-0.143941,0.192615,-0.194392,-0.003715,-0.460661,1.000000,0.200000,0.375000,0,1,0,0,0.625220,0.374780,0.000000,0.000000},
-	{ -0.091786,0.560827,0.073748,-0.366915,-0.139057,0.332475,-0.335717,0.000000,-0.370532,1.000000,0.150000,0.375000,0,1,0,0,0.625104,0.374896,0.000000,0.000000},
-	{ -0.068657,0.747797,0.107212,-0.250786,-0.034036,0.432223,-0.432475,0.000000,-0.250929,1.000000,0.100001,0.500000,0,1,0,0,0.500119,0.499881,0.000000,0.000000},
-	{ -0.063211,0.560850,0.096071,-0.256394,-0.132593,0.424107,-0.427893,0.000000,-0.258665,1.000000,0.100001,0.375000,0,1,0,0,0.625089,0.374911,0.000000,0.000000},
-	{ -0.033863,0.747755,0.122236,-0.136441,-0.030548,0.480781,-0.481009,0.000000,-0.136494,1.000000,0.050001,0.500000,0,1,0,0,0.500147,0.499853,0.000000,0.000000},
-	{ -0.031554,0.560818,0.110168,-0.138743,-0.130507,0.475912,-0.480038,0.001114,-0.139870,1.000000,0.050001,0.375000,0,1,0,0,0.625110,0.374890,0.000000,0.000000},
-	{ 0.000000,0.747733,0.126709,-0.000004,-0.030395,0.499769,-0.499997,-0.003688,-0.000000,1.000000,0.000000,0.500000,0,1,0,0,0.500162,0.499838,0.000000,0.000000},
-	{ 0.000000,0.560801,0.114496,-0.000003,-0.130458,0.495727,-0.499923,-0.017403,-0.001148,1.000000,0.000000,0.375000,0,1,0,0,0.625121,0.374879,0.000000,0.000000},
-	{ -0.120778,0.560334,0.005041,-0.494658,-0.143139,0.013820,-0.013941,0.000000,-0.499806,1.000000,0.250000,0.375000,0,1,0,0,0.625433,0.374567,0.000000,0.000000},
-	{ -0.134419,0.747111,0.007353,-0.499198,-0.045365,0.016933,-0.016955,0.000000,-0.499712,1.000000,0.250000,0.500000,0,1,0,0,0.500577,0.499423,0.000000,0.000000},
-	{ -0.114435,0.560702,-0.029877,-0.464919,-0.131136,-0.171903,0.173125,0.004422,-0.469066,1.000000,0.300000,0.375000,0,1,0,0,0.625187,0.374813,0.000000,0.000000},
-	{ -0.127266,0.747601,-0.030985,-0.467396,-0.032134,-0.176871,0.176886,0.004894,-0.467659,1.000000,0.300000,0.500000,0,1,0,0,0.500250,0.499750,0.000000,0.000000},
-	{ -0.096089,0.560880,-0.061898,-0.386938,-0.116042,-0.311308,0.313359,0.001452,-0.389622,1.000000,0.350000,0.375000,0,1,0,0,0.625069,0.374931,0.000000,0.000000},
-	{ -0.106589,0.747837,-0.066265,-0.386504,-0.015320,-0.317105,0.317131,0.001759,-0.386558,1.000000,0.350000,0.500000,0,1,0,0,0.500092,0.499908,0.000000,0.000000},
-	{ -0.068575,0.560915,-0.086928,-0.275696,-0.103311,-0.413912,0.416128,0.000000,-0.277196,1.000000,0.400000,0.375000,0,1,0,0,0.625045,0.374955,0.000000,0.000000},
-	{ -0.075793,0.747885,-0.093755,-0.273828,-0.001117,-0.418351,0.418352,0.000000,-0.273828,1.000000,0.400000,0.500000,0,1,0,0,0.500060,0.499940,0.000000,0.000000},
-	{ -0.035064,0.560938,-0.102564,-0.144146,-0.095418,-0.476388,0.478572,0.000000,-0.144805,1.000000,0.450000,0.375000,0,1,0,0,0.625030,0.374970,0.000000,0.000000},
-	{ -0.038532,0.747914,-0.110825,-0.142819,0.007589,-0.479154,0.479168,0.000000,-0.142823,1.000000,0.450000,0.500000,0,1,0,0,0.500041,0.499959,0.000000,0.000000},
-	{ -0.000001,0.560948,-0.107683,-0.000123,-0.092861,-0.497840,0.500000,0.000000,0.000000,1.000000,0.500000,0.375000,0,1,0,0,0.625023,0.374977,0.000000,0.000000},
-	{ -0.000001,0.747928,-0.116351,-0.000150,0.010409,-0.499973,0.500000,0.000000,0.000000,1.000000,0.500000,0.500000,0,1,0,0,0.500031,0.499969,0.000000,0.000000},
-	{ 0.035070,0.560938,-0.102581,0.144107,-0.095462,-0.476398,0.478584,0.000000,0.144766,1.000000,0.550000,0.375000,0,1,0,0,0.625030,0.374970,0.000000,0.000000},
-	{ 0.038540,0.747915,-0.110849,0.142774,0.007546,-0.479167,0.479181,0.000000,0.142777,1.000000,0.550000,0.500000,0,1,0,0,0.500040,0.499960,0.000000,0.000000},
-	{ 0.068579,0.560916,-0.086932,0.275791,-0.103341,-0.413848,0.416065,0.000000,0.277291,1.000000,0.600000,0.375000,0,1,0,0,0.625045,0.374955,0.000000,0.000000},
-	{ 0.075799,0.747885,-0.093760,0.273944,-0.001153,-0.418276,0.418276,0.000000,0.273944,1.000000,0.600000,0.500000,0,1,0,0,0.500060,0.499940,0.000000,0.000000},
-	{ 0.096091,0.560880,-0.061899,0.386958,-0.116051,-0.311282,0.313326,-0.001609,0.389649,1.000000,0.649999,0.375000,0,1,0,0,0.625068,0.374932,0.000000,0.000000},
-	{ 0.106590,0.747838,-0.066266,0.386530,-0.015331,-0.317074,0.317100,-0.001778,0.386584,1.000000,0.649999,0.500000,0,1,0,0,0.500092,0.499908,0.000000,0.000000},
-	{ 0.114437,0.560702,-0.029877,0.464919,-0.131140,-0.171905,0.173136,-0.004260,0.469062,1.000000,0.700000,0.375000,0,1,0,0,0.625187,0.374813,0.000000,0.000000},
-	{ 0.127267,0.747601,-0.030986,0.467395,-0.032138,-0.176872,0.176890,-0.004734,0.467658,1.000000,0.700000,0.500000,0,1,0,0,0.500250,0.499750,0.000000,0.000000},
-	{ 0.120780,0.560334,0.005041,0.494658,-0.143144,0.013822,-0.013946,0.000000,0.499805,1.000000,0.750000,0.375000,0,1,0,0,0.625433,0.374567,0.000000,0.000000},
-	{ 0.134421,0.747111,0.007354,0.499198,-0.045370,0.016934,-0.016959,0.000000,0.499712,1.000000,0.750000,0.500000,0,1,0,0,0.500577,0.499423,0.000000,0.000000},
-	{ 0.112420,0.560653,0.041732,0.455761,-0.143945,0.192619,-0.194407,0.003555,0.460655,1.000000,0.799999,0.375000,0,1,0,0,0.625220,0.374780,0.000000,0.000000},
-	{ 0.124584,0.747535,0.048052,0.456791,-0.046813,0.201977,-0.202110,0.004049,0.457326,1.000000,0.799999,0.500000,0,1,0,0,0.500294,0.499706,0.000000,0.000000},
-	{ 0.091787,0.560827,0.073749,0.366915,-0.139060,0.332474,-0.335698,0.000000,0.370550,1.000000,0.850000,0.375000,0,1,0,0,0.625104,0.374896,0.000000,0.000000},
-	{ 0.100864,0.747768,0.083326,0.362910,-0.041337,0.343321,-0.343593,0.001385,0.363240,1.000000,0.850000,0.500000,0,1,0,0,0.500139,0.499861,0.000000,0.000000},
-	{ 0.063212,0.560850,0.096071,0.256393,-0.132596,0.424108,-0.427904,0.000000,0.258646,1.000000,0.900000,0.375000,0,1,0,0,0.625089,0.374911,0.000000,0.000000},
-	{ 0.068658,0.747797,0.107213,0.250785,-0.034039,0.432224,-0.432477,0.000000,0.250926,1.000000,0.900000,0.500000,0,1,0,0,0.500119,0.499881,0.000000,0.000000},
-	{ 0.031555,0.560818,0.110168,0.138737,-0.130509,0.475914,-0.480038,-0.001017,0.139870,1.000000,0.950000,0.375000,0,1,0,0,0.625110,0.374890,0.000000,0.000000},
-	{ 0.033863,0.747755,0.122236,0.136433,-0.030550,0.480783,-0.481011,0.000000,0.136487,1.000000,0.950000,0.500000,0,1,0,0,0.500147,0.499853,0.000000,0.000000},
-	{ 0.000000,0.560801,0.114496,-0.000003,-0.130458,0.495727,-0.499923,0.017403,0.001142,1.000000,1.000000,0.375000,0,1,0,0,0.625121,0.374879,0.000000,0.000000},
-	{ 0.000000,0.747733,0.126709,-0.000004,-0.030395,0.499769,-0.499997,0.003689,0.000000,1.000000,1.000000,0.500000,0,1,0,0,0.500162,0.499838,0.000000,0.000000},
-	{ -0.000002,0.934948,-0.119766,-0.000190,-0.026685,-0.499822,0.500000,0.000000,0.000000,1.000000,0.500000,0.625000,0,1,0,0,0.375013,0.624987,0.000000,0.000000},
-	{ -0.000002,1.121959,-0.121227,-0.000228,-0.001717,-0.499999,0.500000,0.000000,0.000000,1.000000,0.500000,0.750000,0,1,0,0,0.250000,0.750000,0.000000,0.000000},
-	{ -0.041875,1.121936,-0.115551,-0.136990,-0.004453,-0.480862,0.480867,0.000000,-0.136993,1.000000,0.450000,0.750000,0,1,0,0,0.250016,0.749984,0.000000,0.000000},
-	{ -0.040516,0.934929,-0.114121,-0.139709,-0.029782,-0.479854,0.480066,0.000000,-0.139775,1.000000,0.450000,0.625000,0,1,0,0,0.375025,0.624975,0.000000,0.000000},
-	{ 0.031599,0.373961,-0.094313,0.146382,-0.102624,-0.475331,0.477855,0.000000,0.147155,1.000000,0.550000,0.250000,0,1,0,0,0.750019,0.249981,0.000000,0.000000},
-	{ 0.027649,0.186983,-0.084575,0.149344,-0.111971,-0.473880,0.476879,0.000000,0.150287,1.000000,0.550000,0.125000,0,1,0,0,0.875010,0.124990,0.000000,0.000000},
-	{ 0.053217,0.186976,-0.072025,0.284552,-0.120226,-0.406714,0.409683,0.000000,0.286635,1.000000,0.600000,0.125000,0,1,0,0,0.875015,0.124985,0.000000,0.000000},
-	{ 0.061359,0.373946,-0.080104,0.279565,-0.110607,-0.410834,0.413361,0.000000,0.281305,1.000000,0.600000,0.250000,0,1,0,0,0.750029,0.249971,0.000000,0.000000},
-	{ 0.073816,0.186964,-0.052257,0.394495,-0.133277,-0.299888,0.302540,0.000000,0.398083,1.000000,0.649999,0.125000,0,1,0,0,0.875023,0.124977,0.000000,0.000000},
-	{ 0.085591,0.373922,-0.057532,0.390217,-0.123454,-0.306464,0.308759,-0.001384,0.393278,1.000000,0.649999,0.250000,0,1,0,0,0.750045,0.249955,0.000000,0.000000},
-	{ 0.087270,0.186904,-0.027187,0.467533,-0.148140,-0.161018,0.162683,-0.001860,0.472793,1.000000,0.700000,0.125000,0,1,0,0,0.875062,0.124938,0.000000,0.000000},
-	{ 0.101606,0.373803,-0.028769,0.466070,-0.138479,-0.167287,0.168698,-0.003263,0.470678,1.000000,0.700000,0.250000,0,1,0,0,0.750125,0.249875,0.000000,0.000000},
-	{ 0.091914,0.186781,0.000409,0.493630,-0.158683,0.005839,-0.005909,0.000000,0.499965,1.000000,0.750000,0.125000,0,1,0,0,0.875145,0.124855,0.000000,0.000000},
-	{ 0.107139,0.373557,0.002728,0.494250,-0.149835,0.010223,-0.010326,0.000000,0.499893,1.000000,0.750000,0.250000,0,1,0,0,0.750289,0.249711,0.000000,0.000000},
-	{ 0.086596,0.186888,0.028598,0.463356,-0.159312,0.170165,-0.172223,0.001887,0.469402,1.000000,0.799999,0.125000,0,1,0,0,0.875073,0.124927,0.000000,0.000000},
-	{ 0.100256,0.373770,0.035412,0.459197,-0.150506,0.182963,-0.184861,0.002955,0.464569,1.000000,0.799999,0.250000,0,1,0,0,0.750147,0.249853,0.000000,0.000000},
-	{ 0.072375,0.186946,0.053666,0.385548,-0.154262,0.308875,-0.312592,0.000000,0.390239,1.000000,0.850000,0.125000,0,1,0,0,0.875034,0.124966,0.000000,0.000000},
-	{ 0.082710,0.373887,0.064171,0.375182,-0.145616,0.322393,-0.325828,0.000000,0.379258,1.000000,0.850000,0.250000,0,1,0,0,0.750069,0.249931,0.000000,0.000000},
-	{ 0.051421,0.186954,0.072527,0.276008,-0.148348,0.410266,-0.414882,0.000000,0.279057,1.000000,0.900000,0.125000,0,1,0,0,0.875029,0.124971,0.000000,0.000000},
-	{ 0.057766,0.373902,0.084930,0.265094,-0.139489,0.418164,-0.422317,0.000000,0.267673,1.000000,0.900000,0.250000,0,1,0,0,0.750059,0.249941,0.000000,0.000000},
-	{ 0.026472,0.186943,0.084558,0.146950,-0.146473,0.472273,-0.477430,0.000000,0.148527,1.000000,0.950000,0.125000,0,1,0,0,0.875036,0.124964,0.000000,0.000000},
-	{ 0.029246,0.373881,0.098100,0.142448,-0.137608,0.474315,-0.478885,0.000000,0.143768,1.000000,0.950000,0.250000,0,1,0,0,0.750073,0.249927,0.000000,0.000000},
-	{ 0.000000,0.186937,0.088527,-0.000001,-0.146654,0.494594,-0.499881,0.021538,0.001595,1.000000,1.000000,0.125000,0,1,0,0,0.875040,0.124960,0.000000,0.000000},
-	{ 0.000000,0.373870,0.102284,-0.000002,-0.137762,0.495233,-0.499906,0.019241,0.001336,1.000000,1.000000,0.250000,0,1,0,0,0.750080,0.249920,0.000000,0.000000},
-	{ -0.000001,0.373968,-0.099015,-0.000092,-0.100023,-0.497493,0.500000,0.000000,0.000000,1.000000,0.500000,0.250000,0,1,0,0,0.750015,0.249985,0.000000,0.000000},
-	{ -0.000000,0.186987,-0.088803,-0.000052,-0.109256,-0.497007,0.500000,0.000000,0.000000,1.000000,0.500000,0.125000,0,1,0,0,0.875007,0.124993,0.000000,0.000000},
-	{ -0.031595,0.373961,-0.094302,-0.146411,-0.102581,-0.475324,0.477845,0.000000,-0.147188,1.000000,0.450000,0.250000,0,1,0,0,0.750019,0.249981,0.000000,0.000000},
-	{ -0.027647,0.186983,-0.084570,-0.149361,-0.111930,-0.473877,0.476874,0.000000,-0.150304,1.000000,0.450000,0.125000,0,1,0,0,0.875010,0.124990,0.000000,0.000000},
-	{ -0.061356,0.373946,-0.080102,-0.279495,-0.110578,-0.410884,0.413409,0.000000,-0.281235,1.000000,0.400000,0.250000,0,1,0,0,0.750029,0.249971,0.000000,0.000000},
-	{ -0.053216,0.186976,-0.072024,-0.284512,-0.120198,-0.406744,0.409705,0.000000,-0.286603,1.000000,0.400000,0.125000,0,1,0,0,0.875015,0.124985,0.000000,0.000000},
-	{ -0.085590,0.373922,-0.057531,-0.390202,-0.123446,-0.306485,0.308790,0.001168,-0.393254,1.000000,0.350000,0.250000,0,1,0,0,0.750045,0.249955,0.000000,0.000000},
-	{ -0.073816,0.186964,-0.052257,-0.394487,-0.133268,-0.299900,0.302562,0.000000,-0.398066,1.000000,0.350000,0.125000,0,1,0,0,0.875023,0.124977,0.000000,0.000000},
-	{ -0.101605,0.373803,-0.028769,-0.466071,-0.138475,-0.167286,0.168691,0.003358,-0.470681,1.000000,0.300000,0.250000,0,1,0,0,0.750125,0.249875,0.000000,0.000000},
-	{ -0.087270,0.186904,-0.027187,-0.467533,-0.148136,-0.161017,0.162682,0.001860,-0.472794,1.000000,0.300000,0.125000,0,1,0,0,0.875062,0.124938,0.000000,0.000000},
-	{ -0.107138,0.373557,0.002728,-0.494250,-0.149830,0.010222,-0.010323,0.000000,-0.499893,1.000000,0.250000,0.250000,0,1,0,0,0.750289,0.249711,0.000000,0.000000},
-	{ -0.091913,0.186781,0.000409,-0.493631,-0.158679,0.005838,-0.005908,0.000000,-0.499965,1.000000,0.250000,0.125000,0,1,0,0,0.875145,0.124855,0.000000,0.000000},
-	{ -0.100256,0.373770,0.035412,-0.459198,-0.150503,0.182960,-0.184858,-0.002954,-0.464570,1.000000,0.200000,0.250000,0,1,0,0,0.750147,0.249853,0.000000,0.000000},
-	{ -0.086595,0.186888,0.028598,-0.463357,-0.159309,0.170163,-0.172221,-0.001886,-0.469403,1.000000,0.200000,0.125000,0,1,0,0,0.875073,0.124927,0.000000,0.000000},
-	{ -0.082709,0.373887,0.064171,-0.375182,-0.145613,0.322393,-0.325857,0.000000,-0.379233,1.000000,0.150000,0.250000,0,1,0,0,0.750069,0.249931,0.000000,0.000000},
-	{ -0.072375,0.186946,0.053666,-0.385548,-0.154259,0.308875,-0.312630,0.000000,-0.390208,1.000000,0.150000,0.125000,0,1,0,0,0.875034,0.124966,0.000000,0.000000},
-	{ -0.057766,0.373902,0.084929,-0.265094,-0.139486,0.418164,-0.422298,0.000000,-0.267703,1.000000,0.100001,0.250000,0,1,0,0,0.750059,0.249941,0.000000,0.000000},
-	{ -0.051421,0.186954,0.072527,-0.276008,-0.148345,0.410266,-0.414857,0.000000,-0.279095,1.000000,0.100001,0.125000,0,1,0,0,0.875029,0.124971,0.000000,0.000000},
-	{ -0.029246,0.373881,0.098099,-0.142452,-0.137606,0.474314,-0.478884,0.000000,-0.143773,1.000000,0.050001,0.250000,0,1,0,0,0.750073,0.249927,0.000000,0.000000},
-	{ -0.026472,0.186943,0.084558,-0.146952,-0.146472,0.472273,-0.477429,0.000000,-0.148530,1.000000,0.050001,0.125000,0,1,0,0,0.875036,0.124964,0.000000,0.000000},
-	{ 0.000000,0.373870,0.102284,-0.000002,-0.137762,0.495233,-0.499906,-0.019241,-0.001340,1.000000,0.000000,0.250000,0,1,0,0,0.750080,0.249920,0.000000,0.000000},
-	{ 0.000000,0.186937,0.088527,-0.000001,-0.146654,0.494594,-0.499881,-0.021538,-0.001598,1.000000,0.000000,0.125000,0,1,0,0,0.875040,0.124960,0.000000,0.000000},
-	{ -0.023698,0.000005,0.071016,-0.151946,-0.041048,0.475911,-0.476311,0.000000,-0.152080,1.000000,0.050001,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045076,0.000005,0.060125,-0.287029,-0.043047,0.408841,-0.409212,0.000000,-0.287307,1.000000,0.100001,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062041,0.000005,0.043160,-0.397629,-0.048845,0.302150,-0.302495,0.000000,-0.398117,1.000000,0.150000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072935,0.000005,0.021785,-0.472114,-0.054257,0.162396,-0.162608,-0.001068,-0.472819,1.000000,0.200000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.076688,0.000005,-0.001911,-0.499272,-0.053747,0.002259,-0.002251,0.000000,-0.499995,1.000000,0.250000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072934,0.000005,-0.025606,-0.473530,-0.043680,-0.159036,0.159178,0.000000,-0.473986,1.000000,0.300000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062042,0.000005,-0.046982,-0.400840,-0.028613,-0.298534,0.298654,0.000000,-0.401006,1.000000,0.350000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045076,0.000005,-0.063946,-0.289959,-0.015179,-0.407267,0.407313,0.000000,-0.289993,1.000000,0.400000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023698,0.000005,-0.074837,-0.152301,-0.006663,-0.476228,0.476239,0.000000,-0.152304,1.000000,0.450000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,0.000005,-0.078590,-0.000025,-0.003910,-0.499996,0.500000,0.000000,0.000000,1.000000,0.500000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023698,0.000005,-0.074837,0.152293,-0.006701,-0.476231,0.476241,0.000000,0.152296,1.000000,0.550000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045076,0.000005,-0.063946,0.289978,-0.015208,-0.407253,0.407300,0.000000,0.290012,1.000000,0.600000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062042,0.000005,-0.046982,0.400844,-0.028622,-0.298528,0.298647,0.000000,0.401011,1.000000,0.649999,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072934,0.000005,-0.025606,0.473530,-0.043684,-0.159036,0.159178,0.000000,0.473986,1.000000,0.700000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.076688,0.000005,-0.001911,0.499272,-0.053751,0.002259,-0.002252,0.000000,0.499995,1.000000,0.750000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072935,0.000005,0.021785,0.472113,-0.054261,0.162398,-0.162610,0.001069,0.472819,1.000000,0.799999,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062041,0.000005,0.043160,0.397629,-0.048848,0.302150,-0.302490,0.001071,0.398120,1.000000,0.850000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045076,0.000005,0.060125,0.287029,-0.043049,0.408841,-0.409215,0.000000,0.287304,1.000000,0.900000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023698,0.000005,0.071016,0.151945,-0.041049,0.475911,-0.476311,0.000000,0.152078,1.000000,0.950000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,0.000005,0.074770,-0.000000,-0.041312,0.499573,-0.499990,0.006457,0.000000,1.000000,1.000000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.495510,0.142713,-0.000008,0.007876,0.499985,-0.499999,-0.001529,-0.000000,1.000000,1.000000,1.000000,0,1,0,0,0.000291,0.999709,0.000000,0.000000},
-	{ -0.000000,0.000005,0.074770,-0.000000,-0.041312,0.499573,-0.499990,-0.006457,-0.000000,1.000000,0.000000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.041888,1.121938,-0.115589,-0.136923,0.004500,0.480881,0.480886,0.000000,0.136926,-1.000000,0.550000,0.750000,0,1,0,0,0.250015,0.749985,0.000000,0.000000},
-	{ 0.083804,1.121888,-0.097372,-0.264218,0.013124,0.424436,0.424470,0.000000,0.264244,-1.000000,0.600000,0.750000,0,1,0,0,0.250048,0.749952,0.000000,0.000000},
-	{ 0.080420,0.934890,-0.096362,-0.268630,0.039385,0.421248,0.421569,0.000000,0.268849,-1.000000,0.600000,0.625000,0,1,0,0,0.375052,0.624948,0.000000,0.000000},
-	{ 0.040526,0.934931,-0.114152,-0.139652,0.029836,0.479869,0.480082,0.000000,0.139718,-1.000000,0.550000,0.625000,0,1,0,0,0.375025,0.624975,0.000000,0.000000},
-	{ 0.113715,0.934826,-0.067478,-0.381259,0.055077,0.322310,0.322752,-0.002230,0.381877,-1.000000,0.649999,0.625000,0,1,0,0,0.375094,0.624906,0.000000,0.000000},
-	{ 0.119091,1.121808,-0.067543,-0.377419,0.027617,0.327665,0.327761,-0.002668,0.377586,-1.000000,0.650000,0.750000,0,1,0,0,0.250101,0.749899,0.000000,0.000000},
-	{ 0.136308,0.934508,-0.030232,-0.464074,0.073969,0.182393,0.182672,-0.006317,0.465426,-1.000000,0.700000,0.625000,0,1,0,0,0.375307,0.624693,0.000000,0.000000},
-	{ 0.143252,1.121413,-0.028904,-0.462810,0.045460,0.187856,0.187891,-0.007340,0.463340,-1.000000,0.700000,0.750000,0,1,0,0,0.250366,0.749634,0.000000,0.000000},
-	{ 0.144127,0.933849,0.010026,-0.497549,0.089275,-0.021269,-0.021355,0.000000,0.499544,-1.000000,0.750000,0.625000,0,1,0,0,0.375748,0.624252,0.000000,0.000000},
-	{ 0.151616,1.120595,0.012653,-0.498432,0.060754,-0.025346,-0.025404,0.000000,0.499354,-1.000000,0.750000,0.750000,0,1,0,0,0.250912,0.749088,0.000000,0.000000},
-	{ 0.132711,0.934419,0.053440,-0.450237,0.089758,-0.212774,-0.213417,0.005315,0.452157,-1.000000,0.799999,0.625000,0,1,0,0,0.375366,0.624634,0.000000,0.000000},
-	{ 0.138797,1.121303,0.058115,-0.446400,0.062055,-0.223079,-0.223337,0.006076,0.447338,-1.000000,0.799999,0.750000,0,1,0,0,0.250439,0.749561,0.000000,0.000000},
-	{ 0.106049,0.934732,0.090679,-0.350705,0.082663,-0.353974,-0.355145,0.001519,0.351954,-1.000000,0.850000,0.625000,0,1,0,0,0.375157,0.624843,0.000000,0.000000},
-	{ 0.109603,1.121691,0.096746,-0.340974,0.056459,-0.364609,-0.365153,0.001943,0.341559,-1.000000,0.850000,0.750000,0,1,0,0,0.250180,0.749820,0.000000,0.000000},
-	{ 0.070860,0.934772,0.114734,-0.238386,0.073416,-0.437978,-0.439175,0.000000,0.239009,-1.000000,0.900000,0.625000,0,1,0,0,0.375131,0.624869,0.000000,0.000000},
-	{ 0.071972,1.121741,0.120598,-0.227541,0.048586,-0.444561,-0.445093,0.000000,0.227799,-1.000000,0.900000,0.750000,0,1,0,0,0.250146,0.749854,0.000000,0.000000},
-	{ 0.034263,0.934715,0.129754,-0.130810,0.069180,-0.481344,-0.482510,-0.001131,0.131086,-1.000000,0.950000,0.625000,0,1,0,0,0.375169,0.624831,0.000000,0.000000},
-	{ 0.034136,1.121670,0.135385,-0.125703,0.044745,-0.483423,-0.483914,-0.001111,0.125805,-1.000000,0.950000,0.750000,0,1,0,0,0.250194,0.749806,0.000000,0.000000},
-	{ 0.000000,0.934685,0.133990,0.000005,0.068748,-0.498817,-0.499984,0.008049,0.000000,-1.000000,1.000000,0.625000,0,1,0,0,0.375189,0.624811,0.000000,0.000000},
-	{ 0.000000,1.121633,0.139318,0.000006,0.044601,-0.499502,-0.499995,0.004544,0.000000,-1.000000,1.000000,0.750000,0,1,0,0,0.250218,0.749782,0.000000,0.000000},
-	{ 0.033395,1.308619,0.138799,-0.120537,0.020475,-0.485145,-0.485249,-0.001049,0.120552,-1.000000,0.950000,0.875000,0,1,0,0,0.125223,0.874777,0.000000,0.000000},
-	{ 0.000000,1.308576,0.142355,0.000007,0.019981,-0.499900,-0.499999,0.001449,0.000000,-1.000000,1.000000,0.875000,0,1,0,0,0.125252,0.874748,0.000000,0.000000},
-	{ 0.031973,1.495558,0.139607,-0.118701,-0.007325,-0.485692,-0.485704,0.000000,0.118707,-1.000000,0.950000,1.000000,0,1,0,0,0.000258,0.999742,0.000000,0.000000},
-	{ 0.070179,1.495653,0.126115,-0.213559,-0.002952,-0.452095,-0.452097,0.000000,0.213561,-1.000000,0.900000,1.000000,0,1,0,0,0.000195,0.999805,0.000000,0.000000},
-	{ 0.071807,1.308703,0.124515,-0.216964,0.024777,-0.450303,-0.450444,0.000000,0.217026,-1.000000,0.900000,0.875000,0,1,0,0,0.125167,0.874833,0.000000,0.000000},
-	{ 0.110606,1.495587,0.104002,-0.327689,0.002887,-0.377648,-0.377645,0.002813,0.327692,-1.000000,0.850000,1.000000,0,1,0,0,0.000239,0.999761,0.000000,0.000000},
-	{ 0.111239,1.308644,0.101295,-0.331356,0.031877,-0.374098,-0.374262,0.002406,0.331552,-1.000000,0.850000,0.875000,0,1,0,0,0.125206,0.874794,0.000000,0.000000},
-	{ 0.143244,1.495069,0.064738,-0.440404,0.005614,-0.236720,-0.236700,0.007288,0.440409,-1.000000,0.799999,1.000000,0,1,0,0,0.000585,0.999415,0.000000,0.000000},
-	{ 0.142473,1.308187,0.061947,-0.442286,0.036174,-0.232500,-0.232537,0.006814,0.442623,-1.000000,0.799999,0.875000,0,1,0,0,0.125512,0.874488,0.000000,0.000000},
-	{ 0.158161,1.494124,0.017710,-0.499014,0.001353,-0.031377,-0.031378,-0.001656,0.499014,-1.000000,0.750000,1.000000,0,1,0,0,0.001217,0.998783,0.000000,0.000000},
-	{ 0.156484,1.307351,0.015225,-0.498858,0.033458,-0.029346,-0.029378,0.000000,0.499136,-1.000000,0.750000,0.875000,0,1,0,0,0.126070,0.873930,0.000000,0.000000},
-	{ 0.149171,1.495215,-0.024131,-0.460600,-0.012933,0.194437,0.194499,-0.008993,0.460597,-1.000000,0.700000,1.000000,0,1,0,0,0.000488,0.999512,0.000000,0.000000},
-	{ 0.147718,1.308316,-0.026904,-0.461199,0.018286,0.192904,0.192860,-0.008264,0.461289,-1.000000,0.700000,0.875000,0,1,0,0,0.125425,0.874575,0.000000,0.000000},
-	{ 0.123216,1.495743,-0.063403,-0.372308,-0.028032,0.333452,0.333619,-0.003583,0.372418,-1.000000,0.650000,1.000000,0,1,0,0,0.000135,0.999865,0.000000,0.000000},
-	{ 0.122402,1.308782,-0.066260,-0.373464,0.001677,0.332451,0.332448,-0.003075,0.373465,-1.000000,0.650000,0.875000,0,1,0,0,0.125114,0.874886,0.000000,0.000000},
-	{ 0.085906,1.495849,-0.093460,-0.258585,-0.040253,0.427468,0.427826,-0.001123,0.258775,-1.000000,0.600000,1.000000,0,1,0,0,0.000064,0.999936,0.000000,0.000000},
-	{ 0.085729,1.308876,-0.096512,-0.259839,-0.011708,0.427141,0.427173,0.000000,0.259853,-1.000000,0.600000,0.875000,0,1,0,0,0.125051,0.874949,0.000000,0.000000},
-	{ 0.042279,1.495916,-0.111517,-0.133360,-0.047594,0.481299,0.481851,0.000000,0.133490,-1.000000,0.550000,1.000000,0,1,0,0,0.000019,0.999981,0.000000,0.000000},
-	{ 0.042517,1.308935,-0.114836,-0.134214,-0.019711,0.481549,0.481644,0.000000,0.134235,-1.000000,0.550000,0.875000,0,1,0,0,0.125012,0.874988,0.000000,0.000000},
-	{ -0.000003,1.495945,-0.116890,0.000275,-0.050054,0.499373,0.500000,0.000000,0.000000,-1.000000,0.500000,1.000000,0,1,0,0,0.000000,1.000000,0.000000,0.000000},
-	{ -0.000002,1.308960,-0.120398,0.000264,-0.022366,0.499875,0.500000,0.000000,0.000000,-1.000000,0.500000,0.875000,0,1,0,0,0.124995,0.875005,0.000000,0.000000},
-	{ -0.042262,1.495914,-0.111466,0.133439,-0.047626,0.481276,0.481829,0.000000,-0.133569,-1.000000,0.450000,1.000000,0,1,0,0,0.000021,0.999979,0.000000,0.000000},
-	{ -0.042502,1.308933,-0.114791,0.134291,-0.019752,0.481527,0.481623,0.000000,-0.134312,-1.000000,0.450000,0.875000,0,1,0,0,0.125013,0.874987,0.000000,0.000000},
-	{ -0.085892,1.495848,-0.093449,0.258376,-0.040288,0.427593,0.427952,0.001119,-0.258566,-1.000000,0.400000,1.000000,0,1,0,0,0.000065,0.999935,0.000000,0.000000},
-	{ -0.085717,1.308875,-0.096502,0.259637,-0.011746,0.427263,0.427295,0.000000,-0.259651,-1.000000,0.400000,0.875000,0,1,0,0,0.125052,0.874948,0.000000,0.000000},
-	{ -0.123213,1.495743,-0.063402,0.372260,-0.028044,0.333505,0.333670,0.003437,-0.372372,-1.000000,0.350000,1.000000,0,1,0,0,0.000135,0.999865,0.000000,0.000000},
-	{ -0.122399,1.308782,-0.066259,0.373418,0.001664,0.332503,0.332500,0.002984,-0.373419,-1.000000,0.350000,0.875000,0,1,0,0,0.125114,0.874886,0.000000,0.000000},
-	{ -0.149168,1.495215,-0.024130,0.460601,-0.012938,0.194435,0.194498,0.009333,-0.460596,-1.000000,0.300000,1.000000,0,1,0,0,0.000488,0.999512,0.000000,0.000000},
-	{ -0.147715,1.308316,-0.026903,0.461200,0.018281,0.192902,0.192856,0.008516,-0.461290,-1.000000,0.300000,0.875000,0,1,0,0,0.125425,0.874575,0.000000,0.000000},
-	{ -0.158157,1.494124,0.017710,0.499014,0.001348,-0.031376,-0.031376,0.001284,-0.499014,-1.000000,0.250000,1.000000,0,1,0,0,0.001217,0.998783,0.000000,0.000000},
-	{ -0.156481,1.307351,0.015225,0.498858,0.033453,-0.029344,-0.029373,0.000000,-0.499137,-1.000000,0.250000,0.875000,0,1,0,0,0.126070,0.873930,0.000000,0.000000},
-	{ -0.143241,1.495069,0.064737,0.440408,0.005609,-0.236713,-0.236693,-0.007151,-0.440413,-1.000000,0.200000,1.000000,0,1,0,0,0.000585,0.999415,0.000000,0.000000},
-	{ -0.142471,1.308187,0.061945,0.442290,0.036170,-0.232493,-0.232531,-0.006781,-0.442626,-1.000000,0.200000,0.875000,0,1,0,0,0.125512,0.874488,0.000000,0.000000},
-	{ -0.110604,1.495587,0.104000,0.327688,0.002884,-0.377648,-0.377646,-0.002813,-0.327691,-1.000000,0.150000,1.000000,0,1,0,0,0.000239,0.999761,0.000000,0.000000},
-	{ -0.111238,1.308644,0.101294,0.331355,0.031874,-0.374098,-0.374262,-0.002406,-0.331552,-1.000000,0.150000,0.875000,0,1,0,0,0.125206,0.874794,0.000000,0.000000},
-	{ -0.070177,1.495653,0.126113,0.213562,-0.002955,-0.452094,-0.452096,0.000000,-0.213563,-1.000000,0.100001,1.000000,0,1,0,0,0.000195,0.999805,0.000000,0.000000},
-	{ -0.071806,1.308703,0.124513,0.216966,0.024774,-0.450302,-0.450442,0.000000,-0.217029,-1.000000,0.100001,0.875000,0,1,0,0,0.125167,0.874833,0.000000,0.000000},
-	{ -0.031973,1.495558,0.139606,0.118716,-0.007327,-0.485688,-0.485701,0.000000,-0.118722,-1.000000,0.050001,1.000000,0,1,0,0,0.000258,0.999742,0.000000,0.000000},
-	{ -0.033395,1.308619,0.138798,0.120552,0.020472,-0.485142,-0.485246,0.001145,-0.120565,-1.000000,0.050001,0.875000,0,1,0,0,0.125223,0.874777,0.000000,0.000000},
-	{ 0.000000,1.495510,0.142713,0.000008,-0.007876,-0.499985,-0.499999,0.001517,0.000000,-1.000000,0.000000,1.000000,0,1,0,0,0.000291,0.999709,0.000000,0.000000},
-	{ 0.000000,1.308576,0.142355,0.000007,0.019981,-0.499900,-0.499999,-0.001515,-0.000000,-1.000000,0.000000,0.875000,0,1,0,0,0.125252,0.874748,0.000000,0.000000},
-	{ -0.119089,1.121808,-0.067542,0.377380,0.027604,0.327710,0.327807,0.002625,-0.377546,-1.000000,0.350000,0.750000,0,1,0,0,0.250102,0.749898,0.000000,0.000000},
-	{ -0.083794,1.121887,-0.097363,0.264043,0.013084,0.424545,0.424579,0.000000,-0.264070,-1.000000,0.400000,0.750000,0,1,0,0,0.250049,0.749951,0.000000,0.000000},
-	{ -0.080412,0.934889,-0.096355,0.268485,0.039343,0.421342,0.421662,0.000000,-0.268702,-1.000000,0.400000,0.625000,0,1,0,0,0.375052,0.624948,0.000000,0.000000},
-	{ -0.113714,0.934826,-0.067477,0.381226,0.055064,0.322349,0.322791,0.002239,-0.381844,-1.000000,0.350000,0.625000,0,1,0,0,0.375095,0.624905,0.000000,0.000000},
-	{ -0.143250,1.121413,-0.028903,0.462811,0.045455,0.187855,0.187885,0.007518,-0.463341,-1.000000,0.300000,0.750000,0,1,0,0,0.250366,0.749634,0.000000,0.000000},
-	{ -0.136306,0.934508,-0.030232,0.464075,0.073964,0.182391,0.182667,0.006416,-0.465427,-1.000000,0.300000,0.625000,0,1,0,0,0.375307,0.624693,0.000000,0.000000},
-	{ -0.151613,1.120595,0.012653,0.498433,0.060749,-0.025344,-0.025398,0.000000,-0.499355,-1.000000,0.250000,0.750000,0,1,0,0,0.250912,0.749088,0.000000,0.000000},
-	{ -0.144125,0.933849,0.010026,0.497549,0.089269,-0.021267,-0.021348,0.000000,-0.499544,-1.000000,0.250000,0.625000,0,1,0,0,0.375748,0.624252,0.000000,0.000000},
-	{ -0.138795,1.121303,0.058114,0.446403,0.062051,-0.223073,-0.223330,-0.006075,-0.447341,-1.000000,0.200000,0.750000,0,1,0,0,0.250439,0.749561,0.000000,0.000000},
-	{ -0.132710,0.934419,0.053439,0.450239,0.089754,-0.212769,-0.213411,-0.005314,-0.452160,-1.000000,0.200000,0.625000,0,1,0,0,0.375366,0.624634,0.000000,0.000000},
-	{ -0.109602,1.121691,0.096745,0.340974,0.056456,-0.364609,-0.365153,-0.001943,-0.341558,-1.000000,0.150000,0.750000,0,1,0,0,0.250180,0.749820,0.000000,0.000000},
-	{ -0.106048,0.934732,0.090678,0.350705,0.082660,-0.353974,-0.355145,-0.001519,-0.351954,-1.000000,0.150000,0.625000,0,1,0,0,0.375158,0.624842,0.000000,0.000000},
-	{ -0.071970,1.121741,0.120597,0.227543,0.048582,-0.444560,-0.445091,0.000000,-0.227803,-1.000000,0.100001,0.750000,0,1,0,0,0.250146,0.749854,0.000000,0.000000},
-	{ -0.070859,0.934772,0.114732,0.238387,0.073413,-0.437977,-0.439171,0.000000,-0.239016,-1.000000,0.100001,0.625000,0,1,0,0,0.375131,0.624869,0.000000,0.000000},
-	{ -0.034136,1.121670,0.135384,0.125715,0.044743,-0.483420,-0.483912,0.001282,-0.125813,-1.000000,0.050001,0.750000,0,1,0,0,0.250194,0.749806,0.000000,0.000000},
-	{ -0.034263,0.934715,0.129754,0.130820,0.069177,-0.481342,-0.482509,0.001343,-0.131089,-1.000000,0.050001,0.625000,0,1,0,0,0.375169,0.624831,0.000000,0.000000},
-	{ 0.000000,1.121633,0.139318,0.000006,0.044601,-0.499502,-0.499995,-0.004653,-0.000000,-1.000000,0.000000,0.750000,0,1,0,0,0.250218,0.749782,0.000000,0.000000},
-	{ 0.000000,0.934685,0.133990,0.000005,0.068748,-0.498817,-0.499983,-0.008126,-0.000000,-1.000000,0.000000,0.625000,0,1,0,0,0.375189,0.624811,0.000000,0.000000},
-	{ -0.033863,0.747755,0.122236,0.136441,0.030548,-0.480781,-0.481009,0.000000,-0.136494,-1.000000,0.050001,0.500000,0,1,0,0,0.500147,0.499853,0.000000,0.000000},
-	{ -0.068657,0.747797,0.107212,0.250786,0.034036,-0.432223,-0.432475,0.000000,-0.250929,-1.000000,0.100001,0.500000,0,1,0,0,0.500119,0.499881,0.000000,0.000000},
-	{ -0.063211,0.560850,0.096071,0.256394,0.132593,-0.424107,-0.427893,0.000000,-0.258665,-1.000000,0.100001,0.375000,0,1,0,0,0.625089,0.374911,0.000000,0.000000},
-	{ -0.031554,0.560818,0.110168,0.138743,0.130507,-0.475912,-0.480038,0.001114,-0.139870,-1.000000,0.050001,0.375000,0,1,0,0,0.625110,0.374890,0.000000,0.000000},
-	{ 0.000000,0.747733,0.126709,0.000004,0.030395,-0.499769,-0.499997,-0.003688,-0.000000,-1.000000,0.000000,0.500000,0,1,0,0,0.500162,0.499838,0.000000,0.000000},
-	{ 0.000000,0.560801,0.114496,0.000003,0.130458,-0.495727,-0.499923,-0.017403,-0.001148,-1.000000,0.000000,0.375000,0,1,0,0,0.625121,0.374879,0.000000,0.000000},
-	{ -0.091786,0.560827,0.073748,0.366915,0.139057,-0.332475,-0.335717,0.000000,-0.370532,-1.000000,0.150000,0.375000,0,1,0,0,0.625104,0.374896,0.000000,0.000000},
-	{ -0.100863,0.747767,0.083325,0.362910,0.041334,-0.343321,-0.343594,-0.001361,-0.363240,-1.000000,0.150000,0.500000,0,1,0,0,0.500139,0.499861,0.000000,0.000000},
-	{ -0.112419,0.560653,0.041732,0.455763,0.143941,-0.192615,-0.194392,-0.003715,-0.460661,-1.000000,0.200000,0.375000,0,1,0,0,0.625220,0.374780,0.000000,0.000000},
-	{ -0.124583,0.747535,0.048051,0.456793,0.046808,-0.201972,-0.202104,-0.004077,-0.457329,-1.000000,0.200000,0.500000,0,1,0,0,0.500294,0.499706,0.000000,0.000000},
-	{ -0.120778,0.560334,0.005041,0.494658,0.143139,-0.013820,-0.013941,0.000000,-0.499806,-1.000000,0.250000,0.375000,0,1,0,0,0.625433,0.374567,0.000000,0.000000},
-	{ -0.134419,0.747111,0.007353,0.499198,0.045365,-0.016933,-0.016955,0.000000,-0.499712,-1.000000,0.250000,0.500000,0,1,0,0,0.500577,0.499423,0.000000,0.000000},
-	{ -0.114435,0.560702,-0.029877,0.464919,0.131136,0.171903,0.173125,0.004422,-0.469066,-1.000000,0.300000,0.375000,0,1,0,0,0.625187,0.374813,0.000000,0.000000},
-	{ -0.127266,0.747601,-0.030985,0.467396,0.032134,0.176871,0.176886,0.004894,-0.467659,-1.000000,0.300000,0.500000,0,1,0,0,0.500250,0.499750,0.000000,0.000000},
-	{ -0.096089,0.560880,-0.061898,0.386938,0.116042,0.311308,0.313359,0.001452,-0.389622,-1.000000,0.350000,0.375000,0,1,0,0,0.625069,0.374931,0.000000,0.000000},
-	{ -0.106589,0.747837,-0.066265,0.386504,0.015320,0.317105,0.317131,0.001760,-0.386558,-1.000000,0.350000,0.500000,0,1,0,0,0.500092,0.499908,0.000000,0.000000},
-	{ -0.068575,0.560915,-0.086928,0.275696,0.103311,0.413912,0.416128,0.000000,-0.277196,-1.000000,0.400000,0.375000,0,1,0,0,0.625045,0.374955,0.000000,0.000000},
-	{ -0.075793,0.747885,-0.093755,0.273828,0.001117,0.418351,0.418352,0.000000,-0.273828,-1.000000,0.400000,0.500000,0,1,0,0,0.500060,0.499940,0.000000,0.000000},
-	{ -0.035064,0.560938,-0.102564,0.144146,0.095418,0.476388,0.478572,0.000000,-0.144805,-1.000000,0.450000,0.375000,0,1,0,0,0.625030,0.374970,0.000000,0.000000},
-	{ -0.038532,0.747914,-0.110825,0.142819,-0.007589,0.479154,0.479168,0.000000,-0.142823,-1.000000,0.450000,0.500000,0,1,0,0,0.500041,0.499959,0.000000,0.000000},
-	{ -0.000001,0.560948,-0.107683,0.000123,0.092861,0.497840,0.500000,0.000000,0.000000,-1.000000,0.500000,0.375000,0,1,0,0,0.625023,0.374977,0.000000,0.000000},
-	{ -0.000001,0.747928,-0.116351,0.000150,-0.010409,0.499973,0.500000,0.000000,0.000000,-1.000000,0.500000,0.500000,0,1,0,0,0.500031,0.499969,0.000000,0.000000},
-	{ 0.035070,0.560938,-0.102581,-0.144107,0.095462,0.476398,0.478584,0.000000,0.144766,-1.000000,0.550000,0.375000,0,1,0,0,0.625030,0.374970,0.000000,0.000000},
-	{ 0.038540,0.747915,-0.110849,-0.142774,-0.007546,0.479167,0.479181,0.000000,0.142777,-1.000000,0.550000,0.500000,0,1,0,0,0.500040,0.499960,0.000000,0.000000},
-	{ 0.068579,0.560916,-0.086932,-0.275791,0.103341,0.413848,0.416065,0.000000,0.277291,-1.000000,0.600000,0.375000,0,1,0,0,0.625045,0.374955,0.000000,0.000000},
-	{ 0.075799,0.747885,-0.093760,-0.273944,0.001153,0.418276,0.418276,0.000000,0.273944,-1.000000,0.600000,0.500000,0,1,0,0,0.500060,0.499940,0.000000,0.000000},
-	{ 0.096091,0.560880,-0.061899,-0.386958,0.116051,0.311282,0.313326,-0.001609,0.389649,-1.000000,0.649999,0.375000,0,1,0,0,0.625068,0.374932,0.000000,0.000000},
-	{ 0.106590,0.747838,-0.066266,-0.386530,0.015331,0.317074,0.317100,-0.001778,0.386584,-1.000000,0.649999,0.500000,0,1,0,0,0.500092,0.499908,0.000000,0.000000},
-	{ 0.114437,0.560702,-0.029877,-0.464919,0.131140,0.171905,0.173136,-0.004260,0.469062,-1.000000,0.700000,0.375000,0,1,0,0,0.625187,0.374813,0.000000,0.000000},
-	{ 0.127267,0.747601,-0.030986,-0.467395,0.032138,0.176872,0.176890,-0.004734,0.467658,-1.000000,0.700000,0.500000,0,1,0,0,0.500250,0.499750,0.000000,0.000000},
-	{ 0.120780,0.560334,0.005041,-0.494658,0.143144,-0.013822,-0.013946,0.000000,0.499805,-1.000000,0.750000,0.375000,0,1,0,0,0.625433,0.374567,0.000000,0.000000},
-	{ 0.134421,0.747111,0.007354,-0.499198,0.045370,-0.016934,-0.016959,0.000000,0.499712,-1.000000,0.750000,0.500000,0,1,0,0,0.500577,0.499423,0.000000,0.000000},
-	{ 0.112420,0.560653,0.041732,-0.455761,0.143945,-0.192619,-0.194407,0.003555,0.460655,-1.000000,0.799999,0.375000,0,1,0,0,0.625220,0.374780,0.000000,0.000000},
-	{ 0.124584,0.747535,0.048052,-0.456791,0.046813,-0.201977,-0.202110,0.004049,0.457326,-1.000000,0.799999,0.500000,0,1,0,0,0.500294,0.499706,0.000000,0.000000},
-	{ 0.091787,0.560827,0.073749,-0.366915,0.139060,-0.332474,-0.335698,0.000000,0.370550,-1.000000,0.850000,0.375000,0,1,0,0,0.625104,0.374896,0.000000,0.000000},
-	{ 0.100864,0.747768,0.083326,-0.362910,0.041337,-0.343321,-0.343593,0.001385,0.363240,-1.000000,0.850000,0.500000,0,1,0,0,0.500139,0.499861,0.000000,0.000000},
-	{ 0.063212,0.560850,0.096071,-0.256393,0.132596,-0.424108,-0.427904,0.000000,0.258646,-1.000000,0.900000,0.375000,0,1,0,0,0.625089,0.374911,0.000000,0.000000},
-	{ 0.068658,0.747797,0.107213,-0.250785,0.034039,-0.432224,-0.432477,0.000000,0.250926,-1.000000,0.900000,0.500000,0,1,0,0,0.500119,0.499881,0.000000,0.000000},
-	{ 0.031555,0.560818,0.110168,-0.138737,0.130509,-0.475914,-0.480038,-0.001017,0.139870,-1.000000,0.950000,0.375000,0,1,0,0,0.625110,0.374890,0.000000,0.000000},
-	{ 0.033863,0.747755,0.122236,-0.136433,0.030550,-0.480783,-0.481011,0.000000,0.136487,-1.000000,0.950000,0.500000,0,1,0,0,0.500147,0.499853,0.000000,0.000000},
-	{ 0.000000,0.560801,0.114496,0.000003,0.130458,-0.495727,-0.499923,0.017403,0.001142,-1.000000,1.000000,0.375000,0,1,0,0,0.625121,0.374879,0.000000,0.000000},
-	{ 0.000000,0.747733,0.126709,0.000004,0.030395,-0.499769,-0.499997,0.003689,0.000000,-1.000000,1.000000,0.500000,0,1,0,0,0.500162,0.499838,0.000000,0.000000},
-	{ -0.000002,0.934948,-0.119766,0.000190,0.026685,0.499822,0.500000,0.000000,0.000000,-1.000000,0.500000,0.625000,0,1,0,0,0.375013,0.624987,0.000000,0.000000},
-	{ -0.000002,1.121959,-0.121227,0.000228,0.001717,0.499999,0.500000,0.000000,0.000000,-1.000000,0.500000,0.750000,0,1,0,0,0.250000,0.750000,0.000000,0.000000},
-	{ -0.041875,1.121936,-0.115551,0.136990,0.004453,0.480862,0.480867,0.000000,-0.136993,-1.000000,0.450000,0.750000,0,1,0,0,0.250016,0.749984,0.000000,0.000000},
-	{ -0.040516,0.934929,-0.114121,0.139709,0.029782,0.479854,0.480066,0.000000,-0.139775,-1.000000,0.450000,0.625000,0,1,0,0,0.375025,0.624975,0.000000,0.000000},
-	{ 0.031599,0.373961,-0.094313,-0.146382,0.102624,0.475331,0.477855,0.000000,0.147155,-1.000000,0.550000,0.250000,0,1,0,0,0.750019,0.249981,0.000000,0.000000},
-	{ 0.061359,0.373946,-0.080104,-0.279565,0.110607,0.410834,0.413361,0.000000,0.281305,-1.000000,0.600000,0.250000,0,1,0,0,0.750029,0.249971,0.000000,0.000000},
-	{ 0.053217,0.186976,-0.072025,-0.284552,0.120226,0.406714,0.409683,0.000000,0.286635,-1.000000,0.600000,0.125000,0,1,0,0,0.875015,0.124985,0.000000,0.000000},
-	{ 0.027649,0.186983,-0.084575,-0.149344,0.111971,0.473880,0.476879,0.000000,0.150287,-1.000000,0.550000,0.125000,0,1,0,0,0.875010,0.124990,0.000000,0.000000},
-	{ 0.073816,0.186964,-0.052257,-0.394495,0.133277,0.299888,0.302540,0.000000,0.398083,-1.000000,0.649999,0.125000,0,1,0,0,0.875023,0.124977,0.000000,0.000000},
-	{ 0.085591,0.373922,-0.057532,-0.390217,0.123454,0.306464,0.308759,-0.001384,0.393278,-1.000000,0.649999,0.250000,0,1,0,0,0.750045,0.249955,0.000000,0.000000},
-	{ 0.087270,0.186904,-0.027187,-0.467533,0.148140,0.161018,0.162683,-0.001860,0.472793,-1.000000,0.700000,0.125000,0,1,0,0,0.875062,0.124938,0.000000,0.000000},
-	{ 0.101606,0.373803,-0.028769,-0.466070,0.138479,0.167287,0.168698,-0.003263,0.470678,-1.000000,0.700000,0.250000,0,1,0,0,0.750125,0.249875,0.000000,0.000000},
-	{ 0.091914,0.186781,0.000409,-0.493630,0.158683,-0.005839,-0.005909,0.000000,0.499965,-1.000000,0.750000,0.125000,0,1,0,0,0.875145,0.124855,0.000000,0.000000},
-	{ 0.107139,0.373557,0.002728,-0.494250,0.149835,-0.010223,-0.010326,0.000000,0.499893,-1.000000,0.750000,0.250000,0,1,0,0,0.750289,0.249711,0.000000,0.000000},
-	{ 0.086596,0.186888,0.028598,-0.463356,0.159312,-0.170165,-0.172223,0.001887,0.469402,-1.000000,0.799999,0.125000,0,1,0,0,0.875073,0.124927,0.000000,0.000000},
-	{ 0.100256,0.373770,0.035412,-0.459197,0.150506,-0.182963,-0.184861,0.002955,0.464569,-1.000000,0.799999,0.250000,0,1,0,0,0.750147,0.249853,0.000000,0.000000},
-	{ 0.072375,0.186946,0.053666,-0.385548,0.154262,-0.308875,-0.312592,0.000000,0.390239,-1.000000,0.850000,0.125000,0,1,0,0,0.875034,0.124966,0.000000,0.000000},
-	{ 0.082710,0.373887,0.064171,-0.375182,0.145616,-0.322393,-0.325828,0.000000,0.379258,-1.000000,0.850000,0.250000,0,1,0,0,0.750069,0.249931,0.000000,0.000000},
-	{ 0.051421,0.186954,0.072527,-0.276008,0.148348,-0.410266,-0.414882,0.000000,0.279057,-1.000000,0.900000,0.125000,0,1,0,0,0.875029,0.124971,0.000000,0.000000},
-	{ 0.057766,0.373902,0.084930,-0.265094,0.139489,-0.418164,-0.422317,0.000000,0.267673,-1.000000,0.900000,0.250000,0,1,0,0,0.750059,0.249941,0.000000,0.000000},
-	{ 0.026472,0.186943,0.084558,-0.146950,0.146473,-0.472273,-0.477430,0.000000,0.148527,-1.000000,0.950000,0.125000,0,1,0,0,0.875036,0.124964,0.000000,0.000000},
-	{ 0.029246,0.373881,0.098100,-0.142448,0.137608,-0.474315,-0.478885,0.000000,0.143768,-1.000000,0.950000,0.250000,0,1,0,0,0.750073,0.249927,0.000000,0.000000},
-	{ 0.000000,0.186937,0.088527,0.000001,0.146654,-0.494594,-0.499881,0.021538,0.001595,-1.000000,1.000000,0.125000,0,1,0,0,0.875040,0.124960,0.000000,0.000000},
-	{ 0.000000,0.373870,0.102284,0.000002,0.137762,-0.495233,-0.499906,0.019241,0.001336,-1.000000,1.000000,0.250000,0,1,0,0,0.750080,0.249920,0.000000,0.000000},
-	{ -0.000001,0.373968,-0.099015,0.000092,0.100023,0.497493,0.500000,0.000000,0.000000,-1.000000,0.500000,0.250000,0,1,0,0,0.750015,0.249985,0.000000,0.000000},
-	{ -0.000000,0.186987,-0.088803,0.000052,0.109256,0.497007,0.500000,0.000000,0.000000,-1.000000,0.500000,0.125000,0,1,0,0,0.875007,0.124993,0.000000,0.000000},
-	{ -0.031595,0.373961,-0.094302,0.146411,0.102581,0.475324,0.477845,0.000000,-0.147188,-1.000000,0.450000,0.250000,0,1,0,0,0.750019,0.249981,0.000000,0.000000},
-	{ -0.027647,0.186983,-0.084570,0.149361,0.111930,0.473877,0.476874,0.000000,-0.150304,-1.000000,0.450000,0.125000,0,1,0,0,0.875010,0.124990,0.000000,0.000000},
-	{ -0.061356,0.373946,-0.080102,0.279495,0.110578,0.410884,0.413409,0.000000,-0.281235,-1.000000,0.400000,0.250000,0,1,0,0,0.750029,0.249971,0.000000,0.000000},
-	{ -0.053216,0.186976,-0.072024,0.284512,0.120198,0.406744,0.409705,0.000000,-0.286603,-1.000000,0.400000,0.125000,0,1,0,0,0.875015,0.124985,0.000000,0.000000},
-	{ -0.085590,0.373922,-0.057531,0.390202,0.123446,0.306485,0.308790,0.001168,-0.393254,-1.000000,0.350000,0.250000,0,1,0,0,0.750045,0.249955,0.000000,0.000000},
-	{ -0.073816,0.186964,-0.052257,0.394487,0.133268,0.299900,0.302562,0.000000,-0.398066,-1.000000,0.350000,0.125000,0,1,0,0,0.875023,0.124977,0.000000,0.000000},
-	{ -0.101605,0.373803,-0.028769,0.466071,0.138475,0.167286,0.168691,0.003358,-0.470681,-1.000000,0.300000,0.250000,0,1,0,0,0.750125,0.249875,0.000000,0.000000},
-	{ -0.087270,0.186904,-0.027187,0.467533,0.148136,0.161017,0.162682,0.001859,-0.472794,-1.000000,0.300000,0.125000,0,1,0,0,0.875062,0.124938,0.000000,0.000000},
-	{ -0.107138,0.373557,0.002728,0.494250,0.149830,-0.010222,-0.010323,0.000000,-0.499893,-1.000000,0.250000,0.250000,0,1,0,0,0.750289,0.249711,0.000000,0.000000},
-	{ -0.091913,0.186781,0.000409,0.493631,0.158679,-0.005838,-0.005908,0.000000,-0.499965,-1.000000,0.250000,0.125000,0,1,0,0,0.875145,0.124855,0.000000,0.000000},
-	{ -0.100256,0.373770,0.035412,0.459198,0.150503,-0.182960,-0.184858,-0.002954,-0.464570,-1.000000,0.200000,0.250000,0,1,0,0,0.750147,0.249853,0.000000,0.000000},
-	{ -0.086595,0.186888,0.028598,0.463357,0.159309,-0.170163,-0.172221,-0.001886,-0.469403,-1.000000,0.200000,0.125000,0,1,0,0,0.875073,0.124927,0.000000,0.000000},
-	{ -0.082709,0.373887,0.064171,0.375182,0.145613,-0.322393,-0.325857,0.000000,-0.379233,-1.000000,0.150000,0.250000,0,1,0,0,0.750069,0.249931,0.000000,0.000000},
-	{ -0.072375,0.186946,0.053666,0.385548,0.154259,-0.308875,-0.312630,0.000000,-0.390208,-1.000000,0.150000,0.125000,0,1,0,0,0.875034,0.124966,0.000000,0.000000},
-	{ -0.057766,0.373902,0.084929,0.265094,0.139486,-0.418164,-0.422298,0.000000,-0.267702,-1.000000,0.100001,0.250000,0,1,0,0,0.750059,0.249941,0.000000,0.000000},
-	{ -0.051421,0.186954,0.072527,0.276008,0.148345,-0.410266,-0.414857,0.000000,-0.279095,-1.000000,0.100001,0.125000,0,1,0,0,0.875029,0.124971,0.000000,0.000000},
-	{ -0.029246,0.373881,0.098099,0.142452,0.137606,-0.474314,-0.478884,0.000000,-0.143773,-1.000000,0.050001,0.250000,0,1,0,0,0.750073,0.249927,0.000000,0.000000},
-	{ -0.026472,0.186943,0.084558,0.146952,0.146472,-0.472273,-0.477429,0.000000,-0.148530,-1.000000,0.050001,0.125000,0,1,0,0,0.875036,0.124964,0.000000,0.000000},
-	{ 0.000000,0.373870,0.102284,0.000002,0.137762,-0.495233,-0.499906,-0.019241,-0.001340,-1.000000,0.000000,0.250000,0,1,0,0,0.750080,0.249920,0.000000,0.000000},
-	{ 0.000000,0.186937,0.088527,0.000001,0.146654,-0.494594,-0.499881,-0.021538,-0.001598,-1.000000,0.000000,0.125000,0,1,0,0,0.875040,0.124960,0.000000,0.000000},
-	{ 0.000000,1.495510,0.142713,0.000008,-0.007876,-0.499985,-0.499999,-0.001529,-0.000000,-1.000000,1.000000,1.000000,0,1,0,0,0.000291,0.999709,0.000000,0.000000},
-	{ -0.023698,0.000005,-0.074837,0.152301,0.006663,0.476228,0.476239,0.000000,-0.152304,-1.000000,0.450000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045076,0.000005,-0.063946,0.289959,0.015179,0.407267,0.407313,0.000000,-0.289993,-1.000000,0.400000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062042,0.000005,-0.046982,0.400840,0.028613,0.298534,0.298654,0.000000,-0.401006,-1.000000,0.350000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072934,0.000005,-0.025606,0.473530,0.043680,0.159036,0.159178,0.000000,-0.473986,-1.000000,0.300000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.076688,0.000005,-0.001911,0.499272,0.053747,-0.002259,-0.002251,0.000000,-0.499995,-1.000000,0.250000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072935,0.000005,0.021785,0.472114,0.054257,-0.162396,-0.162608,-0.001068,-0.472819,-1.000000,0.200000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062041,0.000005,0.043160,0.397629,0.048845,-0.302150,-0.302495,0.000000,-0.398117,-1.000000,0.150000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045076,0.000005,0.060125,0.287029,0.043047,-0.408841,-0.409212,0.000000,-0.287307,-1.000000,0.100001,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023698,0.000005,0.071016,0.151946,0.041048,-0.475911,-0.476311,0.000000,-0.152080,-1.000000,0.050001,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,0.000005,0.074770,0.000000,0.041312,-0.499573,-0.499990,-0.006457,-0.000000,-1.000000,0.000000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,0.000005,0.074770,0.000000,0.041312,-0.499573,-0.499990,0.006457,0.000000,-1.000000,1.000000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023698,0.000005,0.071016,-0.151945,0.041049,-0.475911,-0.476311,0.000000,0.152078,-1.000000,0.950000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045076,0.000005,0.060125,-0.287029,0.043049,-0.408841,-0.409215,0.000000,0.287304,-1.000000,0.900000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062041,0.000005,0.043160,-0.397629,0.048848,-0.302150,-0.302490,0.001071,0.398120,-1.000000,0.850000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072935,0.000005,0.021785,-0.472113,0.054261,-0.162398,-0.162610,0.001069,0.472819,-1.000000,0.799999,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.076688,0.000005,-0.001911,-0.499272,0.053751,-0.002259,-0.002252,0.000000,0.499995,-1.000000,0.750000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072934,0.000005,-0.025606,-0.473530,0.043684,0.159036,0.159178,0.000000,0.473986,-1.000000,0.700000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062042,0.000005,-0.046982,-0.400844,0.028622,0.298528,0.298647,0.000000,0.401011,-1.000000,0.649999,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045076,0.000005,-0.063946,-0.289978,0.015208,0.407253,0.407300,0.000000,0.290012,-1.000000,0.600000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.023698,0.000005,-0.074837,-0.152293,0.006701,0.476231,0.476241,0.000000,0.152296,-1.000000,0.550000,-0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,0.000005,-0.078590,0.000025,0.003910,0.499996,0.500000,0.000000,0.000000,-1.000000,0.500000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000}};
-
-const uint32_t unAvatarIndexCount_378 = 1920;
-const uint32_t aunAvatarVertices_378[] = {
-2,1,0,3,2,0,4,2,3,5,4,3,6,4,5,7,
-6,5,8,6,7,9,8,7,10,8,9,11,10,9,12,10,
-11,13,12,11,14,12,13,15,14,13,16,14,15,17,16,15,
-18,16,17,19,18,17,19,17,20,21,19,20,21,20,22,22,
-20,23,20,24,23,17,15,24,20,17,24,23,24,25,24,26,
-25,15,13,26,24,15,26,25,26,27,26,28,27,26,13,28,
-27,28,29,28,30,29,29,30,31,30,32,31,31,32,33,32,
-34,33,33,34,35,34,36,35,35,36,37,36,38,37,37,38,
-39,38,40,39,39,40,41,40,42,41,41,42,43,42,44,43,
-43,44,45,44,46,45,45,46,47,46,48,47,47,48,49,48,
-50,49,49,50,51,50,52,51,51,52,53,52,54,53,53,54,
-55,54,56,55,55,56,57,56,58,57,57,58,59,58,60,59,
-46,61,48,62,61,46,62,63,61,63,64,61,61,64,65,64,
-66,65,65,66,67,66,68,67,67,68,69,68,70,69,69,70,
-71,70,72,71,71,72,73,72,74,73,73,74,75,74,76,75,
-75,76,77,76,78,77,65,67,50,48,65,50,61,65,48,67,
-69,52,50,67,52,69,71,54,52,69,54,71,73,56,54,71,
-56,73,75,58,56,73,58,75,77,60,58,75,60,72,79,74,
-80,79,72,80,81,79,81,82,79,79,82,83,82,84,83,83,
-84,85,84,86,85,85,86,87,86,88,87,89,81,80,90,89,
-80,91,89,90,92,91,90,93,91,92,94,93,92,95,93,94,
-96,95,94,97,95,96,98,97,96,99,97,98,100,99,98,101,
-99,100,102,101,100,103,101,102,104,103,102,105,103,104,106,105,
-104,107,105,106,108,107,106,109,107,108,110,109,108,111,109,110,
-112,111,110,113,111,112,114,113,112,115,113,114,116,115,114,117,
-115,116,118,117,116,119,117,118,120,119,118,120,118,16,18,120,
-16,118,116,14,16,118,14,116,114,12,14,116,12,114,112,10,
-12,114,10,112,110,8,10,112,8,8,110,6,110,108,6,6,
-108,4,108,106,4,4,106,2,106,104,2,2,104,1,104,102,
-1,1,102,121,1,121,122,122,121,123,121,124,123,123,124,62,
-124,63,62,0,1,122,123,62,44,42,123,44,122,123,42,44,
-62,46,0,122,40,40,122,42,38,0,40,3,0,38,36,3,
-38,5,3,36,34,5,36,7,5,34,32,7,34,9,7,32,
-30,9,32,11,9,30,28,11,30,13,11,28,127,126,125,128,
-127,125,129,127,128,130,129,128,131,129,130,132,131,130,133,131,
-132,134,133,132,135,133,134,136,135,134,137,135,136,138,137,136,
-139,137,138,140,139,138,141,139,140,142,141,140,143,141,142,144,
-143,142,144,142,117,119,144,117,142,140,115,117,142,115,140,138,
-113,115,140,113,138,136,111,113,138,111,136,134,109,111,136,109,
-109,134,107,134,132,107,107,132,105,132,130,105,105,130,103,130,
-128,103,103,128,101,128,125,101,101,125,99,125,145,99,125,126,
-145,126,146,145,145,146,147,146,148,147,147,148,149,148,150,149,
-149,150,151,150,152,151,151,152,153,152,154,153,153,154,155,154,
-156,155,155,156,157,156,158,157,157,158,159,158,160,159,159,160,
-161,160,162,161,161,162,163,162,164,163,163,164,165,164,166,165,
-151,153,91,93,151,91,149,151,93,95,149,93,147,149,95,97,
-147,95,159,161,84,82,159,84,161,163,86,84,161,86,163,165,
-88,86,163,88,145,147,97,99,145,97,164,167,166,168,167,164,
-162,168,164,169,168,162,160,169,162,170,169,160,158,170,160,171,
-170,158,156,171,158,172,171,156,154,172,156,173,172,154,152,173,
-154,174,173,152,150,174,152,175,174,150,148,175,150,176,175,148,
-146,176,148,177,176,146,126,177,146,178,177,126,127,178,126,179,
-178,127,129,179,127,180,179,129,131,180,129,181,180,131,133,181,
-131,182,181,133,135,182,133,183,182,135,137,183,135,184,183,137,
-139,184,137,185,184,139,141,185,139,186,185,141,143,186,141,187,
-21,22,98,96,63,124,98,63,63,96,64,96,94,64,64,94,
-66,94,92,66,66,92,68,92,90,68,68,90,70,90,80,70,
-70,80,72,100,98,124,121,100,124,102,100,121,79,83,74,74,
-83,76,83,85,76,76,85,78,85,87,78,153,155,89,91,153,
-89,89,155,81,155,157,81,81,157,82,157,159,82,167,188,166,
-191,190,189,192,191,189,191,193,190,193,194,190,193,195,194,195,
-196,194,195,197,196,197,198,196,197,199,198,199,200,198,199,201,
-200,201,202,200,201,203,202,203,204,202,203,205,204,205,206,204,
-205,207,206,207,208,206,206,208,209,208,210,209,209,210,211,209,
-211,212,213,209,212,206,209,213,204,206,213,213,212,214,215,213,
-214,204,213,215,202,204,215,215,214,216,217,215,216,202,215,217,
-217,216,218,219,217,218,219,218,220,221,219,220,221,220,222,223,
-221,222,223,222,224,225,223,224,225,224,226,227,225,226,227,226,
-228,229,227,228,229,228,230,231,229,230,231,230,232,233,231,232,
-233,232,234,235,233,234,235,234,236,237,235,236,237,236,238,239,
-237,238,239,238,240,241,239,240,241,240,242,243,241,242,243,242,
-244,245,243,244,245,244,246,247,245,246,247,246,248,249,247,248,
-250,235,237,250,251,235,252,251,250,253,252,250,253,250,254,255,
-253,254,255,254,256,257,255,256,257,256,258,259,257,258,259,258,
-260,261,259,260,261,260,262,263,261,262,263,262,264,265,263,264,
-265,264,266,267,265,266,256,254,239,254,237,239,254,250,237,256,
-239,241,258,256,241,258,241,243,260,258,243,260,243,245,262,260,
-245,262,245,247,264,262,247,264,247,249,266,264,249,268,265,267,
-268,269,265,270,269,268,271,270,268,271,268,272,273,271,272,270,
-274,269,274,275,269,274,276,275,276,277,275,276,278,277,278,279,
-277,278,280,279,280,281,279,280,282,281,282,283,281,282,284,283,
-284,285,283,284,286,285,286,287,285,286,288,287,288,289,287,288,
-290,289,290,291,289,290,292,291,292,293,291,292,294,293,294,295,
-293,294,296,295,296,297,295,296,298,297,298,299,297,298,300,299,
-300,301,299,300,302,301,302,303,301,302,304,303,304,305,303,304,
-306,305,306,307,305,306,308,307,308,309,307,307,309,205,309,207,
-205,307,205,203,305,307,203,305,203,201,303,305,201,303,201,199,
-301,303,199,301,199,197,299,301,197,299,197,195,297,299,195,297,
-195,193,295,297,193,295,193,191,293,295,191,293,191,192,291,293,
-192,291,192,310,310,192,311,310,311,312,313,310,312,313,312,251,
-252,313,251,192,189,311,251,312,233,312,231,233,312,311,231,251,
-233,235,311,189,229,311,229,231,189,227,229,189,190,227,190,225,
-227,190,194,225,194,223,225,194,196,223,196,221,223,196,198,221,
-198,219,221,198,200,219,200,217,219,200,202,217,316,315,314,317,
-316,314,316,318,315,318,319,315,318,320,319,320,321,319,320,322,
-321,322,323,321,322,324,323,324,325,323,324,326,325,326,327,325,
-326,328,327,328,329,327,328,330,329,330,331,329,330,332,331,332,
-333,331,331,333,306,333,308,306,331,306,304,329,331,304,329,304,
-302,327,329,302,327,302,300,325,327,300,325,300,298,323,325,298,
-323,298,296,321,323,296,321,296,294,319,321,294,319,294,292,315,
-319,292,315,292,290,314,315,290,314,290,288,334,314,288,317,314,
-334,335,317,334,335,334,336,337,335,336,337,336,338,339,337,338,
-339,338,340,341,339,340,341,340,342,343,341,342,343,342,344,345,
-343,344,345,344,346,347,345,346,347,346,348,349,347,348,349,348,
-350,351,349,350,351,350,352,353,351,352,353,352,354,355,353,354,
-342,340,280,340,282,280,340,338,282,338,284,282,338,336,284,336,
-286,284,350,348,270,348,274,270,348,346,274,346,276,274,346,344,
-276,344,278,276,342,280,278,344,342,278,336,334,286,334,288,286,
-350,270,271,352,350,271,352,271,273,354,352,273,210,356,211,287,
-313,252,285,287,252,285,252,253,283,285,253,283,253,255,281,283,
-255,281,255,257,279,281,257,279,257,259,277,279,259,277,259,261,
-275,277,261,275,261,263,269,275,263,269,263,265,287,289,313,289,
-291,310,289,310,313,272,268,267,357,337,339,358,357,339,358,339,
-341,359,358,341,359,341,343,360,359,343,360,343,345,361,360,345,
-361,345,347,362,361,347,362,347,349,363,362,349,363,349,351,364,
-363,351,364,351,353,365,364,353,365,353,355,366,365,355,367,332,
-330,368,367,330,368,330,328,369,368,328,369,328,326,370,369,326,
-370,326,324,371,370,324,371,324,322,372,371,322,372,322,320,373,
-372,320,373,320,318,374,373,318,374,318,316,375,374,316,375,316,
-317,376,375,317,376,317,335,377,376,335,377,335,337,357,377,337};
-
@@ -1,554 +0,0 @@
-/********************************************************************
-Vireio Perception: Open-Source Stereoscopic 3D Driver
-Copyright (C) 2012 Andres Hernandez
-This file was exported from Vireio using Oculus Avatar SDK.
-Data Copyright : Copyright 2014-2016 Oculus VR, LLC All Rights reserved.
-
-Vireio Perception Version History :.
-v1.0.0 2012 by Andres Hernandez.
-v1.0.X 2013 by John Hicks, Neil Schneider.
-v1.1.x 2013 by Primary Coding Author : Chris Drain.
-Team Support : John Hicks, Phil Larkson, Neil Schneider.
-v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown.
-v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown, Samuel Austin.
-and Neil Schneider.
-
-This program is free software : you can redistribute it and / or modify.
-it under the terms of the GNU Lesser General Public License as published by.
-the Free Software Foundation, either version 3 of the License, or.
-(at your option) any later version..
-
-This program is distributed in the hope that it will be useful,.
-but WITHOUT ANY WARRANTY; without even the implied warranty of.
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the.
-GNU Lesser General Public License for more details..
-
-You should have received a copy of the GNU Lesser General Public License.
-along with this program.If not, see < http://www.gnu.org/licenses/>..
-********************************************************************/
-
-const uint32_t unAvatarVertexCount_399 = 399;
-const ovrAvatarMeshVertex asAvatarVertices_399[] = {
-	{ -0.051205,1.693981,-0.144245,-0.134114,-0.103471,-0.985549,-0.974290,-0.167915,0.150211,-1.000000,0.581233,0.479772,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028302,1.693660,-0.146909,-0.081588,-0.099043,-0.991733,-0.991474,-0.093373,0.090891,-1.000000,0.545560,0.472598,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028334,1.700439,-0.147133,-0.081730,-0.011454,-0.996589,-0.993575,-0.077606,0.082375,-1.000000,0.544287,0.485867,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051584,1.700622,-0.144410,-0.134007,-0.009540,-0.990935,-0.982349,-0.130410,0.134101,-1.000000,0.580015,0.491527,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028334,1.712028,-0.147133,-0.082376,0.000413,-0.996601,-0.995426,-0.048582,0.082259,-1.000000,0.543052,0.508687,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051906,1.712074,-0.144333,-0.136620,0.001538,-0.990622,-0.989160,-0.054556,0.136334,-1.000000,0.579776,0.511680,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.712028,-0.148632,0.000000,0.000000,-1.000000,-1.000000,0.000000,0.000000,-1.000000,0.499960,0.507825,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.700439,-0.148632,0.000000,-0.011963,-0.999928,-1.000000,0.000000,0.000000,-1.000000,0.499948,0.483946,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.693660,-0.148418,0.000000,-0.096106,-0.995371,-1.000000,0.000000,0.000000,-1.000000,0.499942,0.470107,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028334,1.728719,-0.147133,-0.082672,0.000000,-0.996577,-0.996417,0.017929,0.082659,-1.000000,0.542845,0.541596,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.728719,-0.148632,0.000000,0.000000,-1.000000,-0.999995,-0.003226,-0.000000,-1.000000,0.499985,0.542308,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028334,1.744928,-0.147133,-0.082387,-0.000443,-0.996600,-0.993269,0.081731,0.082075,-1.000000,0.544772,0.573623,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051906,1.744883,-0.144333,-0.136667,-0.001652,-0.990616,-0.983451,0.120291,0.135478,-1.000000,0.582095,0.568481,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028334,1.755074,-0.147133,-0.081729,0.013595,-0.996562,-0.990857,0.106587,0.082715,-1.000000,0.547049,0.593665,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051584,1.754891,-0.144410,-0.134045,0.011314,-0.990911,-0.973910,0.183266,0.133838,-1.000000,0.584087,0.586192,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028302,1.760409,-0.146909,-0.081474,0.125480,-0.988745,-0.988679,0.115237,0.096093,-1.000000,0.548671,0.604061,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051205,1.760089,-0.144245,-0.134512,0.131540,-0.982142,-0.965124,0.207256,0.159939,-1.000000,0.585842,0.595370,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.760409,-0.148418,0.000000,0.121555,-0.992585,-1.000000,0.000000,0.000000,-1.000000,0.500053,0.607056,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.755074,-0.148632,0.000000,0.014189,-0.999899,-1.000000,0.000000,0.000000,-1.000000,0.500037,0.596130,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.744928,-0.148632,0.000000,0.000000,-1.000000,-0.999995,-0.003042,-0.000000,-1.000000,0.500009,0.575526,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.052013,1.728719,-0.144308,-0.137647,0.000000,-0.990481,-0.989844,0.035856,0.137558,-1.000000,0.580944,0.540396,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064663,1.754341,-0.142236,-0.196835,0.013421,-0.980345,-0.968083,0.155570,0.196503,-1.000000,0.604208,0.580564,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063309,1.759126,-0.142289,-0.203981,0.138934,-0.969066,-0.955473,0.187341,0.227979,-1.000000,0.603665,0.588529,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070594,1.753791,-0.140557,-0.344227,0.061032,-0.936901,-0.937396,0.033875,0.346615,-1.000000,0.613938,0.578618,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072849,1.744608,-0.140025,-0.338251,0.014723,-0.940941,-0.941016,0.003888,0.338339,-1.000000,0.617591,0.564387,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065952,1.744745,-0.141928,-0.201609,-0.000489,-0.979466,-0.976116,0.082742,0.200878,-1.000000,0.605376,0.565075,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067652,1.757315,-0.141041,-0.361367,0.201059,-0.910488,-0.915670,0.107754,0.387219,-1.000000,0.610029,0.584543,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.073601,1.728719,-0.139848,-0.334110,0.000001,-0.942534,-0.941920,0.036101,0.333893,-1.000000,0.618898,0.538931,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066382,1.728719,-0.141826,-0.202470,0.000000,-0.979289,-0.978451,0.041343,0.202297,-1.000000,0.605766,0.539386,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072849,1.712349,-0.140025,-0.338418,-0.013589,-0.940898,-0.938401,0.079076,0.336378,-1.000000,0.615538,0.512728,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065952,1.712211,-0.141928,-0.201555,0.000480,-0.979477,-0.979456,0.006409,0.201554,-1.000000,0.603291,0.513036,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070594,1.701722,-0.140557,-0.345727,-0.051190,-0.936938,-0.937403,0.063342,0.342438,-1.000000,0.610309,0.496517,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064663,1.701172,-0.142236,-0.196850,-0.011367,-0.980368,-0.978013,-0.067940,0.197165,-1.000000,0.600350,0.495581,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067652,1.697129,-0.141041,-0.363786,-0.152826,-0.918860,-0.928591,-0.018171,0.370660,-1.000000,0.605599,0.489461,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063309,1.694943,-0.142289,-0.203199,-0.110767,-0.972852,-0.969036,-0.119605,0.216020,-1.000000,0.598946,0.485530,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046067,1.761821,-0.119709,-0.045360,0.998957,0.005217,-0.672799,-0.034409,0.739025,-1.000000,0.612918,0.640786,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025428,1.762188,-0.124398,-0.008063,0.999967,0.000796,-0.936541,-0.007830,0.350471,-1.000000,0.562292,0.656961,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.762188,-0.113706,-0.008654,0.999963,0.000261,-0.893448,-0.007849,0.449099,-1.000000,0.573413,0.679374,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045406,1.761821,-0.107411,-0.048983,0.998798,0.001666,-0.553286,-0.028523,0.832503,-1.000000,0.634003,0.657588,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.762188,-0.105449,-0.009465,0.999955,0.000000,-0.857543,-0.008117,0.514348,-1.000000,0.584535,0.696620,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045406,1.761821,-0.097727,-0.054383,0.998520,0.000000,-0.482510,-0.026279,0.875496,-1.000000,0.654923,0.669823,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.762188,-0.109931,0.000000,1.000000,0.000000,-1.000000,0.000000,0.000000,-1.000000,0.500151,0.703896,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.762188,-0.117361,0.000000,1.000000,0.000000,-1.000000,0.000000,0.000000,-1.000000,0.500121,0.685246,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.762188,-0.127118,0.000000,1.000000,0.000000,-1.000000,0.000000,0.000000,-1.000000,0.500098,0.661345,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056375,1.760721,-0.103144,-0.219668,0.975545,0.007577,-0.292853,-0.073348,0.953340,-1.000000,0.664190,0.637111,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056375,1.760721,-0.092492,-0.245130,0.969490,0.000000,-0.193628,-0.048958,0.979853,-1.000000,0.689877,0.644470,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061941,1.758209,-0.100200,-0.596966,0.802066,0.017922,-0.142072,-0.127676,0.981588,-1.000000,0.680069,0.623349,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062697,1.758209,-0.114541,-0.575805,0.815112,0.063560,-0.191519,-0.210052,0.958748,-1.000000,0.650887,0.613128,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066844,1.753607,-0.113483,-0.889178,0.448106,0.092537,-0.013523,-0.227887,0.973594,-1.000000,0.660313,0.599541,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066088,1.753607,-0.097874,-0.900408,0.434416,0.023405,-0.028269,-0.112109,0.993294,-1.000000,0.692815,0.607449,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061941,1.758209,-0.088609,-0.628385,0.777902,0.000000,-0.064109,-0.051787,0.996598,-1.000000,0.709011,0.628191,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066088,1.753607,-0.084940,-0.913817,0.406126,0.000000,-0.010387,-0.023372,0.999673,-1.000000,0.725214,0.610307,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069422,1.744562,-0.113034,-0.985379,0.138139,0.099729,0.081040,-0.134875,0.987543,-1.000000,0.669317,0.576926,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068666,1.744562,-0.096362,-0.990561,0.134980,0.023851,0.018263,-0.042489,0.998930,-1.000000,0.703792,0.580994,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068666,1.744562,-0.082269,-0.991759,0.128120,0.000000,0.000000,0.005740,0.999984,-1.000000,0.738025,0.581714,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069525,1.728719,-0.081379,-1.000000,-0.000015,-0.000000,0.000000,0.057000,0.998374,-1.000000,0.741330,0.531633,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069525,1.728719,-0.095858,-0.999718,-0.000001,0.023755,0.023713,0.058895,0.997983,-1.000000,0.707775,0.534371,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068666,1.712395,-0.082269,-0.992755,-0.120159,-0.000000,-0.014550,0.120209,0.992642,-1.000000,0.730652,0.480139,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068666,1.712395,-0.096362,-0.991780,-0.125697,0.023946,0.001351,0.176841,0.984238,-1.000000,0.697912,0.486811,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066088,1.701906,-0.084940,-0.936704,-0.350121,-0.000000,-0.060346,0.161448,0.985035,-1.000000,0.710948,0.448011,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066088,1.701906,-0.097874,-0.928263,-0.371149,0.024032,-0.085336,0.275430,0.957526,-1.000000,0.681570,0.457732,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061941,1.695860,-0.088609,-0.717609,-0.696446,-0.000000,-0.183804,0.189390,0.964545,-1.000000,0.688097,0.427993,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061941,1.695860,-0.100200,-0.687736,-0.725673,0.020455,-0.278076,0.289357,0.915940,-1.000000,0.664894,0.441140,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069422,1.712395,-0.113034,-0.986676,-0.128372,0.099953,0.066964,0.239476,0.968590,-1.000000,0.665778,0.496445,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066844,1.701906,-0.113483,-0.919216,-0.381922,0.095793,-0.048922,0.352175,0.934655,-1.000000,0.653314,0.471670,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062697,1.695860,-0.114541,-0.666566,-0.741822,0.073423,-0.264462,0.327417,0.907115,-1.000000,0.641129,0.457024,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070281,1.728719,-0.112884,-0.995014,0.000002,0.099739,0.099635,0.045781,0.993970,-1.000000,0.674106,0.537014,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056375,1.692867,-0.103144,-0.248174,-0.968677,0.008645,-0.496953,0.134970,0.857217,-1.000000,0.647864,0.430337,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056375,1.692867,-0.092492,-0.278526,-0.960429,-0.000000,-0.537570,0.155897,0.828682,-1.000000,0.665192,0.414577,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057131,1.692867,-0.116520,-0.229845,-0.972834,0.027683,-0.498708,0.142158,0.855033,-1.000000,0.627673,0.446888,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046067,1.691767,-0.119709,-0.048438,-0.998809,0.005811,-0.733139,0.039504,0.678931,-1.000000,0.602564,0.433259,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045406,1.691767,-0.107411,-0.051594,-0.998667,0.001747,-0.680320,0.036428,0.732009,-1.000000,0.618280,0.414918,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025428,1.691400,-0.124398,-0.009328,-0.999956,0.001055,-0.947346,0.009175,0.320081,-1.000000,0.555399,0.418777,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.691400,-0.120597,-0.009346,-0.999956,0.000411,-0.924988,0.008802,0.379895,-1.000000,0.557592,0.410591,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045406,1.691767,-0.097727,-0.056312,-0.998413,0.000000,-0.674252,0.038029,0.737522,-1.000000,0.632189,0.400576,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.691400,-0.112339,-0.009773,-0.999952,-0.000000,-0.893888,0.008736,0.448206,-1.000000,0.565327,0.394756,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.691400,-0.127118,0.000000,-1.000000,0.000000,-1.000000,0.000000,0.000000,-1.000000,0.499942,0.415467,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.691400,-0.124251,0.000000,-1.000000,0.000000,-1.000000,0.000000,0.000000,-1.000000,0.499945,0.408878,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.691400,-0.116822,0.000000,-1.000000,0.000000,-1.000000,0.000000,0.000000,-1.000000,0.499961,0.391650,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069112,1.701906,-0.126534,-0.904176,-0.383576,0.187977,-0.004145,0.447920,0.894064,-1.000000,0.632943,0.484141,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064965,1.695860,-0.127298,-0.653340,-0.744625,0.136676,-0.265193,0.394194,0.879934,-1.000000,0.623406,0.471599,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067298,1.695860,-0.136528,-0.647879,-0.743644,0.165064,-0.308576,0.454332,0.835682,-1.000000,0.611960,0.482679,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071445,1.701906,-0.135618,-0.893864,-0.384442,0.230677,0.030888,0.460487,0.887129,-1.000000,0.620222,0.492903,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068250,1.695860,-0.140292,-0.683189,-0.724274,-0.093163,-0.554309,0.431302,0.711843,-1.000000,0.607029,0.487401,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062684,1.692867,-0.141631,-0.263594,-0.895531,-0.358528,-0.873857,0.064279,0.481915,-1.000000,0.599017,0.481894,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061732,1.692867,-0.137924,-0.221876,-0.973465,0.056004,-0.704570,0.199763,0.680937,-1.000000,0.602674,0.475951,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050926,1.691767,-0.143543,-0.098221,-0.883779,-0.457479,-0.957142,-0.041961,0.286562,-1.000000,0.581924,0.475620,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050094,1.691767,-0.140001,-0.043203,-0.999016,0.010073,-0.915321,0.043620,0.400356,-1.000000,0.584034,0.468222,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028204,1.691400,-0.146235,-0.047360,-0.865218,-0.499154,-0.986739,-0.037145,0.158008,-1.000000,0.546081,0.467912,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027728,1.691400,-0.142956,-0.007560,-0.999970,0.001450,-0.980699,0.007697,0.195374,-1.000000,0.547075,0.460284,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.691400,-0.147777,0.000000,-0.851474,-0.524398,-1.000000,0.000000,0.000000,-1.000000,0.499941,0.465288,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.691400,-0.144652,0.000000,-1.000000,0.000000,-1.000000,0.000000,0.000000,-1.000000,0.499939,0.457710,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072397,1.701906,-0.139322,-0.923311,-0.350796,-0.156326,-0.302366,0.413011,0.859068,-1.000000,0.614026,0.496384,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074023,1.712395,-0.135116,-0.959103,-0.129197,0.251854,0.197522,0.331838,0.922425,-1.000000,0.626999,0.510467,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074975,1.712395,-0.138731,-0.970052,-0.115809,-0.213514,-0.237169,0.261781,0.935533,-1.000000,0.619941,0.512372,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074882,1.728719,-0.134949,-0.966805,0.000000,0.255515,0.255118,0.055742,0.965302,-1.000000,0.631063,0.538584,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.075834,1.728719,-0.138534,-0.972975,-0.000003,-0.230911,-0.230692,0.043498,0.972054,-1.000000,0.623640,0.538791,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074023,1.744562,-0.135116,-0.957782,0.139073,0.251621,0.211873,-0.250143,0.944742,-1.000000,0.629152,0.565991,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074975,1.744562,-0.138731,-0.968911,0.124433,-0.213842,-0.234144,-0.181947,0.955025,-1.000000,0.622009,0.564438,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071445,1.753607,-0.135618,-0.864227,0.450903,0.223156,0.022463,-0.408534,0.912467,-1.000000,0.623970,0.581633,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072397,1.753607,-0.139322,-0.898188,0.410677,-0.156850,-0.311208,-0.341995,0.886673,-1.000000,0.617621,0.578417,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067298,1.758209,-0.136528,-0.559794,0.816266,0.142621,-0.344283,-0.385671,0.855995,-1.000000,0.617072,0.590517,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068250,1.758209,-0.140292,-0.596804,0.798908,-0.074636,-0.573461,-0.359624,0.736080,-1.000000,0.611700,0.585944,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061732,1.760721,-0.137924,-0.196828,0.979182,0.049621,-0.677705,-0.172452,0.714826,-1.000000,0.608184,0.597362,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062684,1.760721,-0.141631,-0.234498,0.928668,-0.287378,-0.847905,-0.050805,0.527708,-1.000000,0.603956,0.591517,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050094,1.761821,-0.140001,-0.043202,0.999016,0.010073,-0.896170,-0.043208,0.441602,-1.000000,0.589446,0.606077,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050926,1.761821,-0.143543,-0.088751,0.923579,-0.372996,-0.943885,0.041618,0.327640,-1.000000,0.586665,0.598745,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.027728,1.762188,-0.142956,-0.007560,0.999970,0.001450,-0.977628,-0.007695,0.210200,-1.000000,0.550725,0.615466,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028204,1.762188,-0.146235,-0.040612,0.909814,-0.413025,-0.984263,0.034721,0.173265,-1.000000,0.549303,0.607866,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.762188,-0.144652,0.000000,1.000000,0.000000,-1.000000,0.000000,0.000000,-1.000000,0.500064,0.618600,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.762188,-0.147777,0.000000,0.899425,-0.437074,-1.000000,0.000000,0.000000,-1.000000,0.500057,0.610983,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026562,1.762188,-0.134912,-0.007721,0.999969,0.001269,-0.965500,-0.007785,0.260287,-1.000000,0.554793,0.633930,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048052,1.761821,-0.131314,-0.043686,0.999008,0.008628,-0.804165,-0.040288,0.593040,-1.000000,0.598136,0.622112,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.762188,-0.136991,0.000000,1.000000,0.000000,-1.000000,0.000000,0.000000,-1.000000,0.500077,0.637328,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059399,1.760721,-0.128833,-0.198051,0.979291,0.042012,-0.513865,-0.140231,0.846332,-1.000000,0.619732,0.609789,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.057131,1.760721,-0.116520,-0.204041,0.978656,0.024476,-0.389940,-0.104181,0.914928,-1.000000,0.638283,0.624539,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064965,1.758209,-0.127298,-0.564190,0.817162,0.118048,-0.238951,-0.298463,0.924025,-1.000000,0.630022,0.600692,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069112,1.753607,-0.126534,-0.874344,0.450003,0.181715,0.014969,-0.349249,0.936910,-1.000000,0.637562,0.589445,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071690,1.744562,-0.126251,-0.969542,0.138402,0.202071,0.158893,-0.272428,0.948966,-1.000000,0.645232,0.570852,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072549,1.728719,-0.126157,-0.978941,0.000001,0.204141,0.204135,0.007639,0.978913,-1.000000,0.650006,0.538118,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.071690,1.712395,-0.126251,-0.970840,-0.128581,0.202328,0.152375,0.320588,0.934882,-1.000000,0.642866,0.504803,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059399,1.692867,-0.128833,-0.223103,-0.973642,0.047390,-0.571337,0.169998,0.802917,-1.000000,0.612478,0.463015,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.048052,1.691767,-0.131314,-0.043686,-0.999008,0.008628,-0.831179,0.041136,0.554481,-1.000000,0.590963,0.452011,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.026562,1.691400,-0.134912,-0.007721,-0.999969,0.001269,-0.971160,0.007801,0.238299,-1.000000,0.549939,0.441784,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.691400,-0.136991,0.000000,-1.000000,-0.000000,-1.000000,0.000000,0.000000,-1.000000,0.499937,0.439125,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025428,1.691400,-0.124398,0.009328,-0.999956,0.001054,-0.947324,-0.009175,-0.320145,-1.000000,0.444491,0.418761,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.691400,-0.120597,0.009346,-0.999956,0.000411,-0.925004,-0.008802,-0.379854,-1.000000,0.442290,0.410575,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.691400,-0.112339,0.009773,-0.999952,0.000000,-0.894050,-0.008738,-0.447882,-1.000000,0.434569,0.394733,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045406,1.691767,-0.097727,0.056312,-0.998413,0.000000,-0.674794,-0.038059,-0.737024,-1.000000,0.367711,0.400534,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045406,1.691767,-0.107411,0.051594,-0.998667,0.001747,-0.680645,-0.036445,-0.731706,-1.000000,0.381607,0.414906,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046067,1.691767,-0.119709,0.048438,-0.998809,0.005811,-0.732809,-0.039490,-0.679288,-1.000000,0.397301,0.433275,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056375,1.692867,-0.092492,0.278526,-0.960429,0.000000,-0.537785,-0.155959,-0.828532,-1.000000,0.334643,0.414525,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056375,1.692867,-0.103144,0.248175,-0.968677,0.008645,-0.497501,-0.135107,-0.856877,-1.000000,0.352007,0.430328,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061941,1.695860,-0.088609,0.717610,-0.696446,0.000000,-0.181975,-0.187505,-0.965260,-1.000000,0.311732,0.428011,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061941,1.695860,-0.100200,0.687736,-0.725673,0.020455,-0.277852,-0.289149,-0.916074,-1.000000,0.334973,0.441140,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066088,1.701906,-0.097874,0.928263,-0.371149,0.024032,-0.084831,-0.274193,-0.957926,-1.000000,0.318310,0.457777,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066088,1.701906,-0.084940,0.936704,-0.350121,0.000000,-0.059227,-0.158456,-0.985588,-1.000000,0.288900,0.448132,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066844,1.701906,-0.113483,0.919217,-0.381922,0.095793,-0.048820,-0.351952,-0.934744,-1.000000,0.346561,0.471722,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062697,1.695860,-0.114541,0.666566,-0.741821,0.073423,-0.264668,-0.327589,-0.906993,-1.000000,0.358736,0.457057,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069422,1.712395,-0.113034,0.986676,-0.128372,0.099953,0.067068,-0.238801,-0.968750,-1.000000,0.334136,0.496537,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068666,1.712395,-0.096362,0.991780,-0.125697,0.023946,0.001570,-0.175170,-0.984537,-1.000000,0.302008,0.486928,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068666,1.712395,-0.082269,0.992755,-0.120159,0.000000,-0.014225,-0.117526,-0.992968,-1.000000,0.269252,0.480349,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069525,1.728719,-0.095858,0.999718,-0.000001,0.023754,0.023715,-0.057329,-0.998074,-1.000000,0.292226,0.534559,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069525,1.728719,-0.081379,1.000000,-0.000015,0.000000,0.000000,-0.054631,-0.998507,-1.000000,0.258673,0.531911,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070281,1.728719,-0.112884,0.995014,0.000002,0.099739,0.099639,-0.044785,-0.994015,-1.000000,0.325881,0.537154,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069422,1.744562,-0.113034,0.985379,0.138139,0.099729,0.080836,0.136214,-0.987376,-1.000000,0.330749,0.577083,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068666,1.744562,-0.096362,0.990561,0.134980,0.023851,0.018051,0.044031,-0.998867,-1.000000,0.296301,0.581211,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066088,1.753607,-0.097874,0.900408,0.434416,0.023405,-0.028935,0.113479,-0.993119,-1.000000,0.307326,0.607665,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066088,1.753607,-0.084940,0.913817,0.406126,0.000000,-0.011190,0.025178,-0.999620,-1.000000,0.274953,0.610590,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061941,1.758209,-0.088609,0.628385,0.777902,0.000000,-0.065478,0.052893,-0.996451,-1.000000,0.291188,0.628448,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061941,1.758209,-0.100200,0.596967,0.802066,0.017922,-0.143288,0.128574,-0.981294,-1.000000,0.320100,0.623553,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068666,1.744562,-0.082269,0.991759,0.128120,0.000000,0.000000,-0.003514,-0.999994,-1.000000,0.262084,0.582014,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066844,1.753607,-0.113483,0.889178,0.448106,0.092537,-0.014161,0.229093,-0.973302,-1.000000,0.339799,0.599694,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062697,1.758209,-0.114541,0.575806,0.815112,0.063560,-0.192512,0.210726,-0.958402,-1.000000,0.349245,0.613274,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056375,1.760721,-0.103144,0.219668,0.975545,0.007577,-0.294307,0.073672,-0.952867,-1.000000,0.335997,0.637300,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057131,1.760721,-0.116520,0.204041,0.978656,0.024476,-0.391211,0.104432,-0.914356,-1.000000,0.361859,0.624681,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045406,1.761821,-0.107411,0.048983,0.998798,0.001666,-0.554819,0.028597,-0.831480,-1.000000,0.366215,0.657745,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046067,1.761821,-0.119709,0.045361,0.998957,0.005217,-0.674169,0.034465,-0.737772,-1.000000,0.387250,0.640899,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.762188,-0.113706,0.008654,0.999963,0.000261,-0.894177,0.007855,-0.447644,-1.000000,0.426830,0.679459,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025428,1.762188,-0.124398,0.008063,0.999967,0.000796,-0.936968,0.007833,-0.349328,-1.000000,0.437891,0.657021,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.762188,-0.105449,0.009465,0.999955,0.000000,-0.858456,0.008125,-0.512823,-1.000000,0.415767,0.696728,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045406,1.761821,-0.097727,0.054383,0.998520,0.000000,-0.484058,0.026364,-0.874638,-1.000000,0.345337,0.670016,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056375,1.760721,-0.092492,0.245130,0.969490,0.000000,-0.195168,0.049347,-0.979528,-1.000000,0.310341,0.644703,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026562,1.762188,-0.134912,0.007721,0.999969,0.001269,-0.965701,0.007786,-0.259540,-1.000000,0.445345,0.633980,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027728,1.762188,-0.142956,0.007560,0.999970,0.001450,-0.977750,0.007696,-0.209633,-1.000000,0.449384,0.615511,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050094,1.761821,-0.140001,0.043202,0.999016,0.010073,-0.896532,0.043216,-0.440867,-1.000000,0.410654,0.606141,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050926,1.761821,-0.143543,0.088751,0.923579,-0.372995,-0.944031,-0.041443,-0.327242,-1.000000,0.413415,0.598804,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028204,1.762188,-0.146235,0.040612,0.909814,-0.413024,-0.984339,-0.034538,-0.172869,-1.000000,0.450794,0.607908,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062684,1.760721,-0.141631,0.234499,0.928668,-0.287378,-0.848617,0.051355,-0.526509,-1.000000,0.396114,0.591584,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061732,1.760721,-0.137924,0.196828,0.979182,0.049621,-0.679244,0.172684,-0.713308,-1.000000,0.391904,0.597444,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068250,1.758209,-0.140292,0.596805,0.798908,-0.074635,-0.574815,0.360788,-0.734452,-1.000000,0.388359,0.586023,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067298,1.758209,-0.136528,0.559794,0.816266,0.142621,-0.346067,0.386689,-0.854816,-1.000000,0.383005,0.590615,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072397,1.753607,-0.139322,0.898188,0.410677,-0.156850,-0.312141,0.344536,-0.885360,-1.000000,0.382422,0.578502,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071445,1.753607,-0.135618,0.864227,0.450903,0.223156,0.021518,0.410026,-0.911820,-1.000000,0.376087,0.581739,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074975,1.744562,-0.138731,0.968911,0.124433,-0.213842,-0.234455,0.185767,-0.954212,-1.000000,0.378014,0.564520,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074023,1.744562,-0.135116,0.957782,0.139073,0.251621,0.211527,0.251847,-0.944367,-1.000000,0.370885,0.566092,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.075834,1.728719,-0.138534,0.972975,-0.000003,-0.230911,-0.230715,-0.041237,-0.972147,-1.000000,0.376343,0.538845,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074882,1.728719,-0.134949,0.966805,0.000000,0.255515,0.255156,-0.052975,-0.965448,-1.000000,0.368920,0.538661,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074975,1.712395,-0.138731,0.970051,-0.115809,-0.213515,-0.237058,-0.259753,-0.936126,-1.000000,0.380004,0.512414,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074023,1.712395,-0.135116,0.959103,-0.129197,0.251854,0.197981,-0.329718,-0.923087,-1.000000,0.372939,0.510530,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072397,1.701906,-0.139322,0.923311,-0.350796,-0.156326,-0.301973,-0.411616,-0.859875,-1.000000,0.385894,0.496422,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071445,1.701906,-0.135618,0.893864,-0.384442,0.230677,0.031541,-0.459318,-0.887712,-1.000000,0.379682,0.492953,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068250,1.695860,-0.140292,0.683190,-0.724274,-0.093162,-0.553596,-0.430496,-0.712884,-1.000000,0.392882,0.487438,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067298,1.695860,-0.136528,0.647880,-0.743644,0.165064,-0.307918,-0.453869,-0.836176,-1.000000,0.387934,0.482722,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062684,1.692867,-0.141631,0.263594,-0.895531,-0.358528,-0.873020,-0.063378,-0.483548,-1.000000,0.400892,0.481913,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061732,1.692867,-0.137924,0.221876,-0.973465,0.056005,-0.703216,-0.199539,-0.682401,-1.000000,0.397209,0.475987,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050926,1.691767,-0.143543,0.098221,-0.883779,-0.457479,-0.957029,0.042155,-0.286912,-1.000000,0.417968,0.475614,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050094,1.691767,-0.140001,0.043203,-0.999016,0.010074,-0.915007,-0.043614,-0.401074,-1.000000,0.415833,0.468218,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028204,1.691400,-0.146235,0.047360,-0.865218,-0.499154,-0.986748,0.037115,-0.157957,-1.000000,0.453807,0.467913,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.027728,1.691400,-0.142956,0.007560,-0.999970,0.001450,-0.980712,-0.007697,-0.195305,-1.000000,0.452816,0.460283,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069112,1.701906,-0.126534,0.904176,-0.383576,0.187977,-0.003967,-0.447583,-0.894233,-1.000000,0.366942,0.484201,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064965,1.695860,-0.127298,0.653340,-0.744625,0.136676,-0.264975,-0.394029,-0.880074,-1.000000,0.376467,0.471653,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071690,1.712395,-0.126251,0.970840,-0.128581,0.202329,0.152542,-0.319742,-0.935145,-1.000000,0.357059,0.504886,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059399,1.692867,-0.128833,0.223103,-0.973642,0.047390,-0.570458,-0.169829,-0.803577,-1.000000,0.387390,0.463059,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.057131,1.692867,-0.116520,0.229845,-0.972833,0.027683,-0.498998,-0.142221,-0.854854,-1.000000,0.372194,0.446915,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048052,1.691767,-0.131314,0.043686,-0.999008,0.008628,-0.830497,-0.041115,-0.555504,-1.000000,0.408905,0.452008,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.026562,1.691400,-0.134912,0.007721,-0.999969,0.001269,-0.971189,-0.007801,-0.238183,-1.000000,0.449946,0.441780,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072549,1.728719,-0.126157,0.978941,0.000001,0.204141,0.204137,-0.006319,-0.978922,-1.000000,0.349978,0.538227,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.071690,1.744562,-0.126251,0.969542,0.138402,0.202071,0.158717,0.273326,-0.948737,-1.000000,0.354814,0.570965,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069112,1.753607,-0.126534,0.874344,0.450003,0.181715,0.014609,0.349859,-0.936689,-1.000000,0.362520,0.589563,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064965,1.758209,-0.127298,0.564190,0.817162,0.118048,-0.239790,0.298987,-0.923638,-1.000000,0.370079,0.600811,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059399,1.760721,-0.128833,0.198051,0.979291,0.042012,-0.515430,0.140505,-0.845335,-1.000000,0.380381,0.609902,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.048052,1.761821,-0.131314,0.043686,0.999008,0.008628,-0.805086,0.040317,-0.591786,-1.000000,0.401992,0.622191,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046158,1.712074,-0.086582,0.538821,-0.154450,0.828141,-0.827261,0.088642,0.554781,-1.000000,0.641850,0.348172,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.712028,-0.104684,0.417895,-0.237196,0.876984,-0.896897,0.046041,0.439836,-1.000000,0.567500,0.345178,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.700439,-0.106293,0.441798,-0.165040,0.881803,-0.886845,0.067956,0.457043,-1.000000,0.569359,0.369675,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045835,1.700622,-0.089398,0.562171,-0.207269,0.800627,-0.797636,0.119877,0.591106,-1.000000,0.641789,0.374418,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.693660,-0.108074,0.398892,-0.277075,0.874136,-0.895174,0.089074,0.436726,-1.000000,0.569402,0.383818,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045513,1.693981,-0.092415,0.534027,-0.328561,0.779014,-0.774160,0.180337,0.606758,-1.000000,0.639260,0.389467,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.693660,-0.113199,0.000000,-0.245600,0.969371,-1.000000,0.000000,0.000000,-1.000000,0.499955,0.380672,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.700439,-0.112240,0.000000,-0.139922,0.990163,-1.000000,0.000000,0.000000,-1.000000,0.499982,0.367430,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.712028,-0.111435,0.000000,-0.279838,0.960047,-1.000000,0.000000,0.000000,-1.000000,0.499992,0.344272,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046265,1.728719,-0.085643,0.496568,-0.054484,0.866286,-0.862463,0.081564,0.499506,-1.000000,0.638539,0.311086,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.728719,-0.097257,0.405281,-0.142082,0.903084,-0.907480,0.056957,0.416215,-1.000000,0.573396,0.306440,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.046158,1.744883,-0.086582,0.456338,0.102963,0.883829,-0.889420,0.082031,0.449669,-1.000000,0.634915,0.275119,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.744928,-0.097794,0.359445,0.077683,0.929927,-0.932852,0.055761,0.355918,-1.000000,0.571355,0.270705,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045835,1.754891,-0.089398,0.423304,0.271481,0.864356,-0.904406,0.070274,0.420846,-1.000000,0.630295,0.251907,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.755074,-0.099403,0.324752,0.207557,0.922744,-0.945440,0.044344,0.322766,-1.000000,0.569650,0.247841,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045513,1.760089,-0.092415,0.364382,0.449494,0.815586,-0.921532,0.047855,0.385342,-1.000000,0.625816,0.238374,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.760409,-0.101184,0.276870,0.361078,0.890486,-0.957709,0.028146,0.286358,-1.000000,0.568003,0.235182,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.744928,-0.104545,0.000000,0.061441,0.998111,-0.999999,0.001103,0.000000,-1.000000,0.500131,0.268868,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.755074,-0.105350,0.000000,0.165822,0.986156,-0.999999,0.001093,0.000000,-1.000000,0.500175,0.246272,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.760409,-0.106309,0.000000,0.307197,0.951646,-1.000000,0.001020,0.000000,-1.000000,0.500199,0.234142,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.728719,-0.104277,0.000000,-0.214238,0.976782,-1.000000,0.000000,0.000000,-1.000000,0.500061,0.304306,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059382,1.744745,-0.079952,0.425213,0.111871,0.898153,-0.904892,0.073480,0.419251,-1.000000,0.671416,0.278196,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059812,1.728719,-0.078879,0.424610,-0.000010,0.905377,-0.902463,0.080150,0.423244,-1.000000,0.675416,0.314188,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066345,1.744608,-0.076991,0.315139,0.115110,0.942039,-0.948956,0.024606,0.314447,-1.000000,0.689265,0.279475,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067097,1.728719,-0.075927,0.309883,-0.000020,0.950775,-0.949204,0.057448,0.309372,-1.000000,0.693609,0.315337,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.059382,1.712211,-0.079952,0.426068,-0.104878,0.898592,-0.895024,0.095951,0.435575,-1.000000,0.676505,0.352013,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066345,1.712349,-0.076991,0.316670,-0.108349,0.942327,-0.941417,0.085583,0.326205,-1.000000,0.693394,0.352994,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058093,1.701172,-0.083170,0.420559,-0.252438,0.871439,-0.885186,0.096446,0.455132,-1.000000,0.673334,0.379268,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064089,1.701722,-0.080185,0.336385,-0.262030,0.904536,-0.926049,0.082485,0.368280,-1.000000,0.687158,0.378377,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056805,1.694943,-0.086610,0.384488,-0.411060,0.826558,-0.879097,0.110197,0.463730,-1.000000,0.670895,0.397818,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061198,1.697129,-0.083573,0.324845,-0.433722,0.840452,-0.931849,0.005115,0.362811,-1.000000,0.679094,0.390536,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.064089,1.753791,-0.080185,0.330197,0.304417,0.893476,-0.938259,0.002411,0.345925,-1.000000,0.680524,0.258166,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.058093,1.754341,-0.083170,0.413164,0.294737,0.861642,-0.908766,0.072499,0.410961,-1.000000,0.664489,0.255664,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061198,1.757315,-0.083573,0.291567,0.540432,0.789254,-0.941058,0.014164,0.337947,-1.000000,0.670587,0.248248,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056805,1.759126,-0.086610,0.356038,0.505061,0.786225,-0.920569,0.044981,0.387980,-1.000000,0.657568,0.242776,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066088,1.701906,-0.079909,-0.843866,-0.411526,0.344293,-0.495077,0.844577,-0.203934,-1.000000,0.691278,0.378750,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061941,1.695860,-0.084100,-0.620499,-0.749935,0.229299,-0.719844,0.660689,0.212872,-1.000000,0.679873,0.394250,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056375,1.692867,-0.088349,-0.059016,-0.924456,0.376693,-0.672027,0.315828,0.669800,-1.000000,0.670391,0.405637,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061941,1.758209,-0.084100,-0.540130,0.820181,0.188580,-0.788542,-0.571511,0.227104,-1.000000,0.671582,0.245489,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056375,1.760721,-0.088349,-0.071406,0.950491,0.302437,-0.938100,-0.167024,0.303433,-1.000000,0.654560,0.237546,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045406,1.761821,-0.093960,0.101164,0.932214,0.347482,-0.939668,-0.025193,0.341158,-1.000000,0.623712,0.233059,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.762188,-0.102237,0.091299,0.929622,0.357026,-0.967287,-0.002425,0.253672,-1.000000,0.567044,0.230426,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.762188,-0.107042,0.000000,0.933359,0.358945,-1.000000,0.000000,0.000000,-1.000000,0.500207,0.229756,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.762188,-0.102237,-0.091299,0.929622,0.357026,-0.966847,0.003108,-0.255337,-1.000000,0.433381,0.230305,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.760409,-0.101184,-0.276870,0.361078,0.890486,-0.957513,-0.025841,-0.287231,-1.000000,0.432402,0.235058,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.755074,-0.099403,-0.324752,0.207557,0.922744,-0.945371,-0.041868,-0.323298,-1.000000,0.430704,0.247716,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045513,1.760089,-0.092415,-0.364382,0.449494,0.815586,-0.921108,-0.045062,-0.386691,-1.000000,0.374602,0.238106,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045835,1.754891,-0.089398,-0.423304,0.271481,0.864356,-0.904225,-0.067114,-0.421750,-1.000000,0.370070,0.251631,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.744928,-0.097794,-0.359445,0.077683,0.929927,-0.932909,-0.053292,-0.356146,-1.000000,0.428908,0.270585,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046158,1.744883,-0.086582,-0.456338,0.102963,0.883829,-0.889504,-0.078667,-0.450104,-1.000000,0.365354,0.274845,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.728719,-0.097257,-0.405281,-0.142082,0.903084,-0.907729,-0.054714,-0.415974,-1.000000,0.426734,0.306339,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046265,1.728719,-0.085643,-0.496568,-0.054484,0.866286,-0.862783,-0.078259,-0.499481,-1.000000,0.361597,0.310845,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.712028,-0.104684,-0.417895,-0.237196,0.876984,-0.897143,-0.044379,-0.439504,-1.000000,0.432494,0.345122,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.700439,-0.106293,-0.441798,-0.165040,0.881803,-0.886986,-0.066930,-0.456921,-1.000000,0.430573,0.369637,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.046158,1.712074,-0.086582,-0.538821,-0.154450,0.828141,-0.827748,-0.085606,-0.554531,-1.000000,0.358146,0.347992,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045835,1.700622,-0.089398,-0.562171,-0.207269,0.800627,-0.798237,-0.117191,-0.590833,-1.000000,0.358113,0.374307,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.693660,-0.108074,-0.398892,-0.277075,0.874136,-0.895303,-0.088450,-0.436587,-1.000000,0.430489,0.383786,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045513,1.693981,-0.092415,-0.534027,-0.328561,0.779014,-0.774843,-0.178467,-0.606438,-1.000000,0.360617,0.389398,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059382,1.712211,-0.079952,-0.426068,-0.104878,0.898592,-0.895613,-0.091464,-0.435330,-1.000000,0.323483,0.351694,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058093,1.701172,-0.083170,-0.420559,-0.252438,0.871439,-0.886102,-0.091964,-0.454275,-1.000000,0.326559,0.379036,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066345,1.712349,-0.076991,-0.316670,-0.108349,0.942327,-0.941974,-0.080734,-0.325834,-1.000000,0.306587,0.352590,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064089,1.701722,-0.080185,-0.336385,-0.262030,0.904536,-0.926947,-0.077362,-0.367130,-1.000000,0.312728,0.378052,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056805,1.694943,-0.086610,-0.384488,-0.411060,0.826558,-0.880278,-0.106377,-0.462380,-1.000000,0.328949,0.397685,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061198,1.697129,-0.083573,-0.324846,-0.433723,0.840452,-0.932864,0.000000,-0.360229,-1.000000,0.320749,0.390288,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059812,1.728719,-0.078879,-0.424610,-0.000010,0.905377,-0.902775,-0.075746,-0.423390,-1.000000,0.324714,0.313808,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.059382,1.744745,-0.079952,-0.425213,0.111871,0.898153,-0.904965,-0.069246,-0.419813,-1.000000,0.328855,0.277794,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066345,1.744608,-0.076991,-0.315139,0.115110,0.942039,-0.948887,-0.020085,-0.314976,-1.000000,0.311005,0.278996,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067097,1.728719,-0.075927,-0.309883,-0.000019,0.950775,-0.949454,-0.052678,-0.309453,-1.000000,0.306518,0.314875,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.058093,1.754341,-0.083170,-0.413164,0.294737,0.861642,-0.908524,-0.068695,-0.412146,-1.000000,0.335874,0.255272,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056805,1.759126,-0.086610,-0.356038,0.505061,0.786225,-0.919966,-0.041775,-0.389767,-1.000000,0.342847,0.242404,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061198,1.757315,-0.083573,-0.291567,0.540432,0.789254,-0.940363,-0.010791,-0.340001,-1.000000,0.329810,0.247828,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064089,1.753791,-0.080185,-0.330197,0.304417,0.893477,-0.937820,0.001564,-0.347117,-1.000000,0.319833,0.257710,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069525,1.728719,-0.075747,0.912467,-0.000054,0.409151,-0.405213,-0.138534,0.903665,-1.000000,0.301128,0.315135,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068666,1.744562,-0.076788,0.900987,0.165401,0.401079,-0.429314,0.473176,0.769281,-1.000000,0.305765,0.278978,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056375,1.692867,-0.088349,0.059016,-0.924456,0.376693,-0.672644,-0.315649,-0.669265,-1.000000,0.329428,0.405552,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045406,1.691767,-0.093960,-0.271585,-0.847055,0.456879,-0.726337,-0.131051,-0.674729,-1.000000,0.362462,0.394413,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061941,1.695860,-0.084100,0.620499,-0.749935,0.229299,0.029543,-0.269834,-0.962454,-1.000000,0.298823,0.425765,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066088,1.701906,-0.079909,0.843866,-0.411526,0.344292,0.246716,-0.272210,-0.930072,-1.000000,0.275095,0.446038,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068666,1.712395,-0.076788,0.902524,-0.157273,0.400894,0.373762,-0.176316,-0.910612,-1.000000,0.254843,0.478500,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.069525,1.728719,-0.075747,0.912467,-0.000054,0.409151,0.408514,-0.055636,-0.911055,-1.000000,0.244107,0.530991,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068666,1.744562,-0.076788,0.900987,0.165401,0.401079,0.396712,0.060127,-0.915972,-1.000000,0.247565,0.581900,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.691400,-0.109127,-0.154706,-0.900763,0.405824,-0.885286,-0.055949,-0.461669,-1.000000,0.431050,0.388685,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.691400,-0.113932,0.000000,-0.896736,0.442566,-1.000000,0.000000,0.000000,-1.000000,0.499962,0.385225,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.691400,-0.109127,0.154706,-0.900762,0.405824,-0.885093,0.056139,0.462017,-1.000000,0.568857,0.388714,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045406,1.691767,-0.093960,0.271586,-0.847055,0.456879,-0.725687,0.131581,0.675326,-1.000000,0.637422,0.394468,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061941,1.695860,-0.084100,-0.620499,-0.749935,0.229299,0.026260,0.272362,0.961837,-1.000000,0.700975,0.425692,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066088,1.701906,-0.079909,-0.843866,-0.411526,0.344293,0.244865,0.275584,0.929567,-1.000000,0.724732,0.445861,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068666,1.712395,-0.076788,-0.902524,-0.157273,0.400894,0.373075,0.179426,0.910286,-1.000000,0.745050,0.478240,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069525,1.728719,-0.075747,-0.912467,-0.000054,0.409151,0.408445,0.058573,0.910901,-1.000000,0.755893,0.530665,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068666,1.744562,-0.076788,-0.900987,0.165401,0.401079,0.397201,-0.057375,0.915936,-1.000000,0.752548,0.581556,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066088,1.753607,-0.079909,-0.820281,0.463830,0.334665,0.292755,-0.162182,0.942333,-1.000000,0.739056,0.610286,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.061941,1.758209,-0.084100,-0.540130,0.820181,0.188580,0.082731,-0.171246,0.981749,-1.000000,0.721718,0.628634,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.056375,1.760721,-0.088349,-0.071406,0.950491,0.302437,-0.124788,-0.309342,0.942728,-1.000000,0.701284,0.646594,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045406,1.761821,-0.093960,0.101164,0.932214,0.347482,-0.480024,-0.260190,0.837782,-1.000000,0.664045,0.674740,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.025050,1.762188,-0.102237,0.091299,0.929622,0.357026,-0.837128,-0.122528,0.533108,-1.000000,0.589489,0.703424,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.762188,-0.107042,0.000000,0.933359,0.358945,-1.000000,0.000000,0.000000,-1.000000,0.500163,0.711206,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.025050,1.762188,-0.102237,-0.091299,0.929622,0.357026,-0.837999,0.121965,-0.531866,-1.000000,0.410838,0.703539,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045406,1.761821,-0.093960,-0.101164,0.932214,0.347482,-0.481423,0.259786,-0.837104,-1.000000,0.336231,0.674948,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056375,1.760721,-0.088349,0.071406,0.950491,0.302437,-0.126514,0.309393,-0.942481,-1.000000,0.298948,0.646847,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061941,1.758209,-0.084100,0.540130,0.820181,0.188580,0.080997,0.172376,-0.981695,-1.000000,0.278491,0.628918,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066088,1.753607,-0.079909,0.820281,0.463830,0.334666,0.291581,0.164263,-0.942337,-1.000000,0.261119,0.610603,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051205,1.760089,-0.144245,-0.134512,0.131540,-0.982142,-0.965124,0.207256,0.159939,-1.000000,0.585842,0.595370,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028302,1.760409,-0.146909,-0.081474,0.125480,-0.988745,-0.988679,0.115237,0.096093,-1.000000,0.548671,0.604061,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028204,1.762188,-0.146235,-0.040612,0.909814,-0.413025,-0.984263,0.034721,0.173265,-1.000000,0.549303,0.607866,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050926,1.761821,-0.143543,-0.088751,0.923579,-0.372996,-0.943885,0.041618,0.327640,-1.000000,0.586665,0.598745,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.762188,-0.147777,0.000000,0.899425,-0.437074,-1.000000,0.000000,0.000000,-1.000000,0.500057,0.610983,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.760409,-0.148418,0.000000,0.121555,-0.992585,-1.000000,0.000000,0.000000,-1.000000,0.500053,0.607056,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063309,1.759126,-0.142289,-0.203981,0.138934,-0.969066,-0.955473,0.187341,0.227979,-1.000000,0.603665,0.588529,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062684,1.760721,-0.141631,-0.234498,0.928668,-0.287378,-0.847905,-0.050805,0.527708,-1.000000,0.603956,0.591517,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067652,1.757315,-0.141041,-0.361367,0.201059,-0.910488,-0.915670,0.107754,0.387219,-1.000000,0.610029,0.584543,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068250,1.758209,-0.140292,-0.596804,0.798908,-0.074636,-0.573461,-0.359624,0.736080,-1.000000,0.611700,0.585944,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070594,1.753791,-0.140557,-0.344227,0.061032,-0.936901,-0.937396,0.033875,0.346615,-1.000000,0.613938,0.578618,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072397,1.753607,-0.139322,-0.898188,0.410677,-0.156850,-0.311208,-0.341995,0.886673,-1.000000,0.617621,0.578417,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072849,1.744608,-0.140025,-0.338251,0.014723,-0.940941,-0.941016,0.003888,0.338339,-1.000000,0.617591,0.564387,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074975,1.744562,-0.138731,-0.968911,0.124433,-0.213842,-0.234144,-0.181947,0.955025,-1.000000,0.622009,0.564438,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.073601,1.728719,-0.139848,-0.334110,0.000001,-0.942534,-0.941920,0.036101,0.333893,-1.000000,0.618898,0.538931,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.075834,1.728719,-0.138534,-0.972975,-0.000003,-0.230911,-0.230692,0.043498,0.972054,-1.000000,0.623640,0.538791,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072849,1.712349,-0.140025,-0.338418,-0.013589,-0.940898,-0.938401,0.079076,0.336378,-1.000000,0.615538,0.512728,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.074975,1.712395,-0.138731,-0.970052,-0.115809,-0.213514,-0.237169,0.261781,0.935533,-1.000000,0.619941,0.512372,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.070594,1.701722,-0.140557,-0.345727,-0.051190,-0.936938,-0.937403,0.063342,0.342438,-1.000000,0.610309,0.496517,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.072397,1.701906,-0.139322,-0.923311,-0.350796,-0.156326,-0.302366,0.413011,0.859068,-1.000000,0.614026,0.496384,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.067652,1.697129,-0.141041,-0.363786,-0.152826,-0.918860,-0.928591,-0.018171,0.370660,-1.000000,0.605599,0.489461,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068250,1.695860,-0.140292,-0.683189,-0.724274,-0.093163,-0.554309,0.431302,0.711843,-1.000000,0.607029,0.487401,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.063309,1.694943,-0.142289,-0.203199,-0.110767,-0.972852,-0.969036,-0.119605,0.216020,-1.000000,0.598946,0.485530,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.062684,1.692867,-0.141631,-0.263594,-0.895531,-0.358528,-0.873857,0.064279,0.481915,-1.000000,0.599017,0.481894,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.051205,1.693981,-0.144245,-0.134114,-0.103471,-0.985549,-0.974290,-0.167915,0.150211,-1.000000,0.581233,0.479772,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.050926,1.691767,-0.143543,-0.098221,-0.883779,-0.457479,-0.957142,-0.041961,0.286562,-1.000000,0.581924,0.475620,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028302,1.693660,-0.146909,-0.081588,-0.099043,-0.991733,-0.991474,-0.093373,0.090891,-1.000000,0.545560,0.472598,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.028204,1.691400,-0.146235,-0.047360,-0.865218,-0.499154,-0.986739,-0.037145,0.158008,-1.000000,0.546081,0.467912,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,1.693660,-0.148418,0.000000,-0.096106,-0.995371,-1.000000,0.000000,0.000000,-1.000000,0.499942,0.470107,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.000000,1.691400,-0.147777,0.000000,-0.851474,-0.524398,-1.000000,0.000000,0.000000,-1.000000,0.499941,0.465288,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028204,1.691400,-0.146235,0.047360,-0.865218,-0.499154,-0.986748,0.037115,-0.157957,-1.000000,0.453807,0.467913,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028302,1.693660,-0.146909,0.081588,-0.099043,-0.991733,-0.991483,0.093287,-0.090883,-1.000000,0.454326,0.472601,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050926,1.691767,-0.143543,0.098221,-0.883779,-0.457479,-0.957029,0.042155,-0.286912,-1.000000,0.417968,0.475614,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051205,1.693981,-0.144245,0.134114,-0.103471,-0.985549,-0.974212,0.168338,-0.150244,-1.000000,0.418683,0.479765,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062684,1.692867,-0.141631,0.263594,-0.895531,-0.358528,-0.873020,-0.063378,-0.483548,-1.000000,0.400892,0.481913,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063309,1.694943,-0.142289,0.203199,-0.110767,-0.972852,-0.968779,0.121399,-0.216171,-1.000000,0.400972,0.485546,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068250,1.695860,-0.140292,0.683190,-0.724274,-0.093162,-0.553596,-0.430496,-0.712884,-1.000000,0.392882,0.487438,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067652,1.697129,-0.141041,0.363786,-0.152826,-0.918860,-0.928437,0.020212,-0.370939,-1.000000,0.394317,0.489494,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072397,1.701906,-0.139322,0.923311,-0.350796,-0.156326,-0.301973,-0.411616,-0.859875,-1.000000,0.385894,0.496422,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070594,1.701722,-0.140557,0.345727,-0.051190,-0.936938,-0.937458,-0.062007,-0.342531,-1.000000,0.389614,0.496550,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074975,1.712395,-0.138731,0.970051,-0.115809,-0.213515,-0.237058,-0.259753,-0.936126,-1.000000,0.380004,0.512414,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072849,1.712349,-0.140025,0.338418,-0.013589,-0.940898,-0.938453,-0.078334,-0.336407,-1.000000,0.384408,0.512768,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.075834,1.728719,-0.138534,0.972975,-0.000003,-0.230911,-0.230715,-0.041237,-0.972147,-1.000000,0.376343,0.538845,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.073601,1.728719,-0.139848,0.334110,0.000001,-0.942534,-0.941937,-0.035596,-0.333899,-1.000000,0.381084,0.538984,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.074975,1.744562,-0.138731,0.968911,0.124433,-0.213842,-0.234455,0.185767,-0.954212,-1.000000,0.378014,0.564520,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072849,1.744608,-0.140025,0.338251,0.014723,-0.940941,-0.941034,-0.001520,-0.338308,-1.000000,0.382427,0.564455,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072397,1.753607,-0.139322,0.898188,0.410677,-0.156850,-0.312141,0.344536,-0.885360,-1.000000,0.382422,0.578502,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070594,1.753791,-0.140557,0.344227,0.061032,-0.936901,-0.937515,-0.031569,-0.346509,-1.000000,0.386104,0.578694,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068250,1.758209,-0.140292,0.596805,0.798908,-0.074635,-0.574815,0.360788,-0.734452,-1.000000,0.388359,0.586023,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067652,1.757315,-0.141041,0.361368,0.201060,-0.910488,-0.916085,-0.105442,-0.386873,-1.000000,0.390024,0.584616,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.062684,1.760721,-0.141631,0.234499,0.928668,-0.287378,-0.848617,0.051355,-0.526509,-1.000000,0.396114,0.591584,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063309,1.759126,-0.142289,0.203981,0.138935,-0.969066,-0.955790,-0.185891,-0.227838,-1.000000,0.396391,0.588591,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.050926,1.761821,-0.143543,0.088751,0.923579,-0.372995,-0.944031,-0.041443,-0.327242,-1.000000,0.413415,0.598804,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051205,1.760088,-0.144245,0.134512,0.131540,-0.982142,-0.965225,-0.206820,-0.159895,-1.000000,0.414227,0.595427,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028204,1.762188,-0.146235,0.040612,0.909814,-0.413024,-0.984339,-0.034538,-0.172869,-1.000000,0.450794,0.607908,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028302,1.760409,-0.146909,0.081474,0.125480,-0.988745,-0.988749,-0.114689,-0.096029,-1.000000,0.451420,0.604103,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068666,1.712395,-0.076788,-0.902524,-0.157273,0.400894,-0.403571,0.633732,-0.659935,-1.000000,0.698420,0.353515,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.069525,1.728719,-0.075747,-0.912467,-0.000054,0.409151,-0.404409,0.151922,-0.901872,-1.000000,0.698997,0.315624,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.068666,1.744562,-0.076788,-0.900987,0.165401,0.401079,-0.429987,-0.463450,-0.774806,-1.000000,0.694506,0.279481,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.066088,1.753607,-0.079909,-0.820281,0.463830,0.334665,-0.547218,-0.806665,-0.223260,-1.000000,0.685169,0.258106,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051205,1.693981,-0.144245,0.134114,-0.103471,-0.985549,-0.974212,0.168338,-0.150244,-1.000000,0.418683,0.479765,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051584,1.700622,-0.144410,0.134007,-0.009540,-0.990935,-0.982313,0.130683,-0.134099,-1.000000,0.419906,0.491531,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028334,1.700439,-0.147133,0.081730,-0.011454,-0.996589,-0.993576,0.077596,-0.082375,-1.000000,0.455607,0.485876,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028302,1.693660,-0.146909,0.081588,-0.099043,-0.991733,-0.991483,0.093287,-0.090883,-1.000000,0.454326,0.472601,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028334,1.712028,-0.147133,0.082376,0.000413,-0.996601,-0.995419,0.048724,-0.082258,-1.000000,0.456868,0.508702,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051906,1.712074,-0.144333,0.136620,0.001538,-0.990622,-0.989147,0.054794,-0.136332,-1.000000,0.420163,0.511701,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.052013,1.728719,-0.144308,0.137647,0.000000,-0.990481,-0.989856,-0.035540,-0.137560,-1.000000,0.419032,0.540433,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028334,1.728719,-0.147133,0.082672,0.000000,-0.996577,-0.996478,-0.014083,-0.082664,-1.000000,0.457125,0.541621,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051906,1.744883,-0.144333,0.136667,-0.001652,-0.990616,-0.983491,-0.119957,-0.135484,-1.000000,0.417927,0.568530,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028334,1.744928,-0.147133,0.082387,-0.000443,-0.996600,-0.993597,-0.077610,-0.082104,-1.000000,0.455254,0.573657,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028334,1.755074,-0.147133,0.081729,0.013595,-0.996562,-0.990916,-0.106040,-0.082712,-1.000000,0.453022,0.593705,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051584,1.754891,-0.144410,0.134045,0.011314,-0.990911,-0.973968,-0.182953,-0.133842,-1.000000,0.415955,0.586247,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.028302,1.760409,-0.146909,0.081474,0.125480,-0.988745,-0.988749,-0.114689,-0.096029,-1.000000,0.451420,0.604103,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.051205,1.760088,-0.144245,0.134512,0.131540,-0.982142,-0.965225,-0.206820,-0.159895,-1.000000,0.414227,0.595427,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065952,1.744745,-0.141928,0.201609,-0.000489,-0.979466,-0.976182,-0.081928,-0.200892,-1.000000,0.394639,0.565132,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064663,1.754341,-0.142236,0.196835,0.013421,-0.980345,-0.968278,-0.154320,-0.196525,-1.000000,0.395832,0.580621,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072849,1.744608,-0.140025,0.338251,0.014723,-0.940941,-0.941034,-0.001520,-0.338308,-1.000000,0.382427,0.564455,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070594,1.753791,-0.140557,0.344227,0.061032,-0.936901,-0.937515,-0.031569,-0.346509,-1.000000,0.386104,0.578694,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063309,1.759126,-0.142289,0.203981,0.138935,-0.969066,-0.955790,-0.185891,-0.227838,-1.000000,0.396391,0.588591,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067652,1.757315,-0.141041,0.361368,0.201060,-0.910488,-0.916085,-0.105442,-0.386873,-1.000000,0.390024,0.584616,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066382,1.728719,-0.141826,0.202470,0.000000,-0.979289,-0.978475,-0.040741,-0.202302,-1.000000,0.394215,0.539431,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065952,1.712211,-0.141928,0.201555,0.000480,-0.979477,-0.979461,-0.005672,-0.201555,-1.000000,0.396656,0.513064,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.072849,1.712349,-0.140025,0.338418,-0.013589,-0.940898,-0.938453,-0.078334,-0.336407,-1.000000,0.384408,0.512768,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.070594,1.701722,-0.140557,0.345727,-0.051190,-0.936938,-0.937458,-0.062007,-0.342531,-1.000000,0.389614,0.496550,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.064663,1.701172,-0.142236,0.196850,-0.011367,-0.980368,-0.977933,0.069094,-0.197163,-1.000000,0.399579,0.495600,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.067652,1.697129,-0.141041,0.363786,-0.152826,-0.918860,-0.928437,0.020212,-0.370939,-1.000000,0.394317,0.489494,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.063309,1.694943,-0.142289,0.203199,-0.110767,-0.972852,-0.968779,0.121399,-0.216171,-1.000000,0.400972,0.485546,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.073601,1.728719,-0.139848,0.334110,0.000001,-0.942534,-0.941937,-0.035596,-0.333899,-1.000000,0.381084,0.538984,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.068666,1.712395,-0.076788,0.902524,-0.157273,0.400894,-0.405067,-0.626057,0.666313,-1.000000,0.301558,0.353085,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066088,1.701906,-0.079909,0.843866,-0.411526,0.344292,-0.496314,-0.842498,0.209452,-1.000000,0.308603,0.378398,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061941,1.695860,-0.084100,0.620499,-0.749935,0.229299,-0.721456,-0.660508,-0.207918,-1.000000,0.319950,0.394000,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.045406,1.761821,-0.093960,-0.101164,0.932214,0.347482,-0.938820,0.026127,-0.343415,-1.000000,0.376726,0.232795,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.056375,1.760721,-0.088349,0.071406,0.950491,0.302437,-0.937074,0.167814,-0.306156,-1.000000,0.345874,0.237183,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.061941,1.758209,-0.084100,0.540130,0.820181,0.188580,-0.787641,0.571588,-0.230019,-1.000000,0.328827,0.245064,0,0,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.066088,1.753607,-0.079909,0.820281,0.463830,0.334666,-0.546389,0.808466,0.218730,-1.000000,0.315190,0.257630,0,0,0,0,1.000000,0.000000,0.000000,0.000000}};
-
-const uint32_t unAvatarIndexCount_399 = 1920;
-const uint32_t aunAvatarVertices_399[] = {
-2,1,0,3,2,0,4,2,3,5,4,3,4,6,2,6,
-7,2,2,7,1,7,8,1,6,4,9,10,6,9,10,9,
-11,11,9,12,13,11,12,14,13,12,15,13,14,16,15,14,
-15,17,13,17,18,13,13,18,11,18,19,11,19,10,11,9,
-20,12,4,5,20,9,4,20,16,14,21,22,16,21,22,21,
-23,23,21,24,21,25,24,14,12,25,21,14,25,26,22,23,
-24,25,27,25,28,27,27,28,29,28,30,29,28,20,30,29,
-30,31,30,32,31,31,32,33,32,34,33,30,5,32,5,3,
-32,32,3,34,3,0,34,25,12,28,12,20,28,20,5,30,
-37,36,35,38,37,35,39,37,38,40,39,38,39,41,37,41,
-42,37,37,42,36,42,43,36,40,38,44,45,40,44,45,44,
-46,46,44,47,47,48,46,48,49,46,46,49,50,50,45,46,
-49,51,50,48,52,49,52,53,49,49,53,51,53,54,51,54,
-53,55,53,56,55,53,52,56,55,56,57,56,58,57,57,58,
-59,58,60,59,59,60,61,60,62,61,58,63,60,63,64,60,
-60,64,62,64,65,62,52,66,56,66,63,58,56,66,58,62,
-67,61,67,68,61,69,67,62,65,69,62,69,70,67,70,71,
-67,67,71,68,70,72,71,72,73,71,71,73,74,71,74,68,
-73,75,74,72,76,73,76,77,73,73,77,75,77,78,75,79,
-64,63,80,65,64,81,80,79,82,81,79,83,81,82,83,84,
-81,84,85,81,81,85,80,84,86,85,86,87,85,86,88,87,
-88,89,87,88,90,89,90,91,89,92,83,82,92,82,93,94,
-92,93,94,93,95,96,94,95,96,95,97,98,96,97,98,97,
-99,100,98,99,100,99,101,102,100,101,101,103,102,103,104,102,
-103,105,104,105,106,104,105,107,106,107,108,106,107,109,108,109,
-110,108,111,107,105,112,111,105,112,105,103,36,111,112,35,36,
-112,36,43,111,43,113,111,113,109,107,111,113,107,114,103,101,
-35,112,114,114,112,103,115,35,114,38,35,115,44,38,115,44,
-115,47,115,114,116,47,115,116,116,114,101,116,117,47,117,48,
-47,99,117,116,101,99,116,99,97,117,97,118,117,117,118,48,
-118,52,48,118,119,52,119,66,52,95,119,118,97,95,118,95,
-93,119,93,120,119,119,120,66,93,82,120,82,79,120,120,79,
-63,120,63,66,79,80,64,80,121,65,121,69,65,85,121,80,
-85,87,121,87,122,121,121,122,69,122,70,69,122,123,70,123,
-72,70,89,123,122,87,89,122,89,91,123,91,124,123,123,124,
-72,124,76,72,76,124,125,76,125,126,77,76,126,77,126,127,
-127,126,128,126,129,128,126,125,129,78,77,127,125,130,129,128,
-129,131,129,132,131,129,130,132,131,132,133,132,134,133,134,135,
-133,135,136,133,137,135,134,138,137,134,137,139,135,139,140,135,
-135,140,136,140,141,136,140,142,141,142,143,141,144,142,140,139,
-144,140,144,145,142,145,146,142,142,146,143,146,145,147,146,147,
-148,148,147,149,147,150,149,151,146,148,146,151,143,145,152,147,
-147,152,150,152,153,150,154,150,153,155,154,153,156,154,155,157,
-156,155,158,156,157,159,158,157,42,158,159,43,42,159,42,41,
-158,41,160,158,158,160,156,160,161,156,156,161,154,161,162,154,
-154,162,150,162,149,150,43,159,163,113,43,163,113,163,164,164,
-163,165,164,165,166,167,164,166,109,164,167,109,113,164,110,109,
-167,166,165,168,165,169,168,168,169,170,169,171,170,172,170,171,
-173,172,171,174,172,173,175,174,173,176,174,175,177,176,175,178,
-176,177,179,178,177,180,178,179,181,180,179,182,180,181,183,182,
-181,184,182,183,185,184,183,186,184,185,187,186,185,188,186,187,
-189,188,187,90,188,189,91,90,189,183,181,190,191,183,190,185,
-183,191,191,190,137,137,190,139,190,192,139,190,181,192,138,191,
-137,193,191,138,187,185,193,193,185,191,194,193,138,194,138,134,
-132,194,134,130,194,132,195,193,194,130,195,194,195,187,193,189,
-187,195,196,195,130,125,196,130,124,196,125,124,91,196,91,189,
-196,196,189,195,139,192,144,192,197,144,144,197,145,197,198,145,
-145,198,152,198,199,152,152,199,153,199,200,153,155,153,200,201,
-155,200,201,200,171,169,201,171,202,201,169,165,202,169,163,202,
-165,163,159,202,159,157,202,157,155,201,202,157,201,198,175,199,
-175,173,199,173,171,200,199,173,200,177,175,198,179,177,197,192,
-179,197,181,179,192,197,177,198,205,204,203,206,205,203,207,205,
-206,208,207,206,207,209,205,209,210,205,205,210,204,210,211,204,
-203,204,212,204,213,212,204,211,213,212,213,214,213,215,214,214,
-215,216,215,217,216,216,217,218,217,219,218,215,220,217,220,221,
-217,217,221,219,221,222,219,211,223,213,223,220,215,213,223,215,
-212,214,224,225,212,224,225,224,226,227,225,226,228,225,227,229,
-228,227,230,228,229,231,230,229,232,230,231,233,232,231,232,208,
-230,208,206,230,230,206,228,206,203,228,228,203,225,203,212,225,
-226,224,234,224,235,234,234,235,236,235,237,236,235,216,237,214,
-216,235,224,214,235,216,218,237,231,238,233,238,239,233,240,232,
-233,239,240,233,236,237,241,236,241,234,237,242,241,237,218,242,
-218,243,242,218,219,243,219,244,243,219,222,244,222,245,244,245,
-222,246,222,247,246,222,221,247,221,248,247,247,248,249,248,250,
-249,221,220,248,220,251,248,248,251,250,251,252,250,251,253,252,
-253,254,252,223,253,251,220,223,251,223,211,253,211,255,253,253,
-255,254,211,210,255,210,256,255,255,256,257,255,257,254,256,258,
-257,210,209,256,209,259,256,256,259,258,259,260,258,257,258,261,
-258,262,261,258,260,262,261,262,263,262,264,263,260,265,262,262,
-265,264,265,266,264,257,261,267,254,257,267,254,267,268,268,267,
-269,267,270,269,261,263,270,267,261,270,252,254,268,252,268,271,
-250,252,271,250,271,272,272,271,273,271,274,273,268,269,274,271,
-268,274,249,250,272,275,270,263,276,269,270,275,276,270,265,277,
-266,278,277,265,260,278,265,278,128,277,128,131,277,277,131,279,
-131,133,279,133,136,279,136,280,279,136,141,280,141,281,280,141,
-143,281,143,282,281,143,151,282,151,283,282,284,278,260,259,284,
-260,285,284,259,209,285,259,285,209,207,286,285,207,286,207,208,
-287,286,208,287,208,232,240,287,232,74,287,240,68,74,240,68,
-240,288,61,68,288,59,61,288,289,59,288,57,59,289,290,57,
-289,55,57,290,291,55,290,54,55,291,292,54,291,74,75,287,
-75,286,287,75,78,286,78,285,286,51,54,292,293,51,292,50,
-51,293,294,50,293,294,295,50,295,45,50,295,296,45,296,40,
-45,296,297,40,297,39,40,297,298,39,298,41,39,285,78,284,
-78,127,284,284,127,278,127,128,278,41,298,160,298,299,160,160,
-299,161,299,300,161,161,300,162,300,301,162,162,301,149,301,302,
-149,149,302,303,148,149,303,148,303,283,151,148,283,306,305,304,
-307,306,304,306,308,305,308,309,305,307,304,310,311,307,310,311,
-310,312,313,311,312,312,314,313,314,315,313,314,316,315,316,317,
-315,316,318,317,318,319,317,318,320,319,320,321,319,320,322,321,
-322,323,321,322,324,323,324,325,323,324,326,325,326,327,325,326,
-328,327,328,329,327,328,330,329,330,331,329,330,332,331,332,333,
-331,333,332,334,332,335,334,334,335,336,335,337,336,336,337,338,
-337,339,338,338,339,340,339,341,340,340,341,342,341,343,342,342,
-343,344,343,345,344,344,345,346,345,347,346,346,347,348,347,349,
-348,348,349,350,349,351,350,350,351,352,351,353,352,354,352,353,
-355,354,353,356,354,355,357,356,355,358,356,357,359,358,357,359,
-309,358,309,308,358,361,360,229,227,361,229,362,361,227,226,362,
-227,229,360,231,360,238,231,363,362,226,234,363,226,241,363,234,
-366,365,364,367,366,364,7,366,367,8,7,367,7,6,366,6,
-368,366,366,368,365,368,369,365,369,368,370,368,371,370,368,6,
-371,370,371,372,371,373,372,373,374,372,374,375,372,18,374,373,
-19,18,373,18,17,374,17,376,374,374,376,375,376,377,375,6,
-10,371,10,19,373,371,10,373,372,375,378,375,379,378,375,377,
-379,378,379,380,379,381,380,377,382,379,379,382,381,382,383,381,
-372,378,384,370,372,384,370,384,385,385,384,386,385,386,387,388,
-385,387,388,387,389,390,388,389,365,388,390,364,365,390,369,385,
-388,365,369,388,369,370,385,384,391,386,384,378,391,378,380,391,
-392,275,263,392,263,264,393,392,264,393,264,266,394,393,266,277,
-394,266,247,249,395,246,247,395,395,249,396,249,272,396,396,272,
-397,272,273,397,397,273,274,398,397,274,398,274,269,276,398,269};
-
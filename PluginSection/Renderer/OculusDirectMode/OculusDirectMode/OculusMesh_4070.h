@@ -1,5803 +0,0 @@
-/********************************************************************
-Vireio Perception: Open-Source Stereoscopic 3D Driver
-Copyright (C) 2012 Andres Hernandez
-This file was exported from Vireio using Oculus Avatar SDK.
-Data Copyright : Copyright 2014-2016 Oculus VR, LLC All Rights reserved.
-
-Vireio Perception Version History :.
-v1.0.0 2012 by Andres Hernandez.
-v1.0.X 2013 by John Hicks, Neil Schneider.
-v1.1.x 2013 by Primary Coding Author : Chris Drain.
-Team Support : John Hicks, Phil Larkson, Neil Schneider.
-v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown.
-v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown, Samuel Austin.
-and Neil Schneider.
-
-This program is free software : you can redistribute it and / or modify.
-it under the terms of the GNU Lesser General Public License as published by.
-the Free Software Foundation, either version 3 of the License, or.
-(at your option) any later version..
-
-This program is distributed in the hope that it will be useful,.
-but WITHOUT ANY WARRANTY; without even the implied warranty of.
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the.
-GNU Lesser General Public License for more details..
-
-You should have received a copy of the GNU Lesser General Public License.
-along with this program.If not, see < http://www.gnu.org/licenses/>..
-********************************************************************/
-
-#pragma region poses
-const uint32_t unJointCount_4070 = 25;
-const D3DXMATRIX asBindPose_4070[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.965899f, 0.246384f, 0.079587f, 0.000000f, 0.150149f, -0.783433f, 0.603066f, 0.000000f, 0.210936f, -0.570551f, -0.793711f, 0.000000f, -0.022414f, -0.030771f, 0.035514f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168681f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.216737f, 0.024541f, 0.975922f, 0.000000f, 0.901744f, -0.377963f, 0.209768f, 0.000000f, 0.374010f, 0.925496f, 0.059788f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.531717f, 0.161164f, 0.831447f, 0.000000f, 0.759864f, -0.342760f, 0.552379f, 0.000000f, 0.374010f, 0.925496f, 0.059788f, 0.000000f, -0.032684f, -0.006868f, -0.023565f, 1.000000f },
-	{ -0.618349f, 0.200801f, 0.759819f, 0.000000f, 0.691203f, -0.321150f, 0.647381f, 0.000000f, 0.374010f, 0.925495f, 0.059788f, 0.000000f, -0.020904f, -0.010438f, -0.041985f, 1.000000f },
-	{ -0.618349f, 0.200801f, 0.759819f, 0.000000f, 0.691203f, -0.321150f, 0.647381f, 0.000000f, 0.374010f, 0.925495f, 0.059788f, 0.000000f, -0.002897f, -0.016286f, -0.064112f, 1.000000f },
-	{ -0.107415f, 0.151467f, 0.982609f, 0.000000f, 0.983464f, -0.128761f, 0.127357f, 0.000000f, 0.145812f, 0.980040f, -0.135131f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ -0.545823f, 0.193614f, 0.815224f, 0.000000f, 0.825116f, -0.045112f, 0.563160f, 0.000000f, 0.145812f, 0.980040f, -0.135131f, 0.000000f, -0.048465f, -0.036289f, -0.027493f, 1.000000f },
-	{ -0.649410f, 0.197861f, 0.734246f, 0.000000f, 0.746328f, -0.019306f, 0.665298f, 0.000000f, 0.145812f, 0.980040f, -0.135131f, 0.000000f, -0.032314f, -0.042018f, -0.051616f, 1.000000f },
-	{ -0.649410f, 0.197861f, 0.734246f, 0.000000f, 0.746328f, -0.019306f, 0.665298f, 0.000000f, 0.145812f, 0.980040f, -0.135131f, 0.000000f, -0.015124f, -0.047255f, -0.071051f, 1.000000f },
-	{ -0.070444f, -0.409608f, -0.909538f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.295081f, 0.879552f, -0.373250f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.165240f, 0.375969f, 0.911780f, 0.000000f, 0.945559f, 0.323216f, 0.038084f, 0.000000f, -0.280383f, 0.868435f, -0.408909f, 0.000000f, -0.043219f, -0.073264f, 0.033203f, 1.000000f },
-	{ -0.463288f, 0.250661f, 0.850020f, 0.000000f, 0.840684f, 0.427774f, 0.332054f, 0.000000f, -0.280383f, 0.868435f, -0.408909f, 0.000000f, -0.037708f, -0.085805f, 0.002790f, 1.000000f },
-	{ -0.540169f, 0.209393f, 0.815091f, 0.000000f, 0.793475f, 0.449418f, 0.410391f, 0.000000f, -0.280383f, 0.868435f, -0.408909f, 0.000000f, -0.029638f, -0.090171f, -0.012016f, 1.000000f },
-	{ -0.540169f, 0.209393f, 0.815091f, 0.000000f, 0.793475f, 0.449418f, 0.410391f, 0.000000f, -0.280383f, 0.868435f, -0.408909f, 0.000000f, -0.019136f, -0.094242f, -0.027863f, 1.000000f },
-	{ -0.108913f, 0.298522f, 0.948169f, 0.000000f, 0.992966f, 0.077226f, 0.089745f, 0.000000f, -0.046432f, 0.951273f, -0.304833f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ -0.494518f, 0.243254f, 0.834434f, 0.000000f, 0.867927f, 0.189490f, 0.459127f, 0.000000f, -0.046432f, 0.951274f, -0.304833f, 0.000000f, -0.047123f, -0.064040f, -0.012844f, 1.000000f },
-	{ -0.632748f, 0.208125f, 0.745865f, 0.000000f, 0.772964f, 0.227515f, 0.592253f, 0.000000f, -0.046432f, 0.951273f, -0.304833f, 0.000000f, -0.034377f, -0.070310f, -0.034351f, 1.000000f },
-	{ -0.632748f, 0.208125f, 0.745865f, 0.000000f, 0.772964f, 0.227515f, 0.592253f, 0.000000f, -0.046432f, 0.951273f, -0.304833f, 0.000000f, -0.019055f, -0.075350f, -0.052412f, 1.000000f },
-	{ -0.481274f, -0.152774f, 0.863155f, 0.000000f, -0.249293f, -0.920180f, -0.301866f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, -0.009764f, 0.002759f, 0.075239f, 1.000000f },
-	{ -0.391518f, 0.112725f, 0.913240f, 0.000000f, -0.374813f, -0.925939f, -0.046395f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.005920f, 0.007738f, 0.047110f, 1.000000f },
-	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840375f, -0.360458f, 0.404773f, 0.000000f, 0.016245f, 0.004765f, 0.023026f, 1.000000f },
-	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840375f, -0.360458f, 0.404773f, 0.000000f, 0.029808f, 0.001475f, -0.008064f, 1.000000f } };
-const D3DXMATRIX asPoseDefault[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.965899f, 0.246384f, 0.079587f, 0.000000f, 0.150149f, -0.783433f, 0.603066f, 0.000000f, 0.210936f, -0.570551f, -0.793711f, 0.000000f, -0.022414f, -0.030771f, 0.035514f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.216737f, 0.024541f, 0.975922f, 0.000000f, 0.901744f, -0.377963f, 0.209767f, 0.000000f, 0.374010f, 0.925496f, 0.059788f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.582121f, 0.179238f, 0.793102f, 0.000000f, 0.701820f, -0.381788f, 0.601405f, 0.000000f, 0.410591f, 0.906704f, 0.096454f, 0.000000f, -0.032684f, -0.006868f, -0.023565f, 1.000000f },
-	{ -0.661488f, 0.223389f, 0.715913f, 0.000000f, 0.627574f, -0.357751f, 0.691496f, 0.000000f, 0.410591f, 0.906704f, 0.096455f, 0.000000f, -0.019788f, -0.010838f, -0.041135f, 1.000000f },
-	{ -0.661488f, 0.223389f, 0.715913f, 0.000000f, 0.627574f, -0.357751f, 0.691496f, 0.000000f, 0.410591f, 0.906704f, 0.096455f, 0.000000f, -0.000524f, -0.017344f, -0.061984f, 1.000000f },
-	{ -0.248272f, 0.084264f, 0.965019f, 0.000000f, 0.960980f, -0.104018f, 0.256315f, 0.000000f, 0.121977f, 0.991000f, -0.055151f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ -0.801349f, 0.133336f, 0.583147f, 0.000000f, 0.585163f, -0.027658f, 0.810444f, 0.000000f, 0.124190f, 0.990685f, -0.055860f, 0.000000f, -0.041990f, -0.033199f, -0.026684f, 1.000000f },
-	{ -0.914386f, 0.135419f, 0.381523f, 0.000000f, 0.384478f, -0.004665f, 0.923123f, 0.000000f, 0.126788f, 0.990777f, -0.047800f, 0.000000f, -0.018278f, -0.037145f, -0.043940f, 1.000000f },
-	{ -0.914386f, 0.135419f, 0.381523f, 0.000000f, 0.384477f, -0.004665f, 0.923123f, 0.000000f, 0.126788f, 0.990777f, -0.047800f, 0.000000f, 0.005926f, -0.040729f, -0.054038f, 1.000000f },
-	{ -0.070221f, -0.409379f, -0.909658f, 0.000000f, -0.952892f, -0.242214f, 0.182564f, 0.000000f, -0.295070f, 0.879625f, -0.373086f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.487376f, 0.061230f, 0.871043f, 0.000000f, 0.786728f, 0.463586f, 0.407611f, 0.000000f, -0.378845f, 0.883934f, -0.274112f, 0.000000f, -0.043207f, -0.073252f, 0.033196f, 1.000000f },
-	{ -0.814140f, -0.179160f, 0.552338f, 0.000000f, 0.438863f, 0.433016f, 0.787335f, 0.000000f, -0.380230f, 0.883402f, -0.273909f, 0.000000f, -0.026950f, -0.075295f, 0.004142f, 1.000000f },
-	{ -0.918694f, -0.328664f, 0.219047f, 0.000000f, 0.103827f, 0.334131f, 0.936791f, 0.000000f, -0.381079f, 0.883367f, -0.272840f, 0.000000f, -0.012770f, -0.072174f, -0.005479f, 1.000000f },
-	{ -0.918694f, -0.328664f, 0.219047f, 0.000000f, 0.103827f, 0.334131f, 0.936791f, 0.000000f, -0.381079f, 0.883367f, -0.272840f, 0.000000f, 0.005091f, -0.065784f, -0.009738f, 1.000000f },
-	{ -0.284623f, 0.157698f, 0.945579f, 0.000000f, 0.953426f, 0.149289f, 0.262088f, 0.000000f, -0.099834f, 0.976137f, -0.192845f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ -0.852130f, 0.012657f, 0.523175f, 0.000000f, 0.513358f, 0.214429f, 0.830953f, 0.000000f, -0.101667f, 0.976657f, -0.189220f, 0.000000f, -0.040346f, -0.058609f, -0.012744f, 1.000000f },
-	{ -0.982254f, -0.066595f, 0.175331f, 0.000000f, 0.158820f, 0.201904f, 0.966442f, 0.000000f, -0.099761f, 0.977138f, -0.187745f, 0.000000f, -0.018382f, -0.058935f, -0.026229f, 1.000000f },
-	{ -0.982254f, -0.066595f, 0.175331f, 0.000000f, 0.158820f, 0.201904f, 0.966442f, 0.000000f, -0.099761f, 0.977138f, -0.187745f, 0.000000f, 0.005403f, -0.057322f, -0.030474f, 1.000000f },
-	{ -0.481274f, -0.152774f, 0.863155f, 0.000000f, -0.249293f, -0.920180f, -0.301866f, 0.000000f, 0.840375f, -0.360458f, 0.404773f, 0.000000f, -0.009764f, 0.002759f, 0.075239f, 1.000000f },
-	{ -0.391518f, 0.112725f, 0.913240f, 0.000000f, -0.374813f, -0.925939f, -0.046395f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.005920f, 0.007738f, 0.047110f, 1.000000f },
-	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.016245f, 0.004765f, 0.023026f, 1.000000f },
-	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.029808f, 0.001475f, -0.008064f, 1.000000f } };
-const D3DXMATRIX asPoseFist[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.873600f, 0.477917f, -0.091756f, 0.000000f, 0.456594f, -0.739721f, 0.494303f, 0.000000f, 0.168362f, -0.473718f, -0.864434f, 0.000000f, -0.017807f, -0.032510f, 0.034160f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.855185f, 0.342740f, 0.388829f, 0.000000f, 0.416634f, 0.008284f, 0.909037f, 0.000000f, 0.308342f, 0.939394f, -0.149881f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.163844f, -0.102724f, -0.981123f, 0.000000f, -0.937072f, 0.327034f, 0.122248f, 0.000000f, 0.308304f, 0.939413f, -0.149842f, 0.000000f, -0.006140f, -0.020097f, 0.000843f, 1.000000f },
-	{ 0.925781f, -0.332522f, -0.179884f, 0.000000f, -0.218811f, -0.083262f, -0.972208f, 0.000000f, 0.308304f, 0.939413f, -0.149842f, 0.000000f, -0.002511f, -0.017821f, 0.022578f, 1.000000f },
-	{ 0.925781f, -0.332522f, -0.179885f, 0.000000f, -0.218811f, -0.083262f, -0.972208f, 0.000000f, 0.308304f, 0.939413f, -0.149842f, 0.000000f, -0.029471f, -0.008137f, 0.027816f, 1.000000f },
-	{ -0.978051f, 0.158075f, 0.135755f, 0.000000f, 0.176508f, 0.282296f, 0.942950f, 0.000000f, 0.110734f, 0.946215f, -0.304001f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ 0.226701f, -0.321864f, -0.919245f, 0.000000f, -0.967650f, 0.032875f, -0.250149f, 0.000000f, 0.110734f, 0.946215f, -0.303998f, 0.000000f, -0.008444f, -0.036592f, 0.011435f, 1.000000f },
-	{ 0.951003f, -0.012031f, 0.308946f, 0.000000f, 0.288672f, -0.323322f, -0.901184f, 0.000000f, 0.110731f, 0.946213f, -0.304007f, 0.000000f, -0.015152f, -0.027068f, 0.038636f, 1.000000f },
-	{ 0.951003f, -0.012031f, 0.308946f, 0.000000f, 0.288672f, -0.323322f, -0.901184f, 0.000000f, 0.110731f, 0.946213f, -0.304007f, 0.000000f, -0.040325f, -0.026750f, 0.030458f, 1.000000f },
-	{ -0.084136f, -0.368123f, -0.925963f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.291472f, 0.897706f, -0.330405f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.977207f, -0.208294f, -0.041003f, 0.000000f, -0.147880f, 0.529323f, 0.835433f, 0.000000f, -0.152312f, 0.822454f, -0.548061f, 0.000000f, -0.043947f, -0.071015f, 0.032386f, 1.000000f },
-	{ 0.505648f, -0.411615f, -0.758218f, 0.000000f, -0.849189f, -0.392611f, -0.353178f, 0.000000f, -0.152311f, 0.822454f, -0.548062f, 0.000000f, -0.011352f, -0.064067f, 0.033754f, 1.000000f },
-	{ 0.937095f, 0.296408f, 0.184379f, 0.000000f, 0.314093f, -0.485503f, -0.815863f, 0.000000f, -0.152311f, 0.822453f, -0.548062f, 0.000000f, -0.020159f, -0.056898f, 0.046960f, 1.000000f },
-	{ 0.937095f, 0.296408f, 0.184379f, 0.000000f, 0.314093f, -0.485503f, -0.815863f, 0.000000f, -0.152311f, 0.822454f, -0.548062f, 0.000000f, -0.038378f, -0.062660f, 0.043376f, 1.000000f },
-	{ -0.994334f, 0.009383f, 0.105885f, 0.000000f, 0.102164f, 0.359520f, 0.927528f, 0.000000f, -0.029364f, 0.933091f, -0.358441f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ 0.330609f, -0.329349f, -0.884437f, 0.000000f, -0.943311f, -0.144479f, -0.298815f, 0.000000f, -0.029368f, 0.933089f, -0.358444f, 0.000000f, -0.012971f, -0.052888f, 0.019645f, 1.000000f },
-	{ 0.910974f, 0.172583f, 0.374623f, 0.000000f, 0.411418f, -0.315531f, -0.855089f, 0.000000f, -0.029368f, 0.933090f, -0.358444f, 0.000000f, -0.021492f, -0.044399f, 0.042442f, 1.000000f },
-	{ 0.910974f, 0.172583f, 0.374623f, 0.000000f, 0.411418f, -0.315531f, -0.855089f, 0.000000f, -0.029368f, 0.933090f, -0.358444f, 0.000000f, -0.043552f, -0.048578f, 0.033370f, 1.000000f },
-	{ -0.475331f, -0.046678f, 0.878568f, 0.000000f, -0.327112f, -0.917629f, -0.225730f, 0.000000f, 0.816736f, -0.394687f, 0.420908f, 0.000000f, -0.010062f, 0.001933f, 0.070744f, 1.000000f },
-	{ -0.377346f, 0.504038f, 0.776889f, 0.000000f, -0.578953f, -0.783155f, 0.226898f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.005428f, 0.003454f, 0.042113f, 1.000000f },
-	{ 0.448220f, 0.893919f, 0.002662f, 0.000000f, -0.525999f, 0.261331f, 0.809340f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.015379f, -0.009838f, 0.021625f, 1.000000f },
-	{ 0.448220f, 0.893919f, 0.002662f, 0.000000f, -0.525999f, 0.261331f, 0.809340f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.000104f, -0.040302f, 0.021535f, 1.000000f } };
-const D3DXMATRIX asPoseThumbRelaxed[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.951999f, 0.304127f, 0.034703f, 0.000000f, 0.228092f, -0.780422f, 0.582165f, 0.000000f, 0.204135f, -0.546305f, -0.812330f, 0.000000f, -0.021285f, -0.031197f, 0.035182f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.413394f, 0.135834f, 0.900364f, 0.000000f, 0.843950f, -0.314061f, 0.434873f, 0.000000f, 0.341840f, 0.939636f, 0.015194f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.888939f, 0.322452f, 0.325288f, 0.000000f, 0.285682f, -0.164783f, 0.944052f, 0.000000f, 0.358013f, 0.932133f, 0.054363f, 0.000000f, -0.024508f, -0.011495f, -0.020424f, 1.000000f },
-	{ -0.922851f, 0.362103f, -0.131252f, 0.000000f, -0.142030f, -0.003179f, 0.989858f, 0.000000f, 0.358013f, 0.932133f, 0.054363f, 0.000000f, -0.004815f, -0.018638f, -0.027630f, 1.000000f },
-	{ -0.922851f, 0.362103f, -0.131252f, 0.000000f, -0.142030f, -0.003179f, 0.989858f, 0.000000f, 0.358013f, 0.932133f, 0.054363f, 0.000000f, 0.022060f, -0.029183f, -0.023808f, 1.000000f },
-	{ -0.507561f, 0.145326f, 0.849272f, 0.000000f, 0.856710f, -0.019918f, 0.515415f, 0.000000f, 0.091819f, 0.989183f, -0.114393f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ -0.995205f, 0.096231f, 0.017527f, 0.000000f, 0.028319f, 0.111953f, 0.993311f, 0.000000f, 0.093625f, 0.989043f, -0.114141f, 0.000000f, -0.030071f, -0.036006f, -0.021363f, 1.000000f },
-	{ -0.848875f, 0.020013f, -0.528215f, 0.000000f, -0.520773f, 0.139596f, 0.842205f, 0.000000f, 0.090592f, 0.990006f, -0.108077f, 0.000000f, -0.000623f, -0.038854f, -0.021882f, 1.000000f },
-	{ -0.848875f, 0.020013f, -0.528215f, 0.000000f, -0.520773f, 0.139596f, 0.842205f, 0.000000f, 0.090592f, 0.990006f, -0.108077f, 0.000000f, 0.021847f, -0.039384f, -0.007900f, 1.000000f },
-	{ -0.073658f, -0.399990f, -0.913555f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.294295f, 0.883967f, -0.363307f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.707112f, 0.001509f, 0.707100f, 0.000000f, 0.608864f, 0.509784f, 0.607787f, 0.000000f, -0.359551f, 0.860301f, -0.361393f, 0.000000f, -0.043390f, -0.072743f, 0.033002f, 1.000000f },
-	{ -0.920047f, -0.391572f, -0.013570f, 0.000000f, -0.153312f, 0.327921f, 0.932182f, 0.000000f, -0.360566f, 0.859732f, -0.361736f, 0.000000f, -0.019804f, -0.072793f, 0.009416f, 1.000000f },
-	{ -0.655842f, -0.510053f, -0.556522f, 0.000000f, -0.662673f, 0.035884f, 0.748049f, 0.000000f, -0.361574f, 0.859394f, -0.361533f, 0.000000f, -0.003778f, -0.065972f, 0.009653f, 1.000000f },
-	{ -0.655842f, -0.510053f, -0.556522f, 0.000000f, -0.662673f, 0.035884f, 0.748048f, 0.000000f, -0.361574f, 0.859394f, -0.361533f, 0.000000f, 0.008972f, -0.056056f, 0.020472f, 1.000000f },
-	{ -0.548059f, 0.147052f, 0.823413f, 0.000000f, 0.830107f, 0.216537f, 0.513843f, 0.000000f, -0.102737f, 0.965136f, -0.240744f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ -0.992196f, -0.118099f, -0.040001f, 0.000000f, -0.066816f, 0.232711f, 0.970249f, 0.000000f, -0.105276f, 0.965349f, -0.238785f, 0.000000f, -0.030185f, -0.058198f, -0.008031f, 1.000000f },
-	{ -0.716899f, -0.238659f, -0.655056f, 0.000000f, -0.689220f, 0.101054f, 0.717472f, 0.000000f, -0.105034f, 0.965831f, -0.236934f, 0.000000f, -0.004611f, -0.055154f, -0.007000f, 1.000000f },
-	{ -0.716899f, -0.238659f, -0.655056f, 0.000000f, -0.689220f, 0.101054f, 0.717472f, 0.000000f, -0.105034f, 0.965831f, -0.236934f, 0.000000f, 0.012749f, -0.049375f, 0.008862f, 1.000000f },
-	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
-	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
-const D3DXMATRIX asPoseThumbRelaxed1[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.965632f, 0.247777f, 0.078487f, 0.000000f, 0.152041f, -0.783420f, 0.602609f, 0.000000f, 0.210801f, -0.569966f, -0.794168f, 0.000000f, -0.022387f, -0.030781f, 0.035506f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.216737f, 0.024541f, 0.975922f, 0.000000f, 0.901744f, -0.377963f, 0.209767f, 0.000000f, 0.374010f, 0.925496f, 0.059788f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.582121f, 0.179238f, 0.793102f, 0.000000f, 0.701820f, -0.381788f, 0.601405f, 0.000000f, 0.410591f, 0.906704f, 0.096454f, 0.000000f, -0.032684f, -0.006868f, -0.023565f, 1.000000f },
-	{ -0.661488f, 0.223389f, 0.715913f, 0.000000f, 0.627574f, -0.357751f, 0.691496f, 0.000000f, 0.410591f, 0.906704f, 0.096455f, 0.000000f, -0.019788f, -0.010838f, -0.041135f, 1.000000f },
-	{ -0.661488f, 0.223389f, 0.715913f, 0.000000f, 0.627574f, -0.357751f, 0.691496f, 0.000000f, 0.410591f, 0.906704f, 0.096455f, 0.000000f, -0.000524f, -0.017344f, -0.061984f, 1.000000f },
-	{ -0.249908f, 0.084769f, 0.964552f, 0.000000f, 0.960598f, -0.103446f, 0.257975f, 0.000000f, 0.121647f, 0.991016f, -0.055577f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ -0.802575f, 0.133384f, 0.581449f, 0.000000f, 0.583549f, -0.026853f, 0.811634f, 0.000000f, 0.123872f, 0.990700f, -0.056285f, 0.000000f, -0.041915f, -0.033223f, -0.026663f, 1.000000f },
-	{ -0.914697f, 0.135254f, 0.380837f, 0.000000f, 0.383817f, -0.004351f, 0.923400f, 0.000000f, 0.126551f, 0.990801f, -0.047933f, 0.000000f, -0.018166f, -0.037170f, -0.043868f, 1.000000f },
-	{ -0.914697f, 0.135254f, 0.380836f, 0.000000f, 0.383816f, -0.004351f, 0.923400f, 0.000000f, 0.126551f, 0.990801f, -0.047933f, 0.000000f, 0.006045f, -0.040750f, -0.053949f, 1.000000f },
-	{ -0.070824f, -0.408476f, -0.910017f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.294990f, 0.880078f, -0.372080f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.488469f, 0.059216f, 0.870570f, 0.000000f, 0.786410f, 0.462185f, 0.409810f, 0.000000f, -0.378097f, 0.884804f, -0.272331f, 0.000000f, -0.043239f, -0.073203f, 0.033179f, 1.000000f },
-	{ -0.814065f, -0.179421f, 0.552365f, 0.000000f, 0.439607f, 0.431165f, 0.787936f, 0.000000f, -0.379532f, 0.884254f, -0.272122f, 0.000000f, -0.026946f, -0.075178f, 0.004140f, 1.000000f },
-	{ -0.919243f, -0.329390f, 0.215626f, 0.000000f, 0.101389f, 0.331158f, 0.938113f, 0.000000f, -0.380411f, 0.884215f, -0.271018f, 0.000000f, -0.012767f, -0.072053f, -0.005481f, 1.000000f },
-	{ -0.919243f, -0.329390f, 0.215626f, 0.000000f, 0.101389f, 0.331158f, 0.938113f, 0.000000f, -0.380411f, 0.884215f, -0.271018f, 0.000000f, 0.005105f, -0.065649f, -0.009673f, 1.000000f },
-	{ -0.285086f, 0.158361f, 0.945330f, 0.000000f, 0.953221f, 0.150225f, 0.262300f, 0.000000f, -0.100473f, 0.975887f, -0.193780f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ -0.853084f, 0.012158f, 0.521632f, 0.000000f, 0.511640f, 0.215564f, 0.831720f, 0.000000f, -0.102332f, 0.976414f, -0.190114f, 0.000000f, -0.040328f, -0.058634f, -0.012734f, 1.000000f },
-	{ -0.982726f, -0.067755f, 0.172217f, 0.000000f, 0.155459f, 0.202652f, 0.966833f, 0.000000f, -0.100407f, 0.976904f, -0.188618f, 0.000000f, -0.018340f, -0.058948f, -0.026179f, 1.000000f },
-	{ -0.982726f, -0.067755f, 0.172217f, 0.000000f, 0.155459f, 0.202652f, 0.966833f, 0.000000f, -0.100407f, 0.976904f, -0.188618f, 0.000000f, 0.005457f, -0.057307f, -0.030350f, 1.000000f },
-	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
-	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
-const D3DXMATRIX asPoseThumb[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.873055f, 0.478794f, -0.092359f, 0.000000f, 0.457723f, -0.739387f, 0.493758f, 0.000000f, 0.168119f, -0.473353f, -0.864681f, 0.000000f, -0.017789f, -0.032517f, 0.034155f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.854834f, 0.342633f, 0.389695f, 0.000000f, 0.417373f, 0.007788f, 0.908702f, 0.000000f, 0.308317f, 0.939437f, -0.149663f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.164652f, -0.102217f, -0.981041f, 0.000000f, -0.936939f, 0.327069f, 0.123172f, 0.000000f, 0.308278f, 0.939456f, -0.149624f, 0.000000f, -0.006155f, -0.020092f, 0.000807f, 1.000000f },
-	{ 0.925300f, -0.332639f, -0.182126f, 0.000000f, -0.220869f, -0.082301f, -0.971824f, 0.000000f, 0.308278f, 0.939456f, -0.149623f, 0.000000f, -0.002507f, -0.017828f, 0.022540f, 1.000000f },
-	{ 0.925300f, -0.332639f, -0.182126f, 0.000000f, -0.220870f, -0.082301f, -0.971824f, 0.000000f, 0.308278f, 0.939456f, -0.149623f, 0.000000f, -0.029454f, -0.008141f, 0.027844f, 1.000000f },
-	{ -0.977869f, 0.158235f, 0.136878f, 0.000000f, 0.177597f, 0.281927f, 0.942856f, 0.000000f, 0.110603f, 0.946298f, -0.303789f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ 0.225628f, -0.321589f, -0.919605f, 0.000000f, -0.967915f, 0.033169f, -0.249080f, 0.000000f, 0.110604f, 0.946299f, -0.303786f, 0.000000f, -0.008453f, -0.036600f, 0.011383f, 1.000000f },
-	{ 0.950941f, -0.011902f, 0.309144f, 0.000000f, 0.288927f, -0.323076f, -0.901191f, 0.000000f, 0.110603f, 0.946299f, -0.303786f, 0.000000f, -0.015129f, -0.027084f, 0.038595f, 1.000000f },
-	{ 0.950941f, -0.011902f, 0.309144f, 0.000000f, 0.288927f, -0.323076f, -0.901191f, 0.000000f, 0.110603f, 0.946298f, -0.303786f, 0.000000f, -0.040300f, -0.026769f, 0.030412f, 1.000000f },
-	{ -0.084677f, -0.366455f, -0.926575f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.291315f, 0.898389f, -0.328685f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.977396f, -0.207627f, -0.039860f, 0.000000f, -0.146268f, 0.527944f, 0.836589f, 0.000000f, -0.152654f, 0.823509f, -0.546379f, 0.000000f, -0.043976f, -0.070925f, 0.032356f, 1.000000f },
-	{ 0.504227f, -0.410589f, -0.759719f, 0.000000f, -0.849972f, -0.391474f, -0.352557f, 0.000000f, -0.152654f, 0.823508f, -0.546381f, 0.000000f, -0.011374f, -0.063999f, 0.033685f, 1.000000f },
-	{ 0.937856f, 0.295052f, 0.182676f, 0.000000f, 0.311646f, -0.484541f, -0.817372f, 0.000000f, -0.152653f, 0.823508f, -0.546381f, 0.000000f, -0.020157f, -0.056848f, 0.046918f, 1.000000f },
-	{ 0.937856f, 0.295052f, 0.182676f, 0.000000f, 0.311646f, -0.484541f, -0.817372f, 0.000000f, -0.152653f, 0.823508f, -0.546381f, 0.000000f, -0.038390f, -0.062584f, 0.043367f, 1.000000f },
-	{ -0.994334f, 0.009383f, 0.105885f, 0.000000f, 0.102164f, 0.359520f, 0.927528f, 0.000000f, -0.029365f, 0.933091f, -0.358441f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ 0.330609f, -0.329348f, -0.884437f, 0.000000f, -0.943311f, -0.144479f, -0.298815f, 0.000000f, -0.029368f, 0.933089f, -0.358444f, 0.000000f, -0.012971f, -0.052888f, 0.019645f, 1.000000f },
-	{ 0.911485f, 0.172192f, 0.373557f, 0.000000f, 0.410283f, -0.315746f, -0.855555f, 0.000000f, -0.029370f, 0.933089f, -0.358445f, 0.000000f, -0.021492f, -0.044399f, 0.042442f, 1.000000f },
-	{ 0.911485f, 0.172192f, 0.373556f, 0.000000f, 0.410283f, -0.315746f, -0.855555f, 0.000000f, -0.029370f, 0.933089f, -0.358445f, 0.000000f, -0.043564f, -0.048568f, 0.033396f, 1.000000f },
-	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
-	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
-const D3DXMATRIX asPoseThumbPoint[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.873328f, 0.478356f, -0.092057f, 0.000000f, 0.457158f, -0.739554f, 0.494031f, 0.000000f, 0.168241f, -0.473536f, -0.864558f, 0.000000f, -0.017798f, -0.032514f, 0.034158f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.028073f, -0.031060f, 0.999123f, 0.000000f, 0.976059f, -0.216521f, 0.020693f, 0.000000f, 0.215688f, 0.975784f, 0.036395f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.128360f, -0.008615f, 0.991690f, 0.000000f, 0.967989f, -0.218568f, 0.123394f, 0.000000f, 0.215688f, 0.975784f, 0.036395f, 0.000000f, -0.040527f, -0.004556f, -0.024530f, 1.000000f },
-	{ 0.020016f, -0.041683f, 0.998930f, 0.000000f, 0.976257f, -0.214729f, -0.028522f, 0.000000f, 0.215688f, 0.975784f, 0.036395f, 0.000000f, -0.037684f, -0.004365f, -0.046499f, 1.000000f },
-	{ 0.020016f, -0.041683f, 0.998931f, 0.000000f, 0.976257f, -0.214729f, -0.028522f, 0.000000f, 0.215688f, 0.975784f, 0.036395f, 0.000000f, -0.038267f, -0.003151f, -0.075590f, 1.000000f },
-	{ -0.977685f, 0.158394f, 0.138002f, 0.000000f, 0.178687f, 0.281557f, 0.942761f, 0.000000f, 0.110472f, 0.946381f, -0.303577f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ 0.224555f, -0.321313f, -0.919964f, 0.000000f, -0.968180f, 0.033462f, -0.248011f, 0.000000f, 0.110473f, 0.946382f, -0.303574f, 0.000000f, -0.008461f, -0.036607f, 0.011332f, 1.000000f },
-	{ 0.951671f, -0.012652f, 0.306859f, 0.000000f, 0.286565f, -0.322810f, -0.902040f, 0.000000f, 0.110470f, 0.946379f, -0.303583f, 0.000000f, -0.015106f, -0.027099f, 0.038554f, 1.000000f },
-	{ 0.951671f, -0.012652f, 0.306859f, 0.000000f, 0.286565f, -0.322810f, -0.902039f, 0.000000f, 0.110470f, 0.946379f, -0.303583f, 0.000000f, -0.040296f, -0.026764f, 0.030432f, 1.000000f },
-	{ -0.084385f, -0.367353f, -0.926246f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.291400f, 0.898022f, -0.329611f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.977447f, -0.207580f, -0.038828f, 0.000000f, -0.145511f, 0.528764f, 0.836203f, 0.000000f, -0.153048f, 0.822994f, -0.547044f, 0.000000f, -0.043961f, -0.070974f, 0.032372f, 1.000000f },
-	{ 0.503545f, -0.411366f, -0.759750f, 0.000000f, -0.850305f, -0.391740f, -0.351455f, 0.000000f, -0.153048f, 0.822993f, -0.547046f, 0.000000f, -0.011357f, -0.064049f, 0.033667f, 1.000000f },
-	{ 0.938332f, 0.294684f, 0.180816f, 0.000000f, 0.310016f, -0.485639f, -0.817340f, 0.000000f, -0.153046f, 0.822992f, -0.547047f, 0.000000f, -0.020128f, -0.056884f, 0.046900f, 1.000000f },
-	{ 0.938332f, 0.294684f, 0.180816f, 0.000000f, 0.310016f, -0.485639f, -0.817340f, 0.000000f, -0.153046f, 0.822992f, -0.547047f, 0.000000f, -0.038370f, -0.062613f, 0.043385f, 1.000000f },
-	{ -0.994575f, 0.008878f, 0.103643f, 0.000000f, 0.099886f, 0.359707f, 0.927703f, 0.000000f, -0.029045f, 0.933023f, -0.358643f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ 0.332772f, -0.329303f, -0.883641f, 0.000000f, -0.942560f, -0.145015f, -0.300918f, 0.000000f, -0.029048f, 0.933022f, -0.358645f, 0.000000f, -0.012962f, -0.052868f, 0.019731f, 1.000000f },
-	{ 0.911064f, 0.172331f, 0.374518f, 0.000000f, 0.411240f, -0.315871f, -0.855049f, 0.000000f, -0.029052f, 0.933021f, -0.358648f, 0.000000f, -0.021539f, -0.044380f, 0.042508f, 1.000000f },
-	{ 0.911064f, 0.172331f, 0.374518f, 0.000000f, 0.411240f, -0.315871f, -0.855049f, 0.000000f, -0.029052f, 0.933021f, -0.358648f, 0.000000f, -0.043600f, -0.048553f, 0.033439f, 1.000000f },
-	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
-	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
-const D3DXMATRIX asPoseThumbPointRelaxed[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.965588f, 0.248009f, 0.078304f, 0.000000f, 0.152356f, -0.783417f, 0.602532f, 0.000000f, 0.210778f, -0.569868f, -0.794244f, 0.000000f, -0.022382f, -0.030783f, 0.035504f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.028642f, -0.032745f, 0.999054f, 0.000000f, 0.974461f, -0.223610f, 0.020608f, 0.000000f, 0.222723f, 0.974129f, 0.038313f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.128762f, -0.009561f, 0.991630f, 0.000000f, 0.966341f, -0.225792f, 0.123301f, 0.000000f, 0.222723f, 0.974129f, 0.038313f, 0.000000f, -0.040503f, -0.004486f, -0.024527f, 1.000000f },
-	{ 0.019369f, -0.043714f, 0.998857f, 0.000000f, 0.974689f, -0.221726f, -0.028604f, 0.000000f, 0.222723f, 0.974129f, 0.038313f, 0.000000f, -0.037651f, -0.004274f, -0.046495f, 1.000000f },
-	{ 0.019369f, -0.043714f, 0.998857f, 0.000000f, 0.974690f, -0.221726f, -0.028604f, 0.000000f, 0.222723f, 0.974129f, 0.038313f, 0.000000f, -0.038215f, -0.003001f, -0.075583f, 1.000000f },
-	{ -0.248837f, 0.084483f, 0.964855f, 0.000000f, 0.960857f, -0.103740f, 0.256889f, 0.000000f, 0.121797f, 0.991010f, -0.055362f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ -0.801911f, 0.133349f, 0.582372f, 0.000000f, 0.584430f, -0.027262f, 0.810987f, 0.000000f, 0.124021f, 0.990694f, -0.056072f, 0.000000f, -0.041964f, -0.033209f, -0.026677f, 1.000000f },
-	{ -0.914252f, 0.135314f, 0.381883f, 0.000000f, 0.384824f, -0.004757f, 0.922979f, 0.000000f, 0.126709f, 0.990791f, -0.047723f, 0.000000f, -0.018235f, -0.037155f, -0.043909f, 1.000000f },
-	{ -0.914252f, 0.135314f, 0.381883f, 0.000000f, 0.384824f, -0.004757f, 0.922979f, 0.000000f, 0.126709f, 0.990791f, -0.047723f, 0.000000f, 0.005965f, -0.040737f, -0.054018f, 1.000000f },
-	{ -0.070894f, -0.408267f, -0.910106f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.294973f, 0.880176f, -0.371863f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.488416f, 0.059040f, 0.870612f, 0.000000f, 0.786454f, 0.462058f, 0.409870f, 0.000000f, -0.378074f, 0.884882f, -0.272108f, 0.000000f, -0.043243f, -0.073191f, 0.033175f, 1.000000f },
-	{ -0.814041f, -0.179511f, 0.552371f, 0.000000f, 0.439671f, 0.430967f, 0.788009f, 0.000000f, -0.379509f, 0.884332f, -0.271899f, 0.000000f, -0.026952f, -0.075161f, 0.004135f, 1.000000f },
-	{ -0.919148f, -0.329085f, 0.216497f, 0.000000f, 0.102333f, 0.331253f, 0.937977f, 0.000000f, -0.380389f, 0.884293f, -0.270794f, 0.000000f, -0.012772f, -0.072034f, -0.005487f, 1.000000f },
-	{ -0.919148f, -0.329085f, 0.216497f, 0.000000f, 0.102333f, 0.331253f, 0.937977f, 0.000000f, -0.380389f, 0.884293f, -0.270794f, 0.000000f, 0.005097f, -0.065636f, -0.009696f, 1.000000f },
-	{ -0.283980f, 0.158367f, 0.945662f, 0.000000f, 0.953555f, 0.149956f, 0.261237f, 0.000000f, -0.100436f, 0.975927f, -0.193596f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ -0.852493f, 0.012343f, 0.522593f, 0.000000f, 0.512632f, 0.215369f, 0.831159f, 0.000000f, -0.102291f, 0.976455f, -0.189928f, 0.000000f, -0.040371f, -0.058634f, -0.012747f, 1.000000f },
-	{ -0.982549f, -0.067511f, 0.173318f, 0.000000f, 0.156601f, 0.202540f, 0.966672f, 0.000000f, -0.100365f, 0.976944f, -0.188433f, 0.000000f, -0.018397f, -0.058953f, -0.026217f, 1.000000f },
-	{ -0.982549f, -0.067511f, 0.173318f, 0.000000f, 0.156601f, 0.202540f, 0.966672f, 0.000000f, -0.100365f, 0.976944f, -0.188433f, 0.000000f, 0.005395f, -0.057318f, -0.030414f, 1.000000f },
-	{ -0.286370f, -0.472706f, 0.833391f, 0.000000f, -0.208495f, -0.818231f, -0.535750f, 0.000000f, 0.935159f, -0.327180f, 0.135760f, 0.000000f, -0.009981f, 0.002158f, 0.071969f, 1.000000f },
-	{ -0.329754f, -0.664087f, 0.671008f, 0.000000f, -0.176440f, -0.654888f, -0.734841f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, -0.000649f, 0.017563f, 0.044810f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.008047f, 0.035076f, 0.027115f, 1.000000f },
-	{ -0.372956f, -0.872398f, 0.315951f, 0.000000f, -0.027791f, -0.329864f, -0.943619f, 0.000000f, 0.927433f, -0.360709f, 0.098780f, 0.000000f, 0.020758f, 0.064807f, 0.016347f, 1.000000f } };
-const D3DXMATRIX asPosePointRelaxed[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.965632f, 0.247777f, 0.078487f, 0.000000f, 0.152041f, -0.783420f, 0.602609f, 0.000000f, 0.210801f, -0.569966f, -0.794168f, 0.000000f, -0.022387f, -0.030781f, 0.035506f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.028060f, -0.031067f, 0.999123f, 0.000000f, 0.976058f, -0.216524f, 0.020680f, 0.000000f, 0.215691f, 0.975783f, 0.036399f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.128348f, -0.008621f, 0.991692f, 0.000000f, 0.967990f, -0.218571f, 0.123380f, 0.000000f, 0.215691f, 0.975783f, 0.036398f, 0.000000f, -0.040528f, -0.004556f, -0.024530f, 1.000000f },
-	{ 0.020029f, -0.041689f, 0.998930f, 0.000000f, 0.976256f, -0.214731f, -0.028536f, 0.000000f, 0.215691f, 0.975783f, 0.036398f, 0.000000f, -0.037684f, -0.004365f, -0.046499f, 1.000000f },
-	{ 0.020029f, -0.041689f, 0.998930f, 0.000000f, 0.976256f, -0.214731f, -0.028536f, 0.000000f, 0.215691f, 0.975783f, 0.036398f, 0.000000f, -0.038268f, -0.003151f, -0.075590f, 1.000000f },
-	{ -0.249908f, 0.084769f, 0.964552f, 0.000000f, 0.960598f, -0.103446f, 0.257975f, 0.000000f, 0.121647f, 0.991016f, -0.055577f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ -0.802575f, 0.133384f, 0.581449f, 0.000000f, 0.583549f, -0.026853f, 0.811634f, 0.000000f, 0.123872f, 0.990700f, -0.056285f, 0.000000f, -0.041915f, -0.033223f, -0.026663f, 1.000000f },
-	{ -0.914697f, 0.135254f, 0.380837f, 0.000000f, 0.383817f, -0.004351f, 0.923400f, 0.000000f, 0.126551f, 0.990801f, -0.047933f, 0.000000f, -0.018166f, -0.037170f, -0.043868f, 1.000000f },
-	{ -0.914697f, 0.135254f, 0.380836f, 0.000000f, 0.383816f, -0.004351f, 0.923400f, 0.000000f, 0.126551f, 0.990801f, -0.047933f, 0.000000f, 0.006045f, -0.040750f, -0.053949f, 1.000000f },
-	{ -0.070824f, -0.408476f, -0.910017f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.294990f, 0.880078f, -0.372080f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.488469f, 0.059216f, 0.870570f, 0.000000f, 0.786410f, 0.462185f, 0.409810f, 0.000000f, -0.378097f, 0.884804f, -0.272331f, 0.000000f, -0.043239f, -0.073203f, 0.033179f, 1.000000f },
-	{ -0.814065f, -0.179421f, 0.552365f, 0.000000f, 0.439607f, 0.431165f, 0.787936f, 0.000000f, -0.379532f, 0.884254f, -0.272122f, 0.000000f, -0.026946f, -0.075178f, 0.004140f, 1.000000f },
-	{ -0.919243f, -0.329390f, 0.215626f, 0.000000f, 0.101389f, 0.331158f, 0.938113f, 0.000000f, -0.380411f, 0.884215f, -0.271018f, 0.000000f, -0.012767f, -0.072053f, -0.005481f, 1.000000f },
-	{ -0.919243f, -0.329390f, 0.215626f, 0.000000f, 0.101389f, 0.331158f, 0.938113f, 0.000000f, -0.380411f, 0.884215f, -0.271018f, 0.000000f, 0.005105f, -0.065649f, -0.009673f, 1.000000f },
-	{ -0.285086f, 0.158361f, 0.945330f, 0.000000f, 0.953221f, 0.150225f, 0.262300f, 0.000000f, -0.100473f, 0.975887f, -0.193780f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ -0.853084f, 0.012158f, 0.521632f, 0.000000f, 0.511640f, 0.215564f, 0.831720f, 0.000000f, -0.102332f, 0.976414f, -0.190114f, 0.000000f, -0.040328f, -0.058634f, -0.012734f, 1.000000f },
-	{ -0.982726f, -0.067755f, 0.172217f, 0.000000f, 0.155459f, 0.202652f, 0.966833f, 0.000000f, -0.100407f, 0.976904f, -0.188618f, 0.000000f, -0.018340f, -0.058948f, -0.026179f, 1.000000f },
-	{ -0.982726f, -0.067755f, 0.172217f, 0.000000f, 0.155459f, 0.202652f, 0.966833f, 0.000000f, -0.100407f, 0.976904f, -0.188618f, 0.000000f, 0.005457f, -0.057307f, -0.030350f, 1.000000f },
-	{ -0.481274f, -0.152774f, 0.863155f, 0.000000f, -0.249293f, -0.920180f, -0.301866f, 0.000000f, 0.840375f, -0.360458f, 0.404773f, 0.000000f, -0.009764f, 0.002759f, 0.075239f, 1.000000f },
-	{ -0.391518f, 0.112725f, 0.913240f, 0.000000f, -0.374813f, -0.925939f, -0.046395f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.005920f, 0.007738f, 0.047110f, 1.000000f },
-	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.016245f, 0.004765f, 0.023026f, 1.000000f },
-	{ -0.397996f, 0.096559f, 0.912292f, 0.000000f, -0.367927f, -0.927765f, -0.062315f, 0.000000f, 0.840374f, -0.360458f, 0.404773f, 0.000000f, 0.029808f, 0.001475f, -0.008064f, 1.000000f } };
-const D3DXMATRIX asPosePoint[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.873464f, 0.478136f, -0.091907f, 0.000000f, 0.456876f, -0.739637f, 0.494167f, 0.000000f, 0.168302f, -0.473627f, -0.864496f, 0.000000f, -0.017803f, -0.032512f, 0.034159f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.031458f, -0.032147f, 0.998988f, 0.000000f, 0.973844f, -0.226012f, 0.023394f, 0.000000f, 0.225031f, 0.973594f, 0.038416f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.131500f, -0.008720f, 0.991278f, 0.000000f, 0.965437f, -0.228120f, 0.126066f, 0.000000f, 0.225031f, 0.973594f, 0.038416f, 0.000000f, -0.040386f, -0.004511f, -0.024524f, 1.000000f },
-	{ 0.016526f, -0.043236f, 0.998928f, 0.000000f, 0.974211f, -0.224155f, -0.025819f, 0.000000f, 0.225031f, 0.973594f, 0.038416f, 0.000000f, -0.037473f, -0.004318f, -0.046484f, 1.000000f },
-	{ 0.016526f, -0.043236f, 0.998928f, 0.000000f, 0.974212f, -0.224155f, -0.025819f, 0.000000f, 0.225031f, 0.973594f, 0.038416f, 0.000000f, -0.037955f, -0.003059f, -0.075575f, 1.000000f },
-	{ -0.978051f, 0.158075f, 0.135755f, 0.000000f, 0.176508f, 0.282296f, 0.942950f, 0.000000f, 0.110734f, 0.946215f, -0.304001f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ 0.227924f, -0.321908f, -0.918928f, 0.000000f, -0.967363f, 0.032467f, -0.251310f, 0.000000f, 0.110734f, 0.946215f, -0.304001f, 0.000000f, -0.008444f, -0.036592f, 0.011435f, 1.000000f },
-	{ 0.950238f, -0.011182f, 0.311325f, 0.000000f, 0.291181f, -0.323348f, -0.900367f, 0.000000f, 0.110734f, 0.946214f, -0.304001f, 0.000000f, -0.015189f, -0.027067f, 0.038627f, 1.000000f },
-	{ 0.950238f, -0.011182f, 0.311325f, 0.000000f, 0.291182f, -0.323348f, -0.900367f, 0.000000f, 0.110734f, 0.946214f, -0.304001f, 0.000000f, -0.040341f, -0.026771f, 0.030386f, 1.000000f },
-	{ -0.084080f, -0.368294f, -0.925900f, 0.000000f, -0.952872f, -0.242094f, 0.182827f, 0.000000f, -0.291488f, 0.897636f, -0.330581f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.977198f, -0.208335f, -0.041010f, 0.000000f, -0.147937f, 0.529470f, 0.835330f, 0.000000f, -0.152315f, 0.822350f, -0.548217f, 0.000000f, -0.043944f, -0.071024f, 0.032389f, 1.000000f },
-	{ 0.506891f, -0.411181f, -0.757623f, 0.000000f, -0.848447f, -0.393284f, -0.354213f, 0.000000f, -0.152315f, 0.822350f, -0.548217f, 0.000000f, -0.011349f, -0.064075f, 0.033757f, 1.000000f },
-	{ 0.936633f, 0.297157f, 0.185516f, 0.000000f, 0.315465f, -0.485221f, -0.815501f, 0.000000f, -0.152315f, 0.822349f, -0.548217f, 0.000000f, -0.020178f, -0.056913f, 0.046953f, 1.000000f },
-	{ 0.936633f, 0.297157f, 0.185516f, 0.000000f, 0.315465f, -0.485221f, -0.815501f, 0.000000f, -0.152315f, 0.822350f, -0.548217f, 0.000000f, -0.038388f, -0.062690f, 0.043347f, 1.000000f },
-	{ -0.994455f, 0.009131f, 0.104764f, 0.000000f, 0.101025f, 0.359614f, 0.927617f, 0.000000f, -0.029205f, 0.933057f, -0.358542f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ 0.332862f, -0.329145f, -0.883667f, 0.000000f, -0.942523f, -0.145153f, -0.300967f, 0.000000f, -0.029205f, 0.933057f, -0.358542f, 0.000000f, -0.012966f, -0.052878f, 0.019688f, 1.000000f },
-	{ 0.909993f, 0.173236f, 0.376700f, 0.000000f, 0.413594f, -0.315270f, -0.854135f, 0.000000f, -0.029205f, 0.933057f, -0.358542f, 0.000000f, -0.021546f, -0.044394f, 0.042465f, 1.000000f },
-	{ 0.909993f, 0.173236f, 0.376699f, 0.000000f, 0.413594f, -0.315270f, -0.854135f, 0.000000f, -0.029205f, 0.933057f, -0.358542f, 0.000000f, -0.043581f, -0.048589f, 0.033343f, 1.000000f },
-	{ -0.475331f, -0.046678f, 0.878568f, 0.000000f, -0.327112f, -0.917629f, -0.225730f, 0.000000f, 0.816736f, -0.394687f, 0.420908f, 0.000000f, -0.010062f, 0.001933f, 0.070744f, 1.000000f },
-	{ -0.377346f, 0.504038f, 0.776889f, 0.000000f, -0.578953f, -0.783155f, 0.226898f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.005428f, 0.003454f, 0.042113f, 1.000000f },
-	{ 0.448220f, 0.893919f, 0.002662f, 0.000000f, -0.525999f, 0.261331f, 0.809340f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.015379f, -0.009838f, 0.021625f, 1.000000f },
-	{ 0.448220f, 0.893919f, 0.002662f, 0.000000f, -0.525999f, 0.261331f, 0.809340f, 0.000000f, 0.722788f, -0.364163f, 0.587335f, 0.000000f, 0.000104f, -0.040302f, 0.021535f, 1.000000f } };
-const D3DXMATRIX asPosePinch[] = {
-	{ 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f, 0.000000f, 0.000000f, 0.000000f, 0.000000f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, -0.296909f, -0.935471f, 0.191676f, 0.000000f, -0.952685f, 0.303871f, 0.007313f, 0.000000f, -0.039957f, -0.025041f, 0.109148f, 1.000000f },
-	{ 0.965586f, 0.248018f, 0.078298f, 0.000000f, 0.152368f, -0.783417f, 0.602530f, 0.000000f, 0.210778f, -0.569865f, -0.794247f, 0.000000f, -0.022383f, -0.030783f, 0.035505f, 1.000000f },
-	{ -0.065086f, -0.180435f, -0.981431f, 0.000000f, 0.155004f, -0.973407f, 0.168680f, 0.000000f, -0.985767f, -0.141147f, 0.091323f, 0.000000f, -0.048816f, -0.049601f, -0.024439f, 1.000000f },
-	{ -0.513859f, 0.107625f, 0.851098f, 0.000000f, 0.781942f, -0.349319f, 0.516278f, 0.000000f, 0.352869f, 0.930803f, 0.095344f, 0.000000f, -0.041694f, -0.005847f, 0.017008f, 1.000000f },
-	{ -0.912018f, 0.319422f, 0.257282f, 0.000000f, 0.208909f, -0.178042f, 0.961592f, 0.000000f, 0.352961f, 0.930737f, 0.095647f, 0.000000f, -0.020331f, -0.010322f, -0.018376f, 1.000000f },
-	{ -0.773463f, 0.347774f, -0.529913f, 0.000000f, -0.526473f, 0.113058f, 0.842642f, 0.000000f, 0.352961f, 0.930737f, 0.095647f, 0.000000f, -0.000127f, -0.017398f, -0.024076f, 1.000000f },
-	{ -0.773464f, 0.347774f, -0.529913f, 0.000000f, -0.526473f, 0.113058f, 0.842642f, 0.000000f, 0.352961f, 0.930737f, 0.095647f, 0.000000f, 0.022398f, -0.027526f, -0.008644f, 1.000000f },
-	{ -0.543003f, 0.123726f, 0.830567f, 0.000000f, 0.827865f, -0.086813f, 0.554169f, 0.000000f, 0.140669f, 0.988512f, -0.055288f, 0.000000f, -0.053403f, -0.029326f, 0.017675f, 1.000000f },
-	{ -0.920718f, 0.151161f, 0.359762f, 0.000000f, 0.363985f, 0.000291f, 0.931405f, 0.000000f, 0.140688f, 0.988509f, -0.055288f, 0.000000f, -0.028442f, -0.035013f, -0.020504f, 1.000000f },
-	{ -0.984336f, 0.145646f, 0.099351f, 0.000000f, 0.106252f, 0.040378f, 0.993520f, 0.000000f, 0.140691f, 0.988513f, -0.055220f, 0.000000f, -0.001198f, -0.039486f, -0.031149f, 1.000000f },
-	{ -0.984336f, 0.145646f, 0.099351f, 0.000000f, 0.106252f, 0.040378f, 0.993519f, 0.000000f, 0.140690f, 0.988513f, -0.055220f, 0.000000f, 0.024857f, -0.043341f, -0.033779f, 1.000000f },
-	{ -0.052164f, -0.390756f, -0.919015f, 0.000000f, -0.954273f, -0.251746f, 0.161205f, 0.000000f, -0.294350f, 0.885401f, -0.359755f, 0.000000f, -0.036690f, -0.052018f, 0.082028f, 1.000000f },
-	{ -0.370200f, 0.154532f, 0.916009f, 0.000000f, 0.821452f, 0.514911f, 0.245119f, 0.000000f, -0.433784f, 0.843200f, -0.317561f, 0.000000f, -0.042242f, -0.072269f, 0.032662f, 1.000000f },
-	{ -0.757591f, -0.150557f, 0.635129f, 0.000000f, 0.487727f, 0.516094f, 0.704108f, 0.000000f, -0.433795f, 0.843196f, -0.317558f, 0.000000f, -0.029894f, -0.077424f, 0.002108f, 1.000000f },
-	{ -0.876835f, -0.313994f, 0.364100f, 0.000000f, 0.207302f, 0.436380f, 0.875556f, 0.000000f, -0.433805f, 0.843197f, -0.317541f, 0.000000f, -0.016698f, -0.074801f, -0.008955f, 1.000000f },
-	{ -0.876834f, -0.313994f, 0.364100f, 0.000000f, 0.207302f, 0.436380f, 0.875556f, 0.000000f, -0.433805f, 0.843197f, -0.317541f, 0.000000f, 0.000349f, -0.068697f, -0.016033f, 1.000000f },
-	{ -0.428550f, 0.103824f, 0.897533f, 0.000000f, 0.901761f, 0.111065f, 0.417722f, 0.000000f, -0.056315f, 0.988375f, -0.141222f, 0.000000f, -0.051324f, -0.052526f, 0.023729f, 1.000000f },
-	{ -0.870642f, 0.020596f, 0.491485f, 0.000000f, 0.488681f, 0.150620f, 0.859363f, 0.000000f, -0.056328f, 0.988377f, -0.141201f, 0.000000f, -0.034794f, -0.056531f, -0.010890f, 1.000000f },
-	{ -0.967508f, -0.019112f, 0.252115f, 0.000000f, 0.246487f, 0.150804f, 0.957342f, 0.000000f, -0.056316f, 0.988379f, -0.141193f, 0.000000f, -0.012353f, -0.057061f, -0.023559f, 1.000000f },
-	{ -0.967508f, -0.019112f, 0.252115f, 0.000000f, 0.246487f, 0.150804f, 0.957342f, 0.000000f, -0.056316f, 0.988379f, -0.141193f, 0.000000f, 0.011075f, -0.056599f, -0.029664f, 1.000000f },
-	{ -0.550105f, 0.366842f, 0.750207f, 0.000000f, -0.600946f, -0.797686f, -0.050597f, 0.000000f, 0.579868f, -0.478668f, 0.659264f, 0.000000f, -0.010062f, 0.001935f, 0.070753f, 1.000000f },
-	{ -0.392654f, 0.123396f, 0.911370f, 0.000000f, -0.787999f, -0.556105f, -0.264206f, 0.000000f, 0.474215f, -0.821901f, 0.315593f, 0.000000f, 0.007865f, -0.010020f, 0.046305f, 1.000000f },
-	{ -0.142559f, 0.282300f, 0.948674f, 0.000000f, -0.959244f, -0.275667f, -0.062117f, 0.000000f, 0.243982f, -0.918866f, 0.310093f, 0.000000f, 0.018220f, -0.013274f, 0.022271f, 1.000000f },
-	{ -0.142559f, 0.282300f, 0.948674f, 0.000000f, -0.959244f, -0.275667f, -0.062117f, 0.000000f, 0.243982f, -0.918866f, 0.310093f, 0.000000f, 0.023079f, -0.022895f, -0.010060f, 1.000000f } };
-
-#pragma endregion
-#pragma region mesh
-const uint32_t unAvatarVertexCount_4070 = 4070;
-const ovrAvatarMeshVertex asAvatarVertices_4070[] = {
-	{ -0.045496, 0.001859, 0.008134, -0.500130, 0.856045, -0.130604, 0.079175, -0.104985, -0.991317, 1.000000, 0.375780, 0.432110, 4, 1, 1, 1, 0.913890, 0.086110, 0.000000, 0.000000 },
-	{ -0.048472, -0.000588, 0.008163, -0.724922, 0.648736, -0.231582, 0.159462, -0.169015, -0.972628, 1.000000, 0.376820, 0.421370, 4, 1, 1, 1, 0.911613, 0.088387, 0.000000, 0.000000 },
-	{ -0.046918, -0.000352, 0.004138, -0.734816, 0.629939, -0.251438, 0.120288, -0.243800, -0.962337, 1.000000, 0.386140, 0.425600, 4, 1, 1, 1, 0.972778, 0.027222, 0.000000, 0.000000 },
-	{ -0.044113, 0.002006, 0.003884, -0.510407, 0.845384, -0.157515, 0.035738, -0.162159, -0.986117, 1.000000, 0.385310, 0.435900, 4, 1, 1, 1, 0.974071, 0.025929, 0.000000, 0.000000 },
-	{ -0.047317, 0.001210, 0.011897, -0.542557, 0.829980, -0.129481, 0.123679, -0.073533, -0.989594, 1.000000, 0.367150, 0.427400, 4, 1, 1, 1, 0.812388, 0.187612, 0.000000, 0.000000 },
-	{ -0.050042, -0.001134, 0.011818, -0.732677, 0.647935, -0.208240, 0.181773, -0.108557, -0.977330, 1.000000, 0.368210, 0.417410, 4, 1, 1, 1, 0.804634, 0.195366, 0.000000, 0.000000 },
-	{ -0.041406, 0.003581, 0.009160, -0.262990, 0.961571, -0.078855, 0.039206, -0.071013, -0.996705, 1.000000, 0.372340, 0.444590, 4, 1, 1, 1, 0.881486, 0.118514, 0.000000, 0.000000 },
-	{ -0.044437, 0.002875, 0.013099, -0.370381, 0.925526, -0.078859, 0.089939, -0.048765, -0.994753, 1.000000, 0.363490, 0.436620, 4, 1, 1, 1, 0.772618, 0.227382, 0.000000, 0.000000 },
-	{ -0.040849, 0.003377, 0.003876, -0.273458, 0.957280, -0.094002, -0.003022, -0.098581, -0.995125, 1.000000, 0.384280, 0.446000, 4, 1, 1, 1, 0.968748, 0.031252, 0.000000, 0.000000 },
-	{ -0.050710, -0.003717, 0.008652, -0.853894, 0.414893, -0.314211, 0.258493, -0.185909, -0.947956, 1.000000, 0.377270, 0.410490, 4, 1, 1, 1, 0.889129, 0.110871, 0.000000, 0.000000 },
-	{ -0.052196, -0.004056, 0.012299, -0.860672, 0.425799, -0.279175, 0.254884, -0.114346, -0.960187, 1.000000, 0.368220, 0.407660, 4, 1, 1, 1, 0.769754, 0.230246, 0.000000, 0.000000 },
-	{ -0.049106, -0.003544, 0.004629, -0.857774, 0.404463, -0.317228, 0.218792, -0.271163, -0.937337, 1.000000, 0.387130, 0.414180, 4, 1, 1, 1, 0.962882, 0.037118, 0.000000, 0.000000 },
-	{ -0.042115, 0.003861, 0.015652, -0.274281, 0.960678, -0.043219, 0.078427, -0.022447, -0.996667, 1.000000, 0.357120, 0.443810, 4, 1, 1, 1, 0.663945, 0.336055, 0.000000, 0.000000 },
-	{ -0.039183, 0.004345, 0.013401, -0.153024, 0.985288, -0.076099, 0.047945, -0.069513, -0.996428, 1.000000, 0.362080, 0.451410, 4, 1, 1, 1, 0.753445, 0.246555, 0.000000, 0.000000 },
-	{ -0.044809, 0.002931, 0.017887, -0.378017, 0.925767, 0.007712, 0.070592, 0.037129, -0.996814, 1.000000, 0.352230, 0.436760, 4, 1, 1, 1, 0.565734, 0.434266, 0.000000, 0.000000 },
-	{ -0.046610, 0.002062, 0.015884, -0.457622, 0.887583, -0.052708, 0.102373, -0.006289, -0.994726, 1.000000, 0.357250, 0.431100, 4, 1, 1, 1, 0.662092, 0.337908, 0.000000, 0.000000 },
-	{ -0.048916, 0.000526, 0.015078, -0.608731, 0.786690, -0.102794, 0.130068, -0.028857, -0.991085, 1.000000, 0.359760, 0.423410, 4, 1, 1, 1, 0.689709, 0.310291, 0.000000, 0.000000 },
-	{ -0.051323, -0.001674, 0.015129, -0.754783, 0.641404, -0.137491, 0.151529, -0.033449, -0.987887, 1.000000, 0.360400, 0.414520, 4, 1, 1, 1, 0.670677, 0.329323, 0.000000, 0.000000 },
-	{ -0.053302, -0.004431, 0.015664, -0.876335, 0.447686, -0.177804, 0.184963, -0.028091, -0.982344, 1.000000, 0.360110, 0.405730, 4, 1, 1, 1, 0.630347, 0.369653, 0.000000, 0.000000 },
-	{ -0.047299, 0.001634, 0.019650, -0.495768, 0.866511, 0.058075, 0.042018, 0.090726, -0.994989, 1.000000, 0.348540, 0.429860, 1, 4, 1, 1, 0.517297, 0.482703, 0.000000, 0.000000 },
-	{ -0.047947, 0.001351, 0.017715, -0.530765, 0.847483, 0.007914, 0.074384, 0.055883, -0.995663, 1.000000, 0.353240, 0.427550, 4, 1, 1, 1, 0.578999, 0.421001, 0.000000, 0.000000 },
-	{ -0.049744, -0.000166, 0.020798, -0.631391, 0.772729, 0.065078, 0.035252, 0.112436, -0.993034, 1.000000, 0.346400, 0.421950, 1, 4, 1, 1, 0.573379, 0.426621, 0.000000, 0.000000 },
-	{ -0.049765, 0.000024, 0.017860, -0.650595, 0.759425, -0.000797, 0.072819, 0.061340, -0.995457, 1.000000, 0.353380, 0.421460, 4, 1, 1, 1, 0.564643, 0.435357, 0.000000, 0.000000 },
-	{ -0.051999, -0.002159, 0.018296, -0.763007, 0.646123, -0.018611, 0.076978, 0.062242, -0.995088, 1.000000, 0.353060, 0.413090, 4, 1, 1, 1, 0.525720, 0.474280, 0.000000, 0.000000 },
-	{ -0.052117, -0.002497, 0.021683, -0.744731, 0.665834, 0.045169, 0.040602, 0.112762, -0.992792, 1.000000, 0.344990, 0.413170, 1, 4, 1, 1, 0.631453, 0.368548, 0.000000, 0.000000 },
-	{ -0.053889, -0.004825, 0.018974, -0.875063, 0.480665, -0.056789, 0.095901, 0.057182, -0.993747, 1.000000, 0.352270, 0.404770, 1, 4, 1, 1, 0.520852, 0.479148, 0.000000, 0.000000 },
-	{ -0.054093, -0.005155, 0.022543, -0.853438, 0.521175, 0.004414, 0.054470, 0.097612, -0.993733, 1.000000, 0.343590, 0.404750, 1, 4, 1, 1, 0.683210, 0.316790, 0.000000, 0.000000 },
-	{ -0.037493, 0.004783, 0.017167, -0.094810, 0.993339, -0.065496, 0.072958, -0.058682, -0.995607, 1.000000, 0.353530, 0.456610, 4, 1, 1, 1, 0.608304, 0.391696, 0.000000, 0.000000 },
-	{ -0.040325, 0.004416, 0.018918, -0.234504, 0.972024, -0.013329, 0.077997, 0.005146, -0.996941, 1.000000, 0.349560, 0.449410, 4, 1, 1, 1, 0.529196, 0.470804, 0.000000, 0.000000 },
-	{ -0.038850, 0.004763, 0.022572, -0.236787, 0.971512, -0.009840, 0.086795, 0.011065, -0.996165, 1.000000, 0.341350, 0.454300, 1, 4, 21, 1, 0.600121, 0.398871, 0.001008, 0.000000 },
-	{ -0.036050, 0.005132, 0.020867, -0.090430, 0.993499, -0.069149, 0.098955, -0.060127, -0.993274, 1.000000, 0.345450, 0.461510, 1, 4, 21, 1, 0.516053, 0.481592, 0.002356, 0.000000 },
-	{ -0.042083, 0.003717, 0.024673, -0.359403, 0.932657, 0.031331, 0.064305, 0.058247, -0.996229, 1.000000, 0.336330, 0.445620, 1, 4, 1, 1, 0.697807, 0.302193, 0.000000, 0.000000 },
-	{ -0.043345, 0.003416, 0.020913, -0.358910, 0.932674, 0.036107, 0.062177, 0.062489, -0.996107, 1.000000, 0.345080, 0.441410, 1, 4, 1, 1, 0.567033, 0.432967, 0.000000, 0.000000 },
-	{ -0.045570, 0.002037, 0.026886, -0.465167, 0.884209, 0.042358, 0.050374, 0.074212, -0.995970, 1.000000, 0.331160, 0.435850, 1, 4, 1, 1, 0.786266, 0.213734, 0.000000, 0.000000 },
-	{ -0.046415, 0.001869, 0.022812, -0.478254, 0.876047, 0.061768, 0.042839, 0.093521, -0.994695, 1.000000, 0.340910, 0.432870, 1, 4, 1, 1, 0.652518, 0.347482, 0.000000, 0.000000 },
-	{ -0.048893, -0.000107, 0.028747, -0.582761, 0.812113, 0.029371, 0.054043, 0.074793, -0.995734, 1.000000, 0.327020, 0.425970, 1, 4, 1, 1, 0.853185, 0.146816, 0.000000, 0.000000 },
-	{ -0.049341, -0.000165, 0.024377, -0.606522, 0.792833, 0.059562, 0.041405, 0.106310, -0.993471, 1.000000, 0.337710, 0.423830, 1, 4, 1, 1, 0.723752, 0.276248, 0.000000, 0.000000 },
-	{ -0.051927, -0.002630, 0.025557, -0.723270, 0.689423, 0.039710, 0.046427, 0.105919, -0.993290, 1.000000, 0.335520, 0.414470, 1, 4, 1, 1, 0.784257, 0.215743, 0.000000, 0.000000 },
-	{ -0.051707, -0.002570, 0.030039, -0.702836, 0.711328, 0.005872, 0.063811, 0.071377, -0.995406, 1.000000, 0.324280, 0.416310, 1, 4, 1, 1, 0.901802, 0.098198, 0.000000, 0.000000 },
-	{ -0.054096, -0.005335, 0.026529, -0.828250, 0.560331, 0.005604, 0.055044, 0.091307, -0.994300, 1.000000, 0.333640, 0.405520, 1, 4, 1, 1, 0.831979, 0.168021, 0.000000, 0.000000 },
-	{ -0.054063, -0.005277, 0.030959, -0.808206, 0.588689, -0.015751, 0.066742, 0.064990, -0.995652, 1.000000, 0.322260, 0.406920, 1, 4, 1, 1, 0.932851, 0.067149, 0.000000, 0.000000 },
-	{ -0.034730, 0.005549, 0.024401, -0.117572, 0.988085, -0.099325, 0.105443, -0.087032, -0.990610, 1.000000, 0.337750, 0.466250, 1, 4, 21, 1, 0.611779, 0.380821, 0.007400, 0.000000 },
-	{ -0.037519, 0.005166, 0.026344, -0.265929, 0.963275, -0.037193, 0.088486, -0.014027, -0.995979, 1.000000, 0.332840, 0.459000, 1, 4, 21, 1, 0.697768, 0.298672, 0.003560, 0.000000 },
-	{ -0.033411, 0.006144, 0.027663, -0.154229, 0.976872, -0.148104, 0.101772, -0.133393, -0.985824, 1.000000, 0.330490, 0.470960, 1, 4, 21, 22, 0.670740, 0.300921, 0.018171, 0.010167 },
-	{ -0.036131, 0.005791, 0.029922, -0.304160, 0.949055, -0.082353, 0.087000, -0.058413, -0.994494, 1.000000, 0.324600, 0.463890, 1, 4, 21, 1, 0.771444, 0.218814, 0.009742, 0.000000 },
-	{ -0.040916, 0.004040, 0.028957, -0.379958, 0.925004, -0.000740, 0.070989, 0.028362, -0.997074, 1.000000, 0.326290, 0.449830, 1, 4, 21, 1, 0.792723, 0.206051, 0.001226, 0.000000 },
-	{ -0.039530, 0.004706, 0.033338, -0.410132, 0.911034, -0.042535, 0.066859, -0.016480, -0.997626, 1.000000, 0.315840, 0.454870, 1, 4, 21, 1, 0.864143, 0.131783, 0.004074, 0.000000 },
-	{ -0.044849, 0.002206, 0.031936, -0.461531, 0.887115, 0.004030, 0.061097, 0.036318, -0.997471, 1.000000, 0.318930, 0.438740, 1, 4, 1, 1, 0.889936, 0.110064, 0.000000, 0.000000 },
-	{ -0.044172, 0.002646, 0.039113, -0.481560, 0.875688, -0.035645, 0.064145, -0.005346, -0.997926, 1.000000, 0.300370, 0.442100, 1, 4, 21, 1, 0.958737, 0.040005, 0.001258, 0.000000 },
-	{ -0.048633, -0.000000, 0.034030, -0.558156, 0.829719, -0.005287, 0.063784, 0.036553, -0.997294, 1.000000, 0.313690, 0.427770, 1, 4, 1, 1, 0.939835, 0.060165, 0.000000, 0.000000 },
-	{ -0.048767, 0.000049, 0.040548, -0.556972, 0.830020, -0.029150, 0.066450, 0.009550, -0.997744, 1.000000, 0.296590, 0.428600, 1, 4, 1, 1, 0.982976, 0.017024, 0.000000, 0.000000 },
-	{ -0.051639, -0.002391, 0.035220, -0.684875, 0.728372, -0.020487, 0.070628, 0.038375, -0.996764, 1.000000, 0.310860, 0.418020, 1, 4, 1, 1, 0.967351, 0.032649, 0.000000, 0.000000 },
-	{ -0.051746, -0.002236, 0.041277, -0.682212, 0.730643, -0.027345, 0.063425, 0.021879, -0.997747, 1.000000, 0.294770, 0.419200, 1, 4, 1, 1, 0.992893, 0.007107, 0.000000, 0.000000 },
-	{ -0.054052, -0.005037, 0.035975, -0.797640, 0.602545, -0.026664, 0.065076, 0.042027, -0.996995, 1.000000, 0.309040, 0.408620, 1, 4, 1, 1, 0.980990, 0.019010, 0.000000, 0.000000 },
-	{ -0.054048, -0.004764, 0.041757, -0.798290, 0.601944, -0.019915, 0.049093, 0.032078, -0.998279, 1.000000, 0.293420, 0.410210, 1, 4, 1, 1, 0.996560, 0.003440, 0.000000, 0.000000 },
-	{ -0.051949, -0.002197, 0.048119, -0.698193, 0.715859, -0.008505, 0.048850, 0.035785, -0.998165, 1.000000, 0.276050, 0.419810, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054014, -0.004588, 0.048321, -0.807368, 0.590039, 0.003344, 0.032762, 0.050485, -0.998187, 1.000000, 0.275280, 0.411530, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052117, -0.002490, 0.055475, -0.721175, 0.691813, 0.036081, 0.046564, 0.100374, -0.993860, 1.000000, 0.255790, 0.420240, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.053938, -0.004739, 0.055502, -0.818247, 0.573621, 0.037815, 0.031609, 0.110573, -0.993365, 1.000000, 0.255380, 0.412680, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052349, -0.003475, 0.063026, -0.738816, 0.669073, 0.080575, 0.065428, 0.190214, -0.979560, 1.000000, 0.235220, 0.420820, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.053947, -0.005516, 0.062986, -0.825796, 0.559979, 0.066966, 0.048559, 0.188900, -0.980795, 1.000000, 0.234900, 0.413820, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052751, -0.005062, 0.070559, -0.750322, 0.655348, 0.086806, 0.096821, 0.238836, -0.966221, 1.000000, 0.214960, 0.421760, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.051209, -0.003534, 0.070769, -0.666022, 0.738338, 0.106171, 0.112119, 0.239804, -0.964325, 1.000000, 0.214770, 0.427870, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050589, -0.001810, 0.063262, -0.647651, 0.756154, 0.093698, 0.084664, 0.193631, -0.977415, 1.000000, 0.234890, 0.427380, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.051889, -0.005100, 0.078071, -0.676457, 0.733474, 0.066508, 0.147246, 0.223174, -0.963593, 1.000000, 0.195190, 0.428960, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.053287, -0.006518, 0.077918, -0.755098, 0.654021, 0.045657, 0.133613, 0.221693, -0.965919, 1.000000, 0.195180, 0.423170, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054184, -0.006929, 0.070513, -0.830129, 0.553833, 0.064460, 0.081139, 0.234370, -0.968756, 1.000000, 0.214590, 0.415140, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054611, -0.008239, 0.077894, -0.829047, 0.558734, 0.022288, 0.118528, 0.214544, -0.969496, 1.000000, 0.194710, 0.416840, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.049605, -0.002291, 0.071202, -0.591947, 0.796808, 0.121222, 0.125433, 0.239648, -0.962723, 1.000000, 0.213870, 0.433650, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.048710, -0.000441, 0.063772, -0.575196, 0.811073, 0.106349, 0.099474, 0.198396, -0.975061, 1.000000, 0.233720, 0.433770, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.046808, 0.000677, 0.064566, -0.525226, 0.842320, 0.120976, 0.109682, 0.207987, -0.971963, 1.000000, 0.231740, 0.439970, 1, 21, 1, 1, 0.998857, 0.001143, 0.000000, 0.000000 },
-	{ -0.047996, -0.001293, 0.071864, -0.530986, 0.836644, 0.134465, 0.135977, 0.240754, -0.961014, 1.000000, 0.212300, 0.439130, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.049049, -0.003024, 0.078913, -0.532618, 0.840321, 0.100894, 0.170482, 0.223287, -0.959729, 1.000000, 0.193490, 0.439330, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050464, -0.003946, 0.078399, -0.601447, 0.794447, 0.084350, 0.159723, 0.223023, -0.961639, 1.000000, 0.194630, 0.434330, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.047722, 0.001050, 0.056168, -0.552211, 0.832845, 0.037848, 0.073318, 0.093735, -0.992894, 1.000000, 0.254210, 0.434850, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.045367, 0.002475, 0.057114, -0.518262, 0.853766, 0.049879, 0.079973, 0.106449, -0.991097, 1.000000, 0.251770, 0.442170, 1, 21, 1, 1, 0.998084, 0.001916, 0.000000, 0.000000 },
-	{ -0.046439, 0.001843, 0.048306, -0.518095, 0.854852, -0.028399, 0.067516, 0.007775, -0.997688, 1.000000, 0.275440, 0.437180, 1, 4, 1, 1, 0.993368, 0.006632, 0.000000, 0.000000 },
-	{ -0.043528, 0.003607, 0.049688, -0.500513, 0.865311, -0.026915, 0.066221, 0.007268, -0.997779, 1.000000, 0.271900, 0.446190, 1, 21, 4, 1, 0.993497, 0.003254, 0.003249, 0.000000 },
-	{ -0.040869, 0.004654, 0.042553, -0.474281, 0.878310, -0.060246, 0.060523, -0.035741, -0.997527, 1.000000, 0.291240, 0.452650, 1, 4, 21, 1, 0.974971, 0.019031, 0.005997, 0.000000 },
-	{ -0.037603, 0.005858, 0.036903, -0.428056, 0.900136, -0.080761, 0.057178, -0.062210, -0.996424, 1.000000, 0.306850, 0.461110, 1, 4, 21, 1, 0.901561, 0.086344, 0.012094, 0.000000 },
-	{ -0.034563, 0.006685, 0.033091, -0.331141, 0.935233, -0.125240, 0.076973, -0.105512, -0.991435, 1.000000, 0.317100, 0.469170, 1, 4, 21, 1, 0.812151, 0.164622, 0.023227, 0.000000 },
-	{ -0.032000, 0.006941, 0.030620, -0.183850, 0.962786, -0.198098, 0.093114, -0.183569, -0.978587, 1.000000, 0.323680, 0.475820, 1, 4, 21, 22, 0.702364, 0.235955, 0.038281, 0.023400 },
-	{ -0.049440, -0.000115, 0.048008, -0.582122, 0.812846, -0.020382, 0.063222, 0.020257, -0.997794, 1.000000, 0.276390, 0.428080, 1, 4, 1, 1, 0.997392, 0.002608, 0.000000, 0.000000 },
-	{ -0.050036, -0.000601, 0.055647, -0.620666, 0.783296, 0.034955, 0.060630, 0.092393, -0.993875, 1.000000, 0.255530, 0.427480, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.030455, 0.007890, 0.033350, -0.199070, 0.952367, -0.231015, 0.079539, -0.219253, -0.972421, 1.000000, 0.317140, 0.480890, 1, 4, 21, 22, 0.704447, 0.182154, 0.073894, 0.039505 },
-	{ -0.032889, 0.007718, 0.035940, -0.337493, 0.929573, -0.148299, 0.063419, -0.134731, -0.988851, 1.000000, 0.310100, 0.474590, 1, 4, 21, 22, 0.809416, 0.137363, 0.051321, 0.001900 },
-	{ -0.028759, 0.008915, 0.035958, -0.203101, 0.949104, -0.240732, 0.065413, -0.232155, -0.970477, 1.000000, 0.310640, 0.486180, 1, 21, 4, 22, 0.667463, 0.133725, 0.133000, 0.065812 },
-	{ -0.031160, 0.008786, 0.038677, -0.328897, 0.932234, -0.150887, 0.046341, -0.143651, -0.988543, 1.000000, 0.303140, 0.479980, 1, 4, 21, 22, 0.768175, 0.111276, 0.104751, 0.015798 },
-	{ -0.035692, 0.007074, 0.039898, -0.422216, 0.901047, -0.099239, 0.046766, -0.087679, -0.995051, 1.000000, 0.298980, 0.467050, 1, 4, 21, 1, 0.904296, 0.063353, 0.032351, 0.000000 },
-	{ -0.033911, 0.008215, 0.042720, -0.404930, 0.909194, -0.096945, 0.038676, -0.088899, -0.995290, 1.000000, 0.291370, 0.472460, 1, 21, 4, 22, 0.885275, 0.075580, 0.033824, 0.005321 },
-	{ -0.038562, 0.006137, 0.045249, -0.469191, 0.880623, -0.066059, 0.054689, -0.045686, -0.997458, 1.000000, 0.283980, 0.459690, 1, 21, 4, 1, 0.968518, 0.019542, 0.011940, 0.000000 },
-	{ -0.036678, 0.007330, 0.047881, -0.450751, 0.891060, -0.053261, 0.055551, -0.031550, -0.997957, 1.000000, 0.276860, 0.465410, 1, 21, 4, 22, 0.937685, 0.051178, 0.009502, 0.001636 },
-	{ -0.041105, 0.005079, 0.051521, -0.493917, 0.869406, -0.013388, 0.065581, 0.021895, -0.997607, 1.000000, 0.267150, 0.453630, 1, 21, 4, 1, 0.985859, 0.011770, 0.002371, 0.000000 },
-	{ -0.039110, 0.006230, 0.053605, -0.479430, 0.877477, 0.013467, 0.066931, 0.051861, -0.996409, 1.000000, 0.261680, 0.459690, 1, 21, 4, 1, 0.965865, 0.032708, 0.001428, 0.000000 },
-	{ -0.043184, 0.003653, 0.058402, -0.501653, 0.862114, 0.071448, 0.086632, 0.132243, -0.987424, 1.000000, 0.248520, 0.448900, 1, 21, 1, 1, 0.993018, 0.006982, 0.000000, 0.000000 },
-	{ -0.041293, 0.004542, 0.060008, -0.490138, 0.866069, 0.098433, 0.095833, 0.165786, -0.981494, 1.000000, 0.244420, 0.454800, 1, 21, 1, 1, 0.980316, 0.019684, 0.000000, 0.000000 },
-	{ -0.044969, 0.001568, 0.065609, -0.495549, 0.857792, 0.136471, 0.117022, 0.221623, -0.968085, 1.000000, 0.229110, 0.445830, 1, 21, 1, 1, 0.995984, 0.004016, 0.000000, 0.000000 },
-	{ -0.043284, 0.002279, 0.066887, -0.481006, 0.863801, 0.149936, 0.123491, 0.236069, -0.963858, 1.000000, 0.225830, 0.451240, 1, 21, 1, 1, 0.988798, 0.011202, 0.000000, 0.000000 },
-	{ -0.046430, -0.000515, 0.072720, -0.487466, 0.860821, 0.146164, 0.144359, 0.244554, -0.958830, 1.000000, 0.210160, 0.444320, 1, 21, 1, 1, 0.997757, 0.002243, 0.000000, 0.000000 },
-	{ -0.044930, 0.000116, 0.073729, -0.464165, 0.872014, 0.155383, 0.151252, 0.250881, -0.956128, 1.000000, 0.207610, 0.449240, 1, 21, 1, 1, 0.993883, 0.006117, 0.000000, 0.000000 },
-	{ -0.046323, -0.001721, 0.080356, -0.439690, 0.889057, 0.127475, 0.189006, 0.230344, -0.954578, 1.000000, 0.189980, 0.448560, 1, 21, 1, 1, 0.997097, 0.002903, 0.000000, 0.000000 },
-	{ -0.047671, -0.002300, 0.079582, -0.475328, 0.872103, 0.116188, 0.179970, 0.225647, -0.957442, 1.000000, 0.191890, 0.444050, 1, 21, 1, 1, 0.998774, 0.001226, 0.000000, 0.000000 },
-	{ -0.047660, -0.003083, 0.086828, -0.411898, 0.910153, 0.044289, 0.228852, 0.150370, -0.961778, 1.000000, 0.172760, 0.448850, 1, 21, 1, 1, 0.998611, 0.001389, 0.000000, 0.000000 },
-	{ -0.046441, -0.002599, 0.087403, -0.390635, 0.919517, 0.043503, 0.234456, 0.145080, -0.961240, 1.000000, 0.171450, 0.452950, 1, 21, 1, 1, 0.997052, 0.002948, 0.000000, 0.000000 },
-	{ -0.047867, -0.003003, 0.093755, -0.368573, 0.924297, -0.099140, 0.241692, -0.007699, -0.970322, 1.000000, 0.154230, 0.453570, 1, 21, 1, 1, 0.998792, 0.001208, 0.000000, 0.000000 },
-	{ -0.046661, -0.002499, 0.094129, -0.350700, 0.930921, -0.101962, 0.240608, -0.015654, -0.970496, 1.000000, 0.153490, 0.457450, 1, 21, 1, 1, 0.997677, 0.002323, 0.000000, 0.000000 },
-	{ -0.045180, -0.002105, 0.087889, -0.382101, 0.923216, 0.040891, 0.238226, 0.141157, -0.960897, 1.000000, 0.170370, 0.457070, 1, 21, 1, 1, 0.994218, 0.005782, 0.000000, 0.000000 },
-	{ -0.045338, -0.001980, 0.094426, -0.340325, 0.935131, -0.098539, 0.237754, -0.015812, -0.971197, 1.000000, 0.152950, 0.461580, 1, 21, 1, 1, 0.995573, 0.004427, 0.000000, 0.000000 },
-	{ -0.043805, -0.001553, 0.088210, -0.383223, 0.922726, 0.041435, 0.239026, 0.142403, -0.960515, 1.000000, 0.169730, 0.461390, 1, 21, 1, 1, 0.988895, 0.011105, 0.000000, 0.000000 },
-	{ -0.043839, -0.001419, 0.094653, -0.332457, 0.939232, -0.085528, 0.232797, -0.006156, -0.972506, 1.000000, 0.152600, 0.466120, 1, 21, 1, 1, 0.991508, 0.008492, 0.000000, 0.000000 },
-	{ -0.042218, -0.000889, 0.088309, -0.387893, 0.920253, 0.051707, 0.237667, 0.154065, -0.959051, 1.000000, 0.169680, 0.466130, 1, 21, 1, 1, 0.979100, 0.020900, 0.000000, 0.000000 },
-	{ -0.042127, -0.000807, 0.094872, -0.320021, 0.945387, -0.061887, 0.227632, 0.013318, -0.973656, 1.000000, 0.152220, 0.471220, 1, 21, 1, 1, 0.984072, 0.015928, 0.000000, 0.000000 },
-	{ -0.040331, -0.000081, 0.088225, -0.386074, 0.919379, 0.075429, 0.233753, 0.176604, -0.956123, 1.000000, 0.170100, 0.471550, 1, 21, 1, 1, 0.960358, 0.039642, 0.000000, 0.000000 },
-	{ -0.040212, -0.000168, 0.095230, -0.296529, 0.954526, -0.030851, 0.222304, 0.037571, -0.974253, 1.000000, 0.151410, 0.476910, 1, 21, 1, 1, 0.973097, 0.026903, 0.000000, 0.000000 },
-	{ -0.038123, 0.000835, 0.088177, -0.370940, 0.922231, 0.109055, 0.229921, 0.204980, -0.951378, 1.000000, 0.170380, 0.477830, 1, 21, 1, 1, 0.933007, 0.066993, 0.000000, 0.000000 },
-	{ -0.038170, 0.000432, 0.095876, -0.255923, 0.966693, 0.002884, 0.214564, 0.059712, -0.974883, 1.000000, 0.149730, 0.483070, 1, 21, 1, 1, 0.960807, 0.039193, 0.000000, 0.000000 },
-	{ -0.035708, 0.001713, 0.088551, -0.338719, 0.929888, 0.143451, 0.230319, 0.229770, -0.945600, 1.000000, 0.169470, 0.484910, 1, 21, 1, 1, 0.900155, 0.099845, 0.000000, 0.000000 },
-	{ -0.036108, 0.000894, 0.096837, -0.187138, 0.981450, 0.041654, 0.206353, 0.080733, -0.975142, 1.000000, 0.147190, 0.489420, 1, 21, 1, 1, 0.952820, 0.047180, 0.000000, 0.000000 },
-	{ -0.033337, 0.002358, 0.089567, -0.281152, 0.943237, 0.176800, 0.231108, 0.245358, -0.941482, 1.000000, 0.166820, 0.492270, 1, 21, 1, 1, 0.879327, 0.120673, 0.000000, 0.000000 },
-	{ -0.034086, 0.001091, 0.098060, -0.075103, 0.993020, 0.090940, 0.204537, 0.104599, -0.973254, 1.000000, 0.144040, 0.495790, 1, 21, 1, 1, 0.950139, 0.049861, 0.000000, 0.000000 },
-	{ -0.031115, 0.002653, 0.090992, -0.182773, 0.956705, 0.226519, 0.233074, 0.265996, -0.935373, 1.000000, 0.163220, 0.499360, 1, 21, 1, 1, 0.869024, 0.130976, 0.000000, 0.000000 },
-	{ -0.035892, 0.001105, 0.104477, 0.039070, 0.995686, -0.084160, 0.119332, -0.088271, -0.988923, 1.000000, 0.126230, 0.493710, 1, 21, 1, 1, 0.985085, 0.014915, 0.000000, 0.000000 },
-	{ -0.037932, 0.000963, 0.103423, -0.073438, 0.991122, -0.110832, 0.134442, -0.100279, -0.985835, 1.000000, 0.129030, 0.487610, 1, 21, 1, 1, 0.985105, 0.014895, 0.000000, 0.000000 },
-	{ -0.036753, 0.002240, 0.110743, 0.094509, 0.980310, -0.173378, 0.028137, -0.176719, -0.983859, 1.000000, 0.108520, 0.492460, 1, 21, 1, 1, 0.998829, 0.001171, 0.000000, 0.000000 },
-	{ -0.038918, 0.002135, 0.109872, -0.006414, 0.981196, -0.192909, 0.051801, -0.192328, -0.979963, 1.000000, 0.111020, 0.486480, 1, 21, 1, 1, 0.998499, 0.001501, 0.000000, 0.000000 },
-	{ -0.039923, 0.000634, 0.102601, -0.149419, 0.979028, -0.138483, 0.149504, -0.116075, -0.981924, 1.000000, 0.131070, 0.481810, 1, 21, 1, 1, 0.987530, 0.012471, 0.000000, 0.000000 },
-	{ -0.040993, 0.001895, 0.109204, -0.083500, 0.974143, -0.209938, 0.065809, -0.204823, -0.976584, 1.000000, 0.112530, 0.480830, 1, 21, 1, 1, 0.998486, 0.001514, 0.000000, 0.000000 },
-	{ -0.041866, 0.000197, 0.101999, -0.199820, 0.965991, -0.164115, 0.162618, -0.132475, -0.977756, 1.000000, 0.132530, 0.476160, 1, 21, 1, 1, 0.991423, 0.008577, 0.000000, 0.000000 },
-	{ -0.042965, 0.001581, 0.108757, -0.143312, 0.964188, -0.223166, 0.081279, -0.213266, -0.973608, 1.000000, 0.113360, 0.475450, 1, 21, 1, 1, 0.998799, 0.001201, 0.000000, 0.000000 },
-	{ -0.043688, -0.000281, 0.101595, -0.236721, 0.953439, -0.186860, 0.172953, -0.147902, -0.973762, 1.000000, 0.133340, 0.470890, 1, 21, 1, 1, 0.994918, 0.005082, 0.000000, 0.000000 },
-	{ -0.044789, 0.001212, 0.108432, -0.190186, 0.953791, -0.232619, 0.094243, -0.218113, -0.971363, 1.000000, 0.113850, 0.470420, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.045328, -0.000769, 0.101301, -0.267104, 0.941771, -0.204264, 0.182362, -0.158738, -0.970333, 1.000000, 0.133820, 0.466110, 1, 21, 1, 1, 0.997328, 0.002672, 0.000000, 0.000000 },
-	{ -0.046418, 0.000799, 0.108157, -0.229682, 0.943045, -0.240649, 0.106246, -0.221487, -0.969358, 1.000000, 0.114200, 0.465930, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.046772, -0.001258, 0.101028, -0.295707, 0.930830, -0.214738, 0.190546, -0.162799, -0.968085, 1.000000, 0.134290, 0.461840, 1, 21, 1, 1, 0.998601, 0.001399, 0.000000, 0.000000 },
-	{ -0.047852, 0.000350, 0.107898, -0.269537, 0.930482, -0.248099, 0.119128, -0.223438, -0.967411, 1.000000, 0.114580, 0.461920, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.048047, -0.001752, 0.100738, -0.326812, 0.919391, -0.218893, 0.197729, -0.159970, -0.967116, 1.000000, 0.134800, 0.457980, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.049113, -0.000129, 0.107639, -0.316943, 0.913963, -0.253414, 0.131367, -0.222311, -0.966085, 1.000000, 0.114990, 0.458310, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.049200, -0.002264, 0.100422, -0.362628, 0.906075, -0.218010, 0.203760, -0.151187, -0.967277, 1.000000, 0.135380, 0.454390, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050243, -0.000645, 0.107374, -0.372084, 0.892661, -0.254382, 0.141770, -0.216189, -0.966004, 1.000000, 0.115420, 0.455000, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050286, -0.002810, 0.100077, -0.404911, 0.889102, -0.213413, 0.208202, -0.137618, -0.968356, 1.000000, 0.136060, 0.450880, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.051293, -0.001214, 0.107097, -0.429717, 0.867592, -0.250256, 0.150780, -0.204313, -0.967224, 1.000000, 0.115920, 0.451810, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.051350, -0.003411, 0.099731, -0.457269, 0.864828, -0.207312, 0.210883, -0.121019, -0.969991, 1.000000, 0.136740, 0.447330, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052316, -0.001853, 0.106814, -0.487860, 0.838644, -0.242219, 0.157458, -0.188384, -0.969391, 1.000000, 0.116480, 0.448560, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052424, -0.004094, 0.099438, -0.521620, 0.828919, -0.202004, 0.211650, -0.103646, -0.971834, 1.000000, 0.137220, 0.443620, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.053348, -0.002580, 0.106566, -0.547963, 0.803654, -0.232115, 0.161896, -0.170348, -0.971994, 1.000000, 0.116920, 0.445140, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.053532, -0.004899, 0.099235, -0.592168, 0.781175, -0.197747, 0.210215, -0.087146, -0.973764, 1.000000, 0.137390, 0.439630, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054414, -0.003422, 0.106387, -0.610569, 0.760355, -0.221507, 0.164756, -0.151624, -0.974611, 1.000000, 0.117090, 0.441440, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054676, -0.005870, 0.099111, -0.662632, 0.723620, -0.193114, 0.206980, -0.070871, -0.975775, 1.000000, 0.137280, 0.435210, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055523, -0.004430, 0.106268, -0.675854, 0.706339, -0.210492, 0.166401, -0.131986, -0.977185, 1.000000, 0.117040, 0.437310, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055841, -0.007043, 0.099044, -0.733506, 0.653417, -0.187124, 0.201997, -0.053303, -0.977935, 1.000000, 0.136960, 0.430280, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.056657, -0.005648, 0.106191, -0.744849, 0.637433, -0.197175, 0.166079, -0.109093, -0.980060, 1.000000, 0.116850, 0.432670, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057000, -0.008472, 0.099020, -0.799850, 0.572639, -0.179789, 0.195287, -0.034952, -0.980123, 1.000000, 0.136430, 0.424710, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057794, -0.007129, 0.106165, -0.808075, 0.560304, -0.181862, 0.163552, -0.083191, -0.983021, 1.000000, 0.116370, 0.427410, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058133, -0.010208, 0.099010, -0.855248, 0.488748, -0.172269, 0.188123, -0.016934, -0.982000, 1.000000, 0.135770, 0.418250, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058918, -0.008931, 0.106162, -0.859629, 0.482806, -0.167144, 0.160817, -0.054829, -0.985460, 1.000000, 0.115720, 0.421270, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059191, -0.012247, 0.099004, -0.900023, 0.403206, -0.165479, 0.181135, 0.000704, -0.983458, 1.000000, 0.134940, 0.410900, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059980, -0.011045, 0.106152, -0.902925, 0.401636, -0.153017, 0.157151, -0.022856, -0.987310, 1.000000, 0.115000, 0.414250, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060132, -0.014589, 0.099034, -0.933990, 0.320019, -0.158907, 0.173766, 0.018229, -0.984618, 1.000000, 0.133800, 0.402640, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060936, -0.013455, 0.106174, -0.937036, 0.320089, -0.139667, 0.151437, 0.012045, -0.988394, 1.000000, 0.113950, 0.406390, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060943, -0.017250, 0.099129, -0.959030, 0.240188, -0.150240, 0.164331, 0.039640, -0.985609, 1.000000, 0.132210, 0.393460, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061754, -0.016157, 0.106263, -0.962963, 0.237844, -0.127015, 0.142694, 0.049834, -0.988512, 1.000000, 0.112490, 0.397670, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061582, -0.020188, 0.099329, -0.977823, 0.158208, -0.137232, 0.148493, 0.061643, -0.986991, 1.000000, 0.130120, 0.383650, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062384, -0.019157, 0.106478, -0.982004, 0.151041, -0.113379, 0.127436, 0.086868, -0.988036, 1.000000, 0.110540, 0.388290, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061999, -0.023347, 0.099698, -0.989830, 0.073675, -0.121690, 0.128086, 0.089399, -0.987726, 1.000000, 0.127360, 0.373620, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062784, -0.022426, 0.106909, -0.992481, 0.069128, -0.101009, 0.109646, 0.135346, -0.984713, 1.000000, 0.107780, 0.378560, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062163, -0.026677, 0.100280, -0.993939, -0.006611, -0.109731, 0.108003, 0.127365, -0.985958, 1.000000, 0.123890, 0.363770, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062955, -0.025882, 0.107591, -0.995514, 0.000197, -0.094610, 0.092930, 0.189654, -0.977443, 1.000000, 0.104190, 0.369040, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062076, -0.030301, 0.101079, -0.992347, -0.056497, -0.109794, 0.099194, 0.164769, -0.981332, 1.000000, 0.119660, 0.353830, 1, 12, 1, 1, 0.997433, 0.002567, 0.000000, 0.000000 },
-	{ -0.062944, -0.029602, 0.108454, -0.994691, -0.039659, -0.094953, 0.082733, 0.240479, -0.967122, 1.000000, 0.099930, 0.359600, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061908, -0.034378, 0.102042, -0.988740, -0.089132, -0.120206, 0.101270, 0.192854, -0.975988, 1.000000, 0.114500, 0.343020, 1, 12, 1, 1, 0.991043, 0.008957, 0.000000, 0.000000 },
-	{ -0.062873, -0.033734, 0.109342, -0.993147, -0.071710, -0.092282, 0.069493, 0.272504, -0.959642, 1.000000, 0.095340, 0.349240, 1, 12, 1, 1, 0.998895, 0.001105, 0.000000, 0.000000 },
-	{ -0.061611, -0.038709, 0.103119, -0.979614, -0.155912, -0.126682, 0.090926, 0.218196, -0.971660, 1.000000, 0.108720, 0.331890, 1, 12, 1, 1, 0.977937, 0.022063, 0.000000, 0.000000 },
-	{ -0.062581, -0.038126, 0.110139, -0.985871, -0.149639, -0.075279, 0.027972, 0.296030, -0.954769, 1.000000, 0.090800, 0.338090, 1, 12, 1, 1, 0.998106, 0.001894, 0.000000, 0.000000 },
-	{ -0.060899, -0.042955, 0.104241, -0.950230, -0.288937, -0.116526, 0.043624, 0.246941, -0.968048, 1.000000, 0.102900, 0.321500, 1, 12, 1, 1, 0.959999, 0.040001, 0.000000, 0.000000 },
-	{ -0.061760, -0.042474, 0.111012, -0.956567, -0.288338, -0.042903, -0.053741, 0.319078, -0.946204, 1.000000, 0.085830, 0.327470, 1, 12, 1, 1, 0.993096, 0.006904, 0.000000, 0.000000 },
-	{ -0.059435, -0.046926, 0.105383, -0.864348, -0.494704, -0.090386, -0.044049, 0.253518, -0.966327, 1.000000, 0.097240, 0.312100, 1, 12, 1, 1, 0.939558, 0.060442, 0.000000, 0.000000 },
-	{ -0.060184, -0.046543, 0.111963, -0.873680, -0.486496, -0.001969, -0.172057, 0.312773, -0.934114, 1.000000, 0.080690, 0.318220, 1, 12, 1, 1, 0.988503, 0.011497, 0.000000, 0.000000 },
-	{ -0.057014, -0.050205, 0.106443, -0.675760, -0.736230, -0.036239, -0.169852, 0.203365, -0.964258, 1.000000, 0.091950, 0.302710, 1, 12, 1, 1, 0.929582, 0.070418, 0.000000, 0.000000 },
-	{ -0.057741, -0.049828, 0.112803, -0.672944, -0.738563, 0.040884, -0.308921, 0.230394, -0.922760, 1.000000, 0.076110, 0.309790, 1, 12, 1, 1, 0.986130, 0.013870, 0.000000, 0.000000 },
-	{ -0.053278, -0.052512, 0.107043, -0.441485, -0.896126, 0.045272, -0.259974, 0.079462, -0.962341, 1.000000, 0.086970, 0.292410, 1, 12, 1, 1, 0.920437, 0.079563, 0.000000, 0.000000 },
-	{ -0.054116, -0.051889, 0.113547, -0.414464, -0.907681, 0.065839, -0.406144, 0.119741, -0.905930, 1.000000, 0.071060, 0.300520, 1, 12, 1, 1, 0.987032, 0.012968, 0.000000, 0.000000 },
-	{ -0.049740, -0.053518, 0.107468, -0.233857, -0.963195, 0.132536, -0.298724, -0.058542, -0.952542, 1.000000, 0.081140, 0.281980, 1, 12, 1, 1, 0.908183, 0.091817, 0.000000, 0.000000 },
-	{ -0.050191, -0.052893, 0.114281, -0.177804, -0.981147, 0.075736, -0.481012, 0.019512, -0.876497, 1.000000, 0.065000, 0.291500, 1, 12, 1, 1, 0.978756, 0.021244, 0.000000, 0.000000 },
-	{ -0.046813, -0.053683, 0.108266, -0.062100, -0.978966, 0.194342, -0.390971, -0.155296, -0.907207, 1.000000, 0.074470, 0.273120, 1, 12, 1, 1, 0.908279, 0.091721, 0.000000, 0.000000 },
-	{ -0.046986, -0.052890, 0.114914, 0.014421, -0.996554, 0.081679, -0.553080, -0.076004, -0.829654, 1.000000, 0.058730, 0.283880, 1, 12, 1, 1, 0.980462, 0.019538, 0.000000, 0.000000 },
-	{ -0.044091, -0.053414, 0.109337, 0.043982, -0.973928, 0.222555, -0.516329, -0.212872, -0.829512, 1.000000, 0.067230, 0.267100, 1, 12, 1, 1, 0.920986, 0.079014, 0.000000, 0.000000 },
-	{ -0.044169, -0.052522, 0.115730, 0.104366, -0.991421, 0.078691, -0.616816, -0.126593, -0.776860, 1.000000, 0.052020, 0.278330, 1, 12, 1, 1, 0.983106, 0.016894, 0.000000, 0.000000 },
-	{ -0.059710, -0.043769, 0.097603, -0.951806, -0.291454, -0.095501, 0.033208, 0.211618, -0.976788, 1.000000, 0.120040, 0.315350, 1, 12, 1, 1, 0.906268, 0.093732, 0.000000, 0.000000 },
-	{ -0.060514, -0.039534, 0.096273, -0.979432, -0.174659, -0.101030, 0.065857, 0.196571, -0.978275, 1.000000, 0.126840, 0.326020, 1, 12, 1, 1, 0.950487, 0.049513, 0.000000, 0.000000 },
-	{ -0.058957, -0.044712, 0.090936, -0.960235, -0.277238, -0.032983, -0.029788, 0.219196, -0.975226, 1.000000, 0.138130, 0.308800, 1, 12, 1, 1, 0.830834, 0.169166, 0.000000, 0.000000 },
-	{ -0.057544, -0.048702, 0.092274, -0.889780, -0.456094, 0.016409, -0.114196, 0.187684, -0.975569, 1.000000, 0.131370, 0.298560, 1, 12, 1, 1, 0.740026, 0.259974, 0.000000, 0.000000 },
-	{ -0.058253, -0.047545, 0.098823, -0.868029, -0.493003, -0.058932, -0.049035, 0.203230, -0.977903, 1.000000, 0.113880, 0.305690, 1, 12, 1, 1, 0.859575, 0.140425, 0.000000, 0.000000 },
-	{ -0.055105, -0.052034, 0.093537, -0.761062, -0.641376, 0.097061, -0.213764, 0.106704, -0.971040, 1.000000, 0.124670, 0.288350, 1, 12, 1, 1, 0.672395, 0.327605, 0.000000, 0.000000 },
-	{ -0.055721, -0.050782, 0.099928, -0.710474, -0.703658, 0.009595, -0.154764, 0.142934, -0.977557, 1.000000, 0.107770, 0.295660, 1, 12, 1, 1, 0.823230, 0.176770, 0.000000, 0.000000 },
-	{ -0.051865, -0.054971, 0.094738, -0.644694, -0.742785, 0.180666, -0.262038, -0.007289, -0.965030, 1.000000, 0.117140, 0.276930, 1, 12, 1, 1, 0.641662, 0.358338, 0.000000, 0.000000 },
-	{ -0.052322, -0.053476, 0.100731, -0.540652, -0.834317, 0.107750, -0.245539, 0.033997, -0.968790, 1.000000, 0.101720, 0.284600, 1, 12, 1, 1, 0.802964, 0.197036, 0.000000, 0.000000 },
-	{ -0.059885, -0.040296, 0.089484, -0.982387, -0.181985, -0.042403, 0.003259, 0.210200, -0.977653, 1.000000, 0.145420, 0.320080, 1, 12, 1, 1, 0.916409, 0.083591, 0.000000, 0.000000 },
-	{ -0.061007, -0.035205, 0.095012, -0.989523, -0.112265, -0.090776, 0.069760, 0.178700, -0.981428, 1.000000, 0.133390, 0.337310, 1, 12, 1, 1, 0.980676, 0.019324, 0.000000, 0.000000 },
-	{ -0.060497, -0.035876, 0.088177, -0.991905, -0.120735, -0.039345, 0.016034, 0.188278, -0.981985, 1.000000, 0.152100, 0.331770, 1, 12, 1, 1, 0.970700, 0.029300, 0.000000, 0.000000 },
-	{ -0.061303, -0.031114, 0.094007, -0.994230, -0.066163, -0.084437, 0.073542, 0.152626, -0.985544, 1.000000, 0.138790, 0.348420, 1, 12, 1, 1, 0.994798, 0.005202, 0.000000, 0.000000 },
-	{ -0.060848, -0.031761, 0.087166, -0.997312, -0.061587, -0.039701, 0.029253, 0.162120, -0.986338, 1.000000, 0.157540, 0.343330, 1, 12, 1, 1, 0.993076, 0.006924, 0.000000, 0.000000 },
-	{ -0.061396, -0.027497, 0.093269, -0.995853, 0.001158, -0.090972, 0.090430, 0.122323, -0.988362, 1.000000, 0.143030, 0.358870, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060907, -0.028058, 0.086414, -0.998671, 0.019819, -0.047571, 0.049914, 0.142284, -0.988567, 1.000000, 0.161920, 0.354330, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061183, -0.024170, 0.092751, -0.990049, 0.092138, -0.106369, 0.115271, 0.097392, -0.988548, 1.000000, 0.146470, 0.369100, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060640, -0.024677, 0.085879, -0.991157, 0.118392, -0.059922, 0.074982, 0.127150, -0.989045, 1.000000, 0.165450, 0.364970, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060698, -0.021026, 0.092418, -0.976578, 0.177041, -0.122279, 0.137696, 0.077544, -0.987435, 1.000000, 0.149240, 0.379400, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060068, -0.021496, 0.085531, -0.976387, 0.203629, -0.072141, 0.097797, 0.118878, -0.988081, 1.000000, 0.168250, 0.375570, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060017, -0.018080, 0.092220, -0.959261, 0.248920, -0.133633, 0.154905, 0.067837, -0.985598, 1.000000, 0.151440, 0.389510, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059304, -0.018473, 0.085323, -0.960917, 0.264799, -0.080751, 0.115469, 0.118262, -0.986246, 1.000000, 0.170480, 0.385970, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.048926, -0.056941, 0.095490, -0.533330, -0.796721, 0.284246, -0.307445, -0.130478, -0.942578, 1.000000, 0.109880, 0.265680, 1, 12, 1, 1, 0.648889, 0.351111, 0.000000, 0.000000 },
-	{ -0.049003, -0.055043, 0.101179, -0.375537, -0.897645, 0.230662, -0.290693, -0.122238, -0.948976, 1.000000, 0.095630, 0.273540, 1, 12, 1, 1, 0.798190, 0.201810, 0.000000, 0.000000 },
-	{ -0.046266, -0.058057, 0.096520, -0.412818, -0.822012, 0.392273, -0.377053, -0.237813, -0.895140, 1.000000, 0.102970, 0.256390, 1, 12, 1, 1, 0.688193, 0.311807, 0.000000, 0.000000 },
-	{ -0.046223, -0.055570, 0.102121, -0.225618, -0.915980, 0.331778, -0.327935, -0.249279, -0.911218, 1.000000, 0.088680, 0.264220, 1, 12, 1, 1, 0.817229, 0.182771, 0.000000, 0.000000 },
-	{ -0.043558, -0.058415, 0.097917, -0.283743, -0.829974, 0.480243, -0.453554, -0.325097, -0.829820, 1.000000, 0.095660, 0.249630, 1, 12, 1, 1, 0.723219, 0.276781, 0.000000, 0.000000 },
-	{ -0.043648, -0.055429, 0.103364, -0.102334, -0.913879, 0.392879, -0.426230, -0.316576, -0.847412, 1.000000, 0.081090, 0.257760, 1, 12, 1, 1, 0.836877, 0.163123, 0.000000, 0.000000 },
-	{ -0.059200, -0.015388, 0.092112, -0.937756, 0.318572, -0.138299, 0.167564, 0.066227, -0.983634, 1.000000, 0.153110, 0.398980, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058439, -0.015672, 0.085201, -0.943632, 0.320429, -0.082963, 0.129295, 0.126107, -0.983555, 1.000000, 0.172190, 0.395680, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058270, -0.013001, 0.092063, -0.906959, 0.398189, -0.137372, 0.177443, 0.065396, -0.981956, 1.000000, 0.154340, 0.407500, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057486, -0.013163, 0.085128, -0.917660, 0.389726, -0.077547, 0.141344, 0.137749, -0.980330, 1.000000, 0.173480, 0.404410, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057226, -0.010933, 0.092045, -0.863051, 0.487351, -0.132783, 0.187246, 0.064534, -0.980191, 1.000000, 0.155270, 0.415050, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.056425, -0.010967, 0.085080, -0.877205, 0.475705, -0.064934, 0.152274, 0.147394, -0.977286, 1.000000, 0.174480, 0.412170, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.056086, -0.009178, 0.092043, -0.805963, 0.578397, -0.126020, 0.197732, 0.062385, -0.978269, 1.000000, 0.155990, 0.421720, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055255, -0.009083, 0.085051, -0.820083, 0.570301, -0.047135, 0.163903, 0.155174, -0.974196, 1.000000, 0.175270, 0.419030, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054890, -0.007725, 0.092062, -0.737999, 0.664473, -0.117614, 0.208290, 0.058528, -0.976314, 1.000000, 0.156550, 0.427590, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054001, -0.007495, 0.085063, -0.750126, 0.660731, -0.027296, 0.176316, 0.160047, -0.971235, 1.000000, 0.175810, 0.425130, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.053671, -0.006528, 0.092134, -0.665407, 0.738581, -0.108318, 0.217814, 0.053313, -0.974533, 1.000000, 0.156880, 0.432820, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052700, -0.006171, 0.085161, -0.675052, 0.737724, -0.008237, 0.188643, 0.161802, -0.968625, 1.000000, 0.176010, 0.430650, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052463, -0.005542, 0.092288, -0.591491, 0.800143, -0.099553, 0.226216, 0.046168, -0.972983, 1.000000, 0.156920, 0.437550, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.051396, -0.005096, 0.085386, -0.598819, 0.800831, 0.009238, 0.200555, 0.161112, -0.966344, 1.000000, 0.175790, 0.435690, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.051289, -0.004737, 0.092546, -0.515684, 0.851729, -0.092885, 0.233099, 0.035149, -0.971818, 1.000000, 0.156610, 0.441860, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050119, -0.004251, 0.085755, -0.522959, 0.851978, 0.025454, 0.211635, 0.158717, -0.964375, 1.000000, 0.175120, 0.440320, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050147, -0.004082, 0.092903, -0.446473, 0.890208, -0.090505, 0.237951, 0.020616, -0.971058, 1.000000, 0.155970, 0.445880, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.048882, -0.003606, 0.086251, -0.455500, 0.889398, 0.038613, 0.221212, 0.155092, -0.962815, 1.000000, 0.174060, 0.444670, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.049014, -0.003519, 0.093328, -0.397962, 0.912598, -0.093762, 0.240856, 0.005316, -0.970546, 1.000000, 0.155110, 0.449750, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.036222, -0.000939, -0.028832, -0.561163, 0.691875, -0.454319, 0.102963, -0.486276, -0.867718, 1.000000, 0.459380, 0.472040, 5, 4, 1, 1, 0.710292, 0.289708, 0.000000, 0.000000 },
-	{ -0.037847, -0.003117, -0.029018, -0.760618, 0.417770, -0.496919, 0.231712, -0.540316, -0.808930, 1.000000, 0.462490, 0.465080, 5, 4, 1, 1, 0.650589, 0.349411, 0.000000, 0.000000 },
-	{ -0.035712, -0.003862, -0.032323, -0.713617, 0.414398, -0.564823, 0.287826, -0.561636, -0.775708, 1.000000, 0.470730, 0.470400, 5, 4, 6, 1, 0.877843, 0.120935, 0.001222, 0.000000 },
-	{ -0.034163, -0.001865, -0.032121, -0.539153, 0.665808, -0.515765, 0.161015, -0.519614, -0.839092, 1.000000, 0.467440, 0.477580, 5, 4, 6, 1, 0.894072, 0.104394, 0.001533, 0.000000 },
-	{ -0.034221, 0.000191, -0.028350, -0.251364, 0.905889, -0.340854, -0.008016, -0.354097, -0.935174, 1.000000, 0.457070, 0.478280, 5, 4, 1, 1, 0.714385, 0.285615, 0.000000, 0.000000 },
-	{ -0.032320, -0.000749, -0.031862, -0.281511, 0.875554, -0.392628, 0.053423, -0.394241, -0.917453, 1.000000, 0.465640, 0.484050, 5, 4, 6, 1, 0.895859, 0.101204, 0.002937, 0.000000 },
-	{ -0.038897, -0.006055, -0.028959, -0.853083, 0.175538, -0.491362, 0.325819, -0.556329, -0.764421, 1.000000, 0.466980, 0.456460, 5, 4, 1, 1, 0.610766, 0.389234, 0.000000, 0.000000 },
-	{ -0.036742, -0.006560, -0.032344, -0.802974, 0.187046, -0.565904, 0.380542, -0.569865, -0.728315, 1.000000, 0.475430, 0.462170, 5, 4, 6, 1, 0.824275, 0.174621, 0.001104, 0.000000 },
-	{ -0.039146, -0.008874, -0.028758, -0.884898, -0.120002, -0.450061, 0.428960, -0.586504, -0.687027, 1.000000, 0.471680, 0.449620, 5, 4, 1, 1, 0.635983, 0.364017, 0.000000, 0.000000 },
-	{ -0.037067, -0.009185, -0.032196, -0.836430, -0.099658, -0.538937, 0.487310, -0.585250, -0.648083, 1.000000, 0.479920, 0.455440, 5, 4, 1, 1, 0.811115, 0.188885, 0.000000, 0.000000 },
-	{ -0.036534, -0.011348, -0.031790, -0.765851, -0.462076, -0.447167, 0.642920, -0.538112, -0.545059, 1.000000, 0.483620, 0.450490, 5, 4, 6, 1, 0.839109, 0.158631, 0.002260, 0.000000 },
-	{ -0.038543, -0.011124, -0.028312, -0.799961, -0.483466, -0.355420, 0.592088, -0.539794, -0.598377, 1.000000, 0.475650, 0.444610, 5, 4, 1, 1, 0.634546, 0.365454, 0.000000, 0.000000 },
-	{ -0.035168, -0.013111, -0.031286, -0.652318, -0.679973, -0.334838, 0.739237, -0.473221, -0.479157, 1.000000, 0.488290, 0.446200, 5, 4, 6, 1, 0.871989, 0.124144, 0.003867, 0.000000 },
-	{ -0.037208, -0.012838, -0.027617, -0.656245, -0.708004, -0.260907, 0.708029, -0.458272, -0.537291, 1.000000, 0.479200, 0.439970, 5, 4, 1, 1, 0.657200, 0.342800, 0.000000, 0.000000 },
-	{ -0.035507, -0.014279, -0.027011, -0.574004, -0.791680, -0.209196, 0.761911, -0.422762, -0.490677, 1.000000, 0.483930, 0.435560, 5, 4, 1, 1, 0.711320, 0.288680, 0.000000, 0.000000 },
-	{ -0.033440, -0.014656, -0.030892, -0.590978, -0.763265, -0.261095, 0.776198, -0.449890, -0.441719, 1.000000, 0.494250, 0.442330, 5, 4, 6, 1, 0.905784, 0.089541, 0.004675, 0.000000 },
-	{ -0.031226, -0.003004, -0.036563, -0.548807, 0.651859, -0.523346, 0.214230, -0.495472, -0.841792, 1.000000, 0.479420, 0.485600, 5, 6, 4, 1, 0.946673, 0.033574, 0.019753, 0.000000 },
-	{ -0.029619, -0.001909, -0.036310, -0.337093, 0.845090, -0.414960, 0.134181, -0.393133, -0.909639, 1.000000, 0.477320, 0.491870, 5, 6, 4, 1, 0.941119, 0.042115, 0.016766, 0.000000 },
-	{ -0.032601, -0.004790, -0.036819, -0.697798, 0.424550, -0.576918, 0.314136, -0.542453, -0.779143, 1.000000, 0.482870, 0.478470, 5, 6, 4, 1, 0.948863, 0.029609, 0.021528, 0.000000 },
-	{ -0.033933, -0.009515, -0.036732, -0.818706, -0.069232, -0.570024, 0.493592, -0.592094, -0.637017, 1.000000, 0.491450, 0.463890, 5, 4, 6, 1, 0.936138, 0.052652, 0.011210, 0.000000 },
-	{ -0.033566, -0.007143, -0.036858, -0.781093, 0.203950, -0.590168, 0.397854, -0.565901, -0.722128, 1.000000, 0.487130, 0.470500, 5, 4, 6, 1, 0.949046, 0.030783, 0.020171, 0.000000 },
-	{ -0.033470, -0.011597, -0.036393, -0.773995, -0.412855, -0.480086, 0.630663, -0.570341, -0.526285, 1.000000, 0.495590, 0.459080, 5, 4, 6, 1, 0.941019, 0.030248, 0.028733, 0.000000 },
-	{ -0.032281, -0.013454, -0.035947, -0.686072, -0.627745, -0.367751, 0.721369, -0.521295, -0.455936, 1.000000, 0.500800, 0.454760, 5, 6, 4, 1, 0.939956, 0.040815, 0.019230, 0.000000 },
-	{ -0.030838, -0.015073, -0.035491, -0.621619, -0.727286, -0.290939, 0.767990, -0.492735, -0.409150, 1.000000, 0.506210, 0.450970, 5, 6, 4, 1, 0.934340, 0.052515, 0.013144, 0.000000 },
-	{ -0.027930, -0.004123, -0.041402, -0.561361, 0.633398, -0.532617, 0.259440, -0.476454, -0.840049, 1.000000, 0.492520, 0.493850, 5, 6, 4, 1, 0.852324, 0.146272, 0.001404, 0.000000 },
-	{ -0.026550, -0.002972, -0.041048, -0.387559, 0.810654, -0.438906, 0.200342, -0.390669, -0.898466, 1.000000, 0.490220, 0.499700, 5, 6, 1, 1, 0.793159, 0.206841, 0.000000, 0.000000 },
-	{ -0.025031, -0.005158, -0.045600, -0.562822, 0.609336, -0.558517, 0.302930, -0.476629, -0.825262, 1.000000, 0.504190, 0.500560, 5, 6, 1, 1, 0.594793, 0.405207, 0.000000, 0.000000 },
-	{ -0.025983, -0.006840, -0.046107, -0.681856, 0.415148, -0.602266, 0.359615, -0.526728, -0.770217, 1.000000, 0.508020, 0.494950, 6, 5, 1, 1, 0.544545, 0.455455, 0.000000, 0.000000 },
-	{ -0.029074, -0.005833, -0.041772, -0.692525, 0.422320, -0.584855, 0.331567, -0.533682, -0.777976, 1.000000, 0.496070, 0.487480, 5, 6, 4, 1, 0.799008, 0.199585, 0.001407, 0.000000 },
-	{ -0.026693, -0.008922, -0.046316, -0.760839, 0.205055, -0.615692, 0.423521, -0.561952, -0.710521, 1.000000, 0.512320, 0.488560, 5, 6, 1, 1, 0.583660, 0.416340, 0.000000, 0.000000 },
-	{ -0.029895, -0.008018, -0.041877, -0.772606, 0.209631, -0.599279, 0.400812, -0.570982, -0.716470, 1.000000, 0.500420, 0.480190, 5, 6, 4, 1, 0.859849, 0.138069, 0.002083, 0.000000 },
-	{ -0.023887, -0.003941, -0.045089, -0.419046, 0.768596, -0.483385, 0.258386, -0.409424, -0.874991, 1.000000, 0.501650, 0.505790, 5, 6, 1, 1, 0.525239, 0.474761, 0.000000, 0.000000 },
-	{ -0.030300, -0.010299, -0.041740, -0.815647, -0.040523, -0.577128, 0.476138, -0.613684, -0.629829, 1.000000, 0.504950, 0.473370, 5, 6, 4, 1, 0.906324, 0.089650, 0.004026, 0.000000 },
-	{ -0.027151, -0.011150, -0.046141, -0.799982, -0.028308, -0.599356, 0.493546, -0.599112, -0.630458, 1.000000, 0.516510, 0.481770, 5, 6, 1, 1, 0.643227, 0.356773, 0.000000, 0.000000 },
-	{ -0.027090, -0.013161, -0.045653, -0.784154, -0.335431, -0.522101, 0.604462, -0.603281, -0.520267, 1.000000, 0.520140, 0.476420, 5, 6, 1, 1, 0.564875, 0.435125, 0.000000, 0.000000 },
-	{ -0.030057, -0.012361, -0.041373, -0.792830, -0.365531, -0.487655, 0.600610, -0.604364, -0.523462, 1.000000, 0.509120, 0.468450, 5, 6, 4, 1, 0.841895, 0.156516, 0.001588, 0.000000 },
-	{ -0.029190, -0.014168, -0.040722, -0.710744, -0.592728, -0.378835, 0.701381, -0.555831, -0.446225, 1.000000, 0.513310, 0.463730, 5, 6, 1, 1, 0.805305, 0.194695, 0.000000, 0.000000 },
-	{ -0.026415, -0.014840, -0.044851, -0.705940, -0.577897, -0.409492, 0.708228, -0.569581, -0.417121, 1.000000, 0.523690, 0.471810, 5, 6, 1, 1, 0.506012, 0.493988, 0.000000, 0.000000 },
-	{ -0.028094, -0.015663, -0.040002, -0.632589, -0.711818, -0.305198, 0.766600, -0.519387, -0.377573, 1.000000, 0.517420, 0.459650, 5, 6, 1, 1, 0.743477, 0.256523, 0.000000, 0.000000 },
-	{ -0.025528, -0.016182, -0.043960, -0.622296, -0.712343, -0.324523, 0.779303, -0.524738, -0.342544, 1.000000, 0.526980, 0.467620, 6, 5, 1, 1, 0.562201, 0.437799, 0.000000, 0.000000 },
-	{ -0.027085, -0.016659, -0.039318, -0.549583, -0.799022, -0.243972, 0.822641, -0.466654, -0.324803, 1.000000, 0.520240, 0.456680, 5, 6, 1, 1, 0.759430, 0.240570, 0.000000, 0.000000 },
-	{ -0.024662, -0.017103, -0.043148, -0.536774, -0.804312, -0.254866, 0.835972, -0.466136, -0.289602, 1.000000, 0.529510, 0.464590, 6, 5, 1, 1, 0.509284, 0.490716, 0.000000, 0.000000 },
-	{ -0.026155, -0.017370, -0.038721, -0.482712, -0.852108, -0.202241, 0.859917, -0.417406, -0.293795, 1.000000, 0.522840, 0.454190, 5, 6, 1, 1, 0.773733, 0.226267, 0.000000, 0.000000 },
-	{ -0.023837, -0.017776, -0.042439, -0.473269, -0.856301, -0.206796, 0.869221, -0.415809, -0.267502, 1.000000, 0.531770, 0.461970, 5, 6, 1, 1, 0.558534, 0.441466, 0.000000, 0.000000 },
-	{ -0.025333, -0.017887, -0.038245, -0.407547, -0.899595, -0.156956, 0.894576, -0.358780, -0.266477, 1.000000, 0.524940, 0.452300, 5, 6, 1, 1, 0.736580, 0.263420, 0.000000, 0.000000 },
-	{ -0.023066, -0.018279, -0.041877, -0.405749, -0.900502, -0.156410, 0.900236, -0.364179, -0.238642, 1.000000, 0.533740, 0.459980, 6, 5, 1, 1, 0.512401, 0.487599, 0.000000, 0.000000 },
-	{ -0.024484, -0.018282, -0.037795, -0.315820, -0.943486, -0.100458, 0.922369, -0.280466, -0.265658, 1.000000, 0.526950, 0.450530, 5, 6, 1, 1, 0.741121, 0.258879, 0.000000, 0.000000 },
-	{ -0.022232, -0.018669, -0.041373, -0.322733, -0.941750, -0.094609, 0.927995, -0.295178, -0.227365, 1.000000, 0.535790, 0.458160, 6, 5, 1, 1, 0.524238, 0.475762, 0.000000, 0.000000 },
-	{ -0.023427, -0.018633, -0.037244, -0.240032, -0.969231, -0.054543, 0.938165, -0.217167, -0.269603, 1.000000, 0.529620, 0.448310, 5, 6, 1, 1, 0.744577, 0.255423, 0.000000, 0.000000 },
-	{ -0.021171, -0.019018, -0.040810, -0.248579, -0.967805, -0.039521, 0.946101, -0.233855, -0.224065, 1.000000, 0.538640, 0.456040, 6, 5, 1, 1, 0.533518, 0.466482, 0.000000, 0.000000 },
-	{ -0.022165, -0.018932, -0.036623, -0.112028, -0.993500, 0.020179, 0.954960, -0.113253, -0.274273, 1.000000, 0.532790, 0.445660, 5, 6, 1, 1, 0.736165, 0.263835, 0.000000, 0.000000 },
-	{ -0.019912, -0.019286, -0.040152, -0.124729, -0.990980, 0.049002, 0.966304, -0.132534, -0.220663, 1.000000, 0.542030, 0.453530, 6, 5, 1, 1, 0.538778, 0.461222, 0.000000, 0.000000 },
-	{ -0.025676, -0.018332, -0.033085, -0.238235, -0.970232, -0.043519, 0.915349, -0.209329, -0.343974, 1.000000, 0.519460, 0.439070, 5, 6, 4, 1, 0.911246, 0.082062, 0.006691, 0.000000 },
-	{ -0.024446, -0.018614, -0.032434, -0.107812, -0.993719, 0.030004, 0.939378, -0.111705, -0.324179, 1.000000, 0.522390, 0.436250, 5, 6, 4, 1, 0.911109, 0.082113, 0.006778, 0.000000 },
-	{ -0.026380, -0.018214, -0.028131, -0.088605, -0.993565, 0.070555, 0.913598, -0.109286, -0.391656, 1.000000, 0.511880, 0.427180, 5, 4, 6, 1, 0.933218, 0.047836, 0.018946, 0.000000 },
-	{ -0.027596, -0.018000, -0.028814, -0.226503, -0.973988, -0.006639, 0.893277, -0.205007, -0.400035, 1.000000, 0.509280, 0.430160, 5, 4, 6, 1, 0.944923, 0.036585, 0.018492, 0.000000 },
-	{ -0.027938, -0.017724, -0.024400, -0.056065, -0.991776, 0.115055, 0.881715, -0.103248, -0.460345, 1.000000, 0.502280, 0.419870, 5, 4, 6, 1, 0.833580, 0.163308, 0.003113, 0.000000 },
-	{ -0.029193, -0.017585, -0.025006, -0.195259, -0.980224, 0.032162, 0.874323, -0.188834, -0.447103, 1.000000, 0.499660, 0.422870, 5, 4, 6, 1, 0.807076, 0.190391, 0.002533, 0.000000 },
-	{ -0.028694, -0.017658, -0.029426, -0.314893, -0.947333, -0.058340, 0.876097, -0.266470, -0.401806, 1.000000, 0.506980, 0.432970, 5, 4, 6, 1, 0.928267, 0.051882, 0.019851, 0.000000 },
-	{ -0.030363, -0.017286, -0.025497, -0.297264, -0.954288, -0.031131, 0.862539, -0.254416, -0.437377, 1.000000, 0.497060, 0.425390, 5, 4, 1, 1, 0.759928, 0.240072, 0.000000, 0.000000 },
-	{ -0.026733, -0.017980, -0.033692, -0.317166, -0.944152, -0.089350, 0.909192, -0.275912, -0.311836, 1.000000, 0.517160, 0.441820, 5, 6, 4, 1, 0.896411, 0.098854, 0.004735, 0.000000 },
-	{ -0.027649, -0.017568, -0.034094, -0.414105, -0.898767, -0.143997, 0.883769, -0.359138, -0.299954, 1.000000, 0.514780, 0.443440, 5, 6, 4, 1, 0.901682, 0.089699, 0.008619, 0.000000 },
-	{ -0.029672, -0.017235, -0.029890, -0.412495, -0.903819, -0.113840, 0.857214, -0.342826, -0.384257, 1.000000, 0.504890, 0.435250, 5, 4, 6, 1, 0.913931, 0.072225, 0.013844, 0.000000 },
-	{ -0.031427, -0.016863, -0.025921, -0.399183, -0.912421, -0.090232, 0.840870, -0.325085, -0.432732, 1.000000, 0.494770, 0.427690, 5, 4, 1, 1, 0.741775, 0.258225, 0.000000, 0.000000 },
-	{ -0.028560, -0.016997, -0.034481, -0.494283, -0.848132, -0.190675, 0.838867, -0.407832, -0.360521, 1.000000, 0.512470, 0.445330, 5, 6, 4, 1, 0.911042, 0.077600, 0.011358, 0.000000 },
-	{ -0.030702, -0.016640, -0.030209, -0.491376, -0.855434, -0.163656, 0.830444, -0.403541, -0.384081, 1.000000, 0.502170, 0.437070, 5, 4, 6, 1, 0.909423, 0.081074, 0.009503, 0.000000 },
-	{ -0.032543, -0.016269, -0.026261, -0.477497, -0.867750, -0.137866, 0.816483, -0.380260, -0.434463, 1.000000, 0.491990, 0.429840, 5, 4, 1, 1, 0.740581, 0.259419, 0.000000, 0.000000 },
-	{ -0.029618, -0.016193, -0.034971, -0.554973, -0.799020, -0.231457, 0.806622, -0.448853, -0.384569, 1.000000, 0.509590, 0.447970, 5, 6, 4, 1, 0.921998, 0.065455, 0.012547, 0.000000 },
-	{ -0.031944, -0.015802, -0.030528, -0.542427, -0.814438, -0.206066, 0.803277, -0.430978, -0.411101, 1.000000, 0.498530, 0.439380, 5, 4, 6, 1, 0.912615, 0.081164, 0.006221, 0.000000 },
-	{ -0.033877, -0.015436, -0.026599, -0.527291, -0.831861, -0.173120, 0.793816, -0.409627, -0.449512, 1.000000, 0.488560, 0.432320, 5, 4, 1, 1, 0.742106, 0.257894, 0.000000, 0.000000 },
-	{ -0.037071, -0.013880, -0.023851, -0.599711, -0.780956, -0.174511, 0.718928, -0.430054, -0.546073, 1.000000, 0.475690, 0.430770, 4, 5, 1, 1, 0.564179, 0.435821, 0.000000, 0.000000 },
-	{ -0.038498, -0.012513, -0.024637, -0.711870, -0.674575, -0.195420, 0.631737, -0.493481, -0.597817, 1.000000, 0.472720, 0.435200, 4, 5, 1, 1, 0.560121, 0.439879, 0.000000, 0.000000 },
-	{ -0.038539, -0.013453, -0.020534, -0.653912, -0.732310, -0.190055, 0.677357, -0.454771, -0.578248, 1.000000, 0.467450, 0.425990, 4, 5, 1, 1, 0.788764, 0.211236, 0.000000, 0.000000 },
-	{ -0.039714, -0.012048, -0.021292, -0.771035, -0.603521, -0.203142, 0.575202, -0.523201, -0.628811, 1.000000, 0.465020, 0.430040, 4, 5, 1, 1, 0.780407, 0.219593, 0.000000, 0.000000 },
-	{ -0.039681, -0.010727, -0.025463, -0.854766, -0.457619, -0.244867, 0.491439, -0.561879, -0.665417, 1.000000, 0.469530, 0.440590, 4, 5, 1, 1, 0.529317, 0.470683, 0.000000, 0.000000 },
-	{ -0.040743, -0.010161, -0.022109, -0.890975, -0.393211, -0.227043, 0.426506, -0.553261, -0.715538, 1.000000, 0.461460, 0.436060, 4, 5, 1, 1, 0.737558, 0.262442, 0.000000, 0.000000 },
-	{ -0.041224, -0.007965, -0.022834, -0.963110, -0.082837, -0.256041, 0.258311, -0.551369, -0.793264, 1.000000, 0.458670, 0.441790, 4, 5, 1, 1, 0.741549, 0.258450, 0.000000, 0.000000 },
-	{ -0.040292, -0.008486, -0.026015, -0.941258, -0.122406, -0.314723, 0.326141, -0.571159, -0.753266, 1.000000, 0.465780, 0.445820, 4, 5, 1, 1, 0.558091, 0.441909, 0.000000, 0.000000 },
-	{ -0.040088, -0.005661, -0.026329, -0.917420, 0.187461, -0.350998, 0.214388, -0.510255, -0.832873, 1.000000, 0.461450, 0.452980, 4, 5, 1, 1, 0.553744, 0.446256, 0.000000, 0.000000 },
-	{ -0.040933, -0.005230, -0.023296, -0.938654, 0.220146, -0.265452, 0.129614, -0.488096, -0.863112, 1.000000, 0.454950, 0.449490, 4, 5, 1, 1, 0.698001, 0.301999, 0.000000, 0.000000 },
-	{ -0.038997, -0.002692, -0.026366, -0.823817, 0.448288, -0.346936, 0.112510, -0.470548, -0.875172, 1.000000, 0.456960, 0.461500, 4, 5, 1, 1, 0.557536, 0.442464, 0.000000, 0.000000 },
-	{ -0.039812, -0.002362, -0.023330, -0.841868, 0.479009, -0.248612, 0.027625, -0.421810, -0.906263, 1.000000, 0.450670, 0.457920, 4, 5, 1, 1, 0.709576, 0.290424, 0.000000, 0.000000 },
-	{ -0.038139, -0.000100, -0.022987, -0.645208, 0.735209, -0.207785, -0.068523, -0.326559, -0.942690, 1.000000, 0.447090, 0.465180, 4, 5, 1, 1, 0.721331, 0.278669, 0.000000, 0.000000 },
-	{ -0.037354, -0.000401, -0.026087, -0.616277, 0.723701, -0.310580, 0.003596, -0.391783, -0.920051, 1.000000, 0.453550, 0.468690, 4, 5, 1, 1, 0.513910, 0.486090, 0.000000, 0.000000 },
-	{ -0.036127, 0.001174, -0.022365, -0.340860, 0.927219, -0.155175, -0.118900, -0.206253, -0.971248, 1.000000, 0.444240, 0.471300, 4, 5, 1, 1, 0.732216, 0.267784, 0.000000, 0.000000 },
-	{ -0.035343, 0.000822, -0.025467, -0.282988, 0.928446, -0.240635, -0.070323, -0.270301, -0.960204, 1.000000, 0.450720, 0.474600, 4, 5, 1, 1, 0.513760, 0.486240, 0.000000, 0.000000 },
-	{ -0.033276, 0.001164, -0.024676, -0.019504, 0.984471, -0.174462, -0.084053, -0.175492, -0.980886, 1.000000, 0.448170, 0.480290, 4, 5, 1, 1, 0.511908, 0.488092, 0.000000, 0.000000 },
-	{ -0.034121, 0.001593, -0.021562, -0.077725, 0.989422, -0.122491, -0.116974, -0.131064, -0.984449, 1.000000, 0.441440, 0.476770, 4, 5, 1, 1, 0.725837, 0.274163, 0.000000, 0.000000 },
-	{ -0.031313, 0.001104, -0.023930, 0.100761, 0.985791, -0.134402, -0.082161, -0.126383, -0.988573, 1.000000, 0.445740, 0.486040, 5, 4, 1, 1, 0.511049, 0.488951, 0.000000, 0.000000 },
-	{ -0.032262, 0.001610, -0.020765, 0.073261, 0.990903, -0.112893, -0.105329, -0.104876, -0.988892, 1.000000, 0.438690, 0.482220, 4, 5, 1, 1, 0.722141, 0.277859, 0.000000, 0.000000 },
-	{ -0.029594, 0.000893, -0.023294, 0.168391, 0.980452, -0.101773, -0.093292, -0.086932, -0.991836, 1.000000, 0.443590, 0.491420, 5, 4, 1, 1, 0.507847, 0.492153, 0.000000, 0.000000 },
-	{ -0.030614, 0.001454, -0.020147, 0.167289, 0.980522, -0.102913, -0.108112, -0.085510, -0.990454, 1.000000, 0.436620, 0.487150, 4, 5, 1, 1, 0.747499, 0.252501, 0.000000, 0.000000 },
-	{ -0.028163, 0.000633, -0.022723, 0.242593, 0.968095, -0.062773, -0.088018, -0.042476, -0.995213, 1.000000, 0.441830, 0.495680, 5, 4, 1, 1, 0.617416, 0.382584, 0.000000, 0.000000 },
-	{ -0.029157, 0.001176, -0.019637, 0.264877, 0.961292, -0.075882, -0.102564, -0.050161, -0.993461, 1.000000, 0.434860, 0.491510, 4, 5, 1, 1, 0.657877, 0.342123, 0.000000, 0.000000 },
-	{ -0.027727, 0.000730, -0.019126, 0.395491, 0.918035, -0.028267, -0.079960, 0.003755, -0.996791, 1.000000, 0.433020, 0.496060, 4, 5, 1, 1, 0.638430, 0.361570, 0.000000, 0.000000 },
-	{ -0.026832, 0.000243, -0.022106, 0.363234, 0.931690, -0.003902, -0.061661, 0.019860, -0.997900, 1.000000, 0.439780, 0.499840, 5, 4, 1, 1, 0.565326, 0.434674, 0.000000, 0.000000 },
-	{ -0.025623, -0.000397, -0.021457, 0.552055, 0.829416, 0.085464, -0.013905, 0.111642, -0.993651, 1.000000, 0.437560, 0.503870, 5, 4, 1, 1, 0.565989, 0.434011, 0.000000, 0.000000 },
-	{ -0.026387, 0.000018, -0.018600, 0.585752, 0.809539, 0.039268, -0.039347, 0.076796, -0.996270, 1.000000, 0.431030, 0.500590, 4, 5, 1, 1, 0.620911, 0.379089, 0.000000, 0.000000 },
-	{ -0.024467, -0.000652, -0.024525, 0.493963, 0.861162, 0.120005, -0.002751, 0.139566, -0.990209, 1.000000, 0.444960, 0.507980, 5, 4, 1, 1, 0.766348, 0.233652, 0.000000, 0.000000 },
-	{ -0.025680, -0.000091, -0.025297, 0.314554, 0.949060, 0.018468, -0.049990, 0.035991, -0.998101, 1.000000, 0.447380, 0.504090, 5, 4, 1, 1, 0.785495, 0.214505, 0.000000, 0.000000 },
-	{ -0.022928, -0.001004, -0.028388, 0.462279, 0.883478, 0.075934, -0.007200, 0.089371, -0.995973, 1.000000, 0.454890, 0.513440, 5, 4, 6, 1, 0.913971, 0.075114, 0.010914, 0.000000 },
-	{ -0.024201, -0.000497, -0.029209, 0.295325, 0.955272, -0.015466, -0.037454, -0.004600, -0.999288, 1.000000, 0.457280, 0.509440, 5, 4, 6, 1, 0.926952, 0.064901, 0.008148, 0.000000 },
-	{ -0.026980, 0.000214, -0.026005, 0.198563, 0.978963, -0.046958, -0.071690, -0.033276, -0.996872, 1.000000, 0.449520, 0.500150, 5, 4, 1, 1, 0.843326, 0.156674, 0.000000, 0.000000 },
-	{ -0.025500, -0.000250, -0.029944, 0.173044, 0.981761, -0.078755, -0.042024, -0.072528, -0.996481, 1.000000, 0.459380, 0.505530, 5, 4, 6, 1, 0.948954, 0.044061, 0.006986, 0.000000 },
-	{ -0.021112, -0.001726, -0.032902, 0.439501, 0.897391, 0.039101, 0.050819, 0.018620, -0.998535, 1.000000, 0.467680, 0.519590, 5, 6, 4, 1, 0.918685, 0.068006, 0.013309, 0.000000 },
-	{ -0.022380, -0.001250, -0.033711, 0.291300, 0.955630, -0.043770, 0.034325, -0.056166, -0.997831, 1.000000, 0.469680, 0.515380, 5, 6, 4, 1, 0.930727, 0.057420, 0.011853, 0.000000 },
-	{ -0.023610, -0.001036, -0.034441, 0.165021, 0.980379, -0.107821, 0.034614, -0.115009, -0.992761, 1.000000, 0.471560, 0.511530, 5, 6, 4, 1, 0.937018, 0.052621, 0.010362, 0.000000 },
-	{ -0.021468, -0.001894, -0.038831, 0.171516, 0.977728, -0.120959, 0.131834, -0.144452, -0.980690, 1.000000, 0.484460, 0.516810, 5, 6, 1, 1, 0.776237, 0.223763, 0.000000, 0.000000 },
-	{ -0.020294, -0.002106, -0.038064, 0.287471, 0.956138, -0.056215, 0.133191, -0.098029, -0.986231, 1.000000, 0.482920, 0.520820, 5, 6, 4, 1, 0.775112, 0.223615, 0.001274, 0.000000 },
-	{ -0.019474, -0.002774, -0.042507, 0.174859, 0.976201, -0.128283, 0.209362, -0.164176, -0.963958, 1.000000, 0.495720, 0.521020, 6, 5, 1, 1, 0.524756, 0.475244, 0.000000, 0.000000 },
-	{ -0.018317, -0.002957, -0.041662, 0.268670, 0.961381, -0.059692, 0.205828, -0.117840, -0.971467, 1.000000, 0.494260, 0.525250, 6, 5, 1, 1, 0.513659, 0.486341, 0.000000, 0.000000 },
-	{ -0.017119, -0.003331, -0.040724, 0.377623, 0.925478, 0.029854, 0.217573, -0.057345, -0.974358, 1.000000, 0.492500, 0.529750, 6, 5, 1, 1, 0.500855, 0.499145, 0.000000, 0.000000 },
-	{ -0.019057, -0.002543, -0.037234, 0.414673, 0.909586, 0.026433, 0.143305, -0.036591, -0.989002, 1.000000, 0.481310, 0.525210, 5, 6, 4, 1, 0.766603, 0.232105, 0.001292, 0.000000 },
-	{ -0.028373, 0.000396, -0.026622, 0.124680, 0.987250, -0.098957, -0.076036, -0.089935, -0.993041, 1.000000, 0.451490, 0.496120, 5, 4, 1, 1, 0.782547, 0.217453, 0.000000, 0.000000 },
-	{ -0.026835, -0.000143, -0.030535, 0.078447, 0.987641, -0.135687, -0.038969, -0.132965, -0.990355, 1.000000, 0.460990, 0.501560, 5, 4, 6, 1, 0.935617, 0.054936, 0.009447, 0.000000 },
-	{ -0.024832, -0.001008, -0.035055, 0.050960, 0.984669, -0.166827, 0.040187, -0.168930, -0.984809, 1.000000, 0.473040, 0.507780, 5, 6, 4, 1, 0.929726, 0.063548, 0.006726, 0.000000 },
-	{ -0.022569, -0.001879, -0.039569, 0.053949, 0.982293, -0.179419, 0.133602, -0.185166, -0.973583, 1.000000, 0.486150, 0.513210, 5, 6, 1, 1, 0.761154, 0.238846, 0.000000, 0.000000 },
-	{ -0.020559, -0.002751, -0.043301, 0.073075, 0.978769, -0.191499, 0.213863, -0.202924, -0.955555, 1.000000, 0.497300, 0.517160, 6, 5, 1, 1, 0.541771, 0.458229, 0.000000, 0.000000 },
-	{ -0.030092, 0.000515, -0.027164, 0.060853, 0.985615, -0.157673, -0.059483, -0.154104, -0.986263, 1.000000, 0.453190, 0.490810, 5, 4, 1, 1, 0.756969, 0.243031, 0.000000, 0.000000 },
-	{ -0.028408, -0.000176, -0.031041, -0.001371, 0.980668, -0.195676, -0.012429, -0.195678, -0.980590, 1.000000, 0.462480, 0.496880, 5, 4, 6, 1, 0.919719, 0.071921, 0.008360, 0.000000 },
-	{ -0.026195, -0.001138, -0.035630, -0.047493, 0.973399, -0.224139, 0.069019, -0.220658, -0.972906, 1.000000, 0.474760, 0.503600, 5, 6, 4, 1, 0.909557, 0.081181, 0.009262, 0.000000 },
-	{ -0.023705, -0.002036, -0.040267, -0.065206, 0.968311, -0.241085, 0.150186, -0.229323, -0.961694, 1.000000, 0.488030, 0.509570, 5, 6, 1, 1, 0.706339, 0.293661, 0.000000, 0.000000 },
-	{ -0.021604, -0.002883, -0.044022, -0.057781, 0.961947, -0.267057, 0.214219, -0.249327, -0.944429, 1.000000, 0.498800, 0.513630, 6, 5, 1, 1, 0.519788, 0.480212, 0.000000, 0.000000 },
-	{ -0.032153, 0.000506, -0.027712, -0.027130, 0.973522, -0.226980, -0.047839, -0.228068, -0.972469, 1.000000, 0.454810, 0.484170, 5, 4, 1, 1, 0.730005, 0.269995, 0.000000, 0.000000 },
-	{ -0.030347, -0.000367, -0.031488, -0.085395, 0.960162, -0.266076, 0.010636, -0.266158, -0.963871, 1.000000, 0.464240, 0.490380, 5, 4, 6, 1, 0.909061, 0.085769, 0.005171, 0.000000 },
-	{ -0.027869, -0.001404, -0.036066, -0.152364, 0.942873, -0.296271, 0.097627, -0.283947, -0.953857, 1.000000, 0.476290, 0.497890, 5, 6, 4, 1, 0.927925, 0.059590, 0.012485, 0.000000 },
-	{ -0.025059, -0.002367, -0.040763, -0.205283, 0.922975, -0.325540, 0.167464, -0.294593, -0.940835, 1.000000, 0.489320, 0.505010, 5, 6, 1, 1, 0.767249, 0.232751, 0.000000, 0.000000 },
-	{ -0.022709, -0.003232, -0.044626, -0.234465, 0.897591, -0.373305, 0.223943, -0.323810, -0.919237, 1.000000, 0.500290, 0.509980, 5, 6, 1, 1, 0.531034, 0.468966, 0.000000, 0.000000 },
-	{ -0.018033, -0.007519, -0.052619, -0.413441, 0.520377, -0.747177, 0.498745, -0.557117, -0.663983, 1.000000, 0.525560, 0.513470, 6, 5, 1, 1, 0.979754, 0.020246, 0.000000, 0.000000 },
-	{ -0.018835, -0.009060, -0.053049, -0.493427, 0.361101, -0.791288, 0.554503, -0.570308, -0.606032, 1.000000, 0.528630, 0.507950, 6, 5, 1, 1, 0.981539, 0.018461, 0.000000, 0.000000 },
-	{ -0.015685, -0.009970, -0.055416, -0.505291, 0.365703, -0.781628, 0.557327, -0.553230, -0.619131, 1.000000, 0.537170, 0.513410, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014937, -0.008467, -0.054997, -0.429538, 0.517338, -0.740174, 0.518967, -0.529359, -0.671158, 1.000000, 0.534320, 0.518890, 6, 5, 1, 1, 0.998795, 0.001205, 0.000000, 0.000000 },
-	{ -0.017177, -0.006348, -0.052076, -0.319058, 0.662919, -0.677304, 0.440060, -0.529318, -0.725375, 1.000000, 0.523190, 0.518140, 6, 5, 1, 1, 0.978244, 0.021756, 0.000000, 0.000000 },
-	{ -0.014187, -0.007356, -0.054481, -0.334659, 0.658594, -0.673986, 0.474927, -0.499871, -0.724274, 1.000000, 0.532080, 0.523190, 6, 5, 1, 1, 0.998046, 0.001954, 0.000000, 0.000000 },
-	{ -0.016279, -0.011782, -0.055678, -0.566533, 0.203945, -0.798403, 0.587819, -0.578996, -0.565006, 1.000000, 0.540850, 0.507440, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019414, -0.010902, -0.053309, -0.564120, 0.185589, -0.804565, 0.599943, -0.577358, -0.553829, 1.000000, 0.532480, 0.502060, 6, 5, 1, 1, 0.985804, 0.014196, 0.000000, 0.000000 },
-	{ -0.019679, -0.012856, -0.053352, -0.619846, -0.002207, -0.784721, 0.630408, -0.596905, -0.496276, 1.000000, 0.536790, 0.496550, 6, 5, 1, 1, 0.983522, 0.016478, 0.000000, 0.000000 },
-	{ -0.016615, -0.013683, -0.055728, -0.615530, 0.026303, -0.787674, 0.611190, -0.615052, -0.498154, 1.000000, 0.544860, 0.501920, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016657, -0.015424, -0.055527, -0.649899, -0.175318, -0.739524, 0.639480, -0.651980, -0.407416, 1.000000, 0.548510, 0.497490, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019655, -0.014661, -0.053120, -0.651431, -0.219463, -0.726274, 0.672269, -0.610696, -0.418454, 1.000000, 0.540670, 0.491890, 6, 5, 1, 1, 0.987127, 0.012873, 0.000000, 0.000000 },
-	{ -0.019336, -0.016169, -0.052649, -0.645019, -0.441334, -0.623838, 0.729114, -0.599848, -0.329507, 1.000000, 0.543970, 0.488150, 6, 5, 1, 1, 0.990761, 0.009239, 0.000000, 0.000000 },
-	{ -0.016395, -0.016892, -0.055167, -0.660785, -0.377594, -0.648680, 0.677616, -0.671796, -0.299211, 1.000000, 0.551890, 0.494180, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018738, -0.017378, -0.052112, -0.609497, -0.615283, -0.499940, 0.778672, -0.583081, -0.231706, 1.000000, 0.547110, 0.485220, 6, 5, 1, 1, 0.990614, 0.009386, 0.000000, 0.000000 },
-	{ -0.015859, -0.018108, -0.054803, -0.648633, -0.539045, -0.537313, 0.718181, -0.667207, -0.197615, 1.000000, 0.555300, 0.491950, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.011608, -0.009377, -0.057651, -0.447636, 0.525297, -0.723661, 0.528394, -0.497489, -0.687971, 1.000000, 0.543980, 0.524400, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.010851, -0.008368, -0.057194, -0.345479, 0.667665, -0.659446, 0.503509, -0.461118, -0.730650, 1.000000, 0.542490, 0.528420, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.008730, -0.010276, -0.060167, -0.457090, 0.525419, -0.717637, 0.542397, -0.474793, -0.693093, 1.000000, 0.552880, 0.528290, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007955, -0.009458, -0.059872, -0.336002, 0.677054, -0.654753, 0.536190, -0.434023, -0.723965, 1.000000, 0.552420, 0.531710, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007061, -0.011050, -0.061810, -0.444531, 0.502280, -0.741692, 0.589542, -0.459345, -0.664412, 1.000000, 0.558720, 0.529750, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006840, -0.012417, -0.062700, -0.494948, 0.341248, -0.799110, 0.609826, -0.518703, -0.599216, 1.000000, 0.561140, 0.527100, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005427, -0.012538, -0.063446, -0.276172, 0.399837, -0.873990, 0.665591, -0.576439, -0.474032, 1.000000, 0.564260, 0.529310, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006218, -0.010745, -0.061992, -0.290745, 0.610069, -0.737078, 0.625548, -0.461709, -0.628900, 1.000000, 0.559880, 0.531740, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006879, -0.014393, -0.063356, -0.532536, 0.192571, -0.824210, 0.605281, -0.594029, -0.529873, 1.000000, 0.564220, 0.522890, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005239, -0.014690, -0.064267, -0.288049, 0.178516, -0.940830, 0.659796, -0.675061, -0.330094, 1.000000, 0.567730, 0.525320, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.009345, -0.011672, -0.060617, -0.539332, 0.358494, -0.761973, 0.565884, -0.515802, -0.643213, 1.000000, 0.554870, 0.523950, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.009764, -0.013599, -0.061061, -0.589597, 0.204243, -0.781448, 0.570901, -0.579017, -0.582075, 1.000000, 0.557830, 0.518860, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.010235, -0.015629, -0.061003, -0.630896, 0.052616, -0.774082, 0.551364, -0.671530, -0.495021, 1.000000, 0.561110, 0.513660, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007385, -0.016384, -0.063295, -0.571490, 0.043984, -0.819430, 0.576483, -0.689137, -0.439043, 1.000000, 0.567140, 0.518250, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.008265, -0.018062, -0.062592, -0.607975, -0.084609, -0.789435, 0.514837, -0.798938, -0.310870, 1.000000, 0.569520, 0.513790, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006945, -0.018487, -0.063357, -0.384410, -0.309454, -0.869751, 0.592244, -0.805377, 0.024792, 1.000000, 0.572190, 0.515920, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.009061, -0.019030, -0.061780, -0.651197, -0.245935, -0.717954, 0.525919, -0.828280, -0.193291, 1.000000, 0.570530, 0.510980, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.008482, -0.019579, -0.061939, -0.489284, -0.511751, -0.706195, 0.666360, -0.741763, 0.075842, 1.000000, 0.572340, 0.511360, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.010313, -0.019687, -0.060018, -0.639291, -0.500374, -0.583894, 0.660377, -0.746278, -0.083500, 1.000000, 0.569660, 0.505820, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.010646, -0.018768, -0.060236, -0.687509, -0.273517, -0.672696, 0.556110, -0.794020, -0.245508, 1.000000, 0.567380, 0.507010, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.010649, -0.017428, -0.060560, -0.666340, -0.087450, -0.740502, 0.514405, -0.772844, -0.371617, 1.000000, 0.564530, 0.509410, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005771, -0.016763, -0.064218, -0.329414, -0.076782, -0.941058, 0.615407, -0.773351, -0.152323, 1.000000, 0.570490, 0.520670, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012344, -0.010848, -0.058077, -0.527329, 0.371040, -0.764365, 0.550512, -0.536039, -0.639999, 1.000000, 0.546320, 0.519200, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012970, -0.012690, -0.058332, -0.586780, 0.209973, -0.782050, 0.561494, -0.590381, -0.579806, 1.000000, 0.549510, 0.513320, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013387, -0.014653, -0.058316, -0.631152, 0.040924, -0.774579, 0.571148, -0.651150, -0.499793, 1.000000, 0.553290, 0.507800, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013504, -0.016448, -0.058086, -0.664058, -0.133949, -0.735585, 0.582916, -0.708857, -0.397153, 1.000000, 0.556950, 0.503520, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013330, -0.017895, -0.057777, -0.681371, -0.316311, -0.660061, 0.612865, -0.739584, -0.278231, 1.000000, 0.560210, 0.500610, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012925, -0.019026, -0.057509, -0.668991, -0.483849, -0.564217, 0.657002, -0.739914, -0.144486, 1.000000, 0.563170, 0.498860, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015166, -0.019123, -0.054485, -0.622696, -0.650957, -0.434171, 0.756761, -0.642073, -0.122696, 1.000000, 0.558620, 0.490400, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012370, -0.019941, -0.057292, -0.627351, -0.615470, -0.477102, 0.707243, -0.706734, -0.018269, 1.000000, 0.566100, 0.497970, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014488, -0.019932, -0.054132, -0.575940, -0.744593, -0.337455, 0.801090, -0.596330, -0.051434, 1.000000, 0.561390, 0.489100, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.011812, -0.020655, -0.057002, -0.545126, -0.747374, -0.379829, 0.784762, -0.614291, 0.082435, 1.000000, 0.568550, 0.497240, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013838, -0.020562, -0.053684, -0.495934, -0.836601, -0.232697, 0.853556, -0.518921, 0.046505, 1.000000, 0.563780, 0.487830, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.011252, -0.021205, -0.056543, -0.421188, -0.866085, -0.269254, 0.861437, -0.474891, 0.180014, 1.000000, 0.570710, 0.496260, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013074, -0.021093, -0.053119, -0.397301, -0.908085, -0.132415, 0.902265, -0.412879, 0.124294, 1.000000, 0.566530, 0.486630, 6, 5, 1, 1, 0.998904, 0.001096, 0.000000, 0.000000 },
-	{ -0.010578, -0.021664, -0.055889, -0.288182, -0.941382, -0.175360, 0.909167, -0.326476, 0.258514, 1.000000, 0.573200, 0.495040, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.009755, -0.022012, -0.054996, -0.133141, -0.988025, -0.077972, 0.935042, -0.151305, 0.320630, 1.000000, 0.576190, 0.493420, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007527, -0.021791, -0.057265, 0.148716, -0.978867, -0.140367, 0.834239, 0.047973, 0.549312, 1.000000, 0.580580, 0.501600, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.008234, -0.021645, -0.058243, -0.017930, -0.972462, -0.232372, 0.866516, -0.131065, 0.481635, 1.000000, 0.577770, 0.502950, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006100, -0.020752, -0.060123, 0.338883, -0.892682, -0.297116, 0.648645, -0.007066, 0.761059, 1.000000, 0.580250, 0.510860, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005480, -0.020724, -0.059117, 0.453716, -0.867467, -0.204064, 0.573349, 0.108854, 0.812048, 1.000000, 0.583200, 0.510520, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003771, -0.019042, -0.060441, 0.700024, -0.659423, -0.274096, 0.336363, -0.034111, 0.941115, 1.000000, 0.583330, 0.519690, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004351, -0.019083, -0.061466, 0.629232, -0.690819, -0.356141, 0.381573, -0.124622, 0.915899, 1.000000, 0.580320, 0.519010, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004869, -0.020525, -0.057942, 0.558107, -0.823851, -0.098931, 0.465429, 0.212111, 0.859293, 1.000000, 0.586730, 0.510110, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003278, -0.018912, -0.059186, 0.773306, -0.614832, -0.154854, 0.219532, 0.030517, 0.975128, 1.000000, 0.586870, 0.520170, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006739, -0.021675, -0.056141, 0.320861, -0.946826, -0.023864, 0.780634, 0.250106, 0.572762, 1.000000, 0.583980, 0.500170, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002681, -0.016911, -0.061134, 0.881378, -0.353147, -0.313783, 0.196693, -0.329579, 0.923412, 1.000000, 0.580750, 0.527280, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002259, -0.016842, -0.059810, 0.930937, -0.316652, -0.181898, 0.073938, -0.324350, 0.943043, 1.000000, 0.584130, 0.529210, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003151, -0.016958, -0.062248, 0.836752, -0.384884, -0.389500, 0.254170, -0.357048, 0.898841, 1.000000, 0.578150, 0.525790, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002643, -0.014491, -0.062352, 0.912625, -0.031431, -0.407589, 0.284468, -0.667221, 0.688400, 1.000000, 0.573870, 0.531870, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002223, -0.014431, -0.061243, 0.950305, -0.034313, -0.309425, 0.206547, -0.674170, 0.709107, 1.000000, 0.575740, 0.534230, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002352, -0.011883, -0.060741, 0.915088, 0.288089, -0.282167, 0.359719, -0.899415, 0.248304, 1.000000, 0.568610, 0.539450, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002773, -0.011948, -0.061783, 0.850987, 0.319932, -0.416491, 0.440126, -0.867129, 0.233186, 1.000000, 0.567980, 0.536650, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003573, -0.009694, -0.060509, 0.577869, 0.721487, -0.381475, 0.638380, -0.690807, -0.339494, 1.000000, 0.561150, 0.539720, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003198, -0.009666, -0.059516, 0.709727, 0.661312, -0.242803, 0.582338, -0.744689, -0.326069, 1.000000, 0.560800, 0.542300, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002083, -0.011916, -0.059442, 0.958222, 0.254071, -0.131373, 0.277732, -0.936295, 0.214982, 1.000000, 0.569330, 0.542870, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002916, -0.009806, -0.058352, 0.813316, 0.573123, -0.100236, 0.506631, -0.782327, -0.362340, 1.000000, 0.560330, 0.545390, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.001865, -0.014392, -0.059898, 0.985426, -0.028198, -0.167753, 0.101581, -0.693473, 0.713286, 1.000000, 0.577920, 0.537330, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004869, -0.007979, -0.057510, 0.416534, 0.882527, -0.218279, 0.587565, -0.444546, -0.676126, 1.000000, 0.551750, 0.543380, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005408, -0.008082, -0.058323, 0.235735, 0.908650, -0.344651, 0.599980, -0.415066, -0.683919, 1.000000, 0.552470, 0.540860, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004310, -0.008122, -0.056532, 0.595852, 0.800744, -0.061404, 0.558044, -0.467811, -0.685376, 1.000000, 0.551060, 0.546290, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006239, -0.006889, -0.054043, 0.442352, 0.896842, 0.000289, 0.524664, -0.258520, -0.811108, 1.000000, 0.540870, 0.545960, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007092, -0.006660, -0.054902, 0.259680, 0.952595, -0.158526, 0.515833, -0.275604, -0.811146, 1.000000, 0.541010, 0.542490, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007902, -0.006726, -0.055559, 0.091848, 0.948297, -0.303804, 0.502788, -0.307511, -0.807862, 1.000000, 0.541050, 0.539550, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.008574, -0.006036, -0.051100, 0.367356, 0.929489, 0.033159, 0.458085, -0.149788, -0.876197, 1.000000, 0.529590, 0.544290, 6, 5, 1, 1, 0.998935, 0.001065, 0.000000, 0.000000 },
-	{ -0.009588, -0.005769, -0.052018, 0.218730, 0.970714, -0.099358, 0.445006, -0.189852, -0.875172, 1.000000, 0.530200, 0.540240, 6, 5, 1, 1, 0.998838, 0.001162, 0.000000, 0.000000 },
-	{ -0.012036, -0.004994, -0.049176, 0.228339, 0.970317, -0.079659, 0.378506, -0.163859, -0.910980, 1.000000, 0.519940, 0.537040, 6, 5, 1, 1, 0.985561, 0.014439, 0.000000, 0.000000 },
-	{ -0.010921, -0.005281, -0.048203, 0.347336, 0.937150, 0.033295, 0.395496, -0.114204, -0.911340, 1.000000, 0.519050, 0.541470, 6, 5, 1, 1, 0.984046, 0.015954, 0.000000, 0.000000 },
-	{ -0.013121, -0.004904, -0.049963, 0.122826, 0.973295, -0.193936, 0.365144, -0.226028, -0.903095, 1.000000, 0.520550, 0.533050, 6, 5, 1, 1, 0.988883, 0.011117, 0.000000, 0.000000 },
-	{ -0.010569, -0.005746, -0.052707, 0.081926, 0.967609, -0.238789, 0.431154, -0.250424, -0.866830, 1.000000, 0.530400, 0.536750, 6, 5, 1, 1, 0.998711, 0.001289, 0.000000, 0.000000 },
-	{ -0.014214, -0.004969, -0.050551, 0.026853, 0.949405, -0.312904, 0.365465, -0.300672, -0.880927, 1.000000, 0.520750, 0.529290, 6, 5, 1, 1, 0.987764, 0.012236, 0.000000, 0.000000 },
-	{ -0.011517, -0.005909, -0.053213, -0.032885, 0.929595, -0.367114, 0.427920, -0.318847, -0.845707, 1.000000, 0.530510, 0.533530, 6, 5, 1, 1, 0.998481, 0.001519, 0.000000, 0.000000 },
-	{ -0.008610, -0.006958, -0.056076, -0.046948, 0.905970, -0.420730, 0.492537, -0.345437, -0.798800, 1.000000, 0.541400, 0.537010, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005904, -0.008293, -0.058952, 0.057212, 0.890118, -0.452126, 0.601789, -0.392094, -0.695782, 1.000000, 0.552980, 0.538770, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004006, -0.009813, -0.061285, 0.383174, 0.752208, -0.536061, 0.686812, -0.620088, -0.379184, 1.000000, 0.561380, 0.537650, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003220, -0.012039, -0.062589, 0.711987, 0.380015, -0.590477, 0.570383, -0.803450, 0.170680, 1.000000, 0.567410, 0.534560, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003072, -0.014565, -0.063249, 0.834786, -0.001718, -0.550572, 0.411199, -0.663039, 0.625536, 1.000000, 0.572430, 0.530120, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003614, -0.016991, -0.063162, 0.767858, -0.407637, -0.494193, 0.333309, -0.404577, 0.851600, 1.000000, 0.576090, 0.524620, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004886, -0.019073, -0.062312, 0.536371, -0.716057, -0.446731, 0.431399, -0.222332, 0.874336, 1.000000, 0.577930, 0.518400, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006671, -0.020654, -0.060910, 0.201284, -0.897362, -0.392716, 0.727826, -0.131304, 0.673074, 1.000000, 0.577920, 0.511220, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.008834, -0.021367, -0.058992, -0.184628, -0.928776, -0.321384, 0.858781, -0.311475, 0.406791, 1.000000, 0.575500, 0.503970, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004596, -0.010053, -0.061769, 0.090745, 0.730686, -0.676657, 0.703952, -0.527677, -0.475404, 1.000000, 0.561330, 0.535880, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006442, -0.008581, -0.059379, -0.121438, 0.826941, -0.549020, 0.583540, -0.387958, -0.713421, 1.000000, 0.553140, 0.536870, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003801, -0.012177, -0.063153, 0.416220, 0.449008, -0.790666, 0.703561, -0.709879, -0.032764, 1.000000, 0.566720, 0.532950, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003599, -0.014646, -0.063916, 0.623334, 0.060437, -0.779617, 0.583513, -0.699656, 0.412303, 1.000000, 0.571280, 0.528660, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004142, -0.016993, -0.063854, 0.585239, -0.398895, -0.705960, 0.464726, -0.548447, 0.695151, 1.000000, 0.574420, 0.523560, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005441, -0.018989, -0.062955, 0.337064, -0.710801, -0.617374, 0.530946, -0.398011, 0.748120, 1.000000, 0.576100, 0.517780, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007225, -0.020448, -0.061478, -0.018319, -0.845951, -0.532946, 0.783800, -0.343084, 0.517640, 1.000000, 0.576070, 0.511490, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.009352, -0.020975, -0.059507, -0.376842, -0.816699, -0.437028, 0.809919, -0.519465, 0.272373, 1.000000, 0.573680, 0.504650, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007131, -0.008954, -0.059651, -0.238178, 0.758484, -0.606608, 0.553704, -0.407092, -0.726421, 1.000000, 0.552820, 0.534610, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.010076, -0.007723, -0.056793, -0.246335, 0.772033, -0.585904, 0.490408, -0.422139, -0.762429, 1.000000, 0.541790, 0.531730, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.009310, -0.007286, -0.056461, -0.157977, 0.844147, -0.512308, 0.487737, -0.384407, -0.783801, 1.000000, 0.541620, 0.534570, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012486, -0.006190, -0.053601, -0.124423, 0.871009, -0.475250, 0.434521, -0.382771, -0.815278, 1.000000, 0.530430, 0.530150, 6, 5, 1, 1, 0.998252, 0.001748, 0.000000, 0.000000 },
-	{ -0.015318, -0.005177, -0.051043, -0.064867, 0.900027, -0.430979, 0.374261, -0.378420, -0.846597, 1.000000, 0.520960, 0.525400, 6, 5, 1, 1, 0.981659, 0.018341, 0.000000, 0.000000 },
-	{ -0.016312, -0.005581, -0.051534, -0.190354, 0.802355, -0.565678, 0.391941, -0.466187, -0.793128, 1.000000, 0.521600, 0.521810, 6, 5, 1, 1, 0.978968, 0.021032, 0.000000, 0.000000 },
-	{ -0.013407, -0.006627, -0.053982, -0.223781, 0.783021, -0.580345, 0.444741, -0.447800, -0.775680, 1.000000, 0.530630, 0.526660, 6, 5, 1, 1, 0.998034, 0.001966, 0.000000, 0.000000 },
-	{ -0.004821, -0.016929, -0.064255, 0.182889, -0.293899, -0.938176, 0.596318, -0.725528, 0.343531, 1.000000, 0.572730, 0.522290, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004283, -0.014715, -0.064295, 0.209230, 0.130435, -0.969128, 0.683171, -0.728584, 0.049433, 1.000000, 0.569830, 0.527110, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004517, -0.012381, -0.063467, 0.066879, 0.460257, -0.885263, 0.717182, -0.639014, -0.278048, 1.000000, 0.565760, 0.531250, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005342, -0.010394, -0.061976, -0.139222, 0.675599, -0.724006, 0.664227, -0.478547, -0.574278, 1.000000, 0.560890, 0.533950, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006100, -0.018784, -0.063341, 0.007982, -0.594171, -0.804299, 0.608676, -0.635268, 0.475341, 1.000000, 0.574280, 0.517080, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007829, -0.020067, -0.061811, -0.271435, -0.713015, -0.646477, 0.755660, -0.573876, 0.315664, 1.000000, 0.574320, 0.511550, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.009837, -0.020408, -0.059812, -0.537292, -0.659886, -0.525232, 0.735756, -0.671162, 0.090578, 1.000000, 0.571830, 0.505160, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054877, -0.019210, 0.010529, -0.670671, 0.445924, -0.592750, 0.583988, -0.175272, -0.792615, 1.000000, 0.382180, 0.360900, 8, 4, 1, 1, 0.719771, 0.153434, 0.126796, 0.000000 },
-	{ -0.057825, -0.019302, 0.013871, -0.782293, 0.446380, -0.434469, 0.447771, -0.081900, -0.890390, 1.000000, 0.368540, 0.357980, 8, 1, 4, 1, 0.639202, 0.270797, 0.090001, 0.000000 },
-	{ -0.060211, -0.023275, 0.013776, -0.810363, 0.476869, -0.340452, 0.370775, -0.032563, -0.928152, 1.000000, 0.365180, 0.342490, 8, 1, 4, 1, 0.692408, 0.300134, 0.007458, 0.000000 },
-	{ -0.057285, -0.022828, 0.009284, -0.702146, 0.598067, -0.386402, 0.444019, -0.056462, -0.894237, 1.000000, 0.380920, 0.345870, 8, 1, 4, 1, 0.863669, 0.121363, 0.014968, 0.000000 },
-	{ -0.062600, -0.027797, 0.014240, -0.921908, 0.281279, -0.266397, 0.286607, 0.032534, -0.957496, 1.000000, 0.360130, 0.325360, 8, 1, 1, 1, 0.656109, 0.343891, 0.000000, 0.000000 },
-	{ -0.061092, -0.027589, 0.009998, -0.878679, 0.361588, -0.311733, 0.341466, 0.019654, -0.939689, 1.000000, 0.371900, 0.325710, 8, 1, 1, 1, 0.834229, 0.165771, 0.000000, 0.000000 },
-	{ -0.051518, -0.019323, 0.007679, -0.580189, 0.456382, -0.674608, 0.644133, -0.249803, -0.722974, 1.000000, 0.395170, 0.364300, 8, 4, 1, 1, 0.747580, 0.203439, 0.048981, 0.000000 },
-	{ -0.052718, -0.021102, 0.006445, -0.493038, 0.766515, -0.411544, 0.516157, -0.123079, -0.847605, 1.000000, 0.395630, 0.356840, 8, 1, 4, 1, 0.925063, 0.041520, 0.033418, 0.000000 },
-	{ -0.063325, -0.032919, 0.015057, -0.963480, -0.086874, -0.253296, 0.246158, 0.085039, -0.965492, 1.000000, 0.355130, 0.309390, 8, 1, 17, 1, 0.596212, 0.366624, 0.037165, 0.000000 },
-	{ -0.062118, -0.032689, 0.010586, -0.952917, -0.092024, -0.288930, 0.283231, 0.070191, -0.956480, 1.000000, 0.367200, 0.309170, 8, 1, 17, 1, 0.797669, 0.182644, 0.019687, 0.000000 },
-	{ -0.062475, -0.039280, 0.016628, -0.939250, -0.186802, -0.287950, 0.259470, 0.162756, -0.951938, 1.000000, 0.348030, 0.288650, 8, 1, 17, 1, 0.419593, 0.363102, 0.217305, 0.000000 },
-	{ -0.060349, -0.039359, 0.011873, -0.876647, -0.296337, -0.379044, 0.340248, 0.175179, -0.923875, 1.000000, 0.364130, 0.284680, 8, 17, 1, 1, 0.609845, 0.233483, 0.156673, 0.000000 },
-	{ -0.061979, -0.046301, 0.018721, -0.953014, -0.124774, -0.276037, 0.251855, 0.179986, -0.950881, 1.000000, 0.336820, 0.267340, 17, 1, 8, 1, 0.490844, 0.357172, 0.151985, 0.000000 },
-	{ -0.059770, -0.047107, 0.014384, -0.894240, -0.091001, -0.438239, 0.407968, 0.237028, -0.881691, 1.000000, 0.351920, 0.261370, 17, 8, 1, 1, 0.628248, 0.213142, 0.158610, 0.000000 },
-	{ -0.061794, -0.052627, 0.021142, -0.969941, -0.189598, -0.152537, 0.121984, 0.163561, -0.978963, 1.000000, 0.323980, 0.250000, 17, 1, 8, 1, 0.625851, 0.353598, 0.020551, 0.000000 },
-	{ -0.060895, -0.053754, 0.017083, -0.959048, -0.143718, -0.244075, 0.214512, 0.194178, -0.957225, 1.000000, 0.333700, 0.244450, 17, 1, 8, 1, 0.792012, 0.184119, 0.023869, 0.000000 },
-	{ -0.057122, -0.045173, 0.010937, -0.757133, -0.127892, -0.640619, 0.589228, 0.289724, -0.754235, 1.000000, 0.367680, 0.263220, 17, 8, 1, 1, 0.672054, 0.274829, 0.053117, 0.000000 },
-	{ -0.057284, -0.042042, 0.009622, -0.753522, -0.448203, -0.480957, 0.426055, 0.224232, -0.876469, 1.000000, 0.372690, 0.271590, 8, 17, 1, 1, 0.656974, 0.292044, 0.050983, 0.000000 },
-	{ -0.060124, -0.057997, 0.023324, -0.890413, -0.452637, -0.047801, -0.012057, 0.128440, -0.991644, 1.000000, 0.313150, 0.234850, 17, 1, 13, 12, 0.633076, 0.321625, 0.035043, 0.010256 },
-	{ -0.059432, -0.059044, 0.019214, -0.864403, -0.496519, -0.079223, 0.002229, 0.153779, -0.988103, 1.000000, 0.322970, 0.229320, 17, 1, 13, 12, 0.814645, 0.171757, 0.011966, 0.001632 },
-	{ -0.056877, -0.063256, 0.025843, -0.824647, -0.558653, -0.088673, -0.059511, 0.241581, -0.968554, 1.000000, 0.300130, 0.215720, 17, 13, 1, 12, 0.438568, 0.246722, 0.242843, 0.071867 },
-	{ -0.055126, -0.064068, 0.021427, -0.726903, -0.667448, -0.161632, -0.012764, 0.248452, -0.968560, 1.000000, 0.311810, 0.206200, 17, 13, 1, 12, 0.702089, 0.166575, 0.114150, 0.017186 },
-	{ -0.053788, -0.068531, 0.028345, -0.848871, -0.514295, -0.122144, -0.098806, 0.381375, -0.919125, 1.000000, 0.284760, 0.200090, 13, 12, 1, 17, 0.543465, 0.192289, 0.135302, 0.128943 },
-	{ -0.051769, -0.069554, 0.024407, -0.820831, -0.485127, -0.301478, -0.000849, 0.528860, -0.848709, 1.000000, 0.295820, 0.189730, 13, 17, 1, 12, 0.651297, 0.230657, 0.059591, 0.058455 },
-	{ -0.051278, -0.073401, 0.030401, -0.862387, -0.505677, -0.024092, -0.186333, 0.361304, -0.913641, 1.000000, 0.269140, 0.189120, 13, 12, 1, 17, 0.653883, 0.284179, 0.049931, 0.012007 },
-	{ -0.050308, -0.074926, 0.026958, -0.890531, -0.442290, -0.106463, -0.133281, 0.477415, -0.868511, 1.000000, 0.275490, 0.181240, 13, 12, 17, 1, 0.831636, 0.115065, 0.028922, 0.024378 },
-	{ -0.050210, -0.068059, 0.021200, -0.659748, -0.512382, -0.549725, 0.176464, 0.605433, -0.776088, 1.000000, 0.307330, 0.185950, 13, 17, 1, 12, 0.732523, 0.224872, 0.025828, 0.016777 },
-	{ -0.051558, -0.065912, 0.019669, -0.527109, -0.792451, -0.306883, 0.065657, 0.322069, -0.944437, 1.000000, 0.313760, 0.191880, 17, 13, 1, 12, 0.530374, 0.411867, 0.042354, 0.015404 },
-	{ -0.048723, -0.076783, 0.031904, -0.750166, -0.640068, 0.166026, -0.400590, 0.240137, -0.884230, 1.000000, 0.259380, 0.181540, 13, 12, 1, 1, 0.654725, 0.334496, 0.010779, 0.000000 },
-	{ -0.048150, -0.078356, 0.028526, -0.774550, -0.617956, 0.134916, -0.387241, 0.294632, -0.873634, 1.000000, 0.264900, 0.174440, 13, 12, 1, 1, 0.862823, 0.131863, 0.005314, 0.000000 },
-	{ -0.045775, -0.079075, 0.032988, -0.608142, -0.753875, 0.248670, -0.502797, 0.123392, -0.855552, 1.000000, 0.250690, 0.175060, 13, 12, 1, 1, 0.651805, 0.347182, 0.001013, 0.000000 },
-	{ -0.045440, -0.080560, 0.029459, -0.594087, -0.762786, 0.255379, -0.540028, 0.142905, -0.829426, 1.000000, 0.256520, 0.168400, 13, 12, 1, 1, 0.879215, 0.120785, 0.000000, 0.000000 },
-	{ -0.043023, -0.080646, 0.034116, -0.497283, -0.829683, 0.253645, -0.520420, 0.051341, -0.852366, 1.000000, 0.242150, 0.169850, 13, 12, 1, 1, 0.655996, 0.344004, 0.000000, 0.000000 },
-	{ -0.042727, -0.081938, 0.030341, -0.437878, -0.855194, 0.277321, -0.587425, 0.038642, -0.808356, 1.000000, 0.248580, 0.163530, 13, 12, 1, 1, 0.860627, 0.139373, 0.000000, 0.000000 },
-	{ -0.060440, -0.056951, 0.027273, -0.921284, -0.386527, 0.042807, -0.091676, 0.108888, -0.989818, 1.000000, 0.303570, 0.239420, 1, 17, 13, 12, 0.476193, 0.447472, 0.047549, 0.028786 },
-	{ -0.057596, -0.062179, 0.029644, -0.877285, -0.478342, 0.039503, -0.144095, 0.183975, -0.972312, 1.000000, 0.290090, 0.222500, 1, 17, 13, 12, 0.358364, 0.253770, 0.231419, 0.156448 },
-	{ -0.054582, -0.067411, 0.031986, -0.870317, -0.490637, 0.042703, -0.189163, 0.252966, -0.948802, 1.000000, 0.275430, 0.207180, 13, 12, 1, 17, 0.411674, 0.335750, 0.195457, 0.057119 },
-	{ -0.051816, -0.071990, 0.033942, -0.839709, -0.531843, 0.109690, -0.284784, 0.259301, -0.922855, 1.000000, 0.262360, 0.195770, 12, 13, 1, 17, 0.480233, 0.445651, 0.069120, 0.004996 },
-	{ -0.049100, -0.075225, 0.035328, -0.735422, -0.643946, 0.210919, -0.423105, 0.193260, -0.885231, 1.000000, 0.253150, 0.188130, 12, 13, 1, 1, 0.571569, 0.414684, 0.013747, 0.000000 },
-	{ -0.046061, -0.077579, 0.036615, -0.632386, -0.733699, 0.248544, -0.458204, 0.095577, -0.883694, 1.000000, 0.243850, 0.181410, 12, 13, 1, 1, 0.591323, 0.407561, 0.001116, 0.000000 },
-	{ -0.043379, -0.079240, 0.037947, -0.544471, -0.801596, 0.246972, -0.455431, 0.035266, -0.889573, 1.000000, 0.234630, 0.175830, 12, 13, 1, 1, 0.596642, 0.403358, 0.000000, 0.000000 },
-	{ -0.060423, -0.056020, 0.031097, -0.931497, -0.351221, 0.094638, -0.141886, 0.111270, -0.983609, 1.000000, 0.293850, 0.243510, 1, 17, 12, 13, 0.609878, 0.276419, 0.059593, 0.054110 },
-	{ -0.062101, -0.050946, 0.028903, -0.979629, -0.191968, 0.058950, -0.083001, 0.119759, -0.989327, 1.000000, 0.304660, 0.257720, 1, 17, 8, 12, 0.679464, 0.311591, 0.005172, 0.003773 },
-	{ -0.061927, -0.050085, 0.032788, -0.977606, -0.193182, 0.083464, -0.108567, 0.123227, -0.986422, 1.000000, 0.294680, 0.261650, 1, 17, 12, 13, 0.807067, 0.177776, 0.009687, 0.005469 },
-	{ -0.060300, -0.055091, 0.034894, -0.936464, -0.331354, 0.115062, -0.161970, 0.117531, -0.979772, 1.000000, 0.284230, 0.247650, 1, 17, 12, 13, 0.711565, 0.131380, 0.105580, 0.051475 },
-	{ -0.057838, -0.061099, 0.033433, -0.891964, -0.440554, 0.101553, -0.185510, 0.151799, -0.970847, 1.000000, 0.280950, 0.228080, 1, 12, 13, 17, 0.447406, 0.242874, 0.188977, 0.120742 },
-	{ -0.057893, -0.060013, 0.037107, -0.896997, -0.422661, 0.129441, -0.207845, 0.144840, -0.967379, 1.000000, 0.272190, 0.233240, 1, 12, 13, 17, 0.507247, 0.334811, 0.112643, 0.045299 },
-	{ -0.054915, -0.066168, 0.035628, -0.869774, -0.479119, 0.118062, -0.239806, 0.201311, -0.949720, 1.000000, 0.267260, 0.213430, 12, 13, 1, 17, 0.472400, 0.267058, 0.235505, 0.025036 },
-	{ -0.055067, -0.064869, 0.039191, -0.866693, -0.476565, 0.147408, -0.261178, 0.181748, -0.948026, 1.000000, 0.259420, 0.219430, 12, 1, 13, 17, 0.611577, 0.258347, 0.121148, 0.008928 },
-	{ -0.052057, -0.070561, 0.037426, -0.822967, -0.541262, 0.172512, -0.335090, 0.217291, -0.916788, 1.000000, 0.255290, 0.202090, 12, 13, 1, 17, 0.671743, 0.246563, 0.079169, 0.002526 },
-	{ -0.052201, -0.069109, 0.040971, -0.812980, -0.551376, 0.187212, -0.339283, 0.187255, -0.921858, 1.000000, 0.248020, 0.208350, 12, 13, 1, 1, 0.822283, 0.093467, 0.084250, 0.000000 },
-	{ -0.049259, -0.073672, 0.038828, -0.733771, -0.637947, 0.233674, -0.417763, 0.152436, -0.895677, 1.000000, 0.246210, 0.194440, 12, 13, 1, 1, 0.779480, 0.205807, 0.014713, 0.000000 },
-	{ -0.049372, -0.072078, 0.042445, -0.737944, -0.635579, 0.226886, -0.386586, 0.122546, -0.914076, 1.000000, 0.238820, 0.200550, 12, 13, 1, 1, 0.914616, 0.069840, 0.015544, 0.000000 },
-	{ -0.046334, -0.076070, 0.040326, -0.664651, -0.707196, 0.241065, -0.405389, 0.070316, -0.911436, 1.000000, 0.236260, 0.187490, 12, 13, 1, 1, 0.805611, 0.193252, 0.001137, 0.000000 },
-	{ -0.046587, -0.074555, 0.044118, -0.690976, -0.683819, 0.234401, -0.361784, 0.046404, -0.931107, 1.000000, 0.228490, 0.193300, 12, 13, 1, 1, 0.940919, 0.057822, 0.001259, 0.000000 },
-	{ -0.043777, -0.077826, 0.041830, -0.579624, -0.779164, 0.238621, -0.400753, 0.017589, -0.916017, 1.000000, 0.226620, 0.181610, 12, 13, 1, 1, 0.829555, 0.170445, 0.000000, 0.000000 },
-	{ -0.044144, -0.076356, 0.045763, -0.608633, -0.753246, 0.249371, -0.363784, -0.014400, -0.931372, 1.000000, 0.218640, 0.187100, 12, 13, 1, 1, 0.954022, 0.045978, 0.000000, 0.000000 },
-	{ -0.062769, -0.044416, 0.030774, -0.993394, -0.103978, 0.048553, -0.060493, 0.114944, -0.991528, 1.000000, 0.304610, 0.277410, 1, 17, 8, 1, 0.833279, 0.149256, 0.017465, 0.000000 },
-	{ -0.062842, -0.045099, 0.026759, -0.995021, -0.098445, 0.015537, -0.026356, 0.109566, -0.993630, 1.000000, 0.315240, 0.274000, 1, 17, 8, 1, 0.697174, 0.253261, 0.049565, 0.000000 },
-	{ -0.063374, -0.038277, 0.028843, -0.996238, -0.079567, 0.034345, -0.042174, 0.098910, -0.994202, 1.000000, 0.314560, 0.295890, 1, 17, 8, 1, 0.842603, 0.085663, 0.071734, 0.000000 },
-	{ -0.063410, -0.038671, 0.024708, -0.995934, -0.090084, 0.000582, -0.009100, 0.094171, -0.995515, 1.000000, 0.325830, 0.293380, 1, 8, 17, 1, 0.708427, 0.163787, 0.127786, 0.000000 },
-	{ -0.063811, -0.032689, 0.027277, -0.999452, -0.008844, 0.031898, -0.032564, 0.089864, -0.995422, 1.000000, 0.322600, 0.313260, 1, 8, 17, 1, 0.853208, 0.125125, 0.021667, 0.000000 },
-	{ -0.063974, -0.032865, 0.023095, -0.999806, -0.019660, -0.000998, -0.000718, 0.087129, -0.996197, 1.000000, 0.333960, 0.311560, 1, 8, 17, 1, 0.720396, 0.254394, 0.025209, 0.000000 },
-	{ -0.063525, -0.028122, 0.026274, -0.983639, 0.179513, 0.015135, 0.000855, 0.088668, -0.996061, 1.000000, 0.327970, 0.327460, 1, 8, 1, 1, 0.858216, 0.141784, 0.000000, 0.000000 },
-	{ -0.063616, -0.028170, 0.022149, -0.979005, 0.202593, -0.022490, 0.040596, 0.085664, -0.995497, 1.000000, 0.339030, 0.326010, 1, 8, 1, 1, 0.718310, 0.281690, 0.000000, 0.000000 },
-	{ -0.062268, -0.024031, 0.025751, -0.942000, 0.334838, -0.022807, 0.050160, 0.073271, -0.996050, 1.000000, 0.331690, 0.341510, 1, 8, 4, 1, 0.844363, 0.154446, 0.001191, 0.000000 },
-	{ -0.062106, -0.023973, 0.021719, -0.925221, 0.373721, -0.065571, 0.095805, 0.062887, -0.993412, 1.000000, 0.342690, 0.340700, 1, 8, 4, 1, 0.689395, 0.308524, 0.002081, 0.000000 },
-	{ -0.063401, -0.028049, 0.018205, -0.964993, 0.230804, -0.124569, 0.143453, 0.066864, -0.987396, 1.000000, 0.349520, 0.325300, 1, 8, 1, 1, 0.539582, 0.460418, 0.000000, 0.000000 },
-	{ -0.061543, -0.023694, 0.017805, -0.893117, 0.415953, -0.171247, 0.201994, 0.030699, -0.978906, 1.000000, 0.353540, 0.340980, 8, 1, 4, 1, 0.499488, 0.497000, 0.003512, 0.000000 },
-	{ -0.059432, -0.019606, 0.017597, -0.873722, 0.429478, -0.228381, 0.254211, 0.002869, -0.967145, 1.000000, 0.356660, 0.356340, 8, 1, 4, 1, 0.504196, 0.449620, 0.046184, 0.000000 },
-	{ -0.063898, -0.032927, 0.019111, -0.994132, -0.040810, -0.100185, 0.096553, 0.082911, -0.991869, 1.000000, 0.344520, 0.310300, 1, 8, 17, 1, 0.554488, 0.415398, 0.030114, 0.000000 },
-	{ -0.063247, -0.038970, 0.020704, -0.987807, -0.120470, -0.098616, 0.085951, 0.106157, -0.990628, 1.000000, 0.336600, 0.291240, 1, 8, 17, 1, 0.547549, 0.288673, 0.163778, 0.000000 },
-	{ -0.062728, -0.045673, 0.022813, -0.991233, -0.105711, -0.079267, 0.066284, 0.121135, -0.990421, 1.000000, 0.325710, 0.270970, 1, 17, 8, 1, 0.537826, 0.361490, 0.100684, 0.000000 },
-	{ -0.062160, -0.051751, 0.025065, -0.980310, -0.196992, -0.013686, -0.011148, 0.124405, -0.992169, 1.000000, 0.314410, 0.254070, 1, 17, 8, 13, 0.523357, 0.462003, 0.012935, 0.001705 },
-	{ -0.060238, -0.019887, 0.021458, -0.907452, 0.405412, -0.110325, 0.140786, 0.045999, -0.988971, 1.000000, 0.345700, 0.355710, 1, 8, 4, 1, 0.642133, 0.334725, 0.023142, 0.000000 },
-	{ -0.060636, -0.020007, 0.025416, -0.923949, 0.377429, -0.062182, 0.092836, 0.063559, -0.993651, 1.000000, 0.334690, 0.356080, 1, 8, 4, 1, 0.812670, 0.176791, 0.010538, 0.000000 },
-	{ -0.062262, -0.023838, 0.029966, -0.952753, 0.303549, -0.010957, 0.034247, 0.071509, -0.996852, 1.000000, 0.320250, 0.343310, 1, 8, 1, 1, 0.940809, 0.059191, 0.000000, 0.000000 },
-	{ -0.063363, -0.027875, 0.030629, -0.986094, 0.165208, 0.017996, -0.003920, 0.085134, -0.996362, 1.000000, 0.316140, 0.329580, 1, 8, 1, 1, 0.944926, 0.055074, 0.000000, 0.000000 },
-	{ -0.062159, -0.023411, 0.034439, -0.958408, 0.285403, -0.000119, 0.019430, 0.064831, -0.997707, 1.000000, 0.308060, 0.345930, 1, 8, 1, 1, 0.983435, 0.016565, 0.000000, 0.000000 },
-	{ -0.060833, -0.019472, 0.033812, -0.941685, 0.335964, -0.018898, 0.039848, 0.055575, -0.997659, 1.000000, 0.311780, 0.359860, 1, 8, 4, 1, 0.977234, 0.019623, 0.003143, 0.000000 },
-	{ -0.060825, -0.019858, 0.029516, -0.935160, 0.351955, -0.040040, 0.065870, 0.063435, -0.995810, 1.000000, 0.323430, 0.357590, 1, 8, 4, 1, 0.924762, 0.069701, 0.005537, 0.000000 },
-	{ -0.063190, -0.027415, 0.035253, -0.986680, 0.160986, 0.023384, -0.010264, 0.081852, -0.996592, 1.000000, 0.303520, 0.332370, 1, 8, 1, 1, 0.984371, 0.015629, 0.000000, 0.000000 },
-	{ -0.063658, -0.032325, 0.031681, -0.999308, -0.003649, 0.037005, -0.037184, 0.093667, -0.994909, 1.000000, 0.310570, 0.315710, 1, 8, 17, 1, 0.940307, 0.047130, 0.012562, 0.000000 },
-	{ -0.063486, -0.031749, 0.036333, -0.998933, 0.000330, 0.046171, -0.045926, 0.095993, -0.994322, 1.000000, 0.297990, 0.318950, 1, 8, 17, 1, 0.982494, 0.013101, 0.004404, 0.000000 },
-	{ -0.063253, -0.037656, 0.033164, -0.995754, -0.078202, 0.048569, -0.056588, 0.103818, -0.992985, 1.000000, 0.302980, 0.299260, 1, 17, 8, 1, 0.934949, 0.041155, 0.023896, 0.000000 },
-	{ -0.063079, -0.036826, 0.037717, -0.994892, -0.079965, 0.061612, -0.069753, 0.103371, -0.992194, 1.000000, 0.290990, 0.303390, 1, 17, 8, 1, 0.980356, 0.013885, 0.005758, 0.000000 },
-	{ -0.062629, -0.043531, 0.034930, -0.991646, -0.110990, 0.065725, -0.078776, 0.117618, -0.989930, 1.000000, 0.293870, 0.281570, 1, 17, 8, 1, 0.926548, 0.069333, 0.004119, 0.000000 },
-	{ -0.062428, -0.042445, 0.039356, -0.990007, -0.117260, 0.078332, -0.091923, 0.115387, -0.989058, 1.000000, 0.282640, 0.286440, 1, 17, 8, 1, 0.972651, 0.026176, 0.001173, 0.000000 },
-	{ -0.061730, -0.049074, 0.036812, -0.976153, -0.194470, 0.096477, -0.121634, 0.121855, -0.985067, 1.000000, 0.284530, 0.266050, 1, 17, 12, 13, 0.891762, 0.080803, 0.021219, 0.006216 },
-	{ -0.061482, -0.047916, 0.041147, -0.975137, -0.195267, 0.104775, -0.130647, 0.124684, -0.983558, 1.000000, 0.273660, 0.270970, 1, 12, 17, 13, 0.929105, 0.043353, 0.022960, 0.004583 },
-	{ -0.060135, -0.054071, 0.038816, -0.939556, -0.318483, 0.125710, -0.173292, 0.125664, -0.976821, 1.000000, 0.274470, 0.252130, 1, 12, 17, 13, 0.772022, 0.158598, 0.040267, 0.029113 },
-	{ -0.059913, -0.052957, 0.043072, -0.942055, -0.309294, 0.129885, -0.179710, 0.138371, -0.973939, 1.000000, 0.263940, 0.257100, 1, 12, 13, 17, 0.788407, 0.196252, 0.008189, 0.007153 },
-	{ -0.057844, -0.058893, 0.040910, -0.900083, -0.412313, 0.140887, -0.218305, 0.146904, -0.964760, 1.000000, 0.263160, 0.238410, 1, 12, 13, 17, 0.535908, 0.413472, 0.038827, 0.011794 },
-	{ -0.057706, -0.057729, 0.045091, -0.904229, -0.403121, 0.140935, -0.218530, 0.153252, -0.963721, 1.000000, 0.253200, 0.243850, 1, 12, 13, 17, 0.529667, 0.459491, 0.008451, 0.002391 },
-	{ -0.055125, -0.063554, 0.042931, -0.866993, -0.474729, 0.151513, -0.260984, 0.173558, -0.949613, 1.000000, 0.251120, 0.225330, 12, 1, 13, 17, 0.699015, 0.265255, 0.033591, 0.002138 },
-	{ -0.055121, -0.062241, 0.047084, -0.871794, -0.468729, 0.142371, -0.249962, 0.175694, -0.952182, 1.000000, 0.241730, 0.231370, 12, 1, 13, 1, 0.741765, 0.251806, 0.006428, 0.000000 },
-	{ -0.052336, -0.067655, 0.044739, -0.811383, -0.557887, 0.174414, -0.319684, 0.173739, -0.931460, 1.000000, 0.240190, 0.214620, 12, 1, 13, 1, 0.892586, 0.084662, 0.022751, 0.000000 },
-	{ -0.052488, -0.066227, 0.048920, -0.815228, -0.557976, 0.155132, -0.298451, 0.175205, -0.938206, 1.000000, 0.231300, 0.221060, 12, 1, 13, 1, 0.920212, 0.076659, 0.003129, 0.000000 },
-	{ -0.049539, -0.070584, 0.046316, -0.737711, -0.643478, 0.204252, -0.355432, 0.112967, -0.927851, 1.000000, 0.230880, 0.206640, 12, 1, 13, 1, 0.971132, 0.015490, 0.013379, 0.000000 },
-	{ -0.049653, -0.069215, 0.050651, -0.736422, -0.653223, 0.176016, -0.309135, 0.093490, -0.946412, 1.000000, 0.221760, 0.212880, 12, 1, 13, 1, 0.985654, 0.013202, 0.001143, 0.000000 },
-	{ -0.046743, -0.072974, 0.048159, -0.694979, -0.683606, 0.222905, -0.314823, 0.010588, -0.949091, 1.000000, 0.220230, 0.199090, 12, 13, 1, 1, 0.989061, 0.009701, 0.001238, 0.000000 },
-	{ -0.047080, -0.071256, 0.052579, -0.689976, -0.701040, 0.180211, -0.255429, 0.002863, -0.966824, 1.000000, 0.210720, 0.205040, 12, 13, 1, 1, 0.998922, 0.001078, 0.000000, 0.000000 },
-	{ -0.044843, -0.072831, 0.054430, -0.631730, -0.754510, 0.177855, -0.286909, 0.014435, -0.957849, 1.000000, 0.200740, 0.198650, 12, 13, 1, 1, 0.998759, 0.001241, 0.000000, 0.000000 },
-	{ -0.044457, -0.074616, 0.049881, -0.626496, -0.740109, 0.244421, -0.324502, -0.037445, -0.945144, 1.000000, 0.210270, 0.192760, 12, 13, 1, 1, 0.991007, 0.008993, 0.000000, 0.000000 },
-	{ -0.061189, -0.046677, 0.045945, -0.974617, -0.196151, 0.107920, -0.136173, 0.136759, -0.981200, 1.000000, 0.261570, 0.276390, 1, 12, 17, 13, 0.931525, 0.064326, 0.002863, 0.001286 },
-	{ -0.062164, -0.041257, 0.044210, -0.988668, -0.122135, 0.087288, -0.101950, 0.119457, -0.987591, 1.000000, 0.270210, 0.291760, 1, 17, 12, 8, 0.986038, 0.011772, 0.001146, 0.001045 },
-	{ -0.061821, -0.040060, 0.049555, -0.987851, -0.125592, 0.091528, -0.108355, 0.134444, -0.984979, 1.000000, 0.256350, 0.297440, 1, 12, 17, 1, 0.985431, 0.009192, 0.005378, 0.000000 },
-	{ -0.062493, -0.034809, 0.048024, -0.993601, -0.077708, 0.081970, -0.090981, 0.120578, -0.988526, 1.000000, 0.263770, 0.313140, 1, 17, 1, 1, 0.998936, 0.001064, 0.000000, 0.000000 },
-	{ -0.062086, -0.033900, 0.053873, -0.993879, -0.073168, 0.082776, -0.092700, 0.144709, -0.985123, 1.000000, 0.248190, 0.318420, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062377, -0.029368, 0.052605, -0.996552, 0.029070, 0.077708, -0.072983, 0.138305, -0.987697, 1.000000, 0.254040, 0.332000, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062844, -0.030144, 0.046729, -0.997285, 0.016774, 0.071708, -0.069398, 0.111778, -0.991307, 1.000000, 0.269920, 0.327290, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062031, -0.025345, 0.051554, -0.982621, 0.173080, 0.067079, -0.045372, 0.126455, -0.990934, 1.000000, 0.258950, 0.344320, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062533, -0.026039, 0.045645, -0.984457, 0.167130, 0.053967, -0.037277, 0.101439, -0.994143, 1.000000, 0.275090, 0.339930, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061130, -0.021489, 0.050667, -0.961008, 0.270937, 0.055283, -0.025760, 0.111336, -0.993449, 1.000000, 0.263360, 0.356770, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061601, -0.022113, 0.044705, -0.961107, 0.273721, 0.036744, -0.014851, 0.081633, -0.996552, 1.000000, 0.279820, 0.352770, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059971, -0.017693, 0.049928, -0.946756, 0.318746, 0.045327, -0.015346, 0.095951, -0.995268, 1.000000, 0.267220, 0.369300, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060398, -0.018284, 0.043894, -0.945717, 0.324075, 0.024378, -0.003685, 0.064312, -0.997923, 1.000000, 0.284020, 0.365770, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061421, -0.038967, 0.055361, -0.987811, -0.128428, 0.087956, -0.107860, 0.157317, -0.981640, 1.000000, 0.241120, 0.303330, 1, 12, 1, 1, 0.980627, 0.019373, 0.000000, 0.000000 },
-	{ -0.060837, -0.045428, 0.051250, -0.974837, -0.196023, 0.106147, -0.137621, 0.154627, -0.978341, 1.000000, 0.248080, 0.282280, 1, 12, 1, 1, 0.916454, 0.083546, 0.000000, 0.000000 },
-	{ -0.060441, -0.044241, 0.057014, -0.976111, -0.194986, 0.095847, -0.131000, 0.176232, -0.975593, 1.000000, 0.233260, 0.288540, 1, 12, 1, 1, 0.897582, 0.102418, 0.000000, 0.000000 },
-	{ -0.059312, -0.050536, 0.053083, -0.949268, -0.292249, 0.116104, -0.170259, 0.167229, -0.971106, 1.000000, 0.239140, 0.268600, 1, 12, 1, 1, 0.729189, 0.270811, 0.000000, 0.000000 },
-	{ -0.058998, -0.049343, 0.058815, -0.954888, -0.280341, 0.097972, -0.154067, 0.185626, -0.970467, 1.000000, 0.224670, 0.274950, 1, 12, 1, 1, 0.692839, 0.307161, 0.000000, 0.000000 },
-	{ -0.057306, -0.055315, 0.055030, -0.919532, -0.376671, 0.112162, -0.190913, 0.178644, -0.965214, 1.000000, 0.229180, 0.255800, 12, 1, 1, 1, 0.559124, 0.440876, 0.000000, 0.000000 },
-	{ -0.057138, -0.054181, 0.060738, -0.928183, -0.360638, 0.091743, -0.173034, 0.200008, -0.964394, 1.000000, 0.215050, 0.262200, 12, 1, 1, 1, 0.598286, 0.401714, 0.000000, 0.000000 },
-	{ -0.055037, -0.059769, 0.056999, -0.884640, -0.453193, 0.109674, -0.219762, 0.197795, -0.955292, 1.000000, 0.218760, 0.244110, 12, 1, 1, 1, 0.818628, 0.181372, 0.000000, 0.000000 },
-	{ -0.055006, -0.058662, 0.062683, -0.886271, -0.452832, 0.097296, -0.208886, 0.203294, -0.956577, 1.000000, 0.205240, 0.250760, 12, 1, 1, 1, 0.840101, 0.159899, 0.000000, 0.000000 },
-	{ -0.052564, -0.063652, 0.058934, -0.824087, -0.553079, 0.122410, -0.255169, 0.169518, -0.951921, 1.000000, 0.209000, 0.234320, 12, 1, 1, 1, 0.954175, 0.045825, 0.000000, 0.000000 },
-	{ -0.052516, -0.062402, 0.064664, -0.824567, -0.553150, 0.118801, -0.230152, 0.136131, -0.963586, 1.000000, 0.195700, 0.240940, 12, 1, 1, 1, 0.957147, 0.042853, 0.000000, 0.000000 },
-	{ -0.049839, -0.066692, 0.061103, -0.761146, -0.635411, 0.130036, -0.213590, 0.056261, -0.975302, 1.000000, 0.198540, 0.225500, 12, 1, 1, 1, 0.993380, 0.006620, 0.000000, 0.000000 },
-	{ -0.050141, -0.065124, 0.066763, -0.773462, -0.619035, 0.136205, -0.205107, 0.041115, -0.977876, 1.000000, 0.185000, 0.231720, 12, 1, 1, 1, 0.986796, 0.013204, 0.000000, 0.000000 },
-	{ -0.047811, -0.068582, 0.063201, -0.715466, -0.685476, 0.135025, -0.186006, 0.000601, -0.982549, 1.000000, 0.187220, 0.217180, 12, 1, 1, 1, 0.997363, 0.002637, 0.000000, 0.000000 },
-	{ -0.048081, -0.067096, 0.068746, -0.718511, -0.677821, 0.155887, -0.228731, 0.018617, -0.973312, 1.000000, 0.173680, 0.223230, 12, 1, 1, 1, 0.980329, 0.019671, 0.000000, 0.000000 },
-	{ -0.045757, -0.070191, 0.065090, -0.639630, -0.750875, 0.164498, -0.267282, 0.016610, -0.963475, 1.000000, 0.177630, 0.210680, 12, 1, 1, 1, 0.992648, 0.007352, 0.000000, 0.000000 },
-	{ -0.045981, -0.068688, 0.070515, -0.623041, -0.758405, 0.191417, -0.318988, 0.022914, -0.947482, 1.000000, 0.164050, 0.216790, 12, 1, 1, 1, 0.959942, 0.040058, 0.000000, 0.000000 },
-	{ -0.059635, -0.051769, 0.047812, -0.944943, -0.301669, 0.126799, -0.178996, 0.152122, -0.972018, 1.000000, 0.252230, 0.262610, 1, 12, 13, 17, 0.768198, 0.228889, 0.001813, 0.001100 },
-	{ -0.055085, -0.060961, 0.051767, -0.878952, -0.459774, 0.126690, -0.234249, 0.184818, -0.954448, 1.000000, 0.230970, 0.237650, 12, 1, 1, 1, 0.780893, 0.219107, 0.000000, 0.000000 },
-	{ -0.057507, -0.056522, 0.049790, -0.910820, -0.391615, 0.130558, -0.208288, 0.162924, -0.964402, 1.000000, 0.241920, 0.249650, 12, 1, 13, 1, 0.506303, 0.492108, 0.001589, 0.000000 },
-	{ -0.049789, -0.067848, 0.055533, -0.744950, -0.651425, 0.143859, -0.265759, 0.091991, -0.959641, 1.000000, 0.210960, 0.219210, 12, 1, 1, 1, 0.990715, 0.009285, 0.000000, 0.000000 },
-	{ -0.052581, -0.064868, 0.053639, -0.820483, -0.555317, 0.135760, -0.275309, 0.175703, -0.945163, 1.000000, 0.220960, 0.227670, 12, 1, 1, 1, 0.938940, 0.061060, 0.000000, 0.000000 },
-	{ -0.045299, -0.071603, 0.059668, -0.635741, -0.759932, 0.135411, -0.258505, 0.044309, -0.964993, 1.000000, 0.189800, 0.204660, 12, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.047408, -0.069898, 0.057665, -0.697303, -0.704435, 0.132442, -0.218985, 0.033428, -0.975156, 1.000000, 0.199600, 0.211110, 12, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.043095, -0.072984, 0.061384, -0.513549, -0.841223, 0.169153, -0.360838, 0.032868, -0.932049, 1.000000, 0.182440, 0.200010, 12, 1, 1, 1, 0.998210, 0.001790, 0.000000, 0.000000 },
-	{ -0.042641, -0.074098, 0.056064, -0.513875, -0.837996, 0.183561, -0.376304, 0.027903, -0.926076, 1.000000, 0.193410, 0.194220, 12, 13, 1, 1, 0.998796, 0.001204, 0.000000, 0.000000 },
-	{ -0.040726, -0.073864, 0.062749, -0.325792, -0.919868, 0.218410, -0.467023, -0.044281, -0.883136, 1.000000, 0.176680, 0.196430, 12, 1, 1, 1, 0.996538, 0.003462, 0.000000, 0.000000 },
-	{ -0.040427, -0.074960, 0.057391, -0.338945, -0.919477, 0.199195, -0.459106, -0.023154, -0.888080, 1.000000, 0.187870, 0.190880, 12, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.038260, -0.074130, 0.063776, -0.092600, -0.961811, 0.257574, -0.535186, -0.170063, -0.827439, 1.000000, 0.171840, 0.193370, 12, 1, 1, 1, 0.994113, 0.005887, 0.000000, 0.000000 },
-	{ -0.038232, -0.075351, 0.058404, -0.114843, -0.968891, 0.219229, -0.503941, -0.133360, -0.853381, 1.000000, 0.183380, 0.188060, 12, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.035748, -0.073819, 0.064507, 0.137736, -0.954232, 0.265464, -0.541279, -0.296974, -0.786654, 1.000000, 0.167190, 0.190310, 12, 1, 1, 1, 0.989985, 0.010015, 0.000000, 0.000000 },
-	{ -0.036031, -0.075217, 0.059106, 0.120294, -0.966083, 0.228503, -0.493732, -0.257910, -0.830488, 1.000000, 0.179150, 0.185210, 12, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.033796, -0.074584, 0.059553, 0.314431, -0.923005, 0.221801, -0.443787, -0.349474, -0.825179, 1.000000, 0.174550, 0.181750, 12, 1, 1, 1, 0.998046, 0.001954, 0.000000, 0.000000 },
-	{ -0.036207, -0.076421, 0.053708, 0.104033, -0.965675, 0.238010, -0.510594, -0.257222, -0.820446, 1.000000, 0.190320, 0.180320, 12, 13, 1, 1, 0.994981, 0.005019, 0.000000, 0.000000 },
-	{ -0.034035, -0.075969, 0.053757, 0.282563, -0.933293, 0.221635, -0.440120, -0.331432, -0.834534, 1.000000, 0.186910, 0.176390, 12, 13, 1, 1, 0.996800, 0.003200, 0.000000, 0.000000 },
-	{ -0.031558, -0.073453, 0.060046, 0.474279, -0.856917, 0.201873, -0.402338, -0.414931, -0.816062, 1.000000, 0.169730, 0.177390, 12, 1, 1, 1, 0.996673, 0.003327, 0.000000, 0.000000 },
-	{ -0.031966, -0.074774, 0.055181, 0.466672, -0.863725, 0.190257, -0.380483, -0.390257, -0.838410, 1.000000, 0.179880, 0.173420, 12, 13, 1, 1, 0.997734, 0.002266, 0.000000, 0.000000 },
-	{ -0.033340, -0.076283, 0.051443, 0.381556, -0.900515, 0.208536, -0.454787, -0.379298, -0.805793, 1.000000, 0.190590, 0.172430, 12, 13, 1, 1, 0.992628, 0.007372, 0.000000, 0.000000 },
-	{ -0.032088, -0.075591, 0.051695, 0.502187, -0.847062, 0.174054, -0.425883, -0.417432, -0.802729, 1.000000, 0.187440, 0.170250, 12, 13, 1, 1, 0.993291, 0.006709, 0.000000, 0.000000 },
-	{ -0.033242, -0.072995, 0.064993, 0.329830, -0.911813, 0.244560, -0.496394, -0.387863, -0.776631, 1.000000, 0.162320, 0.186720, 12, 1, 1, 1, 0.984237, 0.015763, 0.000000, 0.000000 },
-	{ -0.035458, -0.072140, 0.069871, 0.143474, -0.948237, 0.283307, -0.586137, -0.312077, -0.747697, 1.000000, 0.153520, 0.196060, 12, 1, 1, 1, 0.949614, 0.050386, 0.000000, 0.000000 },
-	{ -0.032713, -0.071280, 0.070453, 0.325959, -0.909673, 0.257383, -0.515260, -0.399207, -0.758381, 1.000000, 0.148130, 0.192430, 12, 1, 1, 1, 0.932967, 0.067033, 0.000000, 0.000000 },
-	{ -0.035190, -0.070457, 0.075409, 0.142844, -0.942943, 0.300758, -0.590614, -0.325049, -0.738592, 1.000000, 0.139780, 0.202230, 12, 1, 1, 1, 0.852131, 0.147869, 0.000000, 0.000000 },
-	{ -0.032374, -0.069517, 0.076083, 0.313481, -0.906519, 0.282761, -0.506877, -0.411541, -0.757436, 1.000000, 0.134240, 0.198610, 12, 1, 1, 1, 0.823827, 0.176173, 0.000000, 0.000000 },
-	{ -0.029713, -0.068196, 0.076540, 0.464179, -0.847956, 0.255947, -0.437872, -0.470865, -0.765868, 1.000000, 0.127380, 0.193730, 12, 1, 1, 1, 0.804690, 0.195310, 0.000000, 0.000000 },
-	{ -0.030085, -0.070001, 0.070798, 0.474817, -0.851618, 0.222027, -0.453178, -0.452849, -0.767826, 1.000000, 0.142310, 0.187520, 12, 1, 1, 1, 0.919947, 0.080053, 0.000000, 0.000000 },
-	{ -0.030765, -0.071726, 0.065251, 0.482970, -0.850825, 0.206968, -0.454644, -0.445666, -0.771155, 1.000000, 0.157060, 0.181980, 12, 1, 1, 1, 0.978746, 0.021254, 0.000000, 0.000000 },
-	{ -0.034952, -0.077402, 0.049150, 0.237333, -0.935609, 0.261360, -0.506555, -0.348767, -0.788520, 1.000000, 0.197940, 0.173110, 12, 13, 1, 1, 0.982771, 0.017229, 0.000000, 0.000000 },
-	{ -0.036559, -0.077758, 0.049010, 0.102574, -0.952967, 0.285190, -0.552769, -0.292966, -0.780139, 1.000000, 0.200450, 0.175580, 12, 13, 1, 1, 0.971398, 0.028602, 0.000000, 0.000000 },
-	{ -0.035083, -0.078656, 0.045165, 0.264933, -0.915561, 0.302586, -0.502125, -0.398887, -0.767307, 1.000000, 0.205800, 0.168550, 12, 13, 1, 1, 0.924225, 0.075775, 0.000000, 0.000000 },
-	{ -0.036723, -0.079115, 0.044881, 0.110997, -0.943160, 0.313255, -0.536095, -0.322234, -0.780236, 1.000000, 0.209050, 0.171050, 12, 13, 1, 1, 0.898731, 0.101269, 0.000000, 0.000000 },
-	{ -0.035367, -0.080220, 0.040906, 0.264003, -0.919451, 0.291398, -0.499459, -0.388776, -0.774205, 1.000000, 0.215000, 0.164140, 12, 13, 1, 1, 0.751884, 0.248116, 0.000000, 0.000000 },
-	{ -0.036724, -0.080495, 0.040806, 0.106017, -0.947890, 0.300442, -0.541082, -0.308489, -0.782346, 1.000000, 0.217310, 0.166500, 12, 13, 1, 1, 0.736758, 0.263242, 0.000000, 0.000000 },
-	{ -0.035550, -0.081435, 0.036773, 0.281358, -0.933801, 0.221027, -0.557804, -0.346573, -0.754150, 1.000000, 0.223140, 0.159220, 13, 12, 1, 1, 0.514909, 0.485091, 0.000000, 0.000000 },
-	{ -0.036756, -0.081704, 0.036635, 0.114266, -0.964055, 0.239879, -0.590663, -0.260075, -0.763857, 1.000000, 0.225750, 0.161180, 13, 12, 1, 1, 0.524363, 0.475637, 0.000000, 0.000000 },
-	{ -0.036815, -0.082574, 0.032384, 0.147277, -0.972117, 0.182477, -0.617006, -0.234488, -0.751212, 1.000000, 0.233030, 0.155370, 13, 12, 1, 1, 0.777144, 0.222856, 0.000000, 0.000000 },
-	{ -0.035690, -0.082296, 0.032567, 0.323075, -0.932523, 0.161316, -0.592801, -0.332283, -0.733604, 1.000000, 0.230310, 0.153640, 13, 12, 1, 1, 0.768917, 0.231083, 0.000000, 0.000000 },
-	{ -0.034205, -0.080918, 0.036672, 0.497649, -0.851580, 0.164797, -0.511891, -0.441722, -0.736783, 1.000000, 0.220410, 0.156650, 12, 13, 1, 1, 0.546531, 0.453469, 0.000000, 0.000000 },
-	{ -0.034448, -0.081712, 0.032598, 0.559939, -0.821027, 0.111279, -0.527585, -0.456881, -0.716180, 1.000000, 0.227230, 0.151460, 13, 12, 1, 1, 0.711512, 0.288488, 0.000000, 0.000000 },
-	{ -0.033909, -0.079807, 0.040559, 0.453414, -0.856835, 0.245458, -0.465601, -0.462528, -0.754509, 1.000000, 0.212770, 0.161030, 12, 13, 1, 1, 0.737050, 0.262950, 0.000000, 0.000000 },
-	{ -0.033581, -0.078463, 0.043948, 0.450356, -0.845853, 0.285854, -0.441976, -0.489381, -0.751774, 1.000000, 0.205300, 0.164130, 12, 13, 1, 1, 0.855540, 0.144460, 0.000000, 0.000000 },
-	{ -0.033041, -0.077312, 0.046463, 0.499620, -0.831056, 0.244387, -0.441296, -0.486954, -0.753747, 1.000000, 0.198760, 0.166170, 12, 13, 1, 1, 0.949161, 0.050840, 0.000000, 0.000000 },
-	{ -0.034101, -0.077710, 0.046901, 0.388766, -0.883319, 0.261932, -0.477660, -0.436341, -0.762528, 1.000000, 0.199820, 0.168830, 12, 13, 1, 1, 0.968778, 0.031222, 0.000000, 0.000000 },
-	{ -0.032547, -0.076414, 0.048889, 0.520740, -0.834566, 0.179805, -0.423609, -0.435451, -0.794316, 1.000000, 0.193400, 0.167980, 12, 13, 1, 1, 0.981489, 0.018511, 0.000000, 0.000000 },
-	{ -0.033823, -0.077025, 0.049050, 0.385409, -0.895458, 0.222743, -0.450290, -0.393212, -0.801638, 1.000000, 0.195610, 0.170820, 12, 13, 1, 1, 0.983504, 0.016496, 0.000000, 0.000000 },
-	{ -0.035761, -0.082957, 0.028505, 0.363120, -0.903436, 0.227921, -0.619642, -0.416835, -0.665051, 1.000000, 0.235940, 0.147660, 13, 12, 1, 1, 0.930163, 0.069837, 0.000000, 0.000000 },
-	{ -0.036864, -0.083281, 0.028277, 0.180332, -0.948410, 0.260766, -0.656437, -0.313477, -0.686165, 1.000000, 0.238800, 0.149170, 13, 12, 1, 1, 0.932978, 0.067022, 0.000000, 0.000000 },
-	{ -0.036720, -0.084776, 0.024313, 0.213571, -0.904216, 0.369841, -0.702580, -0.405208, -0.584968, 1.000000, 0.244070, 0.141930, 13, 12, 1, 1, 0.989859, 0.010141, 0.000000, 0.000000 },
-	{ -0.035633, -0.084306, 0.024603, 0.398419, -0.851435, 0.341057, -0.652292, -0.524441, -0.547244, 1.000000, 0.240930, 0.140810, 13, 12, 1, 1, 0.989934, 0.010066, 0.000000, 0.000000 },
-	{ -0.034559, -0.082297, 0.028654, 0.613736, -0.770913, 0.170356, -0.522107, -0.558161, -0.644873, 1.000000, 0.232540, 0.145840, 13, 12, 1, 1, 0.908345, 0.091655, 0.000000, 0.000000 },
-	{ -0.034438, -0.083460, 0.024845, 0.637264, -0.716295, 0.284282, -0.535934, -0.676999, -0.504427, 1.000000, 0.237180, 0.139420, 13, 12, 1, 1, 0.987151, 0.012849, 0.000000, 0.000000 },
-	{ -0.035327, -0.085967, 0.020478, 0.435561, -0.825358, 0.359265, -0.676892, -0.563406, -0.473699, 1.000000, 0.245750, 0.132380, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.036398, -0.086498, 0.020140, 0.253517, -0.890710, 0.377314, -0.731855, -0.431674, -0.527301, 1.000000, 0.248980, 0.133230, 13, 14, 1, 1, 0.998556, 0.001444, 0.000000, 0.000000 },
-	{ -0.034872, -0.087570, 0.016182, 0.456837, -0.812374, 0.362420, -0.699505, -0.579763, -0.417814, 1.000000, 0.250270, 0.122590, 13, 14, 1, 1, 0.986545, 0.013455, 0.000000, 0.000000 },
-	{ -0.035903, -0.088157, 0.015793, 0.285191, -0.881765, 0.375708, -0.755036, -0.448142, -0.478633, 1.000000, 0.253450, 0.123150, 13, 14, 1, 1, 0.984232, 0.015768, 0.000000, 0.000000 },
-	{ -0.035308, -0.089691, 0.011790, 0.313744, -0.869854, 0.380682, -0.776153, -0.465894, -0.424888, 1.000000, 0.257160, 0.113100, 13, 14, 1, 1, 0.920237, 0.079763, 0.000000, 0.000000 },
-	{ -0.034313, -0.089058, 0.012251, 0.467058, -0.801576, 0.373273, -0.707824, -0.591938, -0.385479, 1.000000, 0.253970, 0.112930, 13, 14, 1, 1, 0.927673, 0.072327, 0.000000, 0.000000 },
-	{ -0.033695, -0.086555, 0.016553, 0.658213, -0.677181, 0.328910, -0.584089, -0.735004, -0.344398, 1.000000, 0.246220, 0.121940, 13, 14, 1, 1, 0.990120, 0.009880, 0.000000, 0.000000 },
-	{ -0.033171, -0.088021, 0.012654, 0.662310, -0.665276, 0.344607, -0.582907, -0.746508, -0.320851, 1.000000, 0.250030, 0.112420, 13, 14, 1, 1, 0.940839, 0.059161, 0.000000, 0.000000 },
-	{ -0.034128, -0.085005, 0.020791, 0.651211, -0.689240, 0.317604, -0.556946, -0.718330, -0.416909, 1.000000, 0.241760, 0.131320, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.036172, -0.090157, 0.011306, 0.220935, -0.895940, 0.385331, -0.784059, -0.398139, -0.476169, 1.000000, 0.259870, 0.113060, 13, 14, 1, 1, 0.917168, 0.082832, 0.000000, 0.000000 },
-	{ -0.036836, -0.088564, 0.015383, 0.178476, -0.906783, 0.381958, -0.785528, -0.365080, -0.499662, 1.000000, 0.256240, 0.123580, 13, 14, 1, 1, 0.983741, 0.016259, 0.000000, 0.000000 },
-	{ -0.037398, -0.086838, 0.019787, 0.142109, -0.912839, 0.382794, -0.750086, -0.351647, -0.560103, 1.000000, 0.251870, 0.134030, 13, 14, 1, 1, 0.998257, 0.001743, 0.000000, 0.000000 },
-	{ -0.037757, -0.085093, 0.024005, 0.105180, -0.917758, 0.382958, -0.716349, -0.337030, -0.610945, 1.000000, 0.247010, 0.142980, 13, 12, 1, 1, 0.990456, 0.009545, 0.000000, 0.000000 },
-	{ -0.037920, -0.083484, 0.028003, 0.065329, -0.956189, 0.285368, -0.679608, -0.252036, -0.688921, 1.000000, 0.241540, 0.150540, 13, 12, 1, 1, 0.936615, 0.063385, 0.000000, 0.000000 },
-	{ -0.037881, -0.082696, 0.032098, 0.008505, -0.980202, 0.197819, -0.633086, -0.158408, -0.757700, 1.000000, 0.235580, 0.156840, 13, 12, 1, 1, 0.791492, 0.208508, 0.000000, 0.000000 },
-	{ -0.037897, -0.081831, 0.036305, -0.047611, -0.968643, 0.243851, -0.610671, -0.164964, -0.774511, 1.000000, 0.228400, 0.162660, 13, 12, 1, 1, 0.544794, 0.455206, 0.000000, 0.000000 },
-	{ -0.038005, -0.080625, 0.040459, -0.070358, -0.953095, 0.294382, -0.575212, -0.202342, -0.792583, 1.000000, 0.219900, 0.168190, 12, 13, 1, 1, 0.724622, 0.275378, 0.000000, 0.000000 },
-	{ -0.038178, -0.079296, 0.044504, -0.072348, -0.947270, 0.312162, -0.546534, -0.224156, -0.806880, 1.000000, 0.211860, 0.172960, 12, 13, 1, 1, 0.892133, 0.107867, 0.000000, 0.000000 },
-	{ -0.038212, -0.077923, 0.048631, -0.088702, -0.948992, 0.302566, -0.553976, -0.205446, -0.806785, 1.000000, 0.203330, 0.177790, 12, 13, 1, 1, 0.966811, 0.033189, 0.000000, 0.000000 },
-	{ -0.038220, -0.076530, 0.053212, -0.117791, -0.960077, 0.253730, -0.541778, -0.152001, -0.826664, 1.000000, 0.193850, 0.182870, 12, 13, 1, 1, 0.993464, 0.006536, 0.000000, 0.000000 },
-	{ -0.039049, -0.083650, 0.027614, -0.050226, -0.947594, 0.315505, -0.697096, -0.192964, -0.690523, 1.000000, 0.244620, 0.151770, 13, 12, 1, 1, 0.946126, 0.053874, 0.000000, 0.000000 },
-	{ -0.038850, -0.085357, 0.023624, 0.001364, -0.920678, 0.390322, -0.732319, -0.266714, -0.626556, 1.000000, 0.250080, 0.144050, 13, 12, 1, 1, 0.993152, 0.006848, 0.000000, 0.000000 },
-	{ -0.038436, -0.087123, 0.019348, 0.043965, -0.922132, 0.384369, -0.773932, -0.274729, -0.570573, 1.000000, 0.254890, 0.134760, 13, 14, 1, 1, 0.998089, 0.001911, 0.000000, 0.000000 },
-	{ -0.037797, -0.088924, 0.014887, 0.089666, -0.917507, 0.387482, -0.796237, -0.299747, -0.525508, 1.000000, 0.259130, 0.123820, 13, 14, 1, 1, 0.981516, 0.018484, 0.000000, 0.000000 },
-	{ -0.037069, -0.090572, 0.010789, 0.141431, -0.909811, 0.390183, -0.799438, -0.337431, -0.497031, 1.000000, 0.262450, 0.113260, 13, 14, 1, 1, 0.897849, 0.102151, 0.000000, 0.000000 },
-	{ -0.040228, -0.076290, 0.052399, -0.326037, -0.907800, 0.263816, -0.493081, -0.074799, -0.866762, 1.000000, 0.197900, 0.185400, 12, 13, 1, 1, 0.992194, 0.007806, 0.000000, 0.000000 },
-	{ -0.039969, -0.077835, 0.047996, -0.282761, -0.910598, 0.301425, -0.515869, -0.120562, -0.848141, 1.000000, 0.206930, 0.180020, 12, 13, 1, 1, 0.962822, 0.037178, 0.000000, 0.000000 },
-	{ -0.039731, -0.079233, 0.043915, -0.262101, -0.919637, 0.292525, -0.513857, -0.123582, -0.848928, 1.000000, 0.215010, 0.174970, 12, 13, 1, 1, 0.880984, 0.119016, 0.000000, 0.000000 },
-	{ -0.039414, -0.080561, 0.039886, -0.251859, -0.927084, 0.277638, -0.561703, -0.093580, -0.822030, 1.000000, 0.223110, 0.169840, 12, 13, 1, 1, 0.693594, 0.306406, 0.000000, 0.000000 },
-	{ -0.039164, -0.081800, 0.035788, -0.212373, -0.946526, 0.242870, -0.590191, -0.073846, -0.803879, 1.000000, 0.231540, 0.164120, 13, 12, 1, 1, 0.585845, 0.414155, 0.000000, 0.000000 },
-	{ -0.039048, -0.082702, 0.031657, -0.130075, -0.966440, 0.221526, -0.638517, -0.089278, -0.764412, 1.000000, 0.238570, 0.158220, 13, 12, 1, 1, 0.815502, 0.184498, 0.000000, 0.000000 },
-	{ -0.038245, -0.091053, 0.010036, 0.014157, -0.922155, 0.386563, -0.839657, -0.220884, -0.496172, 1.000000, 0.266190, 0.113070, 13, 14, 1, 1, 0.850516, 0.149484, 0.000000, 0.000000 },
-	{ -0.038965, -0.089301, 0.014170, -0.048386, -0.920606, 0.387483, -0.821960, -0.183708, -0.539104, 1.000000, 0.262720, 0.124000, 13, 14, 1, 1, 0.970669, 0.029331, 0.000000, 0.000000 },
-	{ -0.039669, -0.087373, 0.018714, -0.113762, -0.918454, 0.378816, -0.792220, -0.146231, -0.592456, 1.000000, 0.258680, 0.135310, 13, 14, 1, 1, 0.997299, 0.002701, 0.000000, 0.000000 },
-	{ -0.040185, -0.085530, 0.023083, -0.161383, -0.909838, 0.382297, -0.739992, -0.144742, -0.656857, 1.000000, 0.253970, 0.145170, 13, 12, 1, 1, 0.996520, 0.003480, 0.000000, 0.000000 },
-	{ -0.040480, -0.083717, 0.027093, -0.204757, -0.918491, 0.338303, -0.683700, -0.113125, -0.720942, 1.000000, 0.248600, 0.153290, 13, 12, 1, 1, 0.960554, 0.039446, 0.000000, 0.000000 },
-	{ -0.040578, -0.082525, 0.031070, -0.277353, -0.926285, 0.255091, -0.618184, -0.031196, -0.785414, 1.000000, 0.242640, 0.160140, 13, 12, 1, 1, 0.842401, 0.157599, 0.000000, 0.000000 },
-	{ -0.040813, -0.081479, 0.035068, -0.362326, -0.899070, 0.245750, -0.551354, -0.005836, -0.834251, 1.000000, 0.235730, 0.166350, 13, 12, 1, 1, 0.632980, 0.367020, 0.000000, 0.000000 },
-	{ -0.041171, -0.080163, 0.039053, -0.411654, -0.874005, 0.258179, -0.506626, -0.016018, -0.862017, 1.000000, 0.227960, 0.172140, 12, 13, 1, 1, 0.643761, 0.356239, 0.000000, 0.000000 },
-	{ -0.041579, -0.078802, 0.043035, -0.434259, -0.861651, 0.262633, -0.456353, -0.040931, -0.888857, 1.000000, 0.219490, 0.177650, 12, 13, 1, 1, 0.863324, 0.136676, 0.000000, 0.000000 },
-	{ -0.041942, -0.077376, 0.047058, -0.459766, -0.842563, 0.280539, -0.437911, -0.059717, -0.897033, 1.000000, 0.211690, 0.182880, 12, 13, 1, 1, 0.959926, 0.040074, 0.000000, 0.000000 },
-	{ -0.042309, -0.075675, 0.051294, -0.497384, -0.826946, 0.262239, -0.410884, -0.041675, -0.910735, 1.000000, 0.203120, 0.188480, 12, 13, 1, 1, 0.991098, 0.008902, 0.000000, 0.000000 },
-	{ -0.041981, -0.085279, 0.022448, -0.365946, -0.863605, 0.346799, -0.701250, 0.010897, -0.712832, 1.000000, 0.259050, 0.147220, 13, 12, 1, 1, 0.998791, 0.001209, 0.000000, 0.000000 },
-	{ -0.041253, -0.087361, 0.017909, -0.331326, -0.877116, 0.347694, -0.759256, 0.029085, -0.650142, 1.000000, 0.263320, 0.136160, 13, 14, 1, 1, 0.995282, 0.004719, 0.000000, 0.000000 },
-	{ -0.044272, -0.084260, 0.021859, -0.579718, -0.767871, 0.272583, -0.609267, 0.186371, -0.770753, 1.000000, 0.265770, 0.151340, 13, 12, 1, 1, 0.998762, 0.001238, 0.000000, 0.000000 },
-	{ -0.042473, -0.083410, 0.026500, -0.392788, -0.859032, 0.328301, -0.644815, 0.002729, -0.764334, 1.000000, 0.254340, 0.156150, 13, 12, 1, 1, 0.975166, 0.024834, 0.000000, 0.000000 },
-	{ -0.044978, -0.082243, 0.025855, -0.586804, -0.762385, 0.272818, -0.570409, 0.150065, -0.807536, 1.000000, 0.261510, 0.160780, 13, 12, 1, 1, 0.983798, 0.016202, 0.000000, 0.000000 },
-	{ -0.047417, -0.080101, 0.025121, -0.795758, -0.590405, 0.134874, -0.390835, 0.330525, -0.859070, 1.000000, 0.269500, 0.166540, 13, 12, 1, 1, 0.971845, 0.026864, 0.001291, 0.000000 },
-	{ -0.046573, -0.082237, 0.021296, -0.804467, -0.579214, 0.131697, -0.417408, 0.393493, -0.819106, 1.000000, 0.273340, 0.156650, 13, 12, 1, 1, 0.998658, 0.001342, 0.000000, 0.000000 },
-	{ -0.048312, -0.078915, 0.020457, -0.938620, -0.343937, -0.026437, -0.187672, 0.573464, -0.797445, 1.000000, 0.283310, 0.163660, 13, 12, 1, 1, 0.997308, 0.002692, 0.000000, 0.000000 },
-	{ -0.049266, -0.076801, 0.023889, -0.926137, -0.370078, -0.072891, -0.139818, 0.516314, -0.844909, 1.000000, 0.279810, 0.173210, 13, 12, 1, 1, 0.962155, 0.030889, 0.006956, 0.000000 },
-	{ -0.049863, -0.072853, 0.022273, -0.935224, -0.202778, -0.290236, 0.084544, 0.668131, -0.739225, 1.000000, 0.293850, 0.178660, 13, 12, 17, 1, 0.936274, 0.026318, 0.021886, 0.015522 },
-	{ -0.048913, -0.075342, 0.019370, -0.975454, -0.088384, -0.201689, 0.073736, 0.731938, -0.677369, 1.000000, 0.294340, 0.168820, 13, 12, 1, 1, 0.993290, 0.003864, 0.002846, 0.000000 },
-	{ -0.049136, -0.070431, 0.020581, -0.852600, -0.063776, -0.518658, 0.301066, 0.751298, -0.587292, 1.000000, 0.303960, 0.179290, 13, 17, 12, 1, 0.930371, 0.047198, 0.014097, 0.008333 },
-	{ -0.048297, -0.072853, 0.018405, -0.901747, 0.165340, -0.399393, 0.363639, 0.789701, -0.494105, 1.000000, 0.302560, 0.170610, 13, 12, 1, 17, 0.994189, 0.003466, 0.001262, 0.001083 },
-	{ -0.048059, -0.077995, 0.015224, -0.983221, -0.084322, -0.161761, 0.029576, 0.801334, -0.597486, 1.000000, 0.295840, 0.155150, 13, 14, 1, 1, 0.997918, 0.002082, 0.000000, 0.000000 },
-	{ -0.047506, -0.075594, 0.014666, -0.912406, 0.238442, -0.332659, 0.370263, 0.827227, -0.422611, 1.000000, 0.302080, 0.157250, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.047025, -0.080509, 0.010167, -0.982446, -0.101729, -0.156370, -0.003325, 0.847644, -0.530555, 1.000000, 0.298280, 0.138910, 13, 14, 1, 1, 0.967121, 0.032879, 0.000000, 0.000000 },
-	{ -0.046665, -0.078131, 0.010114, -0.919370, 0.250785, -0.303094, 0.356436, 0.857059, -0.372027, 1.000000, 0.303440, 0.141660, 13, 14, 1, 1, 0.981560, 0.018441, 0.000000, 0.000000 },
-	{ -0.046054, -0.082293, 0.005393, -0.979583, -0.094797, -0.177289, 0.009026, 0.860225, -0.509836, 1.000000, 0.301230, 0.124560, 13, 14, 1, 1, 0.850248, 0.149752, 0.000000, 0.000000 },
-	{ -0.045266, -0.085325, 0.005623, -0.922835, -0.378493, -0.071538, -0.259737, 0.748589, -0.610042, 1.000000, 0.294660, 0.120430, 13, 14, 1, 1, 0.796680, 0.203320, 0.000000, 0.000000 },
-	{ -0.046183, -0.083747, 0.010486, -0.927145, -0.373040, -0.035250, -0.262092, 0.712864, -0.650487, 1.000000, 0.290740, 0.134060, 13, 14, 1, 1, 0.944601, 0.055399, 0.000000, 0.000000 },
-	{ -0.044404, -0.087151, 0.011208, -0.823709, -0.562039, 0.074937, -0.442349, 0.554291, -0.705045, 1.000000, 0.280510, 0.128110, 13, 14, 1, 1, 0.915580, 0.084420, 0.000000, 0.000000 },
-	{ -0.043490, -0.088851, 0.006640, -0.838764, -0.544399, 0.010260, -0.412998, 0.623807, -0.663549, 1.000000, 0.283670, 0.115670, 13, 14, 1, 1, 0.723518, 0.276482, 0.000000, 0.000000 },
-	{ -0.045738, -0.080029, 0.005677, -0.912528, 0.268565, -0.308489, 0.372885, 0.856186, -0.357635, 1.000000, 0.305690, 0.128060, 13, 14, 1, 1, 0.890302, 0.109698, 0.000000, 0.000000 },
-	{ -0.041631, -0.091044, 0.007868, -0.628877, -0.759772, 0.165107, -0.642476, 0.388213, -0.660693, 1.000000, 0.276220, 0.113110, 13, 14, 1, 1, 0.712911, 0.287089, 0.000000, 0.000000 },
-	{ -0.042345, -0.089103, 0.012061, -0.600220, -0.764421, 0.235363, -0.680071, 0.332861, -0.653228, 1.000000, 0.273460, 0.124330, 13, 14, 1, 1, 0.884708, 0.115293, 0.000000, 0.000000 },
-	{ -0.040455, -0.089548, 0.013149, -0.284223, -0.890000, 0.356536, -0.823864, 0.036518, -0.565610, 1.000000, 0.267470, 0.123750, 13, 14, 1, 1, 0.946505, 0.053495, 0.000000, 0.000000 },
-	{ -0.039762, -0.091412, 0.009023, -0.245646, -0.909504, 0.335352, -0.828799, 0.017635, -0.559269, 1.000000, 0.270880, 0.112740, 13, 14, 1, 1, 0.787363, 0.212637, 0.000000, 0.000000 },
-	{ -0.047288, -0.081377, 0.015913, -0.933434, -0.358217, -0.019534, -0.235348, 0.652543, -0.720277, 1.000000, 0.286870, 0.150330, 13, 14, 1, 1, 0.994870, 0.005130, 0.000000, 0.000000 },
-	{ -0.045530, -0.084706, 0.016530, -0.809452, -0.576767, 0.110122, -0.443495, 0.477608, -0.758421, 1.000000, 0.276880, 0.143490, 13, 14, 1, 1, 0.990069, 0.009931, 0.000000, 0.000000 },
-	{ -0.043321, -0.086617, 0.017112, -0.580524, -0.772160, 0.258382, -0.651757, 0.250454, -0.715881, 1.000000, 0.269730, 0.138740, 13, 14, 1, 1, 0.982669, 0.017331, 0.000000, 0.000000 },
-	{ -0.037529, -0.092281, 0.006945, 0.054990, -0.934141, 0.352643, -0.802060, -0.251681, -0.541624, 1.000000, 0.268440, 0.104880, 13, 14, 1, 1, 0.620499, 0.379501, 0.000000, 0.000000 },
-	{ -0.039058, -0.092557, 0.006127, -0.222838, -0.943161, 0.246560, -0.787742, 0.025217, -0.615490, 1.000000, 0.272660, 0.105460, 13, 14, 1, 1, 0.566296, 0.433704, 0.000000, 0.000000 },
-	{ -0.038250, -0.093144, 0.003970, -0.215664, -0.968305, 0.125993, -0.758490, 0.084860, -0.646136, 1.000000, 0.273680, 0.099910, 14, 13, 1, 1, 0.629242, 0.370758, 0.000000, 0.000000 },
-	{ -0.040150, -0.092485, 0.002806, -0.584571, -0.805802, -0.094656, -0.571403, 0.491710, -0.657054, 1.000000, 0.279260, 0.100950, 14, 13, 1, 1, 0.613860, 0.386140, 0.000000, 0.000000 },
-	{ -0.040933, -0.092019, 0.004963, -0.627456, -0.777583, 0.040798, -0.600298, 0.449699, -0.661373, 1.000000, 0.277930, 0.106250, 13, 14, 1, 1, 0.545623, 0.454377, 0.000000, 0.000000 },
-	{ -0.042089, -0.090084, 0.001277, -0.776945, -0.592779, -0.212060, -0.355409, 0.691004, -0.629443, 1.000000, 0.287860, 0.102770, 14, 13, 1, 1, 0.579352, 0.420648, 0.000000, 0.000000 },
-	{ -0.042790, -0.089650, 0.003478, -0.828146, -0.553796, -0.086513, -0.382709, 0.671438, -0.634591, 1.000000, 0.286150, 0.107980, 13, 14, 1, 1, 0.543853, 0.456147, 0.000000, 0.000000 },
-	{ -0.043839, -0.086646, -0.000099, -0.870308, -0.408902, -0.274522, -0.189080, 0.792087, -0.580385, 1.000000, 0.298880, 0.106150, 14, 13, 1, 1, 0.522105, 0.477895, 0.000000, 0.000000 },
-	{ -0.044567, -0.086119, 0.002216, -0.911135, -0.385692, -0.145168, -0.231351, 0.770226, -0.594331, 1.000000, 0.297390, 0.111900, 13, 14, 1, 1, 0.606904, 0.393096, 0.000000, 0.000000 },
-	{ -0.045278, -0.083248, 0.001860, -0.967251, -0.061442, -0.246273, 0.062839, 0.882088, -0.466874, 1.000000, 0.303510, 0.115080, 13, 14, 1, 1, 0.680924, 0.319076, 0.000000, 0.000000 },
-	{ -0.044445, -0.083874, -0.000606, -0.923553, -0.045447, -0.380768, 0.127507, 0.900060, -0.416696, 1.000000, 0.305070, 0.108820, 13, 14, 1, 1, 0.527836, 0.472164, 0.000000, 0.000000 },
-	{ -0.044818, -0.081227, 0.002166, -0.877348, 0.323669, -0.354259, 0.434768, 0.848607, -0.301402, 1.000000, 0.307690, 0.117800, 13, 14, 1, 1, 0.725329, 0.274671, 0.000000, 0.000000 },
-	{ -0.043931, -0.081973, -0.000450, -0.817981, 0.360402, -0.448350, 0.489817, 0.845068, -0.214335, 1.000000, 0.309370, 0.110600, 13, 14, 1, 1, 0.560059, 0.439941, 0.000000, 0.000000 },
-	{ -0.043140, -0.080505, -0.000146, -0.719592, 0.515783, -0.464925, 0.628422, 0.768558, -0.120017, 1.000000, 0.313630, 0.112130, 13, 14, 1, 1, 0.569543, 0.430457, 0.000000, 0.000000 },
-	{ -0.044100, -0.079594, 0.002511, -0.775448, 0.480899, -0.409166, 0.586223, 0.789072, -0.183598, 1.000000, 0.311970, 0.119980, 13, 14, 1, 1, 0.755786, 0.244214, 0.000000, 0.000000 },
-	{ -0.042412, -0.079435, 0.000153, -0.618078, 0.622971, -0.479466, 0.721912, 0.691221, -0.032510, 1.000000, 0.316840, 0.113300, 13, 14, 1, 1, 0.568759, 0.431241, 0.000000, 0.000000 },
-	{ -0.043368, -0.078408, 0.002768, -0.665840, 0.600516, -0.442760, 0.694468, 0.715750, -0.073595, 1.000000, 0.315350, 0.121250, 13, 14, 1, 1, 0.790768, 0.209232, 0.000000, 0.000000 },
-	{ -0.041724, -0.078703, 0.000444, -0.450560, 0.753377, -0.478977, 0.830106, 0.550972, 0.085759, 1.000000, 0.319260, 0.114110, 13, 14, 1, 1, 0.598188, 0.401812, 0.000000, 0.000000 },
-	{ -0.042658, -0.077626, 0.003013, -0.487581, 0.742316, -0.459600, 0.822620, 0.566962, 0.043018, 1.000000, 0.317820, 0.122050, 13, 14, 1, 1, 0.831286, 0.168714, 0.000000, 0.000000 },
-	{ -0.040857, -0.078120, 0.000795, -0.276777, 0.844342, -0.458782, 0.901327, 0.393644, 0.180705, 1.000000, 0.321950, 0.114720, 13, 14, 1, 1, 0.630763, 0.369237, 0.000000, 0.000000 },
-	{ -0.041771, -0.077017, 0.003334, -0.299071, 0.839630, -0.453407, 0.906803, 0.398011, 0.138911, 1.000000, 0.320510, 0.122720, 13, 14, 1, 1, 0.847566, 0.152434, 0.000000, 0.000000 },
-	{ -0.040517, -0.076456, 0.003790, -0.154739, 0.885427, -0.438264, 0.938449, 0.270396, 0.214942, 1.000000, 0.324300, 0.123360, 13, 14, 1, 1, 0.843635, 0.156365, 0.000000, 0.000000 },
-	{ -0.039644, -0.077567, 0.001300, -0.141249, 0.889425, -0.434709, 0.932816, 0.266623, 0.242419, 1.000000, 0.325670, 0.115380, 13, 14, 1, 1, 0.626196, 0.373804, 0.000000, 0.000000 },
-	{ -0.038092, -0.077102, 0.002003, 0.038996, 0.918607, -0.393243, 0.943817, 0.095382, 0.316404, 1.000000, 0.330290, 0.116160, 13, 14, 1, 1, 0.639268, 0.360732, 0.000000, 0.000000 },
-	{ -0.038888, -0.075987, 0.004421, 0.027316, 0.911928, -0.409441, 0.949765, 0.104070, 0.295154, 1.000000, 0.329060, 0.124000, 13, 14, 1, 1, 0.871084, 0.128916, 0.000000, 0.000000 },
-	{ -0.037201, -0.078042, -0.000239, 0.028498, 0.934950, -0.353634, 0.938917, 0.096344, 0.330382, 1.000000, 0.331420, 0.108800, 14, 13, 1, 1, 0.581540, 0.418460, 0.000000, 0.000000 },
-	{ -0.038672, -0.078517, -0.001031, -0.142976, 0.900062, -0.411640, 0.923908, 0.270515, 0.270585, 1.000000, 0.326930, 0.107820, 14, 13, 1, 1, 0.571514, 0.428486, 0.000000, 0.000000 },
-	{ -0.036021, -0.078984, -0.002782, 0.004061, 0.947619, -0.319377, 0.926772, 0.116394, 0.357136, 1.000000, 0.332720, 0.100210, 14, 13, 15, 1, 0.734846, 0.263472, 0.001682, 0.000000 },
-	{ -0.037440, -0.079482, -0.003660, -0.160935, 0.905519, -0.392602, 0.906180, 0.293187, 0.304762, 1.000000, 0.328180, 0.099120, 14, 13, 15, 1, 0.738902, 0.258944, 0.002154, 0.000000 },
-	{ -0.039827, -0.079061, -0.001595, -0.271685, 0.851214, -0.449023, 0.887870, 0.401711, 0.224312, 1.000000, 0.323320, 0.107100, 14, 13, 1, 1, 0.587683, 0.412317, 0.000000, 0.000000 },
-	{ -0.038537, -0.080052, -0.004273, -0.291366, 0.845603, -0.447282, 0.867812, 0.430380, 0.248344, 1.000000, 0.324600, 0.098360, 14, 13, 15, 1, 0.775559, 0.222323, 0.002118, 0.000000 },
-	{ -0.035875, -0.080501, -0.006761, -0.193265, 0.903854, -0.381704, 0.880167, 0.331620, 0.339610, 1.000000, 0.329270, 0.088660, 14, 13, 15, 1, 0.884599, 0.092956, 0.022444, 0.000000 },
-	{ -0.034461, -0.079955, -0.005859, -0.021326, 0.954410, -0.297736, 0.907229, 0.143608, 0.395364, 1.000000, 0.333980, 0.089610, 14, 13, 15, 1, 0.872021, 0.107979, 0.020000, 0.000000 },
-	{ -0.034150, -0.081413, -0.009941, -0.216666, 0.898914, -0.380802, 0.841685, 0.369624, 0.393631, 1.000000, 0.330140, 0.077710, 14, 15, 13, 1, 0.880027, 0.106812, 0.013161, 0.000000 },
-	{ -0.032745, -0.080854, -0.009031, -0.027656, 0.956436, -0.290628, 0.871624, 0.165414, 0.461421, 1.000000, 0.334910, 0.078280, 14, 15, 13, 1, 0.882722, 0.099043, 0.018235, 0.000000 },
-	{ -0.031158, -0.081627, -0.011732, -0.007830, 0.956245, -0.292461, 0.829842, 0.169400, 0.531663, 1.000000, 0.335580, 0.068460, 14, 15, 1, 1, 0.733047, 0.266953, 0.000000, 0.000000 },
-	{ -0.032531, -0.082166, -0.012644, -0.210887, 0.898903, -0.384058, 0.809951, 0.380653, 0.446187, 1.000000, 0.330900, 0.068220, 14, 15, 1, 1, 0.705672, 0.294328, 0.000000, 0.000000 },
-	{ -0.033533, -0.082832, -0.013229, -0.379365, 0.806890, -0.452781, 0.757052, 0.552036, 0.349470, 1.000000, 0.327320, 0.067980, 14, 15, 1, 1, 0.677033, 0.322967, 0.000000, 0.000000 },
-	{ -0.035187, -0.082098, -0.010509, -0.375014, 0.808540, -0.453462, 0.785779, 0.536785, 0.307268, 1.000000, 0.326470, 0.077320, 14, 15, 13, 1, 0.880084, 0.111378, 0.008538, 0.000000 },
-	{ -0.036946, -0.081118, -0.007367, -0.336172, 0.826690, -0.451189, 0.831368, 0.485577, 0.270262, 1.000000, 0.325610, 0.088010, 14, 13, 15, 1, 0.909896, 0.068499, 0.021605, 0.000000 },
-	{ -0.040674, -0.079624, -0.001976, -0.431542, 0.758484, -0.488337, 0.821143, 0.554412, 0.135470, 1.000000, 0.320630, 0.106570, 14, 13, 1, 1, 0.623849, 0.376151, 0.000000, 0.000000 },
-	{ -0.039346, -0.080647, -0.004669, -0.447504, 0.738665, -0.504097, 0.796138, 0.585807, 0.151638, 1.000000, 0.321850, 0.097790, 14, 13, 15, 1, 0.811471, 0.186719, 0.001810, 0.000000 },
-	{ -0.037735, -0.081764, -0.007723, -0.489703, 0.703077, -0.515630, 0.742469, 0.646312, 0.176129, 1.000000, 0.322770, 0.087630, 14, 13, 15, 1, 0.928101, 0.051074, 0.020825, 0.000000 },
-	{ -0.035945, -0.082792, -0.010813, -0.527169, 0.676693, -0.513984, 0.690407, 0.693709, 0.205196, 1.000000, 0.323600, 0.077170, 14, 15, 13, 1, 0.876993, 0.117254, 0.005753, 0.000000 },
-	{ -0.034269, -0.083497, -0.013576, -0.538546, 0.669457, -0.511659, 0.660468, 0.712464, 0.237016, 1.000000, 0.324570, 0.067870, 14, 15, 1, 1, 0.667218, 0.332782, 0.000000, 0.000000 },
-	{ -0.041349, -0.080327, -0.002275, -0.586543, 0.624877, -0.515264, 0.720178, 0.693466, 0.021185, 1.000000, 0.318170, 0.105880, 14, 13, 1, 1, 0.631503, 0.368497, 0.000000, 0.000000 },
-	{ -0.039989, -0.081372, -0.004964, -0.593217, 0.592489, -0.545023, 0.689025, 0.723799, 0.036883, 1.000000, 0.319310, 0.097140, 14, 13, 15, 1, 0.827248, 0.170928, 0.001825, 0.000000 },
-	{ -0.038353, -0.082545, -0.007961, -0.620812, 0.553927, -0.554759, 0.640794, 0.766213, 0.047972, 1.000000, 0.320080, 0.087230, 14, 13, 15, 1, 0.938179, 0.039846, 0.021975, 0.000000 },
-	{ -0.036570, -0.083592, -0.011019, -0.646397, 0.529087, -0.549762, 0.591968, 0.802355, 0.076158, 1.000000, 0.320850, 0.077020, 14, 15, 13, 1, 0.879244, 0.117294, 0.003463, 0.000000 },
-	{ -0.034861, -0.084329, -0.013782, -0.656092, 0.519100, -0.547794, 0.560635, 0.821163, 0.106678, 1.000000, 0.321820, 0.067780, 14, 15, 1, 1, 0.685403, 0.314597, 0.000000, 0.000000 },
-	{ -0.042043, -0.081337, -0.002551, -0.681327, 0.503948, -0.530877, 0.625827, 0.777215, -0.065397, 1.000000, 0.315050, 0.104970, 14, 13, 1, 1, 0.624178, 0.375823, 0.000000, 0.000000 },
-	{ -0.040603, -0.082397, -0.005227, -0.686123, 0.454630, -0.567932, 0.583949, 0.809769, -0.057252, 1.000000, 0.316150, 0.096230, 14, 13, 15, 1, 0.838053, 0.159841, 0.002106, 0.000000 },
-	{ -0.038899, -0.083616, -0.008234, -0.711779, 0.409640, -0.570584, 0.543234, 0.836000, -0.077471, 1.000000, 0.316780, 0.086220, 14, 13, 15, 1, 0.944272, 0.032527, 0.023201, 0.000000 },
-	{ -0.037107, -0.084700, -0.011284, -0.729407, 0.393376, -0.559662, 0.510757, 0.857413, -0.063010, 1.000000, 0.317360, 0.076190, 14, 15, 13, 1, 0.881217, 0.116630, 0.002153, 0.000000 },
-	{ -0.035412, -0.085467, -0.014044, -0.726211, 0.398231, -0.560383, 0.489288, 0.872004, -0.014397, 1.000000, 0.318190, 0.067130, 14, 15, 1, 1, 0.681043, 0.318957, 0.000000, 0.000000 },
-	{ -0.042790, -0.082734, -0.002770, -0.773687, 0.323878, -0.544529, 0.478846, 0.861707, -0.167831, 1.000000, 0.310830, 0.103840, 14, 13, 1, 1, 0.632875, 0.367125, 0.000000, 0.000000 },
-	{ -0.041234, -0.083778, -0.005398, -0.776660, 0.247979, -0.579055, 0.410220, 0.896716, -0.166192, 1.000000, 0.311960, 0.095230, 14, 13, 15, 1, 0.845106, 0.152709, 0.002185, 0.000000 },
-	{ -0.043280, -0.084569, -0.002773, -0.865154, -0.082198, -0.494724, 0.131791, 0.914541, -0.382422, 1.000000, 0.306250, 0.102570, 14, 13, 1, 1, 0.650604, 0.349396, 0.000000, 0.000000 },
-	{ -0.041597, -0.085547, -0.005251, -0.844284, -0.143118, -0.516431, 0.071516, 0.924968, -0.373255, 1.000000, 0.307300, 0.094410, 14, 13, 15, 1, 0.855774, 0.142003, 0.002223, 0.000000 },
-	{ -0.041062, -0.088014, -0.004477, -0.792483, -0.465959, -0.393514, -0.203730, 0.810402, -0.549311, 1.000000, 0.300730, 0.092910, 14, 13, 15, 1, 0.885932, 0.112242, 0.001826, 0.000000 },
-	{ -0.042738, -0.087195, -0.002108, -0.813595, -0.440228, -0.379819, -0.178542, 0.810846, -0.557361, 1.000000, 0.299980, 0.100610, 14, 13, 1, 1, 0.690127, 0.309873, 0.000000, 0.000000 },
-	{ -0.041022, -0.090457, -0.000678, -0.721174, -0.624487, -0.299873, -0.347670, 0.700677, -0.623039, 1.000000, 0.288920, 0.097600, 14, 13, 1, 1, 0.764951, 0.235049, 0.000000, 0.000000 },
-	{ -0.039429, -0.091050, -0.003036, -0.706561, -0.640588, -0.300697, -0.363076, 0.692891, -0.622960, 1.000000, 0.289770, 0.090190, 14, 13, 1, 1, 0.917453, 0.082547, 0.000000, 0.000000 },
-	{ -0.037518, -0.093234, -0.001623, -0.555966, -0.813317, -0.171515, -0.543694, 0.511914, -0.665087, 1.000000, 0.281110, 0.088010, 14, 13, 1, 1, 0.933177, 0.066823, 0.000000, 0.000000 },
-	{ -0.039060, -0.092799, 0.000782, -0.551117, -0.816307, -0.172954, -0.550829, 0.511600, -0.659434, 1.000000, 0.280170, 0.095430, 14, 13, 1, 1, 0.779310, 0.220690, 0.000000, 0.000000 },
-	{ -0.037237, -0.093540, 0.001866, -0.234593, -0.970543, 0.054893, -0.732742, 0.139441, -0.666067, 1.000000, 0.274750, 0.094130, 14, 13, 1, 1, 0.806067, 0.193933, 0.000000, 0.000000 },
-	{ -0.035810, -0.094026, -0.000606, -0.275185, -0.960173, 0.048397, -0.708842, 0.168631, -0.684914, 1.000000, 0.275850, 0.086570, 14, 13, 1, 1, 0.933911, 0.066089, 0.000000, 0.000000 },
-	{ -0.039544, -0.086706, -0.008248, -0.853147, -0.191448, -0.485271, 0.015778, 0.920330, -0.390826, 1.000000, 0.308250, 0.084070, 14, 15, 13, 1, 0.949966, 0.025463, 0.024570, 0.000000 },
-	{ -0.039348, -0.085009, -0.008424, -0.804846, 0.185594, -0.563717, 0.349226, 0.916097, -0.196998, 1.000000, 0.312740, 0.084910, 14, 13, 15, 1, 0.945718, 0.029473, 0.024809, 0.000000 },
-	{ -0.037602, -0.087751, -0.011455, -0.858879, -0.224854, -0.460182, -0.015610, 0.909555, -0.415292, 1.000000, 0.309280, 0.073500, 14, 15, 13, 1, 0.870538, 0.128441, 0.001021, 0.000000 },
-	{ -0.037499, -0.086081, -0.011546, -0.823224, 0.164625, -0.543323, 0.324158, 0.921990, -0.211792, 1.000000, 0.313460, 0.074700, 14, 15, 13, 1, 0.873245, 0.125126, 0.001628, 0.000000 },
-	{ -0.035925, -0.088513, -0.014244, -0.841118, -0.250125, -0.479539, -0.028961, 0.906195, -0.421868, 1.000000, 0.310260, 0.064800, 14, 15, 1, 1, 0.649638, 0.350362, 0.000000, 0.000000 },
-	{ -0.035209, -0.090766, -0.013363, -0.768810, -0.519529, -0.372854, -0.240538, 0.775185, -0.584149, 1.000000, 0.303750, 0.063440, 14, 15, 1, 1, 0.644540, 0.355460, 0.000000, 0.000000 },
-	{ -0.036965, -0.090025, -0.010621, -0.787856, -0.502060, -0.356677, -0.244751, 0.786703, -0.566741, 1.000000, 0.302650, 0.072180, 14, 15, 1, 1, 0.877334, 0.122666, 0.000000, 0.000000 },
-	{ -0.035487, -0.092742, -0.009077, -0.701710, -0.657510, -0.274380, -0.371343, 0.666196, -0.646751, 1.000000, 0.292500, 0.070120, 14, 15, 1, 1, 0.854793, 0.145207, 0.000000, 0.000000 },
-	{ -0.033751, -0.093399, -0.011805, -0.685111, -0.668387, -0.289624, -0.359880, 0.656255, -0.663186, 1.000000, 0.293870, 0.061410, 14, 15, 1, 1, 0.569910, 0.430090, 0.000000, 0.000000 },
-	{ -0.035847, -0.086835, -0.014322, -0.814236, 0.163138, -0.557141, 0.309030, 0.934232, -0.178077, 1.000000, 0.314300, 0.065960, 14, 15, 1, 1, 0.658028, 0.341972, 0.000000, 0.000000 },
-	{ -0.032088, -0.095308, -0.010171, -0.521407, -0.836966, -0.166204, -0.514027, 0.463547, -0.721735, 1.000000, 0.285540, 0.059900, 14, 15, 1, 1, 0.666812, 0.333188, 0.000000, 0.000000 },
-	{ -0.033760, -0.094760, -0.007489, -0.553181, -0.819203, -0.151321, -0.523531, 0.483152, -0.701769, 1.000000, 0.283860, 0.068350, 14, 15, 13, 1, 0.884123, 0.114163, 0.001713, 0.000000 },
-	{ -0.032188, -0.095502, -0.006275, -0.278044, -0.959524, 0.044777, -0.663912, 0.158277, -0.730869, 1.000000, 0.278520, 0.067200, 14, 15, 13, 1, 0.892430, 0.105992, 0.001578, 0.000000 },
-	{ -0.030521, -0.095997, -0.008810, -0.236211, -0.971484, 0.020591, -0.633360, 0.137858, -0.761479, 1.000000, 0.279830, 0.059000, 14, 15, 1, 1, 0.716018, 0.283982, 0.000000, 0.000000 },
-	{ -0.039002, -0.089059, -0.007444, -0.793160, -0.484116, -0.369499, -0.229768, 0.799754, -0.554618, 1.000000, 0.301480, 0.082720, 14, 15, 13, 1, 0.961275, 0.021850, 0.016874, 0.000000 },
-	{ -0.037464, -0.091887, -0.005976, -0.708229, -0.649062, -0.277724, -0.376245, 0.679876, -0.629451, 1.000000, 0.291010, 0.080420, 14, 15, 13, 1, 0.968158, 0.020177, 0.011666, 0.000000 },
-	{ -0.035637, -0.093950, -0.004505, -0.565834, -0.810906, -0.149211, -0.536501, 0.499516, -0.680184, 1.000000, 0.282330, 0.078460, 14, 15, 13, 1, 0.967466, 0.020161, 0.012373, 0.000000 },
-	{ -0.034016, -0.094748, -0.003439, -0.297732, -0.952881, 0.058083, -0.688462, 0.172168, -0.704541, 1.000000, 0.277080, 0.077050, 14, 15, 13, 1, 0.963397, 0.020519, 0.016085, 0.000000 },
-	{ -0.030879, -0.095478, -0.005424, -0.011984, -0.977028, 0.212773, -0.696421, -0.144538, -0.702927, 1.000000, 0.274440, 0.066200, 14, 15, 13, 1, 0.914287, 0.084579, 0.001134, 0.000000 },
-	{ -0.029186, -0.095960, -0.007859, 0.013962, -0.982925, 0.183477, -0.643584, -0.149267, -0.750679, 1.000000, 0.275580, 0.057850, 14, 15, 1, 1, 0.769336, 0.230664, 0.000000, 0.000000 },
-	{ -0.029845, -0.095190, -0.004816, 0.152757, -0.939265, 0.307321, -0.679176, -0.325674, -0.657766, 1.000000, 0.271200, 0.065360, 14, 15, 13, 1, 0.881127, 0.117612, 0.001261, 0.000000 },
-	{ -0.028165, -0.095646, -0.007214, 0.178485, -0.939582, 0.292110, -0.629067, -0.337244, -0.700386, 1.000000, 0.272400, 0.056920, 14, 15, 1, 1, 0.694494, 0.305506, 0.000000, 0.000000 },
-	{ -0.029023, -0.094831, -0.004360, 0.259768, -0.895530, 0.361314, -0.650389, -0.438818, -0.620027, 1.000000, 0.268590, 0.064640, 14, 15, 13, 1, 0.868369, 0.130247, 0.001384, 0.000000 },
-	{ -0.027400, -0.095245, -0.006736, 0.289612, -0.888923, 0.354882, -0.600238, -0.457479, -0.656070, 1.000000, 0.269880, 0.056230, 14, 15, 1, 1, 0.695086, 0.304914, 0.000000, 0.000000 },
-	{ -0.028323, -0.094413, -0.003969, 0.370566, -0.832503, 0.411850, -0.611294, -0.552974, -0.566162, 1.000000, 0.266270, 0.064040, 14, 15, 1, 1, 0.911232, 0.088768, 0.000000, 0.000000 },
-	{ -0.026781, -0.094827, -0.006314, 0.409130, -0.815968, 0.408422, -0.561493, -0.577951, -0.592198, 1.000000, 0.267680, 0.055740, 14, 15, 1, 1, 0.763998, 0.236002, 0.000000, 0.000000 },
-	{ -0.027658, -0.093848, -0.003598, 0.523860, -0.711079, 0.468976, -0.521497, -0.703059, -0.483477, 1.000000, 0.263860, 0.063510, 14, 15, 13, 1, 0.937593, 0.060472, 0.001935, 0.000000 },
-	{ -0.026212, -0.094263, -0.005943, 0.561605, -0.684684, 0.464551, -0.467734, -0.725850, -0.504349, 1.000000, 0.265500, 0.055320, 14, 15, 1, 1, 0.803067, 0.196933, 0.000000, 0.000000 },
-	{ -0.026947, -0.092935, -0.003272, 0.684953, -0.527234, 0.502855, -0.370872, -0.846376, -0.382234, 1.000000, 0.260790, 0.062700, 14, 15, 13, 1, 0.939288, 0.058404, 0.002308, 0.000000 },
-	{ -0.025578, -0.093378, -0.005644, 0.707560, -0.498141, 0.501213, -0.307667, -0.855684, -0.416108, 1.000000, 0.262630, 0.054440, 14, 15, 1, 1, 0.800170, 0.199830, 0.000000, 0.000000 },
-	{ -0.029939, -0.093805, -0.001417, 0.338924, -0.835432, 0.432647, -0.646400, -0.540916, -0.538124, 1.000000, 0.264780, 0.073360, 14, 15, 13, 1, 0.962291, 0.029540, 0.008168, 0.000000 },
-	{ -0.029186, -0.093213, -0.001036, 0.488255, -0.726785, 0.483105, -0.564270, -0.685204, -0.460538, 1.000000, 0.262120, 0.072810, 14, 13, 15, 1, 0.971441, 0.015485, 0.013073, 0.000000 },
-	{ -0.028391, -0.092243, -0.000646, 0.658673, -0.551149, 0.512236, -0.425714, -0.834311, -0.350276, 1.000000, 0.258700, 0.072170, 14, 13, 15, 1, 0.968901, 0.020260, 0.010840, 0.000000 },
-	{ -0.031530, -0.093030, 0.001201, 0.333366, -0.837438, 0.433088, -0.673388, -0.533004, -0.512304, 1.000000, 0.263420, 0.082740, 14, 13, 15, 1, 0.947986, 0.046817, 0.005197, 0.000000 },
-	{ -0.030687, -0.092412, 0.001607, 0.473042, -0.740967, 0.476654, -0.602784, -0.666760, -0.438273, 1.000000, 0.260450, 0.082220, 14, 13, 15, 1, 0.918694, 0.079161, 0.002145, 0.000000 },
-	{ -0.032000, -0.091642, 0.004173, 0.478572, -0.757793, 0.443530, -0.640744, -0.646775, -0.413679, 1.000000, 0.259080, 0.090570, 14, 13, 1, 1, 0.747356, 0.252643, 0.000000, 0.000000 },
-	{ -0.031057, -0.090562, 0.004697, 0.655587, -0.599869, 0.458654, -0.517700, -0.799229, -0.305318, 1.000000, 0.255140, 0.090430, 14, 13, 1, 1, 0.704904, 0.295096, 0.000000, 0.000000 },
-	{ -0.029813, -0.091382, 0.002072, 0.648210, -0.573626, 0.500776, -0.475952, -0.818572, -0.321574, 1.000000, 0.256680, 0.081840, 14, 13, 15, 1, 0.898174, 0.100380, 0.001446, 0.000000 },
-	{ -0.032905, -0.092311, 0.003723, 0.352999, -0.840565, 0.410905, -0.691939, -0.530148, -0.490065, 1.000000, 0.262280, 0.090950, 14, 13, 1, 1, 0.799795, 0.200205, 0.000000, 0.000000 },
-	{ -0.030717, -0.094218, -0.001775, 0.233175, -0.893154, 0.384586, -0.680801, -0.432333, -0.591268, 1.000000, 0.267240, 0.074090, 14, 15, 13, 1, 0.957016, 0.030807, 0.012177, 0.000000 },
-	{ -0.032367, -0.093448, 0.000870, 0.240258, -0.889251, 0.389241, -0.711005, -0.434208, -0.553114, 1.000000, 0.265990, 0.083490, 14, 13, 15, 1, 0.928793, 0.067508, 0.003699, 0.000000 },
-	{ -0.033746, -0.092774, 0.003374, 0.276358, -0.884780, 0.375221, -0.720229, -0.449171, -0.528693, 1.000000, 0.264870, 0.091570, 14, 13, 1, 1, 0.783099, 0.216901, 0.000000, 0.000000 },
-	{ -0.031597, -0.094553, -0.002170, 0.130400, -0.935116, 0.329477, -0.710006, -0.320023, -0.627278, 1.000000, 0.269870, 0.074960, 14, 15, 13, 1, 0.961594, 0.024643, 0.013763, 0.000000 },
-	{ -0.033274, -0.093783, 0.000529, 0.145827, -0.931433, 0.333418, -0.738112, -0.326839, -0.590226, 1.000000, 0.268600, 0.084320, 14, 13, 15, 1, 0.918327, 0.079407, 0.002266, 0.000000 },
-	{ -0.034626, -0.093149, 0.003030, 0.190553, -0.926648, 0.324057, -0.752395, -0.349893, -0.558101, 1.000000, 0.267370, 0.092210, 14, 13, 1, 1, 0.779543, 0.220457, 0.000000, 0.000000 },
-	{ -0.032674, -0.094798, -0.002696, -0.031767, -0.971730, 0.233947, -0.729739, -0.137395, -0.669779, 1.000000, 0.273070, 0.075930, 14, 15, 13, 1, 0.963033, 0.020512, 0.016456, 0.000000 },
-	{ -0.034395, -0.094042, 0.000072, -0.010554, -0.972257, 0.233679, -0.750722, -0.146666, -0.644132, 1.000000, 0.271790, 0.085350, 14, 13, 15, 1, 0.919690, 0.078969, 0.001341, 0.000000 },
-	{ -0.035761, -0.093478, 0.002566, 0.037395, -0.972040, 0.231820, -0.769059, -0.176122, -0.614434, 1.000000, 0.270620, 0.093070, 14, 13, 1, 1, 0.800474, 0.199526, 0.000000, 0.000000 },
-	{ -0.036733, -0.093004, 0.004711, 0.064860, -0.957841, 0.279881, -0.781818, -0.223071, -0.582237, 1.000000, 0.269550, 0.099020, 14, 13, 1, 1, 0.608807, 0.391193, 0.000000, 0.000000 },
-	{ -0.036354, -0.091798, 0.007591, 0.187725, -0.905766, 0.379930, -0.810469, -0.361361, -0.461040, 1.000000, 0.264820, 0.104660, 13, 14, 1, 1, 0.684796, 0.315204, 0.000000, 0.000000 },
-	{ -0.035587, -0.092591, 0.005229, 0.212074, -0.913416, 0.347413, -0.764899, -0.376410, -0.522729, 1.000000, 0.266240, 0.098420, 14, 13, 1, 1, 0.576001, 0.423999, 0.000000, 0.000000 },
-	{ -0.035512, -0.091345, 0.008129, 0.266242, -0.885485, 0.380830, -0.801595, -0.422813, -0.422699, 1.000000, 0.262290, 0.104980, 13, 14, 1, 1, 0.732233, 0.267767, 0.000000, 0.000000 },
-	{ -0.034751, -0.092158, 0.005638, 0.294542, -0.879515, 0.373763, -0.751881, -0.454687, -0.477425, 1.000000, 0.263880, 0.098110, 14, 13, 1, 1, 0.550370, 0.449630, 0.000000, 0.000000 },
-	{ -0.034680, -0.090839, 0.008628, 0.346573, -0.858636, 0.377665, -0.751511, -0.495108, -0.436004, 1.000000, 0.259640, 0.105080, 13, 14, 1, 1, 0.754059, 0.245941, 0.000000, 0.000000 },
-	{ -0.033930, -0.091640, 0.006066, 0.365965, -0.846577, 0.386494, -0.733494, -0.517994, -0.440079, 1.000000, 0.261240, 0.097950, 14, 13, 1, 1, 0.519814, 0.480186, 0.000000, 0.000000 },
-	{ -0.033687, -0.090170, 0.009100, 0.480552, -0.791980, 0.376614, -0.683454, -0.607314, -0.405044, 1.000000, 0.256360, 0.104740, 13, 14, 1, 1, 0.774995, 0.225005, 0.000000, 0.000000 },
-	{ -0.032973, -0.090941, 0.006561, 0.487031, -0.777093, 0.398658, -0.674014, -0.624699, -0.394281, 1.000000, 0.257860, 0.097790, 13, 14, 1, 1, 0.521647, 0.478353, 0.000000, 0.000000 },
-	{ -0.032590, -0.089115, 0.009541, 0.670579, -0.648931, 0.359460, -0.564220, -0.760747, -0.320810, 1.000000, 0.252440, 0.104310, 13, 14, 1, 1, 0.810684, 0.189316, 0.000000, 0.000000 },
-	{ -0.031941, -0.089864, 0.007075, 0.669394, -0.627119, 0.398288, -0.546114, -0.778846, -0.308478, 1.000000, 0.253860, 0.097610, 13, 14, 1, 1, 0.572675, 0.427325, 0.000000, 0.000000 },
-	{ -0.056597, -0.024233, 0.004470, -0.674006, 0.699797, -0.236643, 0.350304, 0.020738, -0.936407, 1.000000, 0.392160, 0.339670, 8, 1, 1, 1, 0.962506, 0.037494, 0.000000, 0.000000 },
-	{ -0.059555, -0.027695, 0.005235, -0.873893, 0.421872, -0.241525, 0.283304, 0.038240, -0.958267, 1.000000, 0.384790, 0.324800, 8, 1, 1, 1, 0.943491, 0.056509, 0.000000, 0.000000 },
-	{ -0.058301, -0.028105, -0.000892, -0.879507, 0.434867, -0.193285, 0.234777, 0.043210, -0.971089, 1.000000, 0.400810, 0.322110, 8, 1, 1, 1, 0.988204, 0.011796, 0.000000, 0.000000 },
-	{ -0.055945, -0.025170, -0.001474, -0.678255, 0.706619, -0.201644, 0.323761, 0.041025, -0.945249, 1.000000, 0.405920, 0.333650, 8, 1, 1, 1, 0.993158, 0.006842, 0.000000, 0.000000 },
-	{ -0.053187, -0.022374, 0.002955, -0.451487, 0.862357, -0.229130, 0.427147, -0.016570, -0.904031, 1.000000, 0.401150, 0.349680, 8, 1, 4, 1, 0.981036, 0.014577, 0.004387, 0.000000 },
-	{ -0.053124, -0.023553, -0.002643, -0.456917, 0.863612, -0.213077, 0.422324, -0.000203, -0.906445, 1.000000, 0.413550, 0.341670, 8, 1, 1, 1, 0.997462, 0.002538, 0.000000, 0.000000 },
-	{ -0.059400, -0.031956, -0.000641, -0.981940, 0.089076, -0.166910, 0.170738, 0.037179, -0.984615, 1.000000, 0.397520, 0.308670, 8, 1, 1, 1, 0.984681, 0.015319, 0.000000, 0.000000 },
-	{ -0.060724, -0.032073, 0.005570, -0.973580, -0.008065, -0.228202, 0.227254, 0.063360, -0.971772, 1.000000, 0.380830, 0.309610, 8, 1, 1, 1, 0.934753, 0.065247, 0.000000, 0.000000 },
-	{ -0.059692, -0.036771, 0.005649, -0.915428, -0.345173, -0.206997, 0.202193, 0.050297, -0.978053, 1.000000, 0.380090, 0.292740, 8, 1, 17, 1, 0.906213, 0.054113, 0.039673, 0.000000 },
-	{ -0.059104, -0.035888, -0.000602, -0.962762, -0.242760, -0.118986, 0.120367, 0.009190, -0.992687, 1.000000, 0.396230, 0.295350, 8, 1, 1, 1, 0.987154, 0.012846, 0.000000, 0.000000 },
-	{ -0.057515, -0.040047, 0.005407, -0.788974, -0.583490, -0.192507, 0.224537, 0.017834, -0.974302, 1.000000, 0.381860, 0.278700, 8, 17, 1, 1, 0.908134, 0.071948, 0.019918, 0.000000 },
-	{ -0.057676, -0.038995, -0.000597, -0.846744, -0.526951, -0.073118, 0.112100, -0.042374, -0.992793, 1.000000, 0.396250, 0.284400, 8, 17, 1, 1, 0.989768, 0.005836, 0.004395, 0.000000 },
-	{ -0.055238, -0.026746, -0.008670, -0.683867, 0.698896, -0.209455, 0.316271, 0.025261, -0.948332, 1.000000, 0.424840, 0.326480, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052799, -0.025183, -0.009090, -0.477730, 0.849981, -0.222053, 0.391236, -0.020468, -0.920063, 1.000000, 0.430100, 0.333950, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054503, -0.028111, -0.015961, -0.683987, 0.705220, -0.186617, 0.299931, 0.038669, -0.953177, 1.000000, 0.444880, 0.320230, 8, 9, 1, 1, 0.984225, 0.015775, 0.000000, 0.000000 },
-	{ -0.052298, -0.026475, -0.015531, -0.482742, 0.853665, -0.195493, 0.363480, -0.007788, -0.931570, 1.000000, 0.447180, 0.328140, 8, 9, 1, 1, 0.986967, 0.013033, 0.000000, 0.000000 },
-	{ -0.053755, -0.028818, -0.022101, -0.671961, 0.719965, -0.173548, 0.307460, 0.058013, -0.949791, 1.000000, 0.461770, 0.315490, 8, 9, 1, 1, 0.867846, 0.132154, 0.000000, 0.000000 },
-	{ -0.055523, -0.031242, -0.022702, -0.895566, 0.411772, -0.168538, 0.215121, 0.069154, -0.974136, 1.000000, 0.461230, 0.307330, 8, 9, 1, 1, 0.805253, 0.194747, 0.000000, 0.000000 },
-	{ -0.056335, -0.030558, -0.016313, -0.890810, 0.421327, -0.170123, 0.219250, 0.070639, -0.973108, 1.000000, 0.443320, 0.311280, 8, 9, 1, 1, 0.970339, 0.029661, 0.000000, 0.000000 },
-	{ -0.051630, -0.027277, -0.021071, -0.453324, 0.872685, -0.181433, 0.379573, 0.004832, -0.925149, 1.000000, 0.461570, 0.323770, 8, 9, 1, 1, 0.908773, 0.091227, 0.000000, 0.000000 },
-	{ -0.056428, -0.034704, -0.022422, -0.980249, 0.126007, -0.152429, 0.160475, 0.056321, -0.985432, 1.000000, 0.458520, 0.296080, 8, 9, 1, 1, 0.824507, 0.175493, 0.000000, 0.000000 },
-	{ -0.057272, -0.033918, -0.016103, -0.980258, 0.133793, -0.145582, 0.155799, 0.069314, -0.985354, 1.000000, 0.440810, 0.300280, 8, 9, 1, 1, 0.956694, 0.043306, 0.000000, 0.000000 },
-	{ -0.057393, -0.037246, -0.015372, -0.984754, -0.136432, -0.107914, 0.098920, 0.071087, -0.992553, 1.000000, 0.437810, 0.289850, 8, 9, 1, 1, 0.975801, 0.024199, 0.000000, 0.000000 },
-	{ -0.056581, -0.038144, -0.021525, -0.984910, -0.127660, -0.116852, 0.106380, 0.086004, -0.990599, 1.000000, 0.454830, 0.285420, 8, 9, 1, 1, 0.871698, 0.128302, 0.000000, 0.000000 },
-	{ -0.056637, -0.039672, -0.014445, -0.893042, -0.447264, -0.049294, 0.037504, 0.035184, -0.998677, 1.000000, 0.434890, 0.283030, 8, 9, 1, 1, 0.980353, 0.019647, 0.000000, 0.000000 },
-	{ -0.055888, -0.040567, -0.020414, -0.896465, -0.440301, -0.049862, 0.030706, 0.050531, -0.998250, 1.000000, 0.452120, 0.279310, 8, 9, 1, 1, 0.890337, 0.109663, 0.000000, 0.000000 },
-	{ -0.057273, -0.029302, -0.008571, -0.884332, 0.429623, -0.182707, 0.223823, 0.046709, -0.973510, 1.000000, 0.421300, 0.316990, 8, 1, 1, 1, 0.998789, 0.001211, 0.000000, 0.000000 },
-	{ -0.058294, -0.032787, -0.008365, -0.980821, 0.128760, -0.146323, 0.152536, 0.039739, -0.987499, 1.000000, 0.418290, 0.305370, 8, 1, 9, 1, 0.996027, 0.002048, 0.001925, 0.000000 },
-	{ -0.058341, -0.036274, -0.007958, -0.980842, -0.166747, -0.100719, 0.098258, 0.022963, -0.994896, 1.000000, 0.416510, 0.294060, 8, 1, 9, 1, 0.996380, 0.001932, 0.001689, 0.000000 },
-	{ -0.057384, -0.038946, -0.007475, -0.880390, -0.471756, -0.048583, 0.060725, -0.010538, -0.998099, 1.000000, 0.415260, 0.285720, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055411, -0.041348, -0.013684, -0.743377, -0.668872, -0.000781, 0.000533, 0.000576, -1.000000, 1.000000, 0.433080, 0.276790, 8, 9, 1, 1, 0.987489, 0.012511, 0.000000, 0.000000 },
-	{ -0.054710, -0.042174, -0.019345, -0.743855, -0.668298, 0.007607, -0.004644, -0.006214, -0.999970, 1.000000, 0.448940, 0.273490, 8, 9, 1, 1, 0.915231, 0.084769, 0.000000, 0.000000 },
-	{ -0.054109, -0.042486, -0.013319, -0.584784, -0.810397, 0.035824, -0.027590, -0.024267, -0.999325, 1.000000, 0.433300, 0.272030, 8, 9, 1, 1, 0.989130, 0.010870, 0.000000, 0.000000 },
-	{ -0.053482, -0.043246, -0.018630, -0.589021, -0.806751, 0.046980, -0.032510, -0.034433, -0.998878, 1.000000, 0.447570, 0.269220, 8, 9, 1, 1, 0.930246, 0.069754, 0.000000, 0.000000 },
-	{ -0.052778, -0.043232, -0.013107, -0.418930, -0.905656, 0.065468, -0.040941, -0.053187, -0.997745, 1.000000, 0.433500, 0.267930, 8, 9, 1, 1, 0.988885, 0.011115, 0.000000, 0.000000 },
-	{ -0.052204, -0.043952, -0.018227, -0.417049, -0.905048, 0.083413, -0.047112, -0.070126, -0.996425, 1.000000, 0.447340, 0.265430, 8, 9, 1, 1, 0.948261, 0.051739, 0.000000, 0.000000 },
-	{ -0.051358, -0.043731, -0.012875, -0.264405, -0.960585, 0.085828, -0.050732, -0.075019, -0.995891, 1.000000, 0.433320, 0.263890, 8, 9, 1, 1, 0.991212, 0.008787, 0.000000, 0.000000 },
-	{ -0.050772, -0.044430, -0.017925, -0.256439, -0.960223, 0.110503, -0.052555, -0.100305, -0.993568, 1.000000, 0.447240, 0.261420, 8, 9, 1, 1, 0.931647, 0.068353, 0.000000, 0.000000 },
-	{ -0.049729, -0.044039, -0.012687, -0.112629, -0.987984, 0.105846, -0.059828, -0.099588, -0.993229, 1.000000, 0.433380, 0.259590, 8, 9, 1, 1, 0.983235, 0.016765, 0.000000, 0.000000 },
-	{ -0.049053, -0.044733, -0.017671, -0.114089, -0.984848, 0.130608, -0.053455, -0.125191, -0.990692, 1.000000, 0.447290, 0.256830, 8, 9, 1, 1, 0.903051, 0.096949, 0.000000, 0.000000 },
-	{ -0.047680, -0.044130, -0.012599, 0.052554, -0.989568, 0.134143, -0.063074, -0.137349, -0.988513, 1.000000, 0.434090, 0.254020, 8, 9, 1, 1, 0.977043, 0.022957, 0.000000, 0.000000 },
-	{ -0.046903, -0.044840, -0.017470, 0.042428, -0.987356, 0.152739, -0.050335, -0.154795, -0.986664, 1.000000, 0.447920, 0.250830, 8, 9, 1, 1, 0.884360, 0.115640, 0.000000, 0.000000 },
-	{ -0.051729, -0.043222, -0.007304, -0.258386, -0.965377, 0.035836, 0.004832, -0.038387, -0.999251, 1.000000, 0.418430, 0.265480, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050219, -0.043509, -0.007266, -0.092740, -0.994172, 0.054965, -0.007437, -0.054510, -0.998486, 1.000000, 0.419080, 0.261570, 8, 9, 1, 1, 0.998937, 0.001063, 0.000000, 0.000000 },
-	{ -0.048304, -0.043546, -0.007233, 0.087258, -0.992607, 0.084371, -0.015037, -0.085997, -0.996182, 1.000000, 0.420050, 0.256600, 8, 9, 1, 1, 0.997805, 0.002195, 0.000000, 0.000000 },
-	{ -0.051934, -0.043189, -0.001861, -0.248648, -0.967635, -0.043096, 0.147911, 0.006039, -0.988982, 1.000000, 0.403860, 0.265240, 8, 17, 1, 1, 0.971267, 0.028733, 0.000000, 0.000000 },
-	{ -0.050541, -0.043410, -0.002037, -0.066417, -0.997441, -0.026480, 0.115112, 0.018702, -0.993177, 1.000000, 0.405580, 0.261870, 8, 17, 1, 1, 0.982401, 0.017599, 0.000000, 0.000000 },
-	{ -0.050718, -0.043762, 0.001958, -0.063641, -0.984001, -0.166408, 0.345266, 0.134739, -0.928783, 1.000000, 0.395990, 0.260160, 8, 17, 1, 1, 0.847534, 0.152466, 0.000000, 0.000000 },
-	{ -0.048942, -0.043657, 0.001779, 0.139569, -0.974397, -0.176273, 0.230522, 0.205097, -0.951207, 1.000000, 0.398910, 0.256550, 8, 17, 1, 1, 0.919839, 0.080161, 0.000000, 0.000000 },
-	{ -0.048725, -0.043367, -0.002062, 0.127532, -0.991835, 0.000112, 0.088118, 0.011218, -0.996047, 1.000000, 0.407110, 0.257390, 8, 17, 1, 1, 0.994521, 0.005479, 0.000000, 0.000000 },
-	{ -0.052033, -0.043614, 0.002334, -0.263101, -0.950238, -0.166808, 0.377009, 0.057886, -0.924399, 1.000000, 0.393470, 0.262690, 8, 17, 1, 1, 0.808590, 0.191410, 0.000000, 0.000000 },
-	{ -0.052056, -0.044329, 0.004593, -0.357607, -0.810848, -0.463296, 0.572001, 0.201971, -0.794998, 1.000000, 0.389140, 0.259720, 17, 8, 1, 1, 0.523753, 0.476247, 0.000000, 0.000000 },
-	{ -0.050771, -0.044426, 0.004120, -0.115700, -0.863048, -0.491693, 0.664612, 0.300616, -0.684048, 1.000000, 0.392250, 0.257730, 8, 17, 1, 1, 0.566082, 0.433918, 0.000000, 0.000000 },
-	{ -0.050669, -0.045402, 0.004853, -0.116730, -0.204755, -0.971828, 0.891420, 0.409830, -0.193419, 1.000000, 0.391280, 0.255630, 17, 8, 1, 1, 0.765195, 0.234805, 0.000000, 0.000000 },
-	{ -0.048838, -0.045578, 0.004886, 0.159416, -0.301790, -0.939952, 0.898350, 0.439134, 0.011368, 1.000000, 0.395620, 0.253940, 17, 8, 1, 1, 0.763557, 0.234791, 0.001652, 0.000000 },
-	{ -0.048955, -0.044416, 0.003966, 0.112317, -0.828565, -0.548511, 0.608531, 0.493738, -0.621219, 1.000000, 0.395960, 0.255340, 8, 17, 1, 1, 0.610111, 0.389889, 0.000000, 0.000000 },
-	{ -0.052035, -0.045282, 0.005230, -0.443407, -0.102840, -0.890401, 0.829456, 0.329407, -0.451103, 1.000000, 0.387690, 0.257230, 17, 8, 1, 1, 0.821552, 0.178448, 0.000000, 0.000000 },
-	{ -0.048586, -0.046904, 0.004687, 0.301066, 0.489357, -0.818467, 0.953271, -0.131778, 0.271863, 1.000000, 0.396120, 0.252480, 17, 8, 1, 1, 0.956189, 0.043811, 0.000000, 0.000000 },
-	{ -0.050422, -0.046633, 0.004500, 0.046948, 0.578477, -0.814347, 0.989291, 0.085867, 0.118029, 1.000000, 0.391360, 0.253120, 17, 8, 1, 1, 0.954947, 0.045053, 0.000000, 0.000000 },
-	{ -0.047952, -0.048470, 0.003280, 0.320635, 0.810278, -0.490554, 0.918558, -0.392391, -0.047750, 1.000000, 0.398320, 0.249500, 17, 8, 1, 1, 0.998328, 0.001672, 0.000000, 0.000000 },
-	{ -0.049877, -0.048217, 0.002894, 0.113076, 0.825124, -0.553521, 0.982711, -0.175076, -0.060229, 1.000000, 0.393210, 0.248400, 17, 8, 1, 1, 0.997273, 0.002727, 0.000000, 0.000000 },
-	{ -0.051853, -0.046528, 0.004755, -0.247673, 0.583017, -0.773789, 0.968626, 0.165940, -0.185008, 1.000000, 0.387450, 0.253930, 17, 8, 1, 1, 0.963411, 0.036589, 0.000000, 0.000000 },
-	{ -0.051417, -0.048184, 0.002908, -0.115147, 0.809237, -0.576088, 0.976996, -0.012535, -0.212887, 1.000000, 0.389120, 0.247900, 17, 8, 1, 1, 0.997352, 0.002648, 0.000000, 0.000000 },
-	{ -0.048912, -0.049998, -0.000115, 0.109886, 0.898320, -0.425379, 0.927261, -0.246767, -0.281591, 1.000000, 0.399050, 0.241020, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.046781, -0.050224, 0.000394, 0.291920, 0.890163, -0.349848, 0.873913, -0.396887, -0.280638, 1.000000, 0.404430, 0.243790, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.047719, -0.051779, -0.003980, 0.095825, 0.923513, -0.371404, 0.879893, -0.253045, -0.402190, 1.000000, 0.407770, 0.232730, 17, 18, 1, 1, 0.978757, 0.021243, 0.000000, 0.000000 },
-	{ -0.045469, -0.051950, -0.003452, 0.273488, 0.910278, -0.310803, 0.839010, -0.383775, -0.385719, 1.000000, 0.413150, 0.236370, 17, 18, 1, 1, 0.984331, 0.015669, 0.000000, 0.000000 },
-	{ -0.044466, -0.053528, -0.007255, 0.283668, 0.905075, -0.316817, 0.818907, -0.400545, -0.411043, 1.000000, 0.421370, 0.228970, 17, 18, 1, 1, 0.925165, 0.074835, 0.000000, 0.000000 },
-	{ -0.046621, -0.053366, -0.007854, 0.106542, 0.929817, -0.352263, 0.858315, -0.264850, -0.439488, 1.000000, 0.416660, 0.225080, 17, 18, 1, 1, 0.870699, 0.129301, 0.000000, 0.000000 },
-	{ -0.048430, -0.053458, -0.008172, -0.067018, 0.921834, -0.381747, 0.873090, -0.131007, -0.469628, 1.000000, 0.412680, 0.222180, 17, 18, 1, 1, 0.863577, 0.136423, 0.000000, 0.000000 },
-	{ -0.049558, -0.051884, -0.004233, -0.074271, 0.907304, -0.413865, 0.894122, -0.123200, -0.430543, 1.000000, 0.403460, 0.230030, 17, 18, 1, 1, 0.977715, 0.022285, 0.000000, 0.000000 },
-	{ -0.050630, -0.050044, -0.000305, -0.075720, 0.879470, -0.469893, 0.937197, -0.098142, -0.334710, 1.000000, 0.394770, 0.239070, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.053169, -0.045186, 0.006003, -0.692872, -0.044546, -0.719683, 0.686487, 0.264602, -0.677290, 1.000000, 0.384110, 0.258700, 17, 8, 1, 1, 0.782064, 0.217936, 0.000000, 0.000000 },
-	{ -0.053121, -0.044139, 0.005358, -0.578366, -0.698912, -0.420730, 0.477147, 0.128497, -0.869379, 1.000000, 0.386030, 0.261570, 17, 8, 1, 1, 0.503875, 0.496125, 0.000000, 0.000000 },
-	{ -0.053155, -0.043294, 0.002920, -0.447292, -0.879988, -0.159850, 0.342641, -0.003509, -0.939460, 1.000000, 0.390950, 0.264880, 8, 17, 1, 1, 0.801338, 0.198662, 0.000000, 0.000000 },
-	{ -0.053190, -0.042772, -0.001583, -0.411416, -0.910163, -0.048389, 0.163784, -0.021599, -0.986260, 1.000000, 0.401980, 0.268400, 8, 17, 1, 1, 0.967261, 0.032739, 0.000000, 0.000000 },
-	{ -0.053109, -0.042732, -0.007337, -0.411428, -0.911177, 0.021997, 0.016743, -0.031685, -0.999358, 1.000000, 0.417850, 0.269380, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052053, -0.050267, -0.000213, -0.312928, 0.817464, -0.483559, 0.893274, 0.080325, -0.442278, 1.000000, 0.391100, 0.237700, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052689, -0.048293, 0.003295, -0.393943, 0.738222, -0.547575, 0.889268, 0.155486, -0.430147, 1.000000, 0.385490, 0.247760, 17, 8, 1, 1, 0.997406, 0.002594, 0.000000, 0.000000 },
-	{ -0.053045, -0.046505, 0.005420, -0.548933, 0.506175, -0.665176, 0.830458, 0.239881, -0.502790, 1.000000, 0.383740, 0.254820, 17, 8, 1, 1, 0.961828, 0.038172, 0.000000, 0.000000 },
-	{ -0.054506, -0.041980, -0.007283, -0.569256, -0.822143, 0.005408, 0.030052, -0.027380, -0.999173, 1.000000, 0.416950, 0.273710, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054505, -0.042095, -0.001207, -0.563785, -0.824567, -0.047287, 0.160505, -0.053220, -0.985599, 1.000000, 0.399930, 0.272070, 8, 17, 1, 1, 0.971386, 0.028614, 0.000000, 0.000000 },
-	{ -0.054285, -0.042742, 0.003728, -0.593228, -0.791212, -0.148542, 0.283549, -0.032666, -0.958401, 1.000000, 0.388070, 0.267420, 8, 17, 1, 1, 0.841187, 0.158813, 0.000000, 0.000000 },
-	{ -0.054184, -0.043789, 0.006461, -0.699406, -0.601357, -0.386265, 0.408288, 0.107414, -0.906512, 1.000000, 0.382410, 0.263660, 8, 17, 1, 1, 0.582948, 0.415192, 0.001860, 0.000000 },
-	{ -0.054240, -0.045052, 0.007204, -0.787777, -0.053742, -0.613612, 0.586804, 0.237385, -0.774151, 1.000000, 0.379900, 0.260240, 17, 8, 1, 1, 0.718290, 0.279011, 0.002698, 0.000000 },
-	{ -0.054124, -0.046567, 0.006543, -0.722667, 0.410923, -0.555783, 0.678285, 0.266912, -0.684608, 1.000000, 0.379510, 0.255830, 17, 8, 1, 1, 0.941350, 0.057428, 0.001222, 0.000000 },
-	{ -0.053842, -0.048577, 0.004106, -0.619615, 0.625918, -0.473606, 0.748138, 0.288450, -0.597567, 1.000000, 0.381590, 0.247970, 17, 8, 1, 1, 0.995536, 0.004464, 0.000000, 0.000000 },
-	{ -0.053361, -0.050730, 0.000172, -0.544529, 0.707156, -0.451021, 0.790476, 0.252896, -0.557845, 1.000000, 0.387370, 0.236630, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055964, -0.040793, -0.007225, -0.728016, -0.685381, -0.015673, 0.046227, -0.026268, -0.998586, 1.000000, 0.415570, 0.278900, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055992, -0.040953, -0.000786, -0.704498, -0.707826, -0.051624, 0.140588, -0.067887, -0.987738, 1.000000, 0.397610, 0.276940, 8, 17, 1, 1, 0.983283, 0.016717, 0.000000, 0.000000 },
-	{ -0.055637, -0.041793, 0.004666, -0.691931, -0.704563, -0.157553, 0.243664, -0.022475, -0.969600, 1.000000, 0.384890, 0.271320, 8, 17, 1, 1, 0.896536, 0.099717, 0.003747, 0.000000 },
-	{ -0.055446, -0.043171, 0.007872, -0.734369, -0.547279, -0.401482, 0.405200, 0.121049, -0.906179, 1.000000, 0.378080, 0.266620, 8, 17, 1, 1, 0.654623, 0.334026, 0.011351, 0.000000 },
-	{ -0.055455, -0.044941, 0.008797, -0.789416, -0.096445, -0.606235, 0.571970, 0.242997, -0.783456, 1.000000, 0.374710, 0.261870, 17, 8, 1, 1, 0.686721, 0.300641, 0.012638, 0.000000 },
-	{ -0.055259, -0.046859, 0.008026, -0.793889, 0.337764, -0.505624, 0.596959, 0.274746, -0.753761, 1.000000, 0.374250, 0.256440, 17, 8, 1, 1, 0.926861, 0.067442, 0.005697, 0.000000 },
-	{ -0.055051, -0.049157, 0.005227, -0.743730, 0.531850, -0.404972, 0.623916, 0.334781, -0.706153, 1.000000, 0.376730, 0.247940, 17, 8, 1, 1, 0.993033, 0.005894, 0.001073, 0.000000 },
-	{ -0.054707, -0.051573, 0.000822, -0.702665, 0.591683, -0.395188, 0.666793, 0.353770, -0.655922, 1.000000, 0.382840, 0.235320, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052460, -0.052790, -0.004114, -0.503486, 0.742459, -0.441879, 0.789094, 0.186846, -0.585166, 1.000000, 0.396270, 0.226080, 17, 18, 1, 1, 0.981018, 0.018982, 0.000000, 0.000000 },
-	{ -0.051078, -0.052195, -0.004256, -0.287892, 0.848543, -0.443952, 0.867443, 0.034628, -0.496331, 1.000000, 0.399800, 0.228020, 17, 18, 1, 1, 0.981088, 0.018912, 0.000000, 0.000000 },
-	{ -0.049965, -0.053803, -0.008279, -0.276377, 0.869073, -0.410278, 0.850428, 0.022311, -0.525618, 1.000000, 0.409200, 0.219920, 17, 18, 1, 1, 0.874894, 0.125106, 0.000000, 0.000000 },
-	{ -0.051365, -0.054478, -0.008317, -0.474310, 0.776011, -0.415737, 0.781922, 0.154359, -0.603963, 1.000000, 0.405910, 0.217540, 17, 18, 1, 1, 0.907770, 0.092230, 0.000000, 0.000000 },
-	{ -0.053833, -0.053790, -0.003860, -0.670853, 0.618154, -0.409685, 0.681760, 0.296689, -0.668714, 1.000000, 0.392450, 0.223620, 17, 18, 1, 1, 0.978830, 0.021170, 0.000000, 0.000000 },
-	{ -0.052716, -0.055546, -0.008377, -0.641266, 0.656730, -0.396841, 0.682995, 0.252824, -0.685273, 1.000000, 0.402800, 0.214430, 17, 18, 1, 1, 0.876030, 0.123970, 0.000000, 0.000000 },
-	{ -0.056109, -0.052993, 0.001605, -0.839505, 0.434432, -0.326343, 0.505493, 0.404183, -0.762307, 1.000000, 0.377520, 0.232790, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055182, -0.055282, -0.003506, -0.825307, 0.440727, -0.353027, 0.533830, 0.405117, -0.742231, 1.000000, 0.388080, 0.220270, 17, 18, 1, 1, 0.988011, 0.011989, 0.000000, 0.000000 },
-	{ -0.056194, -0.057411, -0.003014, -0.954382, 0.142171, -0.262570, 0.298473, 0.429686, -0.852223, 1.000000, 0.383740, 0.216240, 17, 18, 1, 1, 0.982112, 0.017888, 0.000000, 0.000000 },
-	{ -0.054928, -0.059139, -0.008218, -0.948996, 0.148984, -0.277868, 0.314843, 0.400998, -0.860276, 1.000000, 0.395720, 0.206190, 17, 18, 1, 1, 0.882116, 0.117884, 0.000000, 0.000000 },
-	{ -0.055025, -0.062109, -0.007722, -0.973128, -0.122677, -0.194865, 0.146498, 0.323060, -0.934971, 1.000000, 0.390780, 0.199200, 17, 18, 1, 1, 0.888556, 0.111444, 0.000000, 0.000000 },
-	{ -0.056317, -0.060537, -0.002232, -0.975953, -0.121546, -0.180948, 0.132193, 0.330022, -0.934672, 1.000000, 0.377890, 0.209290, 17, 18, 1, 1, 0.979630, 0.020371, 0.000000, 0.000000 },
-	{ -0.054386, -0.065405, -0.006960, -0.928524, -0.353171, -0.114512, 0.018688, 0.263580, -0.964457, 1.000000, 0.384660, 0.189920, 17, 18, 1, 1, 0.889323, 0.110677, 0.000000, 0.000000 },
-	{ -0.055661, -0.063978, -0.001399, -0.925901, -0.364291, -0.099997, 0.006678, 0.248881, -0.968511, 1.000000, 0.371610, 0.199150, 17, 18, 1, 1, 0.982100, 0.017900, 0.000000, 0.000000 },
-	{ -0.054153, -0.066492, -0.000720, -0.742265, -0.669690, 0.023610, -0.158530, 0.141260, -0.977197, 1.000000, 0.367900, 0.191680, 17, 18, 1, 1, 0.977827, 0.022173, 0.000000, 0.000000 },
-	{ -0.053007, -0.067870, -0.006160, -0.753715, -0.657051, 0.014021, -0.160071, 0.162845, -0.973581, 1.000000, 0.380860, 0.182940, 17, 18, 1, 1, 0.845514, 0.154486, 0.000000, 0.000000 },
-	{ -0.053997, -0.057064, -0.008379, -0.807220, 0.469368, -0.357897, 0.543966, 0.356196, -0.759754, 1.000000, 0.399300, 0.210570, 17, 18, 1, 1, 0.886901, 0.113099, 0.000000, 0.000000 },
-	{ -0.051849, -0.068087, -0.000223, -0.505898, -0.853788, 0.122939, -0.248863, 0.008002, -0.968506, 1.000000, 0.364930, 0.183940, 17, 18, 1, 1, 0.970892, 0.029108, 0.000000, 0.000000 },
-	{ -0.050864, -0.069400, -0.005310, -0.515072, -0.848858, 0.118918, -0.266992, 0.027053, -0.963319, 1.000000, 0.377080, 0.176220, 17, 18, 1, 1, 0.849396, 0.150604, 0.000000, 0.000000 },
-	{ -0.057276, -0.055314, 0.002519, -0.954303, 0.172607, -0.243951, 0.293504, 0.387790, -0.873770, 1.000000, 0.371850, 0.228240, 17, 1, 1, 1, 0.997610, 0.002390, 0.000000, 0.000000 },
-	{ -0.057599, -0.058675, 0.003680, -0.980964, -0.099141, -0.166973, 0.132227, 0.288702, -0.948245, 1.000000, 0.364360, 0.220490, 17, 1, 1, 1, 0.997146, 0.002854, 0.000000, 0.000000 },
-	{ -0.056911, -0.062261, 0.004699, -0.923810, -0.375992, -0.072148, 0.002225, 0.183173, -0.983078, 1.000000, 0.357080, 0.209550, 17, 1, 18, 1, 0.995078, 0.003688, 0.001234, 0.000000 },
-	{ -0.055231, -0.064989, 0.005334, -0.734020, -0.677232, 0.050709, -0.135803, 0.073211, -0.988027, 1.000000, 0.352820, 0.200280, 17, 1, 18, 1, 0.995505, 0.003250, 0.001245, 0.000000 },
-	{ -0.052764, -0.066700, 0.005594, -0.493971, -0.859277, 0.132802, -0.203228, -0.034403, -0.978527, 1.000000, 0.350220, 0.191790, 17, 1, 18, 1, 0.996500, 0.002072, 0.001428, 0.000000 },
-	{ -0.057938, -0.052962, 0.007441, -0.938688, 0.214859, -0.269632, 0.326517, 0.302930, -0.895333, 1.000000, 0.362690, 0.240330, 17, 1, 8, 1, 0.983806, 0.014684, 0.001510, 0.000000 },
-	{ -0.056447, -0.050407, 0.006356, -0.839767, 0.421555, -0.342173, 0.494487, 0.333563, -0.802632, 1.000000, 0.370750, 0.246000, 17, 1, 8, 1, 0.990231, 0.005644, 0.004125, 0.000000 },
-	{ -0.056638, -0.047867, 0.009716, -0.828202, 0.273590, -0.489111, 0.554327, 0.271467, -0.786783, 1.000000, 0.367460, 0.255470, 17, 8, 1, 1, 0.917459, 0.059371, 0.023170, 0.000000 },
-	{ -0.058588, -0.050636, 0.011348, -0.916279, 0.151121, -0.370939, 0.398061, 0.240654, -0.885231, 1.000000, 0.356320, 0.249620, 17, 1, 8, 1, 0.904116, 0.058330, 0.037554, 0.000000 },
-	{ -0.058738, -0.056763, 0.008954, -0.980507, -0.072544, -0.182600, 0.162265, 0.225078, -0.960734, 1.000000, 0.352520, 0.230400, 17, 1, 1, 1, 0.980693, 0.019307, 0.000000, 0.000000 },
-	{ -0.059818, -0.055228, 0.013251, -0.969544, -0.090612, -0.227538, 0.206963, 0.193657, -0.958991, 1.000000, 0.342580, 0.237850, 17, 1, 1, 1, 0.926936, 0.073064, 0.000000, 0.000000 },
-	{ -0.057983, -0.060661, 0.010269, -0.910475, -0.409511, -0.057757, -0.003189, 0.146605, -0.989190, 1.000000, 0.344000, 0.218320, 17, 1, 1, 1, 0.979863, 0.020137, 0.000000, 0.000000 },
-	{ -0.058781, -0.059714, 0.014977, -0.881332, -0.468613, -0.060462, -0.000239, 0.128405, -0.991722, 1.000000, 0.332960, 0.224450, 17, 1, 1, 1, 0.929191, 0.070809, 0.000000, 0.000000 },
-	{ -0.055803, -0.063213, 0.016107, -0.684358, -0.729028, 0.013105, -0.054063, 0.032810, -0.997998, 1.000000, 0.325900, 0.208450, 17, 1, 13, 12, 0.925277, 0.052326, 0.020992, 0.001406 },
-	{ -0.055820, -0.063735, 0.010995, -0.711865, -0.699391, 0.064035, -0.113554, 0.024641, -0.993226, 1.000000, 0.338430, 0.206250, 17, 1, 1, 1, 0.982957, 0.017043, 0.000000, 0.000000 },
-	{ -0.053071, -0.065611, 0.011246, -0.482541, -0.866662, 0.126695, -0.128837, -0.072843, -0.988987, 1.000000, 0.335220, 0.196130, 17, 13, 1, 1, 0.972606, 0.018128, 0.009266, 0.000000 },
-	{ -0.052584, -0.065173, 0.016184, -0.473027, -0.880735, 0.023476, -0.032933, -0.008952, -0.999418, 1.000000, 0.322870, 0.195570, 17, 13, 1, 12, 0.822540, 0.148035, 0.025871, 0.003553 },
-	{ -0.050119, -0.021785, 0.000821, -0.265937, 0.937177, -0.225783, 0.502512, -0.065104, -0.862116, 1.000000, 0.411390, 0.355320, 8, 4, 1, 1, 0.981601, 0.013656, 0.004743, 0.000000 },
-	{ -0.049481, -0.020788, 0.004014, -0.344613, 0.863379, -0.368536, 0.526325, -0.147373, -0.837415, 1.000000, 0.406690, 0.362280, 8, 4, 1, 1, 0.909277, 0.077358, 0.013364, 0.000000 },
-	{ -0.047528, -0.021731, -0.001071, -0.141717, 0.960038, -0.241337, 0.593533, -0.112706, -0.796879, 1.000000, 0.420670, 0.358810, 8, 4, 1, 1, 0.979511, 0.019241, 0.001248, 0.000000 },
-	{ -0.046876, -0.020852, 0.001864, -0.237903, 0.902838, -0.358171, 0.588721, -0.159264, -0.792492, 1.000000, 0.416520, 0.365700, 8, 4, 1, 1, 0.892462, 0.103649, 0.003889, 0.000000 },
-	{ -0.045550, -0.021896, -0.002162, -0.009622, 0.960703, -0.277413, 0.668478, -0.200143, -0.716297, 1.000000, 0.426810, 0.360960, 8, 4, 1, 1, 0.977345, 0.022655, 0.000000, 0.000000 },
-	{ -0.044867, -0.021002, 0.000439, -0.118432, 0.908638, -0.400439, 0.707659, -0.205662, -0.675960, 1.000000, 0.423710, 0.367600, 8, 4, 1, 1, 0.904779, 0.094213, 0.001008, 0.000000 },
-	{ -0.044008, -0.022157, -0.002558, 0.189169, 0.923878, -0.332662, 0.679735, -0.367693, -0.634635, 1.000000, 0.430840, 0.363030, 8, 4, 1, 1, 0.984491, 0.015509, 0.000000, 0.000000 },
-	{ -0.043286, -0.021246, -0.000205, 0.100822, 0.863421, -0.494307, 0.806191, -0.362042, -0.467954, 1.000000, 0.428730, 0.368880, 8, 4, 1, 1, 0.871827, 0.128173, 0.000000, 0.000000 },
-	{ -0.042719, -0.022600, -0.002461, 0.472542, 0.797975, -0.374086, 0.620116, -0.602668, -0.502243, 1.000000, 0.433640, 0.364970, 8, 4, 1, 1, 0.969147, 0.030853, 0.000000, 0.000000 },
-	{ -0.043415, -0.023595, -0.005952, 0.438190, 0.858238, -0.267241, 0.490131, -0.477345, -0.729324, 1.000000, 0.438710, 0.358790, 8, 4, 1, 1, 0.997675, 0.002325, 0.000000, 0.000000 },
-	{ -0.041952, -0.024405, -0.005372, 0.622085, 0.749113, -0.227684, 0.434231, -0.572084, -0.695819, 1.000000, 0.441190, 0.362500, 8, 4, 1, 1, 0.997069, 0.002931, 0.000000, 0.000000 },
-	{ -0.041371, -0.023512, -0.001932, 0.682430, 0.631460, -0.368168, 0.529103, -0.774262, -0.347230, 1.000000, 0.437180, 0.367410, 8, 4, 1, 1, 0.959034, 0.040966, 0.000000, 0.000000 },
-	{ -0.044758, -0.023168, -0.006218, 0.217515, 0.938667, -0.267566, 0.537468, -0.344013, -0.769924, 1.000000, 0.436610, 0.355910, 8, 4, 1, 1, 0.998897, 0.001103, 0.000000, 0.000000 },
-	{ -0.043808, -0.024613, -0.010366, 0.385010, 0.898457, -0.211051, 0.422614, -0.374925, -0.825124, 1.000000, 0.447930, 0.352780, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.042191, -0.025328, -0.009802, 0.539272, 0.824221, -0.172757, 0.382704, -0.422594, -0.821555, 1.000000, 0.449940, 0.357160, 8, 9, 1, 1, 0.998862, 0.001138, 0.000000, 0.000000 },
-	{ -0.043889, -0.025555, -0.014894, 0.344139, 0.923424, -0.169875, 0.404146, -0.308993, -0.860923, 1.000000, 0.458730, 0.347730, 8, 9, 1, 1, 0.990237, 0.009763, 0.000000, 0.000000 },
-	{ -0.042150, -0.026220, -0.014353, 0.486613, 0.861700, -0.143810, 0.370882, -0.352811, -0.859053, 1.000000, 0.460750, 0.352560, 8, 9, 1, 1, 0.988389, 0.011611, 0.000000, 0.000000 },
-	{ -0.041880, -0.026921, -0.018369, 0.474904, 0.872941, -0.111539, 0.386280, -0.320652, -0.864853, 1.000000, 0.470730, 0.348800, 8, 9, 1, 1, 0.937945, 0.062055, 0.000000, 0.000000 },
-	{ -0.043644, -0.026286, -0.018942, 0.323420, 0.936865, -0.132977, 0.422637, -0.268753, -0.865534, 1.000000, 0.468770, 0.343860, 8, 9, 1, 1, 0.940000, 0.060000, 0.000000, 0.000000 },
-	{ -0.045164, -0.025938, -0.019369, 0.190247, 0.969643, -0.153619, 0.451860, -0.225403, -0.863143, 1.000000, 0.467200, 0.340030, 8, 9, 1, 1, 0.926307, 0.073693, 0.000000, 0.000000 },
-	{ -0.045397, -0.025186, -0.015252, 0.198366, 0.962403, -0.185557, 0.439578, -0.256567, -0.860782, 1.000000, 0.457080, 0.344030, 8, 9, 1, 1, 0.989491, 0.010509, 0.000000, 0.000000 },
-	{ -0.045254, -0.024231, -0.010678, 0.211599, 0.951087, -0.225077, 0.464491, -0.300482, -0.833042, 1.000000, 0.446090, 0.349400, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.041966, -0.021680, -0.000248, 0.439554, 0.678769, -0.588273, 0.780167, -0.613069, -0.124443, 1.000000, 0.432380, 0.369850, 8, 4, 1, 1, 0.815902, 0.184098, 0.000000, 0.000000 },
-	{ -0.041260, -0.020723, 0.000835, 0.320515, 0.302835, -0.897531, 0.895086, -0.406902, 0.182350, 1.000000, 0.433180, 0.373190, 4, 8, 1, 1, 0.518822, 0.481178, 0.000000, 0.000000 },
-	{ -0.040603, -0.022527, 0.000255, 0.632193, 0.443056, -0.635636, 0.694215, -0.688226, 0.210741, 1.000000, 0.436840, 0.370780, 8, 4, 1, 1, 0.765059, 0.233095, 0.001846, 0.000000 },
-	{ -0.039748, -0.021219, 0.001359, 0.456803, 0.091237, -0.884877, 0.875709, -0.221024, 0.429281, 1.000000, 0.437900, 0.373290, 4, 8, 1, 1, 0.603709, 0.394531, 0.001760, 0.000000 },
-	{ -0.042679, -0.020351, 0.000783, -0.052293, 0.546295, -0.835959, 0.876614, -0.375862, -0.300460, 1.000000, 0.428790, 0.372640, 8, 4, 1, 1, 0.557095, 0.442905, 0.000000, 0.000000 },
-	{ -0.040587, -0.019752, 0.000960, 0.170973, -0.408888, -0.896426, 0.964192, -0.117774, 0.237618, 1.000000, 0.434680, 0.375340, 4, 8, 1, 1, 0.835636, 0.164364, 0.000000, 0.000000 },
-	{ -0.038877, -0.019843, 0.001449, 0.293270, -0.428679, -0.854533, 0.956022, 0.128003, 0.263887, 1.000000, 0.439780, 0.375200, 4, 8, 1, 1, 0.894032, 0.104601, 0.001367, 0.000000 },
-	{ -0.039900, -0.018706, 0.000161, 0.094618, -0.837041, -0.538897, 0.995316, 0.068762, 0.067950, 1.000000, 0.436520, 0.377910, 4, 8, 1, 1, 0.974603, 0.025397, 0.000000, 0.000000 },
-	{ -0.038040, -0.018601, 0.000553, 0.201384, -0.834304, -0.513207, 0.971070, 0.238693, -0.006985, 1.000000, 0.442080, 0.377240, 4, 8, 1, 1, 0.987757, 0.012243, 0.000000, 0.000000 },
-	{ -0.041475, -0.018661, 0.000018, -0.125368, -0.802537, -0.583282, 0.991086, -0.128024, -0.036871, 1.000000, 0.431740, 0.378000, 4, 8, 1, 1, 0.956494, 0.043506, 0.000000, 0.000000 },
-	{ -0.042117, -0.019587, 0.000802, -0.158868, -0.316704, -0.935126, 0.952323, -0.299030, -0.060516, 1.000000, 0.429920, 0.374910, 4, 8, 1, 1, 0.778211, 0.221789, 0.000000, 0.000000 },
-	{ -0.037102, -0.017520, -0.001753, 0.138455, -0.961630, -0.236851, 0.943214, 0.200952, -0.264508, 1.000000, 0.445640, 0.381070, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.039019, -0.017644, -0.002045, 0.049335, -0.958463, -0.280917, 0.975222, 0.106956, -0.193654, 1.000000, 0.440080, 0.382620, 4, 8, 1, 1, 0.998511, 0.001489, 0.000000, 0.000000 },
-	{ -0.040599, -0.017605, -0.002179, -0.106814, -0.936430, -0.334199, 0.978088, -0.038551, -0.204590, 1.000000, 0.435570, 0.383600, 4, 8, 1, 1, 0.996612, 0.003388, 0.000000, 0.000000 },
-	{ -0.037657, -0.016801, -0.005914, 0.003060, -0.990280, -0.139059, 0.913711, 0.059276, -0.402017, 1.000000, 0.448320, 0.390300, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.039196, -0.016731, -0.006018, -0.125128, -0.971858, -0.199586, 0.927121, -0.042911, -0.372297, 1.000000, 0.444310, 0.392050, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.035781, -0.016430, -0.010702, -0.051142, -0.997649, -0.045627, 0.882407, -0.023744, -0.469887, 1.000000, 0.460610, 0.399050, 4, 5, 1, 1, 0.988668, 0.011332, 0.000000, 0.000000 },
-	{ -0.037301, -0.016282, -0.010675, -0.170522, -0.978473, -0.116249, 0.886610, -0.100885, -0.451381, 1.000000, 0.456500, 0.400720, 4, 5, 1, 1, 0.990402, 0.009598, 0.000000, 0.000000 },
-	{ -0.035273, -0.016343, -0.015112, -0.222635, -0.973070, -0.059737, 0.862765, -0.168125, -0.476835, 1.000000, 0.468880, 0.408140, 4, 5, 1, 1, 0.930354, 0.069646, 0.000000, 0.000000 },
-	{ -0.033769, -0.016604, -0.015170, -0.099376, -0.994938, 0.014950, 0.872182, -0.094327, -0.480001, 1.000000, 0.473120, 0.406450, 4, 5, 1, 1, 0.921906, 0.078094, 0.000000, 0.000000 },
-	{ -0.033909, -0.016460, -0.010713, 0.035798, -0.999306, 0.010322, 0.870816, 0.026125, -0.490915, 1.000000, 0.465770, 0.396720, 4, 5, 1, 1, 0.983268, 0.016732, 0.000000, 0.000000 },
-	{ -0.031987, -0.016726, -0.015239, 0.008608, -0.997322, 0.072635, 0.872633, -0.027978, -0.487574, 1.000000, 0.478290, 0.404460, 4, 5, 1, 1, 0.899959, 0.100041, 0.000000, 0.000000 },
-	{ -0.035759, -0.016726, -0.005748, 0.083907, -0.992388, -0.090146, 0.891566, 0.115169, -0.438002, 1.000000, 0.453470, 0.387960, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.036548, -0.015928, -0.015147, -0.373672, -0.916240, -0.144474, 0.834785, -0.264293, -0.482993, 1.000000, 0.465590, 0.409810, 4, 5, 1, 1, 0.935275, 0.064725, 0.000000, 0.000000 },
-	{ -0.038591, -0.015951, -0.010638, -0.343755, -0.917260, -0.201166, 0.854385, -0.216601, -0.472345, 1.000000, 0.453020, 0.402150, 4, 5, 1, 1, 0.991663, 0.008337, 0.000000, 0.000000 },
-	{ -0.040517, -0.016468, -0.005941, -0.326386, -0.904444, -0.274687, 0.892677, -0.199383, -0.404195, 1.000000, 0.440680, 0.393130, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.041996, -0.017369, -0.001986, -0.350334, -0.851127, -0.390959, 0.918958, -0.231661, -0.319138, 1.000000, 0.431530, 0.384090, 4, 8, 1, 1, 0.993177, 0.006823, 0.000000, 0.000000 },
-	{ -0.042971, -0.018404, 0.000398, -0.432263, -0.674334, -0.598683, 0.901178, -0.299452, -0.313380, 1.000000, 0.426870, 0.377670, 4, 8, 1, 1, 0.928479, 0.071521, 0.000000, 0.000000 },
-	{ -0.043707, -0.019318, 0.001391, -0.516970, -0.148858, -0.842961, 0.823050, -0.357049, -0.441708, 1.000000, 0.424360, 0.373970, 4, 8, 1, 1, 0.699602, 0.299203, 0.001196, 0.000000 },
-	{ -0.044296, -0.020091, 0.001463, -0.350055, 0.622252, -0.700189, 0.725828, -0.292333, -0.622667, 1.000000, 0.423170, 0.371480, 8, 4, 1, 1, 0.668176, 0.330318, 0.001506, 0.000000 },
-	{ -0.037793, -0.015263, -0.015291, -0.498140, -0.842707, -0.204210, 0.785349, -0.338659, -0.518206, 1.000000, 0.462150, 0.411860, 4, 5, 1, 1, 0.936377, 0.063623, 0.000000, 0.000000 },
-	{ -0.039865, -0.015342, -0.010616, -0.496686, -0.827027, -0.263304, 0.794237, -0.310762, -0.522126, 1.000000, 0.449440, 0.403940, 4, 5, 1, 1, 0.990884, 0.009116, 0.000000, 0.000000 },
-	{ -0.041863, -0.015920, -0.005663, -0.502950, -0.800562, -0.325794, 0.820433, -0.323619, -0.471339, 1.000000, 0.436690, 0.394190, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.043482, -0.016863, -0.001344, -0.537646, -0.734023, -0.414906, 0.823801, -0.352430, -0.444010, 1.000000, 0.426340, 0.384040, 4, 8, 1, 1, 0.986617, 0.013383, 0.000000, 0.000000 },
-	{ -0.044632, -0.017933, 0.001415, -0.611774, -0.546169, -0.572216, 0.786212, -0.340094, -0.515952, 1.000000, 0.420390, 0.376990, 4, 8, 1, 1, 0.884565, 0.113416, 0.002019, 0.000000 },
-	{ -0.045530, -0.018933, 0.002731, -0.658935, -0.054630, -0.750213, 0.720267, -0.333337, -0.608360, 1.000000, 0.417020, 0.372800, 4, 8, 1, 1, 0.613406, 0.382291, 0.004303, 0.000000 },
-	{ -0.046237, -0.019833, 0.002913, -0.476623, 0.603451, -0.639279, 0.631929, -0.270352, -0.726344, 1.000000, 0.415800, 0.369850, 8, 4, 1, 1, 0.704598, 0.289994, 0.005408, 0.000000 },
-	{ -0.039072, -0.014305, -0.015652, -0.595216, -0.768660, -0.234262, 0.720227, -0.381028, -0.579733, 1.000000, 0.459000, 0.414970, 4, 5, 1, 1, 0.927595, 0.072405, 0.000000, 0.000000 },
-	{ -0.041207, -0.014390, -0.010609, -0.609488, -0.734601, -0.298139, 0.737282, -0.386958, -0.553785, 1.000000, 0.445520, 0.406440, 4, 5, 1, 1, 0.987899, 0.012101, 0.000000, 0.000000 },
-	{ -0.043383, -0.015022, -0.005178, -0.619670, -0.701693, -0.351619, 0.748637, -0.393902, -0.533276, 1.000000, 0.431260, 0.395540, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.045152, -0.016030, -0.000372, -0.643806, -0.640057, -0.419334, 0.736971, -0.371214, -0.564867, 1.000000, 0.419820, 0.384260, 4, 8, 1, 1, 0.975661, 0.021968, 0.002371, 0.000000 },
-	{ -0.046512, -0.017209, 0.002983, -0.690770, -0.468131, -0.551081, 0.713705, -0.319131, -0.623522, 1.000000, 0.412380, 0.376580, 4, 8, 1, 1, 0.840290, 0.151997, 0.007713, 0.000000 },
-	{ -0.047654, -0.018385, 0.004709, -0.696780, -0.031981, -0.716571, 0.688226, -0.311278, -0.655325, 1.000000, 0.408220, 0.371700, 4, 8, 1, 1, 0.553212, 0.432120, 0.014669, 0.000000 },
-	{ -0.048635, -0.019562, 0.005067, -0.534602, 0.550094, -0.641558, 0.611984, -0.271545, -0.742791, 1.000000, 0.406370, 0.367430, 8, 4, 1, 1, 0.713313, 0.269216, 0.017471, 0.000000 },
-	{ -0.040298, -0.013045, -0.016184, -0.695900, -0.672351, -0.252324, 0.655661, -0.451506, -0.605187, 1.000000, 0.456230, 0.419210, 4, 5, 1, 1, 0.921711, 0.078289, 0.000000, 0.000000 },
-	{ -0.042551, -0.013106, -0.010591, -0.715008, -0.620170, -0.322728, 0.659644, -0.445539, -0.605280, 1.000000, 0.440760, 0.409300, 4, 5, 1, 1, 0.989324, 0.010676, 0.000000, 0.000000 },
-	{ -0.041390, -0.011511, -0.016714, -0.804778, -0.530180, -0.266912, 0.552230, -0.503867, -0.664199, 1.000000, 0.452920, 0.423390, 4, 5, 1, 1, 0.950798, 0.049202, 0.000000, 0.000000 },
-	{ -0.043646, -0.011472, -0.010784, -0.822688, -0.459319, -0.334979, 0.546946, -0.478815, -0.686721, 1.000000, 0.436930, 0.413580, 4, 5, 1, 1, 0.995755, 0.004245, 0.000000, 0.000000 },
-	{ -0.044317, -0.009443, -0.011346, -0.918918, -0.216199, -0.329921, 0.394447, -0.506131, -0.766971, 1.000000, 0.434210, 0.419350, 4, 5, 1, 1, 0.990834, 0.009166, 0.000000, 0.000000 },
-	{ -0.042238, -0.009574, -0.017408, -0.911032, -0.306109, -0.276257, 0.404482, -0.533311, -0.742949, 1.000000, 0.449600, 0.429080, 4, 5, 1, 1, 0.924420, 0.075580, 0.000000, 0.000000 },
-	{ -0.044271, -0.006968, -0.012090, -0.950513, 0.067937, -0.303167, 0.232979, -0.489700, -0.840188, 1.000000, 0.432080, 0.426890, 4, 5, 1, 1, 0.988204, 0.011796, 0.000000, 0.000000 },
-	{ -0.042446, -0.007328, -0.018220, -0.962402, -0.011340, -0.271391, 0.236687, -0.525219, -0.817389, 1.000000, 0.447560, 0.435820, 4, 5, 1, 1, 0.910899, 0.089101, 0.000000, 0.000000 },
-	{ -0.041984, -0.004663, -0.018788, -0.928871, 0.268355, -0.255312, 0.105027, -0.470177, -0.876301, 1.000000, 0.444430, 0.443980, 4, 5, 1, 1, 0.870067, 0.129933, 0.000000, 0.000000 },
-	{ -0.043553, -0.004175, -0.012681, -0.908048, 0.320823, -0.269299, 0.104345, -0.449394, -0.887219, 1.000000, 0.429620, 0.435900, 4, 5, 1, 1, 0.980160, 0.019840, 0.000000, 0.000000 },
-	{ -0.040771, -0.001978, -0.018902, -0.826364, 0.515508, -0.226657, -0.003620, -0.407345, -0.913267, 1.000000, 0.440910, 0.452710, 4, 5, 1, 1, 0.885740, 0.114260, 0.000000, 0.000000 },
-	{ -0.042126, -0.001523, -0.012886, -0.799761, 0.553204, -0.233126, -0.010005, -0.400566, -0.916214, 1.000000, 0.426730, 0.445010, 4, 5, 1, 1, 0.975796, 0.024204, 0.000000, 0.000000 },
-	{ -0.040267, 0.000460, -0.012889, -0.611535, 0.768209, -0.189420, -0.105213, -0.316232, -0.942830, 1.000000, 0.424650, 0.452870, 4, 5, 1, 1, 0.980151, 0.019849, 0.000000, 0.000000 },
-	{ -0.039057, 0.000122, -0.018684, -0.636303, 0.749860, -0.181188, -0.097182, -0.310915, -0.945456, 1.000000, 0.437920, 0.460180, 4, 5, 1, 1, 0.898761, 0.101239, 0.000000, 0.000000 },
-	{ -0.038176, 0.001630, -0.012775, -0.380180, 0.913614, -0.144127, -0.145810, -0.213081, -0.966093, 1.000000, 0.422960, 0.460040, 4, 5, 1, 1, 0.976539, 0.023461, 0.000000, 0.000000 },
-	{ -0.037026, 0.001348, -0.018252, -0.375472, 0.917456, -0.131513, -0.139757, -0.196317, -0.970530, 1.000000, 0.435520, 0.466770, 4, 5, 1, 1, 0.886588, 0.113412, 0.000000, 0.000000 },
-	{ -0.039266, 0.002208, -0.006681, -0.354696, 0.920927, -0.161507, -0.120916, -0.216469, -0.968773, 1.000000, 0.408690, 0.453160, 4, 5, 1, 1, 0.998675, 0.001325, 0.000000, 0.000000 },
-	{ -0.041595, 0.001023, -0.006543, -0.581795, 0.785834, -0.209715, -0.073385, -0.307512, -0.948710, 1.000000, 0.409550, 0.445200, 4, 5, 1, 1, 0.998749, 0.001251, 0.000000, 0.000000 },
-	{ -0.043743, -0.001022, -0.006345, -0.774705, 0.579234, -0.253615, 0.017741, -0.381015, -0.924399, 1.000000, 0.410860, 0.436580, 4, 5, 1, 1, 0.998801, 0.001199, 0.000000, 0.000000 },
-	{ -0.045464, -0.003881, -0.006016, -0.885656, 0.361796, -0.291063, 0.124408, -0.419027, -0.899411, 1.000000, 0.413080, 0.426600, 4, 1, 1, 1, 0.998905, 0.001095, 0.000000, 0.000000 },
-	{ -0.046535, -0.007011, -0.005444, -0.935082, 0.129499, -0.329928, 0.241018, -0.450185, -0.859793, 1.000000, 0.415270, 0.416300, 4, 1, 1, 1, 0.998017, 0.001983, 0.000000, 0.000000 },
-	{ -0.046739, -0.009827, -0.004829, -0.919659, -0.145907, -0.364607, 0.388884, -0.467763, -0.793705, 1.000000, 0.417620, 0.407650, 4, 1, 1, 1, 0.996445, 0.003555, 0.000000, 0.000000 },
-	{ -0.046125, -0.012078, -0.004469, -0.832109, -0.405564, -0.378301, 0.544424, -0.467175, -0.696670, 1.000000, 0.420620, 0.401210, 4, 1, 1, 1, 0.996336, 0.003664, 0.000000, 0.000000 },
-	{ -0.044912, -0.013768, -0.004670, -0.722320, -0.584611, -0.369436, 0.665574, -0.442613, -0.600920, 1.000000, 0.425560, 0.397660, 4, 1, 1, 1, 0.998306, 0.001694, 0.000000, 0.000000 },
-	{ -0.040179, 0.002902, -0.001079, -0.310797, 0.938807, -0.148483, -0.057319, -0.174447, -0.982997, 1.000000, 0.395570, 0.448400, 4, 1, 1, 1, 0.994478, 0.005523, 0.000000, 0.000000 },
-	{ -0.042898, 0.001687, -0.000910, -0.548531, 0.810291, -0.206258, -0.009611, -0.252775, -0.967477, 1.000000, 0.396230, 0.439670, 4, 1, 1, 1, 0.994920, 0.005080, 0.000000, 0.000000 },
-	{ -0.045374, -0.000520, -0.000589, -0.753269, 0.601996, -0.264927, 0.074117, -0.322542, -0.943649, 1.000000, 0.397120, 0.430260, 4, 1, 1, 1, 0.994500, 0.005500, 0.000000, 0.000000 },
-	{ -0.047390, -0.003625, -0.000127, -0.867937, 0.388291, -0.309702, 0.168498, -0.356378, -0.919023, 1.000000, 0.398670, 0.419220, 4, 1, 1, 1, 0.992014, 0.007986, 0.000000, 0.000000 },
-	{ -0.050527, -0.007272, 0.005073, -0.912801, 0.185630, -0.363780, 0.310217, -0.264200, -0.913216, 1.000000, 0.389190, 0.402090, 4, 1, 1, 1, 0.946658, 0.053342, 0.000000, 0.000000 },
-	{ -0.052204, -0.007487, 0.009165, -0.902644, 0.210820, -0.375218, 0.343393, -0.172780, -0.923162, 1.000000, 0.378580, 0.398790, 4, 1, 8, 1, 0.852153, 0.139893, 0.007955, 0.000000 },
-	{ -0.052984, -0.011600, 0.009697, -0.880689, 0.063096, -0.469473, 0.451725, -0.186459, -0.872455, 1.000000, 0.381210, 0.385830, 4, 1, 8, 1, 0.737248, 0.148732, 0.114020, 0.000000 },
-	{ -0.050954, -0.011034, 0.005518, -0.902710, -0.036997, -0.428655, 0.422098, -0.269163, -0.865670, 1.000000, 0.392480, 0.390680, 4, 1, 8, 1, 0.922214, 0.060987, 0.016799, 0.000000 },
-	{ -0.050271, -0.014163, 0.005572, -0.822880, -0.243162, -0.513557, 0.566414, -0.279106, -0.775420, 1.000000, 0.397130, 0.381830, 4, 8, 1, 1, 0.814698, 0.136026, 0.049276, 0.000000 },
-	{ -0.052957, -0.015804, 0.009736, -0.786254, 0.080973, -0.612575, 0.584777, -0.222732, -0.780017, 1.000000, 0.385560, 0.372920, 4, 8, 1, 1, 0.475021, 0.406033, 0.118946, 0.000000 },
-	{ -0.048487, -0.016072, 0.004618, -0.732896, -0.403345, -0.547883, 0.671220, -0.297258, -0.679045, 1.000000, 0.404110, 0.377530, 4, 8, 1, 1, 0.819775, 0.158325, 0.021900, 0.000000 },
-	{ -0.050094, -0.017533, 0.007053, -0.702530, -0.055965, -0.709450, 0.692331, -0.284478, -0.663137, 1.000000, 0.398100, 0.371050, 4, 8, 1, 1, 0.522772, 0.431756, 0.045472, 0.000000 },
-	{ -0.054949, -0.011809, 0.013522, -0.892831, 0.185931, -0.410221, 0.398860, -0.096638, -0.911905, 1.000000, 0.369090, 0.383280, 4, 1, 8, 1, 0.613503, 0.277770, 0.108728, 0.000000 },
-	{ -0.056084, -0.015712, 0.013816, -0.837276, 0.268612, -0.476253, 0.466600, -0.103076, -0.878442, 1.000000, 0.369760, 0.370370, 8, 4, 1, 1, 0.370293, 0.365751, 0.263955, 0.000000 },
-	{ -0.056195, -0.011934, 0.017056, -0.923510, 0.294652, -0.245581, 0.255509, -0.004962, -0.966794, 1.000000, 0.359000, 0.382410, 4, 1, 8, 1, 0.440102, 0.418682, 0.141216, 0.000000 },
-	{ -0.057642, -0.015816, 0.017417, -0.896528, 0.357590, -0.261470, 0.279206, -0.002112, -0.960229, 1.000000, 0.358300, 0.369600, 1, 8, 4, 1, 0.423555, 0.364315, 0.212131, 0.000000 },
-	{ -0.056908, -0.012109, 0.020600, -0.928711, 0.347587, -0.129150, 0.154134, 0.045087, -0.987021, 1.000000, 0.349660, 0.382140, 1, 4, 8, 1, 0.578656, 0.297345, 0.123999, 0.000000 },
-	{ -0.058475, -0.015991, 0.021137, -0.915900, 0.377431, -0.136650, 0.164123, 0.041444, -0.985569, 1.000000, 0.347900, 0.369300, 1, 8, 4, 1, 0.601253, 0.278725, 0.120022, 0.000000 },
-	{ -0.057373, -0.012268, 0.024363, -0.922030, 0.379089, -0.078433, 0.111072, 0.064974, -0.991686, 1.000000, 0.339540, 0.382350, 1, 4, 8, 1, 0.747889, 0.156959, 0.095152, 0.000000 },
-	{ -0.058995, -0.016115, 0.025010, -0.921822, 0.378115, -0.085280, 0.116787, 0.061147, -0.991273, 1.000000, 0.337150, 0.369580, 1, 8, 4, 1, 0.776188, 0.173312, 0.050500, 0.000000 },
-	{ -0.057680, -0.012255, 0.028384, -0.914913, 0.399731, -0.056116, 0.089358, 0.065000, -0.993876, 1.000000, 0.328600, 0.383300, 1, 8, 4, 1, 0.884863, 0.057960, 0.057177, 0.000000 },
-	{ -0.059305, -0.016024, 0.029049, -0.925537, 0.374168, -0.058130, 0.087880, 0.062932, -0.994141, 1.000000, 0.326010, 0.370790, 1, 8, 4, 1, 0.904204, 0.077812, 0.017984, 0.000000 },
-	{ -0.057811, -0.012019, 0.032602, -0.910753, 0.411288, -0.037021, 0.065740, 0.055897, -0.996270, 1.000000, 0.317350, 0.384940, 1, 8, 4, 1, 0.961613, 0.021901, 0.016486, 0.000000 },
-	{ -0.059399, -0.015703, 0.033246, -0.928059, 0.371030, -0.032291, 0.056539, 0.054660, -0.996903, 1.000000, 0.314700, 0.372710, 1, 8, 4, 1, 0.969134, 0.023294, 0.007573, 0.000000 },
-	{ -0.057778, -0.011619, 0.037285, -0.909757, 0.414771, -0.017524, 0.040694, 0.047090, -0.998061, 1.000000, 0.304710, 0.387070, 1, 4, 8, 1, 0.990513, 0.004928, 0.004559, 0.000000 },
-	{ -0.059314, -0.015221, 0.037891, -0.929629, 0.368392, -0.008748, 0.028757, 0.048859, -0.998392, 1.000000, 0.302080, 0.375110, 1, 8, 4, 1, 0.992121, 0.004745, 0.003134, 0.000000 },
-	{ -0.057597, -0.011107, 0.042701, -0.910868, 0.412689, 0.002645, 0.019333, 0.049071, -0.998608, 1.000000, 0.289790, 0.389560, 1, 4, 1, 1, 0.998728, 0.001272, 0.000000, 0.000000 },
-	{ -0.059070, -0.014624, 0.043237, -0.931046, 0.364656, 0.013385, 0.007617, 0.056094, -0.998397, 1.000000, 0.287300, 0.378000, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057304, -0.010643, 0.048923, -0.913309, 0.406492, 0.025118, 0.005138, 0.073169, -0.997306, 1.000000, 0.272440, 0.392170, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058697, -0.014073, 0.049351, -0.933001, 0.358141, 0.035276, -0.005563, 0.083660, -0.996479, 1.000000, 0.270230, 0.381140, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060690, -0.018927, 0.038540, -0.944523, 0.328436, 0.002490, 0.015451, 0.052007, -0.998527, 1.000000, 0.298850, 0.362580, 1, 8, 4, 1, 0.994741, 0.003733, 0.001526, 0.000000 },
-	{ -0.061945, -0.022803, 0.039312, -0.960589, 0.277460, 0.016863, 0.001272, 0.065052, -0.997881, 1.000000, 0.294700, 0.349100, 1, 8, 1, 1, 0.996705, 0.003295, 0.000000, 0.000000 },
-	{ -0.062925, -0.026768, 0.040227, -0.985941, 0.162712, 0.038015, -0.023960, 0.087489, -0.995877, 1.000000, 0.289910, 0.335850, 1, 8, 1, 1, 0.997065, 0.002935, 0.000000, 0.000000 },
-	{ -0.063220, -0.030993, 0.041316, -0.998145, 0.006851, 0.060500, -0.059514, 0.100015, -0.993205, 1.000000, 0.284530, 0.322850, 1, 8, 17, 1, 0.996397, 0.002201, 0.001402, 0.000000 },
-	{ -0.062832, -0.035838, 0.042641, -0.994013, -0.080080, 0.074334, -0.082616, 0.105627, -0.990968, 1.000000, 0.278030, 0.308060, 1, 17, 8, 1, 0.995505, 0.003069, 0.001426, 0.000000 },
-	{ -0.059483, -0.017396, 0.056588, -0.948410, 0.311334, 0.059919, -0.017780, 0.136463, -0.990486, 1.000000, 0.248830, 0.372870, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058269, -0.013825, 0.056146, -0.935704, 0.348818, 0.052775, -0.008011, 0.128545, -0.991671, 1.000000, 0.251380, 0.384230, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059014, -0.017456, 0.063688, -0.951289, 0.302911, 0.057403, -0.003138, 0.176667, -0.984266, 1.000000, 0.229450, 0.376260, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060593, -0.021137, 0.057193, -0.961426, 0.266906, 0.066485, -0.027875, 0.145921, -0.988904, 1.000000, 0.245490, 0.360800, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060079, -0.021094, 0.064154, -0.963648, 0.260092, 0.061114, -0.015464, 0.174062, -0.984613, 1.000000, 0.226620, 0.364670, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058769, -0.017881, 0.070982, -0.955565, 0.293391, 0.028590, 0.029279, 0.190971, -0.981159, 1.000000, 0.209660, 0.379500, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059735, -0.021266, 0.071331, -0.968202, 0.248219, 0.031179, 0.014708, 0.180896, -0.983392, 1.000000, 0.207170, 0.368370, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060926, -0.024796, 0.064805, -0.982513, 0.174629, 0.064599, -0.033391, 0.176070, -0.983811, 1.000000, 0.223110, 0.353000, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060514, -0.024796, 0.071858, -0.985690, 0.164825, 0.035321, -0.005495, 0.178006, -0.984014, 1.000000, 0.204000, 0.357060, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058877, -0.018353, 0.078241, -0.959421, 0.281129, -0.021861, 0.072333, 0.170438, -0.982710, 1.000000, 0.189880, 0.382690, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059749, -0.021521, 0.078509, -0.973283, 0.228956, -0.017308, 0.055671, 0.162180, -0.985190, 1.000000, 0.187590, 0.371960, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060423, -0.024836, 0.078931, -0.989461, 0.144496, -0.009372, 0.032551, 0.158894, -0.986759, 1.000000, 0.184650, 0.361020, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060923, -0.028530, 0.072601, -0.998093, 0.048612, 0.038045, -0.028913, 0.176378, -0.983898, 1.000000, 0.200040, 0.345650, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060758, -0.028347, 0.079547, -0.999270, 0.038185, -0.001162, 0.007352, 0.162373, -0.986702, 1.000000, 0.180950, 0.349970, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060860, -0.032553, 0.073554, -0.997847, -0.054116, 0.037043, -0.046196, 0.179120, -0.982742, 1.000000, 0.195140, 0.333580, 1, 12, 1, 1, 0.995461, 0.004539, 0.000000, 0.000000 },
-	{ -0.060717, -0.032207, 0.080372, -0.998502, -0.054623, 0.003016, -0.012544, 0.174954, -0.984497, 1.000000, 0.176340, 0.338420, 1, 12, 1, 1, 0.993590, 0.006410, 0.000000, 0.000000 },
-	{ -0.060401, -0.036948, 0.074706, -0.991596, -0.124950, 0.033537, -0.057558, 0.193924, -0.979327, 1.000000, 0.189240, 0.320680, 1, 12, 1, 1, 0.967893, 0.032107, 0.000000, 0.000000 },
-	{ -0.060649, -0.037490, 0.068055, -0.990019, -0.128506, 0.057864, -0.081974, 0.191090, -0.978144, 1.000000, 0.207310, 0.315030, 1, 12, 1, 1, 0.972558, 0.027442, 0.000000, 0.000000 },
-	{ -0.061192, -0.032858, 0.066761, -0.996365, -0.059430, 0.061038, -0.070994, 0.183215, -0.980506, 1.000000, 0.213610, 0.328690, 1, 12, 1, 1, 0.996956, 0.003044, 0.000000, 0.000000 },
-	{ -0.059787, -0.042350, 0.069534, -0.980119, -0.190339, 0.056008, -0.095301, 0.204041, -0.974313, 1.000000, 0.200190, 0.301340, 1, 12, 1, 1, 0.877494, 0.122506, 0.000000, 0.000000 },
-	{ -0.059632, -0.041616, 0.076094, -0.982056, -0.186225, 0.029780, -0.070553, 0.216340, -0.973766, 1.000000, 0.182410, 0.307660, 1, 12, 1, 1, 0.876747, 0.123253, 0.000000, 0.000000 },
-	{ -0.060330, -0.036452, 0.081429, -0.992516, -0.122093, 0.002272, -0.026286, 0.195443, -0.980363, 1.000000, 0.170740, 0.326240, 1, 12, 1, 1, 0.966157, 0.033843, 0.000000, 0.000000 },
-	{ -0.059646, -0.040973, 0.082761, -0.983080, -0.183179, 0.000293, -0.041099, 0.219010, -0.974857, 1.000000, 0.164070, 0.313930, 1, 12, 1, 1, 0.889322, 0.110678, 0.000000, 0.000000 },
-	{ -0.058521, -0.046436, 0.077702, -0.966435, -0.255069, 0.030711, -0.093262, 0.236930, -0.967040, 1.000000, 0.174630, 0.295000, 1, 12, 1, 1, 0.700122, 0.299878, 0.000000, 0.000000 },
-	{ -0.058630, -0.045595, 0.084291, -0.965218, -0.261341, 0.007420, -0.070510, 0.232880, -0.969946, 1.000000, 0.156530, 0.301940, 1, 12, 1, 1, 0.754493, 0.245507, 0.000000, 0.000000 },
-	{ -0.057064, -0.051083, 0.079319, -0.930089, -0.362791, 0.057593, -0.148423, 0.227740, -0.962344, 1.000000, 0.166740, 0.283300, 12, 1, 1, 1, 0.510312, 0.489688, 0.000000, 0.000000 },
-	{ -0.057210, -0.049890, 0.085760, -0.913807, -0.403012, 0.050386, -0.144192, 0.205938, -0.967883, 1.000000, 0.149240, 0.290990, 1, 12, 1, 1, 0.603984, 0.396016, 0.000000, 0.000000 },
-	{ -0.055020, -0.055069, 0.080830, -0.846744, -0.516767, 0.126401, -0.242156, 0.162829, -0.956477, 1.000000, 0.159070, 0.272660, 12, 1, 1, 1, 0.666386, 0.333614, 0.000000, 0.000000 },
-	{ -0.055011, -0.056460, 0.074663, -0.871063, -0.480766, 0.100564, -0.221887, 0.202508, -0.953812, 1.000000, 0.175270, 0.264940, 12, 1, 1, 1, 0.775824, 0.224176, 0.000000, 0.000000 },
-	{ -0.056997, -0.052121, 0.072974, -0.936409, -0.345648, 0.060549, -0.148661, 0.234451, -0.960694, 1.000000, 0.183600, 0.275900, 12, 1, 1, 1, 0.580221, 0.419779, 0.000000, 0.000000 },
-	{ -0.052232, -0.060167, 0.076511, -0.797512, -0.583723, 0.152454, -0.279145, 0.133006, -0.950993, 1.000000, 0.166090, 0.254620, 12, 1, 1, 1, 0.863113, 0.136887, 0.000000, 0.000000 },
-	{ -0.052004, -0.058628, 0.082559, -0.767792, -0.610245, 0.195182, -0.299991, 0.073229, -0.951127, 1.000000, 0.150120, 0.261860, 12, 1, 1, 1, 0.733616, 0.266384, 0.000000, 0.000000 },
-	{ -0.054972, -0.053487, 0.087135, -0.808360, -0.573599, 0.132435, -0.246663, 0.125759, -0.960907, 1.000000, 0.142050, 0.280610, 12, 1, 1, 1, 0.505897, 0.494103, 0.000000, 0.000000 },
-	{ -0.051805, -0.056785, 0.088684, -0.719483, -0.662477, 0.208490, -0.279704, 0.001622, -0.960085, 1.000000, 0.133580, 0.269350, 12, 1, 1, 1, 0.554746, 0.445254, 0.000000, 0.000000 },
-	{ -0.058557, -0.047282, 0.071216, -0.964611, -0.258241, 0.053259, -0.112979, 0.222287, -0.968413, 1.000000, 0.192160, 0.288180, 1, 12, 1, 1, 0.674907, 0.325093, 0.000000, 0.000000 },
-	{ -0.048950, -0.061586, 0.084356, -0.708467, -0.658487, 0.253909, -0.281712, -0.066006, -0.957226, 1.000000, 0.139760, 0.251140, 12, 1, 1, 1, 0.723928, 0.276072, 0.000000, 0.000000 },
-	{ -0.049001, -0.059137, 0.089899, -0.646429, -0.707694, 0.285130, -0.269928, -0.137414, -0.953025, 1.000000, 0.124550, 0.258180, 12, 1, 1, 1, 0.539835, 0.460165, 0.000000, 0.000000 },
-	{ -0.049466, -0.063133, 0.078515, -0.745864, -0.636926, 0.194968, -0.286912, 0.043044, -0.956990, 1.000000, 0.155180, 0.244450, 12, 1, 1, 1, 0.864979, 0.135021, 0.000000, 0.000000 },
-	{ -0.046856, -0.062979, 0.085725, -0.614617, -0.721395, 0.319116, -0.303777, -0.156889, -0.939737, 1.000000, 0.130170, 0.242180, 12, 1, 1, 1, 0.659992, 0.340008, 0.000000, 0.000000 },
-	{ -0.046672, -0.060548, 0.091149, -0.543862, -0.753298, 0.369806, -0.344541, -0.201380, -0.916918, 1.000000, 0.116580, 0.249050, 1, 12, 1, 1, 0.515062, 0.484938, 0.000000, 0.000000 },
-	{ -0.044193, -0.061389, 0.092707, -0.416337, -0.792310, 0.445991, -0.456423, -0.242111, -0.856189, 1.000000, 0.109760, 0.242370, 1, 12, 1, 1, 0.569374, 0.430626, 0.000000, 0.000000 },
-	{ -0.044753, -0.063824, 0.087285, -0.489441, -0.786938, 0.375734, -0.414065, -0.169479, -0.894330, 1.000000, 0.122750, 0.235790, 12, 1, 1, 1, 0.590474, 0.409526, 0.000000, 0.000000 },
-	{ -0.047388, -0.064789, 0.080146, -0.663646, -0.707083, 0.244147, -0.302869, -0.044448, -0.951995, 1.000000, 0.144250, 0.235530, 12, 1, 1, 1, 0.812948, 0.187052, 0.000000, 0.000000 },
-	{ -0.045442, -0.065863, 0.081618, -0.542538, -0.784702, 0.299827, -0.393360, -0.078053, -0.916065, 1.000000, 0.136150, 0.229210, 12, 1, 1, 1, 0.742362, 0.257638, 0.000000, 0.000000 },
-	{ -0.057022, -0.053155, 0.066768, -0.934498, -0.348219, 0.073868, -0.158126, 0.220166, -0.962561, 1.000000, 0.199760, 0.268880, 12, 1, 1, 1, 0.607480, 0.392521, 0.000000, 0.000000 },
-	{ -0.058733, -0.048265, 0.064901, -0.960364, -0.268010, 0.076628, -0.134434, 0.204498, -0.969592, 1.000000, 0.208930, 0.281490, 1, 12, 1, 1, 0.673781, 0.326219, 0.000000, 0.000000 },
-	{ -0.060074, -0.043222, 0.063147, -0.978003, -0.193335, 0.078310, -0.116365, 0.194105, -0.974055, 1.000000, 0.217220, 0.294940, 1, 12, 1, 1, 0.884953, 0.115047, 0.000000, 0.000000 },
-	{ -0.061011, -0.038108, 0.061559, -0.988629, -0.129690, 0.076113, -0.099230, 0.182336, -0.978216, 1.000000, 0.224690, 0.309240, 1, 12, 1, 1, 0.976244, 0.023756, 0.000000, 0.000000 },
-	{ -0.061630, -0.033228, 0.060143, -0.994874, -0.066493, 0.076188, -0.086574, 0.170717, -0.981509, 1.000000, 0.231380, 0.323630, 1, 12, 1, 1, 0.997803, 0.002197, 0.000000, 0.000000 },
-	{ -0.061324, -0.028647, 0.065668, -0.996735, 0.048253, 0.064733, -0.055070, 0.180000, -0.982124, 1.000000, 0.218870, 0.341290, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061845, -0.028864, 0.058950, -0.996224, 0.040404, 0.076853, -0.069168, 0.165738, -0.983741, 1.000000, 0.236950, 0.336720, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061468, -0.024926, 0.057978, -0.981607, 0.176393, 0.073023, -0.045089, 0.157474, -0.986493, 1.000000, 0.241530, 0.348730, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054975, -0.057592, 0.068619, -0.882709, -0.461067, 0.090789, -0.206674, 0.207393, -0.956177, 1.000000, 0.190680, 0.257670, 12, 1, 1, 1, 0.829589, 0.170411, 0.000000, 0.000000 },
-	{ -0.052429, -0.061246, 0.070544, -0.816288, -0.564566, 0.122230, -0.244111, 0.145373, -0.958789, 1.000000, 0.181340, 0.247670, 12, 1, 1, 1, 0.933476, 0.066524, 0.000000, 0.000000 },
-	{ -0.049989, -0.064008, 0.072568, -0.766771, -0.624367, 0.149089, -0.251645, 0.078705, -0.964614, 1.000000, 0.170440, 0.238020, 12, 1, 1, 1, 0.951147, 0.048853, 0.000000, 0.000000 },
-	{ -0.047903, -0.065932, 0.074407, -0.699704, -0.691316, 0.180271, -0.278238, 0.031278, -0.960003, 1.000000, 0.159010, 0.229320, 12, 1, 1, 1, 0.923411, 0.076589, 0.000000, 0.000000 },
-	{ -0.045863, -0.067354, 0.076042, -0.588950, -0.776055, 0.225557, -0.362699, 0.004401, -0.931896, 1.000000, 0.149750, 0.222960, 12, 1, 1, 1, 0.875746, 0.124254, 0.000000, 0.000000 },
-	{ -0.043508, -0.068419, 0.077560, -0.428863, -0.859802, 0.277159, -0.481478, -0.042045, -0.875449, 1.000000, 0.142950, 0.218430, 12, 1, 1, 1, 0.828224, 0.171776, 0.000000, 0.000000 },
-	{ -0.043632, -0.069928, 0.072075, -0.471516, -0.849137, 0.237990, -0.443455, -0.004958, -0.896283, 1.000000, 0.156650, 0.212130, 12, 1, 1, 1, 0.935760, 0.064240, 0.000000, 0.000000 },
-	{ -0.040753, -0.069019, 0.078926, -0.236132, -0.918123, 0.318264, -0.578101, -0.130527, -0.805458, 1.000000, 0.137160, 0.214740, 12, 1, 1, 1, 0.788529, 0.211471, 0.000000, 0.000000 },
-	{ -0.040983, -0.070684, 0.073421, -0.272037, -0.920747, 0.279680, -0.556548, -0.086556, -0.826295, 1.000000, 0.150560, 0.208440, 12, 1, 1, 1, 0.910915, 0.089085, 0.000000, 0.000000 },
-	{ -0.037829, -0.069009, 0.080067, -0.039174, -0.940685, 0.337012, -0.615683, -0.242919, -0.749616, 1.000000, 0.131900, 0.211540, 12, 1, 1, 1, 0.750391, 0.249609, 0.000000, 0.000000 },
-	{ -0.038106, -0.070869, 0.074528, -0.056038, -0.951797, 0.301567, -0.613506, -0.205467, -0.762492, 1.000000, 0.144970, 0.205290, 12, 1, 1, 1, 0.883216, 0.116784, 0.000000, 0.000000 },
-	{ -0.034950, -0.068488, 0.080996, 0.138819, -0.932544, 0.333305, -0.585080, -0.348775, -0.732146, 1.000000, 0.126830, 0.208490, 12, 1, 1, 1, 0.712333, 0.287667, 0.000000, 0.000000 },
-	{ -0.032176, -0.067571, 0.081752, 0.303014, -0.898892, 0.316505, -0.497387, -0.432468, -0.752049, 1.000000, 0.120860, 0.204930, 12, 1, 1, 1, 0.681999, 0.318001, 0.000000, 0.000000 },
-	{ -0.034657, -0.066358, 0.086584, 0.130485, -0.916985, 0.376978, -0.569387, -0.380582, -0.728667, 1.000000, 0.113820, 0.215080, 12, 1, 1, 1, 0.577609, 0.422391, 0.000000, 0.000000 },
-	{ -0.032063, -0.065422, 0.087396, 0.296432, -0.881551, 0.367419, -0.480550, -0.470138, -0.740299, 1.000000, 0.106950, 0.211540, 12, 1, 1, 1, 0.550642, 0.449358, 0.000000, 0.000000 },
-	{ -0.032017, -0.062937, 0.092787, 0.291871, -0.822926, 0.487446, -0.446138, -0.567935, -0.691673, 1.000000, 0.094180, 0.218460, 1, 12, 1, 1, 0.576142, 0.423858, 0.000000, 0.000000 },
-	{ -0.029503, -0.061374, 0.093462, 0.479196, -0.726017, 0.493225, -0.368504, -0.676438, -0.637680, 1.000000, 0.086290, 0.213620, 1, 12, 1, 1, 0.607150, 0.392850, 0.000000, 0.000000 },
-	{ -0.029411, -0.064030, 0.088030, 0.471765, -0.806422, 0.356541, -0.403348, -0.556957, -0.726023, 1.000000, 0.098350, 0.206660, 12, 1, 1, 1, 0.528307, 0.471693, 0.000000, 0.000000 },
-	{ -0.030066, -0.057506, 0.098323, 0.488222, -0.620171, 0.614025, -0.375365, -0.784395, -0.493787, 1.000000, 0.075320, 0.222090, 1, 12, 1, 1, 0.745294, 0.254706, 0.000000, 0.000000 },
-	{ -0.032324, -0.059371, 0.097669, 0.294509, -0.727071, 0.620188, -0.454386, -0.677456, -0.578434, 1.000000, 0.082920, 0.225940, 1, 12, 1, 1, 0.712358, 0.287642, 0.000000, 0.000000 },
-	{ -0.034494, -0.063881, 0.092015, 0.122353, -0.870663, 0.476421, -0.542647, -0.460609, -0.702406, 1.000000, 0.100370, 0.222150, 1, 12, 1, 1, 0.546672, 0.453328, 0.000000, 0.000000 },
-	{ -0.034526, -0.060587, 0.096982, 0.129802, -0.784546, 0.606333, -0.538161, -0.569343, -0.621475, 1.000000, 0.088950, 0.229070, 1, 12, 1, 1, 0.681309, 0.318691, 0.000000, 0.000000 },
-	{ -0.029505, -0.066230, 0.082311, 0.461314, -0.837032, 0.294224, -0.424727, -0.499490, -0.755061, 1.000000, 0.112840, 0.200120, 12, 1, 1, 1, 0.662393, 0.337607, 0.000000, 0.000000 },
-	{ -0.034909, -0.056387, 0.101746, 0.187815, -0.766037, 0.614747, -0.549641, -0.600680, -0.580585, 1.000000, 0.075560, 0.238570, 1, 12, 1, 1, 0.803745, 0.196255, 0.000000, 0.000000 },
-	{ -0.032988, -0.055153, 0.102378, 0.361240, -0.705950, 0.609212, -0.442729, -0.704843, -0.554245, 1.000000, 0.070380, 0.235890, 1, 12, 1, 1, 0.828194, 0.171806, 0.000000, 0.000000 },
-	{ -0.035625, -0.052984, 0.106915, 0.297001, -0.853663, 0.427843, -0.574010, -0.517680, -0.634445, 1.000000, 0.062870, 0.247930, 1, 12, 1, 1, 0.889604, 0.110396, 0.000000, 0.000000 },
-	{ -0.033831, -0.051851, 0.107479, 0.496443, -0.766011, 0.408376, -0.473492, -0.633248, -0.612211, 1.000000, 0.058560, 0.245500, 1, 12, 1, 1, 0.903830, 0.096170, 0.000000, 0.000000 },
-	{ -0.031046, -0.053251, 0.103000, 0.565824, -0.585935, 0.580107, -0.334627, -0.806203, -0.487915, 1.000000, 0.064310, 0.232530, 1, 12, 1, 1, 0.853850, 0.146150, 0.000000, 0.000000 },
-	{ -0.031961, -0.050029, 0.107958, 0.695644, -0.615857, 0.369864, -0.350180, -0.740242, -0.573948, 1.000000, 0.053360, 0.242260, 1, 12, 1, 1, 0.920296, 0.079704, 0.000000, 0.000000 },
-	{ -0.036193, -0.051402, 0.112799, 0.379533, -0.908179, 0.176541, -0.590538, -0.384693, -0.709419, 1.000000, 0.048520, 0.257970, 1, 12, 1, 1, 0.978455, 0.021545, 0.000000, 0.000000 },
-	{ -0.034432, -0.050342, 0.113385, 0.581357, -0.795288, 0.171877, -0.460567, -0.495793, -0.736252, 1.000000, 0.044190, 0.255550, 1, 12, 1, 1, 0.977074, 0.022926, 0.000000, 0.000000 },
-	{ -0.036655, -0.051136, 0.118942, 0.408071, -0.911877, 0.044267, -0.465553, -0.249558, -0.849107, 1.000000, 0.034230, 0.266840, 1, 12, 1, 1, 0.993126, 0.006874, 0.000000, 0.000000 },
-	{ -0.035157, -0.050268, 0.119378, 0.590085, -0.805480, 0.054786, -0.392338, -0.345406, -0.852505, 1.000000, 0.030620, 0.263570, 1, 12, 1, 1, 0.983921, 0.016079, 0.000000, 0.000000 },
-	{ -0.032629, -0.048576, 0.113853, 0.750802, -0.640476, 0.161515, -0.324989, -0.571071, -0.753830, 1.000000, 0.039420, 0.252040, 1, 12, 1, 1, 0.976217, 0.023783, 0.000000, 0.000000 },
-	{ -0.033568, -0.048874, 0.119714, 0.735798, -0.674688, 0.058280, -0.309030, -0.411101, -0.857611, 1.000000, 0.026130, 0.259580, 1, 12, 1, 1, 0.984131, 0.015869, 0.000000, 0.000000 },
-	{ -0.036926, -0.051201, 0.123625, 0.420577, -0.907190, 0.011059, -0.492592, -0.238570, -0.836921, 1.000000, 0.021500, 0.274680, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.035440, -0.050327, 0.123939, 0.590279, -0.806846, 0.023897, -0.441181, -0.347272, -0.827503, 1.000000, 0.017660, 0.271210, 1, 8, 1, 1, 0.996840, 0.003160, 0.000000, 0.000000 },
-	{ -0.033880, -0.048991, 0.124267, 0.725558, -0.687611, 0.027515, -0.368527, -0.422010, -0.828309, 1.000000, 0.012630, 0.267130, 1, 8, 1, 1, 0.997266, 0.002734, 0.000000, 0.000000 },
-	{ -0.036808, -0.057245, 0.101056, 0.040304, -0.795100, 0.605138, -0.617274, -0.496053, -0.610659, 1.000000, 0.079900, 0.240520, 1, 12, 1, 1, 0.778017, 0.221983, 0.000000, 0.000000 },
-	{ -0.036705, -0.061298, 0.096221, -0.023997, -0.812556, 0.582390, -0.592414, -0.457697, -0.662993, 1.000000, 0.093440, 0.231670, 1, 12, 1, 1, 0.647766, 0.352234, 0.000000, 0.000000 },
-	{ -0.037392, -0.053747, 0.106246, 0.145681, -0.886754, 0.438685, -0.628514, -0.425391, -0.651162, 1.000000, 0.066520, 0.249730, 1, 12, 1, 1, 0.875895, 0.124105, 0.000000, 0.000000 },
-	{ -0.037898, -0.051998, 0.112107, 0.214071, -0.958730, 0.187110, -0.660571, -0.283195, -0.695303, 1.000000, 0.052760, 0.259660, 1, 12, 1, 1, 0.971250, 0.028750, 0.000000, 0.000000 },
-	{ -0.038175, -0.051625, 0.118349, 0.236120, -0.971012, 0.037197, -0.532157, -0.161243, -0.831149, 1.000000, 0.037720, 0.269660, 1, 12, 1, 1, 0.996895, 0.003105, 0.000000, 0.000000 },
-	{ -0.038423, -0.051716, 0.123261, 0.249886, -0.968269, -0.003637, -0.517415, -0.130355, -0.845748, 1.000000, 0.024800, 0.277910, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.038983, -0.061650, 0.095310, -0.155823, -0.819684, 0.551214, -0.590360, -0.370120, -0.717277, 1.000000, 0.097720, 0.234270, 1, 12, 1, 1, 0.620006, 0.379994, 0.000000, 0.000000 },
-	{ -0.039495, -0.064577, 0.090131, -0.184105, -0.875195, 0.447369, -0.599268, -0.260823, -0.756868, 1.000000, 0.110470, 0.227820, 12, 1, 1, 1, 0.514807, 0.485193, 0.000000, 0.000000 },
-	{ -0.036963, -0.064402, 0.091154, -0.036085, -0.885079, 0.464041, -0.602149, -0.351330, -0.716927, 1.000000, 0.105460, 0.225060, 1, 12, 1, 1, 0.514099, 0.485901, 0.000000, 0.000000 },
-	{ -0.037388, -0.066874, 0.085648, -0.032996, -0.923332, 0.382582, -0.613796, -0.283379, -0.736852, 1.000000, 0.118860, 0.218170, 12, 1, 1, 1, 0.611344, 0.388656, 0.000000, 0.000000 },
-	{ -0.040214, -0.066997, 0.084527, -0.206030, -0.903422, 0.376006, -0.599138, -0.187344, -0.778419, 1.000000, 0.123840, 0.221270, 12, 1, 1, 1, 0.646192, 0.353808, 0.000000, 0.000000 },
-	{ -0.039249, -0.054380, 0.105459, 0.055111, -0.896198, 0.440218, -0.616303, -0.377411, -0.691182, 1.000000, 0.070080, 0.251510, 1, 12, 1, 1, 0.860453, 0.139547, 0.000000, 0.000000 },
-	{ -0.038808, -0.057832, 0.100237, -0.074156, -0.811010, 0.580314, -0.605152, -0.425932, -0.672587, 1.000000, 0.084010, 0.242460, 1, 12, 1, 1, 0.756282, 0.243718, 0.000000, 0.000000 },
-	{ -0.043038, -0.066638, 0.083152, -0.384034, -0.855147, 0.348198, -0.518024, -0.112618, -0.847920, 1.000000, 0.129720, 0.224770, 12, 1, 1, 1, 0.685678, 0.314322, 0.000000, 0.000000 },
-	{ -0.042189, -0.064388, 0.088869, -0.337038, -0.842844, 0.419548, -0.534110, -0.195804, -0.822428, 1.000000, 0.116310, 0.231220, 12, 1, 1, 1, 0.543822, 0.456178, 0.000000, 0.000000 },
-	{ -0.041493, -0.061735, 0.094160, -0.279794, -0.814871, 0.507643, -0.542860, -0.301834, -0.783709, 1.000000, 0.103210, 0.237610, 1, 12, 1, 1, 0.599496, 0.400504, 0.000000, 0.000000 },
-	{ -0.041046, -0.058239, 0.099202, -0.170337, -0.823422, 0.541260, -0.533752, -0.384626, -0.753108, 1.000000, 0.088930, 0.245250, 1, 12, 1, 1, 0.741390, 0.258610, 0.000000, 0.000000 },
-	{ -0.041314, -0.054965, 0.104506, -0.013036, -0.904254, 0.426795, -0.541874, -0.352334, -0.763042, 1.000000, 0.074680, 0.253860, 1, 12, 1, 1, 0.850871, 0.149129, 0.000000, 0.000000 },
-	{ -0.039685, -0.052440, 0.111307, 0.135846, -0.968788, 0.207355, -0.659402, -0.244617, -0.710881, 1.000000, 0.056800, 0.261330, 1, 12, 1, 1, 0.951581, 0.048419, 0.000000, 0.000000 },
-	{ -0.039835, -0.051898, 0.117567, 0.146869, -0.988138, 0.044856, -0.592024, -0.124141, -0.796302, 1.000000, 0.041590, 0.272240, 1, 12, 1, 1, 0.991251, 0.008749, 0.000000, 0.000000 },
-	{ -0.040035, -0.051988, 0.122716, 0.147056, -0.989086, -0.009197, -0.532810, -0.071377, -0.843220, 1.000000, 0.028280, 0.281160, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.041712, -0.052925, 0.110381, 0.100836, -0.969203, 0.224675, -0.611757, -0.238490, -0.754239, 1.000000, 0.061290, 0.263560, 1, 12, 1, 1, 0.936113, 0.063887, 0.000000, 0.000000 },
-	{ -0.041790, -0.052154, 0.116646, 0.127977, -0.989714, 0.063941, -0.631420, -0.131024, -0.764291, 1.000000, 0.046260, 0.274870, 1, 12, 1, 1, 0.988583, 0.011417, 0.000000, 0.000000 },
-	{ -0.041909, -0.052189, 0.122067, 0.124306, -0.992244, -0.000948, -0.561860, -0.069601, -0.824299, 1.000000, 0.032360, 0.284900, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057932, -0.015389, 0.078087, -0.945547, 0.324773, -0.021507, 0.084272, 0.180457, -0.979966, 1.000000, 0.191610, 0.392700, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057740, -0.014693, 0.070765, -0.943385, 0.330450, 0.028755, 0.041794, 0.204417, -0.977991, 1.000000, 0.211500, 0.389900, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.056926, -0.012691, 0.077998, -0.923568, 0.383165, -0.014367, 0.094429, 0.190973, -0.977043, 1.000000, 0.192910, 0.401720, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.056656, -0.011783, 0.070636, -0.923534, 0.382058, 0.033423, 0.054309, 0.216551, -0.974760, 1.000000, 0.212840, 0.399320, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057875, -0.014009, 0.063376, -0.939270, 0.338865, 0.054248, 0.008359, 0.180618, -0.983518, 1.000000, 0.231570, 0.387120, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.056672, -0.010840, 0.063177, -0.920096, 0.388072, 0.053135, 0.021097, 0.184556, -0.982596, 1.000000, 0.233070, 0.397040, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.056959, -0.010492, 0.055843, -0.916522, 0.397344, 0.045880, 0.003274, 0.122155, -0.992506, 1.000000, 0.253200, 0.394690, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055531, -0.007430, 0.055635, -0.882387, 0.468757, 0.040752, 0.016158, 0.116747, -0.993030, 1.000000, 0.254500, 0.404230, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055376, -0.007987, 0.063051, -0.886070, 0.460048, 0.056888, 0.034788, 0.188369, -0.981482, 1.000000, 0.234160, 0.405960, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055482, -0.009176, 0.070555, -0.888524, 0.456604, 0.045149, 0.067255, 0.226943, -0.971583, 1.000000, 0.213850, 0.407730, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055826, -0.010296, 0.077935, -0.886451, 0.462823, 0.000709, 0.105221, 0.203021, -0.973505, 1.000000, 0.193930, 0.409750, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055764, -0.007432, 0.048588, -0.877688, 0.479003, 0.014818, 0.017391, 0.062736, -0.997879, 1.000000, 0.274090, 0.402400, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055949, -0.007745, 0.042216, -0.873745, 0.486313, -0.008365, 0.032453, 0.041130, -0.998627, 1.000000, 0.291810, 0.400460, 1, 4, 1, 1, 0.998252, 0.001748, 0.000000, 0.000000 },
-	{ -0.056046, -0.008127, 0.036642, -0.873111, 0.486942, -0.023764, 0.051707, 0.044024, -0.997692, 1.000000, 0.307060, 0.398510, 1, 4, 8, 1, 0.987797, 0.009783, 0.002421, 0.000000 },
-	{ -0.056040, -0.008433, 0.031809, -0.878610, 0.476516, -0.031250, 0.067327, 0.057803, -0.996055, 1.000000, 0.319970, 0.396740, 1, 4, 8, 1, 0.951042, 0.041057, 0.007901, 0.000000 },
-	{ -0.055930, -0.008565, 0.027496, -0.891913, 0.451028, -0.032638, 0.073691, 0.073756, -0.994550, 1.000000, 0.331300, 0.395410, 1, 4, 8, 1, 0.863626, 0.122695, 0.013678, 0.000000 },
-	{ -0.055729, -0.008467, 0.023483, -0.909970, 0.412299, -0.044330, 0.084114, 0.078842, -0.993332, 1.000000, 0.341790, 0.394680, 1, 4, 8, 1, 0.720731, 0.261133, 0.018135, 0.000000 },
-	{ -0.055402, -0.008225, 0.019814, -0.925385, 0.366129, -0.098041, 0.125208, 0.051144, -0.990811, 1.000000, 0.351140, 0.394560, 1, 4, 8, 1, 0.555994, 0.422768, 0.021237, 0.000000 },
-	{ -0.054810, -0.007944, 0.016411, -0.925204, 0.315043, -0.211529, 0.217625, -0.016136, -0.975899, 1.000000, 0.359570, 0.395170, 4, 1, 8, 1, 0.575000, 0.405591, 0.019409, 0.000000 },
-	{ -0.053739, -0.007700, 0.012932, -0.907775, 0.256981, -0.331520, 0.316263, -0.099855, -0.943402, 1.000000, 0.368430, 0.396550, 4, 1, 8, 1, 0.718435, 0.266088, 0.015478, 0.000000 },
-	{ -0.050480, -0.030670, -0.033788, -0.538317, 0.674360, -0.505425, 0.622750, -0.085763, -0.777706, 1.000000, 0.489980, 0.308910, 9, 8, 1, 1, 0.818599, 0.181401, 0.000000, 0.000000 },
-	{ -0.052211, -0.033235, -0.034162, -0.759173, 0.333553, -0.558927, 0.576242, -0.054866, -0.815435, 1.000000, 0.488150, 0.301490, 9, 8, 1, 1, 0.799075, 0.200925, 0.000000, 0.000000 },
-	{ -0.049284, -0.034602, -0.038370, -0.728379, 0.307461, -0.612317, 0.635294, -0.031680, -0.771620, 1.000000, 0.501350, 0.298230, 9, 8, 1, 1, 0.914931, 0.085069, 0.000000, 0.000000 },
-	{ -0.047633, -0.032112, -0.038081, -0.544740, 0.620283, -0.564365, 0.678593, -0.069363, -0.731232, 1.000000, 0.503820, 0.305730, 9, 8, 1, 1, 0.935890, 0.064110, 0.000000, 0.000000 },
-	{ -0.045589, -0.030600, -0.037528, -0.357578, 0.808838, -0.466819, 0.687011, -0.110762, -0.718156, 1.000000, 0.506890, 0.312270, 9, 8, 1, 1, 0.924713, 0.075287, 0.000000, 0.000000 },
-	{ -0.048225, -0.029262, -0.033016, -0.320567, 0.859406, -0.398319, 0.631980, -0.119184, -0.765766, 1.000000, 0.492410, 0.315530, 9, 8, 1, 1, 0.793628, 0.206372, 0.000000, 0.000000 },
-	{ -0.050100, -0.038015, -0.038149, -0.806212, 0.031967, -0.590762, 0.590268, -0.024168, -0.806846, 1.000000, 0.498760, 0.286640, 9, 8, 1, 1, 0.919975, 0.080025, 0.000000, 0.000000 },
-	{ -0.053145, -0.036873, -0.033888, -0.845075, 0.041128, -0.533064, 0.530734, -0.055885, -0.845694, 1.000000, 0.485290, 0.289760, 9, 8, 1, 1, 0.817467, 0.182533, 0.000000, 0.000000 },
-	{ -0.053203, -0.040521, -0.033168, -0.854405, -0.214023, -0.473484, 0.484798, -0.000432, -0.874626, 1.000000, 0.482690, 0.277610, 9, 8, 1, 1, 0.743648, 0.256352, 0.000000, 0.000000 },
-	{ -0.050125, -0.041378, -0.037600, -0.815543, -0.215491, -0.537078, 0.547013, 0.015813, -0.836975, 1.000000, 0.496970, 0.275010, 9, 8, 1, 1, 0.917066, 0.082934, 0.000000, 0.000000 },
-	{ -0.052417, -0.043132, -0.032408, -0.778003, -0.515550, -0.359054, 0.406468, 0.022733, -0.913382, 1.000000, 0.482040, 0.271140, 9, 8, 1, 1, 0.742338, 0.257662, 0.000000, 0.000000 },
-	{ -0.049340, -0.043881, -0.036961, -0.752481, -0.498638, -0.430270, 0.481162, 0.029889, -0.876122, 1.000000, 0.496500, 0.268180, 9, 8, 1, 1, 0.916609, 0.083391, 0.000000, 0.000000 },
-	{ -0.052220, -0.029796, -0.030281, -0.585708, 0.725649, -0.361082, 0.473384, -0.055354, -0.879115, 1.000000, 0.481000, 0.310680, 9, 8, 1, 1, 0.632835, 0.367165, 0.000000, 0.000000 },
-	{ -0.053938, -0.032362, -0.030769, -0.838373, 0.371828, -0.398591, 0.416274, -0.035358, -0.908552, 1.000000, 0.480060, 0.303470, 9, 8, 1, 1, 0.651299, 0.348701, 0.000000, 0.000000 },
-	{ -0.049937, -0.028435, -0.029215, -0.333679, 0.898841, -0.284152, 0.514163, -0.079113, -0.854036, 1.000000, 0.481880, 0.317780, 9, 8, 1, 1, 0.572536, 0.427464, 0.000000, 0.000000 },
-	{ -0.054244, -0.042358, -0.028644, -0.841537, -0.499374, -0.206012, 0.234238, 0.006322, -0.972159, 1.000000, 0.472330, 0.273350, 9, 8, 1, 1, 0.528176, 0.471824, 0.000000, 0.000000 },
-	{ -0.054986, -0.039744, -0.029602, -0.932500, -0.184767, -0.310329, 0.314237, 0.008503, -0.949307, 1.000000, 0.474180, 0.279740, 9, 8, 1, 1, 0.540149, 0.459851, 0.000000, 0.000000 },
-	{ -0.054907, -0.036050, -0.030474, -0.926593, 0.073093, -0.368895, 0.366866, -0.039963, -0.929415, 1.000000, 0.477570, 0.291640, 9, 8, 1, 1, 0.667854, 0.332146, 0.000000, 0.000000 },
-	{ -0.044230, -0.033750, -0.043109, -0.586496, 0.575424, -0.570009, 0.667900, -0.054514, -0.742252, 1.000000, 0.520990, 0.301180, 9, 10, 8, 1, 0.977107, 0.012583, 0.010310, 0.000000 },
-	{ -0.042520, -0.032165, -0.042547, -0.409147, 0.769341, -0.490625, 0.687940, -0.093153, -0.719765, 1.000000, 0.523060, 0.307810, 9, 8, 10, 1, 0.979031, 0.011290, 0.009678, 0.000000 },
-	{ -0.041133, -0.035360, -0.048098, -0.636344, 0.526029, -0.564234, 0.651405, -0.025367, -0.758306, 1.000000, 0.537420, 0.296410, 9, 10, 1, 1, 0.910127, 0.089873, 0.000000, 0.000000 },
-	{ -0.039665, -0.033707, -0.047424, -0.447136, 0.745624, -0.494080, 0.691722, -0.061957, -0.719501, 1.000000, 0.538370, 0.303000, 9, 10, 1, 1, 0.916251, 0.083749, 0.000000, 0.000000 },
-	{ -0.042345, -0.037918, -0.048319, -0.762960, 0.269799, -0.587453, 0.601619, -0.036157, -0.797964, 1.000000, 0.535490, 0.288500, 9, 10, 1, 1, 0.915944, 0.084056, 0.000000, 0.000000 },
-	{ -0.045662, -0.036191, -0.043370, -0.739650, 0.293236, -0.605748, 0.626774, -0.027651, -0.778711, 1.000000, 0.518820, 0.293400, 9, 8, 10, 1, 0.975001, 0.014284, 0.010715, 0.000000 },
-	{ -0.042922, -0.040704, -0.048248, -0.822248, 0.025380, -0.568563, 0.567947, -0.027760, -0.822597, 1.000000, 0.533290, 0.277290, 9, 10, 1, 1, 0.925638, 0.074362, 0.000000, 0.000000 },
-	{ -0.046404, -0.039360, -0.043173, -0.809626, 0.032771, -0.586030, 0.585893, -0.014642, -0.810256, 1.000000, 0.516590, 0.282140, 9, 8, 10, 1, 0.977901, 0.011735, 0.010364, 0.000000 },
-	{ -0.042901, -0.043447, -0.047798, -0.825385, -0.223413, -0.518484, 0.523948, 0.038933, -0.850860, 1.000000, 0.531630, 0.267270, 9, 10, 1, 1, 0.931104, 0.068896, 0.000000, 0.000000 },
-	{ -0.046443, -0.042431, -0.042676, -0.817572, -0.215596, -0.533942, 0.540749, 0.031229, -0.840604, 1.000000, 0.514770, 0.271670, 9, 8, 10, 1, 0.981248, 0.010548, 0.008204, 0.000000 },
-	{ -0.042335, -0.045868, -0.046977, -0.773155, -0.463916, -0.432450, 0.474800, 0.028669, -0.879627, 1.000000, 0.530810, 0.260560, 9, 10, 1, 1, 0.916779, 0.083221, 0.000000, 0.000000 },
-	{ -0.045746, -0.044795, -0.042017, -0.762043, -0.476306, -0.438662, 0.482793, 0.033510, -0.875093, 1.000000, 0.513910, 0.264720, 9, 8, 10, 1, 0.978963, 0.011743, 0.009293, 0.000000 },
-	{ -0.038308, -0.032692, -0.046690, -0.295039, 0.854059, -0.428411, 0.718428, -0.097311, -0.688762, 1.000000, 0.539290, 0.308120, 9, 10, 1, 1, 0.944501, 0.055499, 0.000000, 0.000000 },
-	{ -0.040979, -0.031217, -0.041942, -0.263392, 0.870961, -0.414790, 0.702594, -0.121444, -0.701152, 1.000000, 0.524650, 0.312710, 9, 8, 10, 1, 0.983747, 0.011912, 0.004340, 0.000000 },
-	{ -0.037075, -0.032142, -0.046159, -0.168968, 0.916441, -0.362747, 0.733757, -0.128766, -0.667099, 1.000000, 0.540810, 0.311650, 9, 10, 1, 1, 0.959686, 0.040314, 0.000000, 0.000000 },
-	{ -0.039686, -0.030738, -0.041401, -0.122717, 0.932946, -0.338458, 0.711549, -0.155028, -0.685320, 1.000000, 0.525890, 0.316360, 9, 8, 10, 1, 0.984044, 0.009030, 0.006926, 0.000000 },
-	{ -0.035967, -0.031876, -0.045775, -0.047535, 0.956832, -0.286727, 0.733586, -0.161380, -0.660158, 1.000000, 0.542390, 0.314470, 9, 10, 1, 1, 0.935440, 0.064560, 0.000000, 0.000000 },
-	{ -0.038566, -0.030543, -0.040958, 0.016396, 0.966333, -0.256773, 0.723874, -0.188625, -0.663646, 1.000000, 0.527170, 0.319300, 9, 8, 10, 1, 0.981476, 0.009332, 0.009191, 0.000000 },
-	{ -0.034895, -0.031773, -0.045372, 0.078409, 0.976448, -0.201001, 0.735777, -0.192725, -0.649222, 1.000000, 0.543920, 0.317210, 9, 10, 1, 1, 0.917393, 0.082607, 0.000000, 0.000000 },
-	{ -0.037361, -0.030535, -0.040448, 0.139686, 0.974191, -0.177315, 0.715737, -0.223079, -0.661783, 1.000000, 0.528610, 0.322160, 9, 10, 8, 1, 0.978904, 0.014342, 0.006753, 0.000000 },
-	{ -0.036126, -0.030690, -0.039795, 0.254625, 0.962008, -0.098523, 0.696201, -0.253069, -0.671759, 1.000000, 0.530040, 0.325750, 9, 10, 8, 1, 0.967763, 0.022670, 0.009567, 0.000000 },
-	{ -0.033565, -0.031837, -0.044742, 0.204782, 0.972360, -0.112162, 0.729231, -0.227999, -0.645166, 1.000000, 0.545540, 0.320630, 9, 10, 1, 1, 0.884441, 0.115559, 0.000000, 0.000000 },
-	{ -0.034632, -0.031107, -0.038864, 0.391541, 0.920160, -0.001413, 0.682770, -0.291557, -0.669940, 1.000000, 0.531530, 0.330500, 9, 10, 8, 1, 0.965741, 0.025531, 0.008728, 0.000000 },
-	{ -0.032034, -0.032168, -0.043909, 0.350678, 0.936457, -0.008599, 0.708444, -0.271276, -0.651549, 1.000000, 0.547450, 0.325170, 9, 10, 1, 1, 0.879822, 0.120178, 0.000000, 0.000000 },
-	{ -0.037235, -0.029909, -0.033331, 0.444051, 0.895937, 0.010803, 0.643576, -0.310539, -0.699553, 1.000000, 0.513680, 0.336330, 9, 8, 10, 1, 0.941662, 0.055455, 0.002883, 0.000000 },
-	{ -0.038720, -0.029401, -0.034390, 0.301588, 0.949452, -0.087102, 0.662295, -0.274336, -0.697212, 1.000000, 0.512760, 0.331300, 9, 8, 10, 1, 0.932829, 0.066006, 0.001165, 0.000000 },
-	{ -0.040790, -0.028249, -0.029639, 0.326109, 0.942390, -0.074521, 0.601083, -0.267552, -0.753071, 1.000000, 0.498040, 0.335680, 9, 8, 1, 1, 0.791982, 0.208018, 0.000000, 0.000000 },
-	{ -0.039276, -0.028874, -0.028595, 0.488852, 0.872171, 0.018475, 0.575288, -0.306384, -0.758401, 1.000000, 0.498820, 0.340810, 9, 8, 1, 1, 0.792729, 0.207271, 0.000000, 0.000000 },
-	{ -0.042137, -0.027981, -0.030454, 0.196870, 0.970491, -0.139248, 0.627824, -0.233878, -0.742387, 1.000000, 0.497310, 0.331530, 9, 8, 1, 1, 0.773014, 0.226986, 0.000000, 0.000000 },
-	{ -0.039998, -0.029189, -0.035219, 0.183407, 0.969911, -0.160107, 0.679015, -0.242766, -0.692823, 1.000000, 0.512080, 0.327300, 9, 8, 10, 1, 0.933526, 0.065209, 0.001265, 0.000000 },
-	{ -0.042172, -0.027515, -0.025854, 0.326543, 0.942264, -0.074221, 0.527747, -0.246909, -0.812724, 1.000000, 0.487280, 0.338590, 9, 8, 1, 1, 0.533832, 0.466168, 0.000000, 0.000000 },
-	{ -0.043629, -0.027197, -0.026506, 0.190004, 0.974391, -0.120253, 0.550329, -0.207135, -0.808847, 1.000000, 0.485970, 0.334510, 9, 8, 1, 1, 0.540914, 0.459086, 0.000000, 0.000000 },
-	{ -0.040555, -0.028177, -0.025021, 0.507544, 0.861506, -0.014403, 0.494760, -0.305085, -0.813718, 1.000000, 0.488620, 0.343530, 9, 8, 1, 1, 0.505980, 0.494020, 0.000000, 0.000000 },
-	{ -0.044967, -0.027098, -0.027058, 0.051734, 0.984983, -0.164721, 0.562396, -0.165035, -0.810231, 1.000000, 0.484870, 0.331120, 9, 8, 1, 1, 0.521307, 0.478693, 0.000000, 0.000000 },
-	{ -0.043462, -0.027904, -0.031120, 0.066933, 0.977781, -0.198657, 0.641424, -0.194677, -0.742076, 1.000000, 0.496430, 0.328140, 9, 8, 1, 1, 0.777634, 0.222366, 0.000000, 0.000000 },
-	{ -0.041184, -0.029141, -0.035826, 0.059566, 0.971160, -0.230867, 0.692430, -0.206788, -0.691215, 1.000000, 0.511070, 0.324120, 9, 8, 1, 1, 0.946889, 0.053111, 0.000000, 0.000000 },
-	{ -0.046267, -0.027220, -0.027573, -0.103719, 0.972047, -0.210635, 0.562667, -0.117286, -0.818321, 1.000000, 0.483920, 0.327940, 9, 8, 1, 1, 0.503604, 0.496396, 0.000000, 0.000000 },
-	{ -0.044685, -0.028029, -0.031657, -0.085195, 0.960465, -0.265046, 0.639604, -0.151248, -0.753678, 1.000000, 0.495500, 0.325020, 9, 8, 1, 1, 0.751373, 0.248627, 0.000000, 0.000000 },
-	{ -0.042359, -0.029287, -0.036350, -0.089239, 0.946536, -0.310010, 0.695699, -0.163504, -0.699478, 1.000000, 0.510020, 0.321100, 9, 8, 1, 1, 0.926314, 0.073686, 0.000000, 0.000000 },
-	{ -0.047865, -0.027639, -0.028246, -0.217787, 0.944846, -0.244613, 0.545050, -0.090164, -0.833542, 1.000000, 0.482920, 0.323800, 9, 8, 1, 1, 0.515511, 0.484489, 0.000000, 0.000000 },
-	{ -0.046213, -0.028450, -0.032280, -0.205402, 0.923125, -0.325041, 0.635557, -0.126743, -0.761580, 1.000000, 0.494360, 0.321070, 9, 8, 1, 1, 0.761922, 0.238078, 0.000000, 0.000000 },
-	{ -0.043770, -0.029724, -0.036936, -0.225884, 0.894868, -0.384952, 0.692232, -0.130589, -0.709762, 1.000000, 0.508940, 0.317320, 9, 8, 1, 1, 0.922363, 0.077637, 0.000000, 0.000000 },
-	{ -0.047296, -0.026608, -0.023842, -0.122928, 0.974164, -0.189458, 0.500647, -0.103960, -0.859387, 1.000000, 0.474140, 0.330550, 8, 9, 1, 1, 0.740340, 0.259660, 0.000000, 0.000000 },
-	{ -0.045942, -0.026479, -0.023422, 0.038116, 0.986164, -0.161331, 0.502427, -0.158470, -0.849973, 1.000000, 0.475260, 0.333740, 8, 9, 1, 1, 0.725537, 0.274463, 0.000000, 0.000000 },
-	{ -0.044591, -0.026579, -0.022985, 0.187494, 0.973541, -0.130633, 0.486628, -0.207586, -0.848588, 1.000000, 0.476440, 0.337080, 8, 9, 1, 1, 0.734459, 0.265541, 0.000000, 0.000000 },
-	{ -0.043082, -0.026905, -0.022466, 0.320877, 0.941614, -0.101987, 0.464547, -0.250308, -0.849436, 1.000000, 0.477940, 0.341060, 8, 9, 1, 1, 0.766098, 0.233902, 0.000000, 0.000000 },
-	{ -0.041372, -0.027541, -0.021792, 0.493494, 0.866777, -0.071845, 0.430055, -0.314978, -0.846074, 1.000000, 0.479580, 0.345950, 8, 9, 1, 1, 0.783938, 0.216062, 0.000000, 0.000000 },
-	{ -0.047983, -0.025938, -0.019945, -0.136580, 0.972574, -0.188272, 0.462320, -0.105508, -0.880414, 1.000000, 0.464250, 0.333530, 8, 9, 1, 1, 0.898949, 0.101051, 0.000000, 0.000000 },
-	{ -0.049653, -0.026364, -0.020319, -0.294383, 0.936286, -0.191591, 0.432127, -0.048403, -0.900513, 1.000000, 0.462540, 0.329530, 8, 9, 1, 1, 0.925756, 0.074244, 0.000000, 0.000000 },
-	{ -0.050212, -0.025525, -0.015397, -0.313496, 0.928495, -0.199044, 0.418870, -0.052903, -0.906504, 1.000000, 0.450090, 0.333550, 8, 9, 1, 1, 0.991339, 0.008661, 0.000000, 0.000000 },
-	{ -0.048401, -0.025118, -0.015437, -0.142626, 0.969794, -0.197883, 0.448801, -0.114826, -0.886224, 1.000000, 0.452890, 0.337530, 8, 9, 1, 1, 0.980432, 0.019568, 0.000000, 0.000000 },
-	{ -0.046550, -0.025826, -0.019687, 0.031641, 0.984403, -0.173061, 0.466590, -0.167671, -0.868436, 1.000000, 0.465800, 0.336770, 8, 9, 1, 1, 0.910165, 0.089835, 0.000000, 0.000000 },
-	{ -0.046842, -0.025041, -0.015424, 0.030216, 0.980597, -0.193693, 0.456098, -0.185958, -0.870284, 1.000000, 0.455200, 0.340800, 8, 9, 1, 1, 0.983519, 0.016481, 0.000000, 0.000000 },
-	{ -0.046742, -0.024046, -0.010719, 0.030829, 0.974236, -0.223416, 0.475115, -0.210938, -0.854266, 1.000000, 0.443760, 0.346240, 8, 9, 1, 1, 0.998223, 0.001777, 0.000000, 0.000000 },
-	{ -0.046262, -0.022920, -0.006107, 0.024727, 0.968507, -0.247757, 0.556074, -0.219279, -0.801685, 1.000000, 0.433760, 0.353030, 8, 4, 1, 1, 0.998302, 0.001698, 0.000000, 0.000000 },
-	{ -0.048106, -0.022833, -0.005423, -0.131162, 0.964069, -0.231012, 0.547400, -0.123851, -0.827656, 1.000000, 0.429110, 0.350180, 8, 4, 1, 1, 0.998090, 0.001910, 0.000000, 0.000000 },
-	{ -0.048445, -0.024064, -0.010420, -0.139281, 0.965627, -0.219467, 0.470676, -0.130437, -0.872611, 1.000000, 0.440450, 0.342970, 8, 9, 1, 1, 0.998999, 0.001001, 0.000000, 0.000000 },
-	{ -0.050428, -0.022958, -0.004146, -0.275341, 0.935158, -0.222860, 0.499417, -0.058943, -0.864354, 1.000000, 0.421970, 0.346630, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050477, -0.024375, -0.009796, -0.302318, 0.927183, -0.221214, 0.443728, -0.068504, -0.893540, 1.000000, 0.435710, 0.339090, 8, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.048912, -0.027042, -0.024442, -0.253447, 0.946048, -0.201884, 0.476850, -0.059395, -0.876976, 1.000000, 0.472980, 0.326440, 8, 9, 1, 1, 0.743869, 0.256131, 0.000000, 0.000000 },
-	{ -0.050916, -0.027880, -0.025462, -0.390824, 0.897976, -0.202226, 0.425888, -0.018357, -0.904590, 1.000000, 0.472470, 0.320290, 8, 9, 1, 1, 0.697855, 0.302145, 0.000000, 0.000000 },
-	{ -0.053117, -0.029280, -0.026678, -0.639662, 0.736558, -0.219805, 0.348223, 0.022753, -0.937136, 1.000000, 0.472930, 0.312540, 8, 9, 1, 1, 0.618222, 0.381778, 0.000000, 0.000000 },
-	{ -0.054841, -0.031753, -0.027293, -0.888043, 0.398441, -0.229399, 0.260323, 0.024493, -0.965211, 1.000000, 0.472510, 0.305160, 8, 9, 1, 1, 0.543427, 0.456573, 0.000000, 0.000000 },
-	{ -0.055753, -0.035362, -0.026982, -0.972445, 0.108009, -0.206602, 0.208242, 0.004013, -0.978069, 1.000000, 0.469860, 0.293570, 8, 9, 1, 1, 0.578487, 0.421513, 0.000000, 0.000000 },
-	{ -0.055875, -0.038979, -0.026050, -0.976324, -0.142524, -0.162723, 0.157919, 0.044466, -0.986450, 1.000000, 0.465870, 0.282060, 8, 9, 1, 1, 0.664932, 0.335068, 0.000000, 0.000000 },
-	{ -0.055192, -0.041508, -0.024997, -0.885612, -0.457222, -0.081482, 0.075317, 0.031729, -0.996655, 1.000000, 0.464030, 0.275900, 8, 9, 1, 1, 0.698548, 0.301452, 0.000000, 0.000000 },
-	{ -0.052896, -0.043985, -0.027806, -0.675530, -0.731198, -0.094915, 0.175583, -0.034502, -0.983860, 1.000000, 0.471430, 0.267840, 8, 9, 1, 1, 0.503105, 0.496895, 0.000000, 0.000000 },
-	{ -0.050965, -0.044806, -0.031744, -0.640608, -0.733402, -0.227470, 0.337088, -0.002433, -0.941470, 1.000000, 0.482350, 0.265020, 9, 8, 1, 1, 0.717334, 0.282666, 0.000000, 0.000000 },
-	{ -0.051513, -0.045019, -0.027191, -0.537637, -0.842956, -0.019286, 0.133974, -0.062822, -0.988992, 1.000000, 0.471300, 0.263410, 8, 9, 1, 1, 0.573753, 0.426247, 0.000000, 0.000000 },
-	{ -0.049583, -0.045875, -0.031240, -0.524985, -0.841690, -0.126289, 0.281719, -0.031829, -0.958969, 1.000000, 0.482620, 0.260450, 9, 8, 1, 1, 0.709518, 0.290482, 0.000000, 0.000000 },
-	{ -0.050216, -0.045659, -0.026732, -0.385776, -0.920890, 0.056020, 0.111624, -0.106862, -0.987988, 1.000000, 0.471230, 0.259810, 8, 9, 1, 1, 0.533161, 0.466839, 0.000000, 0.000000 },
-	{ -0.048376, -0.046520, -0.030793, -0.386287, -0.922126, -0.021599, 0.246804, -0.080768, -0.965694, 1.000000, 0.482690, 0.257070, 9, 8, 1, 1, 0.756940, 0.243060, 0.000000, 0.000000 },
-	{ -0.048827, -0.046034, -0.026291, -0.218283, -0.967467, 0.127903, 0.103924, -0.153363, -0.982690, 1.000000, 0.471020, 0.256160, 9, 8, 1, 1, 0.526039, 0.473961, 0.000000, 0.000000 },
-	{ -0.047113, -0.046902, -0.030320, -0.228256, -0.969851, 0.085365, 0.223311, -0.137495, -0.965001, 1.000000, 0.482770, 0.253570, 9, 8, 1, 1, 0.806567, 0.193433, 0.000000, 0.000000 },
-	{ -0.047028, -0.046177, -0.025710, -0.080705, -0.980316, 0.180188, 0.127129, -0.189425, -0.973631, 1.000000, 0.470710, 0.251500, 9, 8, 1, 1, 0.570718, 0.429282, 0.000000, 0.000000 },
-	{ -0.045236, -0.047084, -0.029529, -0.098464, -0.980345, 0.170964, 0.209911, -0.188394, -0.959399, 1.000000, 0.482470, 0.249280, 9, 8, 1, 1, 0.835573, 0.164427, 0.000000, 0.000000 },
-	{ -0.044520, -0.047794, -0.034961, -0.256913, -0.965947, 0.030693, 0.301773, -0.110353, -0.946972, 1.000000, 0.497950, 0.250530, 9, 8, 10, 1, 0.959203, 0.039230, 0.001567, 0.000000 },
-	{ -0.043164, -0.048045, -0.034336, -0.127015, -0.984149, 0.123770, 0.273760, -0.154716, -0.949273, 1.000000, 0.497770, 0.246290, 9, 8, 10, 1, 0.966163, 0.032010, 0.001828, 0.000000 },
-	{ -0.043380, -0.046959, -0.028685, 0.037115, -0.965277, 0.258579, 0.214735, -0.245009, -0.945442, 1.000000, 0.481510, 0.243430, 9, 8, 1, 1, 0.884787, 0.115213, 0.000000, 0.000000 },
-	{ -0.040888, -0.048062, -0.033216, 0.006621, -0.976077, 0.217326, 0.273143, -0.207301, -0.939372, 1.000000, 0.497300, 0.240530, 9, 8, 10, 1, 0.977679, 0.020143, 0.002179, 0.000000 },
-	{ -0.044962, -0.046006, -0.025014, 0.072831, -0.969693, 0.233220, 0.148319, -0.220711, -0.963996, 1.000000, 0.469900, 0.245650, 9, 8, 1, 1, 0.644142, 0.355858, 0.000000, 0.000000 },
-	{ -0.040212, -0.048938, -0.039159, -0.128481, -0.987964, 0.086137, 0.347285, -0.126180, -0.929232, 1.000000, 0.514050, 0.243070, 9, 10, 8, 1, 0.979656, 0.017047, 0.003297, 0.000000 },
-	{ -0.041537, -0.048655, -0.039788, -0.266345, -0.963841, -0.008383, 0.373147, -0.095088, -0.922887, 1.000000, 0.514020, 0.247430, 9, 10, 8, 1, 0.979454, 0.017040, 0.003507, 0.000000 },
-	{ -0.037024, -0.049632, -0.043558, -0.108599, -0.991226, 0.075346, 0.402373, -0.113138, -0.908458, 1.000000, 0.529520, 0.239780, 9, 10, 1, 1, 0.917075, 0.082925, 0.000000, 0.000000 },
-	{ -0.038395, -0.049398, -0.044238, -0.234682, -0.972064, -0.004016, 0.409583, -0.095136, -0.907299, 1.000000, 0.529290, 0.244230, 9, 10, 1, 1, 0.921099, 0.078901, 0.000000, 0.000000 },
-	{ -0.034810, -0.049666, -0.042488, 0.024174, -0.987455, 0.156042, 0.391574, -0.134263, -0.910298, 1.000000, 0.529560, 0.233930, 9, 10, 1, 1, 0.893582, 0.106418, 0.000000, 0.000000 },
-	{ -0.037792, -0.049027, -0.038024, 0.004160, -0.984699, 0.174213, 0.318175, -0.163857, -0.933764, 1.000000, 0.514120, 0.237230, 9, 10, 8, 1, 0.976828, 0.019692, 0.003480, 0.000000 },
-	{ -0.039521, -0.049008, -0.044862, -0.376963, -0.921100, -0.097333, 0.406442, -0.070073, -0.910985, 1.000000, 0.529170, 0.247850, 9, 10, 1, 1, 0.912675, 0.087325, 0.000000, 0.000000 },
-	{ -0.042634, -0.048214, -0.040359, -0.404692, -0.908238, -0.106439, 0.378489, -0.060404, -0.923633, 1.000000, 0.514250, 0.250940, 9, 10, 8, 1, 0.976716, 0.018851, 0.004432, 0.000000 },
-	{ -0.045669, -0.047368, -0.035495, -0.402304, -0.911971, -0.080383, 0.333981, -0.064445, -0.940374, 1.000000, 0.498100, 0.253970, 9, 8, 10, 1, 0.944233, 0.054371, 0.001396, 0.000000 },
-	{ -0.040485, -0.048410, -0.045493, -0.534796, -0.818382, -0.210345, 0.418160, -0.040010, -0.907492, 1.000000, 0.529370, 0.251170, 9, 10, 1, 1, 0.899356, 0.100644, 0.000000, 0.000000 },
-	{ -0.043629, -0.047546, -0.040893, -0.551779, -0.804109, -0.221243, 0.399577, -0.022042, -0.916435, 1.000000, 0.514480, 0.254280, 9, 10, 8, 1, 0.972370, 0.019491, 0.008139, 0.000000 },
-	{ -0.046768, -0.046697, -0.035981, -0.539783, -0.818801, -0.195447, 0.367183, -0.020087, -0.929932, 1.000000, 0.498330, 0.257350, 9, 8, 1, 1, 0.919069, 0.080931, 0.000000, 0.000000 },
-	{ -0.041401, -0.047429, -0.046181, -0.666764, -0.674882, -0.316165, 0.443337, -0.018171, -0.896171, 1.000000, 0.529990, 0.254880, 9, 10, 1, 1, 0.899198, 0.100802, 0.000000, 0.000000 },
-	{ -0.044668, -0.046463, -0.041405, -0.666187, -0.670292, -0.326961, 0.438214, 0.002927, -0.898866, 1.000000, 0.514130, 0.258400, 9, 10, 8, 1, 0.972928, 0.015001, 0.012071, 0.000000 },
-	{ -0.048025, -0.045592, -0.036427, -0.646399, -0.699466, -0.304820, 0.421109, 0.006096, -0.906990, 1.000000, 0.497690, 0.261820, 9, 8, 1, 1, 0.908009, 0.091991, 0.000000, 0.000000 },
-	{ -0.038491, -0.048404, -0.050296, -0.635241, -0.705121, -0.315078, 0.487936, -0.050184, -0.871436, 1.000000, 0.543100, 0.252120, 9, 10, 1, 1, 0.715953, 0.284047, 0.000000, 0.000000 },
-	{ -0.039348, -0.046953, -0.051255, -0.757443, -0.468717, -0.454516, 0.518264, -0.008239, -0.855181, 1.000000, 0.543980, 0.257170, 9, 10, 1, 1, 0.719853, 0.280147, 0.000000, 0.000000 },
-	{ -0.036735, -0.047716, -0.054469, -0.704126, -0.492741, -0.511286, 0.605369, -0.040226, -0.794928, 1.000000, 0.553600, 0.255280, 10, 9, 1, 1, 0.541371, 0.458629, 0.000000, 0.000000 },
-	{ -0.037198, -0.045062, -0.055552, -0.749100, -0.279627, -0.600548, 0.640695, -0.075365, -0.764087, 1.000000, 0.554730, 0.261850, 10, 9, 1, 1, 0.547122, 0.452878, 0.000000, 0.000000 },
-	{ -0.039798, -0.044359, -0.052298, -0.807862, -0.250385, -0.533541, 0.552350, -0.005859, -0.833592, 1.000000, 0.544980, 0.263610, 9, 10, 1, 1, 0.742277, 0.257723, 0.000000, 0.000000 },
-	{ -0.037504, -0.042773, -0.055979, -0.751563, -0.036032, -0.658677, 0.659562, -0.058436, -0.749376, 1.000000, 0.555960, 0.271280, 10, 9, 1, 1, 0.533721, 0.466279, 0.000000, 0.000000 },
-	{ -0.039951, -0.041924, -0.052687, -0.816955, -0.003675, -0.576690, 0.575911, -0.057517, -0.815486, 1.000000, 0.546740, 0.273380, 9, 10, 1, 1, 0.748269, 0.251731, 0.000000, 0.000000 },
-	{ -0.039581, -0.039429, -0.052581, -0.768354, 0.242563, -0.592280, 0.603147, -0.035172, -0.796855, 1.000000, 0.548420, 0.284400, 9, 10, 1, 1, 0.734548, 0.265452, 0.000000, 0.000000 },
-	{ -0.037287, -0.040349, -0.055811, -0.717499, 0.210859, -0.663878, 0.676263, -0.017530, -0.736452, 1.000000, 0.557240, 0.281810, 10, 9, 1, 1, 0.529149, 0.470851, 0.000000, 0.000000 },
-	{ -0.038525, -0.036614, -0.052372, -0.663006, 0.479529, -0.574870, 0.657138, 0.004955, -0.753754, 1.000000, 0.549780, 0.292560, 9, 10, 1, 1, 0.731745, 0.268255, 0.000000, 0.000000 },
-	{ -0.036261, -0.037412, -0.055530, -0.633985, 0.441825, -0.634708, 0.708121, 0.001762, -0.706089, 1.000000, 0.558370, 0.289810, 10, 9, 1, 1, 0.519988, 0.480012, 0.000000, 0.000000 },
-	{ -0.037201, -0.034917, -0.051610, -0.457096, 0.736426, -0.498739, 0.709091, -0.036757, -0.704158, 1.000000, 0.550590, 0.298490, 9, 10, 1, 1, 0.729428, 0.270572, 0.000000, 0.000000 },
-	{ -0.035027, -0.035781, -0.054796, -0.439418, 0.723847, -0.531938, 0.746026, -0.035778, -0.664955, 1.000000, 0.559540, 0.295420, 9, 10, 1, 1, 0.518887, 0.481113, 0.000000, 0.000000 },
-	{ -0.033737, -0.034791, -0.053945, -0.295510, 0.844921, -0.445851, 0.760614, -0.074301, -0.644939, 1.000000, 0.560810, 0.300600, 10, 9, 1, 1, 0.530992, 0.469008, 0.000000, 0.000000 },
-	{ -0.035898, -0.033885, -0.050728, -0.303777, 0.848526, -0.433271, 0.736830, -0.079059, -0.671440, 1.000000, 0.551280, 0.303940, 9, 10, 1, 1, 0.758592, 0.241408, 0.000000, 0.000000 },
-	{ -0.032585, -0.034139, -0.053245, -0.212748, 0.893443, -0.395598, 0.773168, -0.093626, -0.627252, 1.000000, 0.562200, 0.304740, 9, 10, 1, 1, 0.567863, 0.432137, 0.000000, 0.000000 },
-	{ -0.034710, -0.033269, -0.050123, -0.203274, 0.901574, -0.381896, 0.751230, -0.106542, -0.651385, 1.000000, 0.552810, 0.307710, 9, 10, 1, 1, 0.835248, 0.164752, 0.000000, 0.000000 },
-	{ -0.031596, -0.033724, -0.052686, -0.111532, 0.936263, -0.333125, 0.786014, -0.122001, -0.606051, 1.000000, 0.563440, 0.307760, 9, 10, 1, 1, 0.571202, 0.428798, 0.000000, 0.000000 },
-	{ -0.033647, -0.032913, -0.049699, -0.099701, 0.943290, -0.316645, 0.758073, -0.134117, -0.638230, 1.000000, 0.554390, 0.310540, 9, 10, 1, 1, 0.775591, 0.224409, 0.000000, 0.000000 },
-	{ -0.030606, -0.033480, -0.052096, 0.031796, 0.970016, -0.240953, 0.786445, -0.173061, -0.592921, 1.000000, 0.564610, 0.310670, 9, 10, 1, 1, 0.514402, 0.485598, 0.000000, 0.000000 },
-	{ -0.032609, -0.032711, -0.049219, 0.035326, 0.973502, -0.225933, 0.757276, -0.173599, -0.629600, 1.000000, 0.555670, 0.313350, 9, 10, 1, 1, 0.740248, 0.259752, 0.000000, 0.000000 },
-	{ -0.031358, -0.032698, -0.048557, 0.179470, 0.975452, -0.127607, 0.751091, -0.219638, -0.622593, 1.000000, 0.557200, 0.316850, 9, 10, 1, 1, 0.704247, 0.295753, 0.000000, 0.000000 },
-	{ -0.029401, -0.033455, -0.051361, 0.186186, 0.973169, -0.135191, 0.782294, -0.230082, -0.578859, 1.000000, 0.566220, 0.314220, 10, 9, 1, 1, 0.509828, 0.490172, 0.000000, 0.000000 },
-	{ -0.027835, -0.033787, -0.050412, 0.350268, 0.936525, -0.015300, 0.771619, -0.297774, -0.562081, 1.000000, 0.568650, 0.318690, 10, 9, 1, 1, 0.529744, 0.470256, 0.000000, 0.000000 },
-	{ -0.029769, -0.033010, -0.047706, 0.339001, 0.940614, -0.017988, 0.741813, -0.279014, -0.609807, 1.000000, 0.559470, 0.321300, 9, 10, 1, 1, 0.680768, 0.319232, 0.000000, 0.000000 },
-	{ -0.025942, -0.034503, -0.052842, 0.367420, 0.930049, -0.003275, 0.802217, -0.318697, -0.504856, 1.000000, 0.577100, 0.316130, 10, 9, 1, 1, 0.712506, 0.287494, 0.000000, 0.000000 },
-	{ -0.027357, -0.034207, -0.053929, 0.208945, 0.969465, -0.128376, 0.818836, -0.245209, -0.519019, 1.000000, 0.575120, 0.311680, 10, 9, 1, 1, 0.714079, 0.285921, 0.000000, 0.000000 },
-	{ -0.023580, -0.035480, -0.055663, 0.407520, 0.913127, 0.011234, 0.825423, -0.363060, -0.432279, 1.000000, 0.587230, 0.312650, 10, 9, 1, 1, 0.888981, 0.111019, 0.000000, 0.000000 },
-	{ -0.024815, -0.035185, -0.056933, 0.254223, 0.961401, -0.105262, 0.855621, -0.274310, -0.438939, 1.000000, 0.585700, 0.308050, 10, 9, 1, 1, 0.893052, 0.106948, 0.000000, 0.000000 },
-	{ -0.020397, -0.036892, -0.059330, 0.456388, 0.888714, 0.043569, 0.849433, -0.420592, -0.318695, 1.000000, 0.600700, 0.307060, 10, 9, 1, 1, 0.982003, 0.017997, 0.000000, 0.000000 },
-	{ -0.021489, -0.036480, -0.060739, 0.315338, 0.946706, -0.065643, 0.892965, -0.319428, -0.317144, 1.000000, 0.598920, 0.302420, 10, 9, 1, 1, 0.982714, 0.017286, 0.000000, 0.000000 },
-	{ -0.025787, -0.035192, -0.057938, 0.110336, 0.972188, -0.206584, 0.864063, -0.196541, -0.463430, 1.000000, 0.584520, 0.304420, 10, 9, 1, 1, 0.890209, 0.109791, 0.000000, 0.000000 },
-	{ -0.022347, -0.036409, -0.061846, 0.170076, 0.969970, -0.173875, 0.912656, -0.221592, -0.343448, 1.000000, 0.597750, 0.298970, 10, 9, 1, 1, 0.983636, 0.016363, 0.000000, 0.000000 },
-	{ -0.028476, -0.034225, -0.054782, 0.062058, 0.970594, -0.232585, 0.821954, -0.181890, -0.539729, 1.000000, 0.573620, 0.308070, 10, 9, 1, 1, 0.703821, 0.296179, 0.000000, 0.000000 },
-	{ -0.017882, -0.038015, -0.064865, 0.409358, 0.909991, -0.065890, 0.907025, -0.413705, -0.078451, 1.000000, 0.613170, 0.294430, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016858, -0.038530, -0.063493, 0.535594, 0.843379, 0.043017, 0.844140, -0.533250, -0.055431, 1.000000, 0.616110, 0.298060, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015216, -0.039811, -0.067917, 0.607367, 0.771788, -0.188279, 0.774157, -0.521822, 0.358305, 1.000000, 0.622980, 0.285780, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014382, -0.040347, -0.066579, 0.704333, 0.706874, -0.065146, 0.660400, -0.618825, 0.425357, 1.000000, 0.626520, 0.288250, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013172, -0.042816, -0.068239, 0.891809, 0.360981, -0.272709, 0.408698, -0.384312, 0.827811, 1.000000, 0.632230, 0.278020, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013836, -0.042418, -0.069555, 0.822334, 0.394803, -0.409753, 0.555743, -0.402706, 0.727309, 1.000000, 0.628460, 0.277170, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012865, -0.045934, -0.068849, 0.926136, -0.021264, -0.376590, 0.375796, -0.033752, 0.926088, 1.000000, 0.634360, 0.265360, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013551, -0.045750, -0.070128, 0.851020, -0.010623, -0.525025, 0.523912, -0.050953, 0.850247, 1.000000, 0.630590, 0.265880, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014515, -0.042225, -0.070559, 0.735076, 0.415728, -0.535568, 0.673321, -0.355145, 0.648468, 1.000000, 0.625590, 0.276210, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014275, -0.045613, -0.071065, 0.778533, -0.007680, -0.627557, 0.626051, -0.060777, 0.777410, 1.000000, 0.627660, 0.266130, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014904, -0.049097, -0.070912, 0.702995, -0.350981, -0.618555, 0.705687, 0.236215, 0.667989, 1.000000, 0.624940, 0.255490, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014163, -0.049184, -0.069942, 0.782754, -0.367890, -0.501949, 0.606509, 0.270242, 0.747741, 1.000000, 0.627740, 0.254310, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016344, -0.051904, -0.069982, 0.428986, -0.766277, -0.478321, 0.902427, 0.340130, 0.264456, 1.000000, 0.619190, 0.248100, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015588, -0.051914, -0.068894, 0.558596, -0.763325, -0.324509, 0.823614, 0.464170, 0.325894, 1.000000, 0.621360, 0.245920, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014717, -0.051650, -0.067476, 0.661324, -0.728449, -0.178922, 0.714998, 0.540065, 0.443968, 1.000000, 0.624710, 0.242970, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013414, -0.049123, -0.068604, 0.863155, -0.367389, -0.346393, 0.453390, 0.261946, 0.851952, 1.000000, 0.631350, 0.253060, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016008, -0.039590, -0.068933, 0.479703, 0.816049, -0.322412, 0.870926, -0.398176, 0.288000, 1.000000, 0.620440, 0.284020, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016630, -0.052985, -0.065311, 0.340012, -0.939669, 0.037610, 0.920885, 0.324572, -0.215927, 1.000000, 0.615300, 0.235900, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017719, -0.053269, -0.066793, 0.172735, -0.981272, -0.085248, 0.955158, 0.188011, -0.228748, 1.000000, 0.613270, 0.240160, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018567, -0.053174, -0.067934, -0.022343, -0.971224, -0.237120, 0.970437, 0.035943, -0.238661, 1.000000, 0.612090, 0.243250, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021461, -0.053082, -0.064694, -0.240060, -0.962952, -0.122864, 0.810088, -0.128977, -0.571946, 1.000000, 0.600460, 0.239550, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020502, -0.053320, -0.063578, -0.051320, -0.998402, 0.023642, 0.834105, -0.055869, -0.548769, 1.000000, 0.601210, 0.235920, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019196, -0.053159, -0.062072, 0.132315, -0.980488, 0.145385, 0.824546, 0.027475, -0.565128, 1.000000, 0.602380, 0.230900, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024805, -0.052489, -0.060745, -0.272631, -0.958647, -0.081660, 0.686007, -0.134180, -0.715115, 1.000000, 0.586480, 0.237940, 10, 9, 1, 1, 0.995074, 0.004926, 0.000000, 0.000000 },
-	{ -0.023737, -0.052770, -0.059644, -0.119205, -0.991005, 0.060829, 0.695394, -0.127062, -0.707307, 1.000000, 0.587090, 0.233980, 10, 9, 1, 1, 0.986384, 0.013616, 0.000000, 0.000000 },
-	{ -0.026871, -0.052051, -0.055875, -0.129553, -0.986341, 0.101719, 0.623963, -0.160820, -0.764727, 1.000000, 0.573630, 0.233670, 10, 9, 1, 1, 0.905341, 0.094659, 0.000000, 0.000000 },
-	{ -0.025295, -0.051934, -0.054382, 0.015084, -0.972332, 0.233116, 0.627174, -0.172375, -0.759566, 1.000000, 0.573530, 0.228090, 10, 9, 1, 1, 0.895570, 0.104430, 0.000000, 0.000000 },
-	{ -0.022303, -0.052692, -0.058120, 0.046938, -0.979870, 0.194040, 0.692782, -0.108009, -0.713012, 1.000000, 0.587440, 0.228660, 10, 9, 1, 1, 0.980475, 0.019525, 0.000000, 0.000000 },
-	{ -0.028039, -0.051850, -0.056978, -0.248389, -0.968257, -0.027948, 0.623196, -0.137648, -0.769857, 1.000000, 0.573460, 0.237910, 10, 9, 1, 1, 0.944943, 0.055057, 0.000000, 0.000000 },
-	{ -0.027867, -0.051138, -0.051356, 0.013610, -0.967776, 0.251443, 0.571123, -0.198887, -0.796406, 1.000000, 0.561890, 0.228510, 10, 9, 1, 1, 0.737318, 0.262682, 0.000000, 0.000000 },
-	{ -0.029491, -0.051290, -0.052726, -0.110562, -0.984855, 0.133556, 0.567856, -0.172883, -0.804768, 1.000000, 0.562160, 0.234210, 10, 9, 1, 1, 0.742822, 0.257178, 0.000000, 0.000000 },
-	{ -0.030742, -0.051167, -0.053794, -0.211145, -0.977177, 0.023292, 0.572682, -0.142984, -0.807212, 1.000000, 0.562240, 0.238580, 10, 9, 1, 1, 0.766197, 0.233803, 0.000000, 0.000000 },
-	{ -0.019211, -0.052798, -0.068692, -0.247204, -0.878769, -0.408235, 0.940418, -0.116079, -0.319592, 1.000000, 0.611350, 0.245390, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016964, -0.051656, -0.070730, 0.235969, -0.724025, -0.648156, 0.971667, 0.166531, 0.167723, 1.000000, 0.617930, 0.249780, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015550, -0.048920, -0.071614, 0.616320, -0.339887, -0.710371, 0.782550, 0.163392, 0.600765, 1.000000, 0.622980, 0.256460, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014911, -0.045528, -0.071800, 0.724995, -0.004638, -0.688738, 0.687804, -0.047620, 0.724333, 1.000000, 0.625370, 0.266210, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015162, -0.042184, -0.071293, 0.626939, 0.434121, -0.646905, 0.777258, -0.291960, 0.557342, 1.000000, 0.623560, 0.275390, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016716, -0.039614, -0.069681, 0.287982, 0.828151, -0.480866, 0.957526, -0.256620, 0.131492, 1.000000, 0.618680, 0.282540, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019505, -0.037888, -0.066678, 0.071503, 0.935096, -0.347106, 0.967990, -0.148993, -0.201980, 1.000000, 0.609530, 0.289560, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018732, -0.037819, -0.065920, 0.266520, 0.945304, -0.188063, 0.948315, -0.292058, -0.124102, 1.000000, 0.611130, 0.291680, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023153, -0.036533, -0.062647, -0.001291, 0.952020, -0.306033, 0.909695, -0.125970, -0.395710, 1.000000, 0.596380, 0.296250, 10, 9, 1, 1, 0.991630, 0.008370, 0.000000, 0.000000 },
-	{ -0.026642, -0.035380, -0.058730, -0.041565, 0.948962, -0.312640, 0.855587, -0.127792, -0.501638, 1.000000, 0.583430, 0.301360, 10, 9, 1, 1, 0.907090, 0.092910, 0.000000, 0.000000 },
-	{ -0.029404, -0.034461, -0.055490, -0.085345, 0.940580, -0.328672, 0.820542, -0.120770, -0.558682, 1.000000, 0.572590, 0.305000, 10, 9, 1, 1, 0.670848, 0.329152, 0.000000, 0.000000 },
-	{ -0.030310, -0.034888, -0.056155, -0.203267, 0.891413, -0.405050, 0.807687, -0.081187, -0.583996, 1.000000, 0.571680, 0.301850, 10, 9, 1, 1, 0.742462, 0.257538, 0.000000, 0.000000 },
-	{ -0.027495, -0.035749, -0.059405, -0.188301, 0.888682, -0.418076, 0.838945, -0.075768, -0.538917, 1.000000, 0.582370, 0.298360, 10, 9, 1, 1, 0.929594, 0.070406, 0.000000, 0.000000 },
-	{ -0.024000, -0.036832, -0.063226, -0.182869, 0.874675, -0.448890, 0.886693, -0.050486, -0.459594, 1.000000, 0.594700, 0.293860, 10, 9, 1, 1, 0.986701, 0.013299, 0.000000, 0.000000 },
-	{ -0.020273, -0.038196, -0.067178, -0.146575, 0.851794, -0.502953, 0.949849, -0.020787, -0.312017, 1.000000, 0.607740, 0.287780, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017366, -0.039877, -0.070233, 0.059440, 0.787576, -0.613345, 0.992069, -0.114778, -0.051240, 1.000000, 0.617410, 0.280990, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015808, -0.042257, -0.071870, 0.498442, 0.459444, -0.735165, 0.865263, -0.211196, 0.454661, 1.000000, 0.621840, 0.274610, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015499, -0.045469, -0.072439, 0.672156, 0.006008, -0.740385, 0.739862, -0.043897, 0.671325, 1.000000, 0.623410, 0.266280, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016130, -0.048661, -0.072197, 0.516406, -0.348956, -0.782019, 0.849270, 0.091559, 0.519959, 1.000000, 0.621380, 0.257410, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017525, -0.051193, -0.071228, 0.032006, -0.655361, -0.754637, 0.999433, 0.028876, 0.017311, 1.000000, 0.617010, 0.251330, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019721, -0.052242, -0.069166, -0.432549, -0.730181, -0.528903, 0.877473, -0.206098, -0.433088, 1.000000, 0.610470, 0.247050, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022220, -0.052607, -0.065411, -0.412233, -0.867571, -0.278182, 0.770308, -0.168849, -0.614912, 1.000000, 0.599410, 0.242270, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025667, -0.052008, -0.061530, -0.402436, -0.887094, -0.226076, 0.677131, -0.122257, -0.725635, 1.000000, 0.585710, 0.241290, 10, 9, 1, 1, 0.989802, 0.010198, 0.000000, 0.000000 },
-	{ -0.028984, -0.051470, -0.057832, -0.357498, -0.919521, -0.163331, 0.631717, -0.109283, -0.767458, 1.000000, 0.573130, 0.241470, 10, 9, 1, 1, 0.926841, 0.073159, 0.000000, 0.000000 },
-	{ -0.031742, -0.050881, -0.054655, -0.318003, -0.942745, -0.100530, 0.583568, -0.111066, -0.804433, 1.000000, 0.562230, 0.242210, 10, 9, 1, 1, 0.759463, 0.240537, 0.000000, 0.000000 },
-	{ -0.022851, -0.051996, -0.065854, -0.547806, -0.722174, -0.422343, 0.737068, -0.177792, -0.652013, 1.000000, 0.598010, 0.244500, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026357, -0.051393, -0.062125, -0.525564, -0.757465, -0.387336, 0.678820, -0.098928, -0.727610, 1.000000, 0.585150, 0.244230, 10, 9, 1, 1, 0.991193, 0.008807, 0.000000, 0.000000 },
-	{ -0.029729, -0.050929, -0.058574, -0.481116, -0.812532, -0.329120, 0.650006, -0.078725, -0.755840, 1.000000, 0.573060, 0.244580, 10, 9, 1, 1, 0.941557, 0.058443, 0.000000, 0.000000 },
-	{ -0.032549, -0.050420, -0.055432, -0.449107, -0.855077, -0.259126, 0.603659, -0.076573, -0.793557, 1.000000, 0.562360, 0.245310, 10, 9, 1, 1, 0.781968, 0.218032, 0.000000, 0.000000 },
-	{ -0.018060, -0.050550, -0.071645, -0.137142, -0.600800, -0.787548, 0.989999, -0.056585, -0.129230, 1.000000, 0.616070, 0.253050, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016704, -0.048303, -0.072741, 0.411168, -0.366480, -0.834646, 0.908822, 0.093890, 0.406483, 1.000000, 0.619730, 0.258510, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020111, -0.051541, -0.069662, -0.538107, -0.596120, -0.595888, 0.822600, -0.217281, -0.525469, 1.000000, 0.610080, 0.249120, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023252, -0.051194, -0.066358, -0.635508, -0.560153, -0.531374, 0.715682, -0.169137, -0.677637, 1.000000, 0.597430, 0.246890, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026907, -0.050514, -0.062666, -0.615566, -0.582608, -0.530704, 0.691787, -0.076891, -0.717996, 1.000000, 0.584300, 0.247350, 10, 9, 1, 1, 0.992611, 0.007389, 0.000000, 0.000000 },
-	{ -0.030386, -0.050065, -0.059298, -0.583157, -0.643262, -0.496127, 0.679500, -0.051546, -0.731863, 1.000000, 0.573020, 0.248060, 10, 9, 1, 1, 0.946203, 0.053797, 0.000000, 0.000000 },
-	{ -0.033305, -0.049612, -0.056253, -0.566429, -0.704193, -0.428102, 0.636139, -0.043365, -0.770355, 1.000000, 0.562630, 0.248890, 10, 9, 1, 1, 0.793783, 0.206217, 0.000000, 0.000000 },
-	{ -0.017288, -0.047857, -0.073222, 0.164174, -0.300191, -0.939645, 0.986415, 0.055520, 0.154608, 1.000000, 0.617960, 0.260010, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016788, -0.045332, -0.073478, 0.294590, 0.040467, -0.954767, 0.955621, -0.010320, 0.294417, 1.000000, 0.619160, 0.266570, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018088, -0.047368, -0.073196, -0.478621, -0.075297, -0.874787, 0.876984, -0.089421, -0.472127, 1.000000, 0.615980, 0.261230, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018805, -0.048943, -0.072402, -0.537781, -0.256779, -0.803029, 0.842986, -0.178349, -0.507510, 1.000000, 0.614300, 0.256990, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018505, -0.049749, -0.072102, -0.306179, -0.505674, -0.806566, 0.950628, -0.117360, -0.287287, 1.000000, 0.615120, 0.255120, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017657, -0.045133, -0.073401, -0.444049, 0.095168, -0.890934, 0.894200, -0.015966, -0.447382, 1.000000, 0.617030, 0.267030, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017689, -0.043313, -0.072981, -0.416905, 0.290334, -0.861334, 0.904263, 0.036369, -0.425424, 1.000000, 0.617050, 0.271360, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017152, -0.042839, -0.072848, 0.055359, 0.462317, -0.884985, 0.998158, -0.047673, 0.037533, 1.000000, 0.618360, 0.272590, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019104, -0.042264, -0.071592, -0.563699, 0.344450, -0.750731, 0.813500, 0.074118, -0.576823, 1.000000, 0.613470, 0.274260, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019412, -0.044396, -0.072017, -0.626611, 0.149204, -0.764917, 0.771190, -0.022799, -0.636197, 1.000000, 0.611800, 0.268860, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018601, -0.041021, -0.071168, -0.384734, 0.565731, -0.729334, 0.902748, 0.065902, -0.425093, 1.000000, 0.615290, 0.276920, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020457, -0.050501, -0.070214, -0.623499, -0.444944, -0.642864, 0.769844, -0.206005, -0.604071, 1.000000, 0.609460, 0.251820, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020487, -0.048968, -0.070955, -0.671462, -0.219576, -0.707761, 0.740635, -0.167340, -0.650736, 1.000000, 0.609170, 0.255780, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019919, -0.046839, -0.071810, -0.655961, -0.011562, -0.754706, 0.750702, -0.113979, -0.650735, 1.000000, 0.610430, 0.261730, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021606, -0.039665, -0.067971, -0.480751, 0.536639, -0.693467, 0.843654, 0.067509, -0.532627, 1.000000, 0.604490, 0.282810, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022099, -0.041108, -0.068554, -0.583586, 0.357000, -0.729369, 0.790467, 0.044032, -0.610920, 1.000000, 0.604100, 0.277930, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022734, -0.043231, -0.068930, -0.647322, 0.177968, -0.741149, 0.751039, -0.016985, -0.660039, 1.000000, 0.602120, 0.271590, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023265, -0.045889, -0.068789, -0.689116, -0.013653, -0.724522, 0.723506, -0.069135, -0.686847, 1.000000, 0.600320, 0.263250, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023495, -0.048281, -0.068139, -0.705516, -0.220059, -0.673663, 0.704273, -0.111693, -0.701088, 1.000000, 0.599280, 0.256140, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023445, -0.050012, -0.067200, -0.684500, -0.410255, -0.602620, 0.702004, -0.148014, -0.696622, 1.000000, 0.598320, 0.250860, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025838, -0.038345, -0.064051, -0.478252, 0.552905, -0.682328, 0.819731, 0.002239, -0.572745, 1.000000, 0.590390, 0.287850, 10, 9, 1, 1, 0.984610, 0.015390, 0.000000, 0.000000 },
-	{ -0.026428, -0.039947, -0.064566, -0.579815, 0.345975, -0.737642, 0.789345, 0.014220, -0.613786, 1.000000, 0.588960, 0.282510, 10, 9, 1, 1, 0.992598, 0.007402, 0.000000, 0.000000 },
-	{ -0.030673, -0.038869, -0.060839, -0.571926, 0.352083, -0.740904, 0.790690, -0.003886, -0.612204, 1.000000, 0.576190, 0.285970, 10, 9, 1, 1, 0.922125, 0.077875, 0.000000, 0.000000 },
-	{ -0.026764, -0.042265, -0.065115, -0.642112, 0.171405, -0.747203, 0.758240, -0.001644, -0.651973, 1.000000, 0.588690, 0.274590, 10, 9, 1, 1, 0.995929, 0.004071, 0.000000, 0.000000 },
-	{ -0.031163, -0.041418, -0.061216, -0.625067, 0.161926, -0.763591, 0.773301, -0.004743, -0.634021, 1.000000, 0.575380, 0.277730, 10, 9, 1, 1, 0.950484, 0.049516, 0.000000, 0.000000 },
-	{ -0.029695, -0.037284, -0.060445, -0.452990, 0.609990, -0.650163, 0.806457, -0.030504, -0.590505, 1.000000, 0.578380, 0.290940, 10, 9, 1, 1, 0.919643, 0.080357, 0.000000, 0.000000 },
-	{ -0.027040, -0.044846, -0.065097, -0.681591, -0.024925, -0.731309, 0.731668, -0.036617, -0.680677, 1.000000, 0.587280, 0.266050, 10, 9, 1, 1, 0.998396, 0.001604, 0.000000, 0.000000 },
-	{ -0.031285, -0.044038, -0.061387, -0.653880, -0.034643, -0.755805, 0.756594, -0.033339, -0.653034, 1.000000, 0.574500, 0.267770, 10, 9, 1, 1, 0.964736, 0.035264, 0.000000, 0.000000 },
-	{ -0.031290, -0.046686, -0.060864, -0.656632, -0.255439, -0.709638, 0.740777, -0.041632, -0.670460, 1.000000, 0.573410, 0.259360, 10, 9, 1, 1, 0.973409, 0.026591, 0.000000, 0.000000 },
-	{ -0.027206, -0.047238, -0.064447, -0.688323, -0.230786, -0.687714, 0.714904, -0.055092, -0.697049, 1.000000, 0.585860, 0.258220, 10, 9, 1, 1, 0.997185, 0.002815, 0.000000, 0.000000 },
-	{ -0.030955, -0.048640, -0.060096, -0.633998, -0.462024, -0.620145, 0.712451, -0.037079, -0.700742, 1.000000, 0.572920, 0.252880, 10, 9, 1, 1, 0.945891, 0.054109, 0.000000, 0.000000 },
-	{ -0.027206, -0.049164, -0.063453, -0.662099, -0.418998, -0.621342, 0.705895, -0.070252, -0.704825, 1.000000, 0.584340, 0.251910, 10, 9, 1, 1, 0.996328, 0.003672, 0.000000, 0.000000 },
-	{ -0.033874, -0.038056, -0.058015, -0.581041, 0.393512, -0.712419, 0.772233, -0.009847, -0.635264, 1.000000, 0.566370, 0.288070, 10, 9, 1, 1, 0.749061, 0.250939, 0.000000, 0.000000 },
-	{ -0.034639, -0.040748, -0.058305, -0.636985, 0.179499, -0.749687, 0.761685, -0.003177, -0.647940, 1.000000, 0.564990, 0.280080, 10, 9, 1, 1, 0.791660, 0.208340, 0.000000, 0.000000 },
-	{ -0.032709, -0.036477, -0.057487, -0.429618, 0.679802, -0.594388, 0.786760, -0.041283, -0.615878, 1.000000, 0.568130, 0.293200, 10, 9, 1, 1, 0.741315, 0.258685, 0.000000, 0.000000 },
-	{ -0.034067, -0.048182, -0.057205, -0.649725, -0.500436, -0.572207, 0.674301, -0.031880, -0.737768, 1.000000, 0.562850, 0.254000, 10, 9, 1, 1, 0.774499, 0.225501, 0.000000, 0.000000 },
-	{ -0.034609, -0.046050, -0.058078, -0.679420, -0.281786, -0.677484, 0.719351, -0.073785, -0.690717, 1.000000, 0.563240, 0.260590, 10, 9, 1, 1, 0.830516, 0.169484, 0.000000, 0.000000 },
-	{ -0.034767, -0.043424, -0.058515, -0.665842, -0.039303, -0.745057, 0.745895, -0.058022, -0.663531, 1.000000, 0.564010, 0.269500, 10, 9, 1, 1, 0.809978, 0.190022, 0.000000, 0.000000 },
-	{ -0.028500, -0.036351, -0.059989, -0.316210, 0.790238, -0.524915, 0.820501, -0.049943, -0.569460, 1.000000, 0.580810, 0.294930, 10, 9, 1, 1, 0.919661, 0.080339, 0.000000, 0.000000 },
-	{ -0.031409, -0.035534, -0.056837, -0.295779, 0.827366, -0.477474, 0.794413, -0.064537, -0.603940, 1.000000, 0.570210, 0.297840, 10, 9, 1, 1, 0.789548, 0.210452, 0.000000, 0.000000 },
-	{ -0.024912, -0.037395, -0.063674, -0.342586, 0.741088, -0.577429, 0.854767, -0.009195, -0.518931, 1.000000, 0.592810, 0.291170, 10, 9, 1, 1, 0.988064, 0.011936, 0.000000, 0.000000 },
-	{ -0.020996, -0.038760, -0.067549, -0.333088, 0.711806, -0.618373, 0.901114, 0.047248, -0.431000, 1.000000, 0.605920, 0.285760, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017967, -0.040328, -0.070728, -0.150370, 0.709263, -0.688720, 0.971516, -0.023048, -0.235849, 1.000000, 0.616380, 0.279120, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016482, -0.042466, -0.072392, 0.339468, 0.487536, -0.804407, 0.939391, -0.132069, 0.316388, 1.000000, 0.620110, 0.273750, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016118, -0.045411, -0.073016, 0.594651, 0.022812, -0.803661, 0.803975, -0.012144, 0.594539, 1.000000, 0.621390, 0.266370, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.051515, -0.062360, -0.019773, -0.859389, 0.226380, -0.458478, 0.511306, 0.373466, -0.774008, 1.000000, 0.421180, 0.187060, 18, 17, 1, 1, 0.790454, 0.209546, 0.000000, 0.000000 },
-	{ -0.052082, -0.065283, -0.019232, -0.920728, -0.076559, -0.382620, 0.338288, 0.332092, -0.880498, 1.000000, 0.415720, 0.180620, 18, 17, 1, 1, 0.814479, 0.185521, 0.000000, 0.000000 },
-	{ -0.050119, -0.066322, -0.022836, -0.864650, -0.111433, -0.489860, 0.421935, 0.368168, -0.828507, 1.000000, 0.423560, 0.174300, 18, 17, 1, 1, 0.917427, 0.082573, 0.000000, 0.000000 },
-	{ -0.049517, -0.063459, -0.023506, -0.816372, 0.199877, -0.541836, 0.573547, 0.390553, -0.720078, 1.000000, 0.429670, 0.180180, 18, 17, 1, 1, 0.943089, 0.056911, 0.000000, 0.000000 },
-	{ -0.048393, -0.061463, -0.023509, -0.669825, 0.512566, -0.537225, 0.730289, 0.323994, -0.601420, 1.000000, 0.433580, 0.184620, 18, 17, 1, 1, 0.941405, 0.058595, 0.000000, 0.000000 },
-	{ -0.050400, -0.060335, -0.019806, -0.696322, 0.528605, -0.485502, 0.691661, 0.313560, -0.650604, 1.000000, 0.424970, 0.191290, 18, 17, 1, 1, 0.793012, 0.206988, 0.000000, 0.000000 },
-	{ -0.049828, -0.069635, -0.021640, -0.836953, -0.379812, -0.394020, 0.272858, 0.334504, -0.902029, 1.000000, 0.416560, 0.166450, 18, 17, 1, 1, 0.949496, 0.050504, 0.000000, 0.000000 },
-	{ -0.051748, -0.068542, -0.018122, -0.893951, -0.353167, -0.275906, 0.183247, 0.273778, -0.944175, 1.000000, 0.409150, 0.172960, 18, 17, 1, 1, 0.832500, 0.167500, 0.000000, 0.000000 },
-	{ -0.050454, -0.071186, -0.016769, -0.730975, -0.675834, -0.094470, -0.019047, 0.158590, -0.987161, 1.000000, 0.403640, 0.166000, 18, 17, 1, 1, 0.798971, 0.201029, 0.000000, 0.000000 },
-	{ -0.048593, -0.072309, -0.020317, -0.686732, -0.698350, -0.201760, 0.053885, 0.227888, -0.972195, 1.000000, 0.411270, 0.159470, 18, 17, 1, 1, 0.944729, 0.055271, 0.000000, 0.000000 },
-	{ -0.048245, -0.072555, -0.015543, -0.453160, -0.886159, 0.096793, -0.175710, -0.017656, -0.984284, 1.000000, 0.399750, 0.159980, 18, 17, 1, 1, 0.793492, 0.206508, 0.000000, 0.000000 },
-	{ -0.046451, -0.073702, -0.019128, -0.425115, -0.905027, 0.014273, -0.112830, 0.037340, -0.992913, 1.000000, 0.407750, 0.153220, 18, 17, 1, 1, 0.938940, 0.061060, 0.000000, 0.000000 },
-	{ -0.046819, -0.064737, -0.027846, -0.813453, 0.160387, -0.559081, 0.568554, 0.421952, -0.706189, 1.000000, 0.440320, 0.171460, 18, 19, 17, 1, 0.986424, 0.008754, 0.004821, 0.000000 },
-	{ -0.045799, -0.062706, -0.027749, -0.679342, 0.488446, -0.547646, 0.727643, 0.351728, -0.588917, 1.000000, 0.444170, 0.176040, 18, 19, 17, 1, 0.983636, 0.008328, 0.008036, 0.000000 },
-	{ -0.044054, -0.065975, -0.032266, -0.831227, 0.119863, -0.542858, 0.532909, 0.449906, -0.716654, 1.000000, 0.451110, 0.162490, 18, 19, 1, 1, 0.944761, 0.055239, 0.000000, 0.000000 },
-	{ -0.043291, -0.063912, -0.032051, -0.702794, 0.463778, -0.539436, 0.708679, 0.390251, -0.587774, 1.000000, 0.454740, 0.167070, 18, 19, 1, 1, 0.937268, 0.062732, 0.000000, 0.000000 },
-	{ -0.044121, -0.068959, -0.031901, -0.850363, -0.170838, -0.497692, 0.405467, 0.390099, -0.826692, 1.000000, 0.446450, 0.155530, 18, 19, 1, 1, 0.941712, 0.058288, 0.000000, 0.000000 },
-	{ -0.047193, -0.067652, -0.027220, -0.845878, -0.145704, -0.513089, 0.427258, 0.390738, -0.815337, 1.000000, 0.434660, 0.165350, 18, 17, 19, 1, 0.982493, 0.011774, 0.005732, 0.000000 },
-	{ -0.043513, -0.072466, -0.030976, -0.809357, -0.406194, -0.424203, 0.293143, 0.346483, -0.891076, 1.000000, 0.439740, 0.145580, 18, 19, 1, 1, 0.929674, 0.070326, 0.000000, 0.000000 },
-	{ -0.046802, -0.071069, -0.026136, -0.813272, -0.391887, -0.430131, 0.293769, 0.361560, -0.884858, 1.000000, 0.427550, 0.156300, 18, 19, 17, 1, 0.984982, 0.008726, 0.006292, 0.000000 },
-	{ -0.042292, -0.074880, -0.029826, -0.641136, -0.727734, -0.243616, 0.109331, 0.227592, -0.967600, 1.000000, 0.435750, 0.138870, 18, 19, 1, 1, 0.910916, 0.089084, 0.000000, 0.000000 },
-	{ -0.045617, -0.073552, -0.024946, -0.660426, -0.709648, -0.245432, 0.085368, 0.253777, -0.963488, 1.000000, 0.422910, 0.149750, 18, 19, 17, 1, 0.981119, 0.011487, 0.007394, 0.000000 },
-	{ -0.040507, -0.075999, -0.028375, -0.371227, -0.928047, -0.030327, -0.028045, 0.043852, -0.998645, 1.000000, 0.431520, 0.133070, 18, 19, 1, 1, 0.862105, 0.137895, 0.000000, 0.000000 },
-	{ -0.043665, -0.074836, -0.023694, -0.404023, -0.914251, -0.030179, -0.067549, 0.062720, -0.995743, 1.000000, 0.419080, 0.143460, 18, 19, 17, 1, 0.973561, 0.019018, 0.007421, 0.000000 },
-	{ -0.042338, -0.062422, -0.031493, -0.549196, 0.665209, -0.505847, 0.813478, 0.286897, -0.505908, 1.000000, 0.457570, 0.171530, 18, 19, 1, 1, 0.933887, 0.066113, 0.000000, 0.000000 },
-	{ -0.044637, -0.061219, -0.027378, -0.541908, 0.673878, -0.502220, 0.813996, 0.272127, -0.513183, 1.000000, 0.447560, 0.180250, 18, 19, 17, 1, 0.985685, 0.008676, 0.005640, 0.000000 },
-	{ -0.041382, -0.061414, -0.030930, -0.393446, 0.793744, -0.463865, 0.890835, 0.204472, -0.405714, 1.000000, 0.459870, 0.174950, 18, 19, 1, 1, 0.948466, 0.051534, 0.000000, 0.000000 },
-	{ -0.043517, -0.060246, -0.027005, -0.391911, 0.808344, -0.439302, 0.882660, 0.195707, -0.427329, 1.000000, 0.450380, 0.183080, 18, 17, 19, 1, 0.989828, 0.005513, 0.004659, 0.000000 },
-	{ -0.040375, -0.060820, -0.030493, -0.225396, 0.887752, -0.401364, 0.942048, 0.093520, -0.322180, 1.000000, 0.462300, 0.177200, 18, 19, 1, 1, 0.963784, 0.036216, 0.000000, 0.000000 },
-	{ -0.042416, -0.059663, -0.026571, -0.227130, 0.902475, -0.365993, 0.920008, 0.075595, -0.384541, 1.000000, 0.452830, 0.185430, 18, 19, 17, 1, 0.990354, 0.007132, 0.002514, 0.000000 },
-	{ -0.039177, -0.060430, -0.030040, -0.098048, 0.934138, -0.343181, 0.961619, 0.000128, -0.274390, 1.000000, 0.465320, 0.179460, 18, 19, 1, 1, 0.944310, 0.055690, 0.000000, 0.000000 },
-	{ -0.041201, -0.059245, -0.025981, -0.101154, 0.946164, -0.307476, 0.927194, -0.022385, -0.373912, 1.000000, 0.455400, 0.188290, 18, 19, 17, 1, 0.988705, 0.006175, 0.005120, 0.000000 },
-	{ -0.039755, -0.058958, -0.025281, 0.021886, 0.969413, -0.244457, 0.937622, -0.104762, -0.331496, 1.000000, 0.458420, 0.191600, 18, 17, 19, 1, 0.984359, 0.008798, 0.006843, 0.000000 },
-	{ -0.037668, -0.060164, -0.029510, 0.017464, 0.958331, -0.285125, 0.968641, -0.086906, -0.232771, 1.000000, 0.469360, 0.181960, 18, 19, 1, 1, 0.937232, 0.062768, 0.000000, 0.000000 },
-	{ -0.038008, -0.058934, -0.024551, 0.181271, 0.971198, -0.154648, 0.933387, -0.219431, -0.283969, 1.000000, 0.462850, 0.194900, 18, 19, 17, 1, 0.984462, 0.008458, 0.007081, 0.000000 },
-	{ -0.035850, -0.060119, -0.028881, 0.179188, 0.963484, -0.198976, 0.956806, -0.217732, -0.192652, 1.000000, 0.474460, 0.184820, 18, 19, 1, 1, 0.929101, 0.070899, 0.000000, 0.000000 },
-	{ -0.040190, -0.057903, -0.019964, 0.212287, 0.970168, -0.117085, 0.901844, -0.240644, -0.358844, 1.000000, 0.450780, 0.204340, 18, 17, 1, 1, 0.945277, 0.054723, 0.000000, 0.000000 },
-	{ -0.041807, -0.057869, -0.020925, 0.051911, 0.974183, -0.219712, 0.913865, -0.135054, -0.382899, 1.000000, 0.447570, 0.200480, 18, 17, 1, 1, 0.942631, 0.057369, 0.000000, 0.000000 },
-	{ -0.043540, -0.056912, -0.017323, 0.108048, 0.967088, -0.230364, 0.884202, -0.199406, -0.422403, 1.000000, 0.438620, 0.207180, 18, 17, 1, 1, 0.818937, 0.181063, 0.000000, 0.000000 },
-	{ -0.041969, -0.057074, -0.016257, 0.270753, 0.953602, -0.131670, 0.854959, -0.301067, -0.422378, 1.000000, 0.441270, 0.211520, 18, 17, 1, 1, 0.788784, 0.211216, 0.000000, 0.000000 },
-	{ -0.044980, -0.057123, -0.018096, -0.059570, 0.946359, -0.317580, 0.893328, -0.091426, -0.440007, 1.000000, 0.436110, 0.203840, 18, 17, 1, 1, 0.823167, 0.176833, 0.000000, 0.000000 },
-	{ -0.043223, -0.058165, -0.021764, -0.089571, 0.950699, -0.296898, 0.912106, -0.041436, -0.407854, 1.000000, 0.445120, 0.196830, 18, 17, 1, 1, 0.952770, 0.047230, 0.000000, 0.000000 },
-	{ -0.046341, -0.057543, -0.018732, -0.199382, 0.906386, -0.372441, 0.886220, 0.004597, -0.463241, 1.000000, 0.433720, 0.200610, 18, 17, 1, 1, 0.829682, 0.170318, 0.000000, 0.000000 },
-	{ -0.044512, -0.058607, -0.022458, -0.214104, 0.910156, -0.354649, 0.904882, 0.048062, -0.422940, 1.000000, 0.442790, 0.193630, 18, 17, 1, 1, 0.971654, 0.028346, 0.000000, 0.000000 },
-	{ -0.047685, -0.058142, -0.019215, -0.344762, 0.839926, -0.419122, 0.860926, 0.104990, -0.497779, 1.000000, 0.431090, 0.197700, 18, 17, 1, 1, 0.808070, 0.191930, 0.000000, 0.000000 },
-	{ -0.045763, -0.059210, -0.022940, -0.364033, 0.829551, -0.423469, 0.877768, 0.153526, -0.453821, 1.000000, 0.440270, 0.190870, 18, 17, 1, 1, 0.952680, 0.047320, 0.000000, 0.000000 },
-	{ -0.049046, -0.059009, -0.019570, -0.509021, 0.726262, -0.461997, 0.802097, 0.205474, -0.560732, 1.000000, 0.428240, 0.194750, 18, 17, 1, 1, 0.806897, 0.193103, 0.000000, 0.000000 },
-	{ -0.047065, -0.060099, -0.023260, -0.514646, 0.703177, -0.490593, 0.822612, 0.243607, -0.513776, 1.000000, 0.437210, 0.188160, 18, 17, 1, 1, 0.951320, 0.048680, 0.000000, 0.000000 },
-	{ -0.044751, -0.055967, -0.014359, 0.156524, 0.945251, -0.286359, 0.864401, -0.271368, -0.423284, 1.000000, 0.431600, 0.212430, 18, 17, 1, 1, 0.592984, 0.407016, 0.000000, 0.000000 },
-	{ -0.043039, -0.056202, -0.013449, 0.324991, 0.916099, -0.234829, 0.816032, -0.397143, -0.419964, 1.000000, 0.434890, 0.216500, 18, 17, 1, 1, 0.517677, 0.482323, 0.000000, 0.000000 },
-	{ -0.045692, -0.054774, -0.011320, 0.144265, 0.930695, -0.336146, 0.853257, -0.289035, -0.434063, 1.000000, 0.424580, 0.218280, 17, 18, 1, 1, 0.653811, 0.346189, 0.000000, 0.000000 },
-	{ -0.046292, -0.056026, -0.014936, -0.034070, 0.936379, -0.349332, 0.883697, -0.135039, -0.448156, 1.000000, 0.428530, 0.209580, 18, 17, 1, 1, 0.647455, 0.352545, 0.000000, 0.000000 },
-	{ -0.047371, -0.054818, -0.011751, -0.043534, 0.928734, -0.368183, 0.872498, -0.144182, -0.466861, 1.000000, 0.421090, 0.215390, 17, 18, 1, 1, 0.610055, 0.389945, 0.000000, 0.000000 },
-	{ -0.043761, -0.054984, -0.010568, 0.315695, 0.896358, -0.311254, 0.806901, -0.426203, -0.408976, 1.000000, 0.428350, 0.222290, 17, 18, 1, 1, 0.762607, 0.237393, 0.000000, 0.000000 },
-	{ -0.048869, -0.055162, -0.011997, -0.248090, 0.883661, -0.396981, 0.850786, 0.002779, -0.525505, 1.000000, 0.417910, 0.212960, 17, 18, 1, 1, 0.675479, 0.324520, 0.000000, 0.000000 },
-	{ -0.047733, -0.056401, -0.015377, -0.211363, 0.895669, -0.391284, 0.863954, -0.016001, -0.503316, 1.000000, 0.425730, 0.206780, 18, 17, 1, 1, 0.574092, 0.425908, 0.000000, 0.000000 },
-	{ -0.050273, -0.055840, -0.012233, -0.430191, 0.808520, -0.401537, 0.794433, 0.127820, -0.593750, 1.000000, 0.415000, 0.210190, 17, 18, 1, 1, 0.688108, 0.311892, 0.000000, 0.000000 },
-	{ -0.049127, -0.057029, -0.015788, -0.372808, 0.832579, -0.409667, 0.826009, 0.096628, -0.555312, 1.000000, 0.423090, 0.203780, 18, 17, 1, 1, 0.574202, 0.425798, 0.000000, 0.000000 },
-	{ -0.051629, -0.056863, -0.012496, -0.604022, 0.696055, -0.388157, 0.703482, 0.236776, -0.670113, 1.000000, 0.412260, 0.206930, 17, 18, 1, 1, 0.662953, 0.337047, 0.000000, 0.000000 },
-	{ -0.050492, -0.057959, -0.016150, -0.550111, 0.723561, -0.416939, 0.752277, 0.212604, -0.623602, 1.000000, 0.420470, 0.200620, 18, 17, 1, 1, 0.576015, 0.423985, 0.000000, 0.000000 },
-	{ -0.052899, -0.058347, -0.012682, -0.788067, 0.499764, -0.359425, 0.559618, 0.338360, -0.756531, 1.000000, 0.409160, 0.203030, 17, 18, 1, 1, 0.669233, 0.330767, 0.000000, 0.000000 },
-	{ -0.051806, -0.059358, -0.016388, -0.748786, 0.523478, -0.406560, 0.617285, 0.327349, -0.715404, 1.000000, 0.417400, 0.196930, 18, 17, 1, 1, 0.564762, 0.435238, 0.000000, 0.000000 },
-	{ -0.052806, -0.061422, -0.016377, -0.913880, 0.212857, -0.345709, 0.402726, 0.367647, -0.838241, 1.000000, 0.413930, 0.192620, 18, 17, 1, 1, 0.563014, 0.436986, 0.000000, 0.000000 },
-	{ -0.053823, -0.060431, -0.012675, -0.940876, 0.177066, -0.288791, 0.335686, 0.372931, -0.865007, 1.000000, 0.405850, 0.198470, 17, 18, 1, 1, 0.687048, 0.312952, 0.000000, 0.000000 },
-	{ -0.053126, -0.064370, -0.015944, -0.965935, -0.075479, -0.247531, 0.214017, 0.304742, -0.928078, 1.000000, 0.409060, 0.185820, 18, 17, 1, 1, 0.658714, 0.341286, 0.000000, 0.000000 },
-	{ -0.053974, -0.063373, -0.012261, -0.974295, -0.104643, -0.199495, 0.159631, 0.304159, -0.939151, 1.000000, 0.401020, 0.191690, 17, 18, 1, 1, 0.648151, 0.351849, 0.000000, 0.000000 },
-	{ -0.053378, -0.066628, -0.011420, -0.935804, -0.334876, -0.110133, 0.029156, 0.237824, -0.970871, 1.000000, 0.394810, 0.182750, 17, 18, 1, 1, 0.667369, 0.332631, 0.000000, 0.000000 },
-	{ -0.052643, -0.067613, -0.014987, -0.934427, -0.325945, -0.143545, 0.070763, 0.225096, -0.971764, 1.000000, 0.402720, 0.177470, 18, 17, 1, 1, 0.614924, 0.385076, 0.000000, 0.000000 },
-	{ -0.052132, -0.069091, -0.010431, -0.765855, -0.642524, 0.025089, -0.152425, 0.143500, -0.977842, 1.000000, 0.390470, 0.175960, 17, 18, 1, 1, 0.615458, 0.384542, 0.000000, 0.000000 },
-	{ -0.051417, -0.070175, -0.013765, -0.763022, -0.646322, 0.008106, -0.113690, 0.121851, -0.986016, 1.000000, 0.397500, 0.170720, 18, 17, 1, 1, 0.566539, 0.433461, 0.000000, 0.000000 },
-	{ -0.050047, -0.070467, -0.009367, -0.506713, -0.851582, 0.134354, -0.269564, 0.008474, -0.962945, 1.000000, 0.386280, 0.170090, 17, 18, 1, 1, 0.638349, 0.361651, 0.000000, 0.000000 },
-	{ -0.049266, -0.071501, -0.012587, -0.482669, -0.863417, 0.146770, -0.241289, -0.030000, -0.969990, 1.000000, 0.393430, 0.164950, 18, 17, 1, 1, 0.587926, 0.412074, 0.000000, 0.000000 },
-	{ -0.047911, -0.071265, -0.008458, -0.331466, -0.927315, 0.173833, -0.314789, -0.064990, -0.946934, 1.000000, 0.382760, 0.164530, 17, 18, 1, 1, 0.642939, 0.357061, 0.000000, 0.000000 },
-	{ -0.047052, -0.072192, -0.011598, -0.299069, -0.932477, 0.202595, -0.282544, -0.116257, -0.952184, 1.000000, 0.389760, 0.159270, 18, 17, 1, 1, 0.575519, 0.424481, 0.000000, 0.000000 },
-	{ -0.046191, -0.071562, -0.007904, -0.156024, -0.966765, 0.202542, -0.344924, -0.138818, -0.928309, 1.000000, 0.380640, 0.160560, 17, 18, 1, 1, 0.692157, 0.307843, 0.000000, 0.000000 },
-	{ -0.045320, -0.072385, -0.010989, -0.124669, -0.962042, 0.242762, -0.306449, -0.195374, -0.931621, 1.000000, 0.387520, 0.155330, 18, 17, 1, 1, 0.578988, 0.421012, 0.000000, 0.000000 },
-	{ -0.044779, -0.071580, -0.007576, 0.007780, -0.975275, 0.220856, -0.345232, -0.209903, -0.914744, 1.000000, 0.379080, 0.157160, 17, 18, 1, 1, 0.592834, 0.407166, 0.000000, 0.000000 },
-	{ -0.043951, -0.072306, -0.010629, 0.041439, -0.960047, 0.276754, -0.299758, -0.276178, -0.913165, 1.000000, 0.385940, 0.152020, 18, 17, 1, 1, 0.688113, 0.311887, 0.000000, 0.000000 },
-	{ -0.043506, -0.071413, -0.007319, 0.176259, -0.957265, 0.229297, -0.338068, -0.277644, -0.899235, 1.000000, 0.377670, 0.154130, 18, 17, 1, 1, 0.521131, 0.478869, 0.000000, 0.000000 },
-	{ -0.042766, -0.072037, -0.010342, 0.211355, -0.929727, 0.301557, -0.283681, -0.353597, -0.891344, 1.000000, 0.384510, 0.149160, 18, 17, 1, 1, 0.769413, 0.230587, 0.000000, 0.000000 },
-	{ -0.042191, -0.070985, -0.007045, 0.359140, -0.905107, 0.227598, -0.309003, -0.345432, -0.886112, 1.000000, 0.375930, 0.150880, 17, 18, 1, 1, 0.588399, 0.411601, 0.000000, 0.000000 },
-	{ -0.041562, -0.071512, -0.010046, 0.377961, -0.870715, 0.314646, -0.246012, -0.422092, -0.872534, 1.000000, 0.382760, 0.146040, 18, 17, 1, 1, 0.676401, 0.323599, 0.000000, 0.000000 },
-	{ -0.040753, -0.070180, -0.006766, 0.556829, -0.801309, 0.218736, -0.261349, -0.418981, -0.869570, 1.000000, 0.373750, 0.146870, 17, 18, 1, 1, 0.655782, 0.344219, 0.000000, 0.000000 },
-	{ -0.040246, -0.070650, -0.009720, 0.547332, -0.773405, 0.319801, -0.200374, -0.492103, -0.847163, 1.000000, 0.380450, 0.142320, 18, 17, 1, 1, 0.599068, 0.400932, 0.000000, 0.000000 },
-	{ -0.045979, -0.073166, -0.014548, -0.265001, -0.945047, 0.191471, -0.235888, -0.128999, -0.963180, 1.000000, 0.396150, 0.154250, 18, 17, 1, 1, 0.794051, 0.205949, 0.000000, 0.000000 },
-	{ -0.044256, -0.074289, -0.018198, -0.239286, -0.961489, 0.135212, -0.190190, -0.090145, -0.977600, 1.000000, 0.404870, 0.147350, 18, 17, 19, 1, 0.947102, 0.051797, 0.001101, 0.000000 },
-	{ -0.044236, -0.073303, -0.013891, -0.109508, -0.960560, 0.255604, -0.267284, -0.219223, -0.938350, 1.000000, 0.393860, 0.150300, 18, 17, 1, 1, 0.838633, 0.161367, 0.000000, 0.000000 },
-	{ -0.042547, -0.074425, -0.017533, -0.098792, -0.971821, 0.214019, -0.235446, -0.186137, -0.953896, 1.000000, 0.402740, 0.143250, 18, 17, 19, 1, 0.963344, 0.035397, 0.001259, 0.000000 },
-	{ -0.042908, -0.073192, -0.013459, 0.039888, -0.947410, 0.317527, -0.266152, -0.316373, -0.910533, 1.000000, 0.392210, 0.147170, 18, 17, 1, 1, 0.884604, 0.115397, 0.000000, 0.000000 },
-	{ -0.041252, -0.074340, -0.017033, 0.032989, -0.958424, 0.283436, -0.250999, -0.282447, -0.925864, 1.000000, 0.401040, 0.140220, 18, 17, 19, 1, 0.965431, 0.033166, 0.001403, 0.000000 },
-	{ -0.041775, -0.072885, -0.013085, 0.195062, -0.904689, 0.378799, -0.243278, -0.418778, -0.874895, 1.000000, 0.390540, 0.144590, 18, 17, 1, 1, 0.899225, 0.100775, 0.000000, 0.000000 },
-	{ -0.040100, -0.074075, -0.016603, 0.176406, -0.917598, 0.356225, -0.229135, -0.390239, -0.891746, 1.000000, 0.399410, 0.137550, 18, 17, 19, 1, 0.951319, 0.047135, 0.001546, 0.000000 },
-	{ -0.040595, -0.072317, -0.012692, 0.338044, -0.836905, 0.430485, -0.191162, -0.508936, -0.839310, 1.000000, 0.388460, 0.141670, 18, 17, 1, 1, 0.859712, 0.140288, 0.000000, 0.000000 },
-	{ -0.038822, -0.073546, -0.016177, 0.314700, -0.849815, 0.422823, -0.177446, -0.490275, -0.853314, 1.000000, 0.397470, 0.134230, 18, 17, 19, 1, 0.952150, 0.046272, 0.001578, 0.000000 },
-	{ -0.039296, -0.071393, -0.012247, 0.485791, -0.734163, 0.474355, -0.129299, -0.597081, -0.791692, 1.000000, 0.385670, 0.138130, 18, 17, 1, 1, 0.795883, 0.204117, 0.000000, 0.000000 },
-	{ -0.037390, -0.072617, -0.015700, 0.465171, -0.739621, 0.486392, -0.113559, -0.594778, -0.795829, 1.000000, 0.394670, 0.130100, 18, 17, 19, 1, 0.936955, 0.060282, 0.002763, 0.000000 },
-	{ -0.036354, -0.074644, -0.020497, 0.312039, -0.864797, 0.393393, -0.141814, -0.451825, -0.880763, 1.000000, 0.409170, 0.124550, 18, 19, 17, 1, 0.960198, 0.028567, 0.011234, 0.000000 },
-	{ -0.037701, -0.075146, -0.020920, 0.171892, -0.930946, 0.322169, -0.184040, -0.351626, -0.917872, 1.000000, 0.410900, 0.128160, 18, 19, 17, 1, 0.964699, 0.024004, 0.011298, 0.000000 },
-	{ -0.033749, -0.075573, -0.024648, 0.329414, -0.868018, 0.371526, -0.072581, -0.415604, -0.906645, 1.000000, 0.421330, 0.114930, 18, 19, 1, 1, 0.825474, 0.174526, 0.000000, 0.000000 },
-	{ -0.035082, -0.076056, -0.025015, 0.184139, -0.936019, 0.299937, -0.113545, -0.323369, -0.939436, 1.000000, 0.422530, 0.118780, 18, 19, 17, 1, 0.849182, 0.149739, 0.001080, 0.000000 },
-	{ -0.032228, -0.074702, -0.024328, 0.501079, -0.746733, 0.437390, -0.000803, -0.505820, -0.862639, 1.000000, 0.419760, 0.109950, 18, 19, 1, 1, 0.815368, 0.184632, 0.000000, 0.000000 },
-	{ -0.034819, -0.073749, -0.020059, 0.472194, -0.750278, 0.462727, -0.075122, -0.557275, -0.826923, 1.000000, 0.406720, 0.119970, 18, 19, 17, 1, 0.953573, 0.039769, 0.006659, 0.000000 },
-	{ -0.036233, -0.076308, -0.025460, 0.055419, -0.972111, 0.227879, -0.136991, -0.233474, -0.962665, 1.000000, 0.423770, 0.121870, 18, 19, 17, 1, 0.868137, 0.130852, 0.001012, 0.000000 },
-	{ -0.038878, -0.075397, -0.021369, 0.036175, -0.968047, 0.248145, -0.201031, -0.250280, -0.947072, 1.000000, 0.412400, 0.131100, 18, 19, 17, 1, 0.968386, 0.023246, 0.008368, 0.000000 },
-	{ -0.037376, -0.076430, -0.026092, -0.060629, -0.985258, 0.159973, -0.127743, -0.151291, -0.980201, 1.000000, 0.425460, 0.124690, 18, 19, 1, 1, 0.877448, 0.122552, 0.000000, 0.000000 },
-	{ -0.040124, -0.075487, -0.021923, -0.086608, -0.980257, 0.177753, -0.180899, -0.159983, -0.970403, 1.000000, 0.414080, 0.134140, 18, 19, 17, 1, 0.975188, 0.019993, 0.004819, 0.000000 },
-	{ -0.038784, -0.076395, -0.027033, -0.191072, -0.978042, 0.083223, -0.087055, -0.067566, -0.993910, 1.000000, 0.427830, 0.128400, 18, 19, 1, 1, 0.906791, 0.093209, 0.000000, 0.000000 },
-	{ -0.041716, -0.075376, -0.022656, -0.221951, -0.970457, 0.094607, -0.140723, -0.064129, -0.987970, 1.000000, 0.416120, 0.138220, 18, 19, 17, 1, 0.973927, 0.020636, 0.005438, 0.000000 },
-	{ -0.037833, -0.076866, -0.032131, -0.313259, -0.949120, -0.032262, 0.047145, 0.018387, -0.998719, 1.000000, 0.441400, 0.125100, 18, 19, 1, 1, 0.621571, 0.378429, 0.000000, 0.000000 },
-	{ -0.036113, -0.077103, -0.030692, -0.140718, -0.986943, 0.078372, -0.012544, -0.077376, -0.996923, 1.000000, 0.437740, 0.120010, 18, 19, 1, 1, 0.680719, 0.319280, 0.000000, 0.000000 },
-	{ -0.035701, -0.077339, -0.034843, -0.264661, -0.960917, -0.081198, 0.152809, 0.041347, -0.987391, 1.000000, 0.448080, 0.119790, 19, 18, 1, 1, 0.605370, 0.394630, 0.000000, 0.000000 },
-	{ -0.037562, -0.076441, -0.036293, -0.518520, -0.784621, -0.339863, 0.268262, 0.228128, -0.935945, 1.000000, 0.451220, 0.125700, 19, 18, 1, 1, 0.578482, 0.421518, 0.000000, 0.000000 },
-	{ -0.039639, -0.075931, -0.033675, -0.600016, -0.757586, -0.256992, 0.165670, 0.196608, -0.966384, 1.000000, 0.445110, 0.130710, 18, 19, 1, 1, 0.703137, 0.296863, 0.000000, 0.000000 },
-	{ -0.038922, -0.074111, -0.037569, -0.698491, -0.474492, -0.535694, 0.417503, 0.337772, -0.843565, 1.000000, 0.455630, 0.132920, 19, 18, 1, 1, 0.517889, 0.482111, 0.000000, 0.000000 },
-	{ -0.040909, -0.073518, -0.034956, -0.787529, -0.434868, -0.436679, 0.323160, 0.311944, -0.893453, 1.000000, 0.449590, 0.137660, 18, 19, 1, 1, 0.755102, 0.244898, 0.000000, 0.000000 },
-	{ -0.041667, -0.070044, -0.035897, -0.839216, -0.195198, -0.507557, 0.415898, 0.370941, -0.830320, 1.000000, 0.455980, 0.147150, 18, 19, 1, 1, 0.778309, 0.221691, 0.000000, 0.000000 },
-	{ -0.039734, -0.070820, -0.038536, -0.755972, -0.230857, -0.612545, 0.511200, 0.376287, -0.772712, 1.000000, 0.461580, 0.141900, 18, 19, 1, 1, 0.517060, 0.482940, 0.000000, 0.000000 },
-	{ -0.041735, -0.066954, -0.036124, -0.828022, 0.087472, -0.553831, 0.527751, 0.455179, -0.717141, 1.000000, 0.460350, 0.154600, 18, 19, 1, 1, 0.794975, 0.205025, 0.000000, 0.000000 },
-	{ -0.039807, -0.067770, -0.038872, -0.754382, 0.045396, -0.654864, 0.601274, 0.448077, -0.661587, 1.000000, 0.466680, 0.148950, 18, 19, 1, 1, 0.541860, 0.458140, 0.000000, 0.000000 },
-	{ -0.041172, -0.064865, -0.035792, -0.697617, 0.450265, -0.557308, 0.716228, 0.418017, -0.558819, 1.000000, 0.463440, 0.159350, 18, 19, 1, 1, 0.796198, 0.203802, 0.000000, 0.000000 },
-	{ -0.039304, -0.065709, -0.038645, -0.636888, 0.421416, -0.645587, 0.767640, 0.424226, -0.480377, 1.000000, 0.469840, 0.153140, 18, 19, 1, 1, 0.562187, 0.437813, 0.000000, 0.000000 },
-	{ -0.037525, -0.071391, -0.040459, -0.650523, -0.266888, -0.711049, 0.591319, 0.409546, -0.694705, 1.000000, 0.466670, 0.136990, 19, 18, 1, 1, 0.757078, 0.242922, 0.000000, 0.000000 },
-	{ -0.037663, -0.068557, -0.040889, -0.659151, -0.019302, -0.751763, 0.662748, 0.457488, -0.592849, 1.000000, 0.471820, 0.143820, 19, 18, 1, 1, 0.729806, 0.270194, 0.000000, 0.000000 },
-	{ -0.037248, -0.066609, -0.040843, -0.579979, 0.341196, -0.739736, 0.793748, 0.440977, -0.418930, 1.000000, 0.475180, 0.147730, 19, 18, 1, 1, 0.672319, 0.327681, 0.000000, 0.000000 },
-	{ -0.035429, -0.076560, -0.038409, -0.472635, -0.765755, -0.436160, 0.365563, 0.279977, -0.887681, 1.000000, 0.456820, 0.121510, 19, 18, 1, 1, 0.815162, 0.184838, 0.000000, 0.000000 },
-	{ -0.033647, -0.077592, -0.037243, -0.293630, -0.941021, -0.168111, 0.248744, 0.094589, -0.963940, 1.000000, 0.454330, 0.115320, 19, 18, 1, 1, 0.827372, 0.172628, 0.000000, 0.000000 },
-	{ -0.036741, -0.074420, -0.039531, -0.601582, -0.490670, -0.630350, 0.501852, 0.381786, -0.776134, 1.000000, 0.460740, 0.128290, 19, 18, 1, 1, 0.787610, 0.212390, 0.000000, 0.000000 },
-	{ -0.038436, -0.064476, -0.037983, -0.438025, 0.697083, -0.567635, 0.896264, 0.289743, -0.335799, 1.000000, 0.472400, 0.156550, 18, 19, 1, 1, 0.577719, 0.422281, 0.000000, 0.000000 },
-	{ -0.040326, -0.063499, -0.035077, -0.507602, 0.688302, -0.518248, 0.848011, 0.292742, -0.441790, 1.000000, 0.465790, 0.163520, 18, 19, 1, 1, 0.795543, 0.204457, 0.000000, 0.000000 },
-	{ -0.037463, -0.063585, -0.037306, -0.312276, 0.801474, -0.510023, 0.944652, 0.205132, -0.256036, 1.000000, 0.475300, 0.159690, 18, 19, 1, 1, 0.614648, 0.385352, 0.000000, 0.000000 },
-	{ -0.039404, -0.062553, -0.034374, -0.355737, 0.800019, -0.483137, 0.919898, 0.208437, -0.332178, 1.000000, 0.468140, 0.167050, 18, 19, 1, 1, 0.795502, 0.204498, 0.000000, 0.000000 },
-	{ -0.036456, -0.062982, -0.036766, -0.195215, 0.872005, -0.448886, 0.975880, 0.127099, -0.177496, 1.000000, 0.478070, 0.161940, 18, 19, 1, 1, 0.588533, 0.411467, 0.000000, 0.000000 },
-	{ -0.038403, -0.061969, -0.033889, -0.209666, 0.877408, -0.431504, 0.966135, 0.118019, -0.229466, 1.000000, 0.470820, 0.169220, 18, 19, 1, 1, 0.842578, 0.157422, 0.000000, 0.000000 },
-	{ -0.035289, -0.062584, -0.036245, -0.076690, 0.921830, -0.379932, 0.990290, 0.026108, -0.136545, 1.000000, 0.481200, 0.163960, 18, 19, 1, 1, 0.542294, 0.457706, 0.000000, 0.000000 },
-	{ -0.037206, -0.061579, -0.033455, -0.086091, 0.922975, -0.375107, 0.981904, 0.014858, -0.188797, 1.000000, 0.474150, 0.171160, 18, 19, 1, 1, 0.786225, 0.213775, 0.000000, 0.000000 },
-	{ -0.035697, -0.061306, -0.032925, 0.030173, 0.948042, -0.316711, 0.983811, -0.084167, -0.158217, 1.000000, 0.478280, 0.173480, 18, 19, 1, 1, 0.774697, 0.225303, 0.000000, 0.000000 },
-	{ -0.033773, -0.062336, -0.035631, 0.032078, 0.950580, -0.308819, 0.995157, -0.059102, -0.078550, 1.000000, 0.485450, 0.166300, 18, 19, 1, 1, 0.524786, 0.475214, 0.000000, 0.000000 },
-	{ -0.031882, -0.062320, -0.034942, 0.173816, 0.965621, -0.193298, 0.983866, -0.178723, -0.008105, 1.000000, 0.491020, 0.168450, 19, 18, 1, 1, 0.537732, 0.462268, 0.000000, 0.000000 },
-	{ -0.033849, -0.061294, -0.032290, 0.191099, 0.955838, -0.223281, 0.971516, -0.216659, -0.096001, 1.000000, 0.483480, 0.176030, 18, 19, 1, 1, 0.741905, 0.258095, 0.000000, 0.000000 },
-	{ -0.033244, -0.063432, -0.038787, -0.103559, 0.923765, -0.368693, 0.993906, 0.082035, -0.073631, 1.000000, 0.487510, 0.157210, 19, 18, 1, 1, 0.700442, 0.299558, 0.000000, 0.000000 },
-	{ -0.031737, -0.063144, -0.038146, -0.003250, 0.961778, -0.273812, 0.999619, -0.004386, -0.027270, 1.000000, 0.491860, 0.159190, 19, 18, 1, 1, 0.730301, 0.269699, 0.000000, 0.000000 },
-	{ -0.029866, -0.063034, -0.037361, 0.132654, 0.980272, -0.146525, 0.990985, -0.133972, 0.000881, 1.000000, 0.497240, 0.161560, 19, 18, 1, 1, 0.795239, 0.204761, 0.000000, 0.000000 },
-	{ -0.034401, -0.063870, -0.039331, -0.211396, 0.861098, -0.462410, 0.976546, 0.166305, -0.136747, 1.000000, 0.484340, 0.155270, 19, 18, 1, 1, 0.687993, 0.312007, 0.000000, 0.000000 },
-	{ -0.035411, -0.064501, -0.039863, -0.312741, 0.776789, -0.546619, 0.949192, 0.234358, -0.210027, 1.000000, 0.481450, 0.153110, 19, 18, 1, 1, 0.646608, 0.353392, 0.000000, 0.000000 },
-	{ -0.036406, -0.065393, -0.040411, -0.418667, 0.647654, -0.636602, 0.907771, 0.318444, -0.273031, 1.000000, 0.478220, 0.150420, 19, 18, 1, 1, 0.681057, 0.318943, 0.000000, 0.000000 },
-	{ -0.032878, -0.065404, -0.042567, -0.353576, 0.729745, -0.585198, 0.934105, 0.308429, -0.179773, 1.000000, 0.488000, 0.145860, 19, 18, 1, 1, 0.881992, 0.118008, 0.000000, 0.000000 },
-	{ -0.033857, -0.066301, -0.042929, -0.458896, 0.566533, -0.684438, 0.881249, 0.388373, -0.269382, 1.000000, 0.484640, 0.143740, 19, 18, 1, 1, 0.881776, 0.118224, 0.000000, 0.000000 },
-	{ -0.029778, -0.066439, -0.045726, -0.411916, 0.661548, -0.626642, 0.904331, 0.381204, -0.192013, 1.000000, 0.495360, 0.137010, 19, 18, 1, 1, 0.979148, 0.020852, 0.000000, 0.000000 },
-	{ -0.028849, -0.065784, -0.045475, -0.302163, 0.790959, -0.532054, 0.948798, 0.303465, -0.087703, 1.000000, 0.498160, 0.138440, 19, 18, 1, 1, 0.980352, 0.019648, 0.000000, 0.000000 },
-	{ -0.031882, -0.064735, -0.042145, -0.253837, 0.834260, -0.489466, 0.966790, 0.234386, -0.101882, 1.000000, 0.491020, 0.147640, 19, 18, 1, 1, 0.887340, 0.112660, 0.000000, 0.000000 },
-	{ -0.027745, -0.065265, -0.045152, -0.181514, 0.882104, -0.434678, 0.976454, 0.214071, 0.026669, 1.000000, 0.501420, 0.139420, 19, 18, 1, 1, 0.983672, 0.016328, 0.000000, 0.000000 },
-	{ -0.030732, -0.064234, -0.041667, -0.148307, 0.909667, -0.387958, 0.988762, 0.143862, -0.040660, 1.000000, 0.494350, 0.149250, 19, 18, 1, 1, 0.894673, 0.105328, 0.000000, 0.000000 },
-	{ -0.026359, -0.064845, -0.044618, -0.027610, 0.946650, -0.321079, 0.991560, 0.066640, 0.111213, 1.000000, 0.505450, 0.140720, 19, 18, 1, 1, 0.989352, 0.010648, 0.000000, 0.000000 },
-	{ -0.029291, -0.063834, -0.041035, -0.029314, 0.959492, -0.280206, 0.999469, 0.032128, 0.005454, 1.000000, 0.498370, 0.151170, 19, 18, 1, 1, 0.918007, 0.081993, 0.000000, 0.000000 },
-	{ -0.024656, -0.064700, -0.043840, 0.173840, 0.967596, -0.183135, 0.970310, -0.136542, 0.199638, 1.000000, 0.510570, 0.142120, 19, 18, 1, 1, 0.993900, 0.006100, 0.000000, 0.000000 },
-	{ -0.027509, -0.063713, -0.040192, 0.133370, 0.979623, -0.150173, 0.989990, -0.124627, 0.066244, 1.000000, 0.503460, 0.153370, 19, 18, 1, 1, 0.947947, 0.052053, 0.000000, 0.000000 },
-	{ -0.023549, -0.066208, -0.048519, 0.020247, 0.922471, -0.385534, 0.968284, 0.077956, 0.237379, 1.000000, 0.511810, 0.128370, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022044, -0.066084, -0.047747, 0.252730, 0.933943, -0.252742, 0.923718, -0.155184, 0.350233, 1.000000, 0.516370, 0.129370, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021270, -0.067889, -0.051607, 0.181243, 0.832522, -0.523506, 0.865063, 0.118240, 0.487529, 1.000000, 0.515470, 0.117250, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020003, -0.067878, -0.050796, 0.407603, 0.826560, -0.388147, 0.754290, -0.065180, 0.653298, 1.000000, 0.519470, 0.117100, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018607, -0.070178, -0.052407, 0.631475, 0.532202, -0.563916, 0.533857, 0.229032, 0.813967, 1.000000, 0.519060, 0.106820, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019552, -0.070165, -0.053310, 0.452345, 0.528940, -0.718058, 0.672796, 0.326128, 0.664067, 1.000000, 0.515920, 0.108000, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017786, -0.072729, -0.052649, 0.787460, 0.132543, -0.601946, 0.439474, 0.564015, 0.699107, 1.000000, 0.515820, 0.098250, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018505, -0.072966, -0.053465, 0.645784, 0.094351, -0.757668, 0.563982, 0.609964, 0.556658, 1.000000, 0.513490, 0.099660, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020512, -0.070343, -0.053815, 0.228458, 0.480616, -0.846650, 0.761407, 0.453728, 0.463023, 1.000000, 0.513420, 0.108960, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019268, -0.073245, -0.054053, 0.479104, 0.047352, -0.876480, 0.638658, 0.666196, 0.385096, 1.000000, 0.511450, 0.100830, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018742, -0.076078, -0.053079, 0.578452, -0.363033, -0.730479, 0.587257, 0.806863, 0.064043, 1.000000, 0.506430, 0.093870, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018040, -0.075688, -0.052577, 0.720626, -0.283445, -0.632738, 0.502938, 0.841885, 0.195662, 1.000000, 0.508280, 0.092500, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018928, -0.078327, -0.051238, 0.498921, -0.725675, -0.473787, 0.532586, 0.688008, -0.492947, 1.000000, 0.499700, 0.089690, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018183, -0.077906, -0.050877, 0.690269, -0.619508, -0.373816, 0.483315, 0.779255, -0.398959, 1.000000, 0.501190, 0.087900, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017536, -0.077237, -0.050390, 0.836890, -0.485029, -0.253696, 0.418434, 0.865694, -0.274751, 1.000000, 0.503050, 0.085890, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017426, -0.075200, -0.051903, 0.847357, -0.192638, -0.494850, 0.396763, 0.849036, 0.348880, 1.000000, 0.510420, 0.090960, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022337, -0.068145, -0.052109, -0.054650, 0.772351, -0.632841, 0.916919, 0.289738, 0.274428, 1.000000, 0.512510, 0.117220, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018151, -0.078526, -0.048131, 0.726934, -0.681266, 0.086275, 0.458908, 0.388479, -0.799055, 1.000000, 0.494350, 0.083180, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018979, -0.079254, -0.048532, 0.523565, -0.851930, -0.009714, 0.468156, 0.297200, -0.832167, 1.000000, 0.493300, 0.086020, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019815, -0.079612, -0.048882, 0.291248, -0.950265, -0.110323, 0.455661, 0.239199, -0.857413, 1.000000, 0.492680, 0.088310, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021542, -0.079778, -0.045740, 0.142137, -0.983108, 0.115313, 0.332091, -0.062382, -0.941182, 1.000000, 0.482840, 0.089280, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020542, -0.079516, -0.045385, 0.357716, -0.908643, 0.215424, 0.359602, -0.078863, -0.929767, 1.000000, 0.483190, 0.086420, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019463, -0.078840, -0.044986, 0.599258, -0.739159, 0.307465, 0.379610, -0.075775, -0.922038, 1.000000, 0.483600, 0.082900, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023806, -0.079376, -0.041908, 0.112087, -0.967691, 0.225855, 0.261025, -0.190634, -0.946322, 1.000000, 0.470780, 0.092260, 19, 18, 1, 1, 0.997321, 0.002679, 0.000000, 0.000000 },
-	{ -0.022664, -0.079065, -0.041516, 0.287596, -0.900986, 0.324827, 0.282565, -0.244239, -0.927634, 1.000000, 0.470860, 0.088810, 19, 18, 1, 1, 0.997997, 0.002003, 0.000000, 0.000000 },
-	{ -0.025082, -0.078118, -0.037520, 0.275136, -0.873657, 0.401279, 0.234978, -0.343621, -0.909236, 1.000000, 0.458900, 0.092560, 19, 18, 1, 1, 0.970286, 0.029714, 0.000000, 0.000000 },
-	{ -0.023788, -0.077315, -0.036973, 0.468175, -0.732949, 0.493557, 0.272346, -0.411671, -0.869687, 1.000000, 0.457910, 0.088170, 19, 18, 1, 1, 0.981949, 0.018051, 0.000000, 0.000000 },
-	{ -0.021429, -0.078338, -0.041043, 0.517083, -0.746069, 0.419531, 0.311151, -0.292768, -0.904142, 1.000000, 0.470490, 0.084780, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026234, -0.078539, -0.038012, 0.130235, -0.942419, 0.308036, 0.207686, -0.277859, -0.937903, 1.000000, 0.459560, 0.096110, 19, 18, 1, 1, 0.968943, 0.031057, 0.000000, 0.000000 },
-	{ -0.020613, -0.079692, -0.049097, 0.034801, -0.977620, -0.207480, 0.424213, 0.202425, -0.882648, 1.000000, 0.492060, 0.090150, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019664, -0.078525, -0.051488, 0.267585, -0.798130, -0.539803, 0.564441, 0.583885, -0.583511, 1.000000, 0.498640, 0.091200, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019432, -0.076360, -0.053421, 0.421516, -0.435595, -0.795350, 0.647710, 0.758466, -0.072124, 1.000000, 0.504910, 0.095040, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019978, -0.073541, -0.054399, 0.295241, 0.004049, -0.955414, 0.682825, 0.698547, 0.213966, 1.000000, 0.509770, 0.101720, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021311, -0.070641, -0.054017, -0.030714, 0.385260, -0.922297, 0.808737, 0.551817, 0.203572, 1.000000, 0.511510, 0.109470, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023155, -0.068566, -0.052299, -0.297361, 0.628896, -0.718377, 0.872901, 0.483904, 0.062305, 1.000000, 0.510410, 0.116930, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025741, -0.067114, -0.049116, -0.348531, 0.730599, -0.587156, 0.906389, 0.422256, -0.012613, 1.000000, 0.505260, 0.127430, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024776, -0.066611, -0.048967, -0.178103, 0.852117, -0.492114, 0.951900, 0.275916, 0.133254, 1.000000, 0.508250, 0.127690, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026577, -0.067662, -0.049126, -0.483789, 0.561423, -0.671381, 0.832682, 0.531433, -0.155626, 1.000000, 0.502640, 0.127020, 19, 18, 1, 1, 0.998889, 0.001111, 0.000000, 0.000000 },
-	{ -0.023839, -0.069081, -0.052189, -0.491509, 0.442178, -0.750265, 0.775032, 0.614996, -0.145279, 1.000000, 0.508320, 0.117100, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021977, -0.071064, -0.054026, -0.279048, 0.272579, -0.920779, 0.789602, 0.610827, -0.058471, 1.000000, 0.509790, 0.109620, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020631, -0.073866, -0.054574, 0.078928, -0.049276, -0.995662, 0.703922, 0.709977, 0.020664, 1.000000, 0.508140, 0.102390, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020105, -0.076547, -0.053630, 0.199323, -0.506181, -0.839078, 0.676891, 0.690274, -0.255618, 1.000000, 0.503570, 0.096140, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020376, -0.078530, -0.051651, -0.014407, -0.823054, -0.567780, 0.564972, 0.461806, -0.683770, 1.000000, 0.497860, 0.092620, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021385, -0.079533, -0.049175, -0.232694, -0.925506, -0.298818, 0.388567, 0.193191, -0.900940, 1.000000, 0.491250, 0.091840, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022439, -0.079795, -0.045976, -0.059370, -0.998236, 0.000521, 0.305081, -0.018641, -0.952144, 1.000000, 0.482340, 0.091690, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024805, -0.079454, -0.042237, -0.046401, -0.992375, 0.114186, 0.250002, -0.122208, -0.960502, 1.000000, 0.470730, 0.095060, 19, 18, 1, 1, 0.996281, 0.003719, 0.000000, 0.000000 },
-	{ -0.027233, -0.078726, -0.038474, -0.005291, -0.978848, 0.204519, 0.199440, -0.201446, -0.958980, 1.000000, 0.460260, 0.098890, 19, 18, 1, 1, 0.966122, 0.033878, 0.000000, 0.000000 },
-	{ -0.023302, -0.079622, -0.046131, -0.264933, -0.953428, -0.144170, 0.293678, 0.062629, -0.953851, 1.000000, 0.481790, 0.093980, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025786, -0.079334, -0.042559, -0.210340, -0.977276, -0.026261, 0.257255, -0.029414, -0.965896, 1.000000, 0.470940, 0.097740, 19, 18, 1, 1, 0.995174, 0.004826, 0.000000, 0.000000 },
-	{ -0.028305, -0.078719, -0.038911, -0.135371, -0.987286, 0.083319, 0.211927, -0.111000, -0.970962, 1.000000, 0.460720, 0.101900, 19, 18, 1, 1, 0.964273, 0.035727, 0.000000, 0.000000 },
-	{ -0.021307, -0.074198, -0.054554, -0.209814, -0.141270, -0.967482, 0.680292, 0.689626, -0.248231, 1.000000, 0.506350, 0.103040, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020817, -0.076619, -0.053648, -0.129422, -0.547041, -0.827041, 0.668583, 0.567809, -0.480198, 1.000000, 0.502230, 0.097350, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021093, -0.078347, -0.051717, -0.288710, -0.784975, -0.548143, 0.530992, 0.345120, -0.773911, 1.000000, 0.497280, 0.094130, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022167, -0.079143, -0.049164, -0.441059, -0.817550, -0.370242, 0.367776, 0.211663, -0.905505, 1.000000, 0.490310, 0.093720, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024238, -0.079198, -0.046223, -0.436552, -0.848758, -0.298383, 0.321670, 0.162482, -0.932807, 1.000000, 0.481260, 0.096460, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026957, -0.078946, -0.042827, -0.360175, -0.912042, -0.196094, 0.303529, 0.084194, -0.949095, 1.000000, 0.470860, 0.101020, 19, 18, 1, 1, 0.995093, 0.004907, 0.000000, 0.000000 },
-	{ -0.029640, -0.078480, -0.039355, -0.260294, -0.962946, -0.070580, 0.252888, 0.002555, -0.967492, 1.000000, 0.460940, 0.105700, 19, 18, 1, 1, 0.962434, 0.037566, 0.000000, 0.000000 },
-	{ -0.022108, -0.074434, -0.054167, -0.511678, -0.249750, -0.822077, 0.590465, 0.592839, -0.547625, 1.000000, 0.504250, 0.104030, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023257, -0.072229, -0.053595, -0.605018, 0.056266, -0.794221, 0.584909, 0.708196, -0.395398, 1.000000, 0.505430, 0.109660, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023893, -0.072736, -0.053030, -0.720989, -0.111861, -0.683858, 0.483659, 0.625495, -0.612234, 1.000000, 0.503010, 0.110360, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023304, -0.074414, -0.053113, -0.696474, -0.311674, -0.646361, 0.484173, 0.460703, -0.743861, 1.000000, 0.500640, 0.106320, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022825, -0.076330, -0.052416, -0.668714, -0.459540, -0.584504, 0.487829, 0.322096, -0.811343, 1.000000, 0.497180, 0.101100, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021636, -0.076564, -0.053362, -0.468226, -0.513147, -0.719336, 0.590879, 0.423458, -0.686691, 1.000000, 0.500480, 0.098720, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022630, -0.077533, -0.051431, -0.626403, -0.610950, -0.484106, 0.437979, 0.237890, -0.866939, 1.000000, 0.494920, 0.097870, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021844, -0.078008, -0.051662, -0.488188, -0.708167, -0.510070, 0.480006, 0.270238, -0.834605, 1.000000, 0.496370, 0.095870, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025612, -0.071884, -0.051176, -0.715750, -0.099766, -0.691194, 0.563231, 0.502693, -0.655798, 1.000000, 0.499210, 0.114890, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025380, -0.073845, -0.050870, -0.719359, -0.307151, -0.623041, 0.500707, 0.392406, -0.771564, 1.000000, 0.495320, 0.110650, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025205, -0.070628, -0.051514, -0.660299, 0.141106, -0.737628, 0.641081, 0.617504, -0.455747, 1.000000, 0.502360, 0.116690, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023054, -0.078472, -0.049196, -0.551239, -0.724012, -0.414659, 0.367609, 0.235393, -0.899697, 1.000000, 0.489730, 0.096390, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024024, -0.077449, -0.049490, -0.625982, -0.618938, -0.474408, 0.395884, 0.271913, -0.877120, 1.000000, 0.489730, 0.100460, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024782, -0.075912, -0.050238, -0.688590, -0.466352, -0.555301, 0.456229, 0.316610, -0.831633, 1.000000, 0.491650, 0.105170, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.028068, -0.069474, -0.048774, -0.637746, 0.148006, -0.755893, 0.702449, 0.514352, -0.491944, 1.000000, 0.496180, 0.125250, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.028316, -0.071052, -0.048611, -0.677950, -0.103142, -0.727837, 0.604157, 0.485876, -0.631601, 1.000000, 0.492920, 0.121850, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.028120, -0.073145, -0.048180, -0.676842, -0.303676, -0.670572, 0.537975, 0.417730, -0.732179, 1.000000, 0.488600, 0.116820, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.027476, -0.075330, -0.047497, -0.645032, -0.473887, -0.599470, 0.484713, 0.352736, -0.800394, 1.000000, 0.484530, 0.110640, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026545, -0.077068, -0.046776, -0.586706, -0.627593, -0.511765, 0.427769, 0.296410, -0.853906, 1.000000, 0.481740, 0.105370, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025372, -0.078349, -0.046322, -0.525725, -0.742226, -0.415589, 0.379739, 0.232397, -0.895427, 1.000000, 0.480580, 0.100290, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.031435, -0.068469, -0.045870, -0.608822, 0.189451, -0.770353, 0.733919, 0.503153, -0.456289, 1.000000, 0.488670, 0.133730, 19, 18, 1, 1, 0.975541, 0.024459, 0.000000, 0.000000 },
-	{ -0.031673, -0.070206, -0.045758, -0.651133, -0.096510, -0.752803, 0.635950, 0.471987, -0.610570, 1.000000, 0.485190, 0.129970, 19, 18, 1, 1, 0.991003, 0.008997, 0.000000, 0.000000 },
-	{ -0.034971, -0.069376, -0.043066, -0.639988, -0.070914, -0.765106, 0.656478, 0.467001, -0.592408, 1.000000, 0.477790, 0.137590, 19, 18, 1, 1, 0.920608, 0.079392, 0.000000, 0.000000 },
-	{ -0.031414, -0.072508, -0.045346, -0.644979, -0.301601, -0.702167, 0.571745, 0.419213, -0.705244, 1.000000, 0.480760, 0.124050, 19, 18, 1, 1, 0.992776, 0.007224, 0.000000, 0.000000 },
-	{ -0.034758, -0.071920, -0.042606, -0.630965, -0.289952, -0.719591, 0.595271, 0.413889, -0.688729, 1.000000, 0.472870, 0.131190, 19, 18, 1, 1, 0.935302, 0.064698, 0.000000, 0.000000 },
-	{ -0.034646, -0.067527, -0.043143, -0.585862, 0.253607, -0.769707, 0.768327, 0.475901, -0.428010, 1.000000, 0.481370, 0.141390, 19, 18, 1, 1, 0.866068, 0.133932, 0.000000, 0.000000 },
-	{ -0.030735, -0.074901, -0.044596, -0.610296, -0.477366, -0.632188, 0.511553, 0.371851, -0.774623, 1.000000, 0.475980, 0.117190, 19, 18, 1, 1, 0.993519, 0.006480, 0.000000, 0.000000 },
-	{ -0.034046, -0.074605, -0.041745, -0.591328, -0.484324, -0.644796, 0.524542, 0.376313, -0.763704, 1.000000, 0.467240, 0.123430, 19, 18, 1, 1, 0.944491, 0.055509, 0.000000, 0.000000 },
-	{ -0.032880, -0.076629, -0.040793, -0.504862, -0.711269, -0.489092, 0.420267, 0.292374, -0.859007, 1.000000, 0.463460, 0.116800, 19, 18, 1, 1, 0.951333, 0.048667, 0.000000, 0.000000 },
-	{ -0.029742, -0.076805, -0.043742, -0.545970, -0.658099, -0.518481, 0.439405, 0.301987, -0.846007, 1.000000, 0.472280, 0.111180, 19, 18, 1, 1, 0.994767, 0.005233, 0.000000, 0.000000 },
-	{ -0.031276, -0.077850, -0.039970, -0.381127, -0.885449, -0.265938, 0.324739, 0.141107, -0.935219, 1.000000, 0.461740, 0.110780, 19, 18, 1, 1, 0.957974, 0.042026, 0.000000, 0.000000 },
-	{ -0.028400, -0.078132, -0.043121, -0.462026, -0.809748, -0.361719, 0.371499, 0.193646, -0.908014, 1.000000, 0.470590, 0.105750, 19, 18, 1, 1, 0.995484, 0.004516, 0.000000, 0.000000 },
-	{ -0.030711, -0.067281, -0.045840, -0.512746, 0.475716, -0.714693, 0.836628, 0.463735, -0.291553, 1.000000, 0.492040, 0.135700, 19, 18, 1, 1, 0.979574, 0.020426, 0.000000, 0.000000 },
-	{ -0.027401, -0.068385, -0.048940, -0.571492, 0.374762, -0.730034, 0.762508, 0.571303, -0.303637, 1.000000, 0.499520, 0.126890, 19, 18, 1, 1, 0.998769, 0.001231, 0.000000, 0.000000 },
-	{ -0.024488, -0.069743, -0.051889, -0.595716, 0.286033, -0.750538, 0.699722, 0.643603, -0.310103, 1.000000, 0.505900, 0.116970, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022590, -0.071626, -0.053922, -0.458407, 0.173523, -0.871638, 0.708684, 0.663204, -0.240679, 1.000000, 0.507870, 0.109460, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.031913, -0.078003, -0.036271, -0.166954, -0.985793, 0.018413, 0.178261, -0.048548, -0.982785, 1.000000, 0.452510, 0.109960, 19, 18, 1, 1, 0.841506, 0.158494, 0.000000, 0.000000 },
-	{ -0.030578, -0.078043, -0.035602, -0.056509, -0.987318, 0.148356, 0.143865, -0.155095, -0.977368, 1.000000, 0.451470, 0.106310, 19, 18, 1, 1, 0.862849, 0.137151, 0.000000, 0.000000 },
-	{ -0.032619, -0.077502, -0.032702, -0.007712, -0.987395, 0.158090, 0.053172, -0.158276, -0.985962, 1.000000, 0.443560, 0.110790, 19, 18, 1, 1, 0.640730, 0.359270, 0.000000, 0.000000 },
-	{ -0.031580, -0.077313, -0.032101, 0.093241, -0.968650, 0.230268, 0.054183, -0.225996, -0.972620, 1.000000, 0.442310, 0.107880, 19, 18, 1, 1, 0.685651, 0.314349, 0.000000, 0.000000 },
-	{ -0.029516, -0.077917, -0.035068, 0.049185, -0.967989, 0.246126, 0.137870, -0.237486, -0.961557, 1.000000, 0.450550, 0.103310, 19, 18, 1, 1, 0.876020, 0.123980, 0.000000, 0.000000 },
-	{ -0.030609, -0.077014, -0.031608, 0.214885, -0.926524, 0.308833, 0.068298, -0.301190, -0.951115, 1.000000, 0.441110, 0.105220, 19, 18, 1, 1, 0.705119, 0.294881, 0.000000, 0.000000 },
-	{ -0.028549, -0.077641, -0.034550, 0.170396, -0.925080, 0.339400, 0.148076, -0.316487, -0.936968, 1.000000, 0.449510, 0.100560, 19, 18, 1, 1, 0.873896, 0.126104, 0.000000, 0.000000 },
-	{ -0.029532, -0.076482, -0.031170, 0.359991, -0.843359, 0.398940, 0.120731, -0.381901, -0.916284, 1.000000, 0.439980, 0.101970, 19, 18, 1, 1, 0.686974, 0.313026, 0.000000, 0.000000 },
-	{ -0.031459, -0.076116, -0.028255, 0.366524, -0.860414, 0.354045, 0.017729, -0.373999, -0.927260, 1.000000, 0.431910, 0.107310, 18, 19, 1, 1, 0.550069, 0.449931, 0.000000, 0.000000 },
-	{ -0.030089, -0.075222, -0.027957, 0.545377, -0.724114, 0.422165, 0.090315, -0.449963, -0.888469, 1.000000, 0.430600, 0.102640, 18, 19, 1, 1, 0.560181, 0.439819, 0.000000, 0.000000 },
-	{ -0.028319, -0.075555, -0.030776, 0.521860, -0.693558, 0.496629, 0.194307, -0.470240, -0.860883, 1.000000, 0.438450, 0.097620, 19, 18, 1, 1, 0.667568, 0.332432, 0.000000, 0.000000 },
-	{ -0.032673, -0.076616, -0.028614, 0.213794, -0.935915, 0.279920, -0.026941, -0.292085, -0.956013, 1.000000, 0.432940, 0.110850, 18, 19, 1, 1, 0.565687, 0.434313, 0.000000, 0.000000 },
-	{ -0.027468, -0.077138, -0.034023, 0.303708, -0.847066, 0.436166, 0.189868, -0.394798, -0.898935, 1.000000, 0.448270, 0.097270, 19, 18, 1, 1, 0.864428, 0.135572, 0.000000, 0.000000 },
-	{ -0.026213, -0.076267, -0.033511, 0.460607, -0.703732, 0.540928, 0.250017, -0.481883, -0.839810, 1.000000, 0.446900, 0.092860, 19, 18, 1, 1, 0.871110, 0.128890, 0.000000, 0.000000 },
-	{ -0.033752, -0.076881, -0.029040, 0.088502, -0.973520, 0.210774, -0.046159, -0.215385, -0.975438, 1.000000, 0.433810, 0.113910, 18, 19, 1, 1, 0.612705, 0.387295, 0.000000, 0.000000 },
-	{ -0.034818, -0.077048, -0.029674, -0.019821, -0.988622, 0.149107, -0.056065, -0.147803, -0.987427, 1.000000, 0.435240, 0.116730, 18, 19, 1, 1, 0.648251, 0.351749, 0.000000, 0.000000 },
-	{ -0.033925, -0.077576, -0.033577, -0.118433, -0.990883, 0.064222, 0.089277, -0.075041, -0.993176, 1.000000, 0.445350, 0.114300, 19, 18, 1, 1, 0.608110, 0.391890, 0.000000, 0.000000 },
-	{ -0.031354, -0.089760, -0.019479, -0.695491, -0.290338, -0.657264, -0.034406, 0.927136, -0.373143, 1.000000, 0.312710, 0.047930, 15, 14, 1, 1, 0.935512, 0.064488, 0.000000, 0.000000 },
-	{ -0.030738, -0.091903, -0.018707, -0.652013, -0.529559, -0.542630, -0.192179, 0.807729, -0.557353, 1.000000, 0.306170, 0.046750, 15, 14, 1, 1, 0.961216, 0.038784, 0.000000, 0.000000 },
-	{ -0.028641, -0.092378, -0.020800, -0.679537, -0.519494, -0.518031, -0.207471, 0.813362, -0.543506, 1.000000, 0.306820, 0.039480, 15, 14, 1, 1, 0.995916, 0.004084, 0.000000, 0.000000 },
-	{ -0.029251, -0.090406, -0.021441, -0.722236, -0.298614, -0.623863, -0.064025, 0.926988, -0.369585, 1.000000, 0.312940, 0.040650, 15, 14, 1, 1, 0.992440, 0.007560, 0.000000, 0.000000 },
-	{ -0.029217, -0.088992, -0.021750, -0.721775, -0.031881, -0.691394, 0.098731, 0.983980, -0.148442, 1.000000, 0.316910, 0.040790, 15, 14, 1, 1, 0.975651, 0.024349, 0.000000, 0.000000 },
-	{ -0.031239, -0.088240, -0.019772, -0.690699, 0.022086, -0.722805, 0.161166, 0.979095, -0.124090, 1.000000, 0.316790, 0.048050, 15, 14, 1, 1, 0.918387, 0.081613, 0.000000, 0.000000 },
-	{ -0.029338, -0.094343, -0.017426, -0.583302, -0.684621, -0.437096, -0.303524, 0.682861, -0.664510, 1.000000, 0.296620, 0.044540, 15, 14, 1, 1, 0.963750, 0.036250, 0.000000, 0.000000 },
-	{ -0.027348, -0.094638, -0.019741, -0.612953, -0.672195, -0.415263, -0.302996, 0.685363, -0.662172, 1.000000, 0.298210, 0.037320, 15, 14, 1, 1, 0.994094, 0.005906, 0.000000, 0.000000 },
-	{ -0.025838, -0.096259, -0.018669, -0.481942, -0.834130, -0.268252, -0.400893, 0.482146, -0.778987, 1.000000, 0.291390, 0.035090, 15, 14, 1, 1, 0.990653, 0.009347, 0.000000, 0.000000 },
-	{ -0.027706, -0.096067, -0.016209, -0.435413, -0.857417, -0.274322, -0.427065, 0.464986, -0.775503, 1.000000, 0.289210, 0.042280, 15, 14, 1, 1, 0.949006, 0.050994, 0.000000, 0.000000 },
-	{ -0.026105, -0.096696, -0.015264, -0.226465, -0.971979, -0.063003, -0.509522, 0.173346, -0.842816, 1.000000, 0.284450, 0.039950, 15, 14, 1, 1, 0.930318, 0.069682, 0.000000, 0.000000 },
-	{ -0.024378, -0.096986, -0.017822, -0.294907, -0.951636, -0.086132, -0.467168, 0.222230, -0.855785, 1.000000, 0.286780, 0.032820, 15, 14, 1, 1, 0.990732, 0.009268, 0.000000, 0.000000 },
-	{ -0.026965, -0.091223, -0.023852, -0.747640, -0.313708, -0.585338, -0.120912, 0.930965, -0.344507, 1.000000, 0.312900, 0.032050, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026942, -0.089987, -0.024189, -0.746678, -0.060330, -0.662444, 0.051634, 0.987617, -0.148144, 1.000000, 0.316370, 0.031900, 15, 14, 1, 1, 0.996672, 0.003328, 0.000000, 0.000000 },
-	{ -0.024961, -0.091969, -0.026114, -0.749199, -0.337864, -0.569691, -0.192437, 0.934046, -0.300876, 1.000000, 0.312700, 0.024220, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024849, -0.091037, -0.026530, -0.741441, -0.064999, -0.667862, -0.020146, 0.997005, -0.074666, 1.000000, 0.315180, 0.023370, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023680, -0.092546, -0.027433, -0.715536, -0.382679, -0.584436, -0.213733, 0.916417, -0.338377, 1.000000, 0.312080, 0.019440, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022932, -0.093769, -0.027267, -0.664021, -0.534645, -0.522716, -0.287383, 0.827876, -0.481698, 1.000000, 0.308820, 0.018100, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022017, -0.093847, -0.028241, -0.559470, -0.480969, -0.675028, -0.226426, 0.872125, -0.433739, 1.000000, 0.309010, 0.014820, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023267, -0.092216, -0.028021, -0.659346, -0.202089, -0.724171, -0.101954, 0.978334, -0.180188, 1.000000, 0.312900, 0.017800, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021968, -0.095551, -0.026481, -0.634831, -0.610596, -0.473457, -0.288944, 0.755921, -0.587448, 1.000000, 0.303270, 0.016780, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021028, -0.095750, -0.027398, -0.484921, -0.636644, -0.599613, -0.288332, 0.763667, -0.577648, 1.000000, 0.303540, 0.013620, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021416, -0.096723, -0.025576, -0.577283, -0.721963, -0.381462, -0.317584, 0.628903, -0.709663, 1.000000, 0.299250, 0.016410, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020666, -0.097132, -0.025818, -0.389679, -0.836198, -0.385905, -0.378403, 0.527402, -0.760696, 1.000000, 0.298710, 0.014500, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023388, -0.095345, -0.024728, -0.647904, -0.632988, -0.423730, -0.290709, 0.719654, -0.630544, 1.000000, 0.301950, 0.022470, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024440, -0.093460, -0.025572, -0.695312, -0.526702, -0.489005, -0.286412, 0.827097, -0.483611, 1.000000, 0.308400, 0.023900, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021248, -0.097477, -0.023514, -0.371283, -0.912864, -0.169788, -0.433359, 0.332085, -0.837807, 1.000000, 0.294480, 0.018260, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022271, -0.096788, -0.023947, -0.555395, -0.773295, -0.305863, -0.330374, 0.542716, -0.772213, 1.000000, 0.296940, 0.020350, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026418, -0.092971, -0.023264, -0.699981, -0.516553, -0.493153, -0.245708, 0.822569, -0.512843, 1.000000, 0.307600, 0.031390, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025253, -0.095040, -0.022348, -0.636902, -0.655966, -0.405049, -0.296316, 0.693322, -0.656888, 1.000000, 0.300010, 0.029540, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023895, -0.096564, -0.021439, -0.523129, -0.806988, -0.274057, -0.375339, 0.506856, -0.776027, 1.000000, 0.294210, 0.027200, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022639, -0.097304, -0.020683, -0.349670, -0.929762, -0.115211, -0.462360, 0.278213, -0.841915, 1.000000, 0.290130, 0.025260, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020404, -0.097773, -0.023161, -0.156965, -0.983312, -0.091980, -0.462193, 0.155445, -0.873049, 1.000000, 0.292580, 0.016830, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019869, -0.097371, -0.025862, -0.073171, -0.909797, -0.408554, -0.400731, 0.401948, -0.823318, 1.000000, 0.297990, 0.012810, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019672, -0.097838, -0.022853, 0.087145, -0.995698, -0.031489, -0.430520, -0.009137, -0.902535, 1.000000, 0.291180, 0.015530, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019117, -0.097336, -0.025712, 0.254730, -0.881611, -0.397335, -0.394244, 0.280511, -0.875149, 1.000000, 0.297190, 0.011370, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019002, -0.097729, -0.022567, 0.346216, -0.937839, 0.024349, -0.379547, -0.163756, -0.910565, 1.000000, 0.290020, 0.014210, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018476, -0.097108, -0.025467, 0.537128, -0.764658, -0.356078, -0.346031, 0.185236, -0.919756, 1.000000, 0.296420, 0.010040, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018399, -0.097414, -0.022238, 0.595270, -0.798952, 0.085610, -0.303748, -0.322380, -0.896553, 1.000000, 0.288780, 0.012970, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017945, -0.096711, -0.025138, 0.753655, -0.591259, -0.287084, -0.270768, 0.118704, -0.955298, 1.000000, 0.295650, 0.008660, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017878, -0.096853, -0.021872, 0.775208, -0.616469, 0.137905, -0.198526, -0.444995, -0.873251, 1.000000, 0.287360, 0.011590, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017512, -0.096139, -0.024723, 0.873269, -0.434795, -0.219896, -0.205233, 0.081076, -0.975349, 1.000000, 0.294800, 0.007000, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017983, -0.094318, -0.026981, 0.815222, -0.167124, -0.554511, -0.292360, 0.707753, -0.643127, 1.000000, 0.303360, 0.004990, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018425, -0.094851, -0.027402, 0.707406, -0.271604, -0.652540, -0.303206, 0.717348, -0.627279, 1.000000, 0.303300, 0.006940, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019061, -0.091862, -0.028362, 0.598466, 0.111039, -0.793416, -0.164249, 0.986318, 0.014144, 1.000000, 0.312650, 0.006620, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019603, -0.092400, -0.028761, 0.438728, 0.022630, -0.898335, -0.164865, 0.984742, -0.055710, 1.000000, 0.311660, 0.008400, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021221, -0.090112, -0.028695, -0.033270, 0.354700, -0.934388, 0.128724, 0.928640, 0.347935, 1.000000, 0.317870, 0.012270, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020549, -0.089527, -0.028396, 0.188514, 0.475407, -0.859331, 0.154838, 0.849688, 0.504040, 1.000000, 0.319530, 0.010760, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018505, -0.091351, -0.027707, 0.733025, 0.172471, -0.657973, -0.167412, 0.983310, 0.071242, 1.000000, 0.313570, 0.004340, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019754, -0.089064, -0.027806, 0.428122, 0.560446, -0.708952, 0.123833, 0.740700, 0.660325, 1.000000, 0.321320, 0.008800, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017542, -0.093697, -0.026398, 0.879697, -0.087975, -0.467327, -0.279153, 0.700054, -0.657265, 1.000000, 0.303360, 0.002540, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017128, -0.095381, -0.024246, 0.933708, -0.317822, -0.164857, -0.162809, 0.033191, -0.986099, 1.000000, 0.293850, 0.004780, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022365, -0.087591, -0.026879, -0.105472, 0.708698, -0.697583, 0.377895, 0.677435, 0.631092, 1.000000, 0.324940, 0.017520, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023128, -0.088229, -0.027108, -0.334319, 0.534985, -0.775901, 0.323239, 0.838425, 0.438818, 1.000000, 0.322890, 0.019020, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021351, -0.087136, -0.026362, 0.174711, 0.825240, -0.537080, 0.359324, 0.454411, 0.815105, 1.000000, 0.327380, 0.015590, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017417, -0.096022, -0.021526, 0.880002, -0.440755, 0.177006, -0.100857, -0.537573, -0.837164, 1.000000, 0.285760, 0.009680, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023295, -0.085508, -0.023684, 0.085106, 0.913286, -0.398328, 0.560395, 0.286678, 0.777028, 1.000000, 0.332380, 0.025960, 15, 14, 1, 1, 0.993387, 0.006613, 0.000000, 0.000000 },
-	{ -0.024433, -0.085984, -0.024303, -0.185891, 0.809764, -0.556531, 0.550840, 0.554911, 0.623417, 1.000000, 0.329070, 0.027410, 15, 14, 1, 1, 0.995356, 0.004644, 0.000000, 0.000000 },
-	{ -0.025272, -0.086635, -0.024632, -0.399951, 0.632971, -0.662863, 0.448367, 0.765900, 0.460830, 1.000000, 0.326360, 0.028540, 15, 14, 1, 1, 0.996793, 0.003207, 0.000000, 0.000000 },
-	{ -0.025334, -0.084229, -0.020566, 0.040922, 0.943756, -0.328102, 0.681594, 0.213741, 0.699817, 1.000000, 0.335230, 0.037230, 15, 14, 1, 1, 0.957917, 0.042083, 0.000000, 0.000000 },
-	{ -0.026504, -0.084760, -0.021410, -0.198670, 0.861839, -0.466651, 0.657230, 0.470369, 0.588899, 1.000000, 0.331210, 0.037760, 15, 14, 1, 1, 0.963006, 0.036994, 0.000000, 0.000000 },
-	{ -0.028327, -0.083909, -0.018805, -0.198068, 0.888912, -0.413043, 0.721891, 0.417343, 0.551994, 1.000000, 0.331870, 0.047020, 15, 14, 1, 1, 0.869876, 0.130124, 0.000000, 0.000000 },
-	{ -0.027125, -0.083345, -0.017817, 0.003036, 0.957700, -0.287755, 0.749115, 0.188442, 0.635073, 1.000000, 0.336270, 0.047080, 15, 14, 1, 1, 0.854568, 0.145432, 0.000000, 0.000000 },
-	{ -0.029190, -0.084573, -0.019452, -0.362452, 0.773366, -0.520130, 0.661511, 0.606597, 0.440958, 1.000000, 0.328540, 0.046930, 15, 14, 1, 1, 0.874815, 0.125185, 0.000000, 0.000000 },
-	{ -0.027358, -0.085425, -0.021929, -0.387946, 0.717810, -0.578141, 0.570947, 0.679582, 0.460638, 1.000000, 0.328100, 0.038200, 15, 14, 1, 1, 0.967686, 0.032314, 0.000000, 0.000000 },
-	{ -0.029803, -0.085272, -0.019825, -0.521872, 0.591404, -0.614729, 0.553627, 0.783073, 0.283361, 1.000000, 0.325930, 0.046900, 15, 14, 1, 1, 0.896399, 0.103601, 0.000000, 0.000000 },
-	{ -0.027974, -0.086147, -0.022171, -0.555180, 0.505106, -0.660790, 0.439008, 0.852751, 0.282996, 1.000000, 0.325550, 0.038670, 15, 14, 1, 1, 0.981982, 0.018018, 0.000000, 0.000000 },
-	{ -0.025859, -0.087365, -0.024711, -0.564056, 0.415502, -0.713582, 0.315626, 0.907044, 0.278661, 1.000000, 0.324090, 0.029560, 15, 14, 1, 1, 0.998675, 0.001325, 0.000000, 0.000000 },
-	{ -0.023650, -0.088930, -0.027140, -0.501155, 0.357420, -0.788096, 0.253017, 0.931441, 0.261536, 1.000000, 0.320930, 0.020040, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021772, -0.090703, -0.028803, -0.218537, 0.228167, -0.948779, 0.088580, 0.972905, 0.213566, 1.000000, 0.316410, 0.013510, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020155, -0.092899, -0.028932, 0.240173, -0.094369, -0.966132, -0.167956, 0.976214, -0.137106, 1.000000, 0.310820, 0.009940, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018925, -0.095297, -0.027678, 0.515174, -0.415816, -0.749462, -0.297877, 0.733056, -0.611472, 1.000000, 0.303200, 0.008580, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.030301, -0.086078, -0.019976, -0.629872, 0.383572, -0.675377, 0.407708, 0.903399, 0.132836, 1.000000, 0.323390, 0.047030, 15, 14, 1, 1, 0.913190, 0.086810, 0.000000, 0.000000 },
-	{ -0.028454, -0.086954, -0.022185, -0.659879, 0.289374, -0.693414, 0.288087, 0.949775, 0.122204, 1.000000, 0.323090, 0.039260, 15, 14, 1, 1, 0.972131, 0.027869, 0.000000, 0.000000 },
-	{ -0.026294, -0.088149, -0.024636, -0.658674, 0.235049, -0.714773, 0.222730, 0.968290, 0.113167, 1.000000, 0.321810, 0.030460, 15, 14, 1, 1, 0.997205, 0.002795, 0.000000, 0.000000 },
-	{ -0.024061, -0.089631, -0.027073, -0.606147, 0.220108, -0.764289, 0.171561, 0.974506, 0.144586, 1.000000, 0.318980, 0.020900, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022274, -0.091267, -0.028746, -0.380410, 0.102217, -0.919152, 0.037321, 0.994761, 0.095179, 1.000000, 0.315120, 0.014700, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020736, -0.093324, -0.028930, 0.008454, -0.217277, -0.976074, -0.170564, 0.961491, -0.215508, 1.000000, 0.310150, 0.011480, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019540, -0.095618, -0.027796, 0.252620, -0.547095, -0.798042, -0.289232, 0.744382, -0.601864, 1.000000, 0.303190, 0.010160, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.030794, -0.087068, -0.019925, -0.668569, 0.221501, -0.709897, 0.285877, 0.957809, 0.029619, 1.000000, 0.320310, 0.047520, 15, 14, 1, 1, 0.909800, 0.090200, 0.000000, 0.000000 },
-	{ -0.028875, -0.087895, -0.022007, -0.701140, 0.136724, -0.699793, 0.184570, 0.982794, 0.007091, 1.000000, 0.320220, 0.040100, 15, 14, 1, 1, 0.973444, 0.026556, 0.000000, 0.000000 },
-	{ -0.026654, -0.089014, -0.024451, -0.710550, 0.103060, -0.696058, 0.154180, 0.987980, -0.011108, 1.000000, 0.319240, 0.031220, 15, 14, 1, 1, 0.995909, 0.004091, 0.000000, 0.000000 },
-	{ -0.024466, -0.090319, -0.026874, -0.680823, 0.098095, -0.725850, 0.082775, 0.994947, 0.056822, 1.000000, 0.317130, 0.022010, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022764, -0.091785, -0.028475, -0.537453, -0.041423, -0.842276, -0.023060, 0.999141, -0.034424, 1.000000, 0.313960, 0.016090, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021360, -0.093677, -0.028761, -0.284207, -0.358169, -0.889349, -0.174982, 0.931398, -0.319185, 1.000000, 0.309500, 0.013040, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020259, -0.095800, -0.027764, -0.110659, -0.638537, -0.761594, -0.285006, 0.754504, -0.591182, 1.000000, 0.303350, 0.011850, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.032931, -0.087736, -0.018196, -0.712215, 0.089413, -0.696244, 0.233234, 0.965647, -0.114575, 1.000000, 0.316130, 0.053810, 15, 14, 1, 1, 0.792562, 0.207438, 0.000000, 0.000000 },
-	{ -0.032460, -0.086459, -0.018190, -0.666200, 0.321872, -0.672738, 0.394695, 0.917550, 0.048144, 1.000000, 0.319820, 0.053780, 15, 14, 1, 1, 0.813132, 0.186868, 0.000000, 0.000000 },
-	{ -0.034377, -0.087335, -0.016505, -0.775639, 0.143190, -0.614721, 0.283510, 0.949187, -0.136627, 1.000000, 0.315230, 0.059240, 15, 14, 1, 1, 0.575790, 0.424210, 0.000000, 0.000000 },
-	{ -0.033059, -0.089360, -0.017937, -0.722122, -0.282525, -0.631443, -0.019333, 0.920684, -0.389830, 1.000000, 0.312050, 0.053490, 15, 14, 1, 1, 0.808795, 0.191205, 0.000000, 0.000000 },
-	{ -0.034470, -0.089010, -0.016330, -0.792924, -0.268500, -0.546974, -0.024384, 0.910941, -0.411816, 1.000000, 0.311150, 0.058520, 15, 14, 1, 1, 0.616940, 0.383060, 0.000000, 0.000000 },
-	{ -0.032409, -0.091601, -0.017033, -0.667272, -0.537232, -0.515879, -0.197426, 0.795429, -0.572989, 1.000000, 0.305330, 0.052350, 15, 14, 1, 1, 0.844906, 0.155094, 0.000000, 0.000000 },
-	{ -0.033778, -0.091281, -0.015413, -0.727434, -0.532395, -0.432892, -0.219960, 0.778507, -0.587830, 1.000000, 0.304500, 0.057260, 15, 14, 1, 1, 0.629858, 0.370142, 0.000000, 0.000000 },
-	{ -0.032352, -0.093891, -0.013897, -0.648526, -0.682467, -0.337124, -0.340671, 0.656287, -0.673224, 1.000000, 0.294780, 0.055250, 15, 14, 1, 1, 0.683968, 0.316032, 0.000000, 0.000000 },
-	{ -0.030986, -0.094169, -0.015593, -0.592890, -0.690579, -0.414225, -0.314848, 0.672228, -0.670060, 1.000000, 0.295490, 0.050280, 15, 14, 1, 1, 0.858334, 0.141666, 0.000000, 0.000000 },
-	{ -0.030700, -0.095714, -0.012343, -0.473053, -0.860131, -0.190778, -0.499679, 0.440271, -0.745977, 1.000000, 0.286990, 0.053620, 15, 14, 1, 1, 0.646858, 0.353142, 0.000000, 0.000000 },
-	{ -0.029326, -0.095964, -0.014210, -0.424800, -0.870870, -0.247247, -0.467181, 0.444824, -0.764116, 1.000000, 0.287950, 0.048250, 15, 14, 1, 1, 0.868798, 0.131202, 0.000000, 0.000000 },
-	{ -0.029076, -0.096300, -0.010979, -0.196054, -0.980593, -0.000755, -0.599956, 0.120561, -0.790897, 1.000000, 0.281190, 0.052520, 15, 14, 1, 1, 0.536128, 0.463872, 0.000000, 0.000000 },
-	{ -0.027670, -0.096491, -0.013028, -0.182520, -0.982642, -0.033172, -0.560036, 0.131636, -0.817944, 1.000000, 0.282690, 0.046500, 15, 14, 1, 1, 0.797524, 0.202476, 0.000000, 0.000000 },
-	{ -0.033905, -0.085995, -0.016332, -0.703633, 0.385813, -0.596698, 0.459779, 0.887470, 0.031644, 1.000000, 0.319110, 0.059800, 15, 14, 1, 1, 0.598915, 0.401085, 0.000000, 0.000000 },
-	{ -0.031917, -0.085400, -0.018049, -0.613642, 0.472839, -0.632351, 0.505408, 0.850521, 0.145520, 1.000000, 0.323180, 0.053840, 15, 14, 1, 1, 0.770190, 0.229810, 0.000000, 0.000000 },
-	{ -0.033348, -0.084876, -0.016091, -0.639655, 0.512654, -0.572737, 0.545380, 0.827758, 0.131821, 1.000000, 0.322680, 0.060230, 15, 14, 1, 1, 0.542282, 0.457718, 0.000000, 0.000000 },
-	{ -0.031376, -0.084605, -0.017783, -0.503457, 0.647449, -0.572137, 0.617591, 0.732753, 0.285753, 1.000000, 0.325760, 0.054010, 15, 14, 1, 1, 0.732033, 0.267967, 0.000000, 0.000000 },
-	{ -0.032783, -0.084063, -0.015825, -0.521114, 0.667808, -0.531482, 0.647860, 0.714900, 0.263051, 1.000000, 0.325310, 0.060450, 15, 14, 1, 1, 0.557773, 0.442227, 0.000000, 0.000000 },
-	{ -0.030732, -0.083939, -0.017377, -0.347752, 0.802152, -0.485409, 0.702809, 0.565697, 0.431330, 1.000000, 0.328350, 0.054120, 15, 14, 1, 1, 0.738039, 0.261961, 0.000000, 0.000000 },
-	{ -0.032096, -0.083405, -0.015443, -0.358369, 0.811212, -0.462068, 0.733522, 0.550836, 0.398152, 1.000000, 0.327940, 0.060560, 15, 14, 1, 1, 0.568333, 0.431667, 0.000000, 0.000000 },
-	{ -0.031132, -0.082777, -0.014811, -0.191189, 0.903850, -0.382756, 0.782396, 0.375802, 0.496617, 1.000000, 0.331400, 0.060710, 15, 14, 1, 1, 0.533756, 0.466244, 0.000000, 0.000000 },
-	{ -0.029818, -0.083314, -0.016704, -0.189904, 0.902600, -0.386328, 0.753283, 0.386315, 0.532284, 1.000000, 0.331750, 0.054270, 15, 14, 1, 1, 0.726294, 0.273706, 0.000000, 0.000000 },
-	{ -0.028557, -0.082790, -0.015680, -0.011114, 0.964324, -0.264493, 0.772237, 0.176314, 0.610380, 1.000000, 0.336290, 0.054460, 15, 14, 1, 1, 0.691293, 0.308707, 0.000000, 0.000000 },
-	{ -0.029810, -0.082280, -0.013832, 0.003074, 0.960356, -0.278761, 0.794531, 0.166924, 0.583830, 1.000000, 0.336010, 0.060910, 14, 15, 1, 1, 0.514376, 0.485624, 0.000000, 0.000000 },
-	{ -0.027690, -0.096293, -0.009988, 0.017348, -0.988870, 0.147770, -0.601550, -0.128374, -0.788453, 1.000000, 0.276700, 0.051160, 14, 15, 1, 1, 0.537681, 0.462319, 0.000000, 0.000000 },
-	{ -0.026287, -0.096549, -0.012132, -0.011582, -0.993527, 0.113006, -0.581039, -0.085289, -0.809395, 1.000000, 0.278390, 0.044900, 15, 14, 1, 1, 0.762880, 0.237120, 0.000000, 0.000000 },
-	{ -0.026657, -0.095998, -0.009327, 0.177695, -0.946066, 0.270894, -0.578114, -0.323123, -0.749251, 1.000000, 0.273590, 0.050070, 15, 14, 1, 1, 0.509459, 0.490541, 0.000000, 0.000000 },
-	{ -0.025265, -0.096334, -0.011472, 0.146264, -0.960044, 0.238586, -0.567609, -0.278974, -0.774592, 1.000000, 0.275360, 0.043790, 15, 14, 1, 1, 0.717604, 0.282396, 0.000000, 0.000000 },
-	{ -0.025908, -0.095608, -0.008837, 0.301818, -0.884127, 0.356687, -0.558679, -0.467186, -0.685285, 1.000000, 0.271180, 0.049250, 14, 15, 1, 1, 0.509074, 0.490926, 0.000000, 0.000000 },
-	{ -0.024516, -0.095986, -0.010949, 0.295452, -0.893097, 0.339245, -0.524736, -0.448442, -0.723569, 1.000000, 0.272930, 0.043000, 15, 14, 1, 1, 0.718932, 0.281068, 0.000000, 0.000000 },
-	{ -0.025354, -0.095155, -0.008400, 0.436827, -0.790839, 0.428667, -0.511838, -0.610393, -0.604519, 1.000000, 0.269090, 0.048930, 14, 15, 1, 1, 0.533773, 0.466227, 0.000000, 0.000000 },
-	{ -0.023937, -0.095528, -0.010499, 0.446341, -0.787519, 0.424963, -0.451771, -0.608235, -0.652651, 1.000000, 0.270830, 0.042460, 15, 14, 1, 1, 0.712300, 0.287700, 0.000000, 0.000000 },
-	{ -0.024849, -0.094544, -0.008029, 0.576297, -0.654380, 0.489560, -0.396620, -0.747714, -0.532556, 1.000000, 0.266910, 0.048480, 14, 15, 1, 1, 0.566195, 0.433805, 0.000000, 0.000000 },
-	{ -0.023399, -0.094889, -0.010100, 0.577512, -0.650661, 0.493072, -0.351556, -0.743312, -0.569118, 1.000000, 0.268550, 0.041800, 15, 14, 1, 1, 0.702920, 0.297080, 0.000000, 0.000000 },
-	{ -0.024283, -0.093650, -0.007721, 0.697139, -0.474783, 0.537195, -0.242800, -0.861367, -0.446201, 1.000000, 0.264140, 0.047560, 14, 15, 1, 1, 0.569248, 0.430752, 0.000000, 0.000000 },
-	{ -0.022840, -0.093967, -0.009732, 0.686710, -0.478867, 0.546915, -0.218447, -0.853527, -0.473046, 1.000000, 0.265710, 0.040910, 15, 14, 1, 1, 0.693428, 0.306572, 0.000000, 0.000000 },
-	{ -0.024785, -0.096853, -0.014562, -0.067531, -0.993846, 0.087803, -0.548536, -0.036525, -0.835329, 1.000000, 0.280810, 0.038000, 15, 14, 1, 1, 0.950655, 0.049345, 0.000000, 0.000000 },
-	{ -0.023802, -0.096741, -0.013980, 0.097710, -0.972327, 0.212210, -0.551306, -0.230407, -0.801857, 1.000000, 0.278040, 0.036770, 15, 14, 1, 1, 0.913887, 0.086113, 0.000000, 0.000000 },
-	{ -0.023185, -0.097234, -0.017242, -0.131137, -0.989708, 0.057282, -0.496195, 0.015504, -0.868072, 1.000000, 0.283750, 0.030780, 15, 14, 1, 1, 0.995403, 0.004597, 0.000000, 0.000000 },
-	{ -0.022270, -0.097210, -0.016788, 0.046429, -0.982451, 0.180648, -0.502542, -0.179264, -0.845763, 1.000000, 0.281500, 0.029330, 15, 14, 1, 1, 0.990848, 0.009152, 0.000000, 0.000000 },
-	{ -0.023053, -0.096440, -0.013466, 0.271153, -0.908522, 0.317905, -0.506385, -0.415524, -0.755589, 1.000000, 0.275690, 0.035910, 15, 14, 1, 1, 0.902913, 0.097087, 0.000000, 0.000000 },
-	{ -0.021532, -0.096997, -0.016356, 0.238066, -0.927720, 0.287506, -0.466138, -0.368833, -0.804163, 1.000000, 0.279450, 0.028250, 15, 14, 1, 1, 0.984580, 0.015420, 0.000000, 0.000000 },
-	{ -0.022438, -0.095987, -0.013010, 0.440638, -0.801804, 0.403669, -0.423876, -0.582231, -0.693784, 1.000000, 0.273530, 0.035180, 15, 14, 1, 1, 0.895348, 0.104652, 0.000000, 0.000000 },
-	{ -0.020900, -0.096601, -0.015939, 0.432475, -0.819963, 0.375001, -0.388789, -0.544844, -0.742959, 1.000000, 0.277480, 0.027290, 15, 14, 1, 1, 0.979462, 0.020538, 0.000000, 0.000000 },
-	{ -0.021858, -0.095344, -0.012587, 0.588726, -0.661242, 0.464931, -0.319905, -0.718809, -0.617231, 1.000000, 0.271200, 0.034340, 15, 14, 1, 1, 0.889191, 0.110809, 0.000000, 0.000000 },
-	{ -0.020317, -0.095985, -0.015532, 0.609272, -0.664949, 0.432009, -0.279473, -0.689914, -0.667768, 1.000000, 0.275320, 0.026260, 15, 14, 1, 1, 0.973484, 0.026516, 0.000000, 0.000000 },
-	{ -0.021283, -0.094412, -0.012188, 0.713546, -0.488528, 0.502188, -0.192913, -0.826081, -0.529505, 1.000000, 0.268370, 0.033240, 15, 14, 1, 1, 0.888918, 0.111082, 0.000000, 0.000000 },
-	{ -0.019764, -0.095064, -0.015155, 0.751437, -0.479486, 0.453250, -0.158956, -0.798270, -0.580946, 1.000000, 0.272700, 0.024960, 15, 14, 1, 1, 0.971722, 0.028278, 0.000000, 0.000000 },
-	{ -0.018892, -0.096642, -0.018718, 0.664568, -0.661641, 0.347248, -0.237531, -0.627667, -0.741359, 1.000000, 0.280770, 0.018340, 15, 14, 1, 1, 0.997275, 0.002725, 0.000000, 0.000000 },
-	{ -0.019462, -0.097213, -0.019089, 0.466535, -0.835450, 0.290464, -0.345673, -0.474491, -0.809549, 1.000000, 0.282580, 0.019570, 15, 14, 1, 1, 0.998539, 0.001461, 0.000000, 0.000000 },
-	{ -0.018381, -0.095758, -0.018387, 0.803947, -0.465229, 0.370448, -0.119902, -0.736924, -0.665257, 1.000000, 0.278600, 0.016760, 15, 14, 1, 1, 0.996124, 0.003876, 0.000000, 0.000000 },
-	{ -0.020101, -0.097537, -0.019438, 0.237659, -0.948850, 0.207850, -0.414017, -0.292521, -0.861987, 1.000000, 0.284150, 0.020800, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020820, -0.097671, -0.019763, 0.020165, -0.993325, 0.113576, -0.454252, -0.110299, -0.884019, 1.000000, 0.285690, 0.022190, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021640, -0.097614, -0.020135, -0.175902, -0.984377, 0.007807, -0.477583, 0.078401, -0.875082, 1.000000, 0.287430, 0.023700, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019558, 0.013485, 0.054129, -0.245344, 0.969412, -0.006856, 0.051707, 0.006023, -0.998644, 1.000000, 0.261400, 0.512900, 21, 1, 22, 1, 0.669063, 0.297965, 0.032973, 0.000000 },
-	{ -0.016339, 0.013954, 0.049141, -0.225323, 0.969942, -0.091883, 0.021821, -0.089260, -0.995769, 1.000000, 0.275950, 0.521000, 21, 22, 1, 1, 0.711150, 0.156815, 0.132035, 0.000000 },
-	{ -0.012691, 0.015033, 0.051683, -0.228566, 0.972446, -0.045897, 0.047126, -0.036038, -0.998239, 1.000000, 0.268570, 0.531060, 21, 22, 1, 1, 0.768665, 0.128977, 0.102358, 0.000000 },
-	{ -0.016155, 0.014319, 0.057055, -0.227571, 0.973207, 0.032866, 0.078041, 0.051872, -0.995600, 1.000000, 0.254040, 0.522630, 21, 1, 22, 1, 0.728398, 0.250934, 0.020668, 0.000000 },
-	{ -0.019482, 0.012955, 0.046386, -0.206298, 0.970271, -0.126554, 0.010653, -0.127102, -0.991833, 1.000000, 0.283490, 0.512580, 21, 1, 22, 4, 0.614632, 0.216224, 0.167289, 0.001855 },
-	{ -0.022563, 0.012631, 0.050762, -0.251229, 0.967185, -0.037919, 0.028953, -0.031648, -0.999080, 1.000000, 0.270760, 0.504470, 21, 1, 22, 1, 0.576594, 0.371413, 0.051993, 0.000000 },
-	{ -0.023598, 0.012252, 0.060387, -0.296105, 0.950331, 0.095878, 0.093463, 0.128726, -0.987266, 1.000000, 0.244750, 0.503110, 21, 1, 22, 1, 0.546362, 0.450145, 0.003493, 0.000000 },
-	{ -0.020375, 0.012843, 0.063790, -0.272954, 0.953548, 0.127447, 0.126446, 0.166888, -0.977834, 1.000000, 0.236040, 0.512790, 21, 1, 22, 1, 0.602942, 0.395739, 0.001319, 0.000000 },
-	{ -0.026202, 0.011653, 0.056223, -0.298870, 0.953125, 0.047215, 0.059896, 0.068115, -0.995878, 1.000000, 0.255010, 0.495200, 1, 21, 22, 1, 0.513962, 0.477331, 0.008707, 0.000000 },
-	{ -0.029048, 0.008944, 0.069003, -0.358613, 0.915698, 0.181366, 0.153856, 0.249611, -0.956045, 1.000000, 0.221600, 0.491570, 1, 21, 1, 1, 0.647995, 0.352005, 0.000000, 0.000000 },
-	{ -0.025162, 0.009803, 0.072042, -0.320126, 0.923966, 0.209300, 0.175804, 0.275026, -0.945227, 1.000000, 0.213460, 0.503590, 1, 21, 1, 1, 0.577366, 0.422634, 0.000000, 0.000000 },
-	{ -0.029633, 0.005591, 0.081210, -0.328520, 0.913660, 0.239375, 0.216196, 0.319456, -0.922609, 1.000000, 0.188750, 0.496650, 1, 21, 1, 1, 0.745260, 0.254740, 0.000000, 0.000000 },
-	{ -0.032635, 0.004738, 0.080012, -0.368300, 0.904369, 0.215574, 0.205319, 0.305267, -0.929869, 1.000000, 0.191700, 0.487560, 1, 21, 1, 1, 0.790456, 0.209544, 0.000000, 0.000000 },
-	{ -0.035875, 0.003187, 0.080576, -0.395421, 0.897698, 0.194371, 0.207534, 0.293466, -0.933171, 1.000000, 0.190280, 0.478920, 1, 21, 1, 1, 0.862264, 0.137736, 0.000000, 0.000000 },
-	{ -0.034191, 0.005845, 0.072823, -0.399789, 0.893233, 0.205681, 0.166273, 0.291343, -0.942058, 1.000000, 0.210670, 0.479300, 1, 21, 1, 1, 0.793863, 0.206137, 0.000000, 0.000000 },
-	{ -0.030164, 0.009830, 0.061809, -0.351294, 0.927523, 0.127648, 0.112577, 0.177194, -0.977716, 1.000000, 0.240600, 0.486000, 1, 21, 22, 1, 0.659401, 0.339515, 0.001085, 0.000000 },
-	{ -0.033970, 0.007281, 0.066563, -0.410358, 0.895093, 0.174400, 0.130704, 0.246999, -0.960161, 1.000000, 0.227550, 0.477390, 1, 21, 1, 1, 0.783533, 0.216467, 0.000000, 0.000000 },
-	{ -0.008883, 0.015955, 0.053731, -0.188663, 0.981711, 0.025486, 0.063046, 0.038006, -0.997287, 1.000000, 0.263410, 0.541820, 21, 22, 1, 1, 0.795356, 0.126961, 0.077683, 0.000000 },
-	{ -0.012598, 0.014926, 0.059507, -0.177644, 0.979861, 0.091184, 0.095353, 0.109361, -0.989418, 1.000000, 0.247980, 0.533070, 21, 1, 22, 1, 0.757942, 0.230438, 0.011620, 0.000000 },
-	{ -0.017067, 0.013251, 0.066614, -0.204487, 0.962059, 0.180634, 0.137347, 0.210907, -0.967809, 1.000000, 0.228560, 0.523090, 21, 1, 1, 1, 0.632413, 0.367587, 0.000000, 0.000000 },
-	{ -0.022164, 0.010053, 0.074676, -0.243254, 0.932165, 0.268135, 0.181762, 0.315349, -0.931406, 1.000000, 0.206430, 0.513040, 1, 21, 1, 1, 0.547691, 0.452309, 0.000000, 0.000000 },
-	{ -0.027073, 0.005849, 0.083096, -0.241915, 0.925599, 0.291108, 0.221667, 0.344805, -0.912126, 1.000000, 0.184070, 0.504920, 1, 21, 1, 1, 0.725390, 0.274610, 0.000000, 0.000000 },
-	{ -0.031685, 0.009676, 0.057300, -0.368603, 0.927530, 0.061814, 0.080895, 0.098250, -0.991869, 1.000000, 0.251850, 0.480720, 1, 21, 22, 1, 0.721397, 0.275938, 0.002666, 0.000000 },
-	{ -0.028404, 0.010954, 0.052216, -0.315362, 0.948955, -0.005568, 0.042562, 0.008283, -0.999060, 1.000000, 0.265940, 0.488750, 1, 21, 22, 1, 0.609363, 0.375091, 0.015546, 0.000000 },
-	{ -0.033310, 0.009104, 0.053711, -0.392019, 0.919863, 0.013190, 0.062450, 0.040914, -0.997209, 1.000000, 0.261390, 0.475640, 1, 21, 22, 1, 0.806931, 0.189455, 0.003614, 0.000000 },
-	{ -0.030344, 0.010182, 0.048687, -0.344549, 0.937727, -0.044202, 0.037875, -0.033161, -0.998732, 1.000000, 0.275390, 0.483080, 1, 21, 22, 4, 0.722163, 0.256659, 0.018126, 0.003052 },
-	{ -0.034963, 0.008315, 0.050641, -0.422564, 0.905977, -0.025402, 0.056999, -0.001407, -0.998373, 1.000000, 0.269510, 0.470610, 1, 21, 22, 4, 0.886299, 0.108524, 0.003190, 0.001988 },
-	{ -0.032153, 0.009261, 0.045589, -0.378236, 0.922466, -0.077423, 0.036649, -0.068649, -0.996968, 1.000000, 0.283580, 0.477720, 1, 21, 22, 4, 0.822308, 0.150963, 0.014479, 0.012249 },
-	{ -0.027351, 0.010861, 0.044316, -0.285649, 0.952417, -0.106330, 0.018658, -0.105405, -0.994254, 1.000000, 0.287980, 0.491050, 1, 21, 22, 4, 0.611190, 0.313374, 0.061224, 0.014212 },
-	{ -0.029339, 0.009843, 0.041445, -0.310433, 0.940745, -0.136493, 0.029109, -0.134112, -0.990539, 1.000000, 0.295770, 0.485380, 1, 21, 4, 22, 0.709935, 0.192452, 0.052723, 0.044891 },
-	{ -0.024708, 0.011004, 0.041116, -0.197020, 0.958918, -0.204105, 0.032424, -0.201699, -0.978911, 1.000000, 0.297390, 0.498110, 1, 21, 22, 4, 0.490730, 0.347461, 0.124758, 0.037052 },
-	{ -0.026865, 0.009963, 0.038533, -0.201197, 0.951994, -0.230711, 0.049487, -0.225348, -0.973021, 1.000000, 0.304120, 0.491850, 1, 21, 22, 4, 0.598890, 0.225215, 0.096983, 0.078912 },
-	{ -0.035942, 0.007595, 0.058813, -0.443428, 0.891901, 0.088796, 0.091379, 0.143537, -0.985417, 1.000000, 0.247840, 0.469570, 1, 21, 1, 1, 0.873711, 0.126289, 0.000000, 0.000000 },
-	{ -0.037411, 0.007076, 0.056008, -0.460150, 0.886460, 0.049506, 0.075275, 0.094512, -0.992674, 1.000000, 0.255300, 0.464900, 1, 21, 1, 1, 0.928371, 0.071629, 0.000000, 0.000000 },
-	{ -0.022257, 0.012005, 0.043708, -0.196113, 0.966578, -0.165129, 0.016786, -0.165065, -0.986140, 1.000000, 0.290580, 0.504960, 21, 1, 22, 4, 0.485939, 0.355414, 0.149479, 0.009168 },
-	{ -0.025123, 0.011774, 0.047386, -0.262772, 0.962326, -0.069856, 0.020472, -0.066823, -0.997555, 1.000000, 0.279880, 0.497280, 1, 21, 22, 4, 0.483030, 0.450431, 0.063186, 0.003354 },
-	{ -0.034722, 0.007751, 0.062154, -0.426769, 0.894605, 0.132476, 0.111782, 0.197543, -0.973900, 1.000000, 0.239120, 0.473840, 1, 21, 1, 1, 0.817632, 0.182368, 0.000000, 0.000000 },
-	{ -0.037389, 0.005468, 0.066969, -0.455883, 0.873953, 0.168458, 0.128899, 0.252105, -0.959077, 1.000000, 0.226010, 0.468090, 1, 21, 1, 1, 0.888658, 0.111342, 0.000000, 0.000000 },
-	{ -0.036928, 0.004999, 0.070441, -0.443430, 0.877127, 0.184443, 0.142918, 0.272340, -0.951528, 1.000000, 0.216770, 0.470750, 1, 21, 1, 1, 0.869700, 0.130300, 0.000000, 0.000000 },
-	{ -0.037349, 0.003710, 0.075395, -0.428226, 0.881419, 0.199308, 0.175611, 0.297517, -0.938427, 1.000000, 0.203720, 0.471900, 1, 21, 1, 1, 0.882056, 0.117944, 0.000000, 0.000000 },
-	{ -0.038594, 0.001708, 0.081595, -0.416095, 0.893550, 0.168622, 0.210898, 0.275211, -0.937966, 1.000000, 0.187470, 0.471910, 1, 21, 1, 1, 0.919295, 0.080705, 0.000000, 0.000000 },
-	{ -0.038381, 0.005454, 0.064272, -0.469936, 0.870226, 0.147873, 0.117236, 0.227572, -0.966678, 1.000000, 0.233170, 0.464360, 1, 21, 1, 1, 0.922732, 0.077268, 0.000000, 0.000000 },
-	{ -0.039450, 0.002341, 0.076744, -0.436148, 0.880143, 0.187415, 0.182030, 0.290253, -0.939478, 1.000000, 0.200100, 0.466610, 1, 21, 1, 1, 0.931727, 0.068273, 0.000000, 0.000000 },
-	{ -0.040684, 0.000596, 0.082231, -0.418684, 0.895843, 0.148893, 0.212902, 0.256214, -0.942882, 1.000000, 0.185630, 0.466300, 1, 21, 1, 1, 0.957494, 0.042506, 0.000000, 0.000000 },
-	{ -0.042318, -0.000170, 0.082269, -0.413247, 0.899688, 0.140673, 0.211539, 0.245101, -0.946138, 1.000000, 0.185370, 0.461550, 1, 21, 1, 1, 0.976961, 0.023039, 0.000000, 0.000000 },
-	{ -0.040917, 0.001613, 0.076680, -0.436790, 0.881744, 0.178163, 0.177502, 0.278641, -0.943850, 1.000000, 0.200130, 0.462350, 1, 21, 1, 1, 0.957202, 0.042798, 0.000000, 0.000000 },
-	{ -0.043709, -0.000732, 0.081837, -0.413837, 0.899800, 0.138202, 0.205593, 0.240267, -0.948685, 1.000000, 0.186360, 0.457200, 1, 21, 1, 1, 0.987146, 0.012854, 0.000000, 0.000000 },
-	{ -0.042210, 0.001122, 0.075875, -0.443755, 0.879712, 0.170850, 0.166542, 0.268284, -0.948835, 1.000000, 0.202140, 0.458200, 1, 21, 1, 1, 0.974211, 0.025789, 0.000000, 0.000000 },
-	{ -0.045014, -0.001219, 0.081146, -0.422553, 0.896333, 0.134298, 0.197829, 0.235818, -0.951448, 1.000000, 0.188030, 0.452920, 1, 21, 1, 1, 0.993473, 0.006527, 0.000000, 0.000000 },
-	{ -0.043529, 0.000646, 0.074819, -0.452558, 0.876687, 0.163128, 0.158308, 0.259013, -0.952812, 1.000000, 0.204830, 0.453860, 1, 21, 1, 1, 0.986296, 0.013704, 0.000000, 0.000000 },
-	{ -0.040499, 0.003194, 0.070018, -0.464576, 0.869009, 0.170272, 0.138739, 0.261336, -0.955225, 1.000000, 0.217700, 0.460480, 1, 21, 1, 1, 0.955037, 0.044963, 0.000000, 0.000000 },
-	{ -0.041791, 0.002817, 0.068380, -0.472300, 0.866629, 0.160896, 0.130264, 0.249160, -0.959662, 1.000000, 0.221960, 0.456130, 1, 21, 1, 1, 0.975064, 0.024936, 0.000000, 0.000000 },
-	{ -0.039419, 0.003432, 0.071664, -0.457232, 0.871296, 0.178274, 0.145675, 0.271122, -0.951458, 1.000000, 0.213390, 0.464260, 1, 21, 1, 1, 0.932860, 0.067140, 0.000000, 0.000000 },
-	{ -0.038665, 0.003559, 0.072945, -0.451547, 0.872766, 0.185429, 0.154789, 0.281296, -0.947055, 1.000000, 0.210060, 0.466930, 1, 21, 1, 1, 0.915439, 0.084561, 0.000000, 0.000000 },
-	{ -0.039696, 0.005135, 0.061968, -0.479639, 0.868490, 0.125186, 0.106021, 0.198983, -0.974251, 1.000000, 0.239290, 0.459930, 1, 21, 1, 1, 0.956440, 0.043560, 0.000000, 0.000000 },
-	{ -0.024683, 0.005626, 0.085057, -0.116160, 0.923344, 0.365981, 0.230860, 0.383483, -0.894228, 1.000000, 0.179410, 0.512660, 1, 21, 1, 1, 0.721435, 0.278565, 0.000000, 0.000000 },
-	{ -0.019395, 0.009898, 0.076832, -0.124560, 0.927631, 0.352117, 0.185230, 0.370381, -0.910224, 1.000000, 0.201400, 0.521530, 1, 21, 1, 1, 0.539901, 0.460099, 0.000000, 0.000000 },
-	{ -0.016321, 0.009134, 0.079069, -0.012747, 0.906350, 0.422336, 0.219647, 0.414593, -0.883102, 1.000000, 0.196180, 0.530900, 1, 21, 1, 1, 0.543407, 0.456593, 0.000000, 0.000000 },
-	{ -0.022079, 0.004737, 0.087396, -0.008939, 0.904481, 0.426421, 0.264281, 0.413412, -0.871347, 1.000000, 0.173080, 0.521510, 1, 21, 1, 1, 0.731445, 0.268555, 0.000000, 0.000000 },
-	{ -0.010523, 0.012762, 0.070731, 0.039427, 0.935422, 0.351330, 0.169532, 0.340243, -0.924929, 1.000000, 0.219200, 0.542350, 21, 1, 1, 1, 0.640602, 0.359398, 0.000000, 0.000000 },
-	{ -0.013913, 0.013305, 0.068782, -0.091265, 0.959416, 0.266817, 0.137592, 0.277514, -0.950818, 1.000000, 0.223400, 0.532300, 21, 1, 1, 1, 0.642078, 0.357922, 0.000000, 0.000000 },
-	{ -0.005623, 0.014767, 0.063156, 0.075340, 0.956200, 0.282852, 0.128910, 0.271939, -0.953641, 1.000000, 0.239720, 0.553280, 21, 1, 22, 1, 0.769783, 0.214936, 0.015281, 0.000000 },
-	{ -0.009158, 0.015155, 0.061480, -0.072117, 0.980851, 0.180917, 0.106074, 0.187903, -0.976443, 1.000000, 0.243280, 0.542960, 21, 1, 22, 1, 0.768796, 0.217122, 0.014082, 0.000000 },
-	{ -0.001733, 0.016191, 0.057014, 0.073316, 0.966571, 0.245693, 0.113633, 0.236655, -0.964926, 1.000000, 0.255670, 0.561810, 21, 22, 1, 1, 0.806855, 0.137143, 0.056002, 0.000000 },
-	{ -0.005254, 0.016405, 0.055458, -0.084851, 0.988115, 0.128177, 0.081204, 0.135071, -0.987503, 1.000000, 0.259220, 0.551920, 21, 22, 1, 1, 0.804773, 0.132790, 0.062436, 0.000000 },
-	{ 0.001713, 0.015125, 0.058550, 0.254783, 0.904650, 0.341606, 0.150172, 0.311963, -0.938151, 1.000000, 0.251800, 0.572050, 21, 22, 1, 1, 0.805987, 0.144170, 0.049842, 0.000000 },
-	{ -0.001949, 0.013519, 0.065040, 0.225768, 0.906081, 0.357836, 0.165331, 0.326354, -0.930677, 1.000000, 0.234920, 0.564770, 21, 1, 22, 1, 0.765222, 0.223649, 0.011129, 0.000000 },
-	{ -0.006693, 0.011341, 0.073207, 0.156536, 0.899537, 0.407835, 0.202743, 0.374867, -0.904638, 1.000000, 0.212070, 0.555550, 21, 1, 1, 1, 0.632536, 0.367464, 0.000000, 0.000000 },
-	{ -0.012523, 0.007654, 0.081886, 0.077361, 0.878970, 0.470560, 0.254544, 0.438921, -0.861717, 1.000000, 0.187740, 0.544900, 1, 21, 1, 1, 0.552846, 0.447154, 0.000000, 0.000000 },
-	{ -0.018815, 0.003383, 0.089976, 0.077631, 0.871481, 0.484246, 0.303246, 0.442058, -0.844172, 1.000000, 0.164960, 0.533740, 1, 21, 1, 1, 0.751954, 0.248046, 0.000000, 0.000000 },
-	{ -0.008827, 0.005877, 0.084138, 0.235614, 0.808928, 0.538630, 0.272470, 0.477022, -0.835590, 1.000000, 0.181600, 0.557310, 1, 21, 1, 1, 0.564675, 0.435325, 0.000000, 0.000000 },
-	{ -0.015150, 0.001909, 0.091672, 0.203689, 0.790273, 0.577910, 0.340807, 0.496131, -0.798564, 1.000000, 0.160770, 0.547000, 1, 21, 1, 1, 0.765873, 0.234127, 0.000000, 0.000000 },
-	{ -0.003232, 0.009276, 0.075563, 0.333879, 0.817430, 0.469396, 0.214196, 0.419151, -0.882288, 1.000000, 0.204780, 0.567200, 21, 1, 1, 1, 0.621581, 0.378419, 0.000000, 0.000000 },
-	{ 0.001335, 0.011471, 0.067077, 0.419069, 0.805555, 0.418883, 0.188916, 0.373891, -0.908029, 1.000000, 0.228480, 0.575750, 21, 1, 22, 1, 0.757970, 0.232908, 0.009122, 0.000000 },
-	{ 0.004780, 0.013156, 0.060093, 0.470210, 0.783687, 0.405878, 0.184578, 0.362396, -0.913565, 1.000000, 0.247050, 0.582190, 21, 22, 1, 1, 0.803990, 0.114707, 0.081304, 0.000000 },
-	{ -0.005559, 0.003413, 0.085421, 0.484296, 0.629062, 0.608062, 0.317046, 0.521581, -0.792108, 1.000000, 0.176870, 0.569010, 1, 21, 1, 1, 0.577868, 0.422132, 0.000000, 0.000000 },
-	{ -0.011703, -0.000120, 0.092669, 0.396250, 0.622685, 0.674722, 0.394909, 0.547839, -0.737509, 1.000000, 0.157260, 0.559160, 1, 21, 1, 1, 0.795858, 0.204142, 0.000000, 0.000000 },
-	{ -0.002789, -0.000360, 0.085811, 0.711427, 0.343161, 0.613279, 0.377009, 0.550100, -0.745154, 1.000000, 0.172300, 0.582080, 1, 21, 1, 1, 0.594827, 0.405173, 0.000000, 0.000000 },
-	{ -0.008858, -0.003315, 0.093181, 0.607318, 0.370201, 0.702934, 0.446179, 0.573144, -0.687336, 1.000000, 0.153000, 0.571990, 1, 21, 1, 1, 0.837943, 0.162057, 0.000000, 0.000000 },
-	{ 0.002284, 0.002492, 0.077180, 0.774317, 0.344628, 0.530721, 0.327116, 0.499947, -0.801903, 1.000000, 0.195620, 0.590750, 21, 1, 1, 1, 0.603009, 0.396991, 0.000000, 0.000000 },
-	{ -0.000257, 0.006441, 0.076942, 0.582716, 0.620640, 0.524640, 0.261362, 0.468153, -0.844111, 1.000000, 0.199900, 0.578220, 21, 1, 1, 1, 0.610789, 0.389211, 0.000000, 0.000000 },
-	{ 0.006236, 0.004761, 0.068907, 0.813615, 0.356890, 0.458978, 0.278964, 0.452993, -0.846745, 1.000000, 0.218190, 0.597480, 21, 1, 22, 1, 0.745904, 0.243602, 0.010494, 0.000000 },
-	{ 0.004038, 0.008590, 0.068531, 0.650085, 0.602749, 0.462692, 0.228655, 0.425519, -0.875586, 1.000000, 0.222580, 0.585960, 21, 1, 22, 1, 0.750746, 0.236560, 0.012694, 0.000000 },
-	{ 0.009154, 0.006570, 0.061726, 0.847380, 0.340748, 0.407232, 0.248028, 0.424117, -0.870980, 1.000000, 0.237600, 0.602760, 21, 22, 1, 1, 0.796918, 0.114096, 0.088987, 0.000000 },
-	{ 0.007257, 0.010300, 0.061284, 0.695399, 0.576246, 0.429372, 0.216572, 0.401662, -0.889811, 1.000000, 0.242120, 0.592030, 21, 22, 1, 1, 0.801242, 0.111569, 0.087190, 0.000000 },
-	{ 0.004345, -0.002287, 0.075972, 0.858725, 0.136590, 0.493896, 0.368492, 0.505170, -0.780396, 1.000000, 0.193460, 0.605560, 21, 1, 1, 1, 0.605291, 0.394709, 0.000000, 0.000000 },
-	{ -0.001023, -0.006593, 0.085428, 0.812611, 0.104884, 0.573291, 0.428884, 0.558425, -0.710085, 1.000000, 0.164750, 0.599510, 1, 21, 1, 1, 0.623020, 0.376980, 0.000000, 0.000000 },
-	{ 0.010416, 0.002354, 0.061193, 0.925097, 0.132481, 0.355871, 0.268184, 0.435538, -0.859293, 1.000000, 0.234490, 0.614480, 21, 1, 22, 1, 0.788191, 0.111481, 0.100328, 0.000000 },
-	{ 0.007888, 0.000395, 0.068082, 0.897487, 0.145656, 0.416295, 0.311040, 0.460158, -0.831570, 1.000000, 0.215220, 0.610140, 21, 1, 22, 1, 0.745660, 0.244573, 0.009767, 0.000000 },
-	{ -0.017632, -0.003103, 0.098225, 0.421273, 0.617695, 0.664065, 0.451098, 0.492501, -0.744280, 1.000000, 0.140100, 0.550380, 1, 21, 1, 1, 0.922683, 0.077317, 0.000000, 0.000000 },
-	{ -0.014892, -0.005865, 0.098511, 0.538309, 0.408528, 0.737109, 0.514246, 0.533706, -0.671349, 1.000000, 0.136630, 0.563170, 1, 21, 1, 1, 0.939719, 0.060281, 0.000000, 0.000000 },
-	{ -0.019011, -0.007501, 0.102924, 0.699399, 0.443058, 0.560839, 0.433423, 0.361030, -0.825714, 1.000000, 0.123150, 0.558280, 1, 21, 1, 1, 0.979302, 0.020698, 0.000000, 0.000000 },
-	{ -0.021326, -0.004745, 0.103012, 0.604913, 0.650590, 0.459143, 0.343916, 0.306594, -0.887537, 1.000000, 0.125860, 0.545880, 1, 21, 1, 1, 0.973454, 0.026546, 0.000000, 0.000000 },
-	{ -0.020766, -0.001063, 0.097801, 0.302142, 0.783218, 0.543397, 0.375723, 0.426048, -0.822991, 1.000000, 0.142620, 0.538020, 1, 21, 1, 1, 0.910002, 0.089998, 0.000000, 0.000000 },
-	{ -0.024067, -0.002488, 0.102962, 0.489496, 0.800115, 0.346713, 0.270584, 0.238609, -0.932657, 1.000000, 0.128150, 0.533430, 1, 21, 1, 1, 0.968912, 0.031088, 0.000000, 0.000000 },
-	{ -0.023884, 0.000529, 0.096733, 0.184622, 0.884841, 0.427752, 0.317746, 0.358120, -0.877945, 1.000000, 0.146430, 0.526020, 1, 21, 1, 1, 0.896530, 0.103470, 0.000000, 0.000000 },
-	{ -0.026909, -0.000787, 0.102355, 0.350229, 0.902002, 0.252453, 0.228513, 0.179098, -0.956925, 1.000000, 0.131090, 0.521780, 1, 21, 1, 1, 0.964885, 0.035115, 0.000000, 0.000000 },
-	{ -0.026637, 0.001702, 0.094845, 0.075065, 0.933197, 0.351439, 0.282872, 0.318028, -0.904899, 1.000000, 0.152240, 0.515440, 1, 21, 1, 1, 0.879125, 0.120875, 0.000000, 0.000000 },
-	{ -0.029597, 0.000315, 0.101155, 0.207969, 0.960268, 0.186103, 0.212870, 0.141269, -0.966814, 1.000000, 0.134820, 0.511600, 1, 21, 1, 1, 0.958900, 0.041100, 0.000000, 0.000000 },
-	{ -0.028960, 0.002467, 0.092730, -0.046749, 0.954953, 0.293052, 0.254021, 0.295093, -0.921083, 1.000000, 0.158790, 0.506600, 1, 21, 1, 1, 0.870604, 0.129396, 0.000000, 0.000000 },
-	{ -0.031983, 0.000911, 0.099560, 0.066802, 0.987843, 0.140368, 0.209250, 0.123684, -0.970009, 1.000000, 0.139760, 0.502900, 1, 21, 1, 1, 0.952692, 0.047308, 0.000000, 0.000000 },
-	{ -0.020870, -0.007732, 0.107732, 0.874259, 0.444922, 0.194203, 0.149607, 0.133642, -0.979672, 1.000000, 0.111680, 0.554930, 1, 21, 1, 1, 0.993830, 0.006170, 0.000000, 0.000000 },
-	{ -0.022901, -0.004944, 0.107854, 0.740132, 0.663040, 0.112171, 0.086117, 0.071979, -0.993682, 1.000000, 0.113800, 0.543170, 1, 21, 1, 1, 0.992757, 0.007243, 0.000000, 0.000000 },
-	{ -0.021639, -0.006912, 0.113910, 0.905572, 0.423521, 0.023855, -0.021313, 0.101593, -0.994598, 1.000000, 0.095620, 0.550430, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023448, -0.004125, 0.113747, 0.761779, 0.647174, -0.029300, -0.074785, 0.042924, -0.996276, 1.000000, 0.097910, 0.539550, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025477, -0.002589, 0.107896, 0.603946, 0.795599, 0.047669, 0.061379, 0.013204, -0.998027, 1.000000, 0.115300, 0.530960, 1, 21, 1, 1, 0.997110, 0.002890, 0.000000, 0.000000 },
-	{ -0.025946, -0.001747, 0.113528, 0.626643, 0.776411, -0.067124, -0.082876, -0.019251, -0.996374, 1.000000, 0.099870, 0.528250, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.028293, -0.000776, 0.107526, 0.462383, 0.886680, 0.000199, 0.067362, -0.034904, -0.997118, 1.000000, 0.117290, 0.519470, 1, 21, 1, 1, 0.997926, 0.002074, 0.000000, 0.000000 },
-	{ -0.028772, 0.000138, 0.113070, 0.493699, 0.863836, -0.100247, -0.061544, -0.080279, -0.994871, 1.000000, 0.102010, 0.517340, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.031094, 0.000390, 0.106721, 0.314590, 0.948583, -0.034980, 0.079362, -0.063006, -0.994853, 1.000000, 0.119940, 0.509260, 1, 21, 1, 1, 0.997463, 0.002537, 0.000000, 0.000000 },
-	{ -0.031663, 0.001381, 0.112386, 0.350520, 0.927506, -0.129882, -0.030343, -0.127361, -0.991392, 1.000000, 0.104330, 0.507580, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.033655, 0.000965, 0.105649, 0.173677, 0.982925, -0.060780, 0.098623, -0.078767, -0.992003, 1.000000, 0.122850, 0.500760, 1, 21, 1, 1, 0.986226, 0.013774, 0.000000, 0.000000 },
-	{ -0.034374, 0.002035, 0.111583, 0.214939, 0.964595, -0.152835, -0.001247, -0.156222, -0.987721, 1.000000, 0.106540, 0.499180, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021999, -0.005979, 0.119350, 0.911167, 0.411865, -0.011911, -0.082481, 0.153996, -0.984623, 1.000000, 0.076830, 0.544040, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023845, -0.003355, 0.118717, 0.767045, 0.640128, -0.043336, -0.124442, 0.082173, -0.988818, 1.000000, 0.080000, 0.534370, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026273, -0.001069, 0.118187, 0.633568, 0.770487, -0.070298, -0.141458, 0.026031, -0.989602, 1.000000, 0.082630, 0.524380, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.029020, 0.000816, 0.117657, 0.504212, 0.857650, -0.101029, -0.135240, -0.037126, -0.990117, 1.000000, 0.084900, 0.514610, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.031875, 0.002153, 0.117082, 0.362941, 0.922430, -0.131899, -0.098582, -0.102746, -0.989811, 1.000000, 0.086950, 0.505780, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.034626, 0.002880, 0.116424, 0.227251, 0.961177, -0.156512, -0.058172, -0.147032, -0.987420, 1.000000, 0.088690, 0.497920, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020776, -0.010143, 0.114333, 0.986154, 0.145305, 0.079910, 0.059302, 0.141005, -0.988231, 1.000000, 0.091820, 0.561080, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021049, -0.009060, 0.120123, 0.990600, 0.134090, 0.027043, -0.000071, 0.198205, -0.980161, 1.000000, 0.072340, 0.553780, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.037088, 0.003202, 0.115814, 0.111722, 0.977497, -0.178938, -0.024208, -0.177335, -0.983853, 1.000000, 0.090130, 0.491460, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.039320, 0.003260, 0.115229, 0.017403, 0.979240, -0.201955, 0.010731, -0.202156, -0.979295, 1.000000, 0.091480, 0.485790, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.041460, 0.003118, 0.114697, -0.060245, 0.973938, -0.218669, 0.026756, -0.217413, -0.975713, 1.000000, 0.092650, 0.480000, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.043457, 0.002809, 0.114258, -0.127730, 0.965837, -0.225487, 0.034422, -0.222895, -0.974235, 1.000000, 0.093180, 0.474760, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.045272, 0.002393, 0.113861, -0.179902, 0.957423, -0.225778, 0.047843, -0.220735, -0.974160, 1.000000, 0.093650, 0.469940, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.046897, 0.001973, 0.113557, -0.219797, 0.948684, -0.227350, 0.061327, -0.219151, -0.973762, 1.000000, 0.094010, 0.465640, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.048349, 0.001578, 0.113368, -0.260382, 0.936725, -0.233982, 0.075137, -0.221947, -0.972160, 1.000000, 0.094300, 0.461800, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.049638, 0.001174, 0.113235, -0.313388, 0.918346, -0.241721, 0.090391, -0.224540, -0.970264, 1.000000, 0.094590, 0.458410, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050782, 0.000703, 0.113081, -0.378551, 0.892537, -0.245105, 0.104068, -0.222090, -0.969457, 1.000000, 0.094910, 0.455300, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.051827, 0.000138, 0.112876, -0.446289, 0.861569, -0.241919, 0.114688, -0.213038, -0.970289, 1.000000, 0.095170, 0.452350, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052832, -0.000520, 0.112675, -0.509837, 0.828082, -0.233124, 0.123396, -0.197793, -0.972446, 1.000000, 0.095360, 0.449360, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.053840, -0.001280, 0.112502, -0.568778, 0.792207, -0.221135, 0.129528, -0.179230, -0.975243, 1.000000, 0.095500, 0.446180, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054882, -0.002158, 0.112374, -0.625370, 0.751865, -0.208835, 0.134232, -0.159983, -0.977951, 1.000000, 0.095590, 0.442730, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055985, -0.003182, 0.112312, -0.685631, 0.700708, -0.197278, 0.138449, -0.140537, -0.980348, 1.000000, 0.095540, 0.438860, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057123, -0.004422, 0.112297, -0.753278, 0.631647, -0.183289, 0.140303, -0.117940, -0.983059, 1.000000, 0.095410, 0.434490, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058251, -0.005961, 0.112312, -0.815013, 0.554865, -0.166969, 0.139640, -0.091583, -0.985958, 1.000000, 0.095090, 0.429510, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059379, -0.007800, 0.112366, -0.863734, 0.480464, -0.152046, 0.139425, -0.062103, -0.988283, 1.000000, 0.094600, 0.423780, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060446, -0.009954, 0.112389, -0.905591, 0.401383, -0.137098, 0.138117, -0.026553, -0.990060, 1.000000, 0.093980, 0.417300, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061387, -0.012436, 0.112399, -0.939365, 0.320720, -0.121375, 0.133190, 0.015071, -0.990976, 1.000000, 0.093190, 0.410010, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062208, -0.015211, 0.112501, -0.965179, 0.238786, -0.106823, 0.125010, 0.062323, -0.990196, 1.000000, 0.092000, 0.401920, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062847, -0.018291, 0.112749, -0.984315, 0.149992, -0.092876, 0.112258, 0.126395, -0.985608, 1.000000, 0.090120, 0.393160, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.063241, -0.021699, 0.113200, -0.994199, 0.069647, -0.081958, 0.094541, 0.202584, -0.974691, 1.000000, 0.087360, 0.383870, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.063438, -0.025347, 0.113861, -0.997027, 0.006040, -0.076813, 0.075633, 0.267075, -0.960703, 1.000000, 0.083850, 0.374640, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.063422, -0.029234, 0.114610, -0.996932, -0.031956, -0.071451, 0.057627, 0.318097, -0.946305, 1.000000, 0.079840, 0.365590, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.063263, -0.033347, 0.115419, -0.996035, -0.070124, -0.054745, 0.027488, 0.342671, -0.939053, 1.000000, 0.075760, 0.355850, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062792, -0.037723, 0.116083, -0.987395, -0.157106, -0.019188, -0.038713, 0.357279, -0.933195, 1.000000, 0.072080, 0.345100, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061684, -0.042065, 0.116658, -0.955043, -0.294875, 0.030681, -0.139155, 0.354489, -0.924648, 1.000000, 0.067990, 0.334170, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059988, -0.045943, 0.117334, -0.868527, -0.487992, 0.086749, -0.269235, 0.317556, -0.909214, 1.000000, 0.064100, 0.324770, 1, 12, 1, 1, 0.998438, 0.001562, 0.000000, 0.000000 },
-	{ -0.057463, -0.049014, 0.118080, -0.667010, -0.735016, 0.121858, -0.415209, 0.230909, -0.879933, 1.000000, 0.059880, 0.316790, 1, 12, 1, 1, 0.998295, 0.001705, 0.000000, 0.000000 },
-	{ -0.054138, -0.051247, 0.119066, -0.411249, -0.906034, 0.099881, -0.512908, 0.139432, -0.847044, 1.000000, 0.054090, 0.308880, 1, 12, 1, 1, 0.998970, 0.001030, 0.000000, 0.000000 },
-	{ -0.050539, -0.052480, 0.120064, -0.168330, -0.983581, 0.065063, -0.592841, 0.048283, -0.803871, 1.000000, 0.048030, 0.301800, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.047175, -0.052684, 0.120814, 0.032733, -0.998715, 0.038697, -0.636421, -0.050681, -0.769675, 1.000000, 0.042400, 0.295760, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.044247, -0.052436, 0.121452, 0.113845, -0.993357, 0.016800, -0.606320, -0.082864, -0.790892, 1.000000, 0.036870, 0.289830, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.001926, 0.013474, 0.036955, -0.309714, 0.733292, -0.605278, 0.097938, -0.608590, -0.787418, 1.000000, 0.309520, 0.559460, 22, 21, 1, 1, 0.787720, 0.212280, 0.000000, 0.000000 },
-	{ -0.005471, 0.009961, 0.035002, -0.276112, 0.658620, -0.699987, 0.117142, -0.699809, -0.704660, 1.000000, 0.319700, 0.547820, 22, 21, 23, 1, 0.792257, 0.202565, 0.002760, 0.002418 },
-	{ -0.000954, 0.010009, 0.032889, -0.402367, 0.633573, -0.660822, 0.128777, -0.675484, -0.726042, 1.000000, 0.325440, 0.559670, 22, 21, 23, 1, 0.896324, 0.099030, 0.004646, 0.000000 },
-	{ 0.000981, 0.012873, 0.034601, -0.363712, 0.715773, -0.596140, 0.084836, -0.611858, -0.786405, 1.000000, 0.316110, 0.566970, 22, 21, 23, 1, 0.891142, 0.107824, 0.001034, 0.000000 },
-	{ -0.004210, 0.014319, 0.039271, -0.281727, 0.796590, -0.534860, 0.059090, -0.541977, -0.838314, 1.000000, 0.302430, 0.553480, 22, 21, 1, 1, 0.653450, 0.346550, 0.000000, 0.000000 },
-	{ -0.008013, 0.011771, 0.037751, -0.235145, 0.748595, -0.619930, 0.085087, -0.619511, -0.780363, 1.000000, 0.309200, 0.541830, 22, 21, 1, 23, 0.655273, 0.340254, 0.003396, 0.001076 },
-	{ -0.005497, 0.006860, 0.032611, -0.281492, 0.527657, -0.801462, 0.167381, -0.795430, -0.582474, 1.000000, 0.330060, 0.546370, 22, 21, 23, 1, 0.849760, 0.136868, 0.010017, 0.003355 },
-	{ -0.001757, 0.007171, 0.031038, -0.460612, 0.518477, -0.720429, 0.172127, -0.744073, -0.645544, 1.000000, 0.334690, 0.556000, 22, 21, 23, 1, 0.903919, 0.074919, 0.021162, 0.000000 },
-	{ -0.009257, 0.006186, 0.033026, -0.124399, 0.539884, -0.832497, 0.121692, -0.824378, -0.552803, 1.000000, 0.328220, 0.537450, 22, 21, 1, 23, 0.786293, 0.180791, 0.021998, 0.010918 },
-	{ -0.010101, 0.008163, 0.034607, -0.138650, 0.654491, -0.743248, 0.079733, -0.740684, -0.667106, 1.000000, 0.321140, 0.536020, 22, 21, 1, 23, 0.722351, 0.241206, 0.031559, 0.004884 },
-	{ -0.011560, 0.009866, 0.036533, -0.139337, 0.741690, -0.656111, 0.053507, -0.655967, -0.752891, 1.000000, 0.313660, 0.532850, 22, 21, 1, 23, 0.629418, 0.333647, 0.034586, 0.002348 },
-	{ 0.000919, 0.015622, 0.038488, -0.229147, 0.856230, -0.462992, 0.016153, -0.472238, -0.881323, 1.000000, 0.303060, 0.567440, 22, 21, 1, 1, 0.783008, 0.216992, 0.000000, 0.000000 },
-	{ 0.003115, 0.014845, 0.036032, -0.237918, 0.844912, -0.479082, 0.003557, -0.492484, -0.870314, 1.000000, 0.309680, 0.573440, 22, 21, 1, 1, 0.886429, 0.113571, 0.000000, 0.000000 },
-	{ -0.000785, 0.016232, 0.040776, -0.231724, 0.895973, -0.378862, 0.008147, -0.387662, -0.921766, 1.000000, 0.297010, 0.562910, 22, 21, 1, 1, 0.651079, 0.348921, 0.000000, 0.000000 },
-	{ -0.012769, 0.005432, 0.032740, 0.004876, 0.552957, -0.833195, 0.061755, -0.831782, -0.551658, 1.000000, 0.328150, 0.528700, 22, 21, 1, 4, 0.667431, 0.198309, 0.118816, 0.015444 },
-	{ -0.013639, 0.007015, 0.033927, -0.017044, 0.657063, -0.753643, 0.049661, -0.752266, -0.656986, 1.000000, 0.322800, 0.526850, 22, 21, 1, 4, 0.615894, 0.243629, 0.128643, 0.011833 },
-	{ -0.015619, 0.004710, 0.032008, 0.146672, 0.576099, -0.804113, -0.013493, -0.811664, -0.583970, 1.000000, 0.329360, 0.521950, 22, 21, 1, 4, 0.581502, 0.190614, 0.183314, 0.044570 },
-	{ -0.016496, 0.006119, 0.032983, 0.115205, 0.665341, -0.737597, -0.001783, -0.742402, -0.669953, 1.000000, 0.324980, 0.519610, 22, 21, 1, 4, 0.520815, 0.220717, 0.201498, 0.056970 },
-	{ -0.017588, 0.007442, 0.034121, 0.092410, 0.741336, -0.664741, 0.014926, -0.668554, -0.743514, 1.000000, 0.320480, 0.516740, 22, 21, 1, 4, 0.432747, 0.258757, 0.234404, 0.074092 },
-	{ -0.014783, 0.008496, 0.035397, -0.028164, 0.740689, -0.671257, 0.043154, -0.669997, -0.741109, 1.000000, 0.317160, 0.524220, 22, 21, 1, 4, 0.549609, 0.305399, 0.131432, 0.013561 },
-	{ -0.018067, 0.003948, 0.030719, 0.304211, 0.599923, -0.739965, -0.054624, -0.764517, -0.642286, 1.000000, 0.331980, 0.515610, 22, 1, 21, 4, 0.473226, 0.259877, 0.165719, 0.101178 },
-	{ -0.018986, 0.005323, 0.031584, 0.259490, 0.678380, -0.687362, -0.024059, -0.706980, -0.706824, 1.000000, 0.327960, 0.512850, 22, 1, 21, 4, 0.412794, 0.284352, 0.183810, 0.119043 },
-	{ -0.020074, 0.006575, 0.032502, 0.209952, 0.751551, -0.625373, 0.013165, -0.641744, -0.766806, 1.000000, 0.324220, 0.509740, 22, 1, 21, 4, 0.357166, 0.305843, 0.205151, 0.131840 },
-	{ -0.020118, 0.003192, 0.028934, 0.445243, 0.614078, -0.651665, -0.080660, -0.697319, -0.712209, 1.000000, 0.335620, 0.510120, 22, 1, 4, 21, 0.350925, 0.331264, 0.184703, 0.133108 },
-	{ -0.021099, 0.004577, 0.029734, 0.383137, 0.692954, -0.610754, -0.036450, -0.649352, -0.759614, 1.000000, 0.331870, 0.506880, 1, 22, 4, 21, 0.357676, 0.298088, 0.201049, 0.143187 },
-	{ -0.021754, 0.002516, 0.026840, 0.563041, 0.614465, -0.552646, -0.084625, -0.622334, -0.778164, 1.000000, 0.339640, 0.505520, 1, 22, 4, 21, 0.371082, 0.265326, 0.263480, 0.100112 },
-	{ -0.022804, 0.003907, 0.027571, 0.483123, 0.707370, -0.515965, -0.029310, -0.575906, -0.816991, 1.000000, 0.336260, 0.501800, 1, 4, 22, 21, 0.383762, 0.276196, 0.234780, 0.105262 },
-	{ -0.023931, 0.005108, 0.028336, 0.382168, 0.792242, -0.475711, 0.027842, -0.524424, -0.851002, 1.000000, 0.333090, 0.498230, 1, 4, 22, 21, 0.406610, 0.288433, 0.195940, 0.109017 },
-	{ -0.022194, 0.005800, 0.030549, 0.304631, 0.770374, -0.560111, 0.016639, -0.592276, -0.805564, 1.000000, 0.328470, 0.503550, 1, 22, 4, 21, 0.370141, 0.265214, 0.211002, 0.153643 },
-	{ -0.023051, 0.001928, 0.024516, 0.661952, 0.596537, -0.453832, -0.081102, -0.544918, -0.834558, 1.000000, 0.344030, 0.501550, 1, 4, 22, 21, 0.381889, 0.362693, 0.184801, 0.070616 },
-	{ -0.024148, 0.003345, 0.025149, 0.561937, 0.714714, -0.416427, -0.013410, -0.495492, -0.868509, 1.000000, 0.341050, 0.497440, 1, 4, 22, 21, 0.387913, 0.373340, 0.165817, 0.072930 },
-	{ -0.024061, 0.001445, 0.022033, 0.740677, 0.563960, -0.365166, -0.084124, -0.461390, -0.883200, 1.000000, 0.348580, 0.498270, 4, 1, 22, 21, 0.471223, 0.364995, 0.117616, 0.046166 },
-	{ -0.025194, 0.002907, 0.022549, 0.616395, 0.715464, -0.328890, -0.007269, -0.412483, -0.910936, 1.000000, 0.346000, 0.493730, 4, 1, 22, 21, 0.481157, 0.366422, 0.105506, 0.046915 },
-	{ -0.026434, 0.004062, 0.023215, 0.466835, 0.831436, -0.301296, 0.052331, -0.366074, -0.929113, 1.000000, 0.343390, 0.489630, 4, 1, 22, 21, 0.475138, 0.397485, 0.082606, 0.044772 },
-	{ -0.025324, 0.004525, 0.025877, 0.438910, 0.812488, -0.383694, 0.044081, -0.445979, -0.893957, 1.000000, 0.338110, 0.493610, 1, 4, 22, 21, 0.414406, 0.378890, 0.133999, 0.072705 },
-	{ -0.024948, 0.001111, 0.019329, 0.787171, 0.537724, -0.302019, -0.090918, -0.383178, -0.919189, 1.000000, 0.353390, 0.495310, 4, 1, 22, 21, 0.582906, 0.322334, 0.067430, 0.027331 },
-	{ -0.026107, 0.002607, 0.019757, 0.640582, 0.719138, -0.269249, -0.017037, -0.337238, -0.941265, 1.000000, 0.351190, 0.490410, 4, 1, 22, 21, 0.589969, 0.323334, 0.059267, 0.027431 },
-	{ -0.027395, 0.003708, 0.020358, 0.465385, 0.851426, -0.241848, 0.039923, -0.293156, -0.955231, 1.000000, 0.348940, 0.486050, 4, 1, 22, 21, 0.573715, 0.357854, 0.043588, 0.024843 },
-	{ -0.025872, 0.000929, 0.016307, 0.797756, 0.532914, -0.282113, -0.108619, -0.333204, -0.936577, 1.000000, 0.358810, 0.492240, 4, 1, 22, 21, 0.698895, 0.253685, 0.033004, 0.014416 },
-	{ -0.027041, 0.002403, 0.016688, 0.637532, 0.728610, -0.250361, -0.044726, -0.289415, -0.956158, 1.000000, 0.356910, 0.487180, 4, 1, 22, 21, 0.697667, 0.259773, 0.028349, 0.014211 },
-	{ -0.026975, 0.000783, 0.012983, 0.780139, 0.546690, -0.304159, -0.143490, -0.316860, -0.937556, 1.000000, 0.364910, 0.488940, 4, 1, 22, 21, 0.818268, 0.168322, 0.006931, 0.006480 },
-	{ -0.028098, 0.002158, 0.013320, 0.619214, 0.735906, -0.273891, -0.090972, -0.279225, -0.955907, 1.000000, 0.363290, 0.484060, 4, 1, 21, 22, 0.814289, 0.175703, 0.006290, 0.003718 },
-	{ -0.028365, 0.003427, 0.017226, 0.444734, 0.869476, -0.214995, 0.006599, -0.243215, -0.969950, 1.000000, 0.355030, 0.482710, 4, 1, 22, 21, 0.675794, 0.291461, 0.020583, 0.012162 },
-	{ -0.029399, 0.003106, 0.013762, 0.428071, 0.874229, -0.229082, -0.045005, -0.232545, -0.971544, 1.000000, 0.361840, 0.479630, 4, 1, 21, 22, 0.784090, 0.206834, 0.005100, 0.003976 },
-	{ -0.028250, 0.000547, 0.009635, 0.756672, 0.570459, -0.319413, -0.173340, -0.296025, -0.939321, 1.000000, 0.371420, 0.485760, 4, 1, 21, 1, 0.906034, 0.091629, 0.002337, 0.000000 },
-	{ -0.029276, 0.001712, 0.009868, 0.612532, 0.735005, -0.290814, -0.138073, -0.262763, -0.954930, 1.000000, 0.370360, 0.481320, 4, 1, 21, 1, 0.895564, 0.102196, 0.002240, 0.000000 },
-	{ -0.029331, 0.000335, 0.006741, 0.768203, 0.615894, -0.174753, -0.125522, -0.122768, -0.984466, 1.000000, 0.376910, 0.483410, 4, 1, 1, 1, 0.966175, 0.033825, 0.000000, 0.000000 },
-	{ -0.030233, 0.001307, 0.006778, 0.640368, 0.752284, -0.154909, -0.111650, -0.108370, -0.987821, 1.000000, 0.376680, 0.479710, 4, 1, 1, 1, 0.960251, 0.039749, 0.000000, 0.000000 },
-	{ -0.029533, 0.000527, 0.003795, 0.757759, 0.650951, 0.045423, -0.039514, 0.115257, -0.992550, 1.000000, 0.381060, 0.483210, 4, 1, 1, 1, 0.990662, 0.009338, 0.000000, 0.000000 },
-	{ -0.030527, 0.001514, 0.003653, 0.615639, 0.787271, 0.034552, -0.058694, 0.089535, -0.994253, 1.000000, 0.381760, 0.479230, 4, 1, 1, 1, 0.994113, 0.005887, 0.000000, 0.000000 },
-	{ -0.031307, 0.002123, 0.006853, 0.492840, 0.860823, -0.126858, -0.090823, -0.094104, -0.991411, 1.000000, 0.376450, 0.475810, 4, 1, 1, 1, 0.953919, 0.046081, 0.000000, 0.000000 },
-	{ -0.031698, 0.002309, 0.003546, 0.464978, 0.885150, 0.017455, -0.061594, 0.052012, -0.996745, 1.000000, 0.382310, 0.475070, 4, 1, 1, 1, 0.992919, 0.007081, 0.000000, 0.000000 },
-	{ -0.030470, 0.002585, 0.010154, 0.445425, 0.862368, -0.240663, -0.100169, -0.219114, -0.970544, 1.000000, 0.369440, 0.477180, 4, 1, 21, 1, 0.879601, 0.118649, 0.001750, 0.000000 },
-	{ -0.031923, 0.002631, -0.001181, 0.394487, 0.918880, 0.006318, -0.096403, 0.048223, -0.994174, 1.000000, 0.393110, 0.475460, 4, 1, 1, 1, 0.998605, 0.001395, 0.000000, 0.000000 },
-	{ -0.030529, 0.001889, -0.001020, 0.556778, 0.829998, 0.033190, -0.086657, 0.097777, -0.991429, 1.000000, 0.392230, 0.480410, 4, 1, 1, 1, 0.998600, 0.001400, 0.000000, 0.000000 },
-	{ -0.029273, 0.000821, -0.000855, 0.723236, 0.687784, 0.062310, -0.056706, 0.149065, -0.987200, 1.000000, 0.391190, 0.485470, 4, 1, 1, 1, 0.998698, 0.001302, 0.000000, 0.000000 },
-	{ -0.030275, 0.001784, -0.006221, 0.498474, 0.866760, 0.015874, -0.098177, 0.074636, -0.992366, 1.000000, 0.403440, 0.483660, 4, 5, 1, 1, 0.993633, 0.006367, 0.000000, 0.000000 },
-	{ -0.028839, 0.000748, -0.006029, 0.678118, 0.732183, 0.063758, -0.055536, 0.137552, -0.988937, 1.000000, 0.402190, 0.489220, 4, 5, 1, 1, 0.993727, 0.006273, 0.000000, 0.000000 },
-	{ -0.029564, 0.001514, -0.011268, 0.445375, 0.895016, 0.024239, -0.072823, 0.063194, -0.995341, 1.000000, 0.414980, 0.487810, 4, 5, 1, 1, 0.949519, 0.050482, 0.000000, 0.000000 },
-	{ -0.028049, 0.000591, -0.010929, 0.627096, 0.774377, 0.084207, -0.028425, 0.130782, -0.991004, 1.000000, 0.413110, 0.493210, 4, 5, 1, 1, 0.956339, 0.043661, 0.000000, 0.000000 },
-	{ -0.027151, 0.000396, -0.015199, 0.594560, 0.801136, 0.068401, -0.030602, 0.107556, -0.993728, 1.000000, 0.423130, 0.497110, 4, 5, 1, 1, 0.822055, 0.177945, 0.000000, 0.000000 },
-	{ -0.028621, 0.001206, -0.015647, 0.410608, 0.911799, 0.004950, -0.072237, 0.037941, -0.996666, 1.000000, 0.425190, 0.492020, 4, 5, 1, 1, 0.821937, 0.178063, 0.000000, 0.000000 },
-	{ -0.030122, 0.001717, -0.016065, 0.269587, 0.961954, -0.044355, -0.099544, -0.017976, -0.994871, 1.000000, 0.426870, 0.487200, 4, 5, 1, 1, 0.854673, 0.145327, 0.000000, 0.000000 },
-	{ -0.031115, 0.002122, -0.011603, 0.292839, 0.955881, -0.023192, -0.102372, 0.007228, -0.994720, 1.000000, 0.416700, 0.482530, 4, 5, 1, 1, 0.958450, 0.041550, 0.000000, 0.000000 },
-	{ -0.031791, 0.002461, -0.006465, 0.335777, 0.941705, -0.021100, -0.119106, 0.020227, -0.992676, 1.000000, 0.404930, 0.478280, 4, 5, 1, 1, 0.994161, 0.005838, 0.000000, 0.000000 },
-	{ -0.031983, 0.003279, 0.010508, 0.311277, 0.931964, -0.185876, -0.069211, -0.172842, -0.982515, 1.000000, 0.368590, 0.472340, 4, 1, 21, 1, 0.860268, 0.138649, 0.001082, 0.000000 },
-	{ -0.030932, 0.003763, 0.014306, 0.277598, 0.942610, -0.185541, -0.013038, -0.189417, -0.981810, 1.000000, 0.360340, 0.475030, 4, 1, 21, 22, 0.749732, 0.244212, 0.003470, 0.002586 },
-	{ -0.029841, 0.004124, 0.017895, 0.278739, 0.942470, -0.184538, 0.039681, -0.203292, -0.978314, 1.000000, 0.353060, 0.478400, 4, 1, 21, 22, 0.644742, 0.339715, 0.009204, 0.006339 },
-	{ -0.028805, 0.004477, 0.021085, 0.292895, 0.931147, -0.217203, 0.076517, -0.249264, -0.965408, 1.000000, 0.346700, 0.481980, 4, 1, 21, 22, 0.548006, 0.418129, 0.020766, 0.013099 },
-	{ -0.027772, 0.004901, 0.023981, 0.300068, 0.913829, -0.273633, 0.090221, -0.312754, -0.945540, 1.000000, 0.340890, 0.485820, 4, 1, 22, 21, 0.459114, 0.451328, 0.049073, 0.040485 },
-	{ -0.026596, 0.005418, 0.026685, 0.289812, 0.891781, -0.347471, 0.081736, -0.384786, -0.919380, 1.000000, 0.335380, 0.490030, 1, 4, 22, 21, 0.463793, 0.374036, 0.092284, 0.069888 },
-	{ -0.025176, 0.006059, 0.029200, 0.258494, 0.865243, -0.429576, 0.064729, -0.459204, -0.885969, 1.000000, 0.330090, 0.494770, 1, 4, 22, 21, 0.453270, 0.288825, 0.147831, 0.110074 },
-	{ -0.023445, 0.006832, 0.031517, 0.209644, 0.836999, -0.505452, 0.048605, -0.525221, -0.849577, 1.000000, 0.324930, 0.500160, 1, 22, 4, 21, 0.416029, 0.216882, 0.204876, 0.162213 },
-	{ -0.021359, 0.007733, 0.033604, 0.147275, 0.815517, -0.559681, 0.037105, -0.570008, -0.820801, 1.000000, 0.319980, 0.506300, 1, 22, 21, 4, 0.351316, 0.290173, 0.226537, 0.131974 },
-	{ -0.018932, 0.008711, 0.035448, 0.064509, 0.808749, -0.584605, 0.029482, -0.587114, -0.808967, 1.000000, 0.315450, 0.513130, 22, 21, 1, 4, 0.348385, 0.300153, 0.270735, 0.080727 },
-	{ -0.016181, 0.009842, 0.037083, -0.036563, 0.814506, -0.579002, 0.035276, -0.577977, -0.815291, 1.000000, 0.311110, 0.520740, 22, 21, 1, 4, 0.459197, 0.373973, 0.150062, 0.016768 },
-	{ -0.013114, 0.011225, 0.038596, -0.140141, 0.824003, -0.548981, 0.041415, -0.549089, -0.834737, 1.000000, 0.306600, 0.529180, 22, 21, 1, 4, 0.531936, 0.434375, 0.031696, 0.001993 },
-	{ -0.009788, 0.012943, 0.040071, -0.233026, 0.841033, -0.488224, 0.070230, -0.486180, -0.871032, 1.000000, 0.301610, 0.538020, 22, 21, 1, 1, 0.522806, 0.471425, 0.005769, 0.000000 },
-	{ -0.006052, 0.014939, 0.041599, -0.274280, 0.880188, -0.387350, 0.035333, -0.393301, -0.918731, 1.000000, 0.296160, 0.548430, 22, 21, 1, 1, 0.510874, 0.489126, 0.000000, 0.000000 },
-	{ -0.002304, 0.016587, 0.043115, -0.235606, 0.939310, -0.249373, 0.000261, -0.256536, -0.966535, 1.000000, 0.291100, 0.558770, 22, 21, 1, 1, 0.507033, 0.492967, 0.000000, 0.000000 },
-	{ 0.001183, 0.017563, 0.044654, -0.107115, 0.988863, -0.103330, -0.006840, -0.104658, -0.994485, 1.000000, 0.286580, 0.568050, 22, 21, 1, 1, 0.507340, 0.492660, 0.000000, 0.000000 },
-	{ 0.002401, 0.017320, 0.042420, -0.070364, 0.970592, -0.230219, -0.008943, -0.231396, -0.972819, 1.000000, 0.291880, 0.571280, 22, 21, 1, 1, 0.648871, 0.351129, 0.000000, 0.000000 },
-	{ 0.003684, 0.016710, 0.040149, -0.027622, 0.949643, -0.312115, -0.019608, -0.312688, -0.949653, 1.000000, 0.297630, 0.574720, 22, 21, 1, 1, 0.777304, 0.222696, 0.000000, 0.000000 },
-	{ 0.005422, 0.017496, 0.044134, 0.153991, 0.983401, -0.095970, -0.011050, -0.095408, -0.995377, 1.000000, 0.287240, 0.579030, 22, 21, 1, 1, 0.646214, 0.353786, 0.000000, 0.000000 },
-	{ 0.006510, 0.016890, 0.041950, 0.200864, 0.962329, -0.183242, -0.038917, -0.179068, -0.983067, 1.000000, 0.292470, 0.582160, 22, 21, 1, 1, 0.772336, 0.227664, 0.000000, 0.000000 },
-	{ 0.005436, 0.015825, 0.037540, -0.013376, 0.946001, -0.323888, -0.038847, -0.324164, -0.945203, 1.000000, 0.304400, 0.579780, 22, 21, 1, 1, 0.879851, 0.120149, 0.000000, 0.000000 },
-	{ 0.008021, 0.015990, 0.039246, 0.203032, 0.961443, -0.185488, -0.050488, -0.178902, -0.982571, 1.000000, 0.299270, 0.586890, 22, 21, 1, 1, 0.874605, 0.125395, 0.000000, 0.000000 },
-	{ 0.009223, 0.016185, 0.043610, 0.425512, 0.903924, -0.043143, -0.027827, -0.034583, -0.999014, 1.000000, 0.287940, 0.589760, 22, 21, 1, 1, 0.772559, 0.227441, 0.000000, 0.000000 },
-	{ 0.010586, 0.015355, 0.040883, 0.413295, 0.909450, -0.045703, -0.032503, -0.035424, -0.998844, 1.000000, 0.294550, 0.594220, 22, 21, 1, 1, 0.874807, 0.125193, 0.000000, 0.000000 },
-	{ 0.008247, 0.016719, 0.045750, 0.398130, 0.916244, 0.044592, 0.019554, 0.040123, -0.999003, 1.000000, 0.283020, 0.586710, 22, 21, 1, 1, 0.645646, 0.354354, 0.000000, 0.000000 },
-	{ 0.011609, 0.014609, 0.044879, 0.650385, 0.749580, 0.123002, 0.040261, 0.127684, -0.990997, 1.000000, 0.284240, 0.597310, 22, 21, 1, 1, 0.779451, 0.220549, 0.000000, 0.000000 },
-	{ 0.010690, 0.015003, 0.047035, 0.640623, 0.743823, 0.190605, 0.082235, 0.180341, -0.980161, 1.000000, 0.279300, 0.594410, 22, 21, 1, 1, 0.649429, 0.350571, 0.000000, 0.000000 },
-	{ 0.012850, 0.013936, 0.042117, 0.639541, 0.760218, 0.114267, 0.034214, 0.120345, -0.992142, 1.000000, 0.290780, 0.601430, 22, 21, 1, 1, 0.881935, 0.118065, 0.000000, 0.000000 },
-	{ 0.013476, 0.012149, 0.045606, 0.824480, 0.499939, 0.265130, 0.154951, 0.251165, -0.955461, 1.000000, 0.281200, 0.605200, 22, 21, 1, 1, 0.791082, 0.208918, 0.000000, 0.000000 },
-	{ 0.012572, 0.012375, 0.047829, 0.817852, 0.490443, 0.300972, 0.177624, 0.282328, -0.942731, 1.000000, 0.275890, 0.602590, 22, 21, 1, 1, 0.656842, 0.343158, 0.000000, 0.000000 },
-	{ 0.013854, 0.008987, 0.048109, 0.900806, 0.253939, 0.352226, 0.261584, 0.330097, -0.906978, 1.000000, 0.272580, 0.611860, 22, 21, 1, 1, 0.668501, 0.331499, 0.000000, 0.000000 },
-	{ 0.014780, 0.008905, 0.045792, 0.905259, 0.260456, 0.335663, 0.252813, 0.304729, -0.918273, 1.000000, 0.278390, 0.614360, 22, 21, 1, 1, 0.804493, 0.195507, 0.000000, 0.000000 },
-	{ 0.014634, 0.011704, 0.042755, 0.826316, 0.504404, 0.250557, 0.144385, 0.240289, -0.959903, 1.000000, 0.288050, 0.608870, 22, 21, 1, 1, 0.892700, 0.107300, 0.000000, 0.000000 },
-	{ 0.015912, 0.008657, 0.042782, 0.912182, 0.263900, 0.313497, 0.237138, 0.283970, -0.929046, 1.000000, 0.285830, 0.617770, 22, 21, 1, 1, 0.904073, 0.095927, 0.000000, 0.000000 },
-	{ 0.016730, 0.005128, 0.042292, 0.938196, 0.067982, 0.339362, 0.305732, 0.296790, -0.904679, 1.000000, 0.284080, 0.628310, 22, 21, 1, 1, 0.915031, 0.084969, 0.000000, 0.000000 },
-	{ 0.015523, 0.005252, 0.045494, 0.930481, 0.054068, 0.362329, 0.327439, 0.320787, -0.888752, 1.000000, 0.275860, 0.624860, 22, 21, 1, 1, 0.820384, 0.179616, 0.000000, 0.000000 },
-	{ 0.014529, 0.005227, 0.047909, 0.929915, 0.050351, 0.364311, 0.325831, 0.346617, -0.879597, 1.000000, 0.269530, 0.622360, 22, 21, 1, 1, 0.686550, 0.313450, 0.000000, 0.000000 },
-	{ 0.010091, 0.014938, 0.035787, 0.175151, 0.972516, -0.153412, -0.049712, -0.146887, -0.987903, 1.000000, 0.308130, 0.593500, 22, 21, 1, 1, 0.943473, 0.056527, 0.000000, 0.000000 },
-	{ 0.012478, 0.014391, 0.037269, 0.385487, 0.922596, -0.014725, -0.027922, -0.004288, -0.999601, 1.000000, 0.303700, 0.600360, 22, 21, 23, 1, 0.942167, 0.056265, 0.001569, 0.000000 },
-	{ 0.012567, 0.013963, 0.031537, 0.138555, 0.983860, -0.113237, -0.050056, -0.107236, -0.992973, 1.000000, 0.319330, 0.601440, 22, 21, 23, 1, 0.960516, 0.019959, 0.019525, 0.000000 },
-	{ 0.010427, 0.013779, 0.030207, -0.074021, 0.968759, -0.236701, -0.048086, -0.240543, -0.969447, 1.000000, 0.323900, 0.595310, 22, 23, 21, 1, 0.933694, 0.048222, 0.018084, 0.000000 },
-	{ 0.007777, 0.014768, 0.034297, -0.034461, 0.955879, -0.291734, -0.044361, -0.293082, -0.955058, 1.000000, 0.313010, 0.586920, 22, 21, 23, 1, 0.944720, 0.052696, 0.002584, 0.000000 },
-	{ 0.014833, 0.013491, 0.032797, 0.353476, 0.935256, 0.018753, -0.029283, 0.031100, -0.999087, 1.000000, 0.315460, 0.607960, 22, 23, 21, 1, 0.951426, 0.028727, 0.019847, 0.000000 },
-	{ 0.016777, 0.012341, 0.033628, 0.614182, 0.768481, 0.179495, 0.046886, 0.191514, -0.980370, 1.000000, 0.312810, 0.614220, 22, 23, 21, 1, 0.951444, 0.031070, 0.017486, 0.000000 },
-	{ 0.014568, 0.013121, 0.038346, 0.627024, 0.766328, 0.139941, 0.040813, 0.147078, -0.988283, 1.000000, 0.300210, 0.607070, 22, 21, 23, 1, 0.946236, 0.051487, 0.002277, 0.000000 },
-	{ 0.018207, 0.010498, 0.033932, 0.825930, 0.470777, 0.310176, 0.173347, 0.311462, -0.934314, 1.000000, 0.310990, 0.620480, 22, 23, 21, 1, 0.944151, 0.041660, 0.014189, 0.000000 },
-	{ 0.016194, 0.011107, 0.038829, 0.828416, 0.493417, 0.265080, 0.150750, 0.259388, -0.953936, 1.000000, 0.297910, 0.613920, 22, 21, 23, 1, 0.952506, 0.044372, 0.003122, 0.000000 },
-	{ 0.017384, 0.008289, 0.038657, 0.913269, 0.255922, 0.316929, 0.238512, 0.294764, -0.925325, 1.000000, 0.296430, 0.622330, 22, 21, 23, 1, 0.957479, 0.037620, 0.004901, 0.000000 },
-	{ 0.019261, 0.007897, 0.033653, 0.902016, 0.237589, 0.360442, 0.271596, 0.336678, -0.901601, 1.000000, 0.309920, 0.628490, 22, 23, 21, 1, 0.934689, 0.054045, 0.011267, 0.000000 },
-	{ 0.020091, 0.004738, 0.033007, 0.920724, 0.084492, 0.380957, 0.333148, 0.338112, -0.880166, 1.000000, 0.308930, 0.638980, 22, 23, 21, 1, 0.915252, 0.075692, 0.009056, 0.000000 },
-	{ 0.018236, 0.004916, 0.037969, 0.936820, 0.081432, 0.340201, 0.301499, 0.305200, -0.903300, 1.000000, 0.295500, 0.633150, 22, 21, 23, 1, 0.960474, 0.031801, 0.007725, 0.000000 },
-	{ 0.012969, 0.013063, 0.025648, -0.098001, 0.979119, -0.178109, -0.072522, -0.185521, -0.979961, 1.000000, 0.336210, 0.603740, 22, 23, 21, 1, 0.737566, 0.257748, 0.004686, 0.000000 },
-	{ 0.015065, 0.013216, 0.026937, 0.119008, 0.989857, -0.077589, -0.052275, -0.071790, -0.996049, 1.000000, 0.331800, 0.609570, 22, 23, 21, 1, 0.828128, 0.166537, 0.005335, 0.000000 },
-	{ 0.014886, 0.012656, 0.021544, -0.088223, 0.984980, -0.148434, -0.093110, -0.156517, -0.983277, 1.000000, 0.347120, 0.610100, 23, 22, 1, 1, 0.591640, 0.408360, 0.000000, 0.000000 },
-	{ 0.017059, 0.012728, 0.022807, 0.131360, 0.989047, -0.067304, -0.058772, -0.060003, -0.996467, 1.000000, 0.342830, 0.615940, 23, 22, 21, 1, 0.513642, 0.485317, 0.001041, 0.000000 },
-	{ 0.017289, 0.012775, 0.028098, 0.330065, 0.943213, 0.037505, -0.025222, 0.048529, -0.998503, 1.000000, 0.327980, 0.616040, 22, 23, 21, 1, 0.871500, 0.123213, 0.005287, 0.000000 },
-	{ 0.019353, 0.012223, 0.024008, 0.332572, 0.942776, 0.023858, -0.022657, 0.033278, -0.999189, 1.000000, 0.338800, 0.622560, 22, 23, 21, 1, 0.626785, 0.372203, 0.001011, 0.000000 },
-	{ 0.021315, 0.011197, 0.024818, 0.592916, 0.785020, 0.179426, 0.057958, 0.180636, -0.981841, 1.000000, 0.336320, 0.628550, 22, 23, 1, 1, 0.554315, 0.445685, 0.000000, 0.000000 },
-	{ 0.019201, 0.011738, 0.028813, 0.598253, 0.774812, 0.204353, 0.056130, 0.213878, -0.975247, 1.000000, 0.325850, 0.622070, 22, 23, 21, 1, 0.825410, 0.170156, 0.004434, 0.000000 },
-	{ 0.022658, 0.009488, 0.025176, 0.813805, 0.460610, 0.354345, 0.228956, 0.306303, -0.923990, 1.000000, 0.334950, 0.634260, 22, 23, 1, 1, 0.534554, 0.465446, 0.000000, 0.000000 },
-	{ 0.020537, 0.010015, 0.029071, 0.815002, 0.455569, 0.358091, 0.210685, 0.342710, -0.915512, 1.000000, 0.324360, 0.627830, 22, 23, 21, 1, 0.801585, 0.195070, 0.003345, 0.000000 },
-	{ 0.021475, 0.007522, 0.028920, 0.882647, 0.217429, 0.416724, 0.325019, 0.358138, -0.875272, 1.000000, 0.322990, 0.635520, 22, 23, 21, 1, 0.770260, 0.227278, 0.002462, 0.000000 },
-	{ 0.023472, 0.007027, 0.025244, 0.879612, 0.202867, 0.430265, 0.357400, 0.315067, -0.879203, 1.000000, 0.333390, 0.641510, 22, 23, 1, 1, 0.500102, 0.499898, 0.000000, 0.000000 },
-	{ 0.023843, 0.003991, 0.025276, 0.892149, 0.054244, 0.448473, 0.414214, 0.297940, -0.860034, 1.000000, 0.330700, 0.650330, 23, 22, 1, 1, 0.532530, 0.467470, 0.000000, 0.000000 },
-	{ 0.022117, 0.004439, 0.028609, 0.898919, 0.072178, 0.432128, 0.383045, 0.349267, -0.855155, 1.000000, 0.321110, 0.645120, 22, 23, 21, 1, 0.725284, 0.272842, 0.001874, 0.000000 },
-	{ 0.025050, 0.003445, 0.022851, 0.907432, 0.047244, 0.417534, 0.399253, 0.212865, -0.891788, 1.000000, 0.337500, 0.654070, 23, 22, 1, 1, 0.762105, 0.237895, 0.000000, 0.000000 },
-	{ 0.024828, 0.006461, 0.022647, 0.907167, 0.197297, 0.371648, 0.328617, 0.219428, -0.918620, 1.000000, 0.340370, 0.645360, 23, 22, 1, 1, 0.748666, 0.251334, 0.000000, 0.000000 },
-	{ 0.026011, 0.002751, 0.020719, 0.925001, 0.074421, 0.372604, 0.356910, 0.166198, -0.919236, 1.000000, 0.343300, 0.657630, 23, 22, 1, 1, 0.912763, 0.087237, 0.000000, 0.000000 },
-	{ 0.025712, 0.005764, 0.020459, 0.937136, 0.225059, 0.266694, 0.235983, 0.154294, -0.959430, 1.000000, 0.345740, 0.648370, 23, 22, 1, 1, 0.913781, 0.086219, 0.000000, 0.000000 },
-	{ 0.025041, 0.008158, 0.020065, 0.869309, 0.483558, 0.102337, 0.067572, 0.088835, -0.993752, 1.000000, 0.347690, 0.642020, 23, 22, 1, 1, 0.898968, 0.101032, 0.000000, 0.000000 },
-	{ 0.024133, 0.008886, 0.022376, 0.840065, 0.474130, 0.263613, 0.185205, 0.206078, -0.960849, 1.000000, 0.342160, 0.638770, 23, 22, 1, 1, 0.723641, 0.276359, 0.000000, 0.000000 },
-	{ 0.022780, 0.010608, 0.021823, 0.616462, 0.783169, 0.081366, 0.021102, 0.086867, -0.995996, 1.000000, 0.343900, 0.633110, 23, 22, 1, 1, 0.721691, 0.278309, 0.000000, 0.000000 },
-	{ 0.023674, 0.009853, 0.019344, 0.656651, 0.749936, -0.080034, -0.074641, -0.040977, -0.996368, 1.000000, 0.349870, 0.636450, 23, 22, 1, 1, 0.885464, 0.114536, 0.000000, 0.000000 },
-	{ 0.020758, 0.011699, 0.020849, 0.373940, 0.926092, -0.050218, -0.048900, -0.034384, -0.998212, 1.000000, 0.346960, 0.627030, 23, 22, 1, 1, 0.689074, 0.310926, 0.000000, 0.000000 },
-	{ 0.021632, 0.010988, 0.018255, 0.438676, 0.877739, -0.192711, -0.117438, -0.156613, -0.980653, 1.000000, 0.353270, 0.630180, 23, 22, 1, 1, 0.906583, 0.093417, 0.000000, 0.000000 },
-	{ 0.019239, 0.011565, 0.016993, 0.251544, 0.930225, -0.267221, -0.122702, -0.243220, -0.962179, 1.000000, 0.357340, 0.623540, 23, 22, 1, 1, 0.942763, 0.057237, 0.000000, 0.000000 },
-	{ 0.018383, 0.012272, 0.019582, 0.180513, 0.975166, -0.128319, -0.084406, -0.114622, -0.989817, 1.000000, 0.351140, 0.620370, 23, 22, 1, 1, 0.803686, 0.196313, 0.000000, 0.000000 },
-	{ 0.016918, 0.011537, 0.015792, 0.044902, 0.941674, -0.333519, -0.115502, -0.326723, -0.938036, 1.000000, 0.361640, 0.617340, 23, 22, 1, 1, 0.934648, 0.065352, 0.000000, 0.000000 },
-	{ 0.016106, 0.012258, 0.018335, -0.036998, 0.978322, -0.203757, -0.107749, -0.206613, -0.972472, 1.000000, 0.355330, 0.614380, 23, 22, 1, 1, 0.820963, 0.179037, 0.000000, 0.000000 },
-	{ 0.014980, 0.010950, 0.014798, -0.242564, 0.887968, -0.390737, -0.096484, -0.422849, -0.901049, 1.000000, 0.365470, 0.612500, 23, 22, 1, 1, 0.932159, 0.067841, 0.000000, 0.000000 },
-	{ 0.014186, 0.011650, 0.017278, -0.314993, 0.904553, -0.287338, -0.102517, -0.333406, -0.937193, 1.000000, 0.359120, 0.609590, 23, 22, 1, 1, 0.808217, 0.191783, 0.000000, 0.000000 },
-	{ 0.013262, 0.009668, 0.013997, -0.493333, 0.767058, -0.410175, -0.048497, -0.495074, -0.867496, 1.000000, 0.369400, 0.607740, 23, 22, 1, 1, 0.937627, 0.062373, 0.000000, 0.000000 },
-	{ 0.012461, 0.010319, 0.016372, -0.522591, 0.777576, -0.349679, -0.055606, -0.440352, -0.896101, 1.000000, 0.363150, 0.604730, 23, 22, 1, 1, 0.815213, 0.184787, 0.000000, 0.000000 },
-	{ 0.011434, 0.007752, 0.013262, -0.636874, 0.650219, -0.414254, -0.001595, -0.538427, -0.842671, 1.000000, 0.374220, 0.601320, 23, 22, 1, 1, 0.918875, 0.081125, 0.000000, 0.000000 },
-	{ 0.010635, 0.008354, 0.015476, -0.638609, 0.662012, -0.392326, -0.000949, -0.510501, -0.859877, 1.000000, 0.368500, 0.598360, 23, 22, 1, 1, 0.806517, 0.193483, 0.000000, 0.000000 },
-	{ 0.009035, 0.005961, 0.014782, -0.752907, 0.504808, -0.422255, 0.066275, -0.580183, -0.811786, 1.000000, 0.373890, 0.591790, 23, 22, 1, 1, 0.777421, 0.222579, 0.000000, 0.000000 },
-	{ 0.009788, 0.005383, 0.012690, -0.764773, 0.489471, -0.418976, 0.058457, -0.594885, -0.801683, 1.000000, 0.379290, 0.594590, 23, 22, 1, 1, 0.896842, 0.103158, 0.000000, 0.000000 },
-	{ 0.012294, 0.006943, 0.010681, -0.640470, 0.642429, -0.420813, -0.008883, -0.554106, -0.832399, 1.000000, 0.381040, 0.604700, 23, 22, 1, 1, 0.974329, 0.025671, 0.000000, 0.000000 },
-	{ 0.014040, 0.008732, 0.011424, -0.463741, 0.781545, -0.417292, -0.053682, -0.494921, -0.867278, 1.000000, 0.376350, 0.610650, 23, 22, 1, 1, 0.984710, 0.015290, 0.000000, 0.000000 },
-	{ 0.013597, 0.005943, 0.007071, -0.652421, 0.618718, -0.437647, -0.003449, -0.579898, -0.814682, 1.000000, 0.390570, 0.609960, 23, 22, 1, 1, 0.993569, 0.006431, 0.000000, 0.000000 },
-	{ 0.015140, 0.007594, 0.007905, -0.440322, 0.804364, -0.398892, -0.074386, -0.475435, -0.876601, 1.000000, 0.385830, 0.614840, 23, 22, 1, 1, 0.997243, 0.002757, 0.000000, 0.000000 },
-	{ 0.010709, 0.004600, 0.010082, -0.772862, 0.457865, -0.439369, 0.072344, -0.624295, -0.777832, 1.000000, 0.386160, 0.598200, 23, 22, 1, 1, 0.961571, 0.038429, 0.000000, 0.000000 },
-	{ 0.012247, 0.003579, 0.006436, -0.782642, 0.398181, -0.478460, 0.112654, -0.665346, -0.737986, 1.000000, 0.396140, 0.604110, 23, 22, 1, 1, 0.989094, 0.010906, 0.000000, 0.000000 },
-	{ 0.015654, 0.004860, 0.002514, -0.669027, 0.575567, -0.470239, 0.009788, -0.625812, -0.779913, 1.000000, 0.402670, 0.617690, 23, 22, 1, 1, 0.998978, 0.001021, 0.000000, 0.000000 },
-	{ 0.016982, 0.006380, 0.003287, -0.421314, 0.817001, -0.393705, -0.103334, -0.474533, -0.874152, 1.000000, 0.398330, 0.621670, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.014561, 0.002551, 0.002024, -0.790248, 0.315559, -0.525291, 0.159909, -0.721322, -0.673888, 1.000000, 0.408050, 0.612480, 23, 22, 1, 1, 0.998474, 0.001526, 0.000000, 0.000000 },
-	{ 0.016759, 0.008528, 0.008828, -0.166309, 0.917817, -0.360492, -0.091536, -0.378374, -0.921116, 1.000000, 0.381660, 0.619060, 23, 22, 1, 1, 0.998293, 0.001707, 0.000000, 0.000000 },
-	{ 0.018567, 0.007137, 0.004194, -0.154201, 0.936432, -0.315145, -0.121015, -0.334459, -0.934608, 1.000000, 0.394170, 0.625430, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.015717, 0.009843, 0.012228, -0.190768, 0.891278, -0.411377, -0.086429, -0.432696, -0.897388, 1.000000, 0.372580, 0.615230, 23, 22, 1, 1, 0.986739, 0.013261, 0.000000, 0.000000 },
-	{ 0.017224, 0.001827, -0.002152, -0.776909, 0.208854, -0.593964, 0.204792, -0.808254, -0.552074, 1.000000, 0.418360, 0.622300, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.018077, 0.003927, -0.001990, -0.673238, 0.515872, -0.529742, -0.007121, -0.720914, -0.692988, 1.000000, 0.413850, 0.626750, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.019272, 0.005264, -0.001497, -0.409844, 0.808821, -0.421707, -0.151022, -0.516108, -0.843104, 1.000000, 0.410160, 0.629840, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.020925, 0.005843, -0.001008, -0.168972, 0.934044, -0.314660, -0.153756, -0.340322, -0.927653, 1.000000, 0.407540, 0.633950, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.021494, 0.004115, -0.005286, -0.387189, 0.768053, -0.510078, -0.150323, -0.598414, -0.786959, 1.000000, 0.419430, 0.637870, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.023098, 0.004688, -0.005406, -0.202046, 0.879095, -0.431705, -0.158231, -0.464306, -0.871426, 1.000000, 0.418730, 0.642460, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.022870, 0.002847, -0.007377, -0.371764, 0.458242, -0.807345, -0.011353, -0.871857, -0.489630, 1.000000, 0.425210, 0.642500, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.021757, 0.002440, -0.006941, -0.566691, 0.269520, -0.778601, 0.113044, -0.910615, -0.397494, 1.000000, 0.425540, 0.639390, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.021776, 0.001130, -0.006873, -0.562578, -0.114959, -0.818713, 0.292671, -0.953851, -0.067175, 1.000000, 0.428660, 0.638180, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.023396, 0.001116, -0.007705, -0.334817, -0.139628, -0.931881, 0.119647, -0.987255, 0.104937, 1.000000, 0.429790, 0.643630, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.024380, 0.003214, -0.007745, -0.194756, 0.552011, -0.810774, -0.102465, -0.833529, -0.542890, 1.000000, 0.424710, 0.646500, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.024992, 0.001121, -0.008181, -0.135803, -0.110156, -0.984593, -0.081564, -0.989183, 0.121919, 1.000000, 0.429970, 0.648680, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.019754, 0.001379, -0.005175, -0.721476, 0.064384, -0.689440, 0.263715, -0.895083, -0.359556, 1.000000, 0.425170, 0.631300, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.020346, 0.003096, -0.005317, -0.647399, 0.436257, -0.624943, 0.011821, -0.814126, -0.580567, 1.000000, 0.421620, 0.634580, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.026269, 0.003467, -0.007859, 0.045092, 0.623503, -0.780520, -0.182838, -0.762966, -0.620043, 1.000000, 0.423690, 0.651120, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.026860, 0.001071, -0.008280, 0.094313, -0.103363, -0.990162, -0.298476, -0.951778, 0.070926, 1.000000, 0.429210, 0.654350, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.028575, 0.003446, -0.007475, 0.299471, 0.658150, -0.690764, -0.230839, -0.652502, -0.721772, 1.000000, 0.421820, 0.656870, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.029032, 0.000900, -0.007831, 0.310993, -0.110944, -0.943915, -0.500703, -0.863287, -0.063500, 1.000000, 0.426950, 0.661000, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.031014, 0.002988, -0.006460, 0.529824, 0.645035, -0.550651, -0.244685, -0.505405, -0.827463, 1.000000, 0.418920, 0.663200, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.031228, 0.000537, -0.006792, 0.517430, -0.133314, -0.845277, -0.650153, -0.703500, -0.287034, 1.000000, 0.423020, 0.667770, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033032, 0.002145, -0.004847, 0.727691, 0.583159, -0.361097, -0.191316, -0.332993, -0.923317, 1.000000, 0.415080, 0.668940, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033019, 0.000029, -0.005227, 0.723712, -0.170017, -0.668832, -0.653207, -0.481419, -0.584428, 1.000000, 0.417860, 0.673190, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.034119, 0.001140, -0.002967, 0.876417, 0.463153, -0.131845, -0.069800, -0.148718, -0.986413, 1.000000, 0.410640, 0.673110, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.034063, -0.000464, -0.003305, 0.896894, -0.208314, -0.390110, -0.432363, -0.227599, -0.872503, 1.000000, 0.412120, 0.676620, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.034333, 0.000387, -0.001486, 0.959677, 0.254094, 0.120232, 0.123562, 0.002875, -0.992333, 1.000000, 0.407140, 0.675170, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.034263, -0.000786, -0.001209, 0.993574, -0.098351, 0.056008, 0.057942, 0.016922, -0.998177, 1.000000, 0.406190, 0.678110, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.027336, 0.005079, -0.004757, 0.206872, 0.945399, -0.251843, -0.105430, -0.234371, -0.966413, 1.000000, 0.415130, 0.652590, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.025038, 0.005091, -0.005339, -0.017464, 0.934109, -0.356561, -0.152970, -0.354913, -0.922300, 1.000000, 0.417430, 0.647150, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.029807, 0.004443, -0.003669, 0.411257, 0.902247, -0.129684, -0.035016, -0.126530, -0.991345, 1.000000, 0.412330, 0.659270, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.031884, 0.003299, -0.002123, 0.574573, 0.818450, -0.002448, 0.043430, -0.033475, -0.998496, 1.000000, 0.408270, 0.665690, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033124, 0.002048, -0.000516, 0.726466, 0.673686, 0.135626, 0.123638, 0.066008, -0.990130, 1.000000, 0.403930, 0.670310, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033596, 0.000736, 0.000666, 0.888412, 0.371180, 0.270091, 0.230757, 0.147520, -0.961764, 1.000000, 0.401100, 0.673660, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033626, -0.000867, 0.001509, 0.952719, 0.124136, 0.277339, 0.255546, 0.166456, -0.952360, 1.000000, 0.398400, 0.677580, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.031958, 0.001317, 0.004686, 0.867652, 0.407068, 0.285438, 0.222972, 0.194542, -0.955216, 1.000000, 0.389740, 0.669510, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.031243, 0.002917, 0.003795, 0.724503, 0.663725, 0.185916, 0.129297, 0.134071, -0.982501, 1.000000, 0.392040, 0.665290, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.029897, 0.002211, 0.009583, 0.867917, 0.421088, 0.263448, 0.222638, 0.144326, -0.964159, 1.000000, 0.375570, 0.663960, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.028838, 0.004047, 0.008888, 0.744175, 0.649730, 0.155095, 0.120242, 0.098094, -0.987886, 1.000000, 0.377810, 0.658270, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.028029, 0.003438, 0.014176, 0.890035, 0.387369, 0.240382, 0.210942, 0.117519, -0.970409, 1.000000, 0.362670, 0.658330, 23, 22, 1, 1, 0.997357, 0.002643, 0.000000, 0.000000 },
-	{ 0.026880, 0.005542, 0.013611, 0.792023, 0.604683, 0.084011, 0.070665, 0.044857, -0.996491, 1.000000, 0.364690, 0.651360, 23, 22, 1, 1, 0.997706, 0.002294, 0.000000, 0.000000 },
-	{ 0.026615, 0.004708, 0.017778, 0.924300, 0.305386, 0.228929, 0.199698, 0.124197, -0.971955, 1.000000, 0.352890, 0.652970, 23, 22, 1, 1, 0.982520, 0.017481, 0.000000, 0.000000 },
-	{ 0.028771, 0.000854, 0.014529, 0.919280, 0.179966, 0.350052, 0.327306, 0.144454, -0.933812, 1.000000, 0.360880, 0.665950, 23, 22, 1, 1, 0.993321, 0.006679, 0.000000, 0.000000 },
-	{ 0.027153, 0.001873, 0.018125, 0.924182, 0.127998, 0.359866, 0.342329, 0.140295, -0.929047, 1.000000, 0.350550, 0.661380, 23, 22, 1, 1, 0.973464, 0.026536, 0.000000, 0.000000 },
-	{ 0.025716, 0.007035, 0.017330, 0.846795, 0.530628, 0.037050, 0.018708, 0.039901, -0.999029, 1.000000, 0.354630, 0.645840, 23, 22, 1, 1, 0.979433, 0.020567, 0.000000, 0.000000 },
-	{ 0.030634, -0.000109, 0.010022, 0.918896, 0.212204, 0.332565, 0.304790, 0.153336, -0.939995, 1.000000, 0.373700, 0.670950, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.024289, 0.008642, 0.016503, 0.656806, 0.741213, -0.138599, -0.099576, -0.096939, -0.990297, 1.000000, 0.357280, 0.640120, 23, 22, 1, 1, 0.972567, 0.027433, 0.000000, 0.000000 },
-	{ 0.025328, 0.007071, 0.012697, 0.622643, 0.780122, -0.061040, -0.021023, -0.061301, -0.997898, 1.000000, 0.367870, 0.645130, 23, 22, 1, 1, 0.997772, 0.002228, 0.000000, 0.000000 },
-	{ 0.022290, 0.009720, 0.015331, 0.458806, 0.855114, -0.241406, -0.120184, -0.209468, -0.970402, 1.000000, 0.361290, 0.633760, 23, 22, 1, 1, 0.987969, 0.012031, 0.000000, 0.000000 },
-	{ 0.023358, 0.008175, 0.011532, 0.438669, 0.884673, -0.157873, -0.045496, -0.153590, -0.987087, 1.000000, 0.371780, 0.638460, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.021056, 0.008791, 0.010474, 0.242748, 0.939877, -0.240218, -0.062894, -0.231856, -0.970715, 1.000000, 0.375320, 0.631390, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.022946, 0.007374, 0.005721, 0.206389, 0.965578, -0.158313, -0.055261, -0.150035, -0.987135, 1.000000, 0.387730, 0.637940, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.020610, 0.007463, 0.004937, 0.021686, 0.968675, -0.247384, -0.084287, -0.244789, -0.965906, 1.000000, 0.390770, 0.631130, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.018726, 0.008901, 0.009641, 0.055468, 0.949532, -0.308728, -0.077994, -0.304139, -0.949430, 1.000000, 0.378420, 0.624480, 23, 22, 1, 1, 0.998783, 0.001217, 0.000000, 0.000000 },
-	{ 0.019949, 0.010273, 0.014136, 0.270257, 0.910480, -0.313029, -0.110005, -0.293797, -0.949517, 1.000000, 0.365460, 0.626960, 23, 22, 1, 1, 0.989572, 0.010428, 0.000000, 0.000000 },
-	{ 0.017642, 0.010309, 0.013101, 0.075295, 0.925914, -0.370154, -0.096997, -0.362646, -0.926865, 1.000000, 0.369290, 0.620350, 23, 22, 1, 1, 0.986571, 0.013429, 0.000000, 0.000000 },
-	{ 0.025238, 0.006734, 0.006818, 0.409426, 0.910600, -0.056376, -0.001856, -0.060961, -0.998139, 1.000000, 0.383920, 0.644810, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.027250, 0.005542, 0.007983, 0.581939, 0.812216, 0.040647, 0.046988, 0.016317, -0.998762, 1.000000, 0.380240, 0.651740, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.022998, 0.006186, -0.000584, -0.013825, 0.972275, -0.233433, -0.131260, -0.233200, -0.963529, 1.000000, 0.405300, 0.639730, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.025301, 0.006220, 0.000180, 0.186644, 0.972944, -0.136179, -0.092272, -0.120641, -0.988399, 1.000000, 0.402120, 0.645620, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.027695, 0.005603, 0.001355, 0.394485, 0.918462, -0.028435, -0.009692, -0.026784, -0.999594, 1.000000, 0.398190, 0.652340, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.029799, 0.004347, 0.002665, 0.560997, 0.824590, 0.073036, 0.067657, 0.042261, -0.996813, 1.000000, 0.394630, 0.659600, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012140, -0.021532, -0.052339, -0.282161, -0.958685, -0.036166, 0.946996, -0.284359, 0.149459, 1.000000, 0.569880, 0.484980, 6, 5, 1, 1, 0.998904, 0.001096, 0.000000, 0.000000 },
-	{ -0.014585, -0.020755, -0.049482, -0.320301, -0.946923, -0.027281, 0.947150, -0.320650, 0.009469, 1.000000, 0.562040, 0.476730, 6, 5, 1, 1, 0.981643, 0.018357, 0.000000, 0.000000 },
-	{ -0.013487, -0.021073, -0.048528, -0.182737, -0.979501, 0.084765, 0.982849, -0.179826, 0.040861, 1.000000, 0.565550, 0.474280, 6, 5, 1, 1, 0.988385, 0.011615, 0.000000, 0.000000 },
-	{ -0.011109, -0.021772, -0.051314, -0.103957, -0.990541, 0.089568, 0.984211, -0.089484, 0.152716, 1.000000, 0.573240, 0.482630, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015526, -0.020308, -0.050224, -0.407690, -0.905875, -0.114803, 0.912940, -0.406872, -0.031543, 1.000000, 0.559080, 0.478790, 6, 5, 1, 1, 0.986409, 0.013591, 0.000000, 0.000000 },
-	{ -0.008824, -0.022096, -0.053900, 0.072307, -0.995949, 0.053450, 0.946766, 0.085394, 0.310390, 1.000000, 0.579490, 0.491240, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016303, -0.019801, -0.050796, -0.485350, -0.849124, -0.208383, 0.873168, -0.482974, -0.065682, 1.000000, 0.556640, 0.480430, 6, 5, 1, 1, 0.990376, 0.009624, 0.000000, 0.000000 },
-	{ -0.017051, -0.019171, -0.051264, -0.541324, -0.785608, -0.299648, 0.836320, -0.539874, -0.095417, 1.000000, 0.554070, 0.481900, 6, 5, 1, 1, 0.990787, 0.009213, 0.000000, 0.000000 },
-	{ -0.017908, -0.018360, -0.051669, -0.573516, -0.721267, -0.388399, 0.810617, -0.568101, -0.141991, 1.000000, 0.550670, 0.483330, 6, 5, 1, 1, 0.990472, 0.009528, 0.000000, 0.000000 },
-	{ -0.021212, -0.016969, -0.049650, -0.592439, -0.674995, -0.439771, 0.803677, -0.533038, -0.264526, 1.000000, 0.540400, 0.479640, 6, 5, 1, 1, 0.938721, 0.061279, 0.000000, 0.000000 },
-	{ -0.021862, -0.015731, -0.050321, -0.652062, -0.500324, -0.569641, 0.742151, -0.574829, -0.344650, 1.000000, 0.537340, 0.482850, 6, 5, 1, 1, 0.932014, 0.067986, 0.000000, 0.000000 },
-	{ -0.023325, -0.016596, -0.047110, -0.605552, -0.705957, -0.367331, 0.795240, -0.519401, -0.312755, 1.000000, 0.534390, 0.474250, 6, 5, 1, 1, 0.783466, 0.216534, 0.000000, 0.000000 },
-	{ -0.024088, -0.015328, -0.047931, -0.680595, -0.551888, -0.481883, 0.729490, -0.571572, -0.375700, 1.000000, 0.531170, 0.477900, 6, 5, 1, 1, 0.746977, 0.253023, 0.000000, 0.000000 },
-	{ -0.022278, -0.014135, -0.050874, -0.675746, -0.269265, -0.686195, 0.676893, -0.595248, -0.433009, 1.000000, 0.533790, 0.486800, 6, 5, 1, 1, 0.889082, 0.110918, 0.000000, 0.000000 },
-	{ -0.024640, -0.013679, -0.048622, -0.731934, -0.311871, -0.605813, 0.646253, -0.599515, -0.472164, 1.000000, 0.527480, 0.482040, 6, 5, 1, 1, 0.664534, 0.335466, 0.000000, 0.000000 },
-	{ -0.024707, -0.011681, -0.049079, -0.733600, -0.042353, -0.678261, 0.568344, -0.585419, -0.578160, 1.000000, 0.523620, 0.487380, 6, 5, 1, 1, 0.679147, 0.320853, 0.000000, 0.000000 },
-	{ -0.022345, -0.012213, -0.051200, -0.653591, -0.038400, -0.755873, 0.626526, -0.587737, -0.511890, 1.000000, 0.529750, 0.491830, 6, 5, 1, 1, 0.898275, 0.101725, 0.000000, 0.000000 },
-	{ -0.022073, -0.010149, -0.051272, -0.600875, 0.168289, -0.781427, 0.580411, -0.580310, -0.571282, 1.000000, 0.525450, 0.497670, 6, 5, 1, 1, 0.922297, 0.077703, 0.000000, 0.000000 },
-	{ -0.024350, -0.009526, -0.049263, -0.695798, 0.183974, -0.694275, 0.503769, -0.563985, -0.654323, 1.000000, 0.519580, 0.493760, 6, 5, 1, 1, 0.724512, 0.275488, 0.000000, 0.000000 },
-	{ -0.021458, -0.008237, -0.051056, -0.523644, 0.373007, -0.765939, 0.518132, -0.574232, -0.633875, 1.000000, 0.521680, 0.503470, 6, 5, 1, 1, 0.921478, 0.078522, 0.000000, 0.000000 },
-	{ -0.023670, -0.007548, -0.049053, -0.618256, 0.402622, -0.675022, 0.438065, -0.536552, -0.721256, 1.000000, 0.515780, 0.499640, 6, 5, 1, 1, 0.804529, 0.195471, 0.000000, 0.000000 },
-	{ -0.022747, -0.005922, -0.048529, -0.514041, 0.585099, -0.627233, 0.382511, -0.498144, -0.778163, 1.000000, 0.512340, 0.505080, 6, 5, 1, 1, 0.725678, 0.274322, 0.000000, 0.000000 },
-	{ -0.020591, -0.006643, -0.050601, -0.435414, 0.546599, -0.715293, 0.458206, -0.549380, -0.698734, 1.000000, 0.518530, 0.508950, 6, 5, 1, 1, 0.902737, 0.097263, 0.000000, 0.000000 },
-	{ -0.021727, -0.004688, -0.047933, -0.395878, 0.729124, -0.558264, 0.330438, -0.454103, -0.827406, 1.000000, 0.509590, 0.509920, 6, 5, 1, 1, 0.706222, 0.293778, 0.000000, 0.000000 },
-	{ -0.019631, -0.005435, -0.050028, -0.335539, 0.688775, -0.642653, 0.393546, -0.517327, -0.759931, 1.000000, 0.516050, 0.513730, 6, 5, 1, 1, 0.885037, 0.114964, 0.000000, 0.000000 },
-	{ -0.018672, -0.004665, -0.049469, -0.183869, 0.833687, -0.520729, 0.337692, -0.443941, -0.829989, 1.000000, 0.514490, 0.517530, 6, 5, 1, 1, 0.891295, 0.108705, 0.000000, 0.000000 },
-	{ -0.020708, -0.003931, -0.047371, -0.219140, 0.869789, -0.442093, 0.283140, -0.376918, -0.881910, 1.000000, 0.507980, 0.513700, 6, 5, 1, 1, 0.700825, 0.299175, 0.000000, 0.000000 },
-	{ -0.017644, -0.004300, -0.048882, -0.028181, 0.928020, -0.371463, 0.317322, -0.344083, -0.883693, 1.000000, 0.513540, 0.521080, 6, 5, 1, 1, 0.905319, 0.094681, 0.000000, 0.000000 },
-	{ -0.019681, -0.003584, -0.046739, -0.036264, 0.951210, -0.306405, 0.265652, -0.286400, -0.920546, 1.000000, 0.506690, 0.517190, 6, 5, 1, 1, 0.728915, 0.271085, 0.000000, 0.000000 },
-	{ -0.016522, -0.004143, -0.048266, 0.070065, 0.963557, -0.258166, 0.315647, -0.266919, -0.910561, 1.000000, 0.512860, 0.525030, 6, 5, 1, 1, 0.927872, 0.072128, 0.000000, 0.000000 },
-	{ -0.018606, -0.003452, -0.046052, 0.079592, 0.974470, -0.209938, 0.267438, -0.223760, -0.937235, 1.000000, 0.505610, 0.520920, 6, 5, 1, 1, 0.789598, 0.210402, 0.000000, 0.000000 },
-	{ -0.015383, -0.004134, -0.047561, 0.152587, 0.975236, -0.160097, 0.316831, -0.201715, -0.926784, 1.000000, 0.512180, 0.529030, 6, 5, 1, 1, 0.942114, 0.057886, 0.000000, 0.000000 },
-	{ -0.017477, -0.003469, -0.045279, 0.162761, 0.977743, -0.132391, 0.271453, -0.173376, -0.946707, 1.000000, 0.504510, 0.524990, 6, 5, 1, 1, 0.791552, 0.208448, 0.000000, 0.000000 },
-	{ -0.016315, -0.003614, -0.044387, 0.243004, 0.968493, -0.054505, 0.277573, -0.123265, -0.952764, 1.000000, 0.503180, 0.529300, 6, 5, 1, 1, 0.790864, 0.209136, 0.000000, 0.000000 },
-	{ -0.014241, -0.004259, -0.046695, 0.237491, 0.969012, -0.067935, 0.327376, -0.145687, -0.933595, 1.000000, 0.511170, 0.533290, 6, 5, 1, 1, 0.931137, 0.068863, 0.000000, 0.000000 },
-	{ -0.013082, -0.004570, -0.045695, 0.341266, 0.939239, 0.036992, 0.344968, -0.088539, -0.934429, 1.000000, 0.510040, 0.537900, 6, 5, 1, 1, 0.913137, 0.086863, 0.000000, 0.000000 },
-	{ -0.015136, -0.003946, -0.043380, 0.343016, 0.938287, 0.044252, 0.292855, -0.062062, -0.954141, 1.000000, 0.501630, 0.533890, 6, 5, 1, 1, 0.762415, 0.237585, 0.000000, 0.000000 },
-	{ -0.044113, -0.067517, 0.010281, 0.312834, -0.937638, 0.151556, -0.076115, -0.183800, -0.980012, 1.000000, 0.336230, 0.169590, 17, 13, 1, 1, 0.940506, 0.059494, 0.000000, 0.000000 },
-	{ -0.044267, -0.067170, 0.013752, 0.316179, -0.948210, 0.030480, 0.115831, 0.006696, -0.993247, 1.000000, 0.328320, 0.170030, 17, 13, 1, 1, 0.699646, 0.300354, 0.000000, 0.000000 },
-	{ -0.042816, -0.066509, 0.014189, 0.517271, -0.854694, -0.043920, 0.104953, 0.114284, -0.987889, 1.000000, 0.328740, 0.165670, 17, 13, 1, 12, 0.664890, 0.332306, 0.001752, 0.001053 },
-	{ -0.042609, -0.066732, 0.010825, 0.520155, -0.842069, 0.142686, -0.033945, -0.187316, -0.981713, 1.000000, 0.334910, 0.165170, 17, 13, 1, 1, 0.915492, 0.084508, 0.000000, 0.000000 },
-	{ -0.045443, -0.067850, 0.009998, 0.097931, -0.983468, 0.152320, -0.100422, -0.162040, -0.981661, 1.000000, 0.336900, 0.173200, 17, 13, 1, 1, 0.977397, 0.022603, 0.000000, 0.000000 },
-	{ -0.045495, -0.067421, 0.013592, 0.071396, -0.995557, 0.061392, 0.095818, -0.054588, -0.993901, 1.000000, 0.328000, 0.173420, 17, 13, 1, 1, 0.823976, 0.176024, 0.000000, 0.000000 },
-	{ -0.043797, -0.068274, 0.005756, 0.291489, -0.934023, 0.206484, -0.201974, -0.271087, -0.941126, 1.000000, 0.346490, 0.166560, 17, 13, 18, 1, 0.994082, 0.003896, 0.002022, 0.000000 },
-	{ -0.045214, -0.068612, 0.005470, 0.103868, -0.974631, 0.198256, -0.229994, -0.217468, -0.948584, 1.000000, 0.347660, 0.170310, 17, 18, 13, 1, 0.995985, 0.002817, 0.001198, 0.000000 },
-	{ -0.043299, -0.069304, 0.000936, 0.285121, -0.928252, 0.238860, -0.276577, -0.318281, -0.906754, 1.000000, 0.357600, 0.161480, 17, 18, 1, 1, 0.973743, 0.026257, 0.000000, 0.000000 },
-	{ -0.044753, -0.069638, 0.000679, 0.108408, -0.966451, 0.232852, -0.301099, -0.255151, -0.918824, 1.000000, 0.359090, 0.165220, 17, 18, 1, 1, 0.965283, 0.034717, 0.000000, 0.000000 },
-	{ -0.044152, -0.070686, -0.003654, 0.130633, -0.963634, 0.233120, -0.331908, -0.264074, -0.905595, 1.000000, 0.369300, 0.159470, 17, 18, 1, 1, 0.796624, 0.203376, 0.000000, 0.000000 },
-	{ -0.042743, -0.070317, -0.003405, 0.311938, -0.920352, 0.235897, -0.304485, -0.332029, -0.892774, 1.000000, 0.367710, 0.155920, 17, 18, 1, 1, 0.851026, 0.148974, 0.000000, 0.000000 },
-	{ -0.041743, -0.068574, 0.001359, 0.498113, -0.835560, 0.231781, -0.233983, -0.386908, -0.891938, 1.000000, 0.355480, 0.157410, 17, 18, 1, 1, 0.979178, 0.020822, 0.000000, 0.000000 },
-	{ -0.041227, -0.069544, -0.003088, 0.525861, -0.820082, 0.225691, -0.260589, -0.407914, -0.875043, 1.000000, 0.365550, 0.151890, 17, 18, 1, 1, 0.879654, 0.120346, 0.000000, 0.000000 },
-	{ -0.042247, -0.067520, 0.006274, 0.498756, -0.841302, 0.208458, -0.153009, -0.322193, -0.934227, 1.000000, 0.344580, 0.162340, 17, 13, 18, 1, 0.990486, 0.007807, 0.001707, 0.000000 },
-	{ -0.045378, -0.067544, 0.015830, 0.005683, -0.980585, -0.196014, 0.251548, 0.191116, -0.948788, 1.000000, 0.322850, 0.171710, 13, 17, 12, 1, 0.535940, 0.463020, 0.001040, 0.000000 },
-	{ -0.044236, -0.067382, 0.015880, 0.294911, -0.915895, -0.272332, 0.298841, 0.359119, -0.884154, 1.000000, 0.324230, 0.168570, 13, 17, 12, 1, 0.678934, 0.319737, 0.001330, 0.000000 },
-	{ -0.044032, -0.067973, 0.016741, 0.272892, -0.441931, -0.854533, 0.360154, 0.870585, -0.335218, 1.000000, 0.322970, 0.167030, 13, 17, 12, 1, 0.917719, 0.081067, 0.001214, 0.000000 },
-	{ -0.042652, -0.067779, 0.017202, 0.431697, -0.381906, -0.817182, 0.297897, 0.915479, -0.270473, 1.000000, 0.325330, 0.163680, 13, 17, 12, 1, 0.905233, 0.090974, 0.002031, 0.001761 },
-	{ -0.042828, -0.066960, 0.016259, 0.469281, -0.780988, -0.412108, 0.221097, 0.555741, -0.801417, 1.000000, 0.326130, 0.164840, 13, 17, 1, 12, 0.676791, 0.317857, 0.003285, 0.002066 },
-	{ -0.045114, -0.068091, 0.016686, -0.142026, -0.545624, -0.825907, 0.374333, 0.742798, -0.555091, 1.000000, 0.321010, 0.169940, 13, 17, 12, 1, 0.865968, 0.132877, 0.001154, 0.000000 },
-	{ -0.042378, -0.068643, 0.017239, 0.341034, 0.450778, -0.824921, 0.321552, 0.768656, 0.552967, 1.000000, 0.325000, 0.162680, 13, 17, 12, 1, 0.986022, 0.012952, 0.001026, 0.000000 },
-	{ -0.043737, -0.068787, 0.016701, 0.159613, 0.483400, -0.860725, 0.419122, 0.756235, 0.502439, 1.000000, 0.322240, 0.165700, 13, 17, 1, 1, 0.989965, 0.010035, 0.000000, 0.000000 },
-	{ -0.041954, -0.069754, 0.016347, 0.202394, 0.767661, -0.608057, 0.623258, 0.377955, 0.684616, 1.000000, 0.324110, 0.160920, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.043289, -0.070027, 0.015697, 0.049171, 0.744562, -0.665740, 0.706644, 0.445124, 0.550017, 1.000000, 0.320910, 0.162270, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.044763, -0.068940, 0.016606, -0.206782, 0.409185, -0.888712, 0.567031, 0.790359, 0.231966, 1.000000, 0.319960, 0.167990, 13, 17, 1, 1, 0.987096, 0.012904, 0.000000, 0.000000 },
-	{ -0.044265, -0.070311, 0.015491, -0.221013, 0.678672, -0.700399, 0.776857, 0.556683, 0.294274, 1.000000, 0.318450, 0.163230, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.042696, -0.071711, 0.013590, -0.057149, 0.833211, -0.549994, 0.894775, 0.287106, 0.341976, 1.000000, 0.320270, 0.154930, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.041293, -0.071298, 0.014286, 0.100554, 0.858271, -0.503250, 0.898713, 0.138655, 0.416041, 1.000000, 0.323970, 0.155210, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.042043, -0.073515, 0.010432, -0.136553, 0.875578, -0.463376, 0.928621, 0.276034, 0.247928, 1.000000, 0.321010, 0.144440, 13, 14, 1, 1, 0.996206, 0.003795, 0.000000, 0.000000 },
-	{ -0.040484, -0.073052, 0.011063, 0.030289, 0.900582, -0.433629, 0.933990, 0.129019, 0.333192, 1.000000, 0.325430, 0.144890, 13, 14, 1, 1, 0.996636, 0.003364, 0.000000, 0.000000 },
-	{ -0.039677, -0.074621, 0.007470, 0.011395, 0.913514, -0.406648, 0.945509, 0.122496, 0.301675, 1.000000, 0.327410, 0.133550, 13, 14, 1, 1, 0.975347, 0.024653, 0.000000, 0.000000 },
-	{ -0.041326, -0.075101, 0.006878, -0.164673, 0.887364, -0.430660, 0.935580, 0.278795, 0.216708, 1.000000, 0.322670, 0.133110, 13, 14, 1, 1, 0.966809, 0.033191, 0.000000, 0.000000 },
-	{ -0.042566, -0.075655, 0.006479, -0.315119, 0.840273, -0.441182, 0.908396, 0.401652, 0.116152, 1.000000, 0.318990, 0.132560, 13, 14, 1, 1, 0.965349, 0.034651, 0.000000, 0.000000 },
-	{ -0.043184, -0.074013, 0.010061, -0.302008, 0.827077, -0.474063, 0.907980, 0.401074, 0.121296, 1.000000, 0.317720, 0.143970, 13, 14, 1, 1, 0.995834, 0.004166, 0.000000, 0.000000 },
-	{ -0.043704, -0.072137, 0.013266, -0.262448, 0.779000, -0.569456, 0.879298, 0.436133, 0.191372, 1.000000, 0.317480, 0.154790, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.045737, -0.069068, 0.016997, -0.547069, 0.239730, -0.802025, 0.556280, 0.820068, -0.134321, 1.000000, 0.317560, 0.170440, 13, 17, 1, 1, 0.976397, 0.023603, 0.000000, 0.000000 },
-	{ -0.046183, -0.068075, 0.017134, -0.485080, -0.562860, -0.669242, 0.273113, 0.629515, -0.727406, 1.000000, 0.318820, 0.173100, 13, 17, 12, 1, 0.845566, 0.151779, 0.001543, 0.001112 },
-	{ -0.046528, -0.067452, 0.016222, -0.255942, -0.952749, -0.163596, 0.138632, 0.131308, -0.981601, 1.000000, 0.321180, 0.175010, 13, 17, 1, 12, 0.581536, 0.415767, 0.001476, 0.001221 },
-	{ -0.046732, -0.067337, 0.013829, -0.154731, -0.985148, 0.074442, 0.065392, -0.085396, -0.994199, 1.000000, 0.327050, 0.176720, 17, 13, 1, 1, 0.760968, 0.239032, 0.000000, 0.000000 },
-	{ -0.046757, -0.067841, 0.009982, -0.108129, -0.982092, 0.154286, -0.113419, -0.141996, -0.983348, 1.000000, 0.337010, 0.176630, 17, 13, 1, 1, 0.958046, 0.041954, 0.000000, 0.000000 },
-	{ -0.046579, -0.068665, 0.005324, -0.077337, -0.978421, 0.191601, -0.249208, -0.167106, -0.953924, 1.000000, 0.348480, 0.173750, 17, 18, 13, 1, 0.993670, 0.004283, 0.002047, 0.000000 },
-	{ -0.046138, -0.069716, 0.000512, -0.054106, -0.973784, 0.220948, -0.318101, -0.192935, -0.928218, 1.000000, 0.360110, 0.168700, 17, 18, 1, 1, 0.956510, 0.043490, 0.000000, 0.000000 },
-	{ -0.045503, -0.070793, -0.003855, -0.029732, -0.974820, 0.221002, -0.344763, -0.197530, -0.917671, 1.000000, 0.370520, 0.162820, 17, 18, 1, 1, 0.842109, 0.157891, 0.000000, 0.000000 },
-	{ -0.046965, -0.070704, -0.004139, -0.188259, -0.961448, 0.200439, -0.346462, -0.125953, -0.929570, 1.000000, 0.371980, 0.166370, 17, 18, 1, 1, 0.866128, 0.133872, 0.000000, 0.000000 },
-	{ -0.047645, -0.069581, 0.000289, -0.208722, -0.956539, 0.203636, -0.318190, -0.130473, -0.939006, 1.000000, 0.361470, 0.172340, 17, 18, 1, 1, 0.959250, 0.040750, 0.000000, 0.000000 },
-	{ -0.048143, -0.068432, 0.005270, -0.225418, -0.956644, 0.184442, -0.247829, -0.126784, -0.960472, 1.000000, 0.349370, 0.177630, 17, 18, 13, 1, 0.994737, 0.003124, 0.002138, 0.000000 },
-	{ -0.048340, -0.067482, 0.010279, -0.246930, -0.956580, 0.154856, -0.115455, -0.129624, -0.984819, 1.000000, 0.336270, 0.180950, 17, 13, 1, 1, 0.957560, 0.041439, 0.001001, 0.000000 },
-	{ -0.048209, -0.066924, 0.014519, -0.284715, -0.955869, 0.072473, 0.023000, -0.082392, -0.996335, 1.000000, 0.325120, 0.180970, 17, 13, 1, 1, 0.783780, 0.213078, 0.003142, 0.000000 },
-	{ -0.047846, -0.067143, 0.017060, -0.387995, -0.904930, -0.174819, 0.060240, 0.164373, -0.984557, 1.000000, 0.318930, 0.179210, 13, 17, 1, 12, 0.525503, 0.468322, 0.004167, 0.002008 },
-	{ -0.047351, -0.067966, 0.018040, -0.604392, -0.536517, -0.588948, 0.211623, 0.604574, -0.767924, 1.000000, 0.316000, 0.176870, 13, 17, 1, 12, 0.822766, 0.171797, 0.002813, 0.002624 },
-	{ -0.046776, -0.069189, 0.017842, -0.705818, 0.110304, -0.699753, 0.472479, 0.809296, -0.349003, 1.000000, 0.314500, 0.173480, 13, 17, 12, 1, 0.965978, 0.031756, 0.001146, 0.001121 },
-	{ -0.045164, -0.070596, 0.015720, -0.498795, 0.555742, -0.665097, 0.725849, 0.687206, 0.029860, 1.000000, 0.316030, 0.164690, 13, 17, 1, 1, 0.998447, 0.001553, 0.000000, 0.000000 },
-	{ -0.044577, -0.072575, 0.013273, -0.487408, 0.680553, -0.547066, 0.794743, 0.605284, 0.044900, 1.000000, 0.314890, 0.155240, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.044086, -0.074555, 0.009895, -0.500632, 0.732851, -0.460757, 0.821521, 0.570006, 0.013997, 1.000000, 0.315030, 0.143630, 13, 14, 1, 1, 0.994281, 0.005720, 0.000000, 0.000000 },
-	{ -0.043474, -0.076261, 0.006212, -0.508978, 0.741805, -0.436654, 0.819680, 0.572562, 0.017244, 1.000000, 0.316270, 0.131920, 13, 14, 1, 1, 0.961869, 0.038131, 0.000000, 0.000000 },
-	{ -0.046128, -0.070931, 0.016367, -0.678117, 0.430291, -0.595825, 0.625477, 0.763571, -0.160431, 1.000000, 0.313080, 0.166920, 13, 17, 1, 1, 0.997999, 0.002001, 0.000000, 0.000000 },
-	{ -0.045483, -0.073123, 0.013586, -0.664487, 0.556547, -0.498711, 0.682683, 0.723537, -0.102167, 1.000000, 0.311880, 0.156310, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.044938, -0.075267, 0.009931, -0.678265, 0.598121, -0.426858, 0.694360, 0.711785, -0.105952, 1.000000, 0.312120, 0.143650, 13, 14, 1, 1, 0.994000, 0.006000, 0.000000, 0.000000 },
-	{ -0.044250, -0.077051, 0.006070, -0.689534, 0.596113, -0.411330, 0.681785, 0.725877, -0.090947, 1.000000, 0.313600, 0.131380, 13, 14, 1, 1, 0.947077, 0.052923, 0.000000, 0.000000 },
-	{ -0.048692, -0.067867, 0.019356, -0.640717, -0.507855, -0.575817, 0.205344, 0.609310, -0.765882, 1.000000, 0.312360, 0.181300, 13, 17, 1, 12, 0.855769, 0.129641, 0.008713, 0.005877 },
-	{ -0.049453, -0.066648, 0.018237, -0.446469, -0.866802, -0.222083, 0.045385, 0.225937, -0.973084, 1.000000, 0.316360, 0.184780, 13, 17, 1, 12, 0.519773, 0.460998, 0.014080, 0.005150 },
-	{ -0.050113, -0.066203, 0.015462, -0.356273, -0.932875, 0.053055, -0.013597, -0.051598, -0.998576, 1.000000, 0.323170, 0.187150, 17, 13, 1, 12, 0.811672, 0.177587, 0.009476, 0.001265 },
-	{ -0.050476, -0.066735, 0.010861, -0.339289, -0.929062, 0.147401, -0.115647, -0.114310, -0.986691, 1.000000, 0.334930, 0.187660, 17, 13, 1, 1, 0.966714, 0.029428, 0.003858, 0.000000 },
-	{ -0.050227, -0.067803, 0.005437, -0.342234, -0.924581, 0.167408, -0.228819, -0.090794, -0.969226, 1.000000, 0.349670, 0.183650, 17, 18, 13, 1, 0.996927, 0.001977, 0.001097, 0.000000 },
-	{ -0.049524, -0.069092, 0.000049, -0.350588, -0.920369, 0.173230, -0.291822, -0.068403, -0.954024, 1.000000, 0.363070, 0.177080, 17, 18, 1, 1, 0.968175, 0.031825, 0.000000, 0.000000 },
-	{ -0.048717, -0.070313, -0.004605, -0.350943, -0.921313, 0.167393, -0.317563, -0.051070, -0.946861, 1.000000, 0.374020, 0.170520, 17, 18, 1, 1, 0.853293, 0.146707, 0.000000, 0.000000 },
-	{ -0.045844, -0.076406, 0.010047, -0.804845, 0.454871, -0.381205, 0.561452, 0.791741, -0.240663, 1.000000, 0.308240, 0.143240, 13, 14, 1, 1, 0.989710, 0.010290, 0.000000, 0.000000 },
-	{ -0.045040, -0.078274, 0.005939, -0.807364, 0.456012, -0.374454, 0.554345, 0.803611, -0.216588, 1.000000, 0.310020, 0.130370, 13, 14, 1, 1, 0.922284, 0.077716, 0.000000, 0.000000 },
-	{ -0.047930, -0.069485, 0.019077, -0.774672, 0.030705, -0.631617, 0.408663, 0.786536, -0.462986, 1.000000, 0.310280, 0.176810, 13, 17, 12, 1, 0.968043, 0.026585, 0.002691, 0.002681 },
-	{ -0.047203, -0.071538, 0.017345, -0.789979, 0.319457, -0.523337, 0.526254, 0.791266, -0.311376, 1.000000, 0.308890, 0.169450, 13, 17, 1, 1, 0.998095, 0.001905, 0.000000, 0.000000 },
-	{ -0.046499, -0.074036, 0.014101, -0.791246, 0.428006, -0.436739, 0.563328, 0.788039, -0.248306, 1.000000, 0.307760, 0.157350, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.027593, -0.005378, 0.003786, 0.999460, -0.019759, 0.026257, 0.023801, 0.986204, -0.163812, 1.000000, 0.789930, 0.747680, 4, 1, 1, 1, 0.994079, 0.005921, 0.000000, 0.000000 },
-	{ -0.027386, -0.005564, 0.006438, 0.979960, -0.011096, -0.198883, -0.010058, 0.994417, -0.105038, 1.000000, 0.788780, 0.741640, 4, 1, 1, 1, 0.978984, 0.021016, 0.000000, 0.000000 },
-	{ -0.027730, -0.002769, 0.006607, 0.956001, 0.223584, -0.189927, -0.243530, 0.965815, -0.088849, 1.000000, 0.797310, 0.740660, 4, 1, 1, 1, 0.978547, 0.021453, 0.000000, 0.000000 },
-	{ -0.027928, -0.002608, 0.003909, 0.972873, 0.228249, 0.037686, -0.218164, 0.959402, -0.178754, 1.000000, 0.798230, 0.746130, 4, 1, 1, 1, 0.993871, 0.006129, 0.000000, 0.000000 },
-	{ -0.028088, -0.008968, 0.003568, 0.968861, -0.247427, 0.009386, 0.245439, 0.954693, -0.168288, 1.000000, 0.778670, 0.749800, 4, 1, 1, 1, 0.994784, 0.005216, 0.000000, 0.000000 },
-	{ -0.027874, -0.009183, 0.006158, 0.950939, -0.211913, -0.225405, 0.186591, 0.973997, -0.128508, 1.000000, 0.777400, 0.743460, 4, 1, 1, 1, 0.980245, 0.019755, 0.000000, 0.000000 },
-	{ -0.028481, -0.000911, 0.006699, 0.876571, 0.444277, -0.185045, -0.463279, 0.883087, -0.074370, 1.000000, 0.803350, 0.740160, 4, 1, 1, 1, 0.969453, 0.030547, 0.000000, 0.000000 },
-	{ -0.028656, -0.000750, 0.003902, 0.884509, 0.464192, 0.046583, -0.447584, 0.872522, -0.195892, 1.000000, 0.804020, 0.745260, 4, 1, 1, 1, 0.994106, 0.005894, 0.000000, 0.000000 },
-	{ -0.026774, -0.003122, 0.009230, 0.927769, 0.181517, -0.326030, -0.193836, 0.981019, -0.005408, 1.000000, 0.795300, 0.734080, 4, 1, 21, 1, 0.926917, 0.071775, 0.001309, 0.000000 },
-	{ -0.027398, -0.000995, 0.009430, 0.863851, 0.383487, -0.326648, -0.395439, 0.917939, 0.031893, 1.000000, 0.801740, 0.733660, 4, 1, 21, 1, 0.916540, 0.081480, 0.001980, 0.000000 },
-	{ -0.027082, -0.009600, 0.008764, 0.916429, -0.177167, -0.358846, 0.159630, 0.984076, -0.078182, 1.000000, 0.776020, 0.736110, 4, 1, 1, 1, 0.940690, 0.059310, 0.000000, 0.000000 },
-	{ -0.026591, -0.006027, 0.009023, 0.942248, -0.014928, -0.334583, 0.001629, 0.999199, -0.039995, 1.000000, 0.786850, 0.734810, 4, 1, 1, 1, 0.943857, 0.056143, 0.000000, 0.000000 },
-	{ -0.025957, -0.010204, 0.011722, 0.917690, -0.164273, -0.361746, 0.162749, 0.986050, -0.034910, 1.000000, 0.774790, 0.727330, 4, 1, 1, 1, 0.817542, 0.182458, 0.000000, 0.000000 },
-	{ -0.025477, -0.006572, 0.012002, 0.941667, -0.021309, -0.335872, 0.026596, 0.999584, 0.011147, 1.000000, 0.785260, 0.726350, 4, 1, 21, 22, 0.820445, 0.176423, 0.001801, 0.001332 },
-	{ -0.025573, -0.003491, 0.012374, 0.935395, 0.147008, -0.321597, -0.136457, 0.989105, 0.055241, 1.000000, 0.794110, 0.725630, 4, 1, 21, 22, 0.830351, 0.163252, 0.003724, 0.002674 },
-	{ -0.024975, -0.011008, 0.014788, 0.937139, -0.166684, -0.306572, 0.178997, 0.983773, 0.012283, 1.000000, 0.773110, 0.718190, 4, 1, 22, 21, 0.668514, 0.328515, 0.001627, 0.001345 },
-	{ -0.024482, -0.007158, 0.015101, 0.955841, -0.035176, -0.291773, 0.054896, 0.996707, 0.059676, 1.000000, 0.784270, 0.717700, 4, 1, 22, 21, 0.679065, 0.312679, 0.004385, 0.003870 },
-	{ -0.024467, -0.003788, 0.015662, 0.949656, 0.112607, -0.292359, -0.074059, 0.987413, 0.139756, 1.000000, 0.793880, 0.717110, 4, 1, 22, 21, 0.681205, 0.291770, 0.018574, 0.008451 },
-	{ -0.026105, -0.001064, 0.012698, 0.886025, 0.338616, -0.316701, -0.309136, 0.940542, 0.140767, 1.000000, 0.801170, 0.725420, 4, 1, 22, 21, 0.825917, 0.162721, 0.005829, 0.005533 },
-	{ -0.024968, -0.001081, 0.016018, 0.904963, 0.305009, -0.296668, -0.242526, 0.942647, 0.229343, 1.000000, 0.801830, 0.717500, 4, 1, 22, 21, 0.694491, 0.263825, 0.029291, 0.012394 },
-	{ -0.023365, -0.003984, 0.019222, 0.948003, 0.074591, -0.309396, -0.008465, 0.977713, 0.209777, 1.000000, 0.794840, 0.707820, 4, 1, 22, 21, 0.511970, 0.431061, 0.040252, 0.016716 },
-	{ -0.024008, -0.000894, 0.019104, 0.895206, 0.301324, -0.328344, -0.188677, 0.923745, 0.333312, 1.000000, 0.803490, 0.710330, 4, 1, 22, 21, 0.563732, 0.350517, 0.061815, 0.023937 },
-	{ -0.022450, -0.002263, 0.021954, 0.895793, 0.152241, -0.417585, -0.012356, 0.947677, 0.318993, 1.000000, 0.801150, 0.701720, 1, 4, 22, 21, 0.469557, 0.396454, 0.098462, 0.035527 },
-	{ -0.023133, -0.000311, 0.021778, 0.842359, 0.354659, -0.405769, -0.150063, 0.877517, 0.455462, 1.000000, 0.806410, 0.704450, 4, 1, 22, 21, 0.446515, 0.395302, 0.116028, 0.042155 },
-	{ -0.021491, -0.001297, 0.024031, 0.814511, 0.237850, -0.529149, -0.007161, 0.916147, 0.400779, 1.000000, 0.805110, 0.696860, 1, 4, 22, 21, 0.466854, 0.296417, 0.178258, 0.058470 },
-	{ -0.022154, 0.000347, 0.024113, 0.752393, 0.431621, -0.497602, -0.126008, 0.835773, 0.534421, 1.000000, 0.809680, 0.699210, 1, 4, 22, 21, 0.407038, 0.335514, 0.191744, 0.065704 },
-	{ -0.024314, -0.011895, 0.017745, 0.953665, -0.180228, -0.240916, 0.195386, 0.979895, 0.040382, 1.000000, 0.771410, 0.709530, 4, 1, 22, 21, 0.503700, 0.491719, 0.002587, 0.001995 },
-	{ -0.023722, -0.007899, 0.018051, 0.963789, -0.069063, -0.257567, 0.096432, 0.990779, 0.095177, 1.000000, 0.783130, 0.709450, 4, 1, 22, 21, 0.521635, 0.464021, 0.008083, 0.006261 },
-	{ -0.020896, 0.001014, 0.026294, 0.647998, 0.474150, -0.596055, -0.044147, 0.804658, 0.592095, 1.000000, 0.813340, 0.693940, 1, 22, 4, 21, 0.385212, 0.286959, 0.234198, 0.093631 },
-	{ -0.020251, -0.000544, 0.026020, 0.719149, 0.294533, -0.629345, 0.033998, 0.889721, 0.455238, 1.000000, 0.808970, 0.691610, 1, 22, 4, 21, 0.427750, 0.283721, 0.202740, 0.085790 },
-	{ -0.019307, 0.001728, 0.028293, 0.522578, 0.489705, -0.697927, 0.093565, 0.780711, 0.617848, 1.000000, 0.817480, 0.688810, 22, 1, 4, 21, 0.396778, 0.326371, 0.153153, 0.123699 },
-	{ -0.018678, 0.000196, 0.027913, 0.602006, 0.318027, -0.732426, 0.135325, 0.863358, 0.486107, 1.000000, 0.813290, 0.686170, 22, 1, 4, 21, 0.411153, 0.350658, 0.123299, 0.114890 },
-	{ -0.017314, 0.002508, 0.030014, 0.371248, 0.480461, -0.794564, 0.265885, 0.764878, 0.586742, 1.000000, 0.822260, 0.683830, 22, 1, 21, 4, 0.532217, 0.245187, 0.151147, 0.071449 },
-	{ -0.016720, 0.001015, 0.029574, 0.458282, 0.305266, -0.834740, 0.279094, 0.842241, 0.461235, 1.000000, 0.818380, 0.680890, 22, 1, 21, 4, 0.551727, 0.257130, 0.140342, 0.050801 },
-	{ -0.014395, 0.001831, 0.030830, 0.291119, 0.251590, -0.923013, 0.490440, 0.789132, 0.369782, 1.000000, 0.824090, 0.675850, 22, 1, 21, 4, 0.651941, 0.180292, 0.154683, 0.013084 },
-	{ -0.014911, 0.003272, 0.031257, 0.202266, 0.446057, -0.871850, 0.505525, 0.714919, 0.483048, 1.000000, 0.827370, 0.678990, 22, 1, 21, 4, 0.638302, 0.170286, 0.168502, 0.022910 },
-	{ -0.011762, 0.002352, 0.031488, 0.112543, 0.140227, -0.983703, 0.661068, 0.728543, 0.179485, 1.000000, 0.828860, 0.671240, 22, 21, 1, 23, 0.702951, 0.150961, 0.126930, 0.019158 },
-	{ -0.012126, 0.003859, 0.031882, 0.042376, 0.394329, -0.917992, 0.686534, 0.656041, 0.313498, 1.000000, 0.832060, 0.674610, 22, 21, 1, 23, 0.697836, 0.167747, 0.119532, 0.014884 },
-	{ -0.014017, 0.000426, 0.030760, 0.386458, 0.032781, -0.921724, 0.506566, 0.827594, 0.241825, 1.000000, 0.821000, 0.672810, 22, 1, 21, 4, 0.605134, 0.220457, 0.150819, 0.023591 },
-	{ -0.011622, 0.000959, 0.031481, 0.209834, -0.106106, -0.971963, 0.658807, 0.749887, 0.060366, 1.000000, 0.825660, 0.668450, 22, 21, 1, 23, 0.687041, 0.149985, 0.140048, 0.022927 },
-	{ -0.008586, 0.001052, 0.031931, 0.051491, -0.348506, -0.935891, 0.710350, 0.671488, -0.210966, 1.000000, 0.831150, 0.662320, 22, 21, 1, 23, 0.810141, 0.131350, 0.038380, 0.020129 },
-	{ -0.008354, 0.002500, 0.031618, -0.053228, -0.063554, -0.996558, 0.762747, 0.641522, -0.081652, 1.000000, 0.835080, 0.664660, 22, 21, 1, 23, 0.831862, 0.125918, 0.021660, 0.020560 },
-	{ -0.004188, 0.001928, 0.031171, -0.358815, -0.336470, -0.870655, 0.790965, 0.385663, -0.475015, 1.000000, 0.842640, 0.657050, 22, 21, 23, 1, 0.883494, 0.079385, 0.034891, 0.002230 },
-	{ -0.008672, 0.004249, 0.031961, -0.100369, 0.322229, -0.941326, 0.814415, 0.570085, 0.108311, 1.000000, 0.838000, 0.669170, 22, 21, 1, 23, 0.820665, 0.144131, 0.018931, 0.016272 },
-	{ -0.005090, 0.004433, 0.031330, -0.316296, 0.246777, -0.916001, 0.880704, 0.435257, -0.186847, 1.000000, 0.844630, 0.664200, 22, 21, 23, 1, 0.873761, 0.100950, 0.023305, 0.001983 },
-	{ -0.001715, 0.004560, 0.029640, -0.572786, 0.223426, -0.788668, 0.816250, 0.243708, -0.523777, 1.000000, 0.853320, 0.660820, 22, 21, 23, 1, 0.891408, 0.054772, 0.053820, 0.000000 },
-	{ -0.000910, 0.002056, 0.029051, -0.634248, -0.324041, -0.701945, 0.687763, 0.178238, -0.703714, 1.000000, 0.852880, 0.653110, 22, 23, 21, 1, 0.876046, 0.085053, 0.038901, 0.000000 },
-	{ -0.000785, -0.000620, 0.031653, -0.429547, -0.714262, -0.552558, 0.687041, 0.138617, -0.713274, 1.000000, 0.845240, 0.642480, 22, 21, 23, 1, 0.918417, 0.046440, 0.035144, 0.000000 },
-	{ 0.001014, -0.000382, 0.029231, -0.589423, -0.654575, -0.473405, 0.595057, 0.044522, -0.802449, 1.000000, 0.854510, 0.642750, 22, 23, 21, 1, 0.889796, 0.087338, 0.022867, 0.000000 },
-	{ -0.005119, 0.000320, 0.032453, -0.119103, -0.581272, -0.804945, 0.789244, 0.436465, -0.431962, 1.000000, 0.835880, 0.653380, 22, 21, 23, 1, 0.877834, 0.100757, 0.017021, 0.004387 },
-	{ -0.001754, -0.001328, 0.033300, -0.242629, -0.750575, -0.614628, 0.726850, 0.278960, -0.627591, 1.000000, 0.839350, 0.639680, 22, 21, 23, 1, 0.916785, 0.072872, 0.010342, 0.000000 },
-	{ 0.001736, -0.002436, 0.032652, -0.399062, -0.861388, -0.314261, 0.608381, 0.007683, -0.793608, 1.000000, 0.846370, 0.630880, 22, 21, 23, 1, 0.944454, 0.028821, 0.026725, 0.000000 },
-	{ 0.000792, -0.002757, 0.034485, -0.250012, -0.881443, -0.400690, 0.653789, 0.151562, -0.741343, 1.000000, 0.840240, 0.629180, 22, 21, 23, 1, 0.939465, 0.054362, 0.006172, 0.000000 },
-	{ 0.003190, -0.002357, 0.030000, -0.492691, -0.823277, -0.281905, 0.550901, -0.044319, -0.833393, 1.000000, 0.855820, 0.632020, 22, 23, 21, 1, 0.911754, 0.075407, 0.012839, 0.000000 },
-	{ -0.001757, 0.007171, 0.031038, -0.460612, 0.518477, -0.720429, 0.885586, 0.213783, -0.412351, 1.000000, 0.855030, 0.668990, 22, 21, 23, 1, 0.903919, 0.074919, 0.021162, 0.000000 },
-	{ -0.005497, 0.006860, 0.032611, -0.281492, 0.527657, -0.801462, 0.921586, 0.381319, -0.072635, 1.000000, 0.847610, 0.671730, 22, 21, 23, 1, 0.849760, 0.136868, 0.010017, 0.003355 },
-	{ -0.009257, 0.006186, 0.033026, -0.124399, 0.539884, -0.832497, 0.835555, 0.509502, 0.205562, 1.000000, 0.841390, 0.674850, 22, 21, 1, 23, 0.786293, 0.180791, 0.021998, 0.010918 },
-	{ -0.012769, 0.005432, 0.032740, 0.004876, 0.552957, -0.833195, 0.689016, 0.601998, 0.403553, 1.000000, 0.835420, 0.678800, 22, 21, 1, 4, 0.667431, 0.198309, 0.118816, 0.015444 },
-	{ -0.015619, 0.004710, 0.032008, 0.146672, 0.576099, -0.804113, 0.530772, 0.640136, 0.555433, 1.000000, 0.830900, 0.682680, 22, 21, 1, 4, 0.581502, 0.190614, 0.183314, 0.044570 },
-	{ -0.018067, 0.003948, 0.030719, 0.304211, 0.599923, -0.739965, 0.280011, 0.686150, 0.671411, 1.000000, 0.826130, 0.686910, 22, 1, 21, 4, 0.473226, 0.259877, 0.165719, 0.101178 },
-	{ -0.020118, 0.003192, 0.028934, 0.445243, 0.614078, -0.651665, 0.080029, 0.697580, 0.712023, 1.000000, 0.821670, 0.691530, 22, 1, 4, 21, 0.350925, 0.331264, 0.184703, 0.133108 },
-	{ -0.021754, 0.002516, 0.026840, 0.563041, 0.614465, -0.552646, -0.085812, 0.708569, 0.700404, 1.000000, 0.817870, 0.696350, 1, 22, 4, 21, 0.371082, 0.265326, 0.263480, 0.100112 },
-	{ -0.023051, 0.001928, 0.024516, 0.661952, 0.596537, -0.453832, -0.209438, 0.728564, 0.652174, 1.000000, 0.814540, 0.701440, 1, 4, 22, 21, 0.381889, 0.362693, 0.184801, 0.070616 },
-	{ -0.024061, 0.001445, 0.022033, 0.740677, 0.563960, -0.365166, -0.289297, 0.758256, 0.584256, 1.000000, 0.811790, 0.706590, 4, 1, 22, 21, 0.471223, 0.364995, 0.117616, 0.046166 },
-	{ -0.024948, 0.001111, 0.019329, 0.787171, 0.537724, -0.302019, -0.358662, 0.797513, 0.485114, 1.000000, 0.809630, 0.712060, 4, 1, 22, 21, 0.582906, 0.322334, 0.067430, 0.027331 },
-	{ -0.025872, 0.000929, 0.016307, 0.797756, 0.532914, -0.282113, -0.425202, 0.828918, 0.363453, 1.000000, 0.808120, 0.718390, 4, 1, 22, 21, 0.698895, 0.253685, 0.033004, 0.014416 },
-	{ -0.026975, 0.000783, 0.012983, 0.780139, 0.546690, -0.304159, -0.499758, 0.837054, 0.222672, 1.000000, 0.807270, 0.725650, 4, 1, 22, 21, 0.818268, 0.168322, 0.006931, 0.006480 },
-	{ -0.028250, 0.000547, 0.009635, 0.756672, 0.570459, -0.319413, -0.583759, 0.809493, 0.062829, 1.000000, 0.806970, 0.733390, 4, 1, 21, 1, 0.906034, 0.091629, 0.002337, 0.000000 },
-	{ -0.029331, 0.000335, 0.006741, 0.768203, 0.615894, -0.174753, -0.634292, 0.769221, -0.077286, 1.000000, 0.807750, 0.739890, 4, 1, 1, 1, 0.966175, 0.033825, 0.000000, 0.000000 },
-	{ -0.029533, 0.000527, 0.003795, 0.757759, 0.650951, 0.045423, -0.625937, 0.744781, -0.231310, 1.000000, 0.808570, 0.744780, 4, 1, 1, 1, 0.990662, 0.009338, 0.000000, 0.000000 },
-	{ -0.029273, 0.000821, -0.000855, 0.723236, 0.687784, 0.062310, -0.638270, 0.700159, -0.319983, 1.000000, 0.812120, 0.756500, 4, 1, 1, 1, 0.998698, 0.001302, 0.000000, 0.000000 },
-	{ -0.028215, -0.000633, -0.000628, 0.876660, 0.472740, 0.089354, -0.438715, 0.861734, -0.254841, 1.000000, 0.806460, 0.757350, 4, 1, 1, 1, 0.998650, 0.001350, 0.000000, 0.000000 },
-	{ -0.027476, -0.002680, -0.000388, 0.969496, 0.220404, 0.107235, -0.197617, 0.961695, -0.189975, 1.000000, 0.799970, 0.757920, 4, 1, 1, 1, 0.998579, 0.001421, 0.000000, 0.000000 },
-	{ -0.027209, -0.005493, -0.000227, 0.992418, -0.022515, 0.120830, 0.042287, 0.985610, -0.163661, 1.000000, 0.791710, 0.758800, 4, 1, 1, 1, 0.998809, 0.001191, 0.000000, 0.000000 },
-	{ -0.027717, -0.008943, -0.000176, 0.959482, -0.250659, 0.128700, 0.269696, 0.949244, -0.161866, 1.000000, 0.781290, 0.760160, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.029501, -0.012655, 0.003209, 0.897425, -0.440266, -0.028182, 0.424608, 0.879313, -0.215677, 1.000000, 0.766190, 0.752830, 4, 1, 1, 1, 0.995356, 0.004644, 0.000000, 0.000000 },
-	{ -0.029225, -0.012933, 0.005683, 0.888026, -0.360255, -0.285703, 0.318600, 0.930140, -0.182576, 1.000000, 0.764900, 0.746510, 4, 1, 1, 1, 0.979239, 0.020761, 0.000000, 0.000000 },
-	{ -0.031169, -0.016251, 0.005052, 0.797159, -0.449415, -0.403191, 0.407944, 0.893217, -0.189062, 1.000000, 0.753670, 0.750710, 4, 1, 8, 1, 0.973297, 0.023786, 0.002916, 0.000000 },
-	{ -0.029857, -0.017098, 0.008033, 0.813217, -0.346982, -0.467207, 0.343425, 0.934253, -0.096082, 1.000000, 0.751910, 0.741340, 4, 1, 8, 1, 0.916393, 0.081647, 0.001960, 0.000000 },
-	{ -0.031334, -0.020399, 0.007914, 0.784253, -0.344378, -0.516093, 0.363259, 0.929201, -0.068030, 1.000000, 0.740350, 0.742520, 4, 1, 8, 1, 0.880961, 0.094471, 0.024568, 0.000000 },
-	{ -0.033874, -0.019698, 0.004280, 0.682497, -0.450419, -0.575604, 0.452695, 0.878802, -0.150913, 1.000000, 0.741160, 0.755630, 4, 8, 1, 1, 0.932728, 0.041963, 0.025309, 0.000000 },
-	{ -0.033578, -0.017464, 0.001908, 0.598917, -0.735394, -0.317008, 0.665444, 0.677250, -0.313872, 1.000000, 0.748190, 0.760840, 4, 1, 8, 1, 0.993081, 0.004944, 0.001975, 0.000000 },
-	{ -0.031413, -0.015561, 0.002622, 0.782848, -0.607166, -0.136012, 0.564985, 0.785226, -0.253401, 1.000000, 0.755880, 0.756580, 4, 1, 1, 1, 0.995148, 0.004852, 0.000000, 0.000000 },
-	{ -0.035863, -0.018292, 0.001121, 0.358800, -0.811074, -0.461976, 0.718293, 0.555986, -0.418252, 1.000000, 0.742710, 0.765700, 4, 8, 1, 1, 0.992965, 0.005494, 0.001541, 0.000000 },
-	{ -0.036761, -0.019885, 0.002239, 0.463919, -0.465424, -0.753764, 0.493536, 0.842378, -0.216383, 1.000000, 0.737520, 0.764320, 4, 8, 1, 1, 0.922122, 0.072327, 0.005551, 0.000000 },
-	{ -0.033485, -0.022088, 0.006093, 0.726948, -0.305370, -0.615057, 0.353308, 0.934360, -0.046319, 1.000000, 0.734080, 0.749230, 4, 8, 1, 1, 0.849776, 0.102718, 0.047506, 0.000000 },
-	{ -0.032109, -0.022828, 0.008168, 0.795611, -0.283335, -0.535466, 0.315381, 0.948383, -0.033223, 1.000000, 0.732710, 0.742030, 4, 8, 1, 1, 0.769921, 0.125616, 0.104463, 0.000000 },
-	{ -0.029692, -0.021696, 0.011523, 0.842882, -0.310175, -0.439706, 0.312506, 0.947388, -0.069253, 1.000000, 0.737690, 0.730090, 4, 1, 8, 1, 0.729846, 0.218723, 0.051431, 0.000000 },
-	{ -0.030692, -0.024190, 0.011316, 0.852354, -0.265900, -0.450322, 0.282278, 0.958804, -0.031855, 1.000000, 0.729530, 0.731360, 4, 1, 8, 1, 0.589171, 0.213080, 0.197749, 0.000000 },
-	{ -0.028453, -0.023382, 0.015421, 0.885076, -0.275335, -0.375276, 0.279686, 0.959081, -0.044035, 1.000000, 0.734170, 0.717560, 4, 1, 8, 1, 0.505815, 0.399963, 0.094222, 0.000000 },
-	{ -0.029491, -0.026094, 0.014935, 0.889815, -0.233160, -0.392258, 0.247896, 0.968693, -0.013458, 1.000000, 0.725030, 0.719460, 1, 4, 8, 1, 0.365886, 0.338130, 0.295984, 0.000000 },
-	{ -0.027172, -0.026189, 0.020565, 0.915528, -0.210411, -0.342835, 0.216771, 0.976015, -0.020140, 1.000000, 0.727570, 0.701120, 1, 4, 8, 1, 0.641086, 0.229144, 0.129770, 0.000000 },
-	{ -0.028441, -0.028875, 0.018921, 0.907616, -0.190378, -0.374152, 0.203878, 0.978990, -0.003569, 1.000000, 0.718050, 0.706640, 1, 8, 4, 1, 0.547372, 0.294299, 0.158329, 0.000000 },
-	{ -0.026386, -0.031521, 0.025151, 0.922160, -0.151449, -0.355927, 0.163035, 0.986617, 0.002591, 1.000000, 0.713220, 0.686720, 1, 8, 4, 1, 0.810113, 0.118683, 0.071204, 0.000000 },
-	{ -0.027458, -0.032688, 0.022989, 0.917362, -0.151884, -0.367938, 0.174533, 0.984228, 0.028869, 1.000000, 0.708310, 0.693550, 1, 8, 17, 4, 0.668691, 0.193499, 0.070044, 0.067766 },
-	{ -0.025506, -0.036149, 0.029203, 0.929116, -0.146682, -0.339453, 0.169986, 0.984643, 0.039792, 1.000000, 0.701500, 0.673940, 1, 17, 8, 1, 0.832850, 0.090433, 0.076717, 0.000000 },
-	{ -0.026484, -0.036974, 0.027021, 0.928697, -0.135561, -0.345174, 0.172031, 0.982065, 0.077165, 1.000000, 0.697350, 0.680590, 1, 17, 8, 4, 0.750555, 0.124429, 0.109050, 0.015967 },
-	{ -0.024864, -0.040791, 0.033355, 0.943178, -0.151851, -0.295562, 0.181427, 0.980526, 0.075193, 1.000000, 0.689320, 0.660020, 1, 12, 17, 1, 0.813492, 0.102626, 0.083881, 0.000000 },
-	{ -0.025741, -0.041526, 0.031083, 0.942543, -0.132832, -0.306543, 0.175419, 0.977669, 0.115722, 1.000000, 0.685720, 0.667060, 1, 17, 12, 8, 0.753280, 0.129117, 0.071514, 0.046089 },
-	{ -0.024418, -0.045145, 0.037172, 0.959940, -0.123752, -0.251398, 0.149259, 0.985138, 0.084994, 1.000000, 0.678160, 0.647060, 1, 12, 17, 1, 0.644269, 0.322486, 0.033244, 0.000000 },
-	{ -0.025197, -0.045970, 0.034808, 0.956724, -0.111435, -0.268816, 0.151537, 0.979420, 0.133318, 1.000000, 0.674230, 0.654120, 1, 12, 17, 13, 0.631689, 0.296516, 0.054783, 0.017012 },
-	{ -0.023983, -0.049542, 0.040823, 0.972775, -0.086244, -0.215107, 0.123672, 0.978153, 0.167101, 1.000000, 0.667420, 0.634530, 12, 1, 13, 1, 0.588888, 0.399626, 0.011486, 0.000000 },
-	{ -0.024733, -0.050406, 0.038229, 0.965865, -0.088638, -0.243410, 0.134872, 0.974305, 0.180388, 1.000000, 0.663850, 0.642790, 12, 1, 13, 17, 0.561799, 0.403683, 0.019351, 0.015167 },
-	{ -0.023549, -0.055010, 0.044768, 0.978318, -0.096500, -0.183254, 0.136098, 0.966498, 0.217622, 1.000000, 0.651920, 0.618860, 12, 1, 13, 1, 0.816190, 0.175695, 0.008115, 0.000000 },
-	{ -0.024267, -0.055960, 0.041955, 0.968816, -0.114102, -0.219948, 0.158805, 0.967318, 0.197681, 1.000000, 0.646920, 0.625890, 12, 1, 13, 1, 0.801832, 0.182123, 0.016045, 0.000000 },
-	{ -0.023685, -0.060384, 0.047979, 0.971929, -0.172116, -0.160404, 0.199740, 0.963917, 0.175979, 1.000000, 0.637370, 0.606810, 12, 1, 13, 1, 0.943396, 0.052370, 0.004233, 0.000000 },
-	{ -0.024432, -0.061345, 0.044999, 0.959819, -0.203173, -0.193567, 0.240522, 0.950956, 0.194505, 1.000000, 0.632810, 0.614630, 12, 1, 13, 1, 0.935868, 0.053958, 0.010174, 0.000000 },
-	{ -0.024479, -0.065534, 0.050642, 0.944499, -0.304172, -0.124103, 0.323314, 0.927623, 0.187040, 1.000000, 0.621580, 0.596490, 12, 1, 13, 1, 0.987629, 0.010581, 0.001790, 0.000000 },
-	{ -0.025363, -0.066462, 0.047557, 0.932596, -0.322965, -0.161115, 0.352985, 0.909268, 0.220532, 1.000000, 0.617420, 0.604280, 12, 1, 13, 1, 0.983917, 0.009957, 0.006127, 0.000000 },
-	{ -0.025917, -0.069344, 0.052826, 0.865981, -0.499060, -0.031871, 0.495155, 0.846796, 0.194314, 1.000000, 0.608840, 0.588710, 12, 13, 1, 1, 0.995903, 0.002099, 0.001998, 0.000000 },
-	{ -0.026753, -0.070293, 0.049454, 0.867996, -0.490059, -0.080156, 0.494225, 0.836892, 0.235275, 1.000000, 0.604740, 0.596670, 12, 13, 1, 1, 0.993532, 0.005423, 0.001045, 0.000000 },
-	{ -0.027921, -0.071778, 0.054416, 0.732844, -0.675845, 0.078568, 0.652917, 0.731028, 0.198233, 1.000000, 0.598120, 0.583000, 12, 13, 1, 1, 0.997818, 0.002182, 0.000000, 0.000000 },
-	{ -0.028573, -0.072789, 0.050760, 0.752417, -0.657794, 0.034299, 0.634975, 0.738192, 0.227772, 1.000000, 0.594580, 0.591420, 12, 13, 1, 1, 0.993351, 0.006649, 0.000000, 0.000000 },
-	{ -0.029982, -0.073478, 0.055242, 0.609742, -0.778785, 0.147337, 0.753650, 0.627230, 0.196456, 1.000000, 0.589610, 0.579590, 12, 13, 1, 1, 0.997691, 0.002309, 0.000000, 0.000000 },
-	{ -0.027227, -0.070315, 0.058980, 0.729519, -0.674850, 0.111262, 0.660694, 0.737384, 0.140526, 1.000000, 0.602670, 0.572070, 12, 1, 1, 1, 0.994541, 0.005459, 0.000000, 0.000000 },
-	{ -0.029378, -0.072042, 0.059896, 0.607117, -0.777365, 0.164661, 0.767625, 0.627314, 0.131260, 1.000000, 0.593030, 0.568670, 12, 1, 1, 1, 0.995717, 0.004283, 0.000000, 0.000000 },
-	{ -0.030428, -0.074469, 0.051502, 0.631254, -0.766637, 0.117410, 0.739539, 0.640596, 0.206686, 1.000000, 0.586850, 0.588220, 12, 13, 1, 1, 0.992821, 0.007179, 0.000000, 0.000000 },
-	{ -0.028383, -0.070149, 0.065060, 0.615177, -0.771646, 0.161617, 0.769417, 0.632324, 0.090354, 1.000000, 0.597670, 0.554870, 12, 1, 1, 1, 0.975070, 0.024930, 0.000000, 0.000000 },
-	{ -0.026162, -0.068259, 0.064230, 0.746308, -0.656116, 0.111966, 0.647311, 0.754621, 0.107405, 1.000000, 0.608440, 0.558110, 12, 1, 1, 1, 0.969492, 0.030508, 0.000000, 0.000000 },
-	{ -0.027633, -0.068406, 0.070801, 0.616323, -0.766515, 0.180555, 0.763673, 0.637724, 0.100554, 1.000000, 0.603190, 0.538770, 12, 1, 1, 1, 0.910651, 0.089349, 0.000000, 0.000000 },
-	{ -0.025355, -0.066359, 0.070251, 0.759913, -0.637217, 0.128403, 0.629252, 0.770672, 0.100531, 1.000000, 0.615550, 0.541350, 12, 1, 1, 1, 0.898790, 0.101210, 0.000000, 0.000000 },
-	{ -0.024811, -0.064263, 0.076397, 0.771407, -0.614629, 0.164810, 0.591046, 0.788016, 0.172324, 1.000000, 0.622460, 0.524310, 12, 1, 1, 1, 0.771073, 0.228927, 0.000000, 0.000000 },
-	{ -0.027213, -0.066510, 0.076710, 0.617224, -0.755551, 0.219495, 0.754786, 0.647365, 0.105903, 1.000000, 0.608950, 0.521910, 12, 1, 1, 1, 0.790548, 0.209452, 0.000000, 0.000000 },
-	{ -0.029223, -0.073684, 0.047868, 0.778124, -0.626904, 0.038915, 0.600713, 0.760852, 0.245454, 1.000000, 0.591530, 0.597900, 12, 13, 1, 1, 0.982269, 0.017731, 0.000000, 0.000000 },
-	{ -0.030968, -0.075361, 0.048530, 0.649753, -0.749813, 0.124904, 0.717133, 0.659144, 0.226384, 1.000000, 0.584330, 0.594820, 12, 13, 1, 1, 0.980964, 0.019036, 0.000000, 0.000000 },
-	{ -0.029772, -0.074676, 0.045368, 0.800058, -0.591475, 0.100317, 0.556377, 0.794084, 0.244694, 1.000000, 0.588620, 0.603570, 12, 13, 1, 1, 0.959976, 0.040024, 0.000000, 0.000000 },
-	{ -0.031514, -0.076365, 0.046002, 0.652248, -0.734003, 0.189240, 0.696309, 0.678845, 0.233076, 1.000000, 0.581720, 0.600360, 12, 13, 1, 1, 0.952362, 0.047638, 0.000000, 0.000000 },
-	{ -0.028009, -0.071927, 0.044314, 0.906518, -0.422060, 0.009567, 0.404721, 0.875278, 0.264744, 1.000000, 0.598320, 0.608740, 12, 13, 1, 1, 0.957804, 0.042196, 0.000000, 0.000000 },
-	{ -0.027488, -0.071085, 0.046788, 0.885228, -0.460742, -0.063940, 0.460351, 0.848058, 0.262438, 1.000000, 0.601360, 0.602920, 12, 13, 1, 1, 0.986378, 0.013622, 0.000000, 0.000000 },
-	{ -0.026542, -0.067855, 0.042483, 0.958841, -0.279847, -0.048057, 0.282376, 0.922035, 0.264795, 1.000000, 0.611020, 0.617070, 12, 13, 1, 1, 0.939324, 0.051057, 0.009619, 0.000000 },
-	{ -0.026098, -0.067136, 0.045042, 0.941524, -0.312156, -0.126849, 0.334834, 0.908865, 0.248699, 1.000000, 0.614100, 0.610760, 12, 13, 1, 1, 0.973040, 0.017424, 0.009536, 0.000000 },
-	{ -0.025520, -0.062845, 0.039843, 0.982674, -0.157562, -0.097607, 0.178015, 0.948968, 0.260329, 1.000000, 0.625350, 0.628040, 12, 13, 1, 17, 0.875316, 0.068689, 0.054436, 0.001558 },
-	{ -0.025089, -0.062018, 0.042464, 0.969154, -0.190266, -0.156651, 0.222528, 0.948757, 0.224371, 1.000000, 0.629210, 0.621570, 12, 1, 13, 1, 0.922335, 0.053727, 0.023937, 0.000000 },
-	{ -0.025363, -0.057570, 0.036870, 0.986707, -0.060496, -0.150830, 0.098695, 0.960435, 0.260429, 1.000000, 0.640030, 0.640190, 12, 1, 13, 17, 0.721723, 0.179277, 0.087232, 0.011769 },
-	{ -0.024921, -0.056597, 0.039443, 0.978950, -0.087862, -0.184221, 0.131456, 0.961881, 0.239801, 1.000000, 0.644580, 0.634380, 12, 1, 13, 17, 0.778291, 0.181556, 0.033867, 0.006286 },
-	{ -0.025308, -0.051329, 0.036160, 0.977535, -0.049917, -0.204780, 0.105658, 0.956718, 0.271160, 1.000000, 0.659330, 0.647560, 12, 1, 13, 17, 0.536882, 0.397781, 0.038216, 0.027121 },
-	{ -0.025734, -0.052370, 0.033715, 0.980484, -0.023716, -0.195163, 0.067530, 0.972924, 0.221038, 1.000000, 0.654660, 0.653040, 12, 1, 13, 17, 0.476351, 0.378973, 0.087042, 0.057634 },
-	{ -0.025786, -0.046727, 0.032853, 0.970128, -0.058167, -0.235519, 0.106411, 0.974481, 0.197647, 1.000000, 0.671030, 0.659160, 1, 12, 17, 13, 0.605918, 0.262724, 0.100576, 0.030782 },
-	{ -0.026376, -0.047443, 0.030273, 0.970039, -0.027731, -0.241361, 0.066721, 0.985674, 0.154904, 1.000000, 0.667830, 0.666300, 1, 12, 17, 13, 0.553892, 0.200427, 0.189717, 0.055964 },
-	{ -0.026440, -0.042133, 0.029115, 0.956320, -0.080519, -0.281012, 0.128325, 0.979372, 0.156085, 1.000000, 0.683050, 0.672410, 1, 17, 8, 12, 0.695442, 0.194952, 0.061360, 0.048246 },
-	{ -0.027213, -0.042727, 0.026527, 0.956643, -0.049786, -0.286978, 0.086508, 0.989389, 0.116731, 1.000000, 0.679900, 0.679850, 1, 17, 8, 12, 0.607077, 0.277879, 0.086237, 0.028807 },
-	{ -0.027274, -0.037703, 0.025124, 0.942386, -0.093683, -0.321141, 0.133687, 0.985465, 0.104823, 1.000000, 0.694270, 0.685880, 1, 17, 8, 4, 0.661643, 0.165746, 0.160611, 0.012000 },
-	{ -0.028119, -0.038377, 0.022738, 0.944574, -0.070790, -0.320575, 0.103674, 0.990827, 0.086678, 1.000000, 0.691000, 0.693050, 1, 8, 17, 4, 0.550420, 0.235010, 0.207693, 0.006877 },
-	{ -0.028288, -0.033743, 0.021234, 0.932685, -0.105865, -0.344806, 0.133921, 0.989263, 0.058522, 1.000000, 0.704230, 0.698870, 1, 8, 17, 4, 0.563718, 0.306774, 0.085381, 0.044126 },
-	{ -0.029067, -0.034558, 0.019200, 0.938200, -0.082324, -0.336160, 0.111097, 0.991532, 0.067241, 1.000000, 0.700840, 0.705010, 1, 8, 17, 4, 0.450634, 0.426077, 0.097075, 0.026214 },
-	{ -0.029251, -0.030415, 0.017587, 0.923677, -0.133873, -0.359024, 0.156366, 0.987106, 0.034219, 1.000000, 0.712710, 0.710790, 1, 8, 4, 17, 0.438900, 0.419216, 0.119467, 0.022417 },
-	{ -0.029898, -0.031415, 0.016091, 0.934681, -0.092837, -0.343150, 0.117037, 0.991845, 0.050453, 1.000000, 0.709110, 0.715320, 8, 1, 4, 17, 0.564802, 0.346911, 0.064592, 0.023696 },
-	{ -0.030221, -0.027889, 0.014196, 0.906632, -0.163017, -0.389159, 0.187297, 0.981985, 0.024999, 1.000000, 0.719060, 0.721810, 8, 1, 4, 17, 0.502212, 0.307407, 0.186827, 0.003555 },
-	{ -0.030710, -0.029164, 0.013360, 0.921247, -0.097533, -0.376551, 0.125863, 0.990720, 0.051316, 1.000000, 0.714890, 0.724270, 8, 1, 4, 17, 0.653553, 0.254605, 0.088194, 0.003648 },
-	{ -0.031361, -0.026049, 0.010992, 0.871937, -0.185957, -0.452930, 0.216670, 0.976108, 0.016355, 1.000000, 0.723500, 0.732470, 8, 4, 1, 1, 0.434432, 0.372499, 0.193069, 0.000000 },
-	{ -0.031806, -0.027668, 0.010579, 0.878454, -0.109898, -0.465018, 0.150428, 0.987313, 0.050838, 1.000000, 0.718400, 0.733610, 8, 4, 1, 1, 0.656027, 0.173576, 0.170397, 0.000000 },
-	{ -0.032714, -0.024667, 0.008121, 0.816672, -0.197814, -0.542140, 0.245464, 0.969272, 0.016098, 1.000000, 0.726730, 0.742230, 4, 8, 1, 1, 0.549659, 0.348779, 0.101562, 0.000000 },
-	{ -0.033283, -0.026430, 0.007767, 0.823193, -0.112121, -0.556581, 0.169837, 0.984048, 0.052960, 1.000000, 0.721110, 0.743250, 8, 4, 1, 1, 0.596179, 0.305298, 0.098523, 0.000000 },
-	{ -0.034266, -0.023636, 0.005828, 0.746786, -0.203311, -0.633226, 0.260316, 0.965519, -0.003000, 1.000000, 0.728780, 0.750510, 4, 8, 1, 1, 0.697884, 0.254864, 0.047252, 0.000000 },
-	{ -0.034709, -0.025371, 0.005696, 0.780483, -0.099211, -0.617254, 0.158457, 0.986481, 0.041803, 1.000000, 0.723610, 0.750740, 8, 4, 1, 1, 0.534977, 0.413887, 0.051137, 0.000000 },
-	{ -0.031070, -0.030141, 0.012625, 0.910795, -0.101740, -0.400127, 0.127980, 0.990996, 0.039337, 1.000000, 0.711690, 0.726400, 8, 1, 4, 17, 0.727582, 0.218069, 0.050363, 0.003985 },
-	{ -0.030701, -0.032095, 0.014089, 0.912306, -0.127357, -0.389201, 0.152240, 0.987771, 0.033634, 1.000000, 0.706180, 0.721570, 8, 1, 4, 17, 0.678981, 0.261283, 0.035111, 0.024626 },
-	{ -0.032069, -0.029627, 0.010426, 0.867330, -0.114010, -0.484500, 0.148170, 0.988423, 0.032657, 1.000000, 0.712200, 0.733700, 8, 1, 4, 17, 0.773261, 0.159844, 0.064860, 0.002036 },
-	{ -0.032071, -0.032382, 0.011198, 0.861085, -0.175902, -0.477065, 0.202761, 0.979216, 0.004924, 1.000000, 0.703900, 0.730940, 8, 1, 4, 17, 0.781021, 0.175779, 0.023712, 0.019488 },
-	{ -0.033916, -0.028817, 0.007229, 0.818483, -0.096390, -0.566387, 0.134940, 0.990501, 0.026433, 1.000000, 0.712960, 0.744570, 8, 4, 1, 1, 0.782353, 0.125958, 0.091689, 0.000000 },
-	{ -0.034247, -0.032393, 0.007518, 0.814212, -0.180766, -0.551709, 0.201661, 0.979180, -0.023215, 1.000000, 0.701870, 0.743570, 8, 1, 4, 17, 0.869510, 0.097136, 0.021753, 0.011600 },
-	{ -0.036705, -0.026709, 0.003344, 0.820705, -0.015166, -0.571150, 0.057823, 0.996720, 0.056620, 1.000000, 0.717930, 0.759650, 8, 4, 1, 1, 0.750891, 0.217454, 0.031654, 0.000000 },
-	{ -0.036807, -0.032225, 0.003786, 0.836949, -0.166949, -0.521196, 0.179645, 0.983374, -0.026515, 1.000000, 0.700340, 0.757670, 8, 1, 4, 17, 0.926051, 0.039170, 0.029713, 0.005065 },
-	{ -0.034608, -0.036524, 0.008760, 0.763758, -0.320090, -0.560549, 0.345912, 0.936133, -0.063247, 1.000000, 0.689450, 0.739580, 8, 1, 17, 4, 0.803981, 0.108174, 0.082651, 0.005194 },
-	{ -0.037875, -0.036941, 0.004560, 0.742453, -0.398726, -0.538313, 0.397524, 0.909032, -0.125041, 1.000000, 0.685880, 0.756310, 8, 17, 1, 4, 0.879344, 0.078390, 0.040407, 0.001858 },
-	{ -0.034943, -0.041096, 0.010821, 0.719356, -0.331106, -0.610653, 0.363140, 0.928651, -0.075747, 1.000000, 0.674840, 0.732230, 8, 17, 1, 1, 0.540606, 0.331294, 0.128100, 0.000000 },
-	{ -0.040856, -0.042121, 0.005752, 0.603284, -0.480486, -0.636539, 0.482052, 0.855532, -0.188923, 1.000000, 0.665420, 0.755770, 8, 17, 1, 1, 0.641037, 0.322065, 0.036898, 0.000000 },
-	{ -0.040499, -0.047015, 0.008650, 0.618893, -0.240740, -0.747673, 0.345294, 0.938353, -0.016317, 1.000000, 0.651440, 0.745610, 17, 8, 1, 1, 0.753225, 0.195221, 0.051554, 0.000000 },
-	{ -0.046048, -0.044040, 0.004295, 0.364226, -0.671759, -0.645042, 0.589393, 0.702533, -0.398827, 1.000000, 0.653170, 0.767190, 8, 17, 1, 1, 0.598410, 0.394188, 0.007402, 0.000000 },
-	{ -0.045943, -0.045916, 0.005637, 0.388061, -0.325129, -0.862381, 0.419165, 0.895595, -0.149032, 1.000000, 0.648720, 0.763750, 17, 8, 1, 1, 0.777303, 0.212197, 0.010500, 0.000000 },
-	{ -0.034328, -0.045545, 0.013554, 0.734788, -0.210202, -0.644905, 0.287391, 0.957692, 0.015293, 1.000000, 0.662780, 0.722730, 17, 8, 1, 1, 0.655986, 0.179591, 0.164422, 0.000000 },
-	{ -0.032689, -0.050586, 0.016861, 0.787036, -0.155619, -0.596957, 0.257053, 0.962380, 0.088022, 1.000000, 0.649490, 0.708140, 17, 1, 8, 13, 0.755877, 0.188598, 0.030132, 0.025393 },
-	{ -0.036842, -0.052288, 0.012503, 0.719672, -0.140937, -0.679859, 0.294603, 0.948651, 0.115197, 1.000000, 0.638180, 0.724950, 17, 1, 8, 13, 0.883689, 0.080825, 0.030137, 0.005349 },
-	{ -0.031691, -0.056022, 0.020046, 0.801169, -0.235077, -0.550334, 0.334228, 0.938593, 0.085641, 1.000000, 0.633830, 0.695810, 17, 13, 1, 12, 0.576635, 0.188229, 0.162789, 0.072347 },
-	{ -0.035583, -0.057667, 0.015466, 0.759552, -0.280467, -0.586873, 0.405733, 0.909504, 0.090461, 1.000000, 0.623800, 0.711510, 17, 13, 1, 12, 0.815233, 0.095070, 0.078348, 0.011349 },
-	{ -0.031256, -0.061390, 0.023208, 0.777321, -0.269503, -0.568455, 0.395607, 0.911977, 0.108597, 1.000000, 0.618000, 0.681950, 13, 17, 12, 1, 0.478917, 0.232306, 0.192859, 0.095918 },
-	{ -0.036811, -0.063354, 0.018216, 0.692686, -0.393051, -0.604729, 0.510014, 0.859792, 0.025362, 1.000000, 0.605500, 0.701340, 13, 17, 1, 12, 0.466027, 0.448055, 0.043514, 0.042404 },
-	{ -0.030366, -0.066059, 0.026138, 0.799837, -0.210433, -0.562120, 0.376869, 0.904974, 0.197462, 1.000000, 0.606130, 0.668020, 13, 12, 1, 17, 0.640123, 0.286756, 0.037301, 0.035820 },
-	{ -0.035676, -0.067567, 0.021486, 0.696567, -0.212952, -0.685162, 0.413580, 0.899500, 0.140895, 1.000000, 0.594740, 0.687820, 13, 17, 12, 1, 0.815140, 0.091898, 0.076371, 0.016592 },
-	{ -0.040652, -0.066011, 0.016965, 0.568109, -0.587833, -0.575938, 0.632540, 0.759598, -0.151344, 1.000000, 0.592220, 0.706620, 13, 17, 1, 12, 0.597398, 0.382790, 0.013432, 0.006380 },
-	{ -0.040304, -0.067535, 0.018311, 0.529300, -0.323936, -0.784160, 0.473438, 0.879735, -0.043852, 1.000000, 0.588690, 0.702920, 13, 17, 12, 1, 0.871674, 0.111443, 0.010106, 0.006777 },
-	{ -0.029558, -0.070434, 0.029281, 0.879121, -0.236017, -0.414057, 0.375139, 0.878535, 0.295716, 1.000000, 0.595200, 0.653910, 13, 12, 1, 1, 0.652061, 0.338935, 0.009004, 0.000000 },
-	{ -0.032042, -0.071164, 0.025311, 0.828017, -0.109926, -0.549823, 0.342256, 0.875807, 0.340329, 1.000000, 0.588870, 0.665690, 13, 12, 17, 1, 0.873605, 0.114689, 0.007084, 0.004622 },
-	{ -0.029931, -0.074628, 0.032526, 0.906790, -0.359427, -0.220326, 0.416523, 0.844546, 0.336528, 1.000000, 0.585180, 0.639210, 13, 12, 1, 1, 0.605355, 0.393501, 0.001144, 0.000000 },
-	{ -0.031230, -0.074923, 0.028423, 0.926517, -0.243311, -0.286995, 0.353644, 0.823573, 0.443468, 1.000000, 0.581100, 0.650740, 13, 12, 1, 1, 0.850565, 0.149435, 0.000000, 0.000000 },
-	{ -0.031169, -0.077897, 0.034928, 0.858473, -0.507525, -0.073775, 0.499997, 0.796224, 0.340634, 1.000000, 0.577110, 0.629100, 13, 12, 1, 1, 0.554713, 0.445287, 0.000000, 0.000000 },
-	{ -0.031848, -0.078267, 0.030817, 0.903941, -0.413574, -0.108843, 0.414328, 0.783885, 0.462447, 1.000000, 0.573730, 0.639250, 13, 12, 1, 1, 0.803445, 0.196555, 0.000000, 0.000000 },
-	{ -0.033103, -0.080504, 0.032159, 0.780434, -0.624970, 0.018310, 0.542555, 0.691491, 0.476943, 1.000000, 0.568070, 0.632710, 13, 12, 1, 1, 0.769312, 0.230688, 0.000000, 0.000000 },
-	{ -0.032717, -0.079876, 0.036191, 0.719366, -0.692174, 0.058378, 0.635540, 0.689762, 0.346866, 1.000000, 0.571200, 0.623620, 13, 12, 1, 1, 0.523774, 0.476226, 0.000000, 0.000000 },
-	{ -0.032301, -0.078886, 0.040099, 0.672042, -0.725032, 0.150625, 0.674191, 0.683200, 0.280543, 1.000000, 0.574730, 0.614430, 12, 13, 1, 1, 0.739884, 0.260115, 0.000000, 0.000000 },
-	{ -0.030541, -0.077070, 0.039174, 0.834090, -0.551057, 0.025103, 0.524626, 0.806502, 0.272621, 1.000000, 0.581270, 0.618750, 12, 13, 1, 1, 0.710251, 0.289749, 0.000000, 0.000000 },
-	{ -0.028865, -0.073955, 0.037262, 0.912297, -0.398062, -0.096238, 0.408623, 0.869145, 0.278594, 1.000000, 0.590230, 0.626580, 12, 13, 1, 1, 0.678529, 0.320283, 0.001188, 0.000000 },
-	{ -0.027656, -0.069678, 0.034383, 0.935516, -0.276324, -0.220124, 0.330461, 0.904769, 0.268680, 1.000000, 0.601460, 0.638680, 12, 13, 1, 1, 0.621539, 0.367541, 0.010920, 0.000000 },
-	{ -0.027351, -0.064895, 0.031264, 0.920557, -0.183035, -0.345069, 0.274551, 0.931578, 0.238294, 1.000000, 0.613640, 0.652570, 12, 13, 1, 17, 0.544411, 0.395907, 0.050721, 0.008960 },
-	{ -0.031943, -0.077582, 0.043368, 0.650500, -0.728298, 0.215480, 0.692524, 0.685256, 0.225467, 1.000000, 0.578540, 0.606620, 12, 13, 1, 1, 0.893901, 0.106099, 0.000000, 0.000000 },
-	{ -0.030149, -0.075865, 0.042659, 0.816189, -0.567708, 0.107441, 0.532222, 0.811090, 0.242637, 1.000000, 0.585240, 0.610150, 12, 13, 1, 1, 0.889261, 0.110739, 0.000000, 0.000000 },
-	{ -0.028333, -0.072950, 0.041316, 0.914164, -0.405311, 0.005284, 0.390418, 0.883929, 0.257377, 1.000000, 0.594680, 0.616180, 12, 13, 1, 1, 0.871816, 0.128184, 0.000000, 0.000000 },
-	{ -0.026840, -0.068763, 0.039028, 0.958654, -0.273834, -0.077441, 0.284572, 0.923293, 0.257973, 1.000000, 0.606850, 0.625950, 12, 13, 1, 1, 0.836321, 0.153105, 0.010574, 0.000000 },
-	{ -0.026006, -0.063873, 0.036088, 0.973318, -0.160032, -0.164445, 0.196275, 0.951878, 0.235383, 1.000000, 0.620130, 0.638200, 12, 13, 1, 17, 0.754861, 0.186767, 0.055318, 0.003054 },
-	{ -0.027793, -0.059883, 0.028312, 0.897146, -0.149362, -0.415717, 0.250126, 0.947462, 0.199379, 1.000000, 0.626960, 0.665810, 12, 13, 1, 17, 0.407346, 0.364241, 0.141666, 0.086747 },
-	{ -0.028533, -0.054572, 0.025220, 0.888883, -0.137875, -0.436895, 0.223789, 0.962795, 0.151472, 1.000000, 0.642200, 0.678990, 17, 1, 13, 12, 0.321603, 0.258565, 0.216654, 0.203178 },
-	{ -0.029462, -0.049257, 0.021850, 0.878116, -0.119237, -0.463351, 0.193785, 0.974093, 0.116580, 1.000000, 0.657150, 0.692240, 17, 1, 13, 12, 0.568125, 0.329307, 0.055586, 0.046982 },
-	{ -0.030611, -0.044347, 0.018522, 0.856979, -0.143142, -0.495074, 0.209174, 0.974576, 0.080302, 1.000000, 0.670150, 0.704820, 17, 1, 8, 13, 0.535087, 0.316112, 0.144953, 0.003848 },
-	{ -0.031437, -0.040013, 0.015568, 0.845538, -0.203021, -0.493809, 0.248092, 0.968369, 0.026673, 1.000000, 0.681730, 0.715560, 8, 17, 1, 4, 0.395741, 0.341732, 0.260291, 0.002236 },
-	{ -0.031878, -0.035938, 0.013002, 0.851374, -0.216533, -0.477781, 0.254022, 0.967092, 0.014358, 1.000000, 0.693390, 0.724670, 8, 1, 17, 4, 0.659327, 0.208974, 0.123069, 0.008629 },
-	{ -0.026043, -0.058722, 0.033009, 0.966218, -0.082967, -0.244006, 0.134452, 0.969990, 0.202591, 1.000000, 0.633970, 0.651650, 12, 13, 1, 17, 0.598918, 0.202857, 0.169433, 0.028792 },
-	{ -0.026604, -0.053440, 0.029839, 0.953329, -0.059951, -0.295921, 0.112484, 0.980056, 0.163824, 1.000000, 0.648750, 0.665090, 12, 1, 13, 17, 0.358294, 0.335736, 0.165641, 0.140329 },
-	{ -0.027444, -0.048252, 0.026375, 0.940149, -0.062168, -0.335045, 0.110283, 0.985812, 0.126537, 1.000000, 0.663050, 0.678530, 1, 17, 12, 13, 0.461620, 0.349642, 0.117093, 0.071645 },
-	{ -0.028441, -0.043431, 0.022848, 0.925488, -0.081726, -0.369855, 0.125962, 0.987278, 0.097036, 1.000000, 0.675720, 0.691330, 1, 17, 8, 12, 0.477255, 0.391858, 0.118534, 0.012353 },
-	{ -0.029348, -0.039133, 0.019519, 0.914107, -0.114428, -0.388992, 0.153912, 0.985473, 0.071792, 1.000000, 0.686820, 0.702930, 1, 8, 17, 4, 0.411237, 0.313831, 0.271050, 0.003881 },
-	{ -0.030124, -0.035289, 0.016503, 0.911141, -0.131251, -0.390635, 0.163838, 0.985161, 0.051138, 1.000000, 0.697190, 0.713350, 8, 1, 17, 4, 0.538938, 0.330082, 0.116492, 0.014488 },
-	{ -0.033581, -0.078463, 0.043948, 0.450356, -0.845853, 0.285854, 0.825904, 0.516295, 0.226544, 1.000000, 0.574010, 0.604200, 12, 13, 1, 1, 0.855540, 0.144460, 0.000000, 0.000000 },
-	{ -0.033909, -0.079807, 0.040559, 0.453414, -0.856835, 0.245458, 0.803590, 0.512118, 0.303278, 1.000000, 0.570240, 0.611810, 12, 13, 1, 1, 0.737050, 0.262950, 0.000000, 0.000000 },
-	{ -0.034205, -0.080918, 0.036672, 0.497649, -0.851580, 0.164797, 0.770691, 0.521295, 0.366452, 1.000000, 0.566870, 0.620780, 12, 13, 1, 1, 0.546531, 0.453469, 0.000000, 0.000000 },
-	{ -0.034448, -0.081712, 0.032598, 0.559939, -0.821027, 0.111279, 0.685397, 0.534469, 0.494544, 1.000000, 0.563710, 0.629500, 13, 12, 1, 1, 0.711512, 0.288488, 0.000000, 0.000000 },
-	{ -0.033041, -0.077312, 0.046463, 0.499620, -0.831056, 0.244387, 0.799822, 0.550914, 0.238281, 1.000000, 0.577230, 0.598160, 12, 13, 1, 1, 0.949161, 0.050840, 0.000000, 0.000000 },
-	{ -0.032547, -0.076414, 0.048889, 0.520740, -0.834566, 0.179805, 0.802066, 0.550407, 0.231824, 1.000000, 0.579310, 0.592980, 12, 13, 1, 1, 0.981489, 0.018511, 0.000000, 0.000000 },
-	{ -0.032088, -0.075591, 0.051695, 0.502187, -0.847062, 0.174054, 0.822976, 0.529950, 0.204606, 1.000000, 0.581090, 0.586830, 12, 13, 1, 1, 0.993291, 0.006709, 0.000000, 0.000000 },
-	{ -0.031966, -0.074774, 0.055181, 0.466672, -0.863725, 0.190257, 0.836422, 0.500918, 0.222438, 1.000000, 0.582890, 0.578490, 12, 13, 1, 1, 0.997734, 0.002266, 0.000000, 0.000000 },
-	{ -0.031558, -0.073453, 0.060046, 0.474279, -0.856917, 0.201873, 0.846030, 0.507056, 0.164707, 1.000000, 0.585470, 0.567350, 12, 1, 1, 1, 0.996673, 0.003327, 0.000000, 0.000000 },
-	{ -0.030765, -0.071726, 0.065251, 0.482970, -0.850825, 0.206968, 0.855658, 0.508781, 0.094828, 1.000000, 0.589090, 0.553760, 12, 1, 1, 1, 0.978746, 0.021254, 0.000000, 0.000000 },
-	{ -0.030085, -0.070001, 0.070798, 0.474817, -0.851618, 0.222027, 0.855875, 0.505585, 0.108911, 1.000000, 0.593420, 0.537940, 12, 1, 1, 1, 0.919947, 0.080053, 0.000000, 0.000000 },
-	{ -0.029713, -0.068196, 0.076540, 0.464179, -0.847956, 0.255947, 0.859206, 0.501265, 0.102461, 1.000000, 0.597930, 0.521700, 12, 1, 1, 1, 0.804690, 0.195310, 0.000000, 0.000000 },
-	{ -0.026851, -0.064383, 0.082568, 0.630854, -0.729878, 0.263252, 0.734174, 0.671286, 0.101806, 1.000000, 0.615210, 0.505460, 12, 1, 1, 1, 0.642531, 0.357469, 0.000000, 0.000000 },
-	{ -0.024177, -0.061757, 0.082259, 0.796151, -0.565916, 0.214203, 0.543631, 0.824414, 0.157498, 1.000000, 0.629090, 0.508250, 12, 1, 1, 1, 0.611421, 0.388579, 0.000000, 0.000000 },
-	{ -0.023809, -0.058652, 0.088069, 0.828603, -0.465530, 0.310964, 0.461763, 0.882371, 0.090532, 1.000000, 0.635130, 0.493450, 1, 12, 1, 1, 0.549893, 0.450107, 0.000000, 0.000000 },
-	{ -0.026672, -0.061954, 0.088378, 0.665050, -0.663518, 0.342713, 0.666763, 0.734251, 0.127681, 1.000000, 0.620720, 0.490890, 1, 12, 1, 1, 0.505536, 0.494464, 0.000000, 0.000000 },
-	{ -0.024109, -0.054278, 0.093845, 0.830941, -0.345417, 0.436148, 0.400627, 0.915442, -0.038264, 1.000000, 0.639340, 0.477840, 1, 12, 1, 1, 0.716470, 0.283531, 0.000000, 0.000000 },
-	{ -0.026874, -0.058805, 0.093945, 0.684957, -0.549874, 0.477988, 0.593067, 0.801873, 0.072603, 1.000000, 0.625080, 0.477140, 1, 12, 1, 1, 0.653471, 0.346529, 0.000000, 0.000000 },
-	{ -0.026012, -0.049576, 0.099398, 0.814557, -0.283905, 0.505860, 0.379970, 0.920058, -0.095477, 1.000000, 0.640070, 0.459840, 1, 12, 1, 1, 0.847871, 0.152129, 0.000000, 0.000000 },
-	{ -0.027840, -0.054448, 0.098915, 0.691106, -0.444295, 0.570066, 0.532057, 0.846580, 0.014776, 1.000000, 0.627480, 0.461970, 1, 12, 1, 1, 0.793182, 0.206818, 0.000000, 0.000000 },
-	{ -0.022496, -0.061131, 0.075181, 0.900764, -0.428378, 0.071531, 0.418386, 0.900077, 0.121716, 1.000000, 0.636530, 0.530350, 12, 1, 1, 1, 0.759686, 0.240314, 0.000000, 0.000000 },
-	{ -0.023309, -0.063627, 0.068809, 0.897102, -0.439041, 0.049506, 0.432751, 0.895739, 0.101877, 1.000000, 0.628890, 0.546300, 12, 1, 1, 1, 0.889660, 0.110340, 0.000000, 0.000000 },
-	{ -0.024152, -0.065836, 0.062537, 0.884763, -0.464467, 0.038279, 0.459100, 0.882763, 0.099780, 1.000000, 0.620750, 0.563910, 12, 1, 1, 1, 0.963930, 0.036070, 0.000000, 0.000000 },
-	{ -0.025108, -0.067984, 0.057220, 0.869522, -0.493567, 0.017991, 0.486669, 0.862440, 0.139108, 1.000000, 0.613820, 0.577980, 12, 1, 1, 1, 0.991325, 0.008675, 0.000000, 0.000000 },
-	{ -0.023493, -0.064024, 0.054799, 0.956587, -0.280391, -0.079511, 0.288904, 0.948227, 0.131911, 1.000000, 0.628220, 0.585950, 12, 1, 1, 1, 0.985149, 0.014851, 0.000000, 0.000000 },
-	{ -0.022897, -0.058994, 0.052108, 0.982018, -0.139193, -0.127536, 0.153054, 0.982494, 0.106207, 1.000000, 0.643210, 0.595460, 12, 1, 13, 1, 0.948864, 0.049825, 0.001311, 0.000000 },
-	{ -0.022873, -0.053887, 0.048699, 0.986835, -0.075627, -0.142960, 0.097648, 0.983250, 0.153900, 1.000000, 0.656240, 0.607420, 12, 1, 13, 1, 0.835868, 0.161002, 0.003130, 0.000000 },
-	{ -0.023249, -0.048445, 0.044104, 0.984028, -0.070789, -0.163336, 0.096657, 0.982968, 0.156306, 1.000000, 0.672320, 0.625810, 12, 1, 13, 1, 0.620749, 0.374004, 0.005247, 0.000000 },
-	{ -0.023602, -0.044183, 0.040092, 0.973960, -0.111058, -0.197656, 0.131998, 0.986582, 0.096091, 1.000000, 0.682470, 0.638480, 1, 12, 17, 1, 0.625625, 0.357926, 0.016449, 0.000000 },
-	{ -0.023932, -0.040027, 0.036097, 0.958278, -0.145034, -0.246308, 0.170669, 0.981566, 0.086021, 1.000000, 0.693170, 0.651860, 1, 12, 17, 1, 0.816047, 0.134608, 0.049345, 0.000000 },
-	{ -0.022539, -0.061886, 0.060077, 0.963309, -0.264360, -0.046372, 0.267545, 0.959563, 0.087517, 1.000000, 0.636510, 0.571870, 12, 1, 1, 1, 0.962513, 0.037487, 0.000000, 0.000000 },
-	{ -0.022022, -0.056986, 0.057247, 0.986183, -0.124311, -0.109499, 0.131936, 0.989101, 0.065367, 1.000000, 0.650780, 0.581120, 12, 1, 1, 1, 0.942348, 0.057652, 0.000000, 0.000000 },
-	{ -0.022117, -0.052236, 0.053741, 0.989236, -0.064021, -0.131583, 0.081672, 0.987683, 0.133460, 1.000000, 0.662800, 0.590990, 12, 1, 1, 1, 0.852267, 0.147733, 0.000000, 0.000000 },
-	{ -0.022547, -0.047101, 0.048426, 0.989592, -0.056769, -0.132229, 0.074529, 0.988244, 0.133491, 1.000000, 0.678030, 0.612930, 12, 1, 13, 1, 0.657081, 0.340976, 0.001943, 0.000000 },
-	{ -0.022853, -0.043093, 0.043767, 0.986135, -0.087292, -0.141128, 0.098259, 0.992502, 0.072696, 1.000000, 0.687280, 0.627690, 1, 12, 17, 1, 0.592609, 0.402308, 0.005083, 0.000000 },
-	{ -0.023084, -0.039250, 0.039463, 0.977097, -0.121180, -0.174917, 0.136759, 0.987377, 0.079903, 1.000000, 0.697040, 0.641930, 1, 12, 17, 1, 0.801635, 0.177565, 0.020800, 0.000000 },
-	{ -0.021722, -0.059289, 0.065924, 0.964688, -0.261635, -0.030422, 0.263264, 0.961421, 0.079762, 1.000000, 0.644530, 0.556010, 12, 1, 1, 1, 0.897622, 0.102378, 0.000000, 0.000000 },
-	{ -0.021150, -0.054541, 0.062408, 0.985872, -0.131891, -0.103256, 0.139385, 0.987828, 0.069052, 1.000000, 0.658370, 0.566770, 12, 1, 1, 1, 0.894467, 0.105533, 0.000000, 0.000000 },
-	{ -0.021354, -0.050167, 0.058378, 0.988044, -0.064497, -0.140036, 0.084066, 0.986765, 0.138663, 1.000000, 0.670180, 0.579230, 12, 1, 1, 1, 0.834827, 0.165173, 0.000000, 0.000000 },
-	{ -0.021915, -0.045732, 0.053081, 0.989755, -0.051921, -0.133004, 0.072292, 0.985541, 0.153240, 1.000000, 0.682410, 0.598320, 12, 1, 1, 1, 0.680113, 0.319887, 0.000000, 0.000000 },
-	{ -0.022287, -0.041919, 0.048027, 0.990220, -0.076190, -0.116875, 0.084026, 0.994429, 0.063650, 1.000000, 0.692170, 0.615130, 1, 12, 17, 1, 0.559933, 0.438528, 0.001539, 0.000000 },
-	{ -0.022453, -0.038350, 0.043462, 0.985811, -0.111216, -0.125727, 0.118317, 0.991692, 0.050478, 1.000000, 0.701150, 0.629800, 1, 12, 17, 1, 0.781080, 0.213160, 0.005760, 0.000000 },
-	{ -0.020806, -0.056394, 0.071623, 0.960296, -0.277634, -0.027420, 0.278519, 0.959725, 0.036805, 1.000000, 0.652070, 0.540590, 12, 1, 1, 1, 0.780072, 0.219928, 0.000000, 0.000000 },
-	{ -0.020244, -0.052001, 0.067351, 0.978913, -0.170219, -0.112941, 0.176501, 0.983124, 0.048102, 1.000000, 0.665210, 0.553100, 12, 1, 1, 1, 0.799801, 0.200199, 0.000000, 0.000000 },
-	{ -0.020507, -0.048125, 0.062815, 0.980289, -0.103697, -0.168166, 0.122820, 0.986579, 0.107595, 1.000000, 0.676510, 0.567070, 12, 1, 1, 1, 0.772450, 0.227550, 0.000000, 0.000000 },
-	{ -0.021180, -0.044334, 0.057639, 0.980710, -0.090402, -0.173308, 0.118566, 0.980013, 0.159741, 1.000000, 0.687490, 0.584560, 12, 1, 21, 1, 0.660061, 0.338852, 0.001087, 0.000000 },
-	{ -0.021706, -0.040740, 0.052329, 0.981445, -0.118423, -0.150800, 0.137978, 0.982313, 0.126586, 1.000000, 0.697070, 0.602240, 1, 12, 21, 1, 0.542246, 0.456067, 0.001687, 0.000000 },
-	{ -0.021886, -0.037311, 0.047512, 0.976445, -0.162903, -0.141487, 0.174840, 0.981627, 0.076416, 1.000000, 0.705640, 0.617300, 1, 12, 21, 17, 0.761693, 0.234315, 0.002149, 0.001843 },
-	{ -0.021530, -0.057737, 0.080807, 0.905034, -0.406465, 0.125303, 0.403358, 0.913653, 0.050401, 1.000000, 0.644310, 0.514430, 12, 1, 1, 1, 0.600658, 0.399342, 0.000000, 0.000000 },
-	{ -0.019654, -0.053113, 0.077029, 0.954722, -0.297414, 0.007121, 0.297491, 0.954599, -0.015478, 1.000000, 0.659800, 0.525000, 12, 1, 1, 1, 0.634239, 0.365761, 0.000000, 0.000000 },
-	{ -0.019086, -0.049237, 0.072140, 0.969362, -0.220098, -0.109059, 0.223245, 0.974607, 0.017392, 1.000000, 0.672370, 0.539240, 12, 1, 1, 1, 0.675699, 0.324301, 0.000000, 0.000000 },
-	{ -0.019339, -0.046011, 0.067140, 0.966085, -0.175201, -0.189693, 0.188840, 0.980396, 0.056246, 1.000000, 0.682840, 0.554710, 12, 1, 21, 1, 0.650861, 0.347199, 0.001941, 0.000000 },
-	{ -0.020068, -0.042959, 0.061916, 0.959102, -0.173202, -0.223884, 0.196949, 0.976427, 0.088327, 1.000000, 0.692030, 0.571900, 12, 1, 21, 1, 0.589746, 0.406772, 0.003482, 0.000000 },
-	{ -0.020788, -0.039762, 0.056250, 0.952292, -0.215203, -0.216399, 0.237406, 0.967930, 0.082154, 1.000000, 0.700950, 0.591540, 1, 12, 21, 1, 0.552118, 0.442549, 0.005333, 0.000000 },
-	{ -0.021091, -0.036466, 0.051039, 0.940449, -0.271543, -0.204499, 0.284934, 0.957770, 0.038582, 1.000000, 0.709230, 0.607730, 1, 12, 21, 1, 0.749754, 0.243582, 0.006664, 0.000000 },
-	{ -0.020785, -0.053424, 0.086271, 0.907373, -0.330944, 0.259134, 0.350459, 0.936041, -0.031723, 1.000000, 0.652100, 0.499690, 1, 12, 1, 1, 0.571241, 0.428759, 0.000000, 0.000000 },
-	{ -0.018569, -0.049198, 0.081888, 0.952682, -0.273806, 0.132008, 0.284330, 0.956277, -0.068492, 1.000000, 0.668290, 0.510620, 1, 12, 21, 1, 0.542630, 0.456314, 0.001057, 0.000000 },
-	{ -0.017810, -0.046061, 0.076615, 0.970622, -0.236149, -0.046125, 0.235958, 0.971716, -0.009620, 1.000000, 0.680210, 0.525510, 1, 12, 21, 1, 0.519623, 0.477892, 0.002485, 0.000000 },
-	{ -0.017958, -0.043607, 0.071236, 0.961724, -0.220195, -0.163098, 0.227975, 0.973193, 0.030391, 1.000000, 0.689860, 0.542770, 1, 12, 21, 1, 0.515480, 0.475389, 0.009131, 0.000000 },
-	{ -0.018581, -0.041277, 0.066102, 0.946702, -0.227503, -0.228028, 0.246848, 0.967203, 0.059864, 1.000000, 0.697580, 0.558330, 1, 12, 21, 1, 0.554697, 0.432515, 0.012787, 0.000000 },
-	{ -0.019392, -0.038593, 0.060357, 0.931205, -0.273823, -0.240579, 0.294300, 0.954240, 0.053044, 1.000000, 0.706030, 0.577750, 1, 12, 21, 1, 0.622887, 0.361459, 0.015653, 0.000000 },
-	{ -0.019829, -0.035487, 0.054685, 0.913090, -0.333846, -0.234124, 0.338941, 0.940608, -0.019369, 1.000000, 0.714120, 0.595900, 1, 12, 21, 1, 0.743388, 0.238839, 0.017773, 0.000000 },
-	{ -0.021358, -0.047452, 0.092253, 0.882323, -0.253450, 0.396572, 0.324929, 0.937615, -0.123694, 1.000000, 0.661280, 0.480170, 1, 12, 1, 1, 0.770099, 0.229901, 0.000000, 0.000000 },
-	{ -0.018271, -0.044618, 0.086088, 0.936152, -0.236943, 0.259765, 0.271576, 0.956538, -0.106216, 1.000000, 0.678610, 0.497350, 1, 12, 21, 1, 0.783232, 0.212370, 0.004397, 0.000000 },
-	{ -0.020663, -0.040608, 0.094394, 0.867097, -0.237532, 0.437859, 0.323893, 0.936658, -0.133286, 1.000000, 0.680890, 0.470270, 1, 12, 1, 1, 0.950157, 0.049843, 0.000000, 0.000000 },
-	{ -0.018193, -0.040206, 0.088903, 0.914781, -0.239993, 0.324930, 0.284641, 0.953721, -0.096936, 1.000000, 0.690430, 0.486990, 1, 12, 21, 1, 0.904055, 0.088696, 0.007249, 0.000000 },
-	{ -0.016922, -0.042611, 0.080514, 0.972243, -0.225689, 0.061714, 0.228198, 0.972907, -0.037108, 1.000000, 0.689520, 0.512870, 1, 12, 21, 1, 0.718459, 0.270945, 0.010596, 0.000000 },
-	{ -0.016453, -0.039343, 0.083273, 0.957768, -0.243579, 0.152804, 0.251723, 0.967125, -0.036127, 1.000000, 0.699470, 0.504300, 1, 12, 21, 1, 0.834432, 0.146990, 0.018578, 0.000000 },
-	{ -0.016759, -0.040882, 0.074811, 0.967569, -0.232918, -0.097772, 0.233703, 0.972302, -0.003502, 1.000000, 0.697840, 0.532070, 1, 12, 21, 1, 0.682708, 0.298535, 0.018756, 0.000000 },
-	{ -0.015863, -0.038158, 0.077553, 0.965771, -0.257662, -0.029964, 0.257192, 0.966180, -0.018651, 1.000000, 0.706650, 0.522520, 1, 12, 21, 1, 0.756956, 0.206420, 0.036624, 0.000000 },
-	{ -0.017232, -0.039164, 0.069575, 0.948243, -0.251712, -0.193588, 0.260773, 0.965140, 0.022413, 1.000000, 0.703940, 0.547790, 1, 12, 21, 1, 0.649491, 0.320947, 0.029562, 0.000000 },
-	{ -0.016059, -0.036661, 0.072018, 0.945289, -0.285964, -0.157017, 0.289469, 0.957187, -0.000570, 1.000000, 0.712890, 0.540310, 1, 12, 21, 1, 0.701350, 0.239281, 0.059369, 0.000000 },
-	{ -0.017984, -0.036905, 0.063763, 0.927802, -0.295232, -0.228082, 0.309367, 0.950528, 0.028081, 1.000000, 0.711440, 0.567850, 1, 12, 21, 1, 0.673511, 0.288712, 0.037777, 0.000000 },
-	{ -0.016662, -0.034786, 0.066241, 0.920766, -0.326054, -0.214194, 0.333365, 0.942796, -0.002108, 1.000000, 0.719740, 0.559030, 1, 12, 21, 1, 0.700236, 0.221181, 0.078583, 0.000000 },
-	{ -0.018444, -0.034057, 0.057867, 0.907571, -0.351564, -0.229604, 0.354844, 0.934498, -0.028265, 1.000000, 0.719760, 0.586310, 1, 12, 21, 1, 0.755084, 0.202477, 0.042438, 0.000000 },
-	{ -0.017132, -0.032260, 0.060205, 0.897955, -0.376903, -0.227204, 0.377283, 0.925077, -0.043489, 1.000000, 0.727110, 0.577970, 1, 12, 21, 22, 0.755226, 0.155058, 0.087784, 0.001932 },
-	{ -0.024639, -0.044176, 0.099629, 0.845430, -0.237804, 0.478222, 0.352908, 0.920815, -0.166002, 1.000000, 0.656000, 0.456640, 1, 12, 1, 1, 0.896543, 0.103457, 0.000000, 0.000000 },
-	{ -0.023578, -0.039739, 0.099804, 0.850108, -0.240726, 0.468366, 0.369106, 0.906743, -0.203909, 1.000000, 0.672470, 0.452820, 1, 12, 1, 1, 0.974837, 0.025163, 0.000000, 0.000000 },
-	{ -0.015904, -0.033392, 0.067027, 0.883764, -0.415386, -0.215444, 0.400117, 0.909551, -0.112352, 1.000000, 0.723930, 0.556690, 1, 12, 21, 22, 0.696704, 0.164277, 0.137949, 0.001070 },
-	{ -0.016396, -0.031027, 0.060737, 0.851193, -0.464292, -0.244752, 0.452164, 0.885469, -0.107198, 1.000000, 0.731260, 0.576390, 1, 21, 12, 22, 0.734295, 0.156402, 0.106176, 0.003127 },
-	{ -0.015196, -0.032148, 0.067072, 0.768831, -0.592664, -0.240100, 0.517510, 0.797243, -0.310785, 1.000000, 0.728630, 0.555220, 1, 21, 12, 22, 0.670988, 0.211873, 0.114380, 0.002759 },
-	{ -0.014472, -0.033485, 0.073224, 0.817580, -0.559522, -0.136008, 0.537378, 0.826266, -0.168845, 1.000000, 0.723050, 0.535470, 1, 12, 21, 1, 0.702664, 0.155273, 0.142063, 0.000000 },
-	{ -0.015271, -0.034956, 0.073044, 0.916433, -0.376985, -0.134283, 0.368722, 0.925844, -0.082810, 1.000000, 0.717880, 0.536960, 1, 12, 21, 1, 0.715547, 0.176676, 0.107777, 0.000000 },
-	{ -0.015690, -0.029854, 0.060535, 0.723941, -0.626145, -0.289571, 0.550246, 0.777276, -0.305077, 1.000000, 0.735580, 0.575950, 1, 21, 12, 22, 0.700060, 0.247260, 0.045196, 0.007485 },
-	{ -0.014396, -0.034273, 0.079274, 0.857908, -0.513201, 0.024873, 0.511919, 0.849618, -0.126840, 1.000000, 0.718620, 0.516100, 1, 21, 12, 1, 0.795189, 0.117202, 0.087609, 0.000000 },
-	{ -0.015195, -0.036065, 0.078883, 0.939821, -0.341392, 0.013711, 0.341491, 0.937288, -0.069819, 1.000000, 0.713090, 0.518180, 1, 12, 21, 1, 0.797301, 0.135456, 0.067243, 0.000000 },
-	{ -0.015106, -0.034364, 0.085121, 0.857953, -0.475458, 0.194570, 0.499449, 0.860644, -0.099211, 1.000000, 0.714740, 0.497680, 1, 21, 12, 1, 0.891894, 0.061466, 0.046641, 0.000000 },
-	{ -0.015948, -0.036641, 0.084655, 0.926727, -0.322865, 0.192186, 0.338669, 0.939291, -0.055100, 1.000000, 0.707750, 0.499760, 1, 12, 21, 1, 0.880425, 0.085189, 0.034386, 0.000000 },
-	{ -0.013297, -0.031689, 0.084975, 0.760265, -0.618613, 0.198280, 0.646657, 0.749775, -0.140256, 1.000000, 0.723690, 0.496710, 1, 21, 12, 1, 0.869492, 0.105895, 0.024613, 0.000000 },
-	{ -0.012808, -0.032088, 0.078952, 0.736879, -0.674960, 0.037920, 0.671747, 0.724764, -0.153209, 1.000000, 0.726360, 0.515970, 1, 21, 12, 1, 0.771991, 0.158775, 0.069234, 0.000000 },
-	{ -0.013915, -0.030668, 0.066629, 0.598310, -0.760248, -0.253078, 0.677007, 0.648591, -0.347838, 1.000000, 0.735290, 0.554020, 1, 21, 12, 22, 0.634445, 0.319469, 0.040330, 0.005756 },
-	{ -0.014499, -0.028470, 0.059946, 0.540376, -0.774331, -0.329250, 0.671979, 0.632643, -0.384977, 1.000000, 0.741540, 0.575510, 1, 21, 22, 12, 0.614122, 0.356007, 0.015096, 0.014775 },
-	{ -0.013026, -0.031726, 0.072736, 0.670277, -0.731460, -0.125285, 0.703603, 0.680050, -0.206092, 1.000000, 0.730430, 0.535680, 1, 21, 12, 22, 0.681460, 0.248589, 0.068697, 0.001255 },
-	{ -0.017627, -0.036717, 0.090206, 0.886086, -0.310302, 0.344332, 0.355574, 0.931594, -0.075493, 1.000000, 0.701230, 0.482030, 1, 12, 21, 1, 0.942293, 0.043585, 0.014122, 0.000000 },
-	{ -0.019829, -0.036326, 0.095178, 0.841535, -0.288217, 0.456891, 0.363201, 0.927953, -0.083596, 1.000000, 0.695020, 0.466670, 1, 12, 1, 1, 0.980328, 0.019672, 0.000000, 0.000000 },
-	{ -0.022401, -0.035735, 0.099717, 0.839612, -0.276130, 0.467765, 0.379130, 0.914597, -0.140614, 1.000000, 0.688100, 0.450590, 1, 12, 1, 1, 0.991411, 0.008589, 0.000000, 0.000000 },
-	{ -0.014407, -0.030769, 0.090192, 0.752096, -0.552488, 0.359316, 0.618859, 0.779520, -0.096759, 1.000000, 0.721360, 0.480540, 1, 21, 12, 1, 0.935761, 0.053369, 0.010871, 0.000000 },
-	{ -0.020816, -0.032124, 0.099331, 0.800014, -0.338355, 0.495473, 0.444577, 0.888856, -0.110842, 1.000000, 0.701630, 0.450520, 1, 12, 1, 1, 0.995940, 0.004060, 0.000000, 0.000000 },
-	{ -0.018443, -0.032983, 0.095169, 0.792030, -0.386874, 0.472247, 0.477979, 0.874202, -0.085479, 1.000000, 0.706780, 0.465610, 1, 12, 1, 1, 0.988718, 0.011282, 0.000000, 0.000000 },
-	{ -0.018691, -0.028694, 0.098711, 0.736080, -0.385061, 0.556700, 0.525451, 0.843511, -0.111318, 1.000000, 0.714620, 0.451390, 1, 12, 1, 1, 0.998029, 0.001971, 0.000000, 0.000000 },
-	{ -0.016213, -0.029666, 0.094718, 0.730947, -0.466942, 0.497676, 0.580787, 0.808566, -0.094381, 1.000000, 0.718870, 0.466000, 1, 12, 21, 1, 0.984715, 0.011636, 0.003649, 0.000000 },
-	{ -0.016533, -0.033866, 0.090497, 0.827978, -0.439396, 0.348401, 0.490185, 0.868873, -0.069124, 1.000000, 0.710640, 0.480540, 1, 21, 12, 1, 0.951639, 0.027418, 0.020943, 0.000000 },
-	{ -0.025634, -0.039271, 0.104195, 0.891515, -0.286039, 0.351259, 0.359293, 0.918747, -0.163748, 1.000000, 0.668000, 0.440440, 1, 12, 1, 1, 0.989160, 0.010840, 0.000000, 0.000000 },
-	{ -0.026767, -0.042598, 0.104408, 0.874149, -0.283507, 0.394320, 0.360356, 0.922955, -0.135273, 1.000000, 0.653050, 0.441450, 1, 12, 1, 1, 0.957076, 0.042924, 0.000000, 0.000000 },
-	{ -0.027958, -0.041639, 0.109108, 0.905601, -0.359111, 0.225668, 0.391126, 0.912885, -0.116885, 1.000000, 0.649680, 0.426020, 1, 12, 1, 1, 0.982207, 0.017793, 0.000000, 0.000000 },
-	{ -0.026892, -0.039025, 0.109046, 0.915795, -0.349528, 0.197864, 0.377405, 0.917414, -0.126165, 1.000000, 0.663330, 0.425240, 1, 12, 1, 1, 0.995155, 0.004845, 0.000000, 0.000000 },
-	{ -0.029008, -0.044340, 0.108863, 0.884779, -0.384135, 0.263831, 0.419511, 0.903077, -0.091995, 1.000000, 0.638170, 0.427870, 1, 12, 1, 1, 0.964907, 0.035093, 0.000000, 0.000000 },
-	{ -0.027904, -0.046259, 0.104187, 0.837045, -0.318882, 0.444602, 0.391717, 0.916595, -0.080070, 1.000000, 0.639550, 0.443610, 1, 12, 1, 1, 0.925702, 0.074298, 0.000000, 0.000000 },
-	{ -0.030304, -0.047328, 0.108437, 0.828220, -0.465243, 0.312412, 0.499655, 0.865487, -0.035731, 1.000000, 0.628810, 0.429860, 1, 12, 1, 1, 0.942426, 0.057574, 0.000000, 0.000000 },
-	{ -0.029290, -0.050184, 0.103633, 0.745714, -0.424995, 0.513117, 0.491124, 0.871056, 0.007709, 1.000000, 0.628610, 0.445820, 1, 12, 1, 1, 0.888137, 0.111863, 0.000000, 0.000000 },
-	{ -0.031961, -0.050029, 0.107958, 0.695644, -0.615857, 0.369864, 0.649562, 0.759130, 0.042316, 1.000000, 0.621120, 0.431500, 1, 12, 1, 1, 0.920296, 0.079704, 0.000000, 0.000000 },
-	{ -0.031046, -0.053251, 0.103000, 0.565824, -0.585935, 0.580107, 0.647567, 0.751311, 0.127236, 1.000000, 0.619860, 0.447260, 1, 12, 1, 1, 0.853850, 0.146150, 0.000000, 0.000000 },
-	{ -0.024236, -0.035565, 0.103654, 0.894145, -0.299794, 0.332608, 0.366411, 0.916830, -0.158639, 1.000000, 0.683390, 0.440140, 1, 12, 1, 1, 0.996898, 0.003102, 0.000000, 0.000000 },
-	{ -0.025516, -0.035700, 0.108575, 0.925672, -0.326231, 0.191585, 0.354948, 0.924135, -0.141371, 1.000000, 0.677500, 0.425130, 1, 12, 1, 1, 0.998554, 0.001446, 0.000000, 0.000000 },
-	{ -0.022622, -0.031730, 0.102960, 0.875586, -0.321897, 0.360183, 0.396263, 0.905053, -0.154447, 1.000000, 0.698280, 0.440330, 1, 12, 1, 1, 0.998542, 0.001458, 0.000000, 0.000000 },
-	{ -0.024018, -0.031772, 0.107672, 0.925625, -0.313112, 0.212556, 0.343998, 0.930247, -0.127695, 1.000000, 0.691940, 0.426080, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020819, -0.028006, 0.102160, 0.827498, -0.337917, 0.448397, 0.457281, 0.869006, -0.189002, 1.000000, 0.711520, 0.440160, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022286, -0.027669, 0.106392, 0.913115, -0.311204, 0.263388, 0.358487, 0.920554, -0.155134, 1.000000, 0.708020, 0.428690, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024940, -0.031736, 0.113184, 0.945870, -0.298048, 0.128443, 0.314661, 0.939119, -0.138004, 1.000000, 0.687200, 0.409190, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023422, -0.027266, 0.112171, 0.944133, -0.288140, 0.159962, 0.311001, 0.939566, -0.143158, 1.000000, 0.702450, 0.410130, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025314, -0.031268, 0.118679, 0.956753, -0.280374, 0.077548, 0.288576, 0.948398, -0.131399, 1.000000, 0.685760, 0.394020, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026613, -0.035389, 0.119196, 0.947612, -0.314185, 0.057621, 0.318962, 0.940425, -0.117751, 1.000000, 0.673260, 0.394050, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026292, -0.035672, 0.113912, 0.938053, -0.329175, 0.108168, 0.341256, 0.931770, -0.123894, 1.000000, 0.674110, 0.408680, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.027811, -0.038647, 0.119608, 0.928141, -0.370114, 0.039623, 0.372013, 0.918701, -0.132645, 1.000000, 0.661250, 0.393970, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.027495, -0.038554, 0.114399, 0.921682, -0.375601, 0.097086, 0.385574, 0.914531, -0.122340, 1.000000, 0.661010, 0.408280, 1, 12, 1, 1, 0.997945, 0.002055, 0.000000, 0.000000 },
-	{ -0.029071, -0.041472, 0.119751, 0.905828, -0.422448, 0.031831, 0.422883, 0.897139, -0.127714, 1.000000, 0.649700, 0.395040, 1, 12, 1, 1, 0.997425, 0.002575, 0.000000, 0.000000 },
-	{ -0.028597, -0.041003, 0.114501, 0.908501, -0.405457, 0.101146, 0.416238, 0.899472, -0.133026, 1.000000, 0.648490, 0.409000, 1, 12, 1, 1, 0.993244, 0.006756, 0.000000, 0.000000 },
-	{ -0.030461, -0.044233, 0.119832, 0.882088, -0.469439, 0.039343, 0.471032, 0.877665, -0.088510, 1.000000, 0.639150, 0.395770, 1, 12, 1, 1, 0.993280, 0.006720, 0.000000, 0.000000 },
-	{ -0.029743, -0.043505, 0.114382, 0.893354, -0.432890, 0.120521, 0.445805, 0.887468, -0.116875, 1.000000, 0.637820, 0.410510, 1, 12, 1, 1, 0.985989, 0.014011, 0.000000, 0.000000 },
-	{ -0.031969, -0.046821, 0.119879, 0.833638, -0.549874, 0.051830, 0.552229, 0.831453, -0.061068, 1.000000, 0.630100, 0.396210, 1, 12, 1, 1, 0.988754, 0.011246, 0.000000, 0.000000 },
-	{ -0.031069, -0.046185, 0.114189, 0.851690, -0.504294, 0.142521, 0.516871, 0.853216, -0.069760, 1.000000, 0.629060, 0.411930, 1, 12, 1, 1, 0.979383, 0.020617, 0.000000, 0.000000 },
-	{ -0.033568, -0.048874, 0.119714, 0.735798, -0.674688, 0.058280, 0.677081, 0.734557, -0.044581, 1.000000, 0.622630, 0.397150, 1, 12, 1, 1, 0.984131, 0.015869, 0.000000, 0.000000 },
-	{ -0.032629, -0.048576, 0.113853, 0.750802, -0.640476, 0.161515, 0.651540, 0.758304, -0.021682, 1.000000, 0.621750, 0.413270, 1, 12, 1, 1, 0.976217, 0.023783, 0.000000, 0.000000 },
-	{ -0.023953, -0.026561, 0.118054, 0.958310, -0.267497, 0.100430, 0.280376, 0.948073, -0.150155, 1.000000, 0.700060, 0.393840, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.033880, -0.048991, 0.124267, 0.725558, -0.687611, 0.027515, 0.688122, 0.724514, -0.039594, 1.000000, 0.624110, 0.380970, 1, 8, 1, 1, 0.997266, 0.002734, 0.000000, 0.000000 },
-	{ -0.032271, -0.047066, 0.124469, 0.820044, -0.571865, 0.022352, 0.571985, 0.817666, -0.065232, 1.000000, 0.632130, 0.379860, 1, 8, 1, 1, 0.998245, 0.001755, 0.000000, 0.000000 },
-	{ -0.030700, -0.044564, 0.124455, 0.873238, -0.487093, 0.014016, 0.485510, 0.867220, -0.110498, 1.000000, 0.641310, 0.378750, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.029207, -0.041676, 0.124384, 0.904579, -0.426094, 0.013429, 0.423917, 0.895736, -0.133983, 1.000000, 0.651560, 0.377360, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.027834, -0.038406, 0.124269, 0.932449, -0.360435, 0.025006, 0.360534, 0.923730, -0.129377, 1.000000, 0.662310, 0.375920, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026594, -0.034723, 0.123954, 0.952540, -0.301568, 0.041516, 0.304412, 0.943859, -0.128315, 1.000000, 0.673630, 0.375180, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025384, -0.030447, 0.123459, 0.961255, -0.269134, 0.059633, 0.274860, 0.952241, -0.132997, 1.000000, 0.686170, 0.374750, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.024109, -0.025684, 0.122908, 0.963437, -0.256531, 0.077334, 0.265375, 0.953422, -0.143398, 1.000000, 0.699540, 0.374400, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022600, -0.021876, 0.117199, 0.960487, -0.250664, 0.120961, 0.270488, 0.943080, -0.193486, 1.000000, 0.714480, 0.393900, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022858, -0.020981, 0.122263, 0.965540, -0.244591, 0.088922, 0.257636, 0.946643, -0.193625, 1.000000, 0.713190, 0.373870, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021468, -0.017662, 0.116164, 0.972585, -0.194166, 0.127981, 0.221124, 0.942538, -0.250452, 1.000000, 0.728210, 0.393960, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020572, -0.018780, 0.109667, 0.953001, -0.197718, 0.229557, 0.255635, 0.931427, -0.259025, 1.000000, 0.732050, 0.412870, 1, 21, 1, 1, 0.998081, 0.001919, 0.000000, 0.000000 },
-	{ -0.021868, -0.022879, 0.110893, 0.944160, -0.264611, 0.196326, 0.300288, 0.936287, -0.182192, 1.000000, 0.717810, 0.411890, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019778, -0.014799, 0.108642, 0.965361, -0.060050, 0.253914, 0.153062, 0.918452, -0.364717, 1.000000, 0.746080, 0.412140, 1, 21, 1, 1, 0.996799, 0.003201, 0.000000, 0.000000 },
-	{ -0.020776, -0.013766, 0.115140, 0.991052, -0.068060, 0.114820, 0.101873, 0.941509, -0.321220, 1.000000, 0.741670, 0.393460, 1, 21, 1, 1, 0.998771, 0.001229, 0.000000, 0.000000 },
-	{ -0.018965, -0.019339, 0.104384, 0.870243, -0.213648, 0.443882, 0.369921, 0.878465, -0.302421, 1.000000, 0.736630, 0.428180, 1, 21, 1, 1, 0.997695, 0.002305, 0.000000, 0.000000 },
-	{ -0.020550, -0.023565, 0.105254, 0.894314, -0.287487, 0.342862, 0.378321, 0.894989, -0.236363, 1.000000, 0.722510, 0.429500, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016187, -0.019406, 0.100719, 0.710884, -0.227731, 0.665419, 0.481704, 0.847028, -0.224733, 1.000000, 0.740630, 0.438020, 1, 21, 1, 1, 0.993663, 0.006337, 0.000000, 0.000000 },
-	{ -0.013986, -0.014394, 0.099808, 0.677229, -0.050578, 0.734032, 0.401522, 0.861393, -0.311097, 1.000000, 0.758350, 0.436720, 1, 21, 1, 1, 0.981366, 0.018634, 0.000000, 0.000000 },
-	{ -0.017799, -0.015003, 0.103659, 0.836926, -0.056701, 0.544372, 0.308765, 0.870147, -0.384068, 1.000000, 0.751280, 0.425410, 1, 21, 1, 1, 0.992836, 0.007164, 0.000000, 0.000000 },
-	{ -0.018702, -0.024038, 0.101480, 0.763271, -0.315441, 0.563839, 0.498852, 0.842322, -0.204059, 1.000000, 0.724550, 0.439120, 1, 21, 1, 1, 0.998405, 0.001595, 0.000000, 0.000000 },
-	{ -0.021747, -0.016668, 0.121525, 0.976705, -0.196720, 0.085729, 0.211878, 0.947359, -0.240038, 1.000000, 0.726300, 0.372800, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021049, -0.012687, 0.120805, 0.995106, -0.076158, 0.062956, 0.091781, 0.948437, -0.303389, 1.000000, 0.739140, 0.371500, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.011665, -0.019209, 0.096689, 0.685968, -0.271682, 0.675009, 0.524917, 0.827201, -0.200502, 1.000000, 0.748950, 0.453120, 1, 21, 1, 1, 0.971892, 0.028108, 0.000000, 0.000000 },
-	{ -0.015570, -0.024510, 0.097875, 0.690028, -0.368964, 0.622678, 0.562504, 0.814759, -0.140565, 1.000000, 0.730060, 0.452560, 1, 21, 12, 1, 0.987863, 0.010087, 0.002050, 0.000000 },
-	{ -0.012546, -0.025338, 0.093768, 0.704829, -0.462814, 0.537605, 0.615356, 0.775937, -0.138775, 1.000000, 0.733860, 0.467000, 1, 21, 12, 1, 0.941659, 0.056605, 0.001736, 0.000000 },
-	{ -0.007859, -0.019793, 0.092244, 0.733679, -0.355107, 0.579323, 0.557963, 0.801430, -0.215377, 1.000000, 0.752430, 0.468080, 1, 21, 1, 1, 0.881497, 0.118503, 0.000000, 0.000000 },
-	{ -0.008542, -0.013538, 0.095269, 0.714521, -0.057349, 0.697260, 0.403463, 0.847988, -0.343705, 1.000000, 0.767830, 0.452660, 1, 21, 1, 1, 0.941969, 0.058031, 0.000000, 0.000000 },
-	{ -0.003964, -0.013829, 0.089997, 0.797097, -0.099116, 0.595661, 0.376220, 0.853101, -0.361493, 1.000000, 0.771400, 0.469130, 1, 21, 1, 1, 0.779105, 0.220895, 0.000000, 0.000000 },
-	{ -0.001023, -0.006593, 0.085428, 0.812611, 0.104884, 0.573291, 0.204879, 0.869480, -0.449477, 1.000000, 0.794690, 0.472350, 1, 21, 1, 1, 0.623020, 0.376980, 0.000000, 0.000000 },
-	{ -0.007526, -0.007950, 0.093797, 0.709032, 0.157802, 0.687293, 0.267320, 0.841749, -0.469041, 1.000000, 0.784480, 0.448410, 1, 21, 1, 1, 0.892437, 0.107563, 0.000000, 0.000000 },
-	{ 0.002511, -0.010646, 0.079933, 0.885136, -0.096019, 0.455319, 0.292289, 0.876088, -0.383454, 1.000000, 0.790120, 0.493800, 1, 21, 1, 1, 0.524286, 0.475714, 0.000000, 0.000000 },
-	{ -0.001137, -0.015851, 0.084845, 0.845814, -0.248248, 0.472198, 0.425622, 0.847652, -0.316751, 1.000000, 0.771040, 0.485750, 1, 21, 1, 1, 0.686782, 0.313218, 0.000000, 0.000000 },
-	{ 0.003529, -0.013845, 0.075256, 0.890947, -0.357092, 0.280533, 0.438329, 0.837691, -0.325793, 1.000000, 0.786940, 0.508700, 21, 1, 22, 1, 0.559287, 0.439155, 0.001558, 0.000000 },
-	{ -0.000088, -0.018359, 0.079833, 0.830489, -0.476787, 0.288032, 0.548272, 0.791023, -0.271443, 1.000000, 0.769360, 0.501020, 1, 21, 1, 1, 0.592397, 0.407603, 0.000000, 0.000000 },
-	{ -0.000399, -0.020751, 0.074249, 0.769859, -0.625701, 0.125759, 0.631966, 0.719874, -0.287054, 1.000000, 0.767650, 0.518320, 21, 1, 22, 1, 0.504765, 0.493052, 0.002183, 0.000000 },
-	{ 0.003320, -0.016360, 0.070131, 0.831854, -0.540631, 0.125447, 0.550124, 0.773334, -0.315147, 1.000000, 0.784960, 0.525040, 21, 1, 22, 1, 0.633840, 0.358296, 0.007865, 0.000000 },
-	{ 0.006579, -0.010016, 0.069342, 0.917986, -0.299847, 0.259603, 0.381541, 0.846371, -0.371594, 1.000000, 0.803330, 0.520270, 21, 1, 22, 1, 0.689574, 0.296314, 0.014112, 0.000000 },
-	{ 0.006381, -0.012561, 0.064940, 0.863097, -0.492788, 0.110564, 0.497456, 0.791724, -0.354557, 1.000000, 0.801180, 0.534740, 21, 1, 22, 1, 0.722611, 0.222327, 0.055063, 0.000000 },
-	{ 0.005960, -0.006629, 0.073139, 0.912595, -0.058894, 0.404602, 0.243940, 0.872578, -0.423203, 1.000000, 0.807650, 0.506460, 21, 1, 22, 1, 0.645945, 0.350876, 0.003179, 0.000000 },
-	{ 0.008861, -0.003729, 0.066090, 0.939725, -0.061115, 0.336425, 0.220511, 0.860278, -0.459670, 1.000000, 0.822120, 0.520850, 21, 1, 22, 1, 0.753109, 0.211478, 0.035413, 0.000000 },
-	{ 0.009082, -0.007138, 0.063146, 0.935313, -0.279901, 0.216438, 0.347756, 0.840009, -0.416474, 1.000000, 0.817140, 0.533040, 21, 1, 22, 1, 0.755516, 0.141042, 0.103442, 0.000000 },
-	{ 0.010781, -0.004949, 0.057605, 0.945150, -0.291564, 0.147247, 0.326280, 0.821704, -0.467273, 1.000000, 0.828450, 0.544040, 21, 22, 1, 1, 0.741557, 0.236787, 0.021656, 0.000000 },
-	{ 0.008552, -0.009685, 0.059669, 0.875997, -0.479381, 0.053126, 0.459589, 0.796227, -0.393447, 1.000000, 0.814200, 0.544850, 21, 22, 1, 1, 0.743700, 0.196758, 0.059542, 0.000000 },
-	{ 0.009840, -0.007328, 0.055021, 0.870229, -0.491497, -0.033653, 0.430849, 0.792412, -0.431801, 1.000000, 0.824700, 0.553850, 21, 22, 1, 1, 0.694362, 0.298598, 0.007039, 0.000000 },
-	{ 0.010977, -0.001630, 0.059762, 0.958619, -0.073416, 0.275062, 0.210089, 0.834452, -0.509462, 1.000000, 0.833900, 0.534040, 21, 22, 1, 1, 0.771579, 0.172453, 0.055968, 0.000000 },
-	{ 0.008214, -0.008815, 0.051943, 0.762890, -0.610252, -0.213522, 0.493149, 0.763188, -0.417551, 1.000000, 0.822370, 0.565180, 21, 22, 1, 1, 0.628165, 0.369270, 0.002564, 0.000000 },
-	{ 0.007143, -0.011414, 0.055769, 0.782483, -0.608140, -0.133740, 0.521938, 0.757716, -0.391724, 1.000000, 0.812140, 0.557550, 21, 22, 1, 1, 0.710898, 0.269044, 0.020059, 0.000000 },
-	{ 0.006008, -0.009548, 0.048329, 0.663514, -0.656736, -0.358395, 0.524947, 0.749983, -0.402438, 1.000000, 0.820880, 0.579380, 21, 22, 1, 1, 0.546043, 0.453957, 0.000000, 0.000000 },
-	{ 0.004991, -0.012281, 0.051455, 0.685859, -0.661533, -0.303266, 0.551187, 0.744317, -0.377074, 1.000000, 0.810590, 0.572970, 21, 22, 1, 1, 0.653028, 0.339659, 0.007312, 0.000000 },
-	{ 0.002414, -0.012165, 0.047018, 0.584141, -0.671277, -0.456253, 0.570958, 0.739376, -0.356833, 1.000000, 0.810460, 0.589400, 21, 22, 1, 1, 0.574407, 0.423112, 0.002481, 0.000000 },
-	{ 0.003358, -0.015475, 0.054967, 0.678166, -0.695770, -0.236633, 0.601440, 0.710481, -0.365359, 1.000000, 0.798360, 0.566410, 21, 22, 1, 1, 0.713492, 0.237965, 0.048544, 0.000000 },
-	{ 0.000782, -0.015293, 0.049728, 0.578230, -0.711327, -0.399579, 0.618012, 0.701614, -0.354683, 1.000000, 0.798600, 0.584690, 21, 22, 1, 1, 0.657149, 0.325222, 0.017629, 0.000000 },
-	{ -0.002010, -0.014035, 0.044893, 0.487031, -0.678359, -0.550119, 0.607292, 0.715709, -0.344901, 1.000000, 0.799940, 0.602290, 21, 22, 1, 23, 0.575087, 0.413000, 0.010822, 0.001092 },
-	{ -0.004201, -0.017165, 0.047014, 0.466079, -0.736353, -0.490463, 0.662278, 0.657950, -0.358456, 1.000000, 0.787120, 0.599890, 21, 22, 1, 23, 0.618113, 0.330091, 0.050573, 0.001222 },
-	{ -0.001712, -0.018695, 0.052690, 0.540005, -0.767020, -0.346520, 0.683542, 0.639883, -0.351169, 1.000000, 0.784610, 0.580120, 21, 22, 1, 1, 0.686367, 0.231446, 0.082188, 0.000000 },
-	{ -0.006878, -0.019976, 0.049195, 0.416680, -0.795955, -0.439128, 0.738396, 0.578109, -0.347221, 1.000000, 0.774740, 0.597890, 21, 22, 1, 23, 0.609197, 0.233952, 0.155695, 0.001157 },
-	{ -0.005194, -0.022023, 0.055391, 0.478721, -0.818030, -0.318831, 0.753037, 0.569279, -0.329934, 1.000000, 0.770570, 0.577110, 21, 1, 22, 1, 0.656847, 0.202926, 0.140227, 0.000000 },
-	{ -0.000347, -0.011031, 0.042974, 0.478412, -0.639893, -0.601381, 0.578716, 0.744827, -0.332145, 1.000000, 0.811300, 0.605030, 22, 21, 1, 23, 0.507328, 0.489929, 0.001705, 0.001038 },
-	{ 0.003493, -0.009454, 0.044630, 0.554928, -0.664770, -0.500136, 0.551389, 0.744089, -0.377229, 1.000000, 0.820350, 0.593960, 22, 21, 1, 1, 0.542592, 0.457408, 0.000000, 0.000000 },
-	{ 0.000845, -0.008447, 0.041305, 0.438293, -0.636396, -0.634744, 0.578171, 0.740313, -0.343009, 1.000000, 0.820710, 0.607950, 22, 21, 1, 1, 0.618271, 0.381729, 0.000000, 0.000000 },
-	{ 0.000646, -0.019091, 0.058653, 0.639605, -0.744515, -0.191317, 0.665887, 0.660968, -0.346000, 1.000000, 0.783750, 0.560710, 21, 1, 22, 1, 0.711186, 0.166665, 0.122149, 0.000000 },
-	{ -0.003288, -0.022842, 0.061764, 0.574593, -0.796741, -0.187209, 0.733742, 0.602808, -0.313440, 1.000000, 0.768760, 0.557440, 21, 1, 22, 1, 0.650040, 0.296664, 0.053296, 0.000000 },
-	{ 0.005293, -0.014438, 0.060134, 0.778875, -0.624541, -0.057467, 0.565725, 0.739157, -0.365516, 1.000000, 0.799390, 0.549830, 21, 22, 1, 1, 0.734060, 0.146709, 0.119231, 0.000000 },
-	{ 0.002364, -0.018230, 0.064516, 0.745345, -0.666188, -0.025593, 0.622956, 0.709623, -0.329183, 1.000000, 0.783910, 0.542700, 21, 1, 22, 1, 0.689805, 0.271480, 0.038715, 0.000000 },
-	{ -0.001541, -0.022369, 0.068127, 0.684499, -0.728369, -0.030646, 0.691783, 0.662230, -0.287902, 1.000000, 0.767360, 0.537700, 21, 1, 22, 1, 0.592761, 0.394721, 0.012518, 0.000000 },
-	{ -0.009097, -0.024735, 0.057441, 0.423251, -0.847025, -0.321571, 0.798286, 0.516504, -0.309780, 1.000000, 0.759090, 0.575830, 21, 1, 22, 12, 0.578848, 0.347119, 0.072904, 0.001128 },
-	{ -0.007646, -0.026204, 0.064108, 0.517007, -0.829718, -0.210410, 0.790582, 0.557090, -0.254226, 1.000000, 0.754860, 0.555490, 21, 1, 22, 12, 0.548608, 0.425008, 0.024117, 0.002266 },
-	{ -0.011400, -0.028797, 0.065726, 0.507809, -0.827993, -0.237820, 0.779256, 0.559191, -0.282958, 1.000000, 0.743700, 0.553580, 1, 21, 22, 12, 0.546145, 0.431821, 0.011372, 0.010663 },
-	{ -0.012325, -0.026816, 0.059006, 0.430709, -0.838500, -0.333780, 0.771908, 0.533891, -0.345136, 1.000000, 0.749400, 0.574670, 1, 21, 22, 12, 0.490365, 0.472125, 0.033066, 0.004444 },
-	{ -0.010203, -0.029437, 0.071854, 0.598272, -0.796375, -0.088640, 0.761990, 0.599655, -0.244511, 1.000000, 0.740160, 0.536000, 1, 21, 12, 22, 0.626568, 0.353455, 0.017315, 0.002662 },
-	{ -0.006047, -0.026334, 0.070544, 0.619825, -0.782949, -0.052982, 0.746556, 0.609124, -0.267623, 1.000000, 0.751880, 0.535400, 1, 21, 22, 12, 0.520679, 0.470806, 0.005580, 0.002935 },
-	{ -0.009639, -0.029086, 0.078116, 0.673138, -0.735718, 0.074859, 0.734077, 0.652499, -0.188084, 1.000000, 0.737470, 0.516240, 1, 21, 12, 1, 0.721542, 0.258731, 0.019728, 0.000000 },
-	{ -0.004948, -0.025119, 0.076718, 0.695687, -0.709812, 0.110394, 0.711179, 0.658913, -0.245067, 1.000000, 0.751450, 0.516580, 1, 21, 12, 1, 0.626164, 0.372127, 0.001709, 0.000000 },
-	{ -0.009667, -0.027962, 0.084206, 0.712006, -0.664885, 0.225779, 0.700881, 0.692458, -0.171081, 1.000000, 0.736520, 0.496370, 1, 21, 12, 1, 0.820259, 0.171599, 0.008142, 0.000000 },
-	{ -0.004614, -0.023190, 0.082635, 0.745395, -0.611785, 0.264775, 0.663774, 0.717833, -0.210047, 1.000000, 0.751880, 0.497150, 1, 21, 12, 1, 0.728510, 0.270485, 0.001004, 0.000000 },
-	{ -0.005431, -0.021287, 0.087620, 0.762700, -0.474538, 0.439434, 0.602295, 0.768704, -0.215256, 1.000000, 0.752710, 0.482830, 1, 21, 1, 1, 0.813820, 0.186180, 0.000000, 0.000000 },
-	{ -0.010518, -0.026593, 0.089266, 0.721222, -0.569694, 0.394067, 0.660605, 0.736828, -0.143826, 1.000000, 0.735650, 0.481500, 1, 21, 12, 1, 0.893108, 0.102531, 0.004361, 0.000000 },
-	{ -0.014519, -0.025312, 0.053265, 0.477135, -0.786120, -0.392885, 0.700656, 0.610129, -0.369898, 1.000000, 0.748700, 0.596130, 1, 21, 22, 12, 0.620098, 0.346003, 0.030204, 0.003696 },
-	{ -0.012573, -0.023903, 0.052292, 0.365795, -0.836298, -0.408412, 0.769163, 0.518715, -0.373261, 1.000000, 0.755780, 0.595970, 1, 21, 22, 12, 0.473438, 0.455278, 0.070017, 0.001267 },
-	{ -0.009860, -0.022251, 0.051017, 0.363456, -0.834559, -0.414019, 0.785816, 0.513343, -0.344925, 1.000000, 0.764090, 0.596020, 21, 1, 22, 1, 0.550331, 0.309114, 0.140555, 0.000000 },
-	{ -0.015678, -0.026652, 0.054085, 0.668901, -0.660971, -0.340131, 0.592102, 0.750396, -0.293806, 1.000000, 0.743230, 0.595510, 1, 21, 22, 12, 0.736491, 0.240077, 0.013011, 0.010422 },
-	{ -0.016453, -0.027883, 0.054534, 0.815335, -0.510419, -0.273316, 0.493503, 0.859519, -0.132977, 1.000000, 0.738930, 0.595240, 1, 21, 12, 22, 0.801725, 0.150473, 0.042208, 0.005594 },
-	{ -0.017246, -0.029126, 0.054205, 0.878802, -0.414913, -0.235699, 0.411990, 0.908941, -0.063951, 1.000000, 0.735030, 0.596360, 1, 12, 21, 22, 0.829106, 0.084401, 0.084011, 0.002482 },
-	{ -0.015633, -0.023258, 0.047968, 0.630920, -0.665901, -0.398141, 0.646029, 0.735076, -0.205694, 1.000000, 0.751230, 0.613910, 1, 21, 22, 12, 0.778299, 0.200003, 0.019969, 0.001728 },
-	{ -0.016470, -0.024632, 0.048647, 0.789262, -0.525484, -0.317699, 0.522836, 0.846416, -0.101112, 1.000000, 0.746420, 0.612490, 1, 21, 22, 12, 0.862963, 0.123862, 0.008577, 0.004597 },
-	{ -0.017295, -0.026057, 0.048598, 0.864875, -0.427051, -0.263855, 0.424186, 0.902805, -0.070781, 1.000000, 0.741750, 0.612910, 1, 21, 12, 22, 0.909399, 0.068871, 0.017965, 0.003766 },
-	{ -0.018469, -0.030780, 0.052280, 0.891762, -0.388235, -0.232452, 0.384929, 0.920905, -0.061355, 1.000000, 0.728220, 0.603160, 1, 12, 21, 22, 0.861314, 0.095802, 0.041327, 0.001556 },
-	{ -0.018384, -0.027641, 0.047302, 0.879724, -0.397080, -0.261560, 0.392148, 0.916988, -0.073161, 1.000000, 0.735820, 0.617530, 1, 21, 12, 22, 0.939672, 0.034208, 0.023490, 0.002630 },
-	{ -0.019637, -0.028907, 0.045095, 0.879874, -0.379798, -0.285614, 0.374665, 0.924148, -0.074686, 1.000000, 0.730610, 0.624740, 1, 12, 21, 8, 0.957880, 0.025184, 0.015076, 0.001860 },
-	{ -0.019788, -0.032162, 0.049576, 0.895728, -0.374103, -0.240248, 0.372908, 0.926398, -0.052211, 1.000000, 0.722330, 0.611350, 1, 12, 21, 1, 0.884612, 0.097428, 0.017960, 0.000000 },
-	{ -0.021012, -0.033110, 0.046398, 0.925070, -0.308923, -0.220933, 0.317554, 0.948233, 0.003749, 1.000000, 0.717590, 0.621750, 1, 12, 21, 8, 0.897189, 0.094157, 0.006851, 0.001803 },
-	{ -0.021871, -0.033875, 0.043146, 0.966596, -0.189343, -0.172747, 0.198909, 0.979214, 0.039696, 1.000000, 0.714560, 0.631080, 1, 12, 17, 21, 0.908115, 0.085450, 0.004166, 0.002269 },
-	{ -0.020935, -0.029795, 0.042307, 0.909535, -0.303660, -0.283791, 0.310489, 0.950328, -0.021763, 1.000000, 0.726440, 0.634260, 1, 12, 21, 8, 0.965912, 0.024803, 0.005864, 0.003421 },
-	{ -0.021967, -0.030348, 0.039289, 0.954242, -0.174812, -0.242617, 0.183609, 0.982901, 0.013951, 1.000000, 0.723810, 0.643090, 1, 12, 8, 21, 0.970224, 0.019368, 0.008452, 0.001957 },
-	{ -0.016217, -0.020173, 0.042389, 0.630768, -0.604725, -0.486251, 0.591895, 0.780175, -0.202452, 1.000000, 0.759340, 0.630770, 1, 21, 22, 4, 0.829417, 0.143808, 0.022165, 0.004610 },
-	{ -0.016959, -0.021745, 0.043194, 0.768085, -0.496162, -0.404807, 0.491033, 0.862127, -0.124998, 1.000000, 0.753930, 0.628970, 1, 21, 22, 4, 0.902641, 0.086220, 0.008629, 0.002510 },
-	{ -0.017540, -0.016768, 0.037227, 0.649687, -0.500388, -0.572292, 0.521048, 0.841281, -0.144068, 1.000000, 0.767640, 0.646480, 1, 21, 4, 22, 0.868728, 0.090058, 0.023890, 0.017325 },
-	{ -0.018203, -0.019050, 0.038418, 0.735085, -0.444050, -0.512318, 0.442198, 0.886824, -0.134178, 1.000000, 0.760430, 0.643680, 1, 21, 4, 22, 0.931720, 0.050798, 0.011578, 0.005904 },
-	{ -0.017687, -0.023404, 0.043588, 0.847679, -0.410853, -0.335619, 0.406227, 0.909577, -0.087458, 1.000000, 0.748610, 0.628400, 1, 21, 22, 12, 0.946954, 0.047321, 0.003766, 0.001959 },
-	{ -0.018677, -0.021379, 0.039603, 0.802572, -0.381691, -0.458466, 0.389417, 0.917398, -0.082072, 1.000000, 0.753230, 0.640480, 1, 21, 4, 22, 0.965592, 0.027552, 0.004590, 0.002266 },
-	{ -0.019659, -0.012271, 0.031353, 0.700453, -0.419148, -0.577651, 0.507236, 0.861747, -0.010221, 1.000000, 0.778860, 0.668220, 1, 4, 21, 22, 0.863392, 0.084653, 0.045897, 0.006057 },
-	{ -0.020022, -0.016386, 0.033886, 0.739396, -0.401090, -0.540759, 0.436948, 0.896927, -0.067813, 1.000000, 0.766350, 0.659800, 1, 4, 21, 22, 0.934682, 0.038872, 0.024313, 0.002133 },
-	{ -0.021528, -0.015124, 0.030769, 0.808742, -0.338419, -0.481050, 0.405225, 0.913398, 0.038688, 1.000000, 0.768110, 0.669960, 1, 4, 21, 1, 0.918673, 0.072963, 0.008364, 0.000000 },
-	{ -0.021645, -0.019011, 0.033193, 0.839118, -0.297858, -0.455150, 0.342525, 0.939359, 0.016751, 1.000000, 0.756670, 0.662230, 1, 4, 21, 1, 0.960915, 0.034435, 0.004650, 0.000000 },
-	{ -0.020198, -0.019813, 0.036062, 0.789886, -0.352502, -0.501819, 0.370351, 0.926414, -0.067808, 1.000000, 0.756280, 0.652920, 1, 4, 21, 1, 0.971599, 0.015418, 0.012982, 0.000000 },
-	{ -0.022693, -0.018659, 0.030729, 0.911272, -0.221737, -0.347010, 0.251821, 0.966795, 0.043526, 1.000000, 0.756340, 0.669330, 1, 4, 21, 1, 0.936542, 0.062151, 0.001307, 0.000000 },
-	{ -0.022475, -0.014620, 0.028462, 0.900061, -0.255580, -0.352943, 0.300549, 0.950563, 0.078108, 1.000000, 0.768190, 0.677000, 1, 4, 21, 1, 0.884123, 0.113460, 0.002417, 0.000000 },
-	{ -0.021362, -0.011501, 0.028485, 0.800445, -0.341268, -0.492771, 0.422447, 0.904408, 0.059866, 1.000000, 0.778470, 0.677940, 1, 4, 21, 1, 0.856464, 0.129455, 0.014081, 0.000000 },
-	{ -0.020278, -0.008223, 0.027867, 0.744447, -0.357492, -0.563913, 0.448015, 0.893679, 0.024897, 1.000000, 0.788730, 0.680470, 1, 4, 21, 22, 0.789790, 0.170675, 0.035963, 0.003572 },
-	{ -0.021375, -0.008718, 0.026514, 0.810020, -0.324555, -0.488397, 0.404524, 0.912235, 0.064707, 1.000000, 0.785730, 0.684820, 1, 4, 21, 1, 0.801048, 0.184704, 0.014248, 0.000000 },
-	{ -0.022180, -0.011231, 0.026676, 0.894394, -0.265230, -0.360157, 0.321769, 0.940843, 0.106201, 1.000000, 0.777900, 0.683510, 1, 4, 21, 1, 0.825603, 0.170020, 0.004377, 0.000000 },
-	{ -0.021965, -0.009195, 0.025706, 0.884639, -0.272014, -0.378710, 0.330896, 0.938473, 0.098876, 1.000000, 0.783630, 0.687280, 1, 4, 21, 1, 0.786054, 0.207845, 0.006101, 0.000000 },
-	{ -0.021527, -0.022849, 0.035789, 0.865430, -0.264513, -0.425517, 0.293125, 0.956073, 0.001846, 1.000000, 0.745610, 0.654290, 1, 4, 21, 8, 0.981390, 0.013958, 0.003424, 0.001229 },
-	{ -0.020125, -0.022984, 0.038357, 0.825961, -0.328160, -0.458366, 0.332322, 0.940234, -0.074311, 1.000000, 0.746870, 0.645420, 1, 21, 4, 1, 0.985553, 0.008739, 0.005707, 0.000000 },
-	{ -0.021190, -0.026439, 0.038769, 0.889662, -0.270103, -0.368165, 0.282254, 0.959097, -0.021578, 1.000000, 0.735560, 0.645070, 1, 4, 21, 8, 0.986658, 0.005733, 0.004308, 0.003302 },
-	{ -0.019807, -0.025942, 0.041313, 0.857140, -0.356214, -0.372053, 0.348490, 0.932946, -0.090373, 1.000000, 0.738630, 0.636230, 1, 21, 12, 4, 0.981937, 0.010976, 0.004286, 0.002801 },
-	{ -0.022340, -0.026718, 0.036021, 0.938755, -0.156814, -0.306837, 0.169410, 0.985436, 0.014682, 1.000000, 0.733420, 0.653040, 1, 4, 8, 21, 0.980890, 0.010947, 0.006762, 0.001401 },
-	{ -0.022658, -0.022811, 0.033244, 0.924578, -0.177991, -0.336860, 0.197750, 0.979934, 0.024984, 1.000000, 0.744210, 0.661490, 1, 4, 8, 21, 0.968491, 0.027940, 0.002523, 0.001046 },
-	{ -0.018595, -0.024990, 0.043075, 0.862599, -0.384104, -0.329223, 0.383588, 0.920896, -0.069368, 1.000000, 0.742760, 0.630370, 1, 21, 12, 22, 0.969630, 0.024064, 0.004332, 0.001974 },
-	{ -0.019037, -0.023164, 0.040357, 0.831820, -0.359471, -0.422913, 0.362474, 0.928844, -0.076562, 1.000000, 0.747500, 0.638300, 1, 21, 4, 22, 0.980060, 0.016688, 0.002103, 0.001150 },
-	{ -0.023641, -0.022658, 0.030042, 0.950933, -0.139425, -0.276203, 0.144865, 0.989451, -0.000713, 1.000000, 0.743070, 0.671410, 1, 4, 8, 1, 0.941458, 0.053242, 0.005300, 0.000000 },
-	{ -0.023387, -0.026839, 0.032559, 0.956464, -0.102630, -0.273211, 0.103257, 0.994581, -0.012126, 1.000000, 0.731310, 0.663780, 1, 4, 8, 1, 0.965605, 0.020545, 0.013850, 0.000000 },
-	{ -0.024575, -0.022293, 0.026434, 0.953756, -0.153482, -0.258445, 0.160300, 0.987054, 0.005388, 1.000000, 0.742570, 0.682630, 1, 4, 8, 1, 0.882524, 0.104384, 0.013092, 0.000000 },
-	{ -0.024466, -0.026732, 0.028791, 0.952227, -0.111773, -0.284201, 0.114574, 0.993391, -0.006803, 1.000000, 0.729720, 0.675360, 1, 4, 8, 1, 0.923591, 0.047332, 0.029076, 0.000000 },
-	{ -0.025455, -0.021728, 0.022752, 0.942185, -0.200864, -0.268217, 0.208384, 0.978047, -0.000440, 1.000000, 0.742760, 0.694040, 1, 4, 8, 1, 0.765228, 0.205692, 0.029080, 0.000000 },
-	{ -0.025639, -0.026442, 0.024993, 0.938115, -0.154784, -0.309810, 0.160367, 0.987029, -0.007532, 1.000000, 0.728870, 0.687070, 1, 4, 8, 1, 0.827014, 0.112320, 0.060666, 0.000000 },
-	{ -0.026319, -0.020888, 0.018992, 0.919179, -0.253076, -0.301766, 0.259099, 0.965631, -0.020611, 1.000000, 0.743920, 0.705740, 1, 4, 8, 1, 0.583475, 0.387627, 0.028897, 0.000000 },
-	{ -0.027215, -0.019614, 0.015237, 0.890035, -0.289680, -0.352027, 0.292759, 0.955091, -0.045748, 1.000000, 0.746170, 0.717290, 4, 1, 8, 1, 0.611670, 0.372873, 0.015457, 0.000000 },
-	{ -0.028349, -0.018326, 0.011621, 0.853614, -0.308616, -0.419642, 0.315899, 0.947252, -0.054050, 1.000000, 0.748590, 0.728750, 4, 1, 8, 1, 0.795890, 0.197336, 0.006774, 0.000000 },
-	{ -0.025948, -0.015278, 0.014900, 0.909569, -0.255504, -0.327724, 0.265420, 0.964017, -0.014930, 1.000000, 0.760050, 0.717920, 4, 1, 8, 1, 0.676228, 0.322739, 0.001033, 0.000000 },
-	{ -0.025262, -0.016274, 0.018099, 0.934685, -0.245040, -0.257525, 0.253834, 0.967247, 0.000932, 1.000000, 0.758110, 0.708300, 1, 4, 8, 1, 0.516838, 0.480647, 0.002515, 0.000000 },
-	{ -0.026992, -0.014210, 0.011604, 0.881992, -0.261353, -0.392155, 0.263712, 0.963360, -0.048921, 1.000000, 0.762640, 0.728360, 4, 1, 1, 1, 0.833725, 0.166275, 0.000000, 0.000000 },
-	{ -0.028256, -0.013383, 0.008388, 0.869196, -0.287733, -0.402129, 0.261966, 0.957709, -0.119027, 1.000000, 0.764290, 0.738500, 4, 1, 1, 1, 0.932899, 0.067101, 0.000000, 0.000000 },
-	{ -0.024755, -0.017108, 0.021326, 0.950709, -0.219392, -0.219133, 0.228446, 0.973416, 0.016548, 1.000000, 0.756810, 0.698540, 1, 4, 8, 1, 0.698699, 0.297430, 0.003871, 0.000000 },
-	{ -0.023915, -0.012759, 0.020590, 0.960796, -0.194396, -0.197691, 0.208772, 0.976445, 0.054484, 1.000000, 0.769950, 0.701130, 1, 4, 8, 21, 0.646036, 0.350222, 0.001933, 0.001808 },
-	{ -0.023243, -0.008922, 0.020593, 0.965529, -0.131019, -0.224917, 0.158294, 0.981492, 0.107787, 1.000000, 0.781460, 0.702040, 1, 4, 21, 22, 0.611432, 0.377683, 0.005625, 0.005260 },
-	{ -0.022677, -0.005867, 0.021341, 0.951521, -0.070185, -0.299470, 0.123313, 0.978995, 0.162369, 1.000000, 0.790760, 0.701080, 1, 4, 22, 21, 0.587567, 0.378593, 0.019722, 0.014118 },
-	{ -0.021981, -0.003954, 0.022719, 0.912245, -0.028843, -0.408628, 0.128150, 0.967545, 0.217796, 1.000000, 0.796990, 0.698290, 1, 4, 22, 21, 0.583436, 0.328632, 0.058945, 0.028987 },
-	{ -0.021054, -0.002834, 0.024324, 0.844093, 0.021914, -0.535749, 0.142641, 0.953984, 0.263759, 1.000000, 0.801260, 0.694300, 1, 4, 22, 21, 0.556033, 0.258598, 0.135219, 0.050150 },
-	{ -0.024214, -0.017782, 0.024605, 0.955623, -0.191947, -0.223473, 0.202614, 0.978924, 0.025605, 1.000000, 0.756150, 0.688490, 1, 4, 8, 1, 0.824198, 0.172965, 0.002837, 0.000000 },
-	{ -0.023569, -0.013530, 0.023371, 0.958927, -0.200082, -0.201064, 0.216535, 0.974224, 0.063245, 1.000000, 0.768860, 0.692740, 1, 4, 8, 21, 0.760321, 0.236767, 0.001588, 0.001323 },
-	{ -0.022957, -0.009895, 0.022830, 0.960110, -0.182899, -0.211513, 0.209691, 0.971343, 0.111905, 1.000000, 0.779720, 0.695330, 1, 4, 21, 22, 0.719728, 0.273062, 0.004138, 0.003072 },
-	{ -0.022388, -0.007151, 0.022979, 0.943708, -0.175195, -0.280572, 0.220599, 0.965383, 0.139181, 1.000000, 0.788060, 0.696000, 1, 4, 22, 21, 0.693157, 0.282643, 0.013723, 0.010477 },
-	{ -0.021714, -0.005393, 0.023757, 0.895749, -0.177699, -0.407501, 0.257374, 0.954687, 0.149437, 1.000000, 0.793660, 0.694530, 1, 4, 22, 21, 0.673663, 0.259569, 0.044340, 0.022429 },
-	{ -0.020786, -0.004304, 0.025008, 0.833105, -0.164866, -0.527973, 0.288250, 0.944087, 0.160036, 1.000000, 0.797790, 0.691170, 1, 4, 22, 21, 0.635508, 0.217041, 0.105642, 0.041809 },
-	{ -0.023536, -0.018288, 0.027839, 0.946570, -0.185353, -0.263911, 0.199533, 0.979499, 0.027736, 1.000000, 0.756130, 0.678400, 1, 4, 1, 1, 0.896900, 0.103100, 0.000000, 0.000000 },
-	{ -0.023116, -0.014146, 0.026044, 0.944306, -0.211564, -0.252047, 0.235802, 0.969288, 0.069840, 1.000000, 0.768360, 0.684520, 1, 4, 21, 1, 0.834768, 0.164100, 0.001132, 0.000000 },
-	{ -0.022644, -0.010700, 0.024871, 0.943559, -0.212717, -0.253867, 0.248353, 0.961531, 0.117389, 1.000000, 0.778390, 0.689070, 1, 4, 21, 22, 0.787353, 0.207890, 0.003060, 0.001697 },
-	{ -0.022170, -0.008271, 0.024487, 0.921907, -0.230550, -0.311342, 0.279941, 0.951977, 0.123985, 1.000000, 0.785590, 0.691170, 1, 4, 22, 21, 0.756291, 0.228175, 0.008217, 0.007317 },
-	{ -0.021520, -0.006863, 0.024999, 0.857471, -0.268214, -0.439096, 0.346640, 0.931788, 0.107756, 1.000000, 0.790220, 0.690150, 1, 4, 22, 21, 0.740327, 0.215761, 0.027003, 0.016909 },
-	{ -0.020555, -0.005957, 0.026110, 0.794618, -0.281784, -0.537756, 0.383702, 0.919523, 0.085150, 1.000000, 0.793950, 0.686840, 1, 4, 22, 21, 0.707097, 0.190825, 0.066348, 0.035730 },
-	{ -0.019232, -0.005187, 0.027500, 0.732131, -0.277604, -0.622030, 0.407777, 0.910095, 0.073792, 1.000000, 0.797900, 0.682220, 1, 4, 22, 21, 0.637528, 0.159931, 0.136205, 0.066336 },
-	{ -0.019518, -0.003495, 0.026560, 0.768142, -0.140418, -0.624692, 0.311410, 0.934417, 0.172883, 1.000000, 0.801790, 0.686390, 1, 22, 4, 21, 0.565080, 0.200043, 0.165373, 0.069504 },
-	{ -0.019811, -0.002027, 0.026079, 0.767048, 0.069254, -0.637842, 0.163978, 0.939978, 0.299254, 1.000000, 0.805210, 0.689290, 1, 22, 4, 21, 0.494023, 0.245917, 0.182851, 0.077209 },
-	{ -0.018230, -0.001276, 0.027852, 0.667931, 0.094455, -0.738205, 0.228507, 0.917972, 0.324211, 1.000000, 0.809590, 0.683750, 1, 22, 4, 21, 0.404989, 0.374173, 0.113456, 0.107382 },
-	{ -0.016290, -0.000444, 0.029467, 0.540973, 0.086588, -0.836571, 0.327253, 0.894627, 0.304217, 1.000000, 0.814750, 0.678300, 22, 1, 21, 4, 0.499037, 0.308111, 0.134592, 0.058260 },
-	{ -0.017897, -0.002740, 0.028210, 0.686266, -0.119627, -0.717446, 0.348752, 0.919720, 0.180242, 1.000000, 0.806250, 0.680840, 1, 22, 4, 21, 0.468540, 0.318459, 0.109699, 0.103302 },
-	{ -0.015917, -0.001899, 0.029756, 0.580736, -0.119952, -0.805206, 0.408325, 0.898592, 0.160632, 1.000000, 0.811490, 0.675230, 22, 1, 21, 4, 0.443270, 0.358658, 0.136566, 0.061506 },
-	{ -0.013657, -0.000962, 0.031009, 0.451665, -0.157491, -0.878177, 0.526495, 0.841690, 0.119840, 1.000000, 0.818050, 0.669630, 22, 1, 21, 4, 0.563094, 0.250231, 0.159565, 0.027110 },
-	{ -0.011420, -0.000333, 0.031778, 0.297645, -0.262858, -0.917776, 0.658091, 0.752935, -0.002219, 1.000000, 0.822880, 0.665510, 22, 21, 1, 23, 0.668068, 0.165140, 0.148379, 0.018414 },
-	{ -0.008656, -0.000166, 0.032430, 0.166744, -0.426279, -0.889091, 0.731538, 0.658069, -0.178318, 1.000000, 0.828110, 0.659500, 22, 21, 1, 23, 0.794522, 0.154351, 0.036446, 0.014681 },
-	{ -0.005457, -0.000786, 0.033286, 0.027702, -0.602176, -0.797883, 0.737743, 0.550912, -0.390169, 1.000000, 0.832350, 0.650090, 22, 21, 23, 1, 0.853890, 0.133319, 0.009064, 0.003727 },
-	{ -0.002324, -0.002064, 0.034368, -0.063912, -0.733777, -0.676378, 0.710592, 0.442418, -0.547107, 1.000000, 0.835170, 0.638010, 22, 21, 23, 1, 0.883671, 0.111315, 0.005014, 0.000000 },
-	{ 0.000185, -0.003278, 0.035685, -0.052788, -0.834906, -0.547856, 0.705134, 0.357310, -0.612467, 1.000000, 0.836260, 0.627650, 22, 21, 23, 1, 0.901170, 0.095956, 0.002874, 0.000000 },
-	{ 0.003233, -0.003842, 0.036035, -0.142230, -0.954179, -0.263275, 0.646744, 0.111769, -0.754474, 1.000000, 0.841350, 0.617610, 22, 21, 23, 1, 0.947546, 0.049103, 0.003351, 0.000000 },
-	{ 0.004136, -0.003672, 0.034039, -0.269803, -0.950598, -0.153527, 0.607633, -0.044391, -0.792976, 1.000000, 0.847690, 0.619590, 22, 21, 23, 1, 0.965365, 0.021990, 0.012645, 0.000000 },
-	{ 0.006554, -0.004262, 0.035784, -0.092812, -0.995033, -0.035991, 0.641755, -0.032145, -0.766236, 1.000000, 0.848960, 0.609190, 22, 21, 23, 1, 0.967550, 0.025797, 0.006653, 0.000000 },
-	{ 0.005450, -0.003765, 0.031278, -0.331625, -0.933837, -0.134066, 0.569858, -0.085029, -0.817332, 1.000000, 0.856730, 0.621710, 22, 23, 21, 1, 0.949268, 0.042311, 0.008422, 0.000000 },
-	{ 0.007867, -0.004466, 0.032962, -0.133674, -0.991021, -0.003087, 0.606936, -0.079403, -0.790774, 1.000000, 0.857870, 0.611700, 22, 23, 21, 1, 0.962508, 0.028664, 0.008828, 0.000000 },
-	{ 0.005698, -0.004402, 0.037920, 0.028419, -0.984243, -0.174521, 0.671085, 0.148182, -0.726421, 1.000000, 0.842800, 0.606560, 22, 21, 23, 1, 0.936895, 0.061587, 0.001518, 0.000000 },
-	{ 0.009024, -0.004256, 0.037867, 0.094590, -0.994654, 0.041421, 0.673766, 0.033333, -0.738193, 1.000000, 0.850530, 0.598080, 22, 21, 23, 1, 0.955629, 0.041476, 0.002895, 0.000000 },
-	{ 0.008146, -0.004444, 0.040087, 0.215753, -0.970593, -0.106771, 0.673544, 0.227100, -0.703395, 1.000000, 0.844510, 0.595030, 22, 21, 1, 1, 0.905839, 0.094161, 0.000000, 0.000000 },
-	{ 0.010401, -0.004453, 0.034951, 0.066033, -0.993201, 0.095877, 0.641177, -0.031388, -0.766751, 1.000000, 0.859230, 0.601150, 22, 23, 21, 1, 0.967971, 0.017445, 0.014584, 0.000000 },
-	{ 0.011350, -0.003681, 0.040001, 0.301335, -0.946741, 0.113486, 0.683433, 0.131451, -0.718081, 1.000000, 0.852360, 0.587180, 22, 21, 23, 1, 0.930364, 0.068361, 0.001275, 0.000000 },
-	{ 0.012795, -0.003775, 0.036931, 0.277138, -0.944937, 0.174037, 0.655565, 0.053539, -0.753238, 1.000000, 0.860910, 0.590780, 22, 21, 23, 1, 0.962566, 0.026195, 0.011239, 0.000000 },
-	{ 0.010425, -0.003888, 0.042325, 0.414426, -0.909890, -0.018761, 0.657398, 0.313552, -0.685210, 1.000000, 0.846430, 0.583830, 22, 21, 1, 1, 0.857256, 0.142744, 0.000000, 0.000000 },
-	{ 0.013332, -0.002485, 0.041965, 0.533370, -0.821303, 0.202431, 0.655972, 0.250511, -0.712000, 1.000000, 0.854490, 0.577060, 22, 21, 1, 1, 0.898535, 0.101465, 0.000000, 0.000000 },
-	{ 0.014790, -0.002520, 0.038721, 0.523497, -0.813972, 0.251795, 0.629149, 0.170005, -0.758466, 1.000000, 0.862830, 0.581320, 22, 21, 23, 1, 0.951044, 0.042103, 0.006854, 0.000000 },
-	{ 0.014838, -0.000652, 0.043613, 0.771948, -0.558837, 0.302982, 0.564614, 0.383764, -0.730709, 1.000000, 0.857090, 0.567930, 22, 21, 1, 1, 0.866582, 0.133418, 0.000000, 0.000000 },
-	{ 0.016223, -0.000655, 0.040279, 0.773246, -0.545653, 0.323036, 0.537909, 0.294686, -0.789819, 1.000000, 0.864690, 0.572440, 22, 21, 23, 1, 0.938753, 0.058661, 0.002587, 0.000000 },
-	{ 0.015572, 0.001938, 0.044772, 0.908171, -0.212000, 0.360944, 0.418573, 0.469401, -0.777470, 1.000000, 0.860540, 0.559630, 22, 21, 1, 1, 0.840401, 0.159599, 0.000000, 0.000000 },
-	{ 0.016882, 0.001903, 0.041439, 0.915603, -0.194512, 0.351905, 0.400624, 0.366818, -0.839610, 1.000000, 0.867200, 0.564180, 22, 21, 1, 1, 0.926979, 0.073021, 0.000000, 0.000000 },
-	{ 0.012372, -0.002683, 0.044399, 0.619369, -0.778430, 0.102122, 0.618979, 0.404149, -0.673446, 1.000000, 0.848790, 0.573320, 22, 21, 1, 1, 0.802598, 0.197402, 0.000000, 0.000000 },
-	{ 0.013810, -0.000800, 0.046085, 0.814452, -0.527045, 0.242678, 0.529687, 0.504620, -0.681756, 1.000000, 0.851880, 0.564090, 22, 21, 1, 1, 0.752940, 0.247060, 0.000000, 0.000000 },
-	{ 0.014545, 0.001842, 0.047251, 0.918852, -0.203815, 0.337891, 0.391979, 0.570010, -0.722109, 1.000000, 0.856040, 0.555680, 22, 21, 1, 1, 0.714131, 0.285869, 0.000000, 0.000000 },
-	{ 0.014529, 0.005227, 0.047909, 0.929915, 0.050351, 0.364311, 0.272419, 0.571181, -0.774300, 1.000000, 0.861950, 0.546890, 22, 21, 1, 1, 0.686550, 0.313450, 0.000000, 0.000000 },
-	{ 0.015523, 0.005252, 0.045494, 0.930481, 0.054068, 0.362329, 0.293924, 0.480170, -0.826466, 1.000000, 0.865640, 0.550570, 22, 21, 1, 1, 0.820384, 0.179616, 0.000000, 0.000000 },
-	{ 0.016730, 0.005128, 0.042292, 0.938196, 0.067982, 0.339362, 0.290528, 0.378202, -0.878952, 1.000000, 0.870830, 0.554790, 22, 21, 1, 1, 0.915031, 0.084969, 0.000000, 0.000000 },
-	{ 0.018517, 0.001851, 0.037074, 0.919077, -0.163453, 0.358581, 0.390906, 0.262919, -0.882081, 1.000000, 0.877170, 0.568700, 22, 21, 23, 1, 0.957991, 0.026325, 0.015684, 0.000000 },
-	{ 0.018236, 0.004916, 0.037969, 0.936820, 0.081432, 0.340201, 0.307033, 0.274614, -0.911218, 1.000000, 0.879200, 0.559410, 22, 21, 23, 1, 0.960474, 0.031801, 0.007725, 0.000000 },
-	{ 0.020399, 0.001780, 0.032359, 0.908208, -0.136438, 0.395656, 0.414621, 0.164586, -0.894986, 1.000000, 0.889160, 0.572170, 22, 23, 21, 1, 0.883496, 0.109303, 0.007201, 0.000000 },
-	{ 0.017969, -0.000655, 0.036034, 0.792291, -0.504820, 0.342684, 0.498535, 0.211809, -0.840595, 1.000000, 0.875370, 0.576890, 22, 23, 21, 1, 0.948161, 0.031611, 0.020229, 0.000000 },
-	{ 0.019897, -0.000682, 0.031672, 0.800312, -0.466702, 0.376419, 0.483916, 0.132093, -0.865088, 1.000000, 0.887380, 0.579910, 22, 23, 21, 1, 0.853116, 0.141618, 0.005266, 0.000000 },
-	{ 0.016648, -0.002617, 0.034773, 0.552097, -0.787281, 0.274551, 0.572151, 0.118206, -0.811585, 1.000000, 0.873720, 0.585130, 22, 23, 21, 1, 0.939081, 0.047346, 0.013572, 0.000000 },
-	{ 0.018587, -0.002646, 0.030837, 0.574198, -0.764978, 0.291729, 0.534753, 0.080611, -0.841155, 1.000000, 0.885050, 0.587300, 22, 23, 21, 1, 0.819388, 0.177346, 0.003266, 0.000000 },
-	{ 0.014637, -0.003954, 0.033298, 0.300991, -0.936093, 0.182029, 0.597368, 0.036289, -0.801146, 1.000000, 0.871640, 0.593780, 22, 23, 21, 1, 0.933467, 0.058822, 0.007710, 0.000000 },
-	{ 0.016557, -0.003996, 0.029661, 0.323053, -0.929583, 0.177519, 0.558042, 0.035613, -0.829048, 1.000000, 0.882700, 0.595410, 22, 23, 21, 1, 0.817692, 0.180629, 0.001679, 0.000000 },
-	{ 0.012156, -0.004694, 0.031582, 0.085552, -0.992683, 0.085209, 0.593656, -0.017894, -0.804520, 1.000000, 0.869560, 0.603520, 22, 23, 21, 1, 0.925082, 0.070964, 0.003954, 0.000000 },
-	{ 0.014022, -0.004752, 0.028143, 0.103508, -0.992416, 0.066310, 0.566735, 0.004061, -0.823890, 1.000000, 0.880420, 0.604870, 22, 23, 1, 1, 0.825243, 0.174757, 0.000000, 0.000000 },
-	{ 0.009520, -0.004697, 0.029762, -0.129027, -0.991259, -0.027518, 0.581688, -0.053183, -0.811672, 1.000000, 0.867960, 0.613450, 22, 23, 21, 1, 0.908374, 0.089199, 0.002427, 0.000000 },
-	{ 0.011284, -0.004751, 0.026447, -0.116617, -0.992019, -0.047945, 0.577847, -0.028508, -0.815647, 1.000000, 0.878630, 0.615050, 22, 23, 1, 1, 0.784181, 0.215819, 0.000000, 0.000000 },
-	{ 0.007028, -0.003888, 0.028121, -0.348532, -0.924901, -0.151936, 0.560144, -0.075565, -0.824942, 1.000000, 0.866650, 0.623300, 22, 23, 21, 1, 0.889830, 0.107559, 0.002611, 0.000000 },
-	{ 0.008682, -0.003945, 0.024853, -0.344464, -0.925008, -0.160327, 0.574021, -0.072391, -0.815634, 1.000000, 0.877270, 0.625100, 22, 23, 1, 1, 0.760399, 0.239601, 0.000000, 0.000000 },
-	{ 0.020091, 0.004738, 0.033007, 0.920724, 0.084492, 0.380957, 0.362345, 0.177205, -0.915044, 1.000000, 0.890760, 0.563150, 22, 23, 21, 1, 0.915252, 0.075692, 0.009056, 0.000000 },
-	{ 0.012984, -0.004781, 0.023430, -0.123739, -0.992114, -0.019987, 0.575505, -0.055341, -0.815924, 1.000000, 0.888670, 0.616200, 22, 23, 1, 1, 0.595580, 0.404420, 0.000000, 0.000000 },
-	{ 0.010316, -0.004032, 0.021875, -0.344544, -0.929636, -0.130637, 0.580466, -0.101600, -0.807921, 1.000000, 0.887250, 0.626760, 22, 23, 1, 1, 0.562587, 0.437413, 0.000000, 0.000000 },
-	{ 0.014413, -0.005016, 0.021083, -0.174535, -0.981414, 0.079782, 0.556442, -0.165155, -0.814307, 1.000000, 0.896740, 0.616760, 23, 22, 1, 1, 0.582623, 0.417378, 0.000000, 0.000000 },
-	{ 0.011706, -0.004301, 0.019468, -0.376023, -0.925423, -0.046906, 0.553227, -0.183606, -0.812545, 1.000000, 0.895630, 0.627660, 23, 22, 1, 1, 0.598518, 0.401482, 0.000000, 0.000000 },
-	{ 0.015746, -0.004759, 0.025029, 0.091563, -0.991506, 0.092367, 0.558919, -0.025597, -0.828827, 1.000000, 0.890720, 0.605850, 22, 23, 1, 1, 0.644644, 0.355356, 0.000000, 0.000000 },
-	{ 0.017175, -0.004966, 0.022679, 0.032733, -0.978362, 0.204296, 0.560875, -0.151205, -0.813976, 1.000000, 0.898620, 0.606320, 23, 22, 1, 1, 0.536686, 0.463314, 0.000000, 0.000000 },
-	{ 0.019646, -0.004223, 0.023971, 0.270507, -0.908154, 0.319502, 0.564726, -0.119094, -0.816640, 1.000000, 0.901090, 0.597230, 23, 22, 1, 1, 0.520821, 0.479179, 0.000000, 0.000000 },
-	{ 0.018261, -0.004021, 0.026424, 0.316362, -0.925960, 0.206187, 0.545904, -0.000054, -0.837848, 1.000000, 0.893040, 0.596510, 22, 23, 1, 1, 0.653677, 0.346323, 0.000000, 0.000000 },
-	{ 0.021637, -0.002910, 0.024816, 0.540499, -0.732908, 0.413167, 0.553001, -0.060626, -0.830972, 1.000000, 0.903860, 0.589540, 23, 22, 1, 1, 0.527749, 0.472251, 0.000000, 0.000000 },
-	{ 0.020288, -0.002701, 0.027425, 0.569586, -0.755315, 0.324147, 0.523950, 0.029804, -0.851228, 1.000000, 0.895560, 0.588560, 22, 23, 1, 1, 0.640581, 0.359419, 0.000000, 0.000000 },
-	{ 0.023024, -0.001129, 0.025223, 0.771163, -0.437396, 0.462593, 0.517208, 0.006744, -0.855833, 1.000000, 0.906620, 0.582890, 23, 22, 1, 1, 0.577777, 0.422223, 0.000000, 0.000000 },
-	{ 0.021649, -0.000848, 0.028004, 0.790455, -0.451372, 0.414059, 0.492224, 0.065767, -0.867981, 1.000000, 0.898160, 0.581620, 22, 23, 1, 1, 0.652875, 0.347125, 0.000000, 0.000000 },
-	{ 0.023745, 0.001108, 0.025317, 0.877418, -0.131686, 0.461298, 0.468997, 0.033235, -0.882574, 1.000000, 0.909230, 0.576590, 23, 22, 1, 1, 0.538713, 0.461287, 0.000000, 0.000000 },
-	{ 0.022242, 0.001499, 0.028340, 0.889430, -0.128486, 0.438642, 0.451488, 0.097414, -0.886944, 1.000000, 0.900280, 0.574780, 22, 23, 21, 1, 0.690390, 0.308177, 0.001434, 0.000000 },
-	{ 0.022117, 0.004439, 0.028609, 0.898919, 0.072178, 0.432128, 0.424435, 0.101081, -0.899799, 1.000000, 0.902380, 0.565860, 22, 23, 21, 1, 0.725284, 0.272842, 0.001874, 0.000000 },
-	{ 0.023843, 0.003991, 0.025276, 0.892149, 0.054244, 0.448473, 0.446805, 0.040406, -0.893719, 1.000000, 0.911960, 0.567970, 23, 22, 1, 1, 0.532530, 0.467470, 0.000000, 0.000000 },
-	{ 0.020867, -0.004773, 0.022175, 0.205240, -0.853835, 0.478375, 0.603706, -0.274269, -0.748543, 1.000000, 0.907220, 0.597590, 23, 22, 1, 1, 0.683411, 0.316589, 0.000000, 0.000000 },
-	{ 0.022798, -0.003407, 0.022887, 0.507887, -0.668775, 0.542946, 0.612945, -0.162298, -0.773277, 1.000000, 0.910090, 0.590440, 23, 22, 1, 1, 0.698670, 0.301330, 0.000000, 0.000000 },
-	{ 0.024012, -0.004255, 0.020981, 0.531919, -0.620781, 0.575928, 0.627525, -0.167692, -0.760324, 1.000000, 0.916620, 0.591910, 23, 22, 1, 1, 0.819002, 0.180998, 0.000000, 0.000000 },
-	{ 0.025201, -0.002344, 0.021138, 0.771493, -0.338048, 0.539002, 0.554012, -0.059623, -0.830371, 1.000000, 0.919140, 0.585990, 23, 22, 1, 1, 0.819457, 0.180543, 0.000000, 0.000000 },
-	{ 0.024115, -0.001597, 0.023127, 0.755255, -0.392656, 0.524797, 0.552400, -0.049613, -0.832101, 1.000000, 0.913010, 0.584220, 23, 22, 1, 1, 0.730055, 0.269945, 0.000000, 0.000000 },
-	{ 0.025865, -0.000017, 0.021004, 0.882543, -0.098164, 0.459871, 0.459505, -0.027659, -0.887744, 1.000000, 0.922020, 0.579500, 23, 22, 1, 1, 0.872810, 0.127190, 0.000000, 0.000000 },
-	{ 0.024860, 0.000631, 0.023065, 0.875670, -0.124213, 0.466662, 0.467873, -0.021054, -0.883545, 1.000000, 0.915870, 0.577960, 23, 22, 1, 1, 0.746260, 0.253740, 0.000000, 0.000000 },
-	{ 0.022173, -0.005706, 0.020325, 0.210740, -0.833438, 0.510853, 0.626194, -0.286196, -0.725240, 1.000000, 0.914130, 0.598440, 23, 22, 1, 1, 0.816252, 0.183748, 0.000000, 0.000000 },
-	{ 0.018397, -0.005544, 0.020934, -0.054309, -0.932639, 0.356702, 0.560515, -0.324111, -0.762086, 1.000000, 0.904600, 0.606370, 23, 22, 1, 1, 0.689619, 0.310381, 0.000000, 0.000000 },
-	{ 0.019726, -0.006526, 0.019058, -0.069006, -0.921300, 0.382680, 0.576557, -0.349876, -0.738356, 1.000000, 0.911890, 0.606670, 23, 22, 1, 1, 0.829292, 0.170708, 0.000000, 0.000000 },
-	{ 0.016853, -0.006551, 0.017327, -0.281097, -0.927802, 0.245293, 0.529537, -0.363119, -0.766639, 1.000000, 0.910110, 0.616980, 23, 22, 1, 1, 0.880427, 0.119573, 0.000000, 0.000000 },
-	{ 0.015583, -0.005571, 0.019295, -0.257573, -0.941243, 0.218446, 0.525181, -0.326137, -0.786015, 1.000000, 0.902620, 0.616870, 23, 22, 1, 1, 0.743026, 0.256974, 0.000000, 0.000000 },
-	{ 0.012801, -0.004806, 0.017571, -0.438410, -0.895240, 0.079638, 0.504481, -0.318444, -0.802554, 1.000000, 0.901790, 0.628120, 23, 22, 1, 1, 0.769096, 0.230904, 0.000000, 0.000000 },
-	{ 0.013938, -0.005715, 0.015504, -0.458159, -0.881855, 0.111455, 0.495021, -0.357284, -0.792024, 1.000000, 0.909220, 0.628500, 23, 22, 1, 1, 0.903005, 0.096995, 0.000000, 0.000000 },
-	{ 0.025050, 0.003445, 0.022851, 0.907432, 0.047244, 0.417534, 0.417614, 0.008649, -0.908584, 1.000000, 0.918870, 0.569750, 23, 22, 1, 1, 0.762105, 0.237895, 0.000000, 0.000000 },
-	{ 0.026011, 0.002751, 0.020719, 0.925001, 0.074421, 0.372604, 0.373178, 0.006557, -0.927737, 1.000000, 0.924930, 0.571870, 23, 22, 1, 1, 0.912763, 0.087237, 0.000000, 0.000000 },
-	{ 0.011496, -0.004188, 0.014065, -0.635805, -0.771071, -0.034665, 0.452341, -0.335845, -0.826194, 1.000000, 0.908750, 0.638450, 23, 22, 1, 1, 0.885005, 0.114995, 0.000000, 0.000000 },
-	{ 0.010468, -0.003366, 0.016146, -0.622985, -0.779572, -0.064471, 0.472796, -0.309602, -0.824992, 1.000000, 0.901630, 0.638170, 23, 22, 1, 1, 0.740095, 0.259905, 0.000000, 0.000000 },
-	{ 0.009704, -0.002132, 0.013106, -0.802466, -0.567680, -0.183814, 0.417706, -0.314448, -0.852434, 1.000000, 0.908230, 0.646980, 23, 22, 1, 1, 0.859272, 0.140728, 0.000000, 0.000000 },
-	{ 0.008771, -0.001418, 0.015151, -0.800324, -0.559678, -0.215041, 0.438443, -0.301672, -0.846618, 1.000000, 0.901580, 0.646740, 23, 22, 1, 1, 0.739737, 0.260263, 0.000000, 0.000000 },
-	{ 0.007890, 0.000915, 0.014565, -0.914172, -0.197800, -0.353785, 0.399419, -0.291146, -0.869310, 1.000000, 0.901710, 0.654330, 23, 22, 1, 1, 0.771274, 0.228726, 0.000000, 0.000000 },
-	{ 0.008716, 0.000275, 0.012536, -0.919905, -0.227820, -0.319175, 0.378938, -0.307008, -0.873014, 1.000000, 0.908070, 0.654560, 23, 22, 1, 1, 0.871721, 0.128279, 0.000000, 0.000000 },
-	{ 0.008755, 0.002836, 0.012402, -0.893847, 0.195944, -0.403290, 0.342224, -0.282985, -0.895992, 1.000000, 0.908120, 0.661520, 23, 22, 1, 1, 0.888761, 0.111239, 0.000000, 0.000000 },
-	{ 0.007996, 0.003426, 0.014434, -0.876098, 0.226791, -0.425462, 0.363936, -0.267728, -0.892117, 1.000000, 0.902060, 0.661390, 23, 22, 1, 1, 0.776414, 0.223586, 0.000000, 0.000000 },
-	{ 0.009788, 0.005383, 0.012690, -0.764773, 0.489471, -0.418976, 0.331078, -0.259313, -0.907273, 1.000000, 0.908450, 0.669260, 23, 22, 1, 1, 0.896842, 0.103158, 0.000000, 0.000000 },
-	{ 0.009035, 0.005961, 0.014782, -0.752907, 0.504808, -0.422255, 0.354687, -0.229212, -0.906454, 1.000000, 0.902470, 0.669300, 23, 22, 1, 1, 0.777421, 0.222579, 0.000000, 0.000000 },
-	{ 0.009784, 0.002002, 0.009752, -0.887179, 0.142040, -0.439020, 0.393112, -0.265529, -0.880317, 1.000000, 0.916540, 0.661560, 23, 22, 1, 1, 0.954388, 0.045612, 0.000000, 0.000000 },
-	{ 0.010709, 0.004600, 0.010082, -0.772862, 0.457865, -0.439369, 0.355828, -0.260600, -0.897482, 1.000000, 0.916490, 0.669240, 23, 22, 1, 1, 0.961571, 0.038429, 0.000000, 0.000000 },
-	{ 0.012247, 0.003579, 0.006436, -0.782642, 0.398181, -0.478460, 0.443012, -0.183660, -0.877502, 1.000000, 0.929300, 0.669060, 23, 22, 1, 1, 0.989094, 0.010906, 0.000000, 0.000000 },
-	{ 0.011549, 0.000930, 0.006128, -0.868903, 0.065320, -0.490653, 0.473607, -0.178433, -0.862472, 1.000000, 0.929310, 0.661420, 23, 22, 1, 1, 0.987930, 0.012070, 0.000000, 0.000000 },
-	{ 0.009888, -0.000602, 0.009885, -0.887498, -0.283857, -0.363005, 0.437728, -0.273111, -0.856624, 1.000000, 0.916680, 0.654760, 23, 22, 1, 1, 0.949936, 0.050064, 0.000000, 0.000000 },
-	{ 0.011883, -0.001638, 0.006331, -0.839179, -0.346404, -0.419266, 0.497718, -0.178425, -0.848788, 1.000000, 0.929340, 0.654810, 23, 22, 1, 1, 0.988224, 0.011776, 0.000000, 0.000000 },
-	{ 0.011047, -0.003034, 0.010492, -0.767449, -0.593394, -0.242703, 0.477244, -0.275993, -0.834306, 1.000000, 0.916900, 0.647140, 23, 22, 1, 1, 0.953229, 0.046771, 0.000000, 0.000000 },
-	{ 0.013157, -0.003978, 0.006989, -0.718521, -0.620610, -0.313958, 0.520412, -0.180266, -0.834671, 1.000000, 0.929570, 0.647340, 23, 22, 1, 1, 0.989860, 0.010140, 0.000000, 0.000000 },
-	{ 0.015732, -0.004547, 0.002928, -0.650197, -0.643660, -0.403665, 0.543559, -0.022871, -0.839060, 1.000000, 0.944180, 0.647340, 23, 22, 1, 1, 0.998784, 0.001216, 0.000000, 0.000000 },
-	{ 0.014510, -0.002449, 0.002245, -0.777220, -0.397425, -0.487834, 0.537935, -0.017474, -0.842805, 1.000000, 0.944380, 0.654000, 23, 22, 1, 1, 0.998465, 0.001535, 0.000000, 0.000000 },
-	{ 0.014077, -0.000035, 0.001916, -0.837812, -0.018189, -0.545655, 0.545913, -0.015069, -0.837706, 1.000000, 0.944890, 0.660260, 23, 22, 1, 1, 0.998386, 0.001614, 0.000000, 0.000000 },
-	{ 0.012906, -0.005166, 0.011443, -0.611479, -0.783937, -0.107411, 0.502246, -0.279643, -0.818260, 1.000000, 0.917600, 0.638700, 23, 22, 1, 1, 0.966436, 0.033564, 0.000000, 0.000000 },
-	{ 0.014950, -0.006031, 0.007936, -0.571551, -0.795372, -0.201774, 0.540662, -0.180053, -0.821745, 1.000000, 0.929960, 0.639350, 23, 22, 1, 1, 0.992912, 0.007088, 0.000000, 0.000000 },
-	{ 0.017380, -0.006374, 0.003837, -0.506831, -0.799668, -0.321953, 0.557702, -0.019383, -0.829815, 1.000000, 0.943950, 0.640260, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.014561, 0.002551, 0.002024, -0.790248, 0.315559, -0.525291, 0.548525, -0.017879, -0.835943, 1.000000, 0.946050, 0.667660, 23, 22, 1, 1, 0.998474, 0.001526, 0.000000, 0.000000 },
-	{ 0.018444, -0.004345, -0.000823, -0.557905, -0.653291, -0.511814, 0.553657, 0.166425, -0.815945, 1.000000, 0.957390, 0.646760, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.020004, -0.005842, -0.000162, -0.413051, -0.790539, -0.452147, 0.556342, 0.174037, -0.812524, 1.000000, 0.957830, 0.640710, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.017318, -0.002605, -0.001400, -0.691522, -0.431835, -0.579065, 0.566549, 0.173077, -0.805646, 1.000000, 0.957620, 0.652390, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.016889, -0.000513, -0.001900, -0.778067, -0.103975, -0.619516, 0.595806, 0.190373, -0.780240, 1.000000, 0.959340, 0.657960, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.017224, 0.001827, -0.002152, -0.776909, 0.208854, -0.593964, 0.628935, 0.213676, -0.747518, 1.000000, 0.962460, 0.664050, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.019564, -0.000598, -0.004661, -0.686643, -0.189528, -0.701855, 0.606194, 0.383661, -0.696659, 1.000000, 0.970830, 0.654560, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.019754, 0.001379, -0.005175, -0.721476, 0.064384, -0.689440, 0.644728, 0.425653, -0.634937, 1.000000, 0.974790, 0.659100, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.021776, 0.001130, -0.006873, -0.562578, -0.114959, -0.818713, 0.629960, 0.581707, -0.514557, 1.000000, 0.982290, 0.654460, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.021666, -0.000616, -0.006273, -0.530691, -0.285977, -0.797862, 0.605665, 0.530562, -0.593021, 1.000000, 0.978270, 0.650820, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.023396, 0.001116, -0.007705, -0.334817, -0.139628, -0.931881, 0.637531, 0.694672, -0.333145, 1.000000, 0.987140, 0.650790, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.023322, -0.000816, -0.007012, -0.319709, -0.399427, -0.859212, 0.596601, 0.619619, -0.510039, 1.000000, 0.982570, 0.646960, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.021492, -0.001904, -0.005565, -0.495041, -0.450916, -0.742704, 0.588484, 0.454874, -0.668414, 1.000000, 0.974980, 0.648260, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.022567, -0.002498, -0.005719, -0.342473, -0.574361, -0.743520, 0.574435, 0.498221, -0.649461, 1.000000, 0.976450, 0.645070, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.024937, -0.001113, -0.007339, -0.123362, -0.478399, -0.869435, 0.563468, 0.687427, -0.458200, 1.000000, 0.985680, 0.642840, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.024055, -0.003174, -0.005715, -0.176776, -0.660851, -0.729401, 0.555203, 0.544963, -0.628304, 1.000000, 0.978200, 0.640740, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.024992, 0.001121, -0.008181, -0.135803, -0.110156, -0.984593, 0.598706, 0.782689, -0.170145, 1.000000, 0.990900, 0.646910, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.022375, -0.004753, -0.003428, -0.300859, -0.758941, -0.577488, 0.546454, 0.359084, -0.756602, 1.000000, 0.969550, 0.640420, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.020901, -0.003630, -0.003743, -0.456072, -0.646393, -0.611698, 0.547377, 0.338206, -0.765503, 1.000000, 0.968540, 0.645410, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.019896, -0.002301, -0.004087, -0.597112, -0.452130, -0.662597, 0.567427, 0.345788, -0.747300, 1.000000, 0.968560, 0.650100, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.024223, -0.005688, -0.002850, -0.121266, -0.838730, -0.530874, 0.543872, 0.391253, -0.742378, 1.000000, 0.970670, 0.634680, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.021942, -0.007099, 0.000751, -0.243736, -0.890871, -0.383331, 0.561531, 0.192631, -0.804721, 1.000000, 0.958320, 0.634170, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.026396, -0.006363, -0.001882, 0.067057, -0.880931, -0.468470, 0.540980, 0.426621, -0.724800, 1.000000, 0.971770, 0.627850, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.027974, -0.004115, -0.004621, 0.188628, -0.750013, -0.633956, 0.494570, 0.630255, -0.598481, 1.000000, 0.981630, 0.629010, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.028591, -0.006556, -0.000576, 0.267836, -0.888276, -0.373135, 0.525246, 0.459292, -0.716357, 1.000000, 0.972410, 0.620850, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.030063, -0.004244, -0.003463, 0.349924, -0.762984, -0.543515, 0.462642, 0.645257, -0.607952, 1.000000, 0.982780, 0.622080, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.030962, -0.001817, -0.005623, 0.410049, -0.581351, -0.702774, 0.423823, 0.803740, -0.417584, 1.000000, 0.992120, 0.624320, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.028888, -0.001587, -0.006688, 0.251873, -0.559462, -0.789659, 0.469708, 0.784084, -0.405692, 1.000000, 0.990900, 0.631510, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.025872, -0.003740, -0.005382, 0.013452, -0.720154, -0.693684, 0.531852, 0.592623, -0.604923, 1.000000, 0.979940, 0.635500, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.026783, -0.001372, -0.007260, 0.080232, -0.528943, -0.844856, 0.520463, 0.745102, -0.417064, 1.000000, 0.988470, 0.637910, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.031809, -0.004148, -0.002043, 0.505441, -0.752266, -0.422642, 0.447086, 0.647259, -0.617390, 1.000000, 0.982980, 0.615570, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.032617, -0.002056, -0.004113, 0.583668, -0.584169, -0.563984, 0.374801, 0.809971, -0.451078, 1.000000, 0.991300, 0.617490, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.032966, -0.003867, -0.000652, 0.673890, -0.687694, -0.270091, 0.418002, 0.656306, -0.628122, 1.000000, 0.982350, 0.610480, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033616, -0.002201, -0.002356, 0.788390, -0.512162, -0.340780, 0.312612, 0.810645, -0.495104, 1.000000, 0.989170, 0.611800, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033892, -0.002319, -0.000405, 0.968303, -0.248765, 0.022502, 0.218456, 0.799745, -0.559182, 1.000000, 0.985800, 0.606940, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033450, -0.003503, 0.000368, 0.881848, -0.470073, -0.037091, 0.345513, 0.697694, -0.627570, 1.000000, 0.981550, 0.607290, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.034263, -0.000786, -0.001209, 0.993574, -0.098351, 0.056008, 0.113174, 0.868398, -0.482780, 1.000000, 0.991150, 0.606640, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.034063, -0.000464, -0.003305, 0.896894, -0.208314, -0.390110, 0.086416, 0.947661, -0.307362, 1.000000, 0.995070, 0.612190, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033019, 0.000029, -0.005227, 0.723712, -0.170017, -0.668832, 0.122881, 0.985437, -0.117534, 1.000000, 0.997770, 0.619000, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.031228, 0.000537, -0.006792, 0.517430, -0.133314, -0.845277, 0.239429, 0.970892, -0.006560, 1.000000, 0.998620, 0.626990, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.029032, 0.000900, -0.007831, 0.310993, -0.110944, -0.943915, 0.381544, 0.924193, 0.017082, 1.000000, 0.997320, 0.635180, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.026860, 0.001071, -0.008280, 0.094313, -0.103363, -0.990162, 0.518540, 0.854128, -0.039772, 1.000000, 0.994410, 0.642000, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033626, -0.000867, 0.001509, 0.952719, 0.124136, 0.277339, 0.090602, 0.755163, -0.649246, 1.000000, 0.985070, 0.599910, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033511, -0.002628, 0.002202, 0.970795, -0.059385, 0.232443, 0.206461, 0.700264, -0.683377, 1.000000, 0.979600, 0.601850, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.033078, -0.004196, 0.002448, 0.887377, -0.445368, 0.119202, 0.393392, 0.596595, -0.699512, 1.000000, 0.975900, 0.604370, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.032108, -0.005359, 0.001936, 0.648693, -0.756074, -0.086886, 0.493375, 0.504712, -0.708412, 1.000000, 0.974080, 0.608150, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.030568, -0.006165, 0.000822, 0.458959, -0.853711, -0.246039, 0.510019, 0.479916, -0.713836, 1.000000, 0.973210, 0.613870, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.026744, -0.008303, 0.003445, 0.178499, -0.966724, -0.183254, 0.580416, 0.253843, -0.773745, 1.000000, 0.959560, 0.618090, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.024291, -0.008005, 0.002026, -0.053506, -0.952669, -0.299263, 0.575283, 0.215553, -0.789042, 1.000000, 0.958800, 0.626080, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.024840, -0.008982, 0.008069, 0.100957, -0.994663, 0.021284, 0.609806, 0.044963, -0.791274, 1.000000, 0.946440, 0.614670, 23, 22, 1, 1, 0.998547, 0.001453, 0.000000, 0.000000 },
-	{ 0.028973, -0.007729, 0.004778, 0.420041, -0.906570, -0.041199, 0.565781, 0.297098, -0.769172, 1.000000, 0.960700, 0.610950, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.027215, -0.008224, 0.009425, 0.373351, -0.914972, 0.153088, 0.600800, 0.112740, -0.791410, 1.000000, 0.947750, 0.607030, 23, 22, 1, 1, 0.997923, 0.002077, 0.000000, 0.000000 },
-	{ 0.022913, -0.008505, 0.012874, 0.041570, -0.983118, 0.178189, 0.611505, -0.116005, -0.782691, 1.000000, 0.931540, 0.610370, 23, 22, 1, 1, 0.990539, 0.009461, 0.000000, 0.000000 },
-	{ 0.020096, -0.008467, 0.011085, -0.201757, -0.977981, 0.053354, 0.587221, -0.164382, -0.792559, 1.000000, 0.930790, 0.620000, 23, 22, 1, 1, 0.993907, 0.006093, 0.000000, 0.000000 },
-	{ 0.021196, -0.007601, 0.016557, -0.017645, -0.955599, 0.294143, 0.599980, -0.245455, -0.761430, 1.000000, 0.920260, 0.607820, 23, 22, 1, 1, 0.946652, 0.053348, 0.000000, 0.000000 },
-	{ 0.018308, -0.007608, 0.014753, -0.246133, -0.955381, 0.163297, 0.559946, -0.277682, -0.780611, 1.000000, 0.918870, 0.617840, 23, 22, 1, 1, 0.971391, 0.028609, 0.000000, 0.000000 },
-	{ 0.017278, -0.007548, 0.009281, -0.395321, -0.915725, -0.071897, 0.560807, -0.178627, -0.808448, 1.000000, 0.930510, 0.630730, 23, 22, 1, 1, 0.996172, 0.003827, 0.000000, 0.000000 },
-	{ 0.015369, -0.006722, 0.012877, -0.431019, -0.901636, 0.035718, 0.529045, -0.284575, -0.799455, 1.000000, 0.918020, 0.629140, 23, 22, 1, 1, 0.973044, 0.026956, 0.000000, 0.000000 },
-	{ 0.022112, -0.008864, 0.006514, -0.144152, -0.983613, -0.108289, 0.592262, 0.001909, -0.805743, 1.000000, 0.944920, 0.623370, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.019499, -0.007839, 0.005011, -0.337253, -0.914866, -0.221991, 0.572544, -0.012142, -0.819784, 1.000000, 0.944230, 0.632620, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.025322, -0.007688, 0.014222, 0.328857, -0.895584, 0.299640, 0.616035, -0.037052, -0.786847, 1.000000, 0.933050, 0.602680, 23, 22, 1, 1, 0.985347, 0.014653, 0.000000, 0.000000 },
-	{ 0.023627, -0.006764, 0.017855, 0.273346, -0.864082, 0.422664, 0.621103, -0.176976, -0.763486, 1.000000, 0.922170, 0.600010, 23, 22, 1, 1, 0.928413, 0.071587, 0.000000, 0.000000 },
-	{ 0.029075, -0.006837, 0.010235, 0.650625, -0.705326, 0.281428, 0.558361, 0.193142, -0.806802, 1.000000, 0.949530, 0.600750, 23, 22, 1, 1, 0.997762, 0.002238, 0.000000, 0.000000 },
-	{ 0.027139, -0.006266, 0.014900, 0.634512, -0.658690, 0.404379, 0.578971, 0.058454, -0.813250, 1.000000, 0.935490, 0.596850, 23, 22, 1, 1, 0.974356, 0.025644, 0.000000, 0.000000 },
-	{ 0.030342, -0.004929, 0.010292, 0.852552, -0.368618, 0.370507, 0.480570, 0.274237, -0.832974, 1.000000, 0.953580, 0.595850, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.028268, -0.004309, 0.014964, 0.835185, -0.324958, 0.443698, 0.501616, 0.119313, -0.856823, 1.000000, 0.938260, 0.591770, 23, 22, 1, 1, 0.987956, 0.012044, 0.000000, 0.000000 },
-	{ 0.026514, -0.003308, 0.018600, 0.808539, -0.310521, 0.499841, 0.527387, 0.005618, -0.849607, 1.000000, 0.926960, 0.588380, 23, 22, 1, 1, 0.925631, 0.074369, 0.000000, 0.000000 },
-	{ 0.025420, -0.005289, 0.018487, 0.594111, -0.624205, 0.507347, 0.600008, -0.076190, -0.796358, 1.000000, 0.924520, 0.593950, 23, 22, 1, 1, 0.907875, 0.092125, 0.000000, 0.000000 },
-	{ 0.027095, -0.000856, 0.018436, 0.892627, -0.071063, 0.445160, 0.447629, 0.022870, -0.893927, 1.000000, 0.929840, 0.581610, 23, 22, 1, 1, 0.942634, 0.057366, 0.000000, 0.000000 },
-	{ 0.028851, -0.001824, 0.014742, 0.905626, -0.054128, 0.420609, 0.423979, 0.136991, -0.895252, 1.000000, 0.942100, 0.585050, 23, 22, 1, 1, 0.987906, 0.012094, 0.000000, 0.000000 },
-	{ 0.030927, -0.002578, 0.010120, 0.924621, -0.039047, 0.378882, 0.371091, 0.316514, -0.872989, 1.000000, 0.957960, 0.590090, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.027153, 0.001873, 0.018125, 0.924182, 0.127998, 0.359866, 0.360285, 0.020676, -0.932613, 1.000000, 0.932910, 0.574200, 23, 22, 1, 1, 0.973464, 0.026536, 0.000000, 0.000000 },
-	{ 0.028771, 0.000854, 0.014529, 0.919280, 0.179966, 0.350052, 0.331710, 0.124516, -0.935128, 1.000000, 0.944890, 0.577690, 23, 22, 1, 1, 0.993321, 0.006679, 0.000000, 0.000000 },
-	{ 0.030634, -0.000109, 0.010022, 0.918896, 0.212204, 0.332565, 0.264583, 0.293789, -0.918523, 1.000000, 0.959760, 0.583420, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.032553, -0.002823, 0.005772, 0.948083, -0.032450, 0.316364, 0.289900, 0.497196, -0.817774, 1.000000, 0.970210, 0.596010, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.032318, -0.000688, 0.005418, 0.926520, 0.208242, 0.313361, 0.171653, 0.507180, -0.844573, 1.000000, 0.974110, 0.590910, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.032111, -0.004840, 0.005840, 0.871395, -0.416551, 0.259146, 0.444839, 0.448173, -0.775409, 1.000000, 0.967170, 0.600440, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ 0.030832, -0.006492, 0.005609, 0.656450, -0.745953, 0.112372, 0.539300, 0.359904, -0.761331, 1.000000, 0.963570, 0.604840, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020227, -0.005952, -0.025941, 0.879838, 0.202764, 0.429850, -0.002506, 0.906395, -0.422425, 1.000000, 0.817250, 0.829960, 5, 4, 6, 1, 0.890202, 0.089801, 0.019996, 0.000000 },
-	{ -0.022252, -0.005722, -0.022326, 0.873117, 0.179844, 0.453125, 0.022827, 0.913367, -0.406497, 1.000000, 0.813640, 0.818680, 5, 4, 6, 1, 0.731357, 0.267593, 0.001050, 0.000000 },
-	{ -0.022687, -0.003255, -0.023037, 0.836297, 0.391746, 0.383592, -0.180140, 0.857116, -0.482600, 1.000000, 0.822010, 0.817320, 5, 4, 1, 1, 0.737435, 0.262565, 0.000000, 0.000000 },
-	{ -0.020812, -0.003480, -0.026762, 0.821846, 0.449131, 0.350500, -0.222833, 0.819630, -0.527781, 1.000000, 0.825560, 0.828470, 5, 4, 6, 1, 0.892041, 0.092891, 0.015068, 0.000000 },
-	{ -0.020150, -0.009298, -0.025300, 0.884793, -0.028806, 0.465093, 0.209521, 0.916099, -0.341853, 1.000000, 0.806920, 0.832400, 5, 4, 6, 1, 0.888460, 0.090647, 0.020893, 0.000000 },
-	{ -0.022216, -0.008906, -0.021803, 0.872708, -0.025560, 0.487573, 0.224967, 0.907354, -0.355103, 1.000000, 0.803260, 0.820900, 5, 4, 1, 1, 0.719025, 0.280975, 0.000000, 0.000000 },
-	{ -0.023430, -0.001624, -0.023765, 0.707717, 0.656215, 0.261760, -0.420927, 0.689211, -0.589753, 1.000000, 0.828000, 0.816380, 5, 4, 1, 1, 0.749122, 0.250878, 0.000000, 0.000000 },
-	{ -0.021744, -0.001915, -0.027564, 0.667610, 0.713434, 0.212860, -0.459387, 0.619731, -0.636315, 1.000000, 0.831530, 0.827170, 5, 4, 6, 1, 0.902866, 0.084353, 0.012781, 0.000000 },
-	{ -0.020889, -0.012907, -0.025140, 0.839494, -0.273187, 0.469700, 0.428680, 0.864156, -0.263569, 1.000000, 0.795450, 0.835660, 5, 4, 6, 1, 0.857126, 0.132402, 0.010472, 0.000000 },
-	{ -0.022814, -0.012363, -0.021670, 0.831466, -0.261487, 0.490193, 0.440637, 0.847767, -0.295179, 1.000000, 0.791800, 0.824290, 5, 4, 1, 1, 0.698013, 0.301987, 0.000000, 0.000000 },
-	{ -0.022229, -0.015823, -0.025508, 0.715390, -0.546216, 0.435736, 0.652751, 0.744917, -0.137895, 1.000000, 0.785390, 0.839150, 5, 4, 6, 1, 0.890292, 0.092863, 0.016845, 0.000000 },
-	{ -0.024017, -0.015175, -0.022023, 0.717232, -0.525894, 0.457181, 0.657879, 0.727317, -0.195461, 1.000000, 0.782340, 0.827890, 5, 4, 6, 1, 0.715724, 0.283047, 0.001229, 0.000000 },
-	{ -0.023691, -0.017433, -0.026266, 0.460046, -0.822945, 0.333345, 0.876698, 0.480451, -0.023810, 1.000000, 0.779110, 0.841790, 5, 4, 6, 1, 0.911140, 0.072171, 0.016689, 0.000000 },
-	{ -0.025353, -0.016805, -0.022722, 0.475789, -0.799592, 0.366439, 0.871648, 0.484396, -0.074777, 1.000000, 0.776330, 0.830880, 5, 4, 6, 1, 0.750319, 0.247520, 0.002161, 0.000000 },
-	{ -0.025110, -0.018118, -0.027276, 0.156208, -0.968652, 0.193165, 0.983024, 0.171519, 0.065157, 1.000000, 0.773850, 0.844950, 5, 4, 6, 1, 0.925229, 0.055219, 0.019552, 0.000000 },
-	{ -0.026677, -0.017542, -0.023612, 0.174327, -0.956791, 0.232725, 0.982636, 0.184285, 0.021581, 1.000000, 0.771430, 0.833690, 5, 4, 6, 1, 0.781639, 0.215728, 0.002633, 0.000000 },
-	{ -0.024467, -0.000652, -0.024525, 0.493963, 0.861162, 0.120005, -0.608125, 0.440821, -0.660198, 1.000000, 0.833050, 0.815540, 5, 4, 1, 1, 0.766348, 0.233652, 0.000000, 0.000000 },
-	{ -0.022928, -0.001004, -0.028388, 0.462279, 0.883478, 0.075934, -0.620180, 0.383334, -0.684420, 1.000000, 0.836790, 0.826070, 5, 4, 6, 1, 0.913971, 0.075114, 0.010914, 0.000000 },
-	{ -0.026380, -0.018214, -0.028131, -0.088605, -0.993565, 0.070555, 0.986907, -0.077985, 0.141187, 1.000000, 0.769730, 0.846970, 5, 4, 6, 1, 0.933218, 0.047836, 0.018946, 0.000000 },
-	{ -0.027938, -0.017724, -0.024400, -0.056065, -0.991776, 0.115055, 0.994753, -0.045611, 0.091573, 1.000000, 0.767320, 0.835670, 5, 4, 6, 1, 0.833580, 0.163308, 0.003113, 0.000000 },
-	{ -0.021112, -0.001726, -0.032902, 0.439501, 0.897391, 0.039101, -0.613584, 0.331728, -0.716569, 1.000000, 0.841530, 0.839430, 5, 6, 4, 1, 0.918685, 0.068006, 0.013309, 0.000000 },
-	{ -0.019852, -0.002556, -0.032053, 0.629398, 0.759321, 0.165200, -0.483219, 0.548925, -0.682042, 1.000000, 0.836200, 0.840820, 5, 6, 4, 1, 0.908091, 0.078095, 0.013815, 0.000000 },
-	{ -0.018775, -0.003985, -0.031238, 0.808404, 0.499355, 0.311654, -0.249067, 0.769907, -0.587545, 1.000000, 0.830370, 0.842500, 5, 6, 4, 1, 0.895754, 0.088525, 0.015721, 0.000000 },
-	{ -0.018075, -0.006341, -0.030485, 0.890066, 0.218381, 0.400114, -0.013792, 0.890270, -0.455225, 1.000000, 0.822690, 0.844700, 5, 6, 4, 1, 0.877460, 0.106825, 0.015715, 0.000000 },
-	{ -0.017949, -0.009690, -0.029910, 0.900132, -0.027442, 0.434752, 0.192758, 0.920082, -0.341020, 1.000000, 0.811860, 0.847440, 5, 6, 4, 1, 0.860140, 0.125659, 0.014201, 0.000000 },
-	{ -0.023091, -0.018588, -0.031723, 0.144607, -0.976197, 0.161641, 0.976006, 0.167800, 0.138761, 1.000000, 0.777060, 0.858880, 5, 6, 4, 1, 0.890664, 0.101363, 0.007973, 0.000000 },
-	{ -0.024446, -0.018614, -0.032434, -0.107812, -0.993719, 0.030004, 0.974413, -0.099634, 0.201478, 1.000000, 0.772710, 0.860110, 5, 6, 4, 1, 0.911109, 0.082113, 0.006778, 0.000000 },
-	{ -0.021529, -0.017942, -0.030879, 0.456730, -0.835039, 0.306771, 0.874264, 0.485087, 0.018788, 1.000000, 0.782830, 0.856710, 5, 6, 4, 1, 0.896377, 0.090398, 0.013224, 0.000000 },
-	{ -0.019896, -0.016349, -0.030165, 0.725286, -0.551879, 0.411570, 0.643776, 0.755522, -0.121403, 1.000000, 0.789940, 0.854240, 5, 6, 4, 1, 0.906849, 0.073674, 0.019477, 0.000000 },
-	{ -0.018588, -0.013369, -0.029807, 0.855531, -0.269321, 0.442190, 0.403875, 0.881539, -0.244489, 1.000000, 0.800090, 0.850960, 5, 6, 4, 1, 0.874032, 0.102882, 0.023087, 0.000000 },
-	{ -0.017814, -0.003300, -0.036346, 0.586425, 0.795437, 0.152925, -0.473378, 0.489751, -0.732159, 1.000000, 0.841220, 0.854560, 5, 6, 4, 1, 0.750239, 0.248663, 0.001098, 0.000000 },
-	{ -0.016710, -0.004615, -0.035533, 0.775612, 0.545946, 0.316810, -0.245349, 0.723197, -0.645594, 1.000000, 0.835500, 0.856490, 5, 6, 1, 1, 0.725952, 0.274048, 0.000000, 0.000000 },
-	{ -0.015916, -0.004003, -0.039734, 0.529195, 0.831698, 0.168021, -0.463345, 0.449148, -0.763923, 1.000000, 0.845170, 0.865130, 5, 6, 1, 1, 0.531504, 0.468496, 0.000000, 0.000000 },
-	{ -0.014798, -0.005203, -0.038807, 0.707650, 0.603966, 0.366682, -0.242491, 0.695045, -0.676839, 1.000000, 0.839190, 0.866870, 6, 5, 1, 1, 0.518988, 0.481012, 0.000000, 0.000000 },
-	{ -0.014051, -0.007260, -0.038080, 0.805011, 0.269182, 0.528676, 0.045777, 0.860296, -0.507736, 1.000000, 0.831940, 0.869250, 6, 5, 1, 1, 0.589628, 0.410372, 0.000000, 0.000000 },
-	{ -0.015954, -0.006819, -0.034869, 0.873335, 0.234818, 0.426786, 0.014233, 0.863467, -0.504205, 1.000000, 0.828190, 0.859200, 5, 6, 1, 1, 0.694007, 0.305993, 0.000000, 0.000000 },
-	{ -0.013951, -0.010309, -0.037639, 0.809839, -0.005248, 0.586628, 0.268201, 0.892655, -0.362265, 1.000000, 0.821410, 0.872240, 6, 5, 1, 1, 0.593260, 0.406740, 0.000000, 0.000000 },
-	{ -0.015801, -0.010039, -0.034418, 0.886501, -0.020807, 0.462259, 0.212811, 0.905402, -0.367368, 1.000000, 0.817590, 0.862600, 5, 6, 1, 1, 0.664913, 0.335087, 0.000000, 0.000000 },
-	{ -0.016372, -0.013636, -0.034342, 0.849229, -0.252846, 0.463550, 0.394472, 0.887376, -0.238653, 1.000000, 0.805170, 0.866110, 5, 6, 4, 1, 0.646427, 0.352490, 0.001083, 0.000000 },
-	{ -0.014492, -0.013822, -0.037597, 0.771790, -0.230234, 0.592734, 0.446134, 0.860278, -0.246749, 1.000000, 0.808840, 0.875720, 6, 5, 1, 1, 0.579935, 0.420065, 0.000000, 0.000000 },
-	{ -0.015601, -0.016775, -0.038002, 0.662052, -0.501940, 0.556546, 0.654555, 0.748940, -0.103185, 1.000000, 0.798060, 0.879010, 6, 5, 1, 1, 0.646295, 0.353705, 0.000000, 0.000000 },
-	{ -0.017573, -0.016588, -0.034657, 0.728913, -0.532671, 0.430056, 0.625335, 0.773719, -0.101562, 1.000000, 0.794490, 0.868790, 5, 6, 4, 1, 0.703701, 0.293866, 0.002434, 0.000000 },
-	{ -0.017019, -0.018499, -0.038686, 0.417951, -0.804565, 0.421891, 0.870860, 0.487064, 0.066125, 1.000000, 0.790520, 0.881350, 6, 5, 1, 1, 0.579115, 0.420885, 0.000000, 0.000000 },
-	{ -0.019145, -0.018279, -0.035297, 0.465854, -0.823818, 0.322960, 0.861210, 0.505946, 0.048331, 1.000000, 0.786800, 0.870900, 5, 6, 4, 1, 0.714771, 0.283893, 0.001336, 0.000000 },
-	{ -0.018519, -0.019222, -0.039444, 0.113536, -0.969462, 0.217379, 0.972116, 0.153582, 0.177211, 1.000000, 0.784550, 0.882960, 6, 5, 1, 1, 0.544273, 0.455727, 0.000000, 0.000000 },
-	{ -0.020745, -0.018934, -0.035992, 0.145289, -0.975766, 0.163620, 0.970872, 0.172452, 0.166336, 1.000000, 0.780830, 0.872290, 5, 6, 1, 1, 0.696368, 0.303632, 0.000000, 0.000000 },
-	{ -0.019057, -0.002543, -0.037234, 0.414673, 0.909586, 0.026433, -0.585094, 0.288762, -0.757813, 1.000000, 0.846570, 0.853080, 5, 6, 4, 1, 0.766603, 0.232105, 0.001292, 0.000000 },
-	{ -0.017119, -0.003331, -0.040724, 0.377623, 0.925478, 0.029854, -0.564810, 0.255769, -0.784584, 1.000000, 0.850600, 0.863860, 6, 5, 1, 1, 0.500855, 0.499145, 0.000000, 0.000000 },
-	{ -0.019912, -0.019286, -0.040152, -0.124729, -0.990980, 0.049002, 0.969389, -0.111187, 0.218912, 1.000000, 0.779820, 0.884060, 6, 5, 1, 1, 0.538778, 0.461222, 0.000000, 0.000000 },
-	{ -0.022165, -0.018932, -0.036623, -0.112028, -0.993500, 0.020179, 0.972196, -0.105378, 0.209121, 1.000000, 0.776240, 0.873200, 5, 6, 1, 1, 0.736165, 0.263835, 0.000000, 0.000000 },
-	{ -0.016485, -0.019793, -0.042140, 0.037970, -0.965504, 0.257605, 0.970409, 0.097145, 0.221064, 1.000000, 0.787460, 0.891670, 6, 5, 1, 1, 0.769824, 0.230176, 0.000000, 0.000000 },
-	{ -0.017858, -0.019786, -0.043054, -0.164183, -0.983598, 0.074700, 0.956015, -0.140004, 0.257747, 1.000000, 0.782670, 0.893160, 6, 5, 1, 1, 0.755185, 0.244815, 0.000000, 0.000000 },
-	{ -0.015754, -0.020384, -0.045765, -0.192402, -0.978435, 0.075149, 0.952958, -0.168016, 0.252274, 1.000000, 0.785850, 0.902380, 6, 5, 1, 1, 0.914442, 0.085558, 0.000000, 0.000000 },
-	{ -0.014446, -0.020416, -0.044675, 0.009845, -0.970251, 0.241902, 0.974455, 0.063589, 0.215393, 1.000000, 0.790630, 0.900240, 6, 5, 1, 1, 0.923970, 0.076030, 0.000000, 0.000000 },
-	{ -0.014950, -0.019175, -0.041149, 0.320873, -0.806425, 0.496709, 0.895658, 0.428883, 0.117714, 1.000000, 0.793420, 0.889710, 6, 5, 1, 1, 0.832974, 0.167026, 0.000000, 0.000000 },
-	{ -0.012953, -0.019836, -0.043483, 0.315801, -0.828194, 0.462994, 0.905063, 0.409423, 0.115038, 1.000000, 0.796450, 0.897670, 6, 5, 1, 1, 0.951920, 0.048080, 0.000000, 0.000000 },
-	{ -0.013508, -0.017465, -0.040276, 0.566276, -0.489711, 0.662960, 0.697545, 0.713212, -0.068987, 1.000000, 0.800550, 0.887210, 6, 5, 1, 1, 0.856721, 0.143279, 0.000000, 0.000000 },
-	{ -0.011494, -0.018135, -0.042464, 0.591458, -0.509241, 0.625181, 0.694149, 0.716077, -0.073426, 1.000000, 0.803250, 0.894880, 6, 5, 1, 1, 0.940113, 0.059887, 0.000000, 0.000000 },
-	{ -0.010406, -0.014922, -0.041843, 0.703279, -0.232213, 0.671920, 0.489946, 0.843165, -0.221417, 1.000000, 0.813900, 0.890850, 6, 5, 1, 1, 0.937962, 0.062038, 0.000000, 0.000000 },
-	{ -0.012457, -0.014334, -0.039751, 0.673427, -0.216953, 0.706702, 0.497356, 0.840228, -0.215994, 1.000000, 0.811360, 0.883280, 6, 5, 1, 1, 0.804848, 0.195152, 0.000000, 0.000000 },
-	{ -0.009851, -0.011144, -0.041758, 0.746876, 0.010355, 0.664883, 0.284995, 0.898406, -0.334133, 1.000000, 0.826530, 0.886930, 6, 5, 1, 1, 0.940658, 0.059342, 0.000000, 0.000000 },
-	{ -0.011926, -0.010642, -0.039743, 0.717897, 0.014324, 0.696003, 0.300472, 0.895490, -0.328353, 1.000000, 0.824290, 0.879460, 6, 5, 1, 1, 0.819822, 0.180178, 0.000000, 0.000000 },
-	{ -0.012057, -0.007612, -0.040297, 0.726685, 0.319835, 0.607976, 0.031100, 0.868786, -0.494211, 1.000000, 0.834490, 0.876940, 6, 5, 1, 1, 0.828702, 0.171298, 0.000000, 0.000000 },
-	{ -0.010013, -0.008154, -0.042401, 0.746051, 0.339921, 0.572591, -0.005783, 0.863166, -0.504887, 1.000000, 0.836000, 0.884690, 6, 5, 1, 1, 0.940854, 0.059146, 0.000000, 0.000000 },
-	{ -0.012843, -0.005690, -0.041217, 0.637491, 0.657507, 0.401609, -0.271462, 0.679517, -0.681590, 1.000000, 0.841440, 0.875150, 6, 5, 1, 1, 0.762758, 0.237242, 0.000000, 0.000000 },
-	{ -0.010820, -0.006292, -0.043453, 0.638702, 0.673087, 0.372847, -0.305800, 0.666694, -0.679710, 1.000000, 0.842980, 0.883310, 6, 5, 1, 1, 0.922038, 0.077962, 0.000000, 0.000000 },
-	{ -0.011926, -0.005179, -0.044607, 0.480408, 0.858281, 0.180449, -0.487478, 0.432345, -0.758580, 1.000000, 0.849240, 0.882240, 6, 5, 1, 1, 0.906731, 0.093269, 0.000000, 0.000000 },
-	{ -0.013960, -0.004567, -0.042299, 0.479787, 0.856658, 0.189582, -0.471621, 0.434013, -0.767598, 1.000000, 0.847610, 0.873820, 6, 5, 1, 1, 0.722261, 0.277739, 0.000000, 0.000000 },
-	{ -0.015136, -0.003946, -0.043380, 0.343016, 0.938287, 0.044252, -0.562767, 0.242997, -0.790092, 1.000000, 0.853040, 0.872790, 6, 5, 1, 1, 0.762415, 0.237585, 0.000000, 0.000000 },
-	{ -0.013082, -0.004570, -0.045695, 0.341266, 0.939239, 0.036992, -0.572758, 0.238990, -0.784112, 1.000000, 0.854500, 0.881320, 6, 5, 1, 1, 0.913137, 0.086863, 0.000000, 0.000000 },
-	{ -0.009504, -0.018599, -0.045002, 0.651782, -0.514025, 0.557636, 0.669530, 0.735367, -0.104712, 1.000000, 0.806460, 0.902810, 6, 5, 1, 1, 0.985774, 0.014226, 0.000000, 0.000000 },
-	{ -0.010901, -0.020374, -0.046039, 0.381992, -0.819145, 0.427883, 0.895530, 0.442452, 0.047552, 1.000000, 0.799830, 0.906020, 6, 5, 1, 1, 0.984242, 0.015758, 0.000000, 0.000000 },
-	{ -0.008719, -0.020681, -0.048923, 0.477231, -0.778479, 0.407702, 0.858934, 0.511253, -0.029213, 1.000000, 0.804270, 0.915310, 6, 5, 1, 1, 0.997403, 0.002597, 0.000000, 0.000000 },
-	{ -0.007389, -0.018850, -0.048029, 0.699829, -0.502355, 0.507818, 0.643524, 0.751952, -0.142985, 1.000000, 0.810940, 0.911900, 6, 5, 1, 1, 0.997881, 0.002119, 0.000000, 0.000000 },
-	{ -0.009986, -0.021581, -0.050122, 0.171432, -0.951874, 0.254062, 0.977403, 0.196694, 0.077423, 1.000000, 0.799300, 0.919120, 6, 5, 1, 1, 0.998609, 0.001391, 0.000000, 0.000000 },
-	{ -0.012279, -0.021045, -0.047333, 0.056330, -0.968194, 0.243779, 0.983034, 0.096473, 0.156003, 1.000000, 0.794480, 0.909510, 6, 5, 1, 1, 0.981661, 0.018339, 0.000000, 0.000000 },
-	{ -0.008388, -0.015429, -0.044392, 0.762817, -0.248690, 0.596879, 0.468863, 0.848403, -0.245724, 1.000000, 0.816870, 0.898910, 6, 5, 1, 1, 0.985502, 0.014498, 0.000000, 0.000000 },
-	{ -0.006287, -0.015873, -0.047526, 0.802271, -0.253481, 0.540471, 0.447575, 0.854509, -0.263613, 1.000000, 0.820670, 0.908250, 6, 5, 1, 1, 0.998855, 0.001145, 0.000000, 0.000000 },
-	{ -0.007818, -0.011772, -0.044290, 0.808790, -0.004870, 0.588078, 0.261182, 0.898914, -0.351763, 1.000000, 0.828750, 0.894990, 6, 5, 1, 1, 0.985054, 0.014946, 0.000000, 0.000000 },
-	{ -0.005745, -0.012510, -0.047437, 0.853039, -0.010594, 0.521739, 0.233187, 0.902162, -0.362942, 1.000000, 0.831010, 0.904660, 6, 5, 1, 1, 0.997790, 0.002210, 0.000000, 0.000000 },
-	{ -0.007954, -0.008866, -0.044911, 0.799052, 0.323359, 0.506907, -0.040260, 0.869954, -0.491486, 1.000000, 0.837710, 0.893080, 6, 5, 1, 1, 0.983380, 0.016620, 0.000000, 0.000000 },
-	{ -0.005911, -0.009682, -0.047955, 0.845787, 0.291172, 0.447060, -0.052298, 0.879156, -0.473655, 1.000000, 0.839560, 0.902470, 6, 5, 1, 1, 0.996594, 0.003406, 0.000000, 0.000000 },
-	{ -0.008712, -0.007007, -0.045991, 0.676156, 0.652260, 0.342593, -0.331959, 0.684838, -0.648691, 1.000000, 0.844610, 0.892210, 6, 5, 1, 1, 0.982993, 0.017007, 0.000000, 0.000000 },
-	{ -0.006596, -0.007769, -0.048936, 0.732113, 0.600769, 0.321073, -0.343287, 0.732513, -0.587860, 1.000000, 0.846350, 0.901760, 6, 5, 1, 1, 0.996909, 0.003091, 0.000000, 0.000000 },
-	{ -0.009786, -0.005885, -0.047139, 0.501792, 0.847359, 0.173746, -0.508547, 0.451486, -0.733172, 1.000000, 0.850700, 0.891340, 6, 5, 1, 1, 0.980483, 0.019517, 0.000000, 0.000000 },
-	{ -0.007546, -0.006628, -0.050042, 0.546301, 0.819281, 0.174167, -0.553508, 0.509188, -0.659058, 1.000000, 0.852010, 0.901500, 6, 5, 1, 1, 0.997883, 0.002117, 0.000000, 0.000000 },
-	{ -0.010921, -0.005281, -0.048203, 0.347336, 0.937150, 0.033295, -0.606994, 0.251751, -0.753777, 1.000000, 0.855790, 0.890590, 6, 5, 1, 1, 0.984046, 0.015954, 0.000000, 0.000000 },
-	{ -0.008574, -0.006036, -0.051100, 0.367356, 0.929489, 0.033159, -0.684680, 0.294388, -0.666745, 1.000000, 0.856980, 0.901450, 6, 5, 1, 1, 0.998935, 0.001065, 0.000000, 0.000000 },
-	{ -0.011109, -0.021772, -0.051314, -0.103957, -0.990541, 0.089568, 0.986208, -0.091001, 0.138250, 1.000000, 0.795470, 0.922250, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013487, -0.021073, -0.048528, -0.182737, -0.979501, 0.084765, 0.963429, -0.161216, 0.214041, 1.000000, 0.790080, 0.912300, 6, 5, 1, 1, 0.988385, 0.011615, 0.000000, 0.000000 },
-	{ -0.004122, -0.010601, -0.051227, 0.887909, 0.253905, 0.383601, -0.058632, 0.889543, -0.453073, 1.000000, 0.841180, 0.912630, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004699, -0.008666, -0.052013, 0.800547, 0.524311, 0.290211, -0.328031, 0.788674, -0.519989, 1.000000, 0.847750, 0.911800, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002886, -0.011449, -0.054070, 0.928257, 0.209389, 0.307400, -0.059508, 0.899443, -0.432969, 1.000000, 0.842360, 0.921680, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003348, -0.009660, -0.054580, 0.865048, 0.439908, 0.241191, -0.286549, 0.827865, -0.482214, 1.000000, 0.848090, 0.920520, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002217, -0.011951, -0.056244, 0.966787, 0.172768, 0.188344, -0.079462, 0.903586, -0.420973, 1.000000, 0.843490, 0.928200, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002653, -0.010477, -0.056127, 0.918686, 0.359461, 0.163719, -0.253013, 0.853831, -0.454925, 1.000000, 0.847610, 0.925910, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002718, -0.010114, -0.057140, 0.879186, 0.475809, 0.025274, -0.413863, 0.788858, -0.454335, 1.000000, 0.849940, 0.928100, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002003, -0.012008, -0.057959, 0.978206, 0.206314, 0.023408, -0.177263, 0.888488, -0.423280, 1.000000, 0.845290, 0.932950, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.001721, -0.014353, -0.058255, 0.999450, -0.023070, 0.023833, 0.030426, 0.923779, -0.381715, 1.000000, 0.838620, 0.936590, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.001977, -0.014228, -0.056248, 0.979673, -0.014460, 0.200078, 0.091716, 0.919332, -0.382645, 1.000000, 0.836910, 0.930950, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003810, -0.008642, -0.055469, 0.740110, 0.665315, 0.097948, -0.543421, 0.677488, -0.495685, 1.000000, 0.852310, 0.921190, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002615, -0.013904, -0.053804, 0.939990, -0.002411, 0.341193, 0.141097, 0.913215, -0.382269, 1.000000, 0.835110, 0.924010, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002287, -0.016639, -0.056175, 0.948503, -0.243100, 0.203087, 0.299671, 0.896410, -0.326567, 1.000000, 0.829700, 0.933320, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002060, -0.016749, -0.058178, 0.961429, -0.274568, 0.016340, 0.264634, 0.907177, -0.327105, 1.000000, 0.831200, 0.938920, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003160, -0.018615, -0.056011, 0.864600, -0.464011, 0.192769, 0.500909, 0.826095, -0.258182, 1.000000, 0.823140, 0.934650, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003886, -0.018760, -0.053880, 0.809590, -0.469887, 0.351809, 0.560949, 0.795868, -0.227881, 1.000000, 0.820360, 0.928920, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004054, -0.019805, -0.055776, 0.736502, -0.656034, 0.164877, 0.676346, 0.710238, -0.195238, 1.000000, 0.818490, 0.934980, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004345, -0.020187, -0.056739, 0.648371, -0.761183, 0.014652, 0.750034, 0.635335, -0.183844, 1.000000, 0.817510, 0.937960, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003007, -0.018730, -0.057713, 0.841386, -0.540415, 0.004613, 0.522972, 0.812018, -0.259090, 1.000000, 0.824260, 0.939480, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004968, -0.020292, -0.054251, 0.665518, -0.692628, 0.278125, 0.742385, 0.652792, -0.150753, 1.000000, 0.814820, 0.931020, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005897, -0.021199, -0.055056, 0.487734, -0.864538, 0.121205, 0.872505, 0.478105, -0.100745, 1.000000, 0.810990, 0.933850, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002938, -0.016540, -0.053752, 0.900961, -0.241814, 0.360271, 0.360328, 0.879544, -0.310752, 1.000000, 0.827450, 0.926690, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004310, -0.008122, -0.056532, 0.595852, 0.800744, -0.061404, -0.724390, 0.502874, -0.471569, 1.000000, 0.855780, 0.922960, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002083, -0.011916, -0.059442, 0.958222, 0.254071, -0.131373, -0.285894, 0.864736, -0.412913, 1.000000, 0.847290, 0.936850, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.001865, -0.014392, -0.059898, 0.985426, -0.028198, -0.167753, -0.037207, 0.926554, -0.374316, 1.000000, 0.840030, 0.941270, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.002259, -0.016842, -0.059810, 0.930937, -0.316652, -0.181898, 0.246748, 0.912636, -0.325901, 1.000000, 0.832050, 0.943670, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003278, -0.018912, -0.059186, 0.773306, -0.614832, -0.154854, 0.565500, 0.779279, -0.270064, 1.000000, 0.824410, 0.943920, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004869, -0.020525, -0.057942, 0.558107, -0.823851, -0.098931, 0.801300, 0.565972, -0.193890, 1.000000, 0.816180, 0.941840, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006739, -0.021675, -0.056141, 0.320861, -0.946826, -0.023864, 0.941243, 0.321571, -0.103216, 1.000000, 0.808240, 0.937370, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.008824, -0.022096, -0.053900, 0.072307, -0.995949, 0.053450, 0.997160, 0.073318, 0.017191, 1.000000, 0.801520, 0.930800, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007771, -0.021725, -0.052783, 0.330351, -0.918161, 0.218743, 0.941236, 0.337726, -0.003894, 1.000000, 0.804920, 0.927500, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006587, -0.020692, -0.051831, 0.576953, -0.731125, 0.364117, 0.802642, 0.590090, -0.086943, 1.000000, 0.809700, 0.924420, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005352, -0.018903, -0.051185, 0.746483, -0.488631, 0.451667, 0.614739, 0.766226, -0.187064, 1.000000, 0.816090, 0.921500, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.004290, -0.016300, -0.050851, 0.842572, -0.250154, 0.476964, 0.418981, 0.860901, -0.288625, 1.000000, 0.824500, 0.918430, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.003874, -0.013292, -0.050830, 0.893228, -0.004576, 0.449580, 0.194738, 0.905221, -0.377693, 1.000000, 0.833190, 0.915090, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.038476, -0.028065, 0.000014, 0.937697, 0.120703, -0.325814, -0.094029, 0.990884, 0.096473, 1.000000, 0.713470, 0.768980, 8, 4, 1, 1, 0.942680, 0.048798, 0.008522, 0.000000 },
-	{ -0.038828, -0.028547, -0.003472, 0.967691, 0.244614, -0.061139, -0.242266, 0.969240, 0.043367, 1.000000, 0.712560, 0.778560, 8, 4, 1, 1, 0.994250, 0.004066, 0.001685, 0.000000 },
-	{ -0.038441, -0.032796, -0.002471, 0.994242, -0.106190, 0.014365, 0.106822, 0.992781, -0.054544, 1.000000, 0.699540, 0.775780, 8, 1, 4, 17, 0.995241, 0.002206, 0.001432, 0.001121 },
-	{ -0.038230, -0.032444, 0.000858, 0.950079, -0.149417, -0.273908, 0.147609, 0.988668, -0.027322, 1.000000, 0.699810, 0.766100, 8, 1, 17, 4, 0.978960, 0.011511, 0.006751, 0.002778 },
-	{ -0.039837, -0.037440, -0.001851, 0.870925, -0.488366, 0.054672, 0.490371, 0.856424, -0.161477, 1.000000, 0.684240, 0.775470, 8, 17, 1, 1, 0.991033, 0.006902, 0.002065, 0.000000 },
-	{ -0.039584, -0.037102, 0.001469, 0.835175, -0.480525, -0.267540, 0.451941, 0.876833, -0.164052, 1.000000, 0.684150, 0.765640, 8, 17, 1, 1, 0.946252, 0.042828, 0.010919, 0.000000 },
-	{ -0.042997, -0.041002, -0.001733, 0.637359, -0.768611, 0.054877, 0.752283, 0.605234, -0.260314, 1.000000, 0.669270, 0.777950, 8, 17, 1, 1, 0.987467, 0.012533, 0.000000, 0.000000 },
-	{ -0.042804, -0.040966, 0.001872, 0.627903, -0.730305, -0.269058, 0.659931, 0.682851, -0.313377, 1.000000, 0.667460, 0.768150, 8, 17, 1, 1, 0.898675, 0.093650, 0.007675, 0.000000 },
-	{ -0.046194, -0.042801, -0.001913, 0.371517, -0.927891, 0.031517, 0.880640, 0.341441, -0.328470, 1.000000, 0.659380, 0.781690, 8, 17, 1, 1, 0.987236, 0.012764, 0.000000, 0.000000 },
-	{ -0.046307, -0.043011, 0.001823, 0.384740, -0.893977, -0.229743, 0.763251, 0.448099, -0.465463, 1.000000, 0.656450, 0.772530, 8, 17, 1, 1, 0.882320, 0.116290, 0.001389, 0.000000 },
-	{ -0.039808, -0.025134, -0.001071, 0.841554, 0.405386, -0.357002, -0.333486, 0.909821, 0.247007, 1.000000, 0.722230, 0.773440, 8, 4, 1, 1, 0.936985, 0.060233, 0.002782, 0.000000 },
-	{ -0.040285, -0.025841, -0.004535, 0.818256, 0.554139, -0.152927, -0.541737, 0.832321, 0.117321, 1.000000, 0.721330, 0.782370, 8, 4, 1, 1, 0.996157, 0.003843, 0.000000, 0.000000 },
-	{ -0.041371, -0.023512, -0.001932, 0.682430, 0.631460, -0.368168, -0.537325, 0.774850, 0.333000, 1.000000, 0.728120, 0.777350, 8, 4, 1, 1, 0.959034, 0.040966, 0.000000, 0.000000 },
-	{ -0.041952, -0.024405, -0.005372, 0.622085, 0.749113, -0.227684, -0.745871, 0.655445, 0.118616, 1.000000, 0.727720, 0.785240, 8, 4, 1, 1, 0.997069, 0.002931, 0.000000, 0.000000 },
-	{ -0.048725, -0.043367, -0.002062, 0.127532, -0.991835, 0.000112, 0.940569, 0.120904, -0.317352, 1.000000, 0.652610, 0.784340, 8, 17, 1, 1, 0.994521, 0.005479, 0.000000, 0.000000 },
-	{ -0.048942, -0.043657, 0.001779, 0.139569, -0.974397, -0.176273, 0.803457, 0.215486, -0.554997, 1.000000, 0.649750, 0.776390, 8, 17, 1, 1, 0.919839, 0.080161, 0.000000, 0.000000 },
-	{ -0.038739, -0.029075, -0.007941, 0.949010, 0.315245, -0.000098, -0.315010, 0.948289, -0.038959, 1.000000, 0.712980, 0.791960, 8, 9, 1, 1, 0.997817, 0.002183, 0.000000, 0.000000 },
-	{ -0.038079, -0.033270, -0.006904, 0.993858, -0.071111, 0.084793, 0.078375, 0.993237, -0.085659, 1.000000, 0.699900, 0.789660, 8, 9, 1, 1, 0.998758, 0.001242, 0.000000, 0.000000 },
-	{ -0.038447, -0.029794, -0.012665, 0.932573, 0.360749, 0.012978, -0.356474, 0.925996, -0.124327, 1.000000, 0.713720, 0.806150, 8, 9, 1, 1, 0.985296, 0.014704, 0.000000, 0.000000 },
-	{ -0.037643, -0.033919, -0.011807, 0.993436, -0.049462, 0.103144, 0.062435, 0.989987, -0.126603, 1.000000, 0.700700, 0.805130, 8, 9, 1, 1, 0.988374, 0.011626, 0.000000, 0.000000 },
-	{ -0.038041, -0.030541, -0.016733, 0.920221, 0.390685, 0.023621, -0.379808, 0.905923, -0.187214, 1.000000, 0.713910, 0.817920, 8, 9, 1, 1, 0.954980, 0.045020, 0.000000, 0.000000 },
-	{ -0.039948, -0.028101, -0.017586, 0.702646, 0.708406, -0.066696, -0.706440, 0.683339, -0.184366, 1.000000, 0.723670, 0.818530, 8, 9, 1, 1, 0.941040, 0.058960, 0.000000, 0.000000 },
-	{ -0.040210, -0.027343, -0.013604, 0.719049, 0.689909, -0.083625, -0.694396, 0.708402, -0.126417, 1.000000, 0.722760, 0.807670, 8, 9, 1, 1, 0.987992, 0.012008, 0.000000, 0.000000 },
-	{ -0.037179, -0.034559, -0.016097, 0.992281, -0.034317, 0.119171, 0.054999, 0.983055, -0.174867, 1.000000, 0.701450, 0.818280, 8, 9, 1, 1, 0.937021, 0.062979, 0.000000, 0.000000 },
-	{ -0.038926, -0.038651, -0.011541, 0.865037, -0.473369, 0.166231, 0.495860, 0.857103, -0.139633, 1.000000, 0.686370, 0.806460, 8, 9, 1, 1, 0.982063, 0.017937, 0.000000, 0.000000 },
-	{ -0.038360, -0.039342, -0.016071, 0.868278, -0.459888, 0.185999, 0.487015, 0.861572, -0.143216, 1.000000, 0.686840, 0.820730, 8, 9, 1, 1, 0.917555, 0.082445, 0.000000, 0.000000 },
-	{ -0.042080, -0.042174, -0.011980, 0.609645, -0.769916, 0.188582, 0.791865, 0.602288, -0.100990, 1.000000, 0.671580, 0.809730, 8, 9, 1, 1, 0.983464, 0.016536, 0.000000, 0.000000 },
-	{ -0.041349, -0.042918, -0.016651, 0.609796, -0.764894, 0.207574, 0.785984, 0.617292, -0.034336, 1.000000, 0.672250, 0.823910, 8, 9, 1, 1, 0.915589, 0.084411, 0.000000, 0.000000 },
-	{ -0.044332, -0.044502, -0.017155, 0.299657, -0.935709, 0.186159, 0.945967, 0.316749, 0.069400, 1.000000, 0.662730, 0.824930, 8, 9, 1, 1, 0.864726, 0.135274, 0.000000, 0.000000 },
-	{ -0.045118, -0.043769, -0.012427, 0.308234, -0.935697, 0.171650, 0.949815, 0.312811, -0.000407, 1.000000, 0.662010, 0.811530, 8, 9, 1, 1, 0.969169, 0.030831, 0.000000, 0.000000 },
-	{ -0.042150, -0.026220, -0.014353, 0.486613, 0.861700, -0.143810, -0.873269, 0.475136, -0.107921, 1.000000, 0.729500, 0.809030, 8, 9, 1, 1, 0.988389, 0.011611, 0.000000, 0.000000 },
-	{ -0.041880, -0.026921, -0.018369, 0.474904, 0.872941, -0.111539, -0.874953, 0.454747, -0.166319, 1.000000, 0.730530, 0.819600, 8, 9, 1, 1, 0.937945, 0.062055, 0.000000, 0.000000 },
-	{ -0.046903, -0.044840, -0.017470, 0.042428, -0.987356, 0.152739, 0.994279, 0.056726, 0.090504, 1.000000, 0.655400, 0.825190, 8, 9, 1, 1, 0.884360, 0.115640, 0.000000, 0.000000 },
-	{ -0.047680, -0.044130, -0.012599, 0.052554, -0.989568, 0.134143, 0.996046, 0.061578, 0.064028, 1.000000, 0.654750, 0.811620, 8, 9, 1, 1, 0.977043, 0.022957, 0.000000, 0.000000 },
-	{ -0.040356, -0.026546, -0.009014, 0.761031, 0.641272, -0.097991, -0.646648, 0.761951, -0.035727, 1.000000, 0.721830, 0.794930, 8, 9, 1, 1, 0.998172, 0.001828, 0.000000, 0.000000 },
-	{ -0.042191, -0.025328, -0.009802, 0.539272, 0.824221, -0.172757, -0.840389, 0.539902, -0.047466, 1.000000, 0.728440, 0.796760, 8, 9, 1, 1, 0.998862, 0.001138, 0.000000, 0.000000 },
-	{ -0.048304, -0.043546, -0.007233, 0.087258, -0.992607, 0.084371, 0.992723, 0.079587, -0.090369, 1.000000, 0.653900, 0.797470, 8, 9, 1, 1, 0.997805, 0.002195, 0.000000, 0.000000 },
-	{ -0.045767, -0.043104, -0.007033, 0.337038, -0.933724, 0.120690, 0.934862, 0.316718, -0.160385, 1.000000, 0.661230, 0.796090, 8, 9, 1, 1, 0.997340, 0.002660, 0.000000, 0.000000 },
-	{ -0.042661, -0.041439, -0.006586, 0.620515, -0.771070, 0.142873, 0.782012, 0.594846, -0.186053, 1.000000, 0.670930, 0.792650, 8, 9, 1, 1, 0.998154, 0.001846, 0.000000, 0.000000 },
-	{ -0.039466, -0.037931, -0.006386, 0.866717, -0.479987, 0.135698, 0.496307, 0.857027, -0.138508, 1.000000, 0.685580, 0.789640, 8, 9, 1, 1, 0.998075, 0.001925, 0.000000, 0.000000 },
-	{ -0.036276, -0.032552, -0.025858, 0.853829, 0.442193, 0.274666, -0.364293, 0.884484, -0.291513, 1.000000, 0.714970, 0.843600, 9, 8, 1, 1, 0.701194, 0.298806, 0.000000, 0.000000 },
-	{ -0.034183, -0.033230, -0.030461, 0.821083, 0.473122, 0.319341, -0.372182, 0.867921, -0.328928, 1.000000, 0.716700, 0.858660, 9, 8, 10, 1, 0.925375, 0.071301, 0.003324, 0.000000 },
-	{ -0.033250, -0.037091, -0.029135, 0.891537, 0.096645, 0.442518, 0.019965, 0.967638, -0.251552, 1.000000, 0.703270, 0.858360, 9, 8, 1, 1, 0.873407, 0.126593, 0.000000, 0.000000 },
-	{ -0.035414, -0.036332, -0.024797, 0.912993, 0.064712, 0.402810, 0.041067, 0.967748, -0.248553, 1.000000, 0.702300, 0.843770, 9, 8, 1, 1, 0.678669, 0.321331, 0.000000, 0.000000 },
-	{ -0.033906, -0.041996, -0.029103, 0.798493, -0.322473, 0.508351, 0.438217, 0.890339, -0.123544, 1.000000, 0.688410, 0.861890, 9, 8, 10, 1, 0.903385, 0.094372, 0.002243, 0.000000 },
-	{ -0.036146, -0.040946, -0.024888, 0.796722, -0.363037, 0.483155, 0.475376, 0.870109, -0.130104, 1.000000, 0.687750, 0.847220, 9, 8, 1, 1, 0.706988, 0.293012, 0.000000, 0.000000 },
-	{ -0.036044, -0.045654, -0.030369, 0.529340, -0.702008, 0.476428, 0.762596, 0.639796, 0.095438, 1.000000, 0.676070, 0.866380, 9, 8, 10, 1, 0.920849, 0.073236, 0.005915, 0.000000 },
-	{ -0.038414, -0.044422, -0.026052, 0.525333, -0.713909, 0.462990, 0.787708, 0.613794, 0.052667, 1.000000, 0.675320, 0.851240, 9, 8, 1, 1, 0.734301, 0.265699, 0.000000, 0.000000 },
-	{ -0.038663, -0.047512, -0.031973, 0.237584, -0.903473, 0.356779, 0.900866, 0.342316, 0.266948, 1.000000, 0.665270, 0.869290, 9, 8, 10, 1, 0.956754, 0.037172, 0.006074, 0.000000 },
-	{ -0.041075, -0.046295, -0.027524, 0.247966, -0.895472, 0.369652, 0.917781, 0.339299, 0.206287, 1.000000, 0.664460, 0.854490, 9, 8, 1, 1, 0.797067, 0.202933, 0.000000, 0.000000 },
-	{ -0.037694, -0.030151, -0.027321, 0.691299, 0.707390, 0.147326, -0.631567, 0.690597, -0.352417, 1.000000, 0.724900, 0.845150, 9, 8, 1, 1, 0.772150, 0.227850, 0.000000, 0.000000 },
-	{ -0.035647, -0.030951, -0.032067, 0.648991, 0.742704, 0.164927, -0.621235, 0.642479, -0.448651, 1.000000, 0.726940, 0.860130, 9, 8, 10, 1, 0.940769, 0.054266, 0.004965, 0.000000 },
-	{ -0.037192, -0.031999, -0.022858, 0.902208, 0.410385, 0.132683, -0.364861, 0.890262, -0.272601, 1.000000, 0.714290, 0.835760, 8, 9, 1, 1, 0.623971, 0.376029, 0.000000, 0.000000 },
-	{ -0.038851, -0.029531, -0.023994, 0.720383, 0.691530, 0.053231, -0.644850, 0.696058, -0.315709, 1.000000, 0.724330, 0.836310, 8, 9, 1, 1, 0.528759, 0.471241, 0.000000, 0.000000 },
-	{ -0.036410, -0.035822, -0.022113, 0.967780, 0.006845, 0.251704, 0.054224, 0.970511, -0.234878, 1.000000, 0.701870, 0.836550, 8, 9, 1, 1, 0.535466, 0.464534, 0.000000, 0.000000 },
-	{ -0.037375, -0.040337, -0.022226, 0.838509, -0.417873, 0.349692, 0.485160, 0.864701, -0.130046, 1.000000, 0.687200, 0.839440, 8, 9, 1, 1, 0.540451, 0.459549, 0.000000, 0.000000 },
-	{ -0.039819, -0.043638, -0.023113, 0.566506, -0.743669, 0.355004, 0.787696, 0.615241, 0.031836, 1.000000, 0.674320, 0.842430, 8, 9, 1, 1, 0.524813, 0.475187, 0.000000, 0.000000 },
-	{ -0.042570, -0.045332, -0.024157, 0.287496, -0.910635, 0.296799, 0.928735, 0.340791, 0.145989, 1.000000, 0.664240, 0.844300, 9, 8, 1, 1, 0.530019, 0.469981, 0.000000, 0.000000 },
-	{ -0.040555, -0.028177, -0.025021, 0.507544, 0.861506, -0.014403, -0.806336, 0.469017, -0.360340, 1.000000, 0.731370, 0.836780, 9, 8, 1, 1, 0.505980, 0.494020, 0.000000, 0.000000 },
-	{ -0.039276, -0.028874, -0.028595, 0.488852, 0.872171, 0.018475, -0.790041, 0.451601, -0.414598, 1.000000, 0.731980, 0.846140, 9, 8, 1, 1, 0.792729, 0.207271, 0.000000, 0.000000 },
-	{ -0.037235, -0.029909, -0.033331, 0.444051, 0.895937, 0.010803, -0.761571, 0.383753, -0.522248, 1.000000, 0.733580, 0.860400, 9, 8, 10, 1, 0.941662, 0.055455, 0.002883, 0.000000 },
-	{ -0.040888, -0.048062, -0.033216, 0.006621, -0.976077, 0.217326, 0.930976, 0.085349, 0.354963, 1.000000, 0.657850, 0.870590, 9, 8, 10, 1, 0.977679, 0.020143, 0.002179, 0.000000 },
-	{ -0.043380, -0.046959, -0.028685, 0.037115, -0.965277, 0.258579, 0.942921, 0.119521, 0.310830, 1.000000, 0.656990, 0.855740, 9, 8, 1, 1, 0.884787, 0.115213, 0.000000, 0.000000 },
-	{ -0.044962, -0.046006, -0.025014, 0.072831, -0.969693, 0.233220, 0.965028, 0.127561, 0.229017, 1.000000, 0.656870, 0.845290, 9, 8, 1, 1, 0.644142, 0.355858, 0.000000, 0.000000 },
-	{ -0.034632, -0.031107, -0.038864, 0.391541, 0.920160, -0.001413, -0.779397, 0.330828, -0.532065, 1.000000, 0.735600, 0.878430, 9, 10, 8, 1, 0.965741, 0.025531, 0.008728, 0.000000 },
-	{ -0.032894, -0.032050, -0.037647, 0.608030, 0.777581, 0.160208, -0.626520, 0.593900, -0.504733, 1.000000, 0.728930, 0.878440, 9, 10, 8, 1, 0.952963, 0.040228, 0.006809, 0.000000 },
-	{ -0.032034, -0.032168, -0.043909, 0.350678, 0.936457, -0.008599, -0.770524, 0.283298, -0.570994, 1.000000, 0.737450, 0.894860, 9, 10, 1, 1, 0.879822, 0.120178, 0.000000, 0.000000 },
-	{ -0.030175, -0.033042, -0.042793, 0.571400, 0.805485, 0.157149, -0.619133, 0.548791, -0.561697, 1.000000, 0.730600, 0.895570, 9, 10, 1, 1, 0.855918, 0.144082, 0.000000, 0.000000 },
-	{ -0.031246, -0.034284, -0.036174, 0.802194, 0.496692, 0.331333, -0.361602, 0.845751, -0.392364, 1.000000, 0.719440, 0.878400, 9, 10, 8, 1, 0.946527, 0.046263, 0.007210, 0.000000 },
-	{ -0.028409, -0.035172, -0.041411, 0.785090, 0.516324, 0.342116, -0.330553, 0.816388, -0.473545, 1.000000, 0.721800, 0.896590, 9, 10, 1, 1, 0.819207, 0.180793, 0.000000, 0.000000 },
-	{ -0.030255, -0.038089, -0.034916, 0.882480, 0.116255, 0.455755, 0.009230, 0.964506, -0.263901, 1.000000, 0.705370, 0.878580, 9, 10, 8, 1, 0.956582, 0.023741, 0.019677, 0.000000 },
-	{ -0.027440, -0.038928, -0.040082, 0.876041, 0.129769, 0.464449, 0.023583, 0.950432, -0.310038, 1.000000, 0.707230, 0.897900, 9, 10, 1, 1, 0.819296, 0.180704, 0.000000, 0.000000 },
-	{ -0.030959, -0.043258, -0.034489, 0.808171, -0.287471, 0.514023, 0.400794, 0.907960, -0.122364, 1.000000, 0.689640, 0.881330, 9, 10, 8, 1, 0.949057, 0.038244, 0.012699, 0.000000 },
-	{ -0.028085, -0.044023, -0.039448, 0.824219, -0.237245, 0.514177, 0.339568, 0.933708, -0.113504, 1.000000, 0.691620, 0.899900, 9, 10, 1, 1, 0.859619, 0.140381, 0.000000, 0.000000 },
-	{ -0.032917, -0.046859, -0.035513, 0.550581, -0.691144, 0.468167, 0.725375, 0.673664, 0.141447, 1.000000, 0.677310, 0.884950, 9, 10, 8, 1, 0.941204, 0.052224, 0.006572, 0.000000 },
-	{ -0.029861, -0.047538, -0.040161, 0.579667, -0.669958, 0.463834, 0.672230, 0.714886, 0.192470, 1.000000, 0.679360, 0.901580, 9, 10, 1, 1, 0.834071, 0.165929, 0.000000, 0.000000 },
-	{ -0.035569, -0.048589, -0.036954, 0.243770, -0.914474, 0.322976, 0.881262, 0.347903, 0.319909, 1.000000, 0.666970, 0.886700, 9, 10, 8, 1, 0.960410, 0.037062, 0.002527, 0.000000 },
-	{ -0.032459, -0.049207, -0.041403, 0.257842, -0.918607, 0.299464, 0.862085, 0.358681, 0.357991, 1.000000, 0.669790, 0.901950, 9, 10, 1, 1, 0.858207, 0.141793, 0.000000, 0.000000 },
-	{ -0.037792, -0.049027, -0.038024, 0.004160, -0.984699, 0.174213, 0.909261, 0.076234, 0.409186, 1.000000, 0.659560, 0.886990, 9, 10, 8, 1, 0.976828, 0.019692, 0.003480, 0.000000 },
-	{ -0.034810, -0.049666, -0.042488, 0.024174, -0.987455, 0.156042, 0.907472, 0.087159, 0.410971, 1.000000, 0.661980, 0.902080, 9, 10, 1, 1, 0.893582, 0.106418, 0.000000, 0.000000 },
-	{ -0.029905, -0.049583, -0.044879, 0.263158, -0.915433, 0.304516, 0.862304, 0.364738, 0.351280, 1.000000, 0.672510, 0.913770, 9, 10, 1, 1, 0.673942, 0.326058, 0.000000, 0.000000 },
-	{ -0.032166, -0.050139, -0.046074, 0.051531, -0.983326, 0.174400, 0.910376, 0.118046, 0.396587, 1.000000, 0.664570, 0.914410, 9, 10, 1, 1, 0.690405, 0.309595, 0.000000, 0.000000 },
-	{ -0.029974, -0.050541, -0.048831, 0.046082, -0.974391, 0.220089, 0.907719, 0.132827, 0.398000, 1.000000, 0.666610, 0.923730, 10, 9, 1, 1, 0.548859, 0.451141, 0.000000, 0.000000 },
-	{ -0.027880, -0.049892, -0.047460, 0.235644, -0.903205, 0.358738, 0.871189, 0.359913, 0.333904, 1.000000, 0.674300, 0.922470, 10, 9, 1, 1, 0.529671, 0.470329, 0.000000, 0.000000 },
-	{ -0.027522, -0.048012, -0.043725, 0.584171, -0.655694, 0.478340, 0.670489, 0.721982, 0.170838, 1.000000, 0.681700, 0.913210, 9, 10, 1, 1, 0.693766, 0.306234, 0.000000, 0.000000 },
-	{ -0.025719, -0.048330, -0.046248, 0.540220, -0.636245, 0.550776, 0.694697, 0.706555, 0.134816, 1.000000, 0.683370, 0.921120, 10, 9, 1, 1, 0.531565, 0.468435, 0.000000, 0.000000 },
-	{ -0.024321, -0.045350, -0.045765, 0.775254, -0.155539, 0.612199, 0.324032, 0.929892, -0.174081, 1.000000, 0.694840, 0.919530, 10, 9, 1, 1, 0.630215, 0.369785, 0.000000, 0.000000 },
-	{ -0.025990, -0.044783, -0.043176, 0.825596, -0.199874, 0.527676, 0.315054, 0.939103, -0.137214, 1.000000, 0.693520, 0.911930, 9, 10, 1, 1, 0.659675, 0.340325, 0.000000, 0.000000 },
-	{ -0.023601, -0.039834, -0.046928, 0.815298, 0.169788, 0.553590, 0.011182, 0.951249, -0.308220, 1.000000, 0.709200, 0.918230, 10, 9, 1, 1, 0.668880, 0.331120, 0.000000, 0.000000 },
-	{ -0.025265, -0.039482, -0.044087, 0.867450, 0.138077, 0.477980, 0.027079, 0.946190, -0.322477, 1.000000, 0.708530, 0.910470, 9, 10, 1, 1, 0.525437, 0.474563, 0.000000, 0.000000 },
-	{ -0.024473, -0.036602, -0.048020, 0.749122, 0.541253, 0.381919, -0.356155, 0.815207, -0.456719, 1.000000, 0.722990, 0.917530, 10, 9, 1, 1, 0.634191, 0.365809, 0.000000, 0.000000 },
-	{ -0.026121, -0.035905, -0.045352, 0.776687, 0.524764, 0.348396, -0.330073, 0.810162, -0.484448, 1.000000, 0.723100, 0.909520, 9, 10, 1, 1, 0.584182, 0.415818, 0.000000, 0.000000 },
-	{ -0.026060, -0.034707, -0.049258, 0.555872, 0.815882, 0.159194, -0.624566, 0.536298, -0.567716, 1.000000, 0.731440, 0.916860, 10, 9, 1, 1, 0.581221, 0.418779, 0.000000, 0.000000 },
-	{ -0.027850, -0.033898, -0.046619, 0.559323, 0.815350, 0.149543, -0.612384, 0.528005, -0.588385, 1.000000, 0.731420, 0.908200, 9, 10, 1, 1, 0.639029, 0.360971, 0.000000, 0.000000 },
-	{ -0.029769, -0.033010, -0.047706, 0.339001, 0.940614, -0.017988, -0.758308, 0.261881, -0.596982, 1.000000, 0.738340, 0.907110, 9, 10, 1, 1, 0.680768, 0.319232, 0.000000, 0.000000 },
-	{ -0.027835, -0.033787, -0.050412, 0.350268, 0.936525, -0.015300, -0.759278, 0.274335, -0.590116, 1.000000, 0.738280, 0.916240, 10, 9, 1, 1, 0.529744, 0.470256, 0.000000, 0.000000 },
-	{ -0.025786, -0.050465, -0.049764, 0.206885, -0.889900, 0.406543, 0.877972, 0.352220, 0.324201, 1.000000, 0.675670, 0.930890, 10, 9, 1, 1, 0.737145, 0.262855, 0.000000, 0.000000 },
-	{ -0.027867, -0.051138, -0.051356, 0.013610, -0.967776, 0.251443, 0.908853, 0.116818, 0.400425, 1.000000, 0.667720, 0.932780, 10, 9, 1, 1, 0.737318, 0.262682, 0.000000, 0.000000 },
-	{ -0.025295, -0.051934, -0.054382, 0.015084, -0.972332, 0.233116, 0.920464, 0.104564, 0.376579, 1.000000, 0.669080, 0.944270, 10, 9, 1, 1, 0.895570, 0.104430, 0.000000, 0.000000 },
-	{ -0.023268, -0.051205, -0.052617, 0.228631, -0.891207, 0.391763, 0.885429, 0.357635, 0.296837, 1.000000, 0.677150, 0.941530, 10, 9, 1, 1, 0.897275, 0.102725, 0.000000, 0.000000 },
-	{ -0.023656, -0.048818, -0.048427, 0.515021, -0.609037, 0.603181, 0.701994, 0.703491, 0.110930, 1.000000, 0.684590, 0.929020, 10, 9, 1, 1, 0.781493, 0.218507, 0.000000, 0.000000 },
-	{ -0.021272, -0.049487, -0.051169, 0.551235, -0.602750, 0.576917, 0.696533, 0.713106, 0.079511, 1.000000, 0.685750, 0.938920, 10, 9, 1, 1, 0.915594, 0.084406, 0.000000, 0.000000 },
-	{ -0.020392, -0.051983, -0.056276, 0.278485, -0.894367, 0.350076, 0.891553, 0.376280, 0.252083, 1.000000, 0.679600, 0.954770, 10, 9, 1, 1, 0.979574, 0.020426, 0.000000, 0.000000 },
-	{ -0.018567, -0.050238, -0.054777, 0.605599, -0.599658, 0.523125, 0.679752, 0.731616, 0.051731, 1.000000, 0.687260, 0.951500, 10, 9, 1, 1, 0.982295, 0.017705, 0.000000, 0.000000 },
-	{ -0.019976, -0.046385, -0.050744, 0.762665, -0.134710, 0.632611, 0.325019, 0.925433, -0.194774, 1.000000, 0.696640, 0.936570, 10, 9, 1, 1, 0.940993, 0.059007, 0.000000, 0.000000 },
-	{ -0.017383, -0.047215, -0.054317, 0.800419, -0.164212, 0.576510, 0.320410, 0.930031, -0.179944, 1.000000, 0.697730, 0.949120, 10, 9, 1, 1, 0.987919, 0.012081, 0.000000, 0.000000 },
-	{ -0.019476, -0.041633, -0.051698, 0.801929, 0.184798, 0.568119, -0.004537, 0.952813, -0.303526, 1.000000, 0.709790, 0.935150, 10, 9, 1, 1, 0.939406, 0.060594, 0.000000, 0.000000 },
-	{ -0.016905, -0.042988, -0.055076, 0.835899, 0.160869, 0.524781, 0.000234, 0.955983, -0.293424, 1.000000, 0.710200, 0.947870, 10, 9, 1, 1, 0.990152, 0.009848, 0.000000, 0.000000 },
-	{ -0.020399, -0.038442, -0.052787, 0.743316, 0.544919, 0.388001, -0.383010, 0.822228, -0.421004, 1.000000, 0.722290, 0.934590, 10, 9, 1, 1, 0.925691, 0.074309, 0.000000, 0.000000 },
-	{ -0.017636, -0.039915, -0.056227, 0.772368, 0.511257, 0.376914, -0.358862, 0.840858, -0.405187, 1.000000, 0.721630, 0.947840, 10, 9, 1, 1, 0.987559, 0.012441, 0.000000, 0.000000 },
-	{ -0.021984, -0.036446, -0.054227, 0.583996, 0.792491, 0.175803, -0.627577, 0.578143, -0.521439, 1.000000, 0.731080, 0.934700, 10, 9, 1, 1, 0.910708, 0.089292, 0.000000, 0.000000 },
-	{ -0.018993, -0.037928, -0.057763, 0.618733, 0.761635, 0.192567, -0.603539, 0.617754, -0.504105, 1.000000, 0.730330, 0.948560, 10, 9, 1, 1, 0.977944, 0.022056, 0.000000, 0.000000 },
-	{ -0.022630, -0.037370, -0.050151, 0.725301, 0.552519, 0.410683, -0.375725, 0.817567, -0.436365, 1.000000, 0.722780, 0.925090, 10, 9, 1, 1, 0.799637, 0.200363, 0.000000, 0.000000 },
-	{ -0.024244, -0.035420, -0.051526, 0.556992, 0.811395, 0.177196, -0.628938, 0.551429, -0.548054, 1.000000, 0.731310, 0.924790, 10, 9, 1, 1, 0.778429, 0.221571, 0.000000, 0.000000 },
-	{ -0.021717, -0.040583, -0.049079, 0.775961, 0.187214, 0.602358, 0.003996, 0.953463, -0.301486, 1.000000, 0.709470, 0.925710, 10, 9, 1, 1, 0.809798, 0.190202, 0.000000, 0.000000 },
-	{ -0.022301, -0.045779, -0.047984, 0.733760, -0.122786, 0.668221, 0.325929, 0.926587, -0.187636, 1.000000, 0.695740, 0.927110, 10, 9, 1, 1, 0.842126, 0.157874, 0.000000, 0.000000 },
-	{ -0.025942, -0.034503, -0.052842, 0.367420, 0.930049, -0.003275, -0.762921, 0.299378, -0.572996, 1.000000, 0.738200, 0.924720, 10, 9, 1, 1, 0.712506, 0.287494, 0.000000, 0.000000 },
-	{ -0.023580, -0.035480, -0.055663, 0.407520, 0.913127, 0.011234, -0.760974, 0.346365, -0.548589, 1.000000, 0.738120, 0.935230, 10, 9, 1, 1, 0.888981, 0.111019, 0.000000, 0.000000 },
-	{ -0.020397, -0.036892, -0.059330, 0.456388, 0.888714, 0.043569, -0.739264, 0.405980, -0.537279, 1.000000, 0.737330, 0.949660, 10, 9, 1, 1, 0.982003, 0.017997, 0.000000, 0.000000 },
-	{ -0.014762, -0.041455, -0.060259, 0.827849, 0.447479, 0.338273, -0.324437, 0.873889, -0.362021, 1.000000, 0.720650, 0.962670, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014352, -0.044389, -0.059072, 0.886067, 0.115125, 0.449034, 0.010194, 0.963597, -0.267165, 1.000000, 0.710420, 0.962000, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013049, -0.042921, -0.063656, 0.905696, 0.346382, 0.244404, -0.266907, 0.913836, -0.306047, 1.000000, 0.718670, 0.973770, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012831, -0.045444, -0.062754, 0.946725, 0.043802, 0.319052, 0.032118, 0.972926, -0.228876, 1.000000, 0.710320, 0.973230, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012443, -0.043995, -0.065461, 0.976228, 0.201338, 0.080265, -0.173605, 0.948043, -0.266603, 1.000000, 0.716590, 0.979540, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012643, -0.043390, -0.066748, 0.944188, 0.305924, -0.122142, -0.328207, 0.905297, -0.269663, 1.000000, 0.719280, 0.982480, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012310, -0.045986, -0.065327, 0.994331, -0.040117, 0.098469, 0.060548, 0.974906, -0.214226, 1.000000, 0.710360, 0.980480, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012411, -0.046072, -0.067227, 0.981735, -0.044691, -0.184927, 0.004239, 0.976916, -0.213584, 1.000000, 0.711080, 0.985870, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012849, -0.048866, -0.066961, 0.933089, -0.324522, -0.155015, 0.301053, 0.940597, -0.156988, 1.000000, 0.702110, 0.986650, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012710, -0.048533, -0.065007, 0.961047, -0.251678, 0.114224, 0.268274, 0.948840, -0.166531, 1.000000, 0.702410, 0.981020, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013979, -0.051021, -0.065912, 0.754614, -0.655380, -0.032170, 0.652326, 0.754591, -0.071158, 1.000000, 0.694010, 0.984510, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013511, -0.050295, -0.064647, 0.848267, -0.512794, 0.132235, 0.524731, 0.847569, -0.079276, 1.000000, 0.696300, 0.980740, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013609, -0.041301, -0.065039, 0.800703, 0.593350, 0.082527, -0.538812, 0.773518, -0.333695, 1.000000, 0.724680, 0.976000, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013256, -0.048348, -0.062312, 0.913352, -0.226739, 0.338199, 0.288853, 0.946220, -0.145712, 1.000000, 0.701210, 0.973570, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014327, -0.050734, -0.062518, 0.764343, -0.569971, 0.301518, 0.604630, 0.796015, -0.027992, 1.000000, 0.693220, 0.974630, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015469, -0.052205, -0.063681, 0.516958, -0.839729, 0.166163, 0.848884, 0.527900, 0.026814, 1.000000, 0.687810, 0.978080, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014382, -0.040347, -0.066579, 0.704333, 0.706874, -0.065146, -0.683822, 0.650994, -0.329536, 1.000000, 0.729350, 0.979120, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013172, -0.042816, -0.068239, 0.891809, 0.360981, -0.272709, -0.430575, 0.862246, -0.266717, 1.000000, 0.722450, 0.986220, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.012865, -0.045934, -0.068849, 0.926136, -0.021264, -0.376590, -0.061830, 0.976346, -0.207185, 1.000000, 0.712430, 0.990740, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.013414, -0.049123, -0.068604, 0.863155, -0.367389, -0.346393, 0.335739, 0.929977, -0.149737, 1.000000, 0.701450, 0.991710, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.014717, -0.051650, -0.067476, 0.661324, -0.728449, -0.178922, 0.727197, 0.681119, -0.085218, 1.000000, 0.691610, 0.989250, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016630, -0.052985, -0.065311, 0.340012, -0.939669, 0.037610, 0.939997, 0.340787, 0.016403, 1.000000, 0.683850, 0.983070, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.015747, -0.039564, -0.061866, 0.682983, 0.707673, 0.180921, -0.594973, 0.682671, -0.424227, 1.000000, 0.728330, 0.964530, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016858, -0.038530, -0.063493, 0.535594, 0.843379, 0.043017, -0.752118, 0.499562, -0.429832, 1.000000, 0.734390, 0.966980, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019196, -0.053159, -0.062072, 0.132315, -0.980488, 0.145385, 0.968003, 0.159371, 0.193831, 1.000000, 0.677080, 0.972020, 10, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017588, -0.052466, -0.060302, 0.367712, -0.886256, 0.281669, 0.893189, 0.420898, 0.158295, 1.000000, 0.683290, 0.967930, 10, 9, 1, 1, 0.998931, 0.001069, 0.000000, 0.000000 },
-	{ -0.016016, -0.050828, -0.058910, 0.676818, -0.596415, 0.431517, 0.653222, 0.756860, 0.021529, 1.000000, 0.689850, 0.964620, 10, 9, 1, 1, 0.998798, 0.001202, 0.000000, 0.000000 },
-	{ -0.014823, -0.047980, -0.058490, 0.852219, -0.200269, 0.483338, 0.309744, 0.937664, -0.157623, 1.000000, 0.699220, 0.962800, 10, 9, 1, 1, 0.998984, 0.001016, 0.000000, 0.000000 },
-	{ -0.022303, -0.052692, -0.058120, 0.046938, -0.979870, 0.194040, 0.937354, 0.110338, 0.330444, 1.000000, 0.671870, 0.957990, 10, 9, 1, 1, 0.980475, 0.019525, 0.000000, 0.000000 },
-	{ -0.042509, -0.049640, 0.007424, 0.674099, 0.176747, -0.717183, 0.108070, 0.936900, 0.332474, 1.000000, 0.642060, 0.750270, 17, 8, 1, 1, 0.950840, 0.035086, 0.014074, 0.000000 },
-	{ -0.042391, -0.051158, 0.005879, 0.751907, 0.595952, -0.281917, -0.330482, 0.710732, 0.621000, 1.000000, 0.636250, 0.751260, 17, 1, 1, 1, 0.997558, 0.002442, 0.000000, 0.000000 },
-	{ -0.039525, -0.054727, 0.008237, 0.920973, 0.348693, -0.173841, -0.214145, 0.825748, 0.521807, 1.000000, 0.627630, 0.736720, 17, 1, 1, 1, 0.994422, 0.005578, 0.000000, 0.000000 },
-	{ -0.039210, -0.053599, 0.010050, 0.798437, 0.037518, -0.600908, 0.192761, 0.929593, 0.314166, 1.000000, 0.632300, 0.733870, 17, 1, 8, 1, 0.960519, 0.025968, 0.013514, 0.000000 },
-	{ -0.038398, -0.059171, 0.010296, 0.998241, 0.007068, -0.058870, 0.011820, 0.949215, 0.314405, 1.000000, 0.615090, 0.725400, 17, 1, 1, 1, 0.992297, 0.007703, 0.000000, 0.000000 },
-	{ -0.037879, -0.058436, 0.012586, 0.867355, -0.201885, -0.454905, 0.328734, 0.918658, 0.219091, 1.000000, 0.618560, 0.720290, 17, 1, 13, 1, 0.951066, 0.029109, 0.019825, 0.000000 },
-	{ -0.039056, -0.062862, 0.011295, 0.918586, -0.392062, 0.049870, 0.376792, 0.906835, 0.188890, 1.000000, 0.604300, 0.720860, 17, 13, 1, 1, 0.954673, 0.039509, 0.005819, 0.000000 },
-	{ -0.038832, -0.062575, 0.014251, 0.807161, -0.483732, -0.338372, 0.545017, 0.830871, 0.112295, 1.000000, 0.605810, 0.713480, 17, 13, 1, 12, 0.781967, 0.193216, 0.019254, 0.005562 },
-	{ -0.040853, -0.065260, 0.011353, 0.714594, -0.689969, 0.115323, 0.678064, 0.723713, 0.128327, 1.000000, 0.595180, 0.719480, 17, 13, 1, 1, 0.922837, 0.074855, 0.002309, 0.000000 },
-	{ -0.040940, -0.065147, 0.014574, 0.671576, -0.713713, -0.198995, 0.720612, 0.691630, -0.048641, 1.000000, 0.595220, 0.712060, 17, 13, 1, 12, 0.709344, 0.281487, 0.007380, 0.001789 },
-	{ -0.046031, -0.047658, 0.005561, 0.515475, 0.309806, -0.798940, 0.051575, 0.919450, 0.389811, 1.000000, 0.644830, 0.762670, 17, 8, 1, 1, 0.969853, 0.026815, 0.003332, 0.000000 },
-	{ -0.045459, -0.049244, 0.004208, 0.540241, 0.744378, -0.392481, -0.366771, 0.628055, 0.686314, 1.000000, 0.639540, 0.762210, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.048586, -0.046904, 0.004687, 0.301066, 0.489357, -0.818467, -0.029764, 0.862693, 0.504851, 1.000000, 0.644240, 0.769890, 17, 8, 1, 1, 0.956189, 0.043811, 0.000000, 0.000000 },
-	{ -0.047952, -0.048470, 0.003280, 0.320635, 0.810278, -0.490554, -0.379137, 0.584387, 0.717458, 1.000000, 0.640390, 0.769610, 17, 8, 1, 1, 0.998328, 0.001672, 0.000000, 0.000000 },
-	{ -0.042609, -0.066732, 0.010825, 0.520155, -0.842069, 0.142686, 0.816592, 0.539287, 0.205783, 1.000000, 0.587810, 0.719890, 17, 13, 1, 1, 0.915492, 0.084508, 0.000000, 0.000000 },
-	{ -0.042816, -0.066509, 0.014189, 0.517271, -0.854694, -0.043920, 0.845096, 0.518215, -0.131405, 1.000000, 0.588280, 0.713430, 17, 13, 1, 12, 0.664890, 0.332306, 0.001752, 0.001053 },
-	{ -0.041515, -0.052852, 0.003036, 0.754611, 0.646075, -0.114670, -0.517803, 0.693660, 0.500715, 1.000000, 0.626500, 0.755190, 17, 18, 1, 1, 0.998938, 0.001062, 0.000000, 0.000000 },
-	{ -0.039074, -0.056221, 0.005189, 0.925784, 0.377520, -0.020055, -0.337185, 0.848534, 0.407796, 1.000000, 0.619020, 0.742970, 17, 18, 1, 1, 0.998967, 0.001033, 0.000000, 0.000000 },
-	{ -0.040449, -0.054475, -0.001082, 0.773764, 0.627007, -0.090293, -0.537533, 0.725290, 0.430132, 1.000000, 0.614870, 0.763640, 17, 18, 1, 1, 0.989689, 0.010311, 0.000000, 0.000000 },
-	{ -0.038422, -0.057752, 0.000749, 0.939977, 0.341225, -0.003023, -0.314757, 0.870417, 0.378553, 1.000000, 0.608000, 0.753770, 17, 18, 1, 1, 0.989603, 0.010397, 0.000000, 0.000000 },
-	{ -0.039848, -0.055916, -0.005156, 0.794865, 0.592745, -0.129783, -0.507034, 0.766317, 0.394558, 1.000000, 0.605690, 0.772980, 17, 18, 1, 1, 0.947307, 0.052693, 0.000000, 0.000000 },
-	{ -0.042110, -0.054223, -0.006342, 0.532224, 0.811769, -0.240352, -0.677269, 0.578599, 0.454455, 1.000000, 0.610530, 0.779580, 17, 18, 1, 1, 0.942176, 0.057824, 0.000000, 0.000000 },
-	{ -0.042936, -0.052653, -0.002530, 0.523074, 0.826810, -0.206829, -0.677423, 0.550591, 0.487800, 1.000000, 0.619240, 0.771450, 17, 18, 1, 1, 0.989990, 0.010010, 0.000000, 0.000000 },
-	{ -0.038124, -0.059010, -0.003780, 0.952769, 0.301581, -0.035769, -0.268383, 0.891247, 0.365582, 1.000000, 0.598650, 0.765210, 17, 18, 1, 1, 0.944352, 0.055648, 0.000000, 0.000000 },
-	{ -0.037834, -0.061753, 0.002081, 0.997595, -0.004946, 0.069129, -0.016469, 0.951960, 0.305778, 1.000000, 0.598950, 0.746120, 17, 18, 1, 1, 0.994187, 0.005813, 0.000000, 0.000000 },
-	{ -0.037621, -0.062808, -0.002737, 0.998730, -0.022526, 0.045061, 0.005362, 0.936917, 0.349510, 1.000000, 0.589940, 0.758330, 17, 18, 1, 1, 0.956374, 0.043626, 0.000000, 0.000000 },
-	{ -0.038630, -0.064977, 0.002384, 0.912456, -0.383679, 0.142179, 0.320596, 0.886288, 0.334233, 1.000000, 0.590610, 0.742620, 17, 18, 1, 1, 0.988280, 0.011720, 0.000000, 0.000000 },
-	{ -0.038365, -0.065943, -0.002488, 0.923193, -0.362822, 0.126786, 0.284219, 0.866551, 0.410255, 1.000000, 0.581890, 0.754380, 17, 18, 1, 1, 0.920274, 0.079726, 0.000000, 0.000000 },
-	{ -0.039703, -0.068144, -0.002748, 0.745586, -0.638120, 0.192105, 0.473512, 0.710123, 0.521068, 1.000000, 0.574900, 0.751760, 17, 18, 1, 1, 0.898080, 0.101920, 0.000000, 0.000000 },
-	{ -0.040124, -0.067191, 0.001932, 0.716913, -0.667674, 0.200620, 0.543123, 0.715303, 0.439726, 1.000000, 0.582650, 0.741080, 17, 18, 1, 1, 0.983825, 0.016175, 0.000000, 0.000000 },
-	{ -0.045469, -0.051950, -0.003452, 0.273488, 0.910278, -0.310803, -0.729654, 0.406874, 0.549599, 1.000000, 0.623160, 0.778140, 17, 18, 1, 1, 0.984331, 0.015669, 0.000000, 0.000000 },
-	{ -0.044466, -0.053528, -0.007255, 0.283668, 0.905075, -0.316817, -0.745407, 0.415965, 0.520904, 1.000000, 0.614750, 0.785790, 17, 18, 1, 1, 0.925165, 0.074835, 0.000000, 0.000000 },
-	{ -0.041227, -0.069544, -0.003088, 0.525861, -0.820082, 0.225691, 0.579163, 0.539556, 0.611105, 1.000000, 0.569360, 0.749240, 17, 18, 1, 1, 0.879654, 0.120346, 0.000000, 0.000000 },
-	{ -0.041743, -0.068574, 0.001359, 0.498113, -0.835560, 0.231781, 0.652038, 0.536987, 0.535249, 1.000000, 0.576280, 0.739560, 17, 18, 1, 1, 0.979178, 0.020822, 0.000000, 0.000000 },
-	{ -0.044227, -0.050973, 0.001378, 0.524857, 0.818779, -0.232648, -0.597260, 0.548997, 0.584707, 1.000000, 0.630100, 0.764350, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.046781, -0.050224, 0.000394, 0.291920, 0.890163, -0.349848, -0.613515, 0.454890, 0.645503, 1.000000, 0.632780, 0.771820, 17, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.042247, -0.067520, 0.006274, 0.498756, -0.841302, 0.208458, 0.718384, 0.535814, 0.443653, 1.000000, 0.583190, 0.729150, 17, 13, 18, 1, 0.990486, 0.007807, 0.001707, 0.000000 },
-	{ -0.040547, -0.066089, 0.006937, 0.706168, -0.681600, 0.191696, 0.608822, 0.722750, 0.327059, 1.000000, 0.590340, 0.729880, 17, 13, 18, 1, 0.989771, 0.008606, 0.001623, 0.000000 },
-	{ -0.038896, -0.063813, 0.007317, 0.914401, -0.378781, 0.142815, 0.339842, 0.909978, 0.237588, 1.000000, 0.598960, 0.730870, 17, 13, 1, 18, 0.993258, 0.004395, 0.001177, 0.001171 },
-	{ -0.038203, -0.060423, 0.006813, 0.997507, 0.027862, 0.064832, -0.044064, 0.963551, 0.263871, 1.000000, 0.607950, 0.734180, 17, 1, 1, 1, 0.998695, 0.001305, 0.000000, 0.000000 },
-	{ -0.038614, -0.058905, -0.013613, 0.713120, 0.684813, 0.149970, -0.680698, 0.625234, 0.381750, 1.000000, 0.589310, 0.792380, 18, 17, 1, 1, 0.712480, 0.287520, 0.000000, 0.000000 },
-	{ -0.036768, -0.059585, -0.017343, 0.691603, 0.696749, 0.190331, -0.715760, 0.625818, 0.309903, 1.000000, 0.581460, 0.801490, 18, 17, 1, 1, 0.902778, 0.097222, 0.000000, 0.000000 },
-	{ -0.035239, -0.062216, -0.015983, 0.836093, 0.437150, 0.331432, -0.536782, 0.776579, 0.329834, 1.000000, 0.574260, 0.794460, 18, 17, 19, 1, 0.930916, 0.065965, 0.003119, 0.000000 },
-	{ -0.037148, -0.061469, -0.012397, 0.861096, 0.412226, 0.297630, -0.504952, 0.761828, 0.405761, 1.000000, 0.582180, 0.785570, 18, 17, 1, 1, 0.735062, 0.264938, 0.000000, 0.000000 },
-	{ -0.034543, -0.065705, -0.015084, 0.882464, 0.125087, 0.453443, -0.317373, 0.869838, 0.377698, 1.000000, 0.565210, 0.787890, 18, 17, 19, 1, 0.927229, 0.066715, 0.006056, 0.000000 },
-	{ -0.036515, -0.064849, -0.011607, 0.905612, 0.094211, 0.413511, -0.292549, 0.844680, 0.448254, 1.000000, 0.573290, 0.778890, 18, 17, 1, 1, 0.804511, 0.195489, 0.000000, 0.000000 },
-	{ -0.034981, -0.068837, -0.014898, 0.816172, -0.226673, 0.531491, -0.081083, 0.865807, 0.493766, 1.000000, 0.557500, 0.782690, 18, 17, 19, 1, 0.912383, 0.082855, 0.004762, 0.000000 },
-	{ -0.036958, -0.067841, -0.011474, 0.834799, -0.256884, 0.486951, -0.054427, 0.841635, 0.537297, 1.000000, 0.565460, 0.774110, 18, 17, 1, 1, 0.776984, 0.223016, 0.000000, 0.000000 },
-	{ -0.036033, -0.071143, -0.015225, 0.655254, -0.530853, 0.537436, 0.098150, 0.765248, 0.636209, 1.000000, 0.550820, 0.778760, 18, 17, 19, 1, 0.913637, 0.083737, 0.002625, 0.000000 },
-	{ -0.038012, -0.069977, -0.011796, 0.668276, -0.548291, 0.502777, 0.121120, 0.747029, 0.653664, 1.000000, 0.559140, 0.770430, 18, 17, 1, 1, 0.760151, 0.239849, 0.000000, 0.000000 },
-	{ -0.040285, -0.057599, -0.014955, 0.472244, 0.881380, -0.012420, -0.808599, 0.438772, 0.391979, 1.000000, 0.593750, 0.798360, 18, 17, 1, 1, 0.752275, 0.247725, 0.000000, 0.000000 },
-	{ -0.038457, -0.058326, -0.018761, 0.442570, 0.896405, 0.024287, -0.859785, 0.416484, 0.295484, 1.000000, 0.585820, 0.807330, 18, 17, 1, 1, 0.943135, 0.056865, 0.000000, 0.000000 },
-	{ -0.041969, -0.057074, -0.016257, 0.270753, 0.953602, -0.131670, -0.863634, 0.301042, 0.404363, 1.000000, 0.597290, 0.804050, 18, 17, 1, 1, 0.788784, 0.211216, 0.000000, 0.000000 },
-	{ -0.040190, -0.057903, -0.019964, 0.212287, 0.970168, -0.117085, -0.921872, 0.238570, 0.305347, 1.000000, 0.589970, 0.812310, 18, 17, 1, 1, 0.945277, 0.054723, 0.000000, 0.000000 },
-	{ -0.037390, -0.072617, -0.015700, 0.465171, -0.739621, 0.486392, 0.202205, 0.623711, 0.755048, 1.000000, 0.546020, 0.775030, 18, 17, 19, 1, 0.936955, 0.060282, 0.002763, 0.000000 },
-	{ -0.039296, -0.071393, -0.012247, 0.485791, -0.734163, 0.474355, 0.212379, 0.625572, 0.750703, 1.000000, 0.554190, 0.767140, 18, 17, 1, 1, 0.795883, 0.204117, 0.000000, 0.000000 },
-	{ -0.034416, -0.060734, -0.022372, 0.702954, 0.691017, 0.168378, -0.708825, 0.661182, 0.245776, 1.000000, 0.570370, 0.814220, 18, 19, 17, 1, 0.964978, 0.022171, 0.012851, 0.000000 },
-	{ -0.032693, -0.063500, -0.021091, 0.835631, 0.457137, 0.304543, -0.536991, 0.796537, 0.277793, 1.000000, 0.561860, 0.807870, 18, 19, 17, 1, 0.947810, 0.040891, 0.011299, 0.000000 },
-	{ -0.032066, -0.062097, -0.027145, 0.702270, 0.691686, 0.168488, -0.711789, 0.677814, 0.184188, 1.000000, 0.558600, 0.826650, 18, 19, 1, 1, 0.854218, 0.145782, 0.000000, 0.000000 },
-	{ -0.030239, -0.064811, -0.025972, 0.825529, 0.476362, 0.302625, -0.552116, 0.792780, 0.258201, 1.000000, 0.549580, 0.821010, 18, 19, 1, 1, 0.821504, 0.178496, 0.000000, 0.000000 },
-	{ -0.033942, -0.060528, -0.028101, 0.464468, 0.885313, -0.022147, -0.868885, 0.460398, 0.181858, 1.000000, 0.564990, 0.830470, 18, 19, 1, 1, 0.897675, 0.102325, 0.000000, 0.000000 },
-	{ -0.036175, -0.059322, -0.023610, 0.451714, 0.892163, 0.000035, -0.867845, 0.439392, 0.231905, 1.000000, 0.575290, 0.819240, 18, 19, 17, 1, 0.980508, 0.014890, 0.004602, 0.000000 },
-	{ -0.035850, -0.060119, -0.028881, 0.179188, 0.963484, -0.198976, -0.951816, 0.220939, 0.212676, 1.000000, 0.569930, 0.833800, 18, 19, 1, 1, 0.929101, 0.070899, 0.000000, 0.000000 },
-	{ -0.038008, -0.058934, -0.024551, 0.181271, 0.971198, -0.154648, -0.947986, 0.214402, 0.235274, 1.000000, 0.580070, 0.823010, 18, 19, 17, 1, 0.984462, 0.008458, 0.007081, 0.000000 },
-	{ -0.031825, -0.066968, -0.020067, 0.888157, 0.154714, 0.432714, -0.330734, 0.868954, 0.368150, 1.000000, 0.552970, 0.801120, 18, 19, 17, 1, 0.925068, 0.064175, 0.010757, 0.000000 },
-	{ -0.029316, -0.068092, -0.024910, 0.890593, 0.179544, 0.417860, -0.351063, 0.855491, 0.380643, 1.000000, 0.540950, 0.814440, 18, 19, 1, 1, 0.740892, 0.259108, 0.000000, 0.000000 },
-	{ -0.032236, -0.070059, -0.019636, 0.833429, -0.199262, 0.515452, -0.108428, 0.855640, 0.506087, 1.000000, 0.545570, 0.795150, 18, 19, 17, 1, 0.943815, 0.043071, 0.013114, 0.000000 },
-	{ -0.029661, -0.071071, -0.024298, 0.855297, -0.176106, 0.487293, -0.129589, 0.837874, 0.530259, 1.000000, 0.533950, 0.807930, 18, 19, 1, 1, 0.791680, 0.208320, 0.000000, 0.000000 },
-	{ -0.033350, -0.072331, -0.019704, 0.676085, -0.521070, 0.520957, 0.081020, 0.755316, 0.650334, 1.000000, 0.539630, 0.790140, 18, 19, 17, 1, 0.950045, 0.037986, 0.011970, 0.000000 },
-	{ -0.030764, -0.073303, -0.024130, 0.710460, -0.504730, 0.490402, 0.074625, 0.746958, 0.660670, 1.000000, 0.528670, 0.802350, 18, 19, 1, 1, 0.811460, 0.188540, 0.000000, 0.000000 },
-	{ -0.034819, -0.073749, -0.020059, 0.472194, -0.750278, 0.462727, 0.218499, 0.608173, 0.763140, 1.000000, 0.535370, 0.785870, 18, 19, 17, 1, 0.953573, 0.039769, 0.006659, 0.000000 },
-	{ -0.032228, -0.074702, -0.024328, 0.501079, -0.746733, 0.437390, 0.227141, 0.601182, 0.766151, 1.000000, 0.524640, 0.797760, 18, 19, 1, 1, 0.815368, 0.184632, 0.000000, 0.000000 },
-	{ -0.028805, -0.073801, -0.027811, 0.737469, -0.479360, 0.475766, 0.015606, 0.716348, 0.697569, 1.000000, 0.520470, 0.811790, 18, 19, 1, 1, 0.558531, 0.441469, 0.000000, 0.000000 },
-	{ -0.030089, -0.075222, -0.027957, 0.545377, -0.724114, 0.422165, 0.178358, 0.592383, 0.785666, 1.000000, 0.516590, 0.807490, 18, 19, 1, 1, 0.560181, 0.439819, 0.000000, 0.000000 },
-	{ -0.028319, -0.075555, -0.030776, 0.521860, -0.693558, 0.496629, 0.083459, 0.620913, 0.779424, 1.000000, 0.511200, 0.814530, 19, 18, 1, 1, 0.667568, 0.332432, 0.000000, 0.000000 },
-	{ -0.027196, -0.074101, -0.030539, 0.674322, -0.452328, 0.583685, -0.081850, 0.739779, 0.667854, 1.000000, 0.515440, 0.818490, 19, 18, 1, 1, 0.674636, 0.325364, 0.000000, 0.000000 },
-	{ -0.027804, -0.071650, -0.028016, 0.855097, -0.167347, 0.490717, -0.181333, 0.790169, 0.585449, 1.000000, 0.525770, 0.817720, 18, 19, 1, 1, 0.531650, 0.468350, 0.000000, 0.000000 },
-	{ -0.026292, -0.072015, -0.030550, 0.764741, -0.157985, 0.624670, -0.280842, 0.790815, 0.543820, 1.000000, 0.521180, 0.823620, 19, 18, 1, 1, 0.730684, 0.269316, 0.000000, 0.000000 },
-	{ -0.025968, -0.069420, -0.030904, 0.787234, 0.190693, 0.586429, -0.492040, 0.767468, 0.410963, 1.000000, 0.527920, 0.829190, 19, 18, 1, 1, 0.756530, 0.243470, 0.000000, 0.000000 },
-	{ -0.027455, -0.068909, -0.028563, 0.874660, 0.183398, 0.448703, -0.394073, 0.808056, 0.437894, 1.000000, 0.532420, 0.824110, 19, 18, 1, 1, 0.527372, 0.472628, 0.000000, 0.000000 },
-	{ -0.026632, -0.066584, -0.031813, 0.734217, 0.493778, 0.465949, -0.657694, 0.687559, 0.307735, 1.000000, 0.535580, 0.835500, 19, 18, 1, 1, 0.705762, 0.294238, 0.000000, 0.000000 },
-	{ -0.028260, -0.065874, -0.029499, 0.803762, 0.482070, 0.348676, -0.581857, 0.759206, 0.291631, 1.000000, 0.540900, 0.830230, 18, 19, 1, 1, 0.574087, 0.425913, 0.000000, 0.000000 },
-	{ -0.028041, -0.064160, -0.033049, 0.625657, 0.720883, 0.298129, -0.779677, 0.590409, 0.208616, 1.000000, 0.542740, 0.841650, 19, 18, 1, 1, 0.676229, 0.323771, 0.000000, 0.000000 },
-	{ -0.029900, -0.063294, -0.030635, 0.680799, 0.702920, 0.205952, -0.732416, 0.656707, 0.179729, 1.000000, 0.549080, 0.835780, 18, 19, 1, 1, 0.610757, 0.389243, 0.000000, 0.000000 },
-	{ -0.029845, -0.062792, -0.034112, 0.409350, 0.911542, 0.039039, -0.904436, 0.399783, 0.148896, 1.000000, 0.548350, 0.845680, 19, 18, 1, 1, 0.623068, 0.376932, 0.000000, 0.000000 },
-	{ -0.031836, -0.061793, -0.031557, 0.456771, 0.889358, -0.020067, -0.878821, 0.454628, 0.144866, 1.000000, 0.555680, 0.839190, 18, 19, 1, 1, 0.670116, 0.329884, 0.000000, 0.000000 },
-	{ -0.027827, -0.063374, -0.036443, 0.370937, 0.925164, 0.080481, -0.921147, 0.355552, 0.158339, 1.000000, 0.542320, 0.851640, 19, 18, 1, 1, 0.855227, 0.144773, 0.000000, 0.000000 },
-	{ -0.026052, -0.064708, -0.035319, 0.592547, 0.734635, 0.330455, -0.804981, 0.555242, 0.209072, 1.000000, 0.537290, 0.847420, 19, 18, 1, 1, 0.885336, 0.114664, 0.000000, 0.000000 },
-	{ -0.024501, -0.067105, -0.034061, 0.706712, 0.503426, 0.497112, -0.677918, 0.682893, 0.272185, 1.000000, 0.529860, 0.841330, 19, 18, 1, 1, 0.897489, 0.102511, 0.000000, 0.000000 },
-	{ -0.023723, -0.069949, -0.033189, 0.764713, 0.182358, 0.618029, -0.483614, 0.796256, 0.363449, 1.000000, 0.522370, 0.835750, 19, 18, 1, 1, 0.901322, 0.098678, 0.000000, 0.000000 },
-	{ -0.024003, -0.072667, -0.032933, 0.731686, -0.172961, 0.659333, -0.270672, 0.814020, 0.513915, 1.000000, 0.515280, 0.830530, 19, 18, 1, 1, 0.912206, 0.087794, 0.000000, 0.000000 },
-	{ -0.024967, -0.074838, -0.033097, 0.621838, -0.468421, 0.627614, -0.084990, 0.756304, 0.648677, 1.000000, 0.509240, 0.825640, 19, 18, 1, 1, 0.868297, 0.131703, 0.000000, 0.000000 },
-	{ -0.033849, -0.061294, -0.032290, 0.191099, 0.955838, -0.223281, -0.953608, 0.234697, 0.188546, 1.000000, 0.561480, 0.842320, 18, 19, 1, 1, 0.741905, 0.258095, 0.000000, 0.000000 },
-	{ -0.031882, -0.062320, -0.034942, 0.173816, 0.965621, -0.193298, -0.962547, 0.208059, 0.173825, 1.000000, 0.554100, 0.849090, 19, 18, 1, 1, 0.537732, 0.462268, 0.000000, 0.000000 },
-	{ -0.029866, -0.063034, -0.037361, 0.132654, 0.980272, -0.146525, -0.975244, 0.155478, 0.157247, 1.000000, 0.547810, 0.855200, 19, 18, 1, 1, 0.795239, 0.204761, 0.000000, 0.000000 },
-	{ -0.026213, -0.076267, -0.033511, 0.460607, -0.703732, 0.540928, 0.065650, 0.634766, 0.769911, 1.000000, 0.504890, 0.821590, 19, 18, 1, 1, 0.871110, 0.128890, 0.000000, 0.000000 },
-	{ -0.025539, -0.064077, -0.039248, 0.393431, 0.917565, 0.057331, -0.905809, 0.376215, 0.194863, 1.000000, 0.535830, 0.858360, 19, 18, 1, 1, 0.966389, 0.033611, 0.000000, 0.000000 },
-	{ -0.027509, -0.063713, -0.040192, 0.133370, 0.979623, -0.150173, -0.965042, 0.162864, 0.205349, 1.000000, 0.540720, 0.862360, 19, 18, 1, 1, 0.947947, 0.052053, 0.000000, 0.000000 },
-	{ -0.022829, -0.065129, -0.042946, 0.457294, 0.889227, 0.012571, -0.861420, 0.439394, 0.254732, 1.000000, 0.526440, 0.867190, 19, 18, 1, 1, 0.995699, 0.004301, 0.000000, 0.000000 },
-	{ -0.021050, -0.066554, -0.042131, 0.703844, 0.684961, 0.188233, -0.705804, 0.644390, 0.294284, 1.000000, 0.520930, 0.863360, 19, 18, 1, 1, 0.996739, 0.003261, 0.000000, 0.000000 },
-	{ -0.023630, -0.065425, -0.038265, 0.632056, 0.726777, 0.268889, -0.774859, 0.588276, 0.231356, 1.000000, 0.530220, 0.854470, 19, 18, 1, 1, 0.973873, 0.026127, 0.000000, 0.000000 },
-	{ -0.019535, -0.068930, -0.041370, 0.854676, 0.425014, 0.298146, -0.513827, 0.774607, 0.368734, 1.000000, 0.513640, 0.858510, 19, 18, 1, 1, 0.997714, 0.002286, 0.000000, 0.000000 },
-	{ -0.021882, -0.067811, -0.037231, 0.776718, 0.482372, 0.405002, -0.612260, 0.729136, 0.305775, 1.000000, 0.522390, 0.849180, 19, 18, 1, 1, 0.976892, 0.023109, 0.000000, 0.000000 },
-	{ -0.018907, -0.071790, -0.040809, 0.917215, 0.103591, 0.384690, -0.283523, 0.848081, 0.447630, 1.000000, 0.506460, 0.853500, 19, 18, 1, 1, 0.997769, 0.002231, 0.000000, 0.000000 },
-	{ -0.021094, -0.070712, -0.036510, 0.849950, 0.144857, 0.506558, -0.390607, 0.818471, 0.421345, 1.000000, 0.515110, 0.844090, 19, 18, 1, 1, 0.979907, 0.020093, 0.000000, 0.000000 },
-	{ -0.019249, -0.074636, -0.040605, 0.871096, -0.210011, 0.443944, -0.063357, 0.848348, 0.525634, 1.000000, 0.499140, 0.848670, 19, 18, 1, 1, 0.996902, 0.003098, 0.000000, 0.000000 },
-	{ -0.021450, -0.073575, -0.036285, 0.806907, -0.204556, 0.554128, -0.170228, 0.817789, 0.549767, 1.000000, 0.507930, 0.838760, 19, 18, 1, 1, 0.973341, 0.026659, 0.000000, 0.000000 },
-	{ -0.020222, -0.076912, -0.040696, 0.735495, -0.493651, 0.464065, 0.152055, 0.787731, 0.596959, 1.000000, 0.492910, 0.844330, 19, 18, 1, 1, 0.997787, 0.002213, 0.000000, 0.000000 },
-	{ -0.022510, -0.075860, -0.036486, 0.670639, -0.496223, 0.551368, 0.034994, 0.763637, 0.644697, 1.000000, 0.501560, 0.833990, 19, 18, 1, 1, 0.966971, 0.033029, 0.000000, 0.000000 },
-	{ -0.024656, -0.064700, -0.043840, 0.173840, 0.967596, -0.183135, -0.938532, 0.219104, 0.266740, 1.000000, 0.530660, 0.871200, 19, 18, 1, 1, 0.993900, 0.006100, 0.000000, 0.000000 },
-	{ -0.021429, -0.078338, -0.041043, 0.517083, -0.746069, 0.419531, 0.340938, 0.629111, 0.698557, 1.000000, 0.488460, 0.841250, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023788, -0.077315, -0.036973, 0.468175, -0.732949, 0.493557, 0.216302, 0.636619, 0.740223, 1.000000, 0.496690, 0.830590, 19, 18, 1, 1, 0.981949, 0.018051, 0.000000, 0.000000 },
-	{ -0.019029, -0.067971, -0.046074, 0.781879, 0.614455, 0.105408, -0.607684, 0.713399, 0.348973, 1.000000, 0.511220, 0.871820, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017920, -0.070203, -0.045373, 0.913113, 0.352301, 0.205205, -0.406578, 0.824282, 0.394023, 1.000000, 0.505090, 0.867270, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017846, -0.069489, -0.048989, 0.853506, 0.521063, 0.004517, -0.480610, 0.783834, 0.393216, 1.000000, 0.503140, 0.877370, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017137, -0.071366, -0.048386, 0.957151, 0.271916, 0.099614, -0.288676, 0.868639, 0.402656, 1.000000, 0.498450, 0.873550, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017400, -0.070641, -0.050464, 0.909555, 0.388948, -0.146386, -0.304070, 0.862951, 0.403556, 1.000000, 0.498330, 0.879770, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017829, -0.070361, -0.051373, 0.780189, 0.489762, -0.389151, -0.328652, 0.850249, 0.411174, 1.000000, 0.498490, 0.882590, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016969, -0.072158, -0.050330, 0.977783, 0.183617, -0.101125, -0.128767, 0.906789, 0.401438, 1.000000, 0.494330, 0.877610, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017238, -0.072508, -0.051625, 0.904602, 0.148110, -0.399697, 0.005022, 0.933924, 0.357436, 1.000000, 0.492130, 0.880770, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016991, -0.074659, -0.051048, 0.942845, -0.085368, -0.322112, 0.211299, 0.900613, 0.379801, 1.000000, 0.486710, 0.876670, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016729, -0.074143, -0.049888, 0.997505, 0.029567, -0.064101, -0.000695, 0.912125, 0.409913, 1.000000, 0.489380, 0.874140, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017062, -0.076396, -0.049849, 0.931713, -0.336152, -0.137522, 0.361878, 0.826997, 0.430256, 1.000000, 0.483340, 0.871200, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016802, -0.075594, -0.049351, 0.987930, -0.154550, -0.010394, 0.143071, 0.884721, 0.443621, 1.000000, 0.486050, 0.871030, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018805, -0.068348, -0.049831, 0.645910, 0.737659, -0.196621, -0.630866, 0.660791, 0.406650, 1.000000, 0.506170, 0.881120, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016808, -0.073650, -0.047933, 0.986543, 0.064174, 0.150381, -0.121900, 0.901652, 0.414926, 1.000000, 0.492720, 0.869760, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016955, -0.075774, -0.047701, 0.965280, -0.173519, 0.195260, 0.069951, 0.891902, 0.446786, 1.000000, 0.487340, 0.866520, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017432, -0.077384, -0.047808, 0.878618, -0.447598, 0.166393, 0.322158, 0.812808, 0.485343, 1.000000, 0.483000, 0.864430, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020003, -0.067878, -0.050796, 0.407603, 0.826560, -0.388147, -0.704887, 0.555017, 0.441691, 1.000000, 0.508040, 0.885260, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018607, -0.070178, -0.052407, 0.631475, 0.532202, -0.563916, -0.339829, 0.843648, 0.415661, 1.000000, 0.498550, 0.886340, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017786, -0.072729, -0.052649, 0.787460, 0.132543, -0.601946, 0.080830, 0.945965, 0.314034, 1.000000, 0.490510, 0.883820, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017426, -0.075200, -0.051903, 0.847357, -0.192638, -0.494850, 0.386692, 0.862521, 0.326386, 1.000000, 0.484070, 0.878510, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017536, -0.077237, -0.050390, 0.836890, -0.485029, -0.253696, 0.547318, 0.735092, 0.400103, 1.000000, 0.480110, 0.871490, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018151, -0.078526, -0.048131, 0.726934, -0.681266, 0.086275, 0.545434, 0.649142, 0.530204, 1.000000, 0.479220, 0.863250, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020483, -0.066582, -0.046858, 0.542829, 0.837377, -0.064310, -0.780957, 0.531454, 0.328119, 1.000000, 0.515990, 0.875650, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022044, -0.066084, -0.047747, 0.252730, 0.933943, -0.252742, -0.873996, 0.332425, 0.354435, 1.000000, 0.519210, 0.879700, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019463, -0.078840, -0.044986, 0.599258, -0.739159, 0.307465, 0.444475, 0.626626, 0.640141, 1.000000, 0.481880, 0.853080, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018429, -0.077547, -0.044716, 0.804685, -0.475936, 0.354917, 0.246949, 0.811952, 0.528915, 1.000000, 0.485970, 0.855540, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017694, -0.075505, -0.044645, 0.920955, -0.194321, 0.337759, 0.016680, 0.885649, 0.464055, 1.000000, 0.491440, 0.858560, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017473, -0.072879, -0.044855, 0.957187, 0.077290, 0.278959, -0.196184, 0.881821, 0.428840, 1.000000, 0.498370, 0.862650, 19, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.036672, -0.069206, 0.020267, 0.662615, 0.401874, -0.632012, 0.041890, 0.822645, 0.567010, 1.000000, 0.589060, 0.690380, 13, 17, 12, 1, 0.972260, 0.015484, 0.008457, 0.003798 },
-	{ -0.036651, -0.070033, 0.019119, 0.560409, 0.721317, -0.406993, -0.215783, 0.601601, 0.769100, 1.000000, 0.585230, 0.690790, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.033519, -0.072194, 0.021245, 0.834609, 0.510015, -0.208118, -0.243519, 0.680511, 0.691088, 1.000000, 0.582040, 0.676870, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.033300, -0.071567, 0.023046, 0.870388, 0.261334, -0.417288, 0.014258, 0.833782, 0.551910, 1.000000, 0.585960, 0.673120, 13, 12, 17, 1, 0.973853, 0.018174, 0.006692, 0.001281 },
-	{ -0.031867, -0.075948, 0.023217, 0.984591, 0.174530, -0.010904, -0.127413, 0.758699, 0.638860, 1.000000, 0.573610, 0.662240, 13, 12, 1, 1, 0.997334, 0.002666, 0.000000, 0.000000 },
-	{ -0.031899, -0.075259, 0.025645, 0.986290, 0.002190, -0.165008, 0.094721, 0.811279, 0.576936, 1.000000, 0.578020, 0.657470, 13, 12, 1, 1, 0.968981, 0.031019, 0.000000, 0.000000 },
-	{ -0.032013, -0.079457, 0.024416, 0.973427, -0.187464, 0.131521, 0.063759, 0.773490, 0.630594, 1.000000, 0.565830, 0.652690, 13, 12, 1, 1, 0.992171, 0.007829, 0.000000, 0.000000 },
-	{ -0.032170, -0.078658, 0.027486, 0.962642, -0.270776, -0.001211, 0.220828, 0.782467, 0.582220, 1.000000, 0.570600, 0.646790, 13, 12, 1, 1, 0.947571, 0.052429, 0.000000, 0.000000 },
-	{ -0.033137, -0.081938, 0.024883, 0.840240, -0.497203, 0.216301, 0.238262, 0.696914, 0.676419, 1.000000, 0.559670, 0.646530, 13, 12, 1, 1, 0.983776, 0.016224, 0.000000, 0.000000 },
-	{ -0.033273, -0.080987, 0.028444, 0.834462, -0.542660, 0.095885, 0.386724, 0.700628, 0.599638, 1.000000, 0.564670, 0.640240, 13, 12, 1, 1, 0.918033, 0.081967, 0.000000, 0.000000 },
-	{ -0.040136, -0.068606, 0.018315, 0.471953, 0.425775, -0.771995, 0.026949, 0.868275, 0.495351, 1.000000, 0.586590, 0.701720, 13, 17, 1, 12, 0.985512, 0.011423, 0.001867, 0.001198 },
-	{ -0.039792, -0.069596, 0.017476, 0.328514, 0.775928, -0.538530, -0.239040, 0.619916, 0.747372, 1.000000, 0.583350, 0.701210, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.042378, -0.068643, 0.017239, 0.341034, 0.450778, -0.824921, -0.163995, 0.892601, 0.419964, 1.000000, 0.583710, 0.707690, 13, 17, 12, 1, 0.986022, 0.012952, 0.001026, 0.000000 },
-	{ -0.041954, -0.069754, 0.016347, 0.202394, 0.767661, -0.608057, -0.320120, 0.638658, 0.699742, 1.000000, 0.580510, 0.707720, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.034438, -0.083460, 0.024845, 0.637264, -0.716295, 0.284282, 0.328343, 0.586096, 0.740731, 1.000000, 0.554840, 0.642520, 13, 12, 1, 1, 0.987151, 0.012849, 0.000000, 0.000000 },
-	{ -0.034559, -0.082297, 0.028654, 0.613736, -0.770913, 0.170356, 0.524242, 0.559265, 0.642178, 1.000000, 0.560180, 0.636680, 13, 12, 1, 1, 0.908345, 0.091655, 0.000000, 0.000000 },
-	{ -0.033189, -0.073573, 0.018701, 0.816593, 0.550348, -0.174045, -0.290235, 0.652127, 0.700353, 1.000000, 0.573770, 0.679870, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.031504, -0.077223, 0.020128, 0.976942, 0.212455, 0.021160, -0.172136, 0.725133, 0.666746, 1.000000, 0.565620, 0.667250, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.032671, -0.075435, 0.015282, 0.806991, 0.569948, -0.154678, -0.310932, 0.632722, 0.709214, 1.000000, 0.561900, 0.683580, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.031012, -0.078844, 0.016405, 0.975280, 0.218458, 0.033243, -0.177812, 0.686537, 0.705017, 1.000000, 0.554540, 0.672250, 13, 14, 1, 1, 0.997298, 0.002702, 0.000000, 0.000000 },
-	{ -0.032040, -0.077198, 0.011627, 0.802589, 0.579806, -0.140271, -0.316613, 0.613325, 0.723594, 1.000000, 0.549380, 0.687620, 13, 14, 1, 1, 0.990079, 0.009921, 0.000000, 0.000000 },
-	{ -0.034784, -0.075092, 0.010052, 0.548770, 0.790097, -0.273128, -0.418972, 0.542662, 0.727998, 1.000000, 0.552500, 0.698750, 13, 14, 1, 1, 0.985972, 0.014028, 0.000000, 0.000000 },
-	{ -0.035485, -0.073324, 0.013722, 0.540651, 0.785473, -0.301213, -0.401200, 0.555461, 0.728355, 1.000000, 0.565100, 0.694820, 13, 14, 1, 1, 0.998207, 0.001793, 0.000000, 0.000000 },
-	{ -0.037523, -0.074410, 0.008507, 0.270615, 0.893694, -0.357882, -0.475022, 0.447305, 0.757808, 1.000000, 0.552640, 0.707870, 13, 14, 1, 1, 0.983905, 0.016095, 0.000000, 0.000000 },
-	{ -0.038293, -0.072750, 0.012165, 0.261272, 0.885049, -0.385259, -0.452305, 0.464846, 0.761143, 1.000000, 0.564330, 0.704000, 13, 14, 1, 1, 0.997373, 0.002627, 0.000000, 0.000000 },
-	{ -0.030466, -0.080403, 0.012711, 0.977256, 0.208660, 0.037837, -0.168676, 0.656703, 0.735044, 1.000000, 0.543350, 0.676840, 13, 14, 1, 1, 0.979606, 0.020394, 0.000000, 0.000000 },
-	{ -0.031152, -0.082216, 0.016899, 0.958859, -0.206306, 0.195005, -0.006162, 0.671636, 0.740856, 1.000000, 0.547450, 0.663760, 13, 14, 1, 1, 0.995074, 0.004926, 0.000000, 0.000000 },
-	{ -0.030694, -0.083653, 0.013123, 0.955198, -0.221750, 0.196017, -0.011682, 0.633532, 0.773628, 1.000000, 0.536950, 0.668140, 13, 14, 1, 1, 0.968319, 0.031681, 0.000000, 0.000000 },
-	{ -0.031892, -0.086244, 0.012993, 0.821167, -0.492852, 0.287718, 0.074038, 0.591903, 0.802602, 1.000000, 0.530830, 0.661200, 13, 14, 1, 1, 0.954748, 0.045252, 0.000000, 0.000000 },
-	{ -0.032370, -0.084808, 0.016845, 0.819248, -0.500519, 0.279844, 0.101510, 0.606886, 0.788280, 1.000000, 0.541120, 0.657170, 13, 14, 1, 1, 0.993095, 0.006905, 0.000000, 0.000000 },
-	{ -0.040484, -0.073052, 0.011063, 0.030289, 0.900582, -0.433629, -0.462797, 0.397161, 0.792517, 1.000000, 0.563410, 0.711420, 13, 14, 1, 1, 0.996636, 0.003364, 0.000000, 0.000000 },
-	{ -0.039677, -0.074621, 0.007470, 0.011395, 0.913514, -0.406648, -0.484392, 0.360815, 0.796980, 1.000000, 0.552630, 0.714630, 13, 14, 1, 1, 0.975347, 0.024653, 0.000000, 0.000000 },
-	{ -0.033171, -0.088021, 0.012654, 0.662310, -0.665276, 0.344607, 0.125142, 0.551715, 0.824591, 1.000000, 0.526370, 0.656380, 13, 14, 1, 1, 0.940839, 0.059161, 0.000000, 0.000000 },
-	{ -0.033695, -0.086555, 0.016553, 0.658213, -0.677181, 0.328910, 0.153650, 0.548539, 0.821886, 1.000000, 0.536390, 0.652320, 13, 14, 1, 1, 0.990120, 0.009880, 0.000000, 0.000000 },
-	{ -0.036165, -0.071465, 0.016980, 0.539413, 0.767006, -0.347470, -0.341004, 0.576281, 0.742709, 1.000000, 0.577030, 0.691930, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.039115, -0.071029, 0.015443, 0.278611, 0.850349, -0.446411, -0.370023, 0.523975, 0.767160, 1.000000, 0.575830, 0.701400, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.041293, -0.071298, 0.014286, 0.100554, 0.858271, -0.503250, -0.411135, 0.496452, 0.764528, 1.000000, 0.573780, 0.708810, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.034128, -0.085005, 0.020791, 0.651211, -0.689240, 0.317604, 0.221900, 0.573154, 0.788832, 1.000000, 0.546600, 0.647730, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.032791, -0.083297, 0.020993, 0.828059, -0.495133, 0.262984, 0.156325, 0.654386, 0.739825, 1.000000, 0.551530, 0.652240, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.031608, -0.080710, 0.020867, 0.966601, -0.185675, 0.176655, 0.013734, 0.725828, 0.687739, 1.000000, 0.557930, 0.658470, 13, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.033134, -0.078624, 0.002369, 0.533882, 0.837254, -0.118215, -0.527231, 0.438923, 0.727581, 1.000000, 0.528850, 0.706960, 13, 14, 1, 1, 0.506824, 0.493176, 0.000000, 0.000000 },
-	{ -0.032084, -0.079460, -0.000101, 0.519843, 0.852702, -0.051593, -0.582327, 0.397905, 0.708920, 1.000000, 0.521250, 0.709330, 14, 13, 1, 1, 0.741112, 0.258888, 0.000000, 0.000000 },
-	{ -0.029922, -0.081234, 0.001510, 0.760772, 0.641550, 0.098182, -0.504843, 0.489891, 0.710733, 1.000000, 0.518920, 0.699340, 14, 13, 1, 1, 0.728979, 0.271021, 0.000000, 0.000000 },
-	{ -0.030884, -0.080389, 0.004027, 0.771625, 0.635699, 0.021941, -0.441466, 0.510389, 0.737978, 1.000000, 0.526600, 0.696610, 13, 14, 1, 1, 0.585432, 0.414568, 0.000000, 0.000000 },
-	{ -0.028562, -0.084023, 0.002597, 0.916783, 0.300378, 0.263214, -0.394693, 0.580694, 0.712048, 1.000000, 0.514420, 0.689320, 14, 13, 15, 1, 0.781780, 0.217036, 0.001184, 0.000000 },
-	{ -0.029509, -0.083130, 0.005207, 0.938904, 0.282530, 0.196559, -0.330512, 0.580793, 0.743936, 1.000000, 0.522500, 0.686050, 13, 14, 1, 1, 0.551033, 0.448967, 0.000000, 0.000000 },
-	{ -0.028389, -0.087091, 0.002843, 0.913430, -0.067854, 0.401299, -0.275901, 0.621634, 0.733110, 1.000000, 0.508600, 0.680980, 14, 13, 15, 1, 0.845240, 0.153688, 0.001072, 0.000000 },
-	{ -0.029423, -0.086169, 0.005542, 0.931862, -0.100092, 0.348734, -0.215613, 0.620271, 0.754172, 1.000000, 0.516910, 0.677360, 14, 13, 1, 1, 0.572627, 0.427373, 0.000000, 0.000000 },
-	{ -0.028967, -0.089649, 0.002541, 0.804097, -0.352544, 0.478687, -0.193665, 0.605938, 0.771579, 1.000000, 0.503370, 0.674550, 14, 13, 15, 1, 0.882024, 0.116775, 0.001201, 0.000000 },
-	{ -0.030107, -0.088762, 0.005238, 0.816689, -0.383719, 0.431021, -0.126976, 0.609111, 0.782854, 1.000000, 0.511360, 0.670820, 14, 13, 1, 1, 0.657130, 0.342870, 0.000000, 0.000000 },
-	{ -0.035387, -0.077940, 0.000850, 0.280166, 0.927917, -0.245922, -0.577604, 0.367568, 0.728881, 1.000000, 0.529990, 0.715120, 14, 13, 1, 1, 0.555575, 0.444425, 0.000000, 0.000000 },
-	{ -0.034252, -0.078828, -0.001630, 0.251215, 0.947796, -0.196402, -0.622701, 0.313597, 0.716869, 1.000000, 0.522380, 0.717200, 14, 13, 1, 1, 0.754874, 0.245126, 0.000000, 0.000000 },
-	{ -0.037201, -0.078042, -0.000239, 0.028498, 0.934950, -0.353634, -0.599829, 0.298998, 0.742163, 1.000000, 0.530600, 0.720950, 14, 13, 1, 1, 0.581540, 0.418460, 0.000000, 0.000000 },
-	{ -0.036021, -0.078984, -0.002782, 0.004061, 0.947619, -0.319377, -0.636720, 0.248721, 0.729881, 1.000000, 0.523020, 0.723070, 14, 13, 15, 1, 0.734846, 0.263472, 0.001682, 0.000000 },
-	{ -0.029813, -0.091382, 0.002072, 0.648210, -0.573626, 0.500776, -0.138102, 0.558183, 0.818144, 1.000000, 0.499780, 0.669870, 14, 13, 15, 1, 0.898174, 0.100380, 0.001446, 0.000000 },
-	{ -0.031057, -0.090562, 0.004697, 0.655587, -0.599869, 0.458654, -0.066332, 0.559296, 0.826310, 1.000000, 0.507120, 0.666180, 14, 13, 1, 1, 0.704904, 0.295096, 0.000000, 0.000000 },
-	{ -0.028550, -0.082335, -0.001527, 0.771162, 0.621847, 0.136442, -0.520480, 0.492391, 0.697604, 1.000000, 0.508100, 0.702530, 14, 13, 15, 1, 0.923187, 0.063341, 0.013472, 0.000000 },
-	{ -0.027267, -0.085187, -0.000459, 0.907866, 0.298811, 0.294093, -0.417299, 0.576261, 0.702698, 1.000000, 0.503130, 0.692890, 14, 13, 15, 1, 0.935841, 0.048454, 0.015704, 0.000000 },
-	{ -0.027062, -0.083528, -0.004602, 0.787286, 0.594666, 0.162954, -0.518351, 0.495200, 0.697201, 1.000000, 0.496380, 0.705450, 14, 15, 13, 1, 0.917434, 0.075240, 0.007326, 0.000000 },
-	{ -0.025880, -0.086400, -0.003469, 0.904084, 0.293486, 0.310642, -0.424947, 0.540319, 0.726275, 1.000000, 0.491640, 0.695940, 14, 15, 13, 1, 0.920557, 0.073889, 0.005554, 0.000000 },
-	{ -0.025789, -0.084519, -0.007255, 0.790678, 0.580905, 0.193332, -0.515892, 0.462126, 0.721315, 1.000000, 0.486770, 0.707740, 14, 15, 1, 1, 0.797842, 0.202158, 0.000000, 0.000000 },
-	{ -0.027559, -0.082396, -0.008921, 0.596706, 0.801158, 0.045703, -0.608121, 0.414302, 0.677158, 1.000000, 0.490470, 0.717530, 14, 15, 13, 1, 0.825489, 0.173364, 0.001147, 0.000000 },
-	{ -0.028980, -0.081440, -0.006254, 0.569654, 0.821710, 0.016954, -0.608559, 0.407494, 0.680886, 1.000000, 0.500090, 0.715050, 14, 15, 13, 1, 0.931846, 0.048168, 0.019986, 0.000000 },
-	{ -0.029445, -0.081495, -0.010508, 0.290675, 0.946699, -0.138814, -0.673382, 0.305471, 0.673234, 1.000000, 0.492530, 0.724760, 14, 15, 1, 1, 0.763046, 0.236954, 0.000000, 0.000000 },
-	{ -0.030995, -0.080663, -0.007819, 0.258888, 0.954272, -0.149471, -0.668473, 0.288711, 0.685412, 1.000000, 0.501930, 0.722460, 14, 15, 13, 1, 0.898213, 0.081304, 0.020483, 0.000000 },
-	{ -0.024709, -0.087277, -0.006096, 0.894827, 0.301743, 0.328993, -0.440992, 0.482983, 0.756474, 1.000000, 0.482540, 0.698300, 14, 15, 1, 1, 0.801637, 0.198363, 0.000000, 0.000000 },
-	{ -0.025741, -0.089235, -0.003042, 0.902388, -0.026664, 0.430098, -0.345999, 0.550108, 0.760044, 1.000000, 0.487440, 0.687930, 14, 15, 13, 1, 0.928531, 0.068225, 0.003244, 0.000000 },
-	{ -0.024562, -0.089923, -0.005594, 0.899029, 0.004779, 0.437862, -0.382663, 0.494680, 0.780295, 1.000000, 0.479020, 0.690660, 14, 15, 1, 1, 0.782574, 0.217426, 0.000000, 0.000000 },
-	{ -0.024955, -0.091981, -0.005498, 0.828010, -0.259609, 0.496994, -0.327459, 0.495615, 0.804448, 1.000000, 0.476540, 0.684920, 14, 15, 1, 1, 0.779622, 0.220378, 0.000000, 0.000000 },
-	{ -0.026225, -0.091452, -0.003050, 0.818304, -0.296827, 0.492212, -0.279417, 0.542919, 0.791937, 1.000000, 0.484380, 0.681790, 14, 15, 13, 1, 0.932945, 0.064619, 0.002437, 0.000000 },
-	{ -0.032745, -0.080854, -0.009031, -0.027656, 0.956436, -0.290628, -0.681824, 0.194561, 0.705168, 1.000000, 0.502890, 0.728450, 14, 15, 13, 1, 0.882722, 0.099043, 0.018235, 0.000000 },
-	{ -0.031158, -0.081627, -0.011732, -0.007830, 0.956245, -0.292461, -0.690244, 0.206450, 0.693500, 1.000000, 0.493760, 0.730610, 14, 15, 1, 1, 0.733047, 0.266953, 0.000000, 0.000000 },
-	{ -0.025578, -0.093378, -0.005644, 0.707560, -0.498141, 0.501213, -0.266411, 0.468899, 0.842116, 1.000000, 0.474860, 0.680840, 14, 15, 1, 1, 0.800170, 0.199830, 0.000000, 0.000000 },
-	{ -0.026947, -0.092935, -0.003272, 0.684953, -0.527234, 0.502855, -0.215931, 0.512273, 0.831234, 1.000000, 0.482320, 0.677440, 14, 15, 13, 1, 0.939288, 0.058404, 0.002308, 0.000000 },
-	{ -0.030597, -0.080437, -0.003130, 0.535718, 0.844315, -0.011759, -0.601943, 0.391625, 0.695913, 1.000000, 0.511220, 0.712120, 14, 13, 15, 1, 0.891833, 0.102276, 0.005891, 0.000000 },
-	{ -0.032694, -0.079770, -0.004668, 0.241575, 0.956088, -0.165946, -0.652140, 0.286593, 0.701839, 1.000000, 0.512650, 0.719670, 14, 13, 15, 1, 0.882766, 0.103431, 0.013803, 0.000000 },
-	{ -0.034461, -0.079955, -0.005859, -0.021326, 0.954410, -0.297736, -0.666283, 0.208464, 0.715968, 1.000000, 0.513390, 0.725690, 14, 13, 15, 1, 0.872021, 0.107979, 0.020000, 0.000000 },
-	{ -0.028391, -0.092243, -0.000646, 0.658673, -0.551149, 0.512236, -0.185295, 0.540995, 0.820360, 1.000000, 0.491020, 0.673720, 14, 13, 15, 1, 0.968901, 0.020260, 0.010840, 0.000000 },
-	{ -0.027606, -0.090632, -0.000302, 0.804811, -0.324682, 0.496851, -0.244605, 0.581277, 0.776070, 1.000000, 0.493750, 0.678330, 14, 13, 15, 1, 0.964090, 0.023760, 0.012150, 0.000000 },
-	{ -0.027094, -0.088214, -0.000138, 0.903135, -0.046607, 0.426821, -0.316224, 0.600233, 0.734658, 1.000000, 0.497880, 0.684700, 14, 13, 15, 1, 0.955317, 0.030876, 0.013807, 0.000000 },
-	{ -0.023741, -0.083976, -0.014832, 0.552403, 0.826824, 0.105894, -0.668379, 0.363427, 0.648992, 1.000000, 0.472010, 0.722730, 15, 14, 1, 1, 0.769645, 0.230355, 0.000000, 0.000000 },
-	{ -0.021968, -0.085029, -0.017829, 0.602165, 0.797814, 0.029836, -0.606945, 0.433185, 0.666310, 1.000000, 0.462920, 0.725450, 15, 14, 1, 1, 0.927331, 0.072669, 0.000000, 0.000000 },
-	{ -0.020175, -0.086945, -0.016380, 0.781645, 0.595400, 0.185823, -0.536119, 0.489094, 0.688014, 1.000000, 0.459410, 0.716810, 15, 14, 1, 1, 0.940825, 0.059175, 0.000000, 0.000000 },
-	{ -0.021925, -0.085948, -0.013274, 0.731173, 0.619122, 0.286486, -0.619219, 0.426093, 0.659555, 1.000000, 0.468450, 0.713710, 15, 14, 1, 1, 0.815675, 0.184325, 0.000000, 0.000000 },
-	{ -0.019150, -0.089443, -0.015412, 0.890469, 0.324914, 0.318584, -0.450647, 0.532586, 0.716428, 1.000000, 0.455460, 0.708810, 15, 14, 1, 1, 0.966150, 0.033850, 0.000000, 0.000000 },
-	{ -0.020822, -0.088586, -0.012271, 0.837241, 0.348652, 0.421270, -0.545634, 0.481637, 0.685791, 1.000000, 0.464260, 0.705220, 15, 14, 1, 1, 0.853962, 0.146038, 0.000000, 0.000000 },
-	{ -0.018946, -0.091861, -0.014921, 0.914526, 0.035445, 0.402970, -0.350995, 0.564755, 0.746896, 1.000000, 0.452040, 0.701800, 15, 14, 1, 1, 0.974370, 0.025630, 0.000000, 0.000000 },
-	{ -0.020493, -0.091136, -0.011830, 0.867469, 0.061878, 0.493628, -0.450732, 0.517721, 0.727190, 1.000000, 0.460400, 0.697930, 15, 14, 1, 1, 0.875987, 0.124013, 0.000000, 0.000000 },
-	{ -0.019257, -0.093734, -0.014890, 0.861056, -0.247350, 0.444297, -0.238007, 0.576077, 0.781977, 1.000000, 0.449170, 0.696950, 15, 14, 1, 1, 0.974385, 0.025615, 0.000000, 0.000000 },
-	{ -0.020747, -0.093064, -0.011867, 0.821049, -0.240682, 0.517639, -0.338547, 0.524810, 0.781000, 1.000000, 0.457570, 0.693110, 15, 14, 1, 1, 0.884929, 0.115071, 0.000000, 0.000000 },
-	{ -0.025572, -0.083167, -0.016469, 0.289646, 0.951497, -0.103729, -0.712707, 0.286746, 0.640176, 1.000000, 0.473610, 0.729860, 15, 14, 1, 1, 0.830542, 0.169458, 0.000000, 0.000000 },
-	{ -0.023815, -0.084164, -0.019357, 0.347014, 0.926329, -0.146615, -0.663967, 0.353060, 0.659163, 1.000000, 0.464340, 0.732700, 15, 14, 1, 1, 0.948525, 0.051475, 0.000000, 0.000000 },
-	{ -0.027125, -0.083345, -0.017817, 0.003036, 0.957700, -0.287755, -0.729489, 0.198943, 0.654422, 1.000000, 0.474080, 0.735670, 15, 14, 1, 1, 0.854568, 0.145432, 0.000000, 0.000000 },
-	{ -0.025334, -0.084229, -0.020566, 0.040922, 0.943756, -0.328102, -0.684697, 0.265641, 0.678694, 1.000000, 0.464540, 0.738060, 15, 14, 1, 1, 0.957917, 0.042083, 0.000000, 0.000000 },
-	{ -0.019764, -0.095064, -0.015155, 0.751437, -0.479486, 0.453250, -0.136227, 0.559399, 0.817628, 1.000000, 0.446630, 0.693630, 15, 14, 1, 1, 0.971722, 0.028278, 0.000000, 0.000000 },
-	{ -0.021283, -0.094412, -0.012188, 0.713546, -0.488528, 0.502188, -0.244499, 0.498089, 0.831942, 1.000000, 0.455210, 0.689510, 15, 14, 1, 1, 0.888918, 0.111082, 0.000000, 0.000000 },
-	{ -0.018597, -0.088281, -0.020034, 0.826531, 0.553985, 0.099736, -0.444717, 0.534057, 0.719034, 1.000000, 0.449070, 0.720400, 15, 14, 1, 1, 0.990475, 0.009525, 0.000000, 0.000000 },
-	{ -0.017702, -0.090565, -0.018954, 0.930250, 0.295877, 0.217008, -0.356553, 0.589269, 0.725005, 1.000000, 0.445980, 0.712710, 15, 14, 1, 1, 0.997688, 0.002312, 0.000000, 0.000000 },
-	{ -0.017698, -0.089555, -0.023262, 0.879071, 0.476640, -0.006911, -0.321461, 0.603454, 0.729731, 1.000000, 0.439950, 0.723670, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016968, -0.091593, -0.022142, 0.961045, 0.264521, 0.080136, -0.237135, 0.640180, 0.730710, 1.000000, 0.437690, 0.716610, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017598, -0.090434, -0.025396, 0.919151, 0.341241, -0.196762, -0.106482, 0.696169, 0.709937, 1.000000, 0.434190, 0.726290, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018425, -0.089018, -0.025923, 0.803765, 0.538684, -0.252550, -0.214360, 0.658192, 0.721688, 1.000000, 0.436440, 0.730960, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018972, -0.088900, -0.026911, 0.647154, 0.580181, -0.494552, -0.110068, 0.713022, 0.692448, 1.000000, 0.435270, 0.733600, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017953, -0.090911, -0.026767, 0.854364, 0.228673, -0.466660, 0.134964, 0.769534, 0.624181, 1.000000, 0.430750, 0.728620, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017140, -0.093014, -0.025571, 0.938121, 0.027269, -0.345233, 0.215907, 0.733379, 0.644624, 1.000000, 0.428160, 0.720940, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016890, -0.092329, -0.024298, 0.973559, 0.188372, -0.129225, -0.041085, 0.700858, 0.712117, 1.000000, 0.432090, 0.719440, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016815, -0.094466, -0.023743, 0.976150, -0.191024, -0.103156, 0.208815, 0.696148, 0.686859, 1.000000, 0.428800, 0.713680, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016700, -0.093597, -0.023293, 0.999844, 0.002356, -0.017525, 0.010962, 0.695088, 0.718841, 1.000000, 0.431410, 0.714590, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018918, -0.087938, -0.024447, 0.722350, 0.683391, -0.105770, -0.404406, 0.541531, 0.737021, 1.000000, 0.441760, 0.730450, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020171, -0.087156, -0.025525, 0.476992, 0.824890, -0.303374, -0.404112, 0.512359, 0.757748, 1.000000, 0.442240, 0.735510, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.016832, -0.093430, -0.021428, 0.983766, 0.010023, 0.179176, -0.139660, 0.669750, 0.729336, 1.000000, 0.435400, 0.711100, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017032, -0.094888, -0.021309, 0.946141, -0.249233, 0.206642, 0.015548, 0.672508, 0.739927, 1.000000, 0.432860, 0.707530, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021351, -0.087136, -0.026362, 0.174711, 0.825240, -0.537080, -0.376276, 0.560026, 0.738097, 1.000000, 0.441720, 0.739390, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.019754, -0.089064, -0.027806, 0.428122, 0.560446, -0.708952, -0.030247, 0.792928, 0.608565, 1.000000, 0.433620, 0.736340, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.018505, -0.091351, -0.027707, 0.733025, 0.172471, -0.657973, 0.269454, 0.814557, 0.513704, 1.000000, 0.428030, 0.730490, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017542, -0.093697, -0.026398, 0.879697, -0.087975, -0.467327, 0.374803, 0.733105, 0.567521, 1.000000, 0.424940, 0.721590, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017128, -0.095381, -0.024246, 0.933708, -0.317822, -0.164857, 0.346003, 0.682626, 0.643665, 1.000000, 0.425720, 0.712850, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.017417, -0.096022, -0.021526, 0.880002, -0.440755, 0.177006, 0.173791, 0.645623, 0.743618, 1.000000, 0.430220, 0.705240, 15, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.020160, -0.086478, -0.021446, 0.655513, 0.754704, -0.026936, -0.514548, 0.472461, 0.715557, 1.000000, 0.451440, 0.728640, 15, 14, 1, 1, 0.991385, 0.008615, 0.000000, 0.000000 },
-	{ -0.021849, -0.085545, -0.022737, 0.405087, 0.893344, -0.194531, -0.561346, 0.410964, 0.718331, 1.000000, 0.452760, 0.735180, 15, 14, 1, 1, 0.992469, 0.007531, 0.000000, 0.000000 },
-	{ -0.023295, -0.085508, -0.023684, 0.085106, 0.913286, -0.398328, -0.573636, 0.371789, 0.729873, 1.000000, 0.453070, 0.739720, 15, 14, 1, 1, 0.993387, 0.006613, 0.000000, 0.000000 },
-	{ -0.018381, -0.095758, -0.018387, 0.803947, -0.465229, 0.370448, -0.010314, 0.611913, 0.790858, 1.000000, 0.437790, 0.698800, 15, 14, 1, 1, 0.996124, 0.003876, 0.000000, 0.000000 },
-	{ -0.017914, -0.094497, -0.018215, 0.899987, -0.244598, 0.360826, -0.132066, 0.635845, 0.760434, 1.000000, 0.440260, 0.701800, 15, 14, 1, 1, 0.995842, 0.004158, 0.000000, 0.000000 },
-	{ -0.017588, -0.092764, -0.018360, 0.950525, 0.017263, 0.310168, -0.251582, 0.628491, 0.736007, 1.000000, 0.442910, 0.706350, 15, 14, 1, 1, 0.997616, 0.002384, 0.000000, 0.000000 },
-	{ -0.035984, -0.022800, 0.003803, 0.666503, -0.159803, -0.728174, 0.241716, 0.970312, 0.008303, 1.000000, 0.730170, 0.758360, 4, 8, 1, 1, 0.667540, 0.311811, 0.020649, 0.000000 },
-	{ -0.037935, -0.021916, 0.002238, 0.579698, -0.080105, -0.810884, 0.235369, 0.969197, 0.072520, 1.000000, 0.731390, 0.765230, 4, 8, 1, 1, 0.726006, 0.268051, 0.005943, 0.000000 },
-	{ -0.038946, -0.023937, 0.001183, 0.745997, 0.196454, -0.636313, -0.065702, 0.972548, 0.223235, 1.000000, 0.725480, 0.768010, 8, 4, 1, 1, 0.666161, 0.326064, 0.007775, 0.000000 },
-	{ -0.024585, -0.002843, -0.017816, 0.939538, 0.296370, 0.171559, -0.189211, 0.866846, -0.461278, 1.000000, 0.817480, 0.803700, 4, 5, 1, 1, 0.719244, 0.280756, 0.000000, 0.000000 },
-	{ -0.025309, -0.001084, -0.018141, 0.815772, 0.565773, 0.120072, -0.436137, 0.738102, -0.514772, 1.000000, 0.823210, 0.802080, 4, 5, 1, 1, 0.654105, 0.345895, 0.000000, 0.000000 },
-	{ -0.024644, -0.001415, -0.020852, 0.774418, 0.598860, 0.204069, -0.411787, 0.721981, -0.556036, 1.000000, 0.825510, 0.808680, 5, 4, 1, 1, 0.553584, 0.446416, 0.000000, 0.000000 },
-	{ -0.023944, -0.003068, -0.020321, 0.894563, 0.333390, 0.297671, -0.164627, 0.864979, -0.474035, 1.000000, 0.819670, 0.809880, 5, 4, 1, 1, 0.515048, 0.484952, 0.000000, 0.000000 },
-	{ -0.023489, -0.005551, -0.019866, 0.925726, 0.145975, 0.348888, 0.020689, 0.901579, -0.432119, 1.000000, 0.811360, 0.811850, 4, 5, 1, 1, 0.507257, 0.492743, 0.000000, 0.000000 },
-	{ -0.024094, -0.005437, -0.017625, 0.973422, 0.115455, 0.197789, -0.021166, 0.905287, -0.424273, 1.000000, 0.809340, 0.806460, 4, 5, 1, 1, 0.718920, 0.281080, 0.000000, 0.000000 },
-	{ -0.023390, -0.008686, -0.019576, 0.924300, -0.037946, 0.379776, 0.198558, 0.897597, -0.393567, 1.000000, 0.801190, 0.814770, 5, 4, 1, 1, 0.502989, 0.497011, 0.000000, 0.000000 },
-	{ -0.023957, -0.008621, -0.017543, 0.971283, -0.071156, 0.227038, 0.154650, 0.913970, -0.375157, 1.000000, 0.799470, 0.809750, 4, 5, 1, 1, 0.671426, 0.328574, 0.000000, 0.000000 },
-	{ -0.024531, -0.011965, -0.017575, 0.919194, -0.299744, 0.255413, 0.371925, 0.873948, -0.312869, 1.000000, 0.788600, 0.813230, 4, 5, 1, 1, 0.680797, 0.319203, 0.000000, 0.000000 },
-	{ -0.023912, -0.012022, -0.019542, 0.880299, -0.264676, 0.393726, 0.403609, 0.853999, -0.328308, 1.000000, 0.790270, 0.818270, 5, 4, 1, 1, 0.542992, 0.457008, 0.000000, 0.000000 },
-	{ -0.025816, -0.014678, -0.017735, 0.786880, -0.558973, 0.261474, 0.611792, 0.762100, -0.211930, 1.000000, 0.778990, 0.816030, 4, 5, 1, 1, 0.723861, 0.276139, 0.000000, 0.000000 },
-	{ -0.025083, -0.014756, -0.019799, 0.760787, -0.526732, 0.379152, 0.628612, 0.743347, -0.228654, 1.000000, 0.780830, 0.821460, 4, 5, 1, 1, 0.502452, 0.497548, 0.000000, 0.000000 },
-	{ -0.026452, -0.016350, -0.020286, 0.514220, -0.798036, 0.314193, 0.854665, 0.507384, -0.110046, 1.000000, 0.774500, 0.823860, 4, 5, 1, 1, 0.507650, 0.492350, 0.000000, 0.000000 },
-	{ -0.027299, -0.016207, -0.018012, 0.519580, -0.824936, 0.222526, 0.854084, 0.508768, -0.108143, 1.000000, 0.772680, 0.817700, 4, 5, 1, 1, 0.723518, 0.276482, 0.000000, 0.000000 },
-	{ -0.027827, -0.017065, -0.020885, 0.206833, -0.955949, 0.208284, 0.977966, 0.208173, -0.015715, 1.000000, 0.769700, 0.825780, 5, 4, 1, 1, 0.518450, 0.481550, 0.000000, 0.000000 },
-	{ -0.028825, -0.016852, -0.018366, 0.205002, -0.967219, 0.149870, 0.978762, 0.202644, -0.031004, 1.000000, 0.767780, 0.819000, 4, 5, 1, 1, 0.706935, 0.293065, 0.000000, 0.000000 },
-	{ -0.026387, 0.000018, -0.018600, 0.585752, 0.809539, 0.039268, -0.658859, 0.503824, -0.558629, 1.000000, 0.828200, 0.800970, 4, 5, 1, 1, 0.620911, 0.379089, 0.000000, 0.000000 },
-	{ -0.025623, -0.000397, -0.021457, 0.552055, 0.829416, 0.085464, -0.621751, 0.477783, -0.620604, 1.000000, 0.830340, 0.807790, 5, 4, 1, 1, 0.565989, 0.434011, 0.000000, 0.000000 },
-	{ -0.029212, -0.017272, -0.021422, -0.011916, -0.993622, 0.112133, 0.999517, -0.008616, 0.029869, 1.000000, 0.765310, 0.827210, 5, 4, 1, 1, 0.561661, 0.438339, 0.000000, 0.000000 },
-	{ -0.030455, -0.017028, -0.018618, 0.006986, -0.996235, 0.086418, 0.999975, 0.007029, 0.000190, 1.000000, 0.762730, 0.819670, 4, 5, 1, 1, 0.719954, 0.280046, 0.000000, 0.000000 },
-	{ -0.030587, -0.017189, -0.021817, -0.150870, -0.987917, 0.035474, 0.864143, -0.149226, -0.480613, 1.000000, 0.491490, 0.417240, 5, 4, 1, 1, 0.505953, 0.494047, 0.000000, 0.000000 },
-	{ -0.032046, -0.016932, -0.018731, -0.124558, -0.991846, 0.026962, 0.864965, -0.121858, -0.486812, 1.000000, 0.483080, 0.412100, 4, 5, 1, 1, 0.753318, 0.246682, 0.000000, 0.000000 },
-	{ -0.030455, -0.017028, -0.018618, 0.006986, -0.996235, 0.086418, 0.864881, -0.037358, -0.500585, 1.000000, 0.487330, 0.409830, 4, 5, 1, 1, 0.719954, 0.280046, 0.000000, 0.000000 },
-	{ -0.029212, -0.017272, -0.021422, -0.011916, -0.993622, 0.112133, 0.864786, -0.066539, -0.497713, 1.000000, 0.494630, 0.414520, 5, 4, 1, 1, 0.561661, 0.438339, 0.000000, 0.000000 },
-	{ -0.031861, -0.016930, -0.022124, -0.270829, -0.962059, -0.033068, 0.855882, -0.224932, -0.465694, 1.000000, 0.488440, 0.419510, 4, 5, 1, 1, 0.519342, 0.480658, 0.000000, 0.000000 },
-	{ -0.033458, -0.016657, -0.018834, -0.253623, -0.966420, -0.041326, 0.855538, -0.204178, -0.475779, 1.000000, 0.479400, 0.414070, 4, 5, 1, 1, 0.768383, 0.231617, 0.000000, 0.000000 },
-	{ -0.033013, -0.016510, -0.022436, -0.388927, -0.916328, -0.095279, 0.832366, -0.305186, -0.462632, 1.000000, 0.485720, 0.421640, 4, 5, 1, 1, 0.521052, 0.478948, 0.000000, 0.000000 },
-	{ -0.034678, -0.016210, -0.019013, -0.388366, -0.914595, -0.112638, 0.827356, -0.292248, -0.479659, 1.000000, 0.476380, 0.415990, 4, 5, 1, 1, 0.771463, 0.228537, 0.000000, 0.000000 },
-	{ -0.034171, -0.015904, -0.022801, -0.475991, -0.868722, -0.136949, 0.801919, -0.364804, -0.473122, 1.000000, 0.483060, 0.423980, 4, 5, 1, 1, 0.515967, 0.484033, 0.000000, 0.000000 },
-	{ -0.035868, -0.015551, -0.019318, -0.489982, -0.856984, -0.159676, 0.788115, -0.357207, -0.501276, 1.000000, 0.473640, 0.418330, 4, 5, 1, 1, 0.773944, 0.226056, 0.000000, 0.000000 },
-	{ -0.035520, -0.015035, -0.023256, -0.533849, -0.830467, -0.159151, 0.768670, -0.398191, -0.500591, 1.000000, 0.479890, 0.426920, 4, 5, 1, 1, 0.519116, 0.480884, 0.000000, 0.000000 },
-	{ -0.037195, -0.014620, -0.019813, -0.565015, -0.805252, -0.179801, 0.736064, -0.393483, -0.550801, 1.000000, 0.470280, 0.421570, 4, 5, 1, 1, 0.770354, 0.229646, 0.000000, 0.000000 },
-	{ -0.035022, 0.001926, -0.017630, -0.150607, 0.982977, -0.105233, -0.135096, -0.125912, -0.982800, 1.000000, 0.432850, 0.472620, 4, 5, 1, 1, 0.899264, 0.100736, 0.000000, 0.000000 },
-	{ -0.036105, 0.002263, -0.012541, -0.188212, 0.975570, -0.113317, -0.146177, -0.141919, -0.979026, 1.000000, 0.421310, 0.466970, 4, 5, 1, 1, 0.981953, 0.018047, 0.000000, 0.000000 },
-	{ -0.033219, 0.002073, -0.016968, 0.013096, 0.995434, -0.094552, -0.124403, -0.092203, -0.987939, 1.000000, 0.430340, 0.477830, 4, 5, 1, 1, 0.902790, 0.097210, 0.000000, 0.000000 },
-	{ -0.034274, 0.002503, -0.012175, -0.021308, 0.995693, -0.090232, -0.137106, -0.092310, -0.986246, 1.000000, 0.419380, 0.472530, 4, 5, 1, 1, 0.978758, 0.021242, 0.000000, 0.000000 },
-	{ -0.031609, 0.001984, -0.016474, 0.140679, 0.986938, -0.078501, -0.116090, -0.062299, -0.991283, 1.000000, 0.428560, 0.482700, 4, 5, 1, 1, 0.890485, 0.109515, 0.000000, 0.000000 },
-	{ -0.032637, 0.002437, -0.011855, 0.137360, 0.988564, -0.062242, -0.122952, -0.045335, -0.991377, 1.000000, 0.417780, 0.477690, 4, 5, 1, 1, 0.974074, 0.025926, 0.000000, 0.000000 },
-	{ -0.033320, 0.002863, -0.006664, 0.169341, 0.984083, -0.053896, -0.132906, -0.031384, -0.990632, 1.000000, 0.406180, 0.473190, 4, 5, 1, 1, 0.996164, 0.003836, 0.000000, 0.000000 },
-	{ -0.033475, 0.003135, -0.001318, 0.236354, 0.971405, -0.022578, -0.101373, 0.001542, -0.994847, 1.000000, 0.394070, 0.470190, 4, 1, 1, 1, 0.998347, 0.001653, 0.000000, 0.000000 },
-	{ -0.033166, 0.002990, 0.003502, 0.320884, 0.947094, -0.006877, -0.057297, 0.012164, -0.998283, 1.000000, 0.382750, 0.470090, 4, 1, 1, 1, 0.989935, 0.010065, 0.000000, 0.000000 },
-	{ -0.032726, 0.002884, 0.007004, 0.356679, 0.928763, -0.100891, -0.071130, -0.080683, -0.994199, 1.000000, 0.376140, 0.471060, 4, 1, 1, 1, 0.942498, 0.057502, 0.000000, 0.000000 },
-	{ -0.033920, 0.003905, 0.011027, 0.188303, 0.972321, -0.138326, -0.040355, -0.133067, -0.990285, 1.000000, 0.367410, 0.466230, 4, 1, 1, 1, 0.842960, 0.157040, 0.000000, 0.000000 },
-	{ -0.032795, 0.004291, 0.014954, 0.169242, 0.974474, -0.147508, 0.016319, -0.152417, -0.988182, 1.000000, 0.358720, 0.469470, 4, 1, 21, 1, 0.707664, 0.290290, 0.002047, 0.000000 },
-	{ -0.031576, 0.004641, 0.018655, 0.160708, 0.974469, -0.156792, 0.064351, -0.168863, -0.983537, 1.000000, 0.350990, 0.473520, 4, 1, 21, 1, 0.587782, 0.405818, 0.006401, 0.000000 },
-	{ -0.030441, 0.005037, 0.021930, 0.156408, 0.968831, -0.192103, 0.094861, -0.208333, -0.973447, 1.000000, 0.344310, 0.477560, 1, 4, 21, 1, 0.494111, 0.489563, 0.016327, 0.000000 },
-	{ -0.029317, 0.005526, 0.024896, 0.153272, 0.956873, -0.246782, 0.103394, -0.263891, -0.958995, 1.000000, 0.338170, 0.481670, 1, 4, 22, 21, 0.516282, 0.414011, 0.035051, 0.034656 },
-	{ -0.028079, 0.006139, 0.027670, 0.147426, 0.937427, -0.315430, 0.092965, -0.330637, -0.939168, 1.000000, 0.332270, 0.486040, 1, 4, 22, 21, 0.528420, 0.337632, 0.070262, 0.063686 },
-	{ -0.026639, 0.006896, 0.030263, 0.132320, 0.912258, -0.387656, 0.076270, -0.399306, -0.913640, 1.000000, 0.326470, 0.490820, 1, 4, 22, 21, 0.519591, 0.261821, 0.112719, 0.105869 },
-	{ -0.024925, 0.007790, 0.032667, 0.102666, 0.889298, -0.445657, 0.059180, -0.452691, -0.889701, 1.000000, 0.320830, 0.496160, 1, 4, 22, 21, 0.483699, 0.187065, 0.164945, 0.164291 },
-	{ -0.022887, 0.008785, 0.034890, 0.060446, 0.877701, -0.475382, 0.047056, -0.478229, -0.876974, 1.000000, 0.315420, 0.502220, 1, 21, 22, 4, 0.416530, 0.241393, 0.222141, 0.119936 },
-	{ -0.020526, 0.009832, 0.036964, 0.006258, 0.878891, -0.476981, 0.039774, -0.476832, -0.878094, 1.000000, 0.310170, 0.509010, 21, 1, 22, 4, 0.335496, 0.320264, 0.275696, 0.068544 },
-	{ -0.017855, 0.010949, 0.038926, -0.064994, 0.887833, -0.455553, 0.034947, -0.454213, -0.890208, 1.000000, 0.304930, 0.516450, 21, 22, 1, 4, 0.436708, 0.350716, 0.194495, 0.018081 },
-	{ -0.014865, 0.012197, 0.040744, -0.149333, 0.900100, -0.409292, 0.022911, -0.410673, -0.911495, 1.000000, 0.299750, 0.524680, 21, 22, 1, 4, 0.526841, 0.398949, 0.071795, 0.002415 },
-	{ -0.011569, 0.013632, 0.042452, -0.228949, 0.913856, -0.335335, 0.022793, -0.339358, -0.940381, 1.000000, 0.294800, 0.533510, 21, 22, 1, 1, 0.590066, 0.396422, 0.013513, 0.000000 },
-	{ -0.007828, 0.015252, 0.044156, -0.263820, 0.933440, -0.243082, 0.026211, -0.244979, -0.969174, 1.000000, 0.289510, 0.543770, 21, 22, 1, 1, 0.622531, 0.375507, 0.001961, 0.000000 },
-	{ -0.003959, 0.016684, 0.045796, -0.227589, 0.964732, -0.132273, 0.013801, -0.132628, -0.991070, 1.000000, 0.284290, 0.554320, 21, 22, 1, 1, 0.633176, 0.366824, 0.000000, 0.000000 },
-	{ -0.000325, 0.017489, 0.047336, -0.111354, 0.993776, -0.003129, 0.010568, -0.001965, -0.999942, 1.000000, 0.279970, 0.563960, 21, 22, 1, 1, 0.633699, 0.366302, 0.000000, 0.000000 },
-	{ 0.003027, 0.017496, 0.048860, 0.073314, 0.988245, 0.134154, 0.040094, 0.131486, -0.990507, 1.000000, 0.276060, 0.572870, 21, 22, 1, 1, 0.633726, 0.366274, 0.000000, 0.000000 },
-	{ 0.004390, 0.017654, 0.046247, 0.095896, 0.994476, 0.042687, 0.018793, 0.041068, -0.998980, 1.000000, 0.282440, 0.576390, 22, 21, 1, 1, 0.506876, 0.493125, 0.000000, 0.000000 },
-	{ 0.007335, 0.016829, 0.047810, 0.341831, 0.923104, 0.176155, 0.067344, 0.162903, -0.984341, 1.000000, 0.278340, 0.584450, 22, 21, 1, 1, 0.505322, 0.494678, 0.000000, 0.000000 },
-	{ 0.009837, 0.015057, 0.049111, 0.602994, 0.745018, 0.285213, 0.129033, 0.261730, -0.956477, 1.000000, 0.274440, 0.592270, 22, 21, 1, 1, 0.504245, 0.495755, 0.000000, 0.000000 },
-	{ 0.011747, 0.012349, 0.049956, 0.801609, 0.489505, 0.343231, 0.198108, 0.324183, -0.925018, 1.000000, 0.270690, 0.600570, 22, 21, 1, 1, 0.505673, 0.494327, 0.000000, 0.000000 },
-	{ 0.013038, 0.008863, 0.050271, 0.900869, 0.256077, 0.350513, 0.251560, 0.350081, -0.902309, 1.000000, 0.267120, 0.609940, 22, 21, 1, 1, 0.512893, 0.487107, 0.000000, 0.000000 },
-	{ 0.013718, 0.004997, 0.050073, 0.942803, 0.062366, 0.327465, 0.284002, 0.364087, -0.887008, 1.000000, 0.263850, 0.620600, 22, 21, 1, 1, 0.531096, 0.468904, 0.000000, 0.000000 },
-	{ 0.012159, 0.008483, 0.052827, 0.895517, 0.276215, 0.348933, 0.236313, 0.369251, -0.898783, 1.000000, 0.260620, 0.608170, 21, 22, 1, 1, 0.638085, 0.361915, 0.000000, 0.000000 },
-	{ 0.012952, 0.004488, 0.052564, 0.951630, 0.086051, 0.294951, 0.242447, 0.379376, -0.892913, 1.000000, 0.257280, 0.619140, 21, 22, 1, 1, 0.621001, 0.378999, 0.000000, 0.000000 },
-	{ 0.010771, 0.012056, 0.052509, 0.775364, 0.505359, 0.378712, 0.208234, 0.361558, -0.908799, 1.000000, 0.264350, 0.598530, 21, 22, 1, 1, 0.642207, 0.357793, 0.000000, 0.000000 },
-	{ 0.008757, 0.014806, 0.051645, 0.560525, 0.750082, 0.350984, 0.156764, 0.320055, -0.934339, 1.000000, 0.268240, 0.589970, 21, 22, 1, 1, 0.639821, 0.360179, 0.000000, 0.000000 },
-	{ 0.006120, 0.016613, 0.050360, 0.303159, 0.917049, 0.259066, 0.091600, 0.242557, -0.965803, 1.000000, 0.272170, 0.581630, 21, 22, 1, 1, 0.635998, 0.364002, 0.000000, 0.000000 },
-	{ 0.010994, 0.007765, 0.056421, 0.877469, 0.309485, 0.366424, 0.235231, 0.388096, -0.891094, 1.000000, 0.251410, 0.606080, 21, 22, 1, 1, 0.752645, 0.237007, 0.010348, 0.000000 },
-	{ 0.012011, 0.003649, 0.056050, 0.944680, 0.110384, 0.308861, 0.242498, 0.399003, -0.884303, 1.000000, 0.248130, 0.617420, 21, 22, 1, 1, 0.737895, 0.250672, 0.011433, 0.000000 },
-	{ 0.009369, 0.011410, 0.056054, 0.740005, 0.538375, 0.403168, 0.213009, 0.380976, -0.899714, 1.000000, 0.255470, 0.595880, 21, 22, 1, 1, 0.756490, 0.235813, 0.007697, 0.000000 },
-	{ 0.007157, 0.014218, 0.055118, 0.518780, 0.762319, 0.386959, 0.172875, 0.349739, -0.920759, 1.000000, 0.259620, 0.586740, 21, 22, 1, 1, 0.755114, 0.240246, 0.004639, 0.000000 },
-	{ 0.004320, 0.016093, 0.053811, 0.279324, 0.909176, 0.308832, 0.121064, 0.285720, -0.950635, 1.000000, 0.263650, 0.577580, 21, 22, 1, 1, 0.752741, 0.245159, 0.002099, 0.000000 },
-	{ 0.001062, 0.017048, 0.052345, 0.070032, 0.978423, 0.194383, 0.078824, 0.188825, -0.978842, 1.000000, 0.267420, 0.568140, 21, 22, 1, 1, 0.751019, 0.246809, 0.002172, 0.000000 },
-	{ -0.002378, 0.017132, 0.050832, -0.100402, 0.992638, 0.067743, 0.046848, 0.072728, -0.996251, 1.000000, 0.271160, 0.558760, 21, 22, 1, 1, 0.749752, 0.244985, 0.005263, 0.000000 },
-	{ -0.006028, 0.016500, 0.049225, -0.209464, 0.976758, -0.045482, 0.034050, -0.039200, -0.998651, 1.000000, 0.275420, 0.549010, 21, 22, 1, 1, 0.744635, 0.248492, 0.006873, 0.000000 },
-	{ -0.009932, 0.015297, 0.047383, -0.245384, 0.960368, -0.132214, 0.025883, -0.129845, -0.991197, 1.000000, 0.280860, 0.538340, 21, 22, 1, 1, 0.725403, 0.261261, 0.013335, 0.000000 },
-	{ -0.013694, 0.013947, 0.045292, -0.221492, 0.955067, -0.196947, 0.011179, -0.199463, -0.979842, 1.000000, 0.287090, 0.527950, 21, 22, 1, 1, 0.677915, 0.282043, 0.040042, 0.000000 },
-	{ -0.016947, 0.012788, 0.043177, -0.170622, 0.952089, -0.253801, 0.012377, -0.255487, -0.966733, 1.000000, 0.292680, 0.519280, 21, 22, 1, 4, 0.593385, 0.269553, 0.134624, 0.002438 },
-	{ -0.019853, 0.011703, 0.041045, -0.123921, 0.944780, -0.303373, 0.028365, -0.302232, -0.952813, 1.000000, 0.298300, 0.511290, 21, 1, 22, 4, 0.478487, 0.260125, 0.246040, 0.015348 },
-	{ -0.022445, 0.010642, 0.038802, -0.088945, 0.936573, -0.339000, 0.042151, -0.336505, -0.940738, 1.000000, 0.304230, 0.503980, 1, 21, 22, 4, 0.394213, 0.354080, 0.192884, 0.058823 },
-	{ -0.024719, 0.009582, 0.036480, -0.063193, 0.931975, -0.356974, 0.053800, -0.353987, -0.933702, 1.000000, 0.310190, 0.497430, 1, 21, 22, 4, 0.497648, 0.242229, 0.156095, 0.104028 },
-	{ -0.026689, 0.008542, 0.034077, -0.041725, 0.934538, -0.353410, 0.068451, -0.350213, -0.934166, 1.000000, 0.316280, 0.491520, 1, 4, 21, 22, 0.566895, 0.162885, 0.155154, 0.115067 },
-	{ -0.028385, 0.007564, 0.031582, -0.024771, 0.946037, -0.323112, 0.083014, -0.320148, -0.943724, 1.000000, 0.322290, 0.486230, 1, 4, 21, 22, 0.602517, 0.225902, 0.093716, 0.077866 },
-	{ -0.029861, 0.006696, 0.028926, -0.010068, 0.962836, -0.269901, 0.096745, -0.267710, -0.958630, 1.000000, 0.328470, 0.481350, 1, 4, 21, 22, 0.606854, 0.291965, 0.052985, 0.048196 },
-	{ -0.031169, 0.005983, 0.026068, 0.007594, 0.977923, -0.208828, 0.105836, -0.208447, -0.972291, 1.000000, 0.334820, 0.476800, 1, 4, 21, 22, 0.585707, 0.363785, 0.027129, 0.023379 },
-	{ -0.032396, 0.005429, 0.022983, 0.029094, 0.987384, -0.155651, 0.105247, -0.157877, -0.981834, 1.000000, 0.341460, 0.472370, 1, 4, 21, 1, 0.543788, 0.444340, 0.011872, 0.000000 },
-	{ -0.033634, 0.005011, 0.019589, 0.046830, 0.991585, -0.120688, 0.086750, -0.124402, -0.988433, 1.000000, 0.348600, 0.467860, 4, 1, 21, 1, 0.542492, 0.453345, 0.004164, 0.000000 },
-	{ -0.034975, 0.004678, 0.015850, 0.046017, 0.993033, -0.108482, 0.047751, -0.110660, -0.992711, 1.000000, 0.356610, 0.463280, 4, 1, 21, 1, 0.662801, 0.336093, 0.001107, 0.000000 },
-	{ -0.036312, 0.004340, 0.011897, 0.009356, 0.994702, -0.102377, -0.001085, -0.102372, -0.994746, 1.000000, 0.365440, 0.459240, 4, 1, 1, 1, 0.803105, 0.196895, 0.000000, 0.000000 },
-	{ -0.034668, 0.003603, 0.007321, 0.200946, 0.976024, -0.083658, -0.047330, -0.075627, -0.996012, 1.000000, 0.375450, 0.464720, 4, 1, 1, 1, 0.938438, 0.061562, 0.000000, 0.000000 },
-	{ -0.035103, 0.003549, 0.003546, 0.157385, 0.986817, -0.037720, -0.043868, -0.031172, -0.998551, 1.000000, 0.383210, 0.463710, 4, 1, 1, 1, 0.983649, 0.016351, 0.000000, 0.000000 },
-	{ -0.035301, 0.003419, -0.001321, 0.070599, 0.995749, -0.059162, -0.101676, -0.051817, -0.993467, 1.000000, 0.394640, 0.464170, 4, 1, 1, 1, 0.997597, 0.002403, 0.000000, 0.000000 },
-	{ -0.035017, 0.002985, -0.006778, -0.002114, 0.996215, -0.086896, -0.140354, -0.086332, -0.986331, 1.000000, 0.407200, 0.467600, 4, 5, 1, 1, 0.998032, 0.001968, 0.000000, 0.000000 },
-	{ -0.037341, 0.004034, 0.007918, -0.027850, 0.997035, -0.071730, -0.009482, -0.072018, -0.997358, 1.000000, 0.374440, 0.456520, 4, 1, 1, 1, 0.915535, 0.084465, 0.000000, 0.000000 },
-	{ -0.037679, 0.003808, 0.003693, -0.054125, 0.996462, -0.064306, -0.026248, -0.065798, -0.997488, 1.000000, 0.383630, 0.455650, 4, 1, 1, 1, 0.975863, 0.024137, 0.000000, 0.000000 },
-	{ -0.037543, 0.003403, -0.001204, -0.107699, 0.988978, -0.101609, -0.084806, -0.110970, -0.990199, 1.000000, 0.394970, 0.456800, 4, 1, 1, 1, 0.995421, 0.004579, 0.000000, 0.000000 },
-	{ -0.036998, 0.002798, -0.006778, -0.169351, 0.978020, -0.121644, -0.137107, -0.145606, -0.979796, 1.000000, 0.407990, 0.460950, 4, 5, 1, 1, 0.998527, 0.001473, 0.000000, 0.000000 },
-	{ -0.016901, -0.020069, -0.046654, -0.304635, -0.951993, -0.030125, 0.949690, -0.301180, -0.085903, 1.000000, 0.554250, 0.469510, 6, 5, 1, 1, 0.914351, 0.085649, 0.000000, 0.000000 },
-	{ -0.019061, -0.019494, -0.043843, -0.274497, -0.961179, -0.028049, 0.949451, -0.266297, -0.166220, 1.000000, 0.546620, 0.462850, 6, 5, 1, 1, 0.774196, 0.225804, 0.000000, 0.000000 },
-	{ -0.017858, -0.019786, -0.043054, -0.164183, -0.983598, 0.074700, 0.969879, -0.174779, -0.169669, 1.000000, 0.549830, 0.460150, 6, 5, 1, 1, 0.755185, 0.244815, 0.000000, 0.000000 },
-	{ -0.015754, -0.020384, -0.045765, -0.192402, -0.978435, 0.075149, 0.976772, -0.198310, -0.081181, 1.000000, 0.557540, 0.466820, 6, 5, 1, 1, 0.914442, 0.085558, 0.000000, 0.000000 },
-	{ -0.017882, -0.019652, -0.047327, -0.377349, -0.919574, -0.109503, 0.924707, -0.367734, -0.098428, 1.000000, 0.551320, 0.471490, 6, 5, 1, 1, 0.932677, 0.067323, 0.000000, 0.000000 },
-	{ -0.020100, -0.019116, -0.044453, -0.344483, -0.933715, -0.097512, 0.931899, -0.327540, -0.155826, 1.000000, 0.543680, 0.464900, 6, 5, 1, 1, 0.784851, 0.215149, 0.000000, 0.000000 },
-	{ -0.018703, -0.019185, -0.047877, -0.444747, -0.875093, -0.190822, 0.895150, -0.427129, -0.127540, 1.000000, 0.548900, 0.473220, 6, 5, 1, 1, 0.938239, 0.061761, 0.000000, 0.000000 },
-	{ -0.020957, -0.018691, -0.044964, -0.416426, -0.893451, -0.168330, 0.904998, -0.389633, -0.170773, 1.000000, 0.541260, 0.466530, 6, 5, 1, 1, 0.776155, 0.223845, 0.000000, 0.000000 },
-	{ -0.019505, -0.018607, -0.048410, -0.492732, -0.829767, -0.262110, 0.870098, -0.465638, -0.161589, 1.000000, 0.546390, 0.475010, 6, 5, 1, 1, 0.933152, 0.066848, 0.000000, 0.000000 },
-	{ -0.021743, -0.018161, -0.045539, -0.473347, -0.851588, -0.225255, 0.875414, -0.426340, -0.227782, 1.000000, 0.539010, 0.468460, 6, 5, 1, 1, 0.739920, 0.260080, 0.000000, 0.000000 },
-	{ -0.020386, -0.017874, -0.048995, -0.531064, -0.779321, -0.332610, 0.847316, -0.490808, -0.202887, 1.000000, 0.543320, 0.477150, 6, 5, 1, 1, 0.933833, 0.066167, 0.000000, 0.000000 },
-	{ -0.022538, -0.017481, -0.046280, -0.527061, -0.802411, -0.279899, 0.845411, -0.461532, -0.268829, 1.000000, 0.536740, 0.471180, 6, 5, 1, 1, 0.782078, 0.217922, 0.000000, 0.000000 },
-	{ -0.025926, -0.002809, -0.010431, 0.945762, 0.265025, 0.187874, -0.189124, 0.919393, -0.344889, 1.000000, 0.809140, 0.784830, 4, 5, 1, 1, 0.966339, 0.033661, 0.000000, 0.000000 },
-	{ -0.026783, -0.000770, -0.010658, 0.832010, 0.534434, 0.148795, -0.438654, 0.797970, -0.413311, 1.000000, 0.815540, 0.783190, 4, 5, 1, 1, 0.966223, 0.033777, 0.000000, 0.000000 },
-	{ -0.025935, -0.000823, -0.014830, 0.818657, 0.557713, 0.136956, -0.450679, 0.771728, -0.448691, 1.000000, 0.820010, 0.793830, 4, 5, 1, 1, 0.861821, 0.138179, 0.000000, 0.000000 },
-	{ -0.025112, -0.002710, -0.014587, 0.942457, 0.285903, 0.173306, -0.198671, 0.895844, -0.397484, 1.000000, 0.814070, 0.795480, 4, 5, 1, 1, 0.889669, 0.110331, 0.000000, 0.000000 },
-	{ -0.024574, -0.005432, -0.014473, 0.977171, 0.087394, 0.193647, -0.011363, 0.931670, -0.363128, 1.000000, 0.805740, 0.798150, 4, 5, 1, 1, 0.870679, 0.129321, 0.000000, 0.000000 },
-	{ -0.025467, -0.005627, -0.010267, 0.975787, 0.045913, 0.213849, 0.020214, 0.954606, -0.297187, 1.000000, 0.800710, 0.786960, 4, 5, 1, 1, 0.958923, 0.041077, 0.000000, 0.000000 },
-	{ -0.024549, -0.008708, -0.014517, 0.967622, -0.119495, 0.222324, 0.188773, 0.927317, -0.323185, 1.000000, 0.796290, 0.801630, 4, 5, 1, 1, 0.851269, 0.148731, 0.000000, 0.000000 },
-	{ -0.025638, -0.008905, -0.010236, 0.955019, -0.176132, 0.238572, 0.237987, 0.935194, -0.262248, 1.000000, 0.791360, 0.789520, 4, 5, 1, 1, 0.957486, 0.042514, 0.000000, 0.000000 },
-	{ -0.026651, -0.012198, -0.010310, 0.880924, -0.402267, 0.249310, 0.456140, 0.862098, -0.220734, 1.000000, 0.780690, 0.792460, 4, 5, 1, 1, 0.965283, 0.034717, 0.000000, 0.000000 },
-	{ -0.025319, -0.012088, -0.014621, 0.903070, -0.350760, 0.247855, 0.411675, 0.871424, -0.266730, 1.000000, 0.785640, 0.805130, 4, 5, 1, 1, 0.867018, 0.132982, 0.000000, 0.000000 },
-	{ -0.026764, -0.014707, -0.014731, 0.755791, -0.605534, 0.249217, 0.650394, 0.738337, -0.178454, 1.000000, 0.776140, 0.807550, 4, 5, 1, 1, 0.884492, 0.115508, 0.000000, 0.000000 },
-	{ -0.028258, -0.014638, -0.010405, 0.722453, -0.652578, 0.228480, 0.689688, 0.703536, -0.171372, 1.000000, 0.771480, 0.794430, 4, 5, 1, 1, 0.967884, 0.032116, 0.000000, 0.000000 },
-	{ -0.028383, -0.016101, -0.014913, 0.465776, -0.861617, 0.201666, 0.884897, 0.452684, -0.109703, 1.000000, 0.769850, 0.808890, 4, 5, 1, 1, 0.876794, 0.123206, 0.000000, 0.000000 },
-	{ -0.029968, -0.015869, -0.010573, 0.421270, -0.893761, 0.154023, 0.905227, 0.403948, -0.131876, 1.000000, 0.765520, 0.795910, 4, 5, 1, 1, 0.965379, 0.034621, 0.000000, 0.000000 },
-	{ -0.030095, -0.016619, -0.015150, 0.166436, -0.977725, 0.127881, 0.984927, 0.158648, -0.068916, 1.000000, 0.764750, 0.810080, 4, 5, 1, 1, 0.876989, 0.123011, 0.000000, 0.000000 },
-	{ -0.031840, -0.016318, -0.010705, 0.157775, -0.985021, 0.069582, 0.983692, 0.150618, -0.098305, 1.000000, 0.759990, 0.796970, 4, 5, 1, 1, 0.972214, 0.027786, 0.000000, 0.000000 },
-	{ -0.028049, 0.000591, -0.010929, 0.627096, 0.774377, 0.084207, -0.662023, 0.586811, -0.466239, 1.000000, 0.821310, 0.781610, 4, 5, 1, 1, 0.956339, 0.043661, 0.000000, 0.000000 },
-	{ -0.027151, 0.000396, -0.015199, 0.594560, 0.801136, 0.068401, -0.678367, 0.545473, -0.492217, 1.000000, 0.825420, 0.792560, 4, 5, 1, 1, 0.822055, 0.177945, 0.000000, 0.000000 },
-	{ -0.031987, -0.016726, -0.015239, 0.008608, -0.997322, 0.072635, 0.998638, 0.004836, -0.051946, 1.000000, 0.758940, 0.810610, 4, 5, 1, 1, 0.899959, 0.100041, 0.000000, 0.000000 },
-	{ -0.033909, -0.016460, -0.010713, 0.035798, -0.999306, 0.010322, 0.994083, 0.034547, -0.102983, 1.000000, 0.753540, 0.797540, 4, 5, 1, 1, 0.983268, 0.016732, 0.000000, 0.000000 },
-	{ -0.035759, -0.016726, -0.005748, 0.083907, -0.992388, -0.090146, 0.963281, 0.103934, -0.247564, 1.000000, 0.747720, 0.783830, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.033614, -0.016470, -0.005641, 0.191503, -0.981048, -0.029529, 0.964902, 0.193689, -0.177339, 1.000000, 0.753870, 0.782140, 4, 5, 1, 1, 0.997876, 0.002124, 0.000000, 0.000000 },
-	{ -0.031580, -0.015939, -0.005534, 0.423997, -0.903369, 0.064427, 0.898831, 0.411011, -0.152223, 1.000000, 0.759960, 0.780930, 4, 5, 1, 1, 0.995835, 0.004165, 0.000000, 0.000000 },
-	{ -0.029787, -0.014725, -0.005337, 0.714517, -0.681405, 0.158594, 0.699437, 0.690585, -0.184067, 1.000000, 0.765750, 0.779210, 4, 5, 1, 1, 0.995441, 0.004559, 0.000000, 0.000000 },
-	{ -0.028132, -0.012308, -0.005197, 0.875332, -0.441799, 0.196489, 0.475992, 0.858784, -0.189530, 1.000000, 0.774600, 0.777070, 4, 5, 1, 1, 0.995577, 0.004423, 0.000000, 0.000000 },
-	{ -0.037102, -0.017520, -0.001753, 0.138455, -0.961630, -0.236851, 0.857140, 0.236157, -0.457756, 1.000000, 0.742560, 0.774460, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.034956, -0.017176, -0.001411, 0.255577, -0.951612, -0.170636, 0.885745, 0.301214, -0.353165, 1.000000, 0.747800, 0.770860, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.032836, -0.016485, -0.001061, 0.480318, -0.875527, -0.052412, 0.845922, 0.478209, -0.236076, 1.000000, 0.753640, 0.767990, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.030882, -0.015056, -0.000660, 0.733784, -0.676068, 0.067031, 0.673592, 0.711126, -0.201429, 1.000000, 0.760070, 0.765520, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.038040, -0.018601, 0.000553, 0.201384, -0.834304, -0.513207, 0.695539, 0.490716, -0.524808, 1.000000, 0.738610, 0.770560, 4, 8, 1, 1, 0.987757, 0.012243, 0.000000, 0.000000 },
-	{ -0.038877, -0.019843, 0.001449, 0.293270, -0.428679, -0.854533, 0.493234, 0.833537, -0.248871, 1.000000, 0.735610, 0.770010, 4, 8, 1, 1, 0.894032, 0.104601, 0.001367, 0.000000 },
-	{ -0.039748, -0.021219, 0.001359, 0.456803, 0.091237, -0.884877, 0.184159, 0.963478, 0.194410, 1.000000, 0.732680, 0.770700, 4, 8, 1, 1, 0.603709, 0.394531, 0.001760, 0.000000 },
-	{ -0.040603, -0.022527, 0.000255, 0.632193, 0.443056, -0.635636, -0.203104, 0.886451, 0.415877, 1.000000, 0.729710, 0.772920, 8, 4, 1, 1, 0.765059, 0.233095, 0.001846, 0.000000 },
-	{ -0.029089, -0.012448, -0.000303, 0.881680, -0.456553, 0.119165, 0.471680, 0.859532, -0.196780, 1.000000, 0.769250, 0.762360, 4, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026910, -0.008993, -0.005175, 0.954259, -0.225754, 0.196023, 0.264673, 0.942805, -0.202650, 1.000000, 0.785860, 0.774880, 4, 5, 1, 1, 0.993962, 0.006038, 0.000000, 0.000000 },
-	{ -0.026517, -0.005689, -0.005284, 0.984527, 0.001472, 0.175227, 0.038871, 0.973218, -0.226575, 1.000000, 0.795510, 0.773160, 4, 5, 1, 1, 0.992544, 0.007456, 0.000000, 0.000000 },
-	{ -0.026836, -0.002852, -0.005517, 0.960450, 0.235527, 0.148536, -0.189014, 0.943162, -0.273347, 1.000000, 0.803920, 0.771830, 4, 5, 1, 1, 0.992676, 0.007324, 0.000000, 0.000000 },
-	{ -0.027638, -0.000728, -0.005797, 0.858673, 0.499693, 0.113965, -0.435282, 0.828396, -0.352549, 1.000000, 0.810750, 0.770710, 4, 5, 1, 1, 0.993200, 0.006800, 0.000000, 0.000000 },
-	{ -0.028839, 0.000748, -0.006029, 0.678118, 0.732183, 0.063758, -0.649035, 0.637289, -0.415472, 1.000000, 0.816640, 0.769270, 4, 5, 1, 1, 0.993727, 0.006273, 0.000000, 0.000000 },
-	{ -0.031659, -0.050719, -0.050031, -0.078898, -0.989328, 0.122496, 0.495966, -0.145548, -0.856057, 1.000000, 0.552610, 0.235100, 10, 9, 1, 1, 0.528641, 0.471359, 0.000000, 0.000000 },
-	{ -0.033878, -0.050233, -0.047055, -0.079962, -0.992094, 0.096729, 0.444461, -0.122345, -0.887404, 1.000000, 0.542300, 0.236980, 9, 10, 1, 1, 0.737584, 0.262416, 0.000000, 0.000000 },
-	{ -0.032166, -0.050139, -0.046074, 0.051531, -0.983326, 0.174400, 0.433404, -0.135310, -0.890984, 1.000000, 0.542480, 0.231220, 9, 10, 1, 1, 0.690405, 0.309595, 0.000000, 0.000000 },
-	{ -0.029974, -0.050541, -0.048831, 0.046082, -0.974391, 0.220089, 0.507130, -0.167000, -0.845536, 1.000000, 0.552440, 0.229440, 10, 9, 1, 1, 0.548859, 0.451141, 0.000000, 0.000000 },
-	{ -0.033049, -0.050632, -0.051033, -0.181012, -0.982827, 0.035868, 0.509645, -0.124931, -0.851266, 1.000000, 0.552670, 0.239610, 9, 10, 1, 1, 0.504586, 0.495414, 0.000000, 0.000000 },
-	{ -0.035551, -0.050075, -0.048013, -0.195552, -0.980433, 0.022612, 0.456321, -0.111376, -0.882818, 1.000000, 0.542130, 0.241470, 9, 10, 1, 1, 0.765450, 0.234550, 0.000000, 0.000000 },
-	{ -0.034115, -0.050380, -0.051855, -0.303128, -0.950157, -0.072904, 0.527275, -0.103507, -0.843367, 1.000000, 0.552770, 0.243250, 9, 10, 1, 1, 0.508335, 0.491665, 0.000000, 0.000000 },
-	{ -0.036658, -0.049766, -0.048736, -0.334916, -0.939354, -0.073789, 0.454014, -0.092260, -0.886205, 1.000000, 0.542200, 0.245080, 9, 10, 1, 1, 0.760193, 0.239807, 0.000000, 0.000000 },
-	{ -0.035013, -0.049935, -0.052618, -0.447071, -0.869376, -0.210505, 0.540118, -0.074781, -0.838261, 1.000000, 0.552910, 0.246440, 10, 9, 1, 1, 0.509725, 0.490275, 0.000000, 0.000000 },
-	{ -0.037602, -0.049261, -0.049461, -0.491498, -0.849382, -0.192299, 0.463517, -0.068202, -0.883459, 1.000000, 0.542410, 0.248390, 9, 10, 1, 1, 0.735863, 0.264137, 0.000000, 0.000000 },
-	{ -0.035887, -0.049142, -0.053462, -0.583457, -0.727576, -0.360847, 0.568271, -0.048317, -0.821422, 1.000000, 0.553020, 0.250200, 10, 9, 1, 1, 0.525967, 0.474033, 0.000000, 0.000000 },
-	{ -0.039631, -0.057153, -0.008493, 0.801966, 0.576400, -0.156885, -0.489747, 0.784783, 0.379821, 1.000000, 0.599100, 0.780910, 17, 18, 1, 1, 0.807473, 0.192527, 0.000000, 0.000000 },
-	{ -0.041646, -0.055623, -0.009572, 0.545108, 0.797909, -0.257291, -0.673898, 0.599588, 0.431689, 1.000000, 0.603830, 0.786700, 17, 18, 1, 1, 0.791769, 0.208231, 0.000000, 0.000000 },
-	{ -0.041196, -0.056782, -0.012307, 0.535729, 0.827041, -0.170286, -0.713763, 0.551297, 0.431988, 1.000000, 0.598500, 0.793110, 17, 18, 1, 1, 0.533033, 0.466967, 0.000000, 0.000000 },
-	{ -0.039406, -0.058192, -0.011127, 0.785312, 0.616555, -0.056079, -0.546843, 0.733271, 0.404076, 1.000000, 0.593840, 0.787210, 17, 18, 1, 1, 0.540907, 0.459093, 0.000000, 0.000000 },
-	{ -0.038058, -0.060053, -0.007432, 0.954295, 0.294381, -0.051579, -0.255300, 0.892683, 0.371403, 1.000000, 0.591510, 0.774350, 17, 18, 1, 1, 0.849398, 0.150602, 0.000000, 0.000000 },
-	{ -0.037925, -0.060894, -0.010085, 0.936334, 0.343940, 0.070596, -0.340661, 0.841226, 0.419869, 1.000000, 0.586210, 0.780720, 17, 18, 1, 1, 0.608467, 0.391533, 0.000000, 0.000000 },
-	{ -0.037530, -0.063639, -0.006675, 0.998854, -0.006144, 0.047476, -0.013759, 0.913043, 0.407630, 1.000000, 0.582450, 0.768260, 17, 18, 1, 1, 0.791354, 0.208646, 0.000000, 0.000000 },
-	{ -0.037306, -0.064302, -0.009391, 0.981907, 0.039425, 0.185216, -0.126292, 0.865137, 0.485374, 1.000000, 0.577150, 0.774490, 18, 17, 1, 1, 0.546568, 0.453432, 0.000000, 0.000000 },
-	{ -0.038104, -0.066705, -0.006431, 0.932999, -0.331737, 0.139513, 0.222061, 0.835746, 0.502213, 1.000000, 0.574630, 0.763720, 17, 18, 1, 1, 0.705163, 0.294837, 0.000000, 0.000000 },
-	{ -0.037788, -0.067251, -0.009214, 0.913603, -0.301680, 0.272616, 0.096033, 0.811589, 0.576282, 1.000000, 0.569440, 0.769740, 18, 17, 1, 1, 0.576243, 0.423757, 0.000000, 0.000000 },
-	{ -0.038913, -0.069312, -0.009406, 0.741605, -0.593043, 0.313563, 0.262157, 0.686455, 0.678272, 1.000000, 0.563290, 0.765980, 18, 17, 1, 1, 0.559493, 0.440507, 0.000000, 0.000000 },
-	{ -0.039310, -0.068830, -0.006539, 0.764870, -0.613444, 0.196621, 0.392487, 0.685810, 0.612877, 1.000000, 0.568500, 0.760080, 17, 18, 1, 1, 0.686728, 0.313271, 0.000000, 0.000000 },
-	{ -0.043761, -0.054984, -0.010568, 0.315695, 0.896358, -0.311254, -0.752488, 0.436331, 0.493333, 1.000000, 0.607970, 0.792650, 17, 18, 1, 1, 0.762607, 0.237393, 0.000000, 0.000000 },
-	{ -0.043039, -0.056202, -0.013449, 0.324991, 0.916099, -0.234829, -0.786818, 0.399680, 0.470290, 1.000000, 0.602280, 0.798630, 18, 17, 1, 1, 0.517677, 0.482323, 0.000000, 0.000000 },
-	{ -0.040246, -0.070650, -0.009720, 0.547332, -0.773405, 0.319801, 0.343648, 0.556106, 0.756738, 1.000000, 0.558550, 0.762760, 18, 17, 1, 1, 0.599068, 0.400932, 0.000000, 0.000000 },
-	{ -0.040753, -0.070180, -0.006766, 0.556829, -0.801309, 0.218736, 0.493695, 0.531054, 0.688656, 1.000000, 0.563550, 0.756880, 17, 18, 1, 1, 0.655782, 0.344219, 0.000000, 0.000000 },
-	{ -0.034215, -0.076608, 0.006924, 0.562177, 0.781439, -0.270759, -0.413684, 0.549200, 0.726117, 1.000000, 0.542440, 0.702160, 13, 14, 1, 1, 0.940050, 0.059950, 0.000000, 0.000000 },
-	{ -0.036838, -0.075865, 0.005405, 0.297539, 0.887552, -0.351743, -0.481814, 0.457665, 0.747260, 1.000000, 0.543300, 0.711040, 13, 14, 1, 1, 0.920565, 0.079435, 0.000000, 0.000000 },
-	{ -0.036172, -0.077013, 0.003007, 0.306141, 0.898696, -0.314044, -0.517355, 0.433976, 0.737569, 1.000000, 0.536280, 0.713250, 13, 14, 1, 1, 0.721658, 0.278342, 0.000000, 0.000000 },
-	{ -0.033762, -0.077786, 0.004498, 0.562280, 0.796354, -0.222848, -0.445395, 0.518698, 0.729778, 1.000000, 0.535000, 0.704820, 13, 14, 1, 1, 0.793211, 0.206789, 0.000000, 0.000000 },
-	{ -0.031577, -0.078583, 0.008528, 0.804216, 0.574404, -0.152632, -0.301518, 0.615619, 0.728080, 1.000000, 0.539630, 0.691060, 13, 14, 1, 1, 0.942644, 0.057356, 0.000000, 0.000000 },
-	{ -0.031360, -0.079645, 0.006125, 0.798313, 0.592140, -0.109848, -0.332431, 0.585361, 0.739488, 1.000000, 0.532460, 0.694120, 13, 14, 1, 1, 0.808537, 0.191463, 0.000000, 0.000000 },
-	{ -0.030154, -0.081586, 0.009658, 0.979699, 0.199546, 0.019285, -0.144885, 0.638261, 0.756063, 1.000000, 0.534660, 0.680590, 13, 14, 1, 1, 0.932971, 0.067029, 0.000000, 0.000000 },
-	{ -0.029986, -0.082435, 0.007303, 0.970866, 0.229565, 0.068700, -0.197791, 0.605886, 0.770572, 1.000000, 0.528080, 0.683480, 13, 14, 1, 1, 0.826600, 0.173400, 0.000000, 0.000000 },
-	{ -0.030400, -0.084733, 0.010069, 0.959567, -0.208491, 0.189112, -0.021899, 0.614512, 0.788603, 1.000000, 0.528590, 0.671640, 13, 14, 1, 1, 0.888604, 0.111396, 0.000000, 0.000000 },
-	{ -0.030060, -0.085491, 0.007723, 0.955192, -0.157261, 0.250753, -0.105464, 0.610744, 0.784774, 1.000000, 0.522500, 0.674450, 13, 14, 1, 1, 0.714564, 0.285436, 0.000000, 0.000000 },
-	{ -0.030891, -0.088076, 0.007538, 0.833384, -0.422308, 0.356548, -0.041159, 0.595898, 0.802005, 1.000000, 0.517140, 0.667630, 13, 14, 1, 1, 0.637573, 0.362427, 0.000000, 0.000000 },
-	{ -0.031437, -0.087328, 0.009928, 0.833467, -0.463923, 0.300181, 0.037378, 0.589335, 0.807024, 1.000000, 0.522960, 0.664630, 13, 14, 1, 1, 0.847735, 0.152265, 0.000000, 0.000000 },
-	{ -0.038888, -0.075987, 0.004421, 0.027316, 0.911928, -0.409441, -0.505354, 0.365996, 0.781450, 1.000000, 0.543910, 0.717140, 13, 14, 1, 1, 0.871084, 0.128916, 0.000000, 0.000000 },
-	{ -0.038092, -0.077102, 0.002003, 0.038996, 0.918607, -0.393243, -0.549033, 0.348512, 0.759672, 1.000000, 0.537000, 0.719090, 13, 14, 1, 1, 0.639268, 0.360732, 0.000000, 0.000000 },
-	{ -0.031941, -0.089864, 0.007075, 0.669394, -0.627119, 0.398288, 0.013342, 0.546182, 0.837560, 1.000000, 0.513050, 0.662940, 13, 14, 1, 1, 0.572675, 0.427325, 0.000000, 0.000000 },
-	{ -0.032590, -0.089115, 0.009541, 0.670579, -0.648931, 0.359460, 0.081516, 0.546077, 0.833760, 1.000000, 0.518730, 0.659910, 13, 14, 1, 1, 0.810684, 0.189316, 0.000000, 0.000000 },
-	{ -0.026435, -0.083070, -0.010895, 0.568909, 0.813349, 0.121680, -0.649013, 0.353153, 0.673843, 1.000000, 0.484130, 0.719230, 14, 15, 1, 1, 0.619959, 0.380041, 0.000000, 0.000000 },
-	{ -0.028190, -0.082188, -0.012520, 0.285528, 0.953352, -0.097949, -0.697680, 0.276842, 0.660758, 1.000000, 0.485840, 0.726360, 14, 15, 1, 1, 0.557931, 0.442069, 0.000000, 0.000000 },
-	{ -0.026987, -0.082629, -0.014307, 0.257893, 0.963957, -0.065408, -0.724722, 0.237771, 0.646717, 1.000000, 0.480260, 0.727830, 15, 14, 1, 1, 0.651817, 0.348183, 0.000000, 0.000000 },
-	{ -0.025241, -0.083456, -0.012657, 0.523807, 0.834437, 0.171292, -0.695048, 0.302411, 0.652270, 1.000000, 0.478730, 0.720820, 15, 14, 1, 1, 0.591535, 0.408465, 0.000000, 0.000000 },
-	{ -0.024783, -0.085142, -0.009229, 0.745498, 0.600089, 0.290046, -0.591270, 0.394585, 0.703351, 1.000000, 0.480780, 0.709400, 14, 15, 1, 1, 0.646912, 0.353088, 0.000000, 0.000000 },
-	{ -0.023535, -0.085469, -0.011029, 0.695395, 0.622968, 0.358241, -0.663301, 0.364606, 0.653524, 1.000000, 0.475270, 0.711340, 15, 14, 1, 1, 0.587682, 0.412318, 0.000000, 0.000000 },
-	{ -0.023755, -0.087788, -0.008099, 0.841240, 0.333866, 0.425263, -0.537845, 0.436589, 0.721188, 1.000000, 0.476810, 0.700100, 14, 15, 1, 1, 0.586079, 0.413922, 0.000000, 0.000000 },
-	{ -0.022458, -0.088113, -0.009952, 0.793712, 0.357287, 0.492308, -0.607824, 0.434050, 0.664944, 1.000000, 0.471170, 0.702400, 15, 14, 1, 1, 0.660301, 0.339699, 0.000000, 0.000000 },
-	{ -0.023517, -0.090336, -0.007612, 0.852674, 0.053677, 0.519679, -0.482491, 0.462413, 0.743894, 1.000000, 0.473200, 0.692690, 14, 15, 1, 1, 0.537803, 0.462197, 0.000000, 0.000000 },
-	{ -0.022113, -0.090683, -0.009481, 0.820468, 0.077029, 0.566480, -0.530152, 0.473331, 0.703489, 1.000000, 0.467270, 0.694960, 15, 14, 1, 1, 0.696226, 0.303774, 0.000000, 0.000000 },
-	{ -0.022327, -0.092616, -0.009460, 0.781371, -0.221263, 0.583525, -0.429554, 0.487599, 0.760086, 1.000000, 0.464720, 0.689970, 15, 14, 1, 1, 0.694350, 0.305650, 0.000000, 0.000000 },
-	{ -0.023760, -0.092301, -0.007533, 0.799342, -0.222445, 0.558185, -0.411926, 0.473442, 0.778569, 1.000000, 0.470550, 0.687410, 14, 15, 1, 1, 0.540065, 0.459935, 0.000000, 0.000000 },
-	{ -0.029810, -0.082280, -0.013832, 0.003074, 0.960356, -0.278761, -0.714382, 0.197173, 0.671402, 1.000000, 0.486860, 0.732260, 14, 15, 1, 1, 0.514376, 0.485624, 0.000000, 0.000000 },
-	{ -0.028557, -0.082790, -0.015680, -0.011114, 0.964324, -0.264493, -0.733822, 0.171813, 0.657256, 1.000000, 0.480980, 0.733800, 15, 14, 1, 1, 0.691293, 0.308707, 0.000000, 0.000000 },
-	{ -0.022840, -0.093967, -0.009732, 0.686710, -0.478867, 0.546915, -0.338732, 0.454894, 0.823609, 1.000000, 0.462640, 0.686250, 15, 14, 1, 1, 0.693428, 0.306572, 0.000000, 0.000000 },
-	{ -0.024283, -0.093650, -0.007721, 0.697139, -0.474783, 0.537195, -0.336424, 0.445033, 0.829919, 1.000000, 0.468720, 0.683640, 14, 15, 1, 1, 0.569248, 0.430752, 0.000000, 0.000000 },
-	{ 0.004222, 0.012292, 0.031638, -0.426003, 0.732263, -0.531330, 0.046192, -0.568916, -0.821098, 1.000000, 0.323940, 0.576620, 22, 21, 23, 1, 0.939471, 0.044237, 0.016292, 0.000000 },
-	{ 0.002775, 0.009883, 0.029949, -0.511847, 0.650061, -0.561635, 0.095598, -0.606605, -0.789235, 1.000000, 0.332770, 0.570950, 22, 21, 23, 1, 0.928567, 0.040101, 0.031332, 0.000000 },
-	{ 0.005851, 0.009577, 0.026089, -0.583421, 0.682416, -0.440372, 0.042228, -0.515996, -0.855550, 1.000000, 0.341460, 0.580790, 22, 23, 21, 1, 0.834770, 0.152410, 0.012820, 0.000000 },
-	{ 0.007242, 0.011624, 0.027830, -0.480937, 0.764753, -0.428780, 0.014355, -0.482120, -0.875988, 1.000000, 0.333370, 0.585590, 22, 23, 21, 1, 0.869877, 0.115975, 0.014148, 0.000000 },
-	{ 0.001745, 0.007223, 0.028150, -0.609999, 0.533377, -0.586012, 0.154460, -0.645316, -0.748137, 1.000000, 0.341600, 0.566250, 22, 23, 21, 1, 0.895246, 0.072970, 0.031783, 0.000000 },
-	{ 0.004552, 0.007100, 0.024293, -0.695616, 0.552221, -0.459533, 0.107961, -0.552034, -0.826803, 1.000000, 0.350220, 0.575380, 22, 23, 21, 1, 0.768200, 0.221356, 0.010444, 0.000000 },
-	{ 0.005824, 0.013929, 0.032990, -0.265852, 0.857500, -0.440473, -0.021433, -0.462061, -0.886590, 1.000000, 0.317880, 0.581360, 22, 21, 23, 1, 0.944532, 0.047944, 0.007525, 0.000000 },
-	{ 0.008687, 0.013022, 0.029075, -0.311510, 0.878146, -0.363071, -0.024175, -0.389282, -0.920801, 1.000000, 0.328090, 0.590230, 22, 23, 21, 1, 0.901315, 0.082938, 0.015746, 0.000000 },
-	{ 0.006577, 0.006849, 0.020312, -0.732440, 0.548124, -0.403846, 0.069393, -0.529974, -0.845170, 1.000000, 0.359660, 0.582730, 22, 23, 21, 1, 0.561010, 0.436410, 0.002579, 0.000000 },
-	{ 0.008064, 0.009197, 0.021722, -0.622922, 0.695087, -0.358917, 0.007877, -0.453210, -0.891369, 1.000000, 0.352710, 0.588580, 22, 23, 21, 1, 0.607838, 0.389008, 0.003154, 0.000000 },
-	{ 0.009558, 0.008830, 0.018083, -0.637277, 0.683580, -0.355803, -0.007643, -0.467286, -0.884073, 1.000000, 0.361790, 0.594370, 23, 22, 1, 1, 0.628054, 0.371946, 0.000000, 0.000000 },
-	{ 0.008027, 0.006454, 0.017129, -0.744361, 0.526040, -0.411351, 0.062911, -0.558019, -0.827441, 1.000000, 0.367620, 0.588140, 23, 22, 1, 1, 0.623568, 0.376432, 0.000000, 0.000000 },
-	{ 0.009703, 0.011081, 0.023319, -0.517705, 0.788455, -0.332147, -0.026354, -0.402733, -0.914938, 1.000000, 0.345050, 0.594210, 22, 23, 21, 1, 0.643784, 0.352819, 0.003397, 0.000000 },
-	{ 0.011355, 0.010727, 0.019278, -0.531526, 0.791272, -0.302273, -0.055390, -0.388563, -0.919756, 1.000000, 0.355920, 0.600550, 23, 22, 1, 1, 0.615552, 0.384448, 0.000000, 0.000000 },
-	{ 0.011249, 0.012371, 0.024523, -0.346361, 0.895685, -0.278896, -0.061002, -0.318174, -0.946068, 1.000000, 0.340260, 0.599010, 22, 23, 21, 1, 0.675441, 0.320668, 0.003892, 0.000000 },
-	{ 0.013050, 0.012021, 0.020403, -0.350622, 0.905923, -0.237420, -0.094151, -0.286327, -0.953495, 1.000000, 0.351180, 0.605380, 23, 22, 1, 1, 0.611322, 0.388678, 0.000000, 0.000000 },
-	{ 0.001753, 0.002018, 0.026064, -0.795097, -0.226841, -0.562462, 0.576345, 0.006102, -0.817183, 1.000000, 0.864440, 0.651590, 22, 23, 21, 1, 0.809147, 0.175444, 0.015409, 0.000000 },
-	{ 0.003017, -0.000385, 0.026138, -0.697420, -0.584812, -0.414248, 0.541466, -0.051317, -0.839155, 1.000000, 0.865260, 0.642770, 22, 23, 21, 1, 0.810221, 0.181106, 0.008673, 0.000000 },
-	{ 0.004809, -0.000442, 0.022808, -0.746306, -0.549883, -0.375041, 0.512443, -0.115097, -0.850973, 1.000000, 0.875770, 0.643860, 22, 23, 21, 1, 0.645167, 0.352387, 0.002446, 0.000000 },
-	{ 0.003833, 0.001919, 0.022535, -0.864142, -0.176467, -0.471295, 0.492037, -0.099686, -0.864848, 1.000000, 0.875810, 0.651960, 22, 23, 21, 1, 0.694001, 0.301323, 0.004676, 0.000000 },
-	{ 0.003737, 0.004478, 0.022988, -0.825740, 0.272331, -0.493952, 0.492632, -0.078306, -0.866707, 1.000000, 0.875720, 0.659290, 22, 23, 21, 1, 0.709807, 0.282746, 0.007447, 0.000000 },
-	{ 0.001346, 0.004563, 0.026695, -0.744631, 0.252404, -0.617914, 0.646046, 0.039843, -0.762258, 1.000000, 0.864360, 0.659110, 22, 23, 21, 1, 0.839523, 0.137360, 0.023117, 0.000000 },
-	{ 0.004827, -0.002389, 0.026853, -0.542549, -0.793476, -0.275749, 0.543644, -0.081419, -0.835358, 1.000000, 0.866020, 0.633470, 22, 23, 21, 1, 0.851114, 0.144389, 0.004497, 0.000000 },
-	{ 0.006466, -0.002433, 0.023595, -0.560023, -0.784296, -0.266934, 0.544661, -0.105756, -0.831962, 1.000000, 0.876290, 0.635060, 22, 23, 21, 1, 0.710427, 0.288425, 0.001148, 0.000000 },
-	{ 0.004552, 0.007100, 0.024293, -0.695616, 0.552221, -0.459533, 0.516974, -0.059393, -0.853939, 1.000000, 0.875610, 0.667890, 22, 23, 21, 1, 0.768200, 0.221356, 0.010444, 0.000000 },
-	{ 0.001745, 0.007223, 0.028150, -0.609999, 0.533377, -0.586012, 0.710341, 0.040340, -0.702701, 1.000000, 0.864750, 0.667740, 22, 23, 21, 1, 0.895246, 0.072970, 0.031783, 0.000000 },
-	{ 0.006424, -0.000628, 0.019658, -0.759125, -0.549082, -0.349625, 0.511405, -0.170768, -0.842201, 1.000000, 0.886330, 0.645230, 23, 22, 1, 1, 0.520756, 0.479244, 0.000000, 0.000000 },
-	{ 0.008050, -0.002585, 0.020567, -0.563631, -0.790217, -0.240579, 0.552781, -0.144412, -0.820719, 1.000000, 0.886510, 0.636600, 22, 23, 1, 1, 0.512709, 0.487291, 0.000000, 0.000000 },
-	{ 0.007768, -0.000944, 0.017144, -0.771486, -0.558243, -0.305243, 0.496496, -0.228214, -0.837502, 1.000000, 0.895040, 0.646210, 23, 22, 1, 1, 0.638796, 0.361204, 0.000000, 0.000000 },
-	{ 0.009419, -0.002885, 0.018115, -0.580952, -0.794850, -0.175237, 0.533051, -0.208844, -0.819903, 1.000000, 0.895140, 0.637630, 23, 22, 1, 1, 0.609303, 0.390697, 0.000000, 0.000000 },
-	{ 0.005542, 0.001705, 0.019208, -0.882712, -0.167105, -0.439198, 0.464849, -0.173656, -0.868193, 1.000000, 0.886480, 0.652970, 22, 23, 21, 1, 0.530792, 0.468179, 0.001029, 0.000000 },
-	{ 0.006900, 0.001375, 0.016578, -0.891311, -0.179056, -0.416537, 0.449939, -0.236150, -0.861271, 1.000000, 0.895210, 0.653860, 23, 22, 1, 1, 0.639876, 0.360124, 0.000000, 0.000000 },
-	{ 0.007007, 0.003887, 0.016554, -0.857233, 0.251569, -0.449293, 0.399993, -0.224159, -0.888683, 1.000000, 0.895500, 0.660900, 23, 22, 1, 1, 0.619594, 0.380406, 0.000000, 0.000000 },
-	{ 0.005609, 0.004254, 0.019414, -0.849474, 0.272070, -0.452075, 0.424914, -0.155185, -0.891833, 1.000000, 0.886490, 0.660090, 22, 23, 21, 1, 0.544893, 0.453312, 0.001795, 0.000000 },
-	{ 0.008027, 0.006454, 0.017129, -0.744361, 0.526040, -0.411351, 0.371442, -0.185752, -0.909685, 1.000000, 0.895550, 0.669150, 23, 22, 1, 1, 0.623568, 0.376432, 0.000000, 0.000000 },
-	{ 0.006577, 0.006849, 0.020312, -0.732440, 0.548124, -0.403846, 0.405573, -0.125163, -0.905453, 1.000000, 0.886510, 0.668510, 22, 23, 21, 1, 0.561010, 0.436410, 0.002579, 0.000000 },
-	{ -0.003964, -0.005182, 0.036537, 0.271389, -0.537555, -0.798363, 0.641352, 0.719499, -0.266438, 1.000000, 0.822930, 0.633120, 22, 21, 23, 1, 0.690861, 0.303848, 0.003328, 0.001963 },
-	{ -0.005575, -0.003982, 0.035342, 0.241563, -0.494910, -0.834693, 0.640334, 0.727604, -0.246100, 1.000000, 0.823480, 0.641270, 22, 21, 23, 1, 0.703717, 0.287677, 0.004741, 0.003865 },
-	{ -0.007028, -0.004572, 0.035202, 0.300484, -0.460507, -0.835250, 0.622822, 0.757971, -0.193838, 1.000000, 0.819500, 0.644080, 22, 21, 1, 23, 0.664775, 0.310300, 0.018991, 0.005933 },
-	{ -0.005220, -0.006863, 0.037160, 0.322219, -0.510018, -0.797532, 0.629754, 0.744495, -0.221668, 1.000000, 0.816020, 0.632550, 22, 21, 1, 23, 0.624364, 0.361652, 0.010315, 0.003670 },
-	{ -0.001746, -0.006850, 0.038547, 0.340657, -0.587442, -0.734074, 0.614364, 0.730108, -0.299165, 1.000000, 0.821770, 0.621890, 22, 21, 23, 1, 0.666811, 0.331406, 0.001782, 0.000000 },
-	{ -0.002991, -0.009105, 0.039636, 0.385888, -0.576650, -0.720115, 0.600930, 0.749377, -0.278061, 1.000000, 0.813250, 0.620030, 22, 21, 1, 23, 0.575806, 0.417934, 0.004250, 0.002011 },
-	{ -0.006906, -0.009178, 0.037886, 0.370926, -0.508030, -0.777380, 0.623958, 0.756335, -0.196555, 1.000000, 0.806560, 0.631700, 22, 21, 1, 23, 0.549551, 0.405612, 0.040869, 0.003968 },
-	{ -0.004645, -0.011858, 0.040904, 0.408822, -0.603329, -0.684733, 0.611200, 0.738187, -0.285510, 1.000000, 0.802720, 0.618390, 22, 21, 1, 23, 0.492896, 0.487516, 0.017432, 0.002156 },
-	{ -0.008726, -0.012047, 0.038891, 0.393167, -0.549026, -0.737557, 0.610909, 0.755484, -0.236715, 1.000000, 0.795040, 0.630040, 22, 21, 1, 23, 0.458272, 0.428077, 0.109749, 0.003902 },
-	{ -0.011422, -0.008659, 0.035346, 0.426102, -0.450230, -0.784685, 0.604839, 0.786792, -0.122997, 1.000000, 0.800720, 0.647880, 22, 21, 1, 4, 0.443387, 0.321004, 0.229053, 0.006556 },
-	{ -0.011761, -0.012063, 0.037284, 0.405279, -0.535961, -0.740604, 0.630908, 0.750249, -0.197691, 1.000000, 0.790780, 0.640590, 22, 21, 1, 23, 0.371194, 0.356361, 0.267759, 0.004686 },
-	{ -0.010331, -0.014687, 0.040138, 0.381831, -0.630642, -0.675645, 0.637389, 0.709057, -0.301617, 1.000000, 0.784690, 0.628320, 21, 22, 1, 23, 0.431526, 0.363019, 0.201792, 0.003663 },
-	{ -0.006581, -0.014829, 0.042502, 0.411487, -0.658473, -0.630152, 0.647312, 0.697868, -0.306540, 1.000000, 0.790850, 0.616350, 21, 22, 1, 23, 0.526374, 0.410116, 0.061215, 0.002294 },
-	{ -0.008643, -0.017514, 0.044157, 0.382079, -0.729583, -0.567208, 0.690399, 0.633350, -0.349596, 1.000000, 0.779250, 0.614180, 21, 22, 1, 23, 0.525023, 0.310413, 0.162317, 0.002247 },
-	{ -0.009006, -0.006079, 0.035236, 0.371133, -0.439811, -0.817818, 0.617583, 0.774604, -0.136307, 1.000000, 0.812400, 0.646590, 22, 21, 1, 23, 0.588002, 0.326648, 0.078626, 0.006724 },
-	{ -0.014173, -0.009042, 0.033883, 0.491486, -0.439405, -0.751908, 0.582677, 0.807585, -0.091074, 1.000000, 0.795330, 0.655410, 1, 22, 21, 4, 0.461477, 0.274974, 0.242305, 0.021245 },
-	{ -0.013299, -0.012718, 0.036896, 0.422010, -0.558580, -0.714070, 0.635063, 0.744245, -0.206867, 1.000000, 0.785910, 0.643510, 1, 21, 22, 4, 0.430633, 0.302912, 0.257954, 0.008502 },
-	{ -0.012102, -0.016343, 0.040772, 0.358442, -0.689545, -0.629323, 0.628482, 0.676710, -0.383503, 1.000000, 0.776840, 0.629190, 21, 1, 22, 4, 0.384454, 0.375995, 0.233577, 0.005974 },
-	{ -0.010762, -0.019406, 0.045440, 0.340291, -0.783615, -0.519760, 0.716612, 0.574002, -0.396220, 1.000000, 0.770020, 0.613800, 21, 1, 22, 4, 0.475491, 0.326508, 0.195904, 0.002097 },
-	{ -0.016223, -0.009765, 0.032913, 0.540583, -0.460432, -0.704111, 0.535092, 0.834009, -0.134556, 1.000000, 0.790340, 0.660440, 1, 21, 22, 4, 0.649957, 0.167106, 0.135911, 0.047025 },
-	{ -0.015040, -0.013707, 0.036592, 0.465962, -0.567640, -0.678723, 0.629837, 0.751552, -0.196149, 1.000000, 0.780390, 0.646650, 1, 21, 22, 4, 0.620959, 0.227025, 0.130745, 0.021270 },
-	{ -0.013881, -0.017463, 0.041041, 0.386491, -0.700110, -0.600392, 0.667174, 0.661694, -0.342112, 1.000000, 0.770920, 0.631990, 1, 21, 22, 4, 0.563987, 0.306138, 0.122134, 0.007741 },
-	{ -0.012811, -0.020731, 0.046245, 0.343787, -0.798117, -0.494793, 0.724812, 0.560537, -0.400557, 1.000000, 0.762840, 0.614960, 1, 21, 22, 4, 0.502068, 0.391003, 0.104832, 0.002097 },
-	{ -0.018033, -0.010746, 0.032038, 0.615087, -0.453070, -0.645288, 0.533561, 0.841737, -0.082412, 1.000000, 0.785210, 0.665660, 1, 21, 4, 22, 0.782203, 0.100438, 0.080836, 0.036524 },
-	{ -0.016518, -0.015075, 0.036677, 0.552063, -0.547458, -0.628901, 0.619199, 0.774315, -0.130495, 1.000000, 0.773560, 0.647480, 1, 21, 22, 4, 0.770857, 0.151313, 0.049054, 0.028776 },
-	{ -0.015260, -0.018749, 0.041627, 0.478100, -0.681861, -0.553613, 0.673730, 0.689097, -0.266897, 1.000000, 0.764790, 0.631770, 1, 21, 22, 4, 0.718371, 0.220032, 0.054774, 0.006822 },
-	{ -0.014487, -0.021943, 0.047071, 0.443971, -0.767818, -0.461893, 0.715186, 0.614201, -0.333566, 1.000000, 0.756600, 0.615320, 1, 21, 22, 4, 0.657155, 0.292860, 0.048413, 0.001572 },
-	{ 0.001651, -0.006494, 0.039874, 0.361131, -0.680377, -0.637709, 0.598170, 0.693643, -0.401314, 1.000000, 0.827910, 0.610860, 22, 21, 1, 1, 0.730495, 0.269505, 0.000000, 0.000000 },
-	{ -0.000913, -0.005181, 0.037540, 0.261430, -0.638752, -0.723637, 0.634580, 0.678651, -0.369786, 1.000000, 0.828080, 0.624000, 22, 21, 23, 1, 0.758010, 0.240232, 0.001758, 0.000000 },
-	{ 0.002205, -0.005181, 0.038647, 0.236019, -0.775675, -0.585341, 0.634917, 0.579099, -0.511395, 1.000000, 0.832970, 0.613310, 22, 21, 1, 1, 0.828710, 0.171289, 0.000000, 0.000000 },
-	{ -0.000317, -0.004078, 0.036643, 0.132123, -0.731877, -0.668506, 0.682713, 0.556141, -0.473930, 1.000000, 0.832380, 0.625630, 22, 21, 23, 1, 0.839391, 0.158520, 0.002089, 0.000000 },
-	{ 0.002676, -0.004332, 0.037421, 0.054155, -0.891344, -0.450083, 0.670940, 0.366311, -0.644714, 1.000000, 0.837230, 0.615580, 22, 21, 23, 1, 0.901398, 0.097138, 0.001465, 0.000000 },
-	{ 0.005177, -0.004947, 0.039529, 0.214906, -0.904644, -0.368014, 0.656790, 0.412753, -0.631080, 1.000000, 0.838370, 0.603870, 22, 21, 1, 1, 0.876168, 0.123832, 0.000000, 0.000000 },
-	{ 0.007609, -0.005034, 0.041871, 0.386852, -0.880500, -0.273981, 0.623257, 0.468635, -0.626044, 1.000000, 0.839870, 0.592050, 22, 21, 1, 1, 0.822762, 0.177238, 0.000000, 0.000000 },
-	{ 0.009847, -0.004456, 0.044264, 0.554420, -0.817429, -0.156296, 0.587949, 0.517627, -0.621593, 1.000000, 0.841760, 0.580580, 22, 21, 1, 1, 0.751363, 0.248637, 0.000000, 0.000000 },
-	{ 0.011721, -0.003183, 0.046445, 0.725495, -0.688041, -0.016045, 0.531097, 0.574531, -0.622776, 1.000000, 0.844280, 0.569910, 22, 21, 1, 1, 0.677090, 0.322910, 0.000000, 0.000000 },
-	{ 0.013062, -0.001203, 0.048177, 0.878074, -0.457283, 0.140992, 0.433273, 0.634676, -0.639891, 1.000000, 0.847680, 0.560670, 22, 21, 1, 1, 0.612656, 0.387344, 0.000000, 0.000000 },
-	{ 0.013761, 0.001526, 0.049388, 0.948914, -0.170447, 0.265536, 0.309996, 0.660562, -0.683784, 1.000000, 0.852300, 0.552210, 22, 21, 1, 1, 0.563813, 0.436187, 0.000000, 0.000000 },
-	{ 0.013718, 0.004997, 0.050073, 0.942803, 0.062366, 0.327465, 0.211657, 0.646928, -0.732589, 1.000000, 0.858640, 0.543560, 22, 21, 1, 1, 0.531096, 0.468904, 0.000000, 0.000000 },
-	{ 0.004731, -0.005907, 0.041015, 0.374720, -0.790959, -0.483704, 0.602958, 0.604220, -0.520923, 1.000000, 0.833700, 0.601030, 22, 21, 1, 1, 0.784999, 0.215001, 0.000000, 0.000000 },
-	{ 0.007154, -0.005996, 0.043660, 0.518492, -0.775647, -0.359914, 0.564073, 0.626598, -0.537770, 1.000000, 0.834910, 0.588740, 22, 21, 1, 1, 0.712084, 0.287916, 0.000000, 0.000000 },
-	{ 0.009350, -0.005365, 0.046311, 0.654852, -0.719057, -0.232650, 0.524190, 0.653901, -0.545562, 1.000000, 0.836710, 0.576770, 22, 21, 1, 1, 0.624304, 0.375696, 0.000000, 0.000000 },
-	{ 0.011170, -0.004039, 0.048639, 0.797304, -0.596545, -0.091874, 0.455105, 0.694156, -0.557697, 1.000000, 0.839330, 0.566030, 22, 21, 1, 1, 0.538760, 0.461240, 0.000000, 0.000000 },
-	{ 0.012459, -0.001969, 0.050462, 0.920496, -0.384201, 0.071252, 0.350467, 0.731119, -0.585353, 1.000000, 0.843010, 0.556860, 21, 22, 1, 1, 0.532749, 0.467251, 0.000000, 0.000000 },
-	{ 0.013089, 0.000899, 0.051770, 0.969023, -0.129220, 0.210470, 0.236055, 0.735170, -0.635455, 1.000000, 0.848060, 0.548410, 21, 22, 1, 1, 0.586051, 0.413949, 0.000000, 0.000000 },
-	{ 0.012952, 0.004488, 0.052564, 0.951630, 0.086051, 0.294951, 0.147493, 0.714192, -0.684234, 1.000000, 0.854740, 0.539740, 21, 22, 1, 1, 0.621001, 0.378999, 0.000000, 0.000000 },
-	{ 0.004211, -0.007345, 0.042646, 0.487100, -0.703689, -0.517258, 0.560667, 0.706069, -0.432573, 1.000000, 0.828070, 0.597870, 22, 21, 1, 1, 0.669450, 0.330550, 0.000000, 0.000000 },
-	{ 0.006664, -0.007447, 0.045733, 0.610005, -0.693887, -0.382642, 0.526004, 0.715743, -0.459383, 1.000000, 0.828930, 0.584710, 22, 21, 1, 1, 0.583880, 0.416120, 0.000000, 0.000000 },
-	{ 0.008857, -0.006781, 0.048793, 0.721243, -0.645247, -0.251922, 0.490100, 0.732373, -0.472687, 1.000000, 0.830490, 0.571800, 21, 22, 1, 1, 0.508746, 0.491254, 0.000000, 0.000000 },
-	{ 0.010609, -0.005398, 0.051393, 0.842274, -0.530464, -0.095828, 0.424528, 0.762317, -0.488517, 1.000000, 0.833030, 0.560890, 21, 22, 1, 1, 0.592678, 0.407322, 0.000000, 0.000000 },
-	{ 0.011813, -0.003209, 0.053443, 0.940461, -0.329390, 0.083873, 0.322642, 0.787475, -0.525154, 1.000000, 0.836880, 0.551640, 21, 22, 1, 1, 0.659198, 0.339083, 0.001720, 0.000000 },
-	{ 0.012295, -0.000137, 0.055010, 0.969738, -0.097645, 0.223772, 0.212307, 0.789836, -0.575400, 1.000000, 0.842350, 0.542870, 21, 22, 1, 1, 0.707558, 0.287539, 0.004902, 0.000000 },
-	{ 0.012011, 0.003649, 0.056050, 0.944680, 0.110384, 0.308861, 0.112264, 0.775974, -0.620695, 1.000000, 0.849320, 0.534200, 21, 22, 1, 1, 0.737895, 0.250672, 0.011433, 0.000000 },
-	{ 0.010416, 0.002354, 0.061193, 0.925097, 0.132481, 0.355871, 0.092175, 0.830794, -0.548895, 1.000000, 0.841470, 0.524450, 21, 1, 22, 1, 0.788191, 0.111481, 0.100328, 0.000000 },
-	{ 0.007888, 0.000395, 0.068082, 0.897487, 0.145656, 0.416295, 0.097100, 0.855477, -0.508656, 1.000000, 0.829670, 0.509740, 21, 1, 22, 1, 0.745660, 0.244573, 0.009767, 0.000000 },
-	{ 0.004345, -0.002287, 0.075972, 0.858725, 0.136590, 0.493896, 0.138253, 0.866325, -0.479965, 1.000000, 0.815170, 0.493190, 21, 1, 1, 1, 0.605291, 0.394709, 0.000000, 0.000000 },
-	{ -0.002916, -0.009806, -0.058352, 0.813316, 0.573123, -0.100236, -0.553712, 0.709547, -0.435828, 1.000000, 0.852530, 0.930880, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.005426, -0.007495, -0.053011, 0.630593, 0.760352, 0.155615, -0.578712, 0.594260, -0.558524, 1.000000, 0.852850, 0.912090, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.006239, -0.006889, -0.054043, 0.442352, 0.896842, 0.000289, -0.750655, 0.370424, -0.547087, 1.000000, 0.857220, 0.913000, 6, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.048955, -0.044416, 0.003966, 0.112317, -0.828565, -0.548511, 0.625937, 0.487714, -0.608554, 1.000000, 0.647690, 0.772780, 8, 17, 1, 1, 0.610111, 0.389889, 0.000000, 0.000000 },
-	{ -0.048838, -0.045578, 0.004886, 0.159416, -0.301790, -0.939952, 0.387157, 0.894967, -0.221685, 1.000000, 0.646060, 0.770910, 17, 8, 1, 1, 0.763557, 0.234791, 0.001652, 0.000000 },
-	{ -0.042828, -0.066960, 0.016259, 0.469281, -0.780988, -0.412108, 0.666883, 0.619351, -0.414333, 1.000000, 0.586520, 0.709930, 13, 17, 1, 12, 0.676791, 0.317857, 0.003285, 0.002066 },
-	{ -0.042652, -0.067779, 0.017202, 0.431697, -0.381906, -0.817182, 0.295043, 0.915898, -0.272177, 1.000000, 0.584920, 0.708330, 13, 17, 12, 1, 0.905233, 0.090974, 0.002031, 0.001761 },
-	{ -0.029505, -0.066230, 0.082311, 0.461314, -0.837032, 0.294224, 0.866725, 0.496043, 0.052243, 1.000000, 0.602900, 0.505990, 12, 1, 1, 1, 0.662393, 0.337607, 0.000000, 0.000000 },
-	{ -0.029411, -0.064030, 0.088030, 0.471765, -0.806422, 0.356541, 0.829408, 0.543089, 0.130906, 1.000000, 0.608640, 0.490680, 12, 1, 1, 1, 0.528307, 0.471693, 0.000000, 0.000000 },
-	{ -0.029503, -0.061374, 0.093462, 0.479196, -0.726017, 0.493225, 0.764435, 0.621354, 0.171928, 1.000000, 0.613330, 0.477110, 1, 12, 1, 1, 0.607150, 0.392850, 0.000000, 0.000000 },
-	{ -0.030066, -0.057506, 0.098323, 0.488222, -0.620171, 0.614025, 0.708515, 0.692460, 0.136039, 1.000000, 0.617220, 0.463160, 1, 12, 1, 1, 0.745294, 0.254706, 0.000000, 0.000000 },
-	{ -0.046869, -0.014801, 0.000569, -0.726252, -0.542417, -0.422306, 0.657886, -0.370262, -0.655814, 1.000000, 0.413070, 0.386080, 4, 8, 1, 1, 0.965969, 0.026094, 0.007937, 0.000000 },
-	{ -0.048311, -0.013022, 0.001018, -0.833726, -0.362910, -0.416169, 0.539452, -0.374451, -0.754174, 1.000000, 0.407460, 0.390120, 4, 8, 1, 1, 0.963495, 0.021272, 0.015233, 0.000000 },
-	{ -0.049001, -0.010414, 0.000822, -0.917341, -0.097746, -0.385915, 0.392632, -0.382276, -0.836484, 1.000000, 0.403700, 0.397460, 4, 1, 1, 1, 0.981470, 0.018530, 0.000000, 0.000000 },
-	{ -0.048703, -0.007124, 0.000384, -0.922844, 0.165789, -0.347669, 0.267477, -0.373658, -0.888164, 1.000000, 0.400880, 0.407540, 4, 1, 1, 1, 0.986708, 0.013292, 0.000000, 0.000000 },
-	{ 0.032318, -0.000688, 0.005418, 0.926520, 0.208242, 0.313361, 0.277682, 0.183515, -0.942982, 1.000000, 0.386720, 0.674920, 23, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.007526, -0.007950, 0.093797, 0.709032, 0.157802, 0.687293, 0.492732, 0.586373, -0.642949, 1.000000, 0.145110, 0.584380, 1, 21, 1, 1, 0.892437, 0.107563, 0.000000, 0.000000 },
-	{ -0.013447, -0.009613, 0.099009, 0.629984, 0.180461, 0.755350, 0.577543, 0.541377, -0.611028, 1.000000, 0.130630, 0.574500, 1, 21, 1, 1, 0.959998, 0.040002, 0.000000, 0.000000 },
-	{ -0.017718, -0.010889, 0.103119, 0.781144, 0.182971, 0.596939, 0.512607, 0.357879, -0.780485, 1.000000, 0.118390, 0.569600, 1, 21, 1, 1, 0.986660, 0.013340, 0.000000, 0.000000 },
-	{ -0.019800, -0.011031, 0.107948, 0.953708, 0.166169, 0.250656, 0.224267, 0.162326, -0.960914, 1.000000, 0.107440, 0.566080, 1, 21, 1, 1, 0.995306, 0.004694, 0.000000, 0.000000 },
-	{ -0.013447, -0.009613, 0.099009, 0.629984, 0.180461, 0.755350, 0.300113, 0.840497, -0.451107, 1.000000, 0.774150, 0.432210, 1, 21, 1, 1, 0.959998, 0.040002, 0.000000, 0.000000 },
-	{ -0.017718, -0.010889, 0.103119, 0.781144, 0.182971, 0.596939, 0.198314, 0.833870, -0.515105, 1.000000, 0.765010, 0.420690, 1, 21, 1, 1, 0.986660, 0.013340, 0.000000, 0.000000 },
-	{ -0.019800, -0.011031, 0.107948, 0.953708, 0.166169, 0.250656, -0.027045, 0.877495, -0.478822, 1.000000, 0.759270, 0.409340, 1, 21, 1, 1, 0.995306, 0.004694, 0.000000, 0.000000 },
-	{ -0.020776, -0.010143, 0.114333, 0.986154, 0.145305, 0.079910, -0.104965, 0.920015, -0.377565, 1.000000, 0.754570, 0.391710, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021049, -0.009060, 0.120123, 0.990600, 0.134090, 0.027043, -0.116487, 0.930564, -0.347105, 1.000000, 0.751450, 0.369190, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025162, -0.031081, 0.028184, 0.937154, -0.124391, -0.325989, 0.132666, 0.991156, 0.003181, 1.000000, 0.716250, 0.677350, 1, 8, 17, 1, 0.898988, 0.064467, 0.036545, 0.000000 },
-	{ -0.023976, -0.031002, 0.031706, 0.955412, -0.096503, -0.279061, 0.101623, 0.994815, 0.003904, 1.000000, 0.718170, 0.666480, 1, 8, 17, 1, 0.944012, 0.034395, 0.021593, 0.000000 },
-	{ -0.022924, -0.030773, 0.035544, 0.966336, -0.100273, -0.236941, 0.101601, 0.994803, -0.006630, 1.000000, 0.720780, 0.654840, 1, 8, 17, 1, 0.966865, 0.020322, 0.012814, 0.000000 },
-	{ -0.024422, -0.035571, 0.031951, 0.944008, -0.136371, -0.300421, 0.156264, 0.986775, 0.043095, 1.000000, 0.704750, 0.665500, 1, 17, 8, 1, 0.895362, 0.057837, 0.046800, 0.000000 },
-	{ -0.023382, -0.035164, 0.035310, 0.965541, -0.117602, -0.232163, 0.130943, 0.990463, 0.042860, 1.000000, 0.707490, 0.655350, 1, 12, 17, 1, 0.923947, 0.042198, 0.033855, 0.000000 },
-	{ -0.022564, -0.034620, 0.039219, 0.977394, -0.121650, -0.172924, 0.127168, 0.991656, 0.021155, 1.000000, 0.710750, 0.643530, 1, 12, 17, 1, 0.918380, 0.067803, 0.013817, 0.000000 },
-	{ -0.038230, -0.072509, 0.069075, -0.073572, -0.954584, 0.288714, -0.590037, -0.191731, -0.784281, 1.000000, 0.158800, 0.199090, 12, 1, 1, 1, 0.965073, 0.034927, 0.000000, 0.000000 },
-	{ -0.040939, -0.072297, 0.068030, -0.303527, -0.915564, 0.263844, -0.515033, -0.075318, -0.853855, 1.000000, 0.164170, 0.202210, 12, 1, 1, 1, 0.976666, 0.023334, 0.000000, 0.000000 },
-	{ -0.043469, -0.071490, 0.066704, -0.503013, -0.837200, 0.214649, -0.393580, 0.000778, -0.919290, 1.000000, 0.170160, 0.205920, 12, 1, 1, 1, 0.985274, 0.014726, 0.000000, 0.000000 },
-	{ -0.017551, -0.004424, 0.028993, 0.661277, -0.263578, -0.702310, 0.434459, 0.897799, 0.072131, 1.000000, 0.802440, 0.676830, 1, 22, 4, 21, 0.536666, 0.247217, 0.108602, 0.107515 },
-	{ -0.015521, -0.003581, 0.030448, 0.575891, -0.259567, -0.775226, 0.469537, 0.881277, 0.053728, 1.000000, 0.807780, 0.671170, 1, 22, 21, 4, 0.407200, 0.382217, 0.151680, 0.058903 },
-	{ -0.013228, -0.002561, 0.031643, 0.474239, -0.281711, -0.834108, 0.550259, 0.834417, 0.031039, 1.000000, 0.814660, 0.665640, 22, 1, 21, 4, 0.520522, 0.268368, 0.186213, 0.024897 },
-	{ -0.011012, -0.001700, 0.032398, 0.352342, -0.344805, -0.870037, 0.654917, 0.754937, -0.033966, 1.000000, 0.820320, 0.661610, 22, 21, 1, 23, 0.651072, 0.199758, 0.136022, 0.013148 },
-	{ -0.008470, -0.001321, 0.033069, 0.237897, -0.446797, -0.862425, 0.695055, 0.698530, -0.170159, 1.000000, 0.825590, 0.655980, 22, 21, 1, 23, 0.762140, 0.195419, 0.032343, 0.010099 },
-	{ -0.005628, -0.001736, 0.033959, 0.129509, -0.561299, -0.817418, 0.699754, 0.635805, -0.325724, 1.000000, 0.829480, 0.647990, 22, 21, 23, 1, 0.809558, 0.181437, 0.006629, 0.002376 },
-	{ -0.002766, -0.002878, 0.035160, 0.083562, -0.655731, -0.750356, 0.701503, 0.573508, -0.423064, 1.000000, 0.831650, 0.636090, 22, 21, 23, 1, 0.829598, 0.166434, 0.003967, 0.000000 },
-	{ -0.012577, -0.004839, 0.032864, 0.462178, -0.362586, -0.809273, 0.565684, 0.823348, -0.045829, 1.000000, 0.809670, 0.659290, 22, 1, 21, 4, 0.471690, 0.277744, 0.237360, 0.013206 },
-	{ -0.014973, -0.005855, 0.031737, 0.538803, -0.355214, -0.763881, 0.526967, 0.849565, -0.023362, 1.000000, 0.802710, 0.665020, 1, 22, 21, 4, 0.456678, 0.315139, 0.186438, 0.041745 },
-	{ -0.017070, -0.006628, 0.030415, 0.609360, -0.366611, -0.703049, 0.494854, 0.868643, -0.024052, 1.000000, 0.797610, 0.670940, 1, 22, 21, 4, 0.615991, 0.150290, 0.127018, 0.106701 },
-	{ -0.018843, -0.007429, 0.029123, 0.677199, -0.373098, -0.634192, 0.471460, 0.881755, -0.015308, 1.000000, 0.792800, 0.675980, 1, 4, 21, 22, 0.717734, 0.174141, 0.074318, 0.033806 },
-	{ -0.008010, -0.002718, 0.033922, 0.281080, -0.440331, -0.852704, 0.660578, 0.733307, -0.160926, 1.000000, 0.822770, 0.651480, 22, 21, 1, 23, 0.711822, 0.251501, 0.029249, 0.007428 },
-	{ -0.010294, -0.003513, 0.033451, 0.373961, -0.388927, -0.841956, 0.630868, 0.772114, -0.076460, 1.000000, 0.816960, 0.655590, 22, 21, 1, 23, 0.615926, 0.255043, 0.119606, 0.009425 },
-	{ -0.003241, -0.003875, 0.035848, 0.192339, -0.584994, -0.787901, 0.650904, 0.676907, -0.343688, 1.000000, 0.827930, 0.634640, 22, 21, 23, 1, 0.761617, 0.234952, 0.003431, 0.000000 },
-	{ -0.005626, -0.002852, 0.034668, 0.195655, -0.515350, -0.834346, 0.687135, 0.679062, -0.258302, 1.000000, 0.826540, 0.644330, 22, 21, 23, 1, 0.752079, 0.239487, 0.005499, 0.002935 },
-	{ -0.040594, -0.043306, -0.020291, 0.612028, -0.757802, 0.226184, 0.777220, 0.629209, 0.005021, 1.000000, 0.673560, 0.834510, 8, 9, 1, 1, 0.758408, 0.241592, 0.000000, 0.000000 },
-	{ -0.037897, -0.039873, -0.019580, 0.870826, -0.443821, 0.211390, 0.475795, 0.869071, -0.135405, 1.000000, 0.687070, 0.831620, 8, 9, 1, 1, 0.761201, 0.238799, 0.000000, 0.000000 },
-	{ -0.036775, -0.035208, -0.019436, 0.990371, -0.023630, 0.136408, 0.053358, 0.974352, -0.218612, 1.000000, 0.701790, 0.828360, 8, 9, 1, 1, 0.781320, 0.218680, 0.000000, 0.000000 },
-	{ -0.037621, -0.031273, -0.019993, 0.915449, 0.400586, 0.038512, -0.381738, 0.894679, -0.232004, 1.000000, 0.713990, 0.827130, 8, 9, 1, 1, 0.855641, 0.144359, 0.000000, 0.000000 },
-	{ -0.039523, -0.028810, -0.020915, 0.712791, 0.700578, -0.033455, -0.685583, 0.685883, -0.244012, 1.000000, 0.724210, 0.827520, 8, 9, 1, 1, 0.801650, 0.198350, 0.000000, 0.000000 },
-	{ -0.041372, -0.027541, -0.021792, 0.493494, 0.866777, -0.071845, -0.848877, 0.462017, -0.256802, 1.000000, 0.731110, 0.828340, 8, 9, 1, 1, 0.783938, 0.216062, 0.000000, 0.000000 },
-	{ -0.043496, -0.044949, -0.020994, 0.311051, -0.930210, 0.194827, 0.936139, 0.335250, 0.106069, 1.000000, 0.663570, 0.835730, 8, 9, 1, 1, 0.695662, 0.304338, 0.000000, 0.000000 },
-	{ -0.046015, -0.045451, -0.021550, 0.065590, -0.983712, 0.167357, 0.985082, 0.090574, 0.146321, 1.000000, 0.656290, 0.836340, 8, 9, 1, 1, 0.664644, 0.335356, 0.000000, 0.000000 },
-	{ -0.053937, -0.043089, -0.023986, -0.720186, -0.693771, -0.003777, 0.031573, -0.027335, -0.999128, 1.000000, 0.462110, 0.270410, 8, 9, 1, 1, 0.743477, 0.256523, 0.000000, 0.000000 },
-	{ -0.052654, -0.044106, -0.023208, -0.568705, -0.821396, 0.043404, 0.008735, -0.058796, -0.998232, 1.000000, 0.460400, 0.266210, 8, 9, 1, 1, 0.805782, 0.194218, 0.000000, 0.000000 },
-	{ -0.051373, -0.044768, -0.022721, -0.402191, -0.911177, 0.089432, -0.002313, -0.096670, -0.995314, 1.000000, 0.459970, 0.262510, 8, 9, 1, 1, 0.799761, 0.200239, 0.000000, 0.000000 },
-	{ -0.049949, -0.045200, -0.022349, -0.236111, -0.963188, 0.128535, -0.002944, -0.131565, -0.991303, 1.000000, 0.459850, 0.258720, 8, 9, 1, 1, 0.749255, 0.250745, 0.000000, 0.000000 },
-	{ -0.048182, -0.045441, -0.021974, -0.093726, -0.983992, 0.151578, 0.007536, -0.152945, -0.988206, 1.000000, 0.459870, 0.254010, 8, 9, 1, 1, 0.708006, 0.291994, 0.000000, 0.000000 },
-	{ -0.046015, -0.045451, -0.021550, 0.065590, -0.983712, 0.167357, 0.018005, -0.166525, -0.985873, 1.000000, 0.459870, 0.247940, 8, 9, 1, 1, 0.664644, 0.335356, 0.000000, 0.000000 },
-	{ -0.024109, -0.025684, 0.122908, -0.224775, 0.171263, 0.959242, 0.178514, 0.975010, -0.132247, 1.000000, 0.242878, 0.982246, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.025384, -0.030447, 0.123459, -0.224775, 0.171263, 0.959242, 0.178514, 0.975010, -0.132247, 1.000000, 0.205078, 0.979115, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.042940, -0.023191, 0.118051, -0.224775, 0.171263, 0.959242, 0.178514, 0.975010, -0.132247, 1.000000, 0.241916, 0.832579, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.039320, 0.003260, 0.115229, -0.247863, 0.136249, 0.959167, 0.160358, 0.982174, -0.098078, 1.000000, 0.444490, 0.827186, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.037088, 0.003202, 0.115814, -0.247863, 0.136249, 0.959167, 0.160358, 0.982174, -0.098078, 1.000000, 0.446490, 0.844486, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.041460, 0.003118, 0.114697, -0.247388, 0.136199, 0.959296, 0.160390, 0.982168, -0.098085, 1.000000, 0.441098, 0.810863, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.043457, 0.002809, 0.114258, -0.232514, 0.135848, 0.963059, 0.160721, 0.981951, -0.099710, 1.000000, 0.436655, 0.795911, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.045272, 0.002393, 0.113861, -0.241434, 0.135345, 0.960933, 0.160527, 0.982154, -0.098001, 1.000000, 0.431602, 0.782474, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.046897, 0.001973, 0.113557, -0.216250, 0.138568, 0.966455, 0.161394, 0.981333, -0.104588, 1.000000, 0.426758, 0.770547, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.063241, -0.021699, 0.113200, -0.219042, 0.152737, 0.963687, 0.154190, 0.980680, -0.120384, 1.000000, 0.231702, 0.673832, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062847, -0.018291, 0.112749, -0.226478, 0.124870, 0.965979, 0.154073, 0.983855, -0.091057, 1.000000, 0.257931, 0.672734, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.063438, -0.025347, 0.113861, -0.215445, 0.185468, 0.958742, 0.154771, 0.975874, -0.154002, 1.000000, 0.203659, 0.676784, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.063422, -0.029234, 0.114610, -0.215345, 0.183852, 0.959075, 0.155576, 0.976033, -0.152171, 1.000000, 0.173844, 0.681696, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.063263, -0.033347, 0.115419, -0.214487, 0.180473, 0.959909, 0.156641, 0.976416, -0.148576, 1.000000, 0.142278, 0.688025, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062208, -0.015211, 0.112501, -0.234927, 0.104835, 0.966343, 0.154040, 0.985619, -0.069478, 1.000000, 0.281830, 0.673950, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.042940, -0.023191, 0.118051, -0.251651, 0.117231, 0.960692, 0.157813, 0.984322, -0.078775, 1.000000, 0.241916, 0.832579, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061387, -0.012436, 0.112399, -0.240427, 0.095132, 0.965994, 0.154051, 0.986312, -0.058791, 1.000000, 0.303588, 0.676938, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.060446, -0.009954, 0.112389, -0.221904, 0.120401, 0.967606, 0.155179, 0.984060, -0.086861, 1.000000, 0.323261, 0.681221, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059379, -0.007800, 0.112366, -0.195919, 0.148717, 0.969278, 0.156780, 0.980469, -0.118745, 1.000000, 0.340597, 0.686842, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.034626, 0.002880, 0.116424, -0.199498, 0.124255, 0.971989, 0.159333, 0.982841, -0.092940, 1.000000, 0.446709, 0.863797, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.031875, 0.002153, 0.117082, -0.199498, 0.124255, 0.971988, 0.159333, 0.982841, -0.092940, 1.000000, 0.444135, 0.885718, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.042940, -0.023191, 0.118051, -0.161600, 0.122678, 0.979202, 0.159299, 0.982473, -0.096798, 1.000000, 0.241916, 0.832579, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.058251, -0.005961, 0.112312, -0.193231, 0.151166, 0.969438, 0.157793, 0.979987, -0.121359, 1.000000, 0.355582, 0.693268, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.057123, -0.004422, 0.112297, -0.184981, 0.157617, 0.970020, 0.159143, 0.978831, -0.128701, 1.000000, 0.368292, 0.700052, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.055985, -0.003182, 0.112312, -0.194518, 0.151159, 0.969182, 0.159692, 0.979753, -0.120757, 1.000000, 0.378749, 0.707249, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.054882, -0.002158, 0.112374, -0.228499, 0.130638, 0.964739, 0.158794, 0.982686, -0.095458, 1.000000, 0.387542, 0.714442, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.053840, -0.001280, 0.112502, -0.253218, 0.117223, 0.960281, 0.157819, 0.984340, -0.078544, 1.000000, 0.395210, 0.721375, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.052832, -0.000520, 0.112675, -0.264821, 0.111554, 0.957823, 0.157223, 0.984990, -0.071249, 1.000000, 0.401986, 0.728212, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.051827, 0.000138, 0.112876, -0.251651, 0.117231, 0.960692, 0.157813, 0.984322, -0.078775, 1.000000, 0.408010, 0.735168, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050782, 0.000703, 0.113081, -0.251651, 0.117231, 0.960692, 0.157813, 0.984322, -0.078775, 1.000000, 0.413372, 0.742524, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.023845, -0.003355, 0.118717, -0.161600, 0.122678, 0.979202, 0.159299, 0.982473, -0.096798, 1.000000, 0.410800, 0.952161, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021999, -0.005979, 0.119350, -0.161600, 0.122678, 0.979202, 0.159299, 0.982473, -0.096798, 1.000000, 0.393165, 0.969270, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026273, -0.001069, 0.118187, -0.129402, 0.091378, 0.987373, 0.151128, 0.985930, -0.071438, 1.000000, 0.425502, 0.931466, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.029020, 0.000816, 0.117657, -0.128425, 0.090669, 0.987566, 0.152171, 0.985821, -0.070720, 1.000000, 0.436942, 0.908794, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.031875, 0.002153, 0.117082, -0.149713, 0.102942, 0.983356, 0.155621, 0.984622, -0.079382, 1.000000, 0.444135, 0.885718, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.048349, 0.001578, 0.113368, -0.167394, 0.147713, 0.974762, 0.162933, 0.979262, -0.120415, 1.000000, 0.422357, 0.759990, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.046897, 0.001973, 0.113557, -0.167394, 0.147713, 0.974762, 0.162933, 0.979262, -0.120415, 1.000000, 0.426758, 0.770547, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.049638, 0.001174, 0.113235, -0.148292, 0.152342, 0.977140, 0.163073, 0.978305, -0.127775, 1.000000, 0.418067, 0.750696, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.050782, 0.000703, 0.113081, -0.189004, 0.140120, 0.971928, 0.160809, 0.980822, -0.110131, 1.000000, 0.413372, 0.742524, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062792, -0.037723, 0.116083, -0.189708, 0.127368, 0.973544, 0.156499, 0.982796, -0.098082, 1.000000, 0.109242, 0.697052, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.063263, -0.033347, 0.115419, -0.189708, 0.127368, 0.973544, 0.156499, 0.982796, -0.098082, 1.000000, 0.142278, 0.688025, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.061684, -0.042065, 0.116658, -0.162260, 0.088603, 0.982762, 0.155793, 0.985769, -0.063151, 1.000000, 0.077525, 0.710903, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.062792, -0.037723, 0.116083, -0.162260, 0.088603, 0.982762, 0.155793, 0.985769, -0.063151, 1.000000, 0.109242, 0.697052, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.059988, -0.045943, 0.117334, -0.170260, 0.096687, 0.980644, 0.156326, 0.985222, -0.069997, 1.000000, 0.049978, 0.728757, 1, 12, 1, 1, 0.998438, 0.001562, 0.000000, 0.000000 },
-	{ -0.057463, -0.049014, 0.118080, -0.171210, 0.097414, 0.980407, 0.156368, 0.985174, -0.070580, 1.000000, 0.029579, 0.752030, 1, 12, 1, 1, 0.998295, 0.001705, 0.000000, 0.000000 },
-	{ -0.054138, -0.051247, 0.119066, -0.208288, 0.118268, 0.970891, 0.157965, 0.983698, -0.085940, 1.000000, 0.016092, 0.780626, 1, 12, 1, 1, 0.998970, 0.001030, 0.000000, 0.000000 },
-	{ -0.050539, -0.052480, 0.120064, -0.225110, 0.124809, 0.966307, 0.158758, 0.983206, -0.090008, 1.000000, 0.010384, 0.810216, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.047175, -0.052684, 0.120814, -0.209088, 0.120954, 0.970388, 0.158559, 0.983383, -0.088409, 1.000000, 0.012493, 0.836621, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.044247, -0.052436, 0.121452, -0.221146, 0.122416, 0.967527, 0.158520, 0.983409, -0.088193, 1.000000, 0.017490, 0.859123, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.035440, -0.050327, 0.123939, -0.277587, 0.129837, 0.951887, 0.157072, 0.983626, -0.088362, 1.000000, 0.041365, 0.926785, 1, 8, 1, 1, 0.996840, 0.003160, 0.000000, 0.000000 },
-	{ -0.036926, -0.051201, 0.123625, -0.277587, 0.129837, 0.951887, 0.157072, 0.983626, -0.088362, 1.000000, 0.033232, 0.916059, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.033880, -0.048991, 0.124267, -0.302726, 0.121468, 0.945306, 0.153789, 0.985073, -0.077329, 1.000000, 0.053039, 0.937628, 1, 8, 1, 1, 0.997266, 0.002734, 0.000000, 0.000000 },
-	{ -0.042940, -0.023191, 0.118051, -0.302726, 0.121468, 0.945306, 0.153789, 0.985073, -0.077329, 1.000000, 0.241916, 0.832579, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.032271, -0.047066, 0.124469, -0.277297, 0.131918, 0.951685, 0.158120, 0.983289, -0.090226, 1.000000, 0.069465, 0.947966, 1, 8, 1, 1, 0.998245, 0.001755, 0.000000, 0.000000 },
-	{ -0.030700, -0.044564, 0.124455, -0.235069, 0.152997, 0.959862, 0.167188, 0.979180, -0.115132, 1.000000, 0.090557, 0.956911, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.029207, -0.041676, 0.124384, -0.241986, 0.148718, 0.958815, 0.166646, 0.979870, -0.109925, 1.000000, 0.114482, 0.964763, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.027834, -0.038406, 0.124269, -0.253184, 0.139879, 0.957252, 0.164368, 0.981325, -0.099923, 1.000000, 0.141111, 0.971247, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.026594, -0.034723, 0.123954, -0.233134, 0.160539, 0.959101, 0.173097, 0.977379, -0.121523, 1.000000, 0.170862, 0.975821, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.038423, -0.051716, 0.123261, -0.276395, 0.130148, 0.952191, 0.157227, 0.983562, -0.088797, 1.000000, 0.027867, 0.904802, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.041909, -0.052189, 0.122067, -0.264575, 0.123067, 0.956481, 0.157293, 0.984049, -0.083105, 1.000000, 0.021604, 0.877244, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.042940, -0.023191, 0.118051, -0.223393, 0.220023, 0.949571, 0.195640, 0.964487, -0.177453, 1.000000, 0.241916, 0.832579, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021747, -0.016668, 0.121525, -0.223393, 0.220023, 0.949571, 0.195640, 0.964487, -0.177453, 1.000000, 0.313756, 0.986818, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.022858, -0.020981, 0.122263, -0.223393, 0.220023, 0.949571, 0.195640, 0.964487, -0.177453, 1.000000, 0.279999, 0.984986, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021049, -0.012687, 0.120805, -0.221009, 0.210915, 0.952192, 0.192545, 0.966555, -0.169406, 1.000000, 0.344307, 0.986080, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021049, -0.009060, 0.120123, -0.205968, 0.177942, 0.962244, 0.177335, 0.973834, -0.142126, 1.000000, 0.371317, 0.980865, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.021999, -0.005979, 0.119350, -0.205968, 0.177942, 0.962244, 0.177335, 0.973834, -0.142126, 1.000000, 0.393165, 0.969270, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.038423, -0.051716, 0.123261, -0.335799, 0.117529, 0.934573, 0.152432, 0.985888, -0.069212, 1.000000, 0.027867, 0.904802, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.040035, -0.051988, 0.122716, -0.335799, 0.117529, 0.934573, 0.152432, 0.985888, -0.069212, 1.000000, 0.024551, 0.892106, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 },
-	{ -0.041909, -0.052189, 0.122067, -0.336279, 0.117445, 0.934411, 0.153247, 0.985793, -0.068752, 1.000000, 0.021604, 0.877244, 1, 1, 1, 1, 1.000000, 0.000000, 0.000000, 0.000000 } };
-#pragma endregion
-#pragma region mesh indices
-const uint32_t unAvatarIndexCount_4070 = 22488;
-const uint16_t aunAvatarIndices_4070[] = {
-	2, 1, 0, 3, 2, 0, 4, 0, 1, 5, 4, 1, 6, 0, 4, 7,
-	6, 4, 8, 3, 0, 6, 8, 0, 5, 1, 9, 9, 1, 2, 10, 5,
-	9, 11, 9, 2, 7, 12, 6, 12, 13, 6, 14, 12, 7, 15, 14, 7,
-	7, 4, 16, 15, 7, 16, 16, 4, 5, 17, 16, 5, 17, 5, 10, 18,
-	17, 10, 19, 14, 15, 20, 19, 15, 21, 19, 20, 22, 21, 20, 15, 16,
-	22, 20, 15, 22, 22, 16, 17, 21, 22, 23, 23, 22, 17, 23, 17, 18,
-	24, 21, 23, 24, 23, 25, 25, 23, 18, 26, 24, 25, 27, 13, 12, 28,
-	27, 12, 28, 29, 27, 29, 30, 27, 31, 29, 28, 32, 31, 28, 33, 31,
-	32, 34, 33, 32, 34, 32, 19, 34, 19, 21, 35, 33, 34, 36, 35, 34,
-	36, 34, 21, 36, 21, 24, 35, 36, 37, 37, 36, 24, 37, 24, 26, 38,
-	35, 37, 38, 37, 39, 39, 37, 26, 40, 38, 39, 41, 30, 29, 42, 41,
-	29, 42, 29, 31, 43, 41, 42, 44, 43, 42, 44, 42, 45, 45, 42, 31,
-	45, 31, 33, 46, 44, 45, 46, 45, 47, 47, 45, 33, 47, 33, 35, 48,
-	46, 47, 48, 47, 49, 49, 47, 35, 49, 35, 38, 50, 48, 49, 50, 49,
-	51, 51, 49, 38, 51, 38, 40, 52, 50, 51, 52, 51, 53, 53, 51, 40,
-	54, 52, 53, 55, 52, 54, 52, 55, 50, 56, 55, 54, 57, 55, 56, 58,
-	57, 56, 59, 57, 58, 60, 59, 58, 61, 59, 60, 61, 62, 59, 62, 63,
-	59, 64, 62, 61, 65, 64, 61, 65, 61, 66, 66, 61, 60, 67, 65, 66,
-	62, 68, 63, 68, 62, 64, 68, 69, 63, 69, 68, 70, 68, 71, 70, 72,
-	71, 68, 73, 72, 68, 73, 68, 64, 69, 70, 74, 69, 74, 63, 70, 75,
-	74, 74, 75, 76, 75, 77, 76, 76, 77, 48, 77, 78, 48, 78, 79, 48,
-	79, 46, 48, 79, 80, 46, 80, 44, 46, 80, 81, 44, 81, 43, 44, 82,
-	76, 48, 50, 82, 48, 55, 82, 50, 55, 57, 82, 57, 83, 82, 82, 83,
-	76, 83, 57, 59, 63, 83, 59, 74, 83, 63, 83, 74, 76, 84, 81, 80,
-	85, 84, 80, 86, 84, 85, 87, 86, 85, 87, 85, 88, 89, 87, 88, 89,
-	88, 90, 91, 89, 90, 91, 90, 92, 93, 91, 92, 93, 92, 94, 95, 93,
-	94, 95, 94, 96, 97, 95, 96, 97, 96, 98, 99, 97, 98, 99, 98, 100,
-	98, 101, 100, 90, 88, 78, 88, 79, 78, 88, 85, 79, 85, 80, 79, 94,
-	92, 75, 92, 77, 75, 90, 78, 77, 92, 90, 77, 98, 96, 71, 98, 71,
-	101, 96, 70, 71, 94, 75, 70, 96, 94, 70, 71, 72, 101, 100, 101, 102,
-	100, 102, 103, 104, 103, 102, 104, 105, 103, 105, 106, 103, 105, 107, 106, 107,
-	108, 106, 107, 109, 108, 109, 110, 108, 109, 111, 110, 111, 112, 110, 111, 113,
-	112, 113, 114, 112, 113, 115, 114, 115, 116, 114, 115, 117, 116, 117, 118, 116,
-	117, 119, 118, 119, 120, 118, 121, 119, 117, 122, 121, 117, 122, 117, 115, 123,
-	121, 122, 124, 123, 122, 124, 122, 125, 125, 122, 115, 125, 115, 113, 126, 124,
-	125, 126, 125, 127, 127, 125, 113, 128, 126, 127, 128, 127, 129, 130, 128, 129,
-	130, 129, 131, 132, 130, 131, 132, 131, 133, 134, 132, 133, 134, 133, 135, 136,
-	134, 135, 136, 135, 137, 138, 136, 137, 138, 137, 139, 140, 138, 139, 140, 139,
-	141, 142, 140, 141, 142, 141, 143, 144, 142, 143, 144, 143, 145, 146, 144, 145,
-	146, 145, 147, 148, 146, 147, 148, 147, 149, 150, 148, 149, 150, 149, 151, 152,
-	150, 151, 152, 151, 153, 154, 152, 153, 154, 153, 155, 156, 154, 155, 156, 155,
-	157, 158, 156, 157, 158, 157, 159, 160, 158, 159, 160, 159, 161, 162, 160, 161,
-	162, 161, 163, 164, 162, 163, 164, 163, 165, 166, 164, 165, 166, 165, 167, 168,
-	166, 167, 168, 167, 169, 170, 168, 169, 170, 169, 171, 172, 170, 171, 172, 171,
-	173, 174, 172, 173, 174, 173, 175, 176, 174, 175, 176, 175, 177, 178, 176, 177,
-	178, 177, 179, 180, 178, 179, 180, 179, 181, 182, 180, 181, 182, 181, 183, 184,
-	182, 183, 184, 183, 185, 186, 184, 185, 173, 171, 187, 171, 188, 187, 187, 188,
-	189, 187, 189, 190, 191, 187, 190, 191, 190, 192, 193, 191, 192, 193, 192, 194,
-	195, 193, 194, 188, 196, 189, 188, 197, 196, 197, 198, 196, 197, 199, 198, 199,
-	200, 198, 199, 201, 200, 201, 202, 200, 201, 203, 202, 203, 204, 202, 203, 205,
-	204, 205, 206, 204, 205, 207, 206, 207, 208, 206, 195, 194, 209, 210, 195, 209,
-	210, 209, 211, 212, 210, 211, 212, 211, 213, 214, 212, 213, 207, 215, 208, 215,
-	216, 208, 215, 217, 216, 217, 218, 216, 217, 219, 218, 219, 220, 218, 219, 221,
-	220, 221, 222, 220, 221, 223, 222, 223, 224, 222, 223, 225, 224, 225, 226, 224,
-	225, 227, 226, 227, 228, 226, 227, 229, 228, 229, 230, 228, 229, 231, 230, 231,
-	232, 230, 231, 233, 232, 233, 102, 232, 233, 104, 102, 137, 104, 233, 137, 135,
-	104, 135, 105, 104, 135, 133, 105, 133, 107, 105, 133, 131, 107, 131, 109, 107,
-	131, 129, 109, 129, 111, 109, 129, 127, 111, 127, 113, 111, 139, 137, 233, 139,
-	233, 231, 141, 139, 231, 141, 231, 229, 143, 141, 229, 143, 229, 227, 145, 143,
-	227, 145, 227, 225, 147, 145, 225, 147, 225, 223, 149, 147, 223, 149, 223, 221,
-	151, 149, 221, 151, 221, 219, 153, 151, 219, 153, 219, 217, 155, 153, 217, 155,
-	217, 215, 157, 155, 215, 157, 215, 207, 159, 157, 207, 159, 207, 205, 161, 159,
-	205, 161, 205, 203, 163, 161, 203, 163, 203, 201, 165, 163, 201, 165, 201, 199,
-	167, 165, 199, 167, 199, 197, 169, 167, 197, 169, 197, 188, 171, 169, 188, 236,
-	235, 234, 237, 236, 234, 237, 234, 238, 239, 237, 238, 240, 235, 236, 241, 240,
-	236, 242, 240, 241, 243, 242, 241, 243, 244, 242, 244, 245, 242, 245, 244, 246,
-	247, 245, 246, 248, 247, 246, 249, 248, 246, 250, 237, 239, 251, 250, 239, 252,
-	236, 237, 250, 252, 237, 243, 241, 253, 241, 254, 253, 236, 252, 254, 241, 236,
-	254, 255, 244, 243, 253, 255, 243, 244, 255, 256, 246, 244, 256, 246, 256, 257,
-	249, 246, 257, 258, 250, 251, 259, 258, 251, 260, 258, 259, 260, 261, 258, 261,
-	262, 258, 262, 252, 250, 258, 262, 250, 262, 261, 263, 264, 262, 263, 252, 262,
-	264, 254, 252, 264, 265, 260, 259, 266, 264, 263, 254, 264, 266, 253, 254, 266,
-	267, 266, 263, 267, 268, 266, 268, 269, 266, 270, 269, 268, 255, 269, 270, 256,
-	255, 270, 271, 270, 268, 272, 270, 271, 273, 272, 271, 256, 270, 272, 257, 256,
-	272, 266, 269, 253, 269, 255, 253, 274, 272, 273, 275, 274, 273, 276, 274, 275,
-	277, 276, 275, 278, 276, 277, 279, 278, 277, 280, 278, 279, 281, 280, 279, 282,
-	280, 281, 283, 282, 281, 284, 282, 283, 285, 284, 283, 282, 284, 286, 284, 287,
-	286, 287, 288, 286, 288, 289, 286, 288, 290, 289, 290, 291, 289, 289, 291, 292,
-	289, 292, 286, 291, 293, 292, 292, 294, 286, 294, 280, 282, 286, 294, 282, 278,
-	280, 294, 295, 278, 294, 295, 294, 292, 296, 295, 292, 292, 293, 296, 293, 297,
-	296, 276, 278, 295, 298, 276, 295, 298, 295, 296, 299, 298, 296, 296, 297, 299,
-	297, 300, 299, 274, 276, 298, 301, 274, 298, 301, 298, 299, 302, 301, 299, 299,
-	300, 302, 300, 303, 302, 272, 274, 301, 257, 272, 301, 257, 301, 302, 249, 257,
-	302, 302, 303, 249, 303, 248, 249, 304, 248, 303, 304, 305, 248, 304, 306, 305,
-	306, 307, 305, 305, 307, 308, 307, 309, 308, 308, 309, 310, 311, 308, 310, 311,
-	310, 312, 310, 313, 312, 312, 313, 314, 313, 315, 314, 314, 315, 316, 317, 314,
-	316, 317, 316, 318, 319, 317, 318, 319, 318, 320, 318, 321, 320, 320, 321, 322,
-	321, 323, 322, 322, 323, 324, 323, 325, 324, 324, 325, 326, 325, 327, 326, 326,
-	327, 328, 329, 326, 328, 330, 329, 328, 331, 330, 328, 330, 332, 329, 332, 333,
-	329, 329, 333, 326, 332, 334, 333, 334, 335, 333, 333, 335, 336, 333, 336, 326,
-	326, 336, 324, 335, 337, 336, 335, 334, 338, 339, 335, 338, 340, 337, 335, 339,
-	340, 335, 341, 340, 339, 342, 341, 339, 342, 339, 338, 343, 341, 342, 344, 343,
-	342, 345, 344, 342, 346, 345, 342, 346, 342, 338, 336, 337, 347, 337, 348, 347,
-	348, 337, 340, 349, 348, 340, 349, 340, 341, 350, 349, 341, 350, 341, 343, 351,
-	350, 343, 347, 348, 352, 348, 353, 352, 353, 348, 349, 354, 353, 349, 354, 349,
-	350, 355, 354, 350, 355, 350, 351, 356, 355, 351, 352, 353, 357, 353, 358, 357,
-	358, 353, 354, 359, 358, 354, 359, 354, 355, 360, 359, 355, 360, 355, 356, 361,
-	360, 356, 357, 358, 238, 358, 239, 238, 239, 358, 359, 251, 239, 359, 251, 359,
-	360, 259, 251, 360, 259, 360, 361, 265, 259, 361, 352, 357, 320, 322, 352, 320,
-	357, 238, 319, 320, 357, 319, 319, 238, 317, 238, 234, 317, 234, 235, 317, 235,
-	314, 317, 314, 235, 240, 312, 314, 240, 312, 240, 242, 311, 312, 242, 242, 245,
-	311, 245, 308, 311, 308, 245, 247, 305, 308, 247, 305, 247, 248, 347, 352, 322,
-	336, 347, 324, 324, 347, 322, 364, 363, 362, 365, 364, 362, 365, 362, 366, 367,
-	365, 366, 363, 364, 368, 369, 363, 368, 370, 369, 368, 371, 370, 368, 371, 372,
-	370, 372, 373, 370, 374, 373, 372, 375, 374, 372, 376, 374, 375, 377, 376, 375,
-	378, 365, 367, 379, 378, 367, 380, 378, 379, 381, 380, 379, 382, 380, 381, 382,
-	383, 380, 384, 383, 382, 385, 384, 382, 385, 382, 381, 386, 383, 384, 387, 386,
-	384, 383, 388, 380, 380, 388, 378, 389, 388, 383, 386, 389, 383, 390, 389, 386,
-	391, 390, 386, 391, 386, 387, 391, 392, 390, 393, 392, 391, 394, 392, 393, 395,
-	394, 393, 395, 396, 394, 396, 397, 394, 394, 397, 392, 397, 398, 392, 392, 398,
-	390, 399, 393, 391, 399, 391, 387, 400, 388, 389, 388, 400, 378, 401, 400, 389,
-	401, 389, 390, 402, 401, 390, 390, 398, 402, 398, 403, 402, 403, 398, 397, 404,
-	403, 397, 404, 397, 396, 405, 404, 396, 378, 400, 365, 400, 364, 365, 364, 400,
-	401, 368, 364, 401, 368, 401, 402, 371, 368, 402, 402, 403, 371, 403, 372, 371,
-	372, 403, 404, 375, 372, 404, 375, 404, 405, 377, 375, 405, 377, 405, 406, 405,
-	407, 406, 406, 407, 408, 407, 409, 408, 408, 409, 410, 409, 411, 410, 410, 411,
-	412, 411, 413, 412, 412, 413, 414, 414, 413, 415, 413, 416, 415, 415, 416, 417,
-	418, 415, 417, 418, 417, 419, 417, 420, 419, 421, 418, 419, 422, 421, 419, 423,
-	415, 418, 421, 423, 418, 414, 415, 423, 422, 419, 424, 425, 422, 424, 419, 420,
-	426, 424, 419, 426, 426, 427, 424, 427, 428, 424, 425, 424, 428, 428, 427, 429,
-	427, 430, 429, 429, 430, 431, 432, 429, 431, 433, 429, 432, 434, 433, 432, 435,
-	428, 429, 433, 435, 429, 435, 425, 428, 432, 431, 436, 434, 432, 436, 431, 437,
-	436, 438, 434, 436, 439, 438, 436, 440, 439, 436, 436, 437, 440, 437, 441, 440,
-	442, 439, 440, 443, 442, 440, 440, 441, 443, 442, 443, 444, 445, 442, 444, 444,
-	443, 446, 443, 447, 446, 441, 447, 443, 446, 447, 448, 447, 449, 448, 449, 447,
-	441, 450, 449, 441, 450, 441, 437, 451, 450, 437, 451, 437, 431, 452, 451, 431,
-	431, 430, 452, 430, 453, 452, 453, 430, 427, 454, 453, 427, 454, 427, 426, 455,
-	454, 426, 426, 420, 455, 420, 456, 455, 456, 420, 417, 457, 456, 417, 417, 416,
-	457, 416, 458, 457, 458, 416, 413, 411, 458, 413, 452, 453, 459, 459, 460, 452,
-	453, 461, 459, 461, 453, 454, 462, 461, 454, 462, 454, 455, 463, 462, 455, 455,
-	456, 463, 456, 464, 463, 464, 456, 457, 465, 464, 457, 457, 458, 465, 458, 466,
-	465, 466, 458, 411, 409, 466, 411, 467, 460, 459, 467, 468, 460, 468, 469, 460,
-	460, 469, 451, 469, 450, 451, 469, 470, 450, 470, 449, 450, 449, 470, 471, 448,
-	449, 471, 471, 470, 472, 470, 473, 472, 473, 470, 469, 468, 473, 469, 463, 464,
-	474, 474, 475, 463, 475, 462, 463, 475, 476, 462, 476, 461, 462, 461, 476, 477,
-	459, 461, 477, 477, 467, 459, 472, 473, 366, 473, 367, 366, 367, 473, 468, 379,
-	367, 468, 379, 468, 467, 381, 379, 467, 381, 467, 477, 385, 381, 477, 477, 476,
-	385, 476, 384, 385, 384, 476, 475, 387, 384, 475, 387, 475, 474, 399, 387, 474,
-	474, 478, 399, 464, 478, 474, 478, 464, 465, 479, 478, 465, 465, 466, 479, 466,
-	480, 479, 480, 466, 409, 407, 480, 409, 478, 393, 399, 393, 478, 479, 395, 393,
-	479, 479, 480, 395, 480, 396, 395, 396, 480, 407, 405, 396, 407, 483, 482, 481,
-	484, 483, 481, 485, 483, 484, 486, 485, 484, 484, 481, 487, 488, 484, 487, 489,
-	485, 486, 490, 489, 486, 491, 489, 490, 492, 491, 490, 493, 491, 492, 494, 493,
-	492, 495, 493, 494, 496, 495, 494, 497, 494, 492, 498, 497, 492, 499, 495, 496,
-	500, 499, 496, 501, 499, 500, 502, 501, 500, 503, 501, 502, 504, 503, 502, 505,
-	503, 504, 506, 505, 504, 507, 504, 502, 508, 507, 502, 509, 505, 506, 510, 509,
-	506, 511, 509, 510, 512, 511, 510, 513, 511, 512, 514, 513, 512, 515, 499, 501,
-	516, 515, 501, 516, 501, 503, 517, 516, 503, 517, 503, 505, 518, 517, 505, 518,
-	505, 509, 519, 518, 509, 519, 509, 511, 520, 519, 511, 520, 511, 513, 521, 520,
-	513, 522, 515, 516, 522, 523, 515, 523, 522, 524, 522, 525, 524, 522, 526, 525,
-	526, 522, 516, 526, 516, 517, 526, 527, 525, 526, 528, 527, 528, 526, 517, 528,
-	517, 518, 528, 529, 527, 528, 530, 529, 530, 528, 518, 530, 518, 519, 530, 531,
-	529, 530, 532, 531, 532, 530, 519, 532, 519, 520, 532, 533, 531, 532, 534, 533,
-	534, 532, 520, 534, 520, 521, 534, 535, 533, 534, 536, 535, 536, 534, 521, 536,
-	537, 535, 523, 524, 538, 539, 523, 538, 539, 538, 540, 541, 539, 540, 541, 540,
-	542, 543, 541, 542, 543, 542, 544, 545, 543, 544, 545, 544, 546, 547, 545, 546,
-	545, 547, 548, 547, 549, 548, 548, 549, 485, 549, 483, 485, 549, 550, 483, 550,
-	482, 483, 548, 485, 489, 551, 548, 489, 545, 548, 551, 543, 545, 551, 551, 489,
-	491, 552, 551, 491, 543, 551, 552, 552, 491, 493, 553, 552, 493, 553, 493, 495,
-	554, 553, 495, 554, 495, 499, 515, 554, 499, 555, 550, 549, 547, 555, 549, 541,
-	552, 553, 541, 543, 552, 539, 541, 553, 539, 553, 554, 523, 539, 554, 523, 554,
-	515, 555, 547, 546, 556, 555, 546, 556, 546, 557, 546, 544, 557, 544, 558, 557,
-	559, 557, 558, 559, 560, 557, 560, 561, 557, 561, 556, 557, 562, 559, 558, 562,
-	558, 563, 564, 562, 563, 564, 563, 565, 566, 564, 565, 566, 565, 567, 568, 566,
-	567, 568, 567, 569, 570, 568, 569, 570, 569, 571, 572, 570, 571, 572, 571, 573,
-	574, 572, 573, 574, 573, 575, 576, 574, 575, 576, 575, 577, 578, 576, 577, 578,
-	577, 579, 580, 578, 579, 580, 579, 581, 582, 580, 581, 583, 582, 581, 584, 583,
-	581, 585, 570, 572, 585, 586, 570, 587, 586, 585, 587, 588, 586, 589, 588, 587,
-	589, 590, 588, 590, 591, 588, 590, 592, 591, 592, 593, 591, 592, 594, 593, 594,
-	595, 593, 594, 596, 595, 596, 597, 595, 598, 589, 587, 598, 587, 599, 599, 587,
-	585, 600, 598, 599, 600, 599, 601, 602, 600, 601, 602, 601, 603, 604, 602, 603,
-	604, 603, 605, 606, 604, 605, 606, 605, 607, 608, 606, 607, 608, 607, 609, 610,
-	608, 609, 610, 609, 611, 612, 610, 611, 612, 611, 613, 614, 612, 613, 601, 599,
-	615, 599, 585, 615, 605, 603, 616, 603, 617, 616, 601, 615, 617, 603, 601, 617,
-	609, 607, 618, 607, 619, 618, 605, 616, 619, 607, 605, 619, 613, 611, 620, 611,
-	621, 620, 609, 618, 621, 611, 609, 621, 615, 585, 572, 615, 572, 574, 617, 615,
-	574, 617, 574, 576, 616, 617, 576, 616, 576, 578, 619, 616, 578, 619, 578, 580,
-	618, 619, 580, 618, 580, 582, 621, 618, 582, 621, 582, 583, 620, 621, 583, 620,
-	583, 622, 583, 623, 622, 622, 623, 624, 623, 625, 624, 624, 625, 626, 625, 627,
-	626, 626, 627, 628, 627, 629, 628, 628, 629, 630, 630, 629, 631, 632, 630, 631,
-	633, 630, 632, 634, 633, 632, 634, 632, 635, 636, 634, 635, 637, 628, 630, 638,
-	628, 637, 626, 628, 638, 639, 638, 637, 640, 638, 639, 641, 640, 639, 642, 641,
-	639, 643, 642, 639, 643, 639, 637, 644, 643, 637, 644, 637, 630, 633, 644, 630,
-	645, 632, 631, 646, 645, 631, 647, 645, 646, 648, 647, 646, 647, 648, 649, 648,
-	650, 649, 649, 650, 651, 650, 652, 651, 651, 652, 653, 654, 651, 653, 655, 651,
-	654, 656, 655, 654, 657, 649, 651, 655, 657, 651, 658, 647, 649, 657, 658, 649,
-	658, 659, 647, 659, 660, 647, 659, 661, 660, 661, 662, 660, 660, 662, 647, 662,
-	645, 647, 632, 645, 662, 635, 632, 662, 636, 635, 662, 661, 636, 662, 654, 653,
-	663, 653, 664, 663, 663, 664, 665, 666, 663, 665, 667, 663, 666, 668, 667, 666,
-	666, 665, 669, 665, 670, 669, 669, 670, 671, 670, 672, 671, 671, 672, 673, 674,
-	671, 673, 675, 671, 674, 669, 671, 675, 676, 675, 674, 677, 669, 675, 666, 669,
-	677, 668, 666, 677, 654, 663, 667, 656, 654, 667, 673, 672, 678, 672, 679, 678,
-	679, 672, 670, 680, 679, 670, 680, 670, 665, 681, 680, 665, 665, 664, 681, 664,
-	682, 681, 682, 664, 653, 683, 682, 653, 653, 652, 683, 652, 684, 683, 684, 652,
-	650, 685, 684, 650, 685, 650, 648, 686, 685, 648, 686, 648, 687, 648, 646, 687,
-	687, 646, 688, 646, 631, 688, 631, 629, 688, 629, 627, 688, 689, 682, 683, 682,
-	689, 690, 681, 682, 690, 690, 691, 681, 691, 680, 681, 691, 692, 680, 692, 679,
-	680, 679, 692, 693, 678, 679, 693, 687, 688, 694, 688, 627, 694, 695, 687, 694,
-	686, 687, 695, 696, 686, 695, 696, 697, 686, 697, 685, 686, 697, 698, 685, 698,
-	684, 685, 684, 698, 699, 683, 684, 699, 699, 689, 683, 693, 692, 700, 692, 701,
-	700, 701, 692, 691, 702, 701, 691, 702, 691, 690, 703, 702, 690, 690, 689, 703,
-	689, 704, 703, 704, 689, 699, 705, 704, 699, 699, 698, 705, 698, 706, 705, 706,
-	698, 697, 707, 706, 697, 707, 697, 696, 708, 707, 696, 708, 696, 709, 696, 695,
-	709, 709, 695, 710, 695, 694, 710, 694, 625, 710, 627, 625, 694, 625, 623, 710,
-	703, 704, 711, 711, 712, 703, 711, 713, 712, 711, 714, 713, 714, 715, 713, 715,
-	716, 713, 716, 717, 713, 717, 716, 718, 716, 719, 718, 718, 719, 720, 721, 718,
-	720, 721, 720, 722, 723, 721, 722, 724, 721, 723, 725, 724, 723, 726, 724, 725,
-	727, 726, 725, 728, 726, 727, 728, 729, 726, 729, 730, 726, 726, 730, 724, 731,
-	730, 729, 732, 731, 729, 733, 728, 727, 731, 732, 734, 735, 731, 734, 736, 735,
-	734, 737, 736, 734, 730, 738, 724, 738, 730, 731, 739, 738, 731, 739, 731, 735,
-	740, 739, 735, 740, 735, 736, 712, 740, 736, 718, 738, 739, 738, 718, 721, 724,
-	738, 721, 717, 718, 739, 717, 739, 740, 713, 717, 740, 713, 740, 712, 701, 736,
-	737, 700, 701, 737, 736, 701, 702, 712, 736, 702, 712, 702, 703, 700, 737, 741,
-	737, 742, 741, 741, 742, 743, 743, 742, 744, 742, 745, 744, 744, 745, 746, 745,
-	747, 746, 746, 747, 748, 747, 749, 748, 748, 749, 750, 751, 748, 750, 751, 750,
-	752, 753, 751, 752, 753, 752, 754, 752, 755, 754, 754, 755, 756, 755, 757, 756,
-	756, 757, 758, 757, 759, 758, 758, 759, 760, 759, 761, 760, 760, 761, 762, 763,
-	760, 762, 764, 763, 762, 765, 764, 762, 764, 766, 763, 766, 767, 763, 763, 767,
-	760, 766, 768, 767, 768, 769, 767, 767, 769, 770, 767, 770, 760, 760, 770, 758,
-	769, 771, 770, 769, 768, 772, 768, 773, 772, 772, 773, 774, 773, 775, 774, 775,
-	776, 774, 776, 777, 774, 777, 778, 774, 778, 779, 774, 774, 779, 772, 779, 780,
-	772, 780, 771, 769, 772, 780, 769, 770, 771, 781, 771, 782, 781, 782, 771, 780,
-	783, 782, 780, 783, 780, 779, 784, 783, 779, 784, 779, 778, 785, 784, 778, 781,
-	782, 786, 782, 787, 786, 787, 782, 783, 788, 787, 783, 788, 783, 784, 789, 788,
-	784, 789, 784, 785, 790, 789, 785, 786, 787, 791, 787, 792, 791, 792, 787, 788,
-	793, 792, 788, 793, 788, 789, 794, 793, 789, 794, 789, 790, 795, 794, 790, 791,
-	792, 796, 792, 797, 796, 797, 792, 793, 796, 797, 798, 797, 799, 798, 799, 800,
-	798, 800, 801, 798, 802, 801, 800, 803, 802, 800, 802, 803, 804, 805, 802, 804,
-	806, 805, 804, 807, 806, 804, 808, 799, 797, 809, 808, 797, 810, 808, 809, 811,
-	810, 809, 812, 810, 811, 812, 813, 810, 813, 814, 810, 810, 814, 808, 815, 814,
-	813, 816, 815, 813, 817, 812, 811, 815, 816, 818, 819, 815, 818, 820, 819, 818,
-	821, 820, 818, 814, 822, 808, 822, 814, 815, 823, 822, 815, 823, 815, 819, 824,
-	823, 819, 824, 819, 820, 825, 824, 820, 800, 822, 823, 822, 800, 799, 808, 822,
-	799, 803, 800, 823, 803, 823, 824, 804, 803, 824, 804, 824, 825, 807, 804, 825,
-	826, 820, 821, 827, 826, 821, 828, 826, 827, 829, 828, 827, 830, 828, 829, 831,
-	830, 829, 832, 830, 831, 833, 832, 831, 834, 832, 833, 835, 834, 833, 836, 834,
-	835, 837, 836, 835, 838, 832, 834, 830, 832, 838, 839, 838, 834, 839, 834, 836,
-	840, 839, 836, 841, 838, 839, 842, 841, 839, 842, 839, 840, 842, 843, 841, 844,
-	843, 842, 845, 844, 842, 845, 842, 840, 843, 846, 841, 847, 838, 841, 847, 830,
-	838, 848, 847, 841, 841, 846, 848, 846, 849, 848, 828, 830, 847, 850, 828, 847,
-	850, 847, 848, 851, 850, 848, 848, 849, 851, 849, 852, 851, 826, 828, 850, 853,
-	826, 850, 853, 850, 851, 854, 853, 851, 851, 852, 854, 852, 855, 854, 820, 826,
-	853, 825, 820, 853, 825, 853, 854, 807, 825, 854, 854, 855, 807, 855, 806, 807,
-	743, 806, 855, 806, 743, 805, 743, 744, 805, 856, 743, 855, 856, 855, 852, 856,
-	741, 743, 857, 741, 856, 858, 857, 856, 858, 856, 852, 859, 857, 858, 860, 859,
-	858, 861, 859, 860, 862, 861, 860, 863, 861, 862, 864, 863, 862, 865, 863, 864,
-	866, 865, 864, 860, 858, 849, 858, 852, 849, 860, 849, 846, 862, 860, 846, 862,
-	846, 843, 864, 862, 843, 864, 843, 844, 866, 864, 844, 700, 741, 857, 693, 700,
-	857, 693, 857, 859, 678, 693, 859, 678, 859, 861, 673, 678, 861, 673, 861, 863,
-	674, 673, 863, 674, 863, 865, 676, 674, 865, 869, 868, 867, 870, 869, 867, 870,
-	867, 871, 872, 870, 871, 868, 869, 873, 874, 868, 873, 875, 874, 873, 876, 875,
-	873, 877, 875, 876, 878, 877, 876, 879, 870, 872, 880, 879, 872, 881, 879, 880,
-	882, 881, 880, 883, 881, 882, 883, 884, 881, 884, 885, 881, 881, 885, 879, 886,
-	883, 882, 885, 884, 887, 888, 885, 887, 889, 888, 887, 890, 889, 887, 891, 889,
-	890, 892, 891, 890, 885, 893, 879, 893, 885, 888, 894, 893, 888, 894, 888, 889,
-	895, 894, 889, 895, 889, 891, 896, 895, 891, 869, 893, 894, 893, 869, 870, 879,
-	893, 870, 873, 869, 894, 873, 894, 895, 876, 873, 895, 876, 895, 896, 878, 876,
-	896, 897, 891, 892, 898, 897, 892, 899, 897, 898, 900, 899, 898, 901, 899, 900,
-	902, 901, 900, 903, 901, 902, 904, 903, 902, 905, 903, 904, 906, 905, 904, 907,
-	905, 906, 908, 907, 906, 909, 903, 905, 901, 903, 909, 910, 909, 905, 910, 905,
-	907, 911, 910, 907, 912, 909, 910, 913, 912, 910, 913, 910, 911, 913, 914, 912,
-	915, 914, 913, 916, 915, 913, 916, 913, 911, 914, 917, 912, 918, 917, 914, 919,
-	918, 914, 919, 914, 915, 919, 920, 918, 921, 920, 919, 922, 921, 919, 922, 919,
-	915, 920, 923, 918, 921, 924, 920, 924, 925, 920, 920, 925, 923, 924, 926, 925,
-	926, 927, 925, 925, 927, 928, 925, 928, 923, 927, 929, 928, 927, 926, 930, 926,
-	931, 930, 930, 931, 932, 931, 933, 932, 933, 934, 932, 934, 935, 932, 935, 936,
-	932, 936, 937, 932, 932, 937, 930, 937, 938, 930, 938, 929, 927, 930, 938, 927,
-	923, 928, 939, 923, 939, 940, 918, 923, 940, 940, 941, 918, 941, 917, 918, 917,
-	941, 942, 912, 917, 942, 942, 943, 912, 943, 909, 912, 943, 901, 909, 944, 938,
-	937, 944, 945, 938, 945, 929, 938, 929, 945, 946, 928, 946, 939, 928, 929, 946,
-	899, 901, 943, 947, 899, 943, 947, 943, 942, 948, 947, 942, 942, 941, 948, 941,
-	949, 948, 949, 941, 940, 950, 949, 940, 940, 939, 950, 939, 951, 950, 939, 946,
-	951, 946, 952, 951, 946, 945, 952, 945, 953, 952, 953, 945, 944, 954, 953, 944,
-	897, 899, 947, 955, 897, 947, 955, 947, 948, 956, 955, 948, 948, 949, 956, 949,
-	957, 956, 957, 949, 950, 958, 957, 950, 950, 951, 958, 951, 959, 958, 951, 952,
-	959, 952, 960, 959, 952, 953, 960, 953, 961, 960, 961, 953, 954, 962, 961, 954,
-	962, 954, 963, 963, 954, 964, 954, 944, 964, 964, 944, 937, 964, 937, 936, 965,
-	964, 936, 963, 964, 965, 966, 963, 965, 967, 962, 963, 967, 963, 966, 968, 967,
-	966, 956, 957, 878, 878, 896, 956, 896, 955, 956, 896, 891, 955, 891, 897, 955,
-	969, 962, 967, 970, 969, 967, 970, 967, 968, 970, 971, 969, 972, 971, 970, 972,
-	973, 971, 973, 974, 971, 974, 973, 975, 976, 974, 975, 977, 976, 975, 978, 977,
-	975, 979, 972, 970, 980, 977, 978, 981, 980, 978, 971, 982, 969, 971, 974, 982,
-	974, 983, 982, 983, 974, 976, 984, 983, 976, 984, 976, 977, 985, 984, 977, 985,
-	977, 980, 986, 985, 980, 982, 983, 987, 982, 987, 988, 988, 987, 989, 987, 990,
-	989, 987, 991, 990, 983, 991, 987, 991, 983, 984, 991, 992, 990, 992, 991, 993,
-	993, 991, 984, 993, 984, 985, 994, 992, 993, 995, 994, 993, 996, 995, 993, 996,
-	993, 985, 996, 985, 986, 995, 996, 997, 997, 996, 986, 998, 995, 997, 990, 992,
-	494, 989, 990, 494, 992, 496, 494, 496, 992, 994, 500, 496, 994, 500, 994, 995,
-	502, 500, 995, 502, 995, 998, 508, 502, 998, 497, 989, 494, 960, 989, 497, 959,
-	960, 497, 959, 497, 498, 958, 959, 498, 498, 877, 958, 498, 492, 877, 492, 875,
-	877, 492, 490, 875, 490, 874, 875, 490, 486, 874, 486, 868, 874, 868, 486, 484,
-	867, 868, 484, 871, 867, 484, 488, 871, 484, 999, 871, 488, 1000, 999, 488, 1001,
-	999, 1000, 1002, 1001, 1000, 1003, 1001, 1002, 1004, 1003, 1002, 1005, 1003, 1004, 1006, 1005,
-	1004, 1007, 1005, 1006, 1007, 1008, 1005, 1009, 1008, 1007, 1010, 1009, 1007, 1008, 1011, 1005,
-	1005, 1011, 1003, 1008, 1009, 1012, 1009, 1013, 1012, 1012, 1013, 1014, 1013, 1015, 1014, 1015,
-	1016, 1014, 1016, 1017, 1014, 1017, 1018, 1014, 1018, 1019, 1014, 1014, 1019, 1012, 1019, 1020,
-	1012, 1020, 1011, 1008, 1012, 1020, 1008, 1010, 1007, 1021, 1021, 1007, 1006, 1021, 1006, 1022,
-	1023, 1021, 1022, 1023, 1010, 1021, 1024, 1023, 1022, 1006, 1025, 1022, 1024, 1022, 1026, 1022,
-	1025, 1026, 1027, 1024, 1026, 1027, 1026, 1028, 1029, 1027, 1028, 1028, 1026, 1030, 1026, 1031,
-	1030, 1025, 1031, 1026, 1032, 1029, 1028, 1033, 1032, 1028, 1028, 1030, 1034, 1033, 1028, 1034,
-	1033, 1034, 1035, 1034, 1036, 1035, 1035, 1036, 1037, 1036, 1038, 1037, 1037, 1038, 1039, 1040,
-	1037, 1039, 1041, 1037, 1040, 1035, 1037, 1041, 1042, 1041, 1040, 1043, 1035, 1041, 1033, 1035,
-	1043, 1032, 1033, 1043, 1039, 1038, 1044, 1038, 1045, 1044, 1045, 1038, 1036, 1046, 1045, 1036,
-	1046, 1036, 1034, 1047, 1046, 1034, 1034, 1030, 1047, 1030, 1048, 1047, 1030, 1031, 1048, 1031,
-	1049, 1048, 1049, 1031, 1025, 1050, 1049, 1025, 1050, 1025, 1006, 1004, 1050, 1006, 1044, 1045,
-	1051, 1045, 1052, 1051, 1052, 1045, 1046, 1053, 1052, 1046, 1053, 1046, 1047, 1054, 1053, 1047,
-	1047, 1048, 1054, 1048, 1055, 1054, 1048, 1049, 1055, 1049, 1056, 1055, 1056, 1049, 1050, 1057,
-	1056, 1050, 1057, 1050, 1004, 1002, 1057, 1004, 1051, 1052, 1058, 1052, 1059, 1058, 1059, 1052,
-	1053, 1060, 1059, 1053, 1060, 1053, 1054, 1061, 1060, 1054, 1054, 1055, 1061, 1055, 1062, 1061,
-	1055, 1056, 1062, 1056, 1063, 1062, 1063, 1056, 1057, 1064, 1063, 1057, 1064, 1057, 1002, 1000,
-	1064, 1002, 1058, 1059, 1065, 1059, 1066, 1065, 1066, 1059, 1060, 1065, 1066, 1067, 1066, 1068,
-	1067, 1068, 1069, 1067, 1069, 1070, 1067, 1070, 1069, 1071, 1072, 1070, 1071, 1072, 1071, 1073,
-	1071, 1074, 1073, 1073, 1074, 1075, 1074, 1076, 1075, 1075, 1076, 1077, 1078, 1075, 1077, 1078,
-	1077, 1079, 1080, 1078, 1079, 1079, 1077, 1081, 1077, 1082, 1081, 1077, 1076, 1082, 1076, 1083,
-	1082, 1083, 1076, 1074, 1084, 1083, 1074, 1084, 1074, 1071, 1085, 1084, 1071, 1071, 1069, 1085,
-	1069, 1086, 1085, 1086, 1069, 1068, 1087, 1086, 1068, 1087, 1068, 1066, 1088, 1087, 1066, 1081,
-	1082, 1089, 1082, 1090, 1089, 1082, 1083, 1090, 1089, 1090, 8, 1090, 3, 8, 1090, 1091,
-	3, 1083, 1091, 1090, 1091, 1083, 1084, 1091, 2, 3, 11, 2, 1091, 1092, 11, 1091,
-	1092, 1091, 1084, 1092, 1084, 1085, 1093, 11, 1092, 1093, 1094, 11, 1094, 1093, 1095, 1093,
-	1096, 1095, 1095, 1096, 1097, 1098, 1095, 1097, 1098, 1097, 1099, 1100, 1098, 1099, 1101, 1095,
-	1098, 1094, 1095, 1101, 1102, 1101, 1098, 1103, 1101, 1102, 1104, 1103, 1102, 1105, 1103, 1104,
-	1106, 1105, 1104, 1107, 1105, 1106, 1108, 1107, 1106, 1109, 1107, 1108, 1110, 1109, 1108, 1111,
-	1109, 1110, 1112, 1111, 1110, 1113, 1111, 1112, 1114, 1113, 1112, 1115, 1113, 1114, 1116, 1115,
-	1114, 1117, 1115, 1116, 1118, 1117, 1116, 1106, 1104, 555, 1104, 550, 555, 1104, 1102, 550,
-	1102, 482, 550, 482, 1102, 1098, 481, 482, 1098, 481, 1098, 1100, 487, 481, 1100, 1114,
-	1112, 1119, 1112, 560, 1119, 1119, 560, 559, 1120, 1119, 559, 597, 1119, 1120, 595, 597,
-	1120, 595, 1120, 1121, 593, 595, 1121, 593, 1121, 1122, 591, 593, 1122, 591, 1122, 1123,
-	588, 591, 1123, 588, 1123, 586, 1120, 559, 562, 1121, 1120, 562, 1121, 562, 564, 1122,
-	1121, 564, 1122, 564, 566, 1123, 1122, 566, 1123, 566, 568, 586, 1123, 568, 586, 568,
-	570, 1114, 1119, 597, 1116, 1114, 597, 1118, 1116, 597, 596, 1118, 597, 1118, 596, 1124,
-	1125, 1118, 1124, 1125, 1124, 1126, 1126, 1124, 1127, 1124, 596, 1127, 1128, 1126, 1127, 1129,
-	1126, 1128, 1130, 1129, 1128, 1130, 1128, 1131, 1132, 1130, 1131, 1133, 1129, 1130, 1134, 1133,
-	1130, 1134, 1130, 1132, 1135, 1134, 1132, 1135, 1132, 1136, 1137, 1135, 1136, 1137, 1136, 1138,
-	1139, 1137, 1138, 1139, 1138, 1140, 1140, 1138, 1141, 1138, 1142, 1141, 1138, 1136, 1142, 1140,
-	1141, 1143, 1144, 1140, 1143, 1145, 1139, 1140, 1145, 1140, 1144, 1146, 1145, 1144, 1146, 1144,
-	1147, 1148, 1146, 1147, 1148, 1147, 1149, 1150, 1148, 1149, 1150, 1149, 1151, 1151, 1149, 1152,
-	1149, 1153, 1152, 1149, 1147, 1153, 1151, 1152, 1154, 1155, 1151, 1154, 1156, 1150, 1151, 1156,
-	1151, 1155, 1157, 1156, 1155, 1147, 1158, 1153, 1144, 1143, 1158, 1147, 1144, 1158, 1157, 1155,
-	1159, 1160, 1157, 1159, 1155, 1154, 1161, 1159, 1155, 1161, 1160, 1159, 1162, 1163, 1160, 1162,
-	1164, 1163, 1162, 1165, 1164, 1162, 1165, 1162, 1166, 1159, 1161, 1166, 1162, 1159, 1166, 1167,
-	1165, 1166, 1153, 1158, 1168, 1158, 1169, 1168, 1158, 1143, 1169, 1143, 1170, 1169, 1143, 1141,
-	1170, 1141, 1171, 1170, 1141, 1142, 1171, 1142, 1172, 1171, 1142, 1173, 1172, 1136, 1173, 1142,
-	1136, 1132, 1173, 1132, 1131, 1173, 1173, 1131, 1174, 1173, 1174, 1172, 1131, 1175, 1174, 1131,
-	1128, 1175, 1128, 1127, 1175, 1175, 1127, 592, 1127, 594, 592, 596, 594, 1127, 1175, 592,
-	590, 1174, 1175, 590, 1174, 590, 1172, 590, 589, 1172, 1172, 589, 1171, 589, 598, 1171,
-	1171, 598, 600, 1170, 1171, 600, 1170, 600, 602, 1169, 1170, 602, 1169, 602, 1168, 602,
-	604, 1168, 1168, 604, 1176, 1153, 1168, 1176, 1152, 1153, 1176, 1152, 1176, 1177, 1154, 1152,
-	1177, 1154, 1177, 1178, 1161, 1154, 1178, 1161, 1178, 1179, 1166, 1161, 1179, 1166, 1179, 1180,
-	1167, 1166, 1180, 604, 606, 1176, 1176, 606, 608, 1177, 1176, 608, 1177, 608, 610, 1178,
-	1177, 610, 1178, 610, 1179, 610, 612, 1179, 1179, 612, 614, 1180, 1179, 614, 1180, 614,
-	1181, 614, 1182, 1181, 1181, 1182, 1183, 1182, 1184, 1183, 1183, 1184, 1185, 1184, 1186, 1185,
-	1185, 1186, 1187, 1186, 640, 1187, 1187, 640, 1188, 1189, 1187, 1188, 1185, 1187, 1189, 1190,
-	1189, 1188, 1190, 1191, 1189, 1192, 1191, 1190, 1193, 1192, 1190, 1193, 1190, 1188, 1192, 1194,
-	1191, 1194, 1195, 1191, 1191, 1195, 1196, 1191, 1196, 1189, 1195, 1197, 1196, 1198, 1193, 1188,
-	640, 641, 1188, 1198, 1188, 641, 642, 1198, 641, 1199, 1197, 1195, 1200, 1199, 1195, 1200,
-	1195, 1194, 1201, 1199, 1200, 1202, 1201, 1200, 1202, 1200, 1203, 1203, 1200, 1194, 1204, 1202,
-	1203, 1205, 1201, 1202, 1206, 1205, 1202, 1206, 1202, 1204, 1207, 1205, 1206, 1208, 1207, 1206,
-	1208, 1206, 1209, 1209, 1206, 1204, 1210, 1208, 1209, 1211, 1207, 1208, 1212, 1211, 1208, 1212,
-	1208, 1210, 1213, 1212, 1210, 1214, 1199, 1201, 1214, 1215, 1199, 1216, 1214, 1201, 1216, 1201,
-	1205, 1217, 1216, 1205, 1217, 1205, 1207, 1218, 1217, 1207, 1218, 1207, 1211, 1219, 1218, 1211,
-	1220, 1215, 1214, 1215, 1220, 1221, 1222, 1215, 1221, 1197, 1215, 1222, 1196, 1197, 1222, 1196,
-	1222, 1223, 1189, 1196, 1223, 1223, 1185, 1189, 1215, 1197, 1199, 1183, 1185, 1223, 1224, 1183,
-	1223, 1222, 1221, 1224, 1223, 1222, 1224, 1225, 1216, 1217, 1225, 1226, 1216, 1226, 1220, 1214,
-	1226, 1214, 1216, 1181, 1183, 1224, 1227, 1181, 1224, 1224, 1221, 1227, 1221, 1228, 1227, 1221,
-	1220, 1228, 1220, 1229, 1228, 1229, 1220, 1226, 1230, 1229, 1226, 1230, 1226, 1225, 1231, 1230,
-	1225, 1231, 1225, 1232, 1232, 1225, 1217, 1232, 1217, 1218, 1233, 1232, 1218, 1233, 1218, 1219,
-	1234, 1233, 1219, 1235, 1231, 1232, 1235, 1232, 1233, 1236, 1235, 1233, 1236, 1233, 1234, 1237,
-	1236, 1234, 1227, 1228, 1167, 1167, 1180, 1227, 1180, 1181, 1227, 1164, 1229, 1230, 213, 1164,
-	1230, 213, 211, 1164, 211, 1163, 1164, 211, 209, 1163, 209, 1160, 1163, 209, 194, 1160,
-	194, 1157, 1160, 194, 192, 1157, 192, 1156, 1157, 192, 190, 1156, 190, 1150, 1156, 190,
-	189, 1150, 189, 1148, 1150, 189, 196, 1148, 196, 1146, 1148, 196, 198, 1146, 198, 1145,
-	1146, 198, 200, 1145, 200, 1139, 1145, 200, 202, 1139, 202, 1137, 1139, 202, 204, 1137,
-	204, 1135, 1137, 204, 206, 1135, 206, 1134, 1135, 206, 208, 1134, 208, 1133, 1134, 1238,
-	1133, 208, 1238, 1239, 1133, 1238, 1240, 1239, 1240, 1241, 1239, 1239, 1241, 1242, 1241, 1243,
-	1242, 1242, 1243, 1125, 1243, 1244, 1125, 1242, 1125, 1126, 1242, 1126, 1129, 1239, 1242, 1129,
-	1239, 1129, 1133, 1245, 1244, 1243, 1246, 1245, 1243, 1246, 1243, 1241, 1247, 1246, 1241, 1241,
-	1240, 1248, 1247, 1241, 1248, 1245, 1249, 1244, 1249, 1117, 1244, 1244, 1117, 1125, 1249, 1250,
-	1117, 1250, 1115, 1117, 1250, 1251, 1115, 1251, 1113, 1115, 1251, 1252, 1113, 1252, 1111, 1113,
-	1252, 1253, 1111, 1253, 1109, 1111, 1107, 1109, 1253, 1254, 1107, 1253, 1254, 1255, 1107, 1255,
-	1105, 1107, 1255, 1256, 1105, 1256, 1103, 1105, 1256, 1257, 1103, 1257, 1101, 1103, 1257, 1094,
-	1101, 1251, 53, 1252, 54, 53, 1251, 53, 40, 1252, 1252, 40, 39, 1253, 1252, 39,
-	1253, 39, 1254, 39, 26, 1254, 1254, 26, 1255, 26, 25, 1255, 1255, 25, 1256, 25,
-	18, 1256, 1256, 18, 1257, 18, 10, 1257, 1257, 10, 1094, 10, 9, 1094, 1094, 9,
-	11, 56, 54, 1250, 1249, 56, 1250, 58, 56, 1249, 1245, 58, 1249, 60, 58, 1245,
-	1246, 60, 1245, 66, 60, 1246, 1247, 66, 1246, 67, 66, 1247, 1248, 67, 1247, 222,
-	67, 1248, 222, 224, 67, 224, 65, 67, 224, 226, 65, 226, 64, 65, 73, 64,
-	226, 228, 73, 226, 228, 230, 73, 230, 72, 73, 72, 230, 232, 101, 72, 232,
-	101, 232, 102, 220, 222, 1248, 1248, 1240, 220, 1240, 218, 220, 218, 1240, 1238, 216,
-	218, 1238, 216, 1238, 208, 1260, 1259, 1258, 1261, 1260, 1258, 1262, 1261, 1258, 1263, 1262,
-	1258, 1259, 1260, 1264, 1265, 1259, 1264, 1266, 1265, 1264, 1267, 1266, 1264, 1268, 1266, 1267,
-	1269, 1268, 1267, 1258, 1259, 1270, 1259, 1271, 1270, 1258, 1270, 1272, 1263, 1258, 1272, 1268,
-	1273, 1266, 1273, 1274, 1266, 1266, 1274, 1265, 1274, 1275, 1265, 1275, 1271, 1259, 1265, 1275,
-	1259, 1276, 1261, 1262, 1277, 1276, 1262, 1278, 1276, 1277, 1279, 1278, 1277, 1278, 1280, 1276,
-	1280, 1281, 1276, 1281, 1280, 1282, 1283, 1281, 1282, 1283, 1282, 1284, 1285, 1283, 1284, 1285,
-	1284, 1286, 1287, 1285, 1286, 1276, 1281, 1261, 1281, 1260, 1261, 1260, 1281, 1283, 1264, 1260,
-	1283, 1264, 1283, 1285, 1267, 1264, 1285, 1267, 1285, 1287, 1269, 1267, 1287, 1279, 1277, 1288,
-	1277, 1289, 1288, 1288, 1289, 1290, 1289, 1291, 1290, 1290, 1291, 1292, 1291, 1293, 1292, 1292,
-	1293, 1294, 1293, 1295, 1294, 1294, 1295, 1296, 1297, 1294, 1296, 1296, 1298, 1297, 1298, 1299,
-	1297, 1300, 1298, 1296, 1301, 1300, 1296, 1296, 1295, 1301, 1300, 1301, 1302, 1303, 1300, 1302,
-	1302, 1301, 1304, 1301, 1305, 1304, 1295, 1305, 1301, 1302, 1304, 1306, 1303, 1302, 1306, 1304,
-	1307, 1306, 1308, 1303, 1306, 1309, 1307, 1304, 1310, 1309, 1304, 1304, 1305, 1310, 1305, 1311,
-	1310, 1311, 1305, 1295, 1293, 1311, 1295, 1312, 1309, 1310, 1313, 1312, 1310, 1310, 1311, 1313,
-	1311, 1314, 1313, 1314, 1311, 1293, 1291, 1314, 1293, 1315, 1312, 1313, 1316, 1315, 1313, 1313,
-	1314, 1316, 1314, 1317, 1316, 1317, 1314, 1291, 1289, 1317, 1291, 1272, 1315, 1316, 1263, 1272,
-	1316, 1316, 1317, 1263, 1317, 1262, 1263, 1262, 1317, 1289, 1277, 1262, 1289, 1318, 1312, 1315,
-	1318, 1319, 1312, 1319, 1309, 1312, 1319, 1320, 1309, 1320, 1307, 1309, 1307, 1320, 1321, 1306,
-	1307, 1321, 1308, 1306, 1321, 1322, 1308, 1321, 1318, 1323, 1319, 1324, 1323, 1318, 1324, 1325,
-	1323, 1325, 1326, 1323, 1323, 1326, 1327, 1323, 1327, 1319, 1319, 1327, 1320, 1326, 1328, 1327,
-	1327, 1328, 1018, 1327, 1018, 1320, 1328, 1019, 1018, 1328, 1329, 1019, 1329, 1020, 1019, 1329,
-	1330, 1020, 1330, 1011, 1020, 1011, 1330, 1003, 1003, 1330, 1001, 1330, 1331, 1001, 1331, 1330,
-	1329, 1332, 1331, 1329, 1332, 1329, 1328, 1326, 1332, 1328, 1001, 1331, 999, 1331, 1333, 999,
-	1333, 1331, 1332, 1334, 1333, 1332, 1334, 1332, 1326, 1325, 1334, 1326, 999, 1333, 871, 1333,
-	872, 871, 872, 1333, 1334, 880, 872, 1334, 880, 1334, 1325, 882, 880, 1325, 882, 1325,
-	1324, 886, 882, 1324, 886, 1324, 1335, 1336, 886, 1335, 1336, 1335, 1272, 1335, 1315, 1272,
-	1335, 1318, 1315, 1335, 1324, 1318, 1272, 1270, 1336, 1270, 1337, 1336, 1336, 1337, 886, 1270,
-	1271, 1337, 1271, 1338, 1337, 1338, 1271, 1275, 1339, 1338, 1275, 1339, 1275, 1274, 1340, 1339,
-	1274, 1340, 1274, 1273, 1341, 1340, 1273, 1341, 1273, 1342, 1342, 1273, 1268, 1343, 1342, 1268,
-	1344, 1342, 1343, 1345, 1344, 1343, 1346, 1344, 1345, 1347, 1346, 1345, 1348, 1346, 1347, 1349,
-	1348, 1347, 1350, 1348, 1349, 1351, 1350, 1349, 1351, 1349, 1352, 1353, 1351, 1352, 1354, 1351,
-	1353, 1355, 1354, 1353, 1356, 1350, 1351, 1354, 1356, 1351, 1353, 1352, 1357, 1352, 1358, 1357,
-	1357, 1358, 1359, 1358, 1360, 1359, 1357, 1359, 1361, 1362, 1357, 1361, 1353, 1357, 1362, 1355,
-	1353, 1362, 1363, 1360, 1358, 1364, 1363, 1358, 1364, 1358, 1352, 1365, 1364, 1352, 1352, 1349,
-	1365, 1349, 1347, 1365, 1366, 1363, 1364, 1367, 1366, 1364, 1367, 1364, 1365, 1368, 1367, 1365,
-	1365, 1347, 1368, 1347, 1345, 1368, 1369, 1366, 1367, 1370, 1369, 1367, 1370, 1367, 1368, 1371,
-	1370, 1368, 1368, 1345, 1371, 1345, 1343, 1371, 1286, 1369, 1370, 1287, 1286, 1370, 1287, 1370,
-	1371, 1269, 1287, 1371, 1371, 1343, 1269, 1343, 1268, 1269, 1369, 1286, 1372, 1286, 1373, 1372,
-	1372, 1373, 1374, 1374, 1373, 1375, 1373, 1376, 1375, 1375, 1376, 1377, 1376, 1378, 1377, 1378,
-	1379, 1377, 1379, 1380, 1377, 1380, 1379, 1381, 1382, 1380, 1381, 1382, 1381, 1383, 1384, 1382,
-	1383, 1384, 1383, 1385, 1383, 1386, 1385, 1385, 1386, 1387, 1386, 1388, 1387, 1387, 1388, 1389,
-	1388, 1390, 1389, 1389, 1390, 1391, 1390, 1392, 1391, 1391, 1392, 1393, 1394, 1391, 1393, 1395,
-	1394, 1393, 1396, 1395, 1393, 1395, 1397, 1394, 1397, 1398, 1394, 1397, 1399, 1398, 1399, 1400,
-	1398, 1399, 1401, 1400, 1401, 1402, 1400, 1400, 1402, 1403, 1400, 1403, 1398, 1402, 1404, 1403,
-	1403, 1405, 1398, 1405, 1391, 1394, 1398, 1405, 1394, 1402, 1401, 1406, 1401, 1407, 1406, 1406,
-	1407, 1408, 1407, 1409, 1408, 1409, 1410, 1408, 1410, 1411, 1408, 1410, 1412, 1411, 1412, 1413,
-	1411, 1411, 1413, 1414, 1411, 1414, 1408, 1413, 1415, 1414, 1416, 1415, 1413, 1417, 1416, 1413,
-	1418, 1416, 1417, 1419, 1418, 1417, 1420, 1419, 1417, 1421, 1420, 1417, 1421, 1417, 1413, 1412,
-	1421, 1413, 1414, 1422, 1408, 1420, 1423, 1419, 1423, 1424, 1419, 1419, 1424, 1418, 1424, 1425,
-	1418, 1426, 1425, 1424, 1427, 1426, 1424, 1427, 1424, 1423, 1428, 1427, 1423, 1429, 1426, 1427,
-	1430, 1429, 1427, 1430, 1427, 1428, 1430, 1431, 1429, 1432, 1431, 1430, 1433, 1432, 1430, 1433,
-	1430, 1428, 1431, 1434, 1429, 1432, 1435, 1431, 1435, 1436, 1431, 1431, 1436, 1434, 1436, 1437,
-	1434, 1438, 1425, 1426, 1425, 1438, 1439, 1418, 1425, 1439, 1439, 1440, 1418, 1440, 1416, 1418,
-	1440, 1441, 1416, 1441, 1415, 1416, 1415, 1441, 1442, 1414, 1415, 1442, 1442, 1443, 1414, 1443,
-	1422, 1414, 1443, 1444, 1422, 1444, 1445, 1422, 1422, 1445, 1406, 1408, 1422, 1406, 1406, 1445,
-	1402, 1445, 1404, 1402, 1446, 1404, 1445, 1444, 1446, 1445, 1404, 1446, 1447, 1403, 1404, 1447,
-	1447, 1448, 1403, 1448, 1405, 1403, 1449, 1448, 1447, 1450, 1449, 1447, 1447, 1446, 1450, 1446,
-	1451, 1450, 1451, 1446, 1444, 1452, 1451, 1444, 1452, 1444, 1443, 1453, 1452, 1443, 1453, 1443,
-	1442, 1454, 1453, 1442, 1442, 1441, 1454, 1441, 1455, 1454, 1455, 1441, 1440, 1456, 1455, 1440,
-	1456, 1440, 1439, 1457, 1456, 1439, 1439, 1438, 1457, 1438, 1458, 1457, 1458, 1438, 1459, 1459,
-	1438, 1426, 1459, 1426, 1429, 1460, 1459, 1429, 1429, 1434, 1460, 1434, 1461, 1460, 1434, 1437,
-	1461, 1437, 1462, 1461, 1463, 1458, 1459, 1463, 1459, 1460, 1464, 1463, 1460, 1460, 1461, 1464,
-	1461, 1465, 1464, 1461, 1462, 1465, 1462, 1466, 1465, 1457, 1458, 1467, 1467, 1468, 1457, 1458,
-	1469, 1467, 1469, 1458, 1463, 1470, 1469, 1463, 1470, 1463, 1464, 1471, 1470, 1464, 1464, 1465,
-	1471, 1465, 1472, 1471, 1465, 1466, 1472, 1466, 1473, 1472, 1474, 1468, 1467, 1474, 1475, 1468,
-	1474, 1476, 1475, 1477, 1476, 1474, 1478, 1477, 1474, 1478, 1474, 1467, 1467, 1469, 1478, 1476,
-	1479, 1475, 1475, 1479, 1480, 1481, 1475, 1480, 1480, 1479, 1482, 1479, 1483, 1482, 1480, 1482,
-	1484, 1481, 1480, 1484, 1478, 1485, 1477, 1485, 1486, 1477, 1477, 1486, 1476, 1486, 1487, 1476,
-	1487, 1483, 1479, 1476, 1487, 1479, 1484, 1482, 1488, 1482, 1489, 1488, 1482, 1483, 1489, 1483,
-	1490, 1489, 1490, 1483, 1487, 1491, 1490, 1487, 1491, 1487, 1486, 1492, 1491, 1486, 1492, 1486,
-	1485, 1493, 1492, 1485, 1488, 1489, 1494, 1489, 1495, 1494, 1489, 1490, 1495, 1494, 1495, 1496,
-	1495, 1497, 1496, 1490, 1497, 1495, 1497, 1490, 1491, 1497, 1498, 1496, 1499, 1494, 1496, 1498,
-	1497, 1500, 1500, 1497, 1491, 1500, 1491, 1492, 1501, 1498, 1500, 1502, 1501, 1500, 1503, 1502,
-	1500, 1503, 1500, 1492, 1503, 1492, 1493, 1504, 1502, 1503, 1505, 1504, 1503, 1505, 1503, 1493,
-	1496, 1498, 1506, 1498, 1507, 1506, 1496, 1506, 1508, 1499, 1496, 1508, 1504, 1509, 1502, 1509,
-	1510, 1502, 1502, 1510, 1501, 1510, 1511, 1501, 1511, 1507, 1498, 1501, 1511, 1498, 1499, 1508,
-	1512, 1508, 1513, 1512, 1512, 1513, 1450, 1513, 1449, 1450, 1450, 1451, 1512, 1451, 1514, 1512,
-	1514, 1451, 1452, 1515, 1514, 1452, 1515, 1452, 1453, 1516, 1515, 1453, 1516, 1453, 1454, 1517,
-	1516, 1454, 1454, 1455, 1517, 1455, 1518, 1517, 1518, 1455, 1456, 1468, 1518, 1456, 1468, 1456,
-	1457, 1494, 1514, 1515, 1514, 1494, 1499, 1512, 1514, 1499, 1488, 1494, 1515, 1488, 1515, 1516,
-	1484, 1488, 1516, 1484, 1516, 1517, 1481, 1484, 1517, 1517, 1518, 1481, 1518, 1475, 1481, 1475,
-	1518, 1468, 1521, 1520, 1519, 1522, 1521, 1519, 1523, 1522, 1519, 1524, 1523, 1519, 1520, 1521,
-	1525, 1526, 1520, 1525, 1527, 1526, 1525, 1528, 1527, 1525, 1529, 1527, 1528, 1530, 1529, 1528,
-	1531, 1522, 1523, 1532, 1531, 1523, 1533, 1531, 1532, 1534, 1533, 1532, 1533, 1535, 1531, 1535,
-	1536, 1531, 1536, 1521, 1522, 1531, 1536, 1522, 1536, 1535, 1537, 1538, 1536, 1537, 1538, 1537,
-	1539, 1540, 1538, 1539, 1525, 1538, 1540, 1528, 1525, 1540, 1540, 1539, 1541, 1542, 1540, 1541,
-	1528, 1540, 1542, 1530, 1528, 1542, 1521, 1536, 1538, 1525, 1521, 1538, 1534, 1532, 1543, 1532,
-	1544, 1543, 1543, 1544, 1545, 1544, 1546, 1545, 1545, 1546, 1547, 1546, 1548, 1547, 1547, 1548,
-	1549, 1548, 1550, 1549, 1549, 1550, 1551, 1552, 1549, 1551, 1551, 1553, 1552, 1553, 1554, 1552,
-	1555, 1553, 1551, 1556, 1555, 1551, 1551, 1550, 1556, 1555, 1556, 1557, 1558, 1555, 1557, 1557,
-	1556, 1559, 1556, 1560, 1559, 1550, 1560, 1556, 1559, 1560, 1561, 1560, 1562, 1561, 1562, 1560,
-	1550, 1548, 1562, 1550, 1561, 1562, 1563, 1562, 1564, 1563, 1564, 1562, 1548, 1546, 1564, 1548,
-	1563, 1564, 1565, 1564, 1566, 1565, 1566, 1564, 1546, 1544, 1566, 1546, 1565, 1566, 1524, 1566,
-	1523, 1524, 1523, 1566, 1544, 1532, 1523, 1544, 1558, 1557, 1567, 1568, 1558, 1567, 1568, 1567,
-	1569, 1567, 1570, 1569, 1567, 1557, 1570, 1570, 1571, 1569, 1572, 1568, 1569, 1573, 1571, 1570,
-	1574, 1573, 1570, 1575, 1573, 1574, 1576, 1575, 1574, 1577, 1575, 1576, 1578, 1577, 1576, 1579,
-	1577, 1578, 1580, 1579, 1578, 1580, 1581, 1579, 1581, 1582, 1579, 1581, 1583, 1582, 1583, 1584,
-	1582, 1585, 1584, 1583, 1586, 1585, 1583, 1587, 1585, 1586, 1588, 1587, 1586, 1589, 1587, 1588,
-	1590, 1589, 1588, 1591, 1589, 1590, 1592, 1591, 1590, 1593, 1591, 1592, 1594, 1593, 1592, 1595,
-	1593, 1594, 1596, 1595, 1594, 1597, 1595, 1596, 1598, 1597, 1596, 1599, 1597, 1598, 1600, 1599,
-	1598, 1601, 1599, 1600, 1602, 1601, 1600, 1590, 1588, 1527, 1529, 1590, 1527, 1590, 1529, 1603,
-	1592, 1590, 1603, 1603, 1529, 1530, 1604, 1603, 1530, 1605, 1603, 1604, 1606, 1605, 1604, 1607,
-	1605, 1606, 1608, 1607, 1606, 1609, 1607, 1608, 1610, 1609, 1608, 1611, 1609, 1610, 1612, 1611,
-	1610, 1613, 1611, 1612, 1614, 1613, 1612, 1612, 1610, 1615, 1610, 1616, 1615, 1615, 1616, 1617,
-	1616, 1618, 1617, 1615, 1617, 1619, 1620, 1615, 1619, 1612, 1615, 1620, 1614, 1612, 1620, 1621,
-	1618, 1616, 1622, 1621, 1616, 1622, 1616, 1610, 1608, 1622, 1610, 1623, 1621, 1622, 1624, 1623,
-	1622, 1624, 1622, 1608, 1606, 1624, 1608, 1625, 1623, 1624, 1626, 1625, 1624, 1626, 1624, 1606,
-	1604, 1626, 1606, 1541, 1625, 1626, 1542, 1541, 1626, 1542, 1626, 1604, 1530, 1542, 1604, 1625,
-	1541, 1627, 1628, 1625, 1627, 1628, 1627, 1629, 1629, 1627, 1630, 1627, 1631, 1630, 1630, 1631,
-	1632, 1631, 1633, 1632, 1633, 1634, 1632, 1634, 1635, 1632, 1635, 1634, 1636, 1637, 1635, 1636,
-	1637, 1636, 1638, 1639, 1637, 1638, 1640, 1635, 1637, 1632, 1635, 1640, 1641, 1640, 1637, 1641,
-	1637, 1639, 1642, 1641, 1639, 1629, 1630, 1643, 1644, 1629, 1643, 1630, 1632, 1645, 1643, 1630,
-	1645, 1645, 1632, 1640, 1639, 1638, 1646, 1639, 1646, 1642, 1638, 1647, 1646, 1646, 1647, 1648,
-	1647, 1649, 1648, 1648, 1649, 1650, 1649, 1651, 1650, 1650, 1651, 1652, 1651, 1653, 1652, 1652,
-	1653, 1654, 1655, 1652, 1654, 1656, 1655, 1654, 1657, 1656, 1654, 1658, 1652, 1655, 1650, 1652,
-	1658, 1659, 1658, 1655, 1660, 1659, 1655, 1656, 1660, 1655, 1661, 1650, 1658, 1648, 1650, 1661,
-	1662, 1648, 1661, 1646, 1648, 1662, 1663, 1646, 1662, 1646, 1663, 1642, 1663, 1662, 1664, 1665,
-	1663, 1664, 1642, 1663, 1665, 1664, 1666, 1665, 1667, 1666, 1664, 1668, 1667, 1664, 1662, 1661,
-	1668, 1664, 1662, 1668, 1669, 1667, 1668, 1670, 1669, 1668, 1661, 1658, 1670, 1668, 1661, 1670,
-	1670, 1658, 1659, 1671, 1669, 1670, 1672, 1671, 1670, 1672, 1670, 1659, 1672, 1659, 1660, 1673,
-	1671, 1672, 1674, 1673, 1672, 1671, 1673, 1675, 1673, 1676, 1675, 1675, 1676, 1677, 1676, 1678,
-	1677, 1678, 1679, 1677, 1679, 1680, 1677, 1679, 1681, 1680, 1681, 1682, 1680, 1680, 1682, 1683,
-	1680, 1683, 1677, 1682, 1684, 1683, 1685, 1684, 1682, 1686, 1685, 1682, 1687, 1685, 1686, 1688,
-	1687, 1686, 1689, 1688, 1686, 1690, 1689, 1686, 1690, 1686, 1682, 1681, 1690, 1682, 1683, 1691,
-	1677, 1689, 1692, 1688, 1692, 1693, 1688, 1688, 1693, 1687, 1693, 1694, 1687, 1695, 1694, 1693,
-	1696, 1695, 1693, 1696, 1693, 1692, 1697, 1696, 1692, 1698, 1695, 1696, 1699, 1698, 1696, 1699,
-	1696, 1697, 1699, 1700, 1698, 1701, 1700, 1699, 1702, 1701, 1699, 1702, 1699, 1697, 1700, 1703,
-	1698, 1704, 1694, 1695, 1694, 1704, 1705, 1687, 1694, 1705, 1705, 1706, 1687, 1706, 1685, 1687,
-	1706, 1707, 1685, 1707, 1684, 1685, 1684, 1707, 1708, 1683, 1684, 1708, 1708, 1709, 1683, 1709,
-	1691, 1683, 1709, 1710, 1691, 1710, 1711, 1691, 1691, 1711, 1675, 1677, 1691, 1675, 1675, 1711,
-	1671, 1711, 1669, 1671, 1667, 1669, 1711, 1710, 1667, 1711, 1666, 1667, 1710, 1712, 1666, 1710,
-	1712, 1710, 1709, 1713, 1712, 1709, 1713, 1709, 1708, 1714, 1713, 1708, 1708, 1707, 1714, 1707,
-	1715, 1714, 1715, 1707, 1706, 1716, 1715, 1706, 1716, 1706, 1705, 1717, 1716, 1705, 1705, 1704,
-	1717, 1704, 1718, 1717, 1718, 1704, 1719, 1719, 1704, 1695, 1719, 1695, 1698, 1720, 1719, 1698,
-	1698, 1703, 1720, 1703, 1721, 1720, 1722, 1718, 1719, 1722, 1719, 1720, 1723, 1722, 1720, 1720,
-	1721, 1723, 1721, 1724, 1723, 1725, 1715, 1716, 1726, 1725, 1716, 1726, 1716, 1717, 1727, 1726,
-	1717, 1717, 1718, 1727, 1718, 1728, 1727, 1728, 1718, 1722, 1729, 1728, 1722, 1729, 1722, 1723,
-	1730, 1729, 1723, 1723, 1724, 1730, 1724, 1731, 1730, 1732, 1725, 1726, 1725, 1732, 1733, 1733,
-	1732, 1734, 1732, 1735, 1734, 1736, 1735, 1732, 1737, 1736, 1732, 1737, 1732, 1726, 1737, 1726,
-	1727, 1738, 1736, 1737, 1739, 1738, 1737, 1739, 1737, 1727, 1727, 1728, 1739, 1734, 1735, 1740,
-	1735, 1741, 1740, 1734, 1740, 1742, 1733, 1734, 1742, 1739, 1743, 1738, 1728, 1743, 1739, 1743,
-	1728, 1729, 1743, 1744, 1738, 1738, 1744, 1736, 1744, 1745, 1736, 1745, 1741, 1735, 1736, 1745,
-	1735, 1742, 1740, 1746, 1740, 1747, 1746, 1740, 1741, 1747, 1741, 1748, 1747, 1748, 1741, 1745,
-	1749, 1748, 1745, 1749, 1745, 1744, 1750, 1749, 1744, 1750, 1744, 1743, 1751, 1750, 1743, 1746,
-	1747, 1752, 1747, 1753, 1752, 1747, 1748, 1753, 1752, 1753, 1754, 1753, 1755, 1754, 1748, 1755,
-	1753, 1755, 1748, 1749, 1755, 1756, 1754, 1757, 1752, 1754, 1756, 1755, 1758, 1758, 1755, 1749,
-	1758, 1749, 1750, 1759, 1756, 1758, 1760, 1759, 1758, 1761, 1760, 1758, 1761, 1758, 1750, 1761,
-	1750, 1751, 1762, 1760, 1761, 1763, 1762, 1761, 1763, 1761, 1751, 1764, 1752, 1757, 1665, 1764,
-	1757, 1666, 1764, 1665, 1764, 1666, 1712, 1765, 1764, 1712, 1765, 1712, 1713, 1766, 1765, 1713,
-	1766, 1713, 1714, 1767, 1766, 1714, 1714, 1715, 1767, 1715, 1725, 1767, 1752, 1764, 1765, 1746,
-	1752, 1765, 1746, 1765, 1766, 1742, 1746, 1766, 1742, 1766, 1767, 1733, 1742, 1767, 1767, 1725,
-	1733, 1763, 1751, 1730, 1751, 1729, 1730, 1751, 1743, 1729, 1730, 1731, 1763, 1731, 1762, 1763,
-	1731, 1768, 1762, 1769, 1768, 1731, 1769, 1770, 1768, 1771, 1770, 1769, 1772, 1771, 1769, 1773,
-	1771, 1772, 1774, 1773, 1772, 1775, 1773, 1774, 1775, 1776, 1773, 1777, 1776, 1775, 1778, 1777,
-	1775, 1776, 1779, 1773, 1773, 1779, 1771, 1778, 1775, 1780, 1780, 1775, 1774, 1781, 1778, 1780,
-	1779, 1782, 1771, 1771, 1782, 1770, 1782, 1783, 1770, 1770, 1784, 1768, 1770, 1783, 1784, 1783,
-	1628, 1784, 1784, 1628, 1629, 1784, 1629, 1644, 1768, 1784, 1644, 1781, 1780, 1700, 1701, 1781,
-	1700, 1700, 1780, 1703, 1780, 1774, 1703, 1703, 1774, 1721, 1774, 1772, 1721, 1721, 1772, 1724,
-	1772, 1769, 1724, 1724, 1769, 1731, 1768, 1644, 1762, 1762, 1644, 1760, 1644, 1643, 1760, 1760,
-	1643, 1759, 1643, 1645, 1759, 1759, 1645, 1756, 1645, 1640, 1756, 1756, 1640, 1641, 1754, 1756,
-	1641, 1754, 1641, 1642, 1757, 1754, 1642, 1757, 1642, 1665, 1787, 1786, 1785, 1788, 1787, 1785,
-	1789, 1788, 1785, 1790, 1789, 1785, 1791, 1786, 1787, 1792, 1791, 1787, 1791, 1792, 1793, 1794,
-	1791, 1793, 1795, 1794, 1793, 1796, 1795, 1793, 1797, 1788, 1789, 1798, 1797, 1789, 1799, 1797,
-	1798, 1800, 1799, 1798, 1801, 1799, 1800, 1801, 1802, 1799, 1803, 1802, 1801, 1804, 1803, 1801,
-	1804, 1801, 1800, 1805, 1802, 1803, 1806, 1805, 1803, 1807, 1805, 1806, 1808, 1807, 1806, 1805,
-	1809, 1802, 1809, 1810, 1802, 1802, 1810, 1799, 1799, 1810, 1797, 1808, 1811, 1807, 1811, 1812,
-	1807, 1812, 1809, 1805, 1807, 1812, 1805, 1810, 1813, 1797, 1813, 1810, 1809, 1814, 1813, 1809,
-	1814, 1809, 1812, 1815, 1814, 1812, 1815, 1812, 1811, 1816, 1815, 1811, 1787, 1813, 1814, 1813,
-	1787, 1788, 1797, 1813, 1788, 1792, 1787, 1814, 1792, 1814, 1815, 1793, 1792, 1815, 1793, 1815,
-	1816, 1796, 1793, 1816, 1817, 1811, 1808, 1818, 1817, 1808, 1819, 1817, 1818, 1820, 1819, 1818,
-	1821, 1819, 1820, 1822, 1821, 1820, 1823, 1821, 1822, 1824, 1823, 1822, 1825, 1823, 1824, 1826,
-	1825, 1824, 1826, 1824, 1827, 1824, 1828, 1827, 1827, 1828, 1829, 1828, 1830, 1829, 1829, 1830,
-	1831, 1832, 1829, 1831, 1833, 1829, 1832, 1834, 1833, 1832, 1835, 1827, 1829, 1833, 1835, 1829,
-	1836, 1826, 1827, 1835, 1836, 1827, 1832, 1831, 1837, 1834, 1832, 1837, 1831, 1838, 1837, 1839,
-	1834, 1837, 1840, 1825, 1826, 1836, 1840, 1826, 1841, 1839, 1837, 1842, 1841, 1837, 1837, 1838,
-	1842, 1838, 1843, 1842, 1844, 1841, 1842, 1845, 1844, 1842, 1842, 1843, 1845, 1844, 1845, 1846,
-	1847, 1844, 1846, 1846, 1845, 1848, 1845, 1849, 1848, 1843, 1849, 1845, 1848, 1849, 1850, 1849,
-	1851, 1850, 1851, 1849, 1843, 1852, 1851, 1843, 1852, 1843, 1838, 1853, 1852, 1838, 1853, 1838,
-	1831, 1854, 1853, 1831, 1831, 1830, 1854, 1830, 1855, 1854, 1855, 1830, 1828, 1856, 1855, 1828,
-	1856, 1828, 1824, 1822, 1856, 1824, 1850, 1851, 1857, 1851, 1858, 1857, 1858, 1851, 1852, 1859,
-	1858, 1852, 1859, 1852, 1853, 1860, 1859, 1853, 1860, 1853, 1854, 1861, 1860, 1854, 1854, 1855,
-	1861, 1855, 1862, 1861, 1862, 1855, 1856, 1863, 1862, 1856, 1863, 1856, 1822, 1820, 1863, 1822,
-	1857, 1858, 1864, 1858, 1865, 1864, 1865, 1858, 1859, 1866, 1865, 1859, 1866, 1859, 1860, 1867,
-	1866, 1860, 1867, 1860, 1861, 1868, 1867, 1861, 1861, 1862, 1868, 1862, 1869, 1868, 1869, 1862,
-	1863, 1870, 1869, 1863, 1870, 1863, 1820, 1818, 1870, 1820, 1864, 1865, 1790, 1865, 1789, 1790,
-	1789, 1865, 1866, 1798, 1789, 1866, 1798, 1866, 1867, 1800, 1798, 1867, 1800, 1867, 1868, 1804,
-	1800, 1868, 1868, 1869, 1804, 1869, 1803, 1804, 1803, 1869, 1870, 1806, 1803, 1870, 1806, 1870,
-	1818, 1808, 1806, 1818, 1864, 1790, 1871, 1872, 1864, 1871, 1871, 1873, 1872, 1871, 1874, 1873,
-	1871, 1790, 1874, 1874, 1875, 1873, 1874, 1876, 1875, 1876, 1877, 1875, 1878, 1877, 1876, 1879,
-	1878, 1876, 1880, 1878, 1879, 1881, 1880, 1879, 1882, 1880, 1881, 1883, 1882, 1881, 1873, 1884,
-	1872, 1872, 1884, 1885, 1884, 1886, 1885, 1885, 1886, 1887, 1886, 1888, 1887, 1887, 1888, 1889,
-	1888, 1890, 1889, 1889, 1890, 1891, 1892, 1889, 1891, 1893, 1892, 1891, 1894, 1893, 1891, 1895,
-	1882, 1883, 1896, 1895, 1883, 1897, 1895, 1896, 1898, 1897, 1896, 1899, 1897, 1898, 1900, 1899,
-	1898, 1901, 1899, 1900, 1902, 1901, 1900, 1903, 1901, 1902, 1904, 1903, 1902, 1905, 1903, 1904,
-	1906, 1905, 1904, 1898, 1896, 1907, 1908, 1898, 1907, 1908, 1907, 1909, 1910, 1908, 1909, 1911,
-	1908, 1910, 1898, 1908, 1911, 1900, 1898, 1911, 1912, 1911, 1910, 1913, 1911, 1912, 1900, 1911,
-	1913, 1902, 1900, 1913, 1914, 1913, 1912, 1915, 1913, 1914, 1902, 1913, 1915, 1904, 1902, 1915,
-	1916, 1915, 1914, 1917, 1915, 1916, 1904, 1915, 1917, 1906, 1904, 1917, 1918, 1917, 1916, 1916,
-	1914, 1919, 1914, 1920, 1919, 1919, 1920, 1825, 1920, 1823, 1825, 1919, 1825, 1840, 1921, 1919,
-	1840, 1916, 1919, 1921, 1918, 1916, 1921, 1821, 1823, 1920, 1922, 1821, 1920, 1922, 1920, 1914,
-	1912, 1922, 1914, 1819, 1821, 1922, 1923, 1819, 1922, 1923, 1922, 1912, 1910, 1923, 1912, 1817,
-	1819, 1923, 1924, 1817, 1923, 1924, 1923, 1910, 1909, 1924, 1910, 1811, 1817, 1924, 1816, 1811,
-	1924, 1816, 1924, 1909, 1796, 1816, 1909, 1909, 1907, 1796, 1907, 1795, 1796, 1883, 1795, 1907,
-	1883, 1881, 1795, 1881, 1794, 1795, 1881, 1879, 1794, 1879, 1791, 1794, 1879, 1876, 1791, 1876,
-	1786, 1791, 1786, 1876, 1874, 1785, 1786, 1874, 1790, 1785, 1874, 1896, 1883, 1907, 1927, 1926,
-	1925, 1928, 1927, 1925, 1925, 1926, 1929, 1930, 1925, 1929, 1928, 1925, 1931, 1931, 1925, 1930,
-	1932, 1928, 1931, 1933, 1931, 1930, 1932, 1931, 1934, 1934, 1931, 1933, 1935, 1932, 1934, 1936,
-	1935, 1934, 1937, 1936, 1934, 1938, 1937, 1934, 1939, 1938, 1934, 1939, 1934, 1940, 1940, 1934,
-	1933, 1941, 1939, 1940, 1942, 1927, 1928, 1943, 1942, 1928, 1943, 1928, 1932, 1944, 1943, 1932,
-	1944, 1932, 1935, 1945, 1944, 1935, 1945, 1935, 1936, 1946, 1945, 1936, 1940, 1933, 1947, 1941,
-	1940, 1947, 1933, 1948, 1947, 1947, 1948, 1949, 1948, 1950, 1949, 1949, 1950, 1951, 1950, 1952,
-	1951, 1950, 1953, 1952, 1953, 1954, 1952, 1953, 1955, 1954, 1955, 1956, 1954, 1957, 1949, 1951,
-	1958, 1957, 1951, 1959, 1955, 1953, 1960, 1959, 1953, 1960, 1953, 1950, 1948, 1960, 1950, 1961,
-	1947, 1949, 1957, 1961, 1949, 1929, 1959, 1960, 1930, 1929, 1960, 1930, 1960, 1948, 1933, 1930,
-	1948, 1962, 1961, 1957, 1962, 1963, 1961, 1963, 1941, 1961, 1961, 1941, 1947, 1963, 1964, 1941,
-	1964, 1939, 1941, 1964, 1965, 1939, 1965, 1938, 1939, 1966, 1962, 1957, 1966, 1957, 1958, 1965,
-	1964, 1967, 1967, 1964, 1963, 1968, 1965, 1967, 1968, 1967, 1969, 1967, 1970, 1969, 1969, 1970,
-	1971, 1970, 1972, 1971, 1971, 1972, 1973, 1972, 1974, 1973, 1974, 1972, 1975, 1976, 1974, 1975,
-	1975, 1966, 1976, 1972, 1970, 1977, 1975, 1972, 1977, 1970, 1967, 1978, 1977, 1970, 1978, 1978,
-	1967, 1963, 1978, 1963, 1977, 1963, 1962, 1977, 1962, 1966, 1975, 1977, 1962, 1975, 1966, 1979,
-	1976, 1979, 1966, 1958, 1979, 1958, 95, 1958, 93, 95, 1958, 1951, 93, 1951, 91, 93,
-	1951, 1952, 91, 1952, 89, 91, 1952, 1954, 89, 1954, 87, 89, 1954, 1956, 87, 1956,
-	86, 87, 1979, 95, 97, 1976, 1979, 97, 1976, 97, 99, 1974, 1976, 99, 1974, 99,
-	1973, 99, 100, 1973, 1973, 100, 103, 1971, 1973, 103, 106, 1971, 103, 1969, 1971, 106,
-	108, 1969, 106, 1968, 1969, 108, 110, 1968, 108, 110, 112, 1968, 112, 1965, 1968, 112,
-	114, 1965, 114, 1938, 1965, 114, 116, 1938, 116, 1937, 1938, 116, 118, 1937, 118, 1936,
-	1937, 1946, 1936, 118, 120, 1946, 118, 1980, 1946, 120, 1980, 1981, 1946, 1982, 1981, 1980,
-	1983, 1982, 1980, 1982, 1984, 1981, 1984, 1985, 1981, 1984, 1986, 1985, 1986, 1987, 1985, 1986,
-	1988, 1987, 1988, 1989, 1987, 1990, 1988, 1986, 1991, 1990, 1986, 1991, 1986, 1984, 1992, 1991,
-	1984, 1992, 1984, 1982, 1993, 1992, 1982, 1993, 1982, 1983, 1994, 1993, 1983, 1995, 1993, 1994,
-	1996, 1995, 1994, 1997, 1992, 1993, 1995, 1997, 1993, 1998, 1991, 1992, 1997, 1998, 1992, 1999,
-	1990, 1991, 1998, 1999, 1991, 2000, 1995, 1996, 2001, 2000, 1996, 2002, 2000, 2001, 2003, 2002,
-	2001, 2002, 2004, 2000, 2004, 2005, 2000, 2005, 1997, 1995, 2000, 2005, 1995, 2004, 2006, 2005,
-	2006, 2007, 2005, 2007, 1998, 1997, 2005, 2007, 1997, 2006, 2008, 2007, 2008, 2009, 2007, 2009,
-	1999, 1998, 2007, 2009, 1998, 2010, 2004, 2002, 2011, 2010, 2002, 2012, 2008, 2006, 2013, 2012,
-	2006, 2013, 2006, 2004, 2010, 2013, 2004, 2003, 2001, 2014, 2015, 2003, 2014, 2016, 2015, 2014,
-	2017, 2016, 2014, 2017, 2014, 2018, 2019, 2017, 2018, 2019, 2018, 2020, 2021, 2019, 2020, 2021,
-	2020, 2022, 2023, 2021, 2022, 2023, 2022, 2024, 2025, 2023, 2024, 2026, 2016, 2017, 2027, 2026,
-	2017, 2027, 2017, 2019, 2028, 2026, 2027, 2029, 2028, 2027, 2029, 2027, 2030, 2030, 2027, 2019,
-	2030, 2019, 2021, 2031, 2029, 2030, 2031, 2030, 2032, 2032, 2030, 2021, 2032, 2021, 2023, 2033,
-	2031, 2032, 2033, 2032, 2034, 2034, 2032, 2023, 2034, 2023, 2025, 2035, 2033, 2034, 2035, 2034,
-	2036, 2036, 2034, 2025, 2037, 2035, 2036, 2038, 2028, 2029, 2039, 2038, 2029, 2039, 2029, 2031,
-	2040, 2039, 2031, 2040, 2031, 2033, 2041, 2040, 2033, 2041, 2033, 2035, 2042, 2041, 2035, 2042,
-	2035, 2037, 2043, 2042, 2037, 2044, 2028, 2038, 2045, 2044, 2038, 2037, 2036, 123, 2036, 121,
-	123, 2036, 2025, 121, 2025, 119, 121, 2025, 2024, 119, 2024, 120, 119, 2024, 1980, 120,
-	1983, 1980, 2024, 2022, 1983, 2024, 1994, 1983, 2022, 2020, 1994, 2022, 1996, 1994, 2020, 2018,
-	1996, 2020, 2001, 1996, 2018, 2014, 2001, 2018, 2046, 123, 124, 2047, 2046, 124, 2047, 124,
-	126, 2048, 2047, 126, 2048, 126, 128, 2049, 2048, 128, 2049, 128, 130, 2050, 2049, 130,
-	2050, 130, 132, 2051, 2050, 132, 2051, 132, 134, 2052, 2051, 134, 2052, 134, 136, 2053,
-	2052, 136, 2053, 136, 138, 2054, 2053, 138, 2054, 138, 140, 2055, 2054, 140, 2055, 140,
-	142, 2056, 2055, 142, 2056, 142, 144, 2057, 2056, 144, 2057, 144, 146, 2058, 2057, 146,
-	2058, 146, 148, 2059, 2058, 148, 2059, 148, 150, 2060, 2059, 150, 2060, 150, 152, 2061,
-	2060, 152, 2061, 152, 154, 2062, 2061, 154, 2062, 154, 156, 2063, 2062, 156, 2063, 156,
-	158, 2064, 2063, 158, 2064, 158, 160, 2065, 2064, 160, 2065, 160, 162, 2066, 2065, 162,
-	2066, 162, 164, 2067, 2066, 164, 2067, 164, 166, 2068, 2067, 166, 2068, 166, 168, 2069,
-	2068, 168, 2069, 168, 170, 2070, 2069, 170, 2070, 170, 172, 2071, 2070, 172, 2071, 172,
-	174, 2072, 2071, 174, 2072, 174, 176, 2073, 2072, 176, 2073, 176, 178, 2074, 2073, 178,
-	2074, 178, 180, 2075, 2074, 180, 2075, 180, 182, 2076, 2075, 182, 2076, 182, 184, 2077,
-	2076, 184, 2077, 184, 186, 2078, 2077, 186, 2078, 186, 1237, 186, 1236, 1237, 186, 185,
-	1236, 185, 1235, 1236, 185, 214, 1235, 185, 183, 214, 183, 212, 214, 183, 181, 212,
-	181, 210, 212, 181, 179, 210, 179, 195, 210, 179, 177, 195, 177, 193, 195, 177,
-	175, 193, 175, 191, 193, 175, 173, 191, 173, 187, 191, 214, 1231, 1235, 214, 213,
-	1231, 213, 1230, 1231, 2081, 2080, 2079, 2082, 2081, 2079, 2079, 2080, 2083, 2080, 2084, 2083,
-	2085, 2080, 2081, 2086, 2085, 2081, 2085, 2087, 2080, 2087, 2088, 2080, 2084, 2080, 2088, 2089,
-	2084, 2088, 2082, 2079, 2090, 2091, 2082, 2090, 2079, 2083, 2092, 2090, 2079, 2092, 2087, 2093,
-	2088, 2093, 2094, 2088, 2093, 2095, 2094, 2095, 2096, 2094, 2094, 2096, 2097, 2098, 2094, 2097,
-	2088, 2094, 2098, 2089, 2088, 2098, 2095, 2099, 2096, 2099, 2100, 2096, 2096, 2100, 2101, 2097,
-	2096, 2101, 2099, 2102, 2100, 2102, 2103, 2100, 2102, 2104, 2103, 2104, 2105, 2103, 2103, 2105,
-	2106, 2107, 2103, 2106, 2100, 2103, 2107, 2101, 2100, 2107, 2104, 2108, 2105, 2108, 2109, 2105,
-	2108, 2110, 2109, 2110, 2111, 2109, 2109, 2111, 2112, 2113, 2109, 2112, 2105, 2109, 2113, 2106,
-	2105, 2113, 2110, 2114, 2111, 2114, 2115, 2111, 2111, 2115, 2116, 2112, 2111, 2116, 2114, 2117,
-	2115, 2117, 2118, 2115, 2117, 2119, 2118, 2119, 2120, 2118, 2121, 2118, 2120, 2115, 2118, 2121,
-	2116, 2115, 2121, 2122, 2121, 2120, 2119, 2123, 2120, 2123, 2124, 2120, 2123, 2125, 2124, 2125,
-	2126, 2124, 2125, 2127, 2126, 2127, 2128, 2126, 2126, 2128, 2129, 2128, 2130, 2129, 2131, 2124,
-	2126, 2129, 2131, 2126, 2120, 2124, 2131, 2122, 2120, 2131, 2132, 2130, 2128, 2133, 2132, 2128,
-	2133, 2128, 2127, 2134, 2133, 2127, 2133, 2134, 2135, 2134, 2136, 2135, 2135, 2136, 2137, 2136,
-	2138, 2137, 2138, 2139, 2137, 2139, 2140, 2137, 2140, 2141, 2137, 2141, 2142, 2137, 2137, 2142,
-	2135, 2142, 2143, 2135, 2143, 2132, 2133, 2135, 2143, 2133, 2144, 2131, 2129, 2122, 2131, 2144,
-	2145, 2122, 2144, 2145, 2146, 2122, 2146, 2121, 2122, 2116, 2121, 2146, 2147, 2116, 2146, 2112,
-	2116, 2147, 2148, 2112, 2147, 2113, 2112, 2148, 2149, 2113, 2148, 2106, 2113, 2149, 2150, 2106,
-	2149, 2107, 2106, 2150, 2151, 2107, 2150, 2101, 2107, 2151, 2152, 2101, 2151, 2097, 2101, 2152,
-	2153, 2097, 2152, 2098, 2097, 2153, 2154, 2098, 2153, 2089, 2098, 2154, 2155, 2089, 2154, 2155,
-	2156, 2089, 2156, 2084, 2089, 2084, 2156, 2157, 2083, 2084, 2157, 2083, 2157, 2158, 2092, 2083,
-	2158, 2092, 2158, 2159, 2160, 2092, 2159, 2090, 2092, 2160, 2161, 2090, 2160, 2161, 2160, 2162,
-	2163, 2161, 2162, 2164, 2161, 2163, 2165, 2164, 2163, 2165, 2163, 2166, 2167, 2165, 2166, 2163,
-	2162, 2168, 2166, 2163, 2168, 2166, 2168, 2169, 2168, 2170, 2169, 2166, 2169, 2171, 2167, 2166,
-	2171, 2169, 2170, 2172, 2170, 2173, 2172, 2172, 2173, 2174, 2175, 2172, 2174, 2176, 2172, 2175,
-	2169, 2172, 2176, 2171, 2169, 2176, 2177, 2176, 2175, 2178, 2177, 2175, 2179, 2178, 2175, 2179,
-	2175, 2174, 2180, 2179, 2174, 2181, 2165, 2167, 2182, 2181, 2167, 2183, 2181, 2182, 2183, 2184,
-	2181, 2184, 2185, 2181, 2186, 2183, 2182, 2186, 2182, 2187, 2182, 2188, 2187, 2187, 2188, 2189,
-	2188, 2190, 2189, 2190, 2176, 2177, 2189, 2190, 2191, 2191, 2190, 2177, 2191, 2177, 2178, 2192,
-	2189, 2191, 2193, 2192, 2191, 2194, 2193, 2191, 2195, 2184, 2183, 2196, 2195, 2183, 2196, 2183,
-	2186, 2197, 2195, 2196, 2198, 2197, 2196, 2198, 2196, 2199, 2199, 2196, 2186, 2200, 2198, 2199,
-	2200, 2199, 2201, 2199, 2202, 2201, 2201, 2202, 2203, 2202, 2204, 2203, 2204, 2189, 2192, 2203,
-	2204, 2205, 2205, 2204, 2192, 2205, 2192, 2193, 2206, 2203, 2205, 2207, 2206, 2205, 2208, 2207,
-	2205, 2208, 2205, 2193, 2199, 2186, 2202, 2186, 2187, 2202, 2202, 2187, 2204, 2187, 2189, 2204,
-	2207, 2209, 2206, 2209, 2210, 2206, 2209, 2211, 2210, 2211, 2212, 2210, 2212, 2213, 2210, 2213,
-	2214, 2210, 2214, 2203, 2206, 2210, 2214, 2206, 2215, 2214, 2213, 2203, 2214, 2215, 2216, 2215,
-	2213, 2217, 2215, 2216, 2218, 2217, 2216, 2218, 2219, 2217, 2219, 2220, 2217, 2219, 2221, 2220,
-	2221, 2222, 2220, 2221, 2223, 2222, 2223, 2224, 2222, 2223, 2225, 2224, 2225, 2226, 2224, 2225,
-	2227, 2226, 2227, 2228, 2226, 2229, 2228, 2227, 2230, 2229, 2227, 2231, 2227, 2225, 2232, 2231,
-	2225, 2232, 2225, 2223, 2233, 2231, 2232, 2234, 2233, 2232, 2235, 2231, 2233, 2227, 2231, 2235,
-	2230, 2227, 2235, 2236, 2235, 2233, 2237, 2233, 2234, 2236, 2233, 2237, 2238, 2237, 2234, 2239,
-	2236, 2237, 2238, 2234, 2240, 2241, 2238, 2240, 2234, 2232, 2242, 2240, 2234, 2242, 2243, 2239,
-	2237, 2244, 2243, 2237, 2244, 2237, 2238, 2245, 2244, 2238, 2245, 2238, 2241, 2246, 2245, 2241,
-	2247, 2245, 2246, 2248, 2247, 2246, 2249, 2247, 2248, 2249, 2250, 2247, 2251, 2250, 2249, 2252,
-	2251, 2249, 2252, 2249, 2253, 2253, 2249, 2248, 2254, 2252, 2253, 2250, 2251, 2255, 2256, 2250,
-	2255, 2250, 2256, 2247, 2256, 2244, 2245, 2247, 2256, 2245, 2256, 2255, 2243, 2244, 2256, 2243,
-	2254, 2253, 2257, 2258, 2254, 2257, 2258, 2257, 2259, 2260, 2258, 2259, 2260, 2259, 2261, 2262,
-	2260, 2261, 2262, 2261, 2263, 2264, 2262, 2263, 2264, 2263, 2265, 2266, 2264, 2265, 2266, 2265,
-	2267, 2268, 2266, 2267, 2259, 2257, 2269, 2257, 2270, 2269, 2259, 2269, 2271, 2261, 2259, 2271,
-	2261, 2271, 2263, 2271, 2272, 2263, 2263, 2272, 2265, 2272, 2273, 2265, 2265, 2273, 2274, 2267,
-	2265, 2274, 2267, 2274, 2275, 2268, 2267, 2275, 2274, 2273, 2276, 2275, 2274, 2276, 2273, 2277,
-	2276, 2277, 2273, 2272, 2276, 2277, 2278, 2277, 2279, 2278, 2278, 2279, 2280, 2279, 2281, 2280,
-	2280, 2281, 2282, 2283, 2280, 2282, 2284, 2283, 2282, 2281, 2285, 2282, 2286, 2278, 2280, 2283,
-	2286, 2280, 2276, 2278, 2286, 2287, 2285, 2281, 2288, 2287, 2281, 2288, 2281, 2279, 2289, 2287,
-	2288, 2290, 2289, 2288, 2290, 2291, 2289, 2292, 2291, 2290, 2292, 2293, 2291, 2293, 2294, 2291,
-	2291, 2294, 2295, 2291, 2295, 2289, 2294, 2296, 2295, 2297, 2292, 2290, 2290, 2288, 2298, 2297,
-	2290, 2298, 2298, 2288, 2279, 2299, 2293, 2292, 2300, 2299, 2292, 2300, 2292, 2297, 2301, 2300,
-	2297, 2297, 2298, 2302, 2301, 2297, 2302, 2298, 2279, 2277, 2302, 2298, 2277, 2302, 2277, 2272,
-	2302, 2272, 2271, 2301, 2302, 2271, 2269, 2300, 2301, 2271, 2269, 2301, 2270, 2299, 2300, 2269,
-	2270, 2300, 2270, 2248, 2299, 2253, 2248, 2270, 2257, 2253, 2270, 2248, 2246, 2299, 2299, 2246,
-	2293, 2246, 2241, 2293, 2293, 2241, 2294, 2241, 2240, 2294, 2294, 2240, 2296, 2240, 2242, 2296,
-	2296, 2242, 2221, 2296, 2221, 2219, 2295, 2296, 2219, 2295, 2219, 2218, 2289, 2295, 2218, 2218,
-	2216, 2289, 2216, 2287, 2289, 2216, 2213, 2287, 2213, 2285, 2287, 2285, 2213, 2212, 2282, 2285,
-	2212, 2284, 2282, 2212, 2211, 2284, 2212, 2242, 2223, 2221, 2242, 2232, 2223, 2305, 2304, 2303,
-	2306, 2305, 2303, 2303, 2304, 412, 2304, 2307, 412, 2303, 412, 414, 2303, 414, 2308, 2306,
-	2303, 2308, 2308, 414, 423, 412, 2307, 410, 2307, 2309, 410, 410, 2309, 408, 2309, 2310,
-	408, 408, 2310, 406, 2310, 2311, 406, 406, 2311, 377, 2311, 376, 377, 2312, 376, 2311,
-	2312, 2313, 376, 2312, 2314, 2313, 2314, 2315, 2313, 2313, 2315, 2316, 2315, 2317, 2316, 2316,
-	2317, 2318, 2319, 2316, 2318, 2319, 2318, 2320, 2318, 2321, 2320, 2320, 2321, 2322, 2321, 2323,
-	2322, 2322, 2323, 2324, 2325, 2322, 2324, 2325, 2324, 2326, 2327, 2325, 2326, 2327, 2326, 2328,
-	2326, 2329, 2328, 2328, 2329, 2330, 2329, 2331, 2330, 2330, 2331, 2332, 2331, 2333, 2332, 2332,
-	2333, 2334, 2333, 2335, 2334, 2334, 2335, 2336, 2337, 2334, 2336, 2338, 2337, 2336, 2339, 2338,
-	2336, 2338, 445, 2337, 445, 444, 2337, 2337, 444, 2334, 444, 446, 2334, 2334, 446, 2332,
-	446, 448, 2332, 2332, 448, 2330, 448, 471, 2330, 2330, 471, 2328, 471, 472, 2328, 2328,
-	472, 2327, 472, 366, 2327, 2327, 366, 2325, 366, 362, 2325, 362, 363, 2325, 363, 2322,
-	2325, 2322, 363, 369, 2320, 2322, 369, 2320, 369, 370, 2319, 2320, 370, 370, 373, 2319,
-	373, 2316, 2319, 2316, 373, 374, 2313, 2316, 374, 2313, 374, 376, 2342, 2341, 2340, 2343,
-	2342, 2340, 2340, 2341, 2344, 2341, 2345, 2344, 2340, 2344, 2346, 2344, 2347, 2346, 2346, 2347,
-	2348, 2347, 2349, 2348, 2348, 2349, 2350, 2351, 2348, 2350, 2352, 2348, 2351, 2346, 2348, 2352,
-	2353, 2352, 2351, 2354, 2346, 2352, 2340, 2346, 2354, 2343, 2340, 2354, 2355, 2345, 2341, 2356,
-	2355, 2341, 2356, 2341, 2342, 2356, 2357, 2355, 2358, 2357, 2356, 2359, 2358, 2356, 2357, 2360,
-	2355, 2359, 2356, 2342, 2358, 2361, 2357, 2361, 2362, 2357, 2357, 2362, 2360, 2361, 2363, 2362,
-	2363, 2364, 2362, 2362, 2364, 2365, 2362, 2365, 2360, 2364, 2366, 2365, 2364, 2363, 2367, 2363,
-	2368, 2367, 2367, 2368, 2369, 2368, 2370, 2369, 2370, 2371, 2369, 2371, 2372, 2369, 2372, 2373,
-	2369, 2373, 2374, 2369, 2369, 2374, 2367, 2374, 2375, 2367, 2375, 2366, 2364, 2367, 2375, 2364,
-	2365, 2366, 2376, 2365, 2376, 2377, 2360, 2365, 2377, 2360, 2377, 2378, 2355, 2360, 2378, 2378,
-	2379, 2355, 2379, 2345, 2355, 2345, 2379, 2380, 2344, 2345, 2380, 2380, 2381, 2344, 2381, 2347,
-	2344, 2381, 2382, 2347, 2382, 2349, 2347, 2349, 2382, 2383, 2350, 2349, 2383, 2383, 2382, 2384,
-	2382, 2385, 2384, 2385, 2382, 2381, 2386, 2385, 2381, 2386, 2381, 2380, 2387, 2386, 2380, 2380,
-	2379, 2387, 2379, 2388, 2387, 2388, 2379, 2378, 2389, 2388, 2378, 2378, 2377, 2389, 2377, 2390,
-	2389, 2377, 2376, 2390, 2376, 2391, 2390, 2376, 2392, 2391, 2366, 2392, 2376, 2392, 2366, 2375,
-	2393, 2392, 2375, 2393, 2375, 2374, 2394, 2393, 2374, 2394, 2374, 2373, 2395, 2394, 2373, 2392,
-	2396, 2391, 2396, 2392, 2393, 2397, 2396, 2393, 2397, 2393, 2394, 2398, 2397, 2394, 2398, 2394,
-	2395, 2399, 2398, 2395, 2390, 2391, 2400, 2390, 2400, 2401, 2389, 2390, 2401, 2401, 2402, 2389,
-	2402, 2388, 2389, 2388, 2402, 2403, 2387, 2388, 2403, 2403, 2404, 2387, 2404, 2386, 2387, 2404,
-	2405, 2386, 2405, 2385, 2386, 2385, 2405, 2406, 2384, 2385, 2406, 2407, 2398, 2399, 2408, 2407,
-	2399, 2406, 2405, 981, 2405, 980, 981, 980, 2405, 2404, 986, 980, 2404, 986, 2404, 2403,
-	997, 986, 2403, 2403, 2402, 997, 2402, 998, 997, 998, 2402, 2401, 508, 998, 2401, 2401,
-	2400, 508, 2400, 507, 508, 2400, 2409, 507, 2391, 2409, 2400, 2391, 2396, 2409, 2396, 2410,
-	2409, 2410, 2396, 2397, 2411, 2410, 2397, 2411, 2397, 2398, 2407, 2411, 2398, 2409, 722, 507,
-	2409, 2410, 722, 507, 722, 504, 722, 720, 504, 720, 719, 504, 719, 506, 504, 506,
-	719, 716, 510, 506, 716, 510, 716, 715, 512, 510, 715, 512, 715, 714, 514, 512,
-	714, 2410, 723, 722, 723, 2410, 2411, 725, 723, 2411, 725, 2411, 2407, 727, 725, 2407,
-	514, 714, 705, 714, 704, 705, 704, 714, 711, 705, 706, 514, 706, 513, 514, 513,
-	706, 707, 521, 513, 707, 521, 707, 708, 536, 521, 708, 536, 708, 537, 708, 709,
-	537, 537, 709, 584, 537, 584, 581, 535, 537, 581, 535, 581, 579, 533, 535, 579,
-	533, 579, 577, 531, 533, 577, 531, 577, 575, 529, 531, 575, 529, 575, 573, 527,
-	529, 573, 527, 573, 571, 525, 527, 571, 525, 571, 569, 524, 525, 569, 524, 569,
-	567, 538, 524, 567, 538, 567, 565, 540, 538, 565, 540, 565, 563, 542, 540, 563,
-	542, 563, 558, 544, 542, 558, 2414, 2413, 2412, 2415, 2414, 2412, 2412, 2413, 2416, 2413,
-	2417, 2416, 2414, 2415, 2418, 2415, 2419, 2418, 2414, 2418, 2420, 2418, 2421, 2420, 2422, 2417,
-	2413, 2423, 2422, 2413, 2423, 2413, 2414, 2420, 2423, 2414, 2424, 2422, 2423, 2425, 2424, 2423,
-	2425, 2423, 2420, 2426, 2425, 2420, 2420, 2421, 2426, 2427, 2424, 2425, 2428, 2427, 2425, 2428,
-	2425, 2426, 2429, 2428, 2426, 2426, 2430, 2429, 2421, 2430, 2426, 2430, 2431, 2429, 2429, 2431,
-	2432, 2431, 2433, 2432, 2432, 2433, 2434, 2433, 2435, 2434, 2434, 2435, 2436, 2435, 2437, 2436,
-	2438, 2427, 2428, 2439, 2438, 2428, 2439, 2428, 2429, 2432, 2439, 2429, 2436, 2437, 2440, 2441,
-	2436, 2440, 2441, 2440, 2442, 2443, 2441, 2442, 2443, 2442, 2444, 2445, 2443, 2444, 2445, 2444,
-	2446, 2444, 2447, 2446, 2446, 2447, 2448, 2447, 2449, 2448, 2450, 2446, 2448, 2445, 2446, 2450,
-	2451, 2450, 2448, 2452, 2451, 2448, 2453, 2452, 2448, 2453, 2448, 2449, 2452, 2453, 2454, 2453,
-	2455, 2454, 2455, 2453, 2449, 2455, 2456, 2454, 2454, 2456, 2457, 2458, 2454, 2457, 2454, 2458,
-	2459, 2458, 2460, 2459, 2461, 2454, 2459, 2461, 2452, 2454, 2462, 2461, 2459, 2462, 2459, 2463,
-	2459, 2460, 2463, 2464, 2462, 2463, 2460, 2465, 2463, 2457, 2456, 2466, 2456, 2467, 2466, 2467,
-	2456, 2455, 2468, 2467, 2455, 2468, 2455, 2469, 2455, 2449, 2469, 2469, 2449, 2447, 2470, 2469,
-	2447, 2470, 2447, 2444, 2471, 2470, 2444, 2444, 2442, 2471, 2442, 2472, 2471, 2442, 2440, 2472,
-	2440, 2473, 2472, 2440, 2437, 2473, 2437, 2474, 2473, 2474, 2437, 2435, 2475, 2474, 2435, 2475,
-	2435, 2433, 2476, 2475, 2433, 2476, 2433, 2431, 2477, 2476, 2431, 2477, 2431, 2430, 2478, 2477,
-	2430, 2478, 2430, 2421, 2479, 2478, 2421, 2479, 2421, 2418, 2480, 2479, 2418, 2418, 2419, 2480,
-	2419, 2481, 2480, 2482, 2481, 2419, 2483, 2482, 2419, 2483, 2419, 2415, 2484, 2483, 2415, 2484,
-	2415, 2485, 2415, 2412, 2485, 2485, 2412, 2486, 2412, 2416, 2486, 2486, 2416, 2487, 2487, 2416,
-	2488, 2488, 2489, 2487, 2490, 2489, 2488, 2490, 2491, 2489, 2491, 2492, 2489, 2489, 2492, 2493,
-	2494, 2489, 2493, 2489, 2494, 2487, 2493, 2492, 2495, 2492, 2496, 2495, 2497, 2492, 2491, 2498,
-	2497, 2491, 2498, 2491, 2499, 2499, 2491, 2490, 2500, 2498, 2499, 2500, 2499, 2501, 2502, 2500,
-	2501, 2502, 2501, 2503, 2504, 2502, 2503, 2504, 2503, 2505, 2506, 2504, 2505, 2506, 2505, 2507,
-	2508, 2506, 2507, 2508, 2507, 2509, 2510, 2508, 2509, 2510, 2509, 2511, 2512, 2510, 2511, 2512,
-	2511, 2513, 2514, 2512, 2513, 2514, 2513, 2515, 2516, 2514, 2515, 2516, 2515, 2517, 2518, 2516,
-	2517, 2518, 2517, 2519, 2520, 2518, 2519, 2520, 2519, 2521, 2522, 2520, 2521, 2522, 2521, 2523,
-	2524, 2522, 2523, 2524, 2523, 2525, 2523, 2526, 2525, 2526, 2523, 2521, 2526, 2527, 2525, 2528,
-	2524, 2525, 2529, 2527, 2526, 2530, 2529, 2526, 2531, 2529, 2530, 2532, 2531, 2530, 2531, 2532,
-	2533, 2534, 2531, 2533, 2535, 2524, 2528, 2536, 2535, 2528, 2537, 2535, 2536, 2538, 2537, 2536,
-	2537, 2539, 2535, 2539, 2540, 2535, 2539, 2541, 2540, 2541, 2542, 2540, 2541, 2543, 2542, 2543,
-	2544, 2542, 2543, 2545, 2544, 2545, 2546, 2544, 2547, 2546, 2545, 2548, 2547, 2545, 2549, 2547,
-	2548, 2550, 2549, 2548, 2551, 2549, 2550, 2552, 2551, 2550, 2553, 2551, 2552, 2554, 2553, 2552,
-	2555, 2553, 2554, 2556, 2555, 2554, 2557, 2555, 2556, 2558, 2557, 2556, 2559, 2557, 2558, 2560,
-	2559, 2558, 2561, 2559, 2560, 2562, 2561, 2560, 2563, 2561, 2562, 2564, 2563, 2562, 2565, 2563,
-	2564, 2566, 2565, 2564, 2560, 2558, 2567, 2558, 2568, 2567, 2558, 2556, 2568, 2567, 2568, 2569,
-	2560, 2567, 2569, 2562, 2560, 2569, 2568, 2570, 2569, 2569, 2570, 2571, 2562, 2569, 2571, 2564,
-	2562, 2571, 2570, 2572, 2571, 2571, 2572, 2573, 2564, 2571, 2573, 2566, 2564, 2573, 2572, 2574,
-	2573, 2572, 2575, 2574, 2575, 2576, 2574, 2575, 2577, 2576, 2577, 2578, 2576, 2579, 2578, 2577,
-	2578, 2579, 2580, 2579, 2581, 2580, 2582, 2579, 2577, 2582, 2583, 2579, 2583, 2584, 2579, 2583,
-	2585, 2584, 2585, 2586, 2584, 2585, 2587, 2586, 2587, 2588, 2586, 2587, 2589, 2588, 2589, 2590,
-	2588, 2588, 2590, 2591, 2590, 2592, 2591, 2589, 2593, 2590, 2593, 2594, 2590, 2593, 2595, 2594,
-	2595, 2596, 2594, 2595, 2597, 2596, 2597, 2598, 2596, 2598, 2597, 2599, 2597, 2600, 2599, 2601,
-	2600, 2597, 2602, 2601, 2597, 2602, 2597, 2595, 2603, 2602, 2595, 2603, 2595, 2593, 2604, 2603,
-	2593, 2604, 2593, 2589, 2605, 2604, 2589, 2606, 2601, 2602, 2607, 2606, 2602, 2607, 2602, 2603,
-	2608, 2607, 2603, 2608, 2603, 2604, 2609, 2608, 2604, 2609, 2604, 2605, 2610, 2609, 2605, 2610,
-	2605, 2611, 2611, 2605, 2587, 2605, 2589, 2587, 2611, 2587, 2585, 2612, 2611, 2585, 2612, 2585,
-	2583, 2613, 2612, 2583, 2613, 2583, 2582, 2614, 2613, 2582, 2614, 2582, 2615, 2582, 2577, 2615,
-	2615, 2577, 2575, 2616, 2615, 2575, 2616, 2575, 2572, 2570, 2616, 2572, 2617, 2610, 2611, 2617,
-	2611, 2612, 2618, 2617, 2612, 2618, 2612, 2613, 2619, 2618, 2613, 2619, 2613, 2614, 2620, 2619,
-	2614, 2614, 2615, 2621, 2620, 2614, 2621, 2621, 2615, 2616, 2622, 2621, 2616, 2622, 2616, 2570,
-	2568, 2622, 2570, 2550, 2619, 2620, 2552, 2550, 2620, 2552, 2620, 2621, 2556, 2622, 2568, 2545,
-	2617, 2618, 2545, 2543, 2617, 2543, 2610, 2617, 2543, 2541, 2610, 2541, 2609, 2610, 2541, 2539,
-	2609, 2539, 2608, 2609, 2539, 2537, 2608, 2537, 2607, 2608, 2537, 2538, 2607, 2538, 2606, 2607,
-	2556, 2554, 2622, 2554, 2552, 2621, 2554, 2621, 2622, 2623, 2606, 2538, 2623, 2624, 2606, 2624,
-	2601, 2606, 2624, 2625, 2601, 2625, 2600, 2601, 2600, 2625, 2626, 2599, 2600, 2626, 2627, 2623,
-	2538, 2627, 2538, 2628, 2538, 2536, 2628, 2628, 2536, 2629, 2536, 2528, 2629, 2629, 2528, 2630,
-	2528, 2525, 2630, 2525, 2527, 2630, 2527, 2631, 2630, 2631, 2527, 2529, 2632, 2631, 2529, 2632,
-	2529, 2531, 2633, 2632, 2531, 2633, 2531, 2534, 2634, 2633, 2534, 2634, 2534, 2635, 2635, 2534,
-	2636, 2635, 2636, 2637, 2638, 2635, 2637, 2637, 2639, 2638, 2639, 2640, 2638, 2639, 2641, 2640,
-	2641, 2642, 2640, 2534, 2533, 2636, 2636, 2533, 2643, 2643, 2533, 2644, 2533, 2532, 2644, 2644,
-	2532, 2645, 2532, 2530, 2645, 2645, 2530, 2646, 2530, 2526, 2646, 2646, 2526, 2521, 2646, 2521,
-	2519, 2647, 2646, 2519, 2645, 2646, 2647, 2647, 2519, 2517, 2648, 2647, 2517, 2648, 2517, 2515,
-	2649, 2648, 2515, 2649, 2515, 2513, 2650, 2649, 2513, 2650, 2513, 2511, 2651, 2650, 2511, 2651,
-	2511, 2509, 2652, 2651, 2509, 2653, 2647, 2648, 2653, 2645, 2647, 2654, 2653, 2648, 2654, 2648,
-	2649, 2655, 2654, 2649, 2655, 2649, 2650, 2656, 2655, 2650, 2656, 2650, 2651, 2657, 2656, 2651,
-	2657, 2651, 2652, 2658, 2657, 2652, 2644, 2645, 2653, 2659, 2644, 2653, 2659, 2653, 2654, 2660,
-	2659, 2654, 2660, 2654, 2655, 2661, 2660, 2655, 2661, 2655, 2656, 2662, 2661, 2656, 2662, 2656,
-	2657, 2663, 2662, 2657, 2663, 2657, 2658, 2664, 2663, 2658, 2643, 2644, 2659, 2665, 2643, 2659,
-	2665, 2659, 2660, 2666, 2665, 2660, 2666, 2660, 2661, 2667, 2666, 2661, 2667, 2661, 2662, 2668,
-	2667, 2662, 2668, 2662, 2663, 2669, 2668, 2663, 2669, 2663, 2664, 2670, 2669, 2664, 2671, 2643,
-	2665, 2671, 2636, 2643, 2672, 2671, 2665, 2672, 2665, 2666, 2673, 2672, 2666, 2673, 2666, 2667,
-	2674, 2673, 2667, 2674, 2667, 2668, 2675, 2674, 2668, 2675, 2668, 2669, 2676, 2675, 2669, 2676,
-	2669, 2670, 2677, 2676, 2670, 2637, 2636, 2671, 2678, 2637, 2671, 2678, 2671, 2672, 2679, 2678,
-	2672, 2679, 2672, 2673, 2680, 2679, 2673, 2680, 2673, 2674, 2681, 2680, 2674, 2681, 2674, 2675,
-	2682, 2681, 2675, 2682, 2675, 2676, 2683, 2682, 2676, 2683, 2676, 2677, 2684, 2683, 2677, 2685,
-	2678, 2679, 2637, 2678, 2685, 2686, 2685, 2679, 2686, 2679, 2680, 2687, 2685, 2686, 2688, 2687,
-	2686, 2688, 2686, 2689, 2689, 2686, 2680, 2689, 2680, 2681, 2690, 2688, 2689, 2690, 2689, 2691,
-	2691, 2689, 2681, 2691, 2681, 2682, 2692, 2690, 2691, 2692, 2691, 2693, 2693, 2691, 2682, 2693,
-	2682, 2683, 2694, 2692, 2693, 2694, 2693, 2695, 2695, 2693, 2683, 2695, 2683, 2684, 2696, 2694,
-	2695, 2696, 2695, 2697, 2697, 2695, 2684, 2698, 2696, 2697, 2699, 2685, 2687, 2700, 2699, 2687,
-	2685, 2699, 2639, 2639, 2637, 2685, 2699, 2641, 2639, 2696, 2698, 2701, 2698, 2702, 2701, 2701,
-	2702, 2703, 2701, 2703, 2704, 2705, 2701, 2704, 2696, 2701, 2705, 2694, 2696, 2705, 2702, 2706,
-	2703, 2705, 2704, 2707, 2708, 2705, 2707, 2708, 2707, 2709, 2710, 2708, 2709, 2694, 2705, 2708,
-	2692, 2694, 2708, 2692, 2708, 2710, 2690, 2692, 2710, 2711, 2709, 2707, 2712, 2711, 2707, 2712,
-	2707, 2704, 2713, 2703, 2706, 2714, 2713, 2706, 2715, 2704, 2703, 2713, 2715, 2703, 2715, 2712,
-	2704, 2710, 2716, 2690, 2716, 2688, 2690, 2716, 2717, 2688, 2717, 2687, 2688, 2717, 2718, 2687,
-	2718, 2700, 2687, 2711, 2719, 2709, 2720, 2718, 2717, 2721, 2720, 2717, 2721, 2717, 2716, 2722,
-	2720, 2721, 2723, 2722, 2721, 2723, 2721, 2724, 2719, 2723, 2724, 2724, 2721, 2716, 2719, 2724,
-	2709, 2724, 2716, 2710, 2709, 2724, 2710, 2725, 2700, 2718, 2725, 2726, 2700, 2727, 2726, 2725,
-	2728, 2727, 2725, 2727, 2729, 2726, 2729, 2730, 2726, 2729, 2731, 2730, 2731, 2732, 2730, 2731,
-	2733, 2732, 2733, 2734, 2732, 2728, 2725, 2735, 2736, 2728, 2735, 2736, 2735, 2737, 2738, 2736,
-	2737, 2738, 2737, 2739, 2740, 2738, 2739, 2741, 2738, 2740, 2742, 2741, 2740, 2743, 2741, 2742,
-	2743, 2744, 2741, 2744, 2745, 2741, 2745, 2736, 2738, 2741, 2745, 2738, 2744, 2746, 2745, 2746,
-	2747, 2745, 2745, 2747, 2736, 2746, 2748, 2747, 2748, 2749, 2747, 2748, 2750, 2749, 2750, 2751,
-	2749, 2750, 2752, 2751, 2752, 2753, 2751, 2752, 2754, 2753, 2754, 2755, 2753, 2756, 2743, 2742,
-	2753, 2755, 2731, 2755, 2733, 2731, 2753, 2731, 2729, 2751, 2753, 2729, 2751, 2729, 2727, 2749,
-	2751, 2727, 2749, 2727, 2728, 2747, 2749, 2728, 2747, 2728, 2736, 2757, 2754, 2752, 2758, 2757,
-	2752, 2758, 2752, 2750, 2759, 2758, 2750, 2759, 2750, 2748, 2760, 2759, 2748, 2760, 2748, 2746,
-	2761, 2760, 2746, 2761, 2746, 2744, 2762, 2761, 2744, 2762, 2744, 2743, 2763, 2762, 2743, 2763,
-	2743, 2756, 2764, 2763, 2756, 2764, 2756, 2765, 2766, 2764, 2765, 2766, 2765, 2767, 2767, 2765,
-	2768, 2765, 2769, 2768, 2765, 2756, 2769, 2767, 2768, 2770, 2771, 2767, 2770, 2768, 2769, 2772,
-	2769, 2773, 2772, 2772, 2773, 2774, 2772, 2774, 2775, 2776, 2772, 2775, 2768, 2772, 2776, 2770,
-	2768, 2776, 2773, 2777, 2774, 2778, 2766, 2767, 2778, 2767, 2771, 2779, 2778, 2771, 2774, 2777,
-	2780, 2777, 2781, 2780, 2780, 2781, 2782, 2783, 2780, 2782, 2784, 2780, 2783, 2774, 2780, 2784,
-	2775, 2774, 2784, 2785, 2784, 2783, 2785, 2786, 2784, 2786, 2787, 2784, 2786, 2785, 2788, 2785,
-	2789, 2788, 2788, 2789, 2790, 2789, 2791, 2790, 2791, 2792, 2790, 2792, 2793, 2790, 2790, 2793,
-	2794, 2788, 2790, 2794, 2793, 2795, 2794, 2796, 2788, 2794, 2786, 2788, 2796, 2797, 2796, 2794,
-	2798, 2797, 2794, 2798, 2794, 2795, 2797, 2798, 2799, 2798, 2800, 2799, 2800, 2798, 2795, 2800,
-	2801, 2799, 2802, 2797, 2799, 2803, 2801, 2800, 2804, 2803, 2800, 2805, 2803, 2804, 2806, 2805,
-	2804, 2806, 2807, 2805, 2806, 2808, 2807, 2806, 2804, 2808, 2808, 2809, 2807, 2807, 2809, 2810,
-	2811, 2810, 2809, 2812, 2811, 2809, 2812, 2809, 2808, 2813, 2811, 2812, 2814, 2813, 2812, 2815,
-	2807, 2810, 2807, 2815, 2816, 2807, 2816, 2805, 2815, 2817, 2816, 2814, 2812, 2818, 2818, 2812,
-	2808, 2819, 2814, 2818, 2804, 2820, 2808, 2808, 2820, 2821, 2818, 2808, 2821, 2818, 2821, 2822,
-	2819, 2818, 2822, 2804, 2800, 2820, 2800, 2795, 2820, 2820, 2795, 2793, 2821, 2820, 2793, 2821,
-	2793, 2792, 2822, 2821, 2792, 2823, 2814, 2819, 2824, 2823, 2819, 2824, 2819, 2822, 2824, 2825,
-	2823, 2825, 2826, 2823, 2827, 2825, 2824, 2828, 2827, 2824, 2828, 2824, 2822, 2828, 2822, 2792,
-	2829, 2827, 2828, 2830, 2829, 2828, 2830, 2828, 2792, 2831, 2829, 2830, 2832, 2831, 2830, 2830,
-	2792, 2791, 2832, 2830, 2791, 2791, 2789, 2832, 2789, 2833, 2832, 2832, 2833, 2831, 2789, 2785,
-	2833, 2785, 2783, 2833, 2833, 2783, 2834, 2833, 2834, 2831, 2783, 2782, 2834, 2834, 2782, 2719,
-	2782, 2723, 2719, 2782, 2781, 2723, 2781, 2722, 2723, 2739, 2722, 2781, 2739, 2737, 2722, 2737,
-	2720, 2722, 2737, 2735, 2720, 2735, 2718, 2720, 2735, 2725, 2718, 2777, 2739, 2781, 2740, 2739,
-	2777, 2773, 2740, 2777, 2742, 2740, 2773, 2769, 2742, 2773, 2756, 2742, 2769, 2834, 2719, 2711,
-	2831, 2834, 2711, 2831, 2711, 2712, 2829, 2831, 2712, 2829, 2712, 2715, 2827, 2829, 2715, 2827,
-	2715, 2713, 2825, 2827, 2713, 2825, 2713, 2714, 2826, 2825, 2714, 2714, 2835, 2826, 2835, 2836,
-	2826, 2826, 2836, 2823, 2836, 2837, 2823, 2823, 2837, 2814, 2837, 2813, 2814, 2838, 2835, 2714,
-	2706, 2838, 2714, 2838, 2706, 2702, 2839, 2838, 2702, 2839, 2702, 2698, 2840, 2839, 2698, 2841,
-	2838, 2839, 2838, 2841, 2835, 2842, 2841, 2839, 2842, 2839, 2840, 2843, 2842, 2840, 2844, 2840,
-	2698, 2697, 2844, 2698, 2845, 2843, 2840, 2844, 2845, 2840, 2846, 2845, 2844, 2847, 2846, 2844,
-	2847, 2844, 2697, 2846, 2847, 2848, 2848, 2847, 2677, 2848, 2677, 2670, 2849, 2848, 2670, 2847,
-	2684, 2677, 2684, 2847, 2697, 2850, 2846, 2848, 2850, 2848, 2849, 2851, 2850, 2849, 2852, 2841,
-	2842, 2853, 2852, 2842, 2853, 2842, 2843, 2854, 2852, 2853, 2855, 2854, 2853, 2855, 2853, 2856,
-	2857, 2855, 2856, 2858, 2854, 2855, 2859, 2858, 2855, 2859, 2855, 2857, 2858, 2859, 2860, 2860,
-	2859, 2861, 2859, 2862, 2861, 2862, 2859, 2857, 2860, 2861, 2863, 2864, 2860, 2863, 2865, 2858,
-	2860, 2865, 2860, 2864, 2866, 2858, 2865, 2867, 2866, 2865, 2867, 2865, 2868, 2868, 2865, 2864,
-	2869, 2867, 2868, 2861, 2862, 2870, 2862, 2871, 2870, 2870, 2871, 2872, 2871, 2873, 2872, 2870,
-	2872, 2874, 2875, 2870, 2874, 2861, 2870, 2875, 2863, 2861, 2875, 2873, 2871, 2876, 2871, 2877,
-	2876, 2871, 2862, 2877, 2876, 2877, 2856, 2877, 2857, 2856, 2862, 2857, 2877, 2876, 2856, 2845,
-	2856, 2843, 2845, 2856, 2853, 2843, 2876, 2845, 2846, 2873, 2876, 2846, 2873, 2846, 2850, 2872,
-	2873, 2850, 2872, 2850, 2851, 2874, 2872, 2851, 2875, 2874, 2878, 2874, 2879, 2878, 2878, 2879,
-	2880, 2879, 2881, 2880, 2880, 2881, 2882, 2881, 2883, 2882, 2882, 2883, 2884, 2883, 2503, 2884,
-	2884, 2503, 2885, 2503, 2501, 2885, 2885, 2501, 2886, 2501, 2499, 2886, 2886, 2499, 2490, 2884,
-	2885, 2887, 2888, 2884, 2887, 2882, 2884, 2888, 2885, 2886, 2889, 2887, 2885, 2889, 2886, 2490,
-	2890, 2889, 2886, 2890, 2890, 2490, 2488, 2890, 2488, 2422, 2488, 2417, 2422, 2416, 2417, 2488,
-	2890, 2422, 2424, 2889, 2890, 2424, 2889, 2424, 2427, 2887, 2889, 2427, 2887, 2427, 2438, 2888,
-	2887, 2438, 2891, 2888, 2438, 2891, 2882, 2888, 2892, 2891, 2438, 2892, 2438, 2439, 2893, 2892,
-	2439, 2893, 2439, 2432, 2894, 2893, 2432, 2432, 2434, 2894, 2434, 2895, 2894, 2434, 2436, 2895,
-	2436, 2896, 2895, 2880, 2882, 2891, 2897, 2880, 2891, 2897, 2891, 2892, 2898, 2897, 2892, 2898,
-	2892, 2893, 2899, 2898, 2893, 2899, 2893, 2894, 2900, 2899, 2894, 2894, 2895, 2900, 2895, 2901,
-	2900, 2895, 2896, 2901, 2896, 2902, 2901, 2878, 2880, 2897, 2903, 2878, 2897, 2903, 2897, 2898,
-	2904, 2903, 2898, 2904, 2898, 2899, 2905, 2904, 2899, 2905, 2899, 2900, 2906, 2905, 2900, 2900,
-	2901, 2906, 2901, 2907, 2906, 2901, 2902, 2907, 2902, 2908, 2907, 2875, 2878, 2903, 2863, 2875,
-	2903, 2863, 2903, 2904, 2864, 2863, 2904, 2864, 2904, 2905, 2868, 2864, 2905, 2868, 2905, 2906,
-	2869, 2868, 2906, 2906, 2907, 2869, 2907, 2867, 2869, 2907, 2908, 2867, 2908, 2866, 2867, 2908,
-	2902, 2909, 2902, 2910, 2909, 2902, 2896, 2910, 2896, 2911, 2910, 2896, 2436, 2911, 2436, 2441,
-	2911, 2911, 2441, 2912, 2441, 2443, 2912, 2912, 2443, 2913, 2443, 2445, 2913, 2913, 2445, 2450,
-	2911, 2912, 2914, 2910, 2911, 2914, 2912, 2913, 2915, 2914, 2912, 2915, 2913, 2450, 2916, 2915,
-	2913, 2916, 2916, 2450, 2451, 2917, 2916, 2451, 2917, 2451, 2452, 2918, 2917, 2452, 2918, 2452,
-	2461, 2919, 2918, 2461, 2919, 2461, 2462, 2920, 2919, 2462, 2920, 2462, 2464, 2921, 2920, 2464,
-	2921, 2464, 2922, 2922, 2464, 2923, 2922, 2923, 2924, 2923, 2925, 2924, 2925, 2926, 2924, 2927,
-	2922, 2924, 2927, 2924, 2928, 2924, 2926, 2928, 2929, 2927, 2928, 2926, 2930, 2928, 2928, 2930,
-	2931, 2930, 2932, 2931, 2928, 2931, 2933, 2929, 2928, 2933, 2931, 2932, 2934, 2932, 2935, 2934,
-	2934, 2935, 2936, 2935, 2937, 2936, 2936, 2937, 2938, 2937, 2939, 2938, 2940, 2934, 2936, 2931,
-	2934, 2940, 2933, 2931, 2940, 2941, 2940, 2936, 2942, 2941, 2936, 2938, 2942, 2936, 2943, 2942,
-	2938, 2944, 2943, 2938, 2938, 2939, 2944, 2939, 2945, 2944, 2939, 2946, 2945, 2946, 2939, 2937,
-	2946, 2947, 2945, 2947, 2946, 2948, 2948, 2946, 2949, 2949, 2946, 2937, 2949, 2937, 2935, 2950,
-	2948, 2949, 2950, 2949, 2951, 2952, 2950, 2951, 2952, 2951, 2953, 2954, 2952, 2953, 2954, 2953,
-	2955, 2956, 2954, 2955, 2955, 2957, 2956, 2957, 2958, 2956, 2958, 2957, 2959, 2960, 2958, 2959,
-	2961, 2947, 2948, 2962, 2958, 2960, 2963, 2962, 2960, 2964, 2962, 2963, 2965, 2964, 2963, 2966,
-	2962, 2964, 2958, 2962, 2966, 2956, 2958, 2966, 2967, 2966, 2964, 2967, 2968, 2966, 2968, 2969,
-	2966, 2969, 2954, 2956, 2966, 2969, 2956, 2968, 2970, 2969, 2970, 2971, 2969, 2970, 2972, 2971,
-	2972, 2973, 2971, 2972, 2974, 2973, 2974, 2975, 2973, 2976, 2975, 2974, 2976, 2961, 2975, 2977,
-	2976, 2974, 2973, 2975, 2950, 2975, 2948, 2950, 2961, 2948, 2975, 2973, 2950, 2952, 2971, 2973,
-	2952, 2971, 2952, 2954, 2969, 2971, 2954, 2978, 2968, 2967, 2979, 2970, 2968, 2980, 2979, 2978,
-	2980, 2981, 2979, 2981, 2982, 2979, 2981, 2983, 2982, 2983, 2984, 2982, 2985, 2980, 2978, 2985,
-	2978, 2986, 2987, 2985, 2986, 2987, 2986, 2988, 2986, 2989, 2988, 2988, 2989, 2990, 2991, 2988,
-	2990, 2992, 2984, 2983, 2993, 2992, 2983, 2991, 2990, 2994, 2990, 2995, 2994, 2994, 2995, 2996,
-	2995, 2997, 2996, 2996, 2997, 2998, 2999, 2996, 2998, 2999, 2998, 3000, 2998, 3001, 3000, 3000,
-	3001, 3002, 3001, 3003, 3002, 3000, 3002, 3004, 3002, 3005, 3004, 3004, 3005, 3006, 3007, 3004,
-	3006, 3008, 3004, 3007, 3000, 3004, 3008, 2999, 3000, 3008, 2999, 3008, 2996, 3009, 3008, 3007,
-	3008, 3009, 3010, 3008, 3010, 2996, 3009, 3011, 3010, 3012, 3011, 3009, 3013, 3012, 3009, 3009,
-	3007, 3014, 3013, 3009, 3014, 3010, 3011, 3015, 3011, 3016, 3015, 3016, 3011, 3012, 3017, 3016,
-	3012, 3007, 3006, 3018, 3014, 3007, 3018, 3017, 3012, 3019, 3019, 3012, 3013, 3020, 3017, 3019,
-	3021, 3019, 3013, 3013, 3014, 3022, 3021, 3013, 3022, 3014, 3018, 3023, 3022, 3014, 3023, 3022,
-	3023, 3024, 3023, 3025, 3024, 3024, 3025, 3026, 3027, 3024, 3026, 3027, 3026, 3028, 3029, 3027,
-	3028, 3030, 3027, 3029, 3031, 3030, 3029, 3031, 3029, 3032, 3033, 3031, 3032, 3029, 3028, 3034,
-	3032, 3029, 3034, 3033, 3035, 3031, 3035, 3036, 3031, 3031, 3036, 3037, 3030, 3031, 3037, 3037,
-	3024, 3027, 3030, 3037, 3027, 3022, 3024, 3037, 3021, 3022, 3037, 3037, 3036, 3021, 3036, 3019,
-	3021, 3019, 3036, 3035, 3020, 3019, 3035, 3020, 3035, 3038, 3038, 3035, 3033, 3039, 3020, 3038,
-	3038, 3040, 3039, 3041, 3040, 3038, 3042, 3040, 3041, 3043, 3042, 3041, 3043, 3041, 3044, 3041,
-	3045, 3044, 3041, 3046, 3045, 3046, 3041, 3038, 3046, 3047, 3045, 3043, 3044, 3048, 3043, 3048,
-	3042, 3044, 3049, 3048, 3048, 3049, 3050, 3049, 3051, 3050, 3050, 3051, 3052, 3053, 3050, 3052,
-	3052, 3051, 3054, 3051, 3055, 3054, 3055, 3051, 3049, 3056, 3055, 3049, 3056, 3049, 3044, 3057,
-	3056, 3044, 3044, 3045, 3057, 3045, 3058, 3057, 3045, 3047, 3058, 3047, 3059, 3058, 3054, 3060,
-	3052, 3060, 3061, 3052, 3052, 3061, 3062, 3053, 3052, 3062, 3053, 3062, 3063, 3050, 3053, 3063,
-	3050, 3063, 3064, 3048, 3050, 3064, 3048, 3064, 3042, 3042, 3064, 3065, 3065, 3066, 3042, 3065,
-	3067, 3066, 3065, 3068, 3067, 3064, 3068, 3065, 3064, 3063, 3068, 3068, 3069, 3067, 3067, 3069,
-	3070, 3070, 3071, 3067, 3071, 3070, 3072, 3073, 3071, 3072, 3074, 3071, 3073, 3075, 3074, 3073,
-	3076, 3071, 3074, 3071, 3076, 3067, 3067, 3076, 3066, 3077, 3076, 3074, 3066, 3076, 3077, 3069,
-	3078, 3070, 3070, 3078, 3079, 3072, 3070, 3079, 3069, 3080, 3078, 3080, 3081, 3078, 3080, 3082,
-	3081, 3082, 3083, 3081, 3081, 3083, 3084, 3085, 3081, 3084, 3078, 3081, 3085, 3079, 3078, 3085,
-	3084, 3083, 3086, 3083, 3087, 3086, 3088, 3087, 3083, 3082, 3088, 3083, 3086, 3087, 3089, 3087,
-	3090, 3089, 3090, 3087, 3088, 3091, 3090, 3088, 3091, 3088, 3092, 3092, 3088, 3082, 3093, 3091,
-	3092, 3094, 3092, 3082, 3094, 3082, 3080, 3095, 3094, 3080, 3095, 3080, 3069, 3068, 3095, 3069,
-	3063, 3095, 3068, 3062, 3094, 3095, 3063, 3062, 3095, 3061, 3092, 3094, 3062, 3061, 3094, 3092,
-	3061, 3060, 3093, 3092, 3060, 3086, 3089, 2993, 2983, 3086, 2993, 3084, 3086, 2983, 2981, 3084,
-	2983, 3085, 3084, 2981, 2980, 3085, 2981, 3079, 3085, 2980, 2985, 3079, 2980, 3072, 3079, 2985,
-	2987, 3072, 2985, 3073, 3072, 2987, 2988, 3073, 2987, 3075, 3073, 2988, 2991, 3075, 2988, 3015,
-	3075, 2991, 3015, 3016, 3075, 3016, 3074, 3075, 3074, 3016, 3017, 3077, 3074, 3017, 3077, 3017,
-	3020, 3039, 3077, 3020, 3039, 3066, 3077, 3040, 3066, 3039, 3066, 3040, 3042, 2994, 3015, 2991,
-	3010, 3015, 2994, 2996, 3010, 2994, 3098, 3097, 3096, 3099, 3098, 3096, 3096, 3097, 3100, 3097,
-	3101, 3100, 3098, 3099, 3102, 3099, 3103, 3102, 3104, 3100, 3101, 3105, 3104, 3101, 3104, 3105,
-	3106, 3105, 3107, 3106, 3106, 3107, 3108, 3107, 3109, 3108, 3108, 3109, 3110, 3109, 3111, 3110,
-	3102, 3103, 3112, 3103, 3113, 3112, 3110, 3111, 3114, 3111, 3115, 3114, 3113, 3103, 3116, 3103,
-	3117, 3116, 3117, 3103, 3099, 3118, 3117, 3099, 3099, 3096, 3118, 3096, 3119, 3118, 3119, 3096,
-	3120, 3096, 3100, 3120, 3110, 3114, 3121, 3114, 3122, 3121, 3110, 3121, 3123, 3108, 3110, 3123,
-	3108, 3123, 3124, 3106, 3108, 3124, 3106, 3124, 3125, 3104, 3106, 3125, 3120, 3100, 3104, 3125,
-	3120, 3104, 3126, 3117, 3118, 3127, 3126, 3118, 3118, 3119, 3127, 3128, 3126, 3127, 3129, 3128,
-	3127, 3129, 3127, 3130, 3127, 3131, 3130, 3130, 3131, 3132, 3131, 3133, 3132, 3132, 3133, 3134,
-	3134, 3133, 3125, 3125, 3124, 3134, 3135, 3132, 3134, 3135, 3134, 3136, 3134, 3137, 3136, 3124,
-	3137, 3134, 3136, 3137, 3138, 3137, 3139, 3138, 3138, 3139, 3140, 3139, 3141, 3140, 3142, 3126,
-	3128, 3143, 3142, 3128, 3140, 3141, 3144, 3141, 3145, 3144, 3131, 3119, 3133, 3119, 3131, 3127,
-	3119, 3120, 3133, 3123, 3139, 3137, 3124, 3123, 3137, 3121, 3141, 3139, 3123, 3121, 3139, 3122,
-	3145, 3141, 3121, 3122, 3141, 3140, 3144, 3146, 3144, 3147, 3146, 3146, 3147, 3148, 3149, 3146,
-	3148, 3150, 3146, 3149, 3151, 3150, 3149, 3152, 3150, 3151, 3153, 3152, 3151, 3152, 3153, 3154,
-	3155, 3152, 3154, 3154, 3156, 3155, 3156, 3157, 3155, 3158, 3157, 3156, 3159, 3158, 3156, 3160,
-	3158, 3159, 3161, 3160, 3159, 3161, 3162, 3160, 3162, 3163, 3160, 3164, 3163, 3162, 3165, 3164,
-	3162, 3153, 3151, 3166, 3151, 3167, 3166, 3166, 3167, 3168, 3169, 3166, 3168, 3168, 3167, 3170,
-	3167, 3171, 3170, 3172, 3166, 3169, 3173, 3172, 3169, 3172, 3173, 3174, 3173, 3175, 3174, 3176,
-	3174, 3175, 3177, 3176, 3175, 3178, 3176, 3177, 3179, 3178, 3177, 3178, 3179, 3180, 3179, 3181,
-	3180, 3180, 3181, 3182, 3181, 3183, 3182, 3170, 3171, 3184, 3171, 3185, 3184, 3179, 3177, 3186,
-	3177, 3175, 3186, 3187, 3179, 3186, 3187, 3186, 3188, 3189, 3187, 3188, 3189, 3188, 3190, 3191,
-	3189, 3190, 3191, 3190, 3192, 3191, 3192, 3189, 3190, 3193, 3192, 3194, 3193, 3190, 3195, 3194,
-	3190, 3190, 3188, 3195, 3192, 3196, 3189, 3189, 3196, 3187, 3188, 3197, 3195, 3194, 3195, 3198,
-	3199, 3194, 3198, 3198, 3200, 3199, 3201, 3200, 3198, 3200, 3201, 3202, 3202, 3203, 3200, 3203,
-	3204, 3200, 3200, 3204, 3199, 3201, 3205, 3202, 3202, 3205, 3203, 3205, 3206, 3203, 3207, 3201,
-	3198, 3195, 3197, 3207, 3198, 3195, 3207, 3208, 3196, 3192, 3209, 3193, 3194, 3210, 3209, 3194,
-	3210, 3194, 3199, 3211, 3210, 3199, 3199, 3204, 3211, 3204, 3212, 3211, 3212, 3204, 3203, 3213,
-	3212, 3203, 3203, 3206, 3213, 3206, 3214, 3213, 3215, 3214, 3206, 3216, 3215, 3206, 3216, 3206,
-	3205, 3217, 3216, 3205, 3217, 3205, 3201, 3218, 3217, 3201, 3218, 3201, 3207, 3219, 3218, 3207,
-	3207, 3197, 3219, 3197, 3220, 3219, 3220, 3197, 3188, 3186, 3220, 3188, 3184, 3215, 3216, 3170,
-	3184, 3216, 3170, 3216, 3217, 3168, 3170, 3217, 3168, 3217, 3218, 3169, 3168, 3218, 3169, 3218,
-	3219, 3173, 3169, 3219, 3219, 3220, 3173, 3220, 3175, 3173, 3175, 3220, 3186, 3223, 3222, 3221,
-	3224, 3223, 3221, 3225, 3223, 3224, 3226, 3225, 3224, 3227, 3225, 3226, 3228, 3227, 3226, 3227,
-	3228, 3229, 3228, 3230, 3229, 3221, 3222, 3231, 3222, 3232, 3231, 3231, 3232, 3233, 3232, 3234,
-	3233, 3229, 3230, 3235, 3230, 3236, 3235, 3237, 3222, 3223, 3238, 3237, 3223, 3238, 3223, 3225,
-	3239, 3237, 3238, 3240, 3239, 3238, 3241, 3239, 3240, 3241, 3242, 3239, 3242, 3243, 3239, 3239,
-	3243, 3237, 3244, 3241, 3240, 3244, 3240, 3245, 3246, 3244, 3245, 3246, 3245, 3247, 3248, 3246,
-	3247, 3248, 3247, 3249, 3247, 3250, 3249, 3251, 3243, 3242, 3252, 3251, 3242, 3249, 3250, 3253,
-	3250, 3254, 3253, 3255, 3243, 3251, 3243, 3255, 3237, 3256, 3255, 3251, 3257, 3254, 3250, 3258,
-	3257, 3250, 3258, 3250, 3247, 3259, 3258, 3247, 3247, 3245, 3259, 3245, 3260, 3259, 3245, 3240,
-	3260, 3240, 3238, 3260, 3237, 3255, 3222, 3255, 3232, 3222, 3232, 3255, 3256, 3234, 3232, 3256,
-	3235, 3257, 3258, 3229, 3235, 3258, 3229, 3258, 3259, 3227, 3229, 3259, 3259, 3260, 3227, 3260,
-	3225, 3227, 3260, 3238, 3225, 3263, 3262, 3261, 3264, 3263, 3261, 3265, 3263, 3264, 3266, 3265,
-	3264, 3267, 3265, 3266, 3268, 3267, 3266, 3267, 3268, 3269, 3268, 3270, 3269, 3261, 3262, 3271,
-	3262, 3272, 3271, 3261, 3271, 3273, 3271, 3274, 3273, 3261, 3273, 3275, 3264, 3261, 3275, 3264,
-	3275, 3276, 3266, 3264, 3276, 3266, 3276, 3277, 3268, 3266, 3277, 3268, 3277, 3270, 3277, 3278,
-	3270, 3279, 3274, 3271, 3280, 3279, 3271, 3271, 3272, 3280, 3272, 3281, 3280, 3269, 3270, 3282,
-	3270, 3283, 3282, 3270, 3278, 3283, 3278, 3284, 3283, 3281, 3272, 3285, 3272, 3286, 3285, 3285,
-	3286, 3287, 3286, 3288, 3287, 3288, 3286, 3289, 3290, 3288, 3289, 3290, 3289, 3291, 3292, 3290,
-	3291, 3292, 3291, 3293, 3294, 3292, 3293, 3294, 3293, 3295, 3296, 3294, 3295, 3295, 3297, 3296,
-	3297, 3298, 3296, 3297, 3299, 3298, 3299, 3300, 3298, 3293, 3291, 3265, 3291, 3263, 3265, 3291,
-	3289, 3263, 3289, 3262, 3263, 3289, 3286, 3262, 3286, 3272, 3262, 3282, 3299, 3297, 3269, 3282,
-	3297, 3269, 3297, 3295, 3267, 3269, 3295, 3293, 3265, 3267, 3295, 3293, 3267, 3298, 3300, 3301,
-	3300, 3302, 3301, 3301, 3302, 3303, 3304, 3301, 3303, 3305, 3301, 3304, 3298, 3301, 3305, 3306,
-	3305, 3304, 3306, 3307, 3305, 3307, 3308, 3305, 3307, 3309, 3308, 3309, 3310, 3308, 3309, 3311,
-	3310, 3311, 3312, 3310, 3311, 3313, 3312, 3313, 3314, 3312, 3315, 3314, 3313, 3316, 3315, 3313,
-	3304, 3303, 3317, 3303, 3318, 3317, 3317, 3318, 3319, 3320, 3317, 3319, 3321, 3317, 3320, 3322,
-	3321, 3320, 3322, 3320, 3323, 3324, 3322, 3323, 3322, 3324, 3325, 3322, 3325, 3321, 3324, 3326,
-	3325, 3325, 3326, 3327, 3326, 3328, 3327, 3327, 3328, 3329, 3328, 3330, 3329, 3329, 3330, 3331,
-	3330, 3332, 3331, 3329, 3331, 3333, 3331, 3334, 3333, 3329, 3333, 3335, 3327, 3329, 3335, 3327,
-	3335, 3336, 3325, 3327, 3336, 3325, 3336, 3321, 3337, 3334, 3331, 3338, 3337, 3331, 3331, 3332,
-	3338, 3332, 3339, 3338, 3340, 3330, 3328, 3341, 3340, 3328, 3341, 3328, 3326, 3342, 3340, 3341,
-	3343, 3342, 3341, 3344, 3342, 3343, 3344, 3345, 3342, 3344, 3346, 3345, 3346, 3344, 3343, 3346,
-	3347, 3345, 3348, 3347, 3346, 3349, 3348, 3346, 3350, 3348, 3349, 3351, 3350, 3349, 3345, 3352,
-	3342, 3342, 3352, 3340, 3346, 3343, 3353, 3349, 3346, 3353, 3349, 3353, 3354, 3351, 3349, 3354,
-	3351, 3354, 3350, 3354, 3355, 3350, 3356, 3352, 3345, 3357, 3356, 3345, 3345, 3347, 3357, 3347,
-	3358, 3357, 3358, 3347, 3348, 3359, 3358, 3348, 3359, 3348, 3350, 3360, 3359, 3350, 3350, 3355,
-	3360, 3355, 3361, 3360, 3362, 3352, 3356, 3352, 3362, 3340, 3363, 3362, 3356, 3364, 3361, 3355,
-	3365, 3364, 3355, 3365, 3355, 3354, 3366, 3365, 3354, 3354, 3353, 3366, 3353, 3367, 3366, 3353,
-	3343, 3367, 3343, 3341, 3367, 3340, 3362, 3330, 3362, 3332, 3330, 3332, 3362, 3363, 3339, 3332,
-	3363, 3368, 3364, 3365, 3323, 3368, 3365, 3323, 3365, 3366, 3323, 3320, 3368, 3320, 3319, 3368,
-	3324, 3323, 3366, 3366, 3367, 3324, 3367, 3326, 3324, 3367, 3341, 3326, 3371, 3370, 3369, 3372,
-	3371, 3369, 3373, 3371, 3372, 3374, 3373, 3372, 3375, 3373, 3374, 3376, 3375, 3374, 3375, 3376,
-	3377, 3376, 3378, 3377, 3369, 3370, 3379, 3370, 3380, 3379, 3379, 3380, 3381, 3380, 3382, 3381,
-	3377, 3378, 3383, 3378, 3384, 3383, 3385, 3370, 3371, 3386, 3385, 3371, 3386, 3371, 3373, 3387,
-	3385, 3386, 3388, 3387, 3386, 3389, 3387, 3388, 3389, 3390, 3387, 3390, 3391, 3387, 3387, 3391,
-	3385, 3392, 3389, 3388, 3392, 3388, 3393, 3394, 3392, 3393, 3394, 3393, 3395, 3396, 3394, 3395,
-	3396, 3395, 3397, 3395, 3398, 3397, 3399, 3391, 3390, 3400, 3399, 3390, 3397, 3398, 3401, 3398,
-	3402, 3401, 3403, 3391, 3399, 3391, 3403, 3385, 3404, 3403, 3399, 3405, 3402, 3398, 3406, 3405,
-	3398, 3406, 3398, 3395, 3407, 3406, 3395, 3395, 3393, 3407, 3393, 3408, 3407, 3393, 3388, 3408,
-	3388, 3386, 3408, 3385, 3403, 3370, 3403, 3380, 3370, 3380, 3403, 3404, 3382, 3380, 3404, 3383,
-	3405, 3406, 3377, 3383, 3406, 3377, 3406, 3407, 3375, 3377, 3407, 3407, 3408, 3375, 3408, 3373,
-	3375, 3408, 3386, 3373, 3411, 3410, 3409, 3412, 3411, 3409, 3413, 3411, 3412, 3414, 3413, 3412,
-	3415, 3413, 3414, 3416, 3415, 3414, 3415, 3416, 3417, 3416, 3418, 3417, 3409, 3410, 3419, 3410,
-	3420, 3419, 3419, 3420, 3421, 3420, 3422, 3421, 3417, 3418, 3423, 3418, 3424, 3423, 3425, 3410,
-	3411, 3426, 3425, 3411, 3426, 3411, 3413, 3427, 3425, 3426, 3428, 3427, 3426, 3427, 3429, 3425,
-	3429, 3430, 3425, 3430, 3429, 3431, 3432, 3430, 3431, 3420, 3430, 3432, 3422, 3420, 3432, 3428,
-	3426, 3433, 3434, 3428, 3433, 3434, 3433, 3435, 3436, 3434, 3435, 3435, 3437, 3436, 3437, 3438,
-	3436, 3437, 3439, 3438, 3439, 3440, 3438, 3425, 3430, 3410, 3430, 3420, 3410, 3423, 3439, 3437,
-	3417, 3423, 3437, 3417, 3437, 3435, 3415, 3417, 3435, 3435, 3433, 3415, 3433, 3413, 3415, 3433,
-	3426, 3413, 3438, 3440, 3441, 3440, 3442, 3441, 3441, 3442, 3443, 3444, 3441, 3443, 3445, 3441,
-	3444, 3438, 3441, 3445, 3446, 3445, 3444, 3446, 3447, 3445, 3447, 3448, 3445, 3447, 3449, 3448,
-	3449, 3450, 3448, 3449, 3451, 3450, 3451, 3452, 3450, 3451, 3453, 3452, 3453, 3454, 3452, 3455,
-	3453, 3451, 3456, 3455, 3451, 3456, 3451, 3449, 3457, 3456, 3449, 3457, 3449, 3447, 3458, 3457,
-	3447, 3458, 3447, 3446, 3459, 3458, 3446, 3446, 3444, 3460, 3459, 3446, 3460, 3461, 3454, 3453,
-	3462, 3461, 3453, 3462, 3453, 3455, 3463, 3462, 3455, 3460, 3444, 3464, 3444, 3443, 3464, 3463,
-	3455, 3465, 3465, 3455, 3456, 3466, 3463, 3465, 3465, 3467, 3466, 3468, 3467, 3465, 3469, 3468,
-	3465, 3469, 3465, 3456, 3469, 3456, 3457, 3470, 3468, 3469, 3471, 3470, 3469, 3472, 3470, 3471,
-	3473, 3472, 3471, 3474, 3472, 3473, 3475, 3474, 3473, 3474, 3475, 3476, 3475, 3477, 3476, 3467,
-	3478, 3466, 3476, 3477, 3479, 3477, 3480, 3479, 3481, 3468, 3470, 3482, 3481, 3470, 3482, 3470,
-	3472, 3483, 3481, 3482, 3484, 3483, 3482, 3485, 3483, 3484, 3485, 3486, 3483, 3485, 3487, 3486,
-	3487, 3485, 3484, 3487, 3488, 3486, 3489, 3488, 3487, 3490, 3489, 3487, 3491, 3489, 3490, 3492,
-	3491, 3490, 3486, 3493, 3483, 3483, 3493, 3481, 3487, 3484, 3494, 3490, 3487, 3494, 3490, 3494,
-	3495, 3492, 3490, 3495, 3492, 3495, 3491, 3495, 3496, 3491, 3497, 3493, 3486, 3498, 3497, 3486,
-	3486, 3488, 3498, 3488, 3499, 3498, 3499, 3488, 3489, 3500, 3499, 3489, 3500, 3489, 3491, 3501,
-	3500, 3491, 3491, 3496, 3501, 3496, 3502, 3501, 3503, 3493, 3497, 3493, 3503, 3481, 3504, 3503,
-	3497, 3505, 3502, 3496, 3506, 3505, 3496, 3506, 3496, 3495, 3507, 3506, 3495, 3495, 3494, 3507,
-	3494, 3508, 3507, 3494, 3484, 3508, 3484, 3482, 3508, 3481, 3503, 3468, 3503, 3467, 3468, 3467,
-	3503, 3504, 3478, 3467, 3504, 3479, 3505, 3506, 3476, 3479, 3506, 3476, 3506, 3507, 3474, 3476,
-	3507, 3507, 3508, 3474, 3508, 3472, 3474, 3508, 3482, 3472, 3511, 3510, 3509, 3512, 3511, 3509,
-	3513, 3511, 3512, 3514, 3513, 3512, 3515, 3513, 3514, 3516, 3515, 3514, 3515, 3516, 3517, 3516,
-	3518, 3517, 3509, 3510, 3519, 3510, 3520, 3519, 3519, 3520, 3521, 3520, 3522, 3521, 3517, 3518,
-	3523, 3518, 3524, 3523, 3525, 3511, 3513, 3526, 3525, 3513, 3526, 3513, 3515, 3527, 3525, 3526,
-	3528, 3527, 3526, 3529, 3527, 3528, 3529, 3530, 3527, 3530, 3531, 3527, 3527, 3531, 3525, 3530,
-	3532, 3531, 3532, 3533, 3531, 3534, 3529, 3528, 3534, 3528, 3535, 3536, 3534, 3535, 3536, 3535,
-	3537, 3535, 3538, 3537, 3539, 3533, 3532, 3540, 3539, 3532, 3537, 3538, 3541, 3538, 3542, 3541,
-	3531, 3533, 3543, 3531, 3543, 3525, 3533, 3544, 3543, 3544, 3533, 3539, 3545, 3544, 3539, 3546,
-	3542, 3538, 3547, 3546, 3538, 3547, 3538, 3535, 3548, 3547, 3535, 3535, 3528, 3548, 3528, 3526,
-	3548, 3525, 3543, 3511, 3543, 3510, 3511, 3543, 3544, 3510, 3544, 3520, 3510, 3520, 3544, 3545,
-	3522, 3520, 3545, 3523, 3546, 3547, 3517, 3523, 3547, 3517, 3547, 3548, 3515, 3517, 3548, 3548,
-	3526, 3515, 3551, 3550, 3549, 3552, 3551, 3549, 3553, 3551, 3552, 3554, 3553, 3552, 3555, 3553,
-	3554, 3556, 3555, 3554, 3555, 3556, 3557, 3556, 3558, 3557, 3549, 3550, 3559, 3550, 3560, 3559,
-	3559, 3560, 3561, 3560, 3562, 3561, 3557, 3558, 3563, 3558, 3564, 3563, 3565, 3551, 3553, 3566,
-	3565, 3553, 3566, 3553, 3555, 3567, 3565, 3566, 3568, 3567, 3566, 3569, 3567, 3568, 3569, 3570,
-	3567, 3570, 3571, 3567, 3567, 3571, 3565, 3570, 3572, 3571, 3572, 3573, 3571, 3574, 3569, 3568,
-	3574, 3568, 3575, 3576, 3574, 3575, 3576, 3575, 3577, 3575, 3578, 3577, 3579, 3573, 3572, 3580,
-	3579, 3572, 3577, 3578, 3581, 3578, 3582, 3581, 3571, 3573, 3583, 3571, 3583, 3565, 3573, 3584,
-	3583, 3584, 3573, 3579, 3585, 3584, 3579, 3586, 3582, 3578, 3587, 3586, 3578, 3587, 3578, 3575,
-	3588, 3587, 3575, 3575, 3568, 3588, 3568, 3566, 3588, 3565, 3583, 3551, 3583, 3550, 3551, 3583,
-	3584, 3550, 3584, 3560, 3550, 3560, 3584, 3585, 3562, 3560, 3585, 3563, 3586, 3587, 3557, 3563,
-	3587, 3557, 3587, 3588, 3555, 3557, 3588, 3588, 3566, 3555, 3591, 3590, 3589, 3592, 3591, 3589,
-	3593, 3591, 3592, 3594, 3593, 3592, 3595, 3593, 3594, 3596, 3595, 3594, 3595, 3596, 3597, 3596,
-	3598, 3597, 3589, 3590, 3599, 3590, 3600, 3599, 3599, 3600, 3601, 3600, 3602, 3601, 3597, 3598,
-	3603, 3598, 3604, 3603, 3605, 3591, 3593, 3606, 3605, 3593, 3606, 3593, 3595, 3607, 3605, 3606,
-	3608, 3607, 3606, 3609, 3607, 3608, 3609, 3610, 3607, 3610, 3609, 3611, 3609, 3612, 3611, 3613,
-	3612, 3609, 3614, 3613, 3609, 3614, 3609, 3608, 3615, 3613, 3614, 3616, 3615, 3614, 3610, 3611,
-	3617, 3610, 3617, 3607, 3607, 3617, 3605, 3611, 3618, 3617, 3614, 3608, 3619, 3616, 3614, 3619,
-	3616, 3619, 3615, 3619, 3620, 3615, 3621, 3618, 3611, 3622, 3621, 3611, 3611, 3612, 3622, 3612,
-	3623, 3622, 3623, 3612, 3613, 3624, 3623, 3613, 3624, 3613, 3615, 3625, 3624, 3615, 3615, 3620,
-	3625, 3620, 3626, 3625, 3617, 3618, 3627, 3617, 3627, 3605, 3618, 3628, 3627, 3628, 3618, 3621,
-	3629, 3628, 3621, 3630, 3626, 3620, 3631, 3630, 3620, 3631, 3620, 3619, 3632, 3631, 3619, 3619,
-	3608, 3632, 3608, 3606, 3632, 3605, 3627, 3591, 3627, 3590, 3591, 3627, 3628, 3590, 3628, 3600,
-	3590, 3600, 3628, 3629, 3602, 3600, 3629, 3603, 3630, 3631, 3597, 3603, 3631, 3597, 3631, 3632,
-	3595, 3597, 3632, 3632, 3606, 3595, 3634, 3633, 2573, 3635, 3634, 2573, 2566, 2573, 3633, 2565,
-	2566, 3633, 2565, 3633, 2492, 2492, 3633, 3634, 2497, 2565, 2492, 2497, 2498, 2565, 2498, 2563,
-	2565, 2498, 2500, 2563, 2500, 2561, 2563, 2500, 2502, 2561, 2502, 2559, 2561, 2502, 2504, 2559,
-	2504, 2557, 2559, 2504, 2506, 2557, 2506, 2555, 2557, 2506, 2508, 2555, 2508, 2553, 2555, 2508,
-	2510, 2553, 2510, 2551, 2553, 2510, 2512, 2551, 2512, 2549, 2551, 2512, 2514, 2549, 2514, 2547,
-	2549, 2514, 2516, 2547, 2516, 2546, 2547, 2546, 2516, 2518, 2544, 2546, 2518, 2544, 2518, 2520,
-	2542, 2544, 2520, 2542, 2520, 2522, 2540, 2542, 2522, 2540, 2522, 2524, 2535, 2540, 2524, 3638,
-	3637, 3636, 3639, 3638, 3636, 3639, 3636, 3640, 3636, 3641, 3640, 3640, 3641, 3642, 3641, 3643,
-	3642, 3642, 3643, 3644, 3645, 3642, 3644, 3644, 3646, 3645, 3646, 3647, 3645, 3647, 3646, 3648,
-	3646, 3649, 3648, 3648, 3649, 3650, 3649, 3651, 3650, 3652, 3637, 3638, 3653, 3652, 3638, 3650,
-	3651, 3654, 3651, 3655, 3654, 3650, 3654, 3111, 3654, 3115, 3111, 3650, 3111, 3109, 3648, 3650,
-	3109, 3648, 3109, 3107, 3647, 3648, 3107, 3647, 3107, 3105, 3645, 3647, 3105, 3645, 3105, 3642,
-	3105, 3101, 3642, 3642, 3101, 3097, 3640, 3642, 3097, 3640, 3097, 3098, 3639, 3640, 3098, 3639,
-	3098, 3638, 3098, 3102, 3638, 3638, 3102, 3653, 3102, 3112, 3653, 3658, 3657, 3656, 3659, 3658,
-	3656, 3656, 3657, 3660, 3657, 3661, 3660, 3660, 3661, 3662, 3661, 3663, 3662, 3662, 3663, 3664,
-	3663, 3665, 3664, 3664, 3665, 3666, 3665, 3667, 3666, 3666, 3667, 304, 3667, 306, 304, 3666,
-	304, 303, 3666, 303, 300, 3664, 3666, 300, 3664, 300, 297, 3662, 3664, 297, 3662, 297,
-	293, 3660, 3662, 293, 3660, 293, 291, 3656, 3660, 291, 3656, 291, 290, 3659, 3656, 290,
-	1065, 306, 3667, 1065, 1067, 306, 1067, 307, 306, 1067, 1070, 307, 1070, 309, 307, 309,
-	1070, 1072, 310, 309, 1072, 1072, 1073, 310, 1073, 313, 310, 1073, 1075, 313, 1075, 315,
-	313, 315, 1075, 1078, 316, 315, 1078, 316, 1078, 1080, 318, 316, 1080, 1080, 3668, 318,
-	1080, 1079, 3668, 1079, 3669, 3668, 3668, 3669, 3670, 3669, 3671, 3670, 3670, 3671, 3672, 3671,
-	3673, 3672, 3672, 3673, 2141, 3673, 2142, 2141, 3673, 3674, 2142, 3674, 2143, 2142, 3674, 3675,
-	2143, 3675, 2132, 2143, 3675, 3676, 2132, 3676, 2130, 2132, 2130, 3676, 3677, 2129, 2130, 3677,
-	3677, 2144, 2129, 3678, 2144, 3677, 2145, 2144, 3678, 3679, 2145, 3678, 3679, 3680, 2145, 3680,
-	2146, 2145, 2147, 2146, 3680, 3681, 2147, 3680, 2148, 2147, 3681, 3682, 2148, 3681, 2149, 2148,
-	3682, 3683, 2149, 3682, 2150, 2149, 3683, 3684, 2150, 3683, 2151, 2150, 3684, 3685, 2151, 3684,
-	2152, 2151, 3685, 3686, 2152, 3685, 2153, 2152, 3686, 3687, 2153, 3686, 2154, 2153, 3687, 3688,
-	2154, 3687, 2155, 2154, 3688, 3689, 2155, 3688, 3689, 3690, 2155, 3690, 2156, 2155, 2156, 3690,
-	3691, 2157, 2156, 3691, 2157, 3691, 3692, 2158, 2157, 3692, 2158, 3692, 3693, 2159, 2158, 3693,
-	2159, 3693, 3694, 3695, 2159, 3694, 2160, 2159, 3695, 2162, 2160, 3695, 2162, 3695, 3696, 2168,
-	2162, 3696, 3696, 3697, 2168, 3697, 2170, 2168, 3697, 3698, 2170, 3698, 2173, 2170, 2173, 3698,
-	3699, 2174, 2173, 3699, 2180, 2174, 3699, 3700, 2180, 3699, 3700, 3699, 3701, 3699, 3698, 3701,
-	3702, 3700, 3701, 3698, 3703, 3701, 3703, 3698, 3697, 3704, 3703, 3697, 3704, 3697, 3696, 3705,
-	3704, 3696, 3696, 3695, 3705, 3695, 3694, 3705, 3702, 3701, 3706, 3701, 3703, 3706, 3707, 3702,
-	3706, 3703, 3708, 3706, 3708, 3703, 3704, 3709, 3708, 3704, 3709, 3704, 3705, 3710, 3709, 3705,
-	3705, 3694, 3710, 3694, 3711, 3710, 3694, 3693, 3711, 3693, 3712, 3711, 3693, 3692, 3712, 3692,
-	3713, 3712, 3692, 3691, 3713, 3691, 3714, 3713, 3691, 3690, 3714, 3690, 3715, 3714, 3715, 3690,
-	3689, 3716, 3715, 3689, 3716, 3689, 3717, 3689, 3688, 3717, 3717, 3688, 3718, 3688, 3687, 3718,
-	3718, 3687, 3719, 3687, 3686, 3719, 3719, 3686, 3720, 3686, 3685, 3720, 3720, 3685, 3721, 3685,
-	3684, 3721, 3721, 3684, 3722, 3684, 3683, 3722, 3722, 3683, 3723, 3683, 3682, 3723, 3723, 3682,
-	3724, 3682, 3681, 3724, 3724, 3681, 3725, 3681, 3680, 3725, 3725, 3680, 3679, 3726, 3725, 3679,
-	3726, 3679, 3727, 3679, 3678, 3727, 3727, 3678, 3728, 3728, 3678, 3677, 3677, 3676, 3728, 3676,
-	3729, 3728, 3729, 3676, 3675, 3730, 3729, 3675, 3730, 3675, 3674, 3731, 3730, 3674, 3731, 3674,
-	3673, 3671, 3731, 3673, 3732, 3727, 3728, 3728, 3729, 3732, 3729, 3733, 3732, 3733, 3729, 3730,
-	3734, 3733, 3730, 3734, 3730, 3731, 3735, 3734, 3731, 3735, 3731, 3671, 3669, 3735, 3671, 3732,
-	3733, 6, 6, 13, 3732, 13, 3727, 3732, 3726, 3727, 13, 27, 3726, 13, 27, 30,
-	3726, 30, 3725, 3726, 3724, 3725, 30, 41, 3724, 30, 3723, 3724, 41, 43, 3723, 41,
-	3722, 3723, 43, 81, 3722, 43, 3721, 3722, 81, 84, 3721, 81, 3720, 3721, 84, 86,
-	3720, 84, 3719, 3720, 86, 1956, 3719, 86, 3718, 3719, 1956, 1955, 3718, 1956, 3717, 3718,
-	1955, 1959, 3717, 1955, 3716, 3717, 1959, 1929, 3716, 1959, 1929, 1926, 3716, 1926, 3715, 3716,
-	3715, 1926, 1927, 3714, 3715, 1927, 3714, 1927, 1942, 3713, 3714, 1942, 3713, 1942, 1989, 1989,
-	1942, 1943, 1987, 1989, 1943, 1987, 1943, 1944, 1985, 1987, 1944, 1985, 1944, 1945, 1981, 1985,
-	1945, 1981, 1945, 1946, 3712, 3713, 1989, 3712, 1989, 1988, 3711, 3712, 1988, 3711, 1988, 1990,
-	3710, 3711, 1990, 1990, 1999, 3710, 1999, 3709, 3710, 1999, 2009, 3709, 2009, 3708, 3709, 3708,
-	2009, 2008, 3706, 3708, 2008, 3707, 3706, 2008, 2012, 3707, 2008, 3738, 3737, 3736, 3739, 3738,
-	3736, 3736, 3737, 3740, 3737, 3741, 3740, 3740, 3741, 3742, 3741, 3743, 3742, 3742, 3743, 3744,
-	3743, 3745, 3744, 3744, 3745, 3746, 3745, 3747, 3746, 3746, 3747, 2312, 3747, 2314, 2312, 3746,
-	2312, 2311, 3746, 2311, 2310, 3744, 3746, 2310, 3744, 2310, 2309, 3742, 3744, 2309, 3742, 2309,
-	2307, 3740, 3742, 2307, 3740, 2307, 2304, 3736, 3740, 2304, 3736, 2304, 2305, 3739, 3736, 2305,
-	273, 2314, 3747, 273, 271, 2314, 271, 2315, 2314, 271, 268, 2315, 268, 2317, 2315, 2317,
-	268, 267, 2318, 2317, 267, 267, 263, 2318, 263, 2321, 2318, 263, 261, 2321, 261, 2323,
-	2321, 2323, 261, 260, 2324, 2323, 260, 2324, 260, 265, 2326, 2324, 265, 265, 361, 2326,
-	361, 2329, 2326, 361, 356, 2329, 356, 2331, 2329, 356, 351, 2331, 351, 2333, 2331, 351,
-	343, 2333, 343, 2335, 2333, 2335, 343, 344, 2336, 2335, 344, 2339, 2336, 344, 345, 2339,
-	344, 3750, 3749, 3748, 3751, 3750, 3748, 3751, 3748, 3752, 3748, 3753, 3752, 3752, 3753, 3754,
-	3753, 3755, 3754, 3754, 3755, 3756, 3757, 3754, 3756, 3757, 3756, 3758, 3756, 3759, 3758, 3758,
-	3759, 3760, 3759, 3761, 3760, 3760, 3761, 3762, 3761, 3763, 3762, 3764, 3749, 3750, 3765, 3764,
-	3750, 3762, 3763, 3766, 3763, 3767, 3766, 3768, 3767, 3763, 3769, 3768, 3763, 3769, 3763, 3761,
-	3770, 3769, 3761, 3770, 3761, 3759, 3771, 3770, 3759, 3771, 3759, 3756, 3772, 3771, 3756, 3773,
-	3768, 3769, 3774, 3773, 3769, 3774, 3769, 3770, 3774, 2495, 3773, 2493, 2495, 3774, 3775, 2493,
-	3774, 3775, 3774, 3770, 3775, 3770, 3771, 2494, 2493, 3775, 3776, 2494, 3775, 3776, 3775, 3771,
-	3776, 3771, 3772, 2495, 3777, 3773, 2495, 2496, 3777, 2496, 3778, 3777, 3778, 2496, 3779, 2496,
-	3634, 3779, 2496, 2492, 3634, 3779, 3634, 3635, 3780, 3779, 3635, 2487, 2494, 3776, 3781, 2487,
-	3776, 3781, 2486, 2487, 3781, 3776, 3772, 3782, 2486, 3781, 3772, 3782, 3781, 3755, 3782, 3772,
-	3756, 3755, 3772, 3782, 3755, 3753, 3783, 3782, 3753, 2486, 3782, 3783, 3784, 3783, 3753, 3748,
-	3784, 3753, 3748, 3749, 3784, 3749, 3785, 3784, 3785, 3749, 3764, 3786, 3785, 3764, 3784, 2484,
-	3783, 3784, 3785, 2484, 2484, 2485, 3783, 2485, 2486, 3783, 3785, 2483, 2484, 2483, 3785, 3786,
-	2482, 2483, 3786, 3789, 3788, 3787, 3790, 3789, 3787, 3787, 3788, 3791, 3788, 3792, 3791, 3791,
-	3792, 3793, 3792, 3794, 3793, 3793, 3794, 3795, 3794, 3796, 3795, 3795, 3796, 3797, 3796, 1372,
-	3797, 3797, 1372, 1374, 3797, 1374, 1473, 1374, 1509, 1473, 1473, 1509, 1504, 1472, 1473, 1504,
-	1472, 1504, 1505, 1471, 1472, 1505, 1505, 1493, 1471, 1493, 1470, 1471, 1493, 1485, 1470, 1485,
-	1469, 1470, 1469, 1485, 1478, 1374, 1375, 1509, 1375, 1510, 1509, 1375, 1377, 1510, 1377, 1511,
-	1510, 1377, 1380, 1511, 1380, 1507, 1511, 1507, 1380, 1382, 1506, 1507, 1382, 1506, 1382, 1384,
-	1508, 1506, 1384, 1384, 1385, 1508, 1385, 1513, 1508, 1385, 1387, 1513, 1387, 1449, 1513, 1387,
-	1389, 1449, 1389, 1448, 1449, 1389, 1391, 1448, 1391, 1405, 1448, 3800, 3799, 3798, 3801, 3800,
-	3798, 3801, 3798, 3802, 3803, 3801, 3802, 3803, 3802, 3804, 3805, 3803, 3804, 3805, 3804, 3806,
-	3807, 3805, 3806, 3807, 3806, 3808, 3806, 3809, 3808, 3810, 3799, 3800, 3811, 3810, 3800, 3808,
-	3809, 3812, 3809, 3813, 3812, 3808, 3812, 3418, 3812, 3424, 3418, 3808, 3418, 3416, 3807, 3808,
-	3416, 3807, 3416, 3805, 3416, 3414, 3805, 3805, 3414, 3803, 3414, 3412, 3803, 3803, 3412, 3801,
-	3412, 3409, 3801, 3801, 3409, 3800, 3409, 3419, 3800, 3800, 3419, 3811, 3419, 3421, 3811, 3401,
-	3813, 3809, 3397, 3401, 3809, 3397, 3809, 3806, 3396, 3397, 3806, 3806, 3804, 3396, 3804, 3394,
-	3396, 3804, 3802, 3394, 3802, 3392, 3394, 3802, 3798, 3392, 3798, 3389, 3392, 3798, 3799, 3389,
-	3799, 3390, 3389, 3390, 3799, 3810, 3400, 3390, 3810, 3816, 3815, 3814, 3817, 3816, 3814, 3817,
-	3814, 3818, 3819, 3817, 3818, 3819, 3818, 3820, 3821, 3819, 3820, 3821, 3820, 3822, 3823, 3821,
-	3822, 3823, 3822, 3824, 3822, 3825, 3824, 3826, 3815, 3816, 3827, 3826, 3816, 3824, 3825, 3828,
-	3825, 3829, 3828, 3824, 3828, 3558, 3828, 3564, 3558, 3824, 3558, 3556, 3823, 3824, 3556, 3823,
-	3556, 3821, 3556, 3554, 3821, 3821, 3554, 3819, 3554, 3552, 3819, 3819, 3552, 3817, 3552, 3549,
-	3817, 3817, 3549, 3816, 3549, 3559, 3816, 3816, 3559, 3827, 3559, 3561, 3827, 3541, 3829, 3825,
-	3537, 3541, 3825, 3537, 3825, 3822, 3536, 3537, 3822, 3822, 3820, 3536, 3820, 3534, 3536, 3820,
-	3818, 3534, 3818, 3529, 3534, 3818, 3814, 3529, 3814, 3530, 3529, 3814, 3815, 3530, 3815, 3532,
-	3530, 3532, 3815, 3826, 3540, 3532, 3826, 3832, 3831, 3830, 3833, 3832, 3830, 3833, 3830, 3834,
-	3835, 3833, 3834, 3835, 3834, 3836, 3837, 3835, 3836, 3837, 3836, 3838, 3839, 3837, 3838, 3839,
-	3838, 3840, 3838, 3841, 3840, 3842, 3831, 3832, 3843, 3842, 3832, 3840, 3841, 3844, 3841, 3845,
-	3844, 3840, 3844, 3598, 3844, 3604, 3598, 3840, 3598, 3596, 3839, 3840, 3596, 3839, 3596, 3837,
-	3596, 3594, 3837, 3837, 3594, 3835, 3594, 3592, 3835, 3835, 3592, 3833, 3592, 3589, 3833, 3833,
-	3589, 3832, 3589, 3599, 3832, 3832, 3599, 3843, 3599, 3601, 3843, 3581, 3845, 3841, 3577, 3581,
-	3841, 3577, 3841, 3838, 3576, 3577, 3838, 3838, 3836, 3576, 3836, 3574, 3576, 3836, 3834, 3574,
-	3834, 3569, 3574, 3834, 3830, 3569, 3830, 3570, 3569, 3830, 3831, 3570, 3831, 3572, 3570, 3572,
-	3831, 3842, 3580, 3572, 3842, 3848, 3847, 3846, 3849, 3848, 3846, 3850, 3847, 3848, 3851, 3850,
-	3848, 3849, 3846, 3852, 3853, 3849, 3852, 3854, 3851, 3848, 3855, 3854, 3848, 3855, 3848, 3849,
-	3855, 3856, 3854, 3856, 3857, 3854, 3856, 3855, 3858, 3858, 3855, 3849, 3858, 3849, 3853, 3859,
-	3856, 3858, 3859, 3858, 3860, 3860, 3858, 3853, 3861, 3859, 3860, 3850, 2086, 3847, 2086, 2081,
-	3847, 3861, 3860, 2195, 2197, 3861, 2195, 3860, 3853, 2184, 2195, 3860, 2184, 3853, 3852, 2185,
-	2184, 3853, 2185, 2185, 3852, 2164, 2185, 2164, 2165, 2181, 2185, 2165, 3852, 2091, 2164, 3852,
-	3846, 2091, 3846, 2082, 2091, 3847, 2081, 2082, 3846, 3847, 2082, 2164, 2091, 2161, 2091, 2090,
-	2161, 2222, 2197, 2198, 2220, 2222, 2198, 2220, 2198, 2200, 2217, 2220, 2200, 2200, 2201, 2217,
-	2201, 2215, 2217, 2201, 2203, 2215, 2222, 2224, 2197, 2224, 3861, 2197, 2224, 2226, 3861, 2226,
-	3859, 3861, 2226, 2228, 3859, 2228, 3856, 3859, 3856, 2228, 2229, 3857, 3856, 2229, 3864, 3863,
-	3862, 3865, 3864, 3862, 3865, 3862, 3866, 3862, 3867, 3866, 3868, 3863, 3864, 3869, 3868, 3864,
-	3866, 3867, 3870, 3867, 3871, 3870, 3869, 3864, 3872, 3872, 3864, 3865, 3873, 3869, 3872, 3873,
-	3872, 3874, 3875, 3873, 3874, 3874, 3872, 3876, 3876, 3872, 3865, 3877, 3874, 3876, 3877, 3876,
-	3878, 3876, 3879, 3878, 3865, 3866, 3879, 3876, 3865, 3879, 3878, 3879, 3880, 3879, 3881, 3880,
-	3866, 3870, 3881, 3879, 3866, 3881, 3867, 2457, 3871, 2458, 2457, 3867, 2457, 2466, 3871, 2960,
-	3869, 3873, 2963, 2960, 3873, 2963, 3873, 3875, 2965, 2963, 3875, 3878, 3880, 3001, 3880, 3003,
-	3001, 3878, 3001, 2998, 3877, 3878, 2998, 2998, 2997, 3877, 2997, 3874, 3877, 3874, 2997, 2995,
-	3875, 3874, 2995, 3875, 2995, 2990, 2965, 3875, 2990, 2990, 2989, 2965, 2989, 2964, 2965, 2964,
-	2989, 2986, 2967, 2964, 2986, 2986, 2978, 2967, 2960, 2959, 3869, 2959, 3868, 3869, 2959, 2925,
-	3868, 2959, 2957, 2925, 2957, 2926, 2925, 2957, 2955, 2926, 2955, 2930, 2926, 2955, 2953, 2930,
-	2953, 2932, 2930, 2953, 2951, 2932, 2951, 2935, 2932, 2951, 2949, 2935, 2925, 2465, 3868, 3868,
-	2465, 2460, 3863, 3868, 2460, 3863, 2460, 2458, 3862, 3863, 2458, 3862, 2458, 3867, 2465, 2925,
-	2923, 2463, 2465, 2923, 2464, 2463, 2923, 2548, 2545, 2618, 2548, 2618, 2619, 2550, 2548, 2619,
-	3884, 3883, 3882, 3885, 3884, 3882, 3885, 3882, 3886, 3887, 3885, 3886, 3885, 3887, 3888, 3887,
-	3889, 3888, 3890, 3888, 3889, 3890, 3891, 3888, 3892, 3891, 3890, 3893, 3892, 3890, 3893, 3890,
-	3894, 3894, 3890, 3889, 3895, 3893, 3894, 3891, 3896, 3888, 3885, 3888, 3896, 3884, 3885, 3896,
-	3897, 3891, 3892, 3898, 3897, 3892, 3898, 3892, 3893, 3899, 3898, 3893, 3899, 3893, 3895, 3900,
-	3899, 3895, 3901, 3897, 3898, 3902, 3901, 3898, 3902, 3898, 3899, 3903, 3902, 3899, 3903, 3899,
-	3900, 3904, 3903, 3900, 3905, 3901, 3902, 3906, 3905, 3902, 3906, 3902, 3903, 3907, 3906, 3903,
-	3907, 3903, 3904, 3908, 3907, 3904, 2858, 3905, 3906, 2854, 2858, 3906, 2854, 3906, 3907, 2852,
-	2854, 3907, 2852, 3907, 3908, 2841, 2852, 3908, 2841, 3908, 2835, 3908, 3904, 2836, 2835, 3908,
-	2836, 3904, 3900, 2837, 2836, 3904, 2837, 2837, 3900, 2813, 3900, 3895, 2813, 2813, 3895, 2811,
-	3895, 3894, 2811, 2811, 3894, 2810, 3894, 3889, 2810, 2810, 3889, 3887, 2815, 2810, 3887, 2815,
-	3887, 2817, 3887, 3886, 2817, 2817, 3886, 3909, 3886, 3910, 3909, 3909, 3910, 3911, 3910, 3912,
-	3911, 3911, 3912, 3913, 3912, 2921, 3913, 3913, 2921, 2922, 3913, 2922, 2927, 3914, 3913, 2927,
-	3911, 3913, 3914, 3914, 2927, 2929, 3915, 3914, 2929, 3915, 2929, 3916, 2929, 2933, 3916, 3916,
-	2933, 3917, 2933, 2940, 3917, 3917, 2940, 2941, 3918, 3917, 2941, 3918, 2941, 2942, 3919, 3918,
-	2942, 3919, 2942, 2943, 3920, 3919, 2943, 3921, 3914, 3915, 3921, 3911, 3914, 3922, 3921, 3915,
-	3915, 3916, 3923, 3922, 3915, 3923, 3916, 3917, 3924, 3923, 3916, 3924, 3924, 3917, 3918, 3925,
-	3924, 3918, 3925, 3918, 3919, 3926, 3925, 3919, 3926, 3919, 3920, 3927, 3926, 3920, 3909, 3911,
-	3921, 3928, 3909, 3921, 3928, 3921, 3922, 3929, 3928, 3922, 3922, 3923, 3930, 3929, 3922, 3930,
-	3923, 3924, 3931, 3930, 3923, 3931, 3931, 3924, 3925, 3932, 3931, 3925, 3932, 3925, 3926, 3933,
-	3932, 3926, 3933, 3926, 3927, 3934, 3933, 3927, 2817, 3909, 3928, 2816, 2817, 3928, 2816, 3928,
-	3929, 2805, 2816, 3929, 3929, 3930, 2803, 2805, 3929, 2803, 3930, 3931, 2801, 2803, 3930, 2801,
-	2801, 3931, 3932, 2799, 2801, 3932, 2799, 3932, 3933, 2802, 2799, 3933, 2802, 3933, 3934, 3935,
-	2802, 3934, 3935, 3936, 2802, 3936, 2797, 2802, 3936, 3937, 2797, 3937, 2796, 2797, 3937, 2786,
-	2796, 28, 12, 14, 32, 28, 14, 32, 14, 19, 1112, 1110, 561, 560, 1112, 561,
-	1110, 1108, 561, 1108, 556, 561, 1108, 1106, 556, 1106, 555, 556, 1117, 1118, 1125, 1250,
-	54, 1251, 3938, 3208, 3192, 3192, 3193, 3938, 3193, 3209, 3938, 3939, 3196, 3208, 3196, 3939,
-	3187, 3940, 3939, 3208, 3187, 3939, 3179, 3939, 3181, 3179, 3181, 3939, 3940, 3183, 3181, 3940,
-	2581, 3942, 3941, 2580, 2581, 3941, 2580, 3941, 3230, 3941, 3236, 3230, 2580, 3230, 3228, 2578,
-	2580, 3228, 2578, 3228, 2576, 3228, 3226, 2576, 2576, 3226, 2574, 3226, 3224, 2574, 2574, 3224,
-	2573, 3224, 3221, 2573, 2573, 3221, 3635, 3221, 3231, 3635, 3635, 3231, 3780, 3231, 3233, 3780,
-	3369, 3379, 2581, 3372, 3369, 2579, 2584, 3372, 2579, 3374, 3372, 2584, 2586, 3374, 2584, 3376,
-	3374, 2586, 2588, 3376, 2586, 2588, 2591, 3376, 2591, 3378, 3376, 2591, 3943, 3378, 2591, 2592,
-	3943, 2592, 3944, 3943, 3943, 3384, 3378, 2579, 3369, 2581, 2581, 3379, 3942, 3379, 3381, 3942,
-	2592, 3519, 3944, 3509, 3519, 2592, 2590, 3509, 2592, 3512, 3509, 2590, 2594, 3512, 2590, 3514,
-	3512, 2594, 2596, 3514, 2594, 3516, 3514, 2596, 2598, 3516, 2596, 2598, 2599, 3516, 2599, 3518,
-	3516, 2599, 2626, 3518, 2626, 3524, 3518, 3519, 3521, 3944, 3945, 2634, 2635, 3945, 2635, 2638,
-	3946, 3945, 2638, 2638, 2640, 3946, 2640, 3947, 3946, 2640, 2642, 3947, 2642, 3948, 3947, 2734,
-	3948, 2642, 2732, 2734, 2642, 2732, 2642, 2641, 2730, 2732, 2641, 2730, 2641, 2699, 2726, 2730,
-	2699, 2726, 2699, 2700, 1097, 3950, 3949, 1099, 1097, 3949, 1097, 1096, 3950, 1096, 3951, 3950,
-	3951, 1096, 1093, 3952, 3951, 1093, 3952, 1093, 1092, 3952, 1092, 1085, 1086, 3951, 3952, 1085,
-	1086, 3952, 3951, 1086, 1087, 3950, 3951, 1087, 3950, 1087, 1088, 3949, 3950, 1088, 3949, 1088,
-	1061, 1088, 1060, 1061, 1088, 1066, 1060, 1062, 1099, 3949, 1061, 1062, 3949, 1062, 1063, 1099,
-	1063, 1100, 1099, 1100, 1063, 1064, 487, 1100, 1064, 487, 1064, 1000, 488, 487, 1000, 3117,
-	3126, 3142, 3116, 3117, 3142, 3133, 3120, 3125, 969, 982, 988, 969, 988, 962, 988, 961,
-	962, 961, 988, 989, 960, 961, 989, 3953, 2276, 2286, 3953, 2275, 2276, 2167, 2171, 2188,
-	2182, 2167, 2188, 2188, 2171, 2190, 2171, 2176, 2190, 2194, 2191, 2178, 2002, 2003, 3954, 2011,
-	2002, 3954, 3954, 2003, 2015, 3955, 3954, 2015, 3955, 2015, 2016, 3956, 3955, 2016, 3956, 2016,
-	2026, 3957, 3956, 2026, 3957, 2026, 2028, 2044, 3957, 2028, 2784, 2787, 3958, 2775, 2784, 3958,
-	2775, 3958, 3959, 2776, 2775, 3959, 2776, 3959, 3960, 2770, 2776, 3960, 2770, 3960, 3961, 2771,
-	2770, 3961, 2771, 3961, 3962, 2779, 2771, 3962, 2505, 2503, 2883, 3963, 2505, 2883, 3963, 2883,
-	2881, 3964, 3963, 2881, 3964, 2881, 2879, 3965, 3964, 2879, 3965, 2879, 2874, 2851, 3965, 2874,
-	2507, 2505, 3963, 3966, 2507, 3963, 3966, 3963, 3964, 3967, 3966, 3964, 3967, 3964, 3965, 3968,
-	3967, 3965, 3968, 3965, 2851, 2849, 3968, 2851, 2509, 2507, 3966, 2652, 2509, 3966, 2652, 3966,
-	3967, 2658, 2652, 3967, 2658, 3967, 3968, 2664, 2658, 3968, 2664, 3968, 2849, 2670, 2664, 2849,
-	3046, 3038, 3033, 3046, 3033, 3047, 3033, 3032, 3047, 3047, 3032, 3059, 3032, 3034, 3059, 2037,
-	123, 2046, 2043, 2037, 2046, 3969, 626, 638, 3969, 638, 640, 1186, 3969, 640, 624, 626,
-	3969, 3970, 624, 3969, 3970, 3969, 1186, 1184, 3970, 1186, 622, 624, 3970, 3971, 622, 3970,
-	3971, 3970, 1184, 1182, 3971, 1184, 620, 622, 3971, 613, 620, 3971, 613, 3971, 1182, 614,
-	613, 1182, 2910, 2914, 3972, 2909, 2910, 3972, 3972, 2914, 3973, 2914, 2915, 3973, 3973, 2915,
-	3974, 2915, 2916, 3974, 3974, 2916, 2917, 3975, 3974, 2917, 3975, 2917, 2918, 3976, 3975, 2918,
-	3976, 2918, 2919, 3977, 3976, 2919, 3977, 2919, 2920, 3978, 3977, 2920, 3978, 2920, 2921, 3912,
-	3978, 2921, 3973, 3974, 3979, 3979, 3974, 3975, 3980, 3973, 3979, 3972, 3973, 3980, 3981, 3972,
-	3980, 2909, 3972, 3981, 3982, 2909, 3981, 2908, 2909, 3982, 2866, 2908, 3982, 3983, 3976, 3977,
-	3983, 3984, 3976, 3984, 3979, 3975, 3984, 3975, 3976, 3985, 3978, 3912, 3985, 3986, 3978, 3986,
-	3983, 3977, 3986, 3977, 3978, 2866, 3982, 3905, 2858, 2866, 3905, 3982, 3981, 3901, 3905, 3982,
-	3901, 3901, 3981, 3897, 3981, 3980, 3897, 3897, 3980, 3891, 3980, 3979, 3891, 3891, 3979, 3984,
-	3896, 3891, 3984, 3896, 3984, 3983, 3884, 3896, 3983, 3884, 3983, 3986, 3883, 3884, 3986, 3883,
-	3986, 3985, 3882, 3883, 3985, 3882, 3985, 3910, 3910, 3985, 3912, 3886, 3882, 3910, 460, 451,
-	452, 3733, 8, 6, 8, 3733, 3734, 1089, 8, 3734, 1089, 3734, 3735, 1081, 1089, 3735,
-	1081, 3735, 3669, 1079, 1081, 3669, 957, 877, 878, 877, 957, 958, 979, 970, 968, 979,
-	968, 1579, 968, 1577, 1579, 968, 966, 1577, 966, 1575, 1577, 966, 965, 1575, 965, 1573,
-	1575, 965, 936, 1573, 936, 1571, 1573, 1571, 936, 935, 1569, 1571, 935, 1572, 1569, 935,
-	934, 1572, 935, 1579, 1582, 979, 1582, 972, 979, 1582, 1584, 972, 1584, 973, 972, 973,
-	1584, 1585, 975, 973, 1585, 975, 1585, 1587, 978, 975, 1587, 981, 978, 1587, 1589, 981,
-	1587, 981, 1589, 1591, 2406, 981, 1591, 2406, 1591, 1593, 2384, 2406, 1593, 2384, 1593, 1595,
-	2383, 2384, 1595, 2383, 1595, 1597, 2350, 2383, 1597, 2350, 1597, 1599, 2351, 2350, 1599, 2351,
-	1599, 1601, 2353, 2351, 1601, 727, 2407, 2408, 733, 727, 2408, 733, 2408, 752, 2408, 755,
-	752, 2408, 2399, 755, 2399, 757, 755, 2399, 2395, 757, 2395, 759, 757, 2395, 2373, 759,
-	2373, 761, 759, 761, 2373, 2372, 762, 761, 2372, 765, 762, 2372, 2371, 765, 2372, 752,
-	750, 733, 750, 728, 733, 750, 749, 728, 749, 729, 728, 729, 749, 747, 732, 729,
-	747, 732, 747, 745, 734, 732, 745, 737, 734, 745, 742, 737, 745, 809, 797, 793,
-	809, 793, 794, 811, 809, 794, 811, 794, 795, 817, 811, 795, 817, 795, 1873, 795,
-	1884, 1873, 795, 790, 1884, 790, 1886, 1884, 790, 785, 1886, 785, 1888, 1886, 785, 778,
-	1888, 778, 1890, 1888, 1890, 778, 777, 1891, 1890, 777, 1894, 1891, 777, 776, 1894, 777,
-	1873, 1875, 817, 1875, 812, 817, 1875, 1877, 812, 1877, 813, 812, 813, 1877, 1878, 816,
-	813, 1878, 816, 1878, 1880, 818, 816, 1880, 818, 1880, 1882, 821, 818, 1882, 827, 821,
-	1882, 1895, 827, 1882, 827, 1895, 1897, 829, 827, 1897, 829, 1897, 1899, 831, 829, 1899,
-	831, 1899, 1901, 833, 831, 1901, 833, 1901, 1903, 835, 833, 1903, 835, 1903, 1905, 837,
-	835, 1905, 709, 710, 584, 710, 623, 584, 623, 583, 584, 1228, 1165, 1167, 1228, 1229,
-	1165, 1229, 1164, 1165, 2978, 2979, 2968, 2979, 2982, 2970, 2982, 2972, 2970, 2982, 2984, 2972,
-	2984, 2974, 2972, 2974, 2984, 2992, 2977, 2974, 2992, 1058, 1065, 3667, 1058, 3667, 3665, 1051,
-	1058, 3665, 1051, 3665, 3663, 1044, 1051, 3663, 1044, 3663, 3661, 1039, 1044, 3661, 1039, 3661,
-	3657, 1040, 1039, 3657, 1040, 3657, 3658, 1042, 1040, 3658, 3766, 3655, 3651, 3762, 3766, 3651,
-	3762, 3651, 3649, 3760, 3762, 3649, 3760, 3649, 3646, 3758, 3760, 3646, 3758, 3646, 3644, 3757,
-	3758, 3644, 3644, 3643, 3757, 3643, 3754, 3757, 3754, 3643, 3641, 3752, 3754, 3641, 3752, 3641,
-	3636, 3751, 3752, 3636, 3636, 3637, 3751, 3637, 3750, 3751, 3750, 3637, 3652, 3765, 3750, 3652,
-	331, 328, 2140, 2139, 331, 2140, 328, 327, 2140, 327, 2141, 2140, 2141, 327, 325, 3672,
-	2141, 325, 3672, 325, 323, 3670, 3672, 323, 3670, 323, 321, 3668, 3670, 321, 3668, 321,
-	318, 3148, 3185, 3171, 3149, 3148, 3171, 3149, 3171, 3167, 3151, 3149, 3167, 3153, 3166, 3172,
-	3154, 3153, 3172, 3154, 3172, 3156, 3172, 3174, 3156, 3156, 3174, 3176, 3159, 3156, 3176, 3159,
-	3176, 3178, 3161, 3159, 3178, 3161, 3178, 3162, 3178, 3180, 3162, 3162, 3180, 3165, 3180, 3182,
-	3165, 275, 273, 3747, 275, 3747, 3745, 277, 275, 3745, 277, 3745, 3743, 279, 277, 3743,
-	279, 3743, 3741, 281, 279, 3741, 281, 3741, 3737, 283, 281, 3737, 283, 3737, 3738, 285,
-	283, 3738, 3140, 3146, 3150, 3138, 3140, 3150, 3138, 3150, 3152, 3136, 3138, 3152, 3136, 3152,
-	3155, 3135, 3136, 3155, 3155, 3157, 3135, 3157, 3132, 3135, 3132, 3157, 3158, 3130, 3132, 3158,
-	3130, 3158, 3160, 3129, 3130, 3160, 3160, 3163, 3129, 3163, 3128, 3129, 3128, 3163, 3164, 3143,
-	3128, 3164, 3797, 1473, 1466, 3795, 3797, 1466, 3795, 1466, 1462, 3793, 3795, 1462, 3793, 1462,
-	1437, 3791, 3793, 1437, 3791, 1437, 1436, 3787, 3791, 1436, 3787, 1436, 1435, 3790, 3787, 1435,
-	3304, 3317, 3321, 3306, 3304, 3321, 3321, 3336, 3306, 3336, 3307, 3306, 3336, 3335, 3307, 3335,
-	3309, 3307, 3335, 3333, 3309, 3333, 3311, 3309, 3333, 3334, 3311, 3334, 3313, 3311, 3313, 3334,
-	3337, 3316, 3313, 3337, 1381, 1278, 1279, 1383, 1381, 1279, 1381, 1379, 1278, 1379, 1280, 1278,
-	1280, 1379, 1378, 1282, 1280, 1378, 1282, 1378, 1376, 1284, 1282, 1376, 1284, 1376, 1373, 1286,
-	1284, 1373, 1279, 1288, 1383, 1288, 1386, 1383, 1288, 1290, 1386, 1290, 1388, 1386, 1290, 1292,
-	1388, 1292, 1390, 1388, 1292, 1294, 1390, 1294, 1392, 1390, 1392, 1294, 1297, 1393, 1392, 1297,
-	1396, 1393, 1297, 1299, 1396, 1297, 1369, 1372, 3796, 1366, 1369, 3796, 1366, 3796, 3794, 1363,
-	1366, 3794, 1363, 3794, 3792, 1360, 1363, 3792, 1360, 3792, 3788, 1359, 1360, 3788, 1359, 3788,
-	3789, 1361, 1359, 3789, 3296, 3298, 3305, 3305, 3308, 3296, 3308, 3294, 3296, 3308, 3310, 3294,
-	3310, 3292, 3294, 3310, 3312, 3292, 3312, 3290, 3292, 3312, 3314, 3290, 3314, 3288, 3290, 3288,
-	3314, 3315, 3287, 3288, 3315, 3276, 3988, 3987, 3277, 3276, 3987, 3276, 3275, 3988, 3275, 3989,
-	3988, 3275, 3273, 3989, 3273, 3990, 3989, 3273, 3274, 3990, 3274, 3991, 3990, 3991, 3274, 3279,
-	3992, 3991, 3279, 3987, 3993, 3277, 3993, 3278, 3277, 3993, 3994, 3278, 3994, 3284, 3278, 3992,
-	3252, 3991, 3252, 3242, 3991, 3991, 3242, 3241, 3990, 3991, 3241, 3990, 3241, 3244, 3989, 3990,
-	3244, 3989, 3244, 3246, 3988, 3989, 3246, 3988, 3246, 3248, 3987, 3988, 3248, 3987, 3248, 3993,
-	3248, 3249, 3993, 3993, 3249, 3994, 3249, 3253, 3994, 3995, 1341, 1342, 3995, 1342, 1344, 3996,
-	3995, 1344, 3996, 1344, 1346, 3997, 3996, 1346, 3997, 1346, 1348, 3998, 3997, 1348, 3998, 1348,
-	1350, 3999, 3998, 1350, 3999, 1350, 1356, 4000, 3999, 1356, 4000, 908, 3999, 908, 906, 3999,
-	3999, 906, 3998, 906, 904, 3998, 3998, 904, 3997, 904, 902, 3997, 3997, 902, 3996, 902,
-	900, 3996, 3996, 900, 3995, 900, 898, 3995, 898, 892, 1341, 3995, 898, 1341, 1341, 892,
-	1340, 892, 890, 1340, 1340, 890, 1339, 890, 887, 1339, 887, 884, 1339, 884, 1338, 1339,
-	1338, 884, 883, 1337, 1338, 883, 1337, 883, 886, 1320, 1018, 1017, 1321, 1320, 1017, 1321,
-	1017, 1016, 1322, 1321, 1016, 1674, 1672, 1660, 3471, 3469, 3457, 3471, 3457, 3458, 3473, 3471,
-	3458, 3473, 3458, 3459, 3475, 3473, 3459, 3475, 3459, 3477, 3459, 3460, 3477, 3477, 3460, 3480,
-	3460, 3464, 3480, 1625, 1628, 1783, 1623, 1625, 1783, 1623, 1783, 1782, 1621, 1623, 1782, 1621,
-	1782, 1779, 1618, 1621, 1779, 1618, 1779, 1776, 1617, 1618, 1776, 1617, 1776, 1777, 1619, 1617,
-	1777, 3436, 3438, 3445, 3445, 3448, 3436, 3448, 3434, 3436, 3448, 3450, 3434, 3450, 3428, 3434,
-	3450, 3452, 3428, 3452, 3427, 3428, 3452, 3454, 3427, 3454, 3429, 3427, 3429, 3454, 3461, 3431,
-	3429, 3461, 1657, 1654, 1552, 1554, 1657, 1552, 1654, 1653, 1552, 1653, 1549, 1552, 1549, 1653,
-	1651, 1547, 1549, 1651, 1547, 1651, 1649, 1545, 1547, 1649, 1545, 1649, 1647, 1543, 1545, 1647,
-	1543, 1647, 1638, 1534, 1543, 1638, 1638, 1636, 1534, 1636, 1533, 1534, 1636, 1634, 1533, 1634,
-	1535, 1533, 1535, 1634, 1633, 1537, 1535, 1633, 1537, 1633, 1631, 1539, 1537, 1631, 1539, 1631,
-	1627, 1541, 1539, 1627, 1592, 1603, 1605, 1594, 1592, 1605, 1594, 1605, 1607, 1596, 1594, 1607,
-	1596, 1607, 1609, 1598, 1596, 1609, 1598, 1609, 1611, 1600, 1598, 1611, 1600, 1611, 1613, 1602,
-	1600, 1613, 1557, 1559, 1570, 1570, 1559, 1574, 1559, 1561, 1574, 1574, 1561, 1576, 1561, 1563,
-	1576, 1576, 1563, 1578, 1563, 1565, 1578, 1578, 1565, 1580, 1565, 1524, 1580, 1580, 1524, 1581,
-	1524, 1519, 1581, 1519, 1520, 1581, 1520, 1583, 1581, 1583, 1520, 1526, 1586, 1583, 1526, 1586,
-	1526, 1527, 1588, 1586, 1527, 1847, 1846, 1892, 1893, 1847, 1892, 1892, 1846, 1889, 1846, 1848,
-	1889, 1889, 1848, 1887, 1848, 1850, 1887, 1887, 1850, 1885, 1850, 1857, 1885, 1885, 1857, 1872,
-	1857, 1864, 1872, 770, 781, 758, 758, 781, 756, 781, 786, 756, 756, 786, 754, 786,
-	791, 754, 754, 791, 753, 791, 796, 753, 753, 796, 751, 796, 798, 751, 798, 801,
-	751, 801, 748, 751, 748, 801, 802, 746, 748, 802, 746, 802, 805, 744, 746, 805,
-	4003, 4002, 4001, 4003, 4005, 4004, 4003, 4004, 4006, 4003, 4006, 4007, 4003, 4007, 4008, 4003,
-	4008, 4009, 4003, 4011, 4010, 4003, 4010, 4012, 4003, 4012, 4013, 4003, 4013, 4014, 4016, 4015,
-	4011, 4016, 4017, 4015, 4016, 4018, 4017, 4016, 4019, 4018, 4016, 4020, 4005, 4022, 4021, 4020,
-	4022, 4023, 4019, 4022, 4024, 4023, 4022, 4025, 4024, 4022, 4026, 4025, 4016, 4027, 4026, 4016,
-	4028, 4027, 4016, 4029, 4028, 4016, 4030, 4029, 4022, 4032, 4031, 4022, 4031, 4033, 4022, 4033,
-	4034, 4022, 4034, 4035, 4022, 4037, 4036, 4022, 4036, 4038, 4022, 4038, 4039, 4022, 4041, 4040,
-	4022, 4043, 4042, 4022, 4042, 4044, 4022, 4044, 4045, 4016, 4045, 4046, 4016, 4046, 4047, 4016,
-	4047, 4048, 4016, 4048, 4049, 4016, 4051, 4050, 4053, 4050, 4052, 4053, 4052, 4054, 4016, 4054,
-	4055, 4016, 4055, 4056, 4016, 4056, 4057, 4016, 4057, 4058, 4053, 4059, 4051, 4053, 4049, 4060,
-	4061, 4058, 4002, 4061, 4063, 4062, 4061, 4062, 4064, 4061, 4064, 4065, 4061, 4065, 4066, 4061,
-	4001, 4063, 4053, 4068, 4067, 4053, 4069, 4068 };
-#pragma endregion
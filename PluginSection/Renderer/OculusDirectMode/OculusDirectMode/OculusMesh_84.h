@@ -1,134 +0,0 @@
-/********************************************************************
-Vireio Perception: Open-Source Stereoscopic 3D Driver
-Copyright (C) 2012 Andres Hernandez
-This file was exported from Vireio using Oculus Avatar SDK.
-Data Copyright : Copyright 2014-2016 Oculus VR, LLC All Rights reserved.
-
-Vireio Perception Version History :.
-v1.0.0 2012 by Andres Hernandez.
-v1.0.X 2013 by John Hicks, Neil Schneider.
-v1.1.x 2013 by Primary Coding Author : Chris Drain.
-Team Support : John Hicks, Phil Larkson, Neil Schneider.
-v2.0.x 2013 by Denis Reischl, Neil Schneider, Joshua Brown.
-v4.0.x 2015 by Denis Reischl, Grant Bagwell, Simon Brown, Samuel Austin.
-and Neil Schneider.
-
-This program is free software : you can redistribute it and / or modify.
-it under the terms of the GNU Lesser General Public License as published by.
-the Free Software Foundation, either version 3 of the License, or.
-(at your option) any later version..
-
-This program is distributed in the hope that it will be useful,.
-but WITHOUT ANY WARRANTY; without even the implied warranty of.
-MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.See the.
-GNU Lesser General Public License for more details..
-
-You should have received a copy of the GNU Lesser General Public License.
-along with this program.If not, see < http://www.gnu.org/licenses/>..
-********************************************************************/
-
-const uint32_t unAvatarVertexCount_84 = 84;
-const ovrAvatarMeshVertex asAvatarVertices_84[] = {
-	{ -0.047272,0.050450,-0.066125,-0.572132,-0.060427,-0.817932,0.819395,0.001000,-0.573229,-1.000000,0.400000,0.999999,0,1,0,0,0.000058,0.999942,0.000000,0.000000},
-	{ -0.024763,0.050452,-0.077463,-0.300135,-0.056230,-0.952238,0.953740,0.000000,-0.300633,-1.000000,0.450000,0.999999,0,1,0,0,0.000018,0.999982,0.000000,0.000000},
-	{ -0.023698,0.000005,-0.074837,-0.304607,-0.003332,-0.952473,0.952478,0.000000,-0.304608,-1.000000,0.450000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.045076,0.000005,-0.063946,-0.579967,-0.007590,-0.814604,0.814628,0.000000,-0.579984,-1.000000,0.400000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.065218,0.050447,-0.048405,-0.794281,-0.067082,-0.603835,0.605117,0.001505,-0.796135,-1.000000,0.350000,1.000000,0,1,0,0,0.000122,0.999878,0.000000,0.000000},
-	{ -0.062042,0.000005,-0.046982,-0.801927,-0.014311,-0.597251,0.597310,0.000000,-0.802010,-1.000000,0.350000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.076802,0.050431,-0.026033,-0.942858,-0.074685,-0.324718,0.325479,0.002083,-0.945547,-1.000000,0.300000,1.000000,0,1,0,0,0.000440,0.999560,0.000000,0.000000},
-	{ -0.072934,0.000005,-0.025606,-0.947738,-0.021856,-0.318299,0.318366,0.000000,-0.947968,-1.000000,0.300000,0.000001,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.080796,0.050397,-0.001285,-0.996717,-0.080099,0.011787,-0.011775,0.000000,-0.999931,-1.000000,0.250000,1.000000,0,1,0,0,0.001098,0.998902,0.000000,0.000000},
-	{ -0.076688,0.000005,-0.001911,-0.999628,-0.026903,0.004522,-0.004519,0.000000,-0.999990,-1.000000,0.250000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.076621,0.050426,0.023623,-0.935662,-0.080423,0.343611,-0.344497,-0.003023,-0.938782,-1.000000,0.200000,1.000000,0,1,0,0,0.000528,0.999472,0.000000,0.000000},
-	{ -0.072935,0.000005,0.021785,-0.945272,-0.027159,0.325152,-0.325255,0.000000,-0.945626,-1.000000,0.200000,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ -0.064829,0.050442,0.045995,-0.778070,-0.077827,0.623338,-0.625060,-0.002822,-0.780572,-1.000000,0.150000,1.000000,0,1,0,0,0.000216,0.999784,0.000000,0.000000},
-	{ -0.062041,0.000005,0.043160,-0.795970,-0.024444,0.604842,-0.605011,0.000000,-0.796217,-1.000000,0.150000,0.000001,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ -0.046788,0.050444,0.063471,-0.556629,-0.074792,0.827387,-0.829628,-0.001961,-0.558314,-1.000000,0.100001,1.000000,0,1,0,0,0.000175,0.999825,0.000000,0.000000},
-	{ -0.045076,0.000005,0.060125,-0.574457,-0.021538,0.818252,-0.818437,0.000000,-0.574596,-1.000000,0.100001,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ -0.024446,0.050441,0.074670,-0.296298,-0.073832,0.952238,-0.954831,0.000000,-0.297149,-1.000000,0.050001,0.999999,0,1,0,0,0.000232,0.999768,0.000000,0.000000},
-	{ -0.023698,0.000005,0.071016,-0.304084,-0.020537,0.952424,-0.952624,0.000000,-0.304151,-1.000000,0.050001,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.000000,0.050440,0.078482,-0.000002,-0.073926,0.997264,-0.999935,-0.011433,-0.000000,-1.000000,0.000000,1.000000,0,1,0,0,0.000262,0.999738,0.000000,0.000000},
-	{ -0.000000,0.000005,0.074770,-0.000001,-0.020669,0.999786,-0.999995,-0.003240,-0.000000,-1.000000,0.000000,0.000001,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.024446,0.050441,0.074670,0.296293,-0.073833,0.952239,-0.954832,0.000000,0.297144,-1.000000,0.950000,1.000000,0,1,0,0,0.000232,0.999768,0.000000,0.000000},
-	{ 0.000000,0.050440,0.078482,-0.000002,-0.073926,0.997264,-0.999935,0.011434,0.000000,-1.000000,1.000000,1.000000,0,1,0,0,0.000262,0.999738,0.000000,0.000000},
-	{ -0.000000,0.000005,0.074770,-0.000001,-0.020669,0.999786,-0.999995,0.003240,0.000000,-1.000000,1.000000,0.000001,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.023698,0.000005,0.071016,0.304082,-0.020538,0.952424,-0.952625,0.000000,0.304148,-1.000000,0.950000,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.046788,0.050444,0.063471,0.556629,-0.074794,0.827388,-0.829635,0.001802,0.558303,-1.000000,0.900000,1.000000,0,1,0,0,0.000175,0.999825,0.000000,0.000000},
-	{ 0.045076,0.000005,0.060125,0.574456,-0.021540,0.818252,-0.818438,0.000000,0.574595,-1.000000,0.900000,0.000001,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.064829,0.050442,0.045995,0.778070,-0.077829,0.623337,-0.625049,0.002988,0.780580,-1.000000,0.850000,1.000000,0,1,0,0,0.000215,0.999785,0.000000,0.000000},
-	{ 0.062041,0.000005,0.043160,0.795971,-0.024446,0.604841,-0.605010,0.000000,0.796218,-1.000000,0.850000,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.076621,0.050426,0.023623,0.935660,-0.080425,0.343616,-0.344506,0.002968,0.938779,-1.000000,0.800000,0.999999,0,1,0,0,0.000528,0.999472,0.000000,0.000000},
-	{ 0.072935,0.000005,0.021785,0.945271,-0.027161,0.325154,-0.325261,0.000000,0.945624,-1.000000,0.800000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.080796,0.050397,-0.001285,0.996717,-0.080102,0.011790,-0.011773,0.000000,0.999931,-1.000000,0.750000,0.999999,0,1,0,0,0.001098,0.998902,0.000000,0.000000},
-	{ 0.076688,0.000005,-0.001911,0.999628,-0.026905,0.004524,-0.004517,0.000000,0.999990,-1.000000,0.750000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.076802,0.050431,-0.026033,0.942857,-0.074687,-0.324720,0.325481,-0.002083,0.945546,-1.000000,0.700000,1.000000,0,1,0,0,0.000440,0.999560,0.000000,0.000000},
-	{ 0.072934,0.000005,-0.025606,0.947738,-0.021858,-0.318300,0.318367,0.000000,0.947968,-1.000000,0.700000,0.000001,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065218,0.050447,-0.048405,0.794299,-0.067087,-0.603812,0.605092,-0.001545,0.796154,-1.000000,0.650000,1.000000,0,1,0,0,0.000121,0.999879,0.000000,0.000000},
-	{ 0.062042,0.000005,-0.046982,0.801935,-0.014316,-0.597239,0.597299,0.000000,0.802019,-1.000000,0.650000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.047272,0.050450,-0.066126,0.572214,-0.060442,-0.817874,0.819340,0.000000,0.573308,-1.000000,0.600000,1.000000,0,1,0,0,0.000058,0.999942,0.000000,0.000000},
-	{ 0.045076,0.000005,-0.063946,0.580006,-0.007605,-0.814577,0.814600,0.000000,0.580024,-1.000000,0.600000,0.000001,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024764,0.050452,-0.077465,0.300102,-0.056250,-0.952247,0.953750,0.000000,0.300602,-1.000000,0.550000,1.000000,0,1,0,0,0.000017,0.999983,0.000000,0.000000},
-	{ 0.023698,0.000005,-0.074837,0.304591,-0.003351,-0.952477,0.952483,0.000000,0.304592,-1.000000,0.550000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,0.050453,-0.081346,-0.000105,-0.054874,-0.998493,1.000000,0.000000,0.000000,-1.000000,0.500000,1.000000,0,1,0,0,0.000000,1.000000,0.000000,0.000000},
-	{ -0.000000,0.000005,-0.078590,-0.000050,-0.001955,-0.999998,1.000000,0.000000,0.000000,-1.000000,0.500000,0.000001,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.047272,0.050450,-0.066125,-0.572132,-0.060427,-0.817932,0.819395,0.001000,-0.573229,1.000000,0.400000,0.999999,0,1,0,0,0.000058,0.999942,0.000000,0.000000},
-	{ -0.045076,0.000005,-0.063946,-0.579967,-0.007590,-0.814604,0.814628,0.000000,-0.579984,1.000000,0.400000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.023698,0.000005,-0.074837,-0.304607,-0.003332,-0.952473,0.952478,0.000000,-0.304608,1.000000,0.450000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.024763,0.050452,-0.077463,-0.300135,-0.056230,-0.952238,0.953740,0.000000,-0.300633,1.000000,0.450000,0.999999,0,1,0,0,0.000018,0.999982,0.000000,0.000000},
-	{ -0.065218,0.050447,-0.048405,-0.794281,-0.067082,-0.603835,0.605117,0.001505,-0.796135,1.000000,0.350000,1.000000,0,1,0,0,0.000122,0.999878,0.000000,0.000000},
-	{ -0.062042,0.000005,-0.046982,-0.801927,-0.014311,-0.597251,0.597310,0.000000,-0.802010,1.000000,0.350000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.076802,0.050431,-0.026033,-0.942858,-0.074685,-0.324718,0.325479,0.002083,-0.945547,1.000000,0.300000,1.000000,0,1,0,0,0.000440,0.999560,0.000000,0.000000},
-	{ -0.072934,0.000005,-0.025606,-0.947738,-0.021856,-0.318299,0.318366,0.000000,-0.947968,1.000000,0.300000,0.000001,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.080796,0.050397,-0.001285,-0.996717,-0.080099,0.011787,-0.011775,0.000000,-0.999931,1.000000,0.250000,1.000000,0,1,0,0,0.001098,0.998902,0.000000,0.000000},
-	{ -0.076688,0.000005,-0.001911,-0.999628,-0.026903,0.004522,-0.004519,0.000000,-0.999990,1.000000,0.250000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.076621,0.050426,0.023623,-0.935662,-0.080423,0.343611,-0.344497,-0.003023,-0.938782,1.000000,0.200000,1.000000,0,1,0,0,0.000528,0.999472,0.000000,0.000000},
-	{ -0.072935,0.000005,0.021785,-0.945272,-0.027159,0.325152,-0.325255,0.000000,-0.945626,1.000000,0.200000,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ -0.064829,0.050442,0.045995,-0.778070,-0.077827,0.623338,-0.625060,-0.002822,-0.780572,1.000000,0.150000,1.000000,0,1,0,0,0.000216,0.999784,0.000000,0.000000},
-	{ -0.062041,0.000005,0.043160,-0.795970,-0.024444,0.604842,-0.605011,0.000000,-0.796217,1.000000,0.150000,0.000001,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ -0.046788,0.050444,0.063471,-0.556629,-0.074792,0.827387,-0.829628,-0.001961,-0.558314,1.000000,0.100001,1.000000,0,1,0,0,0.000175,0.999825,0.000000,0.000000},
-	{ -0.045076,0.000005,0.060125,-0.574457,-0.021538,0.818252,-0.818437,0.000000,-0.574596,1.000000,0.100001,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ -0.024446,0.050441,0.074670,-0.296298,-0.073832,0.952238,-0.954831,0.000000,-0.297149,1.000000,0.050001,0.999999,0,1,0,0,0.000232,0.999768,0.000000,0.000000},
-	{ -0.023698,0.000005,0.071016,-0.304084,-0.020537,0.952424,-0.952624,0.000000,-0.304151,1.000000,0.050001,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.000000,0.050440,0.078482,-0.000002,-0.073926,0.997264,-0.999935,-0.011433,-0.000000,1.000000,0.000000,1.000000,0,1,0,0,0.000262,0.999738,0.000000,0.000000},
-	{ -0.000000,0.000005,0.074770,-0.000001,-0.020669,0.999786,-0.999995,-0.003240,-0.000000,1.000000,0.000000,0.000001,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.024446,0.050441,0.074670,0.296293,-0.073833,0.952239,-0.954832,0.000000,0.297144,1.000000,0.950000,1.000000,0,1,0,0,0.000232,0.999768,0.000000,0.000000},
-	{ 0.023698,0.000005,0.071016,0.304082,-0.020538,0.952424,-0.952625,0.000000,0.304148,1.000000,0.950000,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ -0.000000,0.000005,0.074770,-0.000001,-0.020669,0.999786,-0.999995,0.003240,0.000000,1.000000,1.000000,0.000001,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.000000,0.050440,0.078482,-0.000002,-0.073926,0.997264,-0.999935,0.011434,0.000000,1.000000,1.000000,1.000000,0,1,0,0,0.000262,0.999738,0.000000,0.000000},
-	{ 0.046788,0.050444,0.063471,0.556629,-0.074794,0.827388,-0.829635,0.001802,0.558303,1.000000,0.900000,1.000000,0,1,0,0,0.000175,0.999825,0.000000,0.000000},
-	{ 0.045076,0.000005,0.060125,0.574456,-0.021540,0.818252,-0.818438,0.000000,0.574595,1.000000,0.900000,0.000001,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.064829,0.050442,0.045995,0.778070,-0.077829,0.623337,-0.625049,0.002988,0.780580,1.000000,0.850000,1.000000,0,1,0,0,0.000215,0.999785,0.000000,0.000000},
-	{ 0.062041,0.000005,0.043160,0.795971,-0.024446,0.604841,-0.605010,0.000000,0.796218,1.000000,0.850000,0.000000,0,1,0,0,0.999999,0.000001,0.000000,0.000000},
-	{ 0.076621,0.050426,0.023623,0.935660,-0.080425,0.343616,-0.344506,0.002968,0.938779,1.000000,0.800000,0.999999,0,1,0,0,0.000528,0.999472,0.000000,0.000000},
-	{ 0.072935,0.000005,0.021785,0.945271,-0.027161,0.325154,-0.325261,0.000000,0.945624,1.000000,0.800000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.080796,0.050397,-0.001285,0.996717,-0.080102,0.011790,-0.011773,0.000000,0.999931,1.000000,0.750000,0.999999,0,1,0,0,0.001098,0.998902,0.000000,0.000000},
-	{ 0.076688,0.000005,-0.001911,0.999628,-0.026905,0.004524,-0.004517,0.000000,0.999990,1.000000,0.750000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.076802,0.050431,-0.026033,0.942857,-0.074687,-0.324720,0.325481,-0.002083,0.945546,1.000000,0.700000,1.000000,0,1,0,0,0.000440,0.999560,0.000000,0.000000},
-	{ 0.072934,0.000005,-0.025606,0.947738,-0.021858,-0.318300,0.318367,0.000000,0.947968,1.000000,0.700000,0.000001,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.065218,0.050447,-0.048405,0.794299,-0.067087,-0.603812,0.605092,-0.001545,0.796154,1.000000,0.650000,1.000000,0,1,0,0,0.000121,0.999879,0.000000,0.000000},
-	{ 0.062042,0.000005,-0.046982,0.801935,-0.014316,-0.597239,0.597299,0.000000,0.802019,1.000000,0.650000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.047272,0.050450,-0.066126,0.572214,-0.060442,-0.817874,0.819340,0.000000,0.573308,1.000000,0.600000,1.000000,0,1,0,0,0.000058,0.999942,0.000000,0.000000},
-	{ 0.045076,0.000005,-0.063946,0.580006,-0.007605,-0.814577,0.814600,0.000000,0.580023,1.000000,0.600000,0.000001,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ 0.024764,0.050452,-0.077465,0.300102,-0.056250,-0.952247,0.953750,0.000000,0.300602,1.000000,0.550000,1.000000,0,1,0,0,0.000017,0.999983,0.000000,0.000000},
-	{ 0.023698,0.000005,-0.074837,0.304591,-0.003351,-0.952477,0.952483,0.000000,0.304592,1.000000,0.550000,0.000000,0,1,0,0,1.000000,0.000000,0.000000,0.000000},
-	{ -0.000000,0.050453,-0.081346,-0.000105,-0.054874,-0.998493,1.000000,0.000000,0.000000,1.000000,0.500000,1.000000,0,1,0,0,0.000000,1.000000,0.000000,0.000000},
-	{ -0.000000,0.000005,-0.078590,-0.000050,-0.001955,-0.999998,1.000000,0.000000,0.000000,1.000000,0.500000,0.000001,0,1,0,0,1.000000,0.000000,0.000000,0.000000}};
-
-const uint32_t unAvatarIndexCount_84 = 240;
-const uint32_t aunAvatarVertices_84[] = {
-2,1,0,3,2,0,3,0,4,5,3,4,5,4,6,7,
-5,6,7,6,8,9,7,8,9,8,10,11,9,10,11,10,
-12,13,11,12,13,12,14,15,13,14,15,14,16,17,15,16,
-17,16,18,19,17,18,22,21,20,23,22,20,23,20,24,25,
-23,24,25,24,26,27,25,26,27,26,28,29,27,28,29,28,
-30,31,29,30,31,30,32,33,31,32,33,32,34,35,33,34,
-35,34,36,37,35,36,37,36,38,39,37,38,39,38,40,41,
-39,40,41,40,1,2,41,1,44,43,42,45,44,42,42,43,
-46,43,47,46,46,47,48,47,49,48,48,49,50,49,51,50,
-50,51,52,51,53,52,52,53,54,53,55,54,54,55,56,55,
-57,56,56,57,58,57,59,58,58,59,60,59,61,60,64,63,
-62,65,64,62,62,63,66,63,67,66,66,67,68,67,69,68,
-68,69,70,69,71,70,70,71,72,71,73,72,72,73,74,73,
-75,74,74,75,76,75,77,76,76,77,78,77,79,78,78,79,
-80,79,81,80,80,81,82,81,83,82,82,83,45,83,44,45};
-
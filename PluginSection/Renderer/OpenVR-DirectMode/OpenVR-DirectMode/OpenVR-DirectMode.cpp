@@ -145,6 +145,7 @@ m_pcContextTemporary(nullptr),
 m_ulOverlayHandle(0),
 m_ulOverlayThumbnailHandle(0),
 m_bHotkeySwitch(false),
+m_psInput(nullptr),
 m_pbZoomOut(nullptr),
 m_pcVSGeometry11(nullptr),
 m_pcVLGeometry11(nullptr),
@@ -457,6 +458,9 @@ m_bRenderModelsCreated(false)
 ***/
 OpenVR_DirectMode::~OpenVR_DirectMode()
 {
+	// no render model load must run past this point, the tracker node might shut down OpenVR any time
+	m_cAssetLoader.Shutdown();
+
 	for (UINT unI = 0; unI < (UINT)m_asRenderModels.size(); unI++)
 	{
 		SAFE_RELEASE(m_asRenderModels[unI].pcIndexBuffer);
@@ -569,6 +573,8 @@ LPWSTR OpenVR_DirectMode::GetDecommanderName(DWORD dwDecommanderIndex)
 			break;
 		case HUDTexture9:
 			break;
+		case OpenVR_Decommanders::Input:
+			return VLink::Name(VLink::_L::InputData);
 	}
 
 	return L"x";
@@ -609,6 +615,8 @@ DWORD OpenVR_DirectMode::GetDecommanderType(DWORD dwDecommanderIndex)
 			break;
 		case HUDTexture9:
 			break;
+		case OpenVR_Decommanders::Input:
+			return VLink::Link(VLink::_L::InputData);
 	}
 
 	return 0;
@@ -656,6 +664,11 @@ void OpenVR_DirectMode::SetInputPointer(DWORD dwDecommanderIndex, void* pData)
 			break;
 		case HUDTexture9:
 			break;
+		case OpenVR_Decommanders::Input:
+			m_psInput = (InputData*)pData;
+			if ((m_psInput) && (m_psInput->pcSnapshot))
+				m_psInput->pcSnapshot->Bind(VK_F11);
+			break;
 	}
 }
 
@@ -686,7 +699,7 @@ void* OpenVR_DirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int e
 
 	/*if (!m_bHotkeySwitch)
 	{
-	if (GetAsyncKeyState(VK_F11))
+	if ((m_psInput) && (m_psInput->pcSnapshot) && (m_psInput->pcSnapshot->IsDown(VK_F11)))
 	{
 	m_bHotkeySwitch = true;
 	}
@@ -866,10 +879,10 @@ void* OpenVR_DirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int e
 						{
 							// backup all states
 							D3DX11_STATE_BLOCK sStateBlock;
-							CreateStateblock(pcContext, &sStateBlock);
+							CreateStateblock(pcContext, &sStateBlock, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 							// clear all states, set targets
-							ClearContextState(pcContext);
+							ClearContextState(pcContext, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 #pragma region set or create
 							// set or create a default rasterizer state here
@@ -997,7 +1010,7 @@ void* OpenVR_DirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int e
 							}
 #pragma endregion
 #pragma region create render models
-							// create all models
+							// query all models, the asset loader loads them off the render thread
 							if (!m_bRenderModelsCreated)
 							{
 								for (uint32_t unTrackedDevice = vr::k_unTrackedDeviceIndex_Hmd + 1; unTrackedDevice < vr::k_unMaxTrackedDeviceCount; unTrackedDevice++)
@@ -1018,120 +1031,98 @@ void* OpenVR_DirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int e
 									OutputDebugString(L"[OPENVR] Connected model name : ");
 									OutputDebugStringA(szModelName.c_str());
 
-									// load model and texture
-									vr::RenderModel_t *pModel = NULL;
-									vr::RenderModel_TextureMap_t *pTexture = NULL;
-
-									// model
-									while (vr::VRRenderModels()->LoadRenderModel_Async(szModelName.c_str(), &pModel) == vr::VRRenderModelError_Loading)
-										Sleep(50);
-									if (vr::VRRenderModels()->LoadRenderModel_Async(szModelName.c_str(), &pModel) || pModel == NULL)
-										OutputDebugString(L"[OPENVR] Unable to load render model");
-
-									// texture
-									while (vr::VRRenderModels()->LoadTexture_Async(pModel->diffuseTextureId, &pTexture) == vr::VRRenderModelError_Loading)
-										Sleep(50);
-									if (vr::VRRenderModels()->LoadTexture_Async(pModel->diffuseTextureId, &pTexture) || pTexture == NULL)
-										OutputDebugString(L"[OPENVR] Unable to load render texture");
-
-									// create a D3D render model structure
-									RenderModel_D3D sRenderModel = {};
-
-									// translate the model from Right-Handed to Left-Handed (negate z-axis for each vertex)
-									vr::RenderModel_Vertex_t* asVertices = new vr::RenderModel_Vertex_t[pModel->unVertexCount];
-									memcpy(asVertices, pModel->rVertexData, sizeof(vr::RenderModel_Vertex_t) * pModel->unVertexCount);
-									for (UINT unI = 0; unI < pModel->unVertexCount; unI++)
+									// queue the load, the model is added once loaded
+									std::shared_ptr<RenderModel_Decoded> psModel = std::make_shared<RenderModel_Decoded>();
+									psModel->unTrackedDeviceIndex = unTrackedDevice;
+									m_cAssetLoader.Submit(
+										[psModel, szModelName](const std::atomic<bool>& bCancel)
 									{
-										// negate z axis
-										asVertices[unI].vPosition.v[2] *= -1.0f;
-										asVertices[unI].vNormal.v[2] *= -1.0f;
-									}
-
-									// arrange the indices accordingly to match the new vertex translations
-									uint16_t* aunIndices = new uint16_t[pModel->unTriangleCount * 3];
-									memcpy(aunIndices, pModel->rIndexData, sizeof(uint16_t)* pModel->unTriangleCount * 3);
-									for (UINT unI = 0; unI < pModel->unTriangleCount; unI++)
+										return LoadRenderModel(szModelName, *psModel, bCancel);
+									},
+										[this, psModel](bool bSucceeded)
 									{
-										// exchange 2nd and 3rd index of the triangle
-										uint16_t unIndex3 = aunIndices[unI * 3 + 2];
-										aunIndices[unI * 3 + 2] = aunIndices[unI * 3 + 1];
-										aunIndices[unI * 3 + 1] = unIndex3;
-									}
+										if (bSucceeded)
+											m_apsRenderModelsDecoded.push_back(psModel);
+										else
+											OutputDebugString(L"[OPENVR] Unable to load render model");
+									});
+								}
+								m_bRenderModelsCreated = true;
+							}
 
-									// Create vertex buffer
-									D3D11_BUFFER_DESC sVertexBufferDesc;
-									ZeroMemory(&sVertexBufferDesc, sizeof(sVertexBufferDesc));
-									sVertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-									sVertexBufferDesc.ByteWidth = sizeof(TexturedNormalVertex)* pModel->unVertexCount;
-									sVertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
-									sVertexBufferDesc.CPUAccessFlags = 0;
-									D3D11_SUBRESOURCE_DATA sInitData;
-									ZeroMemory(&sInitData, sizeof(sInitData));
-									sInitData.pSysMem = asVertices;
-									if (FAILED(pcDevice->CreateBuffer(&sVertexBufferDesc, &sInitData, &sRenderModel.pcVertexBuffer)))
-										OutputDebugString(L"[OPENVR] Failed to create vertex buffer.");
-
-
-									// create index buffer
-									D3D11_BUFFER_DESC sIndexBufferDesc;
-									ZeroMemory(&sIndexBufferDesc, sizeof(sIndexBufferDesc));
-									sIndexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
-									sIndexBufferDesc.ByteWidth = sizeof(WORD)* pModel->unTriangleCount * 3;
-									sIndexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
-									sIndexBufferDesc.CPUAccessFlags = 0;
-									ZeroMemory(&sInitData, sizeof(sInitData));
-									sInitData.pSysMem = aunIndices;
-									if (FAILED(pcDevice->CreateBuffer(&sIndexBufferDesc, &sInitData, &sRenderModel.pcIndexBuffer)))
-										OutputDebugString(L"[OPENVR] Failed to create index buffer.");
-
-									// delete vertex/index translation buffers
-									delete[] asVertices;
-									delete[] aunIndices;
-
-									// set vertices/triangle count and tracked device index
-									sRenderModel.unTriangleCount = pModel->unTriangleCount;
-									sRenderModel.unVertexCount = pModel->unVertexCount;
-									sRenderModel.unTrackedDeviceIndex = unTrackedDevice;
-
-									// create geometry texture
-									D3D11_TEXTURE2D_DESC sDesc;
+							// create D3D resources for all models loaded since the last frame, no wait here
+							m_cAssetLoader.Poll();
+							for (std::shared_ptr<RenderModel_Decoded>& psModel : m_apsRenderModelsDecoded)
+							{
+								// create a D3D render model structure
+								RenderModel_D3D sRenderModel = {};
+
+								// Create vertex buffer
+								D3D11_BUFFER_DESC sVertexBufferDesc;
+								ZeroMemory(&sVertexBufferDesc, sizeof(sVertexBufferDesc));
+								sVertexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+								sVertexBufferDesc.ByteWidth = sizeof(TexturedNormalVertex)* (UINT)psModel->asVertices.size();
+								sVertexBufferDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+								sVertexBufferDesc.CPUAccessFlags = 0;
+								D3D11_SUBRESOURCE_DATA sInitData;
+								ZeroMemory(&sInitData, sizeof(sInitData));
+								sInitData.pSysMem = psModel->asVertices.data();
+								if (FAILED(pcDevice->CreateBuffer(&sVertexBufferDesc, &sInitData, &sRenderModel.pcVertexBuffer)))
+									OutputDebugString(L"[OPENVR] Failed to create vertex buffer.");
+
+
+								// create index buffer
+								D3D11_BUFFER_DESC sIndexBufferDesc;
+								ZeroMemory(&sIndexBufferDesc, sizeof(sIndexBufferDesc));
+								sIndexBufferDesc.Usage = D3D11_USAGE_DEFAULT;
+								sIndexBufferDesc.ByteWidth = sizeof(WORD)* (UINT)psModel->aunIndices.size();
+								sIndexBufferDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+								sIndexBufferDesc.CPUAccessFlags = 0;
+								ZeroMemory(&sInitData, sizeof(sInitData));
+								sInitData.pSysMem = psModel->aunIndices.data();
+								if (FAILED(pcDevice->CreateBuffer(&sIndexBufferDesc, &sInitData, &sRenderModel.pcIndexBuffer)))
+									OutputDebugString(L"[OPENVR] Failed to create index buffer.");
+
+								// set vertices/triangle count and tracked device index
+								sRenderModel.unTriangleCount = (uint32_t)psModel->aunIndices.size() / 3;
+								sRenderModel.unVertexCount = (uint32_t)psModel->asVertices.size();
+								sRenderModel.unTrackedDeviceIndex = psModel->unTrackedDeviceIndex;
+
+								// create geometry texture
+								D3D11_TEXTURE2D_DESC sDesc;
+								ZeroMemory(&sDesc, sizeof(sDesc));
+								sDesc.Width = psModel->unTextureWidth;
+								sDesc.Height = psModel->unTextureHeight;
+								sDesc.MipLevels = sDesc.ArraySize = 1;
+								sDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+								sDesc.SampleDesc.Count = 1;
+								sDesc.Usage = D3D11_USAGE_DEFAULT;
+								sDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+								D3D11_SUBRESOURCE_DATA sData;
+								ZeroMemory(&sData, sizeof(sData));
+								sData.pSysMem = psModel->aunTextureData.data();
+								sData.SysMemPitch = psModel->unTextureWidth * 4;
+								if (FAILED(pcDevice->CreateTexture2D(&sDesc, &sData, &sRenderModel.pcTexture)))
+									OutputDebugString(L"[OPENVR] Failed to create model texture.");
+
+								if (sRenderModel.pcTexture)
+								{
+									// create texture shader resource view
+									D3D11_SHADER_RESOURCE_VIEW_DESC sDesc;
 									ZeroMemory(&sDesc, sizeof(sDesc));
-									sDesc.Width = pTexture->unWidth;
-									sDesc.Height = pTexture->unHeight;
-									sDesc.MipLevels = sDesc.ArraySize = 1;
 									sDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-									sDesc.SampleDesc.Count = 1;
-									sDesc.Usage = D3D11_USAGE_DEFAULT;
-									sDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-									D3D11_SUBRESOURCE_DATA sData;
-									ZeroMemory(&sData, sizeof(sData));
-									sData.pSysMem = pTexture->rubTextureMapData;
-									sData.SysMemPitch = pTexture->unWidth * 4;
-									if (FAILED(pcDevice->CreateTexture2D(&sDesc, &sData, &sRenderModel.pcTexture)))
-										OutputDebugString(L"[OPENVR] Failed to create model texture.");
-
-									if (sRenderModel.pcTexture)
-									{
-										// create texture shader resource view
-										D3D11_SHADER_RESOURCE_VIEW_DESC sDesc;
-										ZeroMemory(&sDesc, sizeof(sDesc));
-										sDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-										sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-										sDesc.Texture2D.MostDetailedMip = 0;
-										sDesc.Texture2D.MipLevels = 1;
-
-										if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)sRenderModel.pcTexture, &sDesc, &sRenderModel.pcTextureSRV))))
-											OutputDebugString(L"[OPENVR] Failed to create model texture shader resource view!");
-									}
+									sDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
+									sDesc.Texture2D.MostDetailedMip = 0;
+									sDesc.Texture2D.MipLevels = 1;
 
-									// and add to vector
-									m_asRenderModels.push_back(sRenderModel);
-
-									vr::VRRenderModels()->FreeRenderModel(pModel);
-									vr::VRRenderModels()->FreeTexture(pTexture);
+									if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)sRenderModel.pcTexture, &sDesc, &sRenderModel.pcTextureSRV))))
+										OutputDebugString(L"[OPENVR] Failed to create model texture shader resource view!");
 								}
-								m_bRenderModelsCreated = true;
+
+								// and add to vector
+								m_asRenderModels.push_back(sRenderModel);
 							}
+							m_apsRenderModelsDecoded.clear();
 #pragma endregion
 #pragma region init and render
 
@@ -1247,10 +1238,10 @@ void* OpenVR_DirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int e
 					{
 						// backup all states
 						D3DX11_STATE_BLOCK sStateBlock;
-						CreateStateblock(pcContext, &sStateBlock);
+						CreateStateblock(pcContext, &sStateBlock, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 						// clear all states, set targets
-						ClearContextState(pcContext);
+						ClearContextState(pcContext, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 						// set viewport by render target size
 						uint32_t unWidth, unHeight;
@@ -1453,4 +1444,77 @@ void* OpenVR_DirectMode::Provoke(void* pThis, int eD3D, int eD3DInterface, int e
 	pcDevice->Release();
 
 	return nullptr;
+}
+
+/**
+* Loads a render model and its texture, called on an asset loader worker thread.
+* OpenVR loads render models asynchronously, so we poll here instead of on the render thread.
+* Translates the model from Right-Handed to Left-Handed.
+***/
+bool OpenVR_DirectMode::LoadRenderModel(const std::string& szModelName, RenderModel_Decoded& sModel, const std::atomic<bool>& bCancel)
+{
+	vr::RenderModel_t *pModel = NULL;
+	vr::RenderModel_TextureMap_t *pTexture = NULL;
+
+	// model, get the interface on every poll since OpenVR might be shut down meanwhile
+	vr::IVRRenderModels *pcRenderModels = NULL;
+	vr::EVRRenderModelError eError = vr::VRRenderModelError_Loading;
+	while (eError == vr::VRRenderModelError_Loading)
+	{
+		if (bCancel) return false;
+		pcRenderModels = vr::VRRenderModels();
+		if (!pcRenderModels) return false;
+		eError = pcRenderModels->LoadRenderModel_Async(szModelName.c_str(), &pModel);
+		if (eError == vr::VRRenderModelError_Loading) Sleep(50);
+	}
+	if ((eError != vr::VRRenderModelError_None) || (pModel == NULL))
+		return false;
+
+	// texture
+	eError = vr::VRRenderModelError_Loading;
+	while (eError == vr::VRRenderModelError_Loading)
+	{
+		pcRenderModels = vr::VRRenderModels();
+		if (!pcRenderModels) return false;
+		if (bCancel) { pcRenderModels->FreeRenderModel(pModel); return false; }
+		eError = pcRenderModels->LoadTexture_Async(pModel->diffuseTextureId, &pTexture);
+		if (eError == vr::VRRenderModelError_Loading) Sleep(50);
+	}
+	if ((eError != vr::VRRenderModelError_None) || (pTexture == NULL))
+	{
+		OutputDebugString(L"[OPENVR] Unable to load render texture");
+		pcRenderModels->FreeRenderModel(pModel);
+		return false;
+	}
+
+	// negate z axis for each vertex
+	sModel.asVertices.assign(pModel->rVertexData, pModel->rVertexData + pModel->unVertexCount);
+	for (vr::RenderModel_Vertex_t& sVertex : sModel.asVertices)
+	{
+		sVertex.vPosition.v[2] *= -1.0f;
+		sVertex.vNormal.v[2] *= -1.0f;
+	}
+
+	// arrange the indices accordingly to match the new vertex translations
+	sModel.aunIndices.assign(pModel->rIndexData, pModel->rIndexData + pModel->unTriangleCount * 3);
+	for (UINT unI = 0; unI < pModel->unTriangleCount; unI++)
+	{
+		// exchange 2nd and 3rd index of the triangle
+		uint16_t unIndex3 = sModel.aunIndices[unI * 3 + 2];
+		sModel.aunIndices[unI * 3 + 2] = sModel.aunIndices[unI * 3 + 1];
+		sModel.aunIndices[unI * 3 + 1] = unIndex3;
+	}
+
+	// texture data
+	sModel.unTextureWidth = pTexture->unWidth;
+	sModel.unTextureHeight = pTexture->unHeight;
+	sModel.aunTextureData.assign(pTexture->rubTextureMapData, pTexture->rubTextureMapData + (size_t)pTexture->unWidth * (size_t)pTexture->unHeight * 4);
+
+	pcRenderModels = vr::VRRenderModels();
+	if (pcRenderModels)
+	{
+		pcRenderModels->FreeRenderModel(pModel);
+		pcRenderModels->FreeTexture(pTexture);
+	}
+	return true;
 }
\ No newline at end of file
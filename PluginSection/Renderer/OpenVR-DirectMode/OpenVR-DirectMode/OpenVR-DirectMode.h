@@ -40,6 +40,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include<stdlib.h>
 #include<sstream>
 #include<vector>
+#include<memory>
 
 #include<Shlwapi.h>
 #pragma comment(lib, "Shlwapi.lib")
@@ -75,9 +76,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include"..\..\..\Include\Vireio_DX11Basics.h"
 #include"..\..\..\Include\Vireio_Node_Plugtypes.h"
 #include"..\..\..\Include\VireioMenu.h"
+#include"..\..\..\Include\Vireio_AssetLoader.h"
 
 #define NUMBER_OF_COMMANDERS                            1
-#define NUMBER_OF_DECOMMANDERS                         11
+#define NUMBER_OF_DECOMMANDERS                         12
 
 #define OPENVR_OVERLAY_NAME                            "key.MTBS3D"
 #define OPENVR_OVERLAY_FRIENDLY_NAME                   "MTBS3D"
@@ -186,6 +188,7 @@ enum OpenVR_Decommanders
 	HUDTexture11,
 	HUDTexture10,
 	HUDTexture9,
+	Input,
 };
 
 /**
@@ -217,6 +220,22 @@ public:
 	virtual bool            SupportsD3DMethod(int nD3DVersion, int nD3DInterface, int nD3DMethod);
 	virtual void*           Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3DMethod, DWORD dwNumberConnected, int& nProvokerIndex);
 private:
+	/**
+	* Render model as loaded by the asset loader, translated to left handed, no D3D resources yet.
+	***/
+	struct RenderModel_Decoded
+	{
+		std::vector<vr::RenderModel_Vertex_t> asVertices;  /**< Vertices, z-axis negated **/
+		std::vector<uint16_t> aunIndices;                   /**< Indices, winding order changed **/
+		std::vector<uint8_t> aunTextureData;                /**< RGBA texture data **/
+		uint16_t unTextureWidth;                            /**< Texture width **/
+		uint16_t unTextureHeight;                           /**< Texture height **/
+		uint32_t unTrackedDeviceIndex;                      /**< Index of the device for this model **/
+	};
+
+	/*** OpenVR_DirectMode private methods ***/
+	static bool             LoadRenderModel(const std::string& szModelName, RenderModel_Decoded& sModel, const std::atomic<bool>& bCancel);
+
 	/**
 	* Temporary directx 11 device for OpenVR.
 	***/
@@ -349,6 +368,10 @@ private:
 	***/
 	bool m_bHotkeySwitch;
 	/**
+	* Input snapshot, if not connected the hotkey is up.
+	***/
+	InputData* m_psInput;
+	/**
 	* True if interleaved reprojection is forced on.
 	***/
 	bool m_bForceInterleavedReprojection;
@@ -422,6 +445,14 @@ private:
 	***/
 	std::vector<RenderModel_D3D> m_asRenderModels;
 	/**
+	* Loads the render models off the render thread.
+	***/
+	VireioAssetLoader m_cAssetLoader;
+	/**
+	* Loaded render models waiting for D3D resource creation.
+	***/
+	std::vector<std::shared_ptr<RenderModel_Decoded>> m_apsRenderModelsDecoded;
+	/**
 	* Vireio menu.
 	***/
 	VireioSubMenu m_sMenu;
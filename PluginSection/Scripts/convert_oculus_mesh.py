@@ -0,0 +1,424 @@
+#----------------------------------------------------------
+# Convert Oculus mesh headers to .vmesh files
+# Reads the OculusMesh_*.h headers exported by the
+# OculusDirectMode node (_CREATE_MESH_FILES) and writes the
+# quantized binary mesh container read by VireioMeshPack
+# (Include/Vireio_MeshPack.h).
+#
+# usage : python convert_oculus_mesh.py [--no-lz] <out dir> <OculusMesh_*.h> ...
+#
+# Indices are reordered for the post transform cache (Forsyth),
+# vertices for fetch locality, the file is decoded again and
+# checked against the source arrays.
+#----------------------------------------------------------
+import math
+import os
+import re
+import struct
+import sys
+
+VERSION = 1
+FLAG_LZ = 0x01
+FLAG_INDEX32 = 0x02
+
+# maximum decode error allowed per attribute, checked after conversion
+MAX_ERROR_POSITION_RELATIVE = 1.0 / 65535.0
+MAX_ERROR_DIRECTION = 0.001
+MAX_ERROR_UV_RELATIVE = 1.0 / 65535.0
+MAX_ERROR_WEIGHT = 1.0 / 255.0
+
+#
+#    Header parsing
+#
+
+def parse_array(text, pattern):
+    match = re.search(pattern + r"\s*\[\s*\]\s*=\s*\{(.*?)\}\s*;", text, re.S)
+    if not match:
+        return None
+    return [float(value.rstrip("f")) for value in re.findall(r"[-+]?[0-9]*\.?[0-9]+(?:[eE][-+]?[0-9]+)?f?", match.group(1))]
+
+def parse_header(path):
+    text = open(path, "r").read()
+    count = int(re.search(r"unAvatarVertexCount_\w+\s*=\s*(\d+)", text).group(1))
+
+    values = parse_array(text, r"const\s+ovrAvatarMeshVertex\s+asAvatarVertices_\w+")
+    if (values is None) or (len(values) != count * 20):
+        raise ValueError(path + " : vertex array does not match the vertex count")
+    vertices = [values[i * 20:(i + 1) * 20] for i in range(count)]
+
+    # older exports name the index array "aunAvatarVertices_"
+    indices = parse_array(text, r"const\s+uint(?:16|32)_t\s+aun(?:AvatarIndices|AvatarVertices)_\w+")
+    index_size = 2 if re.search(r"const\s+uint16_t\s+aunAvatar", text) else 4
+    index_count = int(re.search(r"unAvatarIndexCount_\w+\s*=\s*(\d+)", text).group(1))
+    if (indices is None) or (len(indices) != index_count):
+        raise ValueError(path + " : index array does not match the index count")
+    indices = [int(i) for i in indices]
+
+    bind_pose = parse_array(text, r"const\s+D3DXMATRIX\s+asBindPose_\w+") or []
+    if len(bind_pose) % 16:
+        raise ValueError(path + " : invalid bind pose")
+    return vertices, indices, index_size, bind_pose
+
+#
+#    Vertex cache optimization (Tom Forsyth, linear speed vertex cache optimisation)
+#
+
+CACHE_SIZE = 32
+CACHE_DECAY_POWER = 1.5
+LAST_TRI_SCORE = 0.75
+VALENCE_BOOST_SCALE = 2.0
+VALENCE_BOOST_POWER = 0.5
+
+def vertex_score(cache_position, remaining):
+    if remaining == 0:
+        return -1.0
+    score = 0.0
+    if cache_position >= 0:
+        if cache_position < 3:
+            score = LAST_TRI_SCORE
+        else:
+            score = math.pow(1.0 - (cache_position - 3) / float(CACHE_SIZE - 3), CACHE_DECAY_POWER)
+    return score + VALENCE_BOOST_SCALE * math.pow(remaining, -VALENCE_BOOST_POWER)
+
+def optimize_vertex_cache(indices, vertex_count):
+    triangle_count = len(indices) // 3
+    vertex_triangles = [[] for _ in range(vertex_count)]
+    for t in range(triangle_count):
+        for k in range(3):
+            vertex_triangles[indices[t * 3 + k]].append(t)
+    remaining = [len(v) for v in vertex_triangles]
+    cache_position = [-1] * vertex_count
+    score = [vertex_score(-1, remaining[v]) for v in range(vertex_count)]
+    triangle_score = [sum(score[indices[t * 3 + k]] for k in range(3)) for t in range(triangle_count)]
+    emitted = [False] * triangle_count
+
+    cache = []
+    output = []
+    scan = 0
+    best = -1
+    while len(output) < len(indices):
+        if best < 0:
+            # no candidate in the cache, take the best not emitted triangle
+            best_score = -1.0
+            for t in range(scan, triangle_count):
+                if (not emitted[t]) and (triangle_score[t] > best_score):
+                    best_score = triangle_score[t]
+                    best = t
+            while emitted[scan]:
+                scan += 1
+
+        emitted[best] = True
+        triangle = indices[best * 3:best * 3 + 3]
+        output.extend(triangle)
+        for v in triangle:
+            remaining[v] -= 1
+            vertex_triangles[v].remove(best)
+            if v in cache:
+                cache.remove(v)
+        cache = triangle + cache
+
+        # update the scores of all vertices in the cache and the evicted ones
+        evicted = cache[CACHE_SIZE:]
+        cache = cache[:CACHE_SIZE]
+        for v in evicted:
+            cache_position[v] = -1
+        touched = set()
+        for position, v in enumerate(cache + evicted):
+            if position < len(cache):
+                cache_position[v] = position
+            new_score = vertex_score(cache_position[v], remaining[v])
+            delta = new_score - score[v]
+            score[v] = new_score
+            for t in vertex_triangles[v]:
+                triangle_score[t] += delta
+                touched.add(t)
+
+        best = -1
+        best_score = -1.0
+        for t in touched:
+            if triangle_score[t] > best_score:
+                best_score = triangle_score[t]
+                best = t
+    return output
+
+def optimize_vertex_fetch(vertices, indices):
+    # vertices in order of first use, unreferenced vertices at the end
+    # returns the new vertices and the remap table (source index -> new index)
+    remap = [-1] * len(vertices)
+    order = []
+    for i in indices:
+        if remap[i] < 0:
+            remap[i] = len(order)
+            order.append(i)
+    for i in range(len(vertices)):
+        if remap[i] < 0:
+            remap[i] = len(order)
+            order.append(i)
+    return [vertices[i] for i in order], remap
+
+def acmr(indices, vertex_count, cache_size=16):
+    timestamps = [0] * vertex_count
+    time = cache_size + 1
+    misses = 0
+    for i in indices:
+        if time - timestamps[i] > cache_size:
+            timestamps[i] = time
+            time += 1
+            misses += 1
+    return misses / float(len(indices) // 3)
+
+#
+#    Quantization
+#
+
+def quantize_unorm16(value, minimum, scale):
+    if scale == 0.0:
+        return 0
+    return max(0, min(65535, int(round((value - minimum) / scale))))
+
+def oct_encode(x, y, z):
+    length = abs(x) + abs(y) + abs(z)
+    if length == 0.0:
+        return 0, 0
+    x, y, z = x / length, y / length, z / length
+    if z < 0.0:
+        x, y = (1.0 - abs(y)) * (1.0 if x >= 0.0 else -1.0), (1.0 - abs(x)) * (1.0 if y >= 0.0 else -1.0)
+    return int(round(max(-1.0, min(1.0, x)) * 32767.0)), int(round(max(-1.0, min(1.0, y)) * 32767.0))
+
+def oct_decode(ox, oy):
+    x, y = ox / 32767.0, oy / 32767.0
+    z = 1.0 - abs(x) - abs(y)
+    if z < 0.0:
+        x, y = (1.0 - abs(y)) * (1.0 if x >= 0.0 else -1.0), (1.0 - abs(x)) * (1.0 if y >= 0.0 else -1.0)
+    length = math.sqrt(x * x + y * y + z * z)
+    return x / length, y / length, z / length
+
+def quantize_weights(weights):
+    # 8 bit, largest remainder so the sum stays 255
+    total = sum(weights)
+    if total <= 0.0:
+        return [255, 0, 0, 0]
+    scaled = [w / total * 255.0 for w in weights]
+    result = [int(math.floor(s)) for s in scaled]
+    order = sorted(range(4), key=lambda k: scaled[k] - result[k], reverse=True)
+    for k in order[:255 - sum(result)]:
+        result[k] += 1
+    return result
+
+def bounds(vertices, first, count):
+    minimum = [min(v[first + k] for v in vertices) for k in range(count)]
+    maximum = [max(v[first + k] for v in vertices) for k in range(count)]
+    return minimum, [(maximum[k] - minimum[k]) / 65535.0 for k in range(count)]
+
+def pack_vertices(vertices):
+    position_min, position_scale = bounds(vertices, 0, 3)
+    uv_min, uv_scale = bounds(vertices, 10, 2)
+    data = bytearray()
+    for v in vertices:
+        position = [quantize_unorm16(v[k], position_min[k], position_scale[k]) for k in range(3)]
+        normal = oct_encode(v[3], v[4], v[5])
+        tangent = oct_encode(v[6], v[7], v[8])
+        uv = [quantize_unorm16(v[10 + k], uv_min[k], uv_scale[k]) for k in range(2)]
+        data += struct.pack("<3Hh2h2h2H4B4B", position[0], position[1], position[2], -32767 if v[9] < 0.0 else 32767,
+                            normal[0], normal[1], tangent[0], tangent[1], uv[0], uv[1],
+                            *([int(i) for i in v[12:16]] + quantize_weights(v[16:20])))
+    return data, position_min, position_scale, uv_min, uv_scale
+
+#
+#    LZ compression (LZ4 block layout, greedy)
+#
+
+MIN_MATCH = 4
+MAX_OFFSET = 65535
+
+def write_length(out, length):
+    while length >= 255:
+        out.append(255)
+        length -= 255
+    out.append(length)
+
+def lz_compress(data):
+    out = bytearray()
+    table = {}
+    anchor = 0
+    position = 0
+    end = len(data)
+    # the last bytes are always literals
+    match_limit = end - 5
+    while position < match_limit:
+        key = bytes(data[position:position + MIN_MATCH])
+        candidate = table.get(key, -1)
+        table[key] = position
+        if (candidate < 0) or (position - candidate > MAX_OFFSET):
+            position += 1
+            continue
+        length = MIN_MATCH
+        while (position + length < match_limit) and (data[candidate + length] == data[position + length]):
+            length += 1
+
+        literal_length = position - anchor
+        match_code = length - MIN_MATCH
+        out.append((min(literal_length, 15) << 4) | min(match_code, 15))
+        if literal_length >= 15:
+            write_length(out, literal_length - 15)
+        out += data[anchor:position]
+        out += struct.pack("<H", position - candidate)
+        if match_code >= 15:
+            write_length(out, match_code - 15)
+
+        for p in range(position + 1, min(position + length, match_limit)):
+            table[bytes(data[p:p + MIN_MATCH])] = p
+        position += length
+        anchor = position
+
+    literal_length = end - anchor
+    out.append(min(literal_length, 15) << 4)
+    if literal_length >= 15:
+        write_length(out, literal_length - 15)
+    out += data[anchor:]
+    return out
+
+def lz_decompress(data, size):
+    out = bytearray()
+    position = 0
+    while position < len(data):
+        token = data[position]
+        position += 1
+        length = token >> 4
+        if length == 15:
+            while True:
+                value = data[position]
+                position += 1
+                length += value
+                if value != 255:
+                    break
+        out += data[position:position + length]
+        position += length
+        if position == len(data):
+            break
+        offset = data[position] | (data[position + 1] << 8)
+        position += 2
+        length = token & 15
+        if length == 15:
+            while True:
+                value = data[position]
+                position += 1
+                length += value
+                if value != 255:
+                    break
+        length += MIN_MATCH
+        for _ in range(length):
+            out.append(out[-offset])
+    if len(out) != size:
+        raise ValueError("lz round trip size mismatch")
+    return out
+
+#
+#    File writing and verification
+#
+
+HEADER_FORMAT = "<4s5I3f3f2f2f2I"
+
+def write_vmesh(path, vertices, indices, bind_pose, compress):
+    index32 = len(vertices) > 65535
+    payload, position_min, position_scale, uv_min, uv_scale = pack_vertices(vertices)
+    payload += struct.pack("<%d%s" % (len(indices), "I" if index32 else "H"), *indices)
+    raw_size = len(payload)
+    flags = FLAG_INDEX32 if index32 else 0
+    if compress:
+        compressed = lz_compress(payload)
+        if lz_decompress(compressed, raw_size) != payload:
+            raise ValueError("lz round trip failed")
+        if len(compressed) < raw_size:
+            payload = compressed
+            flags |= FLAG_LZ
+
+    header = struct.pack(HEADER_FORMAT, b"VMSH", VERSION, flags, len(vertices), len(indices), len(bind_pose) // 16,
+                         *(position_min + position_scale + uv_min + uv_scale + [len(payload), raw_size]))
+    with open(path, "wb") as out:
+        out.write(header)
+        out.write(struct.pack("<%df" % len(bind_pose), *bind_pose))
+        out.write(payload)
+    return len(header) + len(bind_pose) * 4 + len(payload)
+
+def read_vmesh(path):
+    data = open(path, "rb").read()
+    size = struct.calcsize(HEADER_FORMAT)
+    fields = struct.unpack(HEADER_FORMAT, data[:size])
+    magic, version, flags, vertex_count, index_count, joint_count = fields[:6]
+    position_min, position_scale, uv_min, uv_scale = fields[6:9], fields[9:12], fields[12:14], fields[14:16]
+    payload_size, raw_size = fields[16:18]
+    if (magic != b"VMSH") or (version != VERSION):
+        raise ValueError(path + " : no .vmesh file")
+    offset = size + joint_count * 64
+    payload = data[offset:offset + payload_size]
+    if flags & FLAG_LZ:
+        payload = lz_decompress(payload, raw_size)
+
+    vertices = []
+    for i in range(vertex_count):
+        p = struct.unpack_from("<3Hh2h2h2H4B4B", payload, i * 28)
+        normal = oct_decode(p[4], p[5])
+        tangent = oct_decode(p[6], p[7])
+        vertices.append([position_min[k] + p[k] * position_scale[k] for k in range(3)] + list(normal) + list(tangent) +
+                        [-1.0 if p[3] < 0 else 1.0] + [uv_min[k] + p[8 + k] * uv_scale[k] for k in range(2)] +
+                        [float(b) for b in p[10:14]] + [w / 255.0 for w in p[14:18]])
+    indices = list(struct.unpack_from("<%d%s" % (index_count, "I" if flags & FLAG_INDEX32 else "H"), payload, vertex_count * 28))
+    return vertices, indices
+
+def max_errors(source_vertices, decoded_vertices, remap):
+    position_extent = max(max(v[k] for v in source_vertices) - min(v[k] for v in source_vertices) for k in range(3))
+    uv_extent = max(max(v[10 + k] for v in source_vertices) - min(v[10 + k] for v in source_vertices) for k in range(2))
+    error = {"position": 0.0, "normal": 0.0, "tangent": 0.0, "uv": 0.0, "weight": 0.0, "index": 0}
+    for i, source in enumerate(source_vertices):
+        decoded = decoded_vertices[remap[i]]
+        error["position"] = max(error["position"], max(abs(source[k] - decoded[k]) for k in range(3)))
+        length = math.sqrt(sum(source[3 + k] ** 2 for k in range(3))) or 1.0
+        error["normal"] = max(error["normal"], max(abs(source[3 + k] / length - decoded[3 + k]) for k in range(3)))
+        length = math.sqrt(sum(source[6 + k] ** 2 for k in range(3))) or 1.0
+        error["tangent"] = max(error["tangent"], max(abs(source[6 + k] / length - decoded[6 + k]) for k in range(3)))
+        error["uv"] = max(error["uv"], max(abs(source[10 + k] - decoded[10 + k]) for k in range(2)))
+        total = sum(source[16:20]) or 1.0
+        error["weight"] = max(error["weight"], max(abs(source[16 + k] / total - decoded[16 + k]) for k in range(4)))
+        error["index"] += sum(1 for k in range(4) if int(source[12 + k]) != int(decoded[12 + k]))
+    if (error["position"] > position_extent * MAX_ERROR_POSITION_RELATIVE or error["uv"] > uv_extent * MAX_ERROR_UV_RELATIVE or
+            error["normal"] > MAX_ERROR_DIRECTION or error["tangent"] > MAX_ERROR_DIRECTION or
+            error["weight"] > MAX_ERROR_WEIGHT or error["index"]):
+        raise ValueError("decode error out of bounds : " + str(error))
+    return error
+
+def convert(source_path, out_dir, compress):
+    vertices, indices, index_size, bind_pose = parse_header(source_path)
+    acmr_before = acmr(indices, len(vertices))
+
+    optimized = optimize_vertex_cache(indices, len(vertices))
+    ordered_vertices, remap = optimize_vertex_fetch(vertices, optimized)
+    ordered_indices = [remap[i] for i in optimized]
+
+    name = os.path.splitext(os.path.basename(source_path))[0] + ".vmesh"
+    out_path = os.path.join(out_dir, name)
+    size = write_vmesh(out_path, ordered_vertices, ordered_indices, bind_pose, compress)
+
+    # decode and check against the source arrays
+    decoded_vertices, decoded_indices = read_vmesh(out_path)
+    if decoded_indices != ordered_indices:
+        raise ValueError("index round trip failed")
+    if sorted(tuple(sorted(remap[i] for i in indices[t * 3:t * 3 + 3])) for t in range(len(indices) // 3)) != \
+            sorted(tuple(sorted(decoded_indices[t * 3:t * 3 + 3])) for t in range(len(decoded_indices) // 3)):
+        raise ValueError("triangle set changed")
+    error = max_errors(vertices, decoded_vertices, remap)
+
+    print("%s : %d vertices, %d indices, %d joints" % (name, len(vertices), len(indices), len(bind_pose) // 16))
+    print("  source arrays %d bytes, file %d bytes" % (len(vertices) * 80 + len(indices) * index_size + len(bind_pose) * 4, size))
+    print("  acmr (fifo 16) %.3f -> %.3f" % (acmr_before, acmr(decoded_indices, len(decoded_vertices))))
+    print("  max error position %g normal %g tangent %g uv %g weight %g" % (error["position"], error["normal"], error["tangent"], error["uv"], error["weight"]))
+
+if __name__ == "__main__":
+    arguments = sys.argv[1:]
+    compress = "--no-lz" not in arguments
+    arguments = [a for a in arguments if a != "--no-lz"]
+    if len(arguments) < 2:
+        print("usage : python convert_oculus_mesh.py [--no-lz] <out dir> <OculusMesh_*.h> ...")
+        sys.exit(1)
+    for source in arguments[1:]:
+        convert(source, arguments[0], compress)
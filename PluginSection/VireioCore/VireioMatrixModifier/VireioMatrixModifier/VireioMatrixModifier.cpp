@@ -1724,7 +1724,7 @@ void MatrixModifier::UpdateImGuiControl(float fZoom)
 				m_dwCurrentChosenShaderHashCode = (UINT)m_adwVShaderHashCodes[nItem_VShader];
 			else
 			{
-				OutputDebugString(L"[MAM] Serious node logic error !! Wrong index !!");
+				VIREIO_LOG_ERROR("[MAM] Serious node logic error !! Wrong index !!");
 				m_dwCurrentChosenShaderHashCode = 0;
 		}
 	}
@@ -1740,7 +1740,7 @@ void MatrixModifier::UpdateImGuiControl(float fZoom)
 				m_dwCurrentChosenShaderHashCode = (UINT)m_adwPShaderHashCodes[nItem_VShader];
 			else
 			{
-				OutputDebugString(L"[MAM] Serious node logic error !! Wrong index !!");
+				VIREIO_LOG_ERROR("[MAM] Serious node logic error !! Wrong index !!");
 				m_dwCurrentChosenShaderHashCode = 0;
 			}
 		}
@@ -2451,14 +2451,21 @@ void MatrixModifier::VerifyConstantBuffer(ID3D11Buffer* pcBuffer, UINT dwBufferI
 	// not addressed ? address
 	if (sRulesIndex.m_nRulesIndex == VIREIO_CONSTANT_RULES_NOT_ADDRESSED)
 	{
+		// scratch data for this call on the arena, no heap calls
+		VireioFrameArena::Scope sScratch(m_cScratch);
+
 		// create a vector for this constant buffer
-		std::vector<Vireio_Constant_Rule_Index> asConstantBufferRules = std::vector<Vireio_Constant_Rule_Index>();
+		std::vector<Vireio_Constant_Rule_Index, VireioArenaAllocator<Vireio_Constant_Rule_Index>> asConstantBufferRules{ VireioArenaAllocator<Vireio_Constant_Rule_Index>(m_cScratch) };
+
+		// get a bool for each register index (+1, the register tests below allow the index to equal the size)
+		bool* abRegistersMatching = m_cScratch.AllocateArray<bool>(dwBufferRegisterSize + 1);
+		if (!abRegistersMatching) return;
 
 		// loop through all global rules
 		for (UINT dwI = 0; dwI < (UINT)m_aunGlobalConstantRuleIndices.size(); dwI++)
 		{
-			// get a bool for each register index, set to false
-			std::vector<bool> abRegistersMatching = std::vector<bool>(dwBufferRegisterSize, false);
+			// set all registers to false
+			ZeroMemory(abRegistersMatching, dwBufferRegisterSize + 1);
 
 			if ((m_asConstantRules[m_aunGlobalConstantRuleIndices[dwI]].m_bUseName) || (m_asConstantRules[m_aunGlobalConstantRuleIndices[dwI]].m_bUsePartialNameMatch))
 			{
@@ -2548,7 +2555,7 @@ void MatrixModifier::VerifyConstantBuffer(ID3D11Buffer* pcBuffer, UINT dwBufferI
 				if ((dwBufferRegisterSize) && (dwRegister <= dwBufferRegisterSize))
 				{
 					bool bOld = abRegistersMatching[dwRegister];
-					abRegistersMatching = std::vector<bool>(dwBufferRegisterSize, false);
+					ZeroMemory(abRegistersMatching, dwBufferRegisterSize + 1);
 					abRegistersMatching[dwRegister] = bOld;
 
 					// set to true if no naming convention 
@@ -2556,7 +2563,7 @@ void MatrixModifier::VerifyConstantBuffer(ID3D11Buffer* pcBuffer, UINT dwBufferI
 						abRegistersMatching[dwRegister] = true;
 				}
 				else
-					abRegistersMatching = std::vector<bool>(dwBufferRegisterSize, false);
+					ZeroMemory(abRegistersMatching, dwBufferRegisterSize + 1);
 			}
 
 			// use buffer index
@@ -2566,7 +2573,7 @@ void MatrixModifier::VerifyConstantBuffer(ID3D11Buffer* pcBuffer, UINT dwBufferI
 				{
 				case VertexShader:
 					if (m_asConstantRules[m_aunGlobalConstantRuleIndices[dwI]].m_dwBufferIndex != dwBufferIndex)
-						abRegistersMatching = std::vector<bool>(dwBufferRegisterSize, false);
+						ZeroMemory(abRegistersMatching, dwBufferRegisterSize + 1);
 					break;
 				case PixelShader:
 					break;
@@ -2585,7 +2592,7 @@ void MatrixModifier::VerifyConstantBuffer(ID3D11Buffer* pcBuffer, UINT dwBufferI
 			if (m_asConstantRules[m_aunGlobalConstantRuleIndices[dwI]].m_bUseBufferSize)
 			{
 				if (m_asConstantRules[m_aunGlobalConstantRuleIndices[dwI]].m_dwBufferSize != dwBufferSize)
-					abRegistersMatching = std::vector<bool>(dwBufferRegisterSize, false);
+					ZeroMemory(abRegistersMatching, dwBufferRegisterSize + 1);
 			}
 
 			// loop through registers and create the rules
@@ -2637,8 +2644,8 @@ void MatrixModifier::VerifyConstantBuffer(ID3D11Buffer* pcBuffer, UINT dwBufferI
 			// set index... current vector size
 			sRulesIndex.m_nRulesIndex = (INT)m_aasConstantBufferRuleIndices.size();
 
-			// and add
-			m_aasConstantBufferRuleIndices.push_back(asConstantBufferRules);
+			// and add (copy from the scratch arena)
+			m_aasConstantBufferRuleIndices.push_back(std::vector<Vireio_Constant_Rule_Index>(asConstantBufferRules.begin(), asConstantBufferRules.end()));
 		}
 	}
 
@@ -2904,7 +2911,7 @@ void MatrixModifier::CreateShader(std::vector<Vireio_D3D11_Shader>* pasShaders,
 			}
 		}
 	}
-	else OutputDebugString(L"MatrixModifier: Failed to reflect vertex shader !");
+	else VIREIO_LOG_ERROR("MatrixModifier: Failed to reflect vertex shader !");
 }
 #endif
 #if defined(VIREIO_D3D9)
@@ -3017,16 +3024,16 @@ HRESULT MatrixModifier::VerifyConstantDescriptionForRule(Vireio_Constant_Modific
 		switch (psDescription->eClass)
 		{
 		case D3DXPC_VECTOR:
-			OutputDebugString(L"VS: D3DXPC_VECTOR");
+			VIREIO_LOG_DEBUG("VS: D3DXPC_VECTOR");
 			break;
 		case D3DXPC_MATRIX_ROWS:
-			OutputDebugString(L"VS: D3DXPC_MATRIX_ROWS");
+			VIREIO_LOG_DEBUG("VS: D3DXPC_MATRIX_ROWS");
 			break;
 		case D3DXPC_MATRIX_COLUMNS:
-			OutputDebugString(L"VS: D3DXPC_MATRIX_COLUMNS");
+			VIREIO_LOG_DEBUG("VS: D3DXPC_MATRIX_COLUMNS");
 			break;
 		default:
-			OutputDebugString(L"VS: UNKNOWN_CONSTANT");
+			VIREIO_LOG_DEBUG("VS: UNKNOWN_CONSTANT");
 			break;
 		}
 		debugf("Register Index: %d", psDescription->uRegisterIndex);
@@ -3166,14 +3173,14 @@ HRESULT MatrixModifier::SetXShaderConstantF(UINT unStartRegister, const float* p
 						if (unStartRegister <= unStartRegisterConstant)
 							memcpy(&psShader->afRegisterBuffer[unStartRegisterConstant - unStartRegister], &sMatrixLeft, sizeof(D3DMATRIX));
 						else
-							OutputDebugString(L"[MAM] Unlikely case: partially changed matrices");
+							VIREIO_LOG_WARNING("[MAM] Unlikely case: partially changed matrices");
 					}
 					else
 					{
 						if (unStartRegister <= unStartRegisterConstant)
 							memcpy(&psShader->afRegisterBuffer[unStartRegisterConstant - unStartRegister], &sMatrixRight, sizeof(D3DMATRIX));
 						else
-							OutputDebugString(L"[MAM] Unlikely case: partially changed matrices");
+							VIREIO_LOG_WARNING("[MAM] Unlikely case: partially changed matrices");
 					}
 				}
 		}
@@ -4275,15 +4282,15 @@ void MatrixModifier::VSSetShader(int& nFlags)
 						{
 							// create render target view
 							if (FAILED(pcDevice->CreateRenderTargetView(m_pcSecondaryRenderTarget11, NULL, &m_pcSecondaryRenderTargetView11)))
-								OutputDebugString(L"[MAM] Failed to create secondary render target view.");
+								VIREIO_LOG_ERROR("[MAM] Failed to create secondary render target view.");
 
 							// create shader resource view
 							if (FAILED(pcDevice->CreateShaderResourceView(m_pcSecondaryRenderTarget11, NULL, &m_pcSecondaryRenderTargetSRView11)))
-								OutputDebugString(L"[MAM] Failed to create secondary render target shader resource view.");
+								VIREIO_LOG_ERROR("[MAM] Failed to create secondary render target shader resource view.");
 						}
-						else OutputDebugString(L"[MAM] Failed to create secondary render target !");
+						else VIREIO_LOG_ERROR("[MAM] Failed to create secondary render target !");
 					}
-					else OutputDebugString(L"[MAM] No Viewport present !");
+					else VIREIO_LOG_WARNING("[MAM] No Viewport present !");
 
 					pcDevice->Release();
 				}
@@ -4334,15 +4341,15 @@ void MatrixModifier::VSSetShader(int& nFlags)
 							{
 								// create render target view
 								if (FAILED(pcDevice->CreateRenderTargetView(m_pcSecondaryRenderTarget11, NULL, &m_pcSecondaryRenderTargetView11)))
-									OutputDebugString(L"[MAM] Failed to create secondary render target view.");
+									VIREIO_LOG_ERROR("[MAM] Failed to create secondary render target view.");
 
 								// create shader resource view
 								if (FAILED(pcDevice->CreateShaderResourceView(m_pcSecondaryRenderTarget11, NULL, &m_pcSecondaryRenderTargetSRView11)))
-									OutputDebugString(L"[MAM] Failed to create secondary render target shader resource view.");
+									VIREIO_LOG_ERROR("[MAM] Failed to create secondary render target shader resource view.");
 							}
-							else OutputDebugString(L"[MAM] Failed to create secondary render target !");
+							else VIREIO_LOG_ERROR("[MAM] Failed to create secondary render target !");
 						}
-						else OutputDebugString(L"[MAM] No Viewport present !");
+						else VIREIO_LOG_WARNING("[MAM] No Viewport present !");
 
 						pcDevice->Release();
 					}
@@ -4954,7 +4961,7 @@ HRESULT MatrixModifier::CreateVertexShader(int& nFlags)
 	std::vector<VIREIO_D3D9_CONSTANT_DESC> asConstantDesc;
 	if (FAILED(ParseShaderFunction(auFunc, uSizeOfData, uCreatorIx, asConstantDesc, uHash, VIREIO_SEED)))
 	{
-		OutputDebugString(L"[MAM] Failed to parse shader function !!");
+		VIREIO_LOG_ERROR("[MAM] Failed to parse shader function !!");
 
 		// create shader
 		HRESULT nHr = m_pcDeviceCurrent->CreateVertexShader(*ppuFunction, *pppcShader);
@@ -4991,7 +4998,7 @@ HRESULT MatrixModifier::CreateVertexShader(int& nFlags)
 	if (!uCreatorIx)
 	{
 		// TODO !! NO CONSTANT TABLE PRESENT - CREATE CONSTANT TABLE BY HAND
-		OutputDebugString(L"[MAM] No Creator CTAB text present within shader byte code !!");
+		VIREIO_LOG_WARNING("[MAM] No Creator CTAB text present within shader byte code !!");
 		return S_OK;
 	}
 
@@ -5084,7 +5091,7 @@ HRESULT MatrixModifier::CreatePixelShader(int& nFlags)
 	std::vector<VIREIO_D3D9_CONSTANT_DESC> asConstantDesc;
 	if (FAILED(ParseShaderFunction(auFunc, uSizeOfData, uCreatorIx, asConstantDesc, uHash, VIREIO_SEED)))
 	{
-		OutputDebugString(L"[MAM] Failed to parse shader function !!");
+		VIREIO_LOG_ERROR("[MAM] Failed to parse shader function !!");
 
 		// create shader
 		HRESULT nHr = m_pcDeviceCurrent->CreatePixelShader(*ppuFunction, *pppcShader);
@@ -5121,7 +5128,7 @@ HRESULT MatrixModifier::CreatePixelShader(int& nFlags)
 	if (!uCreatorIx)
 	{
 		// TODO !! NO CONSTANT TABLE PRESENT - CREATE CONSTANT TABLE BY HAND
-		OutputDebugString(L"[MAM] No Creator CTAB text present within shader byte code !!");
+		VIREIO_LOG_WARNING("[MAM] No Creator CTAB text present within shader byte code !!");
 		return S_OK;
 	}
 
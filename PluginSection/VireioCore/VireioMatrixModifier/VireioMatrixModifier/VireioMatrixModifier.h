@@ -86,6 +86,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include"..//..//..//..//Aquilinus/Aquilinus/VMT_IDXGISwapChain.h"
 #include"..\..\..\Include\Vireio_GameConfig.h"
 #include"..\..\..\Include\Vireio_Node_Plugtypes.h"
+#include"..\..\..\Include\Vireio_FrameArena.h"
 #include"VireioMatrixModifierMods.h"
 
 #define	PROVOKING_TYPE                                 2                     /**< Provoking type is 2 - just invoker, no provoker **/
@@ -452,6 +453,10 @@ private:
 	/// </summary>
 	std::vector<std::vector<Vireio_Constant_Rule_Index>> m_aasConstantBufferRuleIndices;
 	/// <summary>
+	/// Scratch memory for constant buffer verification, rewound per call.
+	/// </summary>
+	VireioFrameArena m_cScratch;
+	/// <summary>
 	/// View matrix adjustment class.
 	/// @see ViewAdjustment
 	/// </summary>
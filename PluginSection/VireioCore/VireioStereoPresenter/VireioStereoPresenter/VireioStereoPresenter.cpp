@@ -73,6 +73,9 @@ m_eStereoMode(VireioMonitorStereoModes::Vireio_Mono),
 m_bMenu(false),
 m_bMenuHotkeySwitch(false),
 m_pcFontSegeo128(nullptr),
+m_cAssetLoader(1),
+m_unFontTicket(0),
+m_bFontLoadFailed(false),
 m_pbCinemaMode(nullptr)
 {
 	m_strFontName = std::string("PassionOne");
@@ -88,6 +91,12 @@ m_pbCinemaMode(nullptr)
 	// read settings
 	m_strFontName = GetIniFileSetting(m_strFontName, "Stereo Presenter", "strFontName", szFilePathINI, bFileExists);
 
+	// bind the static hotkeys, output the input snapshot
+	m_cInput.Bind(VK_LCONTROL);
+	m_cInput.Bind(0x51);
+	m_cInput.Bind(VK_F12);
+	m_sInputData.pcSnapshot = &m_cInput;
+
 	// TODO !! LOOP THROUGH AVAILABLE MENUES, SET SECONDARY VALUE ! (IN FIRST PROVOKING CALL)
 	m_asSubMenu = std::vector<VireioSubMenu*>();
 	m_asSubMenu.resize(32);
@@ -204,7 +213,13 @@ HBITMAP StereoPresenter::GetLogo()
 /// </summary>
 LPWSTR StereoPresenter::GetCommanderName(DWORD dwCommanderIndex)
 {
-	return L"UNTITLED";
+	switch ((STP_Commanders)dwCommanderIndex)
+	{
+	case STP_Commanders::Input:
+		return VLink::Name(VLink::_L::InputData);
+	}
+
+	return L"";
 }
 
 /// <summary>
@@ -226,6 +241,12 @@ LPWSTR StereoPresenter::GetDecommanderName(DWORD dwDecommanderIndex)
 /// </summary>
 DWORD StereoPresenter::GetCommanderType(DWORD dwCommanderIndex)
 {
+	switch ((STP_Commanders)dwCommanderIndex)
+	{
+	case STP_Commanders::Input:
+		return VLink::Link(VLink::_L::InputData);
+	}
+
 	return 0;
 }
 
@@ -248,6 +269,12 @@ DWORD StereoPresenter::GetDecommanderType(DWORD dwDecommanderIndex)
 /// </summary>
 void* StereoPresenter::GetOutputPointer(DWORD dwCommanderIndex)
 {
+	switch ((STP_Commanders)dwCommanderIndex)
+	{
+	case STP_Commanders::Input:
+		return (void*)&m_sInputData;
+	}
+
 	return nullptr;
 }
 
@@ -344,78 +371,21 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 			{
 				m_sSubMenu.asEntries[nIx].bOnChanged = false;
 
-				// font ?
+				// font ? load it on the asset loader, the font is replaced once decoded
 				if (nIx == ENTRY_FONT)
 				{
-					// get device and context
-					ID3D11Device* pcDevice = nullptr;
-					ID3D11DeviceContext* pcContext = nullptr;
-					HRESULT nHr = S_OK;
-					if ((eD3DInterface == INTERFACE_IDXGISWAPCHAIN) && (eD3DMethod == METHOD_IDXGISWAPCHAIN_PRESENT))
-						nHr = GetDeviceAndContext((IDXGISwapChain*)pThis, &pcDevice, &pcContext);
-					else
-					{
-						if (m_psStereoData)
-						{
-							if (m_psStereoData->pcTex11DrawSRV[0])
-								m_psStereoData->pcTex11DrawSRV[0]->GetDevice(&pcDevice);
-							if (pcDevice)
-								pcDevice->GetImmediateContext(&pcContext);
-							else nHr = E_FAIL;
-							if (!pcContext) nHr = E_FAIL;
-						}
-						else
-							nHr = E_FAIL;
-					}
-					if (SUCCEEDED(nHr))
-					{
-						HRESULT nHr;
-						// get base directory and convert to wchar_t string
-						std::wstring strVireioPathW = GetBaseDir();
-						std::string strVireioPath;
-						for (wchar_t c : strVireioPathW) strVireioPath += (char)c;
-
-						// add file path
-						strVireioPath += "..//..//font//";
-						strVireioPath += m_sSubMenu.asEntries[nIx].astrValueEnumeration[m_sSubMenu.asEntries[nIx].unValue];
-						strVireioPath += ".spritefont";
-						OutputDebugStringA(strVireioPath.c_str());
-
-						// create font, make backup
-						VireioFont* pcOldFont = m_pcFontSegeo128;
-						m_pcFontSegeo128 = new VireioFont(pcDevice, pcContext, strVireioPath.c_str(), 128.0f, 1.0f, nHr, 1);
-						if (FAILED(nHr))
-						{
-							delete m_pcFontSegeo128; m_pcFontSegeo128 = pcOldFont;
-						}
-						else
-						{
-							// set new font name
-							m_strFontName = m_sSubMenu.asEntries[nIx].astrValueEnumeration[m_sSubMenu.asEntries[nIx].unValue];
-
-							// write to ini file
-							char szFilePathINI[1024];
-							GetCurrentDirectoryA(1024, szFilePathINI);
-							strcat_s(szFilePathINI, "\\VireioPerception.ini");
-							WritePrivateProfileStringA("Stereo Presenter", "strFontName", m_strFontName.c_str(), szFilePathINI);
-						}
-					}
-					SAFE_RELEASE(pcDevice);
-					SAFE_RELEASE(pcContext);
+					m_bFontLoadFailed = false;
+					LoadFontAsync(m_sSubMenu.asEntries[nIx].astrValueEnumeration[m_sSubMenu.asEntries[nIx].unValue]);
 				}
 
 			}
 		}
 	}
 
-	/// => Handle Controller 
-	XINPUT_STATE sControllerState;
-	bool bControllerAttached = false;
-	ZeroMemory(&sControllerState, sizeof(XINPUT_STATE));
-	if (XInputGetState(0, &sControllerState) == ERROR_SUCCESS)
-	{
-		bControllerAttached = true;
-	}
+	/// => Take the input snapshot, the only place keyboard and controller are polled
+	m_cInput.Update(m_cInputSource, dwTimeCur);
+	const VireioInputState& sInput = m_cInput.GetState();
+	bool bControllerAttached = sInput.bControllerAttached;
 
 	if (true)
 	{
@@ -425,7 +395,7 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 
 		// keyboard menu on/off event + get hand poses
 		UINT uIxHandPoses = 0, uIxPoseRequest = 0;
-		s_bOnMenu = GetAsyncKeyState(VK_LCONTROL) && GetAsyncKeyState(0x51);
+		s_bOnMenu = m_cInput.IsDown(VK_LCONTROL) && m_cInput.IsDown(0x51);
 		for (UINT unIx = 0; unIx < 32; unIx++)
 		{
 			// set menu bool event
@@ -461,7 +431,7 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 		// static hotkeys :  LCTRL+Q - toggle vireio menu
 		//                   F11 - toggle full immersive mode
 		//                   F12 - toggle stereo output
-		if (GetAsyncKeyState(VK_F12))
+		if (m_cInput.IsDown(VK_F12))
 		{
 			m_bHotkeySwitch = true;
 		}
@@ -495,7 +465,7 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 		static bool bFullImmersiveSwitch = false, bFullImmersiveSwitchKb = false;
 		if (bControllerAttached)
 		{
-			if ((sControllerState.Gamepad.wButtons & XINPUT_GAMEPAD_LEFT_THUMB) && (sControllerState.Gamepad.wButtons & XINPUT_GAMEPAD_RIGHT_THUMB))
+			if (m_cInput.IsButtonDown(XINPUT_GAMEPAD_LEFT_THUMB | XINPUT_GAMEPAD_RIGHT_THUMB))
 			{
 				bFullImmersiveSwitch = true;
 			}
@@ -513,7 +483,7 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 		}
 
 		// ...then on keyboard (F11)
-		if (GetAsyncKeyState(VK_F12))
+		if (m_cInput.IsDown(VK_F12))
 		{
 			bFullImmersiveSwitchKb = true;
 		}
@@ -537,21 +507,21 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 			// handle controller
 			if (bControllerAttached)
 			{
-				if (sControllerState.Gamepad.wButtons & XINPUT_GAMEPAD_BACK)
+				if (m_cInput.IsButtonDown(XINPUT_GAMEPAD_BACK))
 				{
 					m_abMenuEvents[VireioMenuEvent::OnExit] = TRUE;
 				}
-				if (sControllerState.Gamepad.wButtons & XINPUT_GAMEPAD_A)
+				if (m_cInput.IsButtonDown(XINPUT_GAMEPAD_A))
 				{
 					m_abMenuEvents[VireioMenuEvent::OnAccept] = TRUE;
 				}
-				if (sControllerState.Gamepad.sThumbLY > 28000)
+				if (sInput.nThumbLY > 28000)
 					m_abMenuEvents[VireioMenuEvent::OnUp] = TRUE;
-				if (sControllerState.Gamepad.sThumbLY < -28000)
+				if (sInput.nThumbLY < -28000)
 					m_abMenuEvents[VireioMenuEvent::OnDown] = TRUE;
-				if (sControllerState.Gamepad.sThumbLX > 28000)
+				if (sInput.nThumbLX > 28000)
 					m_abMenuEvents[VireioMenuEvent::OnRight] = TRUE;
-				if (sControllerState.Gamepad.sThumbLX < -28000)
+				if (sInput.nThumbLX < -28000)
 					m_abMenuEvents[VireioMenuEvent::OnLeft] = TRUE;
 
 			}
@@ -637,7 +607,7 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 					descDepth.CPUAccessFlags = 0;
 					descDepth.MiscFlags = 0;
 					if (FAILED(pcDevice->CreateTexture2D(&descDepth, NULL, &m_pcDSGeometry11)))
-						OutputDebugString(L"[STP] Failed to create depth stencil.");
+						VIREIO_LOG_ERROR("[STP] Failed to create depth stencil.");
 
 					// Create the depth stencil view
 					D3D11_DEPTH_STENCIL_VIEW_DESC descDSV;
@@ -646,7 +616,7 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 					descDSV.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
 					descDSV.Texture2D.MipSlice = 0;
 					if (FAILED(pcDevice->CreateDepthStencilView(m_pcDSGeometry11, &descDSV, &m_pcDSVGeometry11)))
-						OutputDebugString(L"[STP] Failed to create depth stencil view.");
+						VIREIO_LOG_ERROR("[STP] Failed to create depth stencil view.");
 				}
 			}
 
@@ -657,10 +627,10 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 
 			// backup all states
 			D3DX11_STATE_BLOCK sStateBlock;
-			CreateStateblock(pcContext, &sStateBlock);
+			CreateStateblock(pcContext, &sStateBlock, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 			// clear all states, set targets
-			ClearContextState(pcContext);
+			ClearContextState(pcContext, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 			// set the menu texture (if present)
 			if (m_psStereoData)
@@ -717,25 +687,40 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 					pcContext->ClearDepthStencilView(m_pcDSVGeometry11, D3D11_CLEAR_DEPTH, 1.0f, 0);
 				}
 
-			// create the font class if not present 
+			// execute finished asset loads
+			m_cAssetLoader.Poll();
+
+			// create the font class if decoded, keep the old font on failure
 			nHr = S_OK;
-			if (!m_pcFontSegeo128)
+			if (m_psFontData)
 			{
-				// get base directory and convert to wchar_t string
-				std::wstring strVireioPathW = GetBaseDir();
-				std::string strVireioPath;
-				for (wchar_t c : strVireioPathW) strVireioPath += (char)c;
-
-				// add file path
-				strVireioPath += "..//..//font//";
-				strVireioPath += m_strFontName;
-				strVireioPath += ".spritefont";
-				OutputDebugStringA(strVireioPath.c_str());
-
-				// create font
-				m_pcFontSegeo128 = new VireioFont(pcDevice, pcContext, strVireioPath.c_str(), 128.0f, 1.0f, nHr, 1);
+				VireioFont* pcFont = new VireioFont(pcDevice, pcContext, *m_psFontData, 128.0f, 1.0f, nHr, 1);
+				m_psFontData.reset();
+				if (FAILED(nHr))
+				{
+					delete pcFont;
+					m_bFontLoadFailed = true;
+				}
+				else
+				{
+					if (m_pcFontSegeo128) delete m_pcFontSegeo128;
+					m_pcFontSegeo128 = pcFont;
+
+					if (m_strFontName != m_strFontNameLoaded)
+					{
+						// set new font name
+						m_strFontName = m_strFontNameLoaded;
+
+						// write to ini file
+						char szFilePathINI[1024];
+						GetCurrentDirectoryA(1024, szFilePathINI);
+						strcat_s(szFilePathINI, "\\VireioPerception.ini");
+						WritePrivateProfileStringA("Stereo Presenter", "strFontName", m_strFontName.c_str(), szFilePathINI);
+					}
+				}
 			}
-			if (FAILED(nHr)) { delete m_pcFontSegeo128; m_pcFontSegeo128 = nullptr; }
+			else if ((!m_pcFontSegeo128) && (!m_unFontTicket) && (!m_bFontLoadFailed))
+				LoadFontAsync(m_strFontName);
 
 			// render text (if font present)
 			if (m_pcFontSegeo128)
@@ -752,8 +737,9 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 
 				m_pcFontSegeo128->ToRender(pcContext, fGlobalTime, m_sMenuControl.fYOrigin, 30.0f, fDepthTremble);
 				RenderMenu(pcDevice, pcContext);
+				m_pcFontSegeo128->Flush(pcDevice, pcContext);
 			}
-			else OutputDebugString(L"Failed to create font!");
+			else if (m_bFontLoadFailed) VIREIO_LOG_ERROR("Failed to create font!");
 
 			// set back device
 			ApplyStateblock(pcContext, &sStateBlock);
@@ -788,10 +774,10 @@ void* StereoPresenter::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3
 
 				// backup all states
 				D3DX11_STATE_BLOCK sStateBlock;
-				CreateStateblock(pcContext, &sStateBlock);
+				CreateStateblock(pcContext, &sStateBlock, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 				// clear all states, set targets
-				ClearContextState(pcContext);
+				ClearContextState(pcContext, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 				// set first active render target - the stored back buffer - get the stored private data view
 				ID3D11Texture2D* pcBackBuffer = nullptr;
@@ -919,7 +905,7 @@ void StereoPresenter::RenderMenu(ID3D11Device* pcDevice, ID3D11DeviceContext* pc
 		if ((m_sMenuControl.nMenuIx >= 0) && (m_sMenuControl.nMenuIx < 32))
 		{
 			if (!m_asSubMenu[m_sMenuControl.nMenuIx])
-				OutputDebugString(L"[STP] Fatal menu error -> wrong menu index !!");
+				VIREIO_LOG_ERROR("[STP] Fatal menu error -> wrong menu index !!");
 			else
 				RenderSubMenu(pcDevice, pcContext, m_asSubMenu[m_sMenuControl.nMenuIx]);
 		}
@@ -928,7 +914,7 @@ void StereoPresenter::RenderMenu(ID3D11Device* pcDevice, ID3D11DeviceContext* pc
 			if (m_sMenuControl.nMenuIx == 32)
 				RenderSubMenu(pcDevice, pcContext, &m_sSubMenu);
 			else
-				OutputDebugString(L"[STP] Fatal menu error -> wrong menu index !!");
+				VIREIO_LOG_ERROR("[STP] Fatal menu error -> wrong menu index !!");
 }
 
 /// <summary>
@@ -936,57 +922,20 @@ void StereoPresenter::RenderMenu(ID3D11Device* pcDevice, ID3D11DeviceContext* pc
 /// </summary>
 void StereoPresenter::RenderSubMenu(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, VireioSubMenu* psSubMenu)
 {
+	// update the retained text, formats changed entries only
+	m_cMenuText.Update(psSubMenu);
+
 	// render title
-	m_pcFontSegeo128->RenderTextLine(pcDevice, pcContext, psSubMenu->strSubMenu.c_str());
+	m_pcFontSegeo128->RenderTextLine(pcDevice, pcContext, m_cMenuText.GetTitle().c_str());
 	m_pcFontSegeo128->Enter();
 
-	// loop through entries
-	for (size_t nEntryIx = 0; nEntryIx < psSubMenu->asEntries.size(); nEntryIx++)
+	// loop through entries, render the text lines
+	for (size_t nEntryIx = 0; nEntryIx < m_cMenuText.GetEntryCount(); nEntryIx++)
 	{
 		// entry is inactive ?
-		if (!psSubMenu->asEntries[nEntryIx].bIsActive) continue;
-
-		// create an output stream based on entry string
-		std::stringstream strOutput = std::stringstream();
-		strOutput << psSubMenu->asEntries[nEntryIx].strEntry;
-
-		// switch by entry type
-		switch (psSubMenu->asEntries[nEntryIx].eType)
-		{
-		case VireioMenuEntry::Entry_Bool:
-			if (psSubMenu->asEntries[nEntryIx].bValue)
-				strOutput << " - True ";
-			else
-				strOutput << " - False ";
-			break;
-		case VireioMenuEntry::Entry_Int:
-			strOutput << " : " << psSubMenu->asEntries[nEntryIx].nValue;
-			break;
-		case VireioMenuEntry::Entry_UInt:
-			if (psSubMenu->asEntries[nEntryIx].bValueEnumeration)
-			{
-				// render the enumeration string
-				UINT unIx = psSubMenu->asEntries[nEntryIx].unValue;
-				if (unIx < (UINT)psSubMenu->asEntries[nEntryIx].astrValueEnumeration.size())
-					strOutput << " : " << psSubMenu->asEntries[nEntryIx].astrValueEnumeration[unIx];
-			}
-			else
-			{
-				strOutput << " : " << psSubMenu->asEntries[nEntryIx].unValue;
-			}
-			break;
-		case VireioMenuEntry::Entry_Float:
-			strOutput << " : " << psSubMenu->asEntries[nEntryIx].fValue;
-			break;
-		case VireioMenuEntry::Entry:
-			break;
-		default:
-			strOutput << "ERROR";
-			break;
-		}
+		if (!m_cMenuText.IsActive(nEntryIx)) continue;
 
-		// render the text line
-		m_pcFontSegeo128->RenderTextLine(pcDevice, pcContext, strOutput.str().c_str());
+		m_pcFontSegeo128->RenderTextLine(pcDevice, pcContext, m_cMenuText.GetText(nEntryIx).c_str());
 	}
 }
 
@@ -1005,7 +954,7 @@ void StereoPresenter::UpdateMenu(float fGlobalTime)
 		if ((m_sMenuControl.nMenuIx >= 0) && (m_sMenuControl.nMenuIx < 32))
 		{
 			if (!m_asSubMenu[m_sMenuControl.nMenuIx])
-				OutputDebugString(L"[STP] Fatal menu error -> wrong menu index !!");
+				VIREIO_LOG_ERROR("[STP] Fatal menu error -> wrong menu index !!");
 			else
 				UpdateSubMenu(m_asSubMenu[m_sMenuControl.nMenuIx], fGlobalTime);
 		}
@@ -1014,7 +963,50 @@ void StereoPresenter::UpdateMenu(float fGlobalTime)
 			if (m_sMenuControl.nMenuIx == 32)
 				UpdateSubMenu(&m_sSubMenu, fGlobalTime);
 			else
-				OutputDebugString(L"[STP] Fatal menu error -> wrong menu index !!");
+				VIREIO_LOG_ERROR("[STP] Fatal menu error -> wrong menu index !!");
+}
+
+/// <summary>
+/// Queues a .spritefont file load on the asset loader.
+/// The font is created in the next Present() call after the file got decoded.
+/// @param strFontName Font file name without extension.
+/// </summary>
+void StereoPresenter::LoadFontAsync(const std::string& strFontName)
+{
+	// a new selection cancels the former one
+	if (m_unFontTicket) m_cAssetLoader.Cancel(m_unFontTicket);
+
+	// get base directory and convert to wchar_t string
+	std::wstring strVireioPathW = GetBaseDir();
+	std::string strVireioPath;
+	for (wchar_t c : strVireioPathW) strVireioPath += (char)c;
+
+	// add file path
+	strVireioPath += "..//..//font//";
+	strVireioPath += strFontName;
+	strVireioPath += ".spritefont";
+	OutputDebugStringA(strVireioPath.c_str());
+
+	std::shared_ptr<SpriteFontData> psData = std::make_shared<SpriteFontData>();
+	m_unFontTicket = m_cAssetLoader.Submit(
+		[psData, strVireioPath](const std::atomic<bool>& bCancel)
+	{
+		return SUCCEEDED(VireioFont::LoadSpriteFont(strVireioPath.c_str(), *psData));
+	},
+		[this, psData, strFontName](bool bSucceeded)
+	{
+		m_unFontTicket = 0;
+		if (bSucceeded)
+		{
+			m_psFontData = psData;
+			m_strFontNameLoaded = strFontName;
+		}
+		else
+		{
+			VIREIO_LOG_ERROR("[STP] Failed to load font file !");
+			m_bFontLoadFailed = true;
+		}
+	});
 }
 
 /// <summary>
@@ -1035,13 +1027,9 @@ void StereoPresenter::UpdateSubMenu(VireioSubMenu* psSubMenu, float fGlobalTime)
 		}
 	}
 
-	// update the sub (or main) menu active entries number
-	psSubMenu->unActiveEntries = 0;
-	for (size_t nIx = 0; nIx < psSubMenu->asEntries.size(); nIx++)
-	{
-		if (psSubMenu->asEntries[nIx].bIsActive)
-			psSubMenu->unActiveEntries++;
-	}
+	// update the sub (or main) menu active entries number, retained unless an entry changed
+	m_cMenuText.Update(psSubMenu);
+	psSubMenu->unActiveEntries = m_cMenuText.GetActiveEntries();
 
 	// set the menu y origin
 	m_sMenuControl.fYOrigin = -2.8f + (float)m_sMenuControl.unSelection * -1.4f;
@@ -1250,7 +1238,7 @@ void StereoPresenter::UpdateSubMenu(VireioSubMenu* psSubMenu, float fGlobalTime)
 				// menu error ?
 				if (unIx >= (UINT)psSubMenu->asEntries.size())
 				{
-					OutputDebugString(L"[STP] Fatal menu structure error ! Empty menu ??");
+					VIREIO_LOG_ERROR("[STP] Fatal menu structure error ! Empty menu ??");
 					m_sMenuControl.unSelection = 0;
 					unIx = 0;
 					break;
@@ -76,13 +76,20 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include"..\..\..\Include\Vireio_GUIDs.h"
 #include"..\..\..\Include\Vireio_DX11Basics.h"
+#include"..\..\..\Include\Vireio_AssetLoader.h"
 #include"..\..\..\Include\Vireio_Node_Plugtypes.h"
 
-#define NUMBER_OF_COMMANDERS                           0
+#define NUMBER_OF_COMMANDERS                           1
 #define NUMBER_OF_DECOMMANDERS                         1
 
 #define DEBUG_F(fmt, ...) { va_list args; va_start(args, fmt); char buf[8192]; vsnprintf_s(buf, 8192, fmt, args); va_end(args); OutputDebugStringA(buf); }
 
+/// <summary>Node commander enumeration</summary>
+enum STP_Commanders
+{
+	Input
+};
+
 /// <summary>Node decommander enumeration</summary>
 enum STP_Decommanders
 {
@@ -141,6 +148,7 @@ private:
 	void                    RenderSubMenu(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, VireioSubMenu* psSubMenu);
 	void                    UpdateMenu(float fGlobalTime);
 	void                    UpdateSubMenu(VireioSubMenu* psSubMenu, float fGlobalTime);
+	void                    LoadFontAsync(const std::string& strFontName);
 
 	/// <summary>
 	/// Stereo data input pointer
@@ -244,6 +252,38 @@ private:
 	/// </summary>
 	std::string m_strFontName;
 	/// <summary>
+	/// Asset loader, reads .spritefont files off the render thread.
+	/// </summary>
+	VireioAssetLoader m_cAssetLoader;
+	/// <summary>
+	/// Ticket of the pending font load, zero if none.
+	/// </summary>
+	unsigned m_unFontTicket;
+	/// <summary>
+	/// Decoded font data waiting for D3D resource creation.
+	/// </summary>
+	std::shared_ptr<SpriteFontData> m_psFontData;
+	/// <summary>
+	/// Font file name of the decoded font data.
+	/// </summary>
+	std::string m_strFontNameLoaded;
+	/// <summary>
+	/// True if the last font load failed, no reload until a new font is chosen.
+	/// </summary>
+	bool m_bFontLoadFailed;
+	/// <summary>
+	/// Input snapshot, taken once per present and provided to all nodes.
+	/// </summary>
+	VireioInputSnapshot m_cInput;
+	/// <summary>
+	/// Input source for the snapshot.
+	/// </summary>
+	VireioInputSourceWin32 m_cInputSource;
+	/// <summary>
+	/// Input commander data.
+	/// </summary>
+	InputData m_sInputData;
+	/// <summary>
 	/// The sub menu for the main menu.
 	/// </summary>
 	VireioSubMenu m_sMainMenu;
@@ -257,6 +297,10 @@ private:
 	/// </summary>
 	std::vector<VireioSubMenu*> m_asSubMenu;
 	/// <summary>
+	/// Retained text of the sub menu currently shown.
+	/// </summary>
+	VireioMenuText m_cMenuText;
+	/// <summary>
 	/// Font selection value.
 	/// </summary>
 	UINT m_unFontSelection;
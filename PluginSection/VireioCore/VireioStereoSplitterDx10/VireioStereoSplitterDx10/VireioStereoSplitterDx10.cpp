@@ -927,7 +927,7 @@ void StereoSplitter::XSSetShaderResourceViews(std::array<ID3D11ShaderResourceVie
 							}
 							else
 							{
-								OutputDebugString(L"Failed to create shader resource view!");
+								VIREIO_LOG_ERROR("Failed to create shader resource view!");
 								apcActiveShaderResourceViews[dwIndexActive + RESOURCE_REGISTER_R_11] = ppcShaderResourceViews[dwIndex];
 							}
 						}
@@ -941,7 +941,7 @@ void StereoSplitter::XSSetShaderResourceViews(std::array<ID3D11ShaderResourceVie
 			}
 			else
 			{
-				OutputDebugString(L"Unknown Shader Resource View !");
+				VIREIO_LOG_ERROR("Unknown Shader Resource View !");
 
 				// set shader resource view for both sides
 				apcActiveShaderResourceViews[dwIndexActive] = ppcShaderResourceViews[dwIndex];
@@ -971,7 +971,7 @@ void StereoSplitter::CreateStereoView(ID3D11Device* pcDevice, ID3D11DeviceContex
 				if (FAILED(pcView->QueryInterface(__uuidof(ID3D11UnorderedAccessView), &pvObject)))
 				{
 					// set to unsupported bind flag "video encoder"
-					OutputDebugString(L"StereoSplitterDX10: Failed to determine d3d view type !");
+					VIREIO_LOG_ERROR("StereoSplitterDX10: Failed to determine d3d view type !");
 					eBindFlag = D3D11_BIND_FLAG::D3D11_BIND_VIDEO_ENCODER;
 				}
 				else
@@ -1057,7 +1057,7 @@ void StereoSplitter::CreateStereoView(ID3D11Device* pcDevice, ID3D11DeviceContex
 
 				if (FAILED(((ID3D11Device*)pcDevice)->CreateTexture1D(&sDesc, NULL, (ID3D11Texture1D**)&pcResourceTwin)))
 				{
-					OutputDebugString(L"StereoSplitterDX10 : Failed to create twin texture !");
+					VIREIO_LOG_ERROR("StereoSplitterDX10 : Failed to create twin texture !");
 					break;
 				}
 				else
@@ -1085,7 +1085,7 @@ void StereoSplitter::CreateStereoView(ID3D11Device* pcDevice, ID3D11DeviceContex
 
 				if (FAILED(((ID3D11Device*)pcDevice)->CreateTexture2D(&sDesc, NULL, (ID3D11Texture2D**)&pcResourceTwin)))
 				{
-					OutputDebugString(L"StereoSplitterDX10 : Failed to create twin texture !");
+					VIREIO_LOG_ERROR("StereoSplitterDX10 : Failed to create twin texture !");
 					break;
 				}
 				else
@@ -1109,7 +1109,7 @@ void StereoSplitter::CreateStereoView(ID3D11Device* pcDevice, ID3D11DeviceContex
 
 				if (FAILED(((ID3D11Device*)pcDevice)->CreateTexture3D(&sDesc, NULL, (ID3D11Texture3D**)&pcResourceTwin)))
 				{
-					OutputDebugString(L"StereoSplitterDX10 : Failed to create twin texture !");
+					VIREIO_LOG_ERROR("StereoSplitterDX10 : Failed to create twin texture !");
 					break;
 				}
 				else
@@ -1132,7 +1132,7 @@ void StereoSplitter::CreateStereoView(ID3D11Device* pcDevice, ID3D11DeviceContex
 			// create the shader resource view
 			ID3D11ShaderResourceView* pcViewTwin = nullptr;
 			if (FAILED(((ID3D11Device*)pcDevice)->CreateShaderResourceView(pcResourceTwin, &sDescSR11, &pcViewTwin)))
-				OutputDebugString(L"StereoSplitterDX10 : Failed to create twin view D3D11_BIND_SHADER_RESOURCE!");
+				VIREIO_LOG_ERROR("StereoSplitterDX10 : Failed to create twin view D3D11_BIND_SHADER_RESOURCE!");
 			else
 				if (pcResourceTwin)
 				{
@@ -1149,7 +1149,7 @@ void StereoSplitter::CreateStereoView(ID3D11Device* pcDevice, ID3D11DeviceContex
 			// create the render target view twin
 			ID3D11RenderTargetView* pcViewTwin = nullptr;
 			if (FAILED(((ID3D11Device*)pcDevice)->CreateRenderTargetView(pcResourceTwin, &sDescRT11, &pcViewTwin)))
-				OutputDebugString(L"StereoSplitterDX10 : Failed to create twin view D3D11_BIND_RENDER_TARGET !");
+				VIREIO_LOG_ERROR("StereoSplitterDX10 : Failed to create twin view D3D11_BIND_RENDER_TARGET !");
 			else
 				if (pcResourceTwin)
 				{
@@ -1164,7 +1164,7 @@ void StereoSplitter::CreateStereoView(ID3D11Device* pcDevice, ID3D11DeviceContex
 			// create the depth stencil view twin
 			ID3D11DepthStencilView* pcViewTwin = nullptr;
 			if (FAILED(((ID3D11Device*)pcDevice)->CreateDepthStencilView(pcResourceTwin, &sDescDS11, &pcViewTwin)))
-				OutputDebugString(L"StereoSplitterDX10 : Failed to create twin view D3D11_BIND_DEPTH_STENCIL !");
+				VIREIO_LOG_ERROR("StereoSplitterDX10 : Failed to create twin view D3D11_BIND_DEPTH_STENCIL !");
 			else
 				if (pcResourceTwin)
 				{
@@ -1179,7 +1179,7 @@ void StereoSplitter::CreateStereoView(ID3D11Device* pcDevice, ID3D11DeviceContex
 			// create the unordered access view twin
 			ID3D11UnorderedAccessView* pcViewTwin = nullptr;
 			if (FAILED(((ID3D11Device*)pcDevice)->CreateUnorderedAccessView(pcResourceTwin, &sDescUAV11, &pcViewTwin)))
-				OutputDebugString(L"StereoSplitterDX10 : Failed to create twin view D3D11_BIND_UNORDERED_ACCESS !");
+				VIREIO_LOG_ERROR("StereoSplitterDX10 : Failed to create twin view D3D11_BIND_UNORDERED_ACCESS !");
 			else
 				if (pcResourceTwin)
 				{
@@ -1761,7 +1761,7 @@ void StereoSplitter::CSSetUnorderedAccessViews(UINT uStartSlot, UINT uNumUAVs, I
 
 
 		}
-		else OutputDebugString(L"[STS] Game uses DirectX 11.1 : D3D11_1_UAV_SLOT_COUNT");
+		else VIREIO_LOG_INFO("[STS] Game uses DirectX 11.1 : D3D11_1_UAV_SLOT_COUNT");
 	}
 }
 
@@ -2313,7 +2313,7 @@ void StereoSplitter::Present(int& nFlags)
 						if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)pcResourceTwin, &sDesc, &pcShaderResourceView))))
 						{
 							if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)pcResourceTwin, nullptr, &pcShaderResourceView))))
-								OutputDebugString(L"[STS] Failed to create texture view!");
+								VIREIO_LOG_ERROR("[STS] Failed to create texture view!");
 						}
 						else
 						{
@@ -2411,7 +2411,7 @@ void StereoSplitter::Present(int& nFlags)
 					pcView->Release();
 				}
 				else
-					OutputDebugString(L"[STS] No back buffer stereo texture present !");
+					VIREIO_LOG_WARNING("[STS] No back buffer stereo texture present !");
 
 				// get device
 				ID3D11Device* pcDevice = nullptr;
@@ -2426,9 +2426,9 @@ void StereoSplitter::Present(int& nFlags)
 					sDescRT.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
 
 					if (FAILED(pcDevice->CreateTexture2D(&sDescRT, NULL, &m_sStereoData.pcTex11[0])))
-						OutputDebugString(L"[STS] Failed to create Texture.");
+						VIREIO_LOG_ERROR("[STS] Failed to create Texture.");
 					if (FAILED(pcDevice->CreateTexture2D(&sDescRT, NULL, &m_sStereoData.pcTex11[1])))
-						OutputDebugString(L"[STS] Failed to create Texture.");
+						VIREIO_LOG_ERROR("[STS] Failed to create Texture.");
 
 					// ...and the views
 					sDesc.Format = sDescRT.Format;
@@ -2439,24 +2439,24 @@ void StereoSplitter::Present(int& nFlags)
 					if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)m_sStereoData.pcTex11[0], &sDesc, &m_sStereoData.pcTex11InputSRV[0]))))
 					{
 						if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)m_sStereoData.pcTex11[0], nullptr, &m_sStereoData.pcTex11InputSRV[0]))))
-							OutputDebugString(L"[STS] Failed to create texture shader resource view!");
+							VIREIO_LOG_ERROR("[STS] Failed to create texture shader resource view!");
 					}
-					else OutputDebugString(L"Succeeded to create SRV");
+					else VIREIO_LOG_DEBUG("Succeeded to create SRV");
 					if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)m_sStereoData.pcTex11[1], &sDesc, &m_sStereoData.pcTex11InputSRV[1]))))
 					{
 						if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)m_sStereoData.pcTex11[1], nullptr, &m_sStereoData.pcTex11InputSRV[1]))))
-							OutputDebugString(L"[STS] Failed to create texture shader resource view!");
+							VIREIO_LOG_ERROR("[STS] Failed to create texture shader resource view!");
 					}
 
 					ID3D11RenderTargetView* pcRTV[2];
 					pcRTV[0] = nullptr; pcRTV[1] = nullptr;
 					if ((FAILED(pcDevice->CreateRenderTargetView((ID3D11Resource*)m_sStereoData.pcTex11[0], NULL, &pcRTV[0]))))
 					{
-						OutputDebugString(L"[STS] Failed to create texture render target view!");
+						VIREIO_LOG_ERROR("[STS] Failed to create texture render target view!");
 					}
 					if ((FAILED(pcDevice->CreateRenderTargetView((ID3D11Resource*)m_sStereoData.pcTex11[1], NULL, &pcRTV[1]))))
 					{
-						OutputDebugString(L"[STS] Failed to create texture render target view!");
+						VIREIO_LOG_ERROR("[STS] Failed to create texture render target view!");
 					}
 
 					// set this as private data interface to the shader resource views instead of texture here !!!!
@@ -2478,7 +2478,7 @@ void StereoSplitter::Present(int& nFlags)
 			{
 				// no render target view present ? break
 				if (!m_bPresent)
-					OutputDebugString(L"[STS] No back buffer render target view present!");
+					VIREIO_LOG_WARNING("[STS] No back buffer render target view present!");
 
 				pcBackBuffer->Release();
 				m_pcActiveBackBuffer11 = nullptr;
@@ -2500,7 +2500,7 @@ void StereoSplitter::Present(int& nFlags)
 			{
 				// no render target view present ? return
 				if (!m_bPresent)
-					OutputDebugString(L"[STS] Back buffer active, no stereo !");
+					VIREIO_LOG_WARNING("[STS] Back buffer active, no stereo !");
 			}
 		}
 		pcBackBuffer->Release();
@@ -2508,7 +2508,7 @@ void StereoSplitter::Present(int& nFlags)
 	else
 	{
 		// no backbuffer present ? should not be...
-		OutputDebugString(L"[STS] No back buffer present !");
+		VIREIO_LOG_WARNING("[STS] No back buffer present !");
 		m_pcActiveBackBuffer11 = NULL;
 		m_pcActiveStereoTwinBackBuffer11 = NULL;
 	}
@@ -2570,12 +2570,12 @@ void StereoSplitter::Present(int& nFlags)
 		D3D11_VIEWPORT psViewport[16];
 		pcContext->RSGetViewports(&dwNumViewports, psViewport);
 
-		// backup all states
+		// backup the states set here
 		D3DX11_STATE_BLOCK sStateBlock;
-		CreateStateblock(pcContext, &sStateBlock);
+		CreateStateblock(pcContext, &sStateBlock, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
-		// clear all states, set targets
-		ClearContextState(pcContext);
+		// clear these states, set targets
+		ClearContextState(pcContext, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 		// set first active render target - the stored back buffer - get the stored private data view
 		ID3D11Texture2D* pcBackBuffer = nullptr;
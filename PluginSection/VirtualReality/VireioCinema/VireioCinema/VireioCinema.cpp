@@ -90,8 +90,10 @@ m_unMenuModelIndex(0)
 	m_apcTex11InputSRV[0] = nullptr;
 	m_apcTex11InputSRV[1] = nullptr;
 	m_pcSamplerState = nullptr;
-	m_pcTex9Copy[0] = nullptr;
-	m_pcTex9Copy[1] = nullptr;
+	ZeroMemory(m_apcSurface9Ring, sizeof(m_apcSurface9Ring));
+	ZeroMemory(m_apcSurface9Readback, sizeof(m_apcSurface9Readback));
+	ZeroMemory(&m_sDescTransfer, sizeof(D3DSURFACE_DESC));
+	m_unTransferEyes = 0;
 	m_pcSharedTexture[0] = nullptr;
 	m_pcSharedTexture[1] = nullptr;
 	m_pcTexCopy11[0] = nullptr;
@@ -181,6 +183,7 @@ m_unMenuModelIndex(0)
 	m_sCinemaRoomSetup.bImmersiveMode = (GetIniFileSetting((DWORD)m_sCinemaRoomSetup.bImmersiveMode, "Stereo Cinema", "sCinemaRoomSetup.bImmersiveMode", szFilePathINI, bFileExists) != 0);
 	m_sCinemaRoomSetup.fGamma = GetIniFileSetting(m_sCinemaRoomSetup.fGamma, "Stereo Cinema", "sCinemaRoomSetup.fGamma", szFilePathINI, bFileExists);
 	m_unMouseTickCount = GetIniFileSetting((DWORD)m_unMouseTickCount, "Stereo Cinema", "unMouseTickCount", szFilePathINI, bFileExists);
+	m_cTransferRing.SetLatency(GetIniFileSetting((DWORD)m_cTransferRing.GetLatency(), "Stereo Cinema", "unTransferLatency", szFilePathINI, bFileExists));
 	m_sImmersiveFullscreenSettings.fIPD = GetIniFileSetting(m_sImmersiveFullscreenSettings.fIPD, "Stereo Presenter", "fIPD", szFilePathINI, bFileExists);
 	m_sImmersiveFullscreenSettings.fVSD = GetIniFileSetting(m_sImmersiveFullscreenSettings.fVSD, "Stereo Presenter", "fVSD", szFilePathINI, bFileExists);
 
@@ -514,6 +517,7 @@ VireioCinema::~VireioCinema()
 	SAFE_RELEASE(m_pcPSGeometry11);
 	SAFE_RELEASE(m_pcPSMenuScreen11);
 	SAFE_RELEASE(m_pcSamplerState);
+	ReleaseTransferD3D9();
 
 	SendMessage(m_hDummy, WM_CLOSE, 0, 0);
 }
@@ -734,37 +738,37 @@ void* VireioCinema::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3DMe
 						case 0: // screen
 							SAFE_RELEASE(m_pcPSGeometry11);
 							if (FAILED(CreatePixelShaderEffect(pcDevice, &m_pcPSGeometry11, m_sCinemaRoomSetup.GetTechnique(m_sCinemaRoomSetup.ePixelShaderFX_Screen))))
-								OutputDebugString(L"[CIN] Failed to create pixel shader. !");
+								VIREIO_LOG_ERROR("[CIN] Failed to create pixel shader. !");
 							break;
 						case 1: // wall front
 							SAFE_RELEASE(m_asRenderModels[m_unWallFModelIndex].pcEffect);
 							if (FAILED(CreatePixelShaderEffect(pcDevice, &m_asRenderModels[m_unWallFModelIndex].pcEffect, m_sCinemaRoomSetup.GetTechnique(m_sCinemaRoomSetup.ePixelShaderFX_Wall_FB[0]))))
-								OutputDebugString(L"[CIN] Failed to create pixel shader. !");
+								VIREIO_LOG_ERROR("[CIN] Failed to create pixel shader. !");
 							break;
 						case 2: // wall back
 							SAFE_RELEASE(m_asRenderModels[m_unWallBModelIndex].pcEffect);
 							if (FAILED(CreatePixelShaderEffect(pcDevice, &m_asRenderModels[m_unWallBModelIndex].pcEffect, m_sCinemaRoomSetup.GetTechnique(m_sCinemaRoomSetup.ePixelShaderFX_Wall_FB[1]))))
-								OutputDebugString(L"[CIN] Failed to create pixel shader. !");
+								VIREIO_LOG_ERROR("[CIN] Failed to create pixel shader. !");
 							break;
 						case 3: // wall left
 							SAFE_RELEASE(m_asRenderModels[m_unWallLModelIndex].pcEffect);
 							if (FAILED(CreatePixelShaderEffect(pcDevice, &m_asRenderModels[m_unWallLModelIndex].pcEffect, m_sCinemaRoomSetup.GetTechnique(m_sCinemaRoomSetup.ePixelShaderFX_Wall_LR[0]))))
-								OutputDebugString(L"[CIN] Failed to create pixel shader. !");
+								VIREIO_LOG_ERROR("[CIN] Failed to create pixel shader. !");
 							break;
 						case 4: // wall right
 							SAFE_RELEASE(m_asRenderModels[m_unWallRModelIndex].pcEffect);
 							if (FAILED(CreatePixelShaderEffect(pcDevice, &m_asRenderModels[m_unWallRModelIndex].pcEffect, m_sCinemaRoomSetup.GetTechnique(m_sCinemaRoomSetup.ePixelShaderFX_Wall_LR[1]))))
-								OutputDebugString(L"[CIN] Failed to create pixel shader. !");
+								VIREIO_LOG_ERROR("[CIN] Failed to create pixel shader. !");
 							break;
 						case 5: // floor
 							SAFE_RELEASE(m_asRenderModels[m_unFloorModelIndex].pcEffect);
 							if (FAILED(CreatePixelShaderEffect(pcDevice, &m_asRenderModels[m_unFloorModelIndex].pcEffect, m_sCinemaRoomSetup.GetTechnique(m_sCinemaRoomSetup.ePixelShaderFX_Floor[1]))))
-								OutputDebugString(L"[CIN] Failed to create pixel shader. !");
+								VIREIO_LOG_ERROR("[CIN] Failed to create pixel shader. !");
 							break;
 						case 6: // ceiling
 							SAFE_RELEASE(m_asRenderModels[m_unCeilingModelIndex].pcEffect);
 							if (FAILED(CreatePixelShaderEffect(pcDevice, &m_asRenderModels[m_unCeilingModelIndex].pcEffect, m_sCinemaRoomSetup.GetTechnique(m_sCinemaRoomSetup.ePixelShaderFX_Floor[0]))))
-								OutputDebugString(L"[CIN] Failed to create pixel shader. !");
+								VIREIO_LOG_ERROR("[CIN] Failed to create pixel shader. !");
 							break;
 						}
 					}
@@ -858,7 +862,7 @@ void* VireioCinema::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3DMe
 					return nullptr;
 				}
 				// no device ?
-				OutputDebugString(L"[CIN] Could not resolve which D3D device is in use !");
+				VIREIO_LOG_WARNING("[CIN] Could not resolve which D3D device is in use !");
 			}
 			break;
 		}
@@ -878,7 +882,7 @@ void* VireioCinema::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3DMe
 			LPDIRECT3DSWAPCHAIN9 pSwapChain = (LPDIRECT3DSWAPCHAIN9)pThis;
 			if (!pSwapChain)
 			{
-				OutputDebugString(L"[CIN] No swapchain !");
+				VIREIO_LOG_WARNING("[CIN] No swapchain !");
 				return nullptr;
 			}
 			pSwapChain->GetDevice(&pcDevice);
@@ -886,7 +890,7 @@ void* VireioCinema::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3DMe
 		}
 		if (!pcDevice)
 		{
-			OutputDebugString(L"[CIN] No device !");
+			VIREIO_LOG_WARNING("[CIN] No device !");
 			return nullptr;
 		}
 
@@ -940,7 +944,7 @@ void* VireioCinema::Provoke(void* pThis, int eD3D, int eD3DInterface, int eD3DMe
 ***/
 void VireioCinema::InitD3D9(LPDIRECT3DDEVICE9 pcDevice)
 {
-	OutputDebugString(L"[CIN] Init D3D9...");
+	VIREIO_LOG_INFO("[CIN] Init D3D9...");
 
 	// create d3d11 device/context/swapchain
 	if ((!m_pcD3D11Device) || (!m_pcD3D11Context))
@@ -960,180 +964,220 @@ void VireioCinema::InitD3D9(LPDIRECT3DDEVICE9 pcDevice)
 ***/
 void VireioCinema::RenderD3D9(LPDIRECT3DDEVICE9 pcDevice)
 {
+	IDirect3DSurface9* apcSurfaceSrc[2] = { nullptr, nullptr };
+	UINT unEyes = 0;
+
 	// no splitter data connected ?
 	if (!m_psStereoDataIn)
 	{
 		// get back buffer
-		IDirect3DSurface9* pcBackBuffer = nullptr;
-		pcDevice->GetBackBuffer(0, 0, D3DBACKBUFFER_TYPE_MONO, &pcBackBuffer);
+		pcDevice->GetBackBuffer(0, 0, D3DBACKBUFFER_TYPE_MONO, &apcSurfaceSrc[0]);
 
-		if (!pcBackBuffer)
+		if (!apcSurfaceSrc[0])
+		{
+			VIREIO_LOG_WARNING("[CIN] No D3D9 backbuffer available !");
+			return;
+		}
+		unEyes = 1;
+	}
+	else
+	{
+		// connected textures already initialized ?? return if not
+		if ((!(m_psStereoDataIn->pcTex9Input[0])) || (!(m_psStereoDataIn->pcTex9Input[1])))
 		{
-			OutputDebugString(L"[CIN] No D3D9 backbuffer available !");
+			static int nDummyCounter = 5;
+			if ((nDummyCounter--) <= 0)
+				VIREIO_LOG_WARNING("[CIN] No Input Textures !");
 			return;
 		}
 
-		// get the description and create the copy texture
-		D3DSURFACE_DESC sDescSurfaceD3D9 = {};
-		pcBackBuffer->GetDesc(&sDescSurfaceD3D9);
+		m_psStereoDataIn->pcTex9Input[0]->GetSurfaceLevel(0, &apcSurfaceSrc[0]);
+		m_psStereoDataIn->pcTex9Input[1]->GetSurfaceLevel(0, &apcSurfaceSrc[1]);
+		unEyes = 2;
+	}
+
+	// issue this frame's readback and take over a finished one
+	bool bTransferred = TransferD3D9(pcDevice, apcSurfaceSrc, unEyes);
+	for (UINT unEye = 0; unEye < 2; unEye++)
+		if (apcSurfaceSrc[unEye]) apcSurfaceSrc[unEye]->Release();
+	if (!bTransferred) return;
+
+	if ((m_pcD3D11Device) || (m_pcD3D11Context))
+	{
+		// TODO !! PROVIDE A D3D9 DEVICE HERE
+		RenderD3D11(m_pcD3D11Device, m_pcD3D11Context, nullptr);
+	}
+}
+
+/**
+* Copies the D3D9 source surfaces to the D3D11 copy textures.
+* The current frame is copied on the GPU (StretchRect) to a render target
+* of the transfer ring, the render target copied latency frames before is
+* read back to a system memory surface and locked without waiting. It
+* updates the persistent D3D11 textures in place. If that readback is not
+* finished yet the textures keep the last frame.
+* @param apcSurfaceSrc Source surfaces left/right, right is ignored for mono.
+* @param unEyes 1 = mono backbuffer, 2 = stereo input textures.
+* @returns False if the transfer resources are not available.
+***/
+bool VireioCinema::TransferD3D9(LPDIRECT3DDEVICE9 pcDevice, IDirect3DSurface9** apcSurfaceSrc, UINT unEyes)
+{
+	if (!m_pcD3D11Device) return false;
 
-		// copy texture created ?
-		if (!m_pcTex9Copy[0])
+	// get the description, (re)create the transfer resources on change
+	D3DSURFACE_DESC sDescSurfaceD3D9 = {};
+	apcSurfaceSrc[0]->GetDesc(&sDescSurfaceD3D9);
+	if ((!m_apcSurface9Ring[0][0]) || (m_unTransferEyes != unEyes) ||
+		(m_sDescTransfer.Width != sDescSurfaceD3D9.Width) ||
+		(m_sDescTransfer.Height != sDescSurfaceD3D9.Height) ||
+		(m_sDescTransfer.Format != sDescSurfaceD3D9.Format))
+	{
+		ReleaseTransferD3D9();
+
+		// render targets, one per ring slot (not multisampled, StretchRect resolves)
+		for (UINT unSlot = 0; unSlot < m_cTransferRing.GetSlotCount(); unSlot++)
 		{
-			HRESULT nHr = pcDevice->CreateTexture(sDescSurfaceD3D9.Width, sDescSurfaceD3D9.Height, 1, 0, sDescSurfaceD3D9.Format, D3DPOOL_SYSTEMMEM, &m_pcTex9Copy[0], NULL);
-			if (!m_pcTex9Copy[0])
+			for (UINT unEye = 0; unEye < unEyes; unEye++)
 			{
-				OutputDebugStringW(L"[CIN] Failed to create D3D9 copy texture : ");
-				TRACE_HEX(nHr);
-				return;
+				HRESULT nHr = pcDevice->CreateRenderTarget(sDescSurfaceD3D9.Width, sDescSurfaceD3D9.Height, sDescSurfaceD3D9.Format, D3DMULTISAMPLE_NONE, 0, FALSE, &m_apcSurface9Ring[unSlot][unEye], NULL);
+				if (!m_apcSurface9Ring[unSlot][unEye])
+				{
+					VIREIO_LOG_ERROR("[CIN] Failed to create D3D9 ring render target : %x", nHr);
+					ReleaseTransferD3D9();
+					return false;
+				}
 			}
 		}
 
-		// release old texture
-		if (m_pcTexCopy11SRV[0]) m_pcTexCopy11SRV[0]->Release();
-		if (m_pcTexCopy11[0]) m_pcTexCopy11[0]->Release();
-
-		// copy d3d9 texture
-		IDirect3DSurface9* pcSurfaceDst = nullptr;
-		m_pcTex9Copy[0]->GetSurfaceLevel(0, &pcSurfaceDst);
-		pcDevice->GetRenderTargetData(pcBackBuffer, pcSurfaceDst);
-		//		pcDevice->StretchRect(pcBackBuffer, NULL, pcSurfaceDst, NULL, D3DTEXF_NONE); // USE THIS HERE ???
-		if (pcBackBuffer) pcBackBuffer->Release();
-
-		// lock and create d3d11 tex
-		D3DLOCKED_RECT sRect = {};
-		if (SUCCEEDED(pcSurfaceDst->LockRect(&sRect, NULL, NULL)))
+		// lockable readback surfaces
+		for (UINT unEye = 0; unEye < unEyes; unEye++)
 		{
-			D3D11_TEXTURE2D_DESC sDesc = {};
-			sDesc.Width = sDescSurfaceD3D9.Width;
-			sDesc.Height = sDescSurfaceD3D9.Height;
-			sDesc.MipLevels = 1;
-			sDesc.ArraySize = 1;
-			sDesc.Format = GetDXGI_Format(sDescSurfaceD3D9.Format);
-			sDesc.SampleDesc.Count = 1;
-			sDesc.SampleDesc.Quality = 0;
-			sDesc.Usage = D3D11_USAGE_DEFAULT;
-			sDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-			sDesc.CPUAccessFlags = 0;
-			sDesc.MiscFlags = 0;
-			D3D11_SUBRESOURCE_DATA sData = {};
-			sData.pSysMem = sRect.pBits;
-			sData.SysMemPitch = sRect.Pitch;
-			if (FAILED(m_pcD3D11Device->CreateTexture2D(&sDesc, &sData, (ID3D11Texture2D**)&m_pcTexCopy11[0])))
+			HRESULT nHr = pcDevice->CreateOffscreenPlainSurface(sDescSurfaceD3D9.Width, sDescSurfaceD3D9.Height, sDescSurfaceD3D9.Format, D3DPOOL_SYSTEMMEM, &m_apcSurface9Readback[unEye], NULL);
+			if (!m_apcSurface9Readback[unEye])
 			{
-				OutputDebugString(L"[CIN] Failed to create copy texture !");
-				return;
+				VIREIO_LOG_ERROR("[CIN] Failed to create D3D9 readback surface : %x", nHr);
+				ReleaseTransferD3D9();
+				return false;
 			}
+		}
 
-			pcSurfaceDst->UnlockRect();
+		// d3d11 textures, updated in place
+		D3D11_TEXTURE2D_DESC sDesc = {};
+		sDesc.Width = sDescSurfaceD3D9.Width;
+		sDesc.Height = sDescSurfaceD3D9.Height;
+		sDesc.MipLevels = 1;
+		sDesc.ArraySize = 1;
+		sDesc.Format = GetDXGI_Format(sDescSurfaceD3D9.Format);
+		sDesc.SampleDesc.Count = 1;
+		sDesc.SampleDesc.Quality = 0;
+		sDesc.Usage = D3D11_USAGE_DEFAULT;
+		sDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+		sDesc.CPUAccessFlags = 0;
+		sDesc.MiscFlags = 0;
+		for (UINT unEye = 0; unEye < unEyes; unEye++)
+		{
+			if (FAILED(m_pcD3D11Device->CreateTexture2D(&sDesc, NULL, &m_pcTexCopy11[unEye])))
+			{
+				VIREIO_LOG_ERROR("[CIN] Failed to create copy texture !");
+				ReleaseTransferD3D9();
+				return false;
+			}
 
 			// create shader resource view
-			if (m_pcTexCopy11[0])
+			if (FAILED(m_pcD3D11Device->CreateShaderResourceView(m_pcTexCopy11[unEye], NULL, &m_pcTexCopy11SRV[unEye])))
 			{
-				if (FAILED(m_pcD3D11Device->CreateShaderResourceView(m_pcTexCopy11[0], NULL, &m_pcTexCopy11SRV[0])))
-					OutputDebugString(L"[CIN] Failed to create shader resource view.");
+				VIREIO_LOG_ERROR("[CIN] Failed to create shader resource view.");
+				ReleaseTransferD3D9();
+				return false;
 			}
+		}
 
-			// set stereo to mono
+		// set stereo to mono
+		if (unEyes == 1)
+		{
 			m_pcTexCopy11[1] = m_pcTexCopy11[0];
 			m_pcTexCopy11SRV[1] = m_pcTexCopy11SRV[0];
-
 		}
 
-		if (pcSurfaceDst) pcSurfaceDst->Release();
+		m_sDescTransfer = sDescSurfaceD3D9;
+		m_unTransferEyes = unEyes;
+		m_cTransferRing.Reset();
+	}
 
+	// copy this frame on the GPU, nothing waits for it
+	UINT unSlotIssue = m_cTransferRing.Issue();
+	for (UINT unEye = 0; unEye < unEyes; unEye++)
+		pcDevice->StretchRect(apcSurfaceSrc[unEye], NULL, m_apcSurface9Ring[unSlotIssue][unEye], NULL, D3DTEXF_NONE);
 
-		if ((m_pcD3D11Device) || (m_pcD3D11Context))
-		{
-			RenderD3D11(m_pcD3D11Device, m_pcD3D11Context, nullptr);
-		}
-		return;
-	}
-	else
+	// read back the copy of latency frames before, without latency lock synchronous (old behavior)
+	DWORD dwLockFlags = D3DLOCK_READONLY;
+	if (m_cTransferRing.GetLatency()) dwLockFlags |= D3DLOCK_DONOTWAIT;
+	m_cTransferRing.Consume([&](unsigned unSlot) -> bool
 	{
-		// connected textures already initialized ?? return if not
-		if ((!(m_psStereoDataIn->pcTex9Input[0])) || (!(m_psStereoDataIn->pcTex9Input[1])))
-		{
-			static int nDummyCounter = 5;
-			if ((nDummyCounter--) <= 0)
-				OutputDebugString(L"[CIN] No Input Textures !");
-			return;
-		}
-
-		for (UINT unEye = 0; unEye < 2; unEye++)
+		for (UINT unEye = 0; unEye < unEyes; unEye++)
 		{
-			// get the description and create the copy texture
-			D3DSURFACE_DESC sDescSurfaceD3D9 = {};
-			m_psStereoDataIn->pcTex9Input[unEye]->GetLevelDesc(0, &sDescSurfaceD3D9);
-
-			// copy texture created ?
-			if (!m_pcTex9Copy[unEye])
+			HRESULT nHr = pcDevice->GetRenderTargetData(m_apcSurface9Ring[unSlot][unEye], m_apcSurface9Readback[unEye]);
+			if (FAILED(nHr))
 			{
-				HRESULT nHr = pcDevice->CreateTexture(sDescSurfaceD3D9.Width, sDescSurfaceD3D9.Height, 1, 0, sDescSurfaceD3D9.Format, D3DPOOL_SYSTEMMEM, &m_pcTex9Copy[unEye], NULL);
-				if (!m_pcTex9Copy[unEye])
-				{
-					OutputDebugStringW(L"[STS] Failed to create D3D9 copy texture : ");
-					TRACE_HEX(nHr);
-					return;
-				}
+				VIREIO_LOG_ERROR("[CIN] Failed to read back ring render target : %x", nHr);
+				return false;
 			}
+		}
 
-			// release old texture
-			if (m_pcTexCopy11SRV[unEye]) m_pcTexCopy11SRV[unEye]->Release();
-			if (m_pcTexCopy11[unEye]) m_pcTexCopy11[unEye]->Release();
-
-			// copy d3d9 texture
-			IDirect3DSurface9* pcSurfaceSrc = nullptr;
-			IDirect3DSurface9* pcSurfaceDst = nullptr;
-			m_psStereoDataIn->pcTex9Input[unEye]->GetSurfaceLevel(0, &pcSurfaceSrc);
-			m_pcTex9Copy[unEye]->GetSurfaceLevel(0, &pcSurfaceDst);
-			pcDevice->GetRenderTargetData(pcSurfaceSrc, pcSurfaceDst);
-			if (pcSurfaceSrc) pcSurfaceSrc->Release();
-
-			// lock and create d3d11 tex
-			D3DLOCKED_RECT sRect = {};
-			if (SUCCEEDED(pcSurfaceDst->LockRect(&sRect, NULL, NULL)))
+		// lock all eyes first, D3DERR_WASSTILLDRAWING if the copy is not done yet
+		D3DLOCKED_RECT asRect[2] = {};
+		for (UINT unEye = 0; unEye < unEyes; unEye++)
+		{
+			HRESULT nHr = m_apcSurface9Readback[unEye]->LockRect(&asRect[unEye], NULL, dwLockFlags);
+			if (FAILED(nHr))
 			{
-				D3D11_TEXTURE2D_DESC sDesc = {};
-				sDesc.Width = sDescSurfaceD3D9.Width;
-				sDesc.Height = sDescSurfaceD3D9.Height;
-				sDesc.MipLevels = 1;
-				sDesc.ArraySize = 1;
-				sDesc.Format = GetDXGI_Format(sDescSurfaceD3D9.Format);
-				sDesc.SampleDesc.Count = 1;
-				sDesc.SampleDesc.Quality = 0;
-				sDesc.Usage = D3D11_USAGE_DEFAULT;
-				sDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-				sDesc.CPUAccessFlags = 0;
-				sDesc.MiscFlags = 0;
-				D3D11_SUBRESOURCE_DATA sData = {};
-				sData.pSysMem = sRect.pBits;
-				sData.SysMemPitch = sRect.Pitch;
-				if (FAILED(m_pcD3D11Device->CreateTexture2D(&sDesc, &sData, (ID3D11Texture2D**)&m_pcTexCopy11[unEye])))
-				{
-					OutputDebugString(L"[CIN] Failed to create copy texture !");
-					return;
-				}
-
-				pcSurfaceDst->UnlockRect();
-
-				// create shader resource view
-				if (m_pcTexCopy11[unEye])
-				{
-					if (FAILED(m_pcD3D11Device->CreateShaderResourceView(m_pcTexCopy11[unEye], NULL, &m_pcTexCopy11SRV[unEye])))
-						OutputDebugString(L"[CIN] Failed to create shader resource view.");
-				}
+				if (nHr != D3DERR_WASSTILLDRAWING)
+					VIREIO_LOG_ERROR("[CIN] Failed to lock readback surface : %x", nHr);
+				for (UINT unLocked = 0; unLocked < unEye; unLocked++)
+					m_apcSurface9Readback[unLocked]->UnlockRect();
+				return false;
 			}
-
-			if (pcSurfaceDst) pcSurfaceDst->Release();
 		}
 
-		if ((m_pcD3D11Device) || (m_pcD3D11Context))
+		// update d3d11 textures
+		for (UINT unEye = 0; unEye < unEyes; unEye++)
 		{
-			// TODO !! PROVIDE A D3D9 DEVICE HERE
-			RenderD3D11(m_pcD3D11Device, m_pcD3D11Context, nullptr);
+			m_pcD3D11Context->UpdateSubresource(m_pcTexCopy11[unEye], 0, NULL, asRect[unEye].pBits, (UINT)asRect[unEye].Pitch, 0);
+			m_apcSurface9Readback[unEye]->UnlockRect();
 		}
+		return true;
+	});
+	m_cTransferRing.EndFrame();
+
+	return true;
+}
+
+/**
+* Releases the D3D9->D3D11 transfer resources.
+***/
+void VireioCinema::ReleaseTransferD3D9()
+{
+	for (UINT unSlot = 0; unSlot < VireioFrameTransferRing::MAX_SLOTS; unSlot++)
+	{
+		SAFE_RELEASE(m_apcSurface9Ring[unSlot][0]);
+		SAFE_RELEASE(m_apcSurface9Ring[unSlot][1]);
 	}
+	SAFE_RELEASE(m_apcSurface9Readback[0]);
+	SAFE_RELEASE(m_apcSurface9Readback[1]);
+
+	// right eye may share the mono texture
+	if (m_pcTexCopy11SRV[1] == m_pcTexCopy11SRV[0]) m_pcTexCopy11SRV[1] = nullptr;
+	if (m_pcTexCopy11[1] == m_pcTexCopy11[0]) m_pcTexCopy11[1] = nullptr;
+	for (UINT unEye = 0; unEye < 2; unEye++)
+	{
+		SAFE_RELEASE(m_pcTexCopy11SRV[unEye]);
+		SAFE_RELEASE(m_pcTexCopy11[unEye]);
+	}
+	m_apcTex11InputSRV[0] = nullptr;
+	m_apcTex11InputSRV[1] = nullptr;
+
+	ZeroMemory(&m_sDescTransfer, sizeof(D3DSURFACE_DESC));
+	m_unTransferEyes = 0;
 }
 
 /**
@@ -1145,7 +1189,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 	if (!m_pcVSGeometry11)
 	{
 		if (FAILED(CreateVertexShaderTechnique(pcDevice, &m_pcVSGeometry11, &m_pcVLGeometry11, VertexShaderTechnique::PosNormUV)))
-			OutputDebugString(L"[CIN] Failed to create vertex shader. !");
+			VIREIO_LOG_ERROR("[CIN] Failed to create vertex shader. !");
 	}
 
 	// create screen pixel shader
@@ -1154,7 +1198,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 		// create screen pixel shader technique by cinema room setup
 		PixelShaderTechnique eTechnique = m_sCinemaRoomSetup.GetTechnique(m_sCinemaRoomSetup.ePixelShaderFX_Screen);
 		if (FAILED(CreatePixelShaderEffect(pcDevice, &m_pcPSGeometry11, eTechnique)))
-			OutputDebugString(L"[CIN] Failed to create pixel shader. !");
+			VIREIO_LOG_ERROR("[CIN] Failed to create pixel shader. !");
 	}
 
 	// create menu screen pixel shader
@@ -1169,7 +1213,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 		break;
 		}*/
 		if (FAILED(CreatePixelShaderEffect(pcDevice, &m_pcPSMenuScreen11, eTechnique)))
-			OutputDebugString(L"[CIN] Failed to create pixel shader. !");
+			VIREIO_LOG_ERROR("[CIN] Failed to create pixel shader. !");
 	}
 
 	// create render targets
@@ -1179,7 +1223,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 		{
 			if (!(m_psTrackerData->sTx.fW) || !(m_psTrackerData->sTx.fH))
 			{
-				OutputDebugString(L"[CIN] Waiting for tracker to initialize render target size...");
+				VIREIO_LOG_INFO("[CIN] Waiting for tracker to initialize render target size...");
 				continue;
 			}
 
@@ -1203,11 +1247,11 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 			{
 				// create render target view
 				if (FAILED(pcDevice->CreateRenderTargetView(m_sStereoData.pcTex11Draw[unEye], NULL, &m_sStereoData.pcTex11DrawRTV[unEye])))
-					OutputDebugString(L"[CIN] Failed to create render target view.");
+					VIREIO_LOG_ERROR("[CIN] Failed to create render target view.");
 
 				// create shader resource view
 				if (FAILED(pcDevice->CreateShaderResourceView(m_sStereoData.pcTex11Draw[unEye], NULL, &m_sStereoData.pcTex11DrawSRV[unEye])))
-					OutputDebugString(L"[CIN] Failed to create render target shader resource view.");
+					VIREIO_LOG_ERROR("[CIN] Failed to create render target shader resource view.");
 
 				// TODO !! DELETE THIS (BOTH HERE AND IN PRESENTER) set this as private data interface to the shader resource views instead of texture here !!!!
 				if ((m_sStereoData.pcTex11DrawRTV[unEye]) && (m_sStereoData.pcTex11DrawSRV[unEye]))
@@ -1216,7 +1260,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 					m_sStereoData.pcTex11DrawRTV[unEye]->Release();
 				}
 			}
-			else OutputDebugString(L"[CIN] Failed to create render target !");
+			else VIREIO_LOG_ERROR("[CIN] Failed to create render target !");
 		}
 	}
 
@@ -1240,9 +1284,9 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 			descDepth.CPUAccessFlags = 0;
 			descDepth.MiscFlags = 0;
 			if (FAILED(pcDevice->CreateTexture2D(&descDepth, NULL, &m_pcDSGeometry11[0])))
-				OutputDebugString(L"[CIN] Failed to create depth stencil.");
+				VIREIO_LOG_ERROR("[CIN] Failed to create depth stencil.");
 			if (FAILED(pcDevice->CreateTexture2D(&descDepth, NULL, &m_pcDSGeometry11[1])))
-				OutputDebugString(L"[CIN] Failed to create depth stencil.");
+				VIREIO_LOG_ERROR("[CIN] Failed to create depth stencil.");
 
 			// Create the depth stencil views
 			D3D11_DEPTH_STENCIL_VIEW_DESC descDSV;
@@ -1251,9 +1295,9 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 			descDSV.ViewDimension = D3D11_DSV_DIMENSION_TEXTURE2D;
 			descDSV.Texture2D.MipSlice = 0;
 			if (FAILED(pcDevice->CreateDepthStencilView(m_pcDSGeometry11[0], &descDSV, &m_pcDSVGeometry11[0])))
-				OutputDebugString(L"[CIN] Failed to create depth stencil view.");
+				VIREIO_LOG_ERROR("[CIN] Failed to create depth stencil view.");
 			if (FAILED(pcDevice->CreateDepthStencilView(m_pcDSGeometry11[1], &descDSV, &m_pcDSVGeometry11[1])))
-				OutputDebugString(L"[CIN] Failed to create depth stencil view.");
+				VIREIO_LOG_ERROR("[CIN] Failed to create depth stencil view.");
 
 			float fAspect = (float)descDepth.Width / (float)descDepth.Height;
 
@@ -1285,7 +1329,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 		sampDesc.MinLOD = 0;
 		sampDesc.MaxLOD = D3D11_FLOAT32_MAX;
 		if (FAILED(pcDevice->CreateSamplerState(&sampDesc, &m_pcSampler11)))
-			OutputDebugString(L"[CIN] Failed to create sampler.");
+			VIREIO_LOG_ERROR("[CIN] Failed to create sampler.");
 	}
 
 	if (!m_pcSamplerState)
@@ -1301,7 +1345,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 		sampDesc.MinLOD = 0;
 		sampDesc.MaxLOD = D3D11_FLOAT32_MAX;
 		if (FAILED(pcDevice->CreateSamplerState(&sampDesc, &m_pcSamplerState)))
-			OutputDebugString(L"[CIN] Failed to create sampler.");
+			VIREIO_LOG_ERROR("[CIN] Failed to create sampler.");
 	}
 
 	// create blend state
@@ -1327,7 +1371,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 	if (!m_pcConstantBufferGeometry)
 	{
 		if (FAILED(CreateGeometryConstantBuffer(pcDevice, &m_pcConstantBufferGeometry, (UINT)sizeof(GeometryConstantBuffer))))
-			OutputDebugString(L"[CIN] Failed to create constant buffer.");
+			VIREIO_LOG_ERROR("[CIN] Failed to create constant buffer.");
 	}
 
 	// create menu texture
@@ -1350,7 +1394,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 		HRESULT nHr = pcDevice->CreateTexture2D(&sDesc, NULL, &m_sStereoData.pcTexMenu);
 		if (FAILED(nHr))
 		{
-			OutputDebugString(L"[CIN] Failed to create menu texture !");
+			VIREIO_LOG_ERROR("[CIN] Failed to create menu texture !");
 			return;
 		}
 
@@ -1364,7 +1408,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 		nHr = pcDevice->CreateRenderTargetView(m_sStereoData.pcTexMenu, &sDescRTV, &m_sStereoData.pcTexMenuRTV);
 		if (FAILED(nHr))
 		{
-			OutputDebugString(L"[CIN] Failed to create menu texture RTV !");
+			VIREIO_LOG_ERROR("[CIN] Failed to create menu texture RTV !");
 			return;
 		}
 
@@ -1379,7 +1423,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 		nHr = pcDevice->CreateShaderResourceView(m_sStereoData.pcTexMenu, &sDescSRV, &m_sStereoData.pcTexMenuSRV);
 		if (FAILED(nHr))
 		{
-			OutputDebugString(L"[CIN] Failed to create menu texture SRV !");
+			VIREIO_LOG_ERROR("[CIN] Failed to create menu texture SRV !");
 			return;
 		}
 	}
@@ -1648,7 +1692,7 @@ void VireioCinema::InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCont
 	m_sGeometryConstants.sResolution.x = 1024.0f;
 	m_sGeometryConstants.sResolution.y = 1024.0f;
 
-	OutputDebugString(L"~InitD3D11");
+	VIREIO_LOG_DEBUG("~InitD3D11");
 }
 
 /**
@@ -1703,7 +1747,7 @@ void VireioCinema::RenderD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCo
 						sDescSR11.Texture2D.MostDetailedMip = 0;
 						if (FAILED(((ID3D11Device*)pcDevice)->CreateShaderResourceView(m_pcBackBufferCopy, &sDescSR11, &m_pcBackBufferCopySR)))
 						{
-							OutputDebugString(L"[CIN] Failed to create sr view !");
+							VIREIO_LOG_ERROR("[CIN] Failed to create sr view !");
 							m_pcBackBufferCopy->Release(); m_pcBackBufferCopy = nullptr;
 							pcBackBuffer->Release();
 							return;
@@ -1719,7 +1763,7 @@ void VireioCinema::RenderD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCo
 			}
 			else
 			{
-				OutputDebugString(L"[CIN] No back buffer !!");
+				VIREIO_LOG_WARNING("[CIN] No back buffer !!");
 				return;
 			}
 		}
@@ -1737,10 +1781,10 @@ void VireioCinema::RenderD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCo
 
 	// backup all states
 	D3DX11_STATE_BLOCK sStateBlock;
-	CreateStateblock(pcContext, &sStateBlock);
+	CreateStateblock(pcContext, &sStateBlock, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 	// clear all states, set targets
-	ClearContextState(pcContext);
+	ClearContextState(pcContext, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 	// set or create a default rasterizer state here
 	if (!m_pcRS)
@@ -2006,10 +2050,10 @@ void VireioCinema::RenderD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCo
 
 	// backup all states
 	ZeroMemory(&sStateBlock, sizeof(D3DX11_STATE_BLOCK));
-	CreateStateblock(pcContext, &sStateBlock);
+	CreateStateblock(pcContext, &sStateBlock, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 	// clear all states, set targets
-	ClearContextState(pcContext);
+	ClearContextState(pcContext, D3DX11_STATE_BLOCK_MASK_OVERLAY);
 
 	// set viewport
 	pcContext->RSSetViewports(1, &sViewport);
@@ -2030,10 +2074,10 @@ void VireioCinema::RenderD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCo
 			ID3D10Blob* pcShader = nullptr;
 			if (SUCCEEDED(D3DX10CompileFromMemory(V_Shader, strlen(V_Shader), NULL, NULL, NULL, "VS", "vs_4_0", NULL, NULL, NULL, &pcShader, NULL, NULL)))
 			{
-				OutputDebugString(L"[TEST!!!!] : Vertex Shader compiled !");
+				VIREIO_LOG_DEBUG("[TEST!!!!] : Vertex Shader compiled !");
 				if (SUCCEEDED(pcDevice->CreateVertexShader(pcShader->GetBufferPointer(), pcShader->GetBufferSize(), NULL, &s_pcVS)))
 				{
-					OutputDebugString(L"[TEST!!!!] : Vertex Shader created !");
+					VIREIO_LOG_DEBUG("[TEST!!!!] : Vertex Shader created !");
 					// Define the input layout
 					D3D11_INPUT_ELEMENT_DESC layout[] =
 					{
@@ -2044,7 +2088,7 @@ void VireioCinema::RenderD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCo
 					// Create the input layout
 					if (SUCCEEDED(pcDevice->CreateInputLayout(layout, numElements, pcShader->GetBufferPointer(), pcShader->GetBufferSize(), &s_pcVL)))
 					{
-						OutputDebugString(L"[TEST!!!!] : Input Layout created !");
+						VIREIO_LOG_DEBUG("[TEST!!!!] : Input Layout created !");
 					}
 				}
 				pcShader->Release();
@@ -2062,9 +2106,9 @@ void VireioCinema::RenderD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCo
 			ID3D10Blob* pcShader = nullptr;
 			if (SUCCEEDED(D3DX10CompileFromMemory(P_Shader, strlen(P_Shader), NULL, NULL, NULL, "PS", "ps_4_0", NULL, NULL, NULL, &pcShader, NULL, NULL)))
 			{
-				OutputDebugString(L"[TEST!!!!] : Pixel Shader compiled !");
+				VIREIO_LOG_DEBUG("[TEST!!!!] : Pixel Shader compiled !");
 				if (SUCCEEDED(pcDevice->CreatePixelShader(pcShader->GetBufferPointer(), pcShader->GetBufferSize(), NULL, &s_pcPS)))
-					OutputDebugString(L"[TEST!!!!] : Pixel Shader created !");
+					VIREIO_LOG_DEBUG("[TEST!!!!] : Pixel Shader created !");
 				pcShader->Release();
 			}
 		}
@@ -2100,7 +2144,7 @@ void VireioCinema::RenderD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcCo
 			InitData.pSysMem = vertices;
 
 			if (FAILED(pcDevice->CreateBuffer(&bd, &InitData, &s_pVertexBuffer)))
-				OutputDebugString(L"Failed to create vertex buffer !!!!!!");
+				VIREIO_LOG_ERROR("Failed to create vertex buffer !!!!!!");
 
 		}
 
@@ -2255,7 +2299,7 @@ void VireioCinema::AddRenderModelD3D11(ID3D11Device* pcDevice, ID3D11Texture2D*
 	ZeroMemory(&sInitData, sizeof(sInitData));
 	sInitData.pSysMem = asVertices;
 	if (FAILED(pcDevice->CreateBuffer(&sVertexBufferDesc, &sInitData, &sRenderModel.pcVertexBuffer)))
-		OutputDebugString(L"[CIN] Failed to create vertex buffer.");
+		VIREIO_LOG_ERROR("[CIN] Failed to create vertex buffer.");
 
 	// create index buffer
 	D3D11_BUFFER_DESC sIndexBufferDesc;
@@ -2267,7 +2311,7 @@ void VireioCinema::AddRenderModelD3D11(ID3D11Device* pcDevice, ID3D11Texture2D*
 	ZeroMemory(&sInitData, sizeof(sInitData));
 	sInitData.pSysMem = aunIndices;
 	if (FAILED(pcDevice->CreateBuffer(&sIndexBufferDesc, &sInitData, &sRenderModel.pcIndexBuffer)))
-		OutputDebugString(L"[CIN] Failed to create index buffer.");
+		VIREIO_LOG_ERROR("[CIN] Failed to create index buffer.");
 
 	// set vertices/triangle count
 	sRenderModel.unTriangleCount = unTriangleCount;
@@ -2291,7 +2335,7 @@ void VireioCinema::AddRenderModelD3D11(ID3D11Device* pcDevice, ID3D11Texture2D*
 		sDesc.Texture2D.MipLevels = 1;
 
 		if ((FAILED(pcDevice->CreateShaderResourceView((ID3D11Resource*)sRenderModel.pcTexture, &sDesc, &sRenderModel.pcTextureSRV))))
-			OutputDebugString(L"[CIN] Failed to create model texture shader resource view!");
+			VIREIO_LOG_ERROR("[CIN] Failed to create model texture shader resource view!");
 	}
 
 	// set resolution
@@ -2372,7 +2416,7 @@ HRESULT VireioCinema::CreateD3D11Device(bool bCreateSwapChain)
 				m_pcD3D11Device->SetPrivateDataInterface(PDIID_ID3D11Device_IDXGISwapChain, pcSwapChain);
 				pcSwapChain->Release();
 			}
-			else OutputDebugString(L"[CIN] Failed to create d3d11 device or/and swapchain.");
+			else VIREIO_LOG_ERROR("[CIN] Failed to create d3d11 device or/and swapchain.");
 		}
 		else
 		{
@@ -2437,6 +2481,7 @@ void VireioCinema::SaveIniSettings()
 	GetIniFileSetting((DWORD)m_sCinemaRoomSetup.bImmersiveMode, "Stereo Cinema", "sCinemaRoomSetup.bImmersiveMode", szFilePathINI, bFileExists);
 	GetIniFileSetting(m_sCinemaRoomSetup.fGamma, "Stereo Cinema", "sCinemaRoomSetup.fGamma", szFilePathINI, bFileExists);
 	GetIniFileSetting((DWORD)m_unMouseTickCount, "Stereo Cinema", "unMouseTickCount", szFilePathINI, bFileExists);
+	GetIniFileSetting((DWORD)m_cTransferRing.GetLatency(), "Stereo Cinema", "unTransferLatency", szFilePathINI, bFileExists);
 	GetIniFileSetting(m_sImmersiveFullscreenSettings.fIPD, "Stereo Presenter", "fIPD", szFilePathINI, bFileExists);
 	GetIniFileSetting(m_sImmersiveFullscreenSettings.fVSD, "Stereo Presenter", "fVSD", szFilePathINI, bFileExists);
 }
@@ -67,6 +67,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 #include"..\..\..\Include\Vireio_GUIDs.h"
 #include"..\..\..\Include\Vireio_DX11Basics.h"
+#include"..\..\..\Include\Vireio_FrameTransferRing.h"
 #include"..\..\..\Include\Vireio_Node_Plugtypes.h"
 
 #define NUMBER_OF_COMMANDERS                           1
@@ -119,6 +120,8 @@ private:
 	/*** VireioCinema private methods ***/
 	void InitD3D9(LPDIRECT3DDEVICE9 pcDevice);
 	void RenderD3D9(LPDIRECT3DDEVICE9 pcDevice);
+	bool TransferD3D9(LPDIRECT3DDEVICE9 pcDevice, IDirect3DSurface9** apcSurfaceSrc, UINT unEyes);
+	void ReleaseTransferD3D9();
 	void InitD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext);
 	void RenderD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, IDXGISwapChain* pcSwapchain);
 	void RenderFullscreenD3D11(ID3D11Device* pcDevice, ID3D11DeviceContext* pcContext, IDXGISwapChain* pcSwapchain);
@@ -149,8 +152,16 @@ private:
 	ID3D11DeviceContext* m_pcD3D11Context;
 	/// <summary>Dummy window for the d3d11 device.</summary>
 	HWND m_hDummy;
-	/// <summary>The lockable copy textures left/right (D3D9).	</summary>
-	IDirect3DTexture9* m_pcTex9Copy[2];
+	/// <summary>The copy render targets (D3D9), one per transfer ring slot left/right.</summary>
+	IDirect3DSurface9* m_apcSurface9Ring[VireioFrameTransferRing::MAX_SLOTS][2];
+	/// <summary>The lockable system memory readback surfaces (D3D9) left/right.</summary>
+	IDirect3DSurface9* m_apcSurface9Readback[2];
+	/// <summary>Paces the D3D9 readbacks, frame N is consumed at frame N + latency.</summary>
+	VireioFrameTransferRing m_cTransferRing;
+	/// <summary>Description of the D3D9 surfaces the transfer resources are created for.</summary>
+	D3DSURFACE_DESC m_sDescTransfer;
+	/// <summary>Number of eyes the transfer resources are created for (1 = mono backbuffer).</summary>
+	UINT m_unTransferEyes;
 	/// <summary>The shared D3D11 textures.</summary>
 	ID3D11Texture2D* m_pcSharedTexture[2];
 	/// <summary>Input texture SR views left/right.</summary>
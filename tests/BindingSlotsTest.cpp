@@ -0,0 +1,156 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <BindingSlotsTest.cpp> :
+BindingSlots and StereoBindingSlots against a std::map reference
+model (the former per stage hash maps), random bind, unbind, copy and
+record sequences. Checks bindings and every reference count.
+********************************************************************/
+#include <d3d9.h>
+#include <map>
+#include <stdlib.h>
+#include "BindingSlots.h"
+#include "TestCheck.h"
+
+/**
+* Stage mapping round trip and the invalid stages.
+***/
+static void TestStageMapping()
+{
+	for (DWORD stage = 0; stage < 16; stage++)
+		TEST_CHECK_EQUAL(SlotToTextureStage(TextureStageToSlot(stage)), stage);
+	for (DWORD stage = D3DDMAPSAMPLER; stage <= D3DVERTEXTEXTURESAMPLER3; stage++)
+	{
+		UINT slot = TextureStageToSlot(stage);
+		TEST_CHECK(slot < BINDING_TEXTURE_SLOTS);
+		TEST_CHECK_EQUAL(SlotToTextureStage(slot), stage);
+	}
+	TEST_CHECK_EQUAL(TextureStageToSlot(16), BINDING_INVALID_SLOT);
+	TEST_CHECK_EQUAL(TextureStageToSlot(D3DVERTEXTEXTURESAMPLER3 + 1), BINDING_INVALID_SLOT);
+}
+
+/**
+* Random operations against the map model, reference counts must match the number of bindings.
+***/
+static void TestAgainstMapModel()
+{
+	const int textureCount = 8;
+	srand(43);
+	for (int run = 0; run < 200; run++)
+	{
+		IDirect3DBaseTexture9 textures[textureCount];
+		{
+			BindingSlots<IDirect3DBaseTexture9, BINDING_TEXTURE_SLOTS> slots, captured;
+			std::map<UINT, IDirect3DBaseTexture9*> model, capturedModel;
+
+			for (int op = 0; op < 2000; op++)
+			{
+				UINT slot = (UINT)(rand() % BINDING_TEXTURE_SLOTS);
+				int kind = rand() % 10;
+				if (kind < 6)
+				{
+					IDirect3DBaseTexture9* pTexture = (rand() % 8) ? &textures[rand() % textureCount] : NULL;
+					bool changed = slots.Bind(slot, pTexture);
+					std::map<UINT, IDirect3DBaseTexture9*>::iterator it = model.find(slot);
+					TEST_CHECK_EQUAL(changed, !((it != model.end()) && (it->second == pTexture)));
+					model[slot] = pTexture;
+				}
+				else if (kind < 8)
+				{
+					slots.Unbind(slot);
+					model.erase(slot);
+				}
+				else if (kind < 9)
+				{
+					// state block capture of a selection
+					uint32_t selection = (uint32_t)rand() & BindingSlots<IDirect3DBaseTexture9, BINDING_TEXTURE_SLOTS>::AllSlots();
+					captured.CopyBound(slots, selection);
+					for (std::map<UINT, IDirect3DBaseTexture9*>::iterator it = model.begin(); it != model.end(); ++it)
+						if (selection & (1u << it->first))
+							capturedModel[it->first] = it->second;
+				}
+				else
+				{
+					// state block apply
+					slots.CopyBound(captured, 0xFFFFFFFF);
+					for (std::map<UINT, IDirect3DBaseTexture9*>::iterator it = capturedModel.begin(); it != capturedModel.end(); ++it)
+						model[it->first] = it->second;
+				}
+			}
+
+			// bindings
+			uint32_t modelMask = 0;
+			for (std::map<UINT, IDirect3DBaseTexture9*>::iterator it = model.begin(); it != model.end(); ++it)
+			{
+				modelMask |= 1u << it->first;
+				TEST_CHECK(slots.IsBound(it->first));
+				TEST_CHECK(slots.Get(it->first) == it->second);
+			}
+			TEST_CHECK_EQUAL(slots.GetBoundMask(), modelMask);
+
+			// ForEachBound visits the bound slots in order
+			UINT visited = 0, last = 0;
+			bool ordered = true;
+			slots.ForEachBound([&](UINT slot, IDirect3DBaseTexture9* pTexture) { if (visited && slot <= last) ordered = false; last = slot; visited++; (void)pTexture; });
+			TEST_CHECK(ordered);
+			TEST_CHECK_EQUAL(visited, (UINT)model.size());
+
+			// one reference per binding
+			for (int i = 0; i < textureCount; i++)
+			{
+				unsigned long references = 1;
+				for (std::map<UINT, IDirect3DBaseTexture9*>::iterator it = model.begin(); it != model.end(); ++it)
+					if (it->second == &textures[i]) references++;
+				for (std::map<UINT, IDirect3DBaseTexture9*>::iterator it = capturedModel.begin(); it != capturedModel.end(); ++it)
+					if (it->second == &textures[i]) references++;
+				TEST_CHECK_EQUAL(textures[i].refCount, references);
+			}
+		}
+
+		// all released on destruction
+		for (int i = 0; i < textureCount; i++)
+			TEST_CHECK_EQUAL(textures[i].refCount, 1ul);
+	}
+}
+
+/**
+* Stereo slots follow the last recorded binding of each slot.
+***/
+static void TestStereoSlots()
+{
+	IDirect3DTexture9 left[4], right[4];
+	StereoBindingSlots<IDirect3DBaseTexture9, BINDING_TEXTURE_SLOTS> stereo;
+	TEST_CHECK_EQUAL(stereo.GetStereoMask(), 0u);
+
+	stereo.Record(0, &left[0], &right[0]);
+	stereo.Record(3, &left[1], &right[1]);
+	stereo.Record(5, &left[2], NULL);
+	TEST_CHECK_EQUAL(stereo.GetStereoMask(), (1u << 0) | (1u << 3));
+	TEST_CHECK(stereo.GetLeft(3) == &left[1]);
+	TEST_CHECK(stereo.GetRight(3) == &right[1]);
+	TEST_CHECK(stereo.GetRight(5) == NULL);
+
+	// mono binding replaces a stereo one
+	stereo.Record(3, &left[3], NULL);
+	TEST_CHECK_EQUAL(stereo.GetStereoMask(), 1u << 0);
+	TEST_CHECK(stereo.GetLeft(3) == NULL);
+
+	// out of range slots are ignored
+	stereo.Record(BINDING_TEXTURE_SLOTS, &left[0], &right[0]);
+	TEST_CHECK_EQUAL(stereo.GetStereoMask(), 1u << 0);
+
+	stereo.Clear();
+	TEST_CHECK_EQUAL(stereo.GetStereoMask(), 0u);
+	TEST_CHECK(stereo.GetRight(0) == NULL);
+
+	// not reference counted
+	TEST_CHECK_EQUAL(right[0].refCount, 1ul);
+}
+
+int main()
+{
+	TestStageMapping();
+	TestAgainstMapModel();
+	TestStereoSlots();
+	return TestResult("BindingSlotsTest");
+}
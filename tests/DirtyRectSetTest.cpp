@@ -0,0 +1,232 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <DirtyRectSetTest.cpp> :
+DirtyRectSet against a pixel mask of the locked rectangles : random,
+tile and row lock patterns must be covered exactly (no pixel missing,
+no pixel copied that was not locked). Also checks the copies sent to
+the mock device and the merge of several unlocks into one upload, as
+D3D9ProxyTexture does for the locked levels of a frame.
+********************************************************************/
+#include <d3d9.h>
+#include <vector>
+#include <stdlib.h>
+#include "DirtyRectSet.h"
+#include "TestCheck.h"
+
+static const int W = 64;
+static const int H = 64;
+
+/**
+* Random rectangle of one of the lock patterns : 16x16 tiles, rows or anything.
+***/
+static RECT RandomRect()
+{
+	RECT rect;
+	int pattern = rand() % 3;
+	if (pattern == 0)
+	{
+		rect.left = (rand() % 4) * 16;
+		rect.top = (rand() % 4) * 16;
+		rect.right = rect.left + 16;
+		rect.bottom = rect.top + 16;
+	}
+	else if (pattern == 1)
+	{
+		rect.left = 0;
+		rect.right = W;
+		rect.top = rand() % H;
+		rect.bottom = rect.top + 1 + rand() % 4;
+	}
+	else
+	{
+		rect.left = rand() % W;
+		rect.top = rand() % H;
+		rect.right = rect.left + rand() % 20;
+		rect.bottom = rect.top + rand() % 20;
+	}
+	if (rect.right > W) rect.right = W;
+	if (rect.bottom > H) rect.bottom = H;
+	return rect;
+}
+
+/**
+* Marks a rectangle in a pixel mask.
+***/
+static void Fill(std::vector<char>& mask, const RECT& rect)
+{
+	for (int y = rect.top; y < rect.bottom; y++)
+		for (int x = rect.left; x < rect.right; x++)
+			mask[y * W + x] = 1;
+}
+
+/**
+* Counts pixels only in a and pixels only in b.
+***/
+static void Compare(const std::vector<char>& a, const std::vector<char>& b, long& onlyA, long& onlyB)
+{
+	for (size_t i = 0; i < a.size(); i++)
+	{
+		if (a[i] && !b[i]) onlyA++;
+		if (b[i] && !a[i]) onlyB++;
+	}
+}
+
+/**
+* Coalesced rectangles cover exactly the locked pixels.
+***/
+static void TestExactCoverage()
+{
+	srand(50);
+	long missing = 0, extra = 0;
+	for (int run = 0; run < 20000; run++)
+	{
+		DirtyRectSet set;
+		std::vector<char> locked(W * H, 0);
+		int count = 1 + rand() % 12;
+		for (int i = 0; i < count; i++)
+		{
+			RECT rect = RandomRect();
+			set.Add(&rect);
+			Fill(locked, rect);
+		}
+
+		std::vector<char> covered(W * H, 0);
+		const std::vector<RECT>& rects = set.GetRects();
+		for (size_t i = 0; i < rects.size(); i++)
+			Fill(covered, rects[i]);
+		Compare(locked, covered, missing, extra);
+		TEST_CHECK(!set.IsFull());
+	}
+	TEST_CHECK_EQUAL(missing, 0);
+	TEST_CHECK_EQUAL(extra, 0);
+}
+
+/**
+* Rows, tiles and repeated locks coalesce, diagonal neighbours do not.
+***/
+static void TestCoalescing()
+{
+	DirtyRectSet rows;
+	for (LONG i = 0; i < 64; i++)
+	{
+		RECT rect = { 0, i, 1024, i + 1 };
+		rows.Add(&rect);
+	}
+	TEST_CHECK_EQUAL(rows.GetRects().size(), 1u);
+
+	DirtyRectSet tiles;
+	for (LONG i = 0; i < 64; i++)
+	{
+		RECT rect = { (i % 8) * 16, (i / 8) * 16, (i % 8) * 16 + 16, (i / 8) * 16 + 16 };
+		tiles.Add(&rect);
+	}
+	TEST_CHECK_EQUAL(tiles.GetRects().size(), 1u);
+
+	DirtyRectSet repeated;
+	for (int i = 0; i < 16; i++)
+	{
+		RECT rect = { 100, 100, 164, 164 };
+		repeated.Add(&rect);
+	}
+	TEST_CHECK_EQUAL(repeated.GetRects().size(), 1u);
+
+	DirtyRectSet diagonal;
+	RECT a = { 0, 0, 10, 10 }, b = { 10, 10, 20, 20 };
+	diagonal.Add(&a);
+	diagonal.Add(&b);
+	TEST_CHECK_EQUAL(diagonal.GetRects().size(), 2u);
+
+	DirtyRectSet empty;
+	RECT none = { 5, 5, 5, 10 };
+	empty.Add(&none);
+	TEST_CHECK(empty.IsEmpty());
+}
+
+/**
+* Update() sends one copy per rectangle at the same position, a full set one full copy.
+***/
+static void TestUpdate()
+{
+	IDirect3DDevice9 device;
+	IDirect3DSurface9 source, destination;
+
+	DirtyRectSet set;
+	RECT a = { 0, 0, 16, 16 }, b = { 32, 32, 40, 48 };
+	set.Add(&a);
+	set.Add(&b);
+	TEST_CHECK_EQUAL(set.Update(&device, &source, &destination), D3D_OK);
+	TEST_CHECK_EQUAL(device.updateSurfaceCalls, 2);
+	TEST_CHECK_EQUAL(device.updateSurfacePixels, 16 * 16 + 8 * 16);
+	for (size_t i = 0; i < device.updateSurfaceLog.size(); i++)
+	{
+		const IDirect3DDevice9::UpdateSurfaceCall& call = device.updateSurfaceLog[i];
+		TEST_CHECK(call.pSource == &source);
+		TEST_CHECK(call.pDestination == &destination);
+		TEST_CHECK_EQUAL(call.point.x, call.rect.left);
+		TEST_CHECK_EQUAL(call.point.y, call.rect.top);
+	}
+
+	set.Add((const RECT*)NULL);
+	TEST_CHECK(set.IsFull());
+	TEST_CHECK(set.GetRects().empty());
+	set.Add(&a);
+	TEST_CHECK(set.IsFull());
+	TEST_CHECK_EQUAL(set.Update(&device, &source, &destination), D3D_OK);
+	TEST_CHECK_EQUAL(device.updateSurfaceCalls, 3);
+	TEST_CHECK(device.updateSurfaceLog.back().full);
+
+	set.Clear();
+	TEST_CHECK(set.IsEmpty());
+}
+
+/**
+* Unlocks merged into the pending set of the level (one upload per frame) cover the same pixels
+* as uploading every unlock, with fewer or as many copies.
+***/
+static void TestMergedUnlocks()
+{
+	srand(51);
+	long missing = 0, extra = 0;
+	for (int frame = 0; frame < 2000; frame++)
+	{
+		IDirect3DDevice9 perUnlock, perFrame;
+		IDirect3DSurface9 source, destination;
+		DirtyRectSet pending;
+		std::vector<char> locked(W * H, 0);
+
+		int unlocks = 1 + rand() % 8;
+		for (int i = 0; i < unlocks; i++)
+		{
+			DirtyRectSet lock;
+			int count = 1 + rand() % 4;
+			for (int k = 0; k < count; k++)
+			{
+				RECT rect = RandomRect();
+				lock.Add(&rect);
+				Fill(locked, rect);
+			}
+			lock.Update(&perUnlock, &source, &destination);
+			pending.Add(lock);
+		}
+		pending.Update(&perFrame, &source, &destination);
+		TEST_CHECK(perFrame.updateSurfaceCalls <= perUnlock.updateSurfaceCalls);
+		TEST_CHECK(perFrame.updateSurfacePixels <= perUnlock.updateSurfacePixels);
+
+		std::vector<char> copied(W * H, 0);
+		for (size_t i = 0; i < perFrame.updateSurfaceLog.size(); i++)
+			Fill(copied, perFrame.updateSurfaceLog[i].rect);
+		Compare(locked, copied, missing, extra);
+	}
+	TEST_CHECK_EQUAL(missing, 0);
+	TEST_CHECK_EQUAL(extra, 0);
+}
+
+int main()
+{
+	TestExactCoverage();
+	TestCoalescing();
+	TestUpdate();
+	TestMergedUnlocks();
+	return TestResult("DirtyRectSetTest");
+}
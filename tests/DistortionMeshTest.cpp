@@ -0,0 +1,199 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <DistortionMeshTest.cpp> :
+DistortionMesh against HMDisplayInfo::Distort() for the shipped HMD
+profiles : the uvs the rasterizer interpolates from the mesh must stay
+within half a texel of the per pixel distortion (and chroma correction) on a
+DK1 sized eye texture. Also checks the disk cache round trip and prints
+the generation time per mesh resolution.
+********************************************************************/
+#include <d3d9.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <math.h>
+#include <chrono>
+#include "DistortionMesh.h"
+#include "HMDisplayInfo_Default.h"
+#include "HMDisplayInfo_OculusRift.h"
+#include "TestCheck.h"
+
+/**
+* Eye texture size, Rift DK1.
+***/
+static const float W = 1280.0f;
+static const float H = 800.0f;
+
+/**
+* Lens space y extent as StereoViewRift uses it (ScaleIn[1]).
+***/
+static float YExtent(float aspect) { return 4.0f / aspect; }
+
+/**
+* Uniform random float in [a, b].
+***/
+static float Random(float a, float b) { return a + (b - a) * (float)rand() / (float)RAND_MAX; }
+
+/**
+* Largest texel error of the mesh against the HMD profile at random lens space positions.
+* Only positions on the screen (lens center at half height) that sample inside the eye
+* texture count, the rest is drawn black.
+***/
+static float MaxTexelError(HMDisplayInfo* hmd, float aspect, UINT resolution)
+{
+	DistortionMesh mesh;
+	TEST_CHECK(mesh.Generate(hmd, YExtent(aspect), resolution, resolution));
+
+	// lens space to texel scale, see StereoViewRift::CalculateShaderVariables()
+	float scaleToFill = hmd->GetScaleToFillHorizontal();
+	float scaleFactor = (scaleToFill != 0.0f) ? 1.0f / scaleToFill : 1.0f;
+	float texelsU = 2.0f * (1.0f / 4.0f) * scaleFactor * W;
+	float texelsV = (1.0f / 2.0f) * scaleFactor * (W / H) * H;
+
+	const float* chroma = hmd->GetDistortionCoefficientsChroma();
+	float xMin = -1.0f - hmd->GetLensXCenterOffset();
+	float xMax = 1.0f - hmd->GetLensXCenterOffset();
+
+	float maxError = 0.0f;
+	srand(1);
+	for (int i = 0; i < 20000; i++)
+	{
+		float x = Random(xMin, xMax);
+		float y = Random(-YExtent(aspect) * 0.5f, YExtent(aspect) * 0.5f);
+		float uv6[6];
+		TEST_CHECK(mesh.Sample(x, y, uv6));
+
+		float radius = sqrtf(x * x + y * y);
+		float rSq = radius * radius;
+		float scale = (radius > 0.0f) ? hmd->Distort(radius) / radius : hmd->GetDistortionCoefficients()[0];
+		float expected[6] =
+		{
+			x * scale * ((1.0f + chroma[0]) + chroma[1] * rSq), y * scale * ((1.0f + chroma[0]) + chroma[1] * rSq),
+			x * scale, y * scale,
+			x * scale * ((1.0f + chroma[2]) + chroma[3] * rSq), y * scale * ((1.0f + chroma[2]) + chroma[3] * rSq)
+		};
+		float u = expected[2] * texelsU / W + 0.5f;
+		float v = expected[3] * texelsV / H + 0.5f;
+		if ((u < 0.0f) || (u > 1.0f) || (v < 0.0f) || (v > 1.0f)) continue;
+
+		for (int j = 0; j < 6; j += 2)
+		{
+			float error = fabsf(uv6[j] - expected[j]) * texelsU;
+			if (error > maxError) maxError = error;
+			error = fabsf(uv6[j + 1] - expected[j + 1]) * texelsV;
+			if (error > maxError) maxError = error;
+		}
+	}
+	return maxError;
+}
+
+/**
+* The vertices hold the exact distortion, the interpolation error shrinks with the resolution.
+***/
+static void TestAgainstDistort()
+{
+	HMDisplayInfo_Default hmdDefault;
+	HMDisplayInfo_OculusRift hmdOculus;
+	HMDisplayInfo* profiles[] = { &hmdDefault, &hmdOculus };
+	float aspects[] = { 16.0f / 10.0f, 16.0f / 9.0f };
+
+	for (int p = 0; p < 2; p++)
+	{
+		for (int a = 0; a < 2; a++)
+		{
+			float error32 = MaxTexelError(profiles[p], aspects[a], 32);
+			float error64 = MaxTexelError(profiles[p], aspects[a], 64);
+			float error128 = MaxTexelError(profiles[p], aspects[a], 128);
+			printf("%s %.2f : max texel error 32 %.3f, 64 %.3f, 128 %.3f\n",
+				profiles[p]->GetHMDName().c_str(), aspects[a], error32, error64, error128);
+
+			// StereoViewRift draws 128 x 128
+			TEST_CHECK(error128 < 0.5f);
+			TEST_CHECK(error128 <= error64);
+			TEST_CHECK(error64 <= error32);
+		}
+	}
+
+	// the vertices themselves match Distort() exactly
+	DistortionMesh mesh;
+	TEST_CHECK(mesh.Generate(&hmdDefault, YExtent(16.0f / 10.0f), 16, 16));
+	const std::vector<DistortionVertex>& vertices = mesh.GetVertices();
+	TEST_CHECK_EQUAL(vertices.size(), 17 * 17);
+	TEST_CHECK_EQUAL(mesh.GetIndices().size(), 16 * 16 * 6);
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		float radius = sqrtf(vertices[i].x * vertices[i].x + vertices[i].y * vertices[i].y);
+		if (radius == 0.0f) continue;
+		float scale = hmdDefault.Distort(radius) / radius;
+		TEST_CHECK(fabsf(vertices[i].greenU - vertices[i].x * scale) < 1e-5f * (1.0f + fabsf(vertices[i].greenU)));
+		TEST_CHECK(fabsf(vertices[i].greenV - vertices[i].y * scale) < 1e-5f * (1.0f + fabsf(vertices[i].greenV)));
+	}
+
+	// the left screen half edge is where GetScaleToFillHorizontal() is taken
+	float uv6[6];
+	TEST_CHECK(mesh.Sample(-1.0f - hmdDefault.GetLensXCenterOffset(), 0.0f, uv6));
+	TEST_CHECK(fabsf(uv6[2] - hmdDefault.Distort(-1.0f - hmdDefault.GetLensXCenterOffset())) < 1e-4f);
+
+	// out of range
+	TEST_CHECK(!mesh.Sample(2.0f, 0.0f, uv6));
+	TEST_CHECK(!mesh.Generate(&hmdDefault, 1.0f, 0, 16));
+	TEST_CHECK(!mesh.Generate(&hmdDefault, 1.0f, DistortionMesh::MAX_RESOLUTION + 1, 16));
+}
+
+/**
+* Cached meshes load the same data, other coefficients use another file.
+***/
+static void TestCache()
+{
+	HMDisplayInfo_Default hmd;
+	DistortionMesh generated;
+	TEST_CHECK(generated.LoadOrGenerate(&hmd, YExtent(16.0f / 10.0f), 32, 32, ""));
+	std::string file = generated.GetCacheFileName();
+
+	FILE* stream = fopen(file.c_str(), "rb");
+	TEST_CHECK(stream != NULL);
+	if (stream) fclose(stream);
+
+	DistortionMesh loaded;
+	TEST_CHECK(loaded.LoadOrGenerate(&hmd, YExtent(16.0f / 10.0f), 32, 32, ""));
+	TEST_CHECK(loaded.GetCacheFileName() == file);
+	TEST_CHECK_EQUAL(loaded.GetVertices().size(), generated.GetVertices().size());
+	TEST_CHECK(memcmp(&loaded.GetVertices()[0], &generated.GetVertices()[0], generated.GetVertices().size() * sizeof(DistortionVertex)) == 0);
+	TEST_CHECK(loaded.GetIndices() == generated.GetIndices());
+
+	DistortionMesh other;
+	TEST_CHECK(other.Generate(&hmd, YExtent(16.0f / 9.0f), 32, 32));
+	TEST_CHECK(other.GetCacheFileName() != file);
+	hmd.GetDistortionCoefficients()[1] = 0.25f;
+	TEST_CHECK(other.Generate(&hmd, YExtent(16.0f / 10.0f), 32, 32));
+	TEST_CHECK(other.GetCacheFileName() != file);
+
+	remove(file.c_str());
+}
+
+/**
+* Generation time per resolution, informational.
+***/
+static void BenchmarkGenerate()
+{
+	HMDisplayInfo_Default hmd;
+	UINT resolutions[] = { 16, 32, 64, 128, DistortionMesh::MAX_RESOLUTION };
+	for (int i = 0; i < 5; i++)
+	{
+		DistortionMesh mesh;
+		const int runs = 20;
+		std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+		for (int run = 0; run < runs; run++)
+			mesh.Generate(&hmd, YExtent(16.0f / 10.0f), resolutions[i], resolutions[i]);
+		double us = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start).count() / runs;
+		printf("Generate %3u x %3u : %8.1f us, %6u vertices\n", resolutions[i], resolutions[i], us, (UINT)mesh.GetVertices().size());
+	}
+}
+
+int main()
+{
+	TestAgainstDistort();
+	TestCache();
+	BenchmarkGenerate();
+	return TestResult("DistortionMeshTest");
+}
@@ -0,0 +1,187 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <ProxyObjectPoolTest.cpp> :
+ProxyObjectPool stress test : a mock device creates and releases
+textures at a high rate, each wrapped by a pooled proxy as the
+D3D9Proxy* wrapper classes do (leaked pool, derived classes on the
+heap). Checks the allocation counts, the footprint, that released
+objects are reused, and that wrappers can still be released after
+the static destructors ran on process exit.
+********************************************************************/
+#include <d3d9.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+#include "ProxyObjectPool.h"
+#include "TestCheck.h"
+
+/**
+* Mock device, counts the actual textures alive.
+***/
+struct MockTextureDevice
+{
+	MockTextureDevice() : created(0), live(0), mtx() {}
+
+	IDirect3DTexture9* CreateTexture()
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		created++;
+		live++;
+		return new IDirect3DTexture9();
+	}
+	void Release(IDirect3DTexture9* pTexture)
+	{
+		if (pTexture->Release() == 0) {
+			std::lock_guard<std::mutex> lock(mtx);
+			live--;
+			delete pTexture;
+		}
+	}
+
+	size_t created;
+	size_t live;
+	std::mutex mtx;
+};
+
+/**
+* Pooled texture wrapper, as D3D9ProxyTexture.
+***/
+class PooledTexture
+{
+public:
+	PooledTexture(MockTextureDevice* pDevice) : m_pDevice(pDevice), m_pActualTexture(pDevice->CreateTexture())
+	{
+		memset(m_payload, 0x5a, sizeof(m_payload));
+	}
+	virtual ~PooledTexture()
+	{
+		// a reused object must not have been overwritten while alive
+		for (size_t i = 0; i < sizeof(m_payload); i++)
+			TEST_CHECK(m_payload[i] == 0x5a);
+		m_pDevice->Release(m_pActualTexture);
+	}
+
+	static void* operator new(size_t size) { return s_pPool->Allocate(size); }
+	static void  operator delete(void* p, size_t size) { s_pPool->Free(p, size); }
+	static ProxyPoolStats GetPoolStats() { return s_pPool->GetStats(); }
+
+protected:
+	MockTextureDevice* m_pDevice;
+	IDirect3DTexture9* m_pActualTexture;
+	unsigned char m_payload[120];
+
+private:
+	static ProxyObjectPool* const s_pPool;
+};
+ProxyObjectPool* const PooledTexture::s_pPool = new ProxyObjectPool(sizeof(PooledTexture));
+
+/**
+* Derived wrapper, bigger than the pooled class, allocated on the heap.
+***/
+class DerivedTexture : public PooledTexture
+{
+public:
+	DerivedTexture(MockTextureDevice* pDevice) : PooledTexture(pDevice) {}
+	double extra[4];
+};
+
+/**
+* Creates and releases wrappers in random order, at most maxLive at the same time.
+***/
+static void Stress(MockTextureDevice* pDevice, int operations, size_t maxLive, unsigned int seed)
+{
+	std::vector<PooledTexture*> live;
+	for (int i = 0; i < operations; i++) {
+		if ((live.size() < maxLive) && (rand_r(&seed) % 3))
+			live.push_back(new PooledTexture(pDevice));
+		else if (!live.empty()) {
+			size_t k = rand_r(&seed) % live.size();
+			delete live[k];
+			live[k] = live.back();
+			live.pop_back();
+		}
+	}
+	for (size_t i = 0; i < live.size(); i++)
+		delete live[i];
+}
+
+/**
+* One thread : the pool grows to the peak and then only reuses objects.
+***/
+static void TestSingleThread(MockTextureDevice* pDevice)
+{
+	ProxyPoolStats before = PooledTexture::GetPoolStats();
+	Stress(pDevice, 1000000, 2000, 1);
+	ProxyPoolStats after = PooledTexture::GetPoolStats();
+
+	TEST_CHECK_EQUAL(after.liveObjects, 0);
+	TEST_CHECK(after.allocations - before.allocations > 300000);
+	TEST_CHECK(after.peakObjects <= 2000);
+	TEST_CHECK_EQUAL(after.slabs, (after.peakObjects + PROXY_POOL_SLAB_OBJECTS - 1) / PROXY_POOL_SLAB_OBJECTS);
+	TEST_CHECK(after.footprint >= after.slabs * PROXY_POOL_SLAB_OBJECTS * sizeof(PooledTexture));
+	TEST_CHECK_EQUAL(pDevice->live, 0);
+
+	// released objects are reused, no new slab
+	PooledTexture* pFirst = new PooledTexture(pDevice);
+	delete pFirst;
+	PooledTexture* pSecond = new PooledTexture(pDevice);
+	TEST_CHECK(pFirst == pSecond);
+	delete pSecond;
+	TEST_CHECK_EQUAL(PooledTexture::GetPoolStats().slabs, after.slabs);
+}
+
+/**
+* Several threads share the pool.
+***/
+static void TestThreads(MockTextureDevice* pDevice)
+{
+	std::thread threads[4];
+	for (unsigned int i = 0; i < 4; i++)
+		threads[i] = std::thread(Stress, pDevice, 200000, (size_t)500, i + 2);
+	for (unsigned int i = 0; i < 4; i++)
+		threads[i].join();
+
+	ProxyPoolStats stats = PooledTexture::GetPoolStats();
+	TEST_CHECK_EQUAL(stats.liveObjects, 0);
+	TEST_CHECK(stats.peakObjects <= 2000);
+	TEST_CHECK_EQUAL(pDevice->live, 0);
+}
+
+/**
+* Derived classes bypass the pool.
+***/
+static void TestDerived(MockTextureDevice* pDevice)
+{
+	ProxyPoolStats before = PooledTexture::GetPoolStats();
+	PooledTexture* pDerived = new DerivedTexture(pDevice);
+	TEST_CHECK_EQUAL(PooledTexture::GetPoolStats().allocations, before.allocations);
+	delete pDerived;
+	TEST_CHECK_EQUAL(PooledTexture::GetPoolStats().liveObjects, before.liveObjects);
+	TEST_CHECK_EQUAL(pDevice->live, 0);
+}
+
+/**
+* Wrapper still alive on process exit, released by a static destructor.
+***/
+struct ExitRelease
+{
+	ExitRelease() : pTexture(NULL) {}
+	~ExitRelease() { delete pTexture; }
+	PooledTexture* pTexture;
+};
+static MockTextureDevice g_exitDevice;
+static ExitRelease g_exitRelease;
+
+int main()
+{
+	MockTextureDevice device;
+	TestSingleThread(&device);
+	TestThreads(&device);
+	TestDerived(&device);
+
+	g_exitRelease.pTexture = new PooledTexture(&g_exitDevice);
+	return TestResult("ProxyObjectPoolTest");
+}
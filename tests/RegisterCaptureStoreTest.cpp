@@ -0,0 +1,135 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <RegisterCaptureStoreTest.cpp> :
+RegisterCaptureStore against a std::map reference model (the former
+per register selection set and data map), random stores and captures
+including runs across mask words. Applying the runs must write the
+same registers as the model and every run must be maximal.
+********************************************************************/
+#include <d3d9.h>
+#include <map>
+#include <set>
+#include <vector>
+#include <stdlib.h>
+#include "ShaderRegisters.h"
+#include "TestCheck.h"
+
+/**
+* One register, the model data.
+***/
+struct Register4
+{
+	float data[VECTOR_LENGTH];
+};
+
+/**
+* Random stores and captures, checked against the map model.
+***/
+static void TestAgainstMapModel()
+{
+	const UINT registerCount = 256;
+	srand(44);
+	for (int run = 0; run < 2000; run++)
+	{
+		RegisterCaptureStore store;
+		std::map<UINT, Register4> model;
+
+		int operations = rand() % 20 + 1;
+		for (int op = 0; op < operations; op++)
+		{
+			UINT start = (UINT)(rand() % (registerCount - 1));
+			UINT count = 1 + (UINT)(rand() % ((rand() % 4 == 0) ? 80 : 4));
+			if (start + count >= registerCount)
+				count = registerCount - 1 - start;
+			if (!count)
+				continue;
+
+			std::vector<float> data(count * VECTOR_LENGTH);
+			for (size_t i = 0; i < data.size(); i++)
+				data[i] = (float)(rand() % 1000);
+			store.Store(start, &data[0], count);
+			for (UINT i = 0; i < count; i++)
+				for (UINT k = 0; k < VECTOR_LENGTH; k++)
+					model[start + i].data[k] = data[RegisterIndex(i) + k];
+		}
+
+		// capture from the device register vector
+		if (rand() % 2)
+		{
+			std::vector<float> device(registerCount * VECTOR_LENGTH);
+			for (size_t i = 0; i < device.size(); i++)
+				device[i] = (float)(rand() % 1000);
+			store.CaptureFrom(device);
+			for (std::map<UINT, Register4>::iterator it = model.begin(); it != model.end(); ++it)
+				for (UINT k = 0; k < VECTOR_LENGTH; k++)
+					it->second.data[k] = device[RegisterIndex(it->first) + k];
+		}
+
+		// apply the runs
+		std::vector<float> applied(registerCount * VECTOR_LENGTH, -1.0f);
+		std::vector<float> expected(registerCount * VECTOR_LENGTH, -1.0f);
+		std::set<UINT> visited;
+		UINT start = 0, count = 0, next = 0;
+		while (store.NextRun(next, start, count))
+		{
+			TEST_CHECK(count > 0);
+			if (!count)
+				break;
+			TEST_CHECK(!store.IsSelected(start + count));
+			if (start > 0)
+				TEST_CHECK(!store.IsSelected(start - 1));
+			const float* pData = store.Data(start);
+			std::copy(pData, pData + VECTOR_LENGTH * count, applied.begin() + RegisterIndex(start));
+			for (UINT i = start; i < start + count; i++)
+				visited.insert(i);
+			next = start + count;
+		}
+		for (std::map<UINT, Register4>::iterator it = model.begin(); it != model.end(); ++it)
+			for (UINT k = 0; k < VECTOR_LENGTH; k++)
+				expected[RegisterIndex(it->first) + k] = it->second.data[k];
+
+		TEST_CHECK(applied == expected);
+		TEST_CHECK_EQUAL(visited.size(), model.size());
+		TEST_CHECK_EQUAL(store.AnySelected(), !model.empty());
+
+		store.Clear();
+		TEST_CHECK(!store.AnySelected());
+		TEST_CHECK(!store.NextRun(0, start, count));
+	}
+}
+
+/**
+* Runs spanning full mask words, and a capture from a shorter register vector.
+***/
+static void TestWordBoundaries()
+{
+	RegisterCaptureStore store;
+	store.Select(30, 70);
+	store.Select(128, 32);
+
+	UINT start = 0, count = 0;
+	TEST_CHECK(store.NextRun(0, start, count));
+	TEST_CHECK_EQUAL(start, 30u);
+	TEST_CHECK_EQUAL(count, 70u);
+	TEST_CHECK(store.NextRun(start + count, start, count));
+	TEST_CHECK_EQUAL(start, 128u);
+	TEST_CHECK_EQUAL(count, 32u);
+	TEST_CHECK(!store.NextRun(start + count, start, count));
+
+	// registers beyond the vector are left untouched
+	float marker[VECTOR_LENGTH] = { 7.0f, 7.0f, 7.0f, 7.0f };
+	store.Store(150, marker, 1);
+	std::vector<float> device(RegisterIndex(140), 1.0f);
+	store.CaptureFrom(device);
+	TEST_CHECK_EQUAL(store.Data(30)[0], 1.0f);
+	TEST_CHECK_EQUAL(store.Data(139)[3], 1.0f);
+	TEST_CHECK_EQUAL(store.Data(150)[0], 7.0f);
+}
+
+int main()
+{
+	TestAgainstMapModel();
+	TestWordBoundaries();
+	return TestResult("RegisterCaptureStoreTest");
+}
@@ -0,0 +1,157 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <RenderStateShadowTest.cpp> :
+RenderStateShadow against the recording mock device. Covers the flat
+index mapping, fetch on first read only, and the stereo view save /
+apply / restore sequence of the proxy device over random game states.
+********************************************************************/
+#include <d3d9.h>
+#include <stdlib.h>
+#include <vector>
+#include "RenderStateShadow.h"
+#include "TestCheck.h"
+
+/**
+* Every index maps to a distinct device state and back.
+***/
+static void TestIndexMapping()
+{
+	IDirect3DDevice9 device;
+	for (UINT index = 0; index < SHADOW_STATE_COUNT; index++)
+		TEST_CHECK(SUCCEEDED(RenderStateShadow::SetOnDevice(&device, index, index + 1)));
+	for (UINT index = 0; index < SHADOW_STATE_COUNT; index++)
+	{
+		DWORD value = 0;
+		TEST_CHECK(SUCCEEDED(RenderStateShadow::GetFromDevice(&device, index, &value)));
+		TEST_CHECK_EQUAL(value, (DWORD)index + 1);
+	}
+	TEST_CHECK(FAILED(RenderStateShadow::SetOnDevice(&device, SHADOW_STATE_COUNT, 0)));
+
+	TEST_CHECK_EQUAL(RenderStateShadow::RenderStateIndex(D3DRS_CULLMODE), (UINT)D3DRS_CULLMODE);
+	TEST_CHECK_EQUAL(RenderStateShadow::RenderStateIndex((D3DRENDERSTATETYPE)SHADOW_RENDER_STATES), SHADOW_INVALID_INDEX);
+	TEST_CHECK_EQUAL(RenderStateShadow::SamplerStateIndex(16, D3DSAMP_ADDRESSU), SHADOW_INVALID_INDEX);
+	TEST_CHECK(RenderStateShadow::SamplerStateIndex(D3DVERTEXTEXTURESAMPLER3, D3DSAMP_DMAPOFFSET) < SHADOW_TEXTURE_STAGE_BASE);
+	TEST_CHECK_EQUAL(RenderStateShadow::TextureStageStateIndex(SHADOW_TEXTURE_STAGES, D3DTSS_COLOROP), SHADOW_INVALID_INDEX);
+	TEST_CHECK(RenderStateShadow::TextureStageStateIndex(SHADOW_TEXTURE_STAGES - 1, D3DTSS_CONSTANT) < SHADOW_STATE_COUNT);
+}
+
+/**
+* Unknown states are fetched once, known states never.
+***/
+static void TestFetch()
+{
+	IDirect3DDevice9 device;
+	RenderStateShadow shadow;
+	RenderStateShadow::SetOnDevice(&device, 100, 7);
+
+	TEST_CHECK(!shadow.IsKnown(100));
+	TEST_CHECK_EQUAL(shadow.Fetch(&device, 100), (DWORD)7);
+	TEST_CHECK_EQUAL(device.stateGets, 1);
+	TEST_CHECK_EQUAL(shadow.Fetch(&device, 100), (DWORD)7);
+	TEST_CHECK_EQUAL(device.stateGets, 1);
+
+	shadow.Set(101, 9);
+	TEST_CHECK_EQUAL(shadow.Fetch(&device, 101), (DWORD)9);
+	TEST_CHECK_EQUAL(device.stateGets, 1);
+
+	shadow.Forget(100);
+	shadow.Fetch(&device, 100);
+	TEST_CHECK_EQUAL(device.stateGets, 2);
+
+	// NextKnown walks the known states in index order
+	RenderStateShadow known;
+	UINT indices[] = { 0, 31, 32, 200, SHADOW_SAMPLER_BASE + 3, SHADOW_STATE_COUNT - 1 };
+	for (UINT i = 0; i < sizeof(indices) / sizeof(indices[0]); i++)
+		known.Set(indices[i], i);
+	UINT found = 0;
+	for (UINT index = known.NextKnown(0); index != SHADOW_INVALID_INDEX; index = known.NextKnown(index + 1))
+	{
+		TEST_CHECK(found < sizeof(indices) / sizeof(indices[0]));
+		if (found < sizeof(indices) / sizeof(indices[0]))
+			TEST_CHECK_EQUAL(index, indices[found]);
+		found++;
+	}
+	TEST_CHECK_EQUAL(found, (UINT)(sizeof(indices) / sizeof(indices[0])));
+}
+
+/**
+* The proxy device sequence : the game sets states (forwarded and shadowed), the stereo view
+* saves the states it is about to change, applies its own and restores the saved ones.
+* The device must end in the game state, without Get calls once all states are known.
+***/
+static void TestSaveRestore()
+{
+	srand(45);
+	IDirect3DDevice9 device;
+	RenderStateShadow game;
+	std::vector<DWORD> gameModel(SHADOW_STATE_COUNT, 0);
+	for (UINT index = 0; index < SHADOW_STATE_COUNT; index++)
+		RenderStateShadow::SetOnDevice(&device, index, 0);
+
+	// stereo view states
+	RenderStateShadow view;
+	for (int i = 0; i < 134; i++)
+		view.Set((UINT)(rand() % SHADOW_STATE_COUNT), (DWORD)rand());
+
+	int mismatches = 0;
+	for (int frame = 0; frame < 2000; frame++)
+	{
+		// game states of this frame
+		int sets = rand() % 64;
+		for (int i = 0; i < sets; i++)
+		{
+			UINT index = (UINT)(rand() % SHADOW_STATE_COUNT);
+			DWORD value = (DWORD)rand();
+			RenderStateShadow::SetOnDevice(&device, index, value);
+			game.Set(index, value);
+			gameModel[index] = value;
+		}
+
+		// save
+		RenderStateShadow saved;
+		saved.CopyKnown(view);
+		saved.RefreshKnown(game, &device);
+
+		// apply the view states
+		for (UINT index = view.NextKnown(0); index != SHADOW_INVALID_INDEX; index = view.NextKnown(index + 1))
+		{
+			DWORD value = 0;
+			view.Get(index, &value);
+			RenderStateShadow::SetOnDevice(&device, index, value);
+		}
+
+		// restore
+		for (UINT index = saved.NextKnown(0); index != SHADOW_INVALID_INDEX; index = saved.NextKnown(index + 1))
+		{
+			DWORD value = 0;
+			saved.Get(index, &value);
+			RenderStateShadow::SetOnDevice(&device, index, value);
+		}
+
+		for (UINT index = 0; index < SHADOW_STATE_COUNT; index++)
+		{
+			DWORD value = 0;
+			RenderStateShadow::GetFromDevice(&device, index, &value);
+			if (value != gameModel[index]) mismatches++;
+		}
+		device.stateGets = 0;
+	}
+	TEST_CHECK_EQUAL(mismatches, 0);
+
+	// once every view state is known in the game shadow there are no more Get calls
+	long getsBefore = device.stateGets;
+	RenderStateShadow saved;
+	saved.CopyKnown(view);
+	saved.RefreshKnown(game, &device);
+	saved.RefreshKnown(game, &device);
+	TEST_CHECK_EQUAL(device.stateGets, getsBefore);
+}
+
+int main()
+{
+	TestIndexMapping();
+	TestFetch();
+	TestSaveRestore();
+	return TestResult("RenderStateShadowTest");
+}
@@ -0,0 +1,228 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <ShaderRegistersTest.cpp> :
+ShaderRegisters dirty run coalescing against a per register model of
+the device registers : random constant sets, shader changes, dirty
+applies and stereo applies for both sides. The device registers must
+match the model after every apply, each maximal run of dirty registers
+must be uploaded with exactly one call and the upload statistics must
+match the calls the mock device received.
+********************************************************************/
+#include <d3d9.h>
+#include <algorithm>
+#include <memory>
+#include <vector>
+#include <stdlib.h>
+#include "ShaderRegisters.h"
+#include "TestCheck.h"
+
+static const UINT VS_REGISTERS = 256;
+static const UINT PS_REGISTERS = 224;
+
+/**
+* Model of the vertex shader registers : proxy data, device data and dirty flags.
+***/
+struct RegisterModel
+{
+	RegisterModel() :
+		proxy(VS_REGISTERS * VECTOR_LENGTH, 0.0f),
+		device(VS_REGISTERS * VECTOR_LENGTH, 0.0f),
+		dirty(VS_REGISTERS, 0),
+		pConstants(NULL)
+	{}
+
+	std::vector<float> proxy;
+	std::vector<float> device;
+	std::vector<char> dirty;
+	const StereoConstantSet* pConstants;
+};
+
+/**
+* Left and right data as the mock modification computes them.
+***/
+static float SideData(float data, vireio::RenderPosition side)
+{
+	return (side == vireio::Left) ? (data * 2 + 1) : (data * 3 - 1);
+}
+
+/**
+* Applies dirty registers (or all modified constants) to the model device.
+* @return Number of maximal dirty runs, the number of uploads expected for a dirty apply.
+***/
+static long ModelApply(RegisterModel& model, vireio::RenderPosition side, bool stereoConstantsOnly)
+{
+	std::vector<char> stereo(VS_REGISTERS, 0);
+	if (model.pConstants)
+	{
+		for (UINT i = 0; i < model.pConstants->Size(); i++)
+		{
+			const StereoConstantBinding& binding = (*model.pConstants)[i];
+			bool dirty = false;
+			for (UINT k = 0; k < binding.count; k++)
+				dirty |= (model.dirty[binding.startRegister + k] != 0);
+
+			if (dirty || stereoConstantsOnly)
+			{
+				for (UINT k = 0; k < binding.count * VECTOR_LENGTH; k++)
+					model.device[RegisterIndex(binding.startRegister) + k] = SideData(model.proxy[RegisterIndex(binding.startRegister) + k], side);
+			}
+			for (UINT k = 0; k < binding.count; k++)
+			{
+				if (stereoConstantsOnly)
+					model.dirty[binding.startRegister + k] = 0;
+				else if (dirty)
+					stereo[binding.startRegister + k] = 1;
+			}
+		}
+	}
+	if (stereoConstantsOnly)
+		return 0;
+
+	long runs = 0;
+	for (UINT r = 0; r < VS_REGISTERS; r++)
+	{
+		bool dirty = model.dirty[r] || stereo[r];
+		if (dirty && ((r == 0) || !(model.dirty[r - 1] || stereo[r - 1])))
+			runs++;
+		if (model.dirty[r] && !stereo[r])
+			for (UINT k = 0; k < VECTOR_LENGTH; k++)
+				model.device[RegisterIndex(r) + k] = model.proxy[RegisterIndex(r) + k];
+	}
+	std::fill(model.dirty.begin(), model.dirty.end(), 0);
+	return runs;
+}
+
+/**
+* Random modified constant set, single registers and matrices with random gaps.
+***/
+static std::shared_ptr<const StereoConstantSet> RandomConstantSet(const std::shared_ptr<ShaderConstantModification<float>>& modification, UINT maxRegister)
+{
+	std::vector<StereoConstantBinding> bindings;
+	UINT startRegister = (UINT)(rand() % 8);
+	while ((startRegister + 4 < maxRegister) && (bindings.size() < 6))
+	{
+		UINT count = (rand() % 2) ? 4 : 1;
+		StereoConstantBinding binding = { startRegister, count, modification };
+		bindings.push_back(binding);
+		startRegister += count + ((rand() % 3) ? 0 : (UINT)(rand() % 10));
+	}
+	StereoConstantSet::Normalize(bindings);
+	return std::make_shared<StereoConstantSet>(bindings);
+}
+
+/**
+* Random register sets, shader changes and applies against the model.
+***/
+static void TestAgainstRegisterModel()
+{
+	std::shared_ptr<ShaderConstantModification<float>> modification = std::make_shared<ShaderConstantModification<float>>();
+	srand(47);
+	for (int run = 0; run < 200; run++)
+	{
+		IDirect3DDevice9 device;
+		ShaderRegisters registers(PS_REGISTERS, VS_REGISTERS, &device);
+		RegisterModel model;
+
+		D3D9ProxyVertexShader shaders[4];
+		for (int i = 0; i < 3; i++)
+			shaders[i].set = RandomConstantSet(modification, 240);
+
+		// the initial device registers are unknown, dirty all of them once
+		std::vector<float> zero(250 * VECTOR_LENGTH, 0.0f);
+		registers.SetVertexShaderConstantF(0, &zero[0], 250);
+		std::fill(model.dirty.begin(), model.dirty.begin() + 250, 1);
+
+		vireio::RenderPosition side = vireio::Left;
+		for (int step = 0; step < 500; step++)
+		{
+			int op = rand() % 10;
+			if (op < 5)
+			{
+				UINT start = (UINT)(rand() % 240);
+				UINT count = 1 + (UINT)(rand() % 8);
+				std::vector<float> data(count * VECTOR_LENGTH);
+				for (size_t i = 0; i < data.size(); i++)
+					data[i] = (float)(rand() % 1000);
+				registers.SetVertexShaderConstantF(start, &data[0], count);
+				std::copy(data.begin(), data.end(), model.proxy.begin() + RegisterIndex(start));
+				std::fill(model.dirty.begin() + start, model.dirty.begin() + start + count, 1);
+			}
+			else if (op < 7)
+			{
+				// constants that are not the same in the old set need updating
+				D3D9ProxyVertexShader* pShader = &shaders[rand() % 4];
+				const StereoConstantSet* pOld = model.pConstants;
+				registers.ActiveVertexShaderChanged(pShader);
+				model.pConstants = pShader->ModifiedConstants();
+				if (model.pConstants && (model.pConstants != pOld))
+				{
+					for (UINT i = 0; i < model.pConstants->Size(); i++)
+					{
+						const StereoConstantBinding& binding = (*model.pConstants)[i];
+						int old = pOld ? pOld->Find(binding.startRegister) : -1;
+						if ((old < 0) || ((*pOld)[old].count != binding.count))
+							model.dirty[binding.startRegister] = 1;
+					}
+				}
+			}
+			else if (op < 9)
+			{
+				long callsBefore = device.vsConstantCalls;
+				registers.ApplyAllDirty(side);
+				long runs = ModelApply(model, side, false);
+				TEST_CHECK(device.vsConstants == model.device);
+				TEST_CHECK_EQUAL(device.vsConstantCalls - callsBefore, runs);
+			}
+			else
+			{
+				side = (side == vireio::Left) ? vireio::Right : vireio::Left;
+				registers.ApplyAllStereoConstants(side);
+				ModelApply(model, side, true);
+				TEST_CHECK(device.vsConstants == model.device);
+			}
+		}
+
+		registers.ActiveVertexShaderChanged(NULL);
+		registers.NextFrame();
+		TEST_CHECK_EQUAL(registers.GetLastFrameVSUploads().calls, (UINT)device.vsConstantCalls);
+		TEST_CHECK_EQUAL(registers.GetLastFrameVSUploads().registers, (UINT)device.vsConstantRegisters);
+		TEST_CHECK_EQUAL(registers.GetLastFrameVSUploads().bytes, (UINT)device.vsConstantRegisters * VECTOR_LENGTH * sizeof(float));
+		TEST_CHECK_EQUAL(device.psConstantCalls, 0);
+	}
+}
+
+/**
+* Adjacent constants set with separate calls go to the device with one call.
+***/
+static void TestAdjacentRunsMerge()
+{
+	IDirect3DDevice9 device;
+	ShaderRegisters registers(PS_REGISTERS, VS_REGISTERS, &device);
+
+	float matrix[4 * VECTOR_LENGTH] = { 0 };
+	registers.SetVertexShaderConstantF(0, matrix, 4);
+	registers.SetVertexShaderConstantF(4, matrix, 4);
+	registers.SetVertexShaderConstantF(8, matrix, 1);
+	registers.SetVertexShaderConstantF(12, matrix, 2);
+	registers.SetPixelShaderConstantF(0, matrix, 1);
+	registers.SetPixelShaderConstantF(1, matrix, 1);
+	registers.ApplyAllDirty(vireio::Left);
+
+	TEST_CHECK_EQUAL(device.vsConstantCalls, 2);
+	TEST_CHECK_EQUAL(device.vsConstantRegisters, 11);
+	TEST_CHECK_EQUAL(device.psConstantCalls, 1);
+	TEST_CHECK_EQUAL(device.psConstantRegisters, 2);
+
+	// nothing dirty, nothing uploaded
+	registers.ApplyAllDirty(vireio::Left);
+	TEST_CHECK_EQUAL(device.vsConstantCalls, 2);
+	TEST_CHECK_EQUAL(device.psConstantCalls, 1);
+}
+
+int main()
+{
+	TestAgainstRegisterModel();
+	TestAdjacentRunsMerge();
+	return TestResult("ShaderRegistersTest");
+}
@@ -0,0 +1,666 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <StereoBatchTest.cpp> :
+StereoBatch record and replay against a recording mock device. A
+test proxy follows the D3DProxyDevice calls (side dependent render
+target, stereo textures and stereo constants, draws recorded or drawn
+twice, flush on any other call). Random game call streams must give
+the same draws with the same state on both sides in both modes, with
+one side switch per run instead of one per draw. Also covers the
+initial state of a run, reference counts, user pointer data copies
+and the CPU time per draw of both modes.
+********************************************************************/
+#include <d3d9.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <vector>
+#include <map>
+#include <chrono>
+#include "StereoBatch.h"
+#include "TestCheck.h"
+
+/**
+* Mock interfaces, identified by number. Stereo textures have a right side number.
+***/
+struct TestTexture : public IDirect3DTexture9 { int left; int right; };
+struct TestVertexShader : public IDirect3DVertexShader9 { int id; };
+struct TestPixelShader : public IDirect3DPixelShader9 { int id; };
+struct TestVertexBuffer : public IDirect3DVertexBuffer9 { int id; };
+struct TestIndexBuffer : public IDirect3DIndexBuffer9 { int id; };
+struct TestDeclaration : public IDirect3DVertexDeclaration9 { int id; };
+
+/**
+* Number of constant registers the stereo constants of the mock modify (per side offset).
+***/
+static const UINT STEREO_REGISTERS = 4;
+
+/**
+* Actual device : the bound state in plain numbers, each draw logs a hash of the state per side.
+***/
+struct ActualDevice
+{
+	ActualDevice() :
+		renderTarget(0), vertexShader(0), pixelShader(0), declaration(0), indices(0),
+		vsConstants(STEREO_BATCH_VS_CONSTANTS * 4, 0.0f), psConstants(STEREO_BATCH_PS_CONSTANTS * 4, 0.0f),
+		calls(0), logging(true)
+	{
+		for (int i = 0; i < BINDING_TEXTURE_SLOTS; i++) textures[i] = 0;
+		for (int i = 0; i < BINDING_VERTEX_STREAMS; i++) streams[i] = offsets[i] = strides[i] = 0;
+		for (UINT i = 0; i < SHADOW_STATE_COUNT; i++) states[i] = 0;
+	}
+
+	void Hash(uint64_t& hash, uint64_t value) const { hash = (hash ^ value) * 1099511628211ull; }
+	void HashData(uint64_t& hash, const void* pData, size_t size) const
+	{
+		for (size_t i = 0; i < size; i++) Hash(hash, ((const BYTE*)pData)[i]);
+	}
+	/**
+	* Logs a draw with all state, constants of the first 32 registers.
+	***/
+	void Draw(uint64_t hash)
+	{
+		calls++;
+		if (!logging) return;
+		Hash(hash, (uint64_t)vertexShader);
+		Hash(hash, (uint64_t)pixelShader);
+		Hash(hash, (uint64_t)declaration);
+		Hash(hash, (uint64_t)indices);
+		for (int i = 0; i < BINDING_TEXTURE_SLOTS; i++) Hash(hash, (uint64_t)textures[i]);
+		for (int i = 0; i < BINDING_VERTEX_STREAMS; i++) { Hash(hash, streams[i]); Hash(hash, offsets[i]); Hash(hash, strides[i]); }
+		for (UINT i = 0; i < SHADOW_STATE_COUNT; i++) Hash(hash, states[i]);
+		HashData(hash, &vsConstants[0], 32 * 4 * sizeof(float));
+		HashData(hash, &psConstants[0], 32 * 4 * sizeof(float));
+		draws[renderTarget].push_back(hash);
+	}
+
+	int renderTarget;
+	int textures[BINDING_TEXTURE_SLOTS];
+	int vertexShader, pixelShader, declaration, indices;
+	int streams[BINDING_VERTEX_STREAMS];
+	UINT offsets[BINDING_VERTEX_STREAMS], strides[BINDING_VERTEX_STREAMS];
+	DWORD states[SHADOW_STATE_COUNT];
+	std::vector<float> vsConstants, psConstants;
+	std::vector<uint64_t> draws[2];
+	long calls;
+	bool logging;
+};
+
+/**
+* Test proxy, the stereo parts of D3DProxyDevice on the actual mock device.
+***/
+class TestProxy
+{
+public:
+	TestProxy(bool batch) :
+		m_batch(batch), m_mono(false), m_side(0), m_switches(0), m_pVertexShader(NULL), m_pPixelShader(NULL),
+		m_pDeclaration(NULL), m_pIndices(NULL),
+		m_vsRegisters(STEREO_BATCH_VS_CONSTANTS * 4, 0.0f), m_psRegisters(STEREO_BATCH_PS_CONSTANTS * 4, 0.0f)
+	{
+		for (int i = 0; i < BINDING_VERTEX_STREAMS; i++) m_offsets[i] = m_strides[i] = 0;
+		for (UINT i = 0; i < SHADOW_STATE_COUNT; i++) m_states.Set(i, 0);
+	}
+	~TestProxy()
+	{
+		FlushStereoBatch();
+		SetVertexShader(NULL);
+		SetPixelShader(NULL);
+		SetVertexDeclaration(NULL);
+		SetIndices(NULL);
+	}
+
+	HRESULT SetTexture(DWORD Stage, IDirect3DBaseTexture9* pTexture)
+	{
+		UINT slot = TextureStageToSlot(Stage);
+		if (StereoBatchRecording() && !m_stereoBatch.RecordTexture(Stage, pTexture, m_textures.Get(slot)))
+			FlushStereoBatch();
+		if (slot == BINDING_INVALID_SLOT)
+			return D3DERR_INVALIDCALL;
+		m_textures.Bind(slot, pTexture);
+		device.textures[slot] = ActualTexture(pTexture);
+		return D3D_OK;
+	}
+	HRESULT SetVertexShader(IDirect3DVertexShader9* pShader)
+	{
+		if (StereoBatchRecording())
+			m_stereoBatch.RecordVertexShader(pShader, m_pVertexShader);
+		Hold(m_pVertexShader, pShader);
+		device.vertexShader = pShader ? static_cast<TestVertexShader*>(pShader)->id : 0;
+		return D3D_OK;
+	}
+	HRESULT SetPixelShader(IDirect3DPixelShader9* pShader)
+	{
+		if (StereoBatchRecording())
+			m_stereoBatch.RecordPixelShader(pShader, m_pPixelShader);
+		Hold(m_pPixelShader, pShader);
+		device.pixelShader = pShader ? static_cast<TestPixelShader*>(pShader)->id : 0;
+		return D3D_OK;
+	}
+	HRESULT SetVertexDeclaration(IDirect3DVertexDeclaration9* pDecl)
+	{
+		if (StereoBatchRecording())
+			m_stereoBatch.RecordVertexDeclaration(pDecl, m_pDeclaration);
+		Hold(m_pDeclaration, pDecl);
+		device.declaration = pDecl ? static_cast<TestDeclaration*>(pDecl)->id : 0;
+		return D3D_OK;
+	}
+	HRESULT SetIndices(IDirect3DIndexBuffer9* pIndexData)
+	{
+		if (StereoBatchRecording())
+			m_stereoBatch.RecordIndices(pIndexData, m_pIndices);
+		Hold(m_pIndices, pIndexData);
+		device.indices = pIndexData ? static_cast<TestIndexBuffer*>(pIndexData)->id : 0;
+		return D3D_OK;
+	}
+	HRESULT SetStreamSource(UINT StreamNumber, IDirect3DVertexBuffer9* pStreamData, UINT OffsetInBytes, UINT Stride)
+	{
+		if (StereoBatchRecording()) {
+			RecordInitialStream(StreamNumber);
+			if (!m_stereoBatch.RecordStreamSource(StreamNumber, pStreamData, OffsetInBytes, Stride))
+				FlushStereoBatch();
+		}
+		m_streams.Bind(StreamNumber, pStreamData);
+		device.streams[StreamNumber] = pStreamData ? static_cast<TestVertexBuffer*>(pStreamData)->id : 0;
+		device.offsets[StreamNumber] = m_offsets[StreamNumber] = OffsetInBytes;
+		device.strides[StreamNumber] = m_strides[StreamNumber] = Stride;
+		return D3D_OK;
+	}
+	HRESULT SetRenderState(D3DRENDERSTATETYPE State, DWORD Value) { return SetState(RenderStateShadow::RenderStateIndex(State), Value); }
+	HRESULT SetSamplerState(DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD Value) { return SetState(RenderStateShadow::SamplerStateIndex(Sampler, Type), Value); }
+	HRESULT SetTextureStageState(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value) { return SetState(RenderStateShadow::TextureStageStateIndex(Stage, Type), Value); }
+	HRESULT SetVertexShaderConstantF(UINT StartRegister, CONST float* pConstantData, UINT Vector4fCount)
+	{
+		if (StereoBatchRecording() && !m_stereoBatch.RecordVertexShaderConstantF(StartRegister, pConstantData, Vector4fCount, &m_vsRegisters[0]))
+			FlushStereoBatch();
+		if ((StartRegister + Vector4fCount) * 4 > m_vsRegisters.size())
+			return D3DERR_INVALIDCALL;
+		memcpy(&m_vsRegisters[StartRegister * 4], pConstantData, Vector4fCount * 4 * sizeof(float));
+		ApplyConstants(StartRegister, Vector4fCount);
+		return D3D_OK;
+	}
+	HRESULT SetPixelShaderConstantF(UINT StartRegister, CONST float* pConstantData, UINT Vector4fCount)
+	{
+		if (StereoBatchRecording() && !m_stereoBatch.RecordPixelShaderConstantF(StartRegister, pConstantData, Vector4fCount, &m_psRegisters[0]))
+			FlushStereoBatch();
+		if ((StartRegister + Vector4fCount) * 4 > m_psRegisters.size())
+			return D3DERR_INVALIDCALL;
+		memcpy(&m_psRegisters[StartRegister * 4], pConstantData, Vector4fCount * 4 * sizeof(float));
+		memcpy(&device.psConstants[StartRegister * 4], pConstantData, Vector4fCount * 4 * sizeof(float));
+		return D3D_OK;
+	}
+
+	HRESULT DrawPrimitive(D3DPRIMITIVETYPE PrimitiveType, UINT StartVertex, UINT PrimitiveCount)
+	{
+		uint64_t hash = DrawHash(1, PrimitiveType, StartVertex, PrimitiveCount);
+		device.Draw(hash);
+		if (StereoBatchDraw())
+			m_stereoBatch.RecordDrawPrimitive(PrimitiveType, StartVertex, PrimitiveCount);
+		else if (!m_stereoBatch.IsReplaying() && switchDrawingSide())
+			device.Draw(hash);
+		return D3D_OK;
+	}
+	HRESULT DrawIndexedPrimitive(D3DPRIMITIVETYPE PrimitiveType, INT BaseVertexIndex, UINT MinVertexIndex, UINT NumVertices, UINT startIndex, UINT primCount)
+	{
+		uint64_t hash = DrawHash(2, PrimitiveType, (UINT)BaseVertexIndex, MinVertexIndex);
+		device.Hash(hash, NumVertices);
+		device.Hash(hash, startIndex);
+		device.Hash(hash, primCount);
+		device.Draw(hash);
+		if (StereoBatchDraw())
+			m_stereoBatch.RecordDrawIndexedPrimitive(PrimitiveType, BaseVertexIndex, MinVertexIndex, NumVertices, startIndex, primCount);
+		else if (!m_stereoBatch.IsReplaying() && switchDrawingSide())
+			device.Draw(hash);
+		return D3D_OK;
+	}
+	HRESULT DrawPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT PrimitiveCount, CONST void* pVertexStreamZeroData, UINT VertexStreamZeroStride)
+	{
+		if (StereoBatchDraw())
+			RecordInitialStream(0);
+		uint64_t hash = DrawHash(3, PrimitiveType, PrimitiveCount, VertexStreamZeroStride);
+		device.HashData(hash, pVertexStreamZeroData, StereoBatch::VertexCount(PrimitiveType, PrimitiveCount) * VertexStreamZeroStride);
+		DrawUP(hash);
+		if (StereoBatchDraw())
+			m_stereoBatch.RecordDrawPrimitiveUP(PrimitiveType, PrimitiveCount, pVertexStreamZeroData, VertexStreamZeroStride);
+		else if (!m_stereoBatch.IsReplaying() && switchDrawingSide())
+			DrawUP(hash);
+		return D3D_OK;
+	}
+	HRESULT DrawIndexedPrimitiveUP(D3DPRIMITIVETYPE PrimitiveType, UINT MinVertexIndex, UINT NumVertices, UINT PrimitiveCount, CONST void* pIndexData, D3DFORMAT IndexDataFormat, CONST void* pVertexStreamZeroData, UINT VertexStreamZeroStride)
+	{
+		if (StereoBatchDraw()) {
+			RecordInitialStream(0);
+			m_stereoBatch.RecordInitialIndices(m_pIndices);
+		}
+		uint64_t hash = DrawHash(4, PrimitiveType, PrimitiveCount, VertexStreamZeroStride);
+		device.HashData(hash, pIndexData, StereoBatch::VertexCount(PrimitiveType, PrimitiveCount) * ((IndexDataFormat == D3DFMT_INDEX32) ? 4 : 2));
+		device.HashData(hash, pVertexStreamZeroData, (MinVertexIndex + NumVertices) * VertexStreamZeroStride);
+		Hold(m_pIndices, (IDirect3DIndexBuffer9*)NULL);
+		device.indices = 0;
+		DrawUP(hash);
+		if (StereoBatchDraw())
+			m_stereoBatch.RecordDrawIndexedPrimitiveUP(PrimitiveType, MinVertexIndex, NumVertices, PrimitiveCount, pIndexData, IndexDataFormat, pVertexStreamZeroData, VertexStreamZeroStride);
+		else if (!m_stereoBatch.IsReplaying() && switchDrawingSide())
+			DrawUP(hash);
+		return D3D_OK;
+	}
+
+	/**
+	* Any call that can't be recorded (lock, present, render target change ...).
+	***/
+	void OtherCall() { FlushStereoBatch(); }
+	/**
+	* Mono render target set (by an other call), draws go to one side only.
+	***/
+	void SetMonoRenderTarget(bool mono) { FlushStereoBatch(); m_mono = mono; if (mono) setDrawingSide(0); }
+
+	/**
+	* Replays the pending batch for the other side.
+	***/
+	void FlushStereoBatch()
+	{
+		if (m_stereoBatch.IsEmpty() || m_stereoBatch.IsReplaying())
+			return;
+		if (m_stereoBatch.GetDrawCount()) {
+			m_stereoBatch.BeginReplay();
+			if (switchDrawingSide())
+				m_stereoBatch.Replay(this);
+			m_stereoBatch.EndReplay();
+		}
+		else
+			m_stereoBatch.Clear();
+	}
+
+	ActualDevice device;
+	long GetSideSwitches() const { return m_switches; }
+	const StereoBatch& GetStereoBatch() const { return m_stereoBatch; }
+
+private:
+	bool StereoBatchRecording()
+	{
+		return m_batch && !m_stereoBatch.IsReplaying();
+	}
+	bool StereoBatchDraw()
+	{
+		return StereoBatchRecording() && !m_mono;
+	}
+	void RecordInitialStream(UINT StreamNumber)
+	{
+		if (m_stereoBatch.NeedsInitialStream(StreamNumber))
+			m_stereoBatch.RecordInitialStream(StreamNumber, m_streams.Get(StreamNumber), m_offsets[StreamNumber], m_strides[StreamNumber]);
+	}
+	HRESULT SetState(UINT index, DWORD Value)
+	{
+		if (StereoBatchRecording()) {
+			if (m_stereoBatch.NeedsInitialState(index))
+				m_stereoBatch.RecordInitialState(index, m_states.Fetch(NULL, index));
+			if (!m_stereoBatch.RecordState(index, Value))
+				FlushStereoBatch();
+		}
+		if (index == SHADOW_INVALID_INDEX)
+			return D3D_OK;
+		m_states.Set(index, Value);
+		device.states[index] = Value;
+		return D3D_OK;
+	}
+	/**
+	* UP draws reset stream 0 (and the indices), the draw doesn't use them.
+	***/
+	void DrawUP(uint64_t hash)
+	{
+		m_streams.Bind(0, NULL);
+		device.streams[0] = 0;
+		device.offsets[0] = device.strides[0] = m_offsets[0] = m_strides[0] = 0;
+		device.Draw(hash);
+	}
+	uint64_t DrawHash(UINT kind, UINT a, UINT b, UINT c)
+	{
+		uint64_t hash = 14695981039346656037ull;
+		device.Hash(hash, kind);
+		device.Hash(hash, a);
+		device.Hash(hash, b);
+		device.Hash(hash, c);
+		return hash;
+	}
+	int ActualTexture(IDirect3DBaseTexture9* pTexture)
+	{
+		if (!pTexture) return 0;
+		TestTexture* pTest = static_cast<TestTexture*>(pTexture);
+		return ((m_side == 1) && pTest->right) ? pTest->right : pTest->left;
+	}
+	/**
+	* Stereo registers get a side dependent offset.
+	***/
+	void ApplyConstants(UINT StartRegister, UINT Vector4fCount)
+	{
+		for (UINT i = StartRegister * 4; i < (StartRegister + Vector4fCount) * 4; i++)
+			device.vsConstants[i] = m_vsRegisters[i] + (((i < STEREO_REGISTERS * 4) && m_side) ? 1000.0f : 0.0f);
+	}
+	template <class T> void Hold(T*& pHeld, T* pNew)
+	{
+		if (pNew) pNew->AddRef();
+		if (pHeld) pHeld->Release();
+		pHeld = pNew;
+	}
+	bool setDrawingSide(int side)
+	{
+		if (side == m_side)
+			return true;
+		if (m_mono && side)
+			return false;
+		m_side = side;
+		m_switches++;
+		device.renderTarget = side;
+		for (UINT slot = 0; slot < BINDING_TEXTURE_SLOTS; slot++)
+			device.textures[slot] = ActualTexture(m_textures.Get(slot));
+		ApplyConstants(0, STEREO_REGISTERS);
+		return true;
+	}
+	bool switchDrawingSide() { return setDrawingSide(1 - m_side); }
+
+	bool m_batch;
+	bool m_mono;
+	int m_side;
+	long m_switches;
+	StereoBatch m_stereoBatch;
+	BindingSlots<IDirect3DBaseTexture9, BINDING_TEXTURE_SLOTS> m_textures;
+	BindingSlots<IDirect3DVertexBuffer9, BINDING_VERTEX_STREAMS> m_streams;
+	UINT m_offsets[BINDING_VERTEX_STREAMS], m_strides[BINDING_VERTEX_STREAMS];
+	IDirect3DVertexShader9* m_pVertexShader;
+	IDirect3DPixelShader9* m_pPixelShader;
+	IDirect3DVertexDeclaration9* m_pDeclaration;
+	IDirect3DIndexBuffer9* m_pIndices;
+	RenderStateShadow m_states;
+	std::vector<float> m_vsRegisters, m_psRegisters;
+};
+
+/**
+* Objects the random game uses.
+***/
+struct TestObjects
+{
+	TestObjects()
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			textures[i].left = 100 + i;
+			textures[i].right = (i & 1) ? 200 + i : 0;
+			vertexShaders[i].id = 300 + i;
+			pixelShaders[i].id = 400 + i;
+			vertexBuffers[i].id = 500 + i;
+			indexBuffers[i].id = 600 + i;
+			declarations[i].id = 700 + i;
+		}
+	}
+	/**
+	* True if only the test holds the objects.
+	***/
+	bool Released() const
+	{
+		for (int i = 0; i < 8; i++)
+			if ((textures[i].refCount != 1) || (vertexShaders[i].refCount != 1) || (pixelShaders[i].refCount != 1) ||
+				(vertexBuffers[i].refCount != 1) || (indexBuffers[i].refCount != 1) || (declarations[i].refCount != 1))
+				return false;
+		return true;
+	}
+
+	TestTexture textures[8];
+	TestVertexShader vertexShaders[8];
+	TestPixelShader pixelShaders[8];
+	TestVertexBuffer vertexBuffers[8];
+	TestIndexBuffer indexBuffers[8];
+	TestDeclaration declarations[8];
+};
+
+/**
+* Plays a random game on the proxy, seeded. Runs of setters and draws, other calls in between.
+* The user pointer data is overwritten after each draw, as games reuse their buffers.
+***/
+static void PlayGame(TestProxy& proxy, TestObjects& objects, unsigned seed, int calls, int otherCallEvery)
+{
+	srand(seed);
+	float constants[16 * 4];
+	WORD indices[64];
+	float vertices[64 * 4];
+	const DWORD stages[] = { 0, 1, 2, 7, 15, D3DDMAPSAMPLER, D3DVERTEXTEXTURESAMPLER0, D3DVERTEXTEXTURESAMPLER3, 16 };
+	const D3DRENDERSTATETYPE renderStates[] = { D3DRS_ZENABLE, D3DRS_FILLMODE, D3DRS_CULLMODE, D3DRS_ALPHABLENDENABLE, (D3DRENDERSTATETYPE)300 };
+
+	for (int call = 0; call < calls; call++)
+	{
+		for (int i = 0; i < 16 * 4; i++) constants[i] = (float)(rand() % 100);
+		for (int i = 0; i < 64; i++) { indices[i] = (WORD)(rand() % 16); vertices[i * 4] = (float)(rand() % 100); }
+
+		if ((rand() % otherCallEvery) == 0)
+		{
+			if ((rand() % 8) == 0)
+				proxy.SetMonoRenderTarget((rand() % 2) == 0);
+			else
+				proxy.OtherCall();
+			continue;
+		}
+
+		switch (rand() % 14)
+		{
+		case 0: proxy.SetTexture(stages[rand() % 9], (rand() % 6) ? &objects.textures[rand() % 8] : NULL); break;
+		case 1: proxy.SetVertexShader((rand() % 6) ? &objects.vertexShaders[rand() % 8] : NULL); break;
+		case 2: proxy.SetPixelShader((rand() % 6) ? &objects.pixelShaders[rand() % 8] : NULL); break;
+		case 3: proxy.SetVertexDeclaration(&objects.declarations[rand() % 8]); break;
+		case 4: proxy.SetIndices(&objects.indexBuffers[rand() % 8]); break;
+		case 5: proxy.SetStreamSource((UINT)(rand() % 3), &objects.vertexBuffers[rand() % 8], (UINT)(rand() % 4) * 16, 16); break;
+		case 6: proxy.SetRenderState(renderStates[rand() % 5], (DWORD)(rand() % 4)); break;
+		case 7: proxy.SetSamplerState(stages[rand() % 9], D3DSAMP_MAGFILTER, (DWORD)(rand() % 4)); break;
+		case 8: proxy.SetTextureStageState((DWORD)(rand() % 9), D3DTSS_COLOROP, (DWORD)(rand() % 4)); break;
+		case 9:
+		{
+			UINT start = (UINT)(rand() % 32);
+			proxy.SetVertexShaderConstantF((rand() % 16) ? start : 250, constants, 1 + (UINT)(rand() % 8));
+			break;
+		}
+		case 10: proxy.SetPixelShaderConstantF((UINT)(rand() % 28), constants, 1 + (UINT)(rand() % 4)); break;
+		case 11:
+			if (rand() % 2)
+				proxy.DrawPrimitive(D3DPT_TRIANGLELIST, (UINT)(rand() % 100), 1 + (UINT)(rand() % 10));
+			else
+				proxy.DrawIndexedPrimitive(D3DPT_TRIANGLESTRIP, rand() % 10, 0, 16, (UINT)(rand() % 100), 1 + (UINT)(rand() % 10));
+			break;
+		case 12:
+			proxy.DrawPrimitiveUP(D3DPT_TRIANGLEFAN, 1 + (UINT)(rand() % 10), vertices, 16);
+			break;
+		case 13:
+			proxy.DrawIndexedPrimitiveUP(D3DPT_LINELIST, 0, 16, 1 + (UINT)(rand() % 20), indices, D3DFMT_INDEX16, vertices, 16);
+			break;
+		}
+	}
+	proxy.OtherCall();
+}
+
+/**
+* Batched and immediate proxies draw the same on both sides, the batch with fewer side switches.
+***/
+static void TestSameDraws()
+{
+	const int otherCallEvery[] = { 2, 8, 40, 1000 };
+	for (unsigned seed = 1; seed <= 40; seed++)
+	{
+		TestObjects objects;
+		{
+			TestProxy immediate(false), batched(true);
+			int every = otherCallEvery[seed % 4];
+			PlayGame(immediate, objects, seed, 3000, every);
+			PlayGame(batched, objects, seed, 3000, every);
+
+			TEST_CHECK(immediate.device.draws[0].size() > 0);
+			TEST_CHECK_EQUAL(batched.device.draws[0].size(), immediate.device.draws[0].size());
+			TEST_CHECK_EQUAL(batched.device.draws[1].size(), immediate.device.draws[1].size());
+			TEST_CHECK(batched.device.draws[0] == immediate.device.draws[0]);
+			TEST_CHECK(batched.device.draws[1] == immediate.device.draws[1]);
+			TEST_CHECK(batched.GetSideSwitches() <= immediate.GetSideSwitches());
+			if (every >= 40)
+				TEST_CHECK(batched.GetSideSwitches() * 3 < immediate.GetSideSwitches());
+			TEST_CHECK(batched.GetStereoBatch().IsEmpty());
+		}
+		TEST_CHECK(objects.Released());
+	}
+}
+
+/**
+* A run restores the state it started with : draws before the first setter of a slot see the
+* state before the run on the other side as well.
+***/
+static void TestInitialState()
+{
+	TestObjects objects;
+	float one[4] = { 1.0f, 1.0f, 1.0f, 1.0f }, two[4] = { 2.0f, 2.0f, 2.0f, 2.0f };
+	{
+		TestProxy proxy(true);
+		proxy.SetTexture(0, &objects.textures[1]);
+		proxy.SetVertexShaderConstantF(0, one, 1);
+		proxy.SetRenderState(D3DRS_CULLMODE, 1);
+		proxy.OtherCall();
+
+		proxy.DrawPrimitive(D3DPT_TRIANGLELIST, 0, 1);
+		proxy.SetTexture(0, &objects.textures[3]);
+		proxy.SetVertexShaderConstantF(0, two, 1);
+		proxy.SetRenderState(D3DRS_CULLMODE, 2);
+		proxy.DrawPrimitive(D3DPT_TRIANGLELIST, 0, 1);
+		TEST_CHECK_EQUAL(proxy.GetStereoBatch().GetDrawCount(), 2u);
+		TEST_CHECK_EQUAL(proxy.GetStereoBatch().GetCommandCount(), 5u);
+		TEST_CHECK_EQUAL(proxy.device.draws[1].size(), 0u);
+
+		// held until the replay
+		TEST_CHECK_EQUAL(objects.textures[1].refCount, 2ul);
+		TEST_CHECK_EQUAL(objects.textures[3].refCount, 3ul);
+
+		proxy.OtherCall();
+		TEST_CHECK_EQUAL(proxy.device.draws[1].size(), 2u);
+		TEST_CHECK(proxy.device.draws[0][0] != proxy.device.draws[0][1]);
+		// state after the replay is the state after the run, right side bound
+		TEST_CHECK_EQUAL(proxy.device.renderTarget, 1);
+		TEST_CHECK_EQUAL(proxy.device.textures[0], 203);
+		TEST_CHECK_EQUAL(proxy.device.vsConstants[0], 1002.0f);
+		TEST_CHECK_EQUAL(proxy.device.states[D3DRS_CULLMODE], 2u);
+		TEST_CHECK_EQUAL(objects.textures[1].refCount, 1ul);
+		TEST_CHECK_EQUAL(objects.textures[3].refCount, 2ul);
+
+		// the next run starts on the right side
+		proxy.DrawPrimitive(D3DPT_TRIANGLELIST, 0, 1);
+		TEST_CHECK_EQUAL(proxy.device.draws[1].size(), 3u);
+		TEST_CHECK_EQUAL(proxy.device.draws[0].size(), 2u);
+		proxy.OtherCall();
+		TEST_CHECK_EQUAL(proxy.device.draws[0].size(), 3u);
+		TEST_CHECK_EQUAL(proxy.device.renderTarget, 0);
+		TEST_CHECK_EQUAL(proxy.device.textures[0], 103);
+	}
+	TEST_CHECK(objects.Released());
+}
+
+/**
+* Setters without draws are dropped on flush, no side switch. Unrecordable calls flush.
+***/
+static void TestFlush()
+{
+	TestObjects objects;
+	float constants[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+	TestProxy proxy(true);
+	proxy.SetTexture(0, &objects.textures[1]);
+	proxy.SetRenderState(D3DRS_ZENABLE, 1);
+	TEST_CHECK(!proxy.GetStereoBatch().IsEmpty());
+	proxy.OtherCall();
+	TEST_CHECK(proxy.GetStereoBatch().IsEmpty());
+	TEST_CHECK_EQUAL(proxy.GetSideSwitches(), 0);
+
+	// not shadowed state, registers out of range and invalid stages can't be recorded
+	proxy.DrawPrimitive(D3DPT_TRIANGLELIST, 0, 1);
+	proxy.SetRenderState((D3DRENDERSTATETYPE)300, 1);
+	TEST_CHECK_EQUAL(proxy.GetSideSwitches(), 1);
+	proxy.DrawPrimitive(D3DPT_TRIANGLELIST, 0, 1);
+	proxy.SetVertexShaderConstantF(STEREO_BATCH_VS_CONSTANTS - 1, constants, 1);
+	TEST_CHECK_EQUAL(proxy.GetSideSwitches(), 1);
+	TEST_CHECK(!proxy.GetStereoBatch().IsEmpty());
+	proxy.SetPixelShaderConstantF(STEREO_BATCH_PS_CONSTANTS, constants, 1);
+	TEST_CHECK_EQUAL(proxy.GetSideSwitches(), 2);
+	proxy.DrawPrimitive(D3DPT_TRIANGLELIST, 0, 1);
+	proxy.SetTexture(16, NULL);
+	TEST_CHECK_EQUAL(proxy.GetSideSwitches(), 3);
+	TEST_CHECK(proxy.GetStereoBatch().IsEmpty());
+	TEST_CHECK_EQUAL(proxy.device.draws[0].size(), 3u);
+	TEST_CHECK_EQUAL(proxy.device.draws[1].size(), 3u);
+
+	// mono render target : drawn once, nothing recorded
+	proxy.SetMonoRenderTarget(true);
+	proxy.DrawPrimitive(D3DPT_TRIANGLELIST, 0, 1);
+	TEST_CHECK_EQUAL(proxy.GetStereoBatch().GetDrawCount(), 0u);
+	proxy.OtherCall();
+	TEST_CHECK_EQUAL(proxy.device.draws[0].size(), 4u);
+	TEST_CHECK_EQUAL(proxy.device.draws[1].size(), 3u);
+}
+
+/**
+* Vertex count per primitive type.
+***/
+static void TestVertexCount()
+{
+	TEST_CHECK_EQUAL(StereoBatch::VertexCount(D3DPT_POINTLIST, 5), 5u);
+	TEST_CHECK_EQUAL(StereoBatch::VertexCount(D3DPT_LINELIST, 5), 10u);
+	TEST_CHECK_EQUAL(StereoBatch::VertexCount(D3DPT_LINESTRIP, 5), 6u);
+	TEST_CHECK_EQUAL(StereoBatch::VertexCount(D3DPT_TRIANGLELIST, 5), 15u);
+	TEST_CHECK_EQUAL(StereoBatch::VertexCount(D3DPT_TRIANGLESTRIP, 5), 7u);
+	TEST_CHECK_EQUAL(StereoBatch::VertexCount(D3DPT_TRIANGLEFAN, 5), 7u);
+}
+
+/**
+* CPU time per draw in both modes, a run of draws with a few setters each (no draw logging).
+* The side switch of the mock is cheap, so this only shows the proxy side of the cost, the
+* driver work of the switches (render targets, depth stencil, textures, constants) comes on top.
+***/
+static void TestBenchmark()
+{
+	const int draws = 200000;
+	const int runLengths[] = { 1, 4, 16, 64 };
+	TestObjects objects;
+	float constants[8 * 4] = {};
+
+	for (int r = 0; r < 4; r++)
+	{
+		double nsPerDraw[2];
+		long switches[2];
+		long calls[2];
+		for (int batch = 0; batch < 2; batch++)
+		{
+			TestProxy proxy(batch != 0);
+			proxy.device.logging = false;
+			std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+			for (int draw = 0; draw < draws; draw++)
+			{
+				proxy.SetTexture(0, &objects.textures[draw & 7]);
+				proxy.SetVertexShaderConstantF(0, constants, 8);
+				proxy.SetRenderState(D3DRS_CULLMODE, (DWORD)(draw & 3));
+				proxy.DrawIndexedPrimitive(D3DPT_TRIANGLELIST, 0, 0, 16, 0, 8);
+				if ((draw % runLengths[r]) == runLengths[r] - 1)
+					proxy.OtherCall();
+			}
+			proxy.OtherCall();
+			std::chrono::duration<double, std::nano> elapsed = std::chrono::high_resolution_clock::now() - start;
+			nsPerDraw[batch] = elapsed.count() / draws;
+			switches[batch] = proxy.GetSideSwitches();
+			calls[batch] = proxy.device.calls;
+		}
+		printf("run of %2d draws : immediate %6.1f ns/draw %.2f switches/draw, stereo batch %6.1f ns/draw %.2f switches/draw\n",
+			runLengths[r], nsPerDraw[0], (double)switches[0] / draws, nsPerDraw[1], (double)switches[1] / draws);
+
+		TEST_CHECK_EQUAL(calls[0], 2L * draws);
+		TEST_CHECK_EQUAL(calls[1], 2L * draws);
+		TEST_CHECK_EQUAL(switches[0], (long)draws);
+		TEST_CHECK_EQUAL(switches[1], (long)(draws / runLengths[r]));
+	}
+	TEST_CHECK(objects.Released());
+}
+
+int main()
+{
+	TestVertexCount();
+	TestInitialState();
+	TestFlush();
+	TestSameDraws();
+	TestBenchmark();
+	return TestResult("StereoBatchTest");
+}
@@ -0,0 +1,92 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <StereoConstantSetTest.cpp> :
+StereoConstantSet against the per shader std::map of modified
+constants it replaced (first constant added for a start register
+wins), and interning the way ShaderModificationRepository does it :
+equal binding lists must give the same shared set.
+********************************************************************/
+#include <d3d9.h>
+#include <map>
+#include <memory>
+#include <vector>
+#include <stdlib.h>
+#include "StereoConstantSet.h"
+#include "TestCheck.h"
+
+typedef std::shared_ptr<ShaderConstantModification<float>> ModificationPtr;
+typedef std::map<std::vector<StereoConstantBinding>, std::shared_ptr<const StereoConstantSet>> ConstantSetMap;
+
+/**
+* Same as ShaderModificationRepository::InternConstantSet().
+***/
+static std::shared_ptr<const StereoConstantSet> InternConstantSet(ConstantSetMap& sets, std::vector<StereoConstantBinding>& bindings)
+{
+	StereoConstantSet::Normalize(bindings);
+
+	ConstantSetMap::iterator itSet = sets.find(bindings);
+	if (itSet != sets.end())
+		return itSet->second;
+
+	std::shared_ptr<const StereoConstantSet> constantSet = std::make_shared<StereoConstantSet>(bindings);
+	sets.insert(std::make_pair(bindings, constantSet));
+	return constantSet;
+}
+
+/**
+* Random binding lists against the map model.
+***/
+static void TestAgainstMapModel()
+{
+	const UINT registerCount = 16;
+	ModificationPtr modifications[3];
+	for (int i = 0; i < 3; i++)
+		modifications[i] = std::make_shared<ShaderConstantModification<float>>();
+
+	ConstantSetMap sets;
+	srand(46);
+	for (int run = 0; run < 20000; run++)
+	{
+		std::vector<StereoConstantBinding> bindings;
+		std::map<UINT, StereoConstantBinding> model;
+		int count = rand() % 8;
+		for (int i = 0; i < count; i++)
+		{
+			StereoConstantBinding binding = { (UINT)(rand() % registerCount), (UINT)(1 + rand() % 4), modifications[rand() % 3] };
+			bindings.push_back(binding);
+			model.insert(std::make_pair(binding.startRegister, binding));
+		}
+		std::vector<StereoConstantBinding> unsorted(bindings);
+
+		std::shared_ptr<const StereoConstantSet> constantSet = InternConstantSet(sets, bindings);
+		TEST_CHECK_EQUAL(constantSet->Size(), model.size());
+
+		UINT index = 0;
+		for (std::map<UINT, StereoConstantBinding>::iterator it = model.begin(); it != model.end(); ++it, index++)
+		{
+			const StereoConstantBinding& binding = (*constantSet)[index];
+			TEST_CHECK_EQUAL(binding.startRegister, it->first);
+			TEST_CHECK_EQUAL(binding.count, it->second.count);
+			TEST_CHECK(binding.modification == it->second.modification);
+			TEST_CHECK_EQUAL(constantSet->Find(it->first), (int)index);
+		}
+		for (UINT startRegister = 0; startRegister <= registerCount; startRegister++)
+		{
+			if (!model.count(startRegister))
+				TEST_CHECK_EQUAL(constantSet->Find(startRegister), -1);
+		}
+
+		// the same bindings again, interned to the same set
+		TEST_CHECK(InternConstantSet(sets, unsorted) == constantSet);
+	}
+
+	// a few modifications on 16 registers, the sets must be shared
+	TEST_CHECK(sets.size() < 20000);
+}
+
+int main()
+{
+	TestAgainstMapModel();
+	return TestResult("StereoConstantSetTest");
+}
@@ -0,0 +1,36 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <TestCheck.h> :
+Minimal check macros for the unit tests. Each test is a plain
+executable, a non zero exit code fails the CTest run.
+********************************************************************/
+#ifndef VIREIO_TEST_CHECK_H
+#define VIREIO_TEST_CHECK_H
+
+#include <stdio.h>
+
+/**
+* Number of failed checks of this test executable.
+***/
+static int g_nTestFailures = 0;
+
+#define TEST_CHECK(condition) \
+	do { if (!(condition)) { g_nTestFailures++; fprintf(stderr, "%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); } } while (0)
+
+#define TEST_CHECK_EQUAL(actual, expected) \
+	do { if (!((actual) == (expected))) { g_nTestFailures++; fprintf(stderr, "%s:%d: check failed: %s == %s (%lld != %lld)\n", __FILE__, __LINE__, #actual, #expected, (long long)(actual), (long long)(expected)); } } while (0)
+
+/**
+* Prints the result, returns the exit code for main().
+***/
+inline int TestResult(const char* szTest)
+{
+	if (g_nTestFailures)
+		fprintf(stderr, "%s: %d check(s) failed\n", szTest, g_nTestFailures);
+	else
+		printf("%s: passed\n", szTest);
+	return g_nTestFailures ? 1 : 0;
+}
+
+#endif
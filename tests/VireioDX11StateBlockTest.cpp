@@ -0,0 +1,297 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <VireioDX11StateBlockTest.cpp> :
+Vireio_DX11StateBlock.h against the mock context in shim/d3d11.h :
+a game state in every slot, a partial state block around an overlay
+(or a distortion pass) drawing into the masked slots, then the game
+state must be back, with the same reference counts. Also checks that
+ApplyStateblockMasked() touches only the masked slots, the number of
+slots transferred and the full state block for comparison.
+********************************************************************/
+#include <vector>
+#include <string.h>
+#include "Vireio_DX11StateBlock.h"
+#include "TestCheck.h"
+
+/**
+* Objects created by the test, kept for the reference count checks.
+***/
+static std::vector<IUnknown*> g_apObjects;
+
+/**
+* Creates an object of the given interface.
+***/
+template <class T> T* Create()
+{
+	T* p = new T();
+	g_apObjects.push_back(p);
+	return p;
+}
+
+/**
+* Reference counts of all objects.
+***/
+static std::vector<unsigned long> RefCounts()
+{
+	std::vector<unsigned long> aunCounts;
+	for (size_t i = 0; i < g_apObjects.size(); i++)
+		aunCounts.push_back(g_apObjects[i]->refCount);
+	return aunCounts;
+}
+
+/**
+* Deletes the objects, the mock context does not release its bindings.
+***/
+static void Cleanup()
+{
+	for (size_t i = 0; i < g_apObjects.size(); i++)
+		delete g_apObjects[i];
+	g_apObjects.clear();
+}
+
+/**
+* A game state : every slot of every graphics stage bound.
+***/
+static void SetGameState(ID3D11DeviceContext* pcContext)
+{
+	pcContext->VSSetShader(Create<ID3D11VertexShader>(), NULL, 0);
+	pcContext->GSSetShader(Create<ID3D11GeometryShader>(), NULL, 0);
+	pcContext->HSSetShader(Create<ID3D11HullShader>(), NULL, 0);
+	pcContext->DSSetShader(Create<ID3D11DomainShader>(), NULL, 0);
+	pcContext->PSSetShader(Create<ID3D11PixelShader>(), NULL, 0);
+
+	for (UINT i = 0; i < D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT; i++)
+	{
+		ID3D11SamplerState* pcSampler = Create<ID3D11SamplerState>();
+		pcContext->VSSetSamplers(i, 1, &pcSampler);
+		pcContext->GSSetSamplers(i, 1, &pcSampler);
+		pcContext->HSSetSamplers(i, 1, &pcSampler);
+		pcContext->DSSetSamplers(i, 1, &pcSampler);
+		pcContext->PSSetSamplers(i, 1, &pcSampler);
+	}
+	for (UINT i = 0; i < D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT; i++)
+	{
+		ID3D11ShaderResourceView* pcView = Create<ID3D11ShaderResourceView>();
+		pcContext->VSSetShaderResources(i, 1, &pcView);
+		pcContext->GSSetShaderResources(i, 1, &pcView);
+		pcContext->HSSetShaderResources(i, 1, &pcView);
+		pcContext->DSSetShaderResources(i, 1, &pcView);
+		pcContext->PSSetShaderResources(i, 1, &pcView);
+	}
+	for (UINT i = 0; i < D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT; i++)
+	{
+		ID3D11Buffer* pcBuffer = Create<ID3D11Buffer>();
+		pcContext->VSSetConstantBuffers(i, 1, &pcBuffer);
+		pcContext->GSSetConstantBuffers(i, 1, &pcBuffer);
+		pcContext->HSSetConstantBuffers(i, 1, &pcBuffer);
+		pcContext->DSSetConstantBuffers(i, 1, &pcBuffer);
+		pcContext->PSSetConstantBuffers(i, 1, &pcBuffer);
+	}
+	for (UINT i = 0; i < D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT; i++)
+	{
+		ID3D11Buffer* pcBuffer = Create<ID3D11Buffer>();
+		UINT unStride = 16 + i, unOffset = 4 * i;
+		pcContext->IASetVertexBuffers(i, 1, &pcBuffer, &unStride, &unOffset);
+	}
+	pcContext->IASetIndexBuffer(Create<ID3D11Buffer>(), DXGI_FORMAT_R32_UINT, 12);
+	pcContext->IASetInputLayout(Create<ID3D11InputLayout>());
+	pcContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP);
+
+	ID3D11RenderTargetView* apcRTV[3] = { Create<ID3D11RenderTargetView>(), Create<ID3D11RenderTargetView>(), Create<ID3D11RenderTargetView>() };
+	pcContext->OMSetRenderTargets(3, apcRTV, Create<ID3D11DepthStencilView>());
+	pcContext->OMSetDepthStencilState(Create<ID3D11DepthStencilState>(), 3);
+	const FLOAT afFactor[4] = { 0.1f, 0.2f, 0.3f, 0.4f };
+	pcContext->OMSetBlendState(Create<ID3D11BlendState>(), afFactor, 0xff);
+
+	D3D11_VIEWPORT asViewports[2] = { { 0.0f, 0.0f, 960.0f, 1080.0f, 0.0f, 1.0f }, { 960.0f, 0.0f, 960.0f, 1080.0f, 0.0f, 1.0f } };
+	pcContext->RSSetViewports(2, asViewports);
+	D3D11_RECT sScissor = { 10, 20, 300, 400 };
+	pcContext->RSSetScissorRects(1, &sScissor);
+	pcContext->RSSetState(Create<ID3D11RasterizerState>());
+
+	ID3D11Buffer* pcSOBuffer = Create<ID3D11Buffer>();
+	UINT unSOOffset = 0;
+	pcContext->SOSetTargets(1, &pcSOBuffer, &unSOOffset);
+	pcContext->SetPredication(Create<ID3D11Predicate>(), TRUE);
+
+	// the context holds the references now
+	for (size_t i = 0; i < g_apObjects.size(); i++)
+		g_apObjects[i]->Release();
+}
+
+/**
+* What the overlays set (menu, cinema, stereo splitter), within D3DX11_STATE_BLOCK_MASK_OVERLAY.
+***/
+static void DrawOverlay(ID3D11DeviceContext* pcContext)
+{
+	pcContext->VSSetShader(Create<ID3D11VertexShader>(), NULL, 0);
+	pcContext->PSSetShader(Create<ID3D11PixelShader>(), NULL, 0);
+	ID3D11Buffer* apcConstants[2] = { Create<ID3D11Buffer>(), Create<ID3D11Buffer>() };
+	pcContext->VSSetConstantBuffers(0, 2, apcConstants);
+	pcContext->PSSetConstantBuffers(0, 1, apcConstants);
+	ID3D11ShaderResourceView* pcView = Create<ID3D11ShaderResourceView>();
+	pcContext->PSSetShaderResources(0, 1, &pcView);
+	ID3D11SamplerState* pcSampler = Create<ID3D11SamplerState>();
+	pcContext->PSSetSamplers(0, 1, &pcSampler);
+
+	ID3D11Buffer* apcVertices[2] = { Create<ID3D11Buffer>(), Create<ID3D11Buffer>() };
+	UINT aunStrides[2] = { 20, 32 }, aunOffsets[2] = { 0, 0 };
+	pcContext->IASetVertexBuffers(0, 2, apcVertices, aunStrides, aunOffsets);
+	pcContext->IASetIndexBuffer(Create<ID3D11Buffer>(), DXGI_FORMAT_R16_UINT, 0);
+	pcContext->IASetInputLayout(Create<ID3D11InputLayout>());
+	pcContext->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+	ID3D11RenderTargetView* pcRTV = Create<ID3D11RenderTargetView>();
+	pcContext->OMSetRenderTargets(1, &pcRTV, NULL);
+	pcContext->OMSetDepthStencilState(Create<ID3D11DepthStencilState>(), 0);
+	pcContext->OMSetBlendState(Create<ID3D11BlendState>(), NULL, 0xffffffff);
+	D3D11_VIEWPORT sViewport = { 0.0f, 0.0f, 1920.0f, 1080.0f, 0.0f, 1.0f };
+	pcContext->RSSetViewports(1, &sViewport);
+	pcContext->RSSetState(Create<ID3D11RasterizerState>());
+}
+
+/**
+* A distortion pass of an HMD runtime, within D3DX11_STATE_BLOCK_MASK_DISTORTION.
+***/
+static void DrawDistortion(ID3D11DeviceContext* pcContext)
+{
+	DrawOverlay(pcContext);
+
+	ID3D11Buffer* apcConstants[4] = { Create<ID3D11Buffer>(), Create<ID3D11Buffer>(), Create<ID3D11Buffer>(), Create<ID3D11Buffer>() };
+	pcContext->VSSetConstantBuffers(0, 4, apcConstants);
+	pcContext->PSSetConstantBuffers(0, 4, apcConstants);
+	ID3D11ShaderResourceView* apcViews[4] = { Create<ID3D11ShaderResourceView>(), NULL, Create<ID3D11ShaderResourceView>(), Create<ID3D11ShaderResourceView>() };
+	pcContext->VSSetShaderResources(0, 4, apcViews);
+	pcContext->PSSetShaderResources(0, 4, apcViews);
+	ID3D11SamplerState* apcSamplers[4] = { Create<ID3D11SamplerState>(), Create<ID3D11SamplerState>(), NULL, NULL };
+	pcContext->VSSetSamplers(0, 4, apcSamplers);
+	pcContext->PSSetSamplers(0, 4, apcSamplers);
+	D3D11_RECT sScissor = { 0, 0, 1920, 1080 };
+	pcContext->RSSetScissorRects(1, &sScissor);
+}
+
+/**
+* Number of slots a masked state block transfers.
+***/
+static long MaskedSlots(const D3DX11_STATE_BLOCK_MASK& sMask)
+{
+	return sMask.VSSamplers + sMask.VSShaderResources + sMask.VSConstantBuffers +
+		sMask.PSSamplers + sMask.PSShaderResources + sMask.PSConstantBuffers + sMask.IAVertexBuffers +
+		(sMask.OMRenderTargets ? D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT : 0) + (sMask.SOTargets ? 4 : 0);
+}
+
+/**
+* Partial state block around a draw within the mask : the game state is restored.
+***/
+static void TestRestore(const D3DX11_STATE_BLOCK_MASK& sMask, void(*pDraw)(ID3D11DeviceContext*))
+{
+	ID3D11DeviceContext cContext;
+	SetGameState(&cContext);
+	MockContextState sGameState;
+	memcpy(&sGameState, &cContext.sState, sizeof(MockContextState));
+	std::vector<unsigned long> aunRefCounts = RefCounts();
+
+	cContext.slotGets = cContext.slotSets = 0;
+	D3DX11_STATE_BLOCK sStateBlock;
+	CreateStateblock(&cContext, &sStateBlock, sMask);
+	TEST_CHECK(sStateBlock.Masked);
+	TEST_CHECK_EQUAL(cContext.slotGets, MaskedSlots(sMask));
+	TEST_CHECK(RefCounts() == aunRefCounts);
+
+	// cleared in the mask, bound outside
+	ClearContextState(&cContext, sMask);
+	TEST_CHECK(cContext.sState.asStages[4].pShader == NULL);
+	TEST_CHECK(cContext.sState.asStages[4].apShaderResources[0] == NULL);
+	TEST_CHECK(cContext.sState.asStages[4].apShaderResources[sMask.PSShaderResources] == sGameState.asStages[4].apShaderResources[sMask.PSShaderResources]);
+	TEST_CHECK(cContext.sState.apVertexBuffers[sMask.IAVertexBuffers] == sGameState.apVertexBuffers[sMask.IAVertexBuffers]);
+
+	pDraw(&cContext);
+	cContext.slotSets = 0;
+	ApplyStateblock(&cContext, &sStateBlock);
+	TEST_CHECK_EQUAL(cContext.slotSets, MaskedSlots(sMask));
+	TEST_CHECK(memcmp(&sGameState, &cContext.sState, sizeof(MockContextState)) == 0);
+
+	// the draw objects are no longer bound, the game objects hold the same references
+	std::vector<unsigned long> aunAfter = RefCounts();
+	aunAfter.resize(aunRefCounts.size());
+	TEST_CHECK(aunAfter == aunRefCounts);
+	for (size_t i = aunRefCounts.size(); i < g_apObjects.size(); i++)
+		TEST_CHECK_EQUAL(g_apObjects[i]->refCount, 1);
+
+	Cleanup();
+}
+
+/**
+* ApplyStateblockMasked() leaves everything outside the mask as it is.
+***/
+static void TestOutsideMask()
+{
+	ID3D11DeviceContext cContext;
+	SetGameState(&cContext);
+	MockContextState sGameState;
+	memcpy(&sGameState, &cContext.sState, sizeof(MockContextState));
+
+	D3DX11_STATE_BLOCK sStateBlock;
+	CreateStateblock(&cContext, &sStateBlock, D3DX11_STATE_BLOCK_MASK_OVERLAY);
+
+	// bind outside the mask (slots above the masked ranges, compute shader stage untouched)
+	ID3D11ShaderResourceView* pcView = Create<ID3D11ShaderResourceView>();
+	cContext.PSSetShaderResources(5, 1, &pcView);
+	ID3D11Buffer* pcBuffer = Create<ID3D11Buffer>();
+	cContext.VSSetConstantBuffers(2, 1, &pcBuffer);
+	ID3D11SamplerState* pcSampler = Create<ID3D11SamplerState>();
+	cContext.VSSetSamplers(0, 1, &pcSampler);
+	// and inside
+	cContext.PSSetShaderResources(0, 1, &pcView);
+	cContext.VSSetConstantBuffers(1, 1, &pcBuffer);
+
+	long lCalls = cContext.calls;
+	ApplyStateblockMasked(&cContext, &sStateBlock);
+	TEST_CHECK(cContext.calls - lCalls < 30);
+
+	TEST_CHECK(cContext.sState.asStages[4].apShaderResources[5] == pcView);
+	TEST_CHECK(cContext.sState.asStages[0].apConstantBuffers[2] == pcBuffer);
+	TEST_CHECK(cContext.sState.asStages[0].apSamplers[0] == pcSampler);
+	TEST_CHECK(cContext.sState.asStages[4].apShaderResources[0] == sGameState.asStages[4].apShaderResources[0]);
+	TEST_CHECK(cContext.sState.asStages[0].apConstantBuffers[1] == sGameState.asStages[0].apConstantBuffers[1]);
+
+	Cleanup();
+}
+
+/**
+* The full state block restores the same and transfers every slot.
+***/
+static void TestFull()
+{
+	ID3D11DeviceContext cContext;
+	SetGameState(&cContext);
+	MockContextState sGameState;
+	memcpy(&sGameState, &cContext.sState, sizeof(MockContextState));
+	std::vector<unsigned long> aunRefCounts = RefCounts();
+
+	cContext.slotGets = 0;
+	D3DX11_STATE_BLOCK sStateBlock;
+	CreateStateblock(&cContext, &sStateBlock);
+	TEST_CHECK(!sStateBlock.Masked);
+	TEST_CHECK(cContext.slotGets > 20 * MaskedSlots(D3DX11_STATE_BLOCK_MASK_OVERLAY));
+
+	ClearContextState(&cContext, D3DX11_STATE_BLOCK_MASK_OVERLAY);
+	DrawOverlay(&cContext);
+	ApplyStateblock(&cContext, &sStateBlock);
+	TEST_CHECK(memcmp(&sGameState, &cContext.sState, sizeof(MockContextState)) == 0);
+	std::vector<unsigned long> aunAfter = RefCounts();
+	aunAfter.resize(aunRefCounts.size());
+	TEST_CHECK(aunAfter == aunRefCounts);
+
+	Cleanup();
+}
+
+int main()
+{
+	TestRestore(D3DX11_STATE_BLOCK_MASK_OVERLAY, DrawOverlay);
+	TestRestore(D3DX11_STATE_BLOCK_MASK_DISTORTION, DrawDistortion);
+	TestOutsideMask();
+	TestFull();
+	return TestResult("VireioDX11StateBlockTest");
+}
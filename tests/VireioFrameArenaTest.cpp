@@ -0,0 +1,145 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <VireioFrameArenaTest.cpp> :
+VireioFrameArena : alignment, scope rewind (nested), the block merge
+at the end of the outermost scope (steady state without heap calls),
+poisoning of rewound memory, the byte counters and the STL allocator,
+as used by VireioMatrixModifier::VerifyConstantBuffer.
+********************************************************************/
+#include <vector>
+#include <stdint.h>
+#include <string.h>
+#include "Vireio_FrameArena.h"
+#include "TestCheck.h"
+
+/**
+* Allocations are aligned and don't overlap.
+***/
+static void TestAlignment()
+{
+	VireioFrameArena cArena(1024, false);
+	VireioFrameArena::Scope sScope(cArena);
+
+	const size_t aunAlign[] = { 1, 2, 4, 8, 16, 64, 256 };
+	std::vector<uint8_t*> apData;
+	for (int nI = 0; nI < 200; nI++)
+	{
+		size_t unAlign = aunAlign[nI % 7];
+		uint8_t* pData = (uint8_t*)cArena.Allocate(1 + nI % 37, unAlign);
+		TEST_CHECK(pData != nullptr);
+		TEST_CHECK_EQUAL((size_t)pData & (unAlign - 1), 0);
+		memset(pData, nI & 0xff, 1 + nI % 37);
+		apData.push_back(pData);
+	}
+	for (int nI = 0; nI < 200; nI++)
+		for (int nJ = 0; nJ < 1 + nI % 37; nJ++)
+			TEST_CHECK(apData[nI][nJ] == (nI & 0xff));
+}
+
+/**
+* A scope frees its allocations, nested scopes rewind to their own start.
+***/
+static void TestScopes()
+{
+	VireioFrameArena cArena(4096, false);
+	{
+		VireioFrameArena::Scope sOuter(cArena);
+		void* pOuter = cArena.Allocate(100);
+		size_t unOuterBytes = cArena.GetStats().unFrameBytes;
+		void* pInner = nullptr;
+		{
+			VireioFrameArena::Scope sInner(cArena);
+			pInner = cArena.Allocate(500);
+			TEST_CHECK(cArena.GetStats().unFrameBytes > unOuterBytes);
+		}
+		TEST_CHECK_EQUAL(cArena.GetStats().unFrameBytes, unOuterBytes);
+
+		// the inner memory is reused
+		void* pAgain = cArena.Allocate(500);
+		TEST_CHECK(pAgain == pInner);
+		TEST_CHECK(pOuter != pAgain);
+	}
+	TEST_CHECK_EQUAL(cArena.GetStats().unFrameBytes, 0);
+}
+
+/**
+* Calls needing more than one block are merged into one at the end of the outermost scope,
+* the same call then makes no heap allocation.
+***/
+static void TestMerge()
+{
+	VireioFrameArena cArena(1024, false);
+	for (int nCall = 0; nCall < 4; nCall++)
+	{
+		VireioFrameArena::Scope sScope(cArena);
+		for (int nI = 0; nI < 100; nI++)
+			cArena.Allocate(100, 16);
+	}
+	TEST_CHECK(cArena.GetStats().unPeakBytes >= 100 * 100);
+	TEST_CHECK(cArena.GetStats().unCapacity >= cArena.GetStats().unPeakBytes);
+
+	unsigned long long unHeap = cArena.GetStats().unHeapAllocations;
+	for (int nCall = 0; nCall < 100; nCall++)
+	{
+		VireioFrameArena::Scope sScope(cArena);
+		for (int nI = 0; nI < 100; nI++)
+			cArena.Allocate(100, 16);
+	}
+	TEST_CHECK_EQUAL(cArena.GetStats().unHeapAllocations, unHeap);
+	TEST_CHECK_EQUAL(cArena.GetStats().unAllocations, 104 * 100);
+	TEST_CHECK_EQUAL(cArena.GetStats().unBytes, 104 * 100 * 100);
+}
+
+/**
+* Rewound memory is poisoned.
+***/
+static void TestPoison()
+{
+	VireioFrameArena cArena(1024, true);
+	VireioFrameArena::Scope sOuter(cArena);
+	uint8_t* pKept = (uint8_t*)cArena.Allocate(64);
+	memset(pKept, 1, 64);
+	uint8_t* pData = nullptr;
+	{
+		VireioFrameArena::Scope sInner(cArena);
+		pData = (uint8_t*)cArena.Allocate(64);
+		memset(pData, 1, 64);
+	}
+	for (int nI = 0; nI < 64; nI++)
+	{
+		TEST_CHECK(pKept[nI] == 1);
+		TEST_CHECK(pData[nI] == 0xCD);
+	}
+}
+
+/**
+* STL containers on the arena.
+***/
+static void TestAllocator()
+{
+	VireioFrameArena cArena(1024, false);
+	{
+		VireioFrameArena::Scope sScope(cArena);
+		std::vector<int, VireioArenaAllocator<int>> anValues{ VireioArenaAllocator<int>(cArena) };
+		for (int nI = 0; nI < 1000; nI++)
+			anValues.push_back(nI);
+		for (int nI = 0; nI < 1000; nI++)
+			TEST_CHECK_EQUAL(anValues[nI], nI);
+
+		std::vector<bool, VireioArenaAllocator<bool>> abFlags(100, false, VireioArenaAllocator<bool>(cArena));
+		abFlags[5] = true;
+		TEST_CHECK(abFlags[5] && !abFlags[4]);
+	}
+	TEST_CHECK_EQUAL(cArena.GetStats().unFrameBytes, 0);
+}
+
+int main()
+{
+	TestAlignment();
+	TestScopes();
+	TestMerge();
+	TestPoison();
+	TestAllocator();
+	return TestResult("VireioFrameArenaTest");
+}
@@ -0,0 +1,164 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <VireioFrameTransferRingTest.cpp> :
+VireioFrameTransferRing with a simulated GPU copy delay, as the
+cinema node uses it (StretchRect to the slot render target, read back
+and lock with D3DLOCK_DONOTWAIT latency frames later). Checks the
+latency the consumer sees, that no readback is locked before it is
+due, that frames are shown in order and the drop and busy counters.
+********************************************************************/
+#include <stdlib.h>
+#include "Vireio_FrameTransferRing.h"
+#include "TestCheck.h"
+
+/**
+* Simulated readbacks : frame issued to each slot and frame its copy is done.
+***/
+struct SimulatedGPU
+{
+	unsigned long long aunIssued[VireioFrameTransferRing::MAX_SLOTS];
+	unsigned long long aunReady[VireioFrameTransferRing::MAX_SLOTS];
+};
+
+/**
+* Result of a simulation.
+***/
+struct SimulationResult
+{
+	unsigned long long unShown;       /**< Frames with a consumed readback. **/
+	unsigned long long unEarly;       /**< Slots tried before being due. **/
+	unsigned long long unOutOfOrder;  /**< Consumed frames older than the one shown before. **/
+	unsigned long long unMaxAge;      /**< Highest frame age consumed. **/
+};
+
+/**
+* Runs the ring for a number of frames, each copy takes unDelay frames plus up to unJitter frames.
+***/
+static SimulationResult Simulate(VireioFrameTransferRing& cRing, unsigned unDelay, unsigned unJitter, unsigned unFrames)
+{
+	SimulatedGPU sGPU = {};
+	SimulationResult sResult = {};
+	unsigned long long unLastShown = 0;
+	bool bShown = false;
+	srand(unDelay * 16 + unJitter);
+
+	for (unsigned long long unFrame = 0; unFrame < unFrames; unFrame++)
+	{
+		unsigned unSlot = cRing.Issue();
+		TEST_CHECK(unSlot < cRing.GetSlotCount());
+		sGPU.aunIssued[unSlot] = unFrame;
+		sGPU.aunReady[unSlot] = unFrame + unDelay + (unJitter ? (unsigned)(rand() % (unJitter + 1)) : 0);
+
+		bool bSynchronous = (cRing.GetLatency() == 0);
+		bool bConsumed = cRing.Consume([&](unsigned unSlotRead) -> bool
+		{
+			unsigned long long unAge = unFrame - sGPU.aunIssued[unSlotRead];
+			if (unAge < cRing.GetLatency()) sResult.unEarly++;
+
+			// D3DERR_WASSTILLDRAWING, the synchronous lock waits
+			if ((!bSynchronous) && (sGPU.aunReady[unSlotRead] > unFrame)) return false;
+
+			if (bShown && (sGPU.aunIssued[unSlotRead] <= unLastShown)) sResult.unOutOfOrder++;
+			unLastShown = sGPU.aunIssued[unSlotRead];
+			bShown = true;
+			if (unAge > sResult.unMaxAge) sResult.unMaxAge = unAge;
+			return true;
+		});
+		if (bConsumed) sResult.unShown++;
+		cRing.EndFrame();
+	}
+	return sResult;
+}
+
+/**
+* Copies done within the latency : one frame shown per frame, exactly latency frames late.
+***/
+static void TestInTime()
+{
+	for (unsigned unLatency = 0; unLatency <= VireioFrameTransferRing::MAX_LATENCY; unLatency++)
+	{
+		for (unsigned unDelay = 0; unDelay <= unLatency; unDelay++)
+		{
+			VireioFrameTransferRing cRing(unLatency);
+			SimulationResult sResult = Simulate(cRing, unDelay, 0, 1000);
+
+			TEST_CHECK_EQUAL(sResult.unShown, 1000 - unLatency);
+			TEST_CHECK_EQUAL(sResult.unEarly, 0);
+			TEST_CHECK_EQUAL(sResult.unOutOfOrder, 0);
+			TEST_CHECK_EQUAL(sResult.unMaxAge, unLatency);
+			TEST_CHECK_EQUAL(cRing.GetStats().unIssued, 1000);
+			TEST_CHECK_EQUAL(cRing.GetStats().unConsumed, 1000 - unLatency);
+			TEST_CHECK_EQUAL(cRing.GetStats().unDropped, 0);
+			TEST_CHECK_EQUAL(cRing.GetStats().unBusy, unLatency);
+			TEST_CHECK(cRing.GetAverageLatency() == (float)unLatency);
+		}
+	}
+}
+
+/**
+* Copies later than the latency : late readbacks are consumed from the spare slot or dropped,
+* the consumer never waits and never goes back in time.
+***/
+static void TestLate()
+{
+	for (unsigned unLatency = 1; unLatency <= 3; unLatency++)
+	{
+		for (unsigned unJitter = 1; unJitter <= 3; unJitter++)
+		{
+			VireioFrameTransferRing cRing(unLatency);
+			SimulationResult sResult = Simulate(cRing, unLatency, unJitter, 5000);
+			const VireioFrameTransferRing::Stats& sStats = cRing.GetStats();
+
+			TEST_CHECK_EQUAL(sResult.unEarly, 0);
+			TEST_CHECK_EQUAL(sResult.unOutOfOrder, 0);
+			TEST_CHECK(sResult.unMaxAge < cRing.GetSlotCount());
+			TEST_CHECK(sResult.unShown > 0);
+			TEST_CHECK_EQUAL(sStats.unConsumed, sResult.unShown);
+			TEST_CHECK_EQUAL(sStats.unIssued, 5000);
+			TEST_CHECK_EQUAL(sStats.unBusy, 5000 - sResult.unShown);
+			// every readback is consumed, dropped or still in the ring
+			TEST_CHECK(sStats.unConsumed + sStats.unDropped <= sStats.unIssued);
+			TEST_CHECK(sStats.unConsumed + sStats.unDropped + cRing.GetSlotCount() >= sStats.unIssued);
+			TEST_CHECK(cRing.GetAverageLatency() >= (float)unLatency);
+			TEST_CHECK(cRing.GetAverageLatency() <= (float)(unLatency + unJitter));
+		}
+	}
+}
+
+/**
+* A GPU slower than the ring : nothing is ever ready in time, all readbacks are dropped.
+***/
+static void TestStalled()
+{
+	VireioFrameTransferRing cRing(2);
+	SimulationResult sResult = Simulate(cRing, 10, 0, 100);
+	TEST_CHECK_EQUAL(sResult.unShown, 0);
+	TEST_CHECK_EQUAL(cRing.GetStats().unBusy, 100);
+	TEST_CHECK_EQUAL(cRing.GetStats().unDropped, 100 - cRing.GetSlotCount());
+}
+
+/**
+* Latency clamp and reset.
+***/
+static void TestSettings()
+{
+	VireioFrameTransferRing cRing(100);
+	TEST_CHECK_EQUAL(cRing.GetLatency(), VireioFrameTransferRing::MAX_LATENCY);
+	TEST_CHECK_EQUAL(cRing.GetSlotCount(), VireioFrameTransferRing::MAX_SLOTS);
+
+	Simulate(cRing, 0, 0, 50);
+	cRing.SetLatency(1);
+	TEST_CHECK_EQUAL(cRing.GetSlotCount(), 3);
+	TEST_CHECK_EQUAL(cRing.GetStats().unIssued, 0);
+	TEST_CHECK_EQUAL(cRing.GetStats().unConsumed, 0);
+}
+
+int main()
+{
+	TestInTime();
+	TestLate();
+	TestStalled();
+	TestSettings();
+	return TestResult("VireioFrameTransferRingTest");
+}
@@ -0,0 +1,169 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <VireioLogTest.cpp> :
+VireioLog ring and rate limit : no message lost below the ring size,
+long messages split in entries that join to the full text, drops
+counted on a full ring, and the per call site burst, deduplication
+and suppressed count report.
+********************************************************************/
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include "Vireio_Log.h"
+#include "TestCheck.h"
+
+/**
+* Messages written by the sink.
+***/
+static std::mutex g_sinkMutex;
+static std::vector<std::string> g_written;
+/**
+* True to hold the writer thread in the sink.
+***/
+static std::atomic<bool> g_bHoldSink(false);
+
+/**
+* Collects the written messages.
+***/
+static void Sink(int nLevel, const char* szMessage)
+{
+	while (g_bHoldSink.load())
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+	std::lock_guard<std::mutex> lock(g_sinkMutex);
+	g_written.push_back(szMessage);
+}
+
+/**
+* Writes all queued messages, returns and clears them.
+***/
+static std::vector<std::string> Written()
+{
+	VireioLog::Get().Flush();
+	std::lock_guard<std::mutex> lock(g_sinkMutex);
+	std::vector<std::string> written;
+	written.swap(g_written);
+	return written;
+}
+
+/**
+* No site, no rate limit : every message is written, in order.
+***/
+static void TestNoLoss()
+{
+	VireioLog::Stats before = VireioLog::Get().GetStats();
+	for (int i = 0; i < (int)VireioLog::RING_SIZE / 2; i++)
+		VireioLog::Get().Write(VIREIO_LOG_LEVEL_INFO, NULL, "message %d", i);
+
+	std::vector<std::string> written = Written();
+	TEST_CHECK_EQUAL(written.size(), VireioLog::RING_SIZE / 2);
+	for (size_t i = 0; i < written.size(); i++)
+		TEST_CHECK(written[i] == "message " + std::to_string(i));
+	TEST_CHECK_EQUAL(VireioLog::Get().GetStats().unDropped, before.unDropped);
+	TEST_CHECK_EQUAL(VireioLog::Get().GetStats().unSuppressed, before.unSuppressed);
+}
+
+/**
+* Long messages are split in entries of MESSAGE_SIZE - 1 characters.
+***/
+static void TestSplit()
+{
+	const size_t lengths[] = { VireioLog::MESSAGE_SIZE - 1, VireioLog::MESSAGE_SIZE, 3 * VireioLog::MESSAGE_SIZE + 17, 8000 };
+	for (size_t k = 0; k < sizeof(lengths) / sizeof(lengths[0]); k++)
+	{
+		std::string text;
+		for (size_t i = 0; i < lengths[k]; i++)
+			text += (char)('a' + (i * 7 + k) % 26);
+		VireioLog::Get().Write(VIREIO_LOG_LEVEL_INFO, NULL, "%s", text.c_str());
+
+		std::vector<std::string> written = Written();
+		TEST_CHECK_EQUAL(written.size(), (lengths[k] + VireioLog::MESSAGE_SIZE - 2) / (VireioLog::MESSAGE_SIZE - 1));
+		std::string joined;
+		for (size_t i = 0; i < written.size(); i++)
+		{
+			TEST_CHECK(written[i].size() <= VireioLog::MESSAGE_SIZE - 1);
+			joined += written[i];
+		}
+		TEST_CHECK(joined == text);
+	}
+}
+
+/**
+* A held writer fills the ring, further messages are dropped and counted.
+***/
+static void TestDrop()
+{
+	VireioLog::Stats before = VireioLog::Get().GetStats();
+	g_bHoldSink = true;
+	VireioLog::Get().Write(VIREIO_LOG_LEVEL_INFO, NULL, "held");
+	while (VireioLog::Get().GetStats().unQueued == before.unQueued)
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	// wait for the writer to take the message (and hold in the sink)
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+	const int extra = 100;
+	for (int i = 0; i < (int)VireioLog::RING_SIZE + extra; i++)
+		VireioLog::Get().Write(VIREIO_LOG_LEVEL_INFO, NULL, "fill %d", i);
+	TEST_CHECK_EQUAL(VireioLog::Get().GetStats().unDropped - before.unDropped, extra);
+	g_bHoldSink = false;
+
+	// the writer reports the drops once the ring is empty
+	VireioLog::Get().Flush();
+	std::this_thread::sleep_for(std::chrono::milliseconds(100));
+	std::vector<std::string> written = Written();
+	TEST_CHECK_EQUAL(written.size(), VireioLog::RING_SIZE + 2);
+	if (written.size() == VireioLog::RING_SIZE + 2)
+		TEST_CHECK(written.back() == "[LOG] " + std::to_string(extra) + " messages dropped");
+}
+
+/**
+* A call site writes RATE_BURST messages per window, repeats are collapsed, the suppressed
+* count goes with the next message of the site.
+***/
+static void TestRateLimit()
+{
+	static const char* szVarying = "[TEST] value %d";
+	static const char* szRepeated = "[TEST] No Input Textures !";
+
+	// the first message opens a new window
+	std::this_thread::sleep_for(std::chrono::milliseconds(VireioLog::RATE_WINDOW_MS + 100));
+
+	VireioLog::Stats before = VireioLog::Get().GetStats();
+	for (int i = 0; i < 100; i++)
+		VireioLog::Get().Write(VIREIO_LOG_LEVEL_WARNING, szVarying, szVarying, i);
+	for (int i = 0; i < 100; i++)
+		VireioLog::Get().Write(VIREIO_LOG_LEVEL_WARNING, szRepeated, szRepeated);
+
+	std::vector<std::string> written = Written();
+	TEST_CHECK_EQUAL(written.size(), VireioLog::RATE_BURST + 1);
+	for (size_t i = 0; (i < written.size()) && (i < VireioLog::RATE_BURST); i++)
+		TEST_CHECK(written[i] == "[TEST] value " + std::to_string(i));
+	TEST_CHECK_EQUAL(VireioLog::Get().GetStats().unSuppressed - before.unSuppressed, 100 - VireioLog::RATE_BURST + 99);
+
+	// next window
+	std::this_thread::sleep_for(std::chrono::milliseconds(VireioLog::RATE_WINDOW_MS + 100));
+	VireioLog::Get().Write(VIREIO_LOG_LEVEL_WARNING, szVarying, szVarying, 1000);
+	VireioLog::Get().Write(VIREIO_LOG_LEVEL_WARNING, szRepeated, szRepeated);
+	written = Written();
+	TEST_CHECK_EQUAL(written.size(), 2);
+	if (written.size() == 2)
+	{
+		TEST_CHECK(written[0] == "[TEST] value 1000 (+" + std::to_string(100 - VireioLog::RATE_BURST) + " suppressed)");
+		TEST_CHECK(written[1] == "[TEST] No Input Textures ! (+99 suppressed)");
+	}
+}
+
+int main()
+{
+	VireioLog::Get().SetSink(Sink);
+	TestNoLoss();
+	TestSplit();
+	TestDrop();
+	TestRateLimit();
+	VireioLog::Get().Shutdown();
+	return TestResult("VireioLogTest");
+}
@@ -0,0 +1,29 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <D3D9ProxyPixelShader.h> (test mock) :
+Proxy pixel shader reduced to its modified constant set.
+********************************************************************/
+#ifndef D3D9PROXYPIXELSHADER_H_INCLUDED
+#define D3D9PROXYPIXELSHADER_H_INCLUDED
+
+#include <memory>
+#include "StereoConstantSet.h"
+
+#ifndef _SAFE_RELEASE
+#define _SAFE_RELEASE(x) if(x) { x->Release(); x = NULL; }
+#endif
+
+class D3D9ProxyPixelShader
+{
+public:
+	D3D9ProxyPixelShader() : refCount(1) {}
+	ULONG AddRef() { return ++refCount; }
+	ULONG Release() { return --refCount; }
+	const StereoConstantSet* ModifiedConstants() { return set.get(); }
+
+	std::shared_ptr<const StereoConstantSet> set;
+	ULONG refCount;
+};
+
+#endif
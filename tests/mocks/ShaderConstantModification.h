@@ -0,0 +1,31 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <ShaderConstantModification.h> (test mock) :
+Stands in for the modification base class, which pulls in the view
+adjustment. Left is 2x+1, right is 3x-1 of the input data.
+********************************************************************/
+#ifndef SHADERCONSTANTMODIFICATION_H_INCLUDED
+#define SHADERCONSTANTMODIFICATION_H_INCLUDED
+
+#include <memory>
+#include <vector>
+#include "d3d9.h"
+#include "VireioUtil.h"
+
+template <class T=float>
+class ShaderConstantModification
+{
+public:
+	virtual ~ShaderConstantModification() {}
+	virtual void ApplyModification(const T* inData, std::vector<T>* outLeft, std::vector<T>* outRight)
+	{
+		for (size_t i = 0; i < outLeft->size(); i++)
+		{
+			(*outLeft)[i] = inData[i] * 2 + 1;
+			(*outRight)[i] = inData[i] * 3 - 1;
+		}
+	}
+};
+
+#endif
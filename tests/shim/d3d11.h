@@ -0,0 +1,228 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <d3d11.h> :
+Minimal Direct3D 11 shim for the unit tests. Declares the types the
+state block header uses and a mock device context : all bindings
+are kept in one plain state structure (holding a reference like the
+runtime does), calls and transferred slots are counted.
+********************************************************************/
+#ifndef __d3d11_h__
+#define __d3d11_h__
+
+#include "windows.h"
+
+#define D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT                   16
+#define D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT            128
+#define D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT       14
+#define D3D11_SHADER_MAX_INTERFACES                             253
+#define D3D11_PS_CS_UAV_REGISTER_COUNT                          8
+#define D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT               32
+#define D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT                  8
+#define D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE 16
+#define D3D11_SO_BUFFER_SLOT_COUNT                              4
+
+typedef enum DXGI_FORMAT { DXGI_FORMAT_UNKNOWN = 0, DXGI_FORMAT_R32_UINT = 42, DXGI_FORMAT_R16_UINT = 57 } DXGI_FORMAT;
+typedef enum D3D_PRIMITIVE_TOPOLOGY
+{
+	D3D10_PRIMITIVE_TOPOLOGY_UNDEFINED = 0, D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED = 0,
+	D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST = 4, D3D11_PRIMITIVE_TOPOLOGY_TRIANGLESTRIP = 5
+} D3D_PRIMITIVE_TOPOLOGY;
+typedef D3D_PRIMITIVE_TOPOLOGY D3D11_PRIMITIVE_TOPOLOGY;
+
+typedef struct D3D11_VIEWPORT { FLOAT TopLeftX; FLOAT TopLeftY; FLOAT Width; FLOAT Height; FLOAT MinDepth; FLOAT MaxDepth; } D3D11_VIEWPORT;
+typedef RECT D3D11_RECT;
+
+struct ID3D11DeviceChild : public IUnknown {};
+struct ID3D11VertexShader : public ID3D11DeviceChild {};
+struct ID3D11GeometryShader : public ID3D11DeviceChild {};
+struct ID3D11HullShader : public ID3D11DeviceChild {};
+struct ID3D11DomainShader : public ID3D11DeviceChild {};
+struct ID3D11PixelShader : public ID3D11DeviceChild {};
+struct ID3D11ComputeShader : public ID3D11DeviceChild {};
+struct ID3D11ClassInstance : public ID3D11DeviceChild {};
+struct ID3D11SamplerState : public ID3D11DeviceChild {};
+struct ID3D11ShaderResourceView : public ID3D11DeviceChild {};
+struct ID3D11UnorderedAccessView : public ID3D11DeviceChild {};
+struct ID3D11RenderTargetView : public ID3D11DeviceChild {};
+struct ID3D11DepthStencilView : public ID3D11DeviceChild {};
+struct ID3D11Buffer : public ID3D11DeviceChild {};
+struct ID3D11InputLayout : public ID3D11DeviceChild {};
+struct ID3D11DepthStencilState : public ID3D11DeviceChild {};
+struct ID3D11BlendState : public ID3D11DeviceChild {};
+struct ID3D11RasterizerState : public ID3D11DeviceChild {};
+struct ID3D11Predicate : public ID3D11DeviceChild {};
+
+/**
+* Bindings of one shader stage.
+***/
+struct MockShaderStage
+{
+	IUnknown* pShader;
+	IUnknown* apSamplers[D3D11_COMMONSHADER_SAMPLER_SLOT_COUNT];
+	IUnknown* apShaderResources[D3D11_COMMONSHADER_INPUT_RESOURCE_SLOT_COUNT];
+	IUnknown* apConstantBuffers[D3D11_COMMONSHADER_CONSTANT_BUFFER_API_SLOT_COUNT];
+};
+
+/**
+* All bindings of the mock context, plain data to be compared with memcmp().
+***/
+struct MockContextState
+{
+	MockShaderStage asStages[5];
+	IUnknown* apVertexBuffers[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	UINT aunStrides[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	UINT aunOffsets[D3D11_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT];
+	IUnknown* pIndexBuffer;
+	DXGI_FORMAT eIndexFormat;
+	UINT unIndexOffset;
+	IUnknown* pInputLayout;
+	D3D11_PRIMITIVE_TOPOLOGY eTopology;
+	IUnknown* apRenderTargets[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT];
+	IUnknown* pDepthStencilView;
+	IUnknown* pDepthStencilState;
+	UINT unStencilRef;
+	IUnknown* pBlendState;
+	FLOAT afBlendFactor[4];
+	UINT unSampleMask;
+	UINT unViewports;
+	D3D11_VIEWPORT asViewports[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+	UINT unScissorRects;
+	D3D11_RECT asScissorRects[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+	IUnknown* pRasterizerState;
+	IUnknown* apSOTargets[D3D11_SO_BUFFER_SLOT_COUNT];
+	IUnknown* pPredicate;
+	BOOL bPredicateValue;
+};
+
+#define MOCK_D3D11_STAGE(X, Shader, n) \
+	void X##GetShader(Shader** ppShader, ID3D11ClassInstance** ppInstances, UINT* pNum) { GetBinding(sState.asStages[n].pShader, (IUnknown**)ppShader); if (pNum) *pNum = 0; } \
+	void X##SetShader(Shader* pShader, ID3D11ClassInstance* const* ppInstances, UINT unNum) { calls++; Bind(sState.asStages[n].pShader, pShader); } \
+	void X##GetSamplers(UINT unStart, UINT unNum, ID3D11SamplerState** pp) { GetSlots(sState.asStages[n].apSamplers, unStart, unNum, (IUnknown**)pp); } \
+	void X##SetSamplers(UINT unStart, UINT unNum, ID3D11SamplerState* const* pp) { SetSlots(sState.asStages[n].apSamplers, unStart, unNum, (IUnknown* const*)pp); } \
+	void X##GetShaderResources(UINT unStart, UINT unNum, ID3D11ShaderResourceView** pp) { GetSlots(sState.asStages[n].apShaderResources, unStart, unNum, (IUnknown**)pp); } \
+	void X##SetShaderResources(UINT unStart, UINT unNum, ID3D11ShaderResourceView* const* pp) { SetSlots(sState.asStages[n].apShaderResources, unStart, unNum, (IUnknown* const*)pp); } \
+	void X##GetConstantBuffers(UINT unStart, UINT unNum, ID3D11Buffer** pp) { GetSlots(sState.asStages[n].apConstantBuffers, unStart, unNum, (IUnknown**)pp); } \
+	void X##SetConstantBuffers(UINT unStart, UINT unNum, ID3D11Buffer* const* pp) { SetSlots(sState.asStages[n].apConstantBuffers, unStart, unNum, (IUnknown* const*)pp); }
+
+/**
+* Mock device context.
+***/
+struct ID3D11DeviceContext : public IUnknown
+{
+	ID3D11DeviceContext() : calls(0), slotGets(0), slotSets(0) { memset(&sState, 0, sizeof(sState)); sState.unSampleMask = 0xffffffff; }
+
+	MOCK_D3D11_STAGE(VS, ID3D11VertexShader, 0)
+	MOCK_D3D11_STAGE(GS, ID3D11GeometryShader, 1)
+	MOCK_D3D11_STAGE(HS, ID3D11HullShader, 2)
+	MOCK_D3D11_STAGE(DS, ID3D11DomainShader, 3)
+	MOCK_D3D11_STAGE(PS, ID3D11PixelShader, 4)
+
+	void IAGetVertexBuffers(UINT unStart, UINT unNum, ID3D11Buffer** pp, UINT* pStrides, UINT* pOffsets)
+	{
+		GetSlots(sState.apVertexBuffers, unStart, unNum, (IUnknown**)pp);
+		for (UINT i = 0; i < unNum; i++) { pStrides[i] = sState.aunStrides[unStart + i]; pOffsets[i] = sState.aunOffsets[unStart + i]; }
+	}
+	void IASetVertexBuffers(UINT unStart, UINT unNum, ID3D11Buffer* const* pp, const UINT* pStrides, const UINT* pOffsets)
+	{
+		SetSlots(sState.apVertexBuffers, unStart, unNum, (IUnknown* const*)pp);
+		for (UINT i = 0; i < unNum; i++) { sState.aunStrides[unStart + i] = pStrides ? pStrides[i] : 0; sState.aunOffsets[unStart + i] = pOffsets ? pOffsets[i] : 0; }
+	}
+	void IAGetIndexBuffer(ID3D11Buffer** pp, DXGI_FORMAT* pFormat, UINT* pOffset) { GetBinding(sState.pIndexBuffer, (IUnknown**)pp); *pFormat = sState.eIndexFormat; *pOffset = sState.unIndexOffset; }
+	void IASetIndexBuffer(ID3D11Buffer* p, DXGI_FORMAT eFormat, UINT unOffset) { calls++; Bind(sState.pIndexBuffer, p); sState.eIndexFormat = eFormat; sState.unIndexOffset = unOffset; }
+	void IAGetInputLayout(ID3D11InputLayout** pp) { GetBinding(sState.pInputLayout, (IUnknown**)pp); }
+	void IASetInputLayout(ID3D11InputLayout* p) { calls++; Bind(sState.pInputLayout, p); }
+	void IAGetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY* p) { calls++; *p = sState.eTopology; }
+	void IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY e) { calls++; sState.eTopology = e; }
+
+	void OMGetRenderTargets(UINT unNum, ID3D11RenderTargetView** pp, ID3D11DepthStencilView** ppDSV)
+	{
+		if (pp) GetSlots(sState.apRenderTargets, 0, unNum, (IUnknown**)pp);
+		if (ppDSV) GetBinding(sState.pDepthStencilView, (IUnknown**)ppDSV);
+	}
+	void OMSetRenderTargets(UINT unNum, ID3D11RenderTargetView* const* pp, ID3D11DepthStencilView* pDSV)
+	{
+		// unbinds all slots past the ones set
+		SetSlots(sState.apRenderTargets, 0, unNum, (IUnknown* const*)pp);
+		for (UINT i = unNum; i < D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT; i++) Bind(sState.apRenderTargets[i], NULL);
+		Bind(sState.pDepthStencilView, pDSV);
+	}
+	void OMGetDepthStencilState(ID3D11DepthStencilState** pp, UINT* pRef) { GetBinding(sState.pDepthStencilState, (IUnknown**)pp); *pRef = sState.unStencilRef; }
+	void OMSetDepthStencilState(ID3D11DepthStencilState* p, UINT unRef) { calls++; Bind(sState.pDepthStencilState, p); sState.unStencilRef = unRef; }
+	void OMGetBlendState(ID3D11BlendState** pp, FLOAT afFactor[4], UINT* pMask) { GetBinding(sState.pBlendState, (IUnknown**)pp); memcpy(afFactor, sState.afBlendFactor, sizeof(sState.afBlendFactor)); *pMask = sState.unSampleMask; }
+	void OMSetBlendState(ID3D11BlendState* p, const FLOAT afFactor[4], UINT unMask)
+	{
+		calls++; Bind(sState.pBlendState, p); sState.unSampleMask = unMask;
+		for (int i = 0; i < 4; i++) sState.afBlendFactor[i] = afFactor ? afFactor[i] : 1.0f;
+	}
+
+	void RSGetViewports(UINT* pNum, D3D11_VIEWPORT* p)
+	{
+		calls++;
+		if (p) for (UINT i = 0; (i < *pNum) && (i < sState.unViewports); i++) p[i] = sState.asViewports[i];
+		*pNum = sState.unViewports;
+	}
+	void RSSetViewports(UINT unNum, const D3D11_VIEWPORT* p)
+	{
+		calls++; memset(sState.asViewports, 0, sizeof(sState.asViewports));
+		sState.unViewports = unNum;
+		for (UINT i = 0; i < unNum; i++) sState.asViewports[i] = p[i];
+	}
+	void RSGetScissorRects(UINT* pNum, D3D11_RECT* p)
+	{
+		calls++;
+		if (p) for (UINT i = 0; (i < *pNum) && (i < sState.unScissorRects); i++) p[i] = sState.asScissorRects[i];
+		*pNum = sState.unScissorRects;
+	}
+	void RSSetScissorRects(UINT unNum, const D3D11_RECT* p)
+	{
+		calls++; memset(sState.asScissorRects, 0, sizeof(sState.asScissorRects));
+		sState.unScissorRects = unNum;
+		for (UINT i = 0; i < unNum; i++) sState.asScissorRects[i] = p[i];
+	}
+	void RSGetState(ID3D11RasterizerState** pp) { GetBinding(sState.pRasterizerState, (IUnknown**)pp); }
+	void RSSetState(ID3D11RasterizerState* p) { calls++; Bind(sState.pRasterizerState, p); }
+
+	void SOGetTargets(UINT unNum, ID3D11Buffer** pp) { GetSlots(sState.apSOTargets, 0, unNum, (IUnknown**)pp); }
+	void SOSetTargets(UINT unNum, ID3D11Buffer* const* pp, const UINT* pOffsets)
+	{
+		SetSlots(sState.apSOTargets, 0, unNum, (IUnknown* const*)pp);
+		for (UINT i = unNum; i < D3D11_SO_BUFFER_SLOT_COUNT; i++) Bind(sState.apSOTargets[i], NULL);
+	}
+	void GetPredication(ID3D11Predicate** pp, BOOL* pValue) { GetBinding(sState.pPredicate, (IUnknown**)pp); *pValue = sState.bPredicateValue; }
+	void SetPredication(ID3D11Predicate* p, BOOL bValue) { calls++; Bind(sState.pPredicate, p); sState.bPredicateValue = bValue; }
+
+	/**
+	* Binds an object, the context holds a reference as the runtime does.
+	***/
+	static void Bind(IUnknown*& pSlot, IUnknown* p)
+	{
+		if (p) p->AddRef();
+		if (pSlot) pSlot->Release();
+		pSlot = p;
+	}
+	void GetBinding(IUnknown* pSlot, IUnknown** pp)
+	{
+		calls++;
+		*pp = pSlot;
+		if (pSlot) pSlot->AddRef();
+	}
+	void GetSlots(IUnknown* const* apSlots, UINT unStart, UINT unNum, IUnknown** pp)
+	{
+		calls++; slotGets += unNum;
+		for (UINT i = 0; i < unNum; i++) { pp[i] = apSlots[unStart + i]; if (pp[i]) pp[i]->AddRef(); }
+	}
+	void SetSlots(IUnknown** apSlots, UINT unStart, UINT unNum, IUnknown* const* pp)
+	{
+		calls++; slotSets += unNum;
+		for (UINT i = 0; i < unNum; i++) Bind(apSlots[unStart + i], pp ? pp[i] : NULL);
+	}
+
+	MockContextState sState;
+	long calls;
+	long slotGets, slotSets;
+};
+
+#undef MOCK_D3D11_STAGE
+
+#endif
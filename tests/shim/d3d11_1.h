@@ -0,0 +1,10 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <d3d11_1.h> :
+Test shim, nothing of Direct3D 11.1 is used by the tested code.
+********************************************************************/
+#ifndef __d3d11_1_h__
+#define __d3d11_1_h__
+#include "d3d11.h"
+#endif
@@ -0,0 +1,117 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <d3d9.h> :
+Minimal Direct3D 9 shim for the unit tests. Declares the types the
+tested headers use and a recording mock device : states and shader
+constants are kept in plain arrays, every call is counted so tests
+can compare call and upload numbers.
+********************************************************************/
+#ifndef VIREIO_TEST_SHIM_D3D9_H
+#define VIREIO_TEST_SHIM_D3D9_H
+
+#include "windows.h"
+#include <map>
+#include <vector>
+
+#define D3D_OK             S_OK
+#define D3DERR_INVALIDCALL ((HRESULT)0x8876086CL)
+#define D3DERR_WASSTILLDRAWING ((HRESULT)0x8876021CL)
+
+#define D3DLOCK_READONLY         0x00000010L
+#define D3DLOCK_DISCARD          0x00002000L
+#define D3DLOCK_NOOVERWRITE      0x00001000L
+#define D3DLOCK_NO_DIRTY_UPDATE  0x00008000L
+#define D3DLOCK_DONOTWAIT        0x00004000L
+
+#define D3DDMAPSAMPLER          256
+#define D3DVERTEXTEXTURESAMPLER0 (D3DDMAPSAMPLER + 1)
+#define D3DVERTEXTEXTURESAMPLER1 (D3DDMAPSAMPLER + 2)
+#define D3DVERTEXTEXTURESAMPLER2 (D3DDMAPSAMPLER + 3)
+#define D3DVERTEXTEXTURESAMPLER3 (D3DDMAPSAMPLER + 4)
+
+typedef enum _D3DRENDERSTATETYPE { D3DRS_ZENABLE = 7, D3DRS_FILLMODE = 8, D3DRS_CULLMODE = 22, D3DRS_ALPHABLENDENABLE = 27, D3DRS_BLENDOPALPHA = 209 } D3DRENDERSTATETYPE;
+typedef enum _D3DSAMPLERSTATETYPE { D3DSAMP_ADDRESSU = 1, D3DSAMP_MAGFILTER = 5, D3DSAMP_DMAPOFFSET = 13 } D3DSAMPLERSTATETYPE;
+typedef enum _D3DTEXTURESTAGESTATETYPE { D3DTSS_COLOROP = 1, D3DTSS_CONSTANT = 32 } D3DTEXTURESTAGESTATETYPE;
+
+typedef struct _D3DMATRIX { float m[4][4]; } D3DMATRIX;
+
+typedef enum _D3DPRIMITIVETYPE { D3DPT_POINTLIST = 1, D3DPT_LINELIST = 2, D3DPT_LINESTRIP = 3, D3DPT_TRIANGLELIST = 4, D3DPT_TRIANGLESTRIP = 5, D3DPT_TRIANGLEFAN = 6 } D3DPRIMITIVETYPE;
+typedef enum _D3DFORMAT { D3DFMT_UNKNOWN = 0, D3DFMT_INDEX16 = 101, D3DFMT_INDEX32 = 102 } D3DFORMAT;
+
+struct IDirect3DResource9 : public IUnknown {};
+struct IDirect3DBaseTexture9 : public IDirect3DResource9 {};
+struct IDirect3DTexture9 : public IDirect3DBaseTexture9 {};
+struct IDirect3DVertexBuffer9 : public IDirect3DResource9 {};
+struct IDirect3DIndexBuffer9 : public IDirect3DResource9 {};
+struct IDirect3DSurface9 : public IDirect3DResource9 {};
+struct IDirect3DVertexShader9 : public IUnknown {};
+struct IDirect3DPixelShader9 : public IUnknown {};
+struct IDirect3DVertexDeclaration9 : public IUnknown {};
+
+/**
+* Recording mock device.
+***/
+struct IDirect3DDevice9 : public IUnknown
+{
+	IDirect3DDevice9() :
+		vsConstants(256 * 4, 0.0f), psConstants(224 * 4, 0.0f),
+		stateSets(0), stateGets(0), vsConstantCalls(0), psConstantCalls(0),
+		vsConstantRegisters(0), psConstantRegisters(0), updateSurfaceCalls(0), updateSurfacePixels(0) {}
+
+	HRESULT SetRenderState(D3DRENDERSTATETYPE State, DWORD Value) { stateSets++; renderStates[(UINT)State] = Value; return D3D_OK; }
+	HRESULT GetRenderState(D3DRENDERSTATETYPE State, DWORD* pValue) { stateGets++; *pValue = renderStates[(UINT)State]; return D3D_OK; }
+	HRESULT SetSamplerState(DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD Value) { stateSets++; samplerStates[Sampler * 64 + (UINT)Type] = Value; return D3D_OK; }
+	HRESULT GetSamplerState(DWORD Sampler, D3DSAMPLERSTATETYPE Type, DWORD* pValue) { stateGets++; *pValue = samplerStates[Sampler * 64 + (UINT)Type]; return D3D_OK; }
+	HRESULT SetTextureStageState(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD Value) { stateSets++; stageStates[Stage * 64 + (UINT)Type] = Value; return D3D_OK; }
+	HRESULT GetTextureStageState(DWORD Stage, D3DTEXTURESTAGESTATETYPE Type, DWORD* pValue) { stateGets++; *pValue = stageStates[Stage * 64 + (UINT)Type]; return D3D_OK; }
+
+	HRESULT SetVertexShaderConstantF(UINT StartRegister, const float* pConstantData, UINT Vector4fCount)
+	{
+		if ((StartRegister + Vector4fCount) * 4 > vsConstants.size()) return D3DERR_INVALIDCALL;
+		vsConstantCalls++; vsConstantRegisters += Vector4fCount;
+		for (UINT i = 0; i < Vector4fCount * 4; i++) vsConstants[StartRegister * 4 + i] = pConstantData[i];
+		return D3D_OK;
+	}
+	HRESULT SetPixelShaderConstantF(UINT StartRegister, const float* pConstantData, UINT Vector4fCount)
+	{
+		if ((StartRegister + Vector4fCount) * 4 > psConstants.size()) return D3DERR_INVALIDCALL;
+		psConstantCalls++; psConstantRegisters += Vector4fCount;
+		for (UINT i = 0; i < Vector4fCount * 4; i++) psConstants[StartRegister * 4 + i] = pConstantData[i];
+		return D3D_OK;
+	}
+
+	HRESULT UpdateSurface(IDirect3DSurface9* pSourceSurface, const RECT* pSourceRect, IDirect3DSurface9* pDestinationSurface, const POINT* pDestPoint)
+	{
+		updateSurfaceCalls++;
+		UpdateSurfaceCall call;
+		call.pSource = pSourceSurface;
+		call.pDestination = pDestinationSurface;
+		call.full = (pSourceRect == NULL);
+		if (pSourceRect) call.rect = *pSourceRect; else memset(&call.rect, 0, sizeof(RECT));
+		if (pDestPoint) call.point = *pDestPoint; else memset(&call.point, 0, sizeof(POINT));
+		updateSurfaceLog.push_back(call);
+		if (pSourceRect) updateSurfacePixels += (long long)(pSourceRect->right - pSourceRect->left) * (pSourceRect->bottom - pSourceRect->top);
+		return D3D_OK;
+	}
+
+	struct UpdateSurfaceCall
+	{
+		IDirect3DSurface9* pSource;
+		IDirect3DSurface9* pDestination;
+		bool full;
+		RECT rect;
+		POINT point;
+	};
+
+	std::map<UINT, DWORD> renderStates, samplerStates, stageStates;
+	std::vector<float> vsConstants, psConstants;
+	std::vector<UpdateSurfaceCall> updateSurfaceLog;
+	long stateSets, stateGets;
+	long vsConstantCalls, psConstantCalls;
+	long vsConstantRegisters, psConstantRegisters;
+	long updateSurfaceCalls;
+	long long updateSurfacePixels;
+};
+
+#endif
@@ -0,0 +1,7 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <d3dx9.h> :
+Test shim, nothing of D3DX is used by the tested code.
+********************************************************************/
+#include "d3d9.h"
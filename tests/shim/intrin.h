@@ -0,0 +1,7 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <intrin.h> :
+Test shim, the intrinsics live in the windows.h shim.
+********************************************************************/
+#include "windows.h"
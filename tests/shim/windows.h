@@ -0,0 +1,76 @@
+/********************************************************************
+Vireio Perception: Open-Source Stereoscopic 3D Driver
+
+File <windows.h> :
+Minimal Win32 type shim, lets the platform neutral Vireio headers
+compile with g++ / clang on Linux for the unit tests.
+Only what the tested headers actually use is declared.
+********************************************************************/
+#ifndef VIREIO_TEST_SHIM_WINDOWS_H
+#define VIREIO_TEST_SHIM_WINDOWS_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef unsigned int   UINT;
+typedef uint32_t       DWORD;
+typedef unsigned long  ULONG;
+typedef int32_t        LONG;
+typedef int32_t        HRESULT;
+typedef int            BOOL;
+typedef int            INT;
+typedef unsigned char  BYTE;
+typedef unsigned short WORD;
+typedef float          FLOAT;
+typedef void*          HANDLE;
+typedef long long      LONGLONG;
+
+#ifndef TRUE
+#define TRUE  1
+#define FALSE 0
+#endif
+#ifndef NULL
+#define NULL 0
+#endif
+
+#define WINAPI
+#define CONST const
+
+#define S_OK          ((HRESULT)0)
+#define S_FALSE       ((HRESULT)1)
+#define E_FAIL        ((HRESULT)0x80004005L)
+#define E_OUTOFMEMORY ((HRESULT)0x8007000EL)
+#define SUCCEEDED(hr) (((HRESULT)(hr)) >= 0)
+#define FAILED(hr)    (((HRESULT)(hr)) < 0)
+
+typedef struct tagRECT { LONG left; LONG top; LONG right; LONG bottom; } RECT;
+typedef struct tagPOINT { LONG x; LONG y; } POINT;
+
+inline void OutputDebugStringA(const char*) {}
+
+#define ZeroMemory(p, n) memset((p), 0, (n))
+
+/**
+* Reference counted interface base.
+***/
+struct IUnknown
+{
+	IUnknown() : refCount(1) {}
+	virtual ~IUnknown() {}
+	ULONG AddRef() { return ++refCount; }
+	ULONG Release() { return --refCount; }
+	unsigned long refCount;
+};
+
+/**
+* MSVC bit scan intrinsic.
+***/
+inline unsigned char _BitScanForward(unsigned long* pIndex, unsigned long mask)
+{
+	if (!mask) return 0;
+	*pIndex = (unsigned long)__builtin_ctzl(mask);
+	return 1;
+}
+
+#endif